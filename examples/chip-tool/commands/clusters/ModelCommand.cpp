@@ -20,6 +20,10 @@
 
 #include <inttypes.h>
 
+#if CONFIG_DEVICE_LAYER
+#include <platform/CHIPDeviceLayer.h>
+#endif
+
 using namespace ::chip;
 
 namespace {
@@ -42,19 +46,42 @@ CHIP_ERROR ModelCommand::Run(PersistentStorage & storage, NodeId localId, NodeId
     err = mCommissioner.ServiceEvents();
     VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Run Loop: %s", ErrorStr(err)));
 
-    err = mCommissioner.GetDevice(remoteId, &mDevice);
-    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(chipTool, "Init failure! No pairing for device: %" PRIu64, localId));
+    err = RunWithCommissioner(mCommissioner, remoteId);
+    SuccessOrExit(err);
 
-    err = SendCommand(mDevice, mEndPointId);
-    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(chipTool, "Failed to send message: %s", ErrorStr(err)));
+exit:
+    mCommissioner.ServiceEventSignal();
+    mCommissioner.Shutdown();
+    return err;
+}
 
+CHIP_ERROR ModelCommand::RunWithCommissioner(ChipDeviceCommissioner & commissioner, NodeId remoteId)
+{
+    CHIP_ERROR err      = CHIP_NO_ERROR;
+    ChipDevice * device = nullptr;
+
+    // The response is handled on the thread running the stack, possibly before SendCommand returns.
     UpdateWaitForResponse(true);
+
+#if CONFIG_DEVICE_LAYER
+    chip::DeviceLayer::PlatformMgr().LockChipStack();
+#endif
+    err = commissioner.GetDevice(remoteId, &device);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = SendCommand(device, mEndPointId);
+    }
+#if CONFIG_DEVICE_LAYER
+    chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+#endif
+
+    VerifyOrExit(device != nullptr, ChipLogError(chipTool, "Init failure! No pairing for device: %" PRIu64, remoteId));
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(chipTool, "Failed to send message: %s", ErrorStr(err)));
+
     WaitForResponse(kWaitDurationInSeconds);
 
     VerifyOrExit(GetCommandExitStatus(), err = CHIP_ERROR_INTERNAL);
 
 exit:
-    mCommissioner.ServiceEventSignal();
-    mCommissioner.Shutdown();
     return err;
 }
@@ -36,11 +36,11 @@ public:
 
     /////////// Command Interface /////////
     CHIP_ERROR Run(PersistentStorage & storage, NodeId localId, NodeId remoteId) override;
+    CHIP_ERROR RunWithCommissioner(ChipDeviceCommissioner & commissioner, NodeId remoteId) override;
 
     virtual CHIP_ERROR SendCommand(ChipDevice * device, uint8_t endPointId) = 0;
 
 private:
     ChipDeviceCommissioner mCommissioner;
-    ChipDevice * mDevice;
     uint8_t mEndPointId;
 };
@@ -324,5 +324,7 @@ void Command::WaitForResponse(uint16_t duration)
     if (!cvWaitingForResponse.wait_until(lk, waitingUntil, [this]() { return !this->mWaitingForResponse; }))
     {
         ChipLogError(chipTool, "No response from device");
+        // A command run before may have left a success status.
+        mCommandExitStatus = false;
     }
 }
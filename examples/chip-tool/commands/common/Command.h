@@ -142,6 +142,21 @@ public:
 
     virtual CHIP_ERROR Run(PersistentStorage & storage, NodeId localId, NodeId remoteId) = 0;
 
+    /**
+     * @brief
+     *   Run the command through a commissioner that is already running, as the commands of a script share one
+     *   instead of setting the stack up for each of them. This is called from threads other than the one running
+     *   the stack.
+     *
+     * @param commissioner The commissioner the device of the command is paired with
+     * @param remoteId     The node id of the device
+     * @returns CHIP_ERROR_NOT_IMPLEMENTED for the commands that need a commissioner of their own
+     */
+    virtual CHIP_ERROR RunWithCommissioner(ChipDeviceCommissioner & commissioner, NodeId remoteId)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
     bool GetCommandExitStatus() const { return mCommandExitStatus; }
     void SetCommandExitStatus(bool status)
     {
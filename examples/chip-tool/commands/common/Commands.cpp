@@ -64,10 +64,28 @@ exit:
 }
 
 CHIP_ERROR Commands::RunCommand(PersistentStorage & storage, NodeId localId, NodeId remoteId, int argc, char ** argv)
+{
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    Command * command = nullptr;
+
+    err = ParseCommand(argc, argv, &command);
+    SuccessOrExit(err);
+
+    err = command->Run(storage, localId, remoteId);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Run command failure: %s", chip::ErrorStr(err));
+        ExitNow();
+    }
+
+exit:
+    return err;
+}
+
+CHIP_ERROR Commands::ParseCommand(int argc, char ** argv, Command ** command)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     std::map<std::string, CommandsVector>::iterator cluster;
-    Command * command = nullptr;
 
     if (argc <= 1)
     {
@@ -93,8 +111,8 @@ CHIP_ERROR Commands::RunCommand(PersistentStorage & storage, NodeId localId, Nod
 
     if (!IsGlobalCommand(argv[2]))
     {
-        command = GetCommand(cluster->second, argv[2]);
-        if (command == nullptr)
+        *command = GetCommand(cluster->second, argv[2]);
+        if (*command == nullptr)
         {
             ChipLogError(chipTool, "Unknown command: %s", argv[2]);
             ShowCluster(argv[0], argv[1], cluster->second);
@@ -110,8 +128,8 @@ CHIP_ERROR Commands::RunCommand(PersistentStorage & storage, NodeId localId, Nod
             ExitNow(err = CHIP_ERROR_INVALID_ARGUMENT);
         }
 
-        command = GetGlobalCommand(cluster->second, argv[2], argv[3]);
-        if (command == nullptr)
+        *command = GetGlobalCommand(cluster->second, argv[2], argv[3]);
+        if (*command == nullptr)
         {
             ChipLogError(chipTool, "Unknown attribute: %s", argv[3]);
             ShowClusterAttributes(argv[0], argv[1], argv[2], cluster->second);
@@ -119,19 +137,12 @@ CHIP_ERROR Commands::RunCommand(PersistentStorage & storage, NodeId localId, Nod
         }
     }
 
-    if (!command->InitArguments(argc - 3, &argv[3]))
+    if (!(*command)->InitArguments(argc - 3, &argv[3]))
     {
-        ShowCommand(argv[0], argv[1], command);
+        ShowCommand(argv[0], argv[1], *command);
         ExitNow(err = CHIP_ERROR_INVALID_ARGUMENT);
     }
 
-    err = command->Run(storage, localId, remoteId);
-    if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(chipTool, "Run command failure: %s", chip::ErrorStr(err));
-        ExitNow();
-    }
-
 exit:
     return err;
 }
@@ -31,6 +31,17 @@ public:
     void Register(const char * clusterName, commands_list commandsList);
     int Run(NodeId localId, NodeId remoteId, int argc, char ** argv);
 
+    /**
+     * @brief
+     *   Find the command named by a command line, and initialize its arguments, printing the usage of the
+     *   command when the command line is not valid.
+     *
+     * @param argc    The number of arguments of the command line, argv[0] being the executable
+     * @param argv    The arguments of the command line, which must outlive the run of the command
+     * @param command Set to the command found
+     */
+    CHIP_ERROR ParseCommand(int argc, char ** argv, Command ** command);
+
 private:
     CHIP_ERROR RunCommand(PersistentStorage & storage, NodeId localId, NodeId remoteId, int argc, char ** argv);
     std::map<std::string, CommandsVector>::iterator GetCluster(std::string clusterName);
@@ -0,0 +1,111 @@
+/*
+ *   Copyright (c) 2021 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "EchoBenchmarkCommand.h"
+
+#include <inttypes.h>
+
+#include <chrono>
+#include <thread>
+
+#if CONFIG_DEVICE_LAYER
+#include <platform/CHIPDeviceLayer.h>
+#endif
+
+using namespace ::chip;
+using namespace ::chip::Protocols::Echo;
+
+namespace {
+
+constexpr std::chrono::milliseconds kPollInterval(100);
+
+void LockStack()
+{
+#if CONFIG_DEVICE_LAYER
+    chip::DeviceLayer::PlatformMgr().LockChipStack();
+#endif
+}
+
+void UnlockStack()
+{
+#if CONFIG_DEVICE_LAYER
+    chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+#endif
+}
+
+} // namespace
+
+void EchoBenchmarkCommand::OnBenchmarkDone(void * context, EchoBenchmark & benchmark)
+{
+    benchmark.LogResults();
+}
+
+CHIP_ERROR EchoBenchmarkCommand::StartBenchmark(NodeId remoteId)
+{
+    ChipDevice * device = nullptr;
+    SecureSessionHandle session;
+
+    ReturnErrorOnFailure(mCommissioner.GetDevice(remoteId, &device));
+    ReturnErrorOnFailure(device->LoadSecureSession(session));
+
+    mParams.mReliable = mReliable != 0;
+    return mBenchmark.Start(device->GetExchangeManager(), session, mParams, OnBenchmarkDone, this);
+}
+
+CHIP_ERROR EchoBenchmarkCommand::Run(PersistentStorage & storage, NodeId localId, NodeId remoteId)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::Controller::CommissionerInitParams initParams;
+    bool running = true;
+
+    initParams.storageDelegate = &storage;
+
+    err = mCommissioner.SetUdpListenPort(storage.GetListenPort());
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Commissioner: %s", ErrorStr(err)));
+
+    err = mCommissioner.Init(localId, initParams);
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Commissioner: %s", ErrorStr(err)));
+
+    err = mCommissioner.ServiceEvents();
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Run Loop: %s", ErrorStr(err)));
+
+    // The requests are sent and answered on the thread running the stack
+    LockStack();
+    err = StartBenchmark(remoteId);
+    UnlockStack();
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(chipTool, "Failed to start the benchmark: %s", ErrorStr(err)));
+
+    ChipLogProgress(chipTool, "Sending %" PRIu32 " Echo Requests to device %" PRIu64 ", %" PRIu16 " at once",
+                    mParams.mRequestCount, remoteId, mParams.mMaxOutstanding);
+
+    while (running)
+    {
+        std::this_thread::sleep_for(kPollInterval);
+
+        LockStack();
+        running = mBenchmark.IsRunning();
+        UnlockStack();
+    }
+
+    SetCommandExitStatus(true);
+
+exit:
+    mCommissioner.ServiceEventSignal();
+    mCommissioner.Shutdown();
+    return err;
+}
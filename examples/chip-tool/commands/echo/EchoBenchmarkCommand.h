@@ -0,0 +1,58 @@
+/*
+ *   Copyright (c) 2021 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../../config/PersistentStorage.h"
+#include "../common/Command.h"
+
+#include <controller/CHIPDeviceController.h>
+#include <protocols/echo/EchoBenchmark.h>
+
+/**
+ * Sends Echo Requests to a device, several of them at once, then logs the round trip times and the loss of the requests.
+ */
+class EchoBenchmarkCommand : public Command
+{
+public:
+    EchoBenchmarkCommand(const char * commandName) : Command(commandName)
+    {
+        AddArgument("request-count", 1, UINT32_MAX, &mParams.mRequestCount);
+        AddArgument("outstanding", 1, chip::Protocols::Echo::EchoBenchmark::kMaxOutstandingRequests, &mParams.mMaxOutstanding);
+        AddArgument("min-payload-size", 0, UINT16_MAX, &mParams.mMinPayloadSize);
+        AddArgument("max-payload-size", 0, UINT16_MAX, &mParams.mMaxPayloadSize);
+        AddArgument("payload-size-step", 0, UINT16_MAX, &mParams.mPayloadSizeStep);
+        AddArgument("interval-ms", 0, UINT32_MAX, &mParams.mRequestIntervalMs);
+        AddArgument("timeout-ms", 1, UINT32_MAX, &mParams.mResponseTimeoutMs);
+        AddArgument("reliable", 0, 1, &mReliable);
+    }
+
+    /////////// Command Interface /////////
+    CHIP_ERROR Run(PersistentStorage & storage, NodeId localId, NodeId remoteId) override;
+
+private:
+    static void OnBenchmarkDone(void * context, chip::Protocols::Echo::EchoBenchmark & benchmark);
+
+    CHIP_ERROR StartBenchmark(NodeId remoteId);
+
+    chip::Protocols::Echo::EchoBenchmarkParams mParams;
+    uint8_t mReliable;
+
+    ChipDeviceCommissioner mCommissioner;
+    chip::Protocols::Echo::EchoBenchmark mBenchmark;
+};
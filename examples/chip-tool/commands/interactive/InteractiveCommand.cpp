@@ -0,0 +1,220 @@
+/*
+ *   Copyright (c) 2021 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "InteractiveCommand.h"
+
+#include <ctype.h>
+#include <fstream>
+#include <inttypes.h>
+#include <iostream>
+#include <memory>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include <support/CodeUtils.h>
+
+using namespace ::chip;
+
+namespace {
+
+// Splits a line on white spaces, keeping together the words of the arguments between double quotes.
+std::vector<std::string> Tokenize(const std::string & line)
+{
+    std::vector<std::string> tokens;
+    std::string token;
+    bool quoted   = false;
+    bool hasToken = false;
+
+    for (char c : line)
+    {
+        if (c == '"')
+        {
+            quoted   = !quoted;
+            hasToken = true;
+        }
+        else if (!quoted && isspace(static_cast<unsigned char>(c)))
+        {
+            if (hasToken)
+            {
+                tokens.push_back(token);
+                token.clear();
+                hasToken = false;
+            }
+        }
+        else
+        {
+            token += c;
+            hasToken = true;
+        }
+    }
+    if (hasToken)
+    {
+        tokens.push_back(token);
+    }
+
+    return tokens;
+}
+
+} // namespace
+
+CHIP_ERROR InteractiveCommand::Run(PersistentStorage & storage, NodeId localId, NodeId remoteId)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::Controller::CommissionerInitParams initParams;
+    std::ifstream scriptFile;
+    std::vector<std::unique_ptr<Commands>> lanes;
+    std::vector<std::thread> threads;
+
+    if (strcmp(mScriptPath, "-") == 0)
+    {
+        mScript = &std::cin;
+    }
+    else
+    {
+        scriptFile.open(mScriptPath);
+        if (!scriptFile.is_open())
+        {
+            ChipLogError(chipTool, "Cannot open script: %s", mScriptPath);
+            ExitNow(err = CHIP_ERROR_INVALID_ARGUMENT);
+        }
+        mScript = &scriptFile;
+    }
+
+    initParams.storageDelegate = &storage;
+
+    err = mCommissioner.SetUdpListenPort(storage.GetListenPort());
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Commissioner: %s", ErrorStr(err)));
+
+    err = mCommissioner.Init(localId, initParams);
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Commissioner: %s", ErrorStr(err)));
+
+    err = mCommissioner.ServiceEvents();
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Run Loop: %s", ErrorStr(err)));
+
+    // Every lane has commands of its own, as a command waits for its response in its own state.
+    for (uint16_t i = 0; i < mParallelism; i++)
+    {
+        lanes.emplace_back(new Commands());
+        mRegisterCommands(*lanes.back());
+    }
+    for (auto & lane : lanes)
+    {
+        threads.emplace_back(&InteractiveCommand::RunLane, this, std::ref(*lane));
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    printf("%" PRIu32 " commands, %" PRIu32 " failed, average latency %" PRIu64 " us, max latency %" PRIu64 " us\n",
+           mCommandCount, mFailureCount,
+           static_cast<uint64_t>(mCommandCount > 0 ? mTotalLatency.count() / mCommandCount : 0),
+           static_cast<uint64_t>(mMaxLatency.count()));
+    VerifyOrExit(mFailureCount == 0, err = CHIP_ERROR_INTERNAL);
+
+exit:
+    mCommissioner.ServiceEventSignal();
+    mCommissioner.Shutdown();
+    return err;
+}
+
+bool InteractiveCommand::ReadLine(std::string & line, uint32_t & lineNumber)
+{
+    std::lock_guard<std::mutex> lock(mScriptMutex);
+
+    while (std::getline(*mScript, line))
+    {
+        lineNumber = ++mLineNumber;
+
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start != std::string::npos && line[start] != '#')
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void InteractiveCommand::RunLane(Commands & lane)
+{
+    std::string line;
+    uint32_t lineNumber;
+
+    while (ReadLine(line, lineNumber))
+    {
+        auto start     = std::chrono::steady_clock::now();
+        CHIP_ERROR err = RunLine(lane, line);
+        ReportLine(lineNumber, line, err,
+                   std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+    }
+}
+
+CHIP_ERROR InteractiveCommand::RunLine(Commands & lane, const std::string & line)
+{
+    std::vector<std::string> tokens = Tokenize(line);
+    std::vector<char *> argv;
+    Command * command = nullptr;
+    char * end        = nullptr;
+    NodeId remoteId;
+
+    // The node id takes the place of the executable, so that the usage printed for a wrong line is the one of a line.
+    VerifyOrReturnError(!tokens.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    remoteId = strtoull(tokens[0].c_str(), &end, 0);
+    if (end == tokens[0].c_str() || *end != '\0')
+    {
+        ChipLogError(chipTool, "Invalid node id: %s", tokens[0].c_str());
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (auto & token : tokens)
+    {
+        argv.push_back(&token[0]);
+    }
+
+    ReturnErrorOnFailure(lane.ParseCommand(static_cast<int>(argv.size()), argv.data(), &command));
+
+    CHIP_ERROR err = command->RunWithCommissioner(mCommissioner, remoteId);
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        ChipLogError(chipTool, "The command of line \"%s\" cannot be run from a script", line.c_str());
+    }
+    return err;
+}
+
+void InteractiveCommand::ReportLine(uint32_t lineNumber, const std::string & line, CHIP_ERROR err,
+                                    std::chrono::microseconds latency)
+{
+    std::lock_guard<std::mutex> lock(mReportMutex);
+
+    mCommandCount++;
+    mTotalLatency += latency;
+    if (latency > mMaxLatency)
+    {
+        mMaxLatency = latency;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        mFailureCount++;
+    }
+
+    printf("%" PRIu32 ": %s in %" PRIu64 " us: %s\n", lineNumber, err == CHIP_NO_ERROR ? "success" : ErrorStr(err),
+           static_cast<uint64_t>(latency.count()), line.c_str());
+    fflush(stdout);
+}
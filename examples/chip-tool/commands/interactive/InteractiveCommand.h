@@ -0,0 +1,77 @@
+/*
+ *   Copyright (c) 2021 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../../config/PersistentStorage.h"
+#include "../common/Command.h"
+#include "../common/Commands.h"
+
+#include <chrono>
+#include <istream>
+#include <mutex>
+#include <string>
+
+/**
+ * Runs a script of commands, one per line, through a single commissioner, so that the stack is set up once and the
+ * sessions with the devices are kept from one command to the next. The commands are run by lanes, each with commands
+ * of its own, so that as many commands as there are lanes are waiting for a response at any time.
+ *
+ * Every line of the script is a node id followed by a command line without the executable, such as
+ * `12344321 onoff on 1`. Empty lines and the lines starting with `#` are skipped. The outcome and the latency of
+ * every command are printed as it completes.
+ */
+class InteractiveCommand : public Command
+{
+public:
+    using RegisterFunction = void (*)(Commands & commands);
+
+    InteractiveCommand(RegisterFunction registerCommands) : Command("run"), mRegisterCommands(registerCommands)
+    {
+        AddArgument("parallelism", 1, kMaxParallelism, &mParallelism);
+        AddArgument("script-path", &mScriptPath);
+    }
+
+    /////////// Command Interface /////////
+    CHIP_ERROR Run(PersistentStorage & storage, NodeId localId, NodeId remoteId) override;
+
+private:
+    static constexpr uint16_t kMaxParallelism = 64;
+
+    bool ReadLine(std::string & line, uint32_t & lineNumber);
+    void RunLane(Commands & lane);
+    CHIP_ERROR RunLine(Commands & lane, const std::string & line);
+    void ReportLine(uint32_t lineNumber, const std::string & line, CHIP_ERROR err, std::chrono::microseconds latency);
+
+    RegisterFunction mRegisterCommands;
+    uint16_t mParallelism;
+    char * mScriptPath;
+
+    ChipDeviceCommissioner mCommissioner;
+
+    // The script is read by the lanes as they get free.
+    std::mutex mScriptMutex;
+    std::istream * mScript = nullptr;
+    uint32_t mLineNumber   = 0;
+
+    std::mutex mReportMutex;
+    uint32_t mCommandCount = 0;
+    uint32_t mFailureCount = 0;
+    std::chrono::microseconds mTotalLatency{ 0 };
+    std::chrono::microseconds mMaxLatency{ 0 };
+};
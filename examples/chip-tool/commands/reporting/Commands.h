@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include "ReportingBenchmarkCommand.h"
 #include "ReportingCommand.h"
 
 typedef void (*UnsupportedAttributeCallback)(void * context);
@@ -131,12 +132,120 @@ private:
         new chip::Callback::Callback<Int16sAttributeCallback>(OnInt16sAttributeResponse, this);
 };
 
+class Benchmark : public ReportingBenchmarkCommand
+{
+public:
+    Benchmark() : ReportingBenchmarkCommand("benchmark") {}
+
+    CHIP_ERROR Subscribe(ChipDevice * device, uint8_t endpointId, uint16_t minInterval, uint16_t maxInterval) override
+    {
+        {
+            chip::Controller::ColorControlCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int8uAttributeCallback>(device->GetDeviceId(), endpointId, 0x0300, 0x0000);
+            ReturnErrorOnFailure(cluster.ReportAttributeCurrentHue(s.GetReportCallback()));
+            ReturnErrorOnFailure(
+                cluster.ConfigureAttributeCurrentHue(s.GetSuccessCallback(), s.GetFailureCallback(), minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::ColorControlCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int8uAttributeCallback>(device->GetDeviceId(), endpointId, 0x0300, 0x0001);
+            ReturnErrorOnFailure(cluster.ReportAttributeCurrentSaturation(s.GetReportCallback()));
+            ReturnErrorOnFailure(cluster.ConfigureAttributeCurrentSaturation(s.GetSuccessCallback(), s.GetFailureCallback(),
+                                                                             minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::ColorControlCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int16uAttributeCallback>(device->GetDeviceId(), endpointId, 0x0300, 0x0003);
+            ReturnErrorOnFailure(cluster.ReportAttributeCurrentX(s.GetReportCallback()));
+            ReturnErrorOnFailure(
+                cluster.ConfigureAttributeCurrentX(s.GetSuccessCallback(), s.GetFailureCallback(), minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::ColorControlCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int16uAttributeCallback>(device->GetDeviceId(), endpointId, 0x0300, 0x0004);
+            ReturnErrorOnFailure(cluster.ReportAttributeCurrentY(s.GetReportCallback()));
+            ReturnErrorOnFailure(
+                cluster.ConfigureAttributeCurrentY(s.GetSuccessCallback(), s.GetFailureCallback(), minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::ColorControlCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int16uAttributeCallback>(device->GetDeviceId(), endpointId, 0x0300, 0x0007);
+            ReturnErrorOnFailure(cluster.ReportAttributeColorTemperature(s.GetReportCallback()));
+            ReturnErrorOnFailure(cluster.ConfigureAttributeColorTemperature(s.GetSuccessCallback(), s.GetFailureCallback(),
+                                                                            minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::DoorLockCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int8uAttributeCallback>(device->GetDeviceId(), endpointId, 0x0101, 0x0000);
+            ReturnErrorOnFailure(cluster.ReportAttributeLockState(s.GetReportCallback()));
+            ReturnErrorOnFailure(
+                cluster.ConfigureAttributeLockState(s.GetSuccessCallback(), s.GetFailureCallback(), minInterval, maxInterval));
+        }
+        {
+            chip::Controller::LevelControlCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int8uAttributeCallback>(device->GetDeviceId(), endpointId, 0x0008, 0x0000);
+            ReturnErrorOnFailure(cluster.ReportAttributeCurrentLevel(s.GetReportCallback()));
+            ReturnErrorOnFailure(cluster.ConfigureAttributeCurrentLevel(s.GetSuccessCallback(), s.GetFailureCallback(),
+                                                                        minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::OnOffCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<BooleanAttributeCallback>(device->GetDeviceId(), endpointId, 0x0006, 0x0000);
+            ReturnErrorOnFailure(cluster.ReportAttributeOnOff(s.GetReportCallback()));
+            ReturnErrorOnFailure(
+                cluster.ConfigureAttributeOnOff(s.GetSuccessCallback(), s.GetFailureCallback(), minInterval, maxInterval));
+        }
+        {
+            chip::Controller::PumpConfigurationAndControlCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int16sAttributeCallback>(device->GetDeviceId(), endpointId, 0x0200, 0x0013);
+            ReturnErrorOnFailure(cluster.ReportAttributeCapacity(s.GetReportCallback()));
+            ReturnErrorOnFailure(
+                cluster.ConfigureAttributeCapacity(s.GetSuccessCallback(), s.GetFailureCallback(), minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::SwitchCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int8uAttributeCallback>(device->GetDeviceId(), endpointId, 0x003B, 0x0001);
+            ReturnErrorOnFailure(cluster.ReportAttributeCurrentPosition(s.GetReportCallback()));
+            ReturnErrorOnFailure(cluster.ConfigureAttributeCurrentPosition(s.GetSuccessCallback(), s.GetFailureCallback(),
+                                                                           minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::TemperatureMeasurementCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int16sAttributeCallback>(device->GetDeviceId(), endpointId, 0x0402, 0x0000);
+            ReturnErrorOnFailure(cluster.ReportAttributeMeasuredValue(s.GetReportCallback()));
+            ReturnErrorOnFailure(cluster.ConfigureAttributeMeasuredValue(s.GetSuccessCallback(), s.GetFailureCallback(),
+                                                                         minInterval, maxInterval, 0));
+        }
+        {
+            chip::Controller::ThermostatCluster cluster;
+            cluster.Associate(device, endpointId);
+            Subscription & s = AddSubscription<Int16sAttributeCallback>(device->GetDeviceId(), endpointId, 0x0201, 0x0000);
+            ReturnErrorOnFailure(cluster.ReportAttributeLocalTemperature(s.GetReportCallback()));
+            ReturnErrorOnFailure(cluster.ConfigureAttributeLocalTemperature(s.GetSuccessCallback(), s.GetFailureCallback(),
+                                                                            minInterval, maxInterval, 0));
+        }
+        return CHIP_NO_ERROR;
+    }
+};
+
 void registerCommandsReporting(Commands & commands)
 {
     const char * clusterName = "Reporting";
 
     commands_list clusterCommands = {
         make_unique<Listen>(),
+        make_unique<Benchmark>(),
     };
 
     commands.Register(clusterName, clusterCommands);
@@ -0,0 +1,206 @@
+/*
+ *   Copyright (c) 2021 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "ReportingBenchmarkCommand.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <thread>
+
+#if CONFIG_DEVICE_LAYER
+#include <platform/CHIPDeviceLayer.h>
+#endif
+
+using namespace ::chip;
+
+namespace {
+
+double ToMilliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void LockStack()
+{
+#if CONFIG_DEVICE_LAYER
+    chip::DeviceLayer::PlatformMgr().LockChipStack();
+#endif
+}
+
+void UnlockStack()
+{
+#if CONFIG_DEVICE_LAYER
+    chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+#endif
+}
+
+} // namespace
+
+void ReportingBenchmarkCommand::Subscription::OnReport()
+{
+    Clock::time_point now = Clock::now();
+
+    if (mReportCount == 0)
+    {
+        mFirstReportAt = now;
+    }
+    else
+    {
+        Clock::duration gap = now - mLastReportAt;
+        if (gap > mLongestGap)
+        {
+            mLongestGap = gap;
+        }
+        if (mMaxInterval != Clock::duration::zero() && gap > mMaxInterval)
+        {
+            mLateReportCount++;
+        }
+    }
+
+    mLastReportAt = now;
+    mReportCount++;
+}
+
+void ReportingBenchmarkCommand::Subscription::OnConfigureSuccess(void * context)
+{
+    static_cast<Subscription *>(context)->mConfigured = true;
+}
+
+void ReportingBenchmarkCommand::Subscription::OnConfigureFailure(void * context, uint8_t status)
+{
+    Subscription * subscription    = static_cast<Subscription *>(context);
+    subscription->mConfigureStatus = status;
+    ChipLogError(chipTool, "Failed to configure the reporting of 0x%04" PRIx16 "/0x%04" PRIx16 " on node %" PRIu64 ": 0x%02x",
+                 subscription->mClusterId, subscription->mAttributeId, subscription->mNodeId, status);
+}
+
+CHIP_ERROR ReportingBenchmarkCommand::Run(PersistentStorage & storage, NodeId localId, NodeId remoteId)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::Controller::CommissionerInitParams initParams;
+    Clock::time_point startedAt;
+    uint16_t subscribedNodes = 0;
+
+    initParams.storageDelegate = &storage;
+
+    err = mCommissioner.SetUdpListenPort(storage.GetListenPort());
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Commissioner: %s", ErrorStr(err)));
+
+    err = mCommissioner.Init(localId, initParams);
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Commissioner: %s", ErrorStr(err)));
+
+    err = mCommissioner.ServiceEvents();
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(Controller, "Init failure! Run Loop: %s", ErrorStr(err)));
+
+    // The reports are counted on the thread running the stack, which the subscriptions are made from as well
+    LockStack();
+    for (uint32_t i = 0; i < mNodeCount; i++)
+    {
+        NodeId nodeId       = mFirstNodeId + i;
+        ChipDevice * device = nullptr;
+
+        if (mCommissioner.GetDevice(nodeId, &device) != CHIP_NO_ERROR)
+        {
+            ChipLogError(chipTool, "No pairing for device: %" PRIu64, nodeId);
+            continue;
+        }
+
+        CHIP_ERROR subscribeErr = Subscribe(device, mEndPointId, mMinInterval, mMaxInterval);
+        if (subscribeErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(chipTool, "Failed to subscribe to device %" PRIu64 ": %s", nodeId, ErrorStr(subscribeErr));
+            continue;
+        }
+        subscribedNodes++;
+    }
+    startedAt = Clock::now();
+    UnlockStack();
+
+    VerifyOrExit(subscribedNodes > 0, err = CHIP_ERROR_NOT_CONNECTED);
+    ChipLogProgress(chipTool, "Subscribed to %zu attributes of %" PRIu16 " nodes, counting reports for %" PRIu16 " s",
+                    mSubscriptions.size(), subscribedNodes, mDuration);
+
+    std::this_thread::sleep_for(std::chrono::seconds(mDuration));
+
+    LockStack();
+    err = WriteResults(std::chrono::duration<double>(Clock::now() - startedAt).count());
+    UnlockStack();
+    SuccessOrExit(err);
+
+    SetCommandExitStatus(true);
+
+exit:
+    mCommissioner.ServiceEventSignal();
+    mCommissioner.Shutdown();
+    return err;
+}
+
+CHIP_ERROR ReportingBenchmarkCommand::WriteResults(double elapsedSeconds)
+{
+    uint64_t totalReports     = 0;
+    uint64_t totalLateReports = 0;
+    size_t configured         = 0;
+
+    FILE * file = fopen(mCsvPath, "w");
+    if (file == nullptr)
+    {
+        ChipLogError(chipTool, "Failed to open %s", mCsvPath);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    fprintf(file,
+            "node_id,endpoint_id,cluster_id,attribute_id,configured,reports,reports_per_second,first_report_latency_ms,"
+            "mean_interval_ms,max_gap_ms,late_reports\n");
+
+    for (const std::unique_ptr<Subscription> & subscription : mSubscriptions)
+    {
+        double firstReportLatency = -1;
+        double meanInterval       = -1;
+
+        if (subscription->mReportCount > 0)
+        {
+            firstReportLatency = ToMilliseconds(subscription->mFirstReportAt - subscription->mSubscribedAt);
+        }
+        if (subscription->mReportCount > 1)
+        {
+            meanInterval =
+                ToMilliseconds(subscription->mLastReportAt - subscription->mFirstReportAt) / (subscription->mReportCount - 1);
+        }
+
+        fprintf(file, "%" PRIu64 ",%" PRIu8 ",0x%04" PRIx16 ",0x%04" PRIx16 ",%d,%" PRIu32 ",%.3f,%.3f,%.3f,%.3f,%" PRIu32 "\n",
+                subscription->mNodeId, subscription->mEndpointId, subscription->mClusterId, subscription->mAttributeId,
+                subscription->mConfigured, subscription->mReportCount, subscription->mReportCount / elapsedSeconds,
+                firstReportLatency, meanInterval, ToMilliseconds(subscription->mLongestGap), subscription->mLateReportCount);
+
+        totalReports += subscription->mReportCount;
+        totalLateReports += subscription->mLateReportCount;
+        configured += subscription->mConfigured ? 1 : 0;
+    }
+
+    bool written = ferror(file) == 0;
+    written      = (fclose(file) == 0) && written;
+    VerifyOrReturnError(written, CHIP_ERROR_WRITE_FAILED);
+
+    ChipLogProgress(chipTool,
+                    "%" PRIu64 " reports in %.1f s (%.1f per second), %zu of %zu subscriptions configured, %" PRIu64
+                    " late reports, results written to %s",
+                    totalReports, elapsedSeconds, static_cast<double>(totalReports) / elapsedSeconds, configured,
+                    mSubscriptions.size(), totalLateReports, mCsvPath);
+    return CHIP_NO_ERROR;
+}
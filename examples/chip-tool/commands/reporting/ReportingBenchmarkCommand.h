@@ -0,0 +1,158 @@
+/*
+ *   Copyright (c) 2021 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "ReportingCommand.h"
+
+#include "gen/CHIPClientCallbacks.h"
+#include "gen/CHIPClusters.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+/**
+ * Subscribes to the reportable attributes of a range of nodes and counts the reports received for a while, without
+ * logging them, then writes the rate, latency and gaps of the reports of each attribute to a CSV file.
+ */
+class ReportingBenchmarkCommand : public Command
+{
+public:
+    ReportingBenchmarkCommand(const char * commandName) : Command(commandName)
+    {
+        AddArgument("endpoint-id", CHIP_ZCL_ENDPOINT_MIN, CHIP_ZCL_ENDPOINT_MAX, &mEndPointId);
+        AddArgument("first-node-id", 0, UINT64_MAX, &mFirstNodeId);
+        AddArgument("node-count", 1, UINT16_MAX, &mNodeCount);
+        AddArgument("min-interval", 0, UINT16_MAX, &mMinInterval);
+        AddArgument("max-interval", 0, UINT16_MAX, &mMaxInterval);
+        AddArgument("duration", 1, UINT16_MAX, &mDuration);
+        AddArgument("csv-path", &mCsvPath);
+    }
+
+    /////////// Command Interface /////////
+    CHIP_ERROR Run(PersistentStorage & storage, NodeId localId, NodeId remoteId) override;
+
+    /**
+     * Subscribe to the reportable attributes of a device, adding a subscription for each of them.
+     */
+    virtual CHIP_ERROR Subscribe(ChipDevice * device, uint8_t endpointId, uint16_t minInterval, uint16_t maxInterval) = 0;
+
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * The reports received for one attribute of one node, updated on the thread running the stack.
+     */
+    class Subscription
+    {
+    public:
+        Subscription(NodeId nodeId, uint8_t endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId) :
+            mNodeId(nodeId), mEndpointId(endpointId), mClusterId(clusterId), mAttributeId(attributeId),
+            mSuccessCallback(OnConfigureSuccess, this), mFailureCallback(OnConfigureFailure, this)
+        {}
+        virtual ~Subscription() {}
+
+        virtual chip::Callback::Cancelable * GetReportCallback() = 0;
+        chip::Callback::Cancelable * GetSuccessCallback() { return mSuccessCallback.Cancel(); }
+        chip::Callback::Cancelable * GetFailureCallback() { return mFailureCallback.Cancel(); }
+
+    protected:
+        void OnReport();
+
+    private:
+        friend class ReportingBenchmarkCommand;
+
+        static void OnConfigureSuccess(void * context);
+        static void OnConfigureFailure(void * context, uint8_t status);
+
+        const NodeId mNodeId;
+        const uint8_t mEndpointId;
+        const chip::ClusterId mClusterId;
+        const chip::AttributeId mAttributeId;
+
+        chip::Callback::Callback<DefaultSuccessCallback> mSuccessCallback;
+        chip::Callback::Callback<DefaultFailureCallback> mFailureCallback;
+
+        Clock::time_point mSubscribedAt;
+        Clock::time_point mFirstReportAt;
+        Clock::time_point mLastReportAt;
+        Clock::duration mLongestGap  = Clock::duration::zero();
+        Clock::duration mMaxInterval = Clock::duration::zero();
+        uint32_t mReportCount        = 0;
+        uint32_t mLateReportCount    = 0;
+        bool mConfigured             = false;
+        uint8_t mConfigureStatus     = 0;
+    };
+
+    /**
+     * Add the subscription of an attribute whose reports are delivered through a callback of type F, which takes the
+     * context followed by the value of the attribute.
+     */
+    template <typename F>
+    Subscription & AddSubscription(NodeId nodeId, uint8_t endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId)
+    {
+        TypedSubscription<F> * subscription = new TypedSubscription<F>(nodeId, endpointId, clusterId, attributeId);
+        subscription->mSubscribedAt         = Clock::now();
+        subscription->mMaxInterval          = std::chrono::seconds(mMaxInterval);
+        mSubscriptions.emplace_back(subscription);
+        return *subscription;
+    }
+
+private:
+    template <typename F>
+    class TypedSubscription : public Subscription
+    {
+    public:
+        TypedSubscription(NodeId nodeId, uint8_t endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId) :
+            Subscription(nodeId, endpointId, clusterId, attributeId), mReportCallback(MakeReportCallback<F>::Get(), this)
+        {}
+
+        chip::Callback::Cancelable * GetReportCallback() override { return mReportCallback.Cancel(); }
+
+    private:
+        template <typename T>
+        struct MakeReportCallback;
+
+        // The value of the report is not looked at, only its arrival
+        template <typename... Args>
+        struct MakeReportCallback<void (*)(void *, Args...)>
+        {
+            static void OnReport(void * context, Args...)
+            {
+                static_cast<TypedSubscription *>(context)->Subscription::OnReport();
+            }
+            static F Get() { return OnReport; }
+        };
+
+        chip::Callback::Callback<F> mReportCallback;
+    };
+
+    CHIP_ERROR WriteResults(double elapsedSeconds);
+
+    uint8_t mEndPointId;
+    uint64_t mFirstNodeId;
+    uint16_t mNodeCount;
+    uint16_t mMinInterval;
+    uint16_t mMaxInterval;
+    uint16_t mDuration;
+    char * mCsvPath;
+
+    ChipDeviceCommissioner mCommissioner;
+    std::vector<std::unique_ptr<Subscription>> mSubscriptions;
+};
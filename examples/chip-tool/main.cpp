@@ -20,6 +20,8 @@
 
 #include "commands/clusters/Commands.h"
 #include "commands/discover/Commands.h"
+#include "commands/echo/Commands.h"
+#include "commands/interactive/Commands.h"
 #include "commands/pairing/Commands.h"
 #include "commands/payload/Commands.h"
 #include "commands/reporting/Commands.h"
@@ -29,14 +31,26 @@
 // ================================================================================
 // Main Code
 // ================================================================================
-int main(int argc, char * argv[])
+namespace {
+
+// Registers the commands a script run by the interactive commands may contain.
+void registerCommands(Commands & commands)
 {
-    Commands commands;
     registerCommandsDiscover(commands);
+    registerCommandsEcho(commands);
     registerCommandsPayload(commands);
     registerCommandsPairing(commands);
     registerCommandsReporting(commands);
     registerClusters(commands);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    Commands commands;
+    registerCommands(commands);
+    registerCommandsInteractive(commands, registerCommands);
 
     return commands.Run(chip::kTestControllerNodeId, chip::kTestDeviceNodeId, argc, argv);
 }
@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "TelemetryService.h"
+
+#include <support/CodeUtils.h>
+#include <system/SystemLayer.h>
+
+#include <string.h>
+#include <utility>
+
+namespace chip {
+namespace rpc {
+
+using namespace chip::System;
+
+// The tables of the stack have to fit in the arrays sized by telemetry_service.options
+static_assert(Stats::kNumEntries <= ArraySize(chip_rpc_TelemetrySample{}.resources_in_use), "Too many resources");
+static_assert(Stats::kNumEntries <= ArraySize(chip_rpc_TelemetrySample{}.high_watermarks), "Too many resources");
+static_assert(Stats::kNumCounters <= ArraySize(chip_rpc_TelemetrySample{}.counters), "Too many counters");
+static_assert(Trace::kStage_Max <= ArraySize(chip_rpc_TelemetrySample{}.histograms), "Too many stages");
+static_assert(Trace::kNumHistogramBuckets == ArraySize(chip_rpc_StageHistogram{}.buckets), "Wrong number of buckets");
+
+pw::Status Telemetry::DescribeMetric(ServerContext &, const chip_rpc_MetricIndex & request, chip_rpc_MetricDescription & response)
+{
+    const char * name = nullptr;
+
+    switch (request.kind)
+    {
+    case chip_rpc_MetricKind_RESOURCE:
+        VerifyOrReturnError(request.index < Stats::kNumEntries, pw::Status::NotFound());
+        name = Stats::GetStrings()[request.index];
+        break;
+    case chip_rpc_MetricKind_COUNTER:
+        VerifyOrReturnError(request.index < Stats::kNumCounters, pw::Status::NotFound());
+        name = Stats::GetCounterStrings()[request.index];
+        break;
+    case chip_rpc_MetricKind_STAGE:
+        VerifyOrReturnError(request.index < Trace::kStage_Max, pw::Status::NotFound());
+        name = Trace::GetStageName(static_cast<Trace::Stage>(request.index));
+        break;
+    default:
+        return pw::Status::InvalidArgument();
+    }
+
+    strncpy(response.name, name, sizeof(response.name) - 1);
+    response.name[sizeof(response.name) - 1] = '\0';
+    return pw::OkStatus();
+}
+
+void Telemetry::Stream(ServerContext &, const chip_rpc_TelemetryRequest & request, ServerWriter<chip_rpc_TelemetrySample> & writer)
+{
+    Lock();
+
+    // A new stream replaces the previous one, and starts from the spans and histograms as they are
+    mWriter       = std::move(writer);
+    mIntervalMs   = request.interval_ms;
+    mSpanSampling = request.span_sampling;
+    mLastSampleUs = 0;
+    mNextSpan     = Trace::GetSpanCount();
+    mSpanCount    = mNextSpan;
+    for (size_t stage = 0; stage < Trace::kStage_Max; stage++)
+    {
+        mLastCounts[stage] = Trace::GetHistogram(static_cast<Trace::Stage>(stage)).mCount;
+    }
+
+    Unlock();
+}
+
+void Telemetry::Sample()
+{
+    Lock();
+
+    const uint64_t nowUs = Layer::GetClock_MonotonicHiRes();
+    if (mWriter.open() && (mLastSampleUs == 0 || nowUs - mLastSampleUs >= static_cast<uint64_t>(mIntervalMs) * 1000))
+    {
+        memset(&mSample, 0, sizeof(mSample));
+        mSample.timestamp_us = nowUs;
+
+        mSample.resources_in_use_count = Stats::kNumEntries;
+        mSample.high_watermarks_count  = Stats::kNumEntries;
+        for (size_t i = 0; i < Stats::kNumEntries; i++)
+        {
+            mSample.resources_in_use[i] = Stats::GetResourcesInUse()[i];
+            mSample.high_watermarks[i]  = Stats::GetHighWatermarks()[i];
+        }
+
+        mSample.counters_count = Stats::kNumCounters;
+        memcpy(mSample.counters, Stats::GetCounters(), sizeof(Stats::counter_t) * Stats::kNumCounters);
+
+        FillHistograms();
+        FillSpans();
+
+        mLastSampleUs = nowUs;
+        if (!mWriter.Write(mSample).ok())
+        {
+            // The client is gone, or the channel is: there is no one left to stream to
+            mWriter.Finish();
+        }
+    }
+
+    Unlock();
+}
+
+void Telemetry::FillHistograms()
+{
+    for (size_t stage = 0; stage < Trace::kStage_Max; stage++)
+    {
+        const Trace::Histogram & histogram = Trace::GetHistogram(static_cast<Trace::Stage>(stage));
+        if (histogram.mCount == mLastCounts[stage])
+        {
+            continue;
+        }
+        mLastCounts[stage] = histogram.mCount;
+
+        chip_rpc_StageHistogram & out = mSample.histograms[mSample.histograms_count++];
+        out.stage                     = static_cast<uint32_t>(stage);
+        out.count                     = histogram.mCount;
+        out.max_us                    = histogram.mMaxUs;
+        out.total_us                  = histogram.mTotalUs;
+        out.buckets_count             = Trace::kNumHistogramBuckets;
+        memcpy(out.buckets, histogram.mBuckets, sizeof(histogram.mBuckets));
+    }
+}
+
+void Telemetry::FillSpans()
+{
+    const size_t count = Trace::GetSpanCount();
+
+    // The spans were reset since the previous sample
+    if (count < mSpanCount)
+    {
+        mNextSpan = 0;
+    }
+    mSpanCount = count;
+
+    if (mSpanSampling == 0)
+    {
+        mNextSpan = count;
+        return;
+    }
+
+    // One span in mSpanSampling is sampled: those which were overwritten, or do not fit, are only counted
+    for (; mNextSpan < count; mNextSpan += mSpanSampling)
+    {
+        Trace::Span span;
+        if (mSample.spans_count == ArraySize(mSample.spans) || !Trace::GetSpan(mNextSpan, span))
+        {
+            mSample.spans_dropped++;
+            continue;
+        }
+
+        chip_rpc_TraceSpan & out = mSample.spans[mSample.spans_count++];
+        out.stage                = span.mStage;
+        out.start_us             = span.mStartUs;
+        out.duration_us          = span.mDurationUs;
+    }
+}
+
+} // namespace rpc
+} // namespace chip
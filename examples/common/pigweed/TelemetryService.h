@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "pigweed/RpcService.h"
+
+/* ignore GCC Wconversion warnings for pigweed */
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+#include "telemetry_service/telemetry_service.rpc.pb.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <system/SystemStats.h>
+#include <system/SystemTrace.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace rpc {
+
+/**
+ * Streams the statistics of the system layer, the latency histograms of the traced stages and a sample of their spans to a
+ * client, in samples of a few hundred bytes which give the metrics by index: a client gets their names once, with
+ * DescribeMetric.
+ *
+ * The samples are taken by Sample(), which the application calls periodically from a task of its own: a stream only gets a
+ * sample once its interval has passed since the previous one. The values are read while the stack updates them, and are only
+ * as consistent as a sample taken at any single instant.
+ */
+class Telemetry final : public generated::Telemetry<Telemetry>
+{
+public:
+    /**
+     * @param mutex Guards the stream between the RPC task and the task sampling. May be nullptr if they are the same.
+     */
+    explicit Telemetry(::chip::rpc::Mutex * mutex) : mMutex(mutex) {}
+
+    pw::Status DescribeMetric(ServerContext &, const chip_rpc_MetricIndex & request, chip_rpc_MetricDescription & response);
+
+    void Stream(ServerContext &, const chip_rpc_TelemetryRequest & request, ServerWriter<chip_rpc_TelemetrySample> & writer);
+
+    /**
+     * Write a sample to the stream, if there is one and its interval has passed.
+     */
+    void Sample();
+
+private:
+    void Lock()
+    {
+        if (mMutex)
+        {
+            mMutex->Lock();
+        }
+    }
+    void Unlock()
+    {
+        if (mMutex)
+        {
+            mMutex->Unlock();
+        }
+    }
+
+    void FillHistograms();
+    void FillSpans();
+
+    ::chip::rpc::Mutex * mMutex;
+    ServerWriter<chip_rpc_TelemetrySample> mWriter;
+    uint32_t mIntervalMs   = 0;
+    uint32_t mSpanSampling = 0;
+    uint64_t mLastSampleUs = 0;
+    // The number of the next span to sample, and the counts of the spans and of each histogram at the previous sample
+    size_t mNextSpan  = 0;
+    size_t mSpanCount = 0;
+    uint32_t mLastCounts[System::Trace::kStage_Max] = {};
+    // Too large for the stack of the sampling task
+    chip_rpc_TelemetrySample mSample;
+};
+
+} // namespace rpc
+} // namespace chip
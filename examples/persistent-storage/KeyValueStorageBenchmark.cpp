@@ -0,0 +1,246 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "KeyValueStorageBenchmark.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <platform/KeyValueStoreManager.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemLayer.h>
+
+using namespace chip::DeviceLayer::PersistedStorage;
+
+namespace chip {
+namespace {
+
+// The keys are short enough for every backend, NVS limiting them to 15 characters
+constexpr char kMarkerKey[]      = "kvsb_boot";
+constexpr char kFillKeyFormat[]  = "kvsb_f%u";
+constexpr char kProbeKeyFormat[] = "kvsb_p%u";
+constexpr size_t kValueSizes[]   = { 16, 64, 256, 1024 };
+constexpr size_t kFillValueSize  = 64;
+constexpr unsigned kFillLevels[] = { 0, KVS_BENCHMARK_MAX_FILL / 4, KVS_BENCHMARK_MAX_FILL };
+constexpr size_t kBufferSize     = (KVS_BENCHMARK_MAX_VALUE_SIZE > kFillValueSize) ? KVS_BENCHMARK_MAX_VALUE_SIZE : kFillValueSize;
+
+uint8_t sWriteBuffer[kBufferSize];
+uint8_t sReadBuffer[kBufferSize];
+
+class Timing
+{
+public:
+    void Add(uint64_t durationUs)
+    {
+        mMinUs = (mCount == 0 || durationUs < mMinUs) ? durationUs : mMinUs;
+        mMaxUs = (durationUs > mMaxUs) ? durationUs : mMaxUs;
+        mTotalUs += durationUs;
+        mCount++;
+    }
+
+    void Log(const char * test, size_t valueSize, unsigned fill, const char * op) const
+    {
+        const uint64_t averageUs      = (mCount == 0) ? 0 : mTotalUs / mCount;
+        const uint64_t bytesPerSecond = (mTotalUs == 0) ? 0 : static_cast<uint64_t>(valueSize) * mCount * 1000000 / mTotalUs;
+
+        // The values are logged as 32 bits, which not every platform logs 64-bit integers of
+        ChipLogProgress(NotSpecified, "KVS_BENCH,%s,%u,%u,%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32, test,
+                        static_cast<unsigned>(valueSize), fill, op, mCount, static_cast<uint32_t>(mMinUs),
+                        static_cast<uint32_t>(averageUs), static_cast<uint32_t>(mMaxUs), static_cast<uint32_t>(bytesPerSecond));
+    }
+
+private:
+    uint32_t mCount   = 0;
+    uint64_t mMinUs   = 0;
+    uint64_t mMaxUs   = 0;
+    uint64_t mTotalUs = 0;
+};
+
+uint64_t Now()
+{
+    return System::Layer::GetClock_MonotonicHiRes();
+}
+
+void MakeKey(char (&key)[16], const char * format, unsigned index)
+{
+    snprintf(key, sizeof(key), format, index);
+}
+
+// A pattern of its own for each key, for a read of the wrong value to be caught
+void FillPattern(uint8_t * buffer, size_t size, unsigned seed)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        buffer[i] = static_cast<uint8_t>(seed * 31 + i);
+    }
+}
+
+CHIP_ERROR TimedPut(const char * key, size_t size, unsigned seed, Timing & timing)
+{
+    FillPattern(sWriteBuffer, size, seed);
+
+    const uint64_t startUs = Now();
+    ReturnErrorOnFailure(KeyValueStoreMgr().Put(key, sWriteBuffer, size));
+    timing.Add(Now() - startUs);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TimedGet(const char * key, size_t size, unsigned seed, Timing & timing)
+{
+    size_t readSize = 0;
+
+    const uint64_t startUs = Now();
+    ReturnErrorOnFailure(KeyValueStoreMgr().Get(key, sReadBuffer, size, &readSize));
+    timing.Add(Now() - startUs);
+
+    FillPattern(sWriteBuffer, size, seed);
+    ReturnErrorCodeIf(readSize != size || memcmp(sReadBuffer, sWriteBuffer, size) != 0, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TimedDelete(const char * key, Timing & timing)
+{
+    const uint64_t startUs = Now();
+    ReturnErrorOnFailure(KeyValueStoreMgr().Delete(key));
+    timing.Add(Now() - startUs);
+    return CHIP_NO_ERROR;
+}
+
+// Time the puts, gets and deletes of KVS_BENCHMARK_ITERATIONS keys of the size, over the keys already stored
+CHIP_ERROR BenchmarkOperations(const char * test, size_t size, unsigned fill)
+{
+    Timing put, get, remove;
+    char key[16];
+
+    for (unsigned i = 0; i < KVS_BENCHMARK_ITERATIONS; i++)
+    {
+        MakeKey(key, kProbeKeyFormat, i);
+        ReturnErrorOnFailure(TimedPut(key, size, i, put));
+    }
+    for (unsigned i = 0; i < KVS_BENCHMARK_ITERATIONS; i++)
+    {
+        MakeKey(key, kProbeKeyFormat, i);
+        ReturnErrorOnFailure(TimedGet(key, size, i, get));
+    }
+    for (unsigned i = 0; i < KVS_BENCHMARK_ITERATIONS; i++)
+    {
+        MakeKey(key, kProbeKeyFormat, i);
+        ReturnErrorOnFailure(TimedDelete(key, remove));
+    }
+
+    put.Log(test, size, fill, "put");
+    get.Log(test, size, fill, "get");
+    remove.Log(test, size, fill, "delete");
+    return CHIP_NO_ERROR;
+}
+
+// Store kFillValueSize-byte values under the fill keys until there are fill of them
+CHIP_ERROR FillTo(unsigned fill, unsigned & filled)
+{
+    char key[16];
+
+    for (; filled < fill; filled++)
+    {
+        MakeKey(key, kFillKeyFormat, filled);
+        FillPattern(sWriteBuffer, kFillValueSize, filled);
+        ReturnErrorOnFailure(KeyValueStoreMgr().Put(key, sWriteBuffer, kFillValueSize));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Delete the fill keys, those of a previous run included, ignoring the keys not found
+void ClearFill()
+{
+    char key[16];
+
+    KeyValueStoreMgr().Delete(kMarkerKey);
+    for (unsigned i = 0; i < KVS_BENCHMARK_MAX_FILL; i++)
+    {
+        MakeKey(key, kFillKeyFormat, i);
+        KeyValueStoreMgr().Delete(key);
+    }
+}
+
+// Read back the keys the previous run left, which were written before the last reset or power cycle
+CHIP_ERROR BenchmarkRecovery(uint64_t initDurationUs)
+{
+    uint32_t stored = 0;
+    Timing init, get;
+    char key[16];
+
+    if (initDurationUs != 0)
+    {
+        init.Add(initDurationUs);
+        init.Log("recovery", 0, 0, "init");
+    }
+
+    // The first run has nothing to recover
+    VerifyOrReturnError(KeyValueStoreMgr().Get(kMarkerKey, &stored) == CHIP_NO_ERROR, CHIP_NO_ERROR);
+    VerifyOrReturnError(stored <= KVS_BENCHMARK_MAX_FILL, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    for (unsigned i = 0; i < stored; i++)
+    {
+        MakeKey(key, kFillKeyFormat, i);
+        ReturnErrorOnFailure(TimedGet(key, kFillValueSize, i, get));
+    }
+
+    get.Log("recovery", kFillValueSize, static_cast<unsigned>(stored), "get");
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark(uint64_t initDurationUs)
+{
+    ReturnErrorOnFailure(BenchmarkRecovery(initDurationUs));
+    ClearFill();
+
+    for (size_t size : kValueSizes)
+    {
+        if (size <= KVS_BENCHMARK_MAX_VALUE_SIZE)
+        {
+            ReturnErrorOnFailure(BenchmarkOperations("size", size, 0));
+        }
+    }
+
+    unsigned filled = 0;
+    for (unsigned fill : kFillLevels)
+    {
+        ReturnErrorOnFailure(FillTo(fill, filled));
+        ReturnErrorOnFailure(BenchmarkOperations("fill", kFillValueSize, fill));
+    }
+
+    // Leave the largest fill for the next start-up to read back
+    return KeyValueStoreMgr().Put(kMarkerKey, static_cast<uint32_t>(filled));
+}
+
+} // namespace
+
+void RunKvsBenchmark(uint64_t initDurationUs)
+{
+    ChipLogProgress(NotSpecified, "KVS_BENCH,test,value_size,fill,op,count,min_us,avg_us,max_us,bytes_per_s");
+
+    const CHIP_ERROR err = RunBenchmark(initDurationUs);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(NotSpecified, "KVS benchmark: FAILED %d [%s]", err, chip::ErrorStr(err));
+    }
+}
+
+} // namespace chip
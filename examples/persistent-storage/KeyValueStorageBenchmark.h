@@ -0,0 +1,53 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/// The largest value written, the value sizes past it being skipped for the backends which cannot store them.
+#ifndef KVS_BENCHMARK_MAX_VALUE_SIZE
+#define KVS_BENCHMARK_MAX_VALUE_SIZE 1024
+#endif
+
+/// The number of times each operation is timed, for each value size and fill level.
+#ifndef KVS_BENCHMARK_ITERATIONS
+#define KVS_BENCHMARK_ITERATIONS 16
+#endif
+
+/// The number of keys of the largest fill level, which are also left in the store for the recovery after a power cycle.
+#ifndef KVS_BENCHMARK_MAX_FILL
+#define KVS_BENCHMARK_MAX_FILL 64
+#endif
+
+namespace chip {
+
+/**
+ * Time the puts, gets and deletes of the key value store manager across value sizes and fill levels, then the reads on
+ * start-up of the keys left by the previous run, and log each result as a line of comma-separated values:
+ *
+ *     KVS_BENCH,<test>,<value size>,<fill>,<op>,<count>,<min us>,<avg us>,<max us>,<bytes per second>
+ *
+ * which is the same on every platform, for runs on several SoCs, or before and after a change of a backend, to be compared.
+ *
+ * @param initDurationUs    How long the initialization of the store took on start-up, which the platform times, or 0 if it
+ *                          did not.
+ */
+void RunKvsBenchmark(uint64_t initDurationUs = 0);
+
+} // namespace chip
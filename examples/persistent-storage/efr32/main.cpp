@@ -28,6 +28,7 @@
 #include <task.h>
 
 #include "AppConfig.h"
+#include "KeyValueStorageBenchmark.h"
 #include "KeyValueStorageTest.h"
 #include "init_efrPlatform.h"
 #include <platform/KeyValueStoreManager.h>
@@ -35,6 +36,10 @@
 static TaskHandle_t sTestTaskHandle;
 void TestTask(void * pvParameter)
 {
+    // The store was initialized before the scheduler started, and the ticks the clock counts: its duration is not known
+    EFR32_LOG("Running Benchmark:");
+    chip::RunKvsBenchmark();
+
     while (1)
     {
         EFR32_LOG("Running Tests:");
@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 
+#include "KeyValueStorageBenchmark.h"
 #include "KeyValueStorageTest.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
@@ -22,12 +23,14 @@
 #include "nvs_flash.h"
 #include <platform/KeyValueStoreManager.h>
 #include <support/ErrorStr.h>
+#include <system/SystemLayer.h>
 
 const char * TAG = "persistent-storage";
 
 extern "C" void app_main()
 {
-    auto err = nvs_flash_init();
+    uint64_t initStartUs = chip::System::Layer::GetClock_MonotonicHiRes();
+    auto err             = nvs_flash_init();
     if (err != CHIP_NO_ERROR)
     {
         ESP_LOGE(TAG, "nvs_flash_init() failed: %s", ::chip::ErrorStr(err));
@@ -37,6 +40,9 @@ extern "C" void app_main()
     ESP_LOGI(TAG, "chip-esp32-persitent-storage-example starting");
     ESP_LOGI(TAG, "=============================================");
 
+    ESP_LOGI(TAG, "Running Benchmark:");
+    chip::RunKvsBenchmark(chip::System::Layer::GetClock_MonotonicHiRes() - initStartUs);
+
     // Run tests
     while (1)
     {
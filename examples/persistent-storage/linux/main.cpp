@@ -21,8 +21,10 @@
 #include <core/CHIPError.h>
 #include <support/CHIPMem.h>
 
+#include "KeyValueStorageBenchmark.h"
 #include "KeyValueStorageTest.h"
 #include <platform/KeyValueStoreManager.h>
+#include <system/SystemLayer.h>
 
 #include <iostream>
 
@@ -30,17 +32,24 @@ using namespace chip;
 
 int main(int argc, char * argv[])
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    CHIP_ERROR err          = CHIP_NO_ERROR;
+    uint64_t initStartUs    = 0;
+    uint64_t initDurationUs = 0;
 
     err = chip::Platform::MemoryInit();
     SuccessOrExit(err);
 
+    initStartUs = chip::System::Layer::GetClock_MonotonicHiRes();
     chip::DeviceLayer::PersistedStorage::KeyValueStoreMgrImpl().Init("/tmp/chip_example_kvs");
+    initDurationUs = chip::System::Layer::GetClock_MonotonicHiRes() - initStartUs;
 
     printf("=============================================\n");
     printf("chip-linux-persitent-storage-example starting\n");
     printf("=============================================\n");
 
+    printf("Running Benchmark:\n");
+    chip::RunKvsBenchmark(initDurationUs);
+
     while (1)
     {
         printf("Running Tests:\n");
@@ -26,6 +26,7 @@
 #include <FreeRTOS.h>
 #include <task.h>
 
+#include "KeyValueStorageBenchmark.h"
 #include "KeyValueStorageTest.h"
 #include <platform/KeyValueStoreManager.h>
 
@@ -36,6 +37,10 @@
 static TaskHandle_t sTestTaskHandle;
 void TestTask(void * pvParameter)
 {
+    // The store is initialized with the Qorvo stack, which is not timed
+    qvCHIP_Printf(LOG_MODULE_ID, "Running Benchmark:");
+    chip::RunKvsBenchmark();
+
     while (1)
     {
         qvCHIP_Printf(LOG_MODULE_ID, "Running Tests:");
@@ -25,8 +25,10 @@
 #include "uart.h"
 
 #include "PigweedLoggerMutex.h"
+#include "TelemetryService.h"
 #include "pigweed/RpcService.h"
 #include <FreeRTOS.h>
+#include <semphr.h>
 #include <task.h>
 
 static LEDWidget sStatusLED;
@@ -38,11 +40,31 @@ using std::byte;
 #define RPC_TASK_PRIORITY 2
 static TaskHandle_t sRpcTaskHandle;
 
+// The telemetry is sampled at this period, the shortest interval a client can stream it at
+#define TELEMETRY_TASK_STACK_SIZE 1024
+#define TELEMETRY_TASK_PRIORITY 1
+#define TELEMETRY_SAMPLE_PERIOD_MS 100
+static TaskHandle_t sTelemetryTaskHandle;
+
+class TelemetryMutex : public ::chip::rpc::Mutex
+{
+public:
+    void Init() { mSemaphore = xSemaphoreCreateMutex(); }
+    void Lock() override { xSemaphoreTake(mSemaphore, portMAX_DELAY); }
+    void Unlock() override { xSemaphoreGive(mSemaphore); }
+
+private:
+    SemaphoreHandle_t mSemaphore = nullptr;
+};
+
 pw::rpc::EchoService echo_service;
+TelemetryMutex telemetry_mutex;
+chip::rpc::Telemetry telemetry_service(&telemetry_mutex);
 
 void RegisterServices(pw::rpc::Server & server)
 {
     server.RegisterService(echo_service);
+    server.RegisterService(telemetry_service);
 }
 
 void RunRpcService(void *)
@@ -50,6 +72,16 @@ void RunRpcService(void *)
     Start(RegisterServices, &::chip::rpc::logger_mutex);
 }
 
+// The samples are written from this task, the channel output serializing them with the responses of the RPC task
+void RunTelemetrySampling(void *)
+{
+    while (true)
+    {
+        telemetry_service.Sample();
+        vTaskDelay(pdMS_TO_TICKS(TELEMETRY_SAMPLE_PERIOD_MS));
+    }
+}
+
 } // namespace
 
 int main(void)
@@ -63,7 +95,10 @@ int main(void)
     sStatusLED.Init(SYSTEM_STATE_LED);
     sStatusLED.Set(true);
 
+    telemetry_mutex.Init();
     xTaskCreate(RunRpcService, "RPC_Task", RPC_TASK_STACK_SIZE / sizeof(StackType_t), nullptr, RPC_TASK_PRIORITY, &sRpcTaskHandle);
+    xTaskCreate(RunTelemetrySampling, "Telemetry_Task", TELEMETRY_TASK_STACK_SIZE / sizeof(StackType_t), nullptr,
+                TELEMETRY_TASK_PRIORITY, &sTelemetryTaskHandle);
 
     vTaskStartScheduler();
 }
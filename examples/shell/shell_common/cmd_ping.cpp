@@ -26,6 +26,7 @@
 #include <messaging/ExchangeMgr.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <protocols/echo/Echo.h>
+#include <protocols/echo/EchoBenchmark.h>
 #include <protocols/secure_channel/PASESession.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/SecureSessionMgr.h>
@@ -57,8 +58,13 @@ public:
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
         mUsingTCP = false;
 #endif
-        mUsingCRMP = true;
-        mEchoPort  = CHIP_PORT;
+        mUsingCRMP         = true;
+        mEchoPort          = CHIP_PORT;
+        mBenchmark         = false;
+        mMaxOutstanding    = 1;
+        mMaxEchoReqSize    = 0;
+        mEchoReqSizeStep   = 0;
+        mBenchmarkInterval = 0;
     }
 
     uint64_t GetLastEchoTime() const { return mLastEchoTime; }
@@ -95,6 +101,21 @@ public:
     bool IsUsingCRMP() const { return mUsingCRMP; }
     void SetUsingCRMP(bool value) { mUsingCRMP = value; }
 
+    bool IsBenchmark() const { return mBenchmark; }
+    void SetBenchmark(bool value) { mBenchmark = value; }
+
+    uint16_t GetMaxOutstanding() const { return mMaxOutstanding; }
+    void SetMaxOutstanding(uint16_t value) { mMaxOutstanding = value; }
+
+    uint32_t GetMaxEchoReqSize() const { return mMaxEchoReqSize; }
+    void SetMaxEchoReqSize(uint32_t value) { mMaxEchoReqSize = value; }
+
+    uint32_t GetEchoReqSizeStep() const { return mEchoReqSizeStep; }
+    void SetEchoReqSizeStep(uint32_t value) { mEchoReqSizeStep = value; }
+
+    uint32_t GetBenchmarkInterval() const { return mBenchmarkInterval; }
+    void SetBenchmarkInterval(uint32_t value) { mBenchmarkInterval = value; }
+
 private:
     // The last time a echo request was attempted to be sent.
     uint64_t mLastEchoTime;
@@ -125,9 +146,23 @@ private:
 #endif
 
     bool mUsingCRMP;
+
+    // True, if the echo requests are pipelined by the benchmark rather than sent one per interval.
+    bool mBenchmark;
+
+    // The echo requests the benchmark keeps awaiting their response at once.
+    uint16_t mMaxOutstanding;
+
+    // The payload size the benchmark grows the requests up to by mEchoReqSizeStep, or 0 to send them all of mEchoReqSize.
+    uint32_t mMaxEchoReqSize;
+    uint32_t mEchoReqSizeStep;
+
+    // The least time between two benchmark requests in milliseconds, or 0 to not limit their rate.
+    uint32_t mBenchmarkInterval;
 } gPingArguments;
 
 Protocols::Echo::EchoClient gEchoClient;
+Protocols::Echo::EchoBenchmark gEchoBenchmark;
 
 bool EchoIntervalExpired(void)
 {
@@ -234,6 +269,85 @@ void HandleEchoResponseReceived(Messaging::ExchangeContext * ec, System::PacketB
                     payload->DataLength(), static_cast<double>(transitTime) / 1000);
 }
 
+void PrintBenchmarkResults(streamer_t * stream)
+{
+    using Protocols::Echo::EchoBenchmark;
+    using Protocols::Echo::EchoBenchmarkStats;
+    using Protocols::Echo::EchoLatencyHistogram;
+
+    streamer_printf(stream, "Benchmark ran for %.3fms\n", static_cast<double>(gEchoBenchmark.GetElapsedUs()) / 1000);
+
+    for (size_t i = 0; i < EchoBenchmark::kTransportTypeCount; i++)
+    {
+        Transport::Type transport        = static_cast<Transport::Type>(i);
+        const EchoBenchmarkStats & stats = gEchoBenchmark.GetStats(transport);
+
+        if (stats.mSent == 0)
+        {
+            continue;
+        }
+
+        streamer_printf(stream, "%s: sent=%" PRIu32 " received=%" PRIu32 " lost=%" PRIu32 "(%.2f%%) failed=%" PRIu32 "\n",
+                        EchoBenchmark::GetTransportName(transport), stats.mSent, stats.mReceived, stats.mLost,
+                        static_cast<double>(stats.mLost) * 100 / stats.mSent, stats.mSendFailures);
+        streamer_printf(stream,
+                        "  rtt min=%" PRIu64 "us mean=%" PRIu64 "us p50=%" PRIu64 "us p90=%" PRIu64 "us p99=%" PRIu64
+                        "us max=%" PRIu64 "us\n",
+                        stats.mRtt.GetMinUs(), stats.mRtt.GetMeanUs(), stats.mRtt.GetPercentileUs(50),
+                        stats.mRtt.GetPercentileUs(90), stats.mRtt.GetPercentileUs(99), stats.mRtt.GetMaxUs());
+
+        for (size_t bucket = 0; bucket < EchoLatencyHistogram::kBucketCount; bucket++)
+        {
+            if (stats.mRtt.GetBucketCount(bucket) > 0)
+            {
+                streamer_printf(stream, "  >= %8" PRIu64 "us: %" PRIu32 "\n", EchoLatencyHistogram::GetBucketLowerBoundUs(bucket),
+                                stats.mRtt.GetBucketCount(bucket));
+            }
+        }
+    }
+}
+
+CHIP_ERROR RunBenchmark(streamer_t * stream)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Protocols::Echo::EchoBenchmarkParams params;
+    uint32_t maxSize = gPingArguments.GetMaxEchoReqSize();
+    bool running     = true;
+
+    VerifyOrReturnError(gPingArguments.GetEchoReqSize() <= UINT16_MAX && maxSize <= UINT16_MAX &&
+                            gPingArguments.GetEchoReqSizeStep() <= UINT16_MAX,
+                        CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    params.mRequestCount      = gPingArguments.GetMaxEchoCount();
+    params.mMaxOutstanding    = gPingArguments.GetMaxOutstanding();
+    params.mMinPayloadSize    = static_cast<uint16_t>(gPingArguments.GetEchoReqSize());
+    params.mMaxPayloadSize    = static_cast<uint16_t>(maxSize > 0 ? maxSize : gPingArguments.GetEchoReqSize());
+    params.mPayloadSizeStep   = static_cast<uint16_t>(gPingArguments.GetEchoReqSizeStep());
+    params.mRequestIntervalMs = gPingArguments.GetBenchmarkInterval();
+    params.mReliable          = gPingArguments.IsUsingCRMP();
+
+    streamer_printf(stream, "\nSend %" PRIu32 " echo requests, %" PRIu16 " at once, to Node: %" PRIu64 "\n",
+                    params.mRequestCount, params.mMaxOutstanding, kTestDeviceNodeId);
+
+    // The requests are sent and answered on the thread running the stack.
+    DeviceLayer::PlatformMgr().LockChipStack();
+    err = gEchoBenchmark.Start(&gExchangeManager, { kTestDeviceNodeId, 0, gAdminId }, params, nullptr, nullptr);
+    DeviceLayer::PlatformMgr().UnlockChipStack();
+    ReturnErrorOnFailure(err);
+
+    while (running)
+    {
+        sleep(1);
+
+        DeviceLayer::PlatformMgr().LockChipStack();
+        running = gEchoBenchmark.IsRunning();
+        DeviceLayer::PlatformMgr().UnlockChipStack();
+    }
+
+    PrintBenchmarkResults(stream);
+    return CHIP_NO_ERROR;
+}
+
 void StartPinging(streamer_t * stream, char * destination)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -300,6 +414,18 @@ void StartPinging(streamer_t * stream, char * destination)
 
     maxEchoCount = gPingArguments.GetMaxEchoCount();
 
+    if (gPingArguments.IsBenchmark())
+    {
+        err = RunBenchmark(stream);
+        if (err != CHIP_NO_ERROR)
+        {
+            streamer_printf(stream, "Benchmark failed: %s\n", ErrorStr(err));
+        }
+
+        // The requests are already sent.
+        maxEchoCount = 0;
+    }
+
     // Connection has been established. Now send the EchoRequests.
     for (unsigned int i = 0; i < maxEchoCount; i++)
     {
@@ -332,6 +458,7 @@ void StartPinging(streamer_t * stream, char * destination)
 #endif
     gUDPManager.Close();
 
+    gEchoBenchmark.Stop();
     gEchoClient.Shutdown();
     gExchangeManager.Shutdown();
     gSessionManager.Shutdown();
@@ -359,6 +486,11 @@ void PrintUsage(streamer_t * stream)
     streamer_printf(stream, "  -c  <count>     stop after <count> replies\n");
     streamer_printf(stream, "  -r  <1|0>       enable or disable CRMP\n");
     streamer_printf(stream, "  -s  <size>      payload size in bytes\n");
+    streamer_printf(stream, "  -b              benchmark: pipeline the requests, then print their round trip times\n");
+    streamer_printf(stream, "  -o  <count>     benchmark: requests awaiting their response at once\n");
+    streamer_printf(stream, "  -S  <size>      benchmark: largest payload size, growing from -s by -k\n");
+    streamer_printf(stream, "  -k  <step>      benchmark: payload size step in bytes\n");
+    streamer_printf(stream, "  -d  <delay>     benchmark: least delay between two requests in milliseconds\n");
 }
 
 int cmd_ping(int argc, char ** argv)
@@ -452,6 +584,62 @@ int cmd_ping(int argc, char ** argv)
                 }
             }
             break;
+        case 'b':
+            gPingArguments.SetBenchmark(true);
+            break;
+        case 'o':
+            if (++optIndex >= argc || argv[optIndex][0] == '-')
+            {
+                streamer_printf(sout, "Invalid argument specified for -o\n");
+                return -1;
+            }
+            else
+            {
+                int arg = atoi(argv[optIndex]);
+
+                if (arg > 0 && arg <= Protocols::Echo::EchoBenchmark::kMaxOutstandingRequests)
+                {
+                    gPingArguments.SetMaxOutstanding(static_cast<uint16_t>(arg));
+                }
+                else
+                {
+                    ret = -1;
+                }
+            }
+            break;
+        case 'S':
+            if (++optIndex >= argc || argv[optIndex][0] == '-')
+            {
+                streamer_printf(sout, "Invalid argument specified for -S\n");
+                return -1;
+            }
+            else
+            {
+                gPingArguments.SetMaxEchoReqSize(atol(argv[optIndex]));
+            }
+            break;
+        case 'k':
+            if (++optIndex >= argc || argv[optIndex][0] == '-')
+            {
+                streamer_printf(sout, "Invalid argument specified for -k\n");
+                return -1;
+            }
+            else
+            {
+                gPingArguments.SetEchoReqSizeStep(atol(argv[optIndex]));
+            }
+            break;
+        case 'd':
+            if (++optIndex >= argc || argv[optIndex][0] == '-')
+            {
+                streamer_printf(sout, "Invalid argument specified for -d\n");
+                return -1;
+            }
+            else
+            {
+                gPingArguments.SetBenchmarkInterval(atol(argv[optIndex]));
+            }
+            break;
         default:
             ret = -1;
         }
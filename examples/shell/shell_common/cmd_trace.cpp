@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/CHIPCore.h>
+#include <lib/shell/shell_core.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemTrace.h>
+
+#if CONFIG_DEVICE_LAYER
+#include <platform/CHIPDeviceLayer.h>
+#endif
+
+#include <inttypes.h>
+
+#include <ChipShellCollection.h>
+
+using namespace chip;
+using namespace chip::Shell;
+using namespace chip::System;
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+
+static chip::Shell::Shell sShellTraceSubcommands;
+
+// The spans are recorded from the thread of the CHIP stack
+class TraceLock
+{
+public:
+#if CONFIG_DEVICE_LAYER
+    TraceLock() { DeviceLayer::PlatformMgr().LockChipStack(); }
+    ~TraceLock() { DeviceLayer::PlatformMgr().UnlockChipStack(); }
+#endif
+};
+
+int cmd_trace_help_iterator(shell_command_t * command, void * arg)
+{
+    streamer_printf(streamer_get(), "  %-15s %s\n\r", command->cmd_name, command->cmd_help);
+    return 0;
+}
+
+int cmd_trace_help(int argc, char ** argv)
+{
+    sShellTraceSubcommands.ForEachCommand(cmd_trace_help_iterator, nullptr);
+    return 0;
+}
+
+int cmd_trace_stats(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+    TraceLock lock;
+
+    streamer_printf(sout, "%-24s %10s %10s %10s %10s %10s %10s\n\r", "stage", "count", "mean(us)", "p50(us)", "p90(us)", "p99(us)",
+                    "max(us)");
+    for (uint8_t i = 0; i < Trace::kStage_Max; i++)
+    {
+        Trace::Stage stage                 = static_cast<Trace::Stage>(i);
+        const Trace::Histogram & histogram = Trace::GetHistogram(stage);
+        uint64_t meanUs                    = (histogram.mCount > 0) ? histogram.mTotalUs / histogram.mCount : 0;
+
+        streamer_printf(sout, "%-24s %10" PRIu32 " %10" PRIu64 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 "\n\r",
+                        Trace::GetStageName(stage), histogram.mCount, meanUs, Trace::GetPercentileUs(stage, 50),
+                        Trace::GetPercentileUs(stage, 90), Trace::GetPercentileUs(stage, 99), histogram.mMaxUs);
+    }
+    return 0;
+}
+
+void cmd_trace_write(void * context, const char * text)
+{
+    streamer_printf(streamer_get(), "%s", text);
+}
+
+int cmd_trace_json(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+    TraceLock lock;
+
+    Trace::ExportChromeTrace(cmd_trace_write, nullptr);
+    streamer_printf(sout, "\n\r");
+    return 0;
+}
+
+int cmd_trace_reset(int argc, char ** argv)
+{
+    TraceLock lock;
+
+    Trace::Reset();
+    return 0;
+}
+
+int cmd_trace_dispatch(int argc, char ** argv)
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+
+    VerifyOrExit(argc > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    error = sShellTraceSubcommands.ExecCommand(argc, argv);
+
+exit:
+    return error;
+}
+
+static const shell_command_t cmds_trace_root = { &cmd_trace_dispatch, "trace", "Latency tracing commands" };
+
+/// Subcommands for root command: `trace <subcommand>`
+static const shell_command_t cmds_trace[] = {
+    { &cmd_trace_help, "help", "Usage: trace <subcommand>" },
+    { &cmd_trace_stats, "stats", "Print the latency percentiles of each stage. Usage: trace stats" },
+    { &cmd_trace_json, "json", "Print the recent spans as Chrome / Perfetto trace JSON. Usage: trace json" },
+    { &cmd_trace_reset, "reset", "Forget the spans recorded until now. Usage: trace reset" },
+};
+
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+
+void cmd_trace_init()
+{
+#if CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+    // Register `trace` subcommands with the local shell dispatcher.
+    sShellTraceSubcommands.RegisterCommands(cmds_trace, ArraySize(cmds_trace));
+
+    // Register the root `trace` command with the top-level shell.
+    shell_register(&cmds_trace_root, 1);
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+}
@@ -47,6 +47,7 @@ int main()
     cmd_otcli_init();
     cmd_ping_init();
     cmd_send_init();
+    cmd_trace_init();
 
     shell_task(nullptr);
     return 0;
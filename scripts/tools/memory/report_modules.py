@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 Project CHIP Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Generate a per-module report of memory use.
+
+This program reads memory usage information and produces a table with
+one row for each source module and one column for each region (commonly
+`FLASH` and `RAM`), so that the cost of a module to a device image can
+be read directly and compared between builds.
+
+A module is named by the leading `--depth` directory components
+of the compilation unit of each symbol, e.g. `src/app` or `third_party/lwip`
+with the default depth of 2. The compilation unit is only available from
+some collection methods; usually `--collect-method=bloaty`.
+
+Use `--collect-method=help` to see available collection methods.
+Use `--output-format=help` to see available output formats.
+"""
+
+import os
+import sys
+
+import numpy as np  # type: ignore
+
+import memdf.collect
+import memdf.name
+import memdf.report
+import memdf.select
+
+from memdf import Config, ConfigDescription, DFs, SymbolDF
+
+MODULE_CONFIG: ConfigDescription = {
+    Config.group_map('report'): {
+        'group': 'output'
+    },
+    'report.module-depth': {
+        'help': 'Number of leading source directory components naming a module',
+        'metavar': 'DEPTH',
+        'default': 2,
+        'argparse': {
+            'alias': ['--depth'],
+            'type': int,
+        },
+    },
+}
+
+
+def module_of(cu: str, depth: int) -> str:
+    """Return the module of a compilation unit."""
+    if not cu:
+        return memdf.name.UNKNOWN
+    # Sources outside the build directory are seen through '..' components.
+    parts = [
+        p for p in os.path.normpath(os.path.dirname(cu)).split(os.path.sep)
+        if p not in ('', '.', '..')
+    ]
+    if not parts:
+        return memdf.name.UNKNOWN
+    return os.path.join(*parts[:depth])
+
+
+def main(argv):
+    status = 0
+    try:
+        config: Config = memdf.collect.parse_args(
+            {
+                **memdf.select.CONFIG,
+                **memdf.report.REPORT_LIMIT_CONFIG,
+                **MODULE_CONFIG,
+                **memdf.report.OUTPUT_CONFIG,
+            }, argv)
+        config['args.need_cu'] = True
+        config.put('section.select-all', True)
+        dfs: DFs = memdf.collect.collect_files(config)
+
+        symbols = dfs[SymbolDF.name]
+        symbols = symbols[~(
+            symbols.symbol.str.startswith(memdf.name.UNUSED_PREFIX)
+            | symbols.symbol.str.startswith(memdf.name.OVERLAP_PREFIX))]
+        depth = config['report.module-depth']
+        symbols = symbols.assign(
+            module=symbols.cu.apply(lambda cu: module_of(cu, depth)))
+
+        modules = symbols.pivot_table(index='module',
+                                      columns='region',
+                                      values='size',
+                                      aggfunc=np.sum,
+                                      fill_value=0)
+        modules['total'] = modules.sum(axis=1)
+        if limit := config['report.limit']:
+            modules = modules[modules.total > limit]
+        modules = modules.sort_values(by='total',
+                                      ascending=False).reset_index()
+        modules.columns.name = None
+        memdf.report.write_dfs(config, {SymbolDF.name: modules})
+
+    except Exception as exception:
+        status = 1
+        raise exception
+
+    return status
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,187 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the registry through which the changes of the
+ *      attributes of the data model are dispatched to the in-process
+ *      observers of each attribute.
+ */
+
+#include <app/AttributeObserverRegistry.h>
+
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+AttributeObserver::~AttributeObserver()
+{
+    if (mpPendingRegistry != nullptr)
+    {
+        mpPendingRegistry->CancelPending(*this);
+    }
+}
+
+AttributeObservation::~AttributeObservation()
+{
+    if (mpRegistry != nullptr)
+    {
+        mpRegistry->Unobserve(*this);
+    }
+}
+
+AttributeObserverRegistry & AttributeObserverRegistry::GetInstance()
+{
+    static AttributeObserverRegistry sInstance;
+    return sInstance;
+}
+
+size_t AttributeObserverRegistry::Bucket(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    uint32_t key = (static_cast<uint32_t>(aEndpointId) << 16) ^ static_cast<uint32_t>(aClusterId) ^
+        (static_cast<uint32_t>(aAttributeId) * 0x9E3779B1u);
+    key ^= key >> 15;
+    key *= 0x2C1B3C6Du;
+    key ^= key >> 12;
+    return key % kBucketCount;
+}
+
+CHIP_ERROR AttributeObserverRegistry::Observe(AttributeObservation & aObservation)
+{
+    VerifyOrReturnError(aObservation.mpRegistry == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    AttributeObservation *& head = mpBuckets[Bucket(aObservation.mEndpointId, aObservation.mClusterId, aObservation.mAttributeId)];
+
+    aObservation.mpRegistry = this;
+    aObservation.mpPrev     = nullptr;
+    aObservation.mpNext     = head;
+    if (head != nullptr)
+    {
+        head->mpPrev = &aObservation;
+    }
+    head = &aObservation;
+    return CHIP_NO_ERROR;
+}
+
+void AttributeObserverRegistry::Unobserve(AttributeObservation & aObservation)
+{
+    VerifyOrReturn(aObservation.mpRegistry == this);
+
+    for (DispatchCursor * cursor = mpCursors; cursor != nullptr; cursor = cursor->mpOuter)
+    {
+        if (cursor->mpNext == &aObservation)
+        {
+            cursor->mpNext = aObservation.mpNext;
+        }
+    }
+
+    if (aObservation.mpPrev != nullptr)
+    {
+        aObservation.mpPrev->mpNext = aObservation.mpNext;
+    }
+    else
+    {
+        mpBuckets[Bucket(aObservation.mEndpointId, aObservation.mClusterId, aObservation.mAttributeId)] = aObservation.mpNext;
+    }
+    if (aObservation.mpNext != nullptr)
+    {
+        aObservation.mpNext->mpPrev = aObservation.mpPrev;
+    }
+
+    aObservation.mpRegistry = nullptr;
+    aObservation.mpNext     = nullptr;
+    aObservation.mpPrev     = nullptr;
+}
+
+void AttributeObserverRegistry::NotifyAttributeChanged(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    // A change outside of a batch is a batch of its own.
+    BeginBatch();
+    Dispatch(aEndpointId, aClusterId, aAttributeId, aAttributeId);
+    if (aAttributeId != AttributeObservation::kAnyAttributeId)
+    {
+        Dispatch(aEndpointId, aClusterId, aAttributeId, AttributeObservation::kAnyAttributeId);
+    }
+    EndBatch();
+}
+
+void AttributeObserverRegistry::Dispatch(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId,
+                                         AttributeId aObservedAttributeId)
+{
+    DispatchCursor cursor = { mpBuckets[Bucket(aEndpointId, aClusterId, aObservedAttributeId)], mpCursors };
+    mpCursors             = &cursor;
+
+    while (cursor.mpNext != nullptr)
+    {
+        AttributeObservation * observation = cursor.mpNext;
+        cursor.mpNext                      = observation->mpNext;
+
+        // Other keys share the bucket.
+        if (observation->mEndpointId != aEndpointId || observation->mClusterId != aClusterId ||
+            observation->mAttributeId != aObservedAttributeId)
+        {
+            continue;
+        }
+
+        AttributeObserver & observer = observation->mObserver;
+        if (observer.mpPendingRegistry == nullptr)
+        {
+            observer.mpPendingRegistry = this;
+            observer.mpNextPending     = mpPendingHead;
+            mpPendingHead              = &observer;
+        }
+        observer.OnAttributeChanged(aEndpointId, aClusterId, aAttributeId);
+    }
+
+    mpCursors = cursor.mpOuter;
+}
+
+void AttributeObserverRegistry::EndBatch()
+{
+    VerifyOrReturn(mBatchDepth > 0);
+    VerifyOrReturn(--mBatchDepth == 0);
+
+    // Observers may make changes from OnAttributeChangesEnd, which end batches of their own, so the list is drained one
+    // observer at a time.
+    while (mpPendingHead != nullptr)
+    {
+        AttributeObserver * observer = mpPendingHead;
+        mpPendingHead                = observer->mpNextPending;
+        observer->mpNextPending      = nullptr;
+        observer->mpPendingRegistry  = nullptr;
+        observer->OnAttributeChangesEnd();
+    }
+}
+
+void AttributeObserverRegistry::CancelPending(AttributeObserver & aObserver)
+{
+    for (AttributeObserver ** link = &mpPendingHead; *link != nullptr; link = &(*link)->mpNextPending)
+    {
+        if (*link == &aObserver)
+        {
+            *link = aObserver.mpNextPending;
+            break;
+        }
+    }
+    aObserver.mpNextPending     = nullptr;
+    aObserver.mpPendingRegistry = nullptr;
+}
+
+} // namespace app
+} // namespace chip
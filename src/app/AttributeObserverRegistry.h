@@ -0,0 +1,190 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the registry through which the changes of the
+ *      attributes of the data model are dispatched to the in-process
+ *      observers of each attribute.
+ */
+
+#pragma once
+
+#include <app/util/basic-types.h>
+#include <core/CHIPConfig.h>
+#include <core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+class AttributeObserverRegistry;
+
+/**
+ * Observes the attributes it registers AttributeObservation objects for, in AttributeObserverRegistry.
+ *
+ * The changes of the attributes are batched: changes made while processing a Write Request or an Invoke Request are in one
+ * batch, and any other change is in a batch of its own. OnAttributeChangesEnd is called once at the end of each batch in
+ * which OnAttributeChanged was called, so that work depending on several attributes is done once for all of them.
+ */
+class AttributeObserver
+{
+public:
+    virtual ~AttributeObserver();
+
+    /**
+     * Called after the value of an observed attribute is written.
+     */
+    virtual void OnAttributeChanged(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) = 0;
+
+    /**
+     * Called at the end of a batch of changes in which OnAttributeChanged was called.
+     */
+    virtual void OnAttributeChangesEnd() {}
+
+private:
+    friend class AttributeObserverRegistry;
+
+    // Set while the observer waits for the end of a batch of the registry
+    AttributeObserverRegistry * mpPendingRegistry = nullptr;
+    AttributeObserver * mpNextPending             = nullptr;
+};
+
+/**
+ * The interest of an observer in an attribute, or in all the attributes of a cluster on an endpoint. It is owned by the
+ * observer and linked into the registry, so registering it does not allocate, and it is unregistered when destroyed.
+ */
+class AttributeObservation
+{
+public:
+    /// Observe every attribute of the cluster.
+    static constexpr AttributeId kAnyAttributeId = 0xFFFF;
+
+    AttributeObservation(AttributeObserver & aObserver, EndpointId aEndpointId, ClusterId aClusterId,
+                         AttributeId aAttributeId = kAnyAttributeId) :
+        mObserver(aObserver),
+        mEndpointId(aEndpointId), mClusterId(aClusterId), mAttributeId(aAttributeId)
+    {}
+    ~AttributeObservation();
+
+    AttributeObservation(const AttributeObservation &) = delete;
+    AttributeObservation & operator=(const AttributeObservation &) = delete;
+
+    bool IsRegistered() const { return mpRegistry != nullptr; }
+
+private:
+    friend class AttributeObserverRegistry;
+
+    AttributeObserver & mObserver;
+    const EndpointId mEndpointId;
+    const ClusterId mClusterId;
+    const AttributeId mAttributeId;
+    AttributeObserverRegistry * mpRegistry = nullptr;
+    AttributeObservation * mpNext          = nullptr;
+    AttributeObservation * mpPrev          = nullptr;
+};
+
+/**
+ * Dispatches the changes of attributes to the observations of their endpoint, cluster and attribute, which are kept in hash
+ * buckets, so that the cost of a change does not grow with the number of attributes observed elsewhere.
+ *
+ * The registry is not thread safe, it is used from the thread running the CHIP stack.
+ */
+class AttributeObserverRegistry
+{
+public:
+    AttributeObserverRegistry() = default;
+
+    AttributeObserverRegistry(const AttributeObserverRegistry &) = delete;
+    AttributeObserverRegistry & operator=(const AttributeObserverRegistry &) = delete;
+
+    static AttributeObserverRegistry & GetInstance();
+
+    /**
+     * Register an observation, which must not be registered already.
+     */
+    CHIP_ERROR Observe(AttributeObservation & aObservation);
+
+    /**
+     * Unregister an observation. Observations may be unregistered from the observer callbacks.
+     */
+    void Unobserve(AttributeObservation & aObservation);
+
+    /**
+     * Notify the observers of an attribute that it was written.
+     */
+    void NotifyAttributeChanged(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId);
+
+    /**
+     * Defer the end of the batch of changes until the matching EndBatch. Batches nest.
+     */
+    void BeginBatch() { mBatchDepth++; }
+
+    /**
+     * End a batch begun by BeginBatch, calling OnAttributeChangesEnd on the observers notified in the outermost batch.
+     */
+    void EndBatch();
+
+    /**
+     * Batch the changes made during its lifetime.
+     */
+    class ScopedBatch
+    {
+    public:
+        explicit ScopedBatch(AttributeObserverRegistry & aRegistry = GetInstance()) : mRegistry(aRegistry)
+        {
+            mRegistry.BeginBatch();
+        }
+        ~ScopedBatch() { mRegistry.EndBatch(); }
+
+        ScopedBatch(const ScopedBatch &) = delete;
+        ScopedBatch & operator=(const ScopedBatch &) = delete;
+
+    private:
+        AttributeObserverRegistry & mRegistry;
+    };
+
+private:
+    friend class AttributeObserver;
+
+    static constexpr size_t kBucketCount = CHIP_CONFIG_ATTRIBUTE_OBSERVER_BUCKETS;
+    static_assert(kBucketCount > 0, "The observer registry needs at least one bucket");
+
+    // The observation a dispatch in progress visits next, moved on when that observation is unregistered. Dispatches
+    // nest when observers write attributes.
+    struct DispatchCursor
+    {
+        AttributeObservation * mpNext;
+        DispatchCursor * mpOuter;
+    };
+
+    static size_t Bucket(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId);
+
+    void Dispatch(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId, AttributeId aObservedAttributeId);
+    void CancelPending(AttributeObserver & aObserver);
+
+    AttributeObservation * mpBuckets[kBucketCount] = {};
+    DispatchCursor * mpCursors                     = nullptr;
+    AttributeObserver * mpPendingHead              = nullptr;
+    uint32_t mBatchDepth                           = 0;
+};
+
+} // namespace app
+} // namespace chip
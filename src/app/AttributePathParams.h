@@ -27,6 +27,10 @@ enum class AttributePathFlags : uint8_t
 {
     kFieldIdValid   = 0x01,
     kListIndexValid = 0x02,
+    // A wildcard path leaves ids out to cover every endpoint, cluster or attribute of the data model.
+    kEndpointIdWildcard = 0x04,
+    kClusterIdWildcard  = 0x08,
+    kFieldIdWildcard    = 0x10,
 };
 
 struct AttributePathParams
@@ -57,6 +61,20 @@ struct AttributePathParams
         }
         return true;
     }
+    bool HasWildcard() const
+    {
+        return mFlags.HasAny(AttributePathFlags::kEndpointIdWildcard, AttributePathFlags::kClusterIdWildcard,
+                             AttributePathFlags::kFieldIdWildcard);
+    }
+    /**
+     * Returns true if this path, wildcard or not, covers the concrete path aPath.
+     */
+    bool Covers(const AttributePathParams & aPath) const
+    {
+        return (mFlags.Has(AttributePathFlags::kEndpointIdWildcard) || mEndpointId == aPath.mEndpointId) &&
+            (mFlags.Has(AttributePathFlags::kClusterIdWildcard) || mClusterId == aPath.mClusterId) &&
+            (mFlags.Has(AttributePathFlags::kFieldIdWildcard) || mFieldId == aPath.mFieldId);
+    }
     chip::NodeId mNodeId         = 0;
     chip::EndpointId mEndpointId = 0;
     chip::ClusterId mClusterId   = 0;
@@ -23,6 +23,17 @@
 
 namespace chip {
 namespace app {
+/**
+ * Position of the expansion of a wildcard path over the data model: the indexes of an endpoint, of a server cluster
+ * on that endpoint and of an attribute of that cluster. See ExpandAttributePath.
+ */
+struct AttributePathCursor
+{
+    uint8_t mEndpointIndex   = 0;
+    uint8_t mClusterIndex    = 0;
+    uint16_t mAttributeIndex = 0;
+};
+
 struct ClusterInfo
 {
     ClusterInfo(const AttributePathParams & aAttributePathParams, bool aDirty) :
@@ -36,6 +47,12 @@ struct ClusterInfo
     AttributePathParams mAttributePathParams;
     bool mDirty          = false;
     ClusterInfo * mpNext = nullptr;
+    // The concrete path of a wildcard path the next report resumes from.
+    AttributePathCursor mCursor;
+    // The data version of the cluster the initiator already has, for the first report of the path to skip the cluster if it
+    // has not changed since.
+    DataVersion mDataVersion = 0;
+    bool mHasDataVersion     = false;
 };
 } // namespace app
 } // namespace chip
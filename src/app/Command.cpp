@@ -141,7 +141,7 @@ void Command::Shutdown()
 
     mCommandIndex = 0;
 exit:
-    return;
+    ReleaseToPool();
 }
 
 CHIP_ERROR Command::PrepareCommand(const CommandPathParams * const apCommandPathParams, bool aIsStatus)
@@ -197,6 +197,14 @@ exit:
 CHIP_ERROR Command::ConstructCommandPath(const CommandPathParams & aCommandPathParams,
                                          CommandDataElement::Builder aCommandDataElement)
 {
+    if (aCommandPathParams.mFlags.Has(CommandPathFlags::kEndpointIdValid) &&
+        !aCommandPathParams.mFlags.Has(CommandPathFlags::kGroupIdValid))
+    {
+        aCommandDataElement.EncodeCommandPath(aCommandPathParams.mEndpointId, aCommandPathParams.mClusterId,
+                                              aCommandPathParams.mCommandId);
+        return aCommandDataElement.GetError();
+    }
+
     CommandPath::Builder commandPath = aCommandDataElement.CreateCommandPathBuilder();
     if (aCommandPathParams.mFlags.Has(CommandPathFlags::kEndpointIdValid))
     {
@@ -29,6 +29,7 @@
 #include <app/MessageDef/CommandDataElement.h>
 #include <app/MessageDef/CommandList.h>
 #include <app/MessageDef/InvokeCommand.h>
+#include <app/ObjectPool.h>
 #include <core/CHIPCore.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -44,7 +45,7 @@
 namespace chip {
 namespace app {
 
-class Command
+class Command : public PoolableObject
 {
 public:
     enum class CommandRoleId
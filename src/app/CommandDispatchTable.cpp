@@ -0,0 +1,188 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the lookup of cluster commands in the table of
+ *      the commands a device handles, and the decoding of their arguments.
+ */
+
+#include <app/CommandDispatchTable.h>
+
+#include <protocols/secure_channel/Constants.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <inttypes.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR CommandArgument::Decode(CommandArgumentType aType, TLV::TLVReader & aReader)
+{
+    // The integers are read with the reader getter of their size, so that they are truncated as they always were.
+    switch (aType)
+    {
+    case CommandArgumentType::kUnsigned8: {
+        uint8_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        mUnsigned = value;
+        break;
+    }
+    case CommandArgumentType::kUnsigned16: {
+        uint16_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        mUnsigned = value;
+        break;
+    }
+    case CommandArgumentType::kUnsigned32: {
+        uint32_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        mUnsigned = value;
+        break;
+    }
+    case CommandArgumentType::kUnsigned64:
+        return aReader.Get(mUnsigned);
+    case CommandArgumentType::kSigned8: {
+        int8_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        mSigned = value;
+        break;
+    }
+    case CommandArgumentType::kSigned16: {
+        int16_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        mSigned = value;
+        break;
+    }
+    case CommandArgumentType::kSigned32: {
+        int32_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        mSigned = value;
+        break;
+    }
+    case CommandArgumentType::kSigned64:
+        return aReader.Get(mSigned);
+    case CommandArgumentType::kBoolean:
+        return aReader.Get(mBoolean);
+    case CommandArgumentType::kOctetString:
+    case CommandArgumentType::kDataPtr:
+        mData = nullptr;
+        ReturnErrorOnFailure(aReader.GetDataPtr(mData));
+        mLength = aReader.GetLength();
+        break;
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    return CHIP_NO_ERROR;
+}
+
+const CommandDescriptor * FindCommandDescriptor(const CommandDescriptor * apDescriptors, size_t aCount, ClusterId aClusterId,
+                                                CommandId aCommandId)
+{
+    const CommandDescriptor * end = apDescriptors + aCount;
+    const CommandDescriptor * descriptor =
+        std::lower_bound(apDescriptors, end, aClusterId, [aCommandId](const CommandDescriptor & d, ClusterId clusterId) {
+            return d.mClusterId < clusterId || (d.mClusterId == clusterId && d.mCommandId < aCommandId);
+        });
+
+    if (descriptor == end || descriptor->mClusterId != aClusterId || descriptor->mCommandId != aCommandId)
+    {
+        return nullptr;
+    }
+    return descriptor;
+}
+
+CHIP_ERROR DecodeCommandArguments(const CommandDescriptor & aDescriptor, TLV::TLVReader & aReader, CommandArgument * apArguments)
+{
+    CHIP_ERROR err                     = CHIP_NO_ERROR;
+    bool present[kMaxCommandArguments] = {};
+    size_t presentCount                = 0;
+
+    VerifyOrReturnError(aDescriptor.mArgumentCount <= kMaxCommandArguments, CHIP_ERROR_INVALID_ARGUMENT);
+
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        uint32_t tag = TLV::TagNumFromTag(aReader.GetTag());
+
+        if (tag >= aDescriptor.mArgumentCount)
+        {
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            continue;
+        }
+        if (present[tag])
+        {
+            ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, tag);
+            return CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+        }
+
+        err = apArguments[tag].Decode(aDescriptor.mArgumentTypes[tag], aReader);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogProgress(Zcl, "Failed to decode TLV data with tag %" PRIx32 ": %" PRId32, tag, err);
+            return err;
+        }
+        present[tag] = true;
+        presentCount++;
+    }
+
+    // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    VerifyOrReturnError(presentCount == aDescriptor.mArgumentCount, CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT);
+    return CHIP_NO_ERROR;
+}
+
+void DispatchClusterCommand(const CommandDescriptor * apDescriptor, ClusterId aClusterId, CommandId aCommandId,
+                            TLV::TLVReader & aReader, Command * apCommandObj)
+{
+    CommandArgument arguments[kMaxCommandArguments];
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    if (apDescriptor == nullptr)
+    {
+        // Unrecognized cluster or command ID, error status will apply.
+        apCommandObj->AddStatusCode(nullptr, Protocols::SecureChannel::GeneralStatusCode::kNotFound, Protocols::SecureChannel::Id,
+                                    Protocols::SecureChannel::kProtocolCodeGeneralFailure);
+        ChipLogError(Zcl, "Unknown command %" PRIx8 " for cluster %" PRIx16, aCommandId, aClusterId);
+        return;
+    }
+
+    // The commands without arguments do not look at the command data.
+    if (apDescriptor->mArgumentCount > 0)
+    {
+        err = DecodeCommandArguments(*apDescriptor, aReader, arguments);
+    }
+
+    // TODO(#5590) We should encode a response of status code for invalid TLV.
+    if (err == CHIP_NO_ERROR)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        apDescriptor->mInvoke(apCommandObj, arguments);
+    }
+    else
+    {
+        apCommandObj->AddStatusCode(nullptr, Protocols::SecureChannel::GeneralStatusCode::kBadRequest, Protocols::SecureChannel::Id,
+                                    Protocols::SecureChannel::kProtocolCodeGeneralFailure);
+        ChipLogProgress(Zcl, "Failed to dispatch command %" PRIx8 " for cluster %" PRIx16 ": %" PRId32, aCommandId, aClusterId,
+                        err);
+    }
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,247 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the table of the cluster commands a device handles,
+ *      that the DispatchSingleClusterCommand generated by ZAP in
+ *      IMClusterCommandHandler.cpp looks commands up in. Each command is
+ *      described by the types of its arguments, which are all decoded by
+ *      the same code, and by a function giving the decoded arguments to the
+ *      cluster callback.
+ */
+
+#pragma once
+
+#include <app/Command.h>
+#include <app/util/basic-types.h>
+#include <core/CHIPTLV.h>
+#include <support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+namespace app {
+
+/**
+ * The most arguments a command can have.
+ */
+constexpr size_t kMaxCommandArguments = 16;
+
+enum class CommandArgumentType : uint8_t
+{
+    kUnsigned8,
+    kUnsigned16,
+    kUnsigned32,
+    kUnsigned64,
+    kSigned8,
+    kSigned16,
+    kSigned32,
+    kSigned64,
+    kBoolean,
+    kOctetString, ///< A byte string, given to the callback as a ByteSpan
+    kDataPtr,     ///< A character string or an array, given to the callback as a pointer to its data
+};
+
+/**
+ * The type of the arguments given to a callback as a T, e.g. CommandArgumentTypeOf<uint16_t>::value.
+ */
+template <typename T>
+struct CommandArgumentTypeOf;
+
+template <CommandArgumentType kType>
+using CommandArgumentTypeConstant = std::integral_constant<CommandArgumentType, kType>;
+
+// clang-format off
+template <> struct CommandArgumentTypeOf<uint8_t> : CommandArgumentTypeConstant<CommandArgumentType::kUnsigned8> {};
+template <> struct CommandArgumentTypeOf<uint16_t> : CommandArgumentTypeConstant<CommandArgumentType::kUnsigned16> {};
+template <> struct CommandArgumentTypeOf<uint32_t> : CommandArgumentTypeConstant<CommandArgumentType::kUnsigned32> {};
+template <> struct CommandArgumentTypeOf<uint64_t> : CommandArgumentTypeConstant<CommandArgumentType::kUnsigned64> {};
+template <> struct CommandArgumentTypeOf<int8_t> : CommandArgumentTypeConstant<CommandArgumentType::kSigned8> {};
+template <> struct CommandArgumentTypeOf<int16_t> : CommandArgumentTypeConstant<CommandArgumentType::kSigned16> {};
+template <> struct CommandArgumentTypeOf<int32_t> : CommandArgumentTypeConstant<CommandArgumentType::kSigned32> {};
+template <> struct CommandArgumentTypeOf<int64_t> : CommandArgumentTypeConstant<CommandArgumentType::kSigned64> {};
+template <> struct CommandArgumentTypeOf<bool> : CommandArgumentTypeConstant<CommandArgumentType::kBoolean> {};
+template <> struct CommandArgumentTypeOf<ByteSpan> : CommandArgumentTypeConstant<CommandArgumentType::kOctetString> {};
+template <> struct CommandArgumentTypeOf<uint8_t *> : CommandArgumentTypeConstant<CommandArgumentType::kDataPtr> {};
+template <> struct CommandArgumentTypeOf<const uint8_t *> : CommandArgumentTypeConstant<CommandArgumentType::kDataPtr> {};
+// clang-format on
+
+/**
+ * A decoded argument, read by the callback invoker with the type its CommandArgumentType was taken from.
+ */
+class CommandArgument
+{
+public:
+    template <typename T, typename std::enable_if<std::is_same<T, bool>::value, int>::type = 0>
+    T Get() const
+    {
+        return mBoolean;
+    }
+
+    template <typename T,
+              typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value,
+                                      int>::type = 0>
+    T Get() const
+    {
+        return static_cast<T>(mUnsigned);
+    }
+
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+    T Get() const
+    {
+        return static_cast<T>(mSigned);
+    }
+
+    template <typename T, typename std::enable_if<std::is_same<T, ByteSpan>::value, int>::type = 0>
+    T Get() const
+    {
+        return ByteSpan(mData, mLength);
+    }
+
+    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+    template <typename T, typename std::enable_if<std::is_pointer<T>::value, int>::type = 0>
+    T Get() const
+    {
+        return const_cast<T>(mData);
+    }
+
+    /**
+     * Read the argument from the element the reader is positioned on.
+     */
+    CHIP_ERROR Decode(CommandArgumentType aType, TLV::TLVReader & aReader);
+
+private:
+    union
+    {
+        uint64_t mUnsigned;
+        int64_t mSigned;
+        bool mBoolean;
+        const uint8_t * mData;
+    };
+    uint32_t mLength;
+};
+
+/**
+ * A command, with the argument of context tag i being of type mArgumentTypes[i].
+ */
+struct CommandDescriptor
+{
+    ClusterId mClusterId;
+    CommandId mCommandId;
+    const CommandArgumentType * mArgumentTypes;
+    size_t mArgumentCount;
+    void (*mInvoke)(Command * apCommandObj, const CommandArgument * apArguments);
+};
+
+/**
+ * @return The command of the given ids in descriptors sorted by cluster and command id, or nullptr if there is none.
+ */
+const CommandDescriptor * FindCommandDescriptor(const CommandDescriptor * apDescriptors, size_t aCount, ClusterId aClusterId,
+                                                CommandId aCommandId);
+
+/**
+ * The commands of an array of descriptors terminated by an empty descriptor, sorted by cluster and command id when the
+ * table is built, so that the table can be built at compile time from descriptors in any order.
+ */
+template <size_t N>
+class CommandDispatchTable
+{
+public:
+    static_assert(N > 0, "The descriptors must be terminated by an empty descriptor");
+
+    constexpr CommandDispatchTable(const CommandDescriptor (&aDescriptors)[N]) : mDescriptors{}
+    {
+        for (size_t i = 0; i < kCount; i++)
+        {
+            size_t j = i;
+            for (; j > 0 && IsOrderedBefore(aDescriptors[i], mDescriptors[j - 1]); j--)
+            {
+                mDescriptors[j] = mDescriptors[j - 1];
+            }
+            mDescriptors[j] = aDescriptors[i];
+        }
+    }
+
+    /**
+     * @return Whether no command is listed twice, and no command has more than kMaxCommandArguments arguments.
+     */
+    constexpr bool IsValid() const
+    {
+        for (size_t i = 0; i < kCount; i++)
+        {
+            if (mDescriptors[i].mArgumentCount > kMaxCommandArguments ||
+                (i > 0 && !IsOrderedBefore(mDescriptors[i - 1], mDescriptors[i])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const CommandDescriptor * Find(ClusterId aClusterId, CommandId aCommandId) const
+    {
+        return FindCommandDescriptor(mDescriptors, kCount, aClusterId, aCommandId);
+    }
+
+private:
+    static constexpr size_t kCount = N - 1;
+
+    static constexpr bool IsOrderedBefore(const CommandDescriptor & a, const CommandDescriptor & b)
+    {
+        return a.mClusterId < b.mClusterId || (a.mClusterId == b.mClusterId && a.mCommandId < b.mCommandId);
+    }
+
+    CommandDescriptor mDescriptors[N];
+};
+
+template <size_t N>
+constexpr CommandDispatchTable<N> MakeCommandDispatchTable(const CommandDescriptor (&aDescriptors)[N])
+{
+    return CommandDispatchTable<N>(aDescriptors);
+}
+
+/**
+ * Decode the arguments of a command from the elements of the command data, which the reader has entered.
+ *
+ * @param[out] apArguments The arguments, of at least aDescriptor.mArgumentCount elements.
+ *
+ * @retval #CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT If an argument is missing or given twice.
+ */
+CHIP_ERROR DecodeCommandArguments(const CommandDescriptor & aDescriptor, TLV::TLVReader & aReader, CommandArgument * apArguments);
+
+/**
+ * Decode the arguments of the command and give them to its callback, or add an error status to the response if the
+ * command is unknown or its arguments cannot be decoded.
+ *
+ * @param[in] apDescriptor The command, or nullptr if it is unknown.
+ * @param[in] aReader      The reader, having entered the command data.
+ */
+void DispatchClusterCommand(const CommandDescriptor * apDescriptor, ClusterId aClusterId, CommandId aCommandId,
+                            TLV::TLVReader & aReader, Command * apCommandObj);
+
+template <size_t N>
+void DispatchClusterCommand(const CommandDispatchTable<N> & aTable, ClusterId aClusterId, CommandId aCommandId,
+                            TLV::TLVReader & aReader, Command * apCommandObj)
+{
+    DispatchClusterCommand(aTable.Find(aClusterId, aCommandId), aClusterId, aCommandId, aReader, apCommandObj);
+}
+
+} // namespace app
+} // namespace chip
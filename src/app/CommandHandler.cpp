@@ -27,7 +27,9 @@
 #include "CommandSender.h"
 #include "InteractionModelEngine.h"
 
+#include <app/AttributeObserverRegistry.h>
 #include <protocols/secure_channel/Constants.h>
+#include <system/SystemTrace.h>
 
 using GeneralStatusCode = chip::Protocols::SecureChannel::GeneralStatusCode;
 
@@ -43,10 +45,22 @@ void CommandHandler::OnMessageReceived(Messaging::ExchangeContext * ec, const Pa
     // Exchange Manager for unsolicited InvokeCommand Requests.
 
     mpExchangeCtx = ec;
+    mGroupRequest = false;
 
-    err = ProcessCommandMessage(std::move(payload), CommandRoleId::HandlerId);
+    {
+        // Observers of the attributes written by the commands are told once the whole request is processed.
+        AttributeObserverRegistry::ScopedBatch batch;
+        err = ProcessCommandMessage(std::move(payload), CommandRoleId::HandlerId);
+    }
     SuccessOrExit(err);
 
+    if (mGroupRequest)
+    {
+        // The commands to a group were multicast to all its members, which do not answer them.
+        Shutdown();
+        ExitNow();
+    }
+
     SendCommandResponse();
 
 exit:
@@ -81,40 +95,65 @@ CHIP_ERROR CommandHandler::ProcessCommandDataElement(CommandDataElement::Parser
     chip::ClusterId clusterId;
     chip::CommandId commandId;
     chip::EndpointId endpointId;
+    chip::GroupId groupId;
+    uint32_t presenceMask       = 0;
+    const uint32_t requiredMask = (1u << CommandPath::kCsTag_ClusterId) | (1u << CommandPath::kCsTag_CommandId);
+    CommandPathParams commandPathParams(0, 0, 0, 0, CommandPathFlags::kEndpointIdValid);
+    uint16_t endpointIndex = 0;
 
     err = aCommandElement.GetCommandPath(&commandPath);
     SuccessOrExit(err);
-    err = commandPath.GetClusterId(&clusterId);
-    SuccessOrExit(err);
-    err = commandPath.GetCommandId(&commandId);
-    SuccessOrExit(err);
-    err = commandPath.GetEndpointId(&endpointId);
+    err = commandPath.DecodeCommandPath(&endpointId, &groupId, &clusterId, &commandId, &presenceMask);
     SuccessOrExit(err);
+    VerifyOrExit((presenceMask & requiredMask) == requiredMask, err = CHIP_END_OF_TLV);
+
+    if ((presenceMask & (1u << CommandPath::kCsTag_EndpointId)) == 0)
+    {
+        // A command addressed to a group goes to every endpoint of the group, each with a reader of its own.
+        VerifyOrExit((presenceMask & (1u << CommandPath::kCsTag_GroupId)) != 0, err = CHIP_END_OF_TLV);
+        commandPathParams = CommandPathParams(0, groupId, clusterId, commandId, CommandPathFlags::kGroupIdValid);
+        mpCommandPath     = &commandPathParams;
+        mGroupRequest     = true;
+
+        err = aCommandElement.GetData(&commandDataReader);
+        SuccessOrExit(err);
+        for (; NextGroupEndpoint(groupId, endpointIndex, endpointId); endpointIndex++)
+        {
+            TLV::TLVReader reader = commandDataReader;
+            SYSTEM_TRACE_SCOPE(ClusterCommand);
+            DispatchSingleClusterCommand(clusterId, commandId, endpointId, reader, this);
+        }
+        ExitNow();
+    }
+
+    commandPathParams = CommandPathParams(endpointId, 0, clusterId, commandId, CommandPathFlags::kEndpointIdValid);
+    mpCommandPath     = &commandPathParams;
 
     err = aCommandElement.GetData(&commandDataReader);
     if (CHIP_END_OF_TLV == err)
     {
         err = CHIP_NO_ERROR;
         ChipLogDetail(DataManagement, "Add Status code for empty command, cluster Id is %d", clusterId);
-        // The Path is not present when the CommandDataElement is used with an empty response, ResponseCommandElement would only
-        // have status code,
+        // The status gets the path of the command, for the sender to match it with the command of its request.
         AddStatusCode(nullptr, GeneralStatusCode::kSuccess, Protocols::SecureChannel::Id,
                       Protocols::SecureChannel::kProtocolCodeSuccess);
     }
     else if (CHIP_NO_ERROR == err)
     {
+        SYSTEM_TRACE_SCOPE(ClusterCommand);
         DispatchSingleClusterCommand(clusterId, commandId, endpointId, commandDataReader, this);
     }
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        // The Path is not present when there is an error to be conveyed back. ResponseCommandElement would only have status code,
-        // set the error with CHIP_NO_ERROR, then continue to process rest of commands
+        // The path is only present if the one of the command could be decoded. Set the error with CHIP_NO_ERROR, then
+        // continue to process rest of commands
         AddStatusCode(nullptr, GeneralStatusCode::kInvalidArgument, Protocols::SecureChannel::Id,
                       Protocols::SecureChannel::kProtocolCodeGeneralFailure);
         err = CHIP_NO_ERROR;
     }
+    mpCommandPath = nullptr;
     return err;
 }
 
@@ -123,16 +162,34 @@ CHIP_ERROR CommandHandler::AddStatusCode(const CommandPathParams * apCommandPath
                                          const Protocols::Id aProtocolId, const uint16_t aProtocolCode)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    StatusElement::Builder statusElementBuilder;
+    CommandDataElement::Builder commandDataElementBuilder;
+
+    if (apCommandPathParams == nullptr)
+    {
+        apCommandPathParams = mpCommandPath;
+    }
+
+    if (apCommandPathParams != nullptr && apCommandPathParams->mFlags.Has(CommandPathFlags::kEndpointIdValid) &&
+        !apCommandPathParams->mFlags.Has(CommandPathFlags::kGroupIdValid))
+    {
+        // Each command of a batch is answered by its own element: the status to a command of an endpoint, the common
+        // case, goes to the response in one write instead of through the builders of the element.
+        CommandList::Builder & commandListBuilder = mInvokeCommandBuilder.GetCommandListBuilder();
+        commandListBuilder.EncodeStatusResponse(apCommandPathParams->mEndpointId, apCommandPathParams->mClusterId,
+                                                apCommandPathParams->mCommandId, aGeneralCode,
+                                                aProtocolId.ToFullyQualifiedSpecForm(), aProtocolCode);
+        err = commandListBuilder.GetError();
+        SuccessOrExit(err);
+        MoveToState(CommandState::AddCommand);
+        ExitNow();
+    }
 
     err = PrepareCommand(apCommandPathParams, true /* isStatus */);
     SuccessOrExit(err);
 
-    statusElementBuilder =
-        mInvokeCommandBuilder.GetCommandListBuilder().GetCommandDataElementBuilder().CreateStatusElementBuilder();
-    statusElementBuilder.EncodeStatusElement(aGeneralCode, aProtocolId.ToFullyQualifiedSpecForm(), aProtocolCode)
-        .EndOfStatusElement();
-    err = statusElementBuilder.GetError();
+    commandDataElementBuilder = mInvokeCommandBuilder.GetCommandListBuilder().GetCommandDataElementBuilder();
+    commandDataElementBuilder.EncodeStatusElement(aGeneralCode, aProtocolId.ToFullyQualifiedSpecForm(), aProtocolCode);
+    err = commandDataElementBuilder.GetError();
     SuccessOrExit(err);
 
     err = FinishCommand(true /* isStatus */);
@@ -44,6 +44,10 @@ class CommandHandler : public Command
 public:
     void OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                            System::PacketBufferHandle payload);
+    /**
+     * Adds a status response. While a command is processed, a status without a path gets the path of that command, so that
+     * the sender can tell which of the commands of its request it answers.
+     */
     CHIP_ERROR AddStatusCode(const CommandPathParams * apCommandPathParams,
                              const Protocols::SecureChannel::GeneralStatusCode aGeneralCode, const Protocols::Id aProtocolId,
                              const uint16_t aProtocolCode) override;
@@ -52,6 +56,9 @@ private:
     friend class TestCommandInteraction;
     CHIP_ERROR SendCommandResponse();
     CHIP_ERROR ProcessCommandDataElement(CommandDataElement::Parser & aCommandElement) override;
+
+    const CommandPathParams * mpCommandPath = nullptr; // Of the command being processed.
+    bool mGroupRequest                      = false;   // Whether the request has commands to a group, not to be answered.
 };
 } // namespace app
 } // namespace chip
@@ -65,6 +65,31 @@ exit:
     return err;
 }
 
+CHIP_ERROR CommandSender::SendGroupCommandRequest(SecureSessionHandle aGroupSession)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    err = FinalizeCommandsMessage();
+    SuccessOrExit(err);
+
+    ClearExistingExchangeContext();
+
+    mpExchangeCtx = mpExchangeMgr->NewContext(aGroupSession, this);
+    VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_NO_MEMORY);
+
+    // A multicast message is neither acknowledged nor answered.
+    err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandRequest, std::move(mCommandMessageBuf),
+                                     Messaging::SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    SuccessOrExit(err);
+
+exit:
+    ChipLogFunctError(err);
+
+    // Nothing comes back on the exchange, which Reset closes.
+    Reset();
+    return err;
+}
+
 void CommandSender::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
                                       const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
 {
@@ -123,22 +148,22 @@ CHIP_ERROR CommandSender::ProcessCommandDataElement(CommandDataElement::Parser &
     chip::ClusterId clusterId;
     chip::CommandId commandId;
     chip::EndpointId endpointId;
+    chip::GroupId groupId;
     Protocols::SecureChannel::GeneralStatusCode generalCode = Protocols::SecureChannel::GeneralStatusCode::kSuccess;
     uint32_t protocolId                                     = 0;
     uint16_t protocolCode                                   = 0;
+    uint32_t presenceMask                                   = 0;
     StatusElement::Parser statusElementParser;
+    const uint32_t requiredMask = (1u << CommandPath::kCsTag_EndpointId) | (1u << CommandPath::kCsTag_ClusterId) |
+        (1u << CommandPath::kCsTag_CommandId);
 
     mCommandIndex++;
     err = aCommandElement.GetCommandPath(&commandPath);
     SuccessOrExit(err);
 
-    err = commandPath.GetClusterId(&clusterId);
-    SuccessOrExit(err);
-    err = commandPath.GetCommandId(&commandId);
-    SuccessOrExit(err);
-
-    err = commandPath.GetEndpointId(&endpointId);
+    err = commandPath.DecodeCommandPath(&endpointId, &groupId, &clusterId, &commandId, &presenceMask);
     SuccessOrExit(err);
+    VerifyOrExit((presenceMask & requiredMask) == requiredMask, err = CHIP_END_OF_TLV);
 
     err = aCommandElement.GetStatusElement(&statusElementParser);
     if (CHIP_NO_ERROR == err)
@@ -165,7 +190,8 @@ exit:
     {
         mpDelegate->CommandResponseProtocolError(this, mCommandIndex);
     }
-    return err;
+    // A response that cannot be processed does not prevent the ones to the other commands of the request from being processed.
+    return CHIP_NO_ERROR;
 }
 
 } // namespace app
@@ -47,6 +47,15 @@ class CommandSender : public Command, public Messaging::ExchangeDelegate
 public:
     CHIP_ERROR SendCommandRequest(NodeId aNodeId, Transport::AdminId aAdminId);
 
+    /**
+     * Send the commands to every member of a group at once, in a single message multicast on the session of the group. The
+     * commands must address the group, not an endpoint. The members do not answer them, so the delegate gets no calls, and
+     * the CommandSender can take new commands as soon as this returns.
+     *
+     * @param[in] aGroupSession  The session of the group, established by SecureSessionMgr::NewGroupSession
+     */
+    CHIP_ERROR SendGroupCommandRequest(SecureSessionHandle aGroupSession);
+
     void OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
                            const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload) override;
     void OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext) override;
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <app/EventPathParams.h>
 #include <app/util/basic-types.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLV.h>
@@ -172,6 +173,13 @@ struct EventLoadOutContext
     EventNumber mCurrentEventNumber = 0;
     Timestamp mCurrentUTCTime;
     bool mFirst = true;
+    /* The events copied are those on one of these paths, all of them if there are none */
+    const EventPathParams * mpInterestedEventPaths = nullptr;
+    size_t mInterestedEventPathCount              = 0;
+    /* Room the copied events leave free in mWriter */
+    uint32_t mReservedSize = 0;
+    /* Whether an event was passed over since the last one copied, which the next one copied then gives its number to */
+    bool mEventSkipped = false;
 };
 } // namespace app
 } // namespace chip
@@ -24,7 +24,9 @@
 #include <inttypes.h>
 #include <support/CodeUtils.h>
 #include <support/ErrorStr.h>
+#include <support/SafeInt.h>
 #include <support/logging/CHIPLogging.h>
+#include <system/SystemStats.h>
 #include <system/SystemTimer.h>
 
 using namespace chip::TLV;
@@ -92,6 +94,11 @@ struct EventEnvelopeContext
     Timestamp mDeltaSystemTime = Timestamp::System(0);
     Timestamp mDeltaUtc        = Timestamp::UTC(0);
     PriorityLevel mPriority    = PriorityLevel::First;
+    /* The path of the event is only read when the events are filtered by path */
+    bool mFetchPath        = false;
+    EndpointId mEndpointId = 0;
+    ClusterId mClusterId   = 0;
+    EventId mEventId       = 0;
 };
 
 EventManagement::EventManagement(Messaging::ExchangeManager * apExchangeMgr, int aNumBuffers,
@@ -125,11 +132,53 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, int a
         current->mProcessEvictedElement = AlwaysFail;
         current->mAppData               = nullptr;
         current->InitCounter(apLogStorageResources[bufferIndex].InitializeCounter());
+        current->SetPersistentLog(apLogStorageResources[bufferIndex].mpPersistentLog);
     }
 
     mpEventBuffer = apCircularEventBuffer;
     mState        = EventManagementStates::Idle;
     mBytesWritten = 0;
+    mIsPooled     = false;
+}
+
+void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, int aNumBuffers,
+                           CircularEventBuffer * apCircularEventBuffer, const LogStorageResources * const apLogStorageResources,
+                           uint8_t * apPool, uint32_t aPoolSize)
+{
+    uint32_t keptSize = 0;
+    uint8_t * end     = nullptr;
+
+    VerifyOrDie(apPool != nullptr && aNumBuffers > 0);
+
+    for (int bufferIndex = 0; bufferIndex < aNumBuffers; bufferIndex++)
+    {
+        VerifyOrDie(apLogStorageResources[bufferIndex].mBufferSize > 0);
+        keptSize += apLogStorageResources[bufferIndex].mBufferSize;
+    }
+    VerifyOrDie(keptSize <= aPoolSize);
+
+    Init(apExchangeManager, aNumBuffers, apCircularEventBuffer, apLogStorageResources);
+
+    // The buffers are laid out from the end of the pool, so that each buffer ends where the buffer of lesser priority starts:
+    // an event moving to the next buffer then lies against their bound once the events of the next buffer end there.
+    end = apPool + aPoolSize;
+    for (int bufferIndex = 0; bufferIndex < aNumBuffers; bufferIndex++)
+    {
+        const LogStorageResources & resources = apLogStorageResources[bufferIndex];
+        CircularEventBuffer & buffer          = apCircularEventBuffer[bufferIndex];
+        uint32_t size                         = resources.mBufferSize;
+
+        if (bufferIndex == aNumBuffers - 1)
+        {
+            size += aPoolSize - keptSize;
+        }
+        end -= size;
+        VerifyOrDie(buffer.MoveBounds(end, size, end, 0) == CHIP_NO_ERROR);
+        buffer.SetQuotas((resources.mMinBufferSize != 0) ? resources.mMinBufferSize : resources.mBufferSize,
+                         resources.mMaxBufferSize);
+    }
+
+    mIsPooled = true;
 }
 
 CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
@@ -143,6 +192,10 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     CircularEventBuffer backup = *nextBuffer;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    EventIndexEntry indexEntry;
+    uint32_t nextTailOffset = nextBuffer->GetTailOffset();
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -161,6 +214,17 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    nextBuffer->IndexTailElement(writer.GetLengthWritten());
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    // The event keeps its index entry in the next buffer.
+    if (apEventBuffer->TakeHeadIndexEntry(indexEntry))
+    {
+        indexEntry.mOffset = nextTailOffset;
+        nextBuffer->AddIndexEntry(indexEntry);
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
     ChipLogProgress(EventLogging, "Copy Event to next buffer with priority %d", nextBuffer->GetPriorityLevel());
 exit:
     if (err != CHIP_NO_ERROR)
@@ -173,8 +237,9 @@ exit:
 CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
 {
     CHIP_ERROR err                    = CHIP_NO_ERROR;
-    size_t requiredSpace              = aRequiredSpace;
-    CircularEventBuffer * eventBuffer = mpEventBuffer;
+    size_t requiredSpace                 = aRequiredSpace;
+    CircularEventBuffer * eventBuffer    = mpEventBuffer;
+    CircularEventBuffer * relinkedBuffer = nullptr;
     ReclaimEventCtx ctx;
 
     // check whether we actually need to do anything, exit if we don't
@@ -182,11 +247,19 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
 
     while (true)
     {
-        // check that the request can ultimately be satisfied.
-        VerifyOrExit(requiredSpace <= eventBuffer->GetTotalDataLength(), err = CHIP_ERROR_BUFFER_TOO_SMALL);
-
         if (requiredSpace > eventBuffer->AvailableDataLength())
         {
+            // a buffer sharing a pool first grows into the free space of the buffers of more important events, which are not
+            // making space for it, unless it just handed events over to the next buffer, whose space it would take back
+            if (mIsPooled && eventBuffer != relinkedBuffer &&
+                GrowFromPool(eventBuffer, static_cast<uint32_t>(requiredSpace - eventBuffer->AvailableDataLength())))
+            {
+                continue;
+            }
+
+            // check that the request can ultimately be satisfied.
+            VerifyOrExit(requiredSpace <= eventBuffer->GetTotalDataLength(), err = CHIP_ERROR_BUFFER_TOO_SMALL);
+
             ctx.mpEventBuffer             = eventBuffer;
             ctx.mSpaceNeededForMovedEvent = 0;
 
@@ -202,6 +275,13 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
             {
                 VerifyOrExit(ctx.mSpaceNeededForMovedEvent != 0, /* no-op, return err */);
                 VerifyOrExit(eventBuffer->GetNextCircularEventBuffer() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+                if (mIsPooled && CanCastTo<uint32_t>(ctx.mSpaceNeededForMovedEvent) &&
+                    RelinkHeadEvent(eventBuffer, static_cast<uint32_t>(ctx.mSpaceNeededForMovedEvent)))
+                {
+                    relinkedBuffer = eventBuffer;
+                    err            = CHIP_NO_ERROR;
+                    continue;
+                }
                 if (ctx.mSpaceNeededForMovedEvent <= eventBuffer->GetNextCircularEventBuffer()->AvailableDataLength())
                 {
                     // we can copy the event outright.  copy event and
@@ -259,6 +339,100 @@ exit:
     return err;
 }
 
+bool EventManagement::GrowFromPool(CircularEventBuffer * apEventBuffer, uint32_t aNeededSpace)
+{
+    constexpr uint32_t kSegmentSize = CHIP_CONFIG_EVENT_LOGGING_POOL_SEGMENT_SIZE;
+    uint32_t wanted                 = ((aNeededSpace + kSegmentSize - 1) / kSegmentSize) * kSegmentSize;
+    uint32_t taken                  = 0;
+
+    if (wanted > apEventBuffer->GetGrowableLength())
+    {
+        wanted = apEventBuffer->GetGrowableLength();
+    }
+
+    for (CircularEventBuffer * donor = apEventBuffer->GetNextCircularEventBuffer(); donor != nullptr && taken < wanted;
+         donor                       = donor->GetNextCircularEventBuffer())
+    {
+        uint32_t length = donor->GetSpareLength();
+        if (length > wanted - taken)
+        {
+            length = wanted - taken;
+        }
+        if (length == 0)
+        {
+            continue;
+        }
+
+        // the space reaches the buffer through the buffers in between, each taking it at its front and giving it at its end
+        for (CircularEventBuffer * buffer = donor; buffer != apEventBuffer; buffer = buffer->GetPreviousCircularEventBuffer())
+        {
+            VerifyOrDie(PassSpace(*buffer, *buffer->GetPreviousCircularEventBuffer(), length) == CHIP_NO_ERROR);
+        }
+        taken += length;
+    }
+
+    return taken > 0;
+}
+
+bool EventManagement::RelinkHeadEvent(CircularEventBuffer * apEventBuffer, uint32_t aEventLength)
+{
+    CircularEventBuffer * nextBuffer = apEventBuffer->GetNextCircularEventBuffer();
+    uint8_t * bound                  = apEventBuffer->GetQueue();
+    const uint32_t length            = apEventBuffer->GetTotalDataLength();
+    const uint32_t headOffset        = static_cast<uint32_t>(apEventBuffer->QueueHead() - bound) % length;
+    const uint32_t nextLength        = nextBuffer->GetTotalDataLength();
+    uint8_t * nextHead               = (nextBuffer->DataLength() == 0) ? bound : nextBuffer->QueueHead();
+    CHIP_ERROR err;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    EventIndexEntry indexEntry;
+    bool indexed;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    VerifyOrReturnError(nextBuffer->GetQueue() + nextLength == bound, false);
+    VerifyOrReturnError(headOffset == 0 && aEventLength <= apEventBuffer->DataLength(), false);
+    VerifyOrReturnError(nextHead + nextBuffer->DataLength() == bound, false);
+    VerifyOrReturnError(length >= apEventBuffer->GetMinLength() + aEventLength && length > aEventLength, false);
+    VerifyOrReturnError(nextBuffer->GetGrowableLength() >= aEventLength, false);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    // The event keeps its index entry in the next buffer.
+    indexed            = apEventBuffer->TakeHeadIndexEntry(indexEntry);
+    indexEntry.mOffset = nextLength;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    // the event becomes the tail of the next buffer where it lies
+    err = nextBuffer->MoveBounds(nextBuffer->GetQueue(), nextLength + aEventLength, nextHead,
+                                 nextBuffer->DataLength() + aEventLength);
+    VerifyOrDie(err == CHIP_NO_ERROR);
+    err = apEventBuffer->MoveBounds(bound + aEventLength, length - aEventLength, bound + aEventLength,
+                                    apEventBuffer->DataLength() - aEventLength);
+    VerifyOrDie(err == CHIP_NO_ERROR);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    if (indexed)
+    {
+        nextBuffer->AddIndexEntry(indexEntry);
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    ChipLogProgress(EventLogging, "Move Event to next buffer with priority %d", nextBuffer->GetPriorityLevel());
+    return true;
+}
+
+CHIP_ERROR EventManagement::PassSpace(CircularEventBuffer & aFrom, CircularEventBuffer & aTo, uint32_t aLength)
+{
+    const uint32_t fromLength = aFrom.GetTotalDataLength() - aLength;
+
+    VerifyOrReturnError(aLength <= aFrom.AvailableDataLength() && fromLength > 0, CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError(aFrom.GetQueue() + aFrom.GetTotalDataLength() == aTo.GetQueue(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(aFrom.KeepEventsBefore(fromLength));
+    ReturnErrorOnFailure(aFrom.MoveBounds(aFrom.GetQueue(), fromLength, aFrom.QueueHead(), aFrom.DataLength()));
+
+    ReturnErrorOnFailure(aTo.KeepEventsBefore(aTo.GetTotalDataLength()));
+    return aTo.MoveBounds(aTo.GetQueue() - aLength, aTo.GetTotalDataLength() + aLength, aTo.QueueHead(), aTo.DataLength());
+}
+
 CHIP_ERROR EventManagement::CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions,
                                                uint32_t & requiredSize)
 {
@@ -366,12 +540,28 @@ void EventManagement::CreateEventManagement(Messaging::ExchangeManager * apExcha
     static_assert(std::is_trivially_destructible<EventManagement>::value, "EventManagement must be trivially destructible");
 }
 
+void EventManagement::CreateEventManagement(Messaging::ExchangeManager * apExchangeManager, int aNumBuffers,
+                                            CircularEventBuffer * apCircularEventBuffer,
+                                            const LogStorageResources * const apLogStorageResources, uint8_t * apPool,
+                                            uint32_t aPoolSize)
+{
+    sInstance.Init(apExchangeManager, aNumBuffers, apCircularEventBuffer, apLogStorageResources, apPool, aPoolSize);
+}
+
 /**
  * @brief Perform any actions we need to on shutdown.
  */
 void EventManagement::DestroyEventManagement()
 {
     CriticalSectionEnter();
+    // The events staged by the persistent logs would be lost otherwise.
+    for (CircularEventBuffer * buffer = sInstance.mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        if (buffer->GetPersistentLog() != nullptr)
+        {
+            buffer->GetPersistentLog()->Flush();
+        }
+    }
     sInstance.mState        = EventManagementStates::Shutdown;
     sInstance.mpEventBuffer = nullptr;
     sInstance.mpExchangeMgr = nullptr;
@@ -433,7 +623,9 @@ CHIP_ERROR EventManagement::CopyAndAdjustDeltaTime(const TLVReader & aReader, si
         }
         else
         {
-            err = ctx->mpWriter->CopyElement(reader);
+            // The delta runs from the last event copied, over the events passed over since.
+            err = ctx->mpWriter->Put(TLV::ContextTag(EventDataElement::kCsTag_DeltaSystemTimestamp),
+                                     ctx->mpContext->mCurrentSystemTime.mValue);
         }
     }
     else
@@ -442,10 +634,12 @@ CHIP_ERROR EventManagement::CopyAndAdjustDeltaTime(const TLVReader & aReader, si
     }
 
     // First event in the sequence gets a event number neatly packaged
-    // right after the priority to keep tags ordered
+    // right after the priority to keep tags ordered, as does an event
+    // following events left out, whose number cannot be counted from
+    // the previous one.
     if (aReader.GetTag() == TLV::ContextTag(EventDataElement::kCsTag_PriorityLevel))
     {
-        if (ctx->mpContext->mFirst)
+        if (ctx->mpContext->mFirst || ctx->mpContext->mEventSkipped)
         {
             err = ctx->mpWriter->Put(TLV::ContextTag(EventDataElement::kCsTag_Number), ctx->mpContext->mCurrentEventNumber);
         }
@@ -481,11 +675,11 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, E
     CircularEventBuffer * buffer   = nullptr;
     EventLoadOutContext ctxt       = EventLoadOutContext(writer, aEventOptions.mpEventSchema->mPriority,
                                                    GetPriorityBuffer(aEventOptions.mpEventSchema->mPriority)->GetLastEventNumber());
-    Timestamp timestamp(Timestamp::Type::kSystem, System::Timer::GetCurrentEpoch());
+    Timestamp timestamp(Timestamp::Type::kSystem, System::Layer::GetClock_MonotonicLoopMS());
     EventOptions opts = EventOptions(timestamp);
-    // Start the event container (anonymous structure) in the circular buffer
-    writer.Init(*mpEventBuffer);
-
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    EventIndexEntry indexEntry;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
     // check whether the entry is to be logged or discarded silently
     VerifyOrExit(aEventOptions.mpEventSchema->mPriority >= CHIP_CONFIG_EVENT_GLOBAL_PRIORITY, /* no-op */);
 
@@ -512,8 +706,19 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, E
 
     // Ensure we have space in the in-memory logging queues
     err = EnsureSpaceInCircularBuffer(requestSize);
+    // only the event written from here is rolled back, as the buffers sharing a pool may have been rearranged
+    checkpoint = *mpEventBuffer;
     SuccessOrExit(err);
 
+    // Start the event container (anonymous structure) in the circular buffer
+    writer.Init(*mpEventBuffer);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    indexEntry.mPriorSystemTimestamp = ctxt.mCurrentSystemTime.mValue;
+    indexEntry.mOffset               = mpEventBuffer->GetTailOffset();
+    indexEntry.mPriority             = opts.mpEventSchema->mPriority;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
@@ -548,6 +753,21 @@ exit:
         CircularEventBuffer * currentBuffer = GetPriorityBuffer(opts.mpEventSchema->mPriority);
         aEventNumber                        = currentBuffer->VendEventNumber();
         currentBuffer->UpdateFirstLastEventTime(opts.mTimestamp);
+        mpEventBuffer->IndexTailElement(writer.GetLengthWritten());
+        SYSTEM_STATS_COUNT(System::Stats::kEventManagement_NumEventsLogged);
+
+        if (currentBuffer->GetPersistentLog() != nullptr)
+        {
+            PersistEvent(*currentBuffer->GetPersistentLog(), apDelegate, opts, aEventNumber);
+        }
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+        if (aEventNumber % CHIP_CONFIG_EVENT_LOGGING_INDEX_INTERVAL == 0)
+        {
+            indexEntry.mEventNumber = aEventNumber;
+            mpEventBuffer->AddIndexEntry(indexEntry);
+        }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
 
 #if CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
         ChipLogDetail(EventLogging,
@@ -562,6 +782,42 @@ exit:
     return err;
 }
 
+void EventManagement::PersistEvent(PersistentEventLog & aLog, EventLoggingDelegate * apDelegate, const EventOptions & aOptions,
+                                   EventNumber aEventNumber)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferTLVWriter writer;
+    EventLoadOutContext ctxt       = EventLoadOutContext(writer, aOptions.mpEventSchema->mPriority, aEventNumber);
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(kMaxEventSizeReserve);
+
+    VerifyOrExit(!buf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    writer.Init(std::move(buf));
+
+    // The event is saved with a delta timestamp of 0, the log keeping the timestamp of each event.
+    ctxt.mCurrentEventNumber = aEventNumber;
+    ctxt.mCurrentSystemTime  = aOptions.mTimestamp;
+    err                      = ConstructEvent(&ctxt, apDelegate, &aOptions);
+    SuccessOrExit(err);
+
+    err = writer.Finalize(&buf);
+    SuccessOrExit(err);
+
+    err = aLog.Append(aEventNumber, aOptions.mTimestamp.mValue, buf->Start(), buf->DataLength());
+    SuccessOrExit(err);
+
+    if (aOptions.mUrgent == EventOptions::Type::kUrgent)
+    {
+        err = aLog.Flush();
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Failed to save event 0x%" PRIx64 " of priority %d: %s", aEventNumber,
+                     static_cast<int>(aOptions.mpEventSchema->mPriority), ErrorStr(err));
+    }
+}
+
 CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWriter, EventLoadOutContext * apContext)
 {
     TLVReader reader;
@@ -605,7 +861,8 @@ CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDep
     err = innerReader.EnterContainer(tlvType);
     SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(innerReader, FetchEventParameters, &event, false /*recurse*/);
+    event.mFetchPath = apEventLoadOutContext->mInterestedEventPathCount > 0;
+    err              = TLV::Utilities::Iterate(innerReader, FetchEventParameters, &event, false /*recurse*/);
     VerifyOrExit(event.mFieldsToRead == kRequiredEventField, err = CHIP_NO_ERROR);
 
     if (err == CHIP_END_OF_TLV)
@@ -617,8 +874,13 @@ CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDep
     if (event.mPriority == apEventLoadOutContext->mPriority)
     {
         apEventLoadOutContext->mCurrentSystemTime.mValue += event.mDeltaSystemTime.mValue;
-        VerifyOrExit(apEventLoadOutContext->mCurrentEventNumber < apEventLoadOutContext->mStartingEventNumber,
+        VerifyOrExit(apEventLoadOutContext->mCurrentEventNumber < apEventLoadOutContext->mStartingEventNumber ||
+                         !IsEventOfInterest(event, apEventLoadOutContext),
                      err = CHIP_EVENT_ID_FOUND);
+        if (apEventLoadOutContext->mCurrentEventNumber >= apEventLoadOutContext->mStartingEventNumber)
+        {
+            apEventLoadOutContext->mEventSkipped = true;
+        }
         apEventLoadOutContext->mCurrentEventNumber++;
     }
 
@@ -643,10 +905,15 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
         // successful copy.  In all other cases, roll back the
         // writer state back to the checkpoint, i.e., the state
         // before we began the copy operation.
+        if (err == CHIP_NO_ERROR && loadOutContext->mWriter.GetRemainingFreeLength() < loadOutContext->mReservedSize)
+        {
+            err = CHIP_ERROR_BUFFER_TOO_SMALL;
+        }
         VerifyOrExit((err == CHIP_NO_ERROR) || (err == CHIP_END_OF_TLV), loadOutContext->mWriter = checkpoint);
 
         loadOutContext->mCurrentSystemTime.mValue = 0;
         loadOutContext->mFirst                    = false;
+        loadOutContext->mEventSkipped             = false;
         loadOutContext->mCurrentEventNumber++;
     }
 
@@ -654,7 +921,26 @@ exit:
     return err;
 }
 
+bool EventManagement::IsEventOfInterest(const EventEnvelopeContext & aEvent, const EventLoadOutContext * apContext)
+{
+    for (size_t i = 0; i < apContext->mInterestedEventPathCount; i++)
+    {
+        if (apContext->mpInterestedEventPaths[i].Covers(aEvent.mEndpointId, aEvent.mClusterId, aEvent.mEventId))
+        {
+            return true;
+        }
+    }
+    return apContext->mInterestedEventPathCount == 0;
+}
+
 CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, PriorityLevel aPriority, EventNumber & aEventNumber)
+{
+    return FetchEventsSince(aWriter, aPriority, aEventNumber, nullptr, 0, 0);
+}
+
+CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, PriorityLevel aPriority, EventNumber & aEventNumber,
+                                             const EventPathParams * apInterestedPaths, size_t aInterestedPathCount,
+                                             uint32_t aReservedSize)
 {
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
@@ -662,6 +948,10 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, PriorityLevel
     CircularEventBufferWrapper bufWrapper;
     EventLoadOutContext context(aWriter, aPriority, aEventNumber);
 
+    context.mpInterestedEventPaths    = apInterestedPaths;
+    context.mInterestedEventPathCount = aInterestedPathCount;
+    context.mReservedSize             = aReservedSize;
+
     CircularEventBuffer * buf = mpEventBuffer;
     CriticalSectionEnter();
 
@@ -675,6 +965,38 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, PriorityLevel
     err                               = GetEventReader(reader, aPriority, &bufWrapper);
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    {
+        // Events of aPriority are numbered in reading order, from the buffer of aPriority down the buffers of lesser
+        // priority, so the closest entry is the last one found along that chain.
+        const EventIndexEntry * indexEntry = nullptr;
+        CircularEventBuffer * indexBuffer  = nullptr;
+
+        for (CircularEventBuffer * current = buf; current != nullptr; current = current->GetPreviousCircularEventBuffer())
+        {
+            const EventIndexEntry * entry = current->FindIndexEntry(aPriority, aEventNumber);
+            if (entry != nullptr && entry->mEventNumber >= context.mCurrentEventNumber)
+            {
+                indexEntry  = entry;
+                indexBuffer = current;
+            }
+        }
+
+        if (indexEntry != nullptr)
+        {
+            CircularEventReader circularReader;
+
+            context.mCurrentSystemTime.mValue = indexEntry->mPriorSystemTimestamp;
+            context.mCurrentEventNumber       = indexEntry->mEventNumber;
+
+            bufWrapper.mpCurrent = indexBuffer;
+            bufWrapper.mpStart   = indexBuffer->GetQueue() + indexEntry->mOffset;
+            circularReader.Init(&bufWrapper);
+            reader.Init(circularReader);
+        }
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
     {
@@ -725,10 +1047,34 @@ CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size
         envelope->mFieldsToRead |= 1 << EventDataElement::kCsTag_DeltaSystemTimestamp;
     }
 
+    if (envelope->mFetchPath && reader.GetTag() == TLV::ContextTag(EventDataElement::kCsTag_EventPath))
+    {
+        EventPath::Parser path;
+
+        err = path.Init(reader);
+        SuccessOrExit(err);
+        err = path.GetEndpointId(&envelope->mEndpointId);
+        SuccessOrExit(err);
+        err = path.GetClusterId(&envelope->mClusterId);
+        SuccessOrExit(err);
+        err = path.GetEventId(&envelope->mEventId);
+        SuccessOrExit(err);
+    }
+
 exit:
     return err;
 }
 
+CHIP_ERROR EventManagement::FetchEvictionParameters(const TLVReader & aReader, size_t aDepth, void * apContext)
+{
+    EventEnvelopeContext * envelope = static_cast<EventEnvelopeContext *>(apContext);
+
+    ReturnErrorOnFailure(FetchEventParameters(aReader, aDepth, apContext));
+
+    // The event data that follows is not needed to evict the event.
+    return (envelope->mFieldsToRead == kRequiredEventField) ? CHIP_END_OF_TLV : CHIP_NO_ERROR;
+}
+
 CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void * apAppData, TLVReader & aReader)
 {
     ReclaimEventCtx * ctx             = static_cast<ReclaimEventCtx *>(apAppData);
@@ -738,6 +1084,7 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
     const bool recurse = false;
     CHIP_ERROR err;
     PriorityLevel imp = PriorityLevel::Invalid;
+    uint32_t eventLength;
 
     // pull out the delta time, pull out the priority
     err = aReader.Next();
@@ -746,16 +1093,20 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
     err = aReader.EnterContainer(containerType);
     SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(aReader, FetchEventParameters, &context, recurse);
+    err = TLV::Utilities::Iterate(aReader, FetchEvictionParameters, &context, recurse);
     if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
 
-    err = aReader.ExitContainer(containerType);
-
-    SuccessOrExit(err);
+    // the rest of the event is only parsed for its length when it is not indexed
+    if (!apBuffer.GetHeadElementLength(eventLength))
+    {
+        err = aReader.ExitContainer(containerType);
+        SuccessOrExit(err);
+        eventLength = aReader.GetLengthRead();
+    }
 
     imp = static_cast<PriorityLevel>(context.mPriority);
 
@@ -763,7 +1114,12 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
     {
         // event is getting dropped.  Increase the event number and first timestamp.
         EventNumber numEventsToDrop = 1;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+        EventIndexEntry indexEntry;
+        eventBuffer->TakeHeadIndexEntry(indexEntry);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
         eventBuffer->RemoveEvent(numEventsToDrop);
+        SYSTEM_STATS_COUNT(System::Stats::kEventManagement_NumEventsEvicted);
         eventBuffer->SetFirstEventSystemTimestamp(eventBuffer->GetFirstEventSystemTimestamp() + context.mDeltaSystemTime.mValue);
         ChipLogProgress(EventLogging,
                         "Dropped events from buffer with priority %d due to overflow: { event priority_level: %d, count: %d };",
@@ -773,7 +1129,7 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
     else
     {
         // event is not getting dropped. Note how much space it requires, and return.
-        ctx->mSpaceNeededForMovedEvent = aReader.GetLengthRead();
+        ctx->mSpaceNeededForMovedEvent = eventLength;
         err                            = CHIP_END_OF_TLV;
     }
 
@@ -783,8 +1139,12 @@ exit:
 
 CHIP_ERROR EventManagement::ScheduleFlushIfNeeded(EventOptions::Type aUrgent)
 {
-    // TODO: Implement ScheduleFlushIfNeeded
-    return CHIP_NO_ERROR;
+    VerifyOrReturnError(IsValid(), CHIP_ERROR_INCORRECT_STATE);
+
+    // The events are not pushed here: each subscription pulls the events past the last one it reported when its next report
+    // is built, so the events logged until then share that report.
+    return InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleEventDelivery(aUrgent ==
+                                                                                                 EventOptions::Type::kUrgent);
 }
 
 void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev,
@@ -799,6 +1159,67 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mFirstEventSystemTimestamp = Timestamp::System(0);
     mLastEventSystemTimestamp  = Timestamp::System(0);
     mpEventNumberCounter       = nullptr;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    mIndexStart = 0;
+    mIndexCount = 0;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+#if CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES > 0
+    SetElementIndex(mEventLengths, CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES);
+#endif // CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES > 0
+}
+
+CHIP_ERROR CircularEventBuffer::AlignEvents(uint32_t aHeadOffset)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    const uint32_t headOffset = GetHeadOffset();
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    ReturnErrorOnFailure(AlignHead(aHeadOffset));
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    // the indexed events keep their distance from the head
+    for (size_t i = 0; i < mIndexCount; i++)
+    {
+        EventIndexEntry & entry = mIndex[(mIndexStart + i) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES];
+        const uint32_t distance = (entry.mOffset + GetTotalDataLength() - headOffset) % GetTotalDataLength();
+        entry.mOffset           = (GetHeadOffset() + distance) % GetTotalDataLength();
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CircularEventBuffer::KeepEventsBefore(uint32_t aEndOffset)
+{
+    const uint32_t headOffset = static_cast<uint32_t>(QueueHead() - GetQueue()) % GetTotalDataLength();
+
+    if (headOffset + DataLength() <= aEndOffset)
+    {
+        // nothing moves, but the head is no longer left at the end of the storage
+        return AlignEvents(headOffset);
+    }
+    VerifyOrReturnError(DataLength() <= aEndOffset, CHIP_ERROR_BUFFER_TOO_SMALL);
+    return AlignEvents(0);
+}
+
+CHIP_ERROR CircularEventBuffer::MoveBounds(uint8_t * apBuffer, uint32_t aBufferLength, uint8_t * apHead, uint32_t aDataLength)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    uint8_t * queue = GetQueue();
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    ReturnErrorOnFailure(SetBounds(apBuffer, aBufferLength, apHead, aDataLength));
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    // the indexed events do not move
+    for (size_t i = 0; i < mIndexCount; i++)
+    {
+        EventIndexEntry & entry = mIndex[(mIndexStart + i) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES];
+        entry.mOffset           = static_cast<uint32_t>(queue + entry.mOffset - apBuffer);
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    return CHIP_NO_ERROR;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -821,6 +1242,52 @@ void CircularEventBuffer::RemoveEvent(EventNumber aNumEvents)
     mFirstEventNumber = mFirstEventNumber + aNumEvents;
 }
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+void CircularEventBuffer::AddIndexEntry(const EventIndexEntry & aEntry)
+{
+    if (mIndexCount == CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES)
+    {
+        // Events up to the next entry are found by scanning from the oldest event instead.
+        mIndexStart = (mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES;
+        mIndexCount--;
+    }
+
+    mIndex[(mIndexStart + mIndexCount) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES] = aEntry;
+    mIndexCount++;
+}
+
+bool CircularEventBuffer::TakeHeadIndexEntry(EventIndexEntry & aEntry)
+{
+    // Events leave the buffer from its head, and entries are kept in the order of their events.
+    if (mIndexCount == 0 || mIndex[mIndexStart].mOffset != GetHeadOffset())
+    {
+        return false;
+    }
+
+    aEntry      = mIndex[mIndexStart];
+    mIndexStart = (mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES;
+    mIndexCount--;
+    return true;
+}
+
+const EventIndexEntry * CircularEventBuffer::FindIndexEntry(PriorityLevel aPriority, EventNumber aEventNumber) const
+{
+    const EventIndexEntry * found = nullptr;
+
+    for (size_t i = 0; i < mIndexCount; i++)
+    {
+        const EventIndexEntry & entry = mIndex[(mIndexStart + i) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES];
+
+        if (entry.mPriority == aPriority && entry.mEventNumber <= aEventNumber && GetDistanceFromHead(entry.mOffset) < DataLength())
+        {
+            found = &entry;
+        }
+    }
+
+    return found;
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
 void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 {
     CircularEventBuffer * prev;
@@ -828,8 +1295,17 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
+    uint32_t dataLength = apBufWrapper->mpCurrent->DataLength();
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    if (apBufWrapper->mpStart != nullptr)
+    {
+        dataLength -= apBufWrapper->mpCurrent->GetDistanceFromHead(
+            static_cast<uint32_t>(apBufWrapper->mpStart - apBufWrapper->mpCurrent->GetQueue()));
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+    TLVReader::Init(*apBufWrapper, dataLength);
+    mMaxLen = dataLength;
     for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
@@ -842,6 +1318,21 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    if (aBufStart == nullptr && mpStart != nullptr)
+    {
+        // Read from mpStart up to the tail, or up to the end of the storage if the data wraps around in between.
+        const uint8_t * tail = mpCurrent->QueueTail();
+        const uint8_t * end  = (tail > mpStart) ? tail : mpCurrent->GetQueue() + mpCurrent->GetTotalDataLength();
+
+        aBufStart = mpStart;
+        aBufLen   = static_cast<uint32_t>(end - mpStart);
+        mpStart   = nullptr;
+        return err;
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
     mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
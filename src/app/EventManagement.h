@@ -28,9 +28,11 @@
 
 #include "EventLoggingDelegate.h"
 #include "EventLoggingTypes.h"
+#include "PersistentEventLog.h"
 #include <app/MessageDef/EventDataElement.h>
 #include <app/util/basic-types.h>
 #include <core/CHIPCircularTLVBuffer.h>
+#include <core/CHIPEventLoggingConfig.h>
 #include <messaging/ExchangeMgr.h>
 #include <support/PersistedCounter.h>
 
@@ -42,6 +44,22 @@ constexpr size_t kMaxEventSizeReserve = 512;
 constexpr uint16_t kRequiredEventField =
     (1 << EventDataElement::kCsTag_PriorityLevel) | (1 << EventDataElement::kCsTag_DeltaSystemTimestamp);
 
+struct EventEnvelopeContext;
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+/**
+ * @brief
+ *   Location of an event in a CircularEventBuffer, with the state FetchEventsSince needs to resume reading there.
+ */
+struct EventIndexEntry
+{
+    EventNumber mEventNumber       = 0;                      //< Number of the event
+    uint64_t mPriorSystemTimestamp = 0;                      //< Timestamp of the event of the same priority logged before it
+    uint32_t mOffset               = 0;                      //< Offset of the event in the buffer storage
+    PriorityLevel mPriority        = PriorityLevel::Invalid; //< Priority of the event
+};
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::CHIPCircularTLVBuffer
@@ -126,6 +144,13 @@ public:
 
     PriorityLevel GetPriorityLevel() { return mPriority; }
 
+    /**
+     * @brief
+     *   Set the log the events of the priority level of the buffer are also saved to, or nullptr to keep them in memory only.
+     */
+    void SetPersistentLog(PersistentEventLog * apLog) { mpPersistentLog = apLog; }
+    PersistentEventLog * GetPersistentLog() const { return mpPersistentLog; }
+
     CircularEventBuffer * GetPreviousCircularEventBuffer() { return mpPrev; }
     CircularEventBuffer * GetNextCircularEventBuffer() { return mpNext; }
 
@@ -140,6 +165,106 @@ public:
 
     uint64_t GetLastEventSystemTimestamp() { return mLastEventSystemTimestamp.mValue; }
 
+    /**
+     * @brief
+     *   Set the sizes the buffer keeps to and grows up to when it shares a pool with the other buffers.
+     *
+     * @param[in] aMinLength  The size the buffer does not give free space below.
+     *
+     * @param[in] aMaxLength  The size the buffer does not grow beyond, or 0 if it grows as long as there is free space.
+     */
+    void SetQuotas(uint32_t aMinLength, uint32_t aMaxLength)
+    {
+        mMinLength = aMinLength;
+        mMaxLength = aMaxLength;
+    }
+
+    uint32_t GetMinLength() const { return mMinLength; }
+
+    /**
+     * @brief
+     *   Number of free bytes the buffer can give to the other buffers of its pool.
+     */
+    uint32_t GetSpareLength() const
+    {
+        const uint32_t aboveMin = (GetTotalDataLength() > mMinLength) ? GetTotalDataLength() - mMinLength : 0;
+        return (AvailableDataLength() < aboveMin) ? AvailableDataLength() : aboveMin;
+    }
+
+    /**
+     * @brief
+     *   Number of bytes the buffer can take from the other buffers of its pool.
+     */
+    uint32_t GetGrowableLength() const
+    {
+        if (mMaxLength == 0)
+        {
+            return UINT32_MAX;
+        }
+        return (mMaxLength > GetTotalDataLength()) ? mMaxLength - GetTotalDataLength() : 0;
+    }
+
+    /**
+     * @brief
+     *   Rotate the storage so that the events start at @a aHeadOffset without wrapping around its end, keeping their index
+     *   entries.
+     */
+    CHIP_ERROR AlignEvents(uint32_t aHeadOffset);
+
+    /**
+     * @brief
+     *   Rotate the storage so that the events end before @a aEndOffset, if they do not already, starting them at offset 0.
+     */
+    CHIP_ERROR KeepEventsBefore(uint32_t aEndOffset);
+
+    /**
+     * @brief
+     *   Move the bounds of the storage within the pool, keeping the events, and their index entries, where they are.
+     *
+     * @param[in] apBuffer       The new storage, which @a apHead and the @a aDataLength bytes of events after it lie within.
+     *
+     * @param[in] aBufferLength  The length of @a apBuffer in bytes.
+     */
+    CHIP_ERROR MoveBounds(uint8_t * apBuffer, uint32_t aBufferLength, uint8_t * apHead, uint32_t aDataLength);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    uint32_t GetHeadOffset() const { return static_cast<uint32_t>(QueueHead() - GetQueue()) % GetTotalDataLength(); }
+    uint32_t GetTailOffset() const { return static_cast<uint32_t>(QueueTail() - GetQueue()); }
+
+    /**
+     * @brief
+     *   Number of bytes between the head of the buffer and @a aOffset.
+     */
+    uint32_t GetDistanceFromHead(uint32_t aOffset) const
+    {
+        return (aOffset + GetTotalDataLength() - GetHeadOffset()) % GetTotalDataLength();
+    }
+
+    /**
+     * @brief
+     *   Index an event just written at the tail of the buffer, forgetting the oldest entry if the index is full.
+     */
+    void AddIndexEntry(const EventIndexEntry & aEntry);
+
+    /**
+     * @brief
+     *   Remove the entry of the event at the head of the buffer, which is about to leave it.
+     *
+     * @param[out] aEntry   The removed entry.
+     *
+     * @retval true if the head event was indexed.
+     */
+    bool TakeHeadIndexEntry(EventIndexEntry & aEntry);
+
+    /**
+     * @brief
+     *   Find the entry of the last indexed event of priority @a aPriority whose number is not greater than @a aEventNumber.
+     *
+     * @return the entry, or nullptr if there is none in this buffer.
+     */
+    const EventIndexEntry * FindIndexEntry(PriorityLevel aPriority, EventNumber aEventNumber) const;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
     virtual ~CircularEventBuffer() = default;
 
 private:
@@ -161,6 +286,22 @@ private:
     EventNumber mLastEventNumber    = 0;  //< Last event Number vended for this priority
     Timestamp mFirstEventSystemTimestamp; //< The timestamp of the first event in this buffer
     Timestamp mLastEventSystemTimestamp;  //< The timestamp of the last event in this buffer
+    uint32_t mMinLength             = 0;  //< Size kept by the buffer when it shares a pool
+    uint32_t mMaxLength             = 0;  //< Size the buffer grows up to when it shares a pool, 0 for no limit
+
+    PersistentEventLog * mpPersistentLog = nullptr; //< Log the events of this priority level are saved to, if any
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    // Entries of the indexed events of this buffer, oldest first, in a ring starting at mIndexStart.
+    EventIndexEntry mIndex[CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES];
+    size_t mIndexStart = 0;
+    size_t mIndexCount = 0;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+
+#if CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES > 0
+    // Storage of the element index of the underlying CHIPCircularTLVBuffer.
+    uint32_t mEventLengths[CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES];
+#endif // CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES > 0
 };
 
 class CircularEventReader;
@@ -176,6 +317,10 @@ class CircularEventBufferWrapper : public TLV::CHIPCircularTLVBuffer
 public:
     CircularEventBufferWrapper() : CHIPCircularTLVBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
+    // When not null, reading starts at this point of the storage of mpCurrent instead of at its oldest event.
+    const uint8_t * mpStart = nullptr;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -205,20 +350,30 @@ struct LogStorageResources
     uint8_t * mpBuffer =
         nullptr; // Buffer to be used as a storage at the particular priority level and shared with more important events.
                  // Must not be nullptr.  Must be large enough to accommodate the largest event emitted by the system.
-    uint32_t mBufferSize = 0; //< The size, in bytes, of the `mBuffer`.
+                 // Not used when the buffers share a pool.
+    uint32_t mBufferSize = 0; //< The size, in bytes, of the `mBuffer`, or the size the buffer starts with when sharing a pool.
     Platform::PersistedStorage::Key * mCounterKey =
         nullptr;                // Name of the key naming persistent counter for events of this priority.  When NULL, the persistent
                                 // counters will not be used for this priority level.
     uint32_t mCounterEpoch = 0; // The interval used in incrementing persistent counters.  When 0, the persistent counters will not
                                 // be used for this priority level.
+    uint32_t mCounterMaxEpoch = 0; // The interval grows up to this value on busy priority levels. When not larger than
+                                   // mCounterEpoch, the interval does not grow.
     PersistedCounter * mpCounterStorage = nullptr; // application provided storage for persistent counter for this priority level.
     PriorityLevel mPriority =
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
+    uint32_t mMinBufferSize = 0; // When the buffers share a pool, the size this buffer keeps when giving its free space to the
+                                 // buffers of less important events.  When 0, it is mBufferSize.
+    uint32_t mMaxBufferSize = 0; // When the buffers share a pool, the size this buffer grows up to by taking the free space of
+                                 // the buffers of more important events.  When 0, the buffer grows as long as there is free space.
+    PersistentEventLog * mpPersistentLog = nullptr; // When not NULL, the initialized log the events of this priority level are
+                                                    // also saved to, so that they outlive a restart.
     PersistedCounter * InitializeCounter() const
     {
         if (mpCounterStorage != nullptr && mCounterKey != nullptr && mCounterEpoch != 0)
         {
-            return (mpCounterStorage->Init(*mCounterKey, mCounterEpoch) != CHIP_NO_ERROR) ? mpCounterStorage : nullptr;
+            const uint32_t maxEpoch = (mCounterMaxEpoch > mCounterEpoch) ? mCounterMaxEpoch : mCounterEpoch;
+            return (mpCounterStorage->Init(*mCounterKey, mCounterEpoch, maxEpoch) == CHIP_NO_ERROR) ? mpCounterStorage : nullptr;
         }
         return nullptr;
     }
@@ -264,6 +419,23 @@ public:
 
     void Init(Messaging::ExchangeManager * apExchangeManager, int aNumBuffers, CircularEventBuffer * apCircularEventBuffer,
               const LogStorageResources * const apLogStorageResources);
+
+    /**
+     * @brief
+     *   Initialize the EventManagement with buffers sharing one pool.
+     *
+     * Each buffer starts with the mBufferSize bytes of its LogStorageResources, and the buffer of the most important events
+     * also starts with the rest of the pool.  A full buffer takes the free space the buffers of more important events have
+     * above their mMinBufferSize, in segments of CHIP_CONFIG_EVENT_LOGGING_POOL_SEGMENT_SIZE bytes, up to its own
+     * mMaxBufferSize.  An event leaving a buffer for the next one is handed over by moving the bound between them when it
+     * lies against that bound, instead of being copied, so that the space follows the events.
+     *
+     * @param[in] apPool     The storage of all the buffers.  The mpBuffer of the LogStorageResources are not used.
+     *
+     * @param[in] aPoolSize  The size of @a apPool in bytes, at least the sum of the mBufferSize of the LogStorageResources.
+     */
+    void Init(Messaging::ExchangeManager * apExchangeManager, int aNumBuffers, CircularEventBuffer * apCircularEventBuffer,
+              const LogStorageResources * const apLogStorageResources, uint8_t * apPool, uint32_t aPoolSize);
     /**
      * @brief
      *   EventManagement default constructor. Provided primarily to make the compiler happy.
@@ -299,6 +471,15 @@ public:
                                       CircularEventBuffer * apCircularEventBuffer,
                                       const LogStorageResources * const apLogStorageResources);
 
+    /**
+     * @brief Create EventManagement object and initialize the logging management subsystem with buffers sharing one pool,
+     *   as the Init() taking a pool does.
+     */
+    static void CreateEventManagement(Messaging::ExchangeManager * apExchangeManager, int aNumBuffers,
+                                      CircularEventBuffer * apCircularEventBuffer,
+                                      const LogStorageResources * const apLogStorageResources, uint8_t * apPool,
+                                      uint32_t aPoolSize);
+
     static void DestroyEventManagement();
 
     /**
@@ -396,6 +577,29 @@ public:
      */
     CHIP_ERROR FetchEventsSince(chip::TLV::TLVWriter & aWriter, PriorityLevel aPriority, EventNumber & aEventNumber);
 
+    /**
+     * @brief
+     *   As FetchEventsSince above, for the events on one of the paths in
+     *   @a apInterestedPaths only, leaving @a aReservedSize bytes free in
+     *   the writer. The events left out are passed over, and the event
+     *   copied after them carries its event number.
+     *
+     * @param[in] apInterestedPaths     The paths of the events to fetch, all the
+     *                                  events if @a aInterestedPathCount is 0.
+     * @param[in] aInterestedPathCount  The number of paths in @a apInterestedPaths.
+     * @param[in] aReservedSize         The bytes the events leave free in @a aWriter,
+     *                                  for what comes after them in the message.
+     *
+     */
+    CHIP_ERROR FetchEventsSince(chip::TLV::TLVWriter & aWriter, PriorityLevel aPriority, EventNumber & aEventNumber,
+                                const EventPathParams * apInterestedPaths, size_t aInterestedPathCount, uint32_t aReservedSize);
+
+    /**
+     * @brief
+     *   Whether the event logging has been initialized and not shut down since.
+     */
+    bool IsValid() const { return mpEventBuffer != nullptr && mState != EventManagementStates::Shutdown; }
+
     /**
      * @brief
      *  Schedule a log offload task.
@@ -421,6 +625,11 @@ public:
      * triggers -- such as minimum and maximum time between offloads --
      * may also be taken into account depending on the offload strategy.
      *
+     * Here the event consumers are the event subscriptions of the
+     * reporting engine: each of them reports the events logged since its
+     * last report once out of its minimum report interval, or right away
+     * for an urgent event.
+     *
      *
      * @param aUrgent  indiate whether the flush should be scheduled if it is urgent
      *
@@ -451,6 +660,12 @@ public:
 
 private:
     CHIP_ERROR CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions, uint32_t & requiredSize);
+    /**
+     * @brief Save an event just logged to the persistent log of its priority level, writing it out right away if it is
+     *   urgent.  A failure is logged, the event staying in memory.
+     */
+    void PersistEvent(PersistentEventLog & aLog, EventLoggingDelegate * apDelegate, const EventOptions & aOptions,
+                      EventNumber aEventNumber);
     /**
      * @brief Helper function for writing event header and data according to event
      *   logging protocol.
@@ -487,6 +702,33 @@ private:
      */
     CHIP_ERROR EnsureSpaceInCircularBuffer(size_t aRequiredSpace);
 
+    /**
+     * @brief When the buffers share a pool, take free space from the buffers of more important events for a full buffer
+     *
+     * @param[in] apEventBuffer  The full buffer
+     * @param[in] aNeededSpace   The bytes missing in the buffer
+     *
+     * @retval true if the buffer took any space.
+     */
+    bool GrowFromPool(CircularEventBuffer * apEventBuffer, uint32_t aNeededSpace);
+
+    /**
+     * @brief When the buffers share a pool, hand the head event of a buffer over to the next buffer by moving the bound between
+     * them, which is only possible when the event starts at that bound and the events of the next buffer end there
+     *
+     * @param[in] apEventBuffer  The buffer whose head event moves to the next buffer
+     * @param[in] aEventLength   The length of the head event
+     *
+     * @retval true if the event was handed over.
+     */
+    bool RelinkHeadEvent(CircularEventBuffer * apEventBuffer, uint32_t aEventLength);
+
+    /**
+     * @brief Move the last @a aLength free bytes of a buffer to the front of the buffer of lesser priority, which starts where
+     * it ends
+     */
+    static CHIP_ERROR PassSpace(CircularEventBuffer & aFrom, CircularEventBuffer & aTo, uint32_t aLength);
+
     /**
      * @brief
      *   Internal API used to implement #FetchEventsSince
@@ -513,6 +755,11 @@ private:
      */
     static CHIP_ERROR EventIterator(const TLV::TLVReader & aReader, size_t aDepth, EventLoadOutContext * apEventLoadOutContext);
 
+    /**
+     * @brief Whether the event is on one of the paths of interest of the context, if it has any.
+     */
+    static bool IsEventOfInterest(const EventEnvelopeContext & aEvent, const EventLoadOutContext * apContext);
+
     /**
      * @brief Internal iterator function used to fetch event into EventEnvelopeContext, then EventIterator would filter event
      * based upon EventEnvelopeContext
@@ -520,6 +767,13 @@ private:
      */
     static CHIP_ERROR FetchEventParameters(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief Internal iterator function used by EvictEvent, as FetchEventParameters but stops at the event data once the
+     * priority and delta time are read
+     *
+     */
+    static CHIP_ERROR FetchEvictionParameters(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      * First event gets a timestamp, subsequent ones get a delta T
@@ -557,6 +811,7 @@ private:
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     EventManagementStates mState               = EventManagementStates::Idle;
     uint32_t mBytesWritten                     = 0;
+    bool mIsPooled                             = false;
 };
 } // namespace app
 } // namespace chip
@@ -19,24 +19,44 @@
 #pragma once
 
 #include <app/util/basic-types.h>
+#include <support/BitFlags.h>
 
 namespace chip {
 namespace app {
+enum class EventPathFlags : uint8_t
+{
+    // A wildcard path leaves ids out to cover the events of every endpoint, cluster or event id.
+    kEndpointIdWildcard = 0x01,
+    kClusterIdWildcard  = 0x02,
+    kEventIdWildcard    = 0x04,
+};
+
 struct EventPathParams
 {
     EventPathParams(NodeId aNodeId, EndpointId aEndpointId, ClusterId aClusterId, EventId aEventId, bool aIsUrgent) :
         mNodeId(aNodeId), mEndpointId(aEndpointId), mClusterId(aClusterId), mEventId(aEventId), mIsUrgent(aIsUrgent)
     {}
+    EventPathParams() {}
     bool IsSamePath(const EventPathParams & other) const
     {
         return other.mNodeId == mNodeId && other.mEndpointId == mEndpointId && other.mClusterId == mClusterId &&
-            other.mEventId == mEventId;
+            other.mEventId == mEventId && other.mFlags == mFlags;
+    }
+    /**
+     * Returns true if this path, wildcard or not, covers the event aEventId of cluster aClusterId on endpoint aEndpointId.
+     */
+    bool Covers(EndpointId aEndpointId, ClusterId aClusterId, EventId aEventId) const
+    {
+        return (mFlags.Has(EventPathFlags::kEndpointIdWildcard) || mEndpointId == aEndpointId) &&
+            (mFlags.Has(EventPathFlags::kClusterIdWildcard) || mClusterId == aClusterId) &&
+            (mFlags.Has(EventPathFlags::kEventIdWildcard) || mEventId == aEventId);
     }
     NodeId mNodeId         = 0;
     EndpointId mEndpointId = 0;
     ClusterId mClusterId   = 0;
     EventId mEventId       = 0;
     bool mIsUrgent         = false;
+    BitFlags<EventPathFlags> mFlags;
 };
 } // namespace app
 } // namespace chip
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <app/AttributePathParams.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLV.h>
 #include <messaging/ExchangeContext.h>
@@ -33,6 +34,7 @@ namespace chip {
 namespace app {
 class ReadClient;
 class CommandSender;
+class WriteClient;
 
 /**
  * @brief
@@ -59,6 +61,20 @@ public:
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
 
+    /**
+     * Notification that the interaction model has received the data of an attribute in response to a Read request.
+     * @param[in]  apReadClient          The readClient the Report Data came in on.
+     * @param[in]  aAttributePathParams  The path of the attribute.
+     * @param[in]  aReader               TLV reader positioned at the data of the attribute.
+     *
+     * @retval # CHIP_ERROR_NOT_IMPLEMENTED if not implemented, in which case the data is passed to WriteSingleClusterData
+     */
+    virtual CHIP_ERROR AttributeDataReceived(const ReadClient * apReadClient, const AttributePathParams & aAttributePathParams,
+                                             TLV::TLVReader & aReader)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
     /**
      * Notification that the last message for a Report Data action for the given ReadClient has been received and processed.
      * @param[in]  apReadClient   A current readClient which can identify the read to the consumer, particularly during
@@ -133,6 +149,47 @@ public:
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
 
+    /**
+     * Notification that a Write Client has received a Write Response containing the status of an attribute.
+     * @param[in]  apWriteClient   A current write client which can identify the write client to the consumer, particularly
+     * during multiple write interactions
+     * @param[in]  aGeneralCode   Status code defined by the standard
+     * @param[in]  aProtocolId    Protocol Id
+     * @param[in]  aProtocolCode  Detailed error information, protocol-specific.
+     * @param[in]  aAttributePathParams  The path of the attribute
+     * @param[in]  aAttributeIndex  Current processing attribute index which can identify the attribute if the response has
+     * several statuses for the same path
+     * @retval # CHIP_ERROR_NOT_IMPLEMENTED if not implemented
+     */
+    virtual CHIP_ERROR WriteResponseStatus(const WriteClient * apWriteClient,
+                                           const Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
+                                           const uint32_t aProtocolId, const uint16_t aProtocolCode,
+                                           AttributePathParams & aAttributePathParams, uint8_t aAttributeIndex)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    /**
+     * Notification that a Write Response has already been processed.
+     * @param[in]  apWriteClient   A current write client which can identify the write client to the consumer, particularly
+     * during multiple write interactions
+     * @retval # CHIP_ERROR_NOT_IMPLEMENTED if not implemented
+     */
+    virtual CHIP_ERROR WriteResponseProcessed(const WriteClient * apWriteClient) { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    /**
+     * Notification that a write client encountered an asynchronous failure.
+     * @param[in]  apWriteClient   A current write client which can identify the write client to the consumer, particularly
+     * during multiple write interactions
+     * @param[in]  aError         A error that could be CHIP_ERROR_TIMEOUT when write client fails to receive, or other error when
+     *                            fail to process write response.
+     * @retval # CHIP_ERROR_NOT_IMPLEMENTED if not implemented
+     */
+    virtual CHIP_ERROR WriteResponseError(const WriteClient * apWriteClient, CHIP_ERROR aError)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
     virtual ~InteractionModelDelegate() = default;
 };
 
@@ -28,6 +28,13 @@
 #include "CommandHandler.h"
 #include "CommandSender.h"
 #include <cinttypes>
+#include <core/CHIPTLV.h>
+#include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/StatusReport.h>
+#include <support/ErrorStr.h>
+#include <support/ScopedBuffer.h>
+#include <system/SystemTrace.h>
+#include <transport/SecureSessionMgr.h>
 
 namespace chip {
 namespace app {
@@ -40,12 +47,18 @@ InteractionModelEngine * InteractionModelEngine::GetInstance()
     return &sInteractionModelEngine;
 }
 
-CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate)
+CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate,
+                                        PersistentStorageDelegate * apSubscriptionStorage)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    mpExchangeMgr = apExchangeMgr;
-    mpDelegate    = apDelegate;
+    mpExchangeMgr         = apExchangeMgr;
+    mpDelegate            = apDelegate;
+    mpSubscriptionStorage = apSubscriptionStorage;
+
+    mCommandHandlerObjs.SetStatsEntry(System::Stats::kInteractionModel_NumCommandHandlers);
+    mReadHandlers.SetStatsEntry(System::Stats::kInteractionModel_NumReadHandlers);
+    mWriteHandlers.SetStatsEntry(System::Stats::kInteractionModel_NumWriteHandlers);
 
     err = mpExchangeMgr->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this);
     SuccessOrExit(err);
@@ -60,31 +73,27 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
     mClusterInfoPool[IM_SERVER_MAX_NUM_PATH_GROUPS - 1].mpNext = nullptr;
     mpNextAvailableClusterInfo                                 = mClusterInfoPool;
 
+    // The sessions the subscriptions are resumed on are restored once the application has loaded its admins, which it does
+    // after the engine is initialized.
+    if (mpSubscriptionStorage != nullptr)
+    {
+        err = mpExchangeMgr->GetSessionMgr()->SystemLayer()->ScheduleWork(ResumeSubscriptions, this);
+        SuccessOrExit(err);
+    }
+
 exit:
     return err;
 }
 
 void InteractionModelEngine::Shutdown()
 {
-    for (auto & commandSender : mCommandSenderObjs)
-    {
-        commandSender.Shutdown();
-    }
-
-    for (auto & commandHandler : mCommandHandlerObjs)
-    {
-        commandHandler.Shutdown();
-    }
-
-    for (auto & readClient : mReadClients)
-    {
-        readClient.Shutdown();
-    }
-
-    for (auto & readHandler : mReadHandlers)
-    {
-        readHandler.Shutdown();
-    }
+    mCommandSenderObjs.ForEachObject([](CommandSender & commandSender) { commandSender.Shutdown(); });
+    mCommandHandlerObjs.ForEachObject([](CommandHandler & commandHandler) { commandHandler.Shutdown(); });
+    mReadClients.ForEachObject([](ReadClient & readClient) { readClient.Shutdown(); });
+    // The subscriptions are shut down without their records being deleted, for them to be resumed once the device restarts.
+    mReadHandlers.ForEachObject([](ReadHandler & readHandler) { readHandler.Shutdown(); });
+    mWriteClients.ForEachObject([](WriteClient & writeClient) { writeClient.Shutdown(); });
+    mWriteHandlers.ForEachObject([](WriteHandler & writeHandler) { writeHandler.Shutdown(); });
 
     for (uint32_t index = 0; index < IM_SERVER_MAX_NUM_PATH_GROUPS; index++)
     {
@@ -92,50 +101,57 @@ void InteractionModelEngine::Shutdown()
         mClusterInfoPool[index].ClearDirty();
     }
     mpNextAvailableClusterInfo = nullptr;
+    mpSubscriptionStorage      = nullptr;
 }
 
-CHIP_ERROR InteractionModelEngine::NewCommandSender(CommandSender ** const apCommandSender)
+CHIP_ERROR InteractionModelEngine::NewCommandSender(CommandSender ** const apCommandSender, InteractionModelDelegate * apDelegate)
 {
-    CHIP_ERROR err   = CHIP_ERROR_NO_MEMORY;
-    *apCommandSender = nullptr;
+    CHIP_ERROR err                = CHIP_NO_ERROR;
+    CommandSender * commandSender = mCommandSenderObjs.Allocate();
+    *apCommandSender              = nullptr;
 
-    for (auto & commandSender : mCommandSenderObjs)
+    VerifyOrExit(commandSender != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    err = commandSender->Init(mpExchangeMgr, apDelegate != nullptr ? apDelegate : mpDelegate);
+    if (CHIP_NO_ERROR != err)
     {
-        if (commandSender.IsFree())
-        {
-            *apCommandSender = &commandSender;
-            err              = commandSender.Init(mpExchangeMgr, mpDelegate);
-            if (CHIP_NO_ERROR != err)
-            {
-                *apCommandSender = nullptr;
-                ExitNow();
-            }
-            break;
-        }
+        mCommandSenderObjs.Release(commandSender);
+        ExitNow();
     }
+    *apCommandSender = commandSender;
 
 exit:
     return err;
 }
 
-CHIP_ERROR InteractionModelEngine::NewReadClient(ReadClient ** const apReadClient)
+CHIP_ERROR InteractionModelEngine::NewReadClient(ReadClient ** const apReadClient, InteractionModelDelegate * apDelegate)
 {
-    CHIP_ERROR err = CHIP_ERROR_NO_MEMORY;
+    CHIP_ERROR err          = CHIP_NO_ERROR;
+    ReadClient * readClient = mReadClients.Allocate();
+    VerifyOrReturnError(readClient != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    for (auto & readClient : mReadClients)
+    *apReadClient = readClient;
+    err           = readClient->Init(mpExchangeMgr, apDelegate != nullptr ? apDelegate : mpDelegate);
+    if (CHIP_NO_ERROR != err)
     {
-        if (readClient.IsFree())
-        {
-            *apReadClient = &readClient;
-            err           = readClient.Init(mpExchangeMgr, mpDelegate);
-            if (CHIP_NO_ERROR != err)
-            {
-                *apReadClient = nullptr;
-            }
-            return err;
-        }
+        *apReadClient = nullptr;
+        mReadClients.Release(readClient);
     }
+    return err;
+}
+
+CHIP_ERROR InteractionModelEngine::NewWriteClient(WriteClient ** const apWriteClient, InteractionModelDelegate * apDelegate)
+{
+    CHIP_ERROR err            = CHIP_NO_ERROR;
+    WriteClient * writeClient = mWriteClients.Allocate();
+    VerifyOrReturnError(writeClient != nullptr, CHIP_ERROR_NO_MEMORY);
 
+    *apWriteClient = writeClient;
+    err            = writeClient->Init(mpExchangeMgr, apDelegate != nullptr ? apDelegate : mpDelegate);
+    if (CHIP_NO_ERROR != err)
+    {
+        *apWriteClient = nullptr;
+        mWriteClients.Release(writeClient);
+    }
     return err;
 }
 
@@ -166,20 +182,27 @@ void InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext *
                                                     const PacketHeader & aPacketHeader, const PayloadHeader & aPayloadHeader,
                                                     System::PacketBufferHandle aPayload)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    CHIP_ERROR err                  = CHIP_NO_ERROR;
+    CommandHandler * commandHandler = mCommandHandlerObjs.Allocate();
 
-    for (auto & commandHandler : mCommandHandlerObjs)
+    if (commandHandler == nullptr)
     {
-        if (commandHandler.IsFree())
-        {
-            err = commandHandler.Init(mpExchangeMgr, mpDelegate);
-            SuccessOrExit(err);
-            commandHandler.OnMessageReceived(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
-            apExchangeContext = nullptr;
-            break;
-        }
+        ChipLogProgress(DataManagement, "No CommandHandler available, busy");
+        err = SendBusyStatusReport(apExchangeContext);
+        SuccessOrExit(err);
+        apExchangeContext = nullptr;
+        ExitNow();
     }
 
+    err = commandHandler->Init(mpExchangeMgr, mpDelegate);
+    if (err != CHIP_NO_ERROR)
+    {
+        mCommandHandlerObjs.Release(commandHandler);
+        ExitNow();
+    }
+    commandHandler->OnMessageReceived(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
+    apExchangeContext = nullptr;
+
 exit:
     ChipLogFunctError(err);
 
@@ -192,23 +215,76 @@ exit:
 void InteractionModelEngine::OnReadRequest(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
                                            const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    CHIP_ERROR err            = CHIP_NO_ERROR;
+    ReadHandler * readHandler = mReadHandlers.Allocate();
 
-    ChipLogDetail(DataManagement, "Receive Read request");
+    ChipLogDetail(DataManagement, "Receive %s request",
+                  aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::SubscribeRequest) ? "Subscribe" : "Read");
 
-    for (auto & readHandler : mReadHandlers)
+    if (readHandler == nullptr)
     {
-        if (readHandler.IsFree())
-        {
-            err = readHandler.Init(mpDelegate);
-            SuccessOrExit(err);
-            err = readHandler.OnReadRequest(apExchangeContext, std::move(aPayload));
-            SuccessOrExit(err);
-            apExchangeContext = nullptr;
-            break;
-        }
+        ChipLogProgress(DataManagement, "No ReadHandler available, busy");
+        err = SendBusyStatusReport(apExchangeContext);
+        SuccessOrExit(err);
+        apExchangeContext = nullptr;
+        ExitNow();
+    }
+
+    err = readHandler->Init(mpDelegate);
+    if (err != CHIP_NO_ERROR)
+    {
+        mReadHandlers.Release(readHandler);
+        ExitNow();
+    }
+    // The read handler shuts itself down, and so returns to the pool, when OnReadRequest fails.
+    if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::SubscribeRequest))
+    {
+        err = readHandler->OnSubscribeRequest(apExchangeContext, std::move(aPayload));
+    }
+    else
+    {
+        err = readHandler->OnReadRequest(apExchangeContext, std::move(aPayload));
+    }
+    SuccessOrExit(err);
+    apExchangeContext = nullptr;
+
+exit:
+    ChipLogFunctError(err);
+
+    if (nullptr != apExchangeContext)
+    {
+        apExchangeContext->Abort();
+    }
+}
+
+void InteractionModelEngine::OnWriteRequest(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                                            const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
+{
+    CHIP_ERROR err              = CHIP_NO_ERROR;
+    WriteHandler * writeHandler = mWriteHandlers.Allocate();
+
+    ChipLogDetail(DataManagement, "Receive Write request");
+
+    if (writeHandler == nullptr)
+    {
+        ChipLogProgress(DataManagement, "No WriteHandler available, busy");
+        err = SendBusyStatusReport(apExchangeContext);
+        SuccessOrExit(err);
+        apExchangeContext = nullptr;
+        ExitNow();
     }
 
+    err = writeHandler->Init(mpDelegate);
+    if (err != CHIP_NO_ERROR)
+    {
+        mWriteHandlers.Release(writeHandler);
+        ExitNow();
+    }
+    // The write handler shuts itself down, and so returns to the pool, once it has answered the request or failed to, closing
+    // the exchange.
+    err               = writeHandler->OnWriteRequest(apExchangeContext, std::move(aPayload));
+    apExchangeContext = nullptr;
+
 exit:
     ChipLogFunctError(err);
 
@@ -221,21 +297,189 @@ exit:
 void InteractionModelEngine::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
                                                const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
 {
+    SYSTEM_TRACE_SCOPE(InteractionModelReceive);
+
     if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::InvokeCommandRequest))
     {
 
         OnInvokeCommandRequest(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
     }
-    else if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::ReadRequest))
+    else if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::ReadRequest) ||
+             aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::SubscribeRequest))
     {
         OnReadRequest(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
     }
+    else if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::WriteRequest))
+    {
+        OnWriteRequest(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
+    }
+    else if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::ReportData))
+    {
+        OnResumedReport(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
+    }
     else
     {
         OnUnknownMsgType(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
     }
 }
 
+void InteractionModelEngine::OnResumedReport(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                                             const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
+{
+    const NodeId peerNodeId = apExchangeContext->GetSecureSessionHandle().GetPeerNodeId();
+    ReadClient * readClient = nullptr;
+
+    mReadClients.ForEachObject([&readClient, peerNodeId](ReadClient & client) {
+        if (readClient == nullptr && client.IsSubscribed() && client.mPeerNodeId == peerNodeId)
+        {
+            readClient = &client;
+        }
+    });
+
+    if (readClient != nullptr)
+    {
+        // The exchange the subscription was on is gone with the reboot of the peer.
+        ChipLogProgress(DataManagement, "Subscription resumed by peer");
+        readClient->ClearExistingExchangeContext();
+        readClient->mpExchangeCtx = apExchangeContext;
+        apExchangeContext->SetDelegate(readClient);
+        readClient->OnMessageReceived(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
+        return;
+    }
+
+    OnUnknownMsgType(apExchangeContext, aPacketHeader, aPayloadHeader, std::move(aPayload));
+}
+
+void InteractionModelEngine::GetSubscriptionKey(uint8_t aSlot, char (&aKey)[16])
+{
+    snprintf(aKey, sizeof(aKey), "%s%u", kPersistentSubscriptionKeyPrefix, static_cast<unsigned>(aSlot));
+}
+
+void InteractionModelEngine::PersistSubscription(ReadHandler & aReadHandler)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    TLV::TLVWriter writer;
+    uint8_t slot = 0;
+    char key[16];
+
+    VerifyOrReturn(mpSubscriptionStorage != nullptr && aReadHandler.GetSubscriptionSlot() == ReadHandler::kNoSubscriptionSlot);
+
+    // A slot of storage is taken by a subscription until it fails, which the resumed subscriptions keep the slots of.
+    for (; slot < CHIP_MAX_NUM_READ_HANDLER; slot++)
+    {
+        bool taken = false;
+        mReadHandlers.ForEachObject([&taken, slot](ReadHandler & readHandler) {
+            taken = taken || (!readHandler.IsFree() && readHandler.GetSubscriptionSlot() == slot);
+        });
+        if (!taken)
+        {
+            break;
+        }
+    }
+    VerifyOrExit(slot < CHIP_MAX_NUM_READ_HANDLER, err = CHIP_ERROR_NO_MEMORY);
+
+    VerifyOrExit(buffer.Alloc(CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE), err = CHIP_ERROR_NO_MEMORY);
+    writer.Init(buffer.Get(), CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE);
+    SuccessOrExit(err = aReadHandler.EncodeSubscription(writer));
+    SuccessOrExit(err = writer.Finalize());
+
+    GetSubscriptionKey(slot, key);
+    SuccessOrExit(
+        err = mpSubscriptionStorage->SyncSetKeyValue(key, buffer.Get(), static_cast<uint16_t>(writer.GetLengthWritten())));
+    aReadHandler.SetSubscriptionSlot(slot);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        // The subscription goes on, but its initiator has to subscribe again after a reboot.
+        ChipLogError(DataManagement, "Failed to persist subscription: %s", ErrorStr(err));
+    }
+}
+
+void InteractionModelEngine::ForgetSubscription(ReadHandler & aReadHandler)
+{
+    char key[16];
+
+    VerifyOrReturn(mpSubscriptionStorage != nullptr && aReadHandler.GetSubscriptionSlot() != ReadHandler::kNoSubscriptionSlot);
+
+    GetSubscriptionKey(aReadHandler.GetSubscriptionSlot(), key);
+    mpSubscriptionStorage->SyncDeleteKeyValue(key);
+    aReadHandler.SetSubscriptionSlot(ReadHandler::kNoSubscriptionSlot);
+}
+
+void InteractionModelEngine::ResumeSubscriptions(System::Layer * aSystemLayer, void * apAppState, System::Error aError)
+{
+    static_cast<InteractionModelEngine *>(apAppState)->ResumeSubscriptions();
+}
+
+void InteractionModelEngine::ResumeSubscriptions()
+{
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    char key[16];
+
+    VerifyOrReturn(mpSubscriptionStorage != nullptr && buffer.Alloc(CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE));
+
+    for (uint8_t slot = 0; slot < CHIP_MAX_NUM_READ_HANDLER; slot++)
+    {
+        uint16_t size = CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE;
+        TLV::TLVReader reader;
+        ReadHandler * readHandler = nullptr;
+
+        GetSubscriptionKey(slot, key);
+        if (mpSubscriptionStorage->SyncGetKeyValue(key, buffer.Get(), size) != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+
+        // A subscription which cannot be resumed is dropped: its initiator subscribes again once it notices.
+        readHandler = mReadHandlers.Allocate();
+        if (readHandler == nullptr || readHandler->Init(mpDelegate) != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "No ReadHandler to resume subscription %u", static_cast<unsigned>(slot));
+            if (readHandler != nullptr)
+            {
+                mReadHandlers.Release(readHandler);
+            }
+            mpSubscriptionStorage->SyncDeleteKeyValue(key);
+            continue;
+        }
+
+        reader.Init(buffer.Get(), size);
+        if (readHandler->ResumeSubscription(reader, mpExchangeMgr) != CHIP_NO_ERROR)
+        {
+            mpSubscriptionStorage->SyncDeleteKeyValue(key);
+            continue;
+        }
+        readHandler->SetSubscriptionSlot(slot);
+        ChipLogProgress(DataManagement, "Resumed subscription %u", static_cast<unsigned>(slot));
+    }
+}
+
+CHIP_ERROR InteractionModelEngine::SendBusyStatusReport(Messaging::ExchangeContext * apExchangeContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    SYSTEM_STATS_COUNT(System::Stats::kInteractionModel_NumBusyResponses);
+    Protocols::SecureChannel::StatusReport report(Protocols::SecureChannel::GeneralStatusCode::kBusy,
+                                                  Protocols::InteractionModel::Id.ToFullyQualifiedSpecForm(), 0);
+    size_t msgSize = report.Size();
+    Encoding::LittleEndian::PacketBufferWriter bbuf(MessagePacketBuffer::New(msgSize), msgSize);
+    System::PacketBufferHandle msgBuf;
+
+    VerifyOrExit(!bbuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    report.WriteToBuffer(bbuf);
+    msgBuf = bbuf.Finalize();
+    VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+
+    err = apExchangeContext->SendMessage(Protocols::SecureChannel::MsgType::StatusReport, std::move(msgBuf),
+                                         Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+    SuccessOrExit(err);
+    apExchangeContext->Close();
+
+exit:
+    return err;
+}
+
 void InteractionModelEngine::OnResponseTimeout(Messaging::ExchangeContext * ec)
 {
     ChipLogProgress(DataManagement, "Time out! failed to receive echo response from Exchange: %d", ec->GetExchangeId());
@@ -277,9 +521,28 @@ CHIP_ERROR __attribute__((weak)) WriteSingleClusterData(AttributePathParams & aA
     return CHIP_NO_ERROR;
 }
 
+bool __attribute__((weak))
+ExpandAttributePath(const AttributePathParams & aWildcard, AttributePathCursor & aCursor, AttributePathParams & aPath)
+{
+    ChipLogError(DataManagement, "Default ExpandAttributePath is called, this should be replaced by the data model's");
+    return false;
+}
+
+bool __attribute__((weak)) NextGroupEndpoint(GroupId aGroupId, uint16_t & aEndpointIndex, EndpointId & aEndpointId)
+{
+    ChipLogError(DataManagement, "Default NextGroupEndpoint is called, this should be replaced by the data model's");
+    return false;
+}
+
+bool __attribute__((weak)) GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId, DataVersion & aDataVersion)
+{
+    // Without the data model's versions, every cluster is reported as changed.
+    return false;
+}
+
 uint16_t InteractionModelEngine::GetReadClientArrayIndex(const ReadClient * const apReadClient) const
 {
-    return static_cast<uint16_t>(apReadClient - mReadClients);
+    return static_cast<uint16_t>(mReadClients.IndexOf(apReadClient));
 }
 
 void InteractionModelEngine::ReleaseClusterInfoList(ClusterInfo *& aClusterInfo)
@@ -312,8 +575,15 @@ CHIP_ERROR InteractionModelEngine::PushFront(ClusterInfo *& aClusterInfo, Attrib
     mpNextAvailableClusterInfo         = mpNextAvailableClusterInfo->mpNext;
     aClusterInfo->mpNext               = last;
     aClusterInfo->mAttributePathParams = aAttributePathParams;
+    aClusterInfo->mHasDataVersion      = false;
     return CHIP_NO_ERROR;
 }
 
+size_t GetMaxSecureSduLength(Messaging::ExchangeContext * apExchangeContext)
+{
+    VerifyOrReturnError(apExchangeContext != nullptr, kMaxSecureSduLengthBytes);
+    return kMaxSecureSduLengthBytes + apExchangeContext->GetMaxPayloadLength() - kMaxAppMessageLen;
+}
+
 } // namespace app
 } // namespace chip
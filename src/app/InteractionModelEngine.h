@@ -27,6 +27,7 @@
 
 #include <app/MessageDef/ReportData.h>
 #include <core/CHIPCore.h>
+#include <core/CHIPPersistentStorageDelegate.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
@@ -42,17 +43,36 @@
 #include <app/CommandHandler.h>
 #include <app/CommandSender.h>
 #include <app/InteractionModelDelegate.h>
+#include <app/ObjectPool.h>
 #include <app/ReadClient.h>
 #include <app/ReadHandler.h>
+#include <app/WriteClient.h>
+#include <app/WriteHandler.h>
 #include <app/reporting/Engine.h>
 #include <app/util/basic-types.h>
 
+#ifndef CHIP_MAX_NUM_COMMAND_HANDLER
 #define CHIP_MAX_NUM_COMMAND_HANDLER 1
+#endif
+#ifndef CHIP_MAX_NUM_COMMAND_SENDER
 #define CHIP_MAX_NUM_COMMAND_SENDER 1
+#endif
+#ifndef CHIP_MAX_NUM_READ_CLIENT
 #define CHIP_MAX_NUM_READ_CLIENT 1
+#endif
+#ifndef CHIP_MAX_NUM_READ_HANDLER
 #define CHIP_MAX_NUM_READ_HANDLER 1
+#endif
+#ifndef CHIP_MAX_NUM_WRITE_CLIENT
+#define CHIP_MAX_NUM_WRITE_CLIENT 1
+#endif
+#ifndef CHIP_MAX_NUM_WRITE_HANDLER
+#define CHIP_MAX_NUM_WRITE_HANDLER 1
+#endif
 #define CHIP_MAX_REPORTS_IN_FLIGHT 1
+#ifndef IM_SERVER_MAX_NUM_PATH_GROUPS
 #define IM_SERVER_MAX_NUM_PATH_GROUPS 8
+#endif
 
 namespace chip {
 namespace app {
@@ -60,6 +80,17 @@ namespace app {
 constexpr size_t kMaxSecureSduLengthBytes = 1024;
 constexpr uint32_t kImMessageTimeoutMsec  = 3000;
 constexpr FieldId kRootFieldId            = 0;
+
+// KVS store is sensitive to length of key strings, based on the underlying
+// platform. Keeping them short.
+constexpr char kPersistentSubscriptionKeyPrefix[] = "CHIPSub";
+
+/**
+ * The largest Interaction Model message to send on an exchange: kMaxSecureSduLengthBytes, plus every byte of payload the
+ * peer of the exchange takes above kMaxAppMessageLen, e.g. over a Wi-Fi or Ethernet path with a larger MTU.
+ */
+size_t GetMaxSecureSduLength(Messaging::ExchangeContext * apExchangeContext);
+
 /**
  * @class InteractionModelEngine
  *
@@ -83,15 +114,18 @@ public:
     /**
      *  Initialize the InteractionModel Engine.
      *
-     *  @param[in]    apExchangeMgr    A pointer to the ExchangeManager object.
-     *  @param[in]    apDelegate       InteractionModelDelegate set by application.
+     *  @param[in]    apExchangeMgr            A pointer to the ExchangeManager object.
+     *  @param[in]    apDelegate               InteractionModelDelegate set by application.
+     *  @param[in]    apSubscriptionStorage    The storage the subscriptions are kept in, for those of before a reboot to be
+     *                                         resumed once the event loop runs, or nullptr for them not to be kept.
      *
      *  @retval #CHIP_ERROR_INCORRECT_STATE If the state is not equal to
      *          kState_NotInitialized.
      *  @retval #CHIP_NO_ERROR On success.
      *
      */
-    CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate);
+    CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate,
+                    PersistentStorageDelegate * apSubscriptionStorage = nullptr);
 
     void Shutdown();
 
@@ -102,29 +136,43 @@ public:
      *  the consumer is responsible for calling Shutdown() on the CommandSender once it's done using it.
      *
      *  @param[out]    apCommandSender    A pointer to the CommandSender object.
+     *  @param[in]     apDelegate         The delegate of the CommandSender, the one of the InteractionModelEngine if nullptr.
      *
-     *  @retval #CHIP_ERROR_INCORRECT_STATE If there is no CommandSender available
+     *  @retval #CHIP_ERROR_NO_MEMORY If there is no CommandSender available
      *  @retval #CHIP_NO_ERROR On success.
      */
-    CHIP_ERROR NewCommandSender(CommandSender ** const apCommandSender);
+    CHIP_ERROR NewCommandSender(CommandSender ** const apCommandSender, InteractionModelDelegate * apDelegate = nullptr);
 
     /**
      *  Retrieve a ReadClient that the SDK consumer can use to send do a read.  If the call succeeds, the consumer
      *  is responsible for calling Shutdown() on the ReadClient once it's done using it.
      *
      *  @param[out]    apReadClient    A pointer to the ReadClient object.
+     *  @param[in]     apDelegate      The delegate of the ReadClient, the one of the InteractionModelEngine if nullptr.
+     *
+     *  @retval #CHIP_ERROR_NO_MEMORY If there is no ReadClient available
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR NewReadClient(ReadClient ** const apReadClient, InteractionModelDelegate * apDelegate = nullptr);
+
+    /**
+     *  Retrieve a WriteClient that the SDK consumer can use to write attributes.  If the call succeeds, the consumer
+     *  is responsible for calling Shutdown() on the WriteClient once it's done using it.
+     *
+     *  @param[out]    apWriteClient   A pointer to the WriteClient object.
+     *  @param[in]     apDelegate      The delegate of the WriteClient, the one of the InteractionModelEngine if nullptr.
      *
-     *  @retval #CHIP_ERROR_INCORRECT_STATE If there is no ReadClient available
+     *  @retval #CHIP_ERROR_NO_MEMORY If there is no WriteClient available
      *  @retval #CHIP_NO_ERROR On success.
      */
-    CHIP_ERROR NewReadClient(ReadClient ** const apReadClient);
+    CHIP_ERROR NewWriteClient(WriteClient ** const apWriteClient, InteractionModelDelegate * apDelegate = nullptr);
 
     /**
      *  Get read client index in mReadClients
      *
      *  @param[in]    apReadClient    A pointer to a read client object.
      *
-     *  @retval  the index in mReadClients array
+     *  @retval  the index in mReadClients pool
      */
     uint16_t GetReadClientArrayIndex(const ReadClient * const apReadClient) const;
 
@@ -133,8 +181,26 @@ public:
     void ReleaseClusterInfoList(ClusterInfo *& aClusterInfo);
     CHIP_ERROR PushFront(ClusterInfo *& aClusterInfo, AttributePathParams & aAttributePathParams);
 
+    /**
+     *  Keep a subscription in the storage given to Init, for it to be resumed after a reboot. Does nothing without storage,
+     *  or when no slot is free or the subscription does not fit in CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE.
+     */
+    void PersistSubscription(ReadHandler & aReadHandler);
+
+    /**
+     *  Delete the kept record of a subscription which has failed, for it not to be resumed after a reboot.
+     */
+    void ForgetSubscription(ReadHandler & aReadHandler);
+
+    /**
+     *  Resume the subscriptions kept in storage before a reboot, each sending its initiator a report of every path right
+     *  away. Init schedules this on the event loop, once the application has restored the admins and sessions.
+     */
+    void ResumeSubscriptions();
+
 private:
     friend class reporting::Engine;
+    friend class TestReadInteraction;
     void OnUnknownMsgType(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
                           const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload);
     void OnInvokeCommandRequest(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
@@ -150,12 +216,37 @@ private:
     void OnReadRequest(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
                        const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload);
 
-    Messaging::ExchangeManager * mpExchangeMgr = nullptr;
-    InteractionModelDelegate * mpDelegate      = nullptr;
-    CommandHandler mCommandHandlerObjs[CHIP_MAX_NUM_COMMAND_HANDLER];
-    CommandSender mCommandSenderObjs[CHIP_MAX_NUM_COMMAND_SENDER];
-    ReadClient mReadClients[CHIP_MAX_NUM_READ_CLIENT];
-    ReadHandler mReadHandlers[CHIP_MAX_NUM_READ_HANDLER];
+    /**
+     * Called when Interaction Model receives a Write Request message.  Errors processing
+     * the Write Request are handled entirely within this function.
+     */
+    void OnWriteRequest(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                        const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload);
+
+    /**
+     * Called when Interaction Model receives a Report Data message on a new exchange, which a device sends to resume a
+     * subscription after a reboot. The report is handed to the subscribed read client of the peer, which takes the exchange.
+     */
+    void OnResumedReport(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                         const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload);
+
+    /**
+     * Answer a request with a Busy status report when the handlers for it are exhausted.
+     */
+    CHIP_ERROR SendBusyStatusReport(Messaging::ExchangeContext * apExchangeContext);
+
+    static void ResumeSubscriptions(System::Layer * aSystemLayer, void * apAppState, System::Error aError);
+    static void GetSubscriptionKey(uint8_t aSlot, char (&aKey)[16]);
+
+    Messaging::ExchangeManager * mpExchangeMgr        = nullptr;
+    InteractionModelDelegate * mpDelegate             = nullptr;
+    PersistentStorageDelegate * mpSubscriptionStorage = nullptr;
+    ObjectPool<CommandHandler, CHIP_MAX_NUM_COMMAND_HANDLER> mCommandHandlerObjs;
+    ObjectPool<CommandSender, CHIP_MAX_NUM_COMMAND_SENDER> mCommandSenderObjs;
+    ObjectPool<ReadClient, CHIP_MAX_NUM_READ_CLIENT> mReadClients;
+    ObjectPool<ReadHandler, CHIP_MAX_NUM_READ_HANDLER> mReadHandlers;
+    ObjectPool<WriteClient, CHIP_MAX_NUM_WRITE_CLIENT> mWriteClients;
+    ObjectPool<WriteHandler, CHIP_MAX_NUM_WRITE_HANDLER> mWriteHandlers;
     reporting::Engine mReportingEngine;
     ClusterInfo mClusterInfoPool[IM_SERVER_MAX_NUM_PATH_GROUPS];
     ClusterInfo * mpNextAvailableClusterInfo = nullptr;
@@ -165,5 +256,28 @@ void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aC
                                   chip::TLV::TLVReader & aReader, Command * apCommandObj);
 CHIP_ERROR ReadSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVWriter & aWriter);
 CHIP_ERROR WriteSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVReader & aReader);
+
+/**
+ * Sets aPath to the first attribute of the data model, at or after aCursor, that the wildcard path aWildcard covers, and moves
+ * aCursor to it. Incrementing aCursor.mAttributeIndex then moves past that attribute.
+ *
+ * @return false once every attribute covered has been visited.
+ */
+bool ExpandAttributePath(const AttributePathParams & aWildcard, AttributePathCursor & aCursor, AttributePathParams & aPath);
+
+/**
+ * Sets aEndpointId to the first endpoint, at or after the endpoint index aEndpointIndex, that is a member of the group aGroupId,
+ * and moves aEndpointIndex to it. Incrementing aEndpointIndex then moves past that endpoint.
+ *
+ * @return false once every endpoint has been visited.
+ */
+bool NextGroupEndpoint(GroupId aGroupId, uint16_t & aEndpointIndex, EndpointId & aEndpointId);
+
+/**
+ * Sets aDataVersion to the data version of the cluster on the endpoint, which changes whenever one of its attributes does.
+ *
+ * @return false if the cluster is not on the endpoint or its version is not kept, its data then being always reported.
+ */
+bool GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId, DataVersion & aDataVersion);
 } // namespace app
 } // namespace chip
@@ -390,6 +390,22 @@ exit:
     return mAttributePathBuilder;
 }
 
+AttributeDataElement::Builder & AttributeDataElement::Builder::EncodeAttributePath(const chip::NodeId aNodeId,
+                                                                                   const chip::EndpointId aEndpointId,
+                                                                                   const chip::ClusterId aClusterId,
+                                                                                   const chip::FieldId aFieldId)
+{
+    // skip if error has already been set
+    SuccessOrExit(mError);
+
+    mError = AttributePath::FieldPathLayout::Encode(*mpWriter, chip::TLV::ContextTag(kCsTag_AttributePath), aNodeId, aEndpointId,
+                                                    aClusterId, aFieldId);
+    ChipLogFunctError(mError);
+
+exit:
+    return *this;
+}
+
 AttributeDataElement::Builder & AttributeDataElement::Builder::DataVersion(const chip::DataVersion aDataVersion)
 {
     // skip if error has already been set
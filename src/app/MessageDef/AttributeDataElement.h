@@ -138,6 +138,15 @@ public:
      */
     AttributePath::Builder & CreateAttributePathBuilder();
 
+    /**
+     *  @brief Inject an AttributePath made of a node, endpoint, cluster and field id into the TLV stream in one go, in place
+     *         of CreateAttributePathBuilder() and the AttributePath::Builder calls.
+     *
+     *  @return A reference to *this
+     */
+    AttributeDataElement::Builder & EncodeAttributePath(const chip::NodeId aNodeId, const chip::EndpointId aEndpointId,
+                                                        const chip::ClusterId aClusterId, const chip::FieldId aFieldId);
+
     /**
      *  @brief Inject DataVersion into the TLV stream to indicate the numerical data version associated with
      *  the cluster that is referenced by the path.
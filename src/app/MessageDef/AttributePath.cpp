@@ -151,10 +151,8 @@ CHIP_ERROR AttributePath::Parser::CheckSchemaValidity() const
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
     {
-        // check for required fields:
-        const uint16_t RequiredFields = (1 << kCsTag_EndpointId) | (1 << kCsTag_ClusterId);
-
-        if ((TagPresenceMask & RequiredFields) == RequiredFields)
+        // Every id can be left out of a wildcard path, provided the path is not empty.
+        if (TagPresenceMask != 0)
         {
             err = CHIP_NO_ERROR;
         }
@@ -197,6 +195,16 @@ CHIP_ERROR AttributePath::Parser::GetListIndex(chip::ListIndex * const apListInd
     return GetUnsignedInteger(kCsTag_ListIndex, apListIndex);
 }
 
+CHIP_ERROR AttributePath::Parser::DecodeAttributePath(chip::NodeId * const apNodeId, chip::EndpointId * const apEndpointId,
+                                                      chip::ClusterId * const apClusterId, chip::FieldId * const apFieldId,
+                                                      chip::ListIndex * const apListIndex, uint32_t * const apPresenceMask) const
+{
+    return DecodeContextFields(*apPresenceMask, UnsignedContextField(kCsTag_NodeId, apNodeId),
+                               UnsignedContextField(kCsTag_EndpointId, apEndpointId),
+                               UnsignedContextField(kCsTag_ClusterId, apClusterId), UnsignedContextField(kCsTag_FieldId, apFieldId),
+                               UnsignedContextField(kCsTag_ListIndex, apListIndex));
+}
+
 CHIP_ERROR AttributePath::Builder::_Init(chip::TLV::TLVWriter * const apWriter, const uint64_t aTag)
 {
     mpWriter = apWriter;
@@ -28,6 +28,7 @@
 #include <app/util/basic-types.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLV.h>
+#include <core/CHIPTLVFixedLayout.h>
 #include <support/CodeUtils.h>
 #include <support/logging/CHIPLogging.h>
 
@@ -43,6 +44,12 @@ enum
     kCsTag_ListIndex  = 4,
 };
 
+/**
+ *  Layout of an AttributePath made of a node, endpoint, cluster and field id, the path of every attribute report.
+ */
+using FieldPathLayout = chip::TLV::FixedLayoutContainer<chip::TLV::kTLVType_List, kCsTag_NodeId, kCsTag_EndpointId,
+                                                        kCsTag_ClusterId, kCsTag_FieldId>;
+
 class Parser : public chip::app::Parser
 {
 public:
@@ -125,6 +132,24 @@ public:
      *          #CHIP_END_OF_TLV if there is no such element
      */
     CHIP_ERROR GetListIndex(chip::ListIndex * const apListIndex) const;
+
+    /**
+     *  @brief Read all the elements of the path in a single walk, instead of one search per Get call.
+     *
+     *  @param [out] apNodeId          A pointer to NodeId
+     *  @param [out] apEndpointId      A pointer to EndpointId
+     *  @param [out] apClusterId       A pointer to ClusterId
+     *  @param [out] apFieldId         A pointer to FieldId
+     *  @param [out] apListIndex       A pointer to ListIndex
+     *  @param [out] apPresenceMask    Bit (1 << kCsTag_*) is set for each element present, missing ones are zeroed
+     *
+     *  @return #CHIP_NO_ERROR on success
+     *          #CHIP_ERROR_WRONG_TLV_TYPE if an element is not any of the defined unsigned integer types
+     *          #CHIP_ERROR_INVALID_TLV_TAG if an element appears twice
+     */
+    CHIP_ERROR DecodeAttributePath(chip::NodeId * const apNodeId, chip::EndpointId * const apEndpointId,
+                                   chip::ClusterId * const apClusterId, chip::FieldId * const apFieldId,
+                                   chip::ListIndex * const apListIndex, uint32_t * const apPresenceMask) const;
 };
 
 class Builder : public chip::app::Builder
@@ -393,6 +393,21 @@ exit:
     return mCommandPathBuilder;
 }
 
+CommandDataElement::Builder & CommandDataElement::Builder::EncodeCommandPath(const chip::EndpointId aEndpointId,
+                                                                             const chip::ClusterId aClusterId,
+                                                                             const chip::CommandId aCommandId)
+{
+    // skip if error has already been set
+    SuccessOrExit(mError);
+
+    mError = CommandPath::EndpointPathLayout::Encode(*mpWriter, chip::TLV::ContextTag(kCsTag_CommandPath), aEndpointId, aClusterId,
+                                                     aCommandId);
+    ChipLogFunctError(mError);
+
+exit:
+    return *this;
+}
+
 StatusElement::Builder & CommandDataElement::Builder::CreateStatusElementBuilder()
 {
     // skip if error has already been set
@@ -406,6 +421,21 @@ exit:
     return mStatusElementBuilder;
 }
 
+CommandDataElement::Builder &
+CommandDataElement::Builder::EncodeStatusElement(const Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
+                                                 const uint32_t aProtocolId, const uint16_t aProtocolCode)
+{
+    // skip if error has already been set
+    SuccessOrExit(mError);
+
+    mError = StatusElement::StatusLayout::Encode(*mpWriter, chip::TLV::ContextTag(kCsTag_StatusElement),
+                                                 static_cast<uint16_t>(aGeneralCode), aProtocolId, aProtocolCode);
+    ChipLogFunctError(mError);
+
+exit:
+    return *this;
+}
+
 CommandDataElement::Builder & CommandDataElement::Builder::EndOfCommandDataElement()
 {
     EndOfContainer();
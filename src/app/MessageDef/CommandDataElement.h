@@ -129,6 +129,15 @@ public:
      */
     CommandPath::Builder & CreateCommandPathBuilder();
 
+    /**
+     *  @brief Inject a CommandPath made of an endpoint, cluster and command id into the TLV stream in one go, in place of
+     *         CreateCommandPathBuilder() and the CommandPath::Builder calls.
+     *
+     *  @return A reference to *this
+     */
+    CommandDataElement::Builder & EncodeCommandPath(const chip::EndpointId aEndpointId, const chip::ClusterId aClusterId,
+                                                    const chip::CommandId aCommandId);
+
     /**
      *  @brief Initialize a StatusElement::Builder for writing into the TLV stream
      *
@@ -136,6 +145,15 @@ public:
      */
     StatusElement::Builder & CreateStatusElementBuilder();
 
+    /**
+     *  @brief Inject a StatusElement into the TLV stream in one go, in place of CreateStatusElementBuilder() and
+     *         StatusElement::Builder::EncodeStatusElement().
+     *
+     *  @return A reference to *this
+     */
+    CommandDataElement::Builder & EncodeStatusElement(const Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
+                                                      const uint32_t aProtocolId, const uint16_t aProtocolCode);
+
     /**
      *  @brief Mark the end of this CommandDataElement
      *
@@ -100,6 +100,42 @@ exit:
     return mCommandDataElementBuilder;
 }
 
+CommandList::Builder & CommandList::Builder::EncodeStatusResponse(const chip::EndpointId aEndpointId,
+                                                                  const chip::ClusterId aClusterId,
+                                                                  const chip::CommandId aCommandId,
+                                                                  const Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
+                                                                  const uint32_t aProtocolId, const uint16_t aProtocolCode)
+{
+    // The control byte and end of the element, the control and tag bytes of the CommandPath and of the StatusElement,
+    // then their fields.
+    uint8_t buf[2 + 2 * 2 + CommandPath::EndpointPathLayout::kMaxEncodedLength + StatusElement::StatusLayout::kMaxEncodedLength];
+    chip::TLV::TLVWriter writer;
+    chip::TLV::TLVType elementType;
+
+    // skip if error has already been set
+    SuccessOrExit(mError);
+
+    writer.Init(buf, sizeof(buf));
+    mError = writer.StartContainer(chip::TLV::AnonymousTag, chip::TLV::kTLVType_Structure, elementType);
+    SuccessOrExit(mError);
+    mError = CommandPath::EndpointPathLayout::Encode(writer, chip::TLV::ContextTag(CommandDataElement::kCsTag_CommandPath),
+                                                     aEndpointId, aClusterId, aCommandId);
+    SuccessOrExit(mError);
+    mError = StatusElement::StatusLayout::Encode(writer, chip::TLV::ContextTag(CommandDataElement::kCsTag_StatusElement),
+                                                 static_cast<uint16_t>(aGeneralCode), aProtocolId, aProtocolCode);
+    SuccessOrExit(mError);
+    mError = writer.EndContainer(elementType);
+    SuccessOrExit(mError);
+
+    // Past the control byte of the anonymous structure, the members and the end of the element.
+    mError = mpWriter->PutPreEncodedContainer(chip::TLV::AnonymousTag, chip::TLV::kTLVType_Structure, buf + 1,
+                                              writer.GetLengthWritten() - 1);
+
+exit:
+    ChipLogFunctError(mError);
+    return *this;
+}
+
 CommandList::Builder & CommandList::Builder::EndOfCommandList()
 {
     EndOfContainer();
@@ -72,6 +72,18 @@ public:
      */
     CommandDataElement::Builder & GetCommandDataElementBuilder() { return mCommandDataElementBuilder; };
 
+    /**
+     *  @brief Inject a CommandDataElement answering the command of an endpoint path with a status into the TLV stream in
+     *         one go, in place of CreateCommandDataElementBuilder(), CommandDataElement::Builder::EncodeCommandPath(),
+     *         CommandDataElement::Builder::EncodeStatusElement() and CommandDataElement::Builder::EndOfCommandDataElement().
+     *
+     *  @return A reference to *this
+     */
+    CommandList::Builder & EncodeStatusResponse(const chip::EndpointId aEndpointId, const chip::ClusterId aClusterId,
+                                                const chip::CommandId aCommandId,
+                                                const Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
+                                                const uint32_t aProtocolId, const uint16_t aProtocolCode);
+
     /**
      *  @brief Mark the end of this CommandList
      *
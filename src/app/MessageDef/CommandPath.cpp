@@ -174,6 +174,15 @@ CHIP_ERROR CommandPath::Parser::GetCommandId(chip::CommandId * const apCommandId
     return GetUnsignedInteger(kCsTag_CommandId, apCommandId);
 }
 
+CHIP_ERROR CommandPath::Parser::DecodeCommandPath(chip::EndpointId * const apEndpointId, chip::GroupId * const apGroupId,
+                                                  chip::ClusterId * const apClusterId, chip::CommandId * const apCommandId,
+                                                  uint32_t * const apPresenceMask) const
+{
+    return DecodeContextFields(*apPresenceMask, UnsignedContextField(kCsTag_EndpointId, apEndpointId),
+                               UnsignedContextField(kCsTag_GroupId, apGroupId), UnsignedContextField(kCsTag_ClusterId, apClusterId),
+                               UnsignedContextField(kCsTag_CommandId, apCommandId));
+}
+
 CHIP_ERROR CommandPath::Builder::_Init(chip::TLV::TLVWriter * const apWriter, const uint64_t aTag)
 {
     mpWriter = apWriter;
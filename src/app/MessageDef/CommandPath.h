@@ -28,6 +28,7 @@
 #include <app/util/basic-types.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLV.h>
+#include <core/CHIPTLVFixedLayout.h>
 #include <support/CodeUtils.h>
 #include <support/logging/CHIPLogging.h>
 
@@ -42,6 +43,12 @@ enum
     kCsTag_CommandId  = 3,
 };
 
+/**
+ *  Layout of a CommandPath made of an endpoint, cluster and command id, the path of every non group command.
+ */
+using EndpointPathLayout =
+    chip::TLV::FixedLayoutContainer<chip::TLV::kTLVType_List, kCsTag_EndpointId, kCsTag_ClusterId, kCsTag_CommandId>;
+
 class Parser : public chip::app::Parser
 {
 public:
@@ -114,6 +121,23 @@ public:
      *          #CHIP_END_OF_TLV if there is no such element
      */
     CHIP_ERROR GetCommandId(chip::CommandId * const apCommandId) const;
+
+    /**
+     *  @brief Read all the elements of the path in a single walk, instead of one search per Get call.
+     *
+     *  @param [out] apEndpointId      A pointer to EndpointId
+     *  @param [out] apGroupId         A pointer to GroupId
+     *  @param [out] apClusterId       A pointer to ClusterId
+     *  @param [out] apCommandId       A pointer to CommandId
+     *  @param [out] apPresenceMask    Bit (1 << kCsTag_*) is set for each element present, missing ones are zeroed
+     *
+     *  @return #CHIP_NO_ERROR on success
+     *          #CHIP_ERROR_WRONG_TLV_TYPE if an element is not any of the defined unsigned integer types
+     *          #CHIP_ERROR_INVALID_TLV_TAG if an element appears twice
+     */
+    CHIP_ERROR DecodeCommandPath(chip::EndpointId * const apEndpointId, chip::GroupId * const apGroupId,
+                                 chip::ClusterId * const apClusterId, chip::CommandId * const apCommandId,
+                                 uint32_t * const apPresenceMask) const;
 };
 
 class Builder : public chip::app::Builder
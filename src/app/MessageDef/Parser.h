@@ -31,6 +31,23 @@
 
 namespace chip {
 namespace app {
+/**
+ *  @brief A context tagged field for Parser::DecodeContextFields: its tag, its TLV type and where to store its value.
+ */
+template <typename T>
+struct ContextField
+{
+    uint8_t mContextTag;
+    chip::TLV::TLVType mTLVType;
+    T * mpValue;
+};
+
+template <typename T>
+ContextField<T> UnsignedContextField(const uint8_t aContextTag, T * const apValue)
+{
+    return { aContextTag, chip::TLV::kTLVType_UnsignedInteger, apValue };
+}
+
 class Parser
 {
 public:
@@ -94,6 +111,77 @@ protected:
 
         return err;
     };
+
+    /**
+     *  @brief Decode several context tagged fields in a single walk over this container, instead of one search per field.
+     *
+     *  Every field is zeroed first. A field that appears twice or with an unexpected type is an error, as in
+     *  CheckSchemaValidity; elements with other tags are skipped for forward compatibility.
+     *
+     *  @param [out] aPresenceMask  Bit (1 << tag) is set for each field found. Tags must be less than 32.
+     *  @param [in]  aFields        The fields, see UnsignedContextField.
+     *
+     *  @return #CHIP_NO_ERROR on success, whether fields are missing or not
+     */
+    template <typename... Fields>
+    CHIP_ERROR DecodeContextFields(uint32_t & aPresenceMask, Fields... aFields) const
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        chip::TLV::TLVReader reader;
+
+        aPresenceMask = 0;
+        ClearContextFields(aFields...);
+
+        reader.Init(mReader);
+        while (CHIP_NO_ERROR == (err = reader.Next()))
+        {
+            if (chip::TLV::IsContextTag(reader.GetTag()))
+            {
+                err = DecodeContextField(reader, chip::TLV::TagNumFromTag(reader.GetTag()), aPresenceMask, aFields...);
+                SuccessOrExit(err);
+            }
+        }
+
+        if (CHIP_END_OF_TLV == err)
+        {
+            err = CHIP_NO_ERROR;
+        }
+
+    exit:
+        ChipLogFunctError(err);
+        return err;
+    }
+
+private:
+    static void ClearContextFields() {}
+
+    template <typename T, typename... Fields>
+    static void ClearContextFields(ContextField<T> aField, Fields... aFields)
+    {
+        *aField.mpValue = 0;
+        ClearContextFields(aFields...);
+    }
+
+    static CHIP_ERROR DecodeContextField(chip::TLV::TLVReader & aReader, uint32_t aTagNum, uint32_t & aPresenceMask)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename T, typename... Fields>
+    static CHIP_ERROR DecodeContextField(chip::TLV::TLVReader & aReader, uint32_t aTagNum, uint32_t & aPresenceMask,
+                                         ContextField<T> aField, Fields... aFields)
+    {
+        if (aTagNum != aField.mContextTag)
+        {
+            return DecodeContextField(aReader, aTagNum, aPresenceMask, aFields...);
+        }
+
+        VerifyOrReturnError(!(aPresenceMask & (1u << aTagNum)), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(aField.mTLVType == aReader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
+        aPresenceMask |= (1u << aTagNum);
+
+        return aReader.Get(*aField.mpValue);
+    }
 };
 }; // namespace app
 }; // namespace chip
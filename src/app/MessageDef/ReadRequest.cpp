@@ -141,6 +141,20 @@ CHIP_ERROR ReadRequest::Parser::CheckSchemaValidity() const
                 SuccessOrExit(err);
                 PRETTY_PRINT("\tEventNumber = 0x%" PRIx64 ",", eventNumber);
             }
+#endif // CHIP_DETAIL_LOGGING
+        }
+        else if (chip::TLV::ContextTag(kCsTag_MinEventPriority) == tag)
+        {
+            VerifyOrExit(!(TagPresenceMask & (1 << kCsTag_MinEventPriority)), err = CHIP_ERROR_INVALID_TLV_TAG);
+            TagPresenceMask |= (1 << kCsTag_MinEventPriority);
+            VerifyOrExit(chip::TLV::kTLVType_UnsignedInteger == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
+#if CHIP_DETAIL_LOGGING
+            {
+                uint8_t minEventPriority;
+                err = reader.Get(minEventPriority);
+                SuccessOrExit(err);
+                PRETTY_PRINT("\tMinEventPriority = %" PRIu8 ",", minEventPriority);
+            }
 #endif // CHIP_DETAIL_LOGGING
         }
     }
@@ -224,6 +238,11 @@ CHIP_ERROR ReadRequest::Parser::GetEventNumber(uint64_t * const apEventNumber) c
     return GetUnsignedInteger(kCsTag_EventNumber, apEventNumber);
 }
 
+CHIP_ERROR ReadRequest::Parser::GetMinEventPriority(uint8_t * const apMinEventPriority) const
+{
+    return GetUnsignedInteger(kCsTag_MinEventPriority, apMinEventPriority);
+}
+
 CHIP_ERROR ReadRequest::Builder::Init(chip::TLV::TLVWriter * const apWriter)
 {
     return InitAnonymousStructure(apWriter);
@@ -280,6 +299,18 @@ exit:
     return *this;
 }
 
+ReadRequest::Builder & ReadRequest::Builder::MinEventPriority(const uint8_t aMinEventPriority)
+{
+    // skip if error has already been set
+    SuccessOrExit(mError);
+
+    mError = mpWriter->Put(chip::TLV::ContextTag(kCsTag_MinEventPriority), aMinEventPriority);
+    ChipLogFunctError(mError);
+
+exit:
+    return *this;
+}
+
 ReadRequest::Builder & ReadRequest::Builder::EndOfReadRequest()
 {
     EndOfContainer();
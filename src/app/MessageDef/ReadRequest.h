@@ -44,6 +44,7 @@ enum
     kCsTag_EventPathList            = 1,
     kCsTag_AttributeDataVersionList = 2,
     kCsTag_EventNumber              = 3,
+    kCsTag_MinEventPriority         = 4,
 };
 
 class Parser : public chip::app::Parser
@@ -113,6 +114,16 @@ public:
      *          #CHIP_END_OF_TLV if there is no such element
      */
     CHIP_ERROR GetEventNumber(uint64_t * const apEventNumber) const;
+
+    /**
+     *  @brief Get the least priority of the events to report. Next() must be called before accessing them.
+     *
+     *  @param [in] apMinEventPriority    A pointer to apMinEventPriority
+     *
+     *  @return #CHIP_NO_ERROR on success
+     *          #CHIP_END_OF_TLV if there is no such element
+     */
+    CHIP_ERROR GetMinEventPriority(uint8_t * const apMinEventPriority) const;
 };
 
 class Builder : public chip::app::Builder
@@ -155,6 +166,15 @@ public:
      *  @return A reference to *this
      */
     ReadRequest::Builder & EventNumber(const uint64_t aEventNumber);
+
+    /**
+     *  @brief An initiator can optionally leave out the events of lesser priority than aMinEventPriority, so that
+     *  a subscriber only interested in alarms is not woken by debug events.
+     *  @param [in] aMinEventPriority The least PriorityLevel of the events to report
+     *  @return A reference to *this
+     */
+    ReadRequest::Builder & MinEventPriority(const uint8_t aMinEventPriority);
+
     /**
      *  @brief Mark the end of this ReadRequest
      *
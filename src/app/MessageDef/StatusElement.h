@@ -29,6 +29,7 @@
 #include <app/util/basic-types.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLV.h>
+#include <core/CHIPTLVFixedLayout.h>
 #include <protocols/secure_channel/Constants.h>
 #include <support/CodeUtils.h>
 #include <support/logging/CHIPLogging.h>
@@ -44,6 +45,13 @@ enum
     kCsTag_ClusterId    = 4
 };
 
+/**
+ *  Layout of a StatusElement made of a general code, protocol id and protocol code, as written by
+ *  Builder::EncodeStatusElement().
+ */
+using StatusLayout = chip::TLV::FixedLayoutContainer<chip::TLV::kTLVType_Array, chip::TLV::kFixedLayoutAnonymousTag,
+                                                     chip::TLV::kFixedLayoutAnonymousTag, chip::TLV::kFixedLayoutAnonymousTag>;
+
 class Parser : public ListParser
 {
 public:
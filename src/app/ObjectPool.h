@@ -0,0 +1,287 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the bounded pool holding the interaction model
+ *      command senders and handlers, read clients and read handlers.
+ *
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <support/CHIPMem.h>
+#include <system/SystemStats.h>
+
+#include <new>
+#include <stddef.h>
+
+namespace chip {
+namespace app {
+
+class ObjectPoolBase;
+
+/**
+ * @class PoolableObject
+ *
+ * @brief Base class of the objects held by an ObjectPool. It carries the free list link, so that an object goes back to its
+ * pool in constant time.
+ */
+class PoolableObject
+{
+protected:
+    /**
+     *  Return the object to the pool it was allocated from. Does nothing if the object is already free, or if it was not
+     *  allocated from a pool.
+     */
+    void ReleaseToPool();
+
+private:
+    friend class ObjectPoolBase;
+
+    ObjectPoolBase * mpPool     = nullptr;
+    PoolableObject * mpNextFree = nullptr;
+    bool mIsFree                = false;
+};
+
+class ObjectPoolBase
+{
+public:
+    /**
+     *  Return an object allocated from this pool.
+     */
+    void Release(PoolableObject * apObject)
+    {
+        if (apObject->mpPool == this && !apObject->mIsFree)
+        {
+            apObject->mIsFree    = true;
+            apObject->mpNextFree = mpFreeList;
+            mpFreeList           = apObject;
+            mNumAllocated--;
+            UpdateStats();
+        }
+    }
+
+    /**
+     *  Number of objects currently allocated.
+     */
+    size_t Allocated() const { return mNumAllocated; }
+
+    /**
+     *  Track the number of objects allocated, from now on, as the given System::Stats resource.
+     */
+    void SetStatsEntry(int aStatsEntry)
+    {
+        mStatsEntry = aStatsEntry;
+        UpdateStats();
+    }
+
+protected:
+    PoolableObject * PopFree()
+    {
+        PoolableObject * object = mpFreeList;
+        if (object != nullptr)
+        {
+            mpFreeList      = object->mpNextFree;
+            object->mIsFree = false;
+            mNumAllocated++;
+            UpdateStats();
+        }
+        return object;
+    }
+
+    /**
+     *  Take a newly created object in, either allocated or on the free list.
+     */
+    void Adopt(PoolableObject * apObject, bool aAllocated)
+    {
+        apObject->mpPool = this;
+        mNumAllocated++;
+        if (!aAllocated)
+        {
+            Release(apObject);
+        }
+        else
+        {
+            UpdateStats();
+        }
+    }
+
+private:
+    void UpdateStats()
+    {
+        if (mStatsEntry >= 0)
+        {
+            SYSTEM_STATS_SET(mStatsEntry, static_cast<chip::System::Stats::count_t>(mNumAllocated));
+        }
+    }
+
+    PoolableObject * mpFreeList = nullptr;
+    size_t mNumAllocated        = 0;
+    int mStatsEntry             = -1;
+};
+
+inline void PoolableObject::ReleaseToPool()
+{
+    if (mpPool != nullptr)
+    {
+        mpPool->Release(this);
+    }
+}
+
+/**
+ * @class ObjectPool
+ *
+ * @brief A pool of at most N objects of type T, a subclass of PoolableObject.
+ *
+ * Objects are not destroyed when they are released: their Shutdown() returns them to the pool and may run more than once, so
+ * a released object stays valid and reports IsFree() until it is handed out again.
+ *
+ * By default the N objects are statically allocated within the pool. With CHIP_CONFIG_IM_OBJECT_POOL_HEAP they are created on
+ * the heap the first time they are needed, so that a large bound only costs memory when it is reached.
+ */
+template <class T, size_t N>
+class ObjectPool : public ObjectPoolBase
+{
+public:
+    ObjectPool()
+    {
+#if !CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+        // Push in reverse so that objects are handed out in index order.
+        for (size_t index = N; index > 0; index--)
+        {
+            Adopt(&mObjects[index - 1], false);
+        }
+#endif // !CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+    }
+
+#if CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+    ~ObjectPool()
+    {
+        for (size_t index = 0; index < mNumCreated; index++)
+        {
+            mObjects[index]->~T();
+            chip::Platform::MemoryFree(mObjects[index]);
+        }
+    }
+#endif // CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+
+    static constexpr size_t Capacity() { return N; }
+
+    /**
+     *  Allocate an object.
+     *
+     *  @retval  nullptr if N objects are already allocated, or if the heap is exhausted.
+     */
+    T * Allocate()
+    {
+        PoolableObject * object = PopFree();
+        if (object != nullptr)
+        {
+            return static_cast<T *>(object);
+        }
+
+#if CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+        if (mNumCreated < N)
+        {
+            void * storage = chip::Platform::MemoryAlloc(sizeof(T));
+            if (storage == nullptr)
+            {
+                return nullptr;
+            }
+
+            T * newObject           = new (storage) T();
+            mObjects[mNumCreated++] = newObject;
+            Adopt(newObject, true);
+            return newObject;
+        }
+#endif // CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+
+        return nullptr;
+    }
+
+    /**
+     *  Number of objects created so far, free or not. Objects are indexed in creation order.
+     */
+    size_t Created() const
+    {
+#if CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+        return mNumCreated;
+#else
+        return N;
+#endif // CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+    }
+
+    /**
+     *  Get the object at aIndex, which must be less than Created().
+     */
+    T * At(size_t aIndex)
+    {
+#if CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+        return mObjects[aIndex];
+#else
+        return &mObjects[aIndex];
+#endif // CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+    }
+
+    const T * At(size_t aIndex) const
+    {
+#if CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+        return mObjects[aIndex];
+#else
+        return &mObjects[aIndex];
+#endif // CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+    }
+
+    /**
+     *  Get the index of an object of this pool, or Created() if the object does not belong to it.
+     */
+    size_t IndexOf(const T * apObject) const
+    {
+        size_t index = 0;
+        while (index < Created() && At(index) != apObject)
+        {
+            index++;
+        }
+        return index;
+    }
+
+    /**
+     *  Run a functor of type `void (T &)` on each object created so far, free or not.
+     */
+    template <typename F>
+    void ForEachObject(F f)
+    {
+        for (size_t index = 0; index < Created(); index++)
+        {
+            f(*At(index));
+        }
+    }
+
+private:
+#if CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+    T * mObjects[N]    = {};
+    size_t mNumCreated = 0;
+#else
+    T mObjects[N];
+#endif // CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,365 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a log saving the events of one priority level to
+ *      persistent storage.
+ *
+ */
+
+#include <app/PersistentEventLog.h>
+
+#include <core/CHIPEncoding.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+uint8_t * PutVarint(uint8_t * p, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *p++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = static_cast<uint8_t>(value);
+    return p;
+}
+
+bool GetVarint(const uint8_t * apData, uint16_t aLength, uint16_t & aOffset, uint64_t & aValue)
+{
+    aValue = 0;
+    for (uint8_t shift = 0; shift < 64 && aOffset < aLength; shift = static_cast<uint8_t>(shift + 7))
+    {
+        const uint8_t byte = apData[aOffset++];
+        aValue |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The timestamps restart from 0 when the device does, so their differences are signed, zigzag encoded.
+uint64_t ZigZagEncode(uint64_t aDelta)
+{
+    return (aDelta << 1) ^ ((aDelta >> 63) != 0 ? UINT64_MAX : 0);
+}
+
+uint64_t ZigZagDecode(uint64_t aValue)
+{
+    return (aValue >> 1) ^ ((aValue & 1) != 0 ? UINT64_MAX : 0);
+}
+
+} // namespace
+
+CHIP_ERROR PersistentEventLog::Init(PersistentStorageDelegate * apStorage, PriorityLevel aPriority)
+{
+    bool saved[kBlockCount] = {};
+    uint16_t offset         = 0;
+
+    VerifyOrReturnError(apStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mpStorage         = apStorage;
+    mPriority         = aPriority;
+    mOldestBlock      = 0;
+    mUsedBlocks       = 0;
+    mBlockLength      = 0;
+    mStagedEvents     = 0;
+    mNewestBlockSaved = false;
+    mLast             = Cursor();
+
+    for (uint8_t block = 0; block < kBlockCount; block++)
+    {
+        uint16_t length = 0;
+
+        saved[block] = (ReadBlock(block, mReadBlock, length) == CHIP_NO_ERROR);
+        if (saved[block])
+        {
+            mFirstEventNumbers[block] = Encoding::LittleEndian::Get64(mReadBlock);
+            if (mUsedBlocks == 0 || mFirstEventNumbers[block] < mFirstEventNumbers[mOldestBlock])
+            {
+                mOldestBlock = block;
+                mUsedBlocks  = 1;
+            }
+        }
+    }
+    VerifyOrReturnError(mUsedBlocks > 0, CHIP_NO_ERROR);
+
+    // The blocks are written in turn, so the saved ones follow the oldest one with growing event numbers.
+    while (mUsedBlocks < kBlockCount)
+    {
+        const uint8_t block = GetBlock(mUsedBlocks);
+        if (!saved[block] || mFirstEventNumbers[block] <= mFirstEventNumbers[GetBlock(static_cast<uint8_t>(mUsedBlocks - 1))])
+        {
+            break;
+        }
+        mUsedBlocks++;
+    }
+
+    // Decode the newest block to go on appending to it, dropping what follows its last valid event.
+    ReturnErrorOnFailure(ReadBlock(GetNewestBlock(), mBlock, mBlockLength));
+    mLast.mEventNumber     = Encoding::LittleEndian::Get64(mBlock);
+    mLast.mSystemTimestamp = Encoding::LittleEndian::Get64(mBlock + sizeof(uint64_t));
+    offset                 = kBlockHeaderSize;
+    while (offset < mBlockLength)
+    {
+        Cursor cursor     = mLast;
+        uint16_t previous = offset;
+
+        if (DecodeEvent(mBlock, mBlockLength, offset, cursor, mLastEvent) != CHIP_NO_ERROR)
+        {
+            ChipLogError(EventLogging, "Dropped the saved events of priority %d past event 0x%" PRIx64, static_cast<int>(mPriority),
+                         mLast.mEventNumber);
+            mBlockLength = previous;
+            break;
+        }
+        mLast = cursor;
+    }
+    mNewestBlockSaved = true;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Append(EventNumber aEventNumber, uint64_t aSystemTimestamp, const uint8_t * apEvent,
+                                      uint16_t aEventLength)
+{
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(apEvent != nullptr || aEventLength == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(IsEmpty() || aEventNumber > mLast.mEventNumber, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(kBlockHeaderSize + kMaxEventOverhead + aEventLength <= kBlockSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    if (IsEmpty() || !EncodeEvent(aEventNumber, aSystemTimestamp, apEvent, aEventLength))
+    {
+        if (!IsEmpty())
+        {
+            ReturnErrorOnFailure(Flush());
+        }
+        StartBlock(aEventNumber, aSystemTimestamp);
+        VerifyOrDie(EncodeEvent(aEventNumber, aSystemTimestamp, apEvent, aEventLength));
+    }
+
+    mStagedEvents++;
+    if (mStagedEvents >= kBatchCount)
+    {
+        return Flush();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Flush()
+{
+    char key[16];
+
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mStagedEvents > 0, CHIP_NO_ERROR);
+
+    GetKey(GetNewestBlock(), key);
+    Encoding::LittleEndian::Put16(mBlock + 2 * sizeof(uint64_t), mBlockLength);
+    ReturnErrorOnFailure(mpStorage->SyncSetKeyValue(key, mBlock, mBlockLength));
+
+    mStagedEvents     = 0;
+    mNewestBlockSaved = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Clear()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    char key[16];
+
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    for (uint8_t age = 0; age < mUsedBlocks; age++)
+    {
+        if (age == mUsedBlocks - 1 && !mNewestBlockSaved)
+        {
+            break;
+        }
+        GetKey(GetBlock(age), key);
+        CHIP_ERROR deleteErr = mpStorage->SyncDeleteKeyValue(key);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = deleteErr;
+        }
+    }
+
+    mOldestBlock      = 0;
+    mUsedBlocks       = 0;
+    mBlockLength      = 0;
+    mStagedEvents     = 0;
+    mNewestBlockSaved = false;
+    mLast             = Cursor();
+    return err;
+}
+
+CHIP_ERROR PersistentEventLog::Iterate(EventNumber aSince, PersistentEventHandler aHandler, void * apContext)
+{
+    uint8_t firstAge = 0;
+
+    VerifyOrReturnError(aHandler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Seek to the block holding the event, from the event numbers each block starts with.
+    while (firstAge + 1 < mUsedBlocks && mFirstEventNumbers[GetBlock(static_cast<uint8_t>(firstAge + 1))] <= aSince)
+    {
+        firstAge++;
+    }
+
+    for (uint8_t age = firstAge; age < mUsedBlocks; age++)
+    {
+        const uint8_t * data = mBlock;
+        uint16_t length      = mBlockLength;
+        uint16_t offset      = kBlockHeaderSize;
+        Cursor cursor;
+
+        if (age != mUsedBlocks - 1)
+        {
+            ReturnErrorOnFailure(ReadBlock(GetBlock(age), mReadBlock, length));
+            data = mReadBlock;
+        }
+
+        cursor.mEventNumber     = Encoding::LittleEndian::Get64(data);
+        cursor.mSystemTimestamp = Encoding::LittleEndian::Get64(data + sizeof(uint64_t));
+        while (offset < length)
+        {
+            ReturnErrorOnFailure(DecodeEvent(data, length, offset, cursor, mReadEvent));
+            if (cursor.mEventNumber >= aSince)
+            {
+                ReturnErrorOnFailure(aHandler(apContext, cursor.mEventNumber, cursor.mSystemTimestamp, mReadEvent,
+                                              cursor.mEventLength));
+            }
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void PersistentEventLog::GetKey(uint8_t aBlock, char (&aKey)[16]) const
+{
+    snprintf(aKey, sizeof(aKey), "%s%u_%u", kPersistentEventLogKeyPrefix, static_cast<unsigned>(mPriority),
+             static_cast<unsigned>(aBlock));
+}
+
+CHIP_ERROR PersistentEventLog::ReadBlock(uint8_t aBlock, uint8_t * apData, uint16_t & aLength)
+{
+    char key[16];
+    uint16_t size = kBlockSize;
+
+    GetKey(aBlock, key);
+    ReturnErrorOnFailure(mpStorage->SyncGetKeyValue(key, apData, size));
+
+    // The block records its length, as the storage may not return the length of the value.  A value cut short keeps the
+    // events before the cut.
+    VerifyOrReturnError(size >= kBlockHeaderSize && size <= kBlockSize, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    aLength = Encoding::LittleEndian::Get16(apData + 2 * sizeof(uint64_t));
+    VerifyOrReturnError(aLength >= kBlockHeaderSize, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    if (aLength > size)
+    {
+        aLength = size;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void PersistentEventLog::StartBlock(EventNumber aEventNumber, uint64_t aSystemTimestamp)
+{
+    if (mUsedBlocks < kBlockCount)
+    {
+        mUsedBlocks++;
+    }
+    else
+    {
+        mOldestBlock = GetBlock(1);
+    }
+
+    mFirstEventNumbers[GetNewestBlock()] = aEventNumber;
+    Encoding::LittleEndian::Put64(mBlock, aEventNumber);
+    Encoding::LittleEndian::Put64(mBlock + sizeof(uint64_t), aSystemTimestamp);
+    mBlockLength           = kBlockHeaderSize;
+    mNewestBlockSaved      = false;
+    mLast.mEventNumber     = aEventNumber;
+    mLast.mSystemTimestamp = aSystemTimestamp;
+    mLast.mEventLength     = 0;
+}
+
+bool PersistentEventLog::EncodeEvent(EventNumber aEventNumber, uint64_t aSystemTimestamp, const uint8_t * apEvent,
+                                     uint16_t aEventLength)
+{
+    uint8_t header[kMaxEventOverhead];
+    uint8_t * p     = header;
+    uint16_t shared = 0;
+    uint16_t headerLength;
+
+    while (shared < aEventLength && shared < mLast.mEventLength && apEvent[shared] == mLastEvent[shared])
+    {
+        shared++;
+    }
+
+    p            = PutVarint(p, aEventNumber - mLast.mEventNumber);
+    p            = PutVarint(p, ZigZagEncode(aSystemTimestamp - mLast.mSystemTimestamp));
+    p            = PutVarint(p, shared);
+    p            = PutVarint(p, static_cast<uint16_t>(aEventLength - shared));
+    headerLength = static_cast<uint16_t>(p - header);
+
+    if (mBlockLength + headerLength + aEventLength - shared > kBlockSize)
+    {
+        return false;
+    }
+
+    memcpy(mBlock + mBlockLength, header, headerLength);
+    memcpy(mBlock + mBlockLength + headerLength, apEvent + shared, aEventLength - shared);
+    mBlockLength = static_cast<uint16_t>(mBlockLength + headerLength + aEventLength - shared);
+
+    memcpy(mLastEvent + shared, apEvent + shared, aEventLength - shared);
+    mLast.mEventNumber     = aEventNumber;
+    mLast.mSystemTimestamp = aSystemTimestamp;
+    mLast.mEventLength     = aEventLength;
+    return true;
+}
+
+CHIP_ERROR PersistentEventLog::DecodeEvent(const uint8_t * apBlock, uint16_t aBlockLength, uint16_t & aOffset, Cursor & aCursor,
+                                           uint8_t * apEvent)
+{
+    uint16_t offset = aOffset;
+    uint64_t numberDelta, timestampDelta, shared, length;
+
+    VerifyOrReturnError(GetVarint(apBlock, aBlockLength, offset, numberDelta), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    VerifyOrReturnError(GetVarint(apBlock, aBlockLength, offset, timestampDelta), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    VerifyOrReturnError(GetVarint(apBlock, aBlockLength, offset, shared), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    VerifyOrReturnError(GetVarint(apBlock, aBlockLength, offset, length), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    VerifyOrReturnError(shared <= aCursor.mEventLength && length <= static_cast<uint64_t>(aBlockLength - offset),
+                        CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    VerifyOrReturnError(shared + length <= kBlockSize, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    memcpy(apEvent + shared, apBlock + offset, static_cast<size_t>(length));
+    aOffset                  = static_cast<uint16_t>(offset + length);
+    aCursor.mEventNumber     = aCursor.mEventNumber + numberDelta;
+    aCursor.mSystemTimestamp = aCursor.mSystemTimestamp + ZigZagDecode(timestampDelta);
+    aCursor.mEventLength     = static_cast<uint16_t>(shared + length);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a log saving the events of one priority level to
+ *      persistent storage, so that they outlive a restart of the device.
+ *
+ */
+
+#pragma once
+
+#include "EventLoggingTypes.h"
+#include <app/util/basic-types.h>
+#include <core/CHIPError.h>
+#include <core/CHIPEventLoggingConfig.h>
+#include <core/CHIPPersistentStorageDelegate.h>
+#include <support/DLLUtil.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+// KVS store is sensitive to length of key strings, based on the underlying
+// platform. Keeping them short.
+constexpr char kPersistentEventLogKeyPrefix[] = "CHIPEv";
+
+/**
+ * Called by PersistentEventLog::Iterate with each event saved, as the TLV event data element it was logged as, with a delta
+ * system timestamp of 0.  An error stops the iteration and is returned by Iterate.
+ */
+using PersistentEventHandler = CHIP_ERROR (*)(void * apContext, EventNumber aEventNumber, uint64_t aSystemTimestamp,
+                                              const uint8_t * apEvent, uint16_t aEventLength);
+
+/**
+ * @class PersistentEventLog
+ *
+ * @brief
+ *   Saves the events of one priority level to a persistent storage delegate, in a ring of
+ *   CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_COUNT values of CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_SIZE bytes.  The events
+ *   are staged in the newest block, which is written once it is full or CHIP_CONFIG_EVENT_LOGGING_PERSIST_BATCH_EVENTS
+ *   events are staged, and the oldest block is overwritten once all of them are full.
+ *
+ *   Each block starts with its length and the number and system timestamp of its first event.  Each event then takes the
+ *   difference of its number and timestamp to those of the event before it, as varints, and the bytes it shares with the
+ *   start of the event before it, which events of the same cluster mostly do, are left out.  The event numbers must grow,
+ *   including across restarts, so the priority level should use a persisted event counter.
+ */
+class DLL_EXPORT PersistentEventLog
+{
+public:
+    static constexpr uint16_t kBlockSize  = CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_SIZE;
+    static constexpr uint8_t kBlockCount  = CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_COUNT;
+    static constexpr uint16_t kBatchCount = CHIP_CONFIG_EVENT_LOGGING_PERSIST_BATCH_EVENTS;
+
+    /**
+     * Load the blocks saved for a priority level, so that new events are added after them and the saved events can be read.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * apStorage, PriorityLevel aPriority);
+
+    /**
+     * Stage an event, writing the newest block if the event does not fit in it or enough events are staged.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT If the event number is not past the last one saved.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL If the event does not fit in a block.
+     */
+    CHIP_ERROR Append(EventNumber aEventNumber, uint64_t aSystemTimestamp, const uint8_t * apEvent, uint16_t aEventLength);
+
+    /**
+     * Write the newest block if events are staged in it.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * Forget all the events, deleting the blocks saved.
+     */
+    CHIP_ERROR Clear();
+
+    /**
+     * Call a handler with each event saved or staged from the given event number on, in order.  Only the blocks holding
+     * these events are read.
+     */
+    CHIP_ERROR Iterate(EventNumber aSince, PersistentEventHandler aHandler, void * apContext);
+
+    bool IsEmpty() const { return mUsedBlocks == 0; }
+    EventNumber GetFirstEventNumber() const { return IsEmpty() ? 0 : mFirstEventNumbers[mOldestBlock]; }
+    EventNumber GetLastEventNumber() const { return mLast.mEventNumber; }
+    uint16_t GetStagedEventCount() const { return mStagedEvents; }
+
+private:
+    /**
+     * The event decoded last from a block, whose data the next event shares its first bytes with.
+     */
+    struct Cursor
+    {
+        EventNumber mEventNumber  = 0;
+        uint64_t mSystemTimestamp = 0;
+        uint16_t mEventLength     = 0;
+    };
+
+    // The number and timestamp of the first event, and the length of the block.
+    static constexpr uint16_t kBlockHeaderSize  = 2 * sizeof(uint64_t) + sizeof(uint16_t);
+    // The varints of the number and timestamp deltas, and of the lengths of the bytes shared and not.
+    static constexpr uint16_t kMaxEventOverhead = 2 * 10 + 2 * 3;
+
+    uint8_t GetBlock(uint8_t aAge) const { return static_cast<uint8_t>((mOldestBlock + aAge) % kBlockCount); }
+    uint8_t GetNewestBlock() const { return GetBlock(static_cast<uint8_t>(mUsedBlocks - 1)); }
+    void GetKey(uint8_t aBlock, char (&aKey)[16]) const;
+    CHIP_ERROR ReadBlock(uint8_t aBlock, uint8_t * apData, uint16_t & aLength);
+    void StartBlock(EventNumber aEventNumber, uint64_t aSystemTimestamp);
+    bool EncodeEvent(EventNumber aEventNumber, uint64_t aSystemTimestamp, const uint8_t * apEvent, uint16_t aEventLength);
+
+    static CHIP_ERROR DecodeEvent(const uint8_t * apBlock, uint16_t aBlockLength, uint16_t & aOffset, Cursor & aCursor,
+                                  uint8_t * apEvent);
+
+    PersistentStorageDelegate * mpStorage = nullptr;
+    PriorityLevel mPriority               = PriorityLevel::Invalid;
+
+    EventNumber mFirstEventNumbers[kBlockCount] = {};
+    uint8_t mOldestBlock                        = 0;
+    uint8_t mUsedBlocks                         = 0;
+
+    // The newest block, and its last event, which the next event appended is encoded against.
+    uint8_t mBlock[kBlockSize];
+    uint16_t mBlockLength  = 0;
+    uint16_t mStagedEvents = 0;
+    bool mNewestBlockSaved = false;
+    Cursor mLast;
+    uint8_t mLastEvent[kBlockSize];
+
+    // A saved block and its event, when iterating.
+    uint8_t mReadBlock[kBlockSize];
+    uint8_t mReadEvent[kBlockSize];
+};
+
+} // namespace app
+} // namespace chip
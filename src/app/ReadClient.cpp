@@ -24,6 +24,7 @@
 
 #include <app/InteractionModelEngine.h>
 #include <app/ReadClient.h>
+#include <protocols/secure_channel/StatusReport.h>
 
 namespace chip {
 namespace app {
@@ -38,8 +39,10 @@ CHIP_ERROR ReadClient::Init(Messaging::ExchangeManager * apExchangeMgr, Interact
 
     mpExchangeMgr = apExchangeMgr;
     mpExchangeCtx = nullptr;
-    mpDelegate    = apDelegate;
-    mState        = ClientState::Initialized;
+    mpDelegate      = apDelegate;
+    mState          = ClientState::Initialized;
+    mIsSubscription = false;
+    ClearDataVersions();
 
 exit:
     ChipLogFunctError(err);
@@ -52,6 +55,7 @@ void ReadClient::Shutdown()
     mpExchangeMgr = nullptr;
     mpDelegate    = nullptr;
     MoveToState(ClientState::Uninitialized);
+    ReleaseToPool();
 }
 
 const char * ReadClient::GetStateStr() const
@@ -65,6 +69,8 @@ const char * ReadClient::GetStateStr() const
         return "INIT";
     case ClientState::AwaitingResponse:
         return "AwaitingResponse";
+    case ClientState::Subscribed:
+        return "Subscribed";
     }
 #endif // CHIP_DETAIL_LOGGING
     return "N/A";
@@ -80,6 +86,23 @@ void ReadClient::MoveToState(const ClientState aTargetState)
 CHIP_ERROR ReadClient::SendReadRequest(NodeId aNodeId, Transport::AdminId aAdminId, EventPathParams * apEventPathParamsList,
                                        size_t aEventPathParamsListSize, AttributePathParams * apAttributePathParamsList,
                                        size_t aAttributePathParamsListSize)
+{
+    return SendRequest(Protocols::InteractionModel::MsgType::ReadRequest, aNodeId, aAdminId, apEventPathParamsList,
+                       aEventPathParamsListSize, apAttributePathParamsList, aAttributePathParamsListSize, PriorityLevel::First);
+}
+
+CHIP_ERROR ReadClient::SendSubscribeRequest(NodeId aNodeId, Transport::AdminId aAdminId, EventPathParams * apEventPathParamsList,
+                                            size_t aEventPathParamsListSize, AttributePathParams * apAttributePathParamsList,
+                                            size_t aAttributePathParamsListSize, PriorityLevel aMinEventPriority)
+{
+    return SendRequest(Protocols::InteractionModel::MsgType::SubscribeRequest, aNodeId, aAdminId, apEventPathParamsList,
+                       aEventPathParamsListSize, apAttributePathParamsList, aAttributePathParamsListSize, aMinEventPriority);
+}
+
+CHIP_ERROR ReadClient::SendRequest(Protocols::InteractionModel::MsgType aMsgType, NodeId aNodeId, Transport::AdminId aAdminId,
+                                   EventPathParams * apEventPathParamsList, size_t aEventPathParamsListSize,
+                                   AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize,
+                                   PriorityLevel aMinEventPriority)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferHandle msgBuf;
@@ -101,36 +124,80 @@ CHIP_ERROR ReadClient::SendReadRequest(NodeId aNodeId, Transport::AdminId aAdmin
         err = request.Init(&writer);
         SuccessOrExit(err);
 
-        if (aEventPathParamsListSize != 0 && apEventPathParamsList != nullptr)
-        {
-            // TODO: fill to construct event paths
-        }
-
         if (aAttributePathParamsListSize != 0 && apAttributePathParamsList != nullptr)
         {
             AttributePathList::Builder attributePathListBuilder = request.CreateAttributePathListBuilder();
             SuccessOrExit(attributePathListBuilder.GetError());
             for (size_t index = 0; index < aAttributePathParamsListSize; index++)
             {
+                const AttributePathParams & path            = apAttributePathParamsList[index];
                 AttributePath::Builder attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
-                attributePathBuilder.NodeId(apAttributePathParamsList[index].mNodeId)
-                    .EndpointId(apAttributePathParamsList[index].mEndpointId)
-                    .ClusterId(apAttributePathParamsList[index].mClusterId);
-                if (apAttributePathParamsList[index].mFlags == AttributePathFlags::kFieldIdValid)
+                attributePathBuilder.NodeId(path.mNodeId);
+                // The ids a wildcard path covers every value of are left out.
+                if (!path.mFlags.Has(AttributePathFlags::kEndpointIdWildcard))
+                {
+                    attributePathBuilder.EndpointId(path.mEndpointId);
+                }
+                if (!path.mFlags.Has(AttributePathFlags::kClusterIdWildcard))
+                {
+                    attributePathBuilder.ClusterId(path.mClusterId);
+                }
+                if (path.mFlags.Has(AttributePathFlags::kFieldIdValid))
                 {
-                    attributePathBuilder.FieldId(apAttributePathParamsList[index].mFieldId);
+                    attributePathBuilder.FieldId(path.mFieldId);
                 }
-                else if (apAttributePathParamsList[index].mFlags == AttributePathFlags::kListIndexValid)
+                else if (path.mFlags.Has(AttributePathFlags::kListIndexValid))
                 {
-                    attributePathBuilder.ListIndex(apAttributePathParamsList[index].mListIndex);
+                    attributePathBuilder.ListIndex(path.mListIndex);
                 }
-                else
+                else if (!path.mFlags.Has(AttributePathFlags::kFieldIdWildcard))
                 {
                     err = CHIP_ERROR_INVALID_ARGUMENT;
                     ExitNow();
                 }
+                attributePathBuilder.EndOfAttributePath();
                 SuccessOrExit(attributePathBuilder.GetError());
             }
+            attributePathListBuilder.EndOfAttributePathList();
+            SuccessOrExit(attributePathListBuilder.GetError());
+
+            err = EncodeDataVersionList(request, aNodeId, apAttributePathParamsList, aAttributePathParamsListSize);
+            SuccessOrExit(err);
+        }
+
+        if (aEventPathParamsListSize != 0 && apEventPathParamsList != nullptr)
+        {
+            EventPathList::Builder eventPathListBuilder = request.CreateEventPathListBuilder();
+            SuccessOrExit(err = eventPathListBuilder.GetError());
+            for (size_t index = 0; index < aEventPathParamsListSize; index++)
+            {
+                const EventPathParams & path        = apEventPathParamsList[index];
+                EventPath::Builder eventPathBuilder = eventPathListBuilder.CreateEventPathBuilder();
+                eventPathBuilder.NodeId(path.mNodeId);
+                // The ids a wildcard path covers every value of are left out.
+                if (!path.mFlags.Has(EventPathFlags::kEndpointIdWildcard))
+                {
+                    eventPathBuilder.EndpointId(path.mEndpointId);
+                }
+                if (!path.mFlags.Has(EventPathFlags::kClusterIdWildcard))
+                {
+                    eventPathBuilder.ClusterId(path.mClusterId);
+                }
+                if (!path.mFlags.Has(EventPathFlags::kEventIdWildcard))
+                {
+                    eventPathBuilder.EventId(path.mEventId);
+                }
+                eventPathBuilder.EndOfEventPath();
+                SuccessOrExit(err = eventPathBuilder.GetError());
+            }
+            eventPathListBuilder.EndOfEventPathList();
+            SuccessOrExit(err = eventPathListBuilder.GetError());
+        }
+
+        // Leaving the priority out reports the events of every priority.
+        if (aMinEventPriority != PriorityLevel::First)
+        {
+            request.MinEventPriority(static_cast<uint8_t>(aMinEventPriority));
         }
         request.EndOfReadRequest();
         SuccessOrExit(request.GetError());
@@ -143,30 +210,61 @@ CHIP_ERROR ReadClient::SendReadRequest(NodeId aNodeId, Transport::AdminId aAdmin
     VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_NO_MEMORY);
     mpExchangeCtx->SetResponseTimeout(kImMessageTimeoutMsec);
 
-    err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReadRequest, std::move(msgBuf),
+    err = mpExchangeCtx->SendMessage(aMsgType, std::move(msgBuf),
                                      Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse));
     SuccessOrExit(err);
+    mIsSubscription = (aMsgType == Protocols::InteractionModel::MsgType::SubscribeRequest);
+    mPeerNodeId     = aNodeId;
     MoveToState(ClientState::AwaitingResponse);
 
 exit:
     ChipLogFunctError(err);
+    if (err != CHIP_NO_ERROR)
+    {
+        CommitDataVersions(false);
+    }
     return err;
 }
 
 void ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
                                    const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    bool moreChunkedMessages = false;
     VerifyOrExit(aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::ReportData),
                  err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
     VerifyOrExit(apExchangeContext == mpExchangeCtx, err = CHIP_ERROR_INCORRECT_STATE);
-    err = ProcessReportData(std::move(aPayload));
+    err = ProcessReportData(std::move(aPayload), moreChunkedMessages);
+    SuccessOrExit(err);
+    if (!moreChunkedMessages)
+    {
+        // The report is complete: the client now has the data of the versions it carried.
+        CommitDataVersions(true);
+    }
+
+    if (moreChunkedMessages || mIsSubscription)
+    {
+        // Acknowledge the chunk and keep the exchange for the next one. A subscription keeps the exchange for the reports
+        // that follow the last chunk too.
+        MoveToState(moreChunkedMessages ? ClientState::AwaitingResponse : ClientState::Subscribed);
+        err = SendStatusReport(Protocols::SecureChannel::GeneralStatusCode::kSuccess);
+        SuccessOrExit(err);
+        if (IsSubscribed() && mpDelegate != nullptr)
+        {
+            mpDelegate->ReportProcessed(this);
+        }
+        return;
+    }
 
 exit:
     ChipLogFunctError(err);
 
     ClearExistingExchangeContext();
     MoveToState(ClientState::Initialized);
+    if (err != CHIP_NO_ERROR)
+    {
+        CommitDataVersions(false);
+    }
     if (mpDelegate != nullptr)
     {
         if (err != CHIP_NO_ERROR)
@@ -193,7 +291,30 @@ CHIP_ERROR ReadClient::ClearExistingExchangeContext()
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle aPayload)
+CHIP_ERROR ReadClient::SendStatusReport(Protocols::SecureChannel::GeneralStatusCode aGeneralCode)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Protocols::SecureChannel::StatusReport report(aGeneralCode, Protocols::InteractionModel::Id.ToFullyQualifiedSpecForm(), 0);
+    size_t msgSize = report.Size();
+    Encoding::LittleEndian::PacketBufferWriter bbuf(MessagePacketBuffer::New(msgSize), msgSize);
+    System::PacketBufferHandle msgBuf;
+
+    VerifyOrExit(!bbuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    report.WriteToBuffer(bbuf);
+    msgBuf = bbuf.Finalize();
+    VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+
+    // The next report of a subscription waits for a change or an event, which may take any time.
+    mpExchangeCtx->SetResponseTimeout(IsSubscribed() ? 0 : kImMessageTimeoutMsec);
+    err = mpExchangeCtx->SendMessage(Protocols::SecureChannel::MsgType::StatusReport, std::move(msgBuf),
+                                     Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse));
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle aPayload, bool & aMoreChunkedMessages)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     ReportData::Parser report;
@@ -201,7 +322,6 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle aPayload)
     bool isEventListPresent         = false;
     bool isAttributeDataListPresent = false;
     bool suppressResponse           = false;
-    bool moreChunkedMessages        = false;
     EventList::Parser eventList;
     AttributeDataList::Parser attributeDataList;
     System::PacketBufferTLVReader reader;
@@ -224,7 +344,8 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle aPayload)
     }
     SuccessOrExit(err);
 
-    err = report.GetMoreChunkedMessages(&moreChunkedMessages);
+    aMoreChunkedMessages = false;
+    err                  = report.GetMoreChunkedMessages(&aMoreChunkedMessages);
     if (CHIP_END_OF_TLV == err)
     {
         err = CHIP_NO_ERROR;
@@ -254,7 +375,7 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle aPayload)
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
-    if (isAttributeDataListPresent && nullptr != mpDelegate && !moreChunkedMessages)
+    if (isAttributeDataListPresent && nullptr != mpDelegate)
     {
         chip::TLV::TLVReader attributeDataListReader;
         attributeDataList.GetReader(&attributeDataListReader);
@@ -279,12 +400,141 @@ void ReadClient::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContex
                     apExchangeContext->GetExchangeId());
     ClearExistingExchangeContext();
     MoveToState(ClientState::Initialized);
+    CommitDataVersions(false);
     if (nullptr != mpDelegate)
     {
         mpDelegate->ReportError(this, CHIP_ERROR_TIMEOUT);
     }
 }
 
+CHIP_ERROR ReadClient::GetAttributeDataVersion(DataVersion & aDataVersion) const
+{
+    VerifyOrReturnError(mHasAttributeDataVersion, CHIP_ERROR_KEY_NOT_FOUND);
+    aDataVersion = mAttributeDataVersion;
+    return CHIP_NO_ERROR;
+}
+
+void ReadClient::ClearDataVersions()
+{
+    for (auto & entry : mDataVersions)
+    {
+        entry = DataVersionEntry();
+    }
+}
+
+ReadClient::DataVersionEntry * ReadClient::FindDataVersion(NodeId aPeerNodeId, const AttributePathParams & aPath, bool aAllocate)
+{
+    DataVersionEntry * freeEntry = nullptr;
+    const bool fieldIdWildcard   = aPath.mFlags.Has(AttributePathFlags::kFieldIdWildcard);
+
+    // A version is only of a single cluster, and is kept for the paths of a single attribute or of a whole cluster.
+    if (aPath.mFlags.HasAny(AttributePathFlags::kEndpointIdWildcard, AttributePathFlags::kClusterIdWildcard) ||
+        !(fieldIdWildcard || aPath.mFlags.Has(AttributePathFlags::kFieldIdValid)))
+    {
+        return nullptr;
+    }
+
+    for (auto & entry : mDataVersions)
+    {
+        if (!entry.mInUse)
+        {
+            freeEntry = (freeEntry == nullptr) ? &entry : freeEntry;
+        }
+        else if (entry.mPeerNodeId == aPeerNodeId && entry.mEndpointId == aPath.mEndpointId &&
+                 entry.mClusterId == aPath.mClusterId && entry.mFieldIdWildcard == fieldIdWildcard &&
+                 (fieldIdWildcard || entry.mFieldId == aPath.mFieldId))
+        {
+            return &entry;
+        }
+    }
+
+    VerifyOrReturnError(aAllocate && freeEntry != nullptr, nullptr);
+    *freeEntry                  = DataVersionEntry();
+    freeEntry->mInUse           = true;
+    freeEntry->mPeerNodeId      = aPeerNodeId;
+    freeEntry->mEndpointId      = aPath.mEndpointId;
+    freeEntry->mClusterId       = aPath.mClusterId;
+    freeEntry->mFieldId         = aPath.mFieldId;
+    freeEntry->mFieldIdWildcard = fieldIdWildcard;
+    return freeEntry;
+}
+
+CHIP_ERROR ReadClient::EncodeDataVersionList(ReadRequest::Builder & aRequest, NodeId aPeerNodeId,
+                                             const AttributePathParams * apAttributePathParamsList,
+                                             size_t aAttributePathParamsListSize)
+{
+    bool hasVersion = false;
+
+    for (auto & entry : mDataVersions)
+    {
+        entry.mInRequest         = false;
+        entry.mHasPendingVersion = false;
+    }
+    for (size_t index = 0; index < aAttributePathParamsListSize; index++)
+    {
+        DataVersionEntry * entry = FindDataVersion(aPeerNodeId, apAttributePathParamsList[index], true);
+        if (entry != nullptr)
+        {
+            entry->mInRequest = true;
+            hasVersion        = hasVersion || entry->mHasVersion;
+        }
+    }
+
+    // The list is left out when it would hold nulls only, as in the first request for the paths.
+    VerifyOrReturnError(hasVersion, CHIP_NO_ERROR);
+
+    AttributeDataVersionList::Builder & dataVersionListBuilder = aRequest.CreateAttributeDataVersionListBuilder();
+    ReturnErrorOnFailure(dataVersionListBuilder.GetError());
+    for (size_t index = 0; index < aAttributePathParamsListSize; index++)
+    {
+        const DataVersionEntry * entry = FindDataVersion(aPeerNodeId, apAttributePathParamsList[index], false);
+        if (entry != nullptr && entry->mHasVersion)
+        {
+            dataVersionListBuilder.AddVersion(entry->mVersion);
+        }
+        else
+        {
+            dataVersionListBuilder.AddNull();
+        }
+    }
+    dataVersionListBuilder.EndOfAttributeDataVersionList();
+    return dataVersionListBuilder.GetError();
+}
+
+void ReadClient::UpdatePendingDataVersion(const AttributePathParams & aPath, DataVersion aDataVersion)
+{
+    // Version 0 is that of a cluster the peer keeps no version of.
+    VerifyOrReturn(aDataVersion != 0);
+
+    for (auto & entry : mDataVersions)
+    {
+        if (entry.mInRequest && entry.mPeerNodeId == mPeerNodeId && entry.mEndpointId == aPath.mEndpointId &&
+            entry.mClusterId == aPath.mClusterId && (entry.mFieldIdWildcard || entry.mFieldId == aPath.mFieldId))
+        {
+            // The attributes of a cluster reported over several chunks may carry several versions, if it changed in
+            // between: the oldest is the one the client has all of the data of.
+            if (!entry.mHasPendingVersion || aDataVersion < entry.mPendingVersion)
+            {
+                entry.mPendingVersion = aDataVersion;
+            }
+            entry.mHasPendingVersion = true;
+        }
+    }
+}
+
+void ReadClient::CommitDataVersions(bool aCommit)
+{
+    for (auto & entry : mDataVersions)
+    {
+        if (aCommit && entry.mHasPendingVersion)
+        {
+            entry.mVersion    = entry.mPendingVersion;
+            entry.mHasVersion = true;
+        }
+        entry.mHasPendingVersion = false;
+    }
+}
+
 CHIP_ERROR ReadClient::ProcessAttributeDataList(TLV::TLVReader & aAttributeDataListReader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -294,38 +544,47 @@ CHIP_ERROR ReadClient::ProcessAttributeDataList(TLV::TLVReader & aAttributeDataL
         AttributeDataElement::Parser element;
         AttributePath::Parser attributePathParser;
         AttributePathParams attributePathParams;
-        TLV::TLVReader reader = aAttributeDataListReader;
-        err                   = element.Init(reader);
+        uint32_t presenceMask       = 0;
+        const uint32_t requiredMask = (1u << AttributePath::kCsTag_NodeId) | (1u << AttributePath::kCsTag_EndpointId) |
+            (1u << AttributePath::kCsTag_ClusterId);
+        TLV::TLVReader reader       = aAttributeDataListReader;
+        err                         = element.Init(reader);
         SuccessOrExit(err);
 
         err = element.GetAttributePath(&attributePathParser);
         SuccessOrExit(err);
 
-        err = attributePathParser.GetNodeId(&(attributePathParams.mNodeId));
-        SuccessOrExit(err);
-
-        err = attributePathParser.GetEndpointId(&(attributePathParams.mEndpointId));
-        SuccessOrExit(err);
-
-        err = attributePathParser.GetClusterId(&(attributePathParams.mClusterId));
+        err = attributePathParser.DecodeAttributePath(&(attributePathParams.mNodeId), &(attributePathParams.mEndpointId),
+                                                      &(attributePathParams.mClusterId), &(attributePathParams.mFieldId),
+                                                      &(attributePathParams.mListIndex), &presenceMask);
         SuccessOrExit(err);
+        VerifyOrExit((presenceMask & requiredMask) == requiredMask, err = CHIP_END_OF_TLV);
 
-        err = attributePathParser.GetFieldId(&(attributePathParams.mFieldId));
-        if (CHIP_NO_ERROR == err)
+        if (presenceMask & (1u << AttributePath::kCsTag_FieldId))
         {
             attributePathParams.mFlags = AttributePathFlags::kFieldIdValid;
         }
-        else if (CHIP_END_OF_TLV == err)
+        else
         {
-            err = attributePathParser.GetListIndex(&(attributePathParams.mListIndex));
-            SuccessOrExit(err);
+            VerifyOrExit(presenceMask & (1u << AttributePath::kCsTag_ListIndex), err = CHIP_END_OF_TLV);
             attributePathParams.mFlags = AttributePathFlags::kListIndexValid;
         }
-        SuccessOrExit(err);
 
         err = element.GetData(&dataReader);
         SuccessOrExit(err);
-        err = WriteSingleClusterData(attributePathParams, dataReader);
+
+        // The data version is optional.
+        mHasAttributeDataVersion = (element.GetDataVersion(&mAttributeDataVersion) == CHIP_NO_ERROR);
+        if (mHasAttributeDataVersion)
+        {
+            UpdatePendingDataVersion(attributePathParams, mAttributeDataVersion);
+        }
+        err                      = mpDelegate->AttributeDataReceived(this, attributePathParams, dataReader);
+        mHasAttributeDataVersion = false;
+        if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+        {
+            err = WriteSingleClusterData(attributePathParams, dataReader);
+        }
         SuccessOrExit(err);
     }
 
@@ -25,15 +25,19 @@
 #pragma once
 
 #include <app/AttributePathParams.h>
+#include <app/EventLoggingTypes.h>
 #include <app/EventPathParams.h>
 #include <app/InteractionModelDelegate.h>
 #include <app/MessageDef/ReadRequest.h>
+#include <app/ObjectPool.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLVDebug.hpp>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
+#include <protocols/interaction_model/Constants.h>
+#include <protocols/secure_channel/Constants.h>
 #include <support/CodeUtils.h>
 #include <support/DLLUtil.h>
 #include <support/logging/CHIPLogging.h>
@@ -48,7 +52,7 @@ namespace app {
  *  for generating one Read Request for a particular set of attributes and/or events, and handling the Report Data response.
  *
  */
-class ReadClient : public Messaging::ExchangeDelegate
+class ReadClient : public PoolableObject, public Messaging::ExchangeDelegate
 {
 public:
     /**
@@ -79,17 +83,63 @@ public:
                                size_t aEventPathParamsListSize, AttributePathParams * apAttributePathParamsList,
                                size_t aAttributePathParamsListSize);
 
+    /**
+     *  Send a Subscribe Request, encoded as a Read Request for the same paths. The reports of the subscription keep coming
+     *  on the exchange, each acknowledged and then passed to InteractionModelDelegate::ReportProcessed, until
+     *  InteractionModelDelegate::ReportError is called or the ReadClient is shut down.
+     *
+     *  @param[in]    aNodeId    Node Id
+     *  @param[in]    aAdminId   Admin ID
+     *  @param[in]    apEventPathParamsList       a list of event paths the read client is interested in
+     *  @param[in]    aEventPathParamsListSize    Number of event paths in apEventPathParamsList
+     *  @param[in]    apAttributePathParamsList       a list of attribute paths the read client is interested in
+     *  @param[in]    aAttributePathParamsListSize    Number of attribute paths in apAttributePathParamsList
+     *  @param[in]    aMinEventPriority    The least priority of the events to report
+     *  @retval #others fail to send subscribe request
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR SendSubscribeRequest(NodeId aNodeId, Transport::AdminId aAdminId, EventPathParams * apEventPathParamsList,
+                                    size_t aEventPathParamsListSize, AttributePathParams * apAttributePathParamsList,
+                                    size_t aAttributePathParamsListSize, PriorityLevel aMinEventPriority = PriorityLevel::First);
+
+    bool IsSubscribed() const { return mState == ClientState::Subscribed; }
+
+    /**
+     *  Get the data version of the attribute data being passed to InteractionModelDelegate::AttributeDataReceived.
+     *  Only valid during that call.
+     *
+     *  @retval #CHIP_ERROR_KEY_NOT_FOUND if the attribute data has no data version
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR GetAttributeDataVersion(DataVersion & aDataVersion) const;
+
+    /**
+     *  Forget the data versions of the paths this client has read, for its next request to have every path reported in
+     *  full. The versions are kept from the reports a client gets, so that reading or subscribing to the same paths again
+     *  leaves out the clusters which have not changed since: a delegate which does not keep the data it was given calls
+     *  this before such a request.
+     */
+    void ClearDataVersions();
+
 private:
     friend class TestReadInteraction;
     friend class InteractionModelEngine;
+    template <class T, size_t N>
+    friend class ObjectPool;
 
     enum class ClientState
     {
         Uninitialized = 0, //< The client has not been initialized
         Initialized,       //< The client has been initialized and is ready for a SendReadRequest
         AwaitingResponse,  //< The client has sent out the read request message
+        Subscribed,        //< The client has acknowledged the last report of its subscription and waits for the next
     };
 
+    CHIP_ERROR SendRequest(Protocols::InteractionModel::MsgType aMsgType, NodeId aNodeId, Transport::AdminId aAdminId,
+                           EventPathParams * apEventPathParamsList, size_t aEventPathParamsListSize,
+                           AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize,
+                           PriorityLevel aMinEventPriority);
+
     /**
      *  Initialize the client object. Within the lifetime
      *  of this instance, this method is invoked once after object
@@ -119,8 +169,35 @@ private:
 
     CHIP_ERROR ProcessAttributeDataList(TLV::TLVReader & aAttributeDataListReader);
 
+    /**
+     *  The data version the client has of a concrete endpoint and cluster of a peer, for a single attribute or for every
+     *  attribute of the cluster.
+     */
+    struct DataVersionEntry
+    {
+        NodeId mPeerNodeId          = kUndefinedNodeId;
+        EndpointId mEndpointId      = 0;
+        ClusterId mClusterId        = 0;
+        FieldId mFieldId            = 0;
+        bool mFieldIdWildcard       = false;
+        bool mInUse                 = false;
+        bool mHasVersion            = false;
+        bool mInRequest             = false;
+        bool mHasPendingVersion     = false;
+        DataVersion mVersion        = 0;
+        DataVersion mPendingVersion = 0;
+    };
+
+    DataVersionEntry * FindDataVersion(NodeId aPeerNodeId, const AttributePathParams & aPath, bool aAllocate);
+    CHIP_ERROR EncodeDataVersionList(ReadRequest::Builder & aRequest, NodeId aPeerNodeId,
+                                     const AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize);
+    void UpdatePendingDataVersion(const AttributePathParams & aPath, DataVersion aDataVersion);
+    // Keep the versions of the report just processed in full, or drop them after an error.
+    void CommitDataVersions(bool aCommit);
+
     void MoveToState(const ClientState aTargetState);
-    CHIP_ERROR ProcessReportData(System::PacketBufferHandle aPayload);
+    CHIP_ERROR ProcessReportData(System::PacketBufferHandle aPayload, bool & aMoreChunkedMessages);
+    CHIP_ERROR SendStatusReport(Protocols::SecureChannel::GeneralStatusCode aGeneralCode);
     CHIP_ERROR ClearExistingExchangeContext();
     const char * GetStateStr() const;
 
@@ -128,6 +205,11 @@ private:
     Messaging::ExchangeContext * mpExchangeCtx = nullptr;
     InteractionModelDelegate * mpDelegate      = nullptr;
     ClientState mState                         = ClientState::Uninitialized;
+    DataVersion mAttributeDataVersion          = 0;
+    bool mHasAttributeDataVersion              = false;
+    bool mIsSubscription                       = false;
+    NodeId mPeerNodeId                         = kUndefinedNodeId;
+    DataVersionEntry mDataVersions[CHIP_CONFIG_IM_DATA_VERSIONS_PER_READ_CLIENT];
 };
 
 }; // namespace app
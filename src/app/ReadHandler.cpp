@@ -22,10 +22,12 @@
  *
  */
 
+#include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/EventPath.h>
 #include <app/ReadHandler.h>
 #include <app/reporting/Engine.h>
+#include <protocols/secure_channel/StatusReport.h>
 
 namespace chip {
 namespace app {
@@ -35,11 +37,24 @@ CHIP_ERROR ReadHandler::Init(InteractionModelDelegate * apDelegate)
     // Error if already initialized.
     VerifyOrExit(apDelegate != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(mpExchangeCtx == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
-    mpExchangeCtx     = nullptr;
-    mpDelegate        = apDelegate;
-    mSuppressResponse = true;
-    mGetToAllEvents   = true;
-    mpClusterInfoList = nullptr;
+    mpExchangeCtx        = nullptr;
+    mpDelegate           = apDelegate;
+    mSuppressResponse    = true;
+    mGetToAllEvents      = true;
+    mpClusterInfoList    = nullptr;
+    mpChunkCursor        = nullptr;
+    mMinReportIntervalMs = 0;
+    mLastReportTimeMs    = 0;
+    mIsSubscription      = false;
+    mUrgentReportPending = false;
+    mMoreChunkedEvents   = false;
+    mSubscriptionSlot    = kNoSubscriptionSlot;
+    mEventPathCount      = 0;
+    mMinEventPriority    = PriorityLevel::First;
+    for (EventNumber & eventNumber : mNextEventNumber)
+    {
+        eventNumber = 0;
+    }
     MoveToState(HandlerState::Initialized);
 
 exit:
@@ -50,9 +65,12 @@ exit:
 void ReadHandler::Shutdown()
 {
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpClusterInfoList);
+    mpChunkCursor      = nullptr;
+    mMoreChunkedEvents = false;
     ClearExistingExchangeContext();
     MoveToState(HandlerState::Uninitialized);
     mpDelegate = nullptr;
+    ReleaseToPool();
 }
 
 CHIP_ERROR ReadHandler::ClearExistingExchangeContext()
@@ -86,19 +104,171 @@ exit:
     return err;
 }
 
+CHIP_ERROR ReadHandler::OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle aPayload)
+{
+    mIsSubscription = true;
+    return OnReadRequest(apExchangeContext, std::move(aPayload));
+}
+
 CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle aPayload)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(aPayload),
-                                     Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+    // Reports yield the link to the interactive exchanges, while they wait to be sent.
+    mpExchangeCtx->SetTrafficClass(Transport::TrafficClass::kReporting);
+
+    if (IsChunkedReportInProgress() || mIsSubscription)
+    {
+        // The next chunk is only built once the initiator has acknowledged this one, and a subscription is only reported
+        // to again once the initiator has acknowledged its last report.
+        mpExchangeCtx->SetDelegate(this);
+        mpExchangeCtx->SetResponseTimeout(kImMessageTimeoutMsec);
+        err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(aPayload),
+                                         Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse));
+        SuccessOrExit(err);
+        MoveToState(HandlerState::AwaitingReportResponse);
+    }
+    else
+    {
+        err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(aPayload),
+                                         Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+        SuccessOrExit(err);
+    }
+    mLastReportTimeMs    = System::Layer::GetClock_MonotonicMS();
+    mUrgentReportPending = false;
+
 exit:
     ChipLogFunctError(err);
-    Shutdown();
+    if (err != CHIP_NO_ERROR)
+    {
+        InteractionModelEngine::GetInstance()->ForgetSubscription(*this);
+    }
+    if (err != CHIP_NO_ERROR || !IsAwaitingReportResponse())
+    {
+        Shutdown();
+    }
     return err;
 }
 
+void ReadHandler::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                                    const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Protocols::SecureChannel::StatusReport report;
+
+    VerifyOrExit(apExchangeContext == mpExchangeCtx, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(aPayloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport),
+                 err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
+
+    err = report.Parse(std::move(aPayload));
+    SuccessOrExit(err);
+    VerifyOrExit(report.GetGeneralCode() == Protocols::SecureChannel::GeneralStatusCode::kSuccess,
+                 err = CHIP_ERROR_INCORRECT_STATE);
+
+exit:
+    OnReportResponse(err);
+}
+
+void ReadHandler::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
+{
+    ChipLogProgress(DataManagement, "Time out! failed to receive status report from Exchange: %d",
+                    apExchangeContext->GetExchangeId());
+    OnReportResponse(CHIP_ERROR_TIMEOUT);
+}
+
+void ReadHandler::OnReportResponse(CHIP_ERROR aError)
+{
+    reporting::Engine & reportingEngine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+
+    VerifyOrReturn(IsAwaitingReportResponse());
+
+    reportingEngine.OnReportConfirm();
+    if (aError == CHIP_NO_ERROR)
+    {
+        // Once the initiator has acknowledged the whole of the priming report, the subscription is kept, for it to be resumed
+        // after a reboot.
+        if (mIsSubscription && !IsChunkedReportInProgress() && mSubscriptionSlot == kNoSubscriptionSlot)
+        {
+            InteractionModelEngine::GetInstance()->PersistSubscription(*this);
+        }
+        // A subscription that has reported everything waits for the next change or event.
+        MoveToState((mIsSubscription && !IsChunkedReportInProgress() && !HasReportPending()) ? HandlerState::Subscribed
+                                                                                              : HandlerState::Reportable);
+    }
+    else
+    {
+        // The initiator is gone, or has dropped the subscription: it is not resumed after a reboot either.
+        ChipLogFunctError(aError);
+        InteractionModelEngine::GetInstance()->ForgetSubscription(*this);
+        Shutdown();
+    }
+
+    // Other handlers may have been waiting for this report to complete.
+    aError = reportingEngine.ScheduleRun();
+    if (aError != CHIP_NO_ERROR && IsReportable())
+    {
+        ChipLogFunctError(aError);
+        InteractionModelEngine::GetInstance()->ForgetSubscription(*this);
+        Shutdown();
+    }
+}
+
+void ReadHandler::MarkReportable(bool aUrgent)
+{
+    mUrgentReportPending = mUrgentReportPending || aUrgent;
+    if (IsSubscribed())
+    {
+        MoveToState(HandlerState::Reportable);
+    }
+}
+
+void ReadHandler::OnNothingToReport()
+{
+    mUrgentReportPending = false;
+    MoveToState(HandlerState::Subscribed);
+}
+
+bool ReadHandler::HasDirtyPaths() const
+{
+    for (ClusterInfo * clusterInfo = mpClusterInfoList; clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        if (clusterInfo->IsDirty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReadHandler::HasReportPending() const
+{
+    return HasDirtyPaths() || HasEventsPending();
+}
+
+bool ReadHandler::HasEventsPending() const
+{
+    EventManagement & eventManager = EventManagement::GetInstance();
+
+    if (mEventPathCount == 0 || !eventManager.IsValid())
+    {
+        return false;
+    }
+
+    for (size_t priority = static_cast<size_t>(mMinEventPriority); priority < kNumPriorityLevel; priority++)
+    {
+        const PriorityLevel priorityLevel = static_cast<PriorityLevel>(priority);
+        const EventNumber lastEventNumber = eventManager.GetLastEventNumber(priorityLevel);
+
+        // The last number is below the first one until an event of the priority is logged.
+        if (lastEventNumber >= eventManager.GetFirstEventNumber(priorityLevel) && lastEventNumber >= mNextEventNumber[priority])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 CHIP_ERROR ReadHandler::ProcessReadRequest(System::PacketBufferHandle aPayload)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -107,7 +277,10 @@ CHIP_ERROR ReadHandler::ProcessReadRequest(System::PacketBufferHandle aPayload)
     ReadRequest::Parser readRequestParser;
     EventPathList::Parser eventPathListParser;
     AttributePathList::Parser attributePathListParser;
-    TLV::TLVReader eventPathListReader;
+    AttributeDataVersionList::Parser attributeDataVersionListParser;
+    AttributeDataVersionList::Parser * dataVersionList = nullptr;
+    uint64_t eventNumber;
+    uint8_t minEventPriority;
 
     reader.Init(std::move(aPayload));
 
@@ -130,7 +303,11 @@ CHIP_ERROR ReadHandler::ProcessReadRequest(System::PacketBufferHandle aPayload)
     else
     {
         SuccessOrExit(err);
-        ProcessAttributePathList(attributePathListParser);
+        if (readRequestParser.GetAttributeDataVersionList(&attributeDataVersionListParser) == CHIP_NO_ERROR)
+        {
+            dataVersionList = &attributeDataVersionListParser;
+        }
+        ProcessAttributePathList(attributePathListParser, dataVersionList);
     }
 
     err = readRequestParser.GetEventPathList(&eventPathListParser);
@@ -141,25 +318,36 @@ CHIP_ERROR ReadHandler::ProcessReadRequest(System::PacketBufferHandle aPayload)
     else
     {
         SuccessOrExit(err);
-        eventPathListParser.GetReader(&eventPathListReader);
+        err = ProcessEventPathList(eventPathListParser);
+        SuccessOrExit(err);
+    }
 
-        while (CHIP_NO_ERROR == (err = eventPathListReader.Next()))
+    // The event number is the last one the initiator has, from which every priority is reported on.
+    err = readRequestParser.GetEventNumber(&eventNumber);
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    else
+    {
+        SuccessOrExit(err);
+        for (EventNumber & nextEventNumber : mNextEventNumber)
         {
-            VerifyOrExit(TLV::AnonymousTag == eventPathListReader.GetTag(), err = CHIP_ERROR_INVALID_TLV_TAG);
-
-            EventPath::Parser eventPath;
-
-            err = eventPath.Init(eventPathListReader);
-            SuccessOrExit(err);
-            // TODO: Pass event path to report engine to generate report with interested events
+            nextEventNumber = eventNumber + 1;
         }
     }
 
-    // if we have exhausted this container
-    if (CHIP_END_OF_TLV == err)
+    err = readRequestParser.GetMinEventPriority(&minEventPriority);
+    if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
     }
+    else
+    {
+        SuccessOrExit(err);
+        VerifyOrExit(minEventPriority <= static_cast<uint8_t>(PriorityLevel::Last), err = CHIP_ERROR_INVALID_ARGUMENT);
+        mMinEventPriority = static_cast<PriorityLevel>(minEventPriority);
+    }
 
     MoveToState(HandlerState::Reportable);
 
@@ -170,7 +358,8 @@ exit:
     return err;
 }
 
-CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser)
+CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser,
+                                                 AttributeDataVersionList::Parser * apDataVersionList)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     TLV::TLVReader reader;
@@ -182,19 +371,111 @@ CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAt
         VerifyOrExit(TLV::kTLVType_List == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
         AttributePathParams attributePathParams;
         AttributePath::Parser path;
+        uint32_t presenceMask = 0;
+
         err = path.Init(reader);
         SuccessOrExit(err);
-        err = path.GetNodeId(&(attributePathParams.mNodeId));
+        err = path.DecodeAttributePath(&(attributePathParams.mNodeId), &(attributePathParams.mEndpointId),
+                                       &(attributePathParams.mClusterId), &(attributePathParams.mFieldId),
+                                       &(attributePathParams.mListIndex), &presenceMask);
+        SuccessOrExit(err);
+        VerifyOrExit(presenceMask & (1u << AttributePath::kCsTag_NodeId), err = CHIP_END_OF_TLV);
+
+        // The ids left out make a wildcard path, which takes a single cluster info however many attributes it covers:
+        // the reporting engine expands it as it goes.
+        if (!(presenceMask & (1u << AttributePath::kCsTag_EndpointId)))
+        {
+            attributePathParams.mFlags.Set(AttributePathFlags::kEndpointIdWildcard);
+        }
+        if (!(presenceMask & (1u << AttributePath::kCsTag_ClusterId)))
+        {
+            attributePathParams.mFlags.Set(AttributePathFlags::kClusterIdWildcard);
+        }
+        if (presenceMask & (1u << AttributePath::kCsTag_FieldId))
+        {
+            attributePathParams.mFlags.Set(AttributePathFlags::kFieldIdValid);
+        }
+        else
+        {
+            VerifyOrExit(!(presenceMask & (1u << AttributePath::kCsTag_ListIndex)), err = CHIP_END_OF_TLV);
+            attributePathParams.mFlags.Set(AttributePathFlags::kFieldIdWildcard);
+        }
+
+        err = InteractionModelEngine::GetInstance()->PushFront(mpClusterInfoList, attributePathParams);
+        SuccessOrExit(err);
+        mpClusterInfoList->SetDirty();
+
+        // The version of the path's cluster, which filters a path of a single cluster only. A malformed list is dropped, at
+        // worst reporting what the initiator already has.
+        if (apDataVersionList != nullptr)
+        {
+            DataVersion dataVersion = 0;
+            if (apDataVersionList->Next() != CHIP_NO_ERROR || !apDataVersionList->IsElementValid())
+            {
+                apDataVersionList = nullptr;
+            }
+            else if (!apDataVersionList->IsNull() && apDataVersionList->GetVersion(&dataVersion) == CHIP_NO_ERROR &&
+                     !attributePathParams.mFlags.HasAny(AttributePathFlags::kEndpointIdWildcard,
+                                                        AttributePathFlags::kClusterIdWildcard))
+            {
+                mpClusterInfoList->mDataVersion    = dataVersion;
+                mpClusterInfoList->mHasDataVersion = true;
+            }
+        }
+    }
+    // if we have exhausted this container
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR ReadHandler::ProcessEventPathList(EventPathList::Parser & aEventPathListParser)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVReader reader;
+    aEventPathListParser.GetReader(&reader);
+
+    while (CHIP_NO_ERROR == (err = reader.Next()))
+    {
+        VerifyOrExit(TLV::AnonymousTag == reader.GetTag(), err = CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrExit(mEventPathCount < CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER, err = CHIP_ERROR_NO_MEMORY);
+        EventPathParams eventPathParams;
+        EventPath::Parser path;
+
+        err = path.Init(reader);
         SuccessOrExit(err);
-        err = path.GetEndpointId(&(attributePathParams.mEndpointId));
+        err = path.GetNodeId(&eventPathParams.mNodeId);
         SuccessOrExit(err);
-        err = path.GetClusterId(&(attributePathParams.mClusterId));
+
+        // The ids left out make a wildcard path, covering the events of every endpoint, cluster or event id.
+        err = path.GetEndpointId(&eventPathParams.mEndpointId);
+        if (err == CHIP_END_OF_TLV)
+        {
+            eventPathParams.mFlags.Set(EventPathFlags::kEndpointIdWildcard);
+            err = CHIP_NO_ERROR;
+        }
         SuccessOrExit(err);
-        err = path.GetFieldId(&(attributePathParams.mFieldId));
+        err = path.GetClusterId(&eventPathParams.mClusterId);
+        if (err == CHIP_END_OF_TLV)
+        {
+            eventPathParams.mFlags.Set(EventPathFlags::kClusterIdWildcard);
+            err = CHIP_NO_ERROR;
+        }
         SuccessOrExit(err);
-        err = InteractionModelEngine::GetInstance()->PushFront(mpClusterInfoList, attributePathParams);
+        err = path.GetEventId(&eventPathParams.mEventId);
+        if (err == CHIP_END_OF_TLV)
+        {
+            eventPathParams.mFlags.Set(EventPathFlags::kEventIdWildcard);
+            err = CHIP_NO_ERROR;
+        }
         SuccessOrExit(err);
-        mpClusterInfoList->SetDirty();
+
+        mEventPaths[mEventPathCount++] = eventPathParams;
     }
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
@@ -207,6 +488,206 @@ exit:
     return err;
 }
 
+namespace {
+// The context tags of the record a subscription is kept in, which later versions have to keep reading.
+constexpr uint8_t kTag_PeerNodeId          = 1;
+constexpr uint8_t kTag_PeerKeyId           = 2;
+constexpr uint8_t kTag_LocalKeyId          = 3;
+constexpr uint8_t kTag_AdminId             = 4;
+constexpr uint8_t kTag_MinReportIntervalMs = 5;
+constexpr uint8_t kTag_MinEventPriority    = 6;
+constexpr uint8_t kTag_AttributePaths      = 7;
+constexpr uint8_t kTag_EventPaths          = 8;
+constexpr uint8_t kTag_NextEventNumbers    = 9;
+
+// The context tags of a path of the record.
+constexpr uint8_t kTag_NodeId     = 1;
+constexpr uint8_t kTag_EndpointId = 2;
+constexpr uint8_t kTag_ClusterId  = 3;
+constexpr uint8_t kTag_FieldId    = 4;
+constexpr uint8_t kTag_ListIndex  = 5;
+constexpr uint8_t kTag_Flags      = 6;
+constexpr uint8_t kTag_IsUrgent   = 7;
+
+template <typename T>
+CHIP_ERROR GetField(TLV::TLVReader & aReader, uint8_t aTag, T & aValue)
+{
+    ReturnErrorOnFailure(aReader.Next(TLV::kTLVType_UnsignedInteger, TLV::ContextTag(aTag)));
+    return aReader.Get(aValue);
+}
+} // namespace
+
+CHIP_ERROR ReadHandler::EncodeSubscription(TLV::TLVWriter & aWriter) const
+{
+    TLV::TLVType outerContainer, listContainer, pathContainer;
+    VerifyOrReturnError(mIsSubscription && mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    const SecureSessionHandle session      = mpExchangeCtx->GetSecureSessionHandle();
+    Transport::PeerConnectionState * state = mpExchangeCtx->GetExchangeMgr()->GetSessionMgr()->GetPeerConnectionState(session);
+    VerifyOrReturnError(state != nullptr, CHIP_ERROR_NOT_CONNECTED);
+
+    ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerContainer));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_PeerNodeId), session.GetPeerNodeId()));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_PeerKeyId), session.GetPeerKeyId()));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_LocalKeyId), state->GetLocalKeyID()));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_AdminId), session.GetAdminId()));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_MinReportIntervalMs), mMinReportIntervalMs));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_MinEventPriority), static_cast<uint8_t>(mMinEventPriority)));
+
+    ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(kTag_AttributePaths), TLV::kTLVType_Array, listContainer));
+    for (const ClusterInfo * clusterInfo = mpClusterInfoList; clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        const AttributePathParams & path = clusterInfo->mAttributePathParams;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, pathContainer));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_NodeId), path.mNodeId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_EndpointId), path.mEndpointId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_ClusterId), path.mClusterId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_FieldId), path.mFieldId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_ListIndex), path.mListIndex));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_Flags), path.mFlags.Raw()));
+        ReturnErrorOnFailure(aWriter.EndContainer(pathContainer));
+    }
+    ReturnErrorOnFailure(aWriter.EndContainer(listContainer));
+
+    ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(kTag_EventPaths), TLV::kTLVType_Array, listContainer));
+    for (size_t index = 0; index < mEventPathCount; index++)
+    {
+        const EventPathParams & path = mEventPaths[index];
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, pathContainer));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_NodeId), path.mNodeId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_EndpointId), path.mEndpointId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_ClusterId), path.mClusterId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_FieldId), path.mEventId));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(kTag_Flags), path.mFlags.Raw()));
+        ReturnErrorOnFailure(aWriter.PutBoolean(TLV::ContextTag(kTag_IsUrgent), path.mIsUrgent));
+        ReturnErrorOnFailure(aWriter.EndContainer(pathContainer));
+    }
+    ReturnErrorOnFailure(aWriter.EndContainer(listContainer));
+
+    ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(kTag_NextEventNumbers), TLV::kTLVType_Array, listContainer));
+    for (EventNumber eventNumber : mNextEventNumber)
+    {
+        ReturnErrorOnFailure(aWriter.Put(TLV::AnonymousTag, eventNumber));
+    }
+    ReturnErrorOnFailure(aWriter.EndContainer(listContainer));
+
+    return aWriter.EndContainer(outerContainer);
+}
+
+CHIP_ERROR ReadHandler::ResumeSubscription(TLV::TLVReader & aReader, Messaging::ExchangeManager * apExchangeMgr)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVType outerContainer, listContainer, pathContainer;
+    NodeId peerNodeId          = kUndefinedNodeId;
+    uint16_t peerKeyId         = 0;
+    uint16_t localKeyId        = 0;
+    Transport::AdminId adminId = Transport::kUndefinedAdminId;
+    uint8_t minEventPriority   = 0;
+    size_t priority            = 0;
+
+    VerifyOrExit(apExchangeMgr != nullptr && mpExchangeCtx == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    SuccessOrExit(err = aReader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag));
+    SuccessOrExit(err = aReader.EnterContainer(outerContainer));
+    SuccessOrExit(err = GetField(aReader, kTag_PeerNodeId, peerNodeId));
+    SuccessOrExit(err = GetField(aReader, kTag_PeerKeyId, peerKeyId));
+    SuccessOrExit(err = GetField(aReader, kTag_LocalKeyId, localKeyId));
+    SuccessOrExit(err = GetField(aReader, kTag_AdminId, adminId));
+    SuccessOrExit(err = GetField(aReader, kTag_MinReportIntervalMs, mMinReportIntervalMs));
+    SuccessOrExit(err = GetField(aReader, kTag_MinEventPriority, minEventPriority));
+    VerifyOrExit(minEventPriority <= static_cast<uint8_t>(PriorityLevel::Last), err = CHIP_ERROR_INVALID_ARGUMENT);
+    mMinEventPriority = static_cast<PriorityLevel>(minEventPriority);
+
+    SuccessOrExit(err = aReader.Next(TLV::kTLVType_Array, TLV::ContextTag(kTag_AttributePaths)));
+    SuccessOrExit(err = aReader.EnterContainer(listContainer));
+    while (CHIP_NO_ERROR == (err = aReader.Next()))
+    {
+        AttributePathParams path;
+        BitFlags<AttributePathFlags>::IntegerType flags = 0;
+
+        VerifyOrExit(TLV::kTLVType_Structure == aReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
+        SuccessOrExit(err = aReader.EnterContainer(pathContainer));
+        SuccessOrExit(err = GetField(aReader, kTag_NodeId, path.mNodeId));
+        SuccessOrExit(err = GetField(aReader, kTag_EndpointId, path.mEndpointId));
+        SuccessOrExit(err = GetField(aReader, kTag_ClusterId, path.mClusterId));
+        SuccessOrExit(err = GetField(aReader, kTag_FieldId, path.mFieldId));
+        SuccessOrExit(err = GetField(aReader, kTag_ListIndex, path.mListIndex));
+        SuccessOrExit(err = GetField(aReader, kTag_Flags, flags));
+        SuccessOrExit(err = aReader.ExitContainer(pathContainer));
+        path.mFlags.SetRaw(flags);
+
+        SuccessOrExit(err = InteractionModelEngine::GetInstance()->PushFront(mpClusterInfoList, path));
+        mpClusterInfoList->SetDirty();
+    }
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    SuccessOrExit(err);
+    SuccessOrExit(err = aReader.ExitContainer(listContainer));
+
+    SuccessOrExit(err = aReader.Next(TLV::kTLVType_Array, TLV::ContextTag(kTag_EventPaths)));
+    SuccessOrExit(err = aReader.EnterContainer(listContainer));
+    while (CHIP_NO_ERROR == (err = aReader.Next()))
+    {
+        EventPathParams path;
+        BitFlags<EventPathFlags>::IntegerType flags = 0;
+
+        VerifyOrExit(mEventPathCount < CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER, err = CHIP_ERROR_NO_MEMORY);
+        VerifyOrExit(TLV::kTLVType_Structure == aReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
+        SuccessOrExit(err = aReader.EnterContainer(pathContainer));
+        SuccessOrExit(err = GetField(aReader, kTag_NodeId, path.mNodeId));
+        SuccessOrExit(err = GetField(aReader, kTag_EndpointId, path.mEndpointId));
+        SuccessOrExit(err = GetField(aReader, kTag_ClusterId, path.mClusterId));
+        SuccessOrExit(err = GetField(aReader, kTag_FieldId, path.mEventId));
+        SuccessOrExit(err = GetField(aReader, kTag_Flags, flags));
+        SuccessOrExit(err = aReader.Next(TLV::kTLVType_Boolean, TLV::ContextTag(kTag_IsUrgent)));
+        SuccessOrExit(err = aReader.Get(path.mIsUrgent));
+        SuccessOrExit(err = aReader.ExitContainer(pathContainer));
+        path.mFlags.SetRaw(flags);
+        mEventPaths[mEventPathCount++] = path;
+    }
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    SuccessOrExit(err);
+    SuccessOrExit(err = aReader.ExitContainer(listContainer));
+
+    SuccessOrExit(err = aReader.Next(TLV::kTLVType_Array, TLV::ContextTag(kTag_NextEventNumbers)));
+    SuccessOrExit(err = aReader.EnterContainer(listContainer));
+    while (CHIP_NO_ERROR == (err = aReader.Next()))
+    {
+        VerifyOrExit(priority < kNumPriorityLevel, err = CHIP_ERROR_INVALID_ARGUMENT);
+        SuccessOrExit(err = aReader.Get(mNextEventNumber[priority++]));
+    }
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    SuccessOrExit(err);
+    SuccessOrExit(err = aReader.ExitContainer(listContainer));
+    SuccessOrExit(err = aReader.ExitContainer(outerContainer));
+
+    // The session is restored from storage before any message of the initiator comes, for the report to be sent on it.
+    SuccessOrExit(err = apExchangeMgr->GetSessionMgr()->RestoreSession(localKeyId));
+    mpExchangeCtx = apExchangeMgr->NewContext(SecureSessionHandle(peerNodeId, peerKeyId, adminId), this);
+    VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_NO_MEMORY);
+
+    mIsSubscription = true;
+    MoveToState(HandlerState::Reportable);
+
+    err = InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogFunctError(err);
+        Shutdown();
+    }
+    return err;
+}
+
 const char * ReadHandler::GetStateStr() const
 {
 #if CHIP_DETAIL_LOGGING
@@ -220,6 +701,12 @@ const char * ReadHandler::GetStateStr() const
 
     case HandlerState::Reportable:
         return "Reportable";
+
+    case HandlerState::AwaitingReportResponse:
+        return "AwaitingReportResponse";
+
+    case HandlerState::Subscribed:
+        return "Subscribed";
     }
 #endif // CHIP_DETAIL_LOGGING
     return "N/A";
@@ -25,7 +25,13 @@
 #pragma once
 
 #include <app/ClusterInfo.h>
+#include <app/EventLoggingTypes.h>
+#include <app/EventPathParams.h>
 #include <app/InteractionModelDelegate.h>
+#include <app/MessageDef/AttributeDataVersionList.h>
+#include <app/MessageDef/AttributePathList.h>
+#include <app/MessageDef/EventPathList.h>
+#include <app/ObjectPool.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLVDebug.hpp>
 #include <messaging/ExchangeContext.h>
@@ -46,7 +52,7 @@ namespace app {
  *         for the relevant data, and sending a reply.
  *
  */
-class ReadHandler
+class ReadHandler : public PoolableObject, public Messaging::ExchangeDelegate
 {
 public:
     /**
@@ -85,7 +91,54 @@ public:
     CHIP_ERROR OnReadRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle aPayload);
 
     /**
-     *  Send ReportData to initiator
+     *  Process a subscribe request, which is encoded as a read request. Once the first report is acknowledged, the handler
+     *  stays subscribed on the exchange: it reports the paths that change and the events logged since its last report,
+     *  until the initiator fails to acknowledge a report.
+     *
+     *  @param[in]    apExchangeContext    A pointer to the ExchangeContext.
+     *  @param[in]    aPayload             A payload that has subscribe request data
+     *
+     *  @retval #Others If fails to process subscribe request
+     *  @retval #CHIP_NO_ERROR On success.
+     *
+     */
+    CHIP_ERROR OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle aPayload);
+
+    /**
+     *  Resume a subscription encoded by EncodeSubscription before a reboot, on a new exchange over the restored session of
+     *  its initiator. Every path is left dirty, so that the report the handler then sends primes the initiator again,
+     *  without it having to subscribe anew. The handler shuts itself down if the subscription cannot be resumed.
+     *
+     *  @param[in]    aReader          A reader positioned before the record of the subscription.
+     *  @param[in]    apExchangeMgr    The exchange manager to restore the session and open the exchange with.
+     *
+     *  @retval #Others If the record is malformed, or the session of the initiator cannot be restored
+     *  @retval #CHIP_NO_ERROR On success.
+     *
+     */
+    CHIP_ERROR ResumeSubscription(TLV::TLVReader & aReader, Messaging::ExchangeManager * apExchangeMgr);
+
+    /**
+     *  Encode what a subscription needs to be resumed after a reboot: the session of its initiator, its attribute and event
+     *  paths, its minimum report interval and event priority, and the numbers of the next events to report.
+     *
+     *  @retval #CHIP_ERROR_INCORRECT_STATE If the handler is not a subscription on an exchange.
+     *  @retval #Others If the record does not fit in the writer
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR EncodeSubscription(TLV::TLVWriter & aWriter) const;
+
+    static constexpr uint8_t kNoSubscriptionSlot = UINT8_MAX;
+
+    /**
+     *  The slot of persistent storage the subscription is kept in, kNoSubscriptionSlot if it is not kept.
+     */
+    uint8_t GetSubscriptionSlot() const { return mSubscriptionSlot; }
+    void SetSubscriptionSlot(uint8_t aSlot) { mSubscriptionSlot = aSlot; }
+
+    /**
+     *  Send ReportData to initiator. If a chunked report is in progress, or the handler is a subscription, the handler then
+     *  waits for the initiator to acknowledge the report with a status report; otherwise it shuts down.
      *
      *  @param[in]    aPayload             A payload that has read request data
      *
@@ -95,24 +148,107 @@ public:
      */
     CHIP_ERROR SendReportData(System::PacketBufferHandle aPayload);
 
+    void OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                           const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload) override;
+    void OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext) override;
+
+    Messaging::ExchangeContext * GetExchangeContext() const { return mpExchangeCtx; }
+
     bool IsFree() const { return mState == HandlerState::Uninitialized; }
     bool IsReportable() const { return mState == HandlerState::Reportable; }
+    bool IsAwaitingReportResponse() const { return mState == HandlerState::AwaitingReportResponse; }
+    bool IsSubscribed() const { return mState == HandlerState::Subscribed; }
+    bool IsSubscription() const { return mIsSubscription; }
+    bool HasSentReport() const { return mLastReportTimeMs != 0; }
+
+    /**
+     *  Make a subscription waiting for changes reportable again, once a path of it is marked dirty or it has events to
+     *  report. An urgent report is sent without waiting for the minimum report interval.
+     */
+    void MarkReportable(bool aUrgent);
+
+    /**
+     *  Return a subscription whose report would carry nothing to waiting for changes or events, without sending the report.
+     */
+    void OnNothingToReport();
+
+    /**
+     *  Returns true if a path of the handler is dirty.
+     */
+    bool HasDirtyPaths() const;
+
+    /**
+     *  Returns true if a dirty path or an event of interest is waiting to be reported.
+     */
+    bool HasReportPending() const;
+
+    /**
+     *  Returns true if events on the event paths of the handler, of at least its minimum priority, have been logged since
+     *  the last ones it reported.
+     */
+    bool HasEventsPending() const;
+
+    const EventPathParams * GetEventPaths() const { return mEventPaths; }
+    size_t GetEventPathCount() const { return mEventPathCount; }
+    PriorityLevel GetMinEventPriority() const { return mMinEventPriority; }
+
+    /**
+     *  The number of the first event of aPriority the next report starts from.
+     */
+    EventNumber & GetNextEventNumber(PriorityLevel aPriority) { return mNextEventNumber[static_cast<size_t>(aPriority)]; }
 
     virtual ~ReadHandler() = default;
 
     ClusterInfo * GetCluterInfolist() { return mpClusterInfoList; };
 
+    /**
+     *  The path the next chunk of the report starts from, or nullptr if the next report starts from the head of the list.
+     */
+    ClusterInfo * GetChunkCursor() { return mpChunkCursor; }
+    void SetChunkCursor(ClusterInfo * apClusterInfo) { mpChunkCursor = apClusterInfo; }
+
+    /**
+     *  Whether the events of interest did not all fit in the report, so that the next chunk carries the rest.
+     */
+    void SetMoreChunkedEvents(bool aMoreChunkedEvents) { mMoreChunkedEvents = aMoreChunkedEvents; }
+    bool IsChunkedReportInProgress() const { return mpChunkCursor != nullptr || mMoreChunkedEvents; }
+
+    /**
+     *  Set the minimum interval between two reports of the handler. Changes arriving within the interval are coalesced into
+     *  the next report. The chunks of a report are not delayed.
+     */
+    void SetMinReportInterval(uint32_t aMinIntervalMs) { mMinReportIntervalMs = aMinIntervalMs; }
+
+    /**
+     *  The monotonic time in milliseconds from which the handler may send its next report, 0 if it may send it right away.
+     */
+    uint64_t GetNextReportTimeMs() const
+    {
+        return (mLastReportTimeMs == 0 || IsChunkedReportInProgress() || mUrgentReportPending)
+            ? 0
+            : mLastReportTimeMs + mMinReportIntervalMs;
+    }
+
 private:
     enum class HandlerState
     {
-        Uninitialized = 0, //< The handler has not been initialized
-        Initialized,       //< The handler has been initialized and is ready
-        Reportable,        //< The handler has received read request and is waiting for the data to send to be available
+        Uninitialized = 0,      //< The handler has not been initialized
+        Initialized,            //< The handler has been initialized and is ready
+        Reportable,             //< The handler has received read request and is waiting for the data to send to be available
+        AwaitingReportResponse, //< The handler has sent a chunk of the report and is waiting for its status report
+        Subscribed,             //< The subscription has reported everything and is waiting for changes or events
     };
 
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle aPayload);
-    CHIP_ERROR ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser);
+    /**
+     * @param apDataVersionList The versions the initiator has of the clusters of the paths, one for each path in order, or
+     *                          nullptr if it sent none.
+     */
+    CHIP_ERROR ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser,
+                                        AttributeDataVersionList::Parser * apDataVersionList);
+    CHIP_ERROR ProcessEventPathList(EventPathList::Parser & aEventPathListParser);
     void MoveToState(const HandlerState aTargetState);
+    void OnReportResponse(CHIP_ERROR aError);
 
     const char * GetStateStr() const;
     CHIP_ERROR ClearExistingExchangeContext();
@@ -129,6 +265,18 @@ private:
     // Current Handler state
     HandlerState mState;
     ClusterInfo * mpClusterInfoList = nullptr;
+    ClusterInfo * mpChunkCursor     = nullptr;
+    uint32_t mMinReportIntervalMs   = 0;
+    uint64_t mLastReportTimeMs      = 0;
+    bool mIsSubscription            = false;
+    bool mUrgentReportPending       = false;
+    bool mMoreChunkedEvents         = false;
+    uint8_t mSubscriptionSlot       = kNoSubscriptionSlot;
+
+    EventPathParams mEventPaths[CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER];
+    size_t mEventPathCount                          = 0;
+    PriorityLevel mMinEventPriority                 = PriorityLevel::First;
+    EventNumber mNextEventNumber[kNumPriorityLevel] = {};
 };
 } // namespace app
 } // namespace chip
@@ -0,0 +1,428 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the initiator side of a CHIP Write Interaction.
+ *
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/WriteClient.h>
+#include <transport/SecureSessionMgr.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR WriteClient::Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    // Error if already initialized.
+    VerifyOrExit(apExchangeMgr != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mpExchangeMgr == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mpExchangeCtx == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    mpExchangeMgr      = apExchangeMgr;
+    mpExchangeCtx      = nullptr;
+    mpDelegate         = apDelegate;
+    mNodeId            = kUndefinedNodeId;
+    mNumWrites         = 0;
+    mSendAfterResponse = false;
+    mArena.Reset();
+    MoveToState(ClientState::Initialized);
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+void WriteClient::Shutdown()
+{
+    if (mState == ClientState::AwaitingWindow)
+    {
+        mpExchangeMgr->GetSessionMgr()->SystemLayer()->CancelTimer(OnCoalesceWindowEnd, this);
+    }
+    ClearExistingExchangeContext();
+    mpExchangeMgr = nullptr;
+    mpDelegate    = nullptr;
+    mNumWrites    = 0;
+    mArena.Reset();
+    MoveToState(ClientState::Uninitialized);
+    ReleaseToPool();
+}
+
+const char * WriteClient::GetStateStr() const
+{
+#if CHIP_DETAIL_LOGGING
+    switch (mState)
+    {
+    case ClientState::Uninitialized:
+        return "UNINIT";
+    case ClientState::Initialized:
+        return "INIT";
+    case ClientState::AwaitingWindow:
+        return "AwaitingWindow";
+    case ClientState::AwaitingResponse:
+        return "AwaitingResponse";
+    }
+#endif // CHIP_DETAIL_LOGGING
+    return "N/A";
+}
+
+void WriteClient::MoveToState(const ClientState aTargetState)
+{
+    mState = aTargetState;
+    ChipLogDetail(DataManagement, "WriteClient moving to [%s]", GetStateStr());
+}
+
+CHIP_ERROR WriteClient::PrepareAttribute(const AttributePathParams & aAttributePathParams)
+{
+    VerifyOrReturnError(mState != ClientState::Uninitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!aAttributePathParams.HasWildcard(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aAttributePathParams.mFlags.HasAny(AttributePathFlags::kFieldIdValid, AttributePathFlags::kListIndexValid),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Context tags only go in a container: the value is put in an anonymous structure until it is copied to the request.
+    // It is encoded in the memory of the arena not allocated yet, and only allocated by FinishAttribute.
+    mPreparedPath = aAttributePathParams;
+    mDataWriter.Init(mArena.Unused(), static_cast<uint32_t>(mArena.UnusedSize()));
+    return mDataWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, mDataOuterType);
+}
+
+CHIP_ERROR WriteClient::FinishAttribute()
+{
+    AttributeWrite * write = nullptr;
+    uint32_t length        = 0;
+
+    VerifyOrReturnError(mState != ClientState::Uninitialized, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mDataWriter.EndContainer(mDataOuterType));
+    ReturnErrorOnFailure(mDataWriter.Finalize());
+    length = mDataWriter.GetLengthWritten();
+
+    // The latest value of an attribute replaces the one still waiting to be sent.
+    for (size_t index = 0; index < mNumWrites; index++)
+    {
+        if (mWrites[index].mPath.IsSamePath(mPreparedPath))
+        {
+            write = &mWrites[index];
+            break;
+        }
+    }
+    if (write == nullptr)
+    {
+        VerifyOrReturnError(mNumWrites < CHIP_IM_MAX_NUM_WRITE_ATTRIBUTES, CHIP_ERROR_NO_MEMORY);
+        write              = &mWrites[mNumWrites++];
+        write->mPath       = mPreparedPath;
+        write->mData       = nullptr;
+        write->mDataLength = 0;
+    }
+
+    if (write->mData != nullptr && length <= write->mDataLength)
+    {
+        // The new value fits where the one it replaces is.
+        memmove(write->mData, mArena.Unused(), length);
+    }
+    else
+    {
+        // The value is already where the arena allocates next.
+        write->mData = static_cast<uint8_t *>(mArena.Allocate(length, 1));
+        VerifyOrReturnError(write->mData != nullptr, CHIP_ERROR_INTERNAL);
+    }
+    write->mDataLength = length;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteClient::SendWriteRequest(NodeId aNodeId, Transport::AdminId aAdminId, uint32_t aCoalesceWindowMs)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    ChipLogDetail(DataManagement, "%s: Client [%5.5s]", __func__, GetStateStr());
+    VerifyOrExit(mState != ClientState::Uninitialized, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mState == ClientState::Initialized || (mNodeId == aNodeId && mAdminId == aAdminId),
+                 err = CHIP_ERROR_INCORRECT_STATE);
+
+    mNodeId  = aNodeId;
+    mAdminId = aAdminId;
+
+    switch (mState)
+    {
+    case ClientState::AwaitingWindow:
+        // The writes go with the request already waiting for the end of its window.
+        break;
+    case ClientState::AwaitingResponse:
+        mSendAfterResponse = true;
+        break;
+    default:
+        if (aCoalesceWindowMs == 0)
+        {
+            err = SendPendingWrites();
+            SuccessOrExit(err);
+        }
+        else
+        {
+            err = mpExchangeMgr->GetSessionMgr()->SystemLayer()->StartTimer(aCoalesceWindowMs, OnCoalesceWindowEnd, this);
+            SuccessOrExit(err);
+            MoveToState(ClientState::AwaitingWindow);
+        }
+        break;
+    }
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+void WriteClient::OnCoalesceWindowEnd(System::Layer * aSystemLayer, void * apAppState, System::Error aError)
+{
+    WriteClient * const client = reinterpret_cast<WriteClient *>(apAppState);
+    CHIP_ERROR err             = client->SendPendingWrites();
+
+    if (err != CHIP_NO_ERROR)
+    {
+        client->WriteResponseDone(err);
+    }
+}
+
+CHIP_ERROR WriteClient::SendPendingWrites()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferHandle msgBuf;
+
+    VerifyOrExit(mpExchangeCtx == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    err = BuildWriteRequest(msgBuf);
+    SuccessOrExit(err);
+
+    // The writes are in the request: the ones added from now on go with the next one.
+    mNumWrites         = 0;
+    mSendAfterResponse = false;
+    mArena.Reset();
+
+    mpExchangeCtx = mpExchangeMgr->NewContext({ mNodeId, 0, mAdminId }, this);
+    VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    mpExchangeCtx->SetResponseTimeout(kImMessageTimeoutMsec);
+
+    err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::WriteRequest, std::move(msgBuf),
+                                     Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse));
+    SuccessOrExit(err);
+    MoveToState(ClientState::AwaitingResponse);
+
+exit:
+    ChipLogFunctError(err);
+    if (err != CHIP_NO_ERROR)
+    {
+        ClearExistingExchangeContext();
+        MoveToState(ClientState::Initialized);
+    }
+    return err;
+}
+
+CHIP_ERROR WriteClient::BuildWriteRequest(System::PacketBufferHandle & aMsgBuf)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferTLVWriter writer;
+    WriteRequest::Builder request;
+    AttributeDataList::Builder attributeDataListBuilder;
+
+    aMsgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    VerifyOrExit(!aMsgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+
+    writer.Init(std::move(aMsgBuf));
+
+    err = request.Init(&writer);
+    SuccessOrExit(err);
+
+    attributeDataListBuilder = request.CreateAttributeDataListBuilder();
+    SuccessOrExit(attributeDataListBuilder.GetError());
+    for (size_t index = 0; index < mNumWrites; index++)
+    {
+        const AttributeWrite & write                 = mWrites[index];
+        AttributeDataElement::Builder elementBuilder = attributeDataListBuilder.CreateAttributeDataElementBuilder();
+        AttributePath::Builder attributePathBuilder  = elementBuilder.CreateAttributePathBuilder();
+        TLV::TLVReader dataReader;
+        TLV::TLVType dataOuterType;
+
+        attributePathBuilder.NodeId(write.mPath.mNodeId).EndpointId(write.mPath.mEndpointId).ClusterId(write.mPath.mClusterId);
+        if (write.mPath.mFlags.Has(AttributePathFlags::kFieldIdValid))
+        {
+            attributePathBuilder.FieldId(write.mPath.mFieldId);
+        }
+        else
+        {
+            attributePathBuilder.ListIndex(write.mPath.mListIndex);
+        }
+        attributePathBuilder.EndOfAttributePath();
+        SuccessOrExit(err = attributePathBuilder.GetError());
+
+        // The value was encoded, with its tag, by the writer of GetAttributeDataElementTLVWriter.
+        dataReader.Init(write.mData, write.mDataLength);
+        err = dataReader.Next();
+        SuccessOrExit(err);
+        err = dataReader.EnterContainer(dataOuterType);
+        SuccessOrExit(err);
+        err = dataReader.Next();
+        SuccessOrExit(err);
+        err = elementBuilder.GetWriter()->CopyElement(dataReader);
+        SuccessOrExit(err);
+
+        elementBuilder.EndOfAttributeDataElement();
+        SuccessOrExit(err = elementBuilder.GetError());
+    }
+    attributeDataListBuilder.EndOfAttributeDataList();
+    SuccessOrExit(err = attributeDataListBuilder.GetError());
+
+    request.EndOfWriteRequest();
+    SuccessOrExit(err = request.GetError());
+
+    err = writer.Finalize(&aMsgBuf);
+    SuccessOrExit(err);
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+void WriteClient::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                                    const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    VerifyOrExit(aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::WriteResponse),
+                 err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
+    VerifyOrExit(apExchangeContext == mpExchangeCtx, err = CHIP_ERROR_INCORRECT_STATE);
+    err = ProcessWriteResponse(std::move(aPayload));
+
+exit:
+    ChipLogFunctError(err);
+    WriteResponseDone(err);
+}
+
+void WriteClient::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
+{
+    ChipLogProgress(DataManagement, "Time out! failed to receive write response from Exchange: %d",
+                    apExchangeContext->GetExchangeId());
+    WriteResponseDone(CHIP_ERROR_TIMEOUT);
+}
+
+void WriteClient::WriteResponseDone(CHIP_ERROR aError)
+{
+    ClearExistingExchangeContext();
+    MoveToState(ClientState::Initialized);
+    if (mpDelegate != nullptr)
+    {
+        if (aError != CHIP_NO_ERROR)
+        {
+            mpDelegate->WriteResponseError(this, aError);
+        }
+        else
+        {
+            mpDelegate->WriteResponseProcessed(this);
+        }
+    }
+
+    // The writes added while the request was in flight only go once it is done, and only the latest value of each.
+    if (mState == ClientState::Initialized && mSendAfterResponse && mNumWrites != 0)
+    {
+        CHIP_ERROR err = SendPendingWrites();
+        if (err != CHIP_NO_ERROR && mpDelegate != nullptr)
+        {
+            mpDelegate->WriteResponseError(this, err);
+        }
+    }
+}
+
+CHIP_ERROR WriteClient::ProcessWriteResponse(System::PacketBufferHandle aPayload)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    WriteResponse::Parser response;
+    AttributeStatusList::Parser attributeStatusList;
+    System::PacketBufferTLVReader reader;
+    TLV::TLVReader attributeStatusListReader;
+    uint8_t attributeIndex = 0;
+
+    reader.Init(std::move(aPayload));
+    err = reader.Next();
+    SuccessOrExit(err);
+
+    err = response.Init(reader);
+    SuccessOrExit(err);
+
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    err = response.CheckSchemaValidity();
+    SuccessOrExit(err);
+#endif
+
+    err = response.GetAttributeStatusList(&attributeStatusList);
+    SuccessOrExit(err);
+
+    attributeStatusList.GetReader(&attributeStatusListReader);
+    while (CHIP_NO_ERROR == (err = attributeStatusListReader.Next()))
+    {
+        AttributeStatusElement::Parser element;
+        AttributePath::Parser attributePathParser;
+        StatusElement::Parser statusElementParser;
+        AttributePathParams attributePathParams;
+        Protocols::SecureChannel::GeneralStatusCode generalCode = Protocols::SecureChannel::GeneralStatusCode::kSuccess;
+        uint32_t protocolId                                     = 0;
+        uint16_t protocolCode                                   = 0;
+        uint32_t presenceMask                                   = 0;
+
+        err = element.Init(attributeStatusListReader);
+        SuccessOrExit(err);
+
+        err = element.GetAttributePath(&attributePathParser);
+        SuccessOrExit(err);
+        err = attributePathParser.DecodeAttributePath(&(attributePathParams.mNodeId), &(attributePathParams.mEndpointId),
+                                                      &(attributePathParams.mClusterId), &(attributePathParams.mFieldId),
+                                                      &(attributePathParams.mListIndex), &presenceMask);
+        SuccessOrExit(err);
+        attributePathParams.mFlags = (presenceMask & (1u << AttributePath::kCsTag_ListIndex)) ? AttributePathFlags::kListIndexValid
+                                                                                              : AttributePathFlags::kFieldIdValid;
+
+        err = element.GetStatusElement(&statusElementParser);
+        SuccessOrExit(err);
+        err = statusElementParser.DecodeStatusElement(&generalCode, &protocolId, &protocolCode);
+        SuccessOrExit(err);
+
+        attributeIndex++;
+        if (mpDelegate != nullptr)
+        {
+            mpDelegate->WriteResponseStatus(this, generalCode, protocolId, protocolCode, attributePathParams, attributeIndex);
+        }
+    }
+
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR WriteClient::ClearExistingExchangeContext()
+{
+    if (mpExchangeCtx != nullptr)
+    {
+        mpExchangeCtx->Abort();
+        mpExchangeCtx = nullptr;
+    }
+
+    return CHIP_NO_ERROR;
+}
+}; // namespace app
+}; // namespace chip
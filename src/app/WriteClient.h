@@ -0,0 +1,201 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines write client for a CHIP Interaction Data model
+ *
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/InteractionModelDelegate.h>
+#include <app/MessageDef/WriteRequest.h>
+#include <app/MessageDef/WriteResponse.h>
+#include <app/ObjectPool.h>
+#include <core/CHIPCore.h>
+#include <core/CHIPTLV.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/Flags.h>
+#include <protocols/Protocols.h>
+#include <support/Arena.h>
+#include <support/CodeUtils.h>
+#include <support/DLLUtil.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemLayer.h>
+#include <system/SystemPacketBuffer.h>
+
+/**
+ * The number of attributes a write client can gather into a single Write Request.
+ */
+#ifndef CHIP_IM_MAX_NUM_WRITE_ATTRIBUTES
+#define CHIP_IM_MAX_NUM_WRITE_ATTRIBUTES 8
+#endif
+
+/**
+ * The size of the arena a write client holds the TLV-encoded values of its attributes in until they are sent, in bytes. The
+ * values share it, whatever their size, and it is freed at once when they go in a Write Request.
+ */
+#ifndef CHIP_IM_WRITE_CLIENT_ARENA_SIZE
+#define CHIP_IM_WRITE_CLIENT_ARENA_SIZE 512
+#endif
+
+namespace chip {
+namespace app {
+/**
+ *  @class WriteClient
+ *
+ *  @brief The write client represents the initiator side of a Write Interaction, and is responsible
+ *  for generating one Write Request for a set of attributes of a node, and handling the Write Response.
+ *
+ *  The writes are held by the client until the request is sent, and a write to an attribute already waiting to be sent
+ *  replaces the value it had: the latest value wins. A write can wait for a coalescing window, so that a burst of writes
+ *  to the same attributes, such as those of a slider, only sends the last of them.
+ */
+class WriteClient : public PoolableObject, public Messaging::ExchangeDelegate
+{
+public:
+    /**
+     *  Shut down the Client. This terminates this instance of the object and releases
+     *  all held resources.  The object must not be used after Shutdown() is called.
+     *
+     *  SDK consumer can choose when to shut down the WriteClient.
+     *  The WriteClient will never shut itself down, unless the overall InteractionModelEngine is shut down.
+     */
+    void Shutdown();
+
+    /**
+     *  Start the write of a value to an attribute. The value is then encoded, with the tag
+     *  TLV::ContextTag(AttributeDataElement::kCsTag_Data), by the writer of GetAttributeDataElementTLVWriter, and the write
+     *  is added to the next Write Request by FinishAttribute.
+     *
+     *  @param[in]    aAttributePathParams    The path of the attribute, which cannot be a wildcard.
+     *
+     *  @retval #CHIP_ERROR_INVALID_ARGUMENT If the path does not name a single attribute
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR PrepareAttribute(const AttributePathParams & aAttributePathParams);
+    TLV::TLVWriter * GetAttributeDataElementTLVWriter() { return &mDataWriter; }
+
+    /**
+     *  Add the write started by PrepareAttribute to the next Write Request, in place of any value for the same attribute
+     *  still waiting to be sent.
+     *
+     *  @retval #CHIP_ERROR_NO_MEMORY If the request already holds CHIP_IM_MAX_NUM_WRITE_ATTRIBUTES attributes
+     *  @retval #CHIP_ERROR_BUFFER_TOO_SMALL If the values waiting to be sent fill CHIP_IM_WRITE_CLIENT_ARENA_SIZE
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR FinishAttribute();
+
+    /**
+     *  Send the writes added by FinishAttribute to a node in a single Write Request, aCoalesceWindowMs later. The writes
+     *  added until then go with it. While a request is waiting for its response, the next one is sent as soon as the
+     *  response comes. The status the node answers every attribute with is passed to
+     *  InteractionModelDelegate::WriteResponseStatus, then InteractionModelDelegate::WriteResponseProcessed, or
+     *  InteractionModelDelegate::WriteResponseError, ends the request.
+     *
+     *  @param[in]    aNodeId             Node Id
+     *  @param[in]    aAdminId            Admin ID
+     *  @param[in]    aCoalesceWindowMs   How long to wait for more writes before sending the request, in milliseconds
+     *
+     *  @retval #CHIP_ERROR_INCORRECT_STATE If the writes of the client are already for another node
+     *  @retval #others fail to send write request
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR SendWriteRequest(NodeId aNodeId, Transport::AdminId aAdminId, uint32_t aCoalesceWindowMs = 0);
+
+private:
+    friend class TestWriteInteraction;
+    friend class InteractionModelEngine;
+    template <class T, size_t N>
+    friend class ObjectPool;
+
+    enum class ClientState
+    {
+        Uninitialized = 0, //< The client has not been initialized
+        Initialized,       //< The client has been initialized and is ready for a SendWriteRequest
+        AwaitingWindow,    //< The client is waiting for the end of the coalescing window to send the write request
+        AwaitingResponse,  //< The client has sent out the write request message
+    };
+
+    struct AttributeWrite
+    {
+        AttributePathParams mPath;
+        uint32_t mDataLength = 0;
+        uint8_t * mData      = nullptr;
+    };
+
+    /**
+     *  Initialize the client object. Within the lifetime
+     *  of this instance, this method is invoked once after object
+     *  construction until a call to Shutdown is made to terminate the
+     *  instance.
+     *
+     *  @param[in]    apExchangeMgr    A pointer to the ExchangeManager object.
+     *  @param[in]    apDelegate       InteractionModelDelegate set by application.
+     *
+     *  @retval #CHIP_ERROR_INCORRECT_STATE incorrect state if it is already initialized
+     *  @retval #CHIP_NO_ERROR On success.
+     *
+     */
+    CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate);
+
+    virtual ~WriteClient() = default;
+
+    void OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PacketHeader & aPacketHeader,
+                           const PayloadHeader & aPayloadHeader, System::PacketBufferHandle aPayload) override;
+    void OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext) override;
+
+    /**
+     *  Check if current write client is being used
+     *
+     */
+    bool IsFree() const { return mState == ClientState::Uninitialized; };
+
+    static void OnCoalesceWindowEnd(System::Layer * aSystemLayer, void * apAppState, System::Error aError);
+    CHIP_ERROR SendPendingWrites();
+    CHIP_ERROR BuildWriteRequest(System::PacketBufferHandle & aMsgBuf);
+    CHIP_ERROR ProcessWriteResponse(System::PacketBufferHandle aPayload);
+    void WriteResponseDone(CHIP_ERROR aError);
+
+    void MoveToState(const ClientState aTargetState);
+    CHIP_ERROR ClearExistingExchangeContext();
+    const char * GetStateStr() const;
+
+    Messaging::ExchangeManager * mpExchangeMgr = nullptr;
+    Messaging::ExchangeContext * mpExchangeCtx = nullptr;
+    InteractionModelDelegate * mpDelegate      = nullptr;
+    ClientState mState                         = ClientState::Uninitialized;
+    NodeId mNodeId                             = kUndefinedNodeId;
+    Transport::AdminId mAdminId                = 0;
+    // Whether writes are waiting for the response to the request in flight to be sent.
+    bool mSendAfterResponse = false;
+
+    AttributePathParams mPreparedPath;
+    TLV::TLVWriter mDataWriter;
+    TLV::TLVType mDataOuterType = TLV::kTLVType_NotSpecified;
+    AttributeWrite mWrites[CHIP_IM_MAX_NUM_WRITE_ATTRIBUTES];
+    // The values of mWrites, and the one being prepared, past them.
+    ArenaAllocator<CHIP_IM_WRITE_CLIENT_ARENA_SIZE> mArena;
+    size_t mNumWrites = 0;
+};
+
+}; // namespace app
+}; // namespace chip
@@ -0,0 +1,264 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the responder side of a CHIP Write Interaction.
+ *
+ */
+
+#include <app/AttributeObserverRegistry.h>
+#include <app/InteractionModelEngine.h>
+#include <app/WriteHandler.h>
+
+using GeneralStatusCode = chip::Protocols::SecureChannel::GeneralStatusCode;
+
+namespace chip {
+namespace app {
+CHIP_ERROR WriteHandler::Init(InteractionModelDelegate * apDelegate)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferHandle msgBuf;
+
+    // Error if already initialized.
+    VerifyOrExit(mpExchangeCtx == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+
+    mMessageWriter.Init(std::move(msgBuf));
+    err = mWriteResponseBuilder.Init(&mMessageWriter);
+    SuccessOrExit(err);
+
+    mAttributeStatusListBuilder = mWriteResponseBuilder.CreateAttributeStatusListBuilder();
+    SuccessOrExit(err = mAttributeStatusListBuilder.GetError());
+
+    mpDelegate = apDelegate;
+    mState     = HandlerState::Initialized;
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+void WriteHandler::Shutdown()
+{
+    mMessageWriter.Reset();
+    ClearExistingExchangeContext();
+    mpDelegate = nullptr;
+    mState     = HandlerState::Uninitialized;
+    ReleaseToPool();
+}
+
+CHIP_ERROR WriteHandler::OnWriteRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle aPayload)
+{
+    CHIP_ERROR err        = CHIP_NO_ERROR;
+    bool suppressResponse = false;
+
+    mpExchangeCtx = apExchangeContext;
+
+    err = ProcessWriteRequest(std::move(aPayload), suppressResponse);
+    SuccessOrExit(err);
+
+    if (!suppressResponse)
+    {
+        err = SendWriteResponse();
+        SuccessOrExit(err);
+    }
+
+exit:
+    ChipLogFunctError(err);
+    Shutdown();
+    return err;
+}
+
+CHIP_ERROR WriteHandler::ProcessWriteRequest(System::PacketBufferHandle aPayload, bool & aSuppressResponse)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferTLVReader reader;
+    WriteRequest::Parser writeRequestParser;
+    AttributeDataList::Parser attributeDataListParser;
+    TLV::TLVReader attributeDataListReader;
+
+    reader.Init(std::move(aPayload));
+
+    err = reader.Next();
+    SuccessOrExit(err);
+
+    err = writeRequestParser.Init(reader);
+    SuccessOrExit(err);
+
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    err = writeRequestParser.CheckSchemaValidity();
+    SuccessOrExit(err);
+#endif
+
+    err = writeRequestParser.GetSuppressResponse(&aSuppressResponse);
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    SuccessOrExit(err);
+
+    err = writeRequestParser.GetAttributeDataList(&attributeDataListParser);
+    SuccessOrExit(err);
+
+    attributeDataListParser.GetReader(&attributeDataListReader);
+    {
+        // Observers of the attributes are told once all of them are written.
+        AttributeObserverRegistry::ScopedBatch batch;
+        err = ProcessAttributeDataList(attributeDataListReader);
+    }
+    SuccessOrExit(err);
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR WriteHandler::ProcessAttributeDataList(TLV::TLVReader & aAttributeDataListReader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    // Every attribute of the request is written in this one pass, and answered by a status of its own.
+    while (CHIP_NO_ERROR == (err = aAttributeDataListReader.Next()))
+    {
+        chip::TLV::TLVReader dataReader;
+        AttributeDataElement::Parser element;
+        AttributePath::Parser attributePathParser;
+        AttributePathParams attributePathParams;
+        uint32_t presenceMask       = 0;
+        const uint32_t requiredMask = (1u << AttributePath::kCsTag_EndpointId) | (1u << AttributePath::kCsTag_ClusterId);
+        TLV::TLVReader reader       = aAttributeDataListReader;
+
+        err = element.Init(reader);
+        SuccessOrExit(err);
+
+        err = element.GetAttributePath(&attributePathParser);
+        SuccessOrExit(err);
+
+        err = attributePathParser.DecodeAttributePath(&(attributePathParams.mNodeId), &(attributePathParams.mEndpointId),
+                                                      &(attributePathParams.mClusterId), &(attributePathParams.mFieldId),
+                                                      &(attributePathParams.mListIndex), &presenceMask);
+        SuccessOrExit(err);
+
+        if (presenceMask & (1u << AttributePath::kCsTag_FieldId))
+        {
+            attributePathParams.mFlags = AttributePathFlags::kFieldIdValid;
+        }
+        else if (presenceMask & (1u << AttributePath::kCsTag_ListIndex))
+        {
+            attributePathParams.mFlags = AttributePathFlags::kListIndexValid;
+        }
+
+        if ((presenceMask & requiredMask) != requiredMask || !attributePathParams.mFlags.HasAny() ||
+            element.GetData(&dataReader) != CHIP_NO_ERROR)
+        {
+            err = AddAttributeStatus(attributePathParams, GeneralStatusCode::kInvalidArgument,
+                                     Protocols::SecureChannel::kProtocolCodeGeneralFailure);
+        }
+        else if (WriteSingleClusterData(attributePathParams, dataReader) != CHIP_NO_ERROR)
+        {
+            err = AddAttributeStatus(attributePathParams, GeneralStatusCode::kFailure,
+                                     Protocols::SecureChannel::kProtocolCodeGeneralFailure);
+        }
+        else
+        {
+            err = AddAttributeStatus(attributePathParams, GeneralStatusCode::kSuccess,
+                                     Protocols::SecureChannel::kProtocolCodeSuccess);
+        }
+        SuccessOrExit(err);
+    }
+
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR WriteHandler::AddAttributeStatus(const AttributePathParams & aAttributePathParams,
+                                            const Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
+                                            const uint16_t aProtocolCode)
+{
+    AttributeStatusElement::Builder attributeStatusElement = mAttributeStatusListBuilder.CreateAttributeStatusBuilder();
+    ReturnErrorOnFailure(attributeStatusElement.GetError());
+
+    AttributePath::Builder attributePathBuilder = attributeStatusElement.CreateAttributePathBuilder();
+    attributePathBuilder.NodeId(aAttributePathParams.mNodeId)
+        .EndpointId(aAttributePathParams.mEndpointId)
+        .ClusterId(aAttributePathParams.mClusterId);
+    if (aAttributePathParams.mFlags.Has(AttributePathFlags::kListIndexValid))
+    {
+        attributePathBuilder.ListIndex(aAttributePathParams.mListIndex);
+    }
+    else
+    {
+        attributePathBuilder.FieldId(aAttributePathParams.mFieldId);
+    }
+    attributePathBuilder.EndOfAttributePath();
+    ReturnErrorOnFailure(attributePathBuilder.GetError());
+
+    StatusElement::Builder statusElementBuilder = attributeStatusElement.CreateStatusElementBuilder();
+    statusElementBuilder.EncodeStatusElement(aGeneralCode, Protocols::SecureChannel::Id.ToFullyQualifiedSpecForm(), aProtocolCode)
+        .EndOfStatusElement();
+    ReturnErrorOnFailure(statusElementBuilder.GetError());
+
+    attributeStatusElement.EndOfAttributeStatusElement();
+    return attributeStatusElement.GetError();
+}
+
+CHIP_ERROR WriteHandler::SendWriteResponse()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferHandle packet;
+
+    mAttributeStatusListBuilder.EndOfAttributeStatusList();
+    SuccessOrExit(err = mAttributeStatusListBuilder.GetError());
+
+    mWriteResponseBuilder.EndOfWriteResponse();
+    SuccessOrExit(err = mWriteResponseBuilder.GetError());
+
+    err = mMessageWriter.Finalize(&packet);
+    SuccessOrExit(err);
+
+    VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::WriteResponse, std::move(packet),
+                                     Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+    SuccessOrExit(err);
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR WriteHandler::ClearExistingExchangeContext()
+{
+    if (mpExchangeCtx != nullptr)
+    {
+        mpExchangeCtx->Abort();
+        mpExchangeCtx = nullptr;
+    }
+
+    return CHIP_NO_ERROR;
+}
+} // namespace app
+} // namespace chip
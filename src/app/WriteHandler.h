@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines write handler for a CHIP Interaction Data model
+ *
+ */
+
+#pragma once
+
+#include <app/InteractionModelDelegate.h>
+#include <app/MessageDef/WriteRequest.h>
+#include <app/MessageDef/WriteResponse.h>
+#include <app/ObjectPool.h>
+#include <core/CHIPCore.h>
+#include <core/CHIPTLV.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/Flags.h>
+#include <protocols/Protocols.h>
+#include <support/CodeUtils.h>
+#include <support/DLLUtil.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemPacketBuffer.h>
+
+namespace chip {
+namespace app {
+/**
+ *  @class WriteHandler
+ *
+ *  @brief The write handler is responsible for processing a write request, writing every attribute of it to the
+ *         attribute store in a single pass, and answering them all in a single Write Response.
+ *
+ */
+class WriteHandler : public PoolableObject
+{
+public:
+    /**
+     *  Initialize the WriteHandler. Within the lifetime
+     *  of this instance, this method is invoked once after object
+     *  construction until a call to Shutdown is made to terminate the
+     *  instance.
+     *
+     *  @param[in]    apDelegate       InteractionModelDelegate set by application.
+     *
+     *  @retval #CHIP_ERROR_INCORRECT_STATE If the state is not equal to
+     *          kState_NotInitialized.
+     *  @retval #CHIP_NO_ERROR On success.
+     *
+     */
+    CHIP_ERROR Init(InteractionModelDelegate * apDelegate);
+
+    /**
+     *  Shut down the WriteHandler. This terminates this instance
+     *  of the object and releases all held resources.
+     *
+     */
+    void Shutdown();
+
+    /**
+     *  Process a write request, then send the Write Response unless the initiator suppressed it. The WriteHandler
+     *  calls Shutdown on itself once done, including if OnWriteRequest returns an error.
+     *
+     *  @param[in]    apExchangeContext    A pointer to the ExchangeContext.
+     *  @param[in]    aPayload             A payload that has write request data
+     *
+     *  @retval #Others If fails to process write request
+     *  @retval #CHIP_NO_ERROR On success.
+     *
+     */
+    CHIP_ERROR OnWriteRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle aPayload);
+
+    bool IsFree() const { return mState == HandlerState::Uninitialized; }
+
+    virtual ~WriteHandler() = default;
+
+private:
+    friend class TestWriteInteraction;
+
+    enum class HandlerState
+    {
+        Uninitialized = 0, //< The handler has not been initialized
+        Initialized,       //< The handler has been initialized and is ready
+    };
+
+    CHIP_ERROR ProcessWriteRequest(System::PacketBufferHandle aPayload, bool & aSuppressResponse);
+    CHIP_ERROR ProcessAttributeDataList(TLV::TLVReader & aAttributeDataListReader);
+    CHIP_ERROR AddAttributeStatus(const AttributePathParams & aAttributePathParams,
+                                  const Protocols::SecureChannel::GeneralStatusCode aGeneralCode, const uint16_t aProtocolCode);
+    CHIP_ERROR SendWriteResponse();
+    CHIP_ERROR ClearExistingExchangeContext();
+
+    Messaging::ExchangeContext * mpExchangeCtx = nullptr;
+    InteractionModelDelegate * mpDelegate      = nullptr;
+    HandlerState mState                        = HandlerState::Uninitialized;
+
+    System::PacketBufferTLVWriter mMessageWriter;
+    WriteResponse::Builder mWriteResponseBuilder;
+    AttributeStatusList::Builder mAttributeStatusListBuilder;
+};
+} // namespace app
+} // namespace chip
@@ -45,6 +45,7 @@
 #include <app/reporting/reporting.h>
 #include <app/util/af-event.h>
 #include <app/util/attribute-storage.h>
+#include <app/util/transition-engine.h>
 #include <assert.h>
 
 #include "gen/af-structs.h"
@@ -54,10 +55,6 @@
 
 using namespace chip;
 
-#define COLOR_TEMP_CONTROL emberAfPluginColorControlServerTempTransitionEventControl
-#define COLOR_XY_CONTROL emberAfPluginColorControlServerXyTransitionEventControl
-#define COLOR_HSV_CONTROL emberAfPluginColorControlServerHueSatTransitionEventControl
-
 // move mode
 enum
 {
@@ -90,7 +87,6 @@ EmberEventControl emberAfPluginColorControlServerTempTransitionEventControl;
 EmberEventControl emberAfPluginColorControlServerXyTransitionEventControl;
 EmberEventControl emberAfPluginColorControlServerHueSatTransitionEventControl;
 
-#define UPDATE_TIME_MS 100
 #define TRANSITION_TIME_1S 10
 #define MIN_CIE_XY_VALUE 0
 // this value comes directly from the ZCL specification table 5.3
@@ -142,8 +138,7 @@ static Color16uTransitionState colorTempTransitionState;
 static Color16uTransitionState colorSaturationTransitionState;
 
 // Forward declarations:
-static bool computeNewColor16uValue(Color16uTransitionState * p);
-static void stopAllColorTransitions(void);
+static void stopAllColorTransitions(EndpointId endpoint);
 static void handleModeSwitch(EndpointId endpoint, uint8_t newColorMode);
 static bool shouldExecuteIfOff(EndpointId endpoint, uint8_t optionMask, uint8_t optionOverride);
 
@@ -153,6 +148,7 @@ static uint8_t subtractHue(uint8_t hue1, uint8_t hue2);
 static uint8_t addSaturation(uint8_t saturation1, uint8_t saturation2);
 static uint8_t subtractSaturation(uint8_t saturation1, uint8_t saturation2);
 static void initHueSat(EndpointId endpoint);
+static void startHueSatTransition(void);
 static uint8_t readHue(EndpointId endpoint);
 static uint8_t readSaturation(EndpointId endpoint);
 #endif
@@ -161,6 +157,11 @@ static uint8_t readSaturation(EndpointId endpoint);
 static uint16_t findNewColorValueFromStep(uint16_t oldValue, int16_t step);
 static uint16_t readColorX(EndpointId endpoint);
 static uint16_t readColorY(EndpointId endpoint);
+static void startXyTransition(void);
+#endif
+
+#ifdef EMBER_AF_PLUGIN_COLOR_CONTROL_SERVER_TEMP
+static void startTempTransition(void);
 #endif
 
 static uint16_t computeTransitionTimeFromStateAndRate(Color16uTransitionState * p, uint16_t rate);
@@ -388,7 +389,7 @@ bool emberAfColorControlClusterMoveToHueAndSaturationCallback(chip::app::Command
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     // Handle color mode transition, if necessary.
     handleModeSwitch(endpoint, COLOR_MODE_HSV);
@@ -417,7 +418,7 @@ bool emberAfColorControlClusterMoveToHueAndSaturationCallback(chip::app::Command
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
+    startHueSatTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -435,7 +436,7 @@ bool emberAfColorControlClusterMoveHueCallback(chip::app::Command * commandObj,
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     if (moveMode == EMBER_ZCL_HUE_MOVE_MODE_STOP)
     {
@@ -477,7 +478,7 @@ bool emberAfColorControlClusterMoveHueCallback(chip::app::Command * commandObj,
     colorSaturationTransitionState.stepsRemaining = 0;
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
+    startHueSatTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -497,7 +498,7 @@ bool emberAfColorControlClusterMoveSaturationCallback(chip::app::Command * comma
     uint16_t transitionTime;
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     if (moveMode == EMBER_ZCL_SATURATION_MOVE_MODE_STOP || rate == 0)
     {
@@ -535,7 +536,7 @@ bool emberAfColorControlClusterMoveSaturationCallback(chip::app::Command * comma
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
+    startHueSatTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -606,7 +607,7 @@ bool emberAfColorControlClusterMoveToHueCallback(chip::app::Command * commandObj
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     // Handle color mode transition, if necessary.
     handleModeSwitch(endpoint, COLOR_MODE_HSV);
@@ -628,7 +629,7 @@ bool emberAfColorControlClusterMoveToHueCallback(chip::app::Command * commandObj
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
+    startHueSatTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -659,7 +660,7 @@ bool emberAfColorControlClusterMoveToSaturationCallback(chip::app::Command * com
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     // Handle color mode transition, if necessary.
     handleModeSwitch(endpoint, COLOR_MODE_HSV);
@@ -681,7 +682,7 @@ bool emberAfColorControlClusterMoveToSaturationCallback(chip::app::Command * com
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
+    startHueSatTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -706,7 +707,7 @@ bool emberAfColorControlClusterStepHueCallback(chip::app::Command * commandObj,
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     if (stepMode == MOVE_MODE_STOP)
     {
@@ -743,7 +744,7 @@ bool emberAfColorControlClusterStepHueCallback(chip::app::Command * commandObj,
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
+    startHueSatTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -768,7 +769,7 @@ bool emberAfColorControlClusterStepSaturationCallback(chip::app::Command * comma
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     if (stepMode == MOVE_MODE_STOP)
     {
@@ -804,7 +805,7 @@ bool emberAfColorControlClusterStepSaturationCallback(chip::app::Command * comma
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
+    startHueSatTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -898,7 +899,7 @@ bool emberAfColorControlClusterMoveToColorCallback(chip::app::Command * commandO
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     // Handle color mode transition, if necessary.
     handleModeSwitch(endpoint, COLOR_MODE_CIE_XY);
@@ -925,7 +926,7 @@ bool emberAfColorControlClusterMoveToColorCallback(chip::app::Command * commandO
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_XY_CONTROL, UPDATE_TIME_MS);
+    startXyTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -946,7 +947,7 @@ bool emberAfColorControlClusterMoveColorCallback(chip::app::Command * commandObj
     uint16_t unsignedRate;
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     if (rateX == 0 && rateY == 0)
     {
@@ -1006,7 +1007,7 @@ bool emberAfColorControlClusterMoveColorCallback(chip::app::Command * commandObj
     }
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_XY_CONTROL, UPDATE_TIME_MS);
+    startXyTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -1032,7 +1033,7 @@ bool emberAfColorControlClusterStepColorCallback(chip::app::Command * commandObj
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     // Handle color mode transition, if necessary.
     handleModeSwitch(endpoint, COLOR_MODE_CIE_XY);
@@ -1059,7 +1060,7 @@ bool emberAfColorControlClusterStepColorCallback(chip::app::Command * commandObj
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_XY_CONTROL, UPDATE_TIME_MS);
+    startXyTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -1131,7 +1132,7 @@ static void moveToColorTemp(EndpointId endpoint, uint16_t colorTemperature, uint
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     // Handle color mode transition, if necessary.
     handleModeSwitch(endpoint, COLOR_MODE_TEMPERATURE);
@@ -1157,7 +1158,7 @@ static void moveToColorTemp(EndpointId endpoint, uint16_t colorTemperature, uint
     colorTempTransitionState.highLimit      = temperatureMax;
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_TEMP_CONTROL, UPDATE_TIME_MS);
+    startTempTransition();
 }
 
 bool emberAfColorControlClusterMoveToColorTemperatureCallback(chip::app::Command * commandObj, uint16_t colorTemperature,
@@ -1194,7 +1195,7 @@ bool emberAfColorControlClusterMoveColorTemperatureCallback(chip::app::Command *
     uint16_t transitionTime;
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     if (moveMode == MOVE_MODE_STOP)
     {
@@ -1255,7 +1256,7 @@ bool emberAfColorControlClusterMoveColorTemperatureCallback(chip::app::Command *
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_TEMP_CONTROL, UPDATE_TIME_MS);
+    startTempTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -1283,7 +1284,7 @@ bool emberAfColorControlClusterStepColorTemperatureCallback(chip::app::Command *
     }
 
     // New command.  Need to stop any active transitions.
-    stopAllColorTransitions();
+    stopAllColorTransitions(endpoint);
 
     if (stepMode == MOVE_MODE_STOP)
     {
@@ -1323,7 +1324,7 @@ bool emberAfColorControlClusterStepColorTemperatureCallback(chip::app::Command *
     writeRemainingTime(endpoint, transitionTime);
 
     // kick off the state machine:
-    emberEventControlSetDelayMS(&COLOR_TEMP_CONTROL, UPDATE_TIME_MS);
+    startTempTransition();
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
     return true;
@@ -1406,7 +1407,7 @@ bool emberAfColorControlClusterStopMoveStepCallback(chip::app::Command * command
 
     if (shouldExecuteIfOff(endpoint, optionsMask, optionsOverride))
     {
-        stopAllColorTransitions();
+        stopAllColorTransitions(endpoint);
     }
 
     emberAfSendImmediateDefaultResponse(EMBER_ZCL_STATUS_SUCCESS);
@@ -1415,16 +1416,165 @@ bool emberAfColorControlClusterStopMoveStepCallback(chip::app::Command * command
 
 // **************** transition state machines ***********
 
-static void stopAllColorTransitions(void)
+// The transitions are run by the transition engine, on every endpoint at once.
+// A command fills in the states above, and then starts the transitions they
+// describe.
+
+static void colorTransitionCallback(const EmberAfTransition * transition, bool written);
+
+static bool colorTransitionActive(EndpointId endpoint, AttributeId attributeId)
+{
+    return emberAfTransitionFind(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, attributeId) != NULL;
+}
+
+static void startColorTransition(EndpointId endpoint, AttributeId attributeId, EmberAfAttributeType attributeType,
+                                 int32_t startValue, int32_t targetValue, uint16_t transitionTime, uint32_t modulus, bool repeat)
+{
+    EmberAfTransition transition = {};
+
+    transition.endpoint      = endpoint;
+    transition.clusterId     = ZCL_COLOR_CONTROL_CLUSTER_ID;
+    transition.attributeId   = attributeId;
+    transition.attributeType = attributeType;
+    transition.startValue    = startValue;
+    transition.targetValue   = targetValue;
+    // Transition time comes in as tenths of a second, but we work in
+    // milliseconds.
+    transition.durationMs = static_cast<uint32_t>(transitionTime) * MILLISECOND_TICKS_PER_DECISECOND;
+    transition.modulus    = modulus;
+    transition.repeat     = repeat;
+    transition.callback   = colorTransitionCallback;
+    if (emberAfTransitionStart(&transition) != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        emberAfColorControlClusterPrintln("ERR: starting transition of attribute 0x%2x", attributeId);
+    }
+}
+
+#ifdef EMBER_AF_PLUGIN_COLOR_CONTROL_SERVER_HSV
+static void startHueSatTransition(void)
+{
+    ColorHueTransitionState * hue        = &colorHueTransitionState;
+    Color16uTransitionState * saturation = &colorSaturationTransitionState;
+
+    if (hue->stepsRemaining > 0)
+    {
+        // The hue goes around the wheel the way the state says.
+        int32_t distance = hue->up ? subtractHue(hue->finalHue, hue->initialHue) : -subtractHue(hue->initialHue, hue->finalHue);
+        startColorTransition(hue->endpoint, ZCL_COLOR_CONTROL_CURRENT_HUE_ATTRIBUTE_ID, ZCL_INT8U_ATTRIBUTE_TYPE, hue->initialHue,
+                             hue->initialHue + distance, hue->stepsTotal, MAX_HUE_VALUE + 1, hue->repeat);
+    }
+    if (saturation->stepsRemaining > 0)
+    {
+        startColorTransition(saturation->endpoint, ZCL_COLOR_CONTROL_CURRENT_SATURATION_ATTRIBUTE_ID, ZCL_INT8U_ATTRIBUTE_TYPE,
+                             saturation->initialValue, saturation->finalValue, saturation->stepsTotal, 0, false);
+    }
+}
+#endif // EMBER_AF_PLUGIN_COLOR_CONTROL_SERVER_HSV
+
+#ifdef EMBER_AF_PLUGIN_COLOR_CONTROL_SERVER_XY
+static void startXyTransition(void)
+{
+    if (colorXTransitionState.stepsRemaining > 0)
+    {
+        startColorTransition(colorXTransitionState.endpoint, ZCL_COLOR_CONTROL_CURRENT_X_ATTRIBUTE_ID, ZCL_INT16U_ATTRIBUTE_TYPE,
+                             colorXTransitionState.initialValue, colorXTransitionState.finalValue, colorXTransitionState.stepsTotal,
+                             0, false);
+    }
+    if (colorYTransitionState.stepsRemaining > 0)
+    {
+        startColorTransition(colorYTransitionState.endpoint, ZCL_COLOR_CONTROL_CURRENT_Y_ATTRIBUTE_ID, ZCL_INT16U_ATTRIBUTE_TYPE,
+                             colorYTransitionState.initialValue, colorYTransitionState.finalValue, colorYTransitionState.stepsTotal,
+                             0, false);
+    }
+}
+#endif // EMBER_AF_PLUGIN_COLOR_CONTROL_SERVER_XY
+
+#ifdef EMBER_AF_PLUGIN_COLOR_CONTROL_SERVER_TEMP
+static void startTempTransition(void)
+{
+    startColorTransition(colorTempTransitionState.endpoint, ZCL_COLOR_CONTROL_COLOR_TEMPERATURE_ATTRIBUTE_ID,
+                         ZCL_INT16U_ATTRIBUTE_TYPE, colorTempTransitionState.initialValue, colorTempTransitionState.finalValue,
+                         colorTempTransitionState.stepsTotal, 0, false);
+}
+#endif // EMBER_AF_PLUGIN_COLOR_CONTROL_SERVER_TEMP
+
+static bool colorTransitionsActive(EndpointId endpoint)
+{
+    return colorTransitionActive(endpoint, ZCL_COLOR_CONTROL_CURRENT_HUE_ATTRIBUTE_ID) ||
+        colorTransitionActive(endpoint, ZCL_COLOR_CONTROL_CURRENT_SATURATION_ATTRIBUTE_ID) ||
+        colorTransitionActive(endpoint, ZCL_COLOR_CONTROL_CURRENT_X_ATTRIBUTE_ID) ||
+        colorTransitionActive(endpoint, ZCL_COLOR_CONTROL_CURRENT_Y_ATTRIBUTE_ID) ||
+        colorTransitionActive(endpoint, ZCL_COLOR_CONTROL_COLOR_TEMPERATURE_ATTRIBUTE_ID);
+}
+
+static void colorTransitionCallback(const EmberAfTransition * transition, bool written)
+{
+    EndpointId endpoint = transition->endpoint;
+
+    if (written)
+    {
+        emberAfColorControlClusterPrintln("Color attribute 0x%2x %d endpoint %d", transition->attributeId, transition->currentValue,
+                                          endpoint);
+
+        // The remaining time is only written along with the color.  A hue
+        // move has no end, and keeps the remaining time it started with.
+        if (transition->status == EMBER_AF_TRANSITION_RUNNING && !transition->repeat)
+        {
+            uint32_t remainingMs = emberAfTransitionGetRemainingMs(transition);
+            writeRemainingTime(endpoint,
+                               static_cast<uint16_t>((remainingMs + MILLISECOND_TICKS_PER_DECISECOND - 1) /
+                                                     MILLISECOND_TICKS_PER_DECISECOND));
+        }
+    }
+    if (transition->status != EMBER_AF_TRANSITION_RUNNING && !colorTransitionsActive(endpoint))
+    {
+        writeRemainingTime(endpoint, 0);
+    }
+
+    // The PWMs are driven on every tick, not only when an attribute is
+    // written, and once for a hue and saturation, or an X and Y, moving
+    // together.
+    switch (transition->attributeId)
+    {
+    case ZCL_COLOR_CONTROL_CURRENT_SATURATION_ATTRIBUTE_ID:
+        if (colorTransitionActive(endpoint, ZCL_COLOR_CONTROL_CURRENT_HUE_ATTRIBUTE_ID))
+        {
+            break;
+        }
+        emberAfPluginColorControlServerComputePwmFromHsvCallback(endpoint);
+        break;
+    case ZCL_COLOR_CONTROL_CURRENT_HUE_ATTRIBUTE_ID:
+        emberAfPluginColorControlServerComputePwmFromHsvCallback(endpoint);
+        break;
+    case ZCL_COLOR_CONTROL_CURRENT_Y_ATTRIBUTE_ID:
+        if (colorTransitionActive(endpoint, ZCL_COLOR_CONTROL_CURRENT_X_ATTRIBUTE_ID))
+        {
+            break;
+        }
+        emberAfPluginColorControlServerComputePwmFromXyCallback(endpoint);
+        break;
+    case ZCL_COLOR_CONTROL_CURRENT_X_ATTRIBUTE_ID:
+        emberAfPluginColorControlServerComputePwmFromXyCallback(endpoint);
+        break;
+    case ZCL_COLOR_CONTROL_COLOR_TEMPERATURE_ATTRIBUTE_ID:
+        emberAfPluginColorControlServerComputePwmFromTempCallback(endpoint);
+        break;
+    default:
+        break;
+    }
+}
+
+static void stopAllColorTransitions(EndpointId endpoint)
 {
-    emberEventControlSetInactive(&COLOR_TEMP_CONTROL);
-    emberEventControlSetInactive(&COLOR_XY_CONTROL);
-    emberEventControlSetInactive(&COLOR_HSV_CONTROL);
+    emberAfTransitionStopCluster(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID);
 }
 
 void emberAfPluginColorControlServerStopTransition(void)
 {
-    stopAllColorTransitions();
+    for (uint8_t i = 0; i < emberAfEndpointCount(); i++)
+    {
+        stopAllColorTransitions(emberAfEndpointFromIndex(i));
+    }
 }
 
 // The specification says that if we are transitioning from one color mode
@@ -1489,7 +1639,7 @@ static uint8_t addHue(uint8_t hue1, uint8_t hue2)
 
     if (hue16 > MAX_HUE_VALUE)
     {
-        hue16 = static_cast<uint16_t>(hue16 - MAX_HUE_VALUE);
+        hue16 = static_cast<uint16_t>(hue16 - (MAX_HUE_VALUE + 1));
     }
 
     return ((uint8_t) hue16);
@@ -1502,7 +1652,7 @@ static uint8_t subtractHue(uint8_t hue1, uint8_t hue2)
     hue16 = ((uint16_t) hue1);
     if (hue2 > hue1)
     {
-        hue16 = static_cast<uint16_t>(hue16 + MAX_HUE_VALUE);
+        hue16 = static_cast<uint16_t>(hue16 + (MAX_HUE_VALUE + 1));
     }
 
     hue16 = static_cast<uint16_t>(hue16 - static_cast<uint16_t>(hue2));
@@ -1510,146 +1660,13 @@ static uint8_t subtractHue(uint8_t hue1, uint8_t hue2)
     return ((uint8_t) hue16);
 }
 
-static bool computeNewHueValue(ColorHueTransitionState * p)
-{
-    uint32_t newHue32;
-    uint8_t newHue;
-
-    // exit with a false if hue is not currently moving
-    if (p->stepsRemaining == 0)
-    {
-        return false;
-    }
-
-    (p->stepsRemaining)--;
-
-    if (p->repeat == false)
-    {
-        writeRemainingTime(p->endpoint, p->stepsRemaining);
-    }
-
-    // are we going up or down?
-    if (p->finalHue == p->currentHue)
-    {
-        // do nothing
-    }
-    else if (p->up)
-    {
-        newHue32 = (uint32_t) subtractHue(p->finalHue, p->initialHue);
-        newHue32 *= ((uint32_t)(p->stepsRemaining));
-        newHue32 /= ((uint32_t)(p->stepsTotal));
-        p->currentHue = subtractHue((uint8_t) p->finalHue, (uint8_t) newHue32);
-    }
-    else
-    {
-        newHue32 = (uint32_t) subtractHue(p->initialHue, p->finalHue);
-        newHue32 *= ((uint32_t)(p->stepsRemaining));
-        newHue32 /= ((uint32_t)(p->stepsTotal));
-
-        p->currentHue = addHue((uint8_t) p->finalHue, (uint8_t) newHue32);
-    }
-
-    if (p->stepsRemaining == 0)
-    {
-        if (p->repeat == false)
-        {
-            // we are performing a move to and not a move.
-            return true;
-        }
-        else
-        {
-            // we are performing a Hue move.  Need to compute the new values for the
-            // next move period.
-            if (p->up)
-            {
-                newHue = subtractHue(p->finalHue, p->initialHue);
-                newHue = addHue(p->finalHue, newHue);
-
-                p->initialHue = p->finalHue;
-                p->finalHue   = newHue;
-            }
-            else
-            {
-                newHue = subtractHue(p->initialHue, p->finalHue);
-                newHue = subtractHue(p->finalHue, newHue);
-
-                p->initialHue = p->finalHue;
-                p->finalHue   = newHue;
-            }
-            p->stepsRemaining = TRANSITION_TIME_1S;
-        }
-    }
-    return false;
-}
-
-void emberAfPluginColorControlServerHueSatTransitionEventHandler(void)
-{
-    EndpointId endpoint = colorHueTransitionState.endpoint;
-    bool limitReached1, limitReached2;
-
-    limitReached1 = computeNewHueValue(&colorHueTransitionState);
-    limitReached2 = computeNewColor16uValue(&colorSaturationTransitionState);
-
-    if (limitReached1 || limitReached2)
-    {
-        stopAllColorTransitions();
-    }
-    else
-    {
-        emberEventControlSetDelayMS(&COLOR_HSV_CONTROL, UPDATE_TIME_MS);
-    }
-
-    writeHue(colorHueTransitionState.endpoint, colorHueTransitionState.currentHue);
-    writeSaturation(colorSaturationTransitionState.endpoint, (uint8_t) colorSaturationTransitionState.currentValue);
-
-    emberAfColorControlClusterPrintln("Hue %d Saturation %d endpoint %d", colorHueTransitionState.currentHue,
-                                      colorSaturationTransitionState.currentValue, endpoint);
-
-    emberAfPluginColorControlServerComputePwmFromHsvCallback(endpoint);
-}
-
-// Return value of true means we need to stop.
-static bool computeNewColor16uValue(Color16uTransitionState * p)
-{
-    uint32_t newValue32u;
-
-    if (p->stepsRemaining == 0)
-    {
-        return false;
-    }
-
-    (p->stepsRemaining)--;
+// The transitions no longer run on the event controls: the handlers are only
+// kept for the generated event table.
+void emberAfPluginColorControlServerHueSatTransitionEventHandler(void) {}
 
-    writeRemainingTime(p->endpoint, p->stepsRemaining);
+void emberAfPluginColorControlServerXyTransitionEventHandler(void) {}
 
-    // handle sign
-    if (p->finalValue == p->currentValue)
-    {
-        // do nothing
-    }
-    else if (p->finalValue > p->initialValue)
-    {
-        newValue32u = ((uint32_t)(p->finalValue - p->initialValue));
-        newValue32u *= ((uint32_t)(p->stepsRemaining));
-        newValue32u /= ((uint32_t)(p->stepsTotal));
-        p->currentValue = static_cast<uint16_t>(p->finalValue - static_cast<uint16_t>(newValue32u));
-    }
-    else
-    {
-        newValue32u = ((uint32_t)(p->initialValue - p->finalValue));
-        newValue32u *= ((uint32_t)(p->stepsRemaining));
-        newValue32u /= ((uint32_t)(p->stepsTotal));
-        p->currentValue = static_cast<uint16_t>(p->finalValue + static_cast<uint16_t>(newValue32u));
-    }
-
-    if (p->stepsRemaining == 0)
-    {
-        // we have completed our move.
-        return true;
-    }
-
-    return false;
-}
+void emberAfPluginColorControlServerTempTransitionEventHandler(void) {}
 
 static uint16_t computeTransitionTimeFromStateAndRate(Color16uTransitionState * p, uint16_t rate)
 {
@@ -1684,58 +1701,6 @@ static uint16_t computeTransitionTimeFromStateAndRate(Color16uTransitionState *
     return (uint16_t) transitionTime;
 }
 
-void emberAfPluginColorControlServerXyTransitionEventHandler(void)
-{
-    EndpointId endpoint = colorXTransitionState.endpoint;
-    bool limitReachedX, limitReachedY;
-
-    // compute new values for X and Y.
-    limitReachedX = computeNewColor16uValue(&colorXTransitionState);
-
-    limitReachedY = computeNewColor16uValue(&colorYTransitionState);
-
-    if (limitReachedX || limitReachedY)
-    {
-        stopAllColorTransitions();
-    }
-    else
-    {
-        emberEventControlSetDelayMS(&COLOR_XY_CONTROL, UPDATE_TIME_MS);
-    }
-
-    // update the attributes
-    writeColorX(colorXTransitionState.endpoint, colorXTransitionState.currentValue);
-    writeColorY(colorXTransitionState.endpoint, colorYTransitionState.currentValue);
-
-    emberAfColorControlClusterPrintln("Color X %d Color Y %d", colorXTransitionState.currentValue,
-                                      colorYTransitionState.currentValue);
-
-    emberAfPluginColorControlServerComputePwmFromXyCallback(endpoint);
-}
-
-void emberAfPluginColorControlServerTempTransitionEventHandler(void)
-{
-    EndpointId endpoint = colorTempTransitionState.endpoint;
-    bool limitReached;
-
-    limitReached = computeNewColor16uValue(&colorTempTransitionState);
-
-    if (limitReached)
-    {
-        stopAllColorTransitions();
-    }
-    else
-    {
-        emberEventControlSetDelayMS(&COLOR_TEMP_CONTROL, UPDATE_TIME_MS);
-    }
-
-    writeColorTemperature(colorTempTransitionState.endpoint, colorTempTransitionState.currentValue);
-
-    emberAfColorControlClusterPrintln("Color Temperature %d", colorTempTransitionState.currentValue);
-
-    emberAfPluginColorControlServerComputePwmFromTempCallback(endpoint);
-}
-
 static bool shouldExecuteIfOff(EndpointId endpoint, uint8_t optionMask, uint8_t optionOverride)
 {
     // From 5.2.2.2.1.10 of ZCL7 document 14-0129-15f-zcl-ch-5-lighting.docx:
@@ -50,6 +50,8 @@
 #include <app/util/af.h>
 #include <app/util/binding-table.h>
 
+#include <string.h>
+
 #include "gen/att-storage.h"
 #include "gen/attribute-id.h"
 #include "gen/attribute-type.h"
@@ -68,6 +70,130 @@ static bool bindingGroupMatch(EndpointId endpoint, GroupId groupId, EmberBinding
 
 static uint8_t findGroupIndex(EndpointId endpoint, GroupId groupId);
 
+// --------------------------
+// Group membership index
+//
+// The groups that endpoints are members of are kept sorted by group id, each
+// with a bitmap of its member endpoints, so that the members of a group are
+// found with one search instead of a walk of the binding table for every
+// endpoint.  The index is built from the binding table on first use and kept
+// up to date as groups are added and removed here.  A change made to the
+// binding table anywhere else makes it built again on next use.
+// --------------------------
+
+typedef struct
+{
+    GroupId groupId;
+    // Endpoint e is a member if bit (e % 8) of byte (e / 8) is set.
+    uint8_t members[(UINT8_MAX + 1) / 8];
+} GroupMembership;
+
+// A group has at least one multicast binding, so there are never more groups than bindings.
+static GroupMembership groupMemberships[EMBER_BINDING_TABLE_SIZE];
+static uint8_t groupMembershipCount        = 0;
+static bool groupMembershipBuilt           = false;
+static uint32_t groupMembershipChangeCount = 0;
+
+// Returns the position of a group in groupMemberships, or the position it would be inserted at.
+static uint8_t findGroupMembership(GroupId groupId)
+{
+    uint8_t low = 0, high = groupMembershipCount;
+
+    while (low < high)
+    {
+        uint8_t middle = static_cast<uint8_t>((low + high) / 2);
+        if (groupMemberships[middle].groupId < groupId)
+        {
+            low = static_cast<uint8_t>(middle + 1);
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static void addGroupMember(EndpointId endpoint, GroupId groupId)
+{
+    uint8_t position = findGroupMembership(groupId);
+
+    if (position == groupMembershipCount || groupMemberships[position].groupId != groupId)
+    {
+        if (groupMembershipCount == EMBER_BINDING_TABLE_SIZE)
+        {
+            return;
+        }
+        memmove(&groupMemberships[position + 1], &groupMemberships[position],
+                (groupMembershipCount - position) * sizeof(GroupMembership));
+        memset(&groupMemberships[position], 0, sizeof(GroupMembership));
+        groupMemberships[position].groupId = groupId;
+        groupMembershipCount++;
+    }
+    groupMemberships[position].members[endpoint / 8] = static_cast<uint8_t>(groupMemberships[position].members[endpoint / 8] |
+                                                                              EMBER_BIT(endpoint % 8));
+}
+
+static void removeGroupMember(EndpointId endpoint, GroupId groupId)
+{
+    uint8_t position = findGroupMembership(groupId);
+    GroupMembership * membership;
+
+    if (position == groupMembershipCount || groupMemberships[position].groupId != groupId)
+    {
+        return;
+    }
+
+    membership                        = &groupMemberships[position];
+    membership->members[endpoint / 8] = static_cast<uint8_t>(membership->members[endpoint / 8] & ~EMBER_BIT(endpoint % 8));
+    for (uint8_t i = 0; i < sizeof(membership->members); i++)
+    {
+        if (membership->members[i] != 0)
+        {
+            return;
+        }
+    }
+
+    // The group has no members left.
+    groupMembershipCount--;
+    memmove(&groupMemberships[position], &groupMemberships[position + 1],
+            (groupMembershipCount - position) * sizeof(GroupMembership));
+}
+
+// Builds the index from the binding table if it was changed since the index last saw it.
+static void updateGroupMemberships(void)
+{
+    if (groupMembershipBuilt && groupMembershipChangeCount == emberBindingTableChangeCount())
+    {
+        return;
+    }
+
+    groupMembershipCount = 0;
+    for (uint8_t i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
+    {
+        EmberBindingTableEntry binding;
+        if (emberGetBinding(i, &binding) == EMBER_SUCCESS && binding.type == EMBER_MULTICAST_BINDING)
+        {
+            addGroupMember(binding.local, binding.groupId);
+        }
+    }
+    groupMembershipBuilt       = true;
+    groupMembershipChangeCount = emberBindingTableChangeCount();
+}
+
+const uint8_t * emberAfGroupsClusterGroupMembers(GroupId groupId)
+{
+    uint8_t position;
+
+    updateGroupMemberships();
+    position = findGroupMembership(groupId);
+    if (position == groupMembershipCount || groupMemberships[position].groupId != groupId)
+    {
+        return NULL;
+    }
+    return groupMemberships[position].members;
+}
+
 void emberAfGroupsClusterServerInitCallback(EndpointId endpoint)
 {
     // The high bit of Name Support indicates whether group names are supported.
@@ -117,6 +243,9 @@ static EmberAfStatus addEntryToGroupTable(EndpointId endpoint, GroupId groupId,
             status = emberSetBinding(i, &binding);
             if (status == EMBER_SUCCESS)
             {
+                addGroupMember(endpoint, groupId);
+                groupMembershipChangeCount = emberBindingTableChangeCount();
+
                 // Set the group name, if supported
                 emberAfPluginGroupsServerSetGroupNameCallback(endpoint, groupId, groupName);
                 return EMBER_ZCL_STATUS_SUCCESS;
@@ -139,6 +268,13 @@ static EmberAfStatus removeEntryFromGroupTable(EndpointId endpoint, GroupId grou
         EmberStatus status   = emberDeleteBinding(bindingIndex);
         if (status == EMBER_SUCCESS)
         {
+            // Another multicast binding may still hold the endpoint in the group.
+            if (findGroupIndex(endpoint, groupId) == EMBER_AF_GROUP_TABLE_NULL_INDEX)
+            {
+                removeGroupMember(endpoint, groupId);
+            }
+            groupMembershipChangeCount = emberBindingTableChangeCount();
+
             uint8_t groupName[ZCL_GROUPS_CLUSTER_MAXIMUM_NAME_LENGTH + 1] = { 0 };
             emberAfPluginGroupsServerSetGroupNameCallback(endpoint, groupId, groupName);
             return EMBER_ZCL_STATUS_SUCCESS;
@@ -210,7 +346,7 @@ bool emberAfGroupsClusterViewGroupCallback(chip::app::Command * commandObj, Grou
 bool emberAfGroupsClusterGetGroupMembershipCallback(chip::app::Command * commandObj, uint8_t groupCount, uint8_t * groupList)
 {
     EmberStatus status;
-    uint8_t i, j;
+    uint8_t i;
     uint8_t count = 0;
     uint8_t list[EMBER_BINDING_TABLE_SIZE << 1];
     uint8_t listLen = 0;
@@ -229,14 +365,14 @@ bool emberAfGroupsClusterGetGroupMembershipCallback(chip::app::Command * command
     // Otherwise, respond with a list of matches.
     if (groupCount == 0)
     {
-        for (i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
+        updateGroupMemberships();
+        for (i = 0; i < groupMembershipCount; i++)
         {
-            EmberBindingTableEntry entry;
-            status = emberGetBinding(i, &entry);
-            if ((status == EMBER_SUCCESS) && (entry.type == EMBER_MULTICAST_BINDING) && (entry.local == emberAfCurrentEndpoint()))
+            GroupId groupId = groupMemberships[i].groupId;
+            if (isGroupPresent(emberAfCurrentEndpoint(), groupId))
             {
-                list[listLen]     = EMBER_LOW_BYTE(entry.groupId);
-                list[listLen + 1] = EMBER_HIGH_BYTE(entry.groupId);
+                list[listLen]     = EMBER_LOW_BYTE(groupId);
+                list[listLen + 1] = EMBER_HIGH_BYTE(groupId);
                 listLen           = static_cast<uint8_t>(listLen + 2);
                 count++;
             }
@@ -244,23 +380,15 @@ bool emberAfGroupsClusterGetGroupMembershipCallback(chip::app::Command * command
     }
     else
     {
-        for (i = 0; i < groupCount; i++)
+        for (i = 0; i < groupCount && listLen < sizeof(list); i++)
         {
             GroupId groupId = emberAfGetInt16u(groupList + (i << 1), 0, 2);
-            for (j = 0; j < EMBER_BINDING_TABLE_SIZE; j++)
+            if (isGroupPresent(emberAfCurrentEndpoint(), groupId))
             {
-                EmberBindingTableEntry entry;
-                status = emberGetBinding(j, &entry);
-                if ((status == EMBER_SUCCESS) && (entry.type == EMBER_MULTICAST_BINDING))
-                {
-                    if (entry.local == emberAfCurrentEndpoint() && entry.groupId == groupId)
-                    {
-                        list[listLen]     = EMBER_LOW_BYTE(groupId);
-                        list[listLen + 1] = EMBER_HIGH_BYTE(groupId);
-                        listLen           = static_cast<uint8_t>(listLen + 2);
-                        count++;
-                    }
-                }
+                list[listLen]     = EMBER_LOW_BYTE(groupId);
+                list[listLen + 1] = EMBER_HIGH_BYTE(groupId);
+                listLen           = static_cast<uint8_t>(listLen + 2);
+                count++;
             }
         }
     }
@@ -420,21 +548,8 @@ void emberAfGroupsClusterClearGroupTableCallback(EndpointId endpoint)
 
 static bool isGroupPresent(EndpointId endpoint, GroupId groupId)
 {
-    uint8_t i;
-
-    for (i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
-    {
-        EmberBindingTableEntry binding;
-        if (emberGetBinding(i, &binding) == EMBER_SUCCESS)
-        {
-            if (bindingGroupMatch(endpoint, groupId, &binding))
-            {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    const uint8_t * members = emberAfGroupsClusterGroupMembers(groupId);
+    return (members != NULL && (members[endpoint / 8] & EMBER_BIT(endpoint % 8)) != 0);
 }
 
 static bool bindingGroupMatch(EndpointId endpoint, GroupId groupId, EmberBindingTableEntry * entry)
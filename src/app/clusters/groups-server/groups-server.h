@@ -58,3 +58,14 @@ bool emberAfPluginGroupsServerGroupNamesSupportedCallback(chip::EndpointId endpo
  * @param groupId The group identifier.  Ver.: always
  */
 bool emberAfGroupsClusterEndpointInGroupCallback(chip::EndpointId endpoint, chip::GroupId groupId);
+
+/** @brief Groups Cluster Group Members
+ *
+ * This function returns the endpoints that are members of a group, as a bitmap
+ * of endpoint ids in which endpoint e is bit (e % 8) of byte (e / 8), or NULL
+ * if no endpoint is a member.  The bitmap is only valid until the group table
+ * next changes.
+ *
+ * @param groupId The group identifier.  Ver.: always
+ */
+const uint8_t * emberAfGroupsClusterGroupMembers(chip::GroupId groupId);
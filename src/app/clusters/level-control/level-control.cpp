@@ -52,6 +52,7 @@
 #include "gen/command-id.h"
 
 #include <app/reporting/reporting.h>
+#include <app/util/transition-engine.h>
 
 #ifdef EMBER_AF_PLUGIN_SCENES
 #include <app/clusters/scenes/scenes.h>
@@ -96,13 +97,10 @@ typedef struct
 {
     CommandId commandId;
     uint8_t moveToLevel;
-    bool increasing;
     bool useOnLevel;
     uint8_t onLevel;
     uint16_t storedLevel;
-    uint32_t eventDurationMs;
     uint32_t transitionTimeMs;
-    uint32_t elapsedTimeMs;
 } EmberAfLevelControlState;
 
 static EmberAfLevelControlState stateTable[EMBER_AF_LEVEL_CONTROL_CLUSTER_SERVER_ENDPOINT_COUNT];
@@ -127,14 +125,35 @@ static void reallyUpdateCoupledColorTemp(EndpointId endpoint);
 #define updateCoupledColorTemp(endpoint)
 #endif // LEVEL...OPTIONS_ATTRIBUTE && COLOR...SERVER_TEMP
 
-static void schedule(EndpointId endpoint, uint32_t delayMs)
+static void levelTransitionCallback(const EmberAfTransition * transition, bool written);
+
+// Moves the level from currentLevel to the moveToLevel of the state over its
+// transitionTimeMs.
+static EmberAfStatus schedule(EndpointId endpoint, uint8_t currentLevel, EmberAfLevelControlState * state)
 {
-    emberAfScheduleServerTickExtended(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, delayMs, EMBER_AF_LONG_POLL, EMBER_AF_OK_TO_SLEEP);
+    EmberAfTransition transition = {};
+
+#if !defined(ZCL_USING_LEVEL_CONTROL_CLUSTER_OPTIONS_ATTRIBUTE) && defined(EMBER_AF_PLUGIN_ZLL_LEVEL_CONTROL_SERVER)
+    if (emberAfPluginZllLevelControlServerIgnoreMoveToLevelMoveStepStop(endpoint, state->commandId))
+    {
+        return EMBER_ZCL_STATUS_SUCCESS;
+    }
+#endif
+
+    transition.endpoint      = endpoint;
+    transition.clusterId     = ZCL_LEVEL_CONTROL_CLUSTER_ID;
+    transition.attributeId   = ZCL_CURRENT_LEVEL_ATTRIBUTE_ID;
+    transition.attributeType = ZCL_INT8U_ATTRIBUTE_TYPE;
+    transition.startValue    = currentLevel;
+    transition.targetValue   = state->moveToLevel;
+    transition.durationMs    = state->transitionTimeMs;
+    transition.callback      = levelTransitionCallback;
+    return emberAfTransitionStart(&transition);
 }
 
 static void deactivate(EndpointId endpoint)
 {
-    emberAfDeactivateServerTick(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID);
+    emberAfTransitionStop(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID);
 }
 
 static EmberAfLevelControlState * getState(EndpointId endpoint)
@@ -164,122 +183,89 @@ static void reallyUpdateCoupledColorTemp(EndpointId endpoint)
 
 void emberAfLevelControlClusterServerTickCallback(EndpointId endpoint)
 {
+    // The level is moved by the transition engine, which calls
+    // levelTransitionCallback, so the server tick is never scheduled.
+}
+
+static void levelTransitionCallback(const EmberAfTransition * transition, bool written)
+{
+    EndpointId endpoint              = transition->endpoint;
     EmberAfLevelControlState * state = getState(endpoint);
     EmberAfStatus status;
-    uint8_t currentLevel;
+    uint8_t currentLevel = static_cast<uint8_t>(transition->currentValue);
 
     if (state == NULL)
     {
         return;
     }
 
-    state->elapsedTimeMs += state->eventDurationMs;
-
-#if !defined(ZCL_USING_LEVEL_CONTROL_CLUSTER_OPTIONS_ATTRIBUTE) && defined(EMBER_AF_PLUGIN_ZLL_LEVEL_CONTROL_SERVER)
-    if (emberAfPluginZllLevelControlServerIgnoreMoveToLevelMoveStepStop(endpoint, state->commandId))
-    {
-        return;
-    }
-#endif
-
-    // Read the attribute; print error message and return if it can't be read
-    status = emberAfReadServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID,
-                                        (uint8_t *) &currentLevel, sizeof(currentLevel));
-    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    if (written)
     {
-        emberAfLevelControlClusterPrintln("ERR: reading current level %x", status);
-        writeRemainingTime(endpoint, 0);
-        return;
-    }
+        emberAfLevelControlClusterPrintln("Event: move to %d", currentLevel);
 
-    emberAfLevelControlClusterPrint("Event: move from %d", currentLevel);
+        updateCoupledColorTemp(endpoint);
 
-    // adjust by the proper amount, either up or down
-    if (state->transitionTimeMs == 0)
-    {
-        // Immediate, not over a time interval.
-        currentLevel = state->moveToLevel;
-    }
-    else if (state->increasing)
-    {
-        assert(currentLevel < MAX_LEVEL);
-        assert(currentLevel < state->moveToLevel);
-        currentLevel++;
-    }
-    else
-    {
-        assert(MIN_LEVEL < currentLevel);
-        assert(state->moveToLevel < currentLevel);
-        currentLevel--;
+#ifdef EMBER_AF_PLUGIN_SCENES
+        // The level has changed, so the scene is no longer valid.
+        if (emberAfContainsServer(endpoint, ZCL_SCENES_CLUSTER_ID))
+        {
+            emberAfScenesClusterMakeInvalidCallback(endpoint);
+        }
+#endif
     }
 
-    emberAfLevelControlClusterPrint(" to %d ", currentLevel);
-    emberAfLevelControlClusterPrintln("(diff %c1)", state->increasing ? '+' : '-');
-
-    status = emberAfWriteServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID,
-                                         (uint8_t *) &currentLevel, ZCL_INT8U_ATTRIBUTE_TYPE);
-    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    if (transition->status == EMBER_AF_TRANSITION_RUNNING)
     {
-        emberAfLevelControlClusterPrintln("ERR: writing current level %x", status);
-        writeRemainingTime(endpoint, 0);
+        // The remaining time is only written along with the level.
+        if (written)
+        {
+            writeRemainingTime(endpoint, static_cast<uint16_t>(emberAfTransitionGetRemainingMs(transition)));
+        }
         return;
     }
 
-    updateCoupledColorTemp(endpoint);
-
-#ifdef EMBER_AF_PLUGIN_SCENES
-    // The level has changed, so the scene is no longer valid.
-    if (emberAfContainsServer(endpoint, ZCL_SCENES_CLUSTER_ID))
+    if (transition->status == EMBER_AF_TRANSITION_STOPPED)
     {
-        emberAfScenesClusterMakeInvalidCallback(endpoint);
+        return;
     }
-#endif
 
-    // Are we at the requested level?
-    if (currentLevel == state->moveToLevel)
+    // We are at the requested level.
+    if (state->commandId == ZCL_MOVE_TO_LEVEL_WITH_ON_OFF_COMMAND_ID || state->commandId == ZCL_MOVE_WITH_ON_OFF_COMMAND_ID ||
+        state->commandId == ZCL_STEP_WITH_ON_OFF_COMMAND_ID)
     {
-        if (state->commandId == ZCL_MOVE_TO_LEVEL_WITH_ON_OFF_COMMAND_ID || state->commandId == ZCL_MOVE_WITH_ON_OFF_COMMAND_ID ||
-            state->commandId == ZCL_STEP_WITH_ON_OFF_COMMAND_ID)
+        setOnOffValue(endpoint, (currentLevel != MIN_LEVEL));
+        if (currentLevel == MIN_LEVEL && state->useOnLevel)
         {
-            setOnOffValue(endpoint, (currentLevel != MIN_LEVEL));
-            if (currentLevel == MIN_LEVEL && state->useOnLevel)
+            status = emberAfWriteServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID,
+                                                 (uint8_t *) &state->onLevel, ZCL_INT8U_ATTRIBUTE_TYPE);
+            if (status != EMBER_ZCL_STATUS_SUCCESS)
             {
-                status = emberAfWriteServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID,
-                                                     (uint8_t *) &state->onLevel, ZCL_INT8U_ATTRIBUTE_TYPE);
-                if (status != EMBER_ZCL_STATUS_SUCCESS)
-                {
-                    emberAfLevelControlClusterPrintln("ERR: writing current level %x", status);
-                }
-                else
-                {
-                    updateCoupledColorTemp(endpoint);
-                }
+                emberAfLevelControlClusterPrintln("ERR: writing current level %x", status);
             }
-        }
-        else
-        {
-            if (state->storedLevel != INVALID_STORED_LEVEL)
+            else
             {
-                uint8_t storedLevel8u = (uint8_t) state->storedLevel;
-                status = emberAfWriteServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID,
-                                                     (uint8_t *) &storedLevel8u, ZCL_INT8U_ATTRIBUTE_TYPE);
-                if (status != EMBER_ZCL_STATUS_SUCCESS)
-                {
-                    emberAfLevelControlClusterPrintln("ERR: writing current level %x", status);
-                }
-                else
-                {
-                    updateCoupledColorTemp(endpoint);
-                }
+                updateCoupledColorTemp(endpoint);
             }
         }
-        writeRemainingTime(endpoint, 0);
     }
     else
     {
-        writeRemainingTime(endpoint, static_cast<uint16_t>(state->transitionTimeMs - state->elapsedTimeMs));
-        schedule(endpoint, state->eventDurationMs);
+        if (state->storedLevel != INVALID_STORED_LEVEL)
+        {
+            uint8_t storedLevel8u = (uint8_t) state->storedLevel;
+            status = emberAfWriteServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID,
+                                                 (uint8_t *) &storedLevel8u, ZCL_INT8U_ATTRIBUTE_TYPE);
+            if (status != EMBER_ZCL_STATUS_SUCCESS)
+            {
+                emberAfLevelControlClusterPrintln("ERR: writing current level %x", status);
+            }
+            else
+            {
+                updateCoupledColorTemp(endpoint);
+            }
+        }
     }
+    writeRemainingTime(endpoint, 0);
 }
 
 static void writeRemainingTime(EndpointId endpoint, uint16_t remainingTimeMs)
@@ -477,7 +463,6 @@ static void moveToLevelHandler(CommandId commandId, uint8_t level, uint16_t tran
     EmberAfLevelControlState * state = getState(endpoint);
     EmberAfStatus status;
     uint8_t currentLevel;
-    uint8_t actualStepSize;
 
     if (state == NULL)
     {
@@ -534,13 +519,6 @@ static void moveToLevelHandler(CommandId commandId, uint8_t level, uint16_t tran
             status = EMBER_ZCL_STATUS_SUCCESS;
             goto send_default_response;
         }
-        state->increasing = true;
-        actualStepSize    = static_cast<uint8_t>(state->moveToLevel - currentLevel);
-    }
-    else
-    {
-        state->increasing = false;
-        actualStepSize    = static_cast<uint8_t>(currentLevel - state->moveToLevel);
     }
 
     // If the Transition time field takes the value 0xFFFF, then the time taken
@@ -576,19 +554,13 @@ static void moveToLevelHandler(CommandId commandId, uint8_t level, uint16_t tran
         state->transitionTimeMs = (transitionTimeDs * MILLISECOND_TICKS_PER_SECOND / 10);
     }
 
-    // The duration between events will be the transition time divided by the
-    // distance we must move.
-    state->eventDurationMs = state->transitionTimeMs / actualStepSize;
-    state->elapsedTimeMs   = 0;
-
     // OnLevel is not used for Move commands.
     state->useOnLevel = false;
 
     state->storedLevel = storedLevel;
 
     // The setup was successful, so mark the new state as active and return.
-    schedule(endpoint, state->eventDurationMs);
-    status = EMBER_ZCL_STATUS_SUCCESS;
+    status = schedule(endpoint, currentLevel, state);
 
 #ifdef EMBER_AF_PLUGIN_ZLL_LEVEL_CONTROL_SERVER
     if (commandId == ZCL_MOVE_TO_LEVEL_WITH_ON_OFF_COMMAND_ID)
@@ -611,6 +583,7 @@ static void moveHandler(CommandId commandId, uint8_t moveMode, uint8_t rate, uin
     EmberAfStatus status;
     uint8_t currentLevel;
     uint8_t difference;
+    uint32_t eventDurationMs;
 
     if (state == NULL)
     {
@@ -642,12 +615,10 @@ static void moveHandler(CommandId commandId, uint8_t moveMode, uint8_t rate, uin
     switch (moveMode)
     {
     case EMBER_ZCL_MOVE_MODE_UP:
-        state->increasing  = true;
         state->moveToLevel = MAX_LEVEL;
         difference         = static_cast<uint8_t>(MAX_LEVEL - currentLevel);
         break;
     case EMBER_ZCL_MOVE_MODE_DOWN:
-        state->increasing  = false;
         state->moveToLevel = MIN_LEVEL;
         difference         = currentLevel - MIN_LEVEL;
         break;
@@ -683,7 +654,7 @@ static void moveHandler(CommandId commandId, uint8_t moveMode, uint8_t rate, uin
         if (status != EMBER_ZCL_STATUS_SUCCESS)
         {
             emberAfLevelControlClusterPrintln("ERR: reading default move rate %x", status);
-            state->eventDurationMs = FASTEST_TRANSITION_TIME_MS;
+            eventDurationMs = FASTEST_TRANSITION_TIME_MS;
         }
         else
         {
@@ -693,23 +664,21 @@ static void moveHandler(CommandId commandId, uint8_t moveMode, uint8_t rate, uin
                 status = EMBER_ZCL_STATUS_SUCCESS;
                 goto send_default_response;
             }
-            state->eventDurationMs = MILLISECOND_TICKS_PER_SECOND / defaultMoveRate;
+            eventDurationMs = MILLISECOND_TICKS_PER_SECOND / defaultMoveRate;
         }
     }
     else
     {
-        state->eventDurationMs = MILLISECOND_TICKS_PER_SECOND / rate;
+        eventDurationMs = MILLISECOND_TICKS_PER_SECOND / rate;
     }
 
-    state->transitionTimeMs = difference * state->eventDurationMs;
-    state->elapsedTimeMs    = 0;
+    state->transitionTimeMs = difference * eventDurationMs;
 
     // OnLevel is not used for Move commands.
     state->useOnLevel = false;
 
     // The setup was successful, so mark the new state as active and return.
-    schedule(endpoint, state->eventDurationMs);
-    status = EMBER_ZCL_STATUS_SUCCESS;
+    status = schedule(endpoint, currentLevel, state);
 
 send_default_response:
     emberAfSendImmediateDefaultResponse(status);
@@ -754,7 +723,6 @@ static void stepHandler(CommandId commandId, uint8_t stepMode, uint8_t stepSize,
     switch (stepMode)
     {
     case EMBER_ZCL_STEP_MODE_UP:
-        state->increasing = true;
         if (MAX_LEVEL - currentLevel < stepSize)
         {
             state->moveToLevel = MAX_LEVEL;
@@ -766,7 +734,6 @@ static void stepHandler(CommandId commandId, uint8_t stepMode, uint8_t stepSize,
         }
         break;
     case EMBER_ZCL_STEP_MODE_DOWN:
-        state->increasing = false;
         if (currentLevel - MIN_LEVEL < stepSize)
         {
             state->moveToLevel = MIN_LEVEL;
@@ -819,17 +786,11 @@ static void stepHandler(CommandId commandId, uint8_t stepMode, uint8_t stepSize,
         }
     }
 
-    // The duration between events will be the transition time divided by the
-    // distance we must move.
-    state->eventDurationMs = state->transitionTimeMs / actualStepSize;
-    state->elapsedTimeMs   = 0;
-
     // OnLevel is not used for Step commands.
     state->useOnLevel = false;
 
     // The setup was successful, so mark the new state as active and return.
-    schedule(endpoint, state->eventDurationMs);
-    status = EMBER_ZCL_STATUS_SUCCESS;
+    status = schedule(endpoint, currentLevel, state);
 
 send_default_response:
     emberAfSendImmediateDefaultResponse(status);
@@ -940,8 +901,7 @@ void emberAfOnOffClusterLevelControlEffectCallback(EndpointId endpoint, bool new
                            temporaryCurrentLevelCache);
 
         // "If OnLevel is not defined, set the CurrentLevel to the stored level."
-        // The emberAfLevelControlClusterServerTickCallback implementation handles
-        // this.
+        // The levelTransitionCallback implementation handles this.
     }
 }
 
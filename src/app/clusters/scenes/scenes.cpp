@@ -41,7 +41,9 @@
 #include "scenes.h"
 #include "app/util/common.h"
 #include <app/Command.h>
+#include <app/reporting/reporting.h>
 #include <app/util/af.h>
+#include <app/util/transition-engine.h>
 
 #include "gen/attribute-id.h"
 #include "gen/attribute-type.h"
@@ -93,6 +95,318 @@ static EmberAfStatus writeServerAttribute(EndpointId endpoint, ClusterId cluster
     return status;
 }
 
+//------------------------------------------------------------------------------
+// Scene index
+//
+// The endpoint, group and scene ids of the entries of the table are kept in
+// RAM, and the used entries are hashed by them, so that a scene is found
+// without retrieving every entry, which may be a token, and the scenes of a
+// group are found from the ids alone.  The index is built from the table on
+// first use and kept up to date by saveSceneEntry().
+
+#ifndef EMBER_AF_PLUGIN_SCENES_INDEX_BUCKET_COUNT
+#define EMBER_AF_PLUGIN_SCENES_INDEX_BUCKET_COUNT EMBER_AF_PLUGIN_SCENES_TABLE_SIZE
+#endif
+
+typedef struct
+{
+    EndpointId endpoint;
+    GroupId groupId;
+    uint8_t sceneId;
+} SceneKey;
+
+static bool sceneIndexBuilt = false;
+static SceneKey sceneKeys[EMBER_AF_PLUGIN_SCENES_TABLE_SIZE];
+// First entry of each bucket, and next entry in the bucket of each entry, or EMBER_AF_SCENE_TABLE_NULL_INDEX.
+static uint8_t sceneIndexBuckets[EMBER_AF_PLUGIN_SCENES_INDEX_BUCKET_COUNT];
+static uint8_t sceneIndexNext[EMBER_AF_PLUGIN_SCENES_TABLE_SIZE];
+
+static uint8_t sceneIndexBucket(const SceneKey * key)
+{
+    uint32_t hash = (static_cast<uint32_t>(key->endpoint) * 31 + key->groupId) * 31 + key->sceneId;
+    return static_cast<uint8_t>(hash % EMBER_AF_PLUGIN_SCENES_INDEX_BUCKET_COUNT);
+}
+
+static void linkSceneIndexEntry(uint8_t index, const EmberAfSceneTableEntry * entry)
+{
+    SceneKey * key = &sceneKeys[index];
+
+    key->endpoint = entry->endpoint;
+    key->groupId  = entry->groupId;
+    key->sceneId  = entry->sceneId;
+    if (key->endpoint == EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID)
+    {
+        return;
+    }
+
+    uint8_t bucket            = sceneIndexBucket(key);
+    sceneIndexNext[index]     = sceneIndexBuckets[bucket];
+    sceneIndexBuckets[bucket] = index;
+}
+
+static void unlinkSceneIndexEntry(uint8_t index)
+{
+    if (sceneKeys[index].endpoint == EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID)
+    {
+        return;
+    }
+
+    uint8_t * link = &sceneIndexBuckets[sceneIndexBucket(&sceneKeys[index])];
+    while (*link != index)
+    {
+        link = &sceneIndexNext[*link];
+    }
+    *link                     = sceneIndexNext[index];
+    sceneKeys[index].endpoint = EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID;
+}
+
+static void buildSceneIndex(void)
+{
+    memset(sceneIndexBuckets, EMBER_AF_SCENE_TABLE_NULL_INDEX, sizeof(sceneIndexBuckets));
+    sceneIndexBuilt = true;
+
+    for (uint8_t i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
+    {
+        EmberAfSceneTableEntry entry;
+        emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
+        linkSceneIndexEntry(i, &entry);
+    }
+}
+
+// Returns the index of the entry of a scene, or EMBER_AF_SCENE_TABLE_NULL_INDEX.
+static uint8_t findSceneEntry(EndpointId endpoint, GroupId groupId, uint8_t sceneId)
+{
+    SceneKey key = { endpoint, groupId, sceneId };
+
+    if (!sceneIndexBuilt)
+    {
+        buildSceneIndex();
+    }
+
+    for (uint8_t i = sceneIndexBuckets[sceneIndexBucket(&key)]; i != EMBER_AF_SCENE_TABLE_NULL_INDEX; i = sceneIndexNext[i])
+    {
+        if (sceneKeys[i].endpoint == endpoint && sceneKeys[i].groupId == groupId && sceneKeys[i].sceneId == sceneId)
+        {
+            return i;
+        }
+    }
+    return EMBER_AF_SCENE_TABLE_NULL_INDEX;
+}
+
+// Returns the index of the lowest unused entry, or EMBER_AF_SCENE_TABLE_NULL_INDEX if the table is full.
+static uint8_t findUnusedSceneEntry(void)
+{
+    if (!sceneIndexBuilt)
+    {
+        buildSceneIndex();
+    }
+
+    for (uint8_t i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
+    {
+        if (sceneKeys[i].endpoint == EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID)
+        {
+            return i;
+        }
+    }
+    return EMBER_AF_SCENE_TABLE_NULL_INDEX;
+}
+
+// Returns whether an entry is used by a scene of a group on an endpoint.
+static bool isSceneEntryInGroup(uint8_t index, EndpointId endpoint, GroupId groupId)
+{
+    if (!sceneIndexBuilt)
+    {
+        buildSceneIndex();
+    }
+
+    return (endpoint != EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID && sceneKeys[index].endpoint == endpoint &&
+            sceneKeys[index].groupId == groupId);
+}
+
+static void saveSceneEntry(EmberAfSceneTableEntry & entry, uint8_t index)
+{
+    if (!sceneIndexBuilt)
+    {
+        buildSceneIndex();
+    }
+
+    emberAfPluginScenesServerSaveSceneEntry(entry, index);
+    unlinkSceneIndexEntry(index);
+    linkSceneIndexEntry(index, &entry);
+}
+
+//------------------------------------------------------------------------------
+// Extension fields
+//
+// The attributes of other clusters that a scene holds, with the offsets in a
+// scene entry of their value and of the flag set when the scene has it.
+// Storing a scene and recalling it walk this table.  The attributes marked as
+// gradual move to the value of the scene over the transition time of a recall.
+
+typedef struct
+{
+    ClusterId clusterId;
+    AttributeId attributeId;
+    EmberAfAttributeType type;
+    const char * name;
+    uint16_t hasValueOffset;
+    uint16_t valueOffset;
+    uint8_t size;
+    bool gradual;
+    // The modulus of a value that wraps around, such as a hue, or 0.
+    uint32_t modulus;
+} SceneExtensionAttribute;
+
+#define SCENE_EXTENSION_ATTRIBUTE(clusterId, attributeId, type, name, hasValue, value, gradual, modulus)                           \
+    {                                                                                                                              \
+        clusterId, attributeId, type, name, offsetof(EmberAfSceneTableEntry, hasValue), offsetof(EmberAfSceneTableEntry, value),   \
+            sizeof(((EmberAfSceneTableEntry *) 0)->value), gradual, modulus                                                        \
+    }
+
+static const SceneExtensionAttribute sceneExtensionAttributes[] = {
+#ifdef ZCL_USING_ON_OFF_CLUSTER_SERVER
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_ON_OFF_CLUSTER_ID, ZCL_ON_OFF_ATTRIBUTE_ID, ZCL_BOOLEAN_ATTRIBUTE_TYPE, "on/off", hasOnOffValue,
+                              onOffValue, false, 0),
+#endif
+#ifdef ZCL_USING_LEVEL_CONTROL_CLUSTER_SERVER
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID, ZCL_INT8U_ATTRIBUTE_TYPE,
+                              "current level", hasCurrentLevelValue, currentLevelValue, true, 0),
+#endif
+#ifdef ZCL_USING_THERMOSTAT_CLUSTER_SERVER
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_THERMOSTAT_CLUSTER_ID, ZCL_OCCUPIED_COOLING_SETPOINT_ATTRIBUTE_ID, ZCL_INT16S_ATTRIBUTE_TYPE,
+                              "occupied cooling setpoint", hasOccupiedCoolingSetpointValue, occupiedCoolingSetpointValue, false, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_THERMOSTAT_CLUSTER_ID, ZCL_OCCUPIED_HEATING_SETPOINT_ATTRIBUTE_ID, ZCL_INT16S_ATTRIBUTE_TYPE,
+                              "occupied heating setpoint", hasOccupiedHeatingSetpointValue, occupiedHeatingSetpointValue, false, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_THERMOSTAT_CLUSTER_ID, ZCL_SYSTEM_MODE_ATTRIBUTE_ID, ZCL_INT8U_ATTRIBUTE_TYPE, "system mode",
+                              hasSystemModeValue, systemModeValue, false, 0),
+#endif
+#ifdef ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_X_ATTRIBUTE_ID, ZCL_INT16U_ATTRIBUTE_TYPE,
+                              "current x", hasCurrentXValue, currentXValue, true, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_Y_ATTRIBUTE_ID, ZCL_INT16U_ATTRIBUTE_TYPE,
+                              "current y", hasCurrentYValue, currentYValue, true, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_ENHANCED_CURRENT_HUE_ATTRIBUTE_ID,
+                              ZCL_INT16U_ATTRIBUTE_TYPE, "enhanced current hue", hasEnhancedCurrentHueValue,
+                              enhancedCurrentHueValue, true, 0x10000),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_SATURATION_ATTRIBUTE_ID,
+                              ZCL_INT8U_ATTRIBUTE_TYPE, "current saturation", hasCurrentSaturationValue, currentSaturationValue,
+                              true, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_ACTIVE_ATTRIBUTE_ID,
+                              ZCL_INT8U_ATTRIBUTE_TYPE, "color loop active", hasColorLoopActiveValue, colorLoopActiveValue, false,
+                              0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_DIRECTION_ATTRIBUTE_ID,
+                              ZCL_INT8U_ATTRIBUTE_TYPE, "color loop direction", hasColorLoopDirectionValue, colorLoopDirectionValue,
+                              false, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_TIME_ATTRIBUTE_ID,
+                              ZCL_INT16U_ATTRIBUTE_TYPE, "color loop time", hasColorLoopTimeValue, colorLoopTimeValue, false, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_TEMPERATURE_ATTRIBUTE_ID,
+                              ZCL_INT16U_ATTRIBUTE_TYPE, "color temp mireds", hasColorTemperatureMiredsValue,
+                              colorTemperatureMiredsValue, true, 0),
+#endif // ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
+#ifdef ZCL_USING_DOOR_LOCK_CLUSTER_SERVER
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_DOOR_LOCK_CLUSTER_ID, ZCL_LOCK_STATE_ATTRIBUTE_ID, ZCL_INT8U_ATTRIBUTE_TYPE, "lock state",
+                              hasLockStateValue, lockStateValue, false, 0),
+#endif
+#ifdef ZCL_USING_WINDOW_COVERING_CLUSTER_SERVER
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_WINDOW_COVERING_CLUSTER_ID, ZCL_CURRENT_LIFT_PERCENTAGE_ATTRIBUTE_ID, ZCL_INT8U_ATTRIBUTE_TYPE,
+                              "current position lift percentage", hasCurrentPositionLiftPercentageValue,
+                              currentPositionLiftPercentageValue, false, 0),
+    SCENE_EXTENSION_ATTRIBUTE(ZCL_WINDOW_COVERING_CLUSTER_ID, ZCL_CURRENT_TILT_PERCENTAGE_ATTRIBUTE_ID, ZCL_INT8U_ATTRIBUTE_TYPE,
+                              "current position tilt percentage", hasCurrentPositionTiltPercentageValue,
+                              currentPositionTiltPercentageValue, false, 0),
+#endif
+    // The end of the table.
+    { 0, 0, ZCL_NO_DATA_ATTRIBUTE_TYPE, NULL, 0, 0, 0, false, 0 },
+};
+
+static bool * sceneHasValue(EmberAfSceneTableEntry * entry, const SceneExtensionAttribute * attribute)
+{
+    return reinterpret_cast<bool *>(reinterpret_cast<uint8_t *>(entry) + attribute->hasValueOffset);
+}
+
+static uint8_t * sceneValue(EmberAfSceneTableEntry * entry, const SceneExtensionAttribute * attribute)
+{
+    return reinterpret_cast<uint8_t *>(entry) + attribute->valueOffset;
+}
+
+static int32_t sceneValueToInt(const uint8_t * data, uint8_t size)
+{
+    uint16_t value16;
+
+    if (size == 1)
+    {
+        return *data;
+    }
+    memcpy(&value16, data, sizeof(value16));
+    return value16;
+}
+
+// Moves an attribute from its current value to the value of a scene over a
+// transition.  Returns false if the attribute is to be written right away.
+static bool startSceneTransition(EndpointId endpoint, const SceneExtensionAttribute * attribute, const uint8_t * value,
+                                 uint32_t durationMs)
+{
+    EmberAfTransition transition = {};
+    uint8_t currentValue[sizeof(uint16_t)];
+
+    if (!readServerAttribute(endpoint, attribute->clusterId, attribute->attributeId, attribute->name, currentValue,
+                             attribute->size))
+    {
+        return false;
+    }
+
+    transition.endpoint      = endpoint;
+    transition.clusterId     = attribute->clusterId;
+    transition.attributeId   = attribute->attributeId;
+    transition.attributeType = attribute->type;
+    transition.startValue    = sceneValueToInt(currentValue, attribute->size);
+    transition.targetValue   = sceneValueToInt(value, attribute->size);
+    transition.durationMs    = durationMs;
+    transition.modulus       = attribute->modulus;
+    // A value that wraps around goes the short way to the scene.
+    if (attribute->modulus != 0)
+    {
+        int32_t half = static_cast<int32_t>(attribute->modulus / 2);
+        if (transition.targetValue - transition.startValue > half)
+        {
+            transition.targetValue -= static_cast<int32_t>(attribute->modulus);
+        }
+        else if (transition.startValue - transition.targetValue > half)
+        {
+            transition.targetValue += static_cast<int32_t>(attribute->modulus);
+        }
+    }
+    return (emberAfTransitionStart(&transition) == EMBER_ZCL_STATUS_SUCCESS);
+}
+
+// Applies the extension fields of a scene to the attributes of an endpoint, as
+// one batch of changes to report.
+static void restoreSceneEntry(EndpointId endpoint, EmberAfSceneTableEntry * entry, uint32_t transitionTimeMs)
+{
+    emberAfPluginReportingBeginBatch();
+    for (const SceneExtensionAttribute * attribute = sceneExtensionAttributes; attribute->name != NULL; attribute++)
+    {
+        if (!*sceneHasValue(entry, attribute))
+        {
+            continue;
+        }
+        if (attribute->gradual)
+        {
+            // The scene takes over from any transition of the attribute.
+            emberAfTransitionStop(endpoint, attribute->clusterId, attribute->attributeId);
+            if (transitionTimeMs > 0 && startSceneTransition(endpoint, attribute, sceneValue(entry, attribute), transitionTimeMs))
+            {
+                continue;
+            }
+        }
+        writeServerAttribute(endpoint, attribute->clusterId, attribute->attributeId, attribute->name, sceneValue(entry, attribute),
+                             attribute->type);
+    }
+    emberAfPluginReportingEndBatch();
+}
+
+static EmberAfStatus recallSavedScene(EndpointId endpoint, GroupId groupId, uint8_t sceneId, uint32_t transitionTimeMs);
+
 bool isEndpointInGroup(EndpointId endpoint, GroupId groupId)
 {
 #ifdef EMBER_AF_PLUGIN_GROUPS_SERVER
@@ -120,7 +434,7 @@ void emberAfScenesClusterServerInitCallback(EndpointId endpoint)
             EmberAfSceneTableEntry entry;
             emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
             entry.endpoint = EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID;
-            emberAfPluginScenesServerSaveSceneEntry(entry, i);
+            saveSceneEntry(entry, i);
         }
         emberAfPluginScenesServerSetNumSceneEntriesInUse(0);
     }
@@ -239,20 +553,16 @@ bool emberAfScenesClusterRemoveSceneCallback(chip::app::Command * commandObj, Gr
     }
     else
     {
-        uint8_t i;
-        for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
+        uint8_t i = findSceneEntry(emberAfCurrentEndpoint(), groupId, sceneId);
+        if (i != EMBER_AF_SCENE_TABLE_NULL_INDEX)
         {
             EmberAfSceneTableEntry entry;
             emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-            if (entry.endpoint == emberAfCurrentEndpoint() && entry.groupId == groupId && entry.sceneId == sceneId)
-            {
-                entry.endpoint = EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID;
-                emberAfPluginScenesServerSaveSceneEntry(entry, i);
-                emberAfPluginScenesServerDecrNumSceneEntriesInUse();
-                emberAfScenesSetSceneCountAttribute(emberAfCurrentEndpoint(), emberAfPluginScenesServerNumSceneEntriesInUse());
-                status = EMBER_ZCL_STATUS_SUCCESS;
-                break;
-            }
+            entry.endpoint = EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID;
+            saveSceneEntry(entry, i);
+            emberAfPluginScenesServerDecrNumSceneEntriesInUse();
+            emberAfScenesSetSceneCountAttribute(emberAfCurrentEndpoint(), emberAfPluginScenesServerNumSceneEntriesInUse());
+            status = EMBER_ZCL_STATUS_SUCCESS;
         }
     }
 
@@ -284,12 +594,12 @@ bool emberAfScenesClusterRemoveAllScenesCallback(chip::app::Command * commandObj
         status = EMBER_ZCL_STATUS_SUCCESS;
         for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
         {
-            EmberAfSceneTableEntry entry;
-            emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-            if (entry.endpoint == emberAfCurrentEndpoint() && entry.groupId == groupId)
+            if (isSceneEntryInGroup(i, emberAfCurrentEndpoint(), groupId))
             {
+                EmberAfSceneTableEntry entry;
+                emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
                 entry.endpoint = EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID;
-                emberAfPluginScenesServerSaveSceneEntry(entry, i);
+                saveSceneEntry(entry, i);
                 emberAfPluginScenesServerDecrNumSceneEntriesInUse();
             }
         }
@@ -337,8 +647,7 @@ bool emberAfScenesClusterStoreSceneCallback(chip::app::Command * commandObj, Gro
 bool emberAfScenesClusterRecallSceneCallback(chip::app::Command * commandObj, GroupId groupId, uint8_t sceneId,
                                              uint16_t transitionTime)
 {
-    // NOTE: TransitionTime field in the RecallScene command is currently
-    // ignored. Per Zigbee Alliance ZCL 7 (07-5123-07):
+    // Per Zigbee Alliance ZCL 7 (07-5123-07):
     //
     // "The transition time determines how long the tranition takes from the
     // old cluster state to the new cluster state. It is recommended that, where
@@ -346,14 +655,17 @@ bool emberAfScenesClusterRecallSceneCallback(chip::app::Command * commandObj, Gr
     // a gradual transition SHOULD take place from the old to the new state
     // over this time. However, the exact transition is manufacturer dependent."
     //
-    // The manufacturer-dependent implementation here is to immediately set
-    // all attributes to their scene-specified values, without regard to the
-    // value of TransitionTime.
+    // The manufacturer-dependent implementation here is to move the level and
+    // color to their scene-specified values on the transition engine, and to
+    // immediately set all other attributes.  The TransitionTime is in tenths of
+    // a second, and 0xFFFF stands for the transition time of the scene.
 
     EmberAfStatus status;
     EmberStatus sendStatus;
+    uint32_t transitionTimeMs =
+        (transitionTime == 0xFFFF ? MAX_INT32U_VALUE : static_cast<uint32_t>(transitionTime) * MILLISECOND_TICKS_PER_DECISECOND);
     emberAfScenesClusterPrintln("RX: RecallScene 0x%2x, 0x%x", groupId, sceneId);
-    status = emberAfScenesClusterRecallSavedSceneCallback(emberAfCurrentEndpoint(), groupId, sceneId);
+    status = recallSavedScene(emberAfCurrentEndpoint(), groupId, sceneId, transitionTimeMs);
 #ifdef EMBER_AF_PLUGIN_ZLL_SCENES_SERVER
     if (status == EMBER_ZCL_STATUS_SUCCESS)
     {
@@ -393,11 +705,9 @@ bool emberAfScenesClusterGetSceneMembershipCallback(chip::app::Command * command
         uint8_t i, sceneList[EMBER_AF_PLUGIN_SCENES_TABLE_SIZE];
         for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
         {
-            EmberAfSceneTableEntry entry;
-            emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-            if (entry.endpoint == emberAfCurrentEndpoint() && entry.groupId == groupId)
+            if (isSceneEntryInGroup(i, emberAfCurrentEndpoint(), groupId))
             {
-                sceneList[sceneCount] = entry.sceneId;
+                sceneList[sceneCount] = sceneKeys[i].sceneId;
                 sceneCount++;
             }
         }
@@ -425,28 +735,22 @@ bool emberAfScenesClusterGetSceneMembershipCallback(chip::app::Command * command
 EmberAfStatus emberAfScenesClusterStoreCurrentSceneCallback(EndpointId endpoint, GroupId groupId, uint8_t sceneId)
 {
     EmberAfSceneTableEntry entry;
-    uint8_t i, index = EMBER_AF_SCENE_TABLE_NULL_INDEX;
+    uint8_t index;
+    bool newEntry = false;
 
     if (!isEndpointInGroup(endpoint, groupId))
     {
         return EMBER_ZCL_STATUS_INVALID_FIELD;
     }
 
-    for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
+    index = findSceneEntry(endpoint, groupId, sceneId);
+    if (index == EMBER_AF_SCENE_TABLE_NULL_INDEX)
     {
-        emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-        if (entry.endpoint == endpoint && entry.groupId == groupId && entry.sceneId == sceneId)
-        {
-            index = i;
-            break;
-        }
-        else if (index == EMBER_AF_SCENE_TABLE_NULL_INDEX && entry.endpoint == EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID)
-        {
-            index = i;
-        }
+        index    = findUnusedSceneEntry();
+        newEntry = true;
     }
 
-    // If the target index is still zero, the table is full.
+    // If the target index is still null, the table is full.
     if (index == EMBER_AF_SCENE_TABLE_NULL_INDEX)
     {
         return EMBER_ZCL_STATUS_INSUFFICIENT_SPACE;
@@ -456,67 +760,17 @@ EmberAfStatus emberAfScenesClusterStoreCurrentSceneCallback(EndpointId endpoint,
 
     // When creating a new entry or refreshing an existing one, the extension
     // fields are updated with the current state of other clusters on the device.
-#ifdef ZCL_USING_ON_OFF_CLUSTER_SERVER
-    entry.hasOnOffValue = readServerAttribute(endpoint, ZCL_ON_OFF_CLUSTER_ID, ZCL_ON_OFF_ATTRIBUTE_ID, "on/off",
-                                              (uint8_t *) &entry.onOffValue, sizeof(entry.onOffValue));
-#endif
-#ifdef ZCL_USING_LEVEL_CONTROL_CLUSTER_SERVER
-    entry.hasCurrentLevelValue =
-        readServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID, "current level",
-                            (uint8_t *) &entry.currentLevelValue, sizeof(entry.currentLevelValue));
-#endif
-#ifdef ZCL_USING_THERMOSTAT_CLUSTER_SERVER
-    entry.hasOccupiedCoolingSetpointValue = readServerAttribute(
-        endpoint, ZCL_THERMOSTAT_CLUSTER_ID, ZCL_OCCUPIED_COOLING_SETPOINT_ATTRIBUTE_ID, "occupied cooling setpoint",
-        (uint8_t *) &entry.occupiedCoolingSetpointValue, sizeof(entry.occupiedCoolingSetpointValue));
-    entry.hasOccupiedHeatingSetpointValue = readServerAttribute(
-        endpoint, ZCL_THERMOSTAT_CLUSTER_ID, ZCL_OCCUPIED_HEATING_SETPOINT_ATTRIBUTE_ID, "occupied heating setpoint",
-        (uint8_t *) &entry.occupiedHeatingSetpointValue, sizeof(entry.occupiedHeatingSetpointValue));
-    entry.hasSystemModeValue = readServerAttribute(endpoint, ZCL_THERMOSTAT_CLUSTER_ID, ZCL_SYSTEM_MODE_ATTRIBUTE_ID, "system mode",
-                                                   (uint8_t *) &entry.systemModeValue, sizeof(entry.systemModeValue));
-#endif
-#ifdef ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
-    entry.hasCurrentXValue = readServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_X_ATTRIBUTE_ID,
-                                                 "current x", (uint8_t *) &entry.currentXValue, sizeof(entry.currentXValue));
-    entry.hasCurrentYValue = readServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_Y_ATTRIBUTE_ID,
-                                                 "current y", (uint8_t *) &entry.currentYValue, sizeof(entry.currentYValue));
-    entry.hasEnhancedCurrentHueValue = readServerAttribute(
-        endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_ENHANCED_CURRENT_HUE_ATTRIBUTE_ID, "enhanced current hue",
-        (uint8_t *) &entry.enhancedCurrentHueValue, sizeof(entry.enhancedCurrentHueValue));
-    entry.hasCurrentSaturationValue =
-        readServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_SATURATION_ATTRIBUTE_ID,
-                            "current saturation", (uint8_t *) &entry.currentSaturationValue, sizeof(entry.currentSaturationValue));
-    entry.hasColorLoopActiveValue =
-        readServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_ACTIVE_ATTRIBUTE_ID,
-                            "color loop active", (uint8_t *) &entry.colorLoopActiveValue, sizeof(entry.colorLoopActiveValue));
-    entry.hasColorLoopDirectionValue = readServerAttribute(
-        endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_DIRECTION_ATTRIBUTE_ID, "color loop direction",
-        (uint8_t *) &entry.colorLoopDirectionValue, sizeof(entry.colorLoopDirectionValue));
-    entry.hasColorLoopTimeValue =
-        readServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_TIME_ATTRIBUTE_ID,
-                            "color loop time", (uint8_t *) &entry.colorLoopTimeValue, sizeof(entry.colorLoopTimeValue));
-    entry.hasColorTemperatureMiredsValue = readServerAttribute(
-        endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_TEMPERATURE_ATTRIBUTE_ID, "color temp mireds",
-        (uint8_t *) &entry.colorTemperatureMiredsValue, sizeof(entry.colorTemperatureMiredsValue));
-#endif // ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
-#ifdef ZCL_USING_DOOR_LOCK_CLUSTER_SERVER
-    entry.hasLockStateValue = readServerAttribute(endpoint, ZCL_DOOR_LOCK_CLUSTER_ID, ZCL_LOCK_STATE_ATTRIBUTE_ID, "lock state",
-                                                  (uint8_t *) &entry.lockStateValue, sizeof(entry.lockStateValue));
-#endif
-#ifdef ZCL_USING_WINDOW_COVERING_CLUSTER_SERVER
-    entry.hasCurrentPositionLiftPercentageValue = readServerAttribute(
-        endpoint, ZCL_WINDOW_COVERING_CLUSTER_ID, ZCL_CURRENT_LIFT_PERCENTAGE_ATTRIBUTE_ID, "current position lift percentage",
-        (uint8_t *) &entry.currentPositionLiftPercentageValue, sizeof(entry.currentPositionLiftPercentageValue));
-    entry.hasCurrentPositionTiltPercentageValue = readServerAttribute(
-        endpoint, ZCL_WINDOW_COVERING_CLUSTER_ID, ZCL_CURRENT_TILT_PERCENTAGE_ATTRIBUTE_ID, "current position tilt percentage",
-        (uint8_t *) &entry.currentPositionTiltPercentageValue, sizeof(entry.currentPositionTiltPercentageValue));
-#endif
+    for (const SceneExtensionAttribute * attribute = sceneExtensionAttributes; attribute->name != NULL; attribute++)
+    {
+        *sceneHasValue(&entry, attribute) = readServerAttribute(endpoint, attribute->clusterId, attribute->attributeId,
+                                                                attribute->name, sceneValue(&entry, attribute), attribute->size);
+    }
 
     // When creating a new entry, the name is set to the null string (i.e., the
     // length is set to zero) and the transition time is set to zero.  The scene
     // count must be increased and written to the attribute table when adding a
     // new scene.  Otherwise, these fields and the count are left alone.
-    if (i != index)
+    if (newEntry)
     {
         entry.endpoint = endpoint;
         entry.groupId  = groupId;
@@ -532,133 +786,43 @@ EmberAfStatus emberAfScenesClusterStoreCurrentSceneCallback(EndpointId endpoint,
 
     // Save the scene entry and mark is as valid by storing its scene and group
     // ids in the attribute table and setting valid to true.
-    emberAfPluginScenesServerSaveSceneEntry(entry, index);
+    saveSceneEntry(entry, index);
     emberAfScenesMakeValid(endpoint, sceneId, groupId);
     return EMBER_ZCL_STATUS_SUCCESS;
 }
 
-EmberAfStatus emberAfScenesClusterRecallSavedSceneCallback(EndpointId endpoint, GroupId groupId, uint8_t sceneId)
+// Recalls a scene, moving the attributes that can to its values over
+// transitionTimeMs.
+static EmberAfStatus recallSavedScene(EndpointId endpoint, GroupId groupId, uint8_t sceneId, uint32_t transitionTimeMs)
 {
+    EmberAfSceneTableEntry entry;
+    uint8_t index;
+
     if (!isEndpointInGroup(endpoint, groupId))
     {
         return EMBER_ZCL_STATUS_INVALID_FIELD;
     }
-    else
+
+    index = findSceneEntry(endpoint, groupId, sceneId);
+    if (index == EMBER_AF_SCENE_TABLE_NULL_INDEX)
     {
-        uint8_t i;
-        for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
-        {
-            EmberAfSceneTableEntry entry;
-            emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-            if (entry.endpoint == endpoint && entry.groupId == groupId && entry.sceneId == sceneId)
-            {
-#ifdef ZCL_USING_ON_OFF_CLUSTER_SERVER
-                if (entry.hasOnOffValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_ON_OFF_CLUSTER_ID, ZCL_ON_OFF_ATTRIBUTE_ID, "on/off",
-                                         (uint8_t *) &entry.onOffValue, ZCL_BOOLEAN_ATTRIBUTE_TYPE);
-                }
-#endif
-#ifdef ZCL_USING_LEVEL_CONTROL_CLUSTER_SERVER
-                if (entry.hasCurrentLevelValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_LEVEL_CONTROL_CLUSTER_ID, ZCL_CURRENT_LEVEL_ATTRIBUTE_ID, "current level",
-                                         (uint8_t *) &entry.currentLevelValue, ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-#endif
-#ifdef ZCL_USING_THERMOSTAT_CLUSTER_SERVER
-                if (entry.hasOccupiedCoolingSetpointValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_THERMOSTAT_CLUSTER_ID, ZCL_OCCUPIED_COOLING_SETPOINT_ATTRIBUTE_ID,
-                                         "occupied cooling setpoint", (uint8_t *) &entry.occupiedCoolingSetpointValue,
-                                         ZCL_INT16S_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasOccupiedHeatingSetpointValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_THERMOSTAT_CLUSTER_ID, ZCL_OCCUPIED_HEATING_SETPOINT_ATTRIBUTE_ID,
-                                         "occupied heating setpoint", (uint8_t *) &entry.occupiedHeatingSetpointValue,
-                                         ZCL_INT16S_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasSystemModeValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_THERMOSTAT_CLUSTER_ID, ZCL_SYSTEM_MODE_ATTRIBUTE_ID, "system mode",
-                                         (uint8_t *) &entry.systemModeValue, ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-#endif
-#ifdef ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
-                if (entry.hasCurrentXValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_X_ATTRIBUTE_ID,
-                                         "current x", (uint8_t *) &entry.currentXValue, ZCL_INT16U_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasCurrentYValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_Y_ATTRIBUTE_ID,
-                                         "current y", (uint8_t *) &entry.currentYValue, ZCL_INT16U_ATTRIBUTE_TYPE);
-                }
+        return EMBER_ZCL_STATUS_NOT_FOUND;
+    }
 
-                if (entry.hasEnhancedCurrentHueValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID,
-                                         ZCL_COLOR_CONTROL_ENHANCED_CURRENT_HUE_ATTRIBUTE_ID, "enhanced current hue",
-                                         (uint8_t *) &entry.enhancedCurrentHueValue, ZCL_INT16U_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasCurrentSaturationValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_CURRENT_SATURATION_ATTRIBUTE_ID,
-                                         "current saturation", (uint8_t *) &entry.currentSaturationValue, ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasColorLoopActiveValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_ACTIVE_ATTRIBUTE_ID,
-                                         "color loop active", (uint8_t *) &entry.colorLoopActiveValue, ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasColorLoopDirectionValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID,
-                                         ZCL_COLOR_CONTROL_COLOR_LOOP_DIRECTION_ATTRIBUTE_ID, "color loop direction",
-                                         (uint8_t *) &entry.colorLoopDirectionValue, ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasColorLoopTimeValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_LOOP_TIME_ATTRIBUTE_ID,
-                                         "color loop time", (uint8_t *) &entry.colorLoopTimeValue, ZCL_INT16U_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasColorTemperatureMiredsValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_COLOR_CONTROL_CLUSTER_ID, ZCL_COLOR_CONTROL_COLOR_TEMPERATURE_ATTRIBUTE_ID,
-                                         "color temp mireds", (uint8_t *) &entry.colorTemperatureMiredsValue,
-                                         ZCL_INT16U_ATTRIBUTE_TYPE);
-                }
-#endif // ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
-#ifdef ZCL_USING_DOOR_LOCK_CLUSTER_SERVER
-                if (entry.hasLockStateValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_DOOR_LOCK_CLUSTER_ID, ZCL_LOCK_STATE_ATTRIBUTE_ID, "lock state",
-                                         (uint8_t *) &entry.lockStateValue, ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-#endif
-#ifdef ZCL_USING_WINDOW_COVERING_CLUSTER_SERVER
-                if (entry.hasCurrentPositionLiftPercentageValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_WINDOW_COVERING_CLUSTER_ID, ZCL_CURRENT_LIFT_PERCENTAGE_ATTRIBUTE_ID,
-                                         "current position lift percentage", (uint8_t *) &entry.currentPositionLiftPercentageValue,
-                                         ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-                if (entry.hasCurrentPositionTiltPercentageValue)
-                {
-                    writeServerAttribute(endpoint, ZCL_WINDOW_COVERING_CLUSTER_ID, ZCL_CURRENT_TILT_PERCENTAGE_ATTRIBUTE_ID,
-                                         "current position tilt percentage", (uint8_t *) &entry.currentPositionTiltPercentageValue,
-                                         ZCL_INT8U_ATTRIBUTE_TYPE);
-                }
-#endif
-                emberAfScenesMakeValid(endpoint, sceneId, groupId);
-                return EMBER_ZCL_STATUS_SUCCESS;
-            }
-        }
+    emberAfPluginScenesServerRetrieveSceneEntry(entry, index);
+    if (transitionTimeMs == MAX_INT32U_VALUE)
+    {
+        transitionTimeMs = static_cast<uint32_t>(entry.transitionTime) * MILLISECOND_TICKS_PER_SECOND +
+            static_cast<uint32_t>(entry.transitionTime100ms) * MILLISECOND_TICKS_PER_DECISECOND;
     }
+    restoreSceneEntry(endpoint, &entry, transitionTimeMs);
+    emberAfScenesMakeValid(endpoint, sceneId, groupId);
+    return EMBER_ZCL_STATUS_SUCCESS;
+}
 
-    return EMBER_ZCL_STATUS_NOT_FOUND;
+EmberAfStatus emberAfScenesClusterRecallSavedSceneCallback(EndpointId endpoint, GroupId groupId, uint8_t sceneId)
+{
+    return recallSavedScene(endpoint, groupId, sceneId, 0);
 }
 
 bool emberAfPluginScenesServerParseAddScene(const EmberAfClusterCommand * cmd, GroupId groupId, uint8_t sceneId,
@@ -673,7 +837,8 @@ bool emberAfPluginScenesServerParseAddScene(const EmberAfClusterCommand * cmd, G
         (cmd->payloadStartIndex + sizeof(groupId) + sizeof(sceneId) + sizeof(transitionTime) + emberAfStringLength(sceneName) + 1));
     uint16_t extensionFieldSetsIndex = 0;
     EndpointId endpoint              = cmd->apsFrame->destinationEndpoint;
-    uint8_t i, index = EMBER_AF_SCENE_TABLE_NULL_INDEX;
+    uint8_t index;
+    bool newEntry = false;
 
     emberAfScenesClusterPrint("RX: %pAddScene 0x%2x, 0x%x, 0x%2x, \"", (enhanced ? "Enhanced" : ""), groupId, sceneId,
                               transitionTime);
@@ -689,21 +854,14 @@ bool emberAfPluginScenesServerParseAddScene(const EmberAfClusterCommand * cmd, G
         goto kickout;
     }
 
-    for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
+    index = findSceneEntry(endpoint, groupId, sceneId);
+    if (index == EMBER_AF_SCENE_TABLE_NULL_INDEX)
     {
-        emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-        if (entry.endpoint == endpoint && entry.groupId == groupId && entry.sceneId == sceneId)
-        {
-            index = i;
-            break;
-        }
-        else if (index == EMBER_AF_SCENE_TABLE_NULL_INDEX && entry.endpoint == EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID)
-        {
-            index = i;
-        }
+        index    = findUnusedSceneEntry();
+        newEntry = true;
     }
 
-    // If the target index is still zero, the table is full.
+    // If the target index is still null, the table is full.
     if (index == EMBER_AF_SCENE_TABLE_NULL_INDEX)
     {
         status = EMBER_ZCL_STATUS_INSUFFICIENT_SPACE;
@@ -731,36 +889,12 @@ bool emberAfPluginScenesServerParseAddScene(const EmberAfClusterCommand * cmd, G
 
     // When adding a new scene, wipe out all of the extensions before parsing the
     // extension field sets data.
-    if (i != index)
+    if (newEntry)
     {
-#ifdef ZCL_USING_ON_OFF_CLUSTER_SERVER
-        entry.hasOnOffValue = false;
-#endif
-#ifdef ZCL_USING_LEVEL_CONTROL_CLUSTER_SERVER
-        entry.hasCurrentLevelValue = false;
-#endif
-#ifdef ZCL_USING_THERMOSTAT_CLUSTER_SERVER
-        entry.hasOccupiedCoolingSetpointValue = false;
-        entry.hasOccupiedHeatingSetpointValue = false;
-        entry.hasSystemModeValue              = false;
-#endif
-#ifdef ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
-        entry.hasCurrentXValue               = false;
-        entry.hasCurrentYValue               = false;
-        entry.hasEnhancedCurrentHueValue     = false;
-        entry.hasCurrentSaturationValue      = false;
-        entry.hasColorLoopActiveValue        = false;
-        entry.hasColorLoopDirectionValue     = false;
-        entry.hasColorLoopTimeValue          = false;
-        entry.hasColorTemperatureMiredsValue = false;
-#endif // ZCL_USING_COLOR_CONTROL_CLUSTER_SERVER
-#ifdef ZCL_USING_DOOR_LOCK_CLUSTER_SERVER
-        entry.hasLockStateValue = false;
-#endif
-#ifdef ZCL_USING_WINDOW_COVERING_CLUSTER_SERVER
-        entry.hasCurrentPositionLiftPercentageValue = false;
-        entry.hasCurrentPositionTiltPercentageValue = false;
-#endif
+        for (const SceneExtensionAttribute * attribute = sceneExtensionAttributes; attribute->name != NULL; attribute++)
+        {
+            *sceneHasValue(&entry, attribute) = false;
+        }
     }
 
     while (extensionFieldSetsIndex < extensionFieldSetsLen)
@@ -957,7 +1091,7 @@ bool emberAfPluginScenesServerParseAddScene(const EmberAfClusterCommand * cmd, G
     // If we got this far, we either added a new entry or updated an existing one.
     // If we added, store the basic data and increment the scene count.  In either
     // case, save the entry.
-    if (i != index)
+    if (newEntry)
     {
         entry.endpoint = endpoint;
         entry.groupId  = groupId;
@@ -965,7 +1099,7 @@ bool emberAfPluginScenesServerParseAddScene(const EmberAfClusterCommand * cmd, G
         emberAfPluginScenesServerIncrNumSceneEntriesInUse();
         emberAfScenesSetSceneCountAttribute(endpoint, emberAfPluginScenesServerNumSceneEntriesInUse());
     }
-    emberAfPluginScenesServerSaveSceneEntry(entry, index);
+    saveSceneEntry(entry, index);
     status = EMBER_ZCL_STATUS_SUCCESS;
 
 kickout:
@@ -1003,15 +1137,11 @@ bool emberAfPluginScenesServerParseViewScene(const EmberAfClusterCommand * cmd,
     }
     else
     {
-        uint8_t i;
-        for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
+        uint8_t i = findSceneEntry(endpoint, groupId, sceneId);
+        if (i != EMBER_AF_SCENE_TABLE_NULL_INDEX)
         {
             emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-            if (entry.endpoint == endpoint && entry.groupId == groupId && entry.sceneId == sceneId)
-            {
-                status = EMBER_ZCL_STATUS_SUCCESS;
-                break;
-            }
+            status = EMBER_ZCL_STATUS_SUCCESS;
         }
     }
 
@@ -1164,13 +1294,13 @@ void emberAfScenesClusterRemoveScenesInGroupCallback(EndpointId endpoint, GroupI
     uint8_t i;
     for (i = 0; i < EMBER_AF_PLUGIN_SCENES_TABLE_SIZE; i++)
     {
-        EmberAfSceneTableEntry entry;
-        emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
-        if (entry.endpoint == endpoint && entry.groupId == groupId)
+        if (isSceneEntryInGroup(i, endpoint, groupId))
         {
+            EmberAfSceneTableEntry entry;
+            emberAfPluginScenesServerRetrieveSceneEntry(entry, i);
             entry.groupId  = ZCL_SCENES_GLOBAL_SCENE_GROUP_ID;
             entry.endpoint = EMBER_AF_SCENE_TABLE_UNUSED_ENDPOINT_ID;
-            emberAfPluginScenesServerSaveSceneEntry(entry, i);
+            saveSceneEntry(entry, i);
             emberAfPluginScenesServerDecrNumSceneEntriesInUse();
             emberAfScenesSetSceneCountAttribute(emberAfCurrentEndpoint(), emberAfPluginScenesServerNumSceneEntriesInUse());
         }
@@ -19,6 +19,7 @@
 
 #include <app/chip-zcl-zpro-codec.h>
 
+#include <core/CHIPEncoding.h>
 #include <support/BufferWriter.h>
 #include <support/SafeInt.h>
 #include <support/logging/CHIPLogging.h>
@@ -29,6 +30,7 @@
 using namespace chip;
 using namespace chip::System;
 using namespace chip::Encoding::LittleEndian;
+using chip::Encoding::Write8;
 
 static uint16_t doEncodeApsFrame(BufferWriter & buf, ClusterId clusterId, EndpointId sourceEndpoint, EndpointId destinationEndpoint,
                                  EmberApsOption options, GroupId groupId, uint8_t sequence, uint8_t radius, bool isMeasuring)
@@ -88,7 +90,13 @@ uint16_t encodeApsFrame(uint8_t * buffer, uint16_t buf_length, EmberApsFrame * a
     if (doEncodeApsFrame(buf, clusterId, kSourceEndpoint, destinationEndpoint, 0, 0, 0, 0, false))                                 \
     {
 
+#define COMMAND_PAYLOAD(size)                                                                                                      \
+    uint8_t * p = buf.Reserve(size);                                                                                               \
+    if (p != nullptr)                                                                                                              \
+    {
+
 #define COMMAND_FOOTER()                                                                                                           \
+    }                                                                                                                              \
     }                                                                                                                              \
     if (!buf.Fit())                                                                                                                \
     {                                                                                                                              \
@@ -96,6 +104,13 @@ uint16_t encodeApsFrame(uint8_t * buffer, uint16_t buf_length, EmberApsFrame * a
     }                                                                                                                              \
     return buf.Finalize();
 
+// Appends bytes as they are, straight from the buffer of the caller.
+static void WriteBytes(uint8_t *& p, const uint8_t * data, size_t length)
+{
+    memcpy(p, data, length);
+    p += length;
+}
+
 /*----------------------------------------------------------------------------*\
 | Cluster Name                                                        |   ID   |
 |---------------------------------------------------------------------+--------|
@@ -366,6 +381,10 @@ constexpr uint8_t kFrameControlClusterSpecificCommand = 0x01;
 // to server, so all the remaining bits are 0.
 constexpr uint8_t kFrameControlGlobalCommand = 0x00;
 
+// The frame control, the sequence number and the command id, which start the
+// payload of every command.
+constexpr size_t kZclHeaderSize = 3;
+
 // Pick source endpoint as 1 for now
 constexpr EndpointId kSourceEndpoint = 1;
 
@@ -394,11 +413,13 @@ PacketBufferHandle encodeAccountLoginClusterGetSetupPINCommand(uint8_t seqNum, E
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_GET_SETUP_PIN_COMMAND_ID)
-        .Put(static_cast<uint8_t>(tempAccountIdentifierStrLen))
-        .Put(tempAccountIdentifier.data(), tempAccountIdentifier.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + tempAccountIdentifierStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_SETUP_PIN_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(tempAccountIdentifierStrLen));
+    WriteBytes(p, tempAccountIdentifier.data(), tempAccountIdentifierStrLen);
     COMMAND_FOOTER();
 }
 
@@ -423,20 +444,27 @@ PacketBufferHandle encodeAccountLoginClusterLoginCommand(uint8_t seqNum, Endpoin
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_LOGIN_COMMAND_ID)
-        .Put(static_cast<uint8_t>(tempAccountIdentifierStrLen))
-        .Put(tempAccountIdentifier.data(), tempAccountIdentifier.size())
-        .Put(static_cast<uint8_t>(setupPINStrLen))
-        .Put(setupPIN.data(), setupPIN.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + tempAccountIdentifierStrLen + setupPINStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_LOGIN_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(tempAccountIdentifierStrLen));
+    WriteBytes(p, tempAccountIdentifier.data(), tempAccountIdentifierStrLen);
+    Write8(p, static_cast<uint8_t>(setupPINStrLen));
+    WriteBytes(p, setupPIN.data(), setupPINStrLen);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeAccountLoginClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverAccountLoginAttributes", ACCOUNT_LOGIN_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -446,7 +474,11 @@ PacketBufferHandle encodeAccountLoginClusterDiscoverAttributes(uint8_t seqNum, E
 PacketBufferHandle encodeAccountLoginClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadAccountLoginClusterRevision", ACCOUNT_LOGIN_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -469,7 +501,12 @@ PacketBufferHandle encodeAccountLoginClusterReadClusterRevisionAttribute(uint8_t
 PacketBufferHandle encodeApplicationBasicClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverApplicationBasicAttributes", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -479,7 +516,11 @@ PacketBufferHandle encodeApplicationBasicClusterDiscoverAttributes(uint8_t seqNu
 PacketBufferHandle encodeApplicationBasicClusterReadVendorNameAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicVendorName", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -489,7 +530,11 @@ PacketBufferHandle encodeApplicationBasicClusterReadVendorNameAttribute(uint8_t
 PacketBufferHandle encodeApplicationBasicClusterReadVendorIdAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicVendorId", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -499,7 +544,11 @@ PacketBufferHandle encodeApplicationBasicClusterReadVendorIdAttribute(uint8_t se
 PacketBufferHandle encodeApplicationBasicClusterReadApplicationNameAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicApplicationName", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -509,7 +558,11 @@ PacketBufferHandle encodeApplicationBasicClusterReadApplicationNameAttribute(uin
 PacketBufferHandle encodeApplicationBasicClusterReadProductIdAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicProductId", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
@@ -519,7 +572,11 @@ PacketBufferHandle encodeApplicationBasicClusterReadProductIdAttribute(uint8_t s
 PacketBufferHandle encodeApplicationBasicClusterReadApplicationIdAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicApplicationId", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0005);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0005);
     COMMAND_FOOTER();
 }
 
@@ -529,7 +586,11 @@ PacketBufferHandle encodeApplicationBasicClusterReadApplicationIdAttribute(uint8
 PacketBufferHandle encodeApplicationBasicClusterReadCatalogVendorIdAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicCatalogVendorId", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0006);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0006);
     COMMAND_FOOTER();
 }
 
@@ -539,7 +600,11 @@ PacketBufferHandle encodeApplicationBasicClusterReadCatalogVendorIdAttribute(uin
 PacketBufferHandle encodeApplicationBasicClusterReadApplicationSatusAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicApplicationSatus", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0007);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0007);
     COMMAND_FOOTER();
 }
 
@@ -549,7 +614,11 @@ PacketBufferHandle encodeApplicationBasicClusterReadApplicationSatusAttribute(ui
 PacketBufferHandle encodeApplicationBasicClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationBasicClusterRevision", APPLICATION_BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -586,21 +655,28 @@ PacketBufferHandle encodeApplicationLauncherClusterLaunchAppCommand(uint8_t seqN
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_LAUNCH_APP_COMMAND_ID)
-        .Put(static_cast<uint8_t>(dataStrLen))
-        .Put(data.data(), data.size())
-        .Put16(catalogVendorId)
-        .Put(static_cast<uint8_t>(applicationIdStrLen))
-        .Put(applicationId.data(), applicationId.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + dataStrLen + applicationIdStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_LAUNCH_APP_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(dataStrLen));
+    WriteBytes(p, data.data(), dataStrLen);
+    Write16(p, catalogVendorId);
+    Write8(p, static_cast<uint8_t>(applicationIdStrLen));
+    WriteBytes(p, applicationId.data(), applicationIdStrLen);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeApplicationLauncherClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverApplicationLauncherAttributes", APPLICATION_LAUNCHER_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -611,7 +687,11 @@ PacketBufferHandle encodeApplicationLauncherClusterReadApplicationLauncherListAt
                                                                                         EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationLauncherApplicationLauncherList", APPLICATION_LAUNCHER_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -621,7 +701,11 @@ PacketBufferHandle encodeApplicationLauncherClusterReadApplicationLauncherListAt
 PacketBufferHandle encodeApplicationLauncherClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadApplicationLauncherClusterRevision", APPLICATION_LAUNCHER_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -652,12 +736,14 @@ PacketBufferHandle encodeAudioOutputClusterRenameOutputCommand(uint8_t seqNum, E
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_RENAME_OUTPUT_COMMAND_ID)
-        .Put8(index)
-        .Put(static_cast<uint8_t>(nameStrLen))
-        .Put(name.data(), name.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + nameStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_RENAME_OUTPUT_COMMAND_ID);
+    Write8(p, index);
+    Write8(p, static_cast<uint8_t>(nameStrLen));
+    WriteBytes(p, name.data(), nameStrLen);
     COMMAND_FOOTER();
 }
 
@@ -668,14 +754,24 @@ PacketBufferHandle encodeAudioOutputClusterSelectOutputCommand(uint8_t seqNum, E
 {
     COMMAND_HEADER("SelectOutput", AUDIO_OUTPUT_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SELECT_OUTPUT_COMMAND_ID).Put8(index);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SELECT_OUTPUT_COMMAND_ID);
+    Write8(p, index);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeAudioOutputClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverAudioOutputAttributes", AUDIO_OUTPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -685,7 +781,11 @@ PacketBufferHandle encodeAudioOutputClusterDiscoverAttributes(uint8_t seqNum, En
 PacketBufferHandle encodeAudioOutputClusterReadAudioOutputListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadAudioOutputAudioOutputList", AUDIO_OUTPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -695,7 +795,11 @@ PacketBufferHandle encodeAudioOutputClusterReadAudioOutputListAttribute(uint8_t
 PacketBufferHandle encodeAudioOutputClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadAudioOutputClusterRevision", AUDIO_OUTPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -722,7 +826,12 @@ PacketBufferHandle encodeBarrierControlClusterBarrierControlGoToPercentCommand(u
 {
     COMMAND_HEADER("BarrierControlGoToPercent", BARRIER_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_BARRIER_CONTROL_GO_TO_PERCENT_COMMAND_ID).Put8(percentOpen);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_BARRIER_CONTROL_GO_TO_PERCENT_COMMAND_ID);
+    Write8(p, percentOpen);
     COMMAND_FOOTER();
 }
 
@@ -732,14 +841,23 @@ PacketBufferHandle encodeBarrierControlClusterBarrierControlGoToPercentCommand(u
 PacketBufferHandle encodeBarrierControlClusterBarrierControlStopCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("BarrierControlStop", BARRIER_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_BARRIER_CONTROL_STOP_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_BARRIER_CONTROL_STOP_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeBarrierControlClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverBarrierControlAttributes", BARRIER_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -749,7 +867,11 @@ PacketBufferHandle encodeBarrierControlClusterDiscoverAttributes(uint8_t seqNum,
 PacketBufferHandle encodeBarrierControlClusterReadBarrierMovingStateAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBarrierControlBarrierMovingState", BARRIER_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -759,7 +881,11 @@ PacketBufferHandle encodeBarrierControlClusterReadBarrierMovingStateAttribute(ui
 PacketBufferHandle encodeBarrierControlClusterReadBarrierSafetyStatusAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBarrierControlBarrierSafetyStatus", BARRIER_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -769,7 +895,11 @@ PacketBufferHandle encodeBarrierControlClusterReadBarrierSafetyStatusAttribute(u
 PacketBufferHandle encodeBarrierControlClusterReadBarrierCapabilitiesAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBarrierControlBarrierCapabilities", BARRIER_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
@@ -779,7 +909,11 @@ PacketBufferHandle encodeBarrierControlClusterReadBarrierCapabilitiesAttribute(u
 PacketBufferHandle encodeBarrierControlClusterReadBarrierPositionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBarrierControlBarrierPosition", BARRIER_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000A);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000A);
     COMMAND_FOOTER();
 }
 
@@ -789,7 +923,11 @@ PacketBufferHandle encodeBarrierControlClusterReadBarrierPositionAttribute(uint8
 PacketBufferHandle encodeBarrierControlClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBarrierControlClusterRevision", BARRIER_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -826,14 +964,24 @@ PacketBufferHandle encodeBarrierControlClusterReadClusterRevisionAttribute(uint8
 PacketBufferHandle encodeBasicClusterMfgSpecificPingCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MfgSpecificPing", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand | (1u << 2)).Put16(0x1002).Put8(seqNum).Put8(ZCL_MFG_SPECIFIC_PING_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand | (1u << 2));
+    Write16(p, 0x1002);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MFG_SPECIFIC_PING_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeBasicClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverBasicAttributes", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -843,7 +991,11 @@ PacketBufferHandle encodeBasicClusterDiscoverAttributes(uint8_t seqNum, Endpoint
 PacketBufferHandle encodeBasicClusterReadInteractionModelVersionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicInteractionModelVersion", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -853,7 +1005,11 @@ PacketBufferHandle encodeBasicClusterReadInteractionModelVersionAttribute(uint8_
 PacketBufferHandle encodeBasicClusterReadVendorNameAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicVendorName", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -863,7 +1019,11 @@ PacketBufferHandle encodeBasicClusterReadVendorNameAttribute(uint8_t seqNum, End
 PacketBufferHandle encodeBasicClusterReadVendorIDAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicVendorID", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -873,7 +1033,11 @@ PacketBufferHandle encodeBasicClusterReadVendorIDAttribute(uint8_t seqNum, Endpo
 PacketBufferHandle encodeBasicClusterReadProductNameAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicProductName", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
@@ -883,7 +1047,11 @@ PacketBufferHandle encodeBasicClusterReadProductNameAttribute(uint8_t seqNum, En
 PacketBufferHandle encodeBasicClusterReadProductIDAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicProductID", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0004);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0004);
     COMMAND_FOOTER();
 }
 
@@ -893,7 +1061,11 @@ PacketBufferHandle encodeBasicClusterReadProductIDAttribute(uint8_t seqNum, Endp
 PacketBufferHandle encodeBasicClusterReadUserLabelAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicUserLabel", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0005);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0005);
     COMMAND_FOOTER();
 }
 
@@ -908,13 +1080,15 @@ PacketBufferHandle encodeBasicClusterWriteUserLabelAttribute(uint8_t seqNum, End
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0005)
-        .Put8(66)
-        .Put(static_cast<uint8_t>(userLabelStrLen))
-        .Put(userLabel.data(), userLabelStrLen);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + userLabelStrLen);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0005);
+    Write8(p, 66);
+    Write8(p, static_cast<uint8_t>(userLabelStrLen));
+    WriteBytes(p, userLabel.data(), userLabelStrLen);
     COMMAND_FOOTER();
 }
 
@@ -924,7 +1098,11 @@ PacketBufferHandle encodeBasicClusterWriteUserLabelAttribute(uint8_t seqNum, End
 PacketBufferHandle encodeBasicClusterReadLocationAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicLocation", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0006);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0006);
     COMMAND_FOOTER();
 }
 
@@ -938,13 +1116,15 @@ PacketBufferHandle encodeBasicClusterWriteLocationAttribute(uint8_t seqNum, Endp
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0006)
-        .Put8(66)
-        .Put(static_cast<uint8_t>(locationStrLen))
-        .Put(location.data(), locationStrLen);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + locationStrLen);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0006);
+    Write8(p, 66);
+    Write8(p, static_cast<uint8_t>(locationStrLen));
+    WriteBytes(p, location.data(), locationStrLen);
     COMMAND_FOOTER();
 }
 
@@ -954,7 +1134,11 @@ PacketBufferHandle encodeBasicClusterWriteLocationAttribute(uint8_t seqNum, Endp
 PacketBufferHandle encodeBasicClusterReadHardwareVersionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicHardwareVersion", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0007);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0007);
     COMMAND_FOOTER();
 }
 
@@ -964,7 +1148,11 @@ PacketBufferHandle encodeBasicClusterReadHardwareVersionAttribute(uint8_t seqNum
 PacketBufferHandle encodeBasicClusterReadHardwareVersionStringAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicHardwareVersionString", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0008);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0008);
     COMMAND_FOOTER();
 }
 
@@ -974,7 +1162,11 @@ PacketBufferHandle encodeBasicClusterReadHardwareVersionStringAttribute(uint8_t
 PacketBufferHandle encodeBasicClusterReadSoftwareVersionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicSoftwareVersion", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0009);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0009);
     COMMAND_FOOTER();
 }
 
@@ -984,7 +1176,11 @@ PacketBufferHandle encodeBasicClusterReadSoftwareVersionAttribute(uint8_t seqNum
 PacketBufferHandle encodeBasicClusterReadSoftwareVersionStringAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicSoftwareVersionString", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000A);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000A);
     COMMAND_FOOTER();
 }
 
@@ -994,7 +1190,11 @@ PacketBufferHandle encodeBasicClusterReadSoftwareVersionStringAttribute(uint8_t
 PacketBufferHandle encodeBasicClusterReadManufacturingDateAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicManufacturingDate", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000B);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000B);
     COMMAND_FOOTER();
 }
 
@@ -1004,7 +1204,11 @@ PacketBufferHandle encodeBasicClusterReadManufacturingDateAttribute(uint8_t seqN
 PacketBufferHandle encodeBasicClusterReadPartNumberAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicPartNumber", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000C);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000C);
     COMMAND_FOOTER();
 }
 
@@ -1014,7 +1218,11 @@ PacketBufferHandle encodeBasicClusterReadPartNumberAttribute(uint8_t seqNum, End
 PacketBufferHandle encodeBasicClusterReadProductURLAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicProductURL", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000D);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000D);
     COMMAND_FOOTER();
 }
 
@@ -1024,7 +1232,11 @@ PacketBufferHandle encodeBasicClusterReadProductURLAttribute(uint8_t seqNum, End
 PacketBufferHandle encodeBasicClusterReadProductLabelAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicProductLabel", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000E);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000E);
     COMMAND_FOOTER();
 }
 
@@ -1034,7 +1246,11 @@ PacketBufferHandle encodeBasicClusterReadProductLabelAttribute(uint8_t seqNum, E
 PacketBufferHandle encodeBasicClusterReadSerialNumberAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicSerialNumber", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000F);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000F);
     COMMAND_FOOTER();
 }
 
@@ -1044,7 +1260,11 @@ PacketBufferHandle encodeBasicClusterReadSerialNumberAttribute(uint8_t seqNum, E
 PacketBufferHandle encodeBasicClusterReadLocalConfigDisabledAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicLocalConfigDisabled", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0010);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0010);
     COMMAND_FOOTER();
 }
 
@@ -1052,12 +1272,14 @@ PacketBufferHandle encodeBasicClusterWriteLocalConfigDisabledAttribute(uint8_t s
                                                                        uint8_t localConfigDisabled)
 {
     COMMAND_HEADER("WriteBasicLocalConfigDisabled", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0010)
-        .Put8(16)
-        .Put8(static_cast<uint8_t>(localConfigDisabled));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0010);
+    Write8(p, 16);
+    Write8(p, static_cast<uint8_t>(localConfigDisabled));
     COMMAND_FOOTER();
 }
 
@@ -1067,7 +1289,11 @@ PacketBufferHandle encodeBasicClusterWriteLocalConfigDisabledAttribute(uint8_t s
 PacketBufferHandle encodeBasicClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBasicClusterRevision", BASIC_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -1090,13 +1316,15 @@ PacketBufferHandle encodeBindingClusterBindCommand(uint8_t seqNum, EndpointId de
 {
     COMMAND_HEADER("Bind", BINDING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_BIND_COMMAND_ID)
-        .Put64(nodeId)
-        .Put16(groupId)
-        .Put8(endpointId)
-        .Put16(clusterId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint64_t) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_BIND_COMMAND_ID);
+    Write64(p, nodeId);
+    Write16(p, groupId);
+    Write8(p, endpointId);
+    Write16(p, clusterId);
     COMMAND_FOOTER();
 }
 
@@ -1108,20 +1336,27 @@ PacketBufferHandle encodeBindingClusterUnbindCommand(uint8_t seqNum, EndpointId
 {
     COMMAND_HEADER("Unbind", BINDING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_UNBIND_COMMAND_ID)
-        .Put64(nodeId)
-        .Put16(groupId)
-        .Put8(endpointId)
-        .Put16(clusterId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint64_t) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_UNBIND_COMMAND_ID);
+    Write64(p, nodeId);
+    Write16(p, groupId);
+    Write8(p, endpointId);
+    Write16(p, clusterId);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeBindingClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverBindingAttributes", BINDING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -1131,7 +1366,11 @@ PacketBufferHandle encodeBindingClusterDiscoverAttributes(uint8_t seqNum, Endpoi
 PacketBufferHandle encodeBindingClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadBindingClusterRevision", BINDING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -1216,13 +1455,15 @@ PacketBufferHandle encodeColorControlClusterMoveColorCommand(uint8_t seqNum, End
 {
     COMMAND_HEADER("MoveColor", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_COLOR_COMMAND_ID)
-        .Put16(static_cast<uint16_t>(rateX))
-        .Put16(static_cast<uint16_t>(rateY))
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_COLOR_COMMAND_ID);
+    Write16(p, static_cast<uint16_t>(rateX));
+    Write16(p, static_cast<uint16_t>(rateY));
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1237,15 +1478,18 @@ PacketBufferHandle encodeColorControlClusterMoveColorTemperatureCommand(uint8_t
 {
     COMMAND_HEADER("MoveColorTemperature", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_COLOR_TEMPERATURE_COMMAND_ID)
-        .Put8(moveMode)
-        .Put16(rate)
-        .Put16(colorTemperatureMinimum)
-        .Put16(colorTemperatureMaximum)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) +
+        sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_COLOR_TEMPERATURE_COMMAND_ID);
+    Write8(p, moveMode);
+    Write16(p, rate);
+    Write16(p, colorTemperatureMinimum);
+    Write16(p, colorTemperatureMaximum);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1257,13 +1501,15 @@ PacketBufferHandle encodeColorControlClusterMoveHueCommand(uint8_t seqNum, Endpo
 {
     COMMAND_HEADER("MoveHue", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_HUE_COMMAND_ID)
-        .Put8(moveMode)
-        .Put8(rate)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_HUE_COMMAND_ID);
+    Write8(p, moveMode);
+    Write8(p, rate);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1275,13 +1521,15 @@ PacketBufferHandle encodeColorControlClusterMoveSaturationCommand(uint8_t seqNum
 {
     COMMAND_HEADER("MoveSaturation", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_SATURATION_COMMAND_ID)
-        .Put8(moveMode)
-        .Put8(rate)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_SATURATION_COMMAND_ID);
+    Write8(p, moveMode);
+    Write8(p, rate);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1294,14 +1542,17 @@ PacketBufferHandle encodeColorControlClusterMoveToColorCommand(uint8_t seqNum, E
 {
     COMMAND_HEADER("MoveToColor", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_TO_COLOR_COMMAND_ID)
-        .Put16(colorX)
-        .Put16(colorY)
-        .Put16(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_TO_COLOR_COMMAND_ID);
+    Write16(p, colorX);
+    Write16(p, colorY);
+    Write16(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1314,13 +1565,15 @@ PacketBufferHandle encodeColorControlClusterMoveToColorTemperatureCommand(uint8_
 {
     COMMAND_HEADER("MoveToColorTemperature", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_TO_COLOR_TEMPERATURE_COMMAND_ID)
-        .Put16(colorTemperature)
-        .Put16(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_TO_COLOR_TEMPERATURE_COMMAND_ID);
+    Write16(p, colorTemperature);
+    Write16(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1333,14 +1586,17 @@ PacketBufferHandle encodeColorControlClusterMoveToHueCommand(uint8_t seqNum, End
 {
     COMMAND_HEADER("MoveToHue", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_TO_HUE_COMMAND_ID)
-        .Put8(hue)
-        .Put8(direction)
-        .Put16(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_TO_HUE_COMMAND_ID);
+    Write8(p, hue);
+    Write8(p, direction);
+    Write16(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1353,14 +1609,17 @@ PacketBufferHandle encodeColorControlClusterMoveToHueAndSaturationCommand(uint8_
 {
     COMMAND_HEADER("MoveToHueAndSaturation", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_TO_HUE_AND_SATURATION_COMMAND_ID)
-        .Put8(hue)
-        .Put8(saturation)
-        .Put16(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_TO_HUE_AND_SATURATION_COMMAND_ID);
+    Write8(p, hue);
+    Write8(p, saturation);
+    Write16(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1373,13 +1632,15 @@ PacketBufferHandle encodeColorControlClusterMoveToSaturationCommand(uint8_t seqN
 {
     COMMAND_HEADER("MoveToSaturation", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_TO_SATURATION_COMMAND_ID)
-        .Put8(saturation)
-        .Put16(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_TO_SATURATION_COMMAND_ID);
+    Write8(p, saturation);
+    Write16(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1392,14 +1653,17 @@ PacketBufferHandle encodeColorControlClusterStepColorCommand(uint8_t seqNum, End
 {
     COMMAND_HEADER("StepColor", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_STEP_COLOR_COMMAND_ID)
-        .Put16(static_cast<uint16_t>(stepX))
-        .Put16(static_cast<uint16_t>(stepY))
-        .Put16(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STEP_COLOR_COMMAND_ID);
+    Write16(p, static_cast<uint16_t>(stepX));
+    Write16(p, static_cast<uint16_t>(stepY));
+    Write16(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1414,16 +1678,19 @@ PacketBufferHandle encodeColorControlClusterStepColorTemperatureCommand(uint8_t
 {
     COMMAND_HEADER("StepColorTemperature", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_STEP_COLOR_TEMPERATURE_COMMAND_ID)
-        .Put8(stepMode)
-        .Put16(stepSize)
-        .Put16(transitionTime)
-        .Put16(colorTemperatureMinimum)
-        .Put16(colorTemperatureMaximum)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) +
+        sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STEP_COLOR_TEMPERATURE_COMMAND_ID);
+    Write8(p, stepMode);
+    Write16(p, stepSize);
+    Write16(p, transitionTime);
+    Write16(p, colorTemperatureMinimum);
+    Write16(p, colorTemperatureMaximum);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1436,14 +1703,17 @@ PacketBufferHandle encodeColorControlClusterStepHueCommand(uint8_t seqNum, Endpo
 {
     COMMAND_HEADER("StepHue", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_STEP_HUE_COMMAND_ID)
-        .Put8(stepMode)
-        .Put8(stepSize)
-        .Put8(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STEP_HUE_COMMAND_ID);
+    Write8(p, stepMode);
+    Write8(p, stepSize);
+    Write8(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1456,14 +1726,17 @@ PacketBufferHandle encodeColorControlClusterStepSaturationCommand(uint8_t seqNum
 {
     COMMAND_HEADER("StepSaturation", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_STEP_SATURATION_COMMAND_ID)
-        .Put8(stepMode)
-        .Put8(stepSize)
-        .Put8(transitionTime)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STEP_SATURATION_COMMAND_ID);
+    Write8(p, stepMode);
+    Write8(p, stepSize);
+    Write8(p, transitionTime);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
@@ -1475,18 +1748,25 @@ PacketBufferHandle encodeColorControlClusterStopMoveStepCommand(uint8_t seqNum,
 {
     COMMAND_HEADER("StopMoveStep", COLOR_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_STOP_MOVE_STEP_COMMAND_ID)
-        .Put8(optionsMask)
-        .Put8(optionsOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STOP_MOVE_STEP_COMMAND_ID);
+    Write8(p, optionsMask);
+    Write8(p, optionsOverride);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeColorControlClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverColorControlAttributes", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -1496,7 +1776,11 @@ PacketBufferHandle encodeColorControlClusterDiscoverAttributes(uint8_t seqNum, E
 PacketBufferHandle encodeColorControlClusterReadCurrentHueAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlCurrentHue", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -1504,15 +1788,18 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentHueAttribute(uint8_t
                                                                          uint16_t minInterval, uint16_t maxInterval, uint8_t change)
 {
     COMMAND_HEADER("ReportColorControlCurrentHue", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0000)
-        .Put8(32)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put8(static_cast<uint8_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0000);
+    Write8(p, 32);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write8(p, static_cast<uint8_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -1522,7 +1809,11 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentHueAttribute(uint8_t
 PacketBufferHandle encodeColorControlClusterReadCurrentSaturationAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlCurrentSaturation", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -1531,15 +1822,18 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentSaturationAttribute(
                                                                                 uint8_t change)
 {
     COMMAND_HEADER("ReportColorControlCurrentSaturation", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0001)
-        .Put8(32)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put8(static_cast<uint8_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0001);
+    Write8(p, 32);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write8(p, static_cast<uint8_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -1549,7 +1843,11 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentSaturationAttribute(
 PacketBufferHandle encodeColorControlClusterReadRemainingTimeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlRemainingTime", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -1559,7 +1857,11 @@ PacketBufferHandle encodeColorControlClusterReadRemainingTimeAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadCurrentXAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlCurrentX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
@@ -1567,15 +1869,18 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentXAttribute(uint8_t s
                                                                        uint16_t minInterval, uint16_t maxInterval, uint16_t change)
 {
     COMMAND_HEADER("ReportColorControlCurrentX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0003)
-        .Put8(33)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0003);
+    Write8(p, 33);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -1585,7 +1890,11 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentXAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadCurrentYAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlCurrentY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0004);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0004);
     COMMAND_FOOTER();
 }
 
@@ -1593,15 +1902,18 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentYAttribute(uint8_t s
                                                                        uint16_t minInterval, uint16_t maxInterval, uint16_t change)
 {
     COMMAND_HEADER("ReportColorControlCurrentY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0004)
-        .Put8(33)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0004);
+    Write8(p, 33);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -1611,7 +1923,11 @@ PacketBufferHandle encodeColorControlClusterConfigureCurrentYAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadDriftCompensationAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlDriftCompensation", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0005);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0005);
     COMMAND_FOOTER();
 }
 
@@ -1621,7 +1937,11 @@ PacketBufferHandle encodeColorControlClusterReadDriftCompensationAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadCompensationTextAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlCompensationText", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0006);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0006);
     COMMAND_FOOTER();
 }
 
@@ -1631,7 +1951,11 @@ PacketBufferHandle encodeColorControlClusterReadCompensationTextAttribute(uint8_
 PacketBufferHandle encodeColorControlClusterReadColorTemperatureAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorTemperature", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0007);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0007);
     COMMAND_FOOTER();
 }
 
@@ -1640,15 +1964,18 @@ PacketBufferHandle encodeColorControlClusterConfigureColorTemperatureAttribute(u
                                                                                uint16_t change)
 {
     COMMAND_HEADER("ReportColorControlColorTemperature", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0007)
-        .Put8(33)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0007);
+    Write8(p, 33);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -1658,7 +1985,11 @@ PacketBufferHandle encodeColorControlClusterConfigureColorTemperatureAttribute(u
 PacketBufferHandle encodeColorControlClusterReadColorModeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorMode", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0008);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0008);
     COMMAND_FOOTER();
 }
 
@@ -1668,7 +1999,11 @@ PacketBufferHandle encodeColorControlClusterReadColorModeAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadColorControlOptionsAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorControlOptions", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000F);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000F);
     COMMAND_FOOTER();
 }
 
@@ -1676,12 +2011,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorControlOptionsAttribute(ui
                                                                               uint8_t colorControlOptions)
 {
     COMMAND_HEADER("WriteColorControlColorControlOptions", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x000F)
-        .Put8(24)
-        .Put8(static_cast<uint8_t>(colorControlOptions));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000F);
+    Write8(p, 24);
+    Write8(p, static_cast<uint8_t>(colorControlOptions));
     COMMAND_FOOTER();
 }
 
@@ -1691,7 +2028,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorControlOptionsAttribute(ui
 PacketBufferHandle encodeColorControlClusterReadNumberOfPrimariesAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlNumberOfPrimaries", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0010);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0010);
     COMMAND_FOOTER();
 }
 
@@ -1701,7 +2042,11 @@ PacketBufferHandle encodeColorControlClusterReadNumberOfPrimariesAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadPrimary1XAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary1X", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0011);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0011);
     COMMAND_FOOTER();
 }
 
@@ -1711,7 +2056,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary1XAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary1YAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary1Y", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0012);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0012);
     COMMAND_FOOTER();
 }
 
@@ -1721,7 +2070,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary1YAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary1IntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary1Intensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0013);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0013);
     COMMAND_FOOTER();
 }
 
@@ -1731,7 +2084,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary1IntensityAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadPrimary2XAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary2X", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0015);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0015);
     COMMAND_FOOTER();
 }
 
@@ -1741,7 +2098,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary2XAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary2YAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary2Y", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0016);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0016);
     COMMAND_FOOTER();
 }
 
@@ -1751,7 +2112,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary2YAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary2IntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary2Intensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0017);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0017);
     COMMAND_FOOTER();
 }
 
@@ -1761,7 +2126,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary2IntensityAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadPrimary3XAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary3X", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0019);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0019);
     COMMAND_FOOTER();
 }
 
@@ -1771,7 +2140,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary3XAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary3YAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary3Y", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x001A);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x001A);
     COMMAND_FOOTER();
 }
 
@@ -1781,7 +2154,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary3YAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary3IntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary3Intensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x001B);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x001B);
     COMMAND_FOOTER();
 }
 
@@ -1791,7 +2168,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary3IntensityAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadPrimary4XAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary4X", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0020);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0020);
     COMMAND_FOOTER();
 }
 
@@ -1801,7 +2182,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary4XAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary4YAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary4Y", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0021);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0021);
     COMMAND_FOOTER();
 }
 
@@ -1811,7 +2196,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary4YAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary4IntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary4Intensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0022);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0022);
     COMMAND_FOOTER();
 }
 
@@ -1821,7 +2210,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary4IntensityAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadPrimary5XAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary5X", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0024);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0024);
     COMMAND_FOOTER();
 }
 
@@ -1831,7 +2224,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary5XAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary5YAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary5Y", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0025);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0025);
     COMMAND_FOOTER();
 }
 
@@ -1841,7 +2238,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary5YAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary5IntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary5Intensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0026);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0026);
     COMMAND_FOOTER();
 }
 
@@ -1851,7 +2252,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary5IntensityAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadPrimary6XAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary6X", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0028);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0028);
     COMMAND_FOOTER();
 }
 
@@ -1861,7 +2266,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary6XAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary6YAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary6Y", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0029);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0029);
     COMMAND_FOOTER();
 }
 
@@ -1871,7 +2280,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary6YAttribute(uint8_t seqNu
 PacketBufferHandle encodeColorControlClusterReadPrimary6IntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlPrimary6Intensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x002A);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x002A);
     COMMAND_FOOTER();
 }
 
@@ -1881,7 +2294,11 @@ PacketBufferHandle encodeColorControlClusterReadPrimary6IntensityAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadWhitePointXAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlWhitePointX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0030);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0030);
     COMMAND_FOOTER();
 }
 
@@ -1889,12 +2306,14 @@ PacketBufferHandle encodeColorControlClusterWriteWhitePointXAttribute(uint8_t se
                                                                       uint16_t whitePointX)
 {
     COMMAND_HEADER("WriteColorControlWhitePointX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0030)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(whitePointX));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0030);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(whitePointX));
     COMMAND_FOOTER();
 }
 
@@ -1904,7 +2323,11 @@ PacketBufferHandle encodeColorControlClusterWriteWhitePointXAttribute(uint8_t se
 PacketBufferHandle encodeColorControlClusterReadWhitePointYAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlWhitePointY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0031);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0031);
     COMMAND_FOOTER();
 }
 
@@ -1912,12 +2335,14 @@ PacketBufferHandle encodeColorControlClusterWriteWhitePointYAttribute(uint8_t se
                                                                       uint16_t whitePointY)
 {
     COMMAND_HEADER("WriteColorControlWhitePointY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0031)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(whitePointY));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0031);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(whitePointY));
     COMMAND_FOOTER();
 }
 
@@ -1927,7 +2352,11 @@ PacketBufferHandle encodeColorControlClusterWriteWhitePointYAttribute(uint8_t se
 PacketBufferHandle encodeColorControlClusterReadColorPointRXAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointRX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0032);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0032);
     COMMAND_FOOTER();
 }
 
@@ -1935,12 +2364,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointRXAttribute(uint8_t s
                                                                        uint16_t colorPointRX)
 {
     COMMAND_HEADER("WriteColorControlColorPointRX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0032)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(colorPointRX));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0032);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(colorPointRX));
     COMMAND_FOOTER();
 }
 
@@ -1950,7 +2381,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointRXAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadColorPointRYAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointRY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0033);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0033);
     COMMAND_FOOTER();
 }
 
@@ -1958,12 +2393,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointRYAttribute(uint8_t s
                                                                        uint16_t colorPointRY)
 {
     COMMAND_HEADER("WriteColorControlColorPointRY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0033)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(colorPointRY));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0033);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(colorPointRY));
     COMMAND_FOOTER();
 }
 
@@ -1973,7 +2410,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointRYAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadColorPointRIntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointRIntensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0034);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0034);
     COMMAND_FOOTER();
 }
 
@@ -1981,12 +2422,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointRIntensityAttribute(u
                                                                                uint8_t colorPointRIntensity)
 {
     COMMAND_HEADER("WriteColorControlColorPointRIntensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0034)
-        .Put8(32)
-        .Put8(static_cast<uint8_t>(colorPointRIntensity));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0034);
+    Write8(p, 32);
+    Write8(p, static_cast<uint8_t>(colorPointRIntensity));
     COMMAND_FOOTER();
 }
 
@@ -1996,7 +2439,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointRIntensityAttribute(u
 PacketBufferHandle encodeColorControlClusterReadColorPointGXAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointGX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0036);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0036);
     COMMAND_FOOTER();
 }
 
@@ -2004,12 +2451,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointGXAttribute(uint8_t s
                                                                        uint16_t colorPointGX)
 {
     COMMAND_HEADER("WriteColorControlColorPointGX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0036)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(colorPointGX));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0036);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(colorPointGX));
     COMMAND_FOOTER();
 }
 
@@ -2019,7 +2468,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointGXAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadColorPointGYAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointGY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0037);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0037);
     COMMAND_FOOTER();
 }
 
@@ -2027,12 +2480,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointGYAttribute(uint8_t s
                                                                        uint16_t colorPointGY)
 {
     COMMAND_HEADER("WriteColorControlColorPointGY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0037)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(colorPointGY));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0037);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(colorPointGY));
     COMMAND_FOOTER();
 }
 
@@ -2042,7 +2497,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointGYAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadColorPointGIntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointGIntensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0038);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0038);
     COMMAND_FOOTER();
 }
 
@@ -2050,12 +2509,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointGIntensityAttribute(u
                                                                                uint8_t colorPointGIntensity)
 {
     COMMAND_HEADER("WriteColorControlColorPointGIntensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0038)
-        .Put8(32)
-        .Put8(static_cast<uint8_t>(colorPointGIntensity));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0038);
+    Write8(p, 32);
+    Write8(p, static_cast<uint8_t>(colorPointGIntensity));
     COMMAND_FOOTER();
 }
 
@@ -2065,7 +2526,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointGIntensityAttribute(u
 PacketBufferHandle encodeColorControlClusterReadColorPointBXAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointBX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x003A);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x003A);
     COMMAND_FOOTER();
 }
 
@@ -2073,12 +2538,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointBXAttribute(uint8_t s
                                                                        uint16_t colorPointBX)
 {
     COMMAND_HEADER("WriteColorControlColorPointBX", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x003A)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(colorPointBX));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x003A);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(colorPointBX));
     COMMAND_FOOTER();
 }
 
@@ -2088,7 +2555,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointBXAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadColorPointBYAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointBY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x003B);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x003B);
     COMMAND_FOOTER();
 }
 
@@ -2096,12 +2567,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointBYAttribute(uint8_t s
                                                                        uint16_t colorPointBY)
 {
     COMMAND_HEADER("WriteColorControlColorPointBY", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x003B)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(colorPointBY));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x003B);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(colorPointBY));
     COMMAND_FOOTER();
 }
 
@@ -2111,7 +2584,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointBYAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadColorPointBIntensityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorPointBIntensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x003C);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x003C);
     COMMAND_FOOTER();
 }
 
@@ -2119,12 +2596,14 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointBIntensityAttribute(u
                                                                                uint8_t colorPointBIntensity)
 {
     COMMAND_HEADER("WriteColorControlColorPointBIntensity", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x003C)
-        .Put8(32)
-        .Put8(static_cast<uint8_t>(colorPointBIntensity));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x003C);
+    Write8(p, 32);
+    Write8(p, static_cast<uint8_t>(colorPointBIntensity));
     COMMAND_FOOTER();
 }
 
@@ -2134,7 +2613,11 @@ PacketBufferHandle encodeColorControlClusterWriteColorPointBIntensityAttribute(u
 PacketBufferHandle encodeColorControlClusterReadEnhancedCurrentHueAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlEnhancedCurrentHue", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x4000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x4000);
     COMMAND_FOOTER();
 }
 
@@ -2144,7 +2627,11 @@ PacketBufferHandle encodeColorControlClusterReadEnhancedCurrentHueAttribute(uint
 PacketBufferHandle encodeColorControlClusterReadEnhancedColorModeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlEnhancedColorMode", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x4001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x4001);
     COMMAND_FOOTER();
 }
 
@@ -2154,7 +2641,11 @@ PacketBufferHandle encodeColorControlClusterReadEnhancedColorModeAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadColorLoopActiveAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorLoopActive", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x4002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x4002);
     COMMAND_FOOTER();
 }
 
@@ -2164,7 +2655,11 @@ PacketBufferHandle encodeColorControlClusterReadColorLoopActiveAttribute(uint8_t
 PacketBufferHandle encodeColorControlClusterReadColorLoopDirectionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorLoopDirection", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x4003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x4003);
     COMMAND_FOOTER();
 }
 
@@ -2174,7 +2669,11 @@ PacketBufferHandle encodeColorControlClusterReadColorLoopDirectionAttribute(uint
 PacketBufferHandle encodeColorControlClusterReadColorLoopTimeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorLoopTime", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x4004);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x4004);
     COMMAND_FOOTER();
 }
 
@@ -2184,7 +2683,11 @@ PacketBufferHandle encodeColorControlClusterReadColorLoopTimeAttribute(uint8_t s
 PacketBufferHandle encodeColorControlClusterReadColorCapabilitiesAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorCapabilities", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x400A);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x400A);
     COMMAND_FOOTER();
 }
 
@@ -2194,7 +2697,11 @@ PacketBufferHandle encodeColorControlClusterReadColorCapabilitiesAttribute(uint8
 PacketBufferHandle encodeColorControlClusterReadColorTempPhysicalMinAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorTempPhysicalMin", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x400B);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x400B);
     COMMAND_FOOTER();
 }
 
@@ -2204,7 +2711,11 @@ PacketBufferHandle encodeColorControlClusterReadColorTempPhysicalMinAttribute(ui
 PacketBufferHandle encodeColorControlClusterReadColorTempPhysicalMaxAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlColorTempPhysicalMax", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x400C);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x400C);
     COMMAND_FOOTER();
 }
 
@@ -2215,7 +2726,11 @@ PacketBufferHandle encodeColorControlClusterReadCoupleColorTempToLevelMinMiredsA
                                                                                          EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlCoupleColorTempToLevelMinMireds", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x400D);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x400D);
     COMMAND_FOOTER();
 }
 
@@ -2226,7 +2741,11 @@ PacketBufferHandle encodeColorControlClusterReadStartUpColorTemperatureMiredsAtt
                                                                                        EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlStartUpColorTemperatureMireds", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x4010);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x4010);
     COMMAND_FOOTER();
 }
 
@@ -2235,12 +2754,14 @@ PacketBufferHandle encodeColorControlClusterWriteStartUpColorTemperatureMiredsAt
                                                                                         uint16_t startUpColorTemperatureMireds)
 {
     COMMAND_HEADER("WriteColorControlStartUpColorTemperatureMireds", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x4010)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(startUpColorTemperatureMireds));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x4010);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(startUpColorTemperatureMireds));
     COMMAND_FOOTER();
 }
 
@@ -2250,7 +2771,11 @@ PacketBufferHandle encodeColorControlClusterWriteStartUpColorTemperatureMiredsAt
 PacketBufferHandle encodeColorControlClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadColorControlClusterRevision", COLOR_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -2282,12 +2807,14 @@ PacketBufferHandle encodeContentLaunchClusterLaunchContentCommand(uint8_t seqNum
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_LAUNCH_CONTENT_COMMAND_ID)
-        .Put8(autoPlay)
-        .Put(static_cast<uint8_t>(dataStrLen))
-        .Put(data.data(), data.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + dataStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_LAUNCH_CONTENT_COMMAND_ID);
+    Write8(p, autoPlay);
+    Write8(p, static_cast<uint8_t>(dataStrLen));
+    WriteBytes(p, data.data(), dataStrLen);
     COMMAND_FOOTER();
 }
 
@@ -2312,20 +2839,27 @@ PacketBufferHandle encodeContentLaunchClusterLaunchURLCommand(uint8_t seqNum, En
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_LAUNCH_URL_COMMAND_ID)
-        .Put(static_cast<uint8_t>(contentURLStrLen))
-        .Put(contentURL.data(), contentURL.size())
-        .Put(static_cast<uint8_t>(displayStringStrLen))
-        .Put(displayString.data(), displayString.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + contentURLStrLen + displayStringStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_LAUNCH_URL_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(contentURLStrLen));
+    WriteBytes(p, contentURL.data(), contentURLStrLen);
+    Write8(p, static_cast<uint8_t>(displayStringStrLen));
+    WriteBytes(p, displayString.data(), displayStringStrLen);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeContentLaunchClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverContentLaunchAttributes", CONTENT_LAUNCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -2335,7 +2869,11 @@ PacketBufferHandle encodeContentLaunchClusterDiscoverAttributes(uint8_t seqNum,
 PacketBufferHandle encodeContentLaunchClusterReadAcceptsHeaderListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadContentLaunchAcceptsHeaderList", CONTENT_LAUNCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -2345,7 +2883,11 @@ PacketBufferHandle encodeContentLaunchClusterReadAcceptsHeaderListAttribute(uint
 PacketBufferHandle encodeContentLaunchClusterReadSupportedStreamingTypesAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadContentLaunchSupportedStreamingTypes", CONTENT_LAUNCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -2355,7 +2897,11 @@ PacketBufferHandle encodeContentLaunchClusterReadSupportedStreamingTypesAttribut
 PacketBufferHandle encodeContentLaunchClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadContentLaunchClusterRevision", CONTENT_LAUNCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -2375,7 +2921,12 @@ PacketBufferHandle encodeContentLaunchClusterReadClusterRevisionAttribute(uint8_
 PacketBufferHandle encodeDescriptorClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverDescriptorAttributes", DESCRIPTOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -2385,7 +2936,11 @@ PacketBufferHandle encodeDescriptorClusterDiscoverAttributes(uint8_t seqNum, End
 PacketBufferHandle encodeDescriptorClusterReadDeviceListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDescriptorDeviceList", DESCRIPTOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -2395,7 +2950,11 @@ PacketBufferHandle encodeDescriptorClusterReadDeviceListAttribute(uint8_t seqNum
 PacketBufferHandle encodeDescriptorClusterReadServerListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDescriptorServerList", DESCRIPTOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -2405,7 +2964,11 @@ PacketBufferHandle encodeDescriptorClusterReadServerListAttribute(uint8_t seqNum
 PacketBufferHandle encodeDescriptorClusterReadClientListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDescriptorClientList", DESCRIPTOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -2415,7 +2978,11 @@ PacketBufferHandle encodeDescriptorClusterReadClientListAttribute(uint8_t seqNum
 PacketBufferHandle encodeDescriptorClusterReadPartsListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDescriptorPartsList", DESCRIPTOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
@@ -2425,7 +2992,11 @@ PacketBufferHandle encodeDescriptorClusterReadPartsListAttribute(uint8_t seqNum,
 PacketBufferHandle encodeDescriptorClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDescriptorClusterRevision", DESCRIPTOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -2470,7 +3041,11 @@ PacketBufferHandle encodeDescriptorClusterReadClusterRevisionAttribute(uint8_t s
 PacketBufferHandle encodeDoorLockClusterClearAllPinsCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ClearAllPins", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_CLEAR_ALL_PINS_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_ALL_PINS_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -2480,7 +3055,11 @@ PacketBufferHandle encodeDoorLockClusterClearAllPinsCommand(uint8_t seqNum, Endp
 PacketBufferHandle encodeDoorLockClusterClearAllRfidsCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ClearAllRfids", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_CLEAR_ALL_RFIDS_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_ALL_RFIDS_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -2492,7 +3071,12 @@ PacketBufferHandle encodeDoorLockClusterClearHolidayScheduleCommand(uint8_t seqN
 {
     COMMAND_HEADER("ClearHolidaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_CLEAR_HOLIDAY_SCHEDULE_COMMAND_ID).Put8(scheduleId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_HOLIDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
     COMMAND_FOOTER();
 }
 
@@ -2503,7 +3087,12 @@ PacketBufferHandle encodeDoorLockClusterClearPinCommand(uint8_t seqNum, Endpoint
 {
     COMMAND_HEADER("ClearPin", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_CLEAR_PIN_COMMAND_ID).Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_PIN_COMMAND_ID);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2514,7 +3103,12 @@ PacketBufferHandle encodeDoorLockClusterClearRfidCommand(uint8_t seqNum, Endpoin
 {
     COMMAND_HEADER("ClearRfid", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_CLEAR_RFID_COMMAND_ID).Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_RFID_COMMAND_ID);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2526,11 +3120,13 @@ PacketBufferHandle encodeDoorLockClusterClearWeekdayScheduleCommand(uint8_t seqN
 {
     COMMAND_HEADER("ClearWeekdaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CLEAR_WEEKDAY_SCHEDULE_COMMAND_ID)
-        .Put8(scheduleId)
-        .Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_WEEKDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2542,11 +3138,13 @@ PacketBufferHandle encodeDoorLockClusterClearYeardayScheduleCommand(uint8_t seqN
 {
     COMMAND_HEADER("ClearYeardaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CLEAR_YEARDAY_SCHEDULE_COMMAND_ID)
-        .Put8(scheduleId)
-        .Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_YEARDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2558,7 +3156,12 @@ PacketBufferHandle encodeDoorLockClusterGetHolidayScheduleCommand(uint8_t seqNum
 {
     COMMAND_HEADER("GetHolidaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_GET_HOLIDAY_SCHEDULE_COMMAND_ID).Put8(scheduleId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_HOLIDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
     COMMAND_FOOTER();
 }
 
@@ -2569,7 +3172,12 @@ PacketBufferHandle encodeDoorLockClusterGetLogRecordCommand(uint8_t seqNum, Endp
 {
     COMMAND_HEADER("GetLogRecord", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_GET_LOG_RECORD_COMMAND_ID).Put16(logIndex);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_LOG_RECORD_COMMAND_ID);
+    Write16(p, logIndex);
     COMMAND_FOOTER();
 }
 
@@ -2580,7 +3188,12 @@ PacketBufferHandle encodeDoorLockClusterGetPinCommand(uint8_t seqNum, EndpointId
 {
     COMMAND_HEADER("GetPin", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_GET_PIN_COMMAND_ID).Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_PIN_COMMAND_ID);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2591,7 +3204,12 @@ PacketBufferHandle encodeDoorLockClusterGetRfidCommand(uint8_t seqNum, EndpointI
 {
     COMMAND_HEADER("GetRfid", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_GET_RFID_COMMAND_ID).Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_RFID_COMMAND_ID);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2602,7 +3220,12 @@ PacketBufferHandle encodeDoorLockClusterGetUserTypeCommand(uint8_t seqNum, Endpo
 {
     COMMAND_HEADER("GetUserType", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_GET_USER_TYPE_COMMAND_ID).Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_USER_TYPE_COMMAND_ID);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2614,11 +3237,13 @@ PacketBufferHandle encodeDoorLockClusterGetWeekdayScheduleCommand(uint8_t seqNum
 {
     COMMAND_HEADER("GetWeekdaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_GET_WEEKDAY_SCHEDULE_COMMAND_ID)
-        .Put8(scheduleId)
-        .Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_WEEKDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2630,11 +3255,13 @@ PacketBufferHandle encodeDoorLockClusterGetYeardayScheduleCommand(uint8_t seqNum
 {
     COMMAND_HEADER("GetYeardaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_GET_YEARDAY_SCHEDULE_COMMAND_ID)
-        .Put8(scheduleId)
-        .Put16(userId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_YEARDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
+    Write16(p, userId);
     COMMAND_FOOTER();
 }
 
@@ -2651,11 +3278,13 @@ PacketBufferHandle encodeDoorLockClusterLockDoorCommand(uint8_t seqNum, Endpoint
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_LOCK_DOOR_COMMAND_ID)
-        .Put(static_cast<uint8_t>(pinStrLen))
-        .Put(pin.data(), pin.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + pinStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_LOCK_DOOR_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(pinStrLen));
+    WriteBytes(p, pin.data(), pinStrLen);
     COMMAND_FOOTER();
 }
 
@@ -2668,13 +3297,15 @@ PacketBufferHandle encodeDoorLockClusterSetHolidayScheduleCommand(uint8_t seqNum
 {
     COMMAND_HEADER("SetHolidaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SET_HOLIDAY_SCHEDULE_COMMAND_ID)
-        .Put8(scheduleId)
-        .Put32(localStartTime)
-        .Put32(localEndTime)
-        .Put8(operatingModeDuringHoliday);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_HOLIDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
+    Write32(p, localStartTime);
+    Write32(p, localEndTime);
+    Write8(p, operatingModeDuringHoliday);
     COMMAND_FOOTER();
 }
 
@@ -2693,14 +3324,16 @@ PacketBufferHandle encodeDoorLockClusterSetPinCommand(uint8_t seqNum, EndpointId
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SET_PIN_COMMAND_ID)
-        .Put16(userId)
-        .Put8(userStatus)
-        .Put8(userType)
-        .Put(static_cast<uint8_t>(pinStrLen))
-        .Put(pin.data(), pin.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + pinStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_PIN_COMMAND_ID);
+    Write16(p, userId);
+    Write8(p, userStatus);
+    Write8(p, userType);
+    Write8(p, static_cast<uint8_t>(pinStrLen));
+    WriteBytes(p, pin.data(), pinStrLen);
     COMMAND_FOOTER();
 }
 
@@ -2719,14 +3352,16 @@ PacketBufferHandle encodeDoorLockClusterSetRfidCommand(uint8_t seqNum, EndpointI
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SET_RFID_COMMAND_ID)
-        .Put16(userId)
-        .Put8(userStatus)
-        .Put8(userType)
-        .Put(static_cast<uint8_t>(idStrLen))
-        .Put(id.data(), id.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + idStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_RFID_COMMAND_ID);
+    Write16(p, userId);
+    Write8(p, userStatus);
+    Write8(p, userType);
+    Write8(p, static_cast<uint8_t>(idStrLen));
+    WriteBytes(p, id.data(), idStrLen);
     COMMAND_FOOTER();
 }
 
@@ -2738,7 +3373,13 @@ PacketBufferHandle encodeDoorLockClusterSetUserTypeCommand(uint8_t seqNum, Endpo
 {
     COMMAND_HEADER("SetUserType", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SET_USER_TYPE_COMMAND_ID).Put16(userId).Put8(userType);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_USER_TYPE_COMMAND_ID);
+    Write16(p, userId);
+    Write8(p, userType);
     COMMAND_FOOTER();
 }
 
@@ -2752,16 +3393,19 @@ PacketBufferHandle encodeDoorLockClusterSetWeekdayScheduleCommand(uint8_t seqNum
 {
     COMMAND_HEADER("SetWeekdaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SET_WEEKDAY_SCHEDULE_COMMAND_ID)
-        .Put8(scheduleId)
-        .Put16(userId)
-        .Put8(daysMask)
-        .Put8(startHour)
-        .Put8(startMinute)
-        .Put8(endHour)
-        .Put8(endMinute);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t) +
+        sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_WEEKDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
+    Write16(p, userId);
+    Write8(p, daysMask);
+    Write8(p, startHour);
+    Write8(p, startMinute);
+    Write8(p, endHour);
+    Write8(p, endMinute);
     COMMAND_FOOTER();
 }
 
@@ -2774,13 +3418,15 @@ PacketBufferHandle encodeDoorLockClusterSetYeardayScheduleCommand(uint8_t seqNum
 {
     COMMAND_HEADER("SetYeardaySchedule", DOOR_LOCK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SET_YEARDAY_SCHEDULE_COMMAND_ID)
-        .Put8(scheduleId)
-        .Put16(userId)
-        .Put32(localStartTime)
-        .Put32(localEndTime);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint32_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_YEARDAY_SCHEDULE_COMMAND_ID);
+    Write8(p, scheduleId);
+    Write16(p, userId);
+    Write32(p, localStartTime);
+    Write32(p, localEndTime);
     COMMAND_FOOTER();
 }
 
@@ -2797,11 +3443,13 @@ PacketBufferHandle encodeDoorLockClusterUnlockDoorCommand(uint8_t seqNum, Endpoi
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_UNLOCK_DOOR_COMMAND_ID)
-        .Put(static_cast<uint8_t>(pinStrLen))
-        .Put(pin.data(), pin.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + pinStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_UNLOCK_DOOR_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(pinStrLen));
+    WriteBytes(p, pin.data(), pinStrLen);
     COMMAND_FOOTER();
 }
 
@@ -2820,19 +3468,26 @@ PacketBufferHandle encodeDoorLockClusterUnlockWithTimeoutCommand(uint8_t seqNum,
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_UNLOCK_WITH_TIMEOUT_COMMAND_ID)
-        .Put16(timeoutInSeconds)
-        .Put(static_cast<uint8_t>(pinStrLen))
-        .Put(pin.data(), pin.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + pinStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_UNLOCK_WITH_TIMEOUT_COMMAND_ID);
+    Write16(p, timeoutInSeconds);
+    Write8(p, static_cast<uint8_t>(pinStrLen));
+    WriteBytes(p, pin.data(), pinStrLen);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeDoorLockClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverDoorLockAttributes", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -2842,7 +3497,11 @@ PacketBufferHandle encodeDoorLockClusterDiscoverAttributes(uint8_t seqNum, Endpo
 PacketBufferHandle encodeDoorLockClusterReadLockStateAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDoorLockLockState", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -2850,14 +3509,16 @@ PacketBufferHandle encodeDoorLockClusterConfigureLockStateAttribute(uint8_t seqN
                                                                     uint16_t minInterval, uint16_t maxInterval)
 {
     COMMAND_HEADER("ReportDoorLockLockState", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0000)
-        .Put8(48)
-        .Put16(minInterval)
-        .Put16(maxInterval);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0000);
+    Write8(p, 48);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
     COMMAND_FOOTER();
 }
 
@@ -2867,7 +3528,11 @@ PacketBufferHandle encodeDoorLockClusterConfigureLockStateAttribute(uint8_t seqN
 PacketBufferHandle encodeDoorLockClusterReadLockTypeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDoorLockLockType", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -2877,7 +3542,11 @@ PacketBufferHandle encodeDoorLockClusterReadLockTypeAttribute(uint8_t seqNum, En
 PacketBufferHandle encodeDoorLockClusterReadActuatorEnabledAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDoorLockActuatorEnabled", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -2887,7 +3556,11 @@ PacketBufferHandle encodeDoorLockClusterReadActuatorEnabledAttribute(uint8_t seq
 PacketBufferHandle encodeDoorLockClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadDoorLockClusterRevision", DOOR_LOCK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -2914,12 +3587,14 @@ PacketBufferHandle encodeGeneralCommissioningClusterArmFailSafeCommand(uint8_t s
 {
     COMMAND_HEADER("ArmFailSafe", GENERAL_COMMISSIONING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_ARM_FAIL_SAFE_COMMAND_ID)
-        .Put16(expiryLengthSeconds)
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ARM_FAIL_SAFE_COMMAND_ID);
+    Write16(p, expiryLengthSeconds);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -2929,7 +3604,11 @@ PacketBufferHandle encodeGeneralCommissioningClusterArmFailSafeCommand(uint8_t s
 PacketBufferHandle encodeGeneralCommissioningClusterCommissioningCompleteCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("CommissioningComplete", GENERAL_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_COMMISSIONING_COMPLETE_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_COMMISSIONING_COMPLETE_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -2949,21 +3628,28 @@ PacketBufferHandle encodeGeneralCommissioningClusterSetRegulatoryConfigCommand(u
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SET_REGULATORY_CONFIG_COMMAND_ID)
-        .Put8(location)
-        .Put(static_cast<uint8_t>(countryCodeStrLen))
-        .Put(countryCode.data(), countryCode.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + countryCodeStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_REGULATORY_CONFIG_COMMAND_ID);
+    Write8(p, location);
+    Write8(p, static_cast<uint8_t>(countryCodeStrLen));
+    WriteBytes(p, countryCode.data(), countryCodeStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeGeneralCommissioningClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverGeneralCommissioningAttributes", GENERAL_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -2973,7 +3659,11 @@ PacketBufferHandle encodeGeneralCommissioningClusterDiscoverAttributes(uint8_t s
 PacketBufferHandle encodeGeneralCommissioningClusterReadFabricIdAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGeneralCommissioningFabricId", GENERAL_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -2983,7 +3673,11 @@ PacketBufferHandle encodeGeneralCommissioningClusterReadFabricIdAttribute(uint8_
 PacketBufferHandle encodeGeneralCommissioningClusterReadBreadcrumbAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGeneralCommissioningBreadcrumb", GENERAL_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -2991,12 +3685,14 @@ PacketBufferHandle encodeGeneralCommissioningClusterWriteBreadcrumbAttribute(uin
                                                                              uint64_t breadcrumb)
 {
     COMMAND_HEADER("WriteGeneralCommissioningBreadcrumb", GENERAL_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0001)
-        .Put8(39)
-        .Put64(static_cast<uint64_t>(breadcrumb));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint64_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
+    Write8(p, 39);
+    Write64(p, static_cast<uint64_t>(breadcrumb));
     COMMAND_FOOTER();
 }
 
@@ -3006,7 +3702,11 @@ PacketBufferHandle encodeGeneralCommissioningClusterWriteBreadcrumbAttribute(uin
 PacketBufferHandle encodeGeneralCommissioningClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGeneralCommissioningClusterRevision", GENERAL_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3024,7 +3724,12 @@ PacketBufferHandle encodeGeneralCommissioningClusterReadClusterRevisionAttribute
 PacketBufferHandle encodeGroupKeyManagementClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverGroupKeyManagementAttributes", GROUP_KEY_MANAGEMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3034,7 +3739,11 @@ PacketBufferHandle encodeGroupKeyManagementClusterDiscoverAttributes(uint8_t seq
 PacketBufferHandle encodeGroupKeyManagementClusterReadGroupsAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGroupKeyManagementGroups", GROUP_KEY_MANAGEMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -3044,7 +3753,11 @@ PacketBufferHandle encodeGroupKeyManagementClusterReadGroupsAttribute(uint8_t se
 PacketBufferHandle encodeGroupKeyManagementClusterReadGroupKeysAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGroupKeyManagementGroupKeys", GROUP_KEY_MANAGEMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -3054,7 +3767,11 @@ PacketBufferHandle encodeGroupKeyManagementClusterReadGroupKeysAttribute(uint8_t
 PacketBufferHandle encodeGroupKeyManagementClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGroupKeyManagementClusterRevision", GROUP_KEY_MANAGEMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3089,12 +3806,14 @@ PacketBufferHandle encodeGroupsClusterAddGroupCommand(uint8_t seqNum, EndpointId
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_ADD_GROUP_COMMAND_ID)
-        .Put16(groupId)
-        .Put(static_cast<uint8_t>(groupNameStrLen))
-        .Put(groupName.data(), groupName.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + groupNameStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ADD_GROUP_COMMAND_ID);
+    Write16(p, groupId);
+    Write8(p, static_cast<uint8_t>(groupNameStrLen));
+    WriteBytes(p, groupName.data(), groupNameStrLen);
     COMMAND_FOOTER();
 }
 
@@ -3113,12 +3832,14 @@ PacketBufferHandle encodeGroupsClusterAddGroupIfIdentifyingCommand(uint8_t seqNu
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_ADD_GROUP_IF_IDENTIFYING_COMMAND_ID)
-        .Put16(groupId)
-        .Put(static_cast<uint8_t>(groupNameStrLen))
-        .Put(groupName.data(), groupName.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + groupNameStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ADD_GROUP_IF_IDENTIFYING_COMMAND_ID);
+    Write16(p, groupId);
+    Write8(p, static_cast<uint8_t>(groupNameStrLen));
+    WriteBytes(p, groupName.data(), groupNameStrLen);
     COMMAND_FOOTER();
 }
 
@@ -3130,11 +3851,13 @@ PacketBufferHandle encodeGroupsClusterGetGroupMembershipCommand(uint8_t seqNum,
 {
     COMMAND_HEADER("GetGroupMembership", GROUPS_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_GET_GROUP_MEMBERSHIP_COMMAND_ID)
-        .Put8(groupCount)
-        .Put16(groupList);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_GROUP_MEMBERSHIP_COMMAND_ID);
+    Write8(p, groupCount);
+    Write16(p, groupList);
     COMMAND_FOOTER();
 }
 
@@ -3144,7 +3867,11 @@ PacketBufferHandle encodeGroupsClusterGetGroupMembershipCommand(uint8_t seqNum,
 PacketBufferHandle encodeGroupsClusterRemoveAllGroupsCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("RemoveAllGroups", GROUPS_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_REMOVE_ALL_GROUPS_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_REMOVE_ALL_GROUPS_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3155,7 +3882,12 @@ PacketBufferHandle encodeGroupsClusterRemoveGroupCommand(uint8_t seqNum, Endpoin
 {
     COMMAND_HEADER("RemoveGroup", GROUPS_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_REMOVE_GROUP_COMMAND_ID).Put16(groupId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_REMOVE_GROUP_COMMAND_ID);
+    Write16(p, groupId);
     COMMAND_FOOTER();
 }
 
@@ -3166,14 +3898,24 @@ PacketBufferHandle encodeGroupsClusterViewGroupCommand(uint8_t seqNum, EndpointI
 {
     COMMAND_HEADER("ViewGroup", GROUPS_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_VIEW_GROUP_COMMAND_ID).Put16(groupId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_VIEW_GROUP_COMMAND_ID);
+    Write16(p, groupId);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeGroupsClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverGroupsAttributes", GROUPS_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3183,7 +3925,11 @@ PacketBufferHandle encodeGroupsClusterDiscoverAttributes(uint8_t seqNum, Endpoin
 PacketBufferHandle encodeGroupsClusterReadNameSupportAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGroupsNameSupport", GROUPS_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -3193,7 +3939,11 @@ PacketBufferHandle encodeGroupsClusterReadNameSupportAttribute(uint8_t seqNum, E
 PacketBufferHandle encodeGroupsClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadGroupsClusterRevision", GROUPS_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3216,7 +3966,12 @@ PacketBufferHandle encodeIdentifyClusterIdentifyCommand(uint8_t seqNum, Endpoint
 {
     COMMAND_HEADER("Identify", IDENTIFY_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_IDENTIFY_COMMAND_ID).Put16(identifyTime);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_IDENTIFY_COMMAND_ID);
+    Write16(p, identifyTime);
     COMMAND_FOOTER();
 }
 
@@ -3226,14 +3981,23 @@ PacketBufferHandle encodeIdentifyClusterIdentifyCommand(uint8_t seqNum, Endpoint
 PacketBufferHandle encodeIdentifyClusterIdentifyQueryCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("IdentifyQuery", IDENTIFY_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_IDENTIFY_QUERY_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_IDENTIFY_QUERY_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeIdentifyClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverIdentifyAttributes", IDENTIFY_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3243,7 +4007,11 @@ PacketBufferHandle encodeIdentifyClusterDiscoverAttributes(uint8_t seqNum, Endpo
 PacketBufferHandle encodeIdentifyClusterReadIdentifyTimeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadIdentifyIdentifyTime", IDENTIFY_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -3251,12 +4019,14 @@ PacketBufferHandle encodeIdentifyClusterWriteIdentifyTimeAttribute(uint8_t seqNu
                                                                    uint16_t identifyTime)
 {
     COMMAND_HEADER("WriteIdentifyIdentifyTime", IDENTIFY_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0000)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(identifyTime));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(identifyTime));
     COMMAND_FOOTER();
 }
 
@@ -3266,7 +4036,11 @@ PacketBufferHandle encodeIdentifyClusterWriteIdentifyTimeAttribute(uint8_t seqNu
 PacketBufferHandle encodeIdentifyClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadIdentifyClusterRevision", IDENTIFY_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3287,14 +4061,24 @@ PacketBufferHandle encodeKeypadInputClusterSendKeyCommand(uint8_t seqNum, Endpoi
 {
     COMMAND_HEADER("SendKey", KEYPAD_INPUT_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SEND_KEY_COMMAND_ID).Put8(keyCode);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SEND_KEY_COMMAND_ID);
+    Write8(p, keyCode);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeKeypadInputClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverKeypadInputAttributes", KEYPAD_INPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3304,7 +4088,11 @@ PacketBufferHandle encodeKeypadInputClusterDiscoverAttributes(uint8_t seqNum, En
 PacketBufferHandle encodeKeypadInputClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadKeypadInputClusterRevision", KEYPAD_INPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3334,13 +4122,15 @@ PacketBufferHandle encodeLevelControlClusterMoveCommand(uint8_t seqNum, Endpoint
 {
     COMMAND_HEADER("Move", LEVEL_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_COMMAND_ID)
-        .Put8(moveMode)
-        .Put8(rate)
-        .Put8(optionMask)
-        .Put8(optionOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_COMMAND_ID);
+    Write8(p, moveMode);
+    Write8(p, rate);
+    Write8(p, optionMask);
+    Write8(p, optionOverride);
     COMMAND_FOOTER();
 }
 
@@ -3352,13 +4142,15 @@ PacketBufferHandle encodeLevelControlClusterMoveToLevelCommand(uint8_t seqNum, E
 {
     COMMAND_HEADER("MoveToLevel", LEVEL_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_TO_LEVEL_COMMAND_ID)
-        .Put8(level)
-        .Put16(transitionTime)
-        .Put8(optionMask)
-        .Put8(optionOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_TO_LEVEL_COMMAND_ID);
+    Write8(p, level);
+    Write16(p, transitionTime);
+    Write8(p, optionMask);
+    Write8(p, optionOverride);
     COMMAND_FOOTER();
 }
 
@@ -3370,11 +4162,13 @@ PacketBufferHandle encodeLevelControlClusterMoveToLevelWithOnOffCommand(uint8_t
 {
     COMMAND_HEADER("MoveToLevelWithOnOff", LEVEL_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MOVE_TO_LEVEL_WITH_ON_OFF_COMMAND_ID)
-        .Put8(level)
-        .Put16(transitionTime);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_TO_LEVEL_WITH_ON_OFF_COMMAND_ID);
+    Write8(p, level);
+    Write16(p, transitionTime);
     COMMAND_FOOTER();
 }
 
@@ -3386,7 +4180,13 @@ PacketBufferHandle encodeLevelControlClusterMoveWithOnOffCommand(uint8_t seqNum,
 {
     COMMAND_HEADER("MoveWithOnOff", LEVEL_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MOVE_WITH_ON_OFF_COMMAND_ID).Put8(moveMode).Put8(rate);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MOVE_WITH_ON_OFF_COMMAND_ID);
+    Write8(p, moveMode);
+    Write8(p, rate);
     COMMAND_FOOTER();
 }
 
@@ -3399,14 +4199,17 @@ PacketBufferHandle encodeLevelControlClusterStepCommand(uint8_t seqNum, Endpoint
 {
     COMMAND_HEADER("Step", LEVEL_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_STEP_COMMAND_ID)
-        .Put8(stepMode)
-        .Put8(stepSize)
-        .Put16(transitionTime)
-        .Put8(optionMask)
-        .Put8(optionOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STEP_COMMAND_ID);
+    Write8(p, stepMode);
+    Write8(p, stepSize);
+    Write16(p, transitionTime);
+    Write8(p, optionMask);
+    Write8(p, optionOverride);
     COMMAND_FOOTER();
 }
 
@@ -3418,12 +4221,14 @@ PacketBufferHandle encodeLevelControlClusterStepWithOnOffCommand(uint8_t seqNum,
 {
     COMMAND_HEADER("StepWithOnOff", LEVEL_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_STEP_WITH_ON_OFF_COMMAND_ID)
-        .Put8(stepMode)
-        .Put8(stepSize)
-        .Put16(transitionTime);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STEP_WITH_ON_OFF_COMMAND_ID);
+    Write8(p, stepMode);
+    Write8(p, stepSize);
+    Write16(p, transitionTime);
     COMMAND_FOOTER();
 }
 
@@ -3435,7 +4240,13 @@ PacketBufferHandle encodeLevelControlClusterStopCommand(uint8_t seqNum, Endpoint
 {
     COMMAND_HEADER("Stop", LEVEL_CONTROL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_STOP_COMMAND_ID).Put8(optionMask).Put8(optionOverride);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STOP_COMMAND_ID);
+    Write8(p, optionMask);
+    Write8(p, optionOverride);
     COMMAND_FOOTER();
 }
 
@@ -3445,14 +4256,23 @@ PacketBufferHandle encodeLevelControlClusterStopCommand(uint8_t seqNum, Endpoint
 PacketBufferHandle encodeLevelControlClusterStopWithOnOffCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("StopWithOnOff", LEVEL_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_STOP_WITH_ON_OFF_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STOP_WITH_ON_OFF_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeLevelControlClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverLevelControlAttributes", LEVEL_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3462,7 +4282,11 @@ PacketBufferHandle encodeLevelControlClusterDiscoverAttributes(uint8_t seqNum, E
 PacketBufferHandle encodeLevelControlClusterReadCurrentLevelAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadLevelControlCurrentLevel", LEVEL_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -3471,15 +4295,18 @@ PacketBufferHandle encodeLevelControlClusterConfigureCurrentLevelAttribute(uint8
                                                                            uint8_t change)
 {
     COMMAND_HEADER("ReportLevelControlCurrentLevel", LEVEL_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0000)
-        .Put8(32)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put8(static_cast<uint8_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0000);
+    Write8(p, 32);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write8(p, static_cast<uint8_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -3489,7 +4316,11 @@ PacketBufferHandle encodeLevelControlClusterConfigureCurrentLevelAttribute(uint8
 PacketBufferHandle encodeLevelControlClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadLevelControlClusterRevision", LEVEL_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3509,14 +4340,23 @@ PacketBufferHandle encodeLevelControlClusterReadClusterRevisionAttribute(uint8_t
 PacketBufferHandle encodeLowPowerClusterSleepCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("Sleep", LOW_POWER_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SLEEP_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SLEEP_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeLowPowerClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverLowPowerAttributes", LOW_POWER_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3526,7 +4366,11 @@ PacketBufferHandle encodeLowPowerClusterDiscoverAttributes(uint8_t seqNum, Endpo
 PacketBufferHandle encodeLowPowerClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadLowPowerClusterRevision", LOW_POWER_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3550,7 +4394,11 @@ PacketBufferHandle encodeLowPowerClusterReadClusterRevisionAttribute(uint8_t seq
 PacketBufferHandle encodeMediaInputClusterHideInputStatusCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("HideInputStatus", MEDIA_INPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_HIDE_INPUT_STATUS_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_HIDE_INPUT_STATUS_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3569,12 +4417,14 @@ PacketBufferHandle encodeMediaInputClusterRenameInputCommand(uint8_t seqNum, End
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_RENAME_INPUT_COMMAND_ID)
-        .Put8(index)
-        .Put(static_cast<uint8_t>(nameStrLen))
-        .Put(name.data(), name.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + nameStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_RENAME_INPUT_COMMAND_ID);
+    Write8(p, index);
+    Write8(p, static_cast<uint8_t>(nameStrLen));
+    WriteBytes(p, name.data(), nameStrLen);
     COMMAND_FOOTER();
 }
 
@@ -3585,7 +4435,12 @@ PacketBufferHandle encodeMediaInputClusterSelectInputCommand(uint8_t seqNum, End
 {
     COMMAND_HEADER("SelectInput", MEDIA_INPUT_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SELECT_INPUT_COMMAND_ID).Put8(index);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SELECT_INPUT_COMMAND_ID);
+    Write8(p, index);
     COMMAND_FOOTER();
 }
 
@@ -3595,14 +4450,23 @@ PacketBufferHandle encodeMediaInputClusterSelectInputCommand(uint8_t seqNum, End
 PacketBufferHandle encodeMediaInputClusterShowInputStatusCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ShowInputStatus", MEDIA_INPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SHOW_INPUT_STATUS_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SHOW_INPUT_STATUS_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeMediaInputClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverMediaInputAttributes", MEDIA_INPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3612,7 +4476,11 @@ PacketBufferHandle encodeMediaInputClusterDiscoverAttributes(uint8_t seqNum, End
 PacketBufferHandle encodeMediaInputClusterReadMediaInputListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadMediaInputMediaInputList", MEDIA_INPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -3622,7 +4490,11 @@ PacketBufferHandle encodeMediaInputClusterReadMediaInputListAttribute(uint8_t se
 PacketBufferHandle encodeMediaInputClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadMediaInputClusterRevision", MEDIA_INPUT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3652,7 +4524,11 @@ PacketBufferHandle encodeMediaInputClusterReadClusterRevisionAttribute(uint8_t s
 PacketBufferHandle encodeMediaPlaybackClusterMediaFastForwardCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaFastForward", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_FAST_FORWARD_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_FAST_FORWARD_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3662,7 +4538,11 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaFastForwardCommand(uint8_t seq
 PacketBufferHandle encodeMediaPlaybackClusterMediaNextCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaNext", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_NEXT_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_NEXT_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3672,7 +4552,11 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaNextCommand(uint8_t seqNum, En
 PacketBufferHandle encodeMediaPlaybackClusterMediaPauseCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaPause", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_PAUSE_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_PAUSE_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3682,7 +4566,11 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaPauseCommand(uint8_t seqNum, E
 PacketBufferHandle encodeMediaPlaybackClusterMediaPlayCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaPlay", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_PLAY_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_PLAY_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3692,7 +4580,11 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaPlayCommand(uint8_t seqNum, En
 PacketBufferHandle encodeMediaPlaybackClusterMediaPreviousCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaPrevious", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_PREVIOUS_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_PREVIOUS_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3702,7 +4594,11 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaPreviousCommand(uint8_t seqNum
 PacketBufferHandle encodeMediaPlaybackClusterMediaRewindCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaRewind", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_REWIND_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_REWIND_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3714,10 +4610,12 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaSkipBackwardCommand(uint8_t se
 {
     COMMAND_HEADER("MediaSkipBackward", MEDIA_PLAYBACK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MEDIA_SKIP_BACKWARD_COMMAND_ID)
-        .Put64(deltaPositionMilliseconds);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint64_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_SKIP_BACKWARD_COMMAND_ID);
+    Write64(p, deltaPositionMilliseconds);
     COMMAND_FOOTER();
 }
 
@@ -3729,10 +4627,12 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaSkipForwardCommand(uint8_t seq
 {
     COMMAND_HEADER("MediaSkipForward", MEDIA_PLAYBACK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_MEDIA_SKIP_FORWARD_COMMAND_ID)
-        .Put64(deltaPositionMilliseconds);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint64_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_SKIP_FORWARD_COMMAND_ID);
+    Write64(p, deltaPositionMilliseconds);
     COMMAND_FOOTER();
 }
 
@@ -3743,7 +4643,12 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaSkipSeekCommand(uint8_t seqNum
 {
     COMMAND_HEADER("MediaSkipSeek", MEDIA_PLAYBACK_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_SKIP_SEEK_COMMAND_ID).Put64(position);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint64_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_SKIP_SEEK_COMMAND_ID);
+    Write64(p, position);
     COMMAND_FOOTER();
 }
 
@@ -3753,7 +4658,11 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaSkipSeekCommand(uint8_t seqNum
 PacketBufferHandle encodeMediaPlaybackClusterMediaStartOverCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaStartOver", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_START_OVER_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_START_OVER_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -3763,14 +4672,23 @@ PacketBufferHandle encodeMediaPlaybackClusterMediaStartOverCommand(uint8_t seqNu
 PacketBufferHandle encodeMediaPlaybackClusterMediaStopCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("MediaStop", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_MEDIA_STOP_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_MEDIA_STOP_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeMediaPlaybackClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverMediaPlaybackAttributes", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -3780,7 +4698,11 @@ PacketBufferHandle encodeMediaPlaybackClusterDiscoverAttributes(uint8_t seqNum,
 PacketBufferHandle encodeMediaPlaybackClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadMediaPlaybackClusterRevision", MEDIA_PLAYBACK_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -3817,13 +4739,15 @@ PacketBufferHandle encodeNetworkCommissioningClusterAddThreadNetworkCommand(uint
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_ADD_THREAD_NETWORK_COMMAND_ID)
-        .Put(static_cast<uint8_t>(operationalDatasetStrLen))
-        .Put(operationalDataset.data(), operationalDataset.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + operationalDatasetStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ADD_THREAD_NETWORK_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(operationalDatasetStrLen));
+    WriteBytes(p, operationalDataset.data(), operationalDatasetStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -3849,15 +4773,17 @@ PacketBufferHandle encodeNetworkCommissioningClusterAddWiFiNetworkCommand(uint8_
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_ADD_WI_FI_NETWORK_COMMAND_ID)
-        .Put(static_cast<uint8_t>(ssidStrLen))
-        .Put(ssid.data(), ssid.size())
-        .Put(static_cast<uint8_t>(credentialsStrLen))
-        .Put(credentials.data(), credentials.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + ssidStrLen + credentialsStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ADD_WI_FI_NETWORK_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(ssidStrLen));
+    WriteBytes(p, ssid.data(), ssidStrLen);
+    Write8(p, static_cast<uint8_t>(credentialsStrLen));
+    WriteBytes(p, credentials.data(), credentialsStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -3876,13 +4802,15 @@ PacketBufferHandle encodeNetworkCommissioningClusterDisableNetworkCommand(uint8_
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_DISABLE_NETWORK_COMMAND_ID)
-        .Put(static_cast<uint8_t>(networkIDStrLen))
-        .Put(networkID.data(), networkID.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + networkIDStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISABLE_NETWORK_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(networkIDStrLen));
+    WriteBytes(p, networkID.data(), networkIDStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -3901,13 +4829,15 @@ PacketBufferHandle encodeNetworkCommissioningClusterEnableNetworkCommand(uint8_t
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_ENABLE_NETWORK_COMMAND_ID)
-        .Put(static_cast<uint8_t>(networkIDStrLen))
-        .Put(networkID.data(), networkID.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + networkIDStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ENABLE_NETWORK_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(networkIDStrLen));
+    WriteBytes(p, networkID.data(), networkIDStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -3920,10 +4850,12 @@ PacketBufferHandle encodeNetworkCommissioningClusterGetLastNetworkCommissioningR
 {
     COMMAND_HEADER("GetLastNetworkCommissioningResult", NETWORK_COMMISSIONING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_GET_LAST_NETWORK_COMMISSIONING_RESULT_COMMAND_ID)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_LAST_NETWORK_COMMISSIONING_RESULT_COMMAND_ID);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -3942,13 +4874,15 @@ PacketBufferHandle encodeNetworkCommissioningClusterRemoveNetworkCommand(uint8_t
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_REMOVE_NETWORK_COMMAND_ID)
-        .Put(static_cast<uint8_t>(networkIDStrLen))
-        .Put(networkID.data(), networkID.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + networkIDStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_REMOVE_NETWORK_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(networkIDStrLen));
+    WriteBytes(p, networkID.data(), networkIDStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -3967,13 +4901,15 @@ PacketBufferHandle encodeNetworkCommissioningClusterScanNetworksCommand(uint8_t
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SCAN_NETWORKS_COMMAND_ID)
-        .Put(static_cast<uint8_t>(ssidStrLen))
-        .Put(ssid.data(), ssid.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + ssidStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SCAN_NETWORKS_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(ssidStrLen));
+    WriteBytes(p, ssid.data(), ssidStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -3992,13 +4928,15 @@ PacketBufferHandle encodeNetworkCommissioningClusterUpdateThreadNetworkCommand(u
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_UPDATE_THREAD_NETWORK_COMMAND_ID)
-        .Put(static_cast<uint8_t>(operationalDatasetStrLen))
-        .Put(operationalDataset.data(), operationalDataset.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + operationalDatasetStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_UPDATE_THREAD_NETWORK_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(operationalDatasetStrLen));
+    WriteBytes(p, operationalDataset.data(), operationalDatasetStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
@@ -4024,22 +4962,29 @@ PacketBufferHandle encodeNetworkCommissioningClusterUpdateWiFiNetworkCommand(uin
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_UPDATE_WI_FI_NETWORK_COMMAND_ID)
-        .Put(static_cast<uint8_t>(ssidStrLen))
-        .Put(ssid.data(), ssid.size())
-        .Put(static_cast<uint8_t>(credentialsStrLen))
-        .Put(credentials.data(), credentials.size())
-        .Put64(breadcrumb)
-        .Put32(timeoutMs);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize + ssidStrLen + credentialsStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_UPDATE_WI_FI_NETWORK_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(ssidStrLen));
+    WriteBytes(p, ssid.data(), ssidStrLen);
+    Write8(p, static_cast<uint8_t>(credentialsStrLen));
+    WriteBytes(p, credentials.data(), credentialsStrLen);
+    Write64(p, breadcrumb);
+    Write32(p, timeoutMs);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeNetworkCommissioningClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverNetworkCommissioningAttributes", NETWORK_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4049,7 +4994,11 @@ PacketBufferHandle encodeNetworkCommissioningClusterDiscoverAttributes(uint8_t s
 PacketBufferHandle encodeNetworkCommissioningClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadNetworkCommissioningClusterRevision", NETWORK_COMMISSIONING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4072,7 +5021,11 @@ PacketBufferHandle encodeNetworkCommissioningClusterReadClusterRevisionAttribute
 PacketBufferHandle encodeOnOffClusterOffCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("Off", ON_OFF_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_OFF_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_OFF_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -4082,7 +5035,11 @@ PacketBufferHandle encodeOnOffClusterOffCommand(uint8_t seqNum, EndpointId desti
 PacketBufferHandle encodeOnOffClusterOnCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("On", ON_OFF_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_ON_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ON_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -4092,14 +5049,23 @@ PacketBufferHandle encodeOnOffClusterOnCommand(uint8_t seqNum, EndpointId destin
 PacketBufferHandle encodeOnOffClusterToggleCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("Toggle", ON_OFF_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_TOGGLE_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_TOGGLE_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeOnOffClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverOnOffAttributes", ON_OFF_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4109,7 +5075,11 @@ PacketBufferHandle encodeOnOffClusterDiscoverAttributes(uint8_t seqNum, Endpoint
 PacketBufferHandle encodeOnOffClusterReadOnOffAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadOnOffOnOff", ON_OFF_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -4117,14 +5087,16 @@ PacketBufferHandle encodeOnOffClusterConfigureOnOffAttribute(uint8_t seqNum, End
                                                              uint16_t maxInterval)
 {
     COMMAND_HEADER("ReportOnOffOnOff", ON_OFF_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0000)
-        .Put8(16)
-        .Put16(minInterval)
-        .Put16(maxInterval);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0000);
+    Write8(p, 16);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
     COMMAND_FOOTER();
 }
 
@@ -4134,7 +5106,11 @@ PacketBufferHandle encodeOnOffClusterConfigureOnOffAttribute(uint8_t seqNum, End
 PacketBufferHandle encodeOnOffClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadOnOffClusterRevision", ON_OFF_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4160,12 +5136,14 @@ PacketBufferHandle encodeOperationalCredentialsClusterRemoveFabricCommand(uint8_
 {
     COMMAND_HEADER("RemoveFabric", OPERATIONAL_CREDENTIALS_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_REMOVE_FABRIC_COMMAND_ID)
-        .Put64(fabricId)
-        .Put64(nodeId)
-        .Put16(vendorId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_REMOVE_FABRIC_COMMAND_ID);
+    Write64(p, fabricId);
+    Write64(p, nodeId);
+    Write16(p, vendorId);
     COMMAND_FOOTER();
 }
 
@@ -4177,7 +5155,12 @@ PacketBufferHandle encodeOperationalCredentialsClusterSetFabricCommand(uint8_t s
 {
     COMMAND_HEADER("SetFabric", OPERATIONAL_CREDENTIALS_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SET_FABRIC_COMMAND_ID).Put16(vendorId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_FABRIC_COMMAND_ID);
+    Write16(p, vendorId);
     COMMAND_FOOTER();
 }
 
@@ -4195,18 +5178,25 @@ PacketBufferHandle encodeOperationalCredentialsClusterUpdateFabricLabelCommand(u
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_UPDATE_FABRIC_LABEL_COMMAND_ID)
-        .Put(static_cast<uint8_t>(labelStrLen))
-        .Put(label.data(), label.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + labelStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_UPDATE_FABRIC_LABEL_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(labelStrLen));
+    WriteBytes(p, label.data(), labelStrLen);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeOperationalCredentialsClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverOperationalCredentialsAttributes", OPERATIONAL_CREDENTIALS_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4216,7 +5206,11 @@ PacketBufferHandle encodeOperationalCredentialsClusterDiscoverAttributes(uint8_t
 PacketBufferHandle encodeOperationalCredentialsClusterReadFabricsListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadOperationalCredentialsFabricsList", OPERATIONAL_CREDENTIALS_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -4226,7 +5220,11 @@ PacketBufferHandle encodeOperationalCredentialsClusterReadFabricsListAttribute(u
 PacketBufferHandle encodeOperationalCredentialsClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadOperationalCredentialsClusterRevision", OPERATIONAL_CREDENTIALS_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4249,7 +5247,12 @@ PacketBufferHandle encodeOperationalCredentialsClusterReadClusterRevisionAttribu
 PacketBufferHandle encodePumpConfigurationAndControlClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverPumpConfigurationAndControlAttributes", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4259,7 +5262,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterDiscoverAttributes(ui
 PacketBufferHandle encodePumpConfigurationAndControlClusterReadMaxPressureAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlMaxPressure", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -4269,7 +5276,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterReadMaxPressureAttrib
 PacketBufferHandle encodePumpConfigurationAndControlClusterReadMaxSpeedAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlMaxSpeed", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -4279,7 +5290,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterReadMaxSpeedAttribute
 PacketBufferHandle encodePumpConfigurationAndControlClusterReadMaxFlowAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlMaxFlow", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -4290,7 +5305,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterReadEffectiveOperatio
                                                                                                EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlEffectiveOperationMode", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0011);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0011);
     COMMAND_FOOTER();
 }
 
@@ -4301,7 +5320,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterReadEffectiveControlM
                                                                                              EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlEffectiveControlMode", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0012);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0012);
     COMMAND_FOOTER();
 }
 
@@ -4311,7 +5334,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterReadEffectiveControlM
 PacketBufferHandle encodePumpConfigurationAndControlClusterReadCapacityAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlCapacity", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0013);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0013);
     COMMAND_FOOTER();
 }
 
@@ -4321,15 +5348,18 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterConfigureCapacityAttr
                                                                                       int16_t change)
 {
     COMMAND_HEADER("ReportPumpConfigurationAndControlCapacity", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0013)
-        .Put8(41)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0013);
+    Write8(p, 41);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -4340,7 +5370,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterReadOperationModeAttr
                                                                                       EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlOperationMode", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0020);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0020);
     COMMAND_FOOTER();
 }
 
@@ -4349,12 +5383,14 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterWriteOperationModeAtt
                                                                                        uint8_t operationMode)
 {
     COMMAND_HEADER("WritePumpConfigurationAndControlOperationMode", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0020)
-        .Put8(48)
-        .Put8(static_cast<uint8_t>(operationMode));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0020);
+    Write8(p, 48);
+    Write8(p, static_cast<uint8_t>(operationMode));
     COMMAND_FOOTER();
 }
 
@@ -4365,7 +5401,11 @@ PacketBufferHandle encodePumpConfigurationAndControlClusterReadClusterRevisionAt
                                                                                         EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadPumpConfigurationAndControlClusterRevision", PUMP_CONFIG_CONTROL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4406,17 +5446,20 @@ PacketBufferHandle encodeScenesClusterAddSceneCommand(uint8_t seqNum, EndpointId
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_ADD_SCENE_COMMAND_ID)
-        .Put16(groupId)
-        .Put8(sceneId)
-        .Put16(transitionTime)
-        .Put(static_cast<uint8_t>(sceneNameStrLen))
-        .Put(sceneName.data(), sceneName.size())
-        .Put16(clusterId)
-        .Put8(length)
-        .Put8(value);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+        sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + sceneNameStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_ADD_SCENE_COMMAND_ID);
+    Write16(p, groupId);
+    Write8(p, sceneId);
+    Write16(p, transitionTime);
+    Write8(p, static_cast<uint8_t>(sceneNameStrLen));
+    WriteBytes(p, sceneName.data(), sceneNameStrLen);
+    Write16(p, clusterId);
+    Write8(p, length);
+    Write8(p, value);
     COMMAND_FOOTER();
 }
 
@@ -4427,7 +5470,12 @@ PacketBufferHandle encodeScenesClusterGetSceneMembershipCommand(uint8_t seqNum,
 {
     COMMAND_HEADER("GetSceneMembership", SCENES_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_GET_SCENE_MEMBERSHIP_COMMAND_ID).Put16(groupId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_SCENE_MEMBERSHIP_COMMAND_ID);
+    Write16(p, groupId);
     COMMAND_FOOTER();
 }
 
@@ -4439,12 +5487,14 @@ PacketBufferHandle encodeScenesClusterRecallSceneCommand(uint8_t seqNum, Endpoin
 {
     COMMAND_HEADER("RecallScene", SCENES_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_RECALL_SCENE_COMMAND_ID)
-        .Put16(groupId)
-        .Put8(sceneId)
-        .Put16(transitionTime);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_RECALL_SCENE_COMMAND_ID);
+    Write16(p, groupId);
+    Write8(p, sceneId);
+    Write16(p, transitionTime);
     COMMAND_FOOTER();
 }
 
@@ -4455,7 +5505,12 @@ PacketBufferHandle encodeScenesClusterRemoveAllScenesCommand(uint8_t seqNum, End
 {
     COMMAND_HEADER("RemoveAllScenes", SCENES_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_REMOVE_ALL_SCENES_COMMAND_ID).Put16(groupId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_REMOVE_ALL_SCENES_COMMAND_ID);
+    Write16(p, groupId);
     COMMAND_FOOTER();
 }
 
@@ -4467,7 +5522,13 @@ PacketBufferHandle encodeScenesClusterRemoveSceneCommand(uint8_t seqNum, Endpoin
 {
     COMMAND_HEADER("RemoveScene", SCENES_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_REMOVE_SCENE_COMMAND_ID).Put16(groupId).Put8(sceneId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_REMOVE_SCENE_COMMAND_ID);
+    Write16(p, groupId);
+    Write8(p, sceneId);
     COMMAND_FOOTER();
 }
 
@@ -4479,7 +5540,13 @@ PacketBufferHandle encodeScenesClusterStoreSceneCommand(uint8_t seqNum, Endpoint
 {
     COMMAND_HEADER("StoreScene", SCENES_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_STORE_SCENE_COMMAND_ID).Put16(groupId).Put8(sceneId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_STORE_SCENE_COMMAND_ID);
+    Write16(p, groupId);
+    Write8(p, sceneId);
     COMMAND_FOOTER();
 }
 
@@ -4491,14 +5558,25 @@ PacketBufferHandle encodeScenesClusterViewSceneCommand(uint8_t seqNum, EndpointI
 {
     COMMAND_HEADER("ViewScene", SCENES_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_VIEW_SCENE_COMMAND_ID).Put16(groupId).Put8(sceneId);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_VIEW_SCENE_COMMAND_ID);
+    Write16(p, groupId);
+    Write8(p, sceneId);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeScenesClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverScenesAttributes", SCENES_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4508,7 +5586,11 @@ PacketBufferHandle encodeScenesClusterDiscoverAttributes(uint8_t seqNum, Endpoin
 PacketBufferHandle encodeScenesClusterReadSceneCountAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadScenesSceneCount", SCENES_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -4518,7 +5600,11 @@ PacketBufferHandle encodeScenesClusterReadSceneCountAttribute(uint8_t seqNum, En
 PacketBufferHandle encodeScenesClusterReadCurrentSceneAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadScenesCurrentScene", SCENES_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -4528,7 +5614,11 @@ PacketBufferHandle encodeScenesClusterReadCurrentSceneAttribute(uint8_t seqNum,
 PacketBufferHandle encodeScenesClusterReadCurrentGroupAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadScenesCurrentGroup", SCENES_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -4538,7 +5628,11 @@ PacketBufferHandle encodeScenesClusterReadCurrentGroupAttribute(uint8_t seqNum,
 PacketBufferHandle encodeScenesClusterReadSceneValidAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadScenesSceneValid", SCENES_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
@@ -4548,7 +5642,11 @@ PacketBufferHandle encodeScenesClusterReadSceneValidAttribute(uint8_t seqNum, En
 PacketBufferHandle encodeScenesClusterReadNameSupportAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadScenesNameSupport", SCENES_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0004);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0004);
     COMMAND_FOOTER();
 }
 
@@ -4558,7 +5656,11 @@ PacketBufferHandle encodeScenesClusterReadNameSupportAttribute(uint8_t seqNum, E
 PacketBufferHandle encodeScenesClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadScenesClusterRevision", SCENES_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4576,7 +5678,12 @@ PacketBufferHandle encodeScenesClusterReadClusterRevisionAttribute(uint8_t seqNu
 PacketBufferHandle encodeSwitchClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverSwitchAttributes", SWITCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4586,7 +5693,11 @@ PacketBufferHandle encodeSwitchClusterDiscoverAttributes(uint8_t seqNum, Endpoin
 PacketBufferHandle encodeSwitchClusterReadNumberOfPositionsAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadSwitchNumberOfPositions", SWITCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -4596,7 +5707,11 @@ PacketBufferHandle encodeSwitchClusterReadNumberOfPositionsAttribute(uint8_t seq
 PacketBufferHandle encodeSwitchClusterReadCurrentPositionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadSwitchCurrentPosition", SWITCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -4604,15 +5719,18 @@ PacketBufferHandle encodeSwitchClusterConfigureCurrentPositionAttribute(uint8_t
                                                                         uint16_t minInterval, uint16_t maxInterval, uint8_t change)
 {
     COMMAND_HEADER("ReportSwitchCurrentPosition", SWITCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0001)
-        .Put8(32)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put8(static_cast<uint8_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0001);
+    Write8(p, 32);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write8(p, static_cast<uint8_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -4622,7 +5740,11 @@ PacketBufferHandle encodeSwitchClusterConfigureCurrentPositionAttribute(uint8_t
 PacketBufferHandle encodeSwitchClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadSwitchClusterRevision", SWITCH_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4654,11 +5776,13 @@ PacketBufferHandle encodeTvChannelClusterChangeChannelCommand(uint8_t seqNum, En
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CHANGE_CHANNEL_COMMAND_ID)
-        .Put(static_cast<uint8_t>(matchStrLen))
-        .Put(match.data(), match.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + matchStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CHANGE_CHANNEL_COMMAND_ID);
+    Write8(p, static_cast<uint8_t>(matchStrLen));
+    WriteBytes(p, match.data(), matchStrLen);
     COMMAND_FOOTER();
 }
 
@@ -4670,11 +5794,13 @@ PacketBufferHandle encodeTvChannelClusterChangeChannelByNumberCommand(uint8_t se
 {
     COMMAND_HEADER("ChangeChannelByNumber", TV_CHANNEL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CHANGE_CHANNEL_BY_NUMBER_COMMAND_ID)
-        .Put16(majorNumber)
-        .Put16(minorNumber);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CHANGE_CHANNEL_BY_NUMBER_COMMAND_ID);
+    Write16(p, majorNumber);
+    Write16(p, minorNumber);
     COMMAND_FOOTER();
 }
 
@@ -4685,14 +5811,24 @@ PacketBufferHandle encodeTvChannelClusterSkipChannelCommand(uint8_t seqNum, Endp
 {
     COMMAND_HEADER("SkipChannel", TV_CHANNEL_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_SKIP_CHANNEL_COMMAND_ID).Put16(count);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SKIP_CHANNEL_COMMAND_ID);
+    Write16(p, count);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTvChannelClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverTvChannelAttributes", TV_CHANNEL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4702,7 +5838,11 @@ PacketBufferHandle encodeTvChannelClusterDiscoverAttributes(uint8_t seqNum, Endp
 PacketBufferHandle encodeTvChannelClusterReadTvChannelListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTvChannelTvChannelList", TV_CHANNEL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -4712,7 +5852,11 @@ PacketBufferHandle encodeTvChannelClusterReadTvChannelListAttribute(uint8_t seqN
 PacketBufferHandle encodeTvChannelClusterReadTvChannelLineupAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTvChannelTvChannelLineup", TV_CHANNEL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -4722,7 +5866,11 @@ PacketBufferHandle encodeTvChannelClusterReadTvChannelLineupAttribute(uint8_t se
 PacketBufferHandle encodeTvChannelClusterReadCurrentTvChannelAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTvChannelCurrentTvChannel", TV_CHANNEL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -4732,7 +5880,11 @@ PacketBufferHandle encodeTvChannelClusterReadCurrentTvChannelAttribute(uint8_t s
 PacketBufferHandle encodeTvChannelClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTvChannelClusterRevision", TV_CHANNEL_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4762,19 +5914,26 @@ PacketBufferHandle encodeTargetNavigatorClusterNavigateTargetCommand(uint8_t seq
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_NAVIGATE_TARGET_COMMAND_ID)
-        .Put8(target)
-        .Put(static_cast<uint8_t>(dataStrLen))
-        .Put(data.data(), data.size());
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + dataStrLen);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_NAVIGATE_TARGET_COMMAND_ID);
+    Write8(p, target);
+    Write8(p, static_cast<uint8_t>(dataStrLen));
+    WriteBytes(p, data.data(), dataStrLen);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTargetNavigatorClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverTargetNavigatorAttributes", TARGET_NAVIGATOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4784,7 +5943,11 @@ PacketBufferHandle encodeTargetNavigatorClusterDiscoverAttributes(uint8_t seqNum
 PacketBufferHandle encodeTargetNavigatorClusterReadTargetNavigatorListAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTargetNavigatorTargetNavigatorList", TARGET_NAVIGATOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -4794,7 +5957,11 @@ PacketBufferHandle encodeTargetNavigatorClusterReadTargetNavigatorListAttribute(
 PacketBufferHandle encodeTargetNavigatorClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTargetNavigatorClusterRevision", TARGET_NAVIGATOR_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4813,7 +5980,12 @@ PacketBufferHandle encodeTargetNavigatorClusterReadClusterRevisionAttribute(uint
 PacketBufferHandle encodeTemperatureMeasurementClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverTemperatureMeasurementAttributes", TEMP_MEASUREMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4823,7 +5995,11 @@ PacketBufferHandle encodeTemperatureMeasurementClusterDiscoverAttributes(uint8_t
 PacketBufferHandle encodeTemperatureMeasurementClusterReadMeasuredValueAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTemperatureMeasurementMeasuredValue", TEMP_MEASUREMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -4833,15 +6009,18 @@ PacketBufferHandle encodeTemperatureMeasurementClusterConfigureMeasuredValueAttr
                                                                                       int16_t change)
 {
     COMMAND_HEADER("ReportTemperatureMeasurementMeasuredValue", TEMP_MEASUREMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0000)
-        .Put8(41)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0000);
+    Write8(p, 41);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -4851,7 +6030,11 @@ PacketBufferHandle encodeTemperatureMeasurementClusterConfigureMeasuredValueAttr
 PacketBufferHandle encodeTemperatureMeasurementClusterReadMinMeasuredValueAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTemperatureMeasurementMinMeasuredValue", TEMP_MEASUREMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
@@ -4861,7 +6044,11 @@ PacketBufferHandle encodeTemperatureMeasurementClusterReadMinMeasuredValueAttrib
 PacketBufferHandle encodeTemperatureMeasurementClusterReadMaxMeasuredValueAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTemperatureMeasurementMaxMeasuredValue", TEMP_MEASUREMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
@@ -4871,7 +6058,11 @@ PacketBufferHandle encodeTemperatureMeasurementClusterReadMaxMeasuredValueAttrib
 PacketBufferHandle encodeTemperatureMeasurementClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTemperatureMeasurementClusterRevision", TEMP_MEASUREMENT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -4910,7 +6101,11 @@ PacketBufferHandle encodeTemperatureMeasurementClusterReadClusterRevisionAttribu
 PacketBufferHandle encodeTestClusterClusterTestCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("Test", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_TEST_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_TEST_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -4920,7 +6115,11 @@ PacketBufferHandle encodeTestClusterClusterTestCommand(uint8_t seqNum, EndpointI
 PacketBufferHandle encodeTestClusterClusterTestNotHandledCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("TestNotHandled", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_TEST_NOT_HANDLED_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_TEST_NOT_HANDLED_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -4930,14 +6129,23 @@ PacketBufferHandle encodeTestClusterClusterTestNotHandledCommand(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterTestSpecificCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("TestSpecific", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_TEST_SPECIFIC_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_TEST_SPECIFIC_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverTestClusterAttributes", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -4947,19 +6155,25 @@ PacketBufferHandle encodeTestClusterClusterDiscoverAttributes(uint8_t seqNum, En
 PacketBufferHandle encodeTestClusterClusterReadBooleanAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterBoolean", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteBooleanAttribute(uint8_t seqNum, EndpointId destinationEndpoint, uint8_t boolean)
 {
     COMMAND_HEADER("WriteTestClusterBoolean", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0000)
-        .Put8(16)
-        .Put8(static_cast<uint8_t>(boolean));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 16);
+    Write8(p, static_cast<uint8_t>(boolean));
     COMMAND_FOOTER();
 }
 
@@ -4969,19 +6183,25 @@ PacketBufferHandle encodeTestClusterClusterWriteBooleanAttribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadBitmap8Attribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterBitmap8", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0001);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteBitmap8Attribute(uint8_t seqNum, EndpointId destinationEndpoint, uint8_t bitmap8)
 {
     COMMAND_HEADER("WriteTestClusterBitmap8", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0001)
-        .Put8(24)
-        .Put8(static_cast<uint8_t>(bitmap8));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0001);
+    Write8(p, 24);
+    Write8(p, static_cast<uint8_t>(bitmap8));
     COMMAND_FOOTER();
 }
 
@@ -4991,19 +6211,25 @@ PacketBufferHandle encodeTestClusterClusterWriteBitmap8Attribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadBitmap16Attribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterBitmap16", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0002);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteBitmap16Attribute(uint8_t seqNum, EndpointId destinationEndpoint, uint16_t bitmap16)
 {
     COMMAND_HEADER("WriteTestClusterBitmap16", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0002)
-        .Put8(25)
-        .Put16(static_cast<uint16_t>(bitmap16));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0002);
+    Write8(p, 25);
+    Write16(p, static_cast<uint16_t>(bitmap16));
     COMMAND_FOOTER();
 }
 
@@ -5013,19 +6239,25 @@ PacketBufferHandle encodeTestClusterClusterWriteBitmap16Attribute(uint8_t seqNum
 PacketBufferHandle encodeTestClusterClusterReadBitmap32Attribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterBitmap32", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteBitmap32Attribute(uint8_t seqNum, EndpointId destinationEndpoint, uint32_t bitmap32)
 {
     COMMAND_HEADER("WriteTestClusterBitmap32", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0003)
-        .Put8(27)
-        .Put32(static_cast<uint32_t>(bitmap32));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
+    Write8(p, 27);
+    Write32(p, static_cast<uint32_t>(bitmap32));
     COMMAND_FOOTER();
 }
 
@@ -5035,19 +6267,25 @@ PacketBufferHandle encodeTestClusterClusterWriteBitmap32Attribute(uint8_t seqNum
 PacketBufferHandle encodeTestClusterClusterReadBitmap64Attribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterBitmap64", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0004);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0004);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteBitmap64Attribute(uint8_t seqNum, EndpointId destinationEndpoint, uint64_t bitmap64)
 {
     COMMAND_HEADER("WriteTestClusterBitmap64", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0004)
-        .Put8(31)
-        .Put64(static_cast<uint64_t>(bitmap64));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint64_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0004);
+    Write8(p, 31);
+    Write64(p, static_cast<uint64_t>(bitmap64));
     COMMAND_FOOTER();
 }
 
@@ -5057,19 +6295,25 @@ PacketBufferHandle encodeTestClusterClusterWriteBitmap64Attribute(uint8_t seqNum
 PacketBufferHandle encodeTestClusterClusterReadInt8uAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt8u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0005);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0005);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt8uAttribute(uint8_t seqNum, EndpointId destinationEndpoint, uint8_t int8u)
 {
     COMMAND_HEADER("WriteTestClusterInt8u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0005)
-        .Put8(32)
-        .Put8(static_cast<uint8_t>(int8u));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0005);
+    Write8(p, 32);
+    Write8(p, static_cast<uint8_t>(int8u));
     COMMAND_FOOTER();
 }
 
@@ -5079,19 +6323,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt8uAttribute(uint8_t seqNum, E
 PacketBufferHandle encodeTestClusterClusterReadInt16uAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt16u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0006);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0006);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt16uAttribute(uint8_t seqNum, EndpointId destinationEndpoint, uint16_t int16u)
 {
     COMMAND_HEADER("WriteTestClusterInt16u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0006)
-        .Put8(33)
-        .Put16(static_cast<uint16_t>(int16u));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0006);
+    Write8(p, 33);
+    Write16(p, static_cast<uint16_t>(int16u));
     COMMAND_FOOTER();
 }
 
@@ -5101,19 +6351,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt16uAttribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadInt32uAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt32u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0008);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0008);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt32uAttribute(uint8_t seqNum, EndpointId destinationEndpoint, uint32_t int32u)
 {
     COMMAND_HEADER("WriteTestClusterInt32u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0008)
-        .Put8(35)
-        .Put32(static_cast<uint32_t>(int32u));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0008);
+    Write8(p, 35);
+    Write32(p, static_cast<uint32_t>(int32u));
     COMMAND_FOOTER();
 }
 
@@ -5123,19 +6379,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt32uAttribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadInt64uAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt64u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000C);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000C);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt64uAttribute(uint8_t seqNum, EndpointId destinationEndpoint, uint64_t int64u)
 {
     COMMAND_HEADER("WriteTestClusterInt64u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x000C)
-        .Put8(39)
-        .Put64(static_cast<uint64_t>(int64u));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint64_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000C);
+    Write8(p, 39);
+    Write64(p, static_cast<uint64_t>(int64u));
     COMMAND_FOOTER();
 }
 
@@ -5145,19 +6407,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt64uAttribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadInt8sAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt8s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000D);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000D);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt8sAttribute(uint8_t seqNum, EndpointId destinationEndpoint, int8_t int8s)
 {
     COMMAND_HEADER("WriteTestClusterInt8s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x000D)
-        .Put8(40)
-        .Put8(static_cast<uint8_t>(int8s));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000D);
+    Write8(p, 40);
+    Write8(p, static_cast<uint8_t>(int8s));
     COMMAND_FOOTER();
 }
 
@@ -5167,19 +6435,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt8sAttribute(uint8_t seqNum, E
 PacketBufferHandle encodeTestClusterClusterReadInt16sAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt16s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x000E);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000E);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt16sAttribute(uint8_t seqNum, EndpointId destinationEndpoint, int16_t int16s)
 {
     COMMAND_HEADER("WriteTestClusterInt16s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x000E)
-        .Put8(41)
-        .Put16(static_cast<uint16_t>(int16s));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x000E);
+    Write8(p, 41);
+    Write16(p, static_cast<uint16_t>(int16s));
     COMMAND_FOOTER();
 }
 
@@ -5189,19 +6463,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt16sAttribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadInt32sAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt32s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0010);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0010);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt32sAttribute(uint8_t seqNum, EndpointId destinationEndpoint, int32_t int32s)
 {
     COMMAND_HEADER("WriteTestClusterInt32s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0010)
-        .Put8(43)
-        .Put32(static_cast<uint32_t>(int32s));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint32_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0010);
+    Write8(p, 43);
+    Write32(p, static_cast<uint32_t>(int32s));
     COMMAND_FOOTER();
 }
 
@@ -5211,19 +6491,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt32sAttribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadInt64sAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterInt64s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0014);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0014);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteInt64sAttribute(uint8_t seqNum, EndpointId destinationEndpoint, int64_t int64s)
 {
     COMMAND_HEADER("WriteTestClusterInt64s", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0014)
-        .Put8(47)
-        .Put64(static_cast<uint64_t>(int64s));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint64_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0014);
+    Write8(p, 47);
+    Write64(p, static_cast<uint64_t>(int64s));
     COMMAND_FOOTER();
 }
 
@@ -5233,19 +6519,25 @@ PacketBufferHandle encodeTestClusterClusterWriteInt64sAttribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadEnum8Attribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterEnum8", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0015);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0015);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteEnum8Attribute(uint8_t seqNum, EndpointId destinationEndpoint, uint8_t enum8)
 {
     COMMAND_HEADER("WriteTestClusterEnum8", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0015)
-        .Put8(48)
-        .Put8(static_cast<uint8_t>(enum8));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0015);
+    Write8(p, 48);
+    Write8(p, static_cast<uint8_t>(enum8));
     COMMAND_FOOTER();
 }
 
@@ -5255,19 +6547,25 @@ PacketBufferHandle encodeTestClusterClusterWriteEnum8Attribute(uint8_t seqNum, E
 PacketBufferHandle encodeTestClusterClusterReadEnum16Attribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterEnum16", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0016);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0016);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeTestClusterClusterWriteEnum16Attribute(uint8_t seqNum, EndpointId destinationEndpoint, uint16_t enum16)
 {
     COMMAND_HEADER("WriteTestClusterEnum16", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0016)
-        .Put8(49)
-        .Put16(static_cast<uint16_t>(enum16));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0016);
+    Write8(p, 49);
+    Write16(p, static_cast<uint16_t>(enum16));
     COMMAND_FOOTER();
 }
 
@@ -5277,7 +6575,11 @@ PacketBufferHandle encodeTestClusterClusterWriteEnum16Attribute(uint8_t seqNum,
 PacketBufferHandle encodeTestClusterClusterReadOctetStringAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterOctetString", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0019);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0019);
     COMMAND_FOOTER();
 }
 
@@ -5292,13 +6594,15 @@ PacketBufferHandle encodeTestClusterClusterWriteOctetStringAttribute(uint8_t seq
         return PacketBufferHandle();
     }
 
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0019)
-        .Put8(65)
-        .Put(static_cast<uint8_t>(octetStringStrLen))
-        .Put(octetString.data(), octetStringStrLen);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize + octetStringStrLen);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0019);
+    Write8(p, 65);
+    Write8(p, static_cast<uint8_t>(octetStringStrLen));
+    WriteBytes(p, octetString.data(), octetStringStrLen);
     COMMAND_FOOTER();
 }
 
@@ -5308,7 +6612,11 @@ PacketBufferHandle encodeTestClusterClusterWriteOctetStringAttribute(uint8_t seq
 PacketBufferHandle encodeTestClusterClusterReadListInt8uAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterListInt8u", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x001A);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x001A);
     COMMAND_FOOTER();
 }
 
@@ -5318,7 +6626,11 @@ PacketBufferHandle encodeTestClusterClusterReadListInt8uAttribute(uint8_t seqNum
 PacketBufferHandle encodeTestClusterClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadTestClusterClusterRevision", TEST_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -5347,7 +6659,11 @@ PacketBufferHandle encodeTestClusterClusterReadClusterRevisionAttribute(uint8_t
 PacketBufferHandle encodeThermostatClusterClearWeeklyScheduleCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ClearWeeklySchedule", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_CLEAR_WEEKLY_SCHEDULE_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CLEAR_WEEKLY_SCHEDULE_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -5357,7 +6673,11 @@ PacketBufferHandle encodeThermostatClusterClearWeeklyScheduleCommand(uint8_t seq
 PacketBufferHandle encodeThermostatClusterGetRelayStatusLogCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("GetRelayStatusLog", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_GET_RELAY_STATUS_LOG_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_RELAY_STATUS_LOG_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -5369,11 +6689,13 @@ PacketBufferHandle encodeThermostatClusterGetWeeklyScheduleCommand(uint8_t seqNu
 {
     COMMAND_HEADER("GetWeeklySchedule", THERMOSTAT_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_GET_WEEKLY_SCHEDULE_COMMAND_ID)
-        .Put8(daysToReturn)
-        .Put8(modeToReturn);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_GET_WEEKLY_SCHEDULE_COMMAND_ID);
+    Write8(p, daysToReturn);
+    Write8(p, modeToReturn);
     COMMAND_FOOTER();
 }
 
@@ -5387,13 +6709,15 @@ PacketBufferHandle encodeThermostatClusterSetWeeklyScheduleCommand(uint8_t seqNu
 {
     COMMAND_HEADER("SetWeeklySchedule", THERMOSTAT_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SET_WEEKLY_SCHEDULE_COMMAND_ID)
-        .Put8(numberOfTransitionsForSequence)
-        .Put8(dayOfWeekForSequence)
-        .Put8(modeForSequence)
-        .Put8(payload);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SET_WEEKLY_SCHEDULE_COMMAND_ID);
+    Write8(p, numberOfTransitionsForSequence);
+    Write8(p, dayOfWeekForSequence);
+    Write8(p, modeForSequence);
+    Write8(p, payload);
     COMMAND_FOOTER();
 }
 
@@ -5405,18 +6729,25 @@ PacketBufferHandle encodeThermostatClusterSetpointRaiseLowerCommand(uint8_t seqN
 {
     COMMAND_HEADER("SetpointRaiseLower", THERMOSTAT_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_SETPOINT_RAISE_LOWER_COMMAND_ID)
-        .Put8(mode)
-        .Put8(static_cast<uint8_t>(amount));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_SETPOINT_RAISE_LOWER_COMMAND_ID);
+    Write8(p, mode);
+    Write8(p, static_cast<uint8_t>(amount));
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeThermostatClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverThermostatAttributes", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -5426,7 +6757,11 @@ PacketBufferHandle encodeThermostatClusterDiscoverAttributes(uint8_t seqNum, End
 PacketBufferHandle encodeThermostatClusterReadLocalTemperatureAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadThermostatLocalTemperature", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -5435,15 +6770,18 @@ PacketBufferHandle encodeThermostatClusterConfigureLocalTemperatureAttribute(uin
                                                                              int16_t change)
 {
     COMMAND_HEADER("ReportThermostatLocalTemperature", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0000)
-        .Put8(41)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0000);
+    Write8(p, 41);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -5453,7 +6791,11 @@ PacketBufferHandle encodeThermostatClusterConfigureLocalTemperatureAttribute(uin
 PacketBufferHandle encodeThermostatClusterReadOccupiedCoolingSetpointAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadThermostatOccupiedCoolingSetpoint", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0011);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0011);
     COMMAND_FOOTER();
 }
 
@@ -5461,12 +6803,14 @@ PacketBufferHandle encodeThermostatClusterWriteOccupiedCoolingSetpointAttribute(
                                                                                 int16_t occupiedCoolingSetpoint)
 {
     COMMAND_HEADER("WriteThermostatOccupiedCoolingSetpoint", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0011)
-        .Put8(41)
-        .Put16(static_cast<uint16_t>(occupiedCoolingSetpoint));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0011);
+    Write8(p, 41);
+    Write16(p, static_cast<uint16_t>(occupiedCoolingSetpoint));
     COMMAND_FOOTER();
 }
 
@@ -5476,7 +6820,11 @@ PacketBufferHandle encodeThermostatClusterWriteOccupiedCoolingSetpointAttribute(
 PacketBufferHandle encodeThermostatClusterReadOccupiedHeatingSetpointAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadThermostatOccupiedHeatingSetpoint", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0012);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0012);
     COMMAND_FOOTER();
 }
 
@@ -5484,12 +6832,14 @@ PacketBufferHandle encodeThermostatClusterWriteOccupiedHeatingSetpointAttribute(
                                                                                 int16_t occupiedHeatingSetpoint)
 {
     COMMAND_HEADER("WriteThermostatOccupiedHeatingSetpoint", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0012)
-        .Put8(41)
-        .Put16(static_cast<uint16_t>(occupiedHeatingSetpoint));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0012);
+    Write8(p, 41);
+    Write16(p, static_cast<uint16_t>(occupiedHeatingSetpoint));
     COMMAND_FOOTER();
 }
 
@@ -5499,7 +6849,11 @@ PacketBufferHandle encodeThermostatClusterWriteOccupiedHeatingSetpointAttribute(
 PacketBufferHandle encodeThermostatClusterReadControlSequenceOfOperationAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadThermostatControlSequenceOfOperation", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x001B);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x001B);
     COMMAND_FOOTER();
 }
 
@@ -5507,12 +6861,14 @@ PacketBufferHandle encodeThermostatClusterWriteControlSequenceOfOperationAttribu
                                                                                    uint8_t controlSequenceOfOperation)
 {
     COMMAND_HEADER("WriteThermostatControlSequenceOfOperation", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x001B)
-        .Put8(48)
-        .Put8(static_cast<uint8_t>(controlSequenceOfOperation));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x001B);
+    Write8(p, 48);
+    Write8(p, static_cast<uint8_t>(controlSequenceOfOperation));
     COMMAND_FOOTER();
 }
 
@@ -5522,7 +6878,11 @@ PacketBufferHandle encodeThermostatClusterWriteControlSequenceOfOperationAttribu
 PacketBufferHandle encodeThermostatClusterReadSystemModeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadThermostatSystemMode", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x001C);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x001C);
     COMMAND_FOOTER();
 }
 
@@ -5530,12 +6890,14 @@ PacketBufferHandle encodeThermostatClusterWriteSystemModeAttribute(uint8_t seqNu
                                                                    uint8_t systemMode)
 {
     COMMAND_HEADER("WriteThermostatSystemMode", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x001C)
-        .Put8(48)
-        .Put8(static_cast<uint8_t>(systemMode));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x001C);
+    Write8(p, 48);
+    Write8(p, static_cast<uint8_t>(systemMode));
     COMMAND_FOOTER();
 }
 
@@ -5545,7 +6907,11 @@ PacketBufferHandle encodeThermostatClusterWriteSystemModeAttribute(uint8_t seqNu
 PacketBufferHandle encodeThermostatClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadThermostatClusterRevision", THERMOSTAT_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -5562,7 +6928,12 @@ PacketBufferHandle encodeThermostatClusterReadClusterRevisionAttribute(uint8_t s
 PacketBufferHandle encodeWakeOnLanClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverWakeOnLanAttributes", WAKE_ON_LAN_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -5572,7 +6943,11 @@ PacketBufferHandle encodeWakeOnLanClusterDiscoverAttributes(uint8_t seqNum, Endp
 PacketBufferHandle encodeWakeOnLanClusterReadWakeOnLanMacAddressAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWakeOnLanWakeOnLanMacAddress", WAKE_ON_LAN_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -5582,7 +6957,11 @@ PacketBufferHandle encodeWakeOnLanClusterReadWakeOnLanMacAddressAttribute(uint8_
 PacketBufferHandle encodeWakeOnLanClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWakeOnLanClusterRevision", WAKE_ON_LAN_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
 
@@ -5617,7 +6996,11 @@ PacketBufferHandle encodeWakeOnLanClusterReadClusterRevisionAttribute(uint8_t se
 PacketBufferHandle encodeWindowCoveringClusterWindowCoveringDownCloseCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("WindowCoveringDownClose", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_WINDOW_COVERING_DOWN_CLOSE_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WINDOW_COVERING_DOWN_CLOSE_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -5630,10 +7013,12 @@ PacketBufferHandle encodeWindowCoveringClusterWindowCoveringGoToLiftPercentageCo
 {
     COMMAND_HEADER("WindowCoveringGoToLiftPercentage", WINDOW_COVERING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WINDOW_COVERING_GO_TO_LIFT_PERCENTAGE_COMMAND_ID)
-        .Put8(percentageLiftValue);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WINDOW_COVERING_GO_TO_LIFT_PERCENTAGE_COMMAND_ID);
+    Write8(p, percentageLiftValue);
     COMMAND_FOOTER();
 }
 
@@ -5645,10 +7030,12 @@ PacketBufferHandle encodeWindowCoveringClusterWindowCoveringGoToLiftValueCommand
 {
     COMMAND_HEADER("WindowCoveringGoToLiftValue", WINDOW_COVERING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WINDOW_COVERING_GO_TO_LIFT_VALUE_COMMAND_ID)
-        .Put16(liftValue);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WINDOW_COVERING_GO_TO_LIFT_VALUE_COMMAND_ID);
+    Write16(p, liftValue);
     COMMAND_FOOTER();
 }
 
@@ -5661,10 +7048,12 @@ PacketBufferHandle encodeWindowCoveringClusterWindowCoveringGoToTiltPercentageCo
 {
     COMMAND_HEADER("WindowCoveringGoToTiltPercentage", WINDOW_COVERING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WINDOW_COVERING_GO_TO_TILT_PERCENTAGE_COMMAND_ID)
-        .Put8(percentageTiltValue);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WINDOW_COVERING_GO_TO_TILT_PERCENTAGE_COMMAND_ID);
+    Write8(p, percentageTiltValue);
     COMMAND_FOOTER();
 }
 
@@ -5676,10 +7065,12 @@ PacketBufferHandle encodeWindowCoveringClusterWindowCoveringGoToTiltValueCommand
 {
     COMMAND_HEADER("WindowCoveringGoToTiltValue", WINDOW_COVERING_CLUSTER_ID);
 
-    buf.Put8(kFrameControlClusterSpecificCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WINDOW_COVERING_GO_TO_TILT_VALUE_COMMAND_ID)
-        .Put16(tiltValue);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WINDOW_COVERING_GO_TO_TILT_VALUE_COMMAND_ID);
+    Write16(p, tiltValue);
     COMMAND_FOOTER();
 }
 
@@ -5689,7 +7080,11 @@ PacketBufferHandle encodeWindowCoveringClusterWindowCoveringGoToTiltValueCommand
 PacketBufferHandle encodeWindowCoveringClusterWindowCoveringStopCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("WindowCoveringStop", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_WINDOW_COVERING_STOP_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WINDOW_COVERING_STOP_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
@@ -5699,14 +7094,23 @@ PacketBufferHandle encodeWindowCoveringClusterWindowCoveringStopCommand(uint8_t
 PacketBufferHandle encodeWindowCoveringClusterWindowCoveringUpOpenCommand(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("WindowCoveringUpOpen", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlClusterSpecificCommand).Put8(seqNum).Put8(ZCL_WINDOW_COVERING_UP_OPEN_COMMAND_ID);
+    constexpr size_t kFixedSize = kZclHeaderSize;
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlClusterSpecificCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WINDOW_COVERING_UP_OPEN_COMMAND_ID);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeWindowCoveringClusterDiscoverAttributes(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("DiscoverWindowCoveringAttributes", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID).Put16(0x0000).Put8(0xFF);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_DISCOVER_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
+    Write8(p, 0xFF);
     COMMAND_FOOTER();
 }
 
@@ -5716,7 +7120,11 @@ PacketBufferHandle encodeWindowCoveringClusterDiscoverAttributes(uint8_t seqNum,
 PacketBufferHandle encodeWindowCoveringClusterReadWindowCoveringTypeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringWindowCoveringType", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0000);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0000);
     COMMAND_FOOTER();
 }
 
@@ -5724,14 +7132,16 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureWindowCoveringTypeAttribu
                                                                                    uint16_t minInterval, uint16_t maxInterval)
 {
     COMMAND_HEADER("ReportWindowCoveringWindowCoveringType", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0000)
-        .Put8(48)
-        .Put16(minInterval)
-        .Put16(maxInterval);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0000);
+    Write8(p, 48);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
     COMMAND_FOOTER();
 }
 
@@ -5741,7 +7151,11 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureWindowCoveringTypeAttribu
 PacketBufferHandle encodeWindowCoveringClusterReadCurrentPositionLiftAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringCurrentPositionLift", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0003);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0003);
     COMMAND_FOOTER();
 }
 
@@ -5750,15 +7164,18 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureCurrentPositionLiftAttrib
                                                                                     uint16_t change)
 {
     COMMAND_HEADER("ReportWindowCoveringCurrentPositionLift", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0003)
-        .Put8(33)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0003);
+    Write8(p, 33);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -5768,7 +7185,11 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureCurrentPositionLiftAttrib
 PacketBufferHandle encodeWindowCoveringClusterReadCurrentPositionTiltAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringCurrentPositionTilt", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0004);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0004);
     COMMAND_FOOTER();
 }
 
@@ -5777,15 +7198,18 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureCurrentPositionTiltAttrib
                                                                                     uint16_t change)
 {
     COMMAND_HEADER("ReportWindowCoveringCurrentPositionTilt", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0004)
-        .Put8(33)
-        .Put16(minInterval)
-        .Put16(maxInterval);
-    buf.Put16(static_cast<uint16_t>(change));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t) +
+        sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0004);
+    Write8(p, 33);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
+    Write16(p, static_cast<uint16_t>(change));
     COMMAND_FOOTER();
 }
 
@@ -5795,7 +7219,11 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureCurrentPositionTiltAttrib
 PacketBufferHandle encodeWindowCoveringClusterReadConfigStatusAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringConfigStatus", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0007);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0007);
     COMMAND_FOOTER();
 }
 
@@ -5803,14 +7231,16 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureConfigStatusAttribute(uin
                                                                              uint16_t minInterval, uint16_t maxInterval)
 {
     COMMAND_HEADER("ReportWindowCoveringConfigStatus", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_CONFIGURE_REPORTING_COMMAND_ID)
-        .Put8(EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        .Put16(0x0007)
-        .Put8(24)
-        .Put16(minInterval)
-        .Put16(maxInterval);
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint8_t) + 2 * sizeof(uint16_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_CONFIGURE_REPORTING_COMMAND_ID);
+    Write8(p, EMBER_ZCL_REPORTING_DIRECTION_REPORTED);
+    Write16(p, 0x0007);
+    Write8(p, 24);
+    Write16(p, minInterval);
+    Write16(p, maxInterval);
     COMMAND_FOOTER();
 }
 
@@ -5820,7 +7250,11 @@ PacketBufferHandle encodeWindowCoveringClusterConfigureConfigStatusAttribute(uin
 PacketBufferHandle encodeWindowCoveringClusterReadInstalledOpenLimitLiftAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringInstalledOpenLimitLift", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0010);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0010);
     COMMAND_FOOTER();
 }
 
@@ -5830,7 +7264,11 @@ PacketBufferHandle encodeWindowCoveringClusterReadInstalledOpenLimitLiftAttribut
 PacketBufferHandle encodeWindowCoveringClusterReadInstalledClosedLimitLiftAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringInstalledClosedLimitLift", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0011);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0011);
     COMMAND_FOOTER();
 }
 
@@ -5840,7 +7278,11 @@ PacketBufferHandle encodeWindowCoveringClusterReadInstalledClosedLimitLiftAttrib
 PacketBufferHandle encodeWindowCoveringClusterReadInstalledOpenLimitTiltAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringInstalledOpenLimitTilt", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0012);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0012);
     COMMAND_FOOTER();
 }
 
@@ -5850,7 +7292,11 @@ PacketBufferHandle encodeWindowCoveringClusterReadInstalledOpenLimitTiltAttribut
 PacketBufferHandle encodeWindowCoveringClusterReadInstalledClosedLimitTiltAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringInstalledClosedLimitTilt", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0013);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0013);
     COMMAND_FOOTER();
 }
 
@@ -5860,19 +7306,25 @@ PacketBufferHandle encodeWindowCoveringClusterReadInstalledClosedLimitTiltAttrib
 PacketBufferHandle encodeWindowCoveringClusterReadModeAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringMode", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0x0017);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0017);
     COMMAND_FOOTER();
 }
 
 PacketBufferHandle encodeWindowCoveringClusterWriteModeAttribute(uint8_t seqNum, EndpointId destinationEndpoint, uint8_t mode)
 {
     COMMAND_HEADER("WriteWindowCoveringMode", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand)
-        .Put8(seqNum)
-        .Put8(ZCL_WRITE_ATTRIBUTES_COMMAND_ID)
-        .Put16(0x0017)
-        .Put8(24)
-        .Put8(static_cast<uint8_t>(mode));
+    constexpr size_t kFixedSize = kZclHeaderSize + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t);
+    COMMAND_PAYLOAD(kFixedSize);
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_WRITE_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0x0017);
+    Write8(p, 24);
+    Write8(p, static_cast<uint8_t>(mode));
     COMMAND_FOOTER();
 }
 
@@ -5882,6 +7334,10 @@ PacketBufferHandle encodeWindowCoveringClusterWriteModeAttribute(uint8_t seqNum,
 PacketBufferHandle encodeWindowCoveringClusterReadClusterRevisionAttribute(uint8_t seqNum, EndpointId destinationEndpoint)
 {
     COMMAND_HEADER("ReadWindowCoveringClusterRevision", WINDOW_COVERING_CLUSTER_ID);
-    buf.Put8(kFrameControlGlobalCommand).Put8(seqNum).Put8(ZCL_READ_ATTRIBUTES_COMMAND_ID).Put16(0xFFFD);
+    COMMAND_PAYLOAD(kZclHeaderSize + sizeof(uint16_t));
+    Write8(p, kFrameControlGlobalCommand);
+    Write8(p, seqNum);
+    Write8(p, ZCL_READ_ATTRIBUTES_COMMAND_ID);
+    Write16(p, 0xFFFD);
     COMMAND_FOOTER();
 }
@@ -23,32 +23,48 @@
  *
  */
 
+#include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/Engine.h>
+#include <system/SystemStats.h>
+
+#include <algorithm>
+#include <limits>
 
 namespace chip {
 namespace app {
 namespace reporting {
+namespace {
+// Room left after the attribute data list for its end of container, the MoreChunkedMessages flag and the end of the report.
+constexpr uint32_t kReservedSizeForEndOfReportData = 4;
+} // namespace
+
 CHIP_ERROR Engine::Init()
 {
-    mMoreChunkedMessages = false;
-    mNumReportsInFlight  = 0;
-    mCurReadHandlerIdx   = 0;
+    mNumReportsInFlight = 0;
+    mCurReadHandlerIdx  = 0;
+    mRunScheduled       = false;
+    mScheduledRunTimeMs = 0;
+    mBatchDepth         = 0;
+    mBatchRunPending    = false;
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    ClearReportCache();
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR
 Engine::RetrieveClusterData(AttributeDataElement::Builder & aAttributeDataElementBuilder, ClusterInfo & aClusterInfo)
 {
-    CHIP_ERROR err                              = CHIP_NO_ERROR;
-    TLV::TLVType type                           = TLV::kTLVType_NotSpecified;
-    AttributePath::Builder attributePathBuilder = aAttributeDataElementBuilder.CreateAttributePathBuilder();
-    attributePathBuilder.NodeId(aClusterInfo.mAttributePathParams.mNodeId)
-        .EndpointId(aClusterInfo.mAttributePathParams.mEndpointId)
-        .ClusterId(aClusterInfo.mAttributePathParams.mClusterId)
-        .FieldId(aClusterInfo.mAttributePathParams.mFieldId)
-        .EndOfAttributePath();
-    err = attributePathBuilder.GetError();
+    CHIP_ERROR err          = CHIP_NO_ERROR;
+    TLV::TLVType type       = TLV::kTLVType_NotSpecified;
+    DataVersion dataVersion = 0;
+
+    aAttributeDataElementBuilder.EncodeAttributePath(aClusterInfo.mAttributePathParams.mNodeId,
+                                                     aClusterInfo.mAttributePathParams.mEndpointId,
+                                                     aClusterInfo.mAttributePathParams.mClusterId,
+                                                     aClusterInfo.mAttributePathParams.mFieldId);
+    err = aAttributeDataElementBuilder.GetError();
     SuccessOrExit(err);
 
     aAttributeDataElementBuilder.GetWriter()->StartContainer(TLV::ContextTag(AttributeDataElement::kCsTag_Data),
@@ -56,9 +72,11 @@ Engine::RetrieveClusterData(AttributeDataElement::Builder & aAttributeDataElemen
     err = ReadSingleClusterData(aClusterInfo.mAttributePathParams, *(aAttributeDataElementBuilder.GetWriter()));
     SuccessOrExit(err);
     aAttributeDataElementBuilder.GetWriter()->EndContainer(type);
-    aAttributeDataElementBuilder.DataVersion(0).MoreClusterData(false).EndOfAttributeDataElement();
+    // The clusters the data model keeps no version of are reported with version 0, which the initiator is not to filter on.
+    GetClusterDataVersion(aClusterInfo.mAttributePathParams.mEndpointId, aClusterInfo.mAttributePathParams.mClusterId,
+                          dataVersion);
+    aAttributeDataElementBuilder.DataVersion(dataVersion).MoreClusterData(false).EndOfAttributeDataElement();
     err = aAttributeDataElementBuilder.GetError();
-    // TODO: Add DataVersion support
 
 exit:
     aClusterInfo.ClearDirty();
@@ -72,30 +90,259 @@ exit:
     return err;
 }
 
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+CHIP_ERROR Engine::RetrieveCachedClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo)
+{
+    CHIP_ERROR err                   = CHIP_NO_ERROR;
+    const AttributePathParams & path = aClusterInfo.mAttributePathParams;
+    ReportCacheEntry * entry         = nullptr;
+
+    for (auto & cacheEntry : mReportCache)
+    {
+        // The node id is part of the encoded path, so it is part of the key.
+        if (cacheEntry.mLength != 0 && cacheEntry.mPath.mNodeId == path.mNodeId &&
+            cacheEntry.mPath.mEndpointId == path.mEndpointId && cacheEntry.mPath.mClusterId == path.mClusterId &&
+            cacheEntry.mPath.mFieldId == path.mFieldId)
+        {
+            entry = &cacheEntry;
+            aClusterInfo.ClearDirty();
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        TLV::TLVWriter writer;
+        AttributeDataElement::Builder attributeDataElementBuilder;
+
+        entry                 = &mReportCache[mNextReportCacheEntry];
+        mNextReportCacheEntry = (mNextReportCacheEntry + 1) % CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES;
+        entry->mLength        = 0;
+
+        writer.Init(entry->mData, sizeof(entry->mData));
+        err = attributeDataElementBuilder.Init(&writer);
+        SuccessOrExit(err);
+        err = RetrieveClusterData(attributeDataElementBuilder, aClusterInfo);
+        if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            // Too large to cache: encode it in place.
+            AttributeDataElement::Builder & builder = aAttributeDataList.CreateAttributeDataElementBuilder();
+            aClusterInfo.SetDirty();
+            return RetrieveClusterData(builder, aClusterInfo);
+        }
+        SuccessOrExit(err);
+        err = writer.Finalize();
+        SuccessOrExit(err);
+
+        entry->mPath   = path;
+        entry->mLength = writer.GetLengthWritten();
+    }
+
+    err = aAttributeDataList.GetWriter()->CopyContainer(TLV::AnonymousTag, entry->mData, static_cast<uint16_t>(entry->mLength));
+
+exit:
+    return err;
+}
+
+void Engine::InvalidateReportCache(const AttributePathParams & aChanged)
+{
+    for (auto & cacheEntry : mReportCache)
+    {
+        if (cacheEntry.mLength != 0 && IsPathAffected(cacheEntry.mPath, aChanged))
+        {
+            cacheEntry.mLength = 0;
+        }
+    }
+}
+
+void Engine::ClearReportCache()
+{
+    for (auto & cacheEntry : mReportCache)
+    {
+        cacheEntry.mLength = 0;
+    }
+    mNextReportCacheEntry = 0;
+}
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+
+CHIP_ERROR Engine::AddClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo,
+                                  bool & aAttributeDataAdded, bool & aReportFull)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    // Copy the builder too, since a failure to start an element sets its error.
+    AttributeDataList::Builder attributeDataListCheckpoint = aAttributeDataList;
+    TLV::TLVWriter checkpoint;
+
+    ChipLogDetail(DataManagement, "<RE:Run> Cluster %u, Field %u is dirty", aClusterInfo.mAttributePathParams.mClusterId,
+                  aClusterInfo.mAttributePathParams.mFieldId);
+    aAttributeDataList.Checkpoint(checkpoint);
+    // Retrieve data for this cluster instance and clear its dirty flag.
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    err = RetrieveCachedClusterData(aAttributeDataList, aClusterInfo);
+#else
+    AttributeDataElement::Builder attributeDataElementBuilder = aAttributeDataList.CreateAttributeDataElementBuilder();
+    err = RetrieveClusterData(attributeDataElementBuilder, aClusterInfo);
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    if (err == CHIP_NO_ERROR && aAttributeDataList.GetWriter()->GetRemainingFreeLength() < kReservedSizeForEndOfReportData)
+    {
+        err = CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    if ((err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY) && aAttributeDataAdded)
+    {
+        // The report is full: drop the partial element and send this path in the next chunk.
+        aAttributeDataList = attributeDataListCheckpoint;
+        aAttributeDataList.Rollback(checkpoint);
+        aClusterInfo.SetDirty();
+        aReportFull = true;
+        return CHIP_NO_ERROR;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting");
+        return err;
+    }
+    aAttributeDataAdded = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Engine::AddWildcardClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo,
+                                          bool & aAttributeDataAdded, bool & aReportFull)
+{
+    AttributePathParams path;
+
+    // The concrete paths are visited one at a time, from where the previous chunk stopped.
+    while (ExpandAttributePath(aClusterInfo.mAttributePathParams, aClusterInfo.mCursor, path))
+    {
+        ClusterInfo concreteClusterInfo(path, true);
+
+        ReturnErrorOnFailure(AddClusterData(aAttributeDataList, concreteClusterInfo, aAttributeDataAdded, aReportFull));
+        if (aReportFull)
+        {
+            return CHIP_NO_ERROR;
+        }
+        aClusterInfo.mCursor.mAttributeIndex++;
+    }
+
+    aClusterInfo.ClearDirty();
+    aClusterInfo.mCursor = AttributePathCursor();
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler)
 {
     CHIP_ERROR err                               = CHIP_NO_ERROR;
-    ClusterInfo * clusterInfo                    = apReadHandler->GetCluterInfolist();
+    ClusterInfo * clusterInfo                    = apReadHandler->GetChunkCursor();
+    bool attributeDataAdded                      = false;
+    bool reportFull                              = false;
     AttributeDataList::Builder attributeDataList = reportDataBuilder.CreateAttributeDataListBuilder();
-    SuccessOrExit(reportDataBuilder.GetError());
-    // TODO: Need to handle multiple chunk of message
+    SuccessOrExit(err = reportDataBuilder.GetError());
+
+    // A new report starts from the head of the list.
+    if (clusterInfo == nullptr)
+    {
+        clusterInfo = apReadHandler->GetCluterInfolist();
+    }
+
     while (clusterInfo != nullptr)
     {
+        if (clusterInfo->IsDirty() && clusterInfo->mHasDataVersion)
+        {
+            // The initiator's version only filters the first report of the path: a later change bumps the version anyway.
+            DataVersion dataVersion      = 0;
+            clusterInfo->mHasDataVersion = false;
+            if (GetClusterDataVersion(clusterInfo->mAttributePathParams.mEndpointId, clusterInfo->mAttributePathParams.mClusterId,
+                                      dataVersion) &&
+                dataVersion == clusterInfo->mDataVersion)
+            {
+                ChipLogDetail(DataManagement, "<RE:Run> Cluster %u is unchanged since the initiator's version, skipped",
+                              clusterInfo->mAttributePathParams.mClusterId);
+                clusterInfo->ClearDirty();
+                clusterInfo->mCursor = AttributePathCursor();
+            }
+        }
+
         if (clusterInfo->IsDirty())
         {
-            AttributeDataElement::Builder attributeDataElementBuilder = attributeDataList.CreateAttributeDataElementBuilder();
-            ChipLogDetail(DataManagement, "<RE:Run> Cluster %u, Field %u is dirty", clusterInfo->mAttributePathParams.mClusterId,
-                          clusterInfo->mAttributePathParams.mFieldId);
-            // Retrieve data for this cluster instance and clear its dirty flag.
-            err = RetrieveClusterData(attributeDataElementBuilder, *clusterInfo);
-            VerifyOrExit(err == CHIP_NO_ERROR,
-                         ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
+            if (clusterInfo->mAttributePathParams.HasWildcard())
+            {
+                err = AddWildcardClusterData(attributeDataList, *clusterInfo, attributeDataAdded, reportFull);
+            }
+            else
+            {
+                err = AddClusterData(attributeDataList, *clusterInfo, attributeDataAdded, reportFull);
+            }
+            SuccessOrExit(err);
+            if (reportFull)
+            {
+                break;
+            }
         }
 
         clusterInfo = clusterInfo->mpNext;
     }
 
+    apReadHandler->SetChunkCursor(clusterInfo);
+    attributeDataList.EndOfAttributeDataList();
+    err = attributeDataList.GetError();
+
+exit:
+    ChipLogFunctError(err);
+    return err;
+}
+
+CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportDataBuilder, ReadHandler * apReadHandler,
+                                                  bool aAttributeDataAdded, bool & aEventDataAdded)
+{
+    CHIP_ERROR err                           = CHIP_NO_ERROR;
+    EventManagement & eventManager           = EventManagement::GetInstance();
+    bool moreEvents                          = false;
+    uint32_t lengthWritten                   = 0;
+    ReportData::Builder reportDataCheckpoint = aReportDataBuilder;
+    TLV::TLVWriter checkpoint;
+
+    aEventDataAdded = false;
+    aReportDataBuilder.Checkpoint(checkpoint);
+    VerifyOrExit(apReadHandler->GetEventPathCount() > 0 && eventManager.IsValid(), err = CHIP_NO_ERROR);
+
+    {
+        EventList::Builder & eventList = aReportDataBuilder.CreateEventDataListBuilder();
+        SuccessOrExit(err = aReportDataBuilder.GetError());
+        lengthWritten = eventList.GetWriter()->GetLengthWritten();
+
+        // The events are copied straight from the event buffers into the report. The alarms go first, so that a burst of
+        // events of lesser priority does not hold them back to a later chunk.
+        for (int priority = static_cast<int>(PriorityLevel::Last);
+             priority >= static_cast<int>(apReadHandler->GetMinEventPriority()); priority--)
+        {
+            const PriorityLevel priorityLevel = static_cast<PriorityLevel>(priority);
+
+            err = eventManager.FetchEventsSince(*eventList.GetWriter(), priorityLevel,
+                                                apReadHandler->GetNextEventNumber(priorityLevel), apReadHandler->GetEventPaths(),
+                                                apReadHandler->GetEventPathCount(), kReservedSizeForEndOfReportData);
+            if (err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY)
+            {
+                err        = CHIP_NO_ERROR;
+                moreEvents = true;
+                break;
+            }
+            SuccessOrExit(err);
+        }
+
+        aEventDataAdded = eventList.GetWriter()->GetLengthWritten() != lengthWritten;
+        eventList.EndOfEventList();
+        err = eventList.GetError();
+    }
+
 exit:
+    if (err == CHIP_NO_ERROR && !aEventDataAdded)
+    {
+        // An event that does not fit in an empty report is never sent.
+        VerifyOrReturnError(!moreEvents || aAttributeDataAdded, CHIP_ERROR_BUFFER_TOO_SMALL);
+        aReportDataBuilder = reportDataCheckpoint;
+        aReportDataBuilder.Rollback(checkpoint);
+    }
+    apReadHandler->SetMoreChunkedEvents(err == CHIP_NO_ERROR && moreEvents);
     ChipLogFunctError(err);
     return err;
 }
@@ -105,7 +352,11 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportData::Builder reportDataBuilder;
-    chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    chip::System::PacketBufferHandle bufHandle =
+        System::PacketBufferHandle::New(GetMaxSecureSduLength(apReadHandler->GetExchangeContext()));
+    bool moreChunkedMessages                   = false;
+    const bool attributeDataAdded              = apReadHandler->HasDirtyPaths();
+    bool eventDataAdded                        = false;
 
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
@@ -117,15 +368,27 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 
     err = BuildSingleReportDataAttributeDataList(reportDataBuilder, apReadHandler);
     SuccessOrExit(err);
-    // TODO: Fill in the EventList.
-    // err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler);
-    // SuccessOrExit(err);
+
+    // The events only go in once every dirty path is reported, in the room the attribute data leaves.
+    if (apReadHandler->GetChunkCursor() == nullptr)
+    {
+        err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler, attributeDataAdded, eventDataAdded);
+        SuccessOrExit(err);
+    }
+
+    // The events logged may all have been off the paths of the subscription.
+    if (apReadHandler->IsSubscription() && apReadHandler->HasSentReport() && !attributeDataAdded && !eventDataAdded)
+    {
+        ChipLogDetail(DataManagement, "<RE> Nothing to report to subscription %u", mCurReadHandlerIdx);
+        apReadHandler->OnNothingToReport();
+        ExitNow();
+    }
 
     // TODO: Add mechanism to set mSuppressResponse to handle status reports for multiple reports
-    // TODO: Add more chunk message support, currently mMoreChunkedMessages is always false.
-    if (mMoreChunkedMessages)
+    moreChunkedMessages = apReadHandler->IsChunkedReportInProgress();
+    if (moreChunkedMessages)
     {
-        reportDataBuilder.MoreChunkedMessages(mMoreChunkedMessages);
+        reportDataBuilder.MoreChunkedMessages(moreChunkedMessages);
     }
 
     reportDataBuilder.EndOfReportData();
@@ -152,20 +415,23 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 #endif // CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
 
     ChipLogDetail(DataManagement, "<RE> Sending report...");
+    SYSTEM_STATS_COUNT(System::Stats::kInteractionModel_NumReportsSent);
+    SYSTEM_STATS_COUNT_BY_N(System::Stats::kInteractionModel_NumReportBytes, bufHandle->TotalLength());
     err = SendReport(apReadHandler, std::move(bufHandle));
     VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(DataManagement, "<RE> Error sending out report data with %d!", err));
 
     ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %u with readHandler %u, RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, mMoreChunkedMessages ? "more messages" : "no more messages");
+                  mCurReadHandlerIdx, moreChunkedMessages ? "more messages" : "no more messages");
 
-    if (!mMoreChunkedMessages)
+    // A chunk, or a report to a subscription, stays in flight until the read handler gets its status report.
+    if (!moreChunkedMessages && !apReadHandler->IsSubscription())
     {
         OnReportConfirm();
     }
 
 exit:
     ChipLogFunctError(err);
-    if (!mMoreChunkedMessages || err != CHIP_NO_ERROR)
+    if ((!moreChunkedMessages && !apReadHandler->IsSubscription()) || err != CHIP_NO_ERROR)
     {
         apReadHandler->Shutdown();
     }
@@ -175,19 +441,46 @@ exit:
 void Engine::Run(System::Layer * aSystemLayer, void * apAppState, System::Error)
 {
     Engine * const pEngine = reinterpret_cast<Engine *>(apAppState);
+    pEngine->mRunScheduled = false;
     pEngine->Run();
 }
 
 CHIP_ERROR Engine::ScheduleRun()
 {
-    if (InteractionModelEngine::GetInstance()->GetExchangeManager() != nullptr)
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    uint64_t runTimeMs   = GetNextReportTimeMs();
+    const uint64_t nowMs = System::Layer::GetClock_MonotonicMS();
+    System::Layer * systemLayer;
+
+    VerifyOrExit(InteractionModelEngine::GetInstance()->GetExchangeManager() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    systemLayer = InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionMgr()->SystemLayer();
+
+    // The node is awake now, but a report due later can wait for the next time it wakes anyway, e.g. for the data poll
+    // of a sleepy end device, instead of waking it on its own.
+    if (runTimeMs > nowMs)
     {
-        return InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionMgr()->SystemLayer()->ScheduleWork(Run, this);
+        runTimeMs = systemLayer->AlignWakeTime(runTimeMs, CHIP_CONFIG_IM_REPORT_WAKE_SLACK_MS);
+    }
+
+    // A run scheduled no later than needed covers this request too, so bursts of changes wake the engine once.
+    VerifyOrExit(!mRunScheduled || mScheduledRunTimeMs > runTimeMs, err = CHIP_NO_ERROR);
+    systemLayer->CancelTimer(Run, this);
+
+    if (runTimeMs <= nowMs)
+    {
+        err = systemLayer->ScheduleWork(Run, this);
     }
     else
     {
-        return CHIP_ERROR_INCORRECT_STATE;
+        err = systemLayer->StartTimer(static_cast<uint32_t>(std::min<uint64_t>(runTimeMs - nowMs, UINT32_MAX)), Run, this);
     }
+    SuccessOrExit(err);
+
+    mRunScheduled       = true;
+    mScheduledRunTimeMs = std::max(runTimeMs, nowMs);
+
+exit:
+    return err;
 }
 
 void Engine::Run()
@@ -195,20 +488,46 @@ void Engine::Run()
     uint32_t numReadHandled = 0;
 
     InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
-    ReadHandler * readHandler         = imEngine->mReadHandlers + mCurReadHandlerIdx;
+    const size_t numReadHandlers      = imEngine->mReadHandlers.Created();
+    const uint64_t nowMs              = System::Layer::GetClock_MonotonicMS();
 
-    while ((mNumReportsInFlight < CHIP_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < CHIP_MAX_NUM_READ_HANDLER))
+    while ((mNumReportsInFlight < CHIP_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < numReadHandlers))
     {
-        if (readHandler->IsReportable())
+        // Read handlers may have been created since the last run.
+        if (mCurReadHandlerIdx >= numReadHandlers)
+        {
+            mCurReadHandlerIdx = 0;
+        }
+        ReadHandler * readHandler = imEngine->mReadHandlers.At(mCurReadHandlerIdx);
+
+        // Handlers within their minimum report interval keep accumulating changes.
+        if (readHandler->IsReportable() && readHandler->GetNextReportTimeMs() <= nowMs)
         {
             CHIP_ERROR err = BuildAndSendSingleReportData(readHandler);
             ChipLogFunctError(err);
-            return;
+            break;
         }
         numReadHandled++;
-        mCurReadHandlerIdx = (mCurReadHandlerIdx + 1) % CHIP_MAX_NUM_READ_HANDLER;
-        readHandler        = imEngine->mReadHandlers + mCurReadHandlerIdx;
+        mCurReadHandlerIdx++;
+    }
+
+    // Each run sends a single report, so come back for the other handlers once the earliest of them is due. A full window
+    // of reports in flight is reopened by the next report confirmation instead.
+    if (HasReportableHandler())
+    {
+        if (mNumReportsInFlight < CHIP_MAX_REPORTS_IN_FLIGHT)
+        {
+            CHIP_ERROR err = ScheduleRun();
+            ChipLogFunctError(err);
+        }
+    }
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    else
+    {
+        // Encodings are only shared within a round.
+        ClearReportCache();
     }
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
 }
 
 CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload)
@@ -227,6 +546,109 @@ CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferH
     return err;
 }
 
+bool Engine::IsPathAffected(const AttributePathParams & aInterest, const AttributePathParams & aChanged)
+{
+    // A path with the root field id covers every attribute of the cluster, including those whose ids do not fit in a field id.
+    return (aInterest.mFlags.Has(AttributePathFlags::kEndpointIdWildcard) || aInterest.mEndpointId == aChanged.mEndpointId) &&
+        (aInterest.mFlags.Has(AttributePathFlags::kClusterIdWildcard) || aInterest.mClusterId == aChanged.mClusterId) &&
+        (aInterest.mFlags.Has(AttributePathFlags::kFieldIdWildcard) || aInterest.mFieldId == kRootFieldId ||
+         (aChanged.mFlags.Has(AttributePathFlags::kFieldIdValid) && aInterest.mFieldId == aChanged.mFieldId));
+}
+
+uint64_t Engine::GetNextReportTimeMs()
+{
+    uint64_t nextReportTimeMs = std::numeric_limits<uint64_t>::max();
+    bool reportable           = false;
+
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachObject([&](ReadHandler & readHandler) {
+        if (readHandler.IsReportable())
+        {
+            nextReportTimeMs = std::min(nextReportTimeMs, readHandler.GetNextReportTimeMs());
+            reportable       = true;
+        }
+    });
+
+    return reportable ? nextReportTimeMs : 0;
+}
+
+bool Engine::HasReportableHandler()
+{
+    bool reportable = false;
+
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachObject(
+        [&reportable](ReadHandler & readHandler) { reportable = reportable || readHandler.IsReportable(); });
+
+    return reportable;
+}
+
+bool Engine::MarkDirty(ReadHandler * apReadHandler, const ClusterInfo & aClusterInfo)
+{
+    bool marked = false;
+
+    for (ClusterInfo * clusterInfo = apReadHandler->GetCluterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        if (IsPathAffected(clusterInfo->mAttributePathParams, aClusterInfo.mAttributePathParams))
+        {
+            clusterInfo->SetDirty();
+            marked = true;
+        }
+    }
+
+    return marked;
+}
+
+CHIP_ERROR Engine::SetDirty(ClusterInfo & aClusterInfo)
+{
+    bool marked = false;
+
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    InvalidateReportCache(aClusterInfo.mAttributePathParams);
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachObject([&marked, &aClusterInfo](ReadHandler & readHandler) {
+        if (!readHandler.IsFree() && MarkDirty(&readHandler, aClusterInfo))
+        {
+            readHandler.MarkReportable(false);
+            marked = true;
+        }
+    });
+
+    VerifyOrReturnError(marked, CHIP_NO_ERROR);
+    if (mBatchDepth > 0)
+    {
+        mBatchRunPending = true;
+        return CHIP_NO_ERROR;
+    }
+    return ScheduleRun();
+}
+
+CHIP_ERROR Engine::EndBatch()
+{
+    VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    mBatchDepth--;
+    VerifyOrReturnError(mBatchDepth == 0 && mBatchRunPending, CHIP_NO_ERROR);
+
+    mBatchRunPending = false;
+    return ScheduleRun();
+}
+
+CHIP_ERROR Engine::ScheduleEventDelivery(bool aUrgent)
+{
+    bool marked = false;
+
+    // A handler awaiting a report response checks for events again once it gets the response.
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachObject([&marked, aUrgent](ReadHandler & readHandler) {
+        if (readHandler.IsSubscription() && !readHandler.IsFree() && readHandler.HasEventsPending())
+        {
+            readHandler.MarkReportable(aUrgent);
+            marked = marked || readHandler.IsReportable();
+        }
+    });
+
+    return marked ? ScheduleRun() : CHIP_NO_ERROR;
+}
+
 void Engine::OnReportConfirm()
 {
     VerifyOrDie(mNumReportsInFlight > 0);
@@ -238,3 +660,36 @@ void Engine::OnReportConfirm()
 }; // namespace reporting
 }; // namespace app
 }; // namespace chip
+
+void InteractionModelReportingAttributeChangeCallback(chip::EndpointId aEndpointId, chip::ClusterId aClusterId,
+                                                      chip::AttributeId aAttributeId)
+{
+    chip::app::ClusterInfo info;
+    info.mAttributePathParams.mEndpointId = aEndpointId;
+    info.mAttributePathParams.mClusterId  = aClusterId;
+    if (aAttributeId <= std::numeric_limits<chip::FieldId>::max())
+    {
+        info.mAttributePathParams.mFieldId = static_cast<chip::FieldId>(aAttributeId);
+        info.mAttributePathParams.mFlags.Set(chip::app::AttributePathFlags::kFieldIdValid);
+    }
+
+    CHIP_ERROR err = chip::app::InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(info);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Error marking attribute %u of cluster %u dirty, err = %d", aAttributeId, aClusterId, err);
+    }
+}
+
+void InteractionModelReportingBeginBatch()
+{
+    chip::app::InteractionModelEngine::GetInstance()->GetReportingEngine().BeginBatch();
+}
+
+void InteractionModelReportingEndBatch()
+{
+    CHIP_ERROR err = chip::app::InteractionModelEngine::GetInstance()->GetReportingEngine().EndBatch();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Error scheduling the report of a batch of attribute changes, err = %d", err);
+    }
+}
@@ -66,10 +66,52 @@ public:
     void Run();
 
     /**
-     * Main work-horse function that executes the run-loop asynchronously on the CHIP thread
+     * Main work-horse function that executes the run-loop asynchronously on the CHIP thread, once the earliest read handler
+     * with a report pending is out of its minimum report interval.  Does nothing if a run is already scheduled by then.
      */
     CHIP_ERROR ScheduleRun();
 
+    /**
+     * Marks the attribute in aClusterInfo as changed in every read handler whose path covers it, so that the next run of
+     * the engine reports it, and schedules that run if any handler is affected.  Paths that have not changed are left
+     * clean and are not encoded again.
+     *
+     * @retval #CHIP_NO_ERROR On success, including when no read handler covers the attribute.
+     * @retval other           The run could not be scheduled.
+     */
+    CHIP_ERROR SetDirty(ClusterInfo & aClusterInfo);
+
+    /**
+     * Holds back the runs SetDirty() schedules until the matching EndBatch(), for a burst of attribute changes to be
+     * reported by one run rather than have the engine rescheduled for each.  Batches nest; the outermost one schedules.
+     */
+    void BeginBatch() { mBatchDepth++; }
+
+    /**
+     * Ends a batch started by BeginBatch(), scheduling the run held back by it once the outermost batch ends.
+     *
+     * @retval #CHIP_NO_ERROR On success, including when no change of the batch is reported.
+     * @retval other           The run could not be scheduled.
+     */
+    CHIP_ERROR EndBatch();
+
+    /**
+     * Makes reportable every subscription with events of interest logged since its last report, and schedules the run
+     * reporting them. The events logged until a subscription is out of its minimum report interval are batched into its
+     * next report, unless aUrgent, which has them reported right away.
+     *
+     * @retval #CHIP_NO_ERROR On success, including when no subscription has events to report.
+     * @retval other           The run could not be scheduled.
+     */
+    CHIP_ERROR ScheduleEventDelivery(bool aUrgent);
+
+    /**
+     * Should be invoked when the device receives a Status report, or when the Report data request times out.
+     * This allows the engine to do some clean-up.
+     *
+     */
+    void OnReportConfirm();
+
 private:
     friend class TestReportingEngine;
     /**
@@ -78,33 +120,87 @@ private:
      */
     CHIP_ERROR BuildAndSendSingleReportData(ReadHandler * apReadHandler);
 
+    /**
+     * Add the dirty paths of apReadHandler to the report, starting from its chunk cursor, for as long as they fit. The cursor
+     * is left on the first path that did not fit, which the next chunk starts from, or cleared once every path is reported.
+     *
+     * @retval #CHIP_NO_ERROR On success, including when not every path fits.
+     * @retval other           A path could not be encoded, or does not fit in an empty report.
+     */
     CHIP_ERROR BuildSingleReportDataAttributeDataList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler);
 
-    CHIP_ERROR RetrieveClusterData(AttributeDataElement::Builder & aAttributeDataElementBuilder, ClusterInfo & aClusterInfo);
     /**
-     * Send Report via ReadHandler
+     * Add the events of interest to apReadHandler logged since its last report to the report, most important priority first,
+     * copying them from the event buffers for as long as they fit. The rest is left for the next chunk. The event list is
+     * left out if no event is added (aEventDataAdded is cleared).
      *
+     * @retval #CHIP_NO_ERROR On success, including when not every event fits.
+     * @retval other           The events could not be copied, or an event does not fit in an empty report.
      */
-    CHIP_ERROR SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload);
+    CHIP_ERROR BuildSingleReportDataEventList(ReportData::Builder & aReportDataBuilder, ReadHandler * apReadHandler,
+                                              bool aAttributeDataAdded, bool & aEventDataAdded);
 
     /**
-     * Should be invoked when the device receives a Status report, or when the Report data request times out.
-     * This allows the engine to do some clean-up.
-     *
+     * Add the data of the concrete path of aClusterInfo to the report. If it does not fit in a report that already has data
+     * (aAttributeDataAdded), aReportFull is set and the path stays dirty; otherwise aAttributeDataAdded is set.
      */
-    void OnReportConfirm();
+    CHIP_ERROR AddClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo,
+                              bool & aAttributeDataAdded, bool & aReportFull);
 
     /**
-     * Generate and send the report data request when there exists subscription or read request
+     * Add the data of the concrete paths covered by the wildcard path of aClusterInfo to the report, expanding it over the
+     * data model from its cursor on. The cursor is left on the first path that did not fit, or reset once every path is
+     * reported, which clears aClusterInfo.
+     */
+    CHIP_ERROR AddWildcardClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo,
+                                      bool & aAttributeDataAdded, bool & aReportFull);
+
+    CHIP_ERROR RetrieveClusterData(AttributeDataElement::Builder & aAttributeDataElementBuilder, ClusterInfo & aClusterInfo);
+
+    /**
+     * Returns true if a change to the attribute in aChanged affects the data reported for the path aInterest.
+     */
+    static bool IsPathAffected(const AttributePathParams & aInterest, const AttributePathParams & aChanged);
+
+    /**
+     * Returns true if any read handler has a report pending.
+     */
+    static bool HasReportableHandler();
+
+    /**
+     * Returns the earliest monotonic time in milliseconds at which a read handler with a report pending may send it, or 0
+     * if no handler has a report pending.
+     */
+    static uint64_t GetNextReportTimeMs();
+
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    /**
+     * Add the attribute data element for aClusterInfo to aAttributeDataList, copying it from the report cache if another
+     * read handler reported the same path in this round, or encoding it and caching the encoding otherwise.
+     */
+    CHIP_ERROR RetrieveCachedClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo);
+
+    void InvalidateReportCache(const AttributePathParams & aChanged);
+    void ClearReportCache();
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+
+    /**
+     * Marks dirty the paths of apReadHandler that cover the attribute in aClusterInfo.
      *
+     * @return true if any path was marked.
      */
-    static void Run(System::Layer * aSystemLayer, void * apAppState, System::Error);
+    static bool MarkDirty(ReadHandler * apReadHandler, const ClusterInfo & aClusterInfo);
+    /**
+     * Send Report via ReadHandler
+     *
+     */
+    CHIP_ERROR SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload);
 
     /**
-     * Boolean to show if more chunk message on the way
+     * Generate and send the report data request when there exists subscription or read request
      *
      */
-    bool mMoreChunkedMessages = false;
+    static void Run(System::Layer * aSystemLayer, void * apAppState, System::Error);
 
     /**
      * The number of report date request in flight
@@ -117,8 +213,50 @@ private:
      *
      */
     uint32_t mCurReadHandlerIdx = 0;
+
+    /**
+     *  Whether a run is pending on the system layer, and the monotonic time in milliseconds it is due at
+     *
+     */
+    bool mRunScheduled           = false;
+    uint64_t mScheduledRunTimeMs = 0;
+
+    /**
+     *  Depth of the batches of changes in progress, and whether a change within them has a run to schedule
+     *
+     */
+    uint32_t mBatchDepth  = 0;
+    bool mBatchRunPending = false;
+
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    struct ReportCacheEntry
+    {
+        AttributePathParams mPath;
+        uint32_t mLength = 0; //< Length of the encoded element in mData, 0 if the entry is unused
+        uint8_t mData[CHIP_CONFIG_IM_REPORT_CACHE_ENTRY_SIZE];
+    };
+
+    /**
+     *  Encoded attribute data elements, reused round-robin
+     *
+     */
+    ReportCacheEntry mReportCache[CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES];
+    size_t mNextReportCacheEntry = 0;
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
 };
 
 }; // namespace reporting
 }; // namespace app
 }; // namespace chip
+
+/**
+ * Called by the attribute store when the value of an attribute changes, to feed the reporting engine's dirty tracking.
+ */
+void InteractionModelReportingAttributeChangeCallback(chip::EndpointId aEndpointId, chip::ClusterId aClusterId,
+                                                      chip::AttributeId aAttributeId);
+
+/**
+ * Called by the attribute store around a bulk update of attributes, for the reporting engine to report their changes in one run.
+ */
+void InteractionModelReportingBeginBatch();
+void InteractionModelReportingEndBatch();
@@ -48,6 +48,8 @@
 #include <support/SafeInt.h>
 #include <system/SystemLayer.h>
 
+#include <algorithm>
+
 #include "gen/attribute-type.h"
 #include "gen/cluster-id.h"
 #include "gen/command-id.h"
@@ -77,6 +79,11 @@ static void putReportableChangeInResp(const EmberAfPluginReportingEntry * entry,
 static void retrySendReport(EmberOutgoingMessageType type, MessageSendDestination destination, EmberApsFrame * apsFrame,
                             uint16_t msgLen, uint8_t * message, EmberStatus status);
 static uint32_t computeStringHash(uint8_t * data, uint8_t length);
+static void buildReportIndex(void);
+static uint8_t findReportingEntry(const EmberAfPluginReportingEntry * key, EmberAfPluginReportingEntry * entry);
+static uint8_t findUnusedReportingEntry(void);
+static void removeDeadline(uint8_t index);
+static void updateDeadline(uint8_t index);
 
 EmberEventControl emberAfPluginReportingTickEventControl;
 
@@ -141,7 +148,7 @@ void emAfPluginReportingGetEntry(uint8_t index, EmberAfPluginReportingEntry * re
     memmove(result, &table[index], sizeof(EmberAfPluginReportingEntry));
 #endif
 }
-void emAfPluginReportingSetEntry(uint8_t index, EmberAfPluginReportingEntry * value)
+static void storeEntry(uint8_t index, EmberAfPluginReportingEntry * value)
 {
 #if REPORT_TABLE_SIZE != 0
     memmove(&table[index], value, sizeof(EmberAfPluginReportingEntry));
@@ -155,12 +162,262 @@ void emAfPluginReportingGetEntry(uint8_t index, EmberAfPluginReportingEntry * re
     result->endpoint = EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID;
     halCommonGetIndexedToken(result, TOKEN_REPORT_TABLE, index);
 }
-void emAfPluginReportingSetEntry(uint8_t index, EmberAfPluginReportingEntry * value)
+static void storeEntry(uint8_t index, EmberAfPluginReportingEntry * value)
 {
     halCommonSetIndexedToken(TOKEN_REPORT_TABLE, index, value);
 }
 #endif
 
+//------------------------------------------------------------------------------
+// Report index
+//
+// The used entries of the table are hashed by endpoint, cluster, attribute and
+// direction, so that the entry of an attribute is found without walking the
+// table, and the reported entries that are to be sent at some point are kept in
+// a min-heap by the time they are due, so that ticks only look at the entries
+// to send.  Both are built from the table on first use and kept up to date by
+// emAfPluginReportingSetEntry() and wherever emAfPluginReportVolatileData
+// changes.
+
+#ifndef REPORT_INDEX_BUCKET_COUNT
+#define REPORT_INDEX_BUCKET_COUNT REPORT_TABLE_SIZE
+#endif
+
+static bool reportIndexBuilt = false;
+// First entry of each bucket, and next entry in the bucket of each entry, or NULL_INDEX.
+static uint8_t reportIndexBuckets[REPORT_INDEX_BUCKET_COUNT];
+static uint8_t reportIndexNext[REPORT_TABLE_SIZE];
+// Bucket of each entry, or NULL_INDEX if it is not indexed.
+static uint8_t reportIndexBucketOf[REPORT_TABLE_SIZE];
+
+// Min-heap of entries by deadline, the time at which they are due to be sent.
+static uint8_t deadlineHeap[REPORT_TABLE_SIZE];
+static uint8_t deadlineHeapCount = 0;
+// Position of each entry in deadlineHeap, or NULL_INDEX.
+static uint8_t deadlineHeapPosition[REPORT_TABLE_SIZE];
+static uint32_t deadlineMs[REPORT_TABLE_SIZE];
+
+// Depth of the batches of attribute changes in progress, during which the tick
+// is not scheduled.
+static uint8_t reportBatchDepth = 0;
+
+static uint8_t reportIndexBucket(const EmberAfPluginReportingEntry * entry)
+{
+    uint8_t key[sizeof(entry->endpoint) + sizeof(entry->clusterId) + sizeof(entry->attributeId) + 1];
+    uint8_t * p = key;
+
+    memcpy(p, &entry->endpoint, sizeof(entry->endpoint));
+    p += sizeof(entry->endpoint);
+    memcpy(p, &entry->clusterId, sizeof(entry->clusterId));
+    p += sizeof(entry->clusterId);
+    memcpy(p, &entry->attributeId, sizeof(entry->attributeId));
+    p += sizeof(entry->attributeId);
+    *p = static_cast<uint8_t>(entry->direction);
+
+    return static_cast<uint8_t>(computeStringHash(key, sizeof(key)) % REPORT_INDEX_BUCKET_COUNT);
+}
+
+static void linkReportIndexEntry(uint8_t index, const EmberAfPluginReportingEntry * entry)
+{
+    if (entry->endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID)
+    {
+        return;
+    }
+
+    uint8_t bucket             = reportIndexBucket(entry);
+    reportIndexNext[index]     = reportIndexBuckets[bucket];
+    reportIndexBuckets[bucket] = index;
+    reportIndexBucketOf[index] = bucket;
+}
+
+static void unlinkReportIndexEntry(uint8_t index)
+{
+    if (reportIndexBucketOf[index] == NULL_INDEX)
+    {
+        return;
+    }
+
+    uint8_t * link = &reportIndexBuckets[reportIndexBucketOf[index]];
+    while (*link != index)
+    {
+        link = &reportIndexNext[*link];
+    }
+    *link                      = reportIndexNext[index];
+    reportIndexBucketOf[index] = NULL_INDEX;
+}
+
+static void buildReportIndex(void)
+{
+    memset(reportIndexBuckets, NULL_INDEX, sizeof(reportIndexBuckets));
+    memset(reportIndexBucketOf, NULL_INDEX, sizeof(reportIndexBucketOf));
+    memset(deadlineHeapPosition, NULL_INDEX, sizeof(deadlineHeapPosition));
+    deadlineHeapCount = 0;
+    reportIndexBuilt  = true;
+
+    for (uint8_t i = 0; i < REPORT_TABLE_SIZE; i++)
+    {
+        EmberAfPluginReportingEntry entry;
+        emAfPluginReportingGetEntry(i, &entry);
+        linkReportIndexEntry(i, &entry);
+        updateDeadline(i);
+    }
+}
+
+// Returns the index of the used entry matching key, read into entry, or NULL_INDEX.
+static uint8_t findReportingEntry(const EmberAfPluginReportingEntry * key, EmberAfPluginReportingEntry * entry)
+{
+    if (!reportIndexBuilt)
+    {
+        buildReportIndex();
+    }
+
+    for (uint8_t i = reportIndexBuckets[reportIndexBucket(key)]; i != NULL_INDEX; i = reportIndexNext[i])
+    {
+        emAfPluginReportingGetEntry(i, entry);
+        if (emAfPluginReportingDoEntriesMatch(entry, key))
+        {
+            return i;
+        }
+    }
+    return NULL_INDEX;
+}
+
+// Returns the index of the lowest unused entry, or NULL_INDEX if the table is full.
+static uint8_t findUnusedReportingEntry(void)
+{
+    if (!reportIndexBuilt)
+    {
+        buildReportIndex();
+    }
+
+    for (uint8_t i = 0; i < REPORT_TABLE_SIZE; i++)
+    {
+        if (reportIndexBucketOf[i] == NULL_INDEX)
+        {
+            return i;
+        }
+    }
+    return NULL_INDEX;
+}
+
+static bool deadlineBefore(uint8_t a, uint8_t b)
+{
+    // Times wrap around with lastReportTimeMs, and deadlines are never more than 0xFFFF seconds apart.
+    return static_cast<int32_t>(deadlineMs[a] - deadlineMs[b]) < 0;
+}
+
+static void setDeadlineHeapEntry(uint8_t position, uint8_t index)
+{
+    deadlineHeap[position]      = index;
+    deadlineHeapPosition[index] = position;
+}
+
+static void siftDeadline(uint8_t position)
+{
+    uint8_t index = deadlineHeap[position];
+
+    while (position > 0 && deadlineBefore(index, deadlineHeap[(position - 1) / 2]))
+    {
+        uint8_t parent = static_cast<uint8_t>((position - 1) / 2);
+        setDeadlineHeapEntry(position, deadlineHeap[parent]);
+        position = parent;
+    }
+
+    for (;;)
+    {
+        uint16_t child = static_cast<uint16_t>(2 * position + 1);
+        if (child >= deadlineHeapCount)
+        {
+            break;
+        }
+        if (child + 1 < deadlineHeapCount && deadlineBefore(deadlineHeap[child + 1], deadlineHeap[child]))
+        {
+            child++;
+        }
+        if (!deadlineBefore(deadlineHeap[child], index))
+        {
+            break;
+        }
+        setDeadlineHeapEntry(position, deadlineHeap[child]);
+        position = static_cast<uint8_t>(child);
+    }
+
+    setDeadlineHeapEntry(position, index);
+}
+
+static void removeDeadline(uint8_t index)
+{
+    uint8_t position = deadlineHeapPosition[index];
+
+    if (position == NULL_INDEX)
+    {
+        return;
+    }
+
+    deadlineHeapPosition[index] = NULL_INDEX;
+    deadlineHeapCount--;
+    if (position != deadlineHeapCount)
+    {
+        setDeadlineHeapEntry(position, deadlineHeap[deadlineHeapCount]);
+        siftDeadline(position);
+    }
+}
+
+// Recomputes when the entry at index is due to be sent, after its configuration, last report or reportable change
+// changed: once the minimum interval has elapsed after a reportable change, or else once the maximum interval has.
+static void updateDeadline(uint8_t index)
+{
+    EmberAfPluginReportingEntry entry;
+    uint32_t intervalS;
+
+    if (!reportIndexBuilt)
+    {
+        return;
+    }
+
+    emAfPluginReportingGetEntry(index, &entry);
+    if (entry.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID || entry.direction != EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
+    {
+        removeDeadline(index);
+        return;
+    }
+
+    if (emAfPluginReportVolatileData[index].reportableChange)
+    {
+        intervalS = entry.data.reported.minInterval;
+    }
+    else if (entry.data.reported.maxInterval != 0)
+    {
+        intervalS = std::max(entry.data.reported.minInterval, entry.data.reported.maxInterval);
+    }
+    else
+    {
+        removeDeadline(index);
+        return;
+    }
+
+    deadlineMs[index] = emAfPluginReportVolatileData[index].lastReportTimeMs + intervalS * MILLISECOND_TICKS_PER_SECOND;
+    if (deadlineHeapPosition[index] == NULL_INDEX)
+    {
+        setDeadlineHeapEntry(deadlineHeapCount++, index);
+    }
+    siftDeadline(deadlineHeapPosition[index]);
+}
+
+void emAfPluginReportingSetEntry(uint8_t index, EmberAfPluginReportingEntry * value)
+{
+    storeEntry(index, value);
+
+    if (!reportIndexBuilt)
+    {
+        buildReportIndex();
+        return;
+    }
+    unlinkReportIndexEntry(index);
+    linkReportIndexEntry(index, value);
+    updateDeadline(index);
+}
+
 void emberAfPluginReportingStackStatusCallback(EmberStatus status)
 {
     if (status == EMBER_NETWORK_UP)
@@ -184,6 +441,7 @@ void emberAfPluginReportingInitCallback(void)
             entry.direction == EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
         {
             emAfPluginReportVolatileData[i].reportableChange = true;
+            updateDeadline(i);
         }
     }
 
@@ -200,16 +458,33 @@ void emberAfPluginReportingTickEventHandler(void)
     uint8_t i;
     uint16_t dataSize;
     bool clientToServer = false;
-    EmberBindingTableEntry bindingEntry;
     // reportSize needs to be able to fit a sum of dataSize and some other stuff
     // without overflowing.
     uint32_t reportSize;
     uint8_t index;
     uint16_t currentPayloadMaxLength = 0, smallestPayloadMaxLength = 0;
+    uint8_t due[REPORT_TABLE_SIZE];
+    uint8_t dueCount = 0;
+    uint32_t nowMs   = static_cast<uint32_t>(chip::System::Layer::GetClock_MonotonicMS());
 
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
+    if (!reportIndexBuilt)
+    {
+        buildReportIndex();
+    }
+
+    // Take the entries that are due out of the heap, and send them in table
+    // order, so that the attributes of a cluster still go in the same report.
+    while (deadlineHeapCount > 0 && static_cast<int32_t>(deadlineMs[deadlineHeap[0]] - nowMs) <= 0)
+    {
+        due[dueCount++] = deadlineHeap[0];
+        removeDeadline(deadlineHeap[0]);
+    }
+    std::sort(due, due + dueCount);
+
+    for (uint8_t d = 0; d < dueCount; d++)
     {
         EmberAfPluginReportingEntry entry;
+        i = due[d];
         // Not initializing entry.mask causes errors even if wrapped with GCC diagnostic ignored
         entry.mask = CLUSTER_MASK_SERVER;
         uint32_t elapsedMs;
@@ -287,17 +562,13 @@ void emberAfPluginReportingTickEventHandler(void)
 
             // find smallest maximum payload that the destination can receive for this cluster and source endpoint
             smallestPayloadMaxLength = MAX_INT8U_VALUE;
-            for (index = 0; index < EMBER_BINDING_TABLE_SIZE; index++)
+            for (index = emberFirstBindingIndex(entry.endpoint, entry.clusterId); index != EMBER_NULL_BINDING_INDEX;
+                 index = emberNextBindingIndex(index))
             {
-                status = (EmberAfStatus) emberGetBinding(index, &bindingEntry);
-                if (status == (EmberAfStatus) EMBER_SUCCESS && bindingEntry.local == entry.endpoint &&
-                    bindingEntry.clusterId == entry.clusterId)
+                currentPayloadMaxLength = EMBER_AF_RESPONSE_BUFFER_LEN;
+                if (currentPayloadMaxLength < smallestPayloadMaxLength)
                 {
-                    currentPayloadMaxLength = EMBER_AF_RESPONSE_BUFFER_LEN;
-                    if (currentPayloadMaxLength < smallestPayloadMaxLength)
-                    {
-                        smallestPayloadMaxLength = currentPayloadMaxLength;
-                    }
+                    smallestPayloadMaxLength = currentPayloadMaxLength;
                 }
             }
         }
@@ -357,6 +628,10 @@ void emberAfPluginReportingTickEventHandler(void)
     {
         conditionallySendReport(apsFrame->sourceEndpoint, apsFrame->clusterId);
     }
+    for (uint8_t d = 0; d < dueCount; d++)
+    {
+        updateDeadline(due[d]);
+    }
     scheduleTick();
 }
 
@@ -578,10 +853,8 @@ bool emberAfReadReportingConfigurationCommandCallback(const EmberAfClusterComman
     {
         AttributeId attributeId;
         EmberAfAttributeMetadata * metadata = NULL;
-        EmberAfPluginReportingEntry entry;
+        EmberAfPluginReportingEntry entry, key;
         EmberAfReportingDirection direction;
-        uint8_t i;
-        bool found = false;
 
         direction = (EmberAfReportingDirection) emberAfGetInt8u(cmd->buffer, bufIndex, cmd->bufLen);
         bufIndex++;
@@ -615,26 +888,16 @@ bool emberAfReadReportingConfigurationCommandCallback(const EmberAfClusterComman
         // CCB 1854 removes the ambiguity and requires NOT_FOUND to be returned in
         // the status field and all fields except direction and attribute identifier
         // to be omitted if there is no report configuration found.
-        for (i = 0; i < REPORT_TABLE_SIZE; i++)
-        {
-            emAfPluginReportingGetEntry(i, &entry);
-            if (entry.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID)
-            {
-                continue;
-            }
-            if (entry.direction == direction && entry.endpoint == cmd->apsFrame->destinationEndpoint &&
-                entry.clusterId == cmd->apsFrame->clusterId && entry.attributeId == attributeId && entry.mask == mask &&
-                entry.manufacturerCode == cmd->mfgCode &&
-                (entry.direction == EMBER_ZCL_REPORTING_DIRECTION_REPORTED ||
-                 (entry.data.received.source == cmd->SourceNodeId() &&
-                  entry.data.received.endpoint == cmd->apsFrame->sourceEndpoint)))
-            {
-                found = true;
-                break;
-            }
-        }
+        key.direction              = direction;
+        key.endpoint               = cmd->apsFrame->destinationEndpoint;
+        key.clusterId              = cmd->apsFrame->clusterId;
+        key.attributeId            = attributeId;
+        key.mask                   = mask;
+        key.manufacturerCode       = cmd->mfgCode;
+        key.data.received.source   = cmd->SourceNodeId();
+        key.data.received.endpoint = cmd->apsFrame->sourceEndpoint;
         // Attribute supported, reportable, no report configuration was found.
-        if (found == false)
+        if (key.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID || findReportingEntry(&key, &entry) == NULL_INDEX)
         {
             emberAfPutInt8uInResp(EMBER_ZCL_STATUS_NOT_FOUND);
             emberAfPutInt8uInResp(direction);
@@ -698,50 +961,88 @@ EmberStatus emAfPluginReportingRemoveEntry(uint8_t index)
 void emberAfReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, uint8_t mask,
                                              uint16_t manufacturerCode, EmberAfAttributeType type, uint8_t * data)
 {
+    EmberAfPluginReportingEntry entry, key;
     uint8_t i;
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
+
+    if (endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID)
     {
-        EmberAfPluginReportingEntry entry;
-        emAfPluginReportingGetEntry(i, &entry);
-        if (entry.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID)
-        {
-            continue;
-        }
-        if (entry.direction == EMBER_ZCL_REPORTING_DIRECTION_REPORTED && entry.endpoint == endpoint &&
-            entry.clusterId == clusterId && entry.attributeId == attributeId && entry.mask == mask &&
-            entry.manufacturerCode == manufacturerCode)
+        return;
+    }
+
+    key.direction        = EMBER_ZCL_REPORTING_DIRECTION_REPORTED;
+    key.endpoint         = endpoint;
+    key.clusterId        = clusterId;
+    key.attributeId      = attributeId;
+    key.mask             = mask;
+    key.manufacturerCode = manufacturerCode;
+    i                    = findReportingEntry(&key, &entry);
+    if (i == NULL_INDEX)
+    {
+        return;
+    }
+
+    // For CHAR and OCTET strings, the string value may be too long to fit into the
+    // lastReportValue field (EmberAfDifferenceType), so instead we save the string's
+    // hash, and detect changes in string value based on unequal hash.
+    uint32_t stringHash = 0;
+    uint8_t dataSize    = emberAfGetDataSize(type);
+    uint8_t * dataRef   = data;
+    if (type == ZCL_OCTET_STRING_ATTRIBUTE_TYPE || type == ZCL_CHAR_STRING_ATTRIBUTE_TYPE)
+    {
+        stringHash = computeStringHash(data + 1, emberAfStringLength(data));
+        dataRef    = (uint8_t *) &stringHash;
+        dataSize   = sizeof(stringHash);
+    }
+    // If we are reporting this particular attribute, we only care whether
+    // the new value meets the reportable change criteria.  If it does, we
+    // mark the entry as ready to report and reschedule the tick.  Whether
+    // the tick will be scheduled for immediate or delayed execution depends
+    // on the minimum reporting interval.  This is handled in the scheduler.
+    EmberAfDifferenceType difference = emberAfGetDifference(dataRef, emAfPluginReportVolatileData[i].lastReportValue, dataSize);
+    uint8_t analogOrDiscrete         = emberAfGetAttributeAnalogOrDiscreteType(type);
+    if ((analogOrDiscrete == EMBER_AF_DATA_TYPE_DISCRETE && difference != 0) ||
+        (analogOrDiscrete == EMBER_AF_DATA_TYPE_ANALOG && entry.data.reported.reportableChange <= difference))
+    {
+        emAfPluginReportVolatileData[i].reportableChange = true;
+        updateDeadline(i);
+        if (reportBatchDepth == 0)
         {
-            // For CHAR and OCTET strings, the string value may be too long to fit into the
-            // lastReportValue field (EmberAfDifferenceType), so instead we save the string's
-            // hash, and detect changes in string value based on unequal hash.
-            uint32_t stringHash = 0;
-            uint8_t dataSize    = emberAfGetDataSize(type);
-            uint8_t * dataRef   = data;
-            if (type == ZCL_OCTET_STRING_ATTRIBUTE_TYPE || type == ZCL_CHAR_STRING_ATTRIBUTE_TYPE)
-            {
-                stringHash = computeStringHash(data + 1, emberAfStringLength(data));
-                dataRef    = (uint8_t *) &stringHash;
-                dataSize   = sizeof(stringHash);
-            }
-            // If we are reporting this particular attribute, we only care whether
-            // the new value meets the reportable change criteria.  If it does, we
-            // mark the entry as ready to report and reschedule the tick.  Whether
-            // the tick will be scheduled for immediate or delayed execution depends
-            // on the minimum reporting interval.  This is handled in the scheduler.
-            EmberAfDifferenceType difference =
-                emberAfGetDifference(dataRef, emAfPluginReportVolatileData[i].lastReportValue, dataSize);
-            uint8_t analogOrDiscrete = emberAfGetAttributeAnalogOrDiscreteType(type);
-            if ((analogOrDiscrete == EMBER_AF_DATA_TYPE_DISCRETE && difference != 0) ||
-                (analogOrDiscrete == EMBER_AF_DATA_TYPE_ANALOG && entry.data.reported.reportableChange <= difference))
-            {
-                emAfPluginReportVolatileData[i].reportableChange = true;
-                scheduleTick();
-            }
-            break;
+            scheduleTick();
         }
     }
 }
 
+void emberAfPluginReportingBeginBatch(void)
+{
+    reportBatchDepth++;
+}
+
+void emberAfPluginReportingEndBatch(void)
+{
+    if (reportBatchDepth > 0 && --reportBatchDepth == 0)
+    {
+        scheduleTick();
+    }
+}
+
+uint32_t emberAfPluginReportingGetReportableChange(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, uint8_t mask,
+                                                   uint16_t manufacturerCode)
+{
+    EmberAfPluginReportingEntry entry, key;
+
+    key.direction        = EMBER_ZCL_REPORTING_DIRECTION_REPORTED;
+    key.endpoint         = endpoint;
+    key.clusterId        = clusterId;
+    key.attributeId      = attributeId;
+    key.mask             = mask;
+    key.manufacturerCode = manufacturerCode;
+    if (endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID || findReportingEntry(&key, &entry) == NULL_INDEX)
+    {
+        return 0;
+    }
+    return entry.data.reported.reportableChange;
+}
+
 bool emAfPluginReportingDoEntriesMatch(const EmberAfPluginReportingEntry * const entry1,
                                        const EmberAfPluginReportingEntry * const entry2)
 {
@@ -769,62 +1070,36 @@ uint8_t emAfPluginReportingAddEntry(EmberAfPluginReportingEntry * newEntry)
 
     // If an entry already exists, or exists but with different parameters,
     // overwrite it with the new entry to prevent pollution of the report table
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
-    {
-        emAfPluginReportingGetEntry(i, &oldEntry);
-        if (emAfPluginReportingDoEntriesMatch(&oldEntry, newEntry))
-        {
-            emAfPluginReportingSetEntry(i, newEntry);
-            return i;
-        }
-    }
+    i = findReportingEntry(newEntry, &oldEntry);
 
     // If no pre-existing entries were found, copy the new entry into the lowest
     // indexed free spot in the reporting table
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
+    if (i == NULL_INDEX)
     {
-        emAfPluginReportingGetEntry(i, &oldEntry);
-        if (oldEntry.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID)
-        {
-            emAfPluginReportingSetEntry(i, newEntry);
-            return i;
-        }
+        i = findUnusedReportingEntry();
     }
 
     // If no free spots were found, return the failure indicator
-    return 0xFF;
+    if (i != NULL_INDEX)
+    {
+        emAfPluginReportingSetEntry(i, newEntry);
+    }
+    return i;
 }
 
 static void scheduleTick(void)
 {
     uint32_t delayMs = MAX_INT32U_VALUE;
-    uint8_t i;
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
-    {
-        EmberAfPluginReportingEntry entry;
-        emAfPluginReportingGetEntry(i, &entry);
 
-        if (entry.endpoint != EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID &&
-            entry.direction == EMBER_ZCL_REPORTING_DIRECTION_REPORTED)
-        {
-            uint32_t minIntervalMs = (entry.data.reported.minInterval * MILLISECOND_TICKS_PER_SECOND);
-            uint32_t maxIntervalMs = (entry.data.reported.maxInterval * MILLISECOND_TICKS_PER_SECOND);
-            uint32_t elapsedMs =
-                elapsedTimeInt32u(emAfPluginReportVolatileData[i].lastReportTimeMs, chip::System::Layer::GetClock_MonotonicMS());
-            uint32_t remainingMs = MAX_INT32U_VALUE;
-            if (emAfPluginReportVolatileData[i].reportableChange)
-            {
-                remainingMs = (minIntervalMs < elapsedMs ? 0 : minIntervalMs - elapsedMs);
-            }
-            else if (maxIntervalMs)
-            {
-                remainingMs = (maxIntervalMs < elapsedMs ? 0 : maxIntervalMs - elapsedMs);
-            }
-            if (remainingMs < delayMs)
-            {
-                delayMs = remainingMs;
-            }
-        }
+    if (!reportIndexBuilt)
+    {
+        buildReportIndex();
+    }
+    if (deadlineHeapCount > 0)
+    {
+        int32_t remainingMs = static_cast<int32_t>(deadlineMs[deadlineHeap[0]] -
+                                                   static_cast<uint32_t>(chip::System::Layer::GetClock_MonotonicMS()));
+        delayMs = (remainingMs < 0 ? 0 : static_cast<uint32_t>(remainingMs));
     }
     if (delayMs != MAX_INT32U_VALUE)
     {
@@ -856,9 +1131,9 @@ static void removeConfigurationAndScheduleTick(uint8_t index)
 EmberAfStatus emberAfPluginReportingConfigureReportedAttribute(const EmberAfPluginReportingEntry * newEntry)
 {
     EmberAfAttributeMetadata * metadata;
-    EmberAfPluginReportingEntry entry;
+    EmberAfPluginReportingEntry entry, key;
     EmberAfStatus status;
-    uint8_t i, index = NULL_INDEX;
+    uint8_t index;
     bool initialize = true;
 
     // Verify that we support the attribute and that the data type matches.
@@ -875,25 +1150,19 @@ EmberAfStatus emberAfPluginReportingConfigureReportedAttribute(const EmberAfPlug
         return EMBER_ZCL_STATUS_INVALID_VALUE;
     }
 
-    // Check the table for an entry that matches this request and also watch for
-    // empty slots along the way.  If a report exists, it will be overwritten
-    // with the new configuration.  Otherwise, a new entry will be created and
-    // initialized.
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
+    // Check the table for an entry that matches this request, or else for an
+    // empty slot.  If a report exists, it will be overwritten with the new
+    // configuration.  Otherwise, a new entry will be created and initialized.
+    memmove(&key, newEntry, sizeof(EmberAfPluginReportingEntry));
+    key.direction = EMBER_ZCL_REPORTING_DIRECTION_REPORTED;
+    index         = findReportingEntry(&key, &entry);
+    if (index != NULL_INDEX)
     {
-        emAfPluginReportingGetEntry(i, &entry);
-        if (entry.direction == EMBER_ZCL_REPORTING_DIRECTION_REPORTED && entry.endpoint == newEntry->endpoint &&
-            entry.clusterId == newEntry->clusterId && entry.attributeId == newEntry->attributeId && entry.mask == newEntry->mask &&
-            entry.manufacturerCode == newEntry->manufacturerCode)
-        {
-            initialize = false;
-            index      = i;
-            break;
-        }
-        else if (entry.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID && index == NULL_INDEX)
-        {
-            index = i;
-        }
+        initialize = false;
+    }
+    else
+    {
+        index = findUnusedReportingEntry();
     }
 
     // If the maximum reporting interval is 0xFFFF, the device shall not issue
@@ -973,35 +1242,33 @@ EmberAfStatus emberAfPluginReportingConfigureReportedAttribute(const EmberAfPlug
 static EmberAfStatus configureReceivedAttribute(const EmberAfClusterCommand * cmd, AttributeId attributeId, uint8_t mask,
                                                 uint16_t timeout)
 {
-    EmberAfPluginReportingEntry entry;
+    EmberAfPluginReportingEntry entry, key;
     EmberAfStatus status;
-    uint8_t i, index = NULL_INDEX;
+    uint8_t index   = NULL_INDEX;
     bool initialize = true;
 
-    // Check the table for an entry that matches this request and also watch for
-    // empty slots along the way.  If a report exists, it will be overwritten
-    // with the new configuration.  Otherwise, a new entry will be created and
-    // initialized.
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
+    // Check the table for an entry that matches this request, or else for an
+    // empty slot.  If a report exists, it will be overwritten with the new
+    // configuration.  Otherwise, a new entry will be created and initialized.
+    key.direction              = EMBER_ZCL_REPORTING_DIRECTION_RECEIVED;
+    key.endpoint               = cmd->apsFrame->destinationEndpoint;
+    key.clusterId              = cmd->apsFrame->clusterId;
+    key.attributeId            = attributeId;
+    key.mask                   = mask;
+    key.manufacturerCode       = cmd->mfgCode;
+    key.data.received.source   = cmd->SourceNodeId();
+    key.data.received.endpoint = cmd->apsFrame->sourceEndpoint;
+    if (key.endpoint != EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID)
     {
-        emAfPluginReportingGetEntry(i, &entry);
-        if (entry.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID)
-        {
-            continue;
-        }
-        if (entry.direction == EMBER_ZCL_REPORTING_DIRECTION_RECEIVED && entry.endpoint == cmd->apsFrame->destinationEndpoint &&
-            entry.clusterId == cmd->apsFrame->clusterId && entry.attributeId == attributeId && entry.mask == mask &&
-            entry.manufacturerCode == cmd->mfgCode && entry.data.received.source == cmd->SourceNodeId() &&
-            entry.data.received.endpoint == cmd->apsFrame->sourceEndpoint)
-        {
-            initialize = false;
-            index      = i;
-            break;
-        }
-        else if (entry.endpoint == EMBER_AF_PLUGIN_REPORTING_UNUSED_ENDPOINT_ID && index == NULL_INDEX)
-        {
-            index = i;
-        }
+        index = findReportingEntry(&key, &entry);
+    }
+    if (index != NULL_INDEX)
+    {
+        initialize = false;
+    }
+    else
+    {
+        index = findUnusedReportingEntry();
     }
 
     if (index == NULL_INDEX)
@@ -1072,19 +1339,9 @@ static void putReportableChangeInResp(const EmberAfPluginReportingEntry * entry,
 // reportable attributes.
 static bool reportEntryDoesNotExist(const EmberAfPluginReportingEntry * newEntry)
 {
-    uint8_t i;
     EmberAfPluginReportingEntry entry;
 
-    for (i = 0; i < REPORT_TABLE_SIZE; i++)
-    {
-        emAfPluginReportingGetEntry(i, &entry);
-        if (emAfPluginReportingDoEntriesMatch(&entry, newEntry))
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return findReportingEntry(newEntry, &entry) == NULL_INDEX;
 }
 
 uint8_t emAfPluginReportingConditionallyAddReportingEntry(EmberAfPluginReportingEntry * newEntry)
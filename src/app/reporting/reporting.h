@@ -82,6 +82,32 @@ uint8_t emAfPluginReportingConditionallyAddReportingEntry(EmberAfPluginReporting
 void emberAfPluginReportingLoadReportingConfigDefaults(void);
 bool emberAfPluginReportingGetReportingConfigDefaults(EmberAfPluginReportingEntry * defaultConfiguration);
 
+/** @brief Reportable Change
+ *
+ * Returns the reportable change of the report configured for an attribute, or
+ * 0 if the attribute is not reported.  Code that changes an attribute often,
+ * such as a transition, can use it to write only the changes that are worth
+ * a report.
+ */
+uint32_t emberAfPluginReportingGetReportableChange(chip::EndpointId endpoint, chip::ClusterId clusterId,
+                                                   chip::AttributeId attributeId, uint8_t mask, uint16_t manufacturerCode);
+
+/** @brief Begin Batch
+ *
+ * Holds back the scheduling of the reports of the attribute changes that
+ * follow until emberAfPluginReportingEndBatch() is called, so that attributes
+ * written together, such as those recalled from a scene, go out in the same
+ * tick of reports.  Batches can be nested.
+ */
+void emberAfPluginReportingBeginBatch(void);
+
+/** @brief End Batch
+ *
+ * Ends a batch begun by emberAfPluginReportingBeginBatch(), and schedules the
+ * reports of the changes made during it once the outermost batch ends.
+ */
+void emberAfPluginReportingEndBatch(void);
+
 /** @brief Configure Reporting Command
  *
  * This function is called by the application framework when a Configure
@@ -178,6 +178,13 @@ void StartServer()
 #endif
     }
 
+    // Apply the advertisements as one update, even when one failed, so that the ones left out are removed.
+    CHIP_ERROR finalizeErr = chip::Mdns::ServiceAdvertiser::Instance().FinalizeServiceUpdate();
+    if (err == CHIP_NO_ERROR)
+    {
+        err = finalizeErr;
+    }
+
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Discovery, "Failed to start mDNS server: %s", chip::ErrorStr(err));
@@ -25,31 +25,33 @@
 #include <setup_payload/ManualSetupPayloadGenerator.h>
 #include <setup_payload/QRCodeSetupPayloadGenerator.h>
 #include <support/CodeUtils.h>
-#include <support/ScopedBuffer.h>
 #include <support/logging/CHIPLogging.h>
 
 constexpr char kQrCodeBaseUrl[]                   = "https://dhrishi.github.io/connectedhomeip/qrcode.html";
 constexpr char kUrlDataAssignmentPhrase[]         = "?data=";
 constexpr char kSpecialCharsUnreservedInRfc3986[] = "-._~";
 
+// Room for the URL of a QR code with no optional data, every character of which may be percent-encoded
+constexpr size_t kQrCodeUrlBufferSize =
+    sizeof(kQrCodeBaseUrl) - 1 + sizeof(kUrlDataAssignmentPhrase) - 1 + 3 * (chip::kQRCodeBase38RepresentationBufferSize - 1) + 1;
+
 using namespace ::chip::DeviceLayer;
 
 void PrintOnboardingCodes(chip::RendezvousInformationFlags aRendezvousFlags)
 {
-    std::string QRCode;
+    char qrCodeBuffer[chip::kQRCodeBase38RepresentationBufferSize];
+    chip::MutableCharSpan QRCode(qrCodeBuffer);
     std::string manualPairingCode;
 
     if (GetQRCode(QRCode, aRendezvousFlags) == CHIP_NO_ERROR)
     {
-        chip::Platform::ScopedMemoryBuffer<char> qrCodeBuffer;
-        const size_t qrCodeBufferMaxSize = strlen(kQrCodeBaseUrl) + strlen(kUrlDataAssignmentPhrase) + 3 * QRCode.size() + 1;
-        qrCodeBuffer.Alloc(qrCodeBufferMaxSize);
+        char qrCodeUrlBuffer[kQrCodeUrlBufferSize];
 
-        ChipLogProgress(AppServer, "SetupQRCode: [%s]", QRCode.c_str());
-        if (GetQRCodeUrl(&qrCodeBuffer[0], qrCodeBufferMaxSize, QRCode) == CHIP_NO_ERROR)
+        ChipLogProgress(AppServer, "SetupQRCode: [%s]", QRCode.data());
+        if (GetQRCodeUrl(qrCodeUrlBuffer, sizeof(qrCodeUrlBuffer), QRCode) == CHIP_NO_ERROR)
         {
             ChipLogProgress(AppServer, "Copy/paste the below URL in a browser to see the QR Code:");
-            ChipLogProgress(AppServer, "%s", &qrCodeBuffer[0]);
+            ChipLogProgress(AppServer, "%s", qrCodeUrlBuffer);
         }
     }
     else
@@ -71,10 +73,11 @@ void PrintOnboardingCodes(chip::RendezvousInformationFlags aRendezvousFlags)
 void ShareQRCodeOverNFC(chip::RendezvousInformationFlags aRendezvousFlags)
 {
     // Get QR Code and emulate its content using NFC tag
-    std::string QRCode;
+    char qrCodeBuffer[chip::kQRCodeBase38RepresentationBufferSize];
+    chip::MutableCharSpan QRCode(qrCodeBuffer);
     ReturnOnFailure(GetQRCode(QRCode, chip::RendezvousInformationFlags(chip::RendezvousInformationFlag::kBLE)));
 
-    ReturnOnFailure(NFCMgr().StartTagEmulation(QRCode.c_str(), QRCode.size()));
+    ReturnOnFailure(NFCMgr().StartTagEmulation(QRCode.data(), QRCode.size()));
 }
 #endif
 
@@ -121,7 +124,27 @@ exit:
     return err;
 }
 
+CHIP_ERROR GetQRCode(chip::MutableCharSpan & aQRCode, chip::RendezvousInformationFlags aRendezvousFlags)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::SetupPayload payload;
+
+    err = GetSetupPayload(payload, aRendezvousFlags);
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogProgress(AppServer, "GetSetupPayload() failed: %s", chip::ErrorStr(err)));
+
+    err = chip::QRCodeSetupPayloadGenerator(payload).payloadBase38Representation(aQRCode);
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogProgress(AppServer, "Generating QR Code failed: %s", chip::ErrorStr(err)));
+
+exit:
+    return err;
+}
+
 CHIP_ERROR GetQRCodeUrl(char * aQRCodeUrl, size_t aUrlMaxSize, const std::string & aQRCode)
+{
+    return GetQRCodeUrl(aQRCodeUrl, aUrlMaxSize, chip::CharSpan(aQRCode.data(), aQRCode.size()));
+}
+
+CHIP_ERROR GetQRCodeUrl(char * aQRCodeUrl, size_t aUrlMaxSize, chip::CharSpan aQRCode)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     int writtenDataSize;
@@ -134,7 +157,7 @@ CHIP_ERROR GetQRCodeUrl(char * aQRCodeUrl, size_t aUrlMaxSize, const std::string
     VerifyOrExit((writtenDataSize > 0) && (writtenDataSize < static_cast<int>(aUrlMaxSize)),
                  err = CHIP_ERROR_INVALID_STRING_LENGTH);
 
-    err = EncodeQRCodeToUrl(aQRCode.c_str(), aQRCode.size(), aQRCodeUrl + writtenDataSize, aUrlMaxSize - writtenDataSize);
+    err = EncodeQRCodeToUrl(aQRCode.data(), aQRCode.size(), aQRCodeUrl + writtenDataSize, aUrlMaxSize - writtenDataSize);
     VerifyOrExit(err == CHIP_NO_ERROR, );
 
 exit:
@@ -70,6 +70,9 @@ CHIP_ERROR RendezvousServer::WaitForPairing(const RendezvousParameters & params,
     ReturnErrorOnFailure(mExchangeManager->RegisterUnsolicitedMessageHandlerForType(
         Protocols::SecureChannel::MsgType::PBKDFParamRequest, &mPairingSession));
 
+    // Derive the verifier and run SPAKE2+ on the worker threads of the platform, if it has them.
+    mPairingSession.SetCryptoWorkerPool(&PlatformMgr().GetWorkerPool());
+
     if (params.HasPASEVerifier())
     {
         ReturnErrorOnFailure(mPairingSession.WaitForPairing(params.GetPASEVerifier(), mNextKeyId++, this));
@@ -132,11 +135,10 @@ void RendezvousServer::OnSessionEstablished()
     Cleanup();
 
     ChipLogProgress(AppServer, "Device completed Rendezvous process");
-    StorablePeerConnection connection(mPairingSession, mAdmin->GetAdminId());
 
-    VerifyOrReturn(mStorage != nullptr,
+    VerifyOrReturn(mStorage != nullptr && mConnections != nullptr,
                    ChipLogError(AppServer, "Storage delegate is not available. Cannot store the connection state"));
-    VerifyOrReturn(connection.StoreIntoKVS(*mStorage) == CHIP_NO_ERROR,
+    VerifyOrReturn(mConnections->Store(mPairingSession, mAdmin->GetAdminId()) == CHIP_NO_ERROR,
                    ChipLogError(AppServer, "Failed to store the connection state"));
 
     mStorage->SyncSetKeyValue(kStorablePeerConnectionCountKey, &mNextKeyId, sizeof(mNextKeyId));
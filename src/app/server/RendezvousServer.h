@@ -18,6 +18,7 @@
 #pragma once
 
 #include <app/server/AppDelegate.h>
+#include <app/server/StorablePeerConnection.h>
 #include <core/CHIPPersistentStorageDelegate.h>
 #include <messaging/ExchangeMgr.h>
 #include <platform/CHIPDeviceLayer.h>
@@ -31,11 +32,13 @@ public:
     CHIP_ERROR WaitForPairing(const RendezvousParameters & params, Messaging::ExchangeManager * exchangeManager,
                               TransportMgrBase * transportMgr, SecureSessionMgr * sessionMgr, Transport::AdminPairingInfo * admin);
 
-    CHIP_ERROR Init(AppDelegate * delegate, PersistentStorageDelegate * storage)
+    CHIP_ERROR Init(AppDelegate * delegate, PersistentStorageDelegate * storage, StoredPeerConnections * connections)
     {
         VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
-        mDelegate = delegate;
-        mStorage  = storage;
+        VerifyOrReturnError(connections != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        mDelegate    = delegate;
+        mStorage     = storage;
+        mConnections = connections;
         return CHIP_NO_ERROR;
     }
 
@@ -51,6 +54,7 @@ public:
 private:
     AppDelegate * mDelegate;
     PersistentStorageDelegate * mStorage          = nullptr;
+    StoredPeerConnections * mConnections          = nullptr;
     Messaging::ExchangeManager * mExchangeManager = nullptr;
 
     PASESession mPairingSession;
@@ -22,6 +22,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/server/EchoHandler.h>
 #include <app/server/RendezvousServer.h>
+#include <app/server/StorableIdIndex.h>
 #include <app/server/StorablePeerConnection.h>
 #include <app/util/DataModelHandler.h>
 
@@ -39,6 +40,7 @@
 #include <support/logging/CHIPLogging.h>
 #include <sys/param.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemTrace.h>
 #include <system/TLVPacketBufferBackingStore.h>
 #include <transport/SecureSessionMgr.h>
 
@@ -96,6 +98,8 @@ class ServerStorageDelegate : public PersistentStorageDelegate
 };
 
 ServerStorageDelegate gServerStorage;
+StorableIdIndex<CHIP_CONFIG_MAX_DEVICE_ADMINS> gAdminIndex;
+StoredPeerConnections gStoredConnections;
 
 CHIP_ERROR PersistAdminPairingToKVS(AdminPairingInfo * admin, AdminId nextAvailableId)
 {
@@ -103,6 +107,8 @@ CHIP_ERROR PersistAdminPairingToKVS(AdminPairingInfo * admin, AdminId nextAvaila
     ChipLogProgress(AppServer, "Persisting admin ID %d, next available %d", admin->GetAdminId(), nextAvailableId);
 
     ReturnErrorOnFailure(GetGlobalAdminPairingTable().Store(admin->GetAdminId()));
+    ReturnErrorOnFailure(gAdminIndex.Add(admin->GetAdminId()));
+    ReturnErrorOnFailure(gAdminIndex.StoreIntoKVS(gServerStorage, kAdminTableIndexKey));
     ReturnErrorOnFailure(PersistedStorage::KeyValueStoreMgr().Put(kAdminTableCountKey, &nextAvailableId, sizeof(nextAvailableId)));
 
     ChipLogProgress(AppServer, "Persisting admin ID successfully");
@@ -118,19 +124,31 @@ CHIP_ERROR RestoreAllAdminPairingsFromKVS(AdminPairingTable & adminPairings, Adm
 
     // TODO: The admin ID space allocation should be re-evaluated. With the current approach, the space could be
     //       exhausted while IDs are still available (e.g. if the admin IDs are allocated and freed over a period of time).
-    //       Also, the current approach can make ID lookup slower as more IDs are allocated and freed.
-    for (AdminId id = 0; id < nextAvailableId; id++)
+    if (gAdminIndex.FetchFromKVS(gServerStorage, kAdminTableIndexKey) != CHIP_NO_ERROR)
     {
-        // Recreate the binding if one exists in persistent storage. Else skip to the next ID
-        if (adminPairings.LoadFromStorage(id) == CHIP_NO_ERROR)
+        // Admin pairings stored without an index are found, once, by trying every admin ID that was allocated.
+        for (AdminId id = 0; id < nextAvailableId && !gAdminIndex.IsFull(); id++)
         {
-            AdminPairingInfo * admin = adminPairings.FindAdminWithId(id);
-            if (admin != nullptr)
+            if (adminPairings.LoadFromStorage(id) == CHIP_NO_ERROR)
             {
-                ChipLogProgress(AppServer, "Found admin pairing for %d, node ID 0x%08" PRIx32 "%08" PRIx32, admin->GetAdminId(),
-                                static_cast<uint32_t>(admin->GetNodeId() >> 32), static_cast<uint32_t>(admin->GetNodeId()));
+                ReturnErrorOnFailure(gAdminIndex.Add(id));
             }
         }
+        ReturnErrorOnFailure(gAdminIndex.StoreIntoKVS(gServerStorage, kAdminTableIndexKey));
+    }
+
+    for (AdminId id : gAdminIndex)
+    {
+        AdminPairingInfo * admin = adminPairings.FindAdminWithId(id);
+        if (admin == nullptr && adminPairings.LoadFromStorage(id) == CHIP_NO_ERROR)
+        {
+            admin = adminPairings.FindAdminWithId(id);
+        }
+        if (admin != nullptr)
+        {
+            ChipLogProgress(AppServer, "Found admin pairing for %d, node ID 0x%08" PRIx32 "%08" PRIx32, admin->GetAdminId(),
+                            static_cast<uint32_t>(admin->GetNodeId() >> 32), static_cast<uint32_t>(admin->GetNodeId()));
+        }
     }
     ChipLogProgress(AppServer, "Restored all admin pairings from KVS.");
 
@@ -140,43 +158,26 @@ CHIP_ERROR RestoreAllAdminPairingsFromKVS(AdminPairingTable & adminPairings, Adm
 void EraseAllAdminPairingsUpTo(AdminId nextAvailableId)
 {
     PersistedStorage::KeyValueStoreMgr().Delete(kAdminTableCountKey);
+    PersistedStorage::KeyValueStoreMgr().Delete(kAdminTableIndexKey);
 
     for (AdminId id = 0; id < nextAvailableId; id++)
     {
         GetGlobalAdminPairingTable().Delete(id);
     }
+    gAdminIndex.Clear();
 }
 
-static CHIP_ERROR RestoreAllSessionsFromKVS(SecureSessionMgr & sessionMgr, RendezvousServer & server)
+static CHIP_ERROR RestoreNextSessionKeyIdFromKVS(RendezvousServer & server)
 {
     uint16_t nextSessionKeyId = 0;
     // It's not an error if the key doesn't exist. Just return right away.
     VerifyOrReturnError(PersistedStorage::KeyValueStoreMgr().Get(kStorablePeerConnectionCountKey, &nextSessionKeyId) ==
                             CHIP_NO_ERROR,
                         CHIP_NO_ERROR);
-    ChipLogProgress(AppServer, "Found %d stored connections", nextSessionKeyId);
-
-    PASESession * session = chip::Platform::New<PASESession>();
-    VerifyOrReturnError(session != nullptr, CHIP_ERROR_NO_MEMORY);
-
-    for (uint16_t keyId = 0; keyId < nextSessionKeyId; keyId++)
-    {
-        StorablePeerConnection connection;
-        if (CHIP_NO_ERROR == connection.FetchFromKVS(gServerStorage, keyId))
-        {
-            connection.GetPASESession(session);
-
-            ChipLogProgress(AppServer, "Fetched the session information: from 0x%08" PRIx32 "%08" PRIx32,
-                            static_cast<uint32_t>(session->PeerConnection().GetPeerNodeId() >> 32),
-                            static_cast<uint32_t>(session->PeerConnection().GetPeerNodeId()));
-            sessionMgr.NewPairing(Optional<Transport::PeerAddress>::Value(session->PeerConnection().GetPeerAddress()),
-                                  session->PeerConnection().GetPeerNodeId(), session,
-                                  SecureSessionMgr::PairingDirection::kResponder, connection.GetAdminId(), nullptr);
-            session->Clear();
-        }
-    }
 
-    chip::Platform::Delete(session);
+    // The sessions themselves are only read from storage the first time a message comes for their key.
+    ChipLogProgress(AppServer, "Found %u stored connections, next key ID is %d", static_cast<unsigned>(gStoredConnections.Count()),
+                    nextSessionKeyId);
 
     server.SetNextKeyId(nextSessionKeyId);
     return CHIP_NO_ERROR;
@@ -186,10 +187,7 @@ void EraseAllSessionsUpTo(uint16_t nextSessionKeyId)
 {
     PersistedStorage::KeyValueStoreMgr().Delete(kStorablePeerConnectionCountKey);
 
-    for (uint16_t keyId = 0; keyId < nextSessionKeyId; keyId++)
-    {
-        StorablePeerConnection::DeleteFromKVS(gServerStorage, keyId);
-    }
+    gStoredConnections.EraseAllUpTo(nextSessionKeyId);
 }
 
 // TODO: The following class is setting the discriminator in Persistent Storage. This is
@@ -287,6 +285,35 @@ RendezvousServer gRendezvousServer;
 Messaging::ExchangeManager gExchangeMgr;
 ServerRendezvousAdvertisementDelegate gAdvDelegate;
 
+// Get the verifier of the setup PIN code stored at provisioning time, so that pairing does not run PBKDF2.
+static CHIP_ERROR GetSetupPASEVerifier(PASEVerifier & verifier)
+{
+    size_t verifierLen = 0;
+    CHIP_ERROR err     = DeviceLayer::ConfigurationMgr().GetSetupPASEVerifier(&verifier[0][0], sizeof(verifier), verifierLen);
+
+    if (err == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(verifierLen == sizeof(verifier), CHIP_ERROR_INVALID_ARGUMENT);
+        return CHIP_NO_ERROR;
+    }
+
+#if CHIP_DEVICE_CONFIG_CACHE_SETUP_PASE_VERIFIER
+    uint32_t pinCode;
+
+    ReturnErrorOnFailure(DeviceLayer::ConfigurationMgr().GetSetupPinCode(pinCode));
+    ReturnErrorOnFailure(PASESession::GeneratePASEVerifier(verifier, false, pinCode));
+
+    err = DeviceLayer::ConfigurationMgr().StoreSetupPASEVerifier(&verifier[0][0], sizeof(verifier));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to store the setup PASE verifier: %s", ErrorStr(err));
+    }
+    return CHIP_NO_ERROR;
+#else
+    return err;
+#endif // CHIP_DEVICE_CONFIG_CACHE_SETUP_PASE_VERIFIER
+}
+
 static CHIP_ERROR OpenPairingWindowUsingVerifier(uint16_t discriminator, PASEVerifier & verifier)
 {
     RendezvousParameters params;
@@ -407,12 +434,19 @@ CHIP_ERROR OpenDefaultPairingWindow(ResetAdmins resetAdmins, chip::PairingWindow
     // TODO(cecille): If this is re-called when the window is already open, what should happen?
     gDeviceDiscriminatorCache.RestoreDiscriminator();
 
-    uint32_t pinCode;
-    ReturnErrorOnFailure(DeviceLayer::ConfigurationMgr().GetSetupPinCode(pinCode));
-
     RendezvousParameters params;
+    PASEVerifier verifier;
 
-    params.SetSetupPINCode(pinCode);
+    if (GetSetupPASEVerifier(verifier) == CHIP_NO_ERROR)
+    {
+        params.SetPASEVerifier(verifier);
+    }
+    else
+    {
+        uint32_t pinCode;
+        ReturnErrorOnFailure(DeviceLayer::ConfigurationMgr().GetSetupPinCode(pinCode));
+        params.SetSetupPINCode(pinCode);
+    }
 #if CONFIG_NETWORK_LAYER_BLE
     gAdvDelegate.SetBLE(advertisementMode == chip::PairingWindowAdvertisement::kBle);
     params.SetAdvertisementDelegate(&gAdvDelegate);
@@ -466,83 +500,90 @@ static void ChipEventHandler(const DeviceLayer::ChipDeviceEvent * event, intptr_
 }
 #endif
 
-// The function will initialize datamodel handler and then start the server
-// The server assumes the platform's networking has been setup already
-void InitServer(AppDelegate * delegate)
-{
-    CHIP_ERROR err = CHIP_NO_ERROR;
+namespace {
 
-    chip::Platform::MemoryInit();
+bool IsNetworkProvisioned()
+{
+    return DeviceLayer::ConnectivityMgr().IsWiFiStationProvisioned() || DeviceLayer::ConnectivityMgr().IsThreadProvisioned();
+}
 
-    InitDataModelHandler(&gExchangeMgr);
-    gCallbacks.SetDelegate(delegate);
+CHIP_ERROR InitStorage(AppDelegate * delegate)
+{
+    SYSTEM_TRACE_SCOPE(BootStorage);
+    CHIP_ERROR err = CHIP_NO_ERROR;
 
 #if CHIP_DEVICE_LAYER_TARGET_DARWIN
-    err = PersistedStorage::KeyValueStoreMgrImpl().Init("chip.store");
-    SuccessOrExit(err);
+    ReturnErrorOnFailure(PersistedStorage::KeyValueStoreMgrImpl().Init("chip.store"));
 #endif
 
-    err = gRendezvousServer.Init(delegate, &gServerStorage);
-    SuccessOrExit(err);
-
+    ReturnErrorOnFailure(gStoredConnections.Init(&gServerStorage));
+    ReturnErrorOnFailure(gRendezvousServer.Init(delegate, &gServerStorage, &gStoredConnections));
     gAdvDelegate.SetDelegate(delegate);
+    ReturnErrorOnFailure(gAdminPairings.Init(&gServerStorage));
+
+    VerifyOrReturnError(!useTestPairing() && IsNetworkProvisioned(), CHIP_NO_ERROR);
+
+    // Only the admin pairings are read now, for their operational identities to be advertised; the sessions are read from
+    // storage the first time a message comes for their key.
+    err = RestoreAllAdminPairingsFromKVS(gAdminPairings, gNextAvailableAdminId);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Could not restore admin table");
+        return err;
+    }
 
-    err = gAdminPairings.Init(&gServerStorage);
-    SuccessOrExit(err);
+    err = RestoreNextSessionKeyIdFromKVS(gRendezvousServer);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Could not restore previous sessions");
+        return err;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR InitTransport()
+{
+    SYSTEM_TRACE_SCOPE(BootTransport);
 
     // Init transport before operations with secure session mgr.
-    err = gTransports.Init(UdpListenParameters(&DeviceLayer::InetLayer).SetAddressType(kIPAddressType_IPv6)
+    ReturnErrorOnFailure(gTransports.Init(UdpListenParameters(&DeviceLayer::InetLayer).SetAddressType(kIPAddressType_IPv6)
 
 #if INET_CONFIG_ENABLE_IPV4
-                               ,
-                           UdpListenParameters(&DeviceLayer::InetLayer).SetAddressType(kIPAddressType_IPv4)
+                                              ,
+                                          UdpListenParameters(&DeviceLayer::InetLayer).SetAddressType(kIPAddressType_IPv4)
 #endif
 #if CONFIG_NETWORK_LAYER_BLE
-                               ,
-                           BleListenParameters(DeviceLayer::ConnectivityMgr().GetBleLayer())
+                                              ,
+                                          BleListenParameters(DeviceLayer::ConnectivityMgr().GetBleLayer())
 #endif
-    );
-
-    SuccessOrExit(err);
+                                              ));
 
-    err = gSessions.Init(chip::kTestDeviceNodeId, &DeviceLayer::SystemLayer, &gTransports, &gAdminPairings);
-    SuccessOrExit(err);
+    ReturnErrorOnFailure(gSessions.Init(chip::kTestDeviceNodeId, &DeviceLayer::SystemLayer, &gTransports, &gAdminPairings));
+    gSessions.SetRestoreDelegate(&gStoredConnections);
 
-    err = gExchangeMgr.Init(&gSessions);
-    SuccessOrExit(err);
-
-#if CHIP_ENABLE_INTERACTION_MODEL
-    err = chip::app::InteractionModelEngine::GetInstance()->Init(&gExchangeMgr, nullptr);
-    SuccessOrExit(err);
-#endif
+    return gExchangeMgr.Init(&gSessions);
+}
 
-#if defined(CHIP_APP_USE_ECHO)
-    err = InitEchoHandler(&gExchangeMgr);
-    SuccessOrExit(err);
-#endif
+CHIP_ERROR InitAdvertise()
+{
+    SYSTEM_TRACE_SCOPE(BootAdvertise);
 
     if (useTestPairing())
     {
         ChipLogProgress(AppServer, "Rendezvous and secure pairing skipped");
-        SuccessOrExit(err = AddTestPairing());
+        ReturnErrorOnFailure(AddTestPairing());
     }
-    else if (DeviceLayer::ConnectivityMgr().IsWiFiStationProvisioned() || DeviceLayer::ConnectivityMgr().IsThreadProvisioned())
+    else if (IsNetworkProvisioned())
     {
         // If the network is already provisioned, proactively disable BLE advertisement.
         ChipLogProgress(AppServer, "Network already provisioned. Disabling BLE advertisement");
         chip::DeviceLayer::ConnectivityMgr().SetBLEAdvertisingEnabled(false);
-
-        // Restore any previous admin pairings
-        VerifyOrExit(CHIP_NO_ERROR == RestoreAllAdminPairingsFromKVS(gAdminPairings, gNextAvailableAdminId),
-                     ChipLogError(AppServer, "Could not restore admin table"));
-
-        VerifyOrExit(CHIP_NO_ERROR == RestoreAllSessionsFromKVS(gSessions, gRendezvousServer),
-                     ChipLogError(AppServer, "Could not restore previous sessions"));
     }
     else
     {
 #if CHIP_DEVICE_CONFIG_ENABLE_PAIRING_AUTOSTART
-        SuccessOrExit(err = OpenDefaultPairingWindow(ResetAdmins::kYes));
+        ReturnErrorOnFailure(OpenDefaultPairingWindow(ResetAdmins::kYes));
 #endif
     }
 
@@ -552,15 +593,56 @@ void InitServer(AppDelegate * delegate)
     PlatformMgr().AddEventHandler(ChipEventHandler, {});
 #endif
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR InitDataModel(AppDelegate * delegate)
+{
+    SYSTEM_TRACE_SCOPE(BootDataModel);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    InitDataModelHandler(&gExchangeMgr);
+    gCallbacks.SetDelegate(delegate);
+
+#if CHIP_ENABLE_INTERACTION_MODEL
+    ReturnErrorOnFailure(chip::app::InteractionModelEngine::GetInstance()->Init(&gExchangeMgr, nullptr, &gServerStorage));
+#endif
+
+#if defined(CHIP_APP_USE_ECHO)
+    ReturnErrorOnFailure(InitEchoHandler(&gExchangeMgr));
+#endif
+
     gCallbacks.SetSessionMgr(&gSessions);
 
     // Register to receive unsolicited legacy ZCL messages from the exchange manager.
     err = gExchangeMgr.RegisterUnsolicitedMessageHandlerForProtocol(Protocols::TempZCL::Id, &gCallbacks);
-    VerifyOrExit(err == CHIP_NO_ERROR, err = CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER);
+    VerifyOrReturnError(err == CHIP_NO_ERROR, CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER);
 
     // Register to receive unsolicited Service Provisioning messages from the exchange manager.
     err = gExchangeMgr.RegisterUnsolicitedMessageHandlerForProtocol(Protocols::ServiceProvisioning::Id, &gCallbacks);
-    VerifyOrExit(err == CHIP_NO_ERROR, err = CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER);
+    VerifyOrReturnError(err == CHIP_NO_ERROR, CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER);
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+// The function will initialize datamodel handler and then start the server
+// The server assumes the platform's networking has been setup already
+void InitServer(AppDelegate * delegate)
+{
+    SYSTEM_TRACE_SCOPE(Boot);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    chip::Platform::MemoryInit();
+
+    // The node is made reachable as early as it can be: the transports listen, and the identities restored from storage are
+    // advertised, before the data model is set up. What peers send meanwhile waits in the sockets for the event loop, which
+    // only runs once every stage is done, rather than being refused.
+    SuccessOrExit(err = InitStorage(delegate));
+    SuccessOrExit(err = InitTransport());
+    SuccessOrExit(err = InitAdvertise());
+    SuccessOrExit(err = InitDataModel(delegate));
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an index of the ids of the entries kept in persistent
+ *      storage, so that they can be found without probing the storage for
+ *      every id ever allocated.
+ */
+
+#pragma once
+
+#include <core/CHIPEncoding.h>
+#include <core/CHIPPersistentStorageDelegate.h>
+#include <support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * The ids of the live entries, oldest first, stored in a single key as an array of 16-bit little endian ids.
+ */
+template <size_t kMaxIds>
+class StorableIdIndex
+{
+public:
+    static_assert(kMaxIds * sizeof(uint16_t) <= UINT16_MAX, "The index must fit in one storage value");
+
+    /**
+     * Read the index stored under the given key. The index is empty if the read fails.
+     */
+    CHIP_ERROR FetchFromKVS(PersistentStorageDelegate & kvs, const char * key)
+    {
+        uint16_t ids[kMaxIds];
+        uint16_t size = sizeof(ids);
+
+        Clear();
+        ReturnErrorOnFailure(kvs.SyncGetKeyValue(key, ids, size));
+        VerifyOrReturnError(size % sizeof(ids[0]) == 0 && size <= sizeof(ids), CHIP_ERROR_INVALID_ARGUMENT);
+
+        for (size_t i = 0; i < size / sizeof(ids[0]); i++)
+        {
+            mIds[mCount++] = Encoding::LittleEndian::HostSwap16(ids[i]);
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR StoreIntoKVS(PersistentStorageDelegate & kvs, const char * key) const
+    {
+        uint16_t ids[kMaxIds];
+
+        for (size_t i = 0; i < mCount; i++)
+        {
+            ids[i] = Encoding::LittleEndian::HostSwap16(mIds[i]);
+        }
+        return kvs.SyncSetKeyValue(key, ids, static_cast<uint16_t>(mCount * sizeof(ids[0])));
+    }
+
+    /**
+     * Add an id, after the others. Adding an id of the index does nothing.
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY If the index is full.
+     */
+    CHIP_ERROR Add(uint16_t id)
+    {
+        VerifyOrReturnError(!Contains(id), CHIP_NO_ERROR);
+        VerifyOrReturnError(mCount < kMaxIds, CHIP_ERROR_NO_MEMORY);
+        mIds[mCount++] = id;
+        return CHIP_NO_ERROR;
+    }
+
+    void Remove(uint16_t id)
+    {
+        size_t i = IndexOf(id);
+        VerifyOrReturn(i < mCount);
+        for (mCount--; i < mCount; i++)
+        {
+            mIds[i] = mIds[i + 1];
+        }
+    }
+
+    bool Contains(uint16_t id) const { return IndexOf(id) < mCount; }
+    bool IsFull() const { return mCount == kMaxIds; }
+    void Clear() { mCount = 0; }
+
+    size_t Count() const { return mCount; }
+    uint16_t operator[](size_t i) const { return mIds[i]; }
+
+    const uint16_t * begin() const { return mIds; }
+    const uint16_t * end() const { return mIds + mCount; }
+
+private:
+    size_t IndexOf(uint16_t id) const
+    {
+        size_t i = 0;
+        while (i < mCount && mIds[i] != id)
+        {
+            i++;
+        }
+        return i;
+    }
+
+    uint16_t mIds[kMaxIds];
+    size_t mCount = 0;
+};
+
+} // namespace chip
@@ -17,7 +17,11 @@
 
 #include <app/server/StorablePeerConnection.h>
 #include <core/CHIPEncoding.h>
+#include <support/CHIPMem.h>
 #include <support/SafeInt.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
 
 namespace chip {
 
@@ -67,4 +71,94 @@ CHIP_ERROR StorablePeerConnection::GenerateKey(uint16_t id, char * key, size_t l
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR StoredPeerConnections::Init(PersistentStorageDelegate * kvs)
+{
+    uint16_t nextKeyId = 0;
+    uint16_t size      = sizeof(nextKeyId);
+
+    VerifyOrReturnError(kvs != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mStorage = kvs;
+
+    VerifyOrReturnError(mIndex.FetchFromKVS(*mStorage, kStorablePeerConnectionIndexKey) != CHIP_NO_ERROR, CHIP_NO_ERROR);
+
+    // Connections stored without an index, if any, are found by trying every key id that was allocated.
+    VerifyOrReturnError(mStorage->SyncGetKeyValue(kStorablePeerConnectionCountKey, &nextKeyId, size) == CHIP_NO_ERROR,
+                        CHIP_NO_ERROR);
+    for (uint16_t keyId = 0; keyId < nextKeyId; keyId++)
+    {
+        StorablePeerConnection connection;
+        if (connection.FetchFromKVS(*mStorage, keyId) == CHIP_NO_ERROR)
+        {
+            if (mIndex.IsFull())
+            {
+                StorablePeerConnection::DeleteFromKVS(*mStorage, mIndex[0]);
+                mIndex.Remove(mIndex[0]);
+            }
+            ReturnErrorOnFailure(mIndex.Add(keyId));
+        }
+    }
+
+    return mIndex.StoreIntoKVS(*mStorage, kStorablePeerConnectionIndexKey);
+}
+
+CHIP_ERROR StoredPeerConnections::Store(PASESession & session, Transport::AdminId admin)
+{
+    StorablePeerConnection connection(session, admin);
+
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!mIndex.Contains(connection.GetKeyId()) && mIndex.IsFull())
+    {
+        ChipLogProgress(AppServer, "Deleting the oldest stored connection, %d", mIndex[0]);
+        StorablePeerConnection::DeleteFromKVS(*mStorage, mIndex[0]);
+        mIndex.Remove(mIndex[0]);
+    }
+
+    ReturnErrorOnFailure(connection.StoreIntoKVS(*mStorage));
+    ReturnErrorOnFailure(mIndex.Add(connection.GetKeyId()));
+    return mIndex.StoreIntoKVS(*mStorage, kStorablePeerConnectionIndexKey);
+}
+
+void StoredPeerConnections::EraseAllUpTo(uint16_t nextKeyId)
+{
+    VerifyOrReturn(mStorage != nullptr);
+
+    // The connections stored before the index are deleted too.
+    for (uint16_t keyId = 0; keyId < nextKeyId; keyId++)
+    {
+        StorablePeerConnection::DeleteFromKVS(*mStorage, keyId);
+    }
+    for (uint16_t keyId : mIndex)
+    {
+        StorablePeerConnection::DeleteFromKVS(*mStorage, keyId);
+    }
+
+    mIndex.Clear();
+    mStorage->SyncDeleteKeyValue(kStorablePeerConnectionIndexKey);
+}
+
+CHIP_ERROR StoredPeerConnections::RestoreSession(uint16_t localKeyId, SecureSessionMgr & mgr)
+{
+    StorablePeerConnection connection;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrReturnError(mStorage != nullptr && mIndex.Contains(localKeyId), CHIP_ERROR_KEY_NOT_FOUND);
+    ReturnErrorOnFailure(connection.FetchFromKVS(*mStorage, localKeyId));
+
+    PASESession * session = chip::Platform::New<PASESession>();
+    VerifyOrReturnError(session != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    connection.GetPASESession(session);
+    ChipLogProgress(AppServer, "Restoring the session of key %d, from 0x%08" PRIx32 "%08" PRIx32, localKeyId,
+                    static_cast<uint32_t>(session->PeerConnection().GetPeerNodeId() >> 32),
+                    static_cast<uint32_t>(session->PeerConnection().GetPeerNodeId()));
+    err = mgr.NewPairing(Optional<Transport::PeerAddress>::Value(session->PeerConnection().GetPeerAddress()),
+                         session->PeerConnection().GetPeerNodeId(), session, SecureSessionMgr::PairingDirection::kResponder,
+                         connection.GetAdminId(), nullptr);
+
+    session->Clear();
+    chip::Platform::Delete(session);
+    return err;
+}
+
 } // namespace chip
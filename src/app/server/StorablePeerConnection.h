@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <app/server/StorableIdIndex.h>
 #include <core/CHIPPersistentStorageDelegate.h>
 #include <protocols/secure_channel/PASESession.h>
+#include <transport/SecureSessionMgr.h>
 
 namespace chip {
 
@@ -26,6 +28,7 @@ namespace chip {
 // platform. Keeping them short.
 constexpr char kStorablePeerConnectionKeyPrefix[] = "CHIPCnxn";
 constexpr char kStorablePeerConnectionCountKey[]  = "CHIPNxtCnxn";
+constexpr char kStorablePeerConnectionIndexKey[]  = "CHIPCnxnIdx";
 
 class DLL_EXPORT StorablePeerConnection
 {
@@ -46,6 +49,8 @@ public:
 
     Transport::AdminId GetAdminId() { return mSession.mAdmin; }
 
+    uint16_t GetKeyId() const { return mKeyId; }
+
 private:
     static constexpr size_t KeySize();
 
@@ -61,4 +66,37 @@ private:
     uint16_t mKeyId;
 };
 
+/**
+ * The peer connections kept in persistent storage, restored into the SecureSessionMgr the first time a message comes for
+ * their key. Only the index of their key ids is read when the node starts.
+ */
+class DLL_EXPORT StoredPeerConnections : public SecureSessionRestoreDelegate
+{
+public:
+    /**
+     * Read the index of the stored connections. The index is built, once, from the connections stored before there was one.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * kvs);
+
+    /**
+     * Store the connection of a pairing session. The oldest connection is deleted if there are already
+     * CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE, as many as there can be sessions.
+     */
+    CHIP_ERROR Store(PASESession & session, Transport::AdminId admin);
+
+    /**
+     * Delete the stored connections which key id is below nextKeyId and the index.
+     */
+    void EraseAllUpTo(uint16_t nextKeyId);
+
+    size_t Count() const { return mIndex.Count(); }
+
+    //////////// SecureSessionRestoreDelegate Implementation ///////////////
+    CHIP_ERROR RestoreSession(uint16_t localKeyId, SecureSessionMgr & mgr) override;
+
+private:
+    PersistentStorageDelegate * mStorage = nullptr;
+    StorableIdIndex<CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE> mIndex;
+};
+
 } // namespace chip
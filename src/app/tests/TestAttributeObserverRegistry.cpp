@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for AttributeObserverRegistry
+ *
+ */
+
+#include <app/AttributeObserverRegistry.h>
+#include <nlunit-test.h>
+#include <support/UnitTestRegistration.h>
+
+namespace chip {
+namespace app {
+namespace TestAttributeObserverRegistry {
+
+class TestObserver : public AttributeObserver
+{
+public:
+    void OnAttributeChanged(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) override
+    {
+        mChanges++;
+        mLastAttributeId = aAttributeId;
+        if (mpToUnobserve != nullptr)
+        {
+            mpRegistry->Unobserve(*mpToUnobserve);
+        }
+    }
+
+    void OnAttributeChangesEnd() override { mEnds++; }
+
+    int mChanges                           = 0;
+    int mEnds                              = 0;
+    AttributeId mLastAttributeId           = 0;
+    AttributeObserverRegistry * mpRegistry = nullptr;
+    AttributeObservation * mpToUnobserve   = nullptr;
+};
+
+void TestDispatch(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeObserverRegistry registry;
+    TestObserver attributeObserver;
+    TestObserver clusterObserver;
+    AttributeObservation attribute(attributeObserver, 1, 6, 0);
+    AttributeObservation cluster(clusterObserver, 1, 6);
+
+    NL_TEST_ASSERT(apSuite, registry.Observe(attribute) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, registry.Observe(cluster) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, registry.Observe(cluster) == CHIP_ERROR_INCORRECT_STATE);
+
+    registry.NotifyAttributeChanged(1, 6, 0);
+    NL_TEST_ASSERT(apSuite, attributeObserver.mChanges == 1 && attributeObserver.mEnds == 1);
+    NL_TEST_ASSERT(apSuite, clusterObserver.mChanges == 1 && clusterObserver.mEnds == 1);
+
+    // Only the observer of the whole cluster sees another attribute
+    registry.NotifyAttributeChanged(1, 6, 0x4000);
+    NL_TEST_ASSERT(apSuite, attributeObserver.mChanges == 1);
+    NL_TEST_ASSERT(apSuite, clusterObserver.mChanges == 2 && clusterObserver.mLastAttributeId == 0x4000);
+
+    // Nor another endpoint or cluster
+    registry.NotifyAttributeChanged(2, 6, 0);
+    registry.NotifyAttributeChanged(1, 8, 0);
+    NL_TEST_ASSERT(apSuite, attributeObserver.mChanges == 1 && clusterObserver.mChanges == 2);
+
+    registry.Unobserve(attribute);
+    NL_TEST_ASSERT(apSuite, !attribute.IsRegistered());
+    registry.NotifyAttributeChanged(1, 6, 0);
+    NL_TEST_ASSERT(apSuite, attributeObserver.mChanges == 1 && clusterObserver.mChanges == 3);
+}
+
+void TestBatch(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeObserverRegistry registry;
+    TestObserver observer;
+    AttributeObservation onOff(observer, 1, 6, 0);
+    AttributeObservation level(observer, 1, 8, 0);
+
+    NL_TEST_ASSERT(apSuite, registry.Observe(onOff) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, registry.Observe(level) == CHIP_NO_ERROR);
+
+    {
+        AttributeObserverRegistry::ScopedBatch batch(registry);
+        registry.NotifyAttributeChanged(1, 6, 0);
+        {
+            AttributeObserverRegistry::ScopedBatch nested(registry);
+            registry.NotifyAttributeChanged(1, 8, 0);
+        }
+        NL_TEST_ASSERT(apSuite, observer.mChanges == 2 && observer.mEnds == 0);
+    }
+    NL_TEST_ASSERT(apSuite, observer.mEnds == 1);
+
+    // A batch without changes ends nothing
+    {
+        AttributeObserverRegistry::ScopedBatch batch(registry);
+    }
+    NL_TEST_ASSERT(apSuite, observer.mEnds == 1);
+}
+
+void TestUnobserveDuringDispatch(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeObserverRegistry registry;
+    TestObserver first;
+    TestObserver second;
+    AttributeObservation firstObservation(first, 1, 6, 0);
+    AttributeObservation secondObservation(second, 1, 6, 0);
+
+    NL_TEST_ASSERT(apSuite, registry.Observe(firstObservation) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, registry.Observe(secondObservation) == CHIP_NO_ERROR);
+
+    // Whichever is called first unregisters the other, which is then skipped
+    first.mpRegistry     = &registry;
+    first.mpToUnobserve  = &secondObservation;
+    second.mpRegistry    = &registry;
+    second.mpToUnobserve = &firstObservation;
+
+    registry.NotifyAttributeChanged(1, 6, 0);
+    NL_TEST_ASSERT(apSuite, first.mChanges + second.mChanges == 1);
+    NL_TEST_ASSERT(apSuite, firstObservation.IsRegistered() != secondObservation.IsRegistered());
+}
+
+void TestDestruction(nlTestSuite * apSuite, void * apContext)
+{
+    AttributeObserverRegistry registry;
+    TestObserver observer;
+
+    {
+        AttributeObservation observation(observer, 1, 6);
+        NL_TEST_ASSERT(apSuite, registry.Observe(observation) == CHIP_NO_ERROR);
+    }
+    registry.NotifyAttributeChanged(1, 6, 0);
+    NL_TEST_ASSERT(apSuite, observer.mChanges == 0);
+
+    // An observer destroyed while waiting for the end of a batch is not called
+    registry.BeginBatch();
+    {
+        TestObserver pending;
+        AttributeObservation observation(pending, 1, 6);
+        NL_TEST_ASSERT(apSuite, registry.Observe(observation) == CHIP_NO_ERROR);
+        registry.NotifyAttributeChanged(1, 6, 0);
+        NL_TEST_ASSERT(apSuite, pending.mChanges == 1);
+    }
+    registry.EndBatch();
+}
+
+} // namespace TestAttributeObserverRegistry
+} // namespace app
+} // namespace chip
+
+namespace {
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestDispatch", chip::app::TestAttributeObserverRegistry::TestDispatch),
+    NL_TEST_DEF("TestBatch", chip::app::TestAttributeObserverRegistry::TestBatch),
+    NL_TEST_DEF("TestUnobserveDuringDispatch", chip::app::TestAttributeObserverRegistry::TestUnobserveDuringDispatch),
+    NL_TEST_DEF("TestDestruction", chip::app::TestAttributeObserverRegistry::TestDestruction),
+    NL_TEST_SENTINEL()
+};
+}
+
+int TestAttributeObserverRegistry()
+{
+    nlTestSuite theSuite = { "AttributeObserverRegistry", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeObserverRegistry)
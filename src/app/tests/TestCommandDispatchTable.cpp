@@ -0,0 +1,190 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for CommandDispatchTable
+ *
+ */
+
+#include <app/CommandDispatchTable.h>
+#include <core/CHIPTLV.h>
+#include <nlunit-test.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace TestCommandDispatchTable {
+
+void InvokeNothing(Command * apCommandObj, const CommandArgument * apArguments) {}
+
+constexpr CommandArgumentType kArguments[] = {
+    CommandArgumentTypeOf<uint8_t>::value,
+    CommandArgumentTypeOf<int16_t>::value,
+    CommandArgumentTypeOf<ByteSpan>::value,
+    CommandArgumentTypeOf<uint8_t *>::value,
+};
+
+// Not sorted, as the descriptors generated for the clusters sorted by name
+constexpr CommandDescriptor kDescriptors[] = {
+    { 0x0103, 1, nullptr, 0, InvokeNothing },
+    { 0x0028, 2, kArguments, ArraySize(kArguments), InvokeNothing },
+    { 0x0103, 0, nullptr, 0, InvokeNothing },
+    { 0xf000, 0, nullptr, 0, InvokeNothing },
+    { 0x0028, 0, nullptr, 0, InvokeNothing },
+    {},
+};
+
+constexpr auto kTable = MakeCommandDispatchTable(kDescriptors);
+static_assert(kTable.IsValid(), "The table must be valid");
+
+constexpr CommandDescriptor kDuplicateDescriptors[] = {
+    { 0x0028, 0, nullptr, 0, InvokeNothing },
+    { 0x0028, 0, nullptr, 0, InvokeNothing },
+    {},
+};
+static_assert(!MakeCommandDispatchTable(kDuplicateDescriptors).IsValid(), "A command listed twice must be caught");
+
+void TestFind(nlTestSuite * apSuite, void * apContext)
+{
+    for (size_t i = 0; i < ArraySize(kDescriptors) - 1; i++)
+    {
+        const CommandDescriptor * descriptor = kTable.Find(kDescriptors[i].mClusterId, kDescriptors[i].mCommandId);
+        NL_TEST_ASSERT(apSuite, descriptor != nullptr);
+        NL_TEST_ASSERT(apSuite, descriptor->mClusterId == kDescriptors[i].mClusterId);
+        NL_TEST_ASSERT(apSuite, descriptor->mCommandId == kDescriptors[i].mCommandId);
+        NL_TEST_ASSERT(apSuite, descriptor->mArgumentCount == kDescriptors[i].mArgumentCount);
+    }
+
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0028, 1) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0006, 0) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0xf000, 1) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0xffff, 0xff) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0, 0) == nullptr);
+
+    constexpr CommandDescriptor kEmptyDescriptors[] = { {} };
+    NL_TEST_ASSERT(apSuite, MakeCommandDispatchTable(kEmptyDescriptors).Find(0, 0) == nullptr);
+}
+
+// Added to a tag to encode a boolean with it
+constexpr uint8_t kBooleanTag = 0x10;
+
+// Encodes the command data, with the arguments of the given tags, and leaves the reader in it
+void EncodeCommandData(nlTestSuite * apSuite, uint8_t * apBuffer, size_t aBufferSize, TLV::TLVReader & aReader,
+                       const uint8_t * apTags, size_t aTagCount)
+{
+    static const uint8_t kData[] = { 1, 2, 3 };
+    TLV::TLVWriter writer;
+    TLV::TLVType type;
+
+    writer.Init(apBuffer, static_cast<uint32_t>(aBufferSize));
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, type) == CHIP_NO_ERROR);
+    for (size_t i = 0; i < aTagCount; i++)
+    {
+        uint64_t tag = TLV::ContextTag(static_cast<uint8_t>(apTags[i] % kBooleanTag));
+        switch (apTags[i])
+        {
+        case 0:
+            NL_TEST_ASSERT(apSuite, writer.Put(tag, static_cast<uint8_t>(200)) == CHIP_NO_ERROR);
+            break;
+        case 1:
+            NL_TEST_ASSERT(apSuite, writer.Put(tag, static_cast<int16_t>(-300)) == CHIP_NO_ERROR);
+            break;
+        case 2:
+            NL_TEST_ASSERT(apSuite, writer.PutBytes(tag, kData, sizeof(kData)) == CHIP_NO_ERROR);
+            break;
+        case 3:
+            NL_TEST_ASSERT(apSuite, writer.PutString(tag, "FR") == CHIP_NO_ERROR);
+            break;
+        default:
+            NL_TEST_ASSERT(apSuite, writer.Put(tag, true) == CHIP_NO_ERROR);
+            break;
+        }
+    }
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(type) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    aReader.Init(apBuffer, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, aReader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, aReader.EnterContainer(type) == CHIP_NO_ERROR);
+}
+
+CHIP_ERROR Decode(nlTestSuite * apSuite, const uint8_t * apTags, size_t aTagCount, CommandArgument * apArguments)
+{
+    uint8_t buffer[64];
+    TLV::TLVReader reader;
+
+    EncodeCommandData(apSuite, buffer, sizeof(buffer), reader, apTags, aTagCount);
+    return DecodeCommandArguments(*kTable.Find(0x0028, 2), reader, apArguments);
+}
+
+void TestDecodeArguments(nlTestSuite * apSuite, void * apContext)
+{
+    // In any order, with the unknown tag 7 ignored
+    const uint8_t kTags[] = { 3, 1, 7, 0, 2 };
+    CommandArgument arguments[kMaxCommandArguments];
+    uint8_t buffer[64];
+    TLV::TLVReader reader;
+
+    EncodeCommandData(apSuite, buffer, sizeof(buffer), reader, kTags, sizeof(kTags));
+    NL_TEST_ASSERT(apSuite, DecodeCommandArguments(*kTable.Find(0x0028, 2), reader, arguments) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, arguments[0].Get<uint8_t>() == 200);
+    NL_TEST_ASSERT(apSuite, arguments[1].Get<int16_t>() == -300);
+    ByteSpan data = arguments[2].Get<ByteSpan>();
+    NL_TEST_ASSERT(apSuite, data.size() == 3 && data.data()[0] == 1 && data.data()[2] == 3);
+    NL_TEST_ASSERT(apSuite, memcmp(arguments[3].Get<uint8_t *>(), "FR", 2) == 0);
+}
+
+void TestDecodeInvalidArguments(nlTestSuite * apSuite, void * apContext)
+{
+    const uint8_t kMissing[]   = { 0, 1, 2 };
+    const uint8_t kDuplicate[] = { 0, 1, 2, 3, 1 };
+    const uint8_t kWrongType[] = { 0, 1, 2, kBooleanTag + 3 };
+    CommandArgument arguments[kMaxCommandArguments];
+
+    NL_TEST_ASSERT(apSuite, Decode(apSuite, kMissing, sizeof(kMissing), arguments) == CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT);
+    NL_TEST_ASSERT(apSuite,
+                   Decode(apSuite, kDuplicate, sizeof(kDuplicate), arguments) == CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT);
+    NL_TEST_ASSERT(apSuite, Decode(apSuite, kWrongType, sizeof(kWrongType), arguments) == CHIP_ERROR_WRONG_TLV_TYPE);
+}
+
+} // namespace TestCommandDispatchTable
+} // namespace app
+} // namespace chip
+
+namespace {
+const nlTest sTests[] = { NL_TEST_DEF("TestFind", chip::app::TestCommandDispatchTable::TestFind),
+                          NL_TEST_DEF("TestDecodeArguments", chip::app::TestCommandDispatchTable::TestDecodeArguments),
+                          NL_TEST_DEF("TestDecodeInvalidArguments",
+                                      chip::app::TestCommandDispatchTable::TestDecodeInvalidArguments),
+                          NL_TEST_SENTINEL() };
+}
+
+int TestCommandDispatchTable()
+{
+    nlTestSuite theSuite = { "CommandDispatchTable", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommandDispatchTable)
@@ -59,9 +59,14 @@ public:
     static void TestCommandHandlerWithSendSimpleStatusCode(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendEmptyResponse(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithProcessReceivedMsg(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerWithProcessReceivedBatch(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerWithProcessReceivedGroupCommand(nlTestSuite * apSuite, void * apContext);
 
 private:
-    static void GenerateReceivedCommand(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload);
+    static void GenerateReceivedCommand(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
+                                        bool aToGroup = false);
+    static void GenerateReceivedEmptyCommands(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
+                                              EndpointId aNumEndpoints);
     static void AddCommandDataElement(nlTestSuite * apSuite, void * apContext, Command * apCommand, bool aNeedStatusCode,
                                       bool aIsEmptyResponse);
     static void ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode,
@@ -77,7 +82,38 @@ class TestExchangeDelegate : public Messaging::ExchangeDelegate
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
 };
 
-void TestCommandInteraction::GenerateReceivedCommand(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload)
+class TestCommandStatusDelegate : public InteractionModelDelegate
+{
+public:
+    CHIP_ERROR CommandResponseStatus(const CommandSender * apCommandSender,
+                                     const Protocols::SecureChannel::GeneralStatusCode aGeneralCode, const uint32_t aProtocolId,
+                                     const uint16_t aProtocolCode, chip::EndpointId aEndpointId, const chip::ClusterId aClusterId,
+                                     chip::CommandId aCommandId, uint8_t aCommandIndex) override
+    {
+        if (mNumStatus < kMaxStatus)
+        {
+            mEndpoints[mNumStatus]      = aEndpointId;
+            mCommandIndexes[mNumStatus] = aCommandIndex;
+        }
+        mNumStatus++;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR CommandResponseProtocolError(const CommandSender * apCommandSender, uint8_t aCommandIndex) override
+    {
+        mNumProtocolError++;
+        return CHIP_NO_ERROR;
+    }
+
+    static constexpr size_t kMaxStatus = 4;
+    EndpointId mEndpoints[kMaxStatus];
+    uint8_t mCommandIndexes[kMaxStatus];
+    size_t mNumStatus        = 0;
+    size_t mNumProtocolError = 0;
+};
+
+void TestCommandInteraction::GenerateReceivedCommand(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
+                                                     bool aToGroup)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     InvokeCommand::Builder invokeCommandBuilder;
@@ -94,7 +130,14 @@ void TestCommandInteraction::GenerateReceivedCommand(nlTestSuite * apSuite, void
     NL_TEST_ASSERT(apSuite, commandList.GetError() == CHIP_NO_ERROR);
     CommandPath::Builder commandPathBuilder = commandDataElementBuilder.CreateCommandPathBuilder();
     NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
-    commandPathBuilder.EndpointId(1).ClusterId(3).CommandId(4).EndOfCommandPath();
+    if (aToGroup)
+    {
+        commandPathBuilder.GroupId(2).ClusterId(3).CommandId(4).EndOfCommandPath();
+    }
+    else
+    {
+        commandPathBuilder.EndpointId(1).ClusterId(3).CommandId(4).EndOfCommandPath();
+    }
     NL_TEST_ASSERT(apSuite, commandPathBuilder.GetError() == CHIP_NO_ERROR);
 
     chip::TLV::TLVWriter * pWriter = commandDataElementBuilder.GetWriter();
@@ -121,6 +164,44 @@ void TestCommandInteraction::GenerateReceivedCommand(nlTestSuite * apSuite, void
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 }
 
+void TestCommandInteraction::GenerateReceivedEmptyCommands(nlTestSuite * apSuite, void * apContext,
+                                                           System::PacketBufferHandle & aPayload, EndpointId aNumEndpoints)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    InvokeCommand::Builder invokeCommandBuilder;
+    System::PacketBufferTLVWriter writer;
+    writer.Init(std::move(aPayload));
+
+    err = invokeCommandBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    CommandList::Builder commandList = invokeCommandBuilder.CreateCommandListBuilder();
+    NL_TEST_ASSERT(apSuite, invokeCommandBuilder.GetError() == CHIP_NO_ERROR);
+
+    // The same command without data, once on every endpoint.
+    for (EndpointId endpoint = 1; endpoint <= aNumEndpoints; endpoint++)
+    {
+        CommandDataElement::Builder commandDataElementBuilder = commandList.CreateCommandDataElementBuilder();
+        NL_TEST_ASSERT(apSuite, commandList.GetError() == CHIP_NO_ERROR);
+        CommandPath::Builder commandPathBuilder = commandDataElementBuilder.CreateCommandPathBuilder();
+        NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
+        commandPathBuilder.EndpointId(endpoint).ClusterId(3).CommandId(4).EndOfCommandPath();
+        NL_TEST_ASSERT(apSuite, commandPathBuilder.GetError() == CHIP_NO_ERROR);
+
+        commandDataElementBuilder.EndOfCommandDataElement();
+        NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
+    }
+
+    commandList.EndOfCommandList();
+    NL_TEST_ASSERT(apSuite, commandList.GetError() == CHIP_NO_ERROR);
+
+    invokeCommandBuilder.EndOfInvokeCommand();
+    NL_TEST_ASSERT(apSuite, invokeCommandBuilder.GetError() == CHIP_NO_ERROR);
+
+    err = writer.Finalize(&aPayload);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+}
+
 void TestCommandInteraction::AddCommandDataElement(nlTestSuite * apSuite, void * apContext, Command * apCommand,
                                                    bool aNeedStatusCode, bool aIsEmptyResponse)
 {
@@ -281,6 +362,59 @@ void TestCommandInteraction::TestCommandHandlerWithProcessReceivedMsg(nlTestSuit
     commandHandler.Shutdown();
 }
 
+void TestCommandInteraction::TestCommandHandlerWithProcessReceivedBatch(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err                     = CHIP_NO_ERROR;
+    constexpr EndpointId kNumEndpoints = 3;
+    app::CommandHandler commandHandler;
+    app::CommandSender commandSender;
+    TestCommandStatusDelegate delegate;
+    System::PacketBufferHandle commandDatabuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+
+    err = commandHandler.Init(&chip::gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    GenerateReceivedEmptyCommands(apSuite, apContext, commandDatabuf, kNumEndpoints);
+    err = commandHandler.ProcessCommandMessage(std::move(commandDatabuf), Command::CommandRoleId::HandlerId);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Every command of the batch is answered in the same response, by a status with the path of the command.
+    err = commandHandler.FinalizeCommandsMessage();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = commandSender.Init(&gExchangeManager, &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = commandSender.ProcessCommandMessage(std::move(commandHandler.mCommandMessageBuf), Command::CommandRoleId::SenderId);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, delegate.mNumProtocolError == 0);
+    NL_TEST_ASSERT(apSuite, delegate.mNumStatus == kNumEndpoints);
+    for (size_t i = 0; i < kNumEndpoints && i < delegate.mNumStatus; i++)
+    {
+        NL_TEST_ASSERT(apSuite, delegate.mEndpoints[i] == i + 1);
+        NL_TEST_ASSERT(apSuite, delegate.mCommandIndexes[i] == i + 1);
+    }
+
+    commandSender.Shutdown();
+    commandHandler.Shutdown();
+}
+
+void TestCommandInteraction::TestCommandHandlerWithProcessReceivedGroupCommand(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::CommandHandler commandHandler;
+    System::PacketBufferHandle commandDatabuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+
+    err = commandHandler.Init(&chip::gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    GenerateReceivedCommand(apSuite, apContext, commandDatabuf, true /* aToGroup */);
+    err = commandHandler.ProcessCommandMessage(std::move(commandDatabuf), Command::CommandRoleId::HandlerId);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // A command without an endpoint is accepted when it has a group, and the request is then not answered.
+    NL_TEST_ASSERT(apSuite, commandHandler.mGroupRequest);
+    commandHandler.Shutdown();
+}
+
 } // namespace app
 } // namespace chip
 
@@ -320,6 +454,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleStatusCode", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode),
     NL_TEST_DEF("TestCommandHandlerWithSendEmptyResponse", chip::app::TestCommandInteraction::TestCommandHandlerWithSendEmptyResponse),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedMsg),
+    NL_TEST_DEF("TestCommandHandlerWithProcessReceivedBatch", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedBatch),
+    NL_TEST_DEF("TestCommandHandlerWithProcessReceivedGroupCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedGroupCommand),
     NL_TEST_SENTINEL()
 };
 // clang-format on
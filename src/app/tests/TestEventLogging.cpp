@@ -26,6 +26,7 @@
 #include <app/EventLoggingTypes.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/PersistentEventLog.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPTLV.h>
 #include <core/CHIPTLVDebug.hpp>
@@ -44,11 +45,13 @@
 
 #include <nlunit-test.h>
 
+#include <string.h>
+
 namespace {
 
 static const chip::NodeId kTestDeviceNodeId     = 0x18B4300000000001ULL;
 static const chip::ClusterId kLivenessClusterId = 0x00000022;
-static const uint32_t kLivenessChangeEvent      = 1;
+static const chip::EventId kLivenessChangeEvent = 1;
 static const chip::EndpointId kTestEndpointId   = 2;
 static const uint64_t kLivenessDeviceStatus     = chip::TLV::ContextTag(1);
 static const chip::Transport::AdminId gAdminId  = 0;
@@ -59,6 +62,7 @@ static uint8_t gDebugEventBuffer[128];
 static uint8_t gInfoEventBuffer[128];
 static uint8_t gCritEventBuffer[128];
 static chip::app::CircularEventBuffer gCircularEventBuffer[3];
+static uint8_t gEventPool[512];
 
 chip::SecureSessionMgr gSessionManager;
 chip::Messaging::ExchangeManager gExchangeManager;
@@ -87,9 +91,9 @@ void InitializeChip(nlTestSuite * apSuite)
 void InitializeEventLogging()
 {
     chip::app::LogStorageResources logStorageResources[] = {
-        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), nullptr, 0, nullptr, chip::app::PriorityLevel::Debug },
-        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), nullptr, 0, nullptr, chip::app::PriorityLevel::Info },
-        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), nullptr, 0, nullptr, chip::app::PriorityLevel::Critical },
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Debug },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Info },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Critical },
     };
 
     chip::app::EventManagement::CreateEventManagement(
@@ -159,6 +163,68 @@ static void CheckLogReadOut(nlTestSuite * apSuite, chip::app::EventManagement &
     chip::TLV::Debug::Dump(reader, SimpleDumpWriter);
 }
 
+class TestEventStorage : public chip::PersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        VerifyOrReturnError(strcmp(key, mKey) == 0, CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(mSize <= size, CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(buffer, mValue, mSize);
+        size = mSize;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        VerifyOrReturnError(mKey[0] == '\0' || strcmp(key, mKey) == 0, CHIP_ERROR_NO_MEMORY);
+        VerifyOrReturnError(size <= sizeof(mValue), CHIP_ERROR_NO_MEMORY);
+        strncpy(mKey, key, sizeof(mKey) - 1);
+        memcpy(mValue, value, size);
+        mSize = size;
+        mWrites++;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    uint32_t mWrites = 0;
+
+private:
+    char mKey[16] = {};
+    uint8_t mValue[chip::app::PersistentEventLog::kBlockSize];
+    uint16_t mSize = 0;
+};
+
+struct PersistedStatuses
+{
+    static CHIP_ERROR Add(void * apContext, chip::EventNumber aEventNumber, uint64_t aSystemTimestamp, const uint8_t * apEvent,
+                          uint16_t aEventLength)
+    {
+        PersistedStatuses * statuses = static_cast<PersistedStatuses *>(apContext);
+        chip::app::EventDataElement::Parser parser;
+        chip::TLV::TLVReader reader;
+        chip::TLV::TLVType dataType;
+        uint64_t deltaTime = 1;
+
+        reader.Init(apEvent, aEventLength);
+        ReturnErrorOnFailure(reader.Next());
+        ReturnErrorOnFailure(parser.Init(reader));
+        ReturnErrorOnFailure(parser.GetDeltaSystemTimestamp(&deltaTime));
+        VerifyOrReturnError(deltaTime == 0 && statuses->mCount < 4, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(parser.GetData(&reader));
+        ReturnErrorOnFailure(reader.EnterContainer(dataType));
+        ReturnErrorOnFailure(reader.Next());
+        ReturnErrorOnFailure(reader.Get(statuses->mStatuses[statuses->mCount]));
+        statuses->mNumbers[statuses->mCount++] = aEventNumber;
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mCount = 0;
+    chip::EventNumber mNumbers[4];
+    int32_t mStatuses[4];
+};
+
 class TestEventGenerator : public chip::app::EventLoggingDelegate
 {
 public:
@@ -270,12 +336,312 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+
+static void CheckFetchEventsSinceEachEvent(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid;
+    chip::app::EventSchema schema = { kTestDeviceNodeId, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent,
+                                      chip::app::PriorityLevel::Info };
+    chip::app::EventOptions options;
+    TestEventGenerator testEventGenerator;
+
+    options.mpEventSchema = &schema;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Wrap around the buffers, so that the oldest events are dropped
+    for (int32_t status = 0; status < 16; status++)
+    {
+        testEventGenerator.SetStatus(status);
+        err = logMgmt.LogEvent(&testEventGenerator, options, eid);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    chip::EventNumber first = logMgmt.GetFirstEventNumber(chip::app::PriorityLevel::Info);
+    chip::EventNumber last  = logMgmt.GetLastEventNumber(chip::app::PriorityLevel::Info);
+    NL_TEST_ASSERT(apSuite, last == eid);
+
+    for (chip::EventNumber since = first; since <= last; since++)
+    {
+        chip::TLV::TLVReader reader;
+        chip::TLV::TLVWriter writer;
+        chip::app::EventDataElement::Parser eventDataElementParser;
+        uint8_t backingStore[1024];
+        size_t elementCount;
+        uint64_t number               = 0;
+        chip::EventNumber fetchNumber = since;
+
+        writer.Init(backingStore, sizeof(backingStore));
+        err = logMgmt.FetchEventsSince(writer, chip::app::PriorityLevel::Info, fetchNumber);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+
+        reader.Init(backingStore, writer.GetLengthWritten());
+        err = chip::TLV::Utilities::Count(reader, elementCount, false);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, elementCount == last - since + 1);
+
+        // The first event fetched carries its number
+        reader.Init(backingStore, writer.GetLengthWritten());
+        err = reader.Next();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = eventDataElementParser.Init(reader);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = eventDataElementParser.GetNumber(&number);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && number == since);
+    }
+}
+
+static void CheckFetchEventsSinceWithPaths(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err                  = CHIP_NO_ERROR;
+    const chip::EventId kOtherEvent = kLivenessChangeEvent + 1;
+    chip::EventNumber eids[4];
+    chip::app::EventOptions options;
+    TestEventGenerator testEventGenerator;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Alternate between two events of the cluster
+    for (int32_t status = 0; status < 4; status++)
+    {
+        chip::app::EventSchema schema = { kTestDeviceNodeId, kTestEndpointId, kLivenessClusterId,
+                                          (status % 2 == 0) ? kLivenessChangeEvent : kOtherEvent, chip::app::PriorityLevel::Info };
+        options.mpEventSchema         = &schema;
+        testEventGenerator.SetStatus(status);
+        err = logMgmt.LogEvent(&testEventGenerator, options, eids[status]);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    chip::app::EventPathParams paths[2];
+    paths[0] = chip::app::EventPathParams(kTestDeviceNodeId, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent, false);
+    paths[1] = chip::app::EventPathParams(kTestDeviceNodeId, kTestEndpointId, kLivenessClusterId, 0, false);
+    paths[1].mFlags.Set(chip::app::EventPathFlags::kEventIdWildcard);
+
+    for (size_t pathIndex = 0; pathIndex < 2; pathIndex++)
+    {
+        // Only the first path leaves events out
+        const bool filtered = (pathIndex == 0);
+        chip::TLV::TLVReader reader;
+        chip::TLV::TLVWriter writer;
+        chip::app::EventDataElement::Parser eventDataElementParser;
+        uint8_t backingStore[1024];
+        size_t elementCount;
+        uint64_t number               = 0;
+        chip::EventNumber fetchNumber = eids[0];
+
+        writer.Init(backingStore, sizeof(backingStore));
+        err = logMgmt.FetchEventsSince(writer, chip::app::PriorityLevel::Info, fetchNumber, &paths[pathIndex], 1, 0);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+        NL_TEST_ASSERT(apSuite, fetchNumber == eids[3] + 1);
+
+        reader.Init(backingStore, writer.GetLengthWritten());
+        err = chip::TLV::Utilities::Count(reader, elementCount, false);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, elementCount == (filtered ? 2u : 4u));
+
+        // The second event fetched only carries its number if the event before it was left out
+        reader.Init(backingStore, writer.GetLengthWritten());
+        err = reader.Next();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = reader.Next();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = eventDataElementParser.Init(reader);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = eventDataElementParser.GetNumber(&number);
+        NL_TEST_ASSERT(apSuite, filtered ? (err == CHIP_NO_ERROR && number == eids[2]) : err == CHIP_END_OF_TLV);
+    }
+}
+
+static void CheckFetchEventsSinceWithReservedSize(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::TLV::TLVWriter writer;
+    uint8_t backingStore[1024];
+    uint32_t lengthWritten;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    chip::EventNumber first              = logMgmt.GetFirstEventNumber(chip::app::PriorityLevel::Info);
+    chip::EventNumber fetchNumber        = first;
+
+    writer.Init(backingStore, sizeof(backingStore));
+    err = logMgmt.FetchEventsSince(writer, chip::app::PriorityLevel::Info, fetchNumber, nullptr, 0, 0);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+    lengthWritten = writer.GetLengthWritten();
+
+    // Reserving all but one byte of the room the events take leaves the last event out
+    fetchNumber = first;
+    writer.Init(backingStore, sizeof(backingStore));
+    err = logMgmt.FetchEventsSince(writer, chip::app::PriorityLevel::Info, fetchNumber, nullptr, 0,
+                                   static_cast<uint32_t>(sizeof(backingStore)) - lengthWritten + 1);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(apSuite, fetchNumber == logMgmt.GetLastEventNumber(chip::app::PriorityLevel::Info));
+    NL_TEST_ASSERT(apSuite, writer.GetLengthWritten() < lengthWritten);
+}
+
+static uint32_t GetPoolLength()
+{
+    uint32_t length = 0;
+    for (auto & buffer : gCircularEventBuffer)
+    {
+        length += buffer.GetTotalDataLength();
+    }
+    return length;
+}
+
+static void CheckLogEventWithSharedPool(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid;
+    chip::app::EventSchema schema = { kTestDeviceNodeId, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent,
+                                      chip::app::PriorityLevel::Debug };
+    chip::app::EventOptions options;
+    TestEventGenerator testEventGenerator;
+    chip::app::CircularEventBuffer & debugBuffer = gCircularEventBuffer[0];
+    chip::app::CircularEventBuffer & infoBuffer  = gCircularEventBuffer[1];
+    chip::app::CircularEventBuffer & critBuffer  = gCircularEventBuffer[2];
+    chip::app::LogStorageResources logStorageResources[] = {
+        { nullptr, 128, nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Debug, 0, 256 },
+        { nullptr, 128, nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Info, 64, 0 },
+        { nullptr, 192, nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Critical, 64, 0 },
+    };
+
+    chip::app::EventManagement::CreateEventManagement(&gExchangeManager,
+                                                      sizeof(logStorageResources) / sizeof(logStorageResources[0]),
+                                                      gCircularEventBuffer, logStorageResources, gEventPool, sizeof(gEventPool));
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // The buffers of more important events come first, and the critical buffer starts with the rest of the pool
+    NL_TEST_ASSERT(apSuite, critBuffer.GetQueue() == &gEventPool[0] && critBuffer.GetTotalDataLength() == 256);
+    NL_TEST_ASSERT(apSuite, infoBuffer.GetQueue() == &gEventPool[256] && infoBuffer.GetTotalDataLength() == 128);
+    NL_TEST_ASSERT(apSuite, debugBuffer.GetQueue() == &gEventPool[384] && debugBuffer.GetTotalDataLength() == 128);
+
+    // A burst of debug events takes the free space of the idle buffers, up to the most the debug buffer may have
+    options.mpEventSchema = &schema;
+    for (int32_t i = 0; i < 20; i++)
+    {
+        testEventGenerator.SetStatus(i);
+        err = logMgmt.LogEvent(&testEventGenerator, options, eid);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, debugBuffer.GetTotalDataLength() <= 256);
+        NL_TEST_ASSERT(apSuite, GetPoolLength() == sizeof(gEventPool));
+    }
+    NL_TEST_ASSERT(apSuite, debugBuffer.GetTotalDataLength() == 256 && debugBuffer.DataLength() > 128);
+    NL_TEST_ASSERT(apSuite, infoBuffer.GetTotalDataLength() == 64);
+    NL_TEST_ASSERT(apSuite, critBuffer.GetTotalDataLength() == 192);
+    NL_TEST_ASSERT(apSuite, critBuffer.GetQueue() + critBuffer.GetTotalDataLength() == infoBuffer.GetQueue());
+    NL_TEST_ASSERT(apSuite, infoBuffer.GetQueue() + infoBuffer.GetTotalDataLength() == debugBuffer.GetQueue());
+
+    // The events that moved with the space are still read in order
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Debug, logMgmt.GetFirstEventNumber(chip::app::PriorityLevel::Debug),
+                    static_cast<size_t>(eid - logMgmt.GetFirstEventNumber(chip::app::PriorityLevel::Debug) + 1));
+}
+
+static void CheckLogEventWithRelinkedEvents(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid, firstEid = 0;
+    chip::app::EventSchema schema = { kTestDeviceNodeId, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent,
+                                      chip::app::PriorityLevel::Info };
+    chip::app::EventOptions options;
+    TestEventGenerator testEventGenerator;
+    chip::app::CircularEventBuffer & debugBuffer = gCircularEventBuffer[0];
+    chip::app::CircularEventBuffer & infoBuffer  = gCircularEventBuffer[1];
+    chip::app::LogStorageResources logStorageResources[] = {
+        { nullptr, 256, nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Debug, 128, 256 },
+        { nullptr, 64, nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Info, 0, 0 },
+        { nullptr, 192, nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Critical, 64, 0 },
+    };
+
+    chip::app::EventManagement::CreateEventManagement(&gExchangeManager,
+                                                      sizeof(logStorageResources) / sizeof(logStorageResources[0]),
+                                                      gCircularEventBuffer, logStorageResources, gEventPool, sizeof(gEventPool));
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // The oldest info events lie against the bound of the info buffer, which moves instead of the events being copied
+    options.mpEventSchema = &schema;
+    for (int32_t i = 0; i < 9; i++)
+    {
+        testEventGenerator.SetStatus(i);
+        err = logMgmt.LogEvent(&testEventGenerator, options, eid);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, GetPoolLength() == sizeof(gEventPool));
+        NL_TEST_ASSERT(apSuite, debugBuffer.GetTotalDataLength() >= 128);
+        if (i == 0)
+        {
+            firstEid = eid;
+        }
+    }
+    NL_TEST_ASSERT(apSuite, infoBuffer.GetTotalDataLength() > 64 && debugBuffer.GetTotalDataLength() < 256);
+    NL_TEST_ASSERT(apSuite, infoBuffer.GetQueue() + infoBuffer.GetTotalDataLength() == debugBuffer.GetQueue());
+    NL_TEST_ASSERT(apSuite, logMgmt.GetFirstEventNumber(chip::app::PriorityLevel::Info) == firstEid);
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Info, firstEid, 9);
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Info, eid, 1);
+}
+
+static void CheckLogEventWithPersistentLog(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid[4];
+    chip::app::EventSchema schema = { kTestDeviceNodeId, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent,
+                                      chip::app::PriorityLevel::Critical };
+    chip::app::EventOptions options;
+    TestEventGenerator testEventGenerator;
+    TestEventStorage storage;
+    chip::app::PersistentEventLog log;
+    chip::app::PersistentEventLog reloaded;
+    PersistedStatuses statuses;
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, chip::app::PriorityLevel::Critical) == CHIP_NO_ERROR);
+
+    chip::app::LogStorageResources logStorageResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Debug },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Info },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), nullptr, 0, 0, nullptr, chip::app::PriorityLevel::Critical, 0, 0,
+          &log },
+    };
+    chip::app::EventManagement::CreateEventManagement(
+        &gExchangeManager, sizeof(logStorageResources) / sizeof(logStorageResources[0]), gCircularEventBuffer, logStorageResources);
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // The critical events are staged by the log, until an urgent one writes them out
+    options.mpEventSchema = &schema;
+    for (int32_t i = 0; i < 4; i++)
+    {
+        options.mUrgent = (i == 3) ? chip::app::EventOptions::Type::kUrgent : chip::app::EventOptions::Type::kNotUrgent;
+        testEventGenerator.SetStatus(i);
+        err = logMgmt.LogEvent(&testEventGenerator, options, eid[i]);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, storage.mWrites == ((i == 3) ? 1u : 0u));
+    }
+    NL_TEST_ASSERT(apSuite, log.GetStagedEventCount() == 0);
+
+    // After a restart, the saved events are read back as they were logged
+    NL_TEST_ASSERT(apSuite, reloaded.Init(&storage, chip::app::PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reloaded.Iterate(eid[1], PersistedStatuses::Add, &statuses) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, statuses.mCount == 3);
+    for (size_t i = 0; i < statuses.mCount; i++)
+    {
+        NL_TEST_ASSERT(apSuite, statuses.mNumbers[i] == eid[i + 1]);
+        NL_TEST_ASSERT(apSuite, statuses.mStatuses[i] == static_cast<int32_t>(i + 1));
+    }
+
+    InitializeEventLogging();
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckFetchEventsSinceEachEvent", CheckFetchEventsSinceEachEvent),
+                          NL_TEST_DEF("CheckFetchEventsSinceWithPaths", CheckFetchEventsSinceWithPaths),
+                          NL_TEST_DEF("CheckFetchEventsSinceWithReservedSize", CheckFetchEventsSinceWithReservedSize),
+                          NL_TEST_DEF("CheckLogEventWithSharedPool", CheckLogEventWithSharedPool),
+                          NL_TEST_DEF("CheckLogEventWithRelinkedEvents", CheckLogEventWithRelinkedEvents),
+                          NL_TEST_DEF("CheckLogEventWithPersistentLog", CheckLogEventWithPersistentLog),
+                          NL_TEST_SENTINEL() };
 } // namespace
 
 int TestEventLogging()
@@ -55,6 +55,7 @@ class TestInteractionModelEngine
 {
 public:
     static void TestClusterInfoPushRelease(nlTestSuite * apSuite, void * apContext);
+    static void TestReadClientPool(nlTestSuite * apSuite, void * apContext);
     static int GetClusterInfoListLength(ClusterInfo * apClusterInfoList);
 };
 
@@ -95,6 +96,39 @@ void TestInteractionModelEngine::TestClusterInfoPushRelease(nlTestSuite * apSuit
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(clusterInfoList);
     NL_TEST_ASSERT(apSuite, GetClusterInfoListLength(clusterInfoList) == 0);
 }
+
+void TestInteractionModelEngine::TestReadClientPool(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    ReadClient * readClients[CHIP_MAX_NUM_READ_CLIENT];
+    ReadClient * readClient = nullptr;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    for (auto & client : readClients)
+    {
+        err = InteractionModelEngine::GetInstance()->NewReadClient(&client);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && client != nullptr);
+    }
+
+    // The bound is enforced.
+    err = InteractionModelEngine::GetInstance()->NewReadClient(&readClient);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NO_MEMORY);
+
+    // Shutting a client down returns it to the pool, once however many times it is shut down.
+    readClients[0]->Shutdown();
+    readClients[0]->Shutdown();
+    err = InteractionModelEngine::GetInstance()->NewReadClient(&readClient);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && readClient == readClients[0]);
+    err = InteractionModelEngine::GetInstance()->NewReadClient(&readClient);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NO_MEMORY);
+
+    for (auto & client : readClients)
+    {
+        client->Shutdown();
+    }
+}
 } // namespace app
 } // namespace chip
 
@@ -124,6 +158,7 @@ void InitializeChip(nlTestSuite * apSuite)
 const nlTest sTests[] =
         {
                 NL_TEST_DEF("TestClusterInfoPushRelease", chip::app::TestInteractionModelEngine::TestClusterInfoPushRelease),
+                NL_TEST_DEF("TestReadClientPool", chip::app::TestInteractionModelEngine::TestReadClientPool),
                 NL_TEST_SENTINEL()
         };
 // clang-format on
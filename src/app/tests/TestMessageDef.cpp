@@ -105,6 +105,12 @@ void ParseAttributePath(nlTestSuite * apSuite, chip::TLV::TLVReader & aReader)
 
     err = attributePathParser.GetListIndex(&listIndex);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && listIndex == 5);
+
+    uint32_t presenceMask = 0;
+
+    err = attributePathParser.DecodeAttributePath(&nodeId, &endpointId, &clusterId, &fieldId, &listIndex, &presenceMask);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && presenceMask == 0x1f);
+    NL_TEST_ASSERT(apSuite, nodeId == 1 && endpointId == 2 && clusterId == 3 && fieldId == 4 && listIndex == 5);
 }
 
 void BuildAttributePathList(nlTestSuite * apSuite, AttributePathList::Builder & aAttributePathListBuilder)
@@ -217,6 +223,17 @@ void ParseCommandPath(nlTestSuite * apSuite, chip::TLV::TLVReader & aReader)
 
     err = commandPathParser.GetCommandId(&commandId);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && commandId == 4);
+
+    chip::GroupId groupId = 7;
+    uint32_t presenceMask = 0;
+
+    err = commandPathParser.DecodeCommandPath(&endpointId, &groupId, &clusterId, &commandId, &presenceMask);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   presenceMask ==
+                       ((1u << CommandPath::kCsTag_EndpointId) | (1u << CommandPath::kCsTag_ClusterId) |
+                        (1u << CommandPath::kCsTag_CommandId)));
+    NL_TEST_ASSERT(apSuite, endpointId == 1 && groupId == 0 && clusterId == 3 && commandId == 4);
 }
 
 void BuildEventDataElement(nlTestSuite * apSuite, EventDataElement::Builder & aEventDataElementBuilder)
@@ -761,6 +778,9 @@ void BuildReadRequest(nlTestSuite * apSuite, chip::TLV::TLVWriter & aWriter)
     readRequestBuilder.EventNumber(1);
     NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
 
+    readRequestBuilder.MinEventPriority(2);
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+
     readRequestBuilder.EndOfReadRequest();
     NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
 }
@@ -774,6 +794,7 @@ void ParseReadRequest(nlTestSuite * apSuite, chip::TLV::TLVReader & aReader)
     EventPathList::Parser eventPathListParser;
     AttributeDataVersionList::Parser attributeDataVersionListParser;
     uint64_t eventNumber;
+    uint8_t minEventPriority;
 
     err = readRequestParser.Init(aReader);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -792,6 +813,9 @@ void ParseReadRequest(nlTestSuite * apSuite, chip::TLV::TLVReader & aReader)
 
     err = readRequestParser.GetEventNumber(&eventNumber);
     NL_TEST_ASSERT(apSuite, eventNumber == 1 && err == CHIP_NO_ERROR);
+
+    err = readRequestParser.GetMinEventPriority(&minEventPriority);
+    NL_TEST_ASSERT(apSuite, minEventPriority == 2 && err == CHIP_NO_ERROR);
 }
 
 void BuildWriteRequest(nlTestSuite * apSuite, chip::TLV::TLVWriter & aWriter)
@@ -903,6 +927,42 @@ void AttributePathTest(nlTestSuite * apSuite, void * apContext)
     ParseAttributePath(apSuite, reader);
 }
 
+void AttributePathDuplicateTagTest(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::System::PacketBufferTLVWriter writer;
+    chip::System::PacketBufferTLVReader reader;
+    chip::TLV::TLVType containerType;
+    AttributePath::Parser attributePathParser;
+    chip::NodeId nodeId         = 0;
+    chip::EndpointId endpointId = 0;
+    chip::ClusterId clusterId   = 0;
+    chip::FieldId fieldId       = 0;
+    chip::ListIndex listIndex   = 0;
+    uint32_t presenceMask       = 0;
+
+    writer.Init(chip::System::PacketBufferHandle::New(chip::System::PacketBuffer::kMaxSize));
+    err = writer.StartContainer(chip::TLV::AnonymousTag, chip::TLV::kTLVType_List, containerType);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    writer.Put(chip::TLV::ContextTag(AttributePath::kCsTag_EndpointId), static_cast<uint16_t>(2));
+    writer.Put(chip::TLV::ContextTag(AttributePath::kCsTag_EndpointId), static_cast<uint16_t>(3));
+    err = writer.EndContainer(containerType);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    chip::System::PacketBufferHandle buf;
+    err = writer.Finalize(&buf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    reader.Init(std::move(buf));
+    err = reader.Next();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = attributePathParser.Init(reader);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // A repeated element is rejected, as CheckSchemaValidity would.
+    err = attributePathParser.DecodeAttributePath(&nodeId, &endpointId, &clusterId, &fieldId, &listIndex, &presenceMask);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INVALID_TLV_TAG);
+}
+
 void AttributePathListTest(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1400,6 +1460,90 @@ void CheckPointRollbackTest(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, NumDataElement == 1);
 }
 
+void FixedLayoutEncodingTest(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t expected[128];
+    uint8_t buf[128];
+    uint32_t expectedLen = 0;
+    chip::TLV::TLVWriter writer;
+    CommandList::Builder commandListBuilder;
+    CommandDataElement::Builder commandDataElementBuilder;
+    AttributeDataElement::Builder attributeDataElementBuilder;
+
+    // CommandPath and StatusElement
+    writer.Init(expected, sizeof(expected));
+    commandDataElementBuilder.Init(&writer);
+    BuildCommandDataElementWithStatusCode(apSuite, commandDataElementBuilder);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    expectedLen = writer.GetLengthWritten();
+
+    writer.Init(buf, sizeof(buf));
+    commandDataElementBuilder.Init(&writer);
+    commandDataElementBuilder.EncodeCommandPath(1, 3, 4)
+        .EncodeStatusElement(chip::Protocols::SecureChannel::GeneralStatusCode::kFailure, 2, 3)
+        .EndOfCommandDataElement();
+    NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, writer.GetLengthWritten() == expectedLen);
+    NL_TEST_ASSERT(apSuite, memcmp(buf, expected, expectedLen) == 0);
+
+    // CommandList of CommandDataElements with a CommandPath and a StatusElement
+    writer.Init(expected, sizeof(expected));
+    commandListBuilder.Init(&writer);
+    commandListBuilder.CreateCommandDataElementBuilder()
+        .EncodeCommandPath(1, 3, 4)
+        .EncodeStatusElement(chip::Protocols::SecureChannel::GeneralStatusCode::kFailure, 2, 3)
+        .EndOfCommandDataElement();
+    commandListBuilder.CreateCommandDataElementBuilder()
+        .EncodeCommandPath(0xFF, 0xFFFC, 0xAB)
+        .EncodeStatusElement(chip::Protocols::SecureChannel::GeneralStatusCode::kSuccess, 0, 0)
+        .EndOfCommandDataElement();
+    NL_TEST_ASSERT(apSuite, commandListBuilder.GetCommandDataElementBuilder().GetError() == CHIP_NO_ERROR);
+    commandListBuilder.EndOfCommandList();
+    NL_TEST_ASSERT(apSuite, commandListBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    expectedLen = writer.GetLengthWritten();
+
+    writer.Init(buf, sizeof(buf));
+    commandListBuilder.Init(&writer);
+    commandListBuilder.EncodeStatusResponse(1, 3, 4, chip::Protocols::SecureChannel::GeneralStatusCode::kFailure, 2, 3)
+        .EncodeStatusResponse(0xFF, 0xFFFC, 0xAB, chip::Protocols::SecureChannel::GeneralStatusCode::kSuccess, 0, 0)
+        .EndOfCommandList();
+    NL_TEST_ASSERT(apSuite, commandListBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, writer.GetLengthWritten() == expectedLen);
+    NL_TEST_ASSERT(apSuite, memcmp(buf, expected, expectedLen) == 0);
+
+    // AttributePath, with ids encoded on one, two and eight bytes
+    writer.Init(expected, sizeof(expected));
+    attributeDataElementBuilder.Init(&writer);
+    AttributePath::Builder attributePathBuilder = attributeDataElementBuilder.CreateAttributePathBuilder();
+    attributePathBuilder.NodeId(0x123456789A).EndpointId(2).ClusterId(0x1234).FieldId(0xAB).EndOfAttributePath();
+    NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    attributeDataElementBuilder.DataVersion(0).EndOfAttributeDataElement();
+    NL_TEST_ASSERT(apSuite, attributeDataElementBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    expectedLen = writer.GetLengthWritten();
+
+    writer.Init(buf, sizeof(buf));
+    attributeDataElementBuilder.Init(&writer);
+    attributeDataElementBuilder.EncodeAttributePath(0x123456789A, 2, 0x1234, 0xAB).DataVersion(0).EndOfAttributeDataElement();
+    NL_TEST_ASSERT(apSuite, attributeDataElementBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, writer.GetLengthWritten() == expectedLen);
+    NL_TEST_ASSERT(apSuite, memcmp(buf, expected, expectedLen) == 0);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -1408,6 +1552,7 @@ void CheckPointRollbackTest(nlTestSuite * apSuite, void * apContext)
 const nlTest sTests[] =
         {
                 NL_TEST_DEF("AttributePathTest", AttributePathTest),
+                NL_TEST_DEF("AttributePathDuplicateTagTest", AttributePathDuplicateTagTest),
                 NL_TEST_DEF("AttributePathListTest", AttributePathListTest),
                 NL_TEST_DEF("EventPathTest", EventPathTest),
                 NL_TEST_DEF("EventPathListTest", EventPathListTest),
@@ -1429,6 +1574,7 @@ const nlTest sTests[] =
                 NL_TEST_DEF("WriteRequestTest", WriteRequestTest),
                 NL_TEST_DEF("WriteResponseTest", WriteResponseTest),
                 NL_TEST_DEF("CheckPointRollbackTest", CheckPointRollbackTest),
+                NL_TEST_DEF("FixedLayoutEncodingTest", FixedLayoutEncodingTest),
                 NL_TEST_SENTINEL()
         };
 // clang-format on
@@ -0,0 +1,332 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for PersistentEventLog
+ *
+ */
+
+#include <app/PersistentEventLog.h>
+#include <nlunit-test.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace TestPersistentEventLog {
+
+class TestStorage : public PersistentStorageDelegate
+{
+public:
+    static constexpr size_t kMaxEntries = 8;
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        Entry * entry = Find(key);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(entry->mSize <= size, CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(buffer, entry->mValue, entry->mSize);
+        size = entry->mSize;
+        mReads++;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        Entry * entry = Find(key);
+        for (size_t i = 0; entry == nullptr && i < kMaxEntries; i++)
+        {
+            if (mEntries[i].mKey[0] == '\0')
+            {
+                entry = &mEntries[i];
+                strncpy(entry->mKey, key, sizeof(entry->mKey) - 1);
+            }
+        }
+        VerifyOrReturnError(entry != nullptr && size <= sizeof(entry->mValue), CHIP_ERROR_NO_MEMORY);
+        memcpy(entry->mValue, value, size);
+        entry->mSize = size;
+        mWrites++;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override
+    {
+        Entry * entry = Find(key);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        *entry = Entry();
+        return CHIP_NO_ERROR;
+    }
+
+    uint16_t GetSize(const char * key)
+    {
+        Entry * entry = Find(key);
+        return (entry != nullptr) ? entry->mSize : 0;
+    }
+
+    uint32_t mReads  = 0;
+    uint32_t mWrites = 0;
+
+private:
+    struct Entry
+    {
+        char mKey[16] = {};
+        uint8_t mValue[PersistentEventLog::kBlockSize];
+        uint16_t mSize = 0;
+    };
+
+    Entry * Find(const char * key)
+    {
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mKey[0] != '\0' && strcmp(entry.mKey, key) == 0)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    Entry mEntries[kMaxEntries];
+};
+
+struct ReadEvents
+{
+    static constexpr size_t kMaxEvents = 64;
+
+    static CHIP_ERROR Add(void * apContext, EventNumber aEventNumber, uint64_t aSystemTimestamp, const uint8_t * apEvent,
+                          uint16_t aEventLength)
+    {
+        ReadEvents * events = static_cast<ReadEvents *>(apContext);
+        VerifyOrReturnError(events->mCount < kMaxEvents, CHIP_ERROR_NO_MEMORY);
+        events->mNumbers[events->mCount]    = aEventNumber;
+        events->mTimestamps[events->mCount] = aSystemTimestamp;
+        events->mLengths[events->mCount]    = aEventLength;
+        events->mFirstBytes[events->mCount] = (aEventLength > 0) ? apEvent[0] : 0;
+        events->mLastBytes[events->mCount]  = (aEventLength > 0) ? apEvent[aEventLength - 1] : 0;
+        events->mCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mCount = 0;
+    EventNumber mNumbers[kMaxEvents];
+    uint64_t mTimestamps[kMaxEvents];
+    uint16_t mLengths[kMaxEvents];
+    uint8_t mFirstBytes[kMaxEvents];
+    uint8_t mLastBytes[kMaxEvents];
+};
+
+// An event of the given length, whose first bytes are the same for all the events of the same kind.
+void MakeEvent(uint8_t * apEvent, uint16_t aLength, uint8_t aKind, uint8_t aValue)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        apEvent[i] = static_cast<uint8_t>(aKind + i);
+    }
+    apEvent[aLength - 1] = aValue;
+}
+
+void TestSaveAndReload(nlTestSuite * apSuite, void * apContext)
+{
+    TestStorage storage;
+    PersistentEventLog log;
+    PersistentEventLog reloaded;
+    ReadEvents events;
+    uint8_t event[40];
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.IsEmpty());
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        MakeEvent(event, sizeof(event), 0, i);
+        NL_TEST_ASSERT(apSuite, log.Append(100 + i, 5000 + 10 * i, event, sizeof(event)) == CHIP_NO_ERROR);
+    }
+
+    // The events are staged until the batch is full or the log is flushed.
+    NL_TEST_ASSERT(apSuite, storage.mWrites == 0);
+    NL_TEST_ASSERT(apSuite, log.GetStagedEventCount() == 5);
+    NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWrites == 1);
+    NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWrites == 1);
+
+    // The events after the first one share all their bytes but the last one with it, and take a few bytes each.
+    NL_TEST_ASSERT(apSuite, storage.GetSize("CHIPEv2_0") < 5 * sizeof(event) / 2);
+
+    NL_TEST_ASSERT(apSuite, reloaded.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reloaded.GetFirstEventNumber() == 100);
+    NL_TEST_ASSERT(apSuite, reloaded.GetLastEventNumber() == 104);
+    NL_TEST_ASSERT(apSuite, reloaded.Iterate(0, ReadEvents::Add, &events) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, events.mCount == 5);
+    for (uint8_t i = 0; i < events.mCount; i++)
+    {
+        NL_TEST_ASSERT(apSuite, events.mNumbers[i] == 100u + i);
+        NL_TEST_ASSERT(apSuite, events.mTimestamps[i] == 5000u + 10 * i);
+        NL_TEST_ASSERT(apSuite, events.mLengths[i] == sizeof(event));
+        NL_TEST_ASSERT(apSuite, events.mFirstBytes[i] == 0 && events.mLastBytes[i] == i);
+    }
+
+    // The reloaded log goes on in the same block, after a restart resetting the timestamps.
+    MakeEvent(event, sizeof(event), 0, 5);
+    NL_TEST_ASSERT(apSuite, reloaded.Append(104, 10, event, sizeof(event)) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite, reloaded.Append(105, 10, event, sizeof(event)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reloaded.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.GetSize("CHIPEv2_1") == 0);
+
+    events = ReadEvents();
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.Iterate(104, ReadEvents::Add, &events) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, events.mCount == 2);
+    NL_TEST_ASSERT(apSuite, events.mNumbers[0] == 104 && events.mTimestamps[0] == 5040);
+    NL_TEST_ASSERT(apSuite, events.mNumbers[1] == 105 && events.mTimestamps[1] == 10 && events.mLastBytes[1] == 5);
+
+    NL_TEST_ASSERT(apSuite, log.Clear() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.IsEmpty());
+    NL_TEST_ASSERT(apSuite, storage.GetSize("CHIPEv2_0") == 0);
+}
+
+void TestBatchedWrites(nlTestSuite * apSuite, void * apContext)
+{
+    TestStorage storage;
+    PersistentEventLog log;
+    uint8_t event[8];
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Info) == CHIP_NO_ERROR);
+
+    // A block is written once per batch of events.
+    for (uint16_t i = 0; i < 3 * PersistentEventLog::kBatchCount; i++)
+    {
+        MakeEvent(event, sizeof(event), 0, static_cast<uint8_t>(i));
+        NL_TEST_ASSERT(apSuite, log.Append(1 + i, i, event, sizeof(event)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, storage.mWrites == (i + 1u) / PersistentEventLog::kBatchCount);
+    }
+    NL_TEST_ASSERT(apSuite, log.GetStagedEventCount() == 0);
+
+    // The events too large for a block are refused.
+    uint8_t largeEvent[PersistentEventLog::kBlockSize] = {};
+    NL_TEST_ASSERT(apSuite, log.Append(100, 0, largeEvent, sizeof(largeEvent)) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+void TestRingAndSeek(nlTestSuite * apSuite, void * apContext)
+{
+    TestStorage storage;
+    PersistentEventLog log;
+    PersistentEventLog reloaded;
+    ReadEvents events;
+    uint8_t event[50];
+    const EventNumber kLastEvent = 60;
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+
+    // Events sharing no bytes fill the blocks, the oldest block being overwritten once all are full.
+    for (EventNumber number = 1; number <= kLastEvent; number++)
+    {
+        MakeEvent(event, sizeof(event), static_cast<uint8_t>(number), static_cast<uint8_t>(number));
+        NL_TEST_ASSERT(apSuite, log.Append(number, 1000 * number, event, sizeof(event)) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.GetFirstEventNumber() > 1);
+    NL_TEST_ASSERT(apSuite, log.GetLastEventNumber() == kLastEvent);
+
+    NL_TEST_ASSERT(apSuite, reloaded.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reloaded.GetFirstEventNumber() == log.GetFirstEventNumber());
+    NL_TEST_ASSERT(apSuite, reloaded.GetLastEventNumber() == kLastEvent);
+
+    NL_TEST_ASSERT(apSuite, reloaded.Iterate(0, ReadEvents::Add, &events) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, events.mCount == kLastEvent - reloaded.GetFirstEventNumber() + 1);
+    for (size_t i = 0; i < events.mCount; i++)
+    {
+        NL_TEST_ASSERT(apSuite, events.mNumbers[i] == reloaded.GetFirstEventNumber() + i);
+        NL_TEST_ASSERT(apSuite, events.mTimestamps[i] == 1000 * events.mNumbers[i]);
+        NL_TEST_ASSERT(apSuite, events.mFirstBytes[i] == static_cast<uint8_t>(events.mNumbers[i]));
+    }
+
+    // Reading the last events only reads the newest block, the one in memory.
+    storage.mReads = 0;
+    events         = ReadEvents();
+    NL_TEST_ASSERT(apSuite, reloaded.Iterate(kLastEvent, ReadEvents::Add, &events) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, events.mCount == 1 && events.mNumbers[0] == kLastEvent);
+    NL_TEST_ASSERT(apSuite, storage.mReads == 0);
+}
+
+void TestCorruptedBlock(nlTestSuite * apSuite, void * apContext)
+{
+    TestStorage storage;
+    PersistentEventLog log;
+    ReadEvents events;
+    uint8_t event[20];
+    uint8_t block[PersistentEventLog::kBlockSize];
+    uint16_t size = sizeof(block);
+
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        MakeEvent(event, sizeof(event), i, i);
+        NL_TEST_ASSERT(apSuite, log.Append(1 + i, i, event, sizeof(event)) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+
+    // A block cut short keeps the events before the cut.
+    NL_TEST_ASSERT(apSuite, storage.SyncGetKeyValue("CHIPEv2_0", block, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.SyncSetKeyValue("CHIPEv2_0", block, static_cast<uint16_t>(size - 5)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.GetLastEventNumber() == 1);
+    NL_TEST_ASSERT(apSuite, log.Iterate(0, ReadEvents::Add, &events) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, events.mCount == 1 && events.mNumbers[0] == 1);
+
+    // So does a block whose last event claims more bytes than there are: after the 18 bytes of the header and the 24 of
+    // the first event, the second event starts with the varints of its deltas and lengths.
+    block[18 + 24 + 3] = 0x7f;
+    NL_TEST_ASSERT(apSuite, storage.SyncSetKeyValue("CHIPEv2_0", block, size) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.GetLastEventNumber() == 1);
+
+    // The events appended next replace the dropped one.
+    MakeEvent(event, sizeof(event), 0, 2);
+    NL_TEST_ASSERT(apSuite, log.Append(2, 1, event, sizeof(event)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.Flush() == CHIP_NO_ERROR);
+    events = ReadEvents();
+    NL_TEST_ASSERT(apSuite, log.Init(&storage, PriorityLevel::Critical) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, log.Iterate(0, ReadEvents::Add, &events) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, events.mCount == 2 && events.mNumbers[1] == 2 && events.mLastBytes[1] == 2);
+}
+} // namespace TestPersistentEventLog
+} // namespace app
+} // namespace chip
+
+namespace {
+const nlTest sTests[] = { NL_TEST_DEF("TestSaveAndReload", chip::app::TestPersistentEventLog::TestSaveAndReload),
+                          NL_TEST_DEF("TestBatchedWrites", chip::app::TestPersistentEventLog::TestBatchedWrites),
+                          NL_TEST_DEF("TestRingAndSeek", chip::app::TestPersistentEventLog::TestRingAndSeek),
+                          NL_TEST_DEF("TestCorruptedBlock", chip::app::TestPersistentEventLog::TestCorruptedBlock),
+                          NL_TEST_SENTINEL() };
+}
+
+int TestPersistentEventLog()
+{
+    nlTestSuite theSuite = { "PersistentEventLog", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPersistentEventLog)
@@ -53,13 +53,104 @@ class TestReadInteraction
 {
 public:
     static void TestReadClient(nlTestSuite * apSuite, void * apContext);
+    static void TestReadClientAttributeData(nlTestSuite * apSuite, void * apContext);
     static void TestReadHandler(nlTestSuite * apSuite, void * apContext);
+    static void TestReadHandlerEventPaths(nlTestSuite * apSuite, void * apContext);
+    static void TestReadClientDataVersions(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscriptionPersistence(nlTestSuite * apSuite, void * apContext);
 
 private:
-    static void GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload);
+    static void GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
+                                   bool aMoreChunkedMessages = false, FieldId aNumAttributeData = 0, DataVersion aDataVersion = 0);
+    static size_t EncodeDataVersions(nlTestSuite * apSuite, ReadClient & aReadClient, AttributePathParams * apPaths,
+                                     size_t aNumPaths, DataVersion * apVersions);
+    static void GenerateSubscribeRequest(nlTestSuite * apSuite, System::PacketBufferHandle & aPayload, size_t aNumEventPaths,
+                                         size_t aNumAttributePaths = 0);
 };
 
-void TestReadInteraction::GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload)
+class TestReadDelegate : public InteractionModelDelegate
+{
+public:
+    CHIP_ERROR AttributeDataReceived(const ReadClient * apReadClient, const AttributePathParams & aAttributePathParams,
+                                     TLV::TLVReader & aReader) override
+    {
+        mNumAttributeData++;
+        mLastFieldId = aAttributePathParams.mFieldId;
+        return CHIP_NO_ERROR;
+    }
+
+    FieldId mNumAttributeData = 0;
+    FieldId mLastFieldId      = 0;
+};
+
+// Keeps the values in memory, as the key value store of a device does across a reboot.
+class TestSubscriptionStorage : public PersistentStorageDelegate
+{
+public:
+    static constexpr size_t kMaxEntries = 2;
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        Entry * entry = Find(key);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(entry->mSize <= size, CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(buffer, entry->mValue, entry->mSize);
+        size = entry->mSize;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        Entry * entry = Find(key);
+        for (size_t i = 0; entry == nullptr && i < kMaxEntries; i++)
+        {
+            if (mEntries[i].mKey[0] == '\0')
+            {
+                entry = &mEntries[i];
+                strncpy(entry->mKey, key, sizeof(entry->mKey) - 1);
+            }
+        }
+        VerifyOrReturnError(entry != nullptr && size <= sizeof(entry->mValue), CHIP_ERROR_NO_MEMORY);
+        memcpy(entry->mValue, value, size);
+        entry->mSize = size;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override
+    {
+        Entry * entry = Find(key);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        *entry = Entry();
+        return CHIP_NO_ERROR;
+    }
+
+    bool Has(const char * key) { return Find(key) != nullptr; }
+
+private:
+    struct Entry
+    {
+        char mKey[16]  = {};
+        uint16_t mSize = 0;
+        uint8_t mValue[CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE];
+    };
+
+    Entry * Find(const char * key)
+    {
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mKey[0] != '\0' && strcmp(entry.mKey, key) == 0)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    Entry mEntries[kMaxEntries];
+};
+
+void TestReadInteraction::GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
+                                             bool aMoreChunkedMessages, FieldId aNumAttributeData, DataVersion aDataVersion)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVWriter writer;
@@ -73,9 +164,38 @@ void TestReadInteraction::GenerateReportData(nlTestSuite * apSuite, void * apCon
     reportDataBuilder.SuppressResponse(true);
     NL_TEST_ASSERT(apSuite, reportDataBuilder.GetError() == CHIP_NO_ERROR);
 
-    reportDataBuilder.MoreChunkedMessages(false);
+    reportDataBuilder.MoreChunkedMessages(aMoreChunkedMessages);
     NL_TEST_ASSERT(apSuite, reportDataBuilder.GetError() == CHIP_NO_ERROR);
 
+    if (aNumAttributeData != 0)
+    {
+        AttributeDataList::Builder attributeDataListBuilder = reportDataBuilder.CreateAttributeDataListBuilder();
+        NL_TEST_ASSERT(apSuite, attributeDataListBuilder.GetError() == CHIP_NO_ERROR);
+
+        for (FieldId fieldId = 0; fieldId < aNumAttributeData; fieldId++)
+        {
+            AttributeDataElement::Builder & builder = attributeDataListBuilder.CreateAttributeDataElementBuilder();
+            TLV::TLVType type                       = TLV::kTLVType_NotSpecified;
+
+            builder.EncodeAttributePath(kTestDeviceNodeId, 1, 6, fieldId);
+            NL_TEST_ASSERT(apSuite, builder.GetError() == CHIP_NO_ERROR);
+
+            err = builder.GetWriter()->StartContainer(TLV::ContextTag(AttributeDataElement::kCsTag_Data), TLV::kTLVType_Structure,
+                                                      type);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+            err = builder.GetWriter()->Put(TLV::ContextTag(0), fieldId);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+            err = builder.GetWriter()->EndContainer(type);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+            builder.DataVersion(aDataVersion).MoreClusterData(false).EndOfAttributeDataElement();
+            NL_TEST_ASSERT(apSuite, builder.GetError() == CHIP_NO_ERROR);
+        }
+
+        attributeDataListBuilder.EndOfAttributeDataList();
+        NL_TEST_ASSERT(apSuite, attributeDataListBuilder.GetError() == CHIP_NO_ERROR);
+    }
+
     reportDataBuilder.EndOfReportData();
     NL_TEST_ASSERT(apSuite, reportDataBuilder.GetError() == CHIP_NO_ERROR);
 
@@ -85,7 +205,8 @@ void TestReadInteraction::GenerateReportData(nlTestSuite * apSuite, void * apCon
 
 void TestReadInteraction::TestReadClient(nlTestSuite * apSuite, void * apContext)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    bool moreChunkedMessages = false;
 
     app::ReadClient readClient;
 
@@ -99,8 +220,38 @@ void TestReadInteraction::TestReadClient(nlTestSuite * apSuite, void * apContext
 
     GenerateReportData(apSuite, apContext, buf);
 
-    err = readClient.ProcessReportData(std::move(buf));
+    err = readClient.ProcessReportData(std::move(buf), moreChunkedMessages);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
+
+    buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateReportData(apSuite, apContext, buf, true /* aMoreChunkedMessages */);
+
+    err = readClient.ProcessReportData(std::move(buf), moreChunkedMessages);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, moreChunkedMessages);
+
+    readClient.Shutdown();
+}
+
+void TestReadInteraction::TestReadClientAttributeData(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    bool moreChunkedMessages = false;
+    TestReadDelegate delegate;
+
+    app::ReadClient readClient;
+
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    err                            = readClient.Init(&gExchangeManager, &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    GenerateReportData(apSuite, apContext, buf, false /* aMoreChunkedMessages */, 3 /* aNumAttributeData */);
+
+    err = readClient.ProcessReportData(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeData == 3);
+    NL_TEST_ASSERT(apSuite, delegate.mLastFieldId == 2);
 
     readClient.Shutdown();
 }
@@ -136,6 +287,276 @@ void TestReadInteraction::TestReadHandler(nlTestSuite * apSuite, void * apContex
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 }
 
+void TestReadInteraction::GenerateSubscribeRequest(nlTestSuite * apSuite, System::PacketBufferHandle & aPayload,
+                                                   size_t aNumEventPaths, size_t aNumAttributePaths)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferTLVWriter writer;
+    ReadRequest::Builder readRequestBuilder;
+
+    writer.Init(std::move(aPayload));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    if (aNumAttributePaths > 0)
+    {
+        AttributePathList::Builder attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+        NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+        for (size_t index = 0; index < aNumAttributePaths; index++)
+        {
+            AttributePath::Builder attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+            attributePathBuilder.NodeId(kTestDeviceNodeId).EndpointId(1).ClusterId(6).FieldId(static_cast<FieldId>(index));
+            attributePathBuilder.EndOfAttributePath();
+            NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+        }
+        attributePathListBuilder.EndOfAttributePathList();
+        NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+    }
+
+    EventPathList::Builder eventPathListBuilder = readRequestBuilder.CreateEventPathListBuilder();
+    NL_TEST_ASSERT(apSuite, eventPathListBuilder.GetError() == CHIP_NO_ERROR);
+    for (size_t index = 0; index < aNumEventPaths; index++)
+    {
+        // The first path covers every event of the cluster, the others a single event
+        EventPath::Builder eventPathBuilder = eventPathListBuilder.CreateEventPathBuilder();
+        eventPathBuilder.NodeId(kTestDeviceNodeId).EndpointId(1).ClusterId(6);
+        if (index > 0)
+        {
+            eventPathBuilder.EventId(static_cast<EventId>(index));
+        }
+        eventPathBuilder.EndOfEventPath();
+        NL_TEST_ASSERT(apSuite, eventPathBuilder.GetError() == CHIP_NO_ERROR);
+    }
+    eventPathListBuilder.EndOfEventPathList();
+    NL_TEST_ASSERT(apSuite, eventPathListBuilder.GetError() == CHIP_NO_ERROR);
+
+    readRequestBuilder.EventNumber(4);
+    readRequestBuilder.MinEventPriority(static_cast<uint8_t>(PriorityLevel::Info));
+    readRequestBuilder.EndOfReadRequest();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize(&aPayload);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+}
+
+void TestReadInteraction::TestReadHandlerEventPaths(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    TestReadDelegate delegate;
+    System::PacketBufferHandle subscribeRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // More event paths than the handler keeps are rejected
+    err = readHandler.Init(&delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    GenerateSubscribeRequest(apSuite, subscribeRequestbuf, CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER + 1);
+    err = readHandler.OnSubscribeRequest(nullptr, std::move(subscribeRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(apSuite, readHandler.IsFree());
+
+    err = readHandler.Init(&delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    subscribeRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateSubscribeRequest(apSuite, subscribeRequestbuf, 2);
+    err = readHandler.OnSubscribeRequest(nullptr, std::move(subscribeRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, readHandler.IsSubscription() && readHandler.IsReportable());
+    NL_TEST_ASSERT(apSuite, readHandler.GetEventPathCount() == 2);
+    NL_TEST_ASSERT(apSuite, readHandler.GetEventPaths()[0].mFlags.Has(EventPathFlags::kEventIdWildcard));
+    NL_TEST_ASSERT(apSuite, !readHandler.GetEventPaths()[1].mFlags.Has(EventPathFlags::kEventIdWildcard));
+    NL_TEST_ASSERT(apSuite, readHandler.GetEventPaths()[1].Covers(1, 6, 1));
+    NL_TEST_ASSERT(apSuite, !readHandler.GetEventPaths()[1].Covers(1, 6, 2));
+    NL_TEST_ASSERT(apSuite, readHandler.GetMinEventPriority() == PriorityLevel::Info);
+    NL_TEST_ASSERT(apSuite, readHandler.GetNextEventNumber(PriorityLevel::Critical) == 5);
+
+    // An urgent report does not wait for the minimum interval
+    readHandler.SetMinReportInterval(60000);
+    readHandler.MarkReportable(true);
+    NL_TEST_ASSERT(apSuite, readHandler.IsReportable() && readHandler.GetNextReportTimeMs() == 0);
+
+    readHandler.Shutdown();
+}
+
+// Encode the data version list of a request for the paths, and return the number of versions in it, null or not.
+size_t TestReadInteraction::EncodeDataVersions(nlTestSuite * apSuite, ReadClient & aReadClient, AttributePathParams * apPaths,
+                                               size_t aNumPaths, DataVersion * apVersions)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t buffer[128];
+    TLV::TLVWriter writer;
+    TLV::TLVReader reader;
+    ReadRequest::Builder readRequestBuilder;
+    ReadRequest::Parser readRequestParser;
+    AttributeDataVersionList::Parser dataVersionListParser;
+    size_t numVersions = 0;
+
+    writer.Init(buffer, sizeof(buffer));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = aReadClient.EncodeDataVersionList(readRequestBuilder, kTestDeviceNodeId, apPaths, aNumPaths);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    readRequestBuilder.EndOfReadRequest();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    reader.Init(buffer, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = readRequestParser.Init(reader);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    if (readRequestParser.GetAttributeDataVersionList(&dataVersionListParser) != CHIP_NO_ERROR)
+    {
+        return 0;
+    }
+    while (dataVersionListParser.Next() == CHIP_NO_ERROR && numVersions < aNumPaths)
+    {
+        apVersions[numVersions] = 0;
+        if (!dataVersionListParser.IsNull())
+        {
+            err = dataVersionListParser.GetVersion(&apVersions[numVersions]);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        }
+        numVersions++;
+    }
+    return numVersions;
+}
+
+void TestReadInteraction::TestReadClientDataVersions(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    bool moreChunkedMessages = false;
+    TestReadDelegate delegate;
+    app::ReadClient readClient;
+    DataVersion versions[3];
+    // Every attribute of the cluster, a single one of its attributes, and a path of every cluster
+    AttributePathParams paths[3] = { AttributePathParams(kTestDeviceNodeId, 1, 6, 0, 0, AttributePathFlags::kFieldIdWildcard),
+                                     AttributePathParams(kTestDeviceNodeId, 1, 6, 1, 0, AttributePathFlags::kFieldIdValid),
+                                     AttributePathParams(kTestDeviceNodeId, 1, 0, 0, 0, AttributePathFlags::kFieldIdWildcard) };
+    paths[2].mFlags.Set(AttributePathFlags::kClusterIdWildcard);
+
+    err = readClient.Init(&gExchangeManager, &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    readClient.mPeerNodeId = kTestDeviceNodeId;
+
+    // Nothing was reported yet: the list is left out
+    NL_TEST_ASSERT(apSuite, EncodeDataVersions(apSuite, readClient, paths, 1, versions) == 0);
+
+    // The versions of a report only replace those of the path once the report is complete
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateReportData(apSuite, apContext, buf, false /* aMoreChunkedMessages */, 3 /* aNumAttributeData */, 5 /* aDataVersion */);
+    err = readClient.ProcessReportData(std::move(buf), moreChunkedMessages);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    readClient.CommitDataVersions(false);
+    NL_TEST_ASSERT(apSuite, EncodeDataVersions(apSuite, readClient, paths, 1, versions) == 0);
+
+    buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateReportData(apSuite, apContext, buf, false /* aMoreChunkedMessages */, 3 /* aNumAttributeData */, 5 /* aDataVersion */);
+    err = readClient.ProcessReportData(std::move(buf), moreChunkedMessages);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    readClient.CommitDataVersions(true);
+
+    // The single attribute was not part of the previous request, and a wildcard cluster has no version of its own
+    NL_TEST_ASSERT(apSuite, EncodeDataVersions(apSuite, readClient, paths, 3, versions) == 3);
+    NL_TEST_ASSERT(apSuite, versions[0] == 5 && versions[1] == 0 && versions[2] == 0);
+
+    buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateReportData(apSuite, apContext, buf, false /* aMoreChunkedMessages */, 2 /* aNumAttributeData */, 7 /* aDataVersion */);
+    err = readClient.ProcessReportData(std::move(buf), moreChunkedMessages);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    readClient.CommitDataVersions(true);
+    NL_TEST_ASSERT(apSuite, EncodeDataVersions(apSuite, readClient, paths, 3, versions) == 3);
+    NL_TEST_ASSERT(apSuite, versions[0] == 7 && versions[1] == 7 && versions[2] == 0);
+
+    readClient.ClearDataVersions();
+    NL_TEST_ASSERT(apSuite, EncodeDataVersions(apSuite, readClient, paths, 3, versions) == 0);
+
+    readClient.Shutdown();
+}
+
+void TestReadInteraction::TestSubscriptionPersistence(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    TestReadDelegate delegate;
+    TestSubscriptionStorage storage;
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+    SecurePairingUsingTestSecret pairing(1, 2);
+    System::PacketBufferHandle subscribeRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    const SecureSessionHandle session(kTestControllerNodeId, 1, gAdminId);
+    const uint8_t corrupted[] = { 0x15, 0x24, 0x01 };
+    char key[16];
+    ReadHandler * resumed = nullptr;
+
+    err = gSessionManager.NewPairing(Optional<Transport::PeerAddress>::Missing(), kTestControllerNodeId, &pairing,
+                                     SecureSessionMgr::PairingDirection::kResponder, gAdminId);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = engine->Init(&gExchangeManager, &delegate, &storage);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    InteractionModelEngine::GetSubscriptionKey(0, key);
+
+    err = readHandler.Init(&delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    GenerateSubscribeRequest(apSuite, subscribeRequestbuf, 2, 2);
+    err = readHandler.OnSubscribeRequest(gExchangeManager.NewContext(session, nullptr), std::move(subscribeRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The subscription is kept, and only once
+    engine->PersistSubscription(readHandler);
+    NL_TEST_ASSERT(apSuite, storage.Has(key) && readHandler.GetSubscriptionSlot() == 0);
+
+    // A reboot shuts the handler down without forgetting the subscription, which the engine resumes on its new start
+    readHandler.Shutdown();
+    engine->Shutdown();
+    err = engine->Init(&gExchangeManager, &delegate, &storage);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    engine->ResumeSubscriptions();
+
+    engine->mReadHandlers.ForEachObject([&resumed](ReadHandler & handler) {
+        if (!handler.IsFree())
+        {
+            resumed = &handler;
+        }
+    });
+    NL_TEST_ASSERT(apSuite, resumed != nullptr);
+    if (resumed != nullptr)
+    {
+        size_t numPaths = 0;
+        for (ClusterInfo * clusterInfo = resumed->GetCluterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+        {
+            NL_TEST_ASSERT(apSuite, clusterInfo->IsDirty() && clusterInfo->mAttributePathParams.mClusterId == 6);
+            numPaths++;
+        }
+        NL_TEST_ASSERT(apSuite, numPaths == 2);
+        NL_TEST_ASSERT(apSuite, resumed->IsSubscription() && resumed->IsReportable());
+        NL_TEST_ASSERT(apSuite, resumed->GetSubscriptionSlot() == 0);
+        NL_TEST_ASSERT(apSuite, resumed->GetExchangeContext() != nullptr);
+        NL_TEST_ASSERT(apSuite, resumed->GetExchangeContext()->GetSecureSessionHandle() == session);
+        NL_TEST_ASSERT(apSuite, resumed->GetEventPathCount() == 2);
+        NL_TEST_ASSERT(apSuite, resumed->GetEventPaths()[0].mFlags.Has(EventPathFlags::kEventIdWildcard));
+        NL_TEST_ASSERT(apSuite, resumed->GetEventPaths()[1].Covers(1, 6, 1));
+        NL_TEST_ASSERT(apSuite, resumed->GetMinEventPriority() == PriorityLevel::Info);
+        NL_TEST_ASSERT(apSuite, resumed->GetNextEventNumber(PriorityLevel::Critical) == 5);
+
+        // A subscription which fails is forgotten
+        engine->ForgetSubscription(*resumed);
+        NL_TEST_ASSERT(apSuite, !storage.Has(key));
+        resumed->Shutdown();
+    }
+
+    // A record which cannot be read back is dropped
+    err = storage.SyncSetKeyValue(key, corrupted, sizeof(corrupted));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    engine->ResumeSubscriptions();
+    NL_TEST_ASSERT(apSuite, !storage.Has(key));
+    NL_TEST_ASSERT(apSuite, engine->mReadHandlers.Allocated() == 0);
+
+    engine->Shutdown();
+}
+
 } // namespace app
 } // namespace chip
 
@@ -170,7 +591,11 @@ void InitializeChip(nlTestSuite * apSuite)
 const nlTest sTests[] =
 {
     NL_TEST_DEF("CheckReadClient", chip::app::TestReadInteraction::TestReadClient),
+    NL_TEST_DEF("CheckReadClientAttributeData", chip::app::TestReadInteraction::TestReadClientAttributeData),
     NL_TEST_DEF("CheckReadHandler", chip::app::TestReadInteraction::TestReadHandler),
+    NL_TEST_DEF("CheckReadHandlerEventPaths", chip::app::TestReadInteraction::TestReadHandlerEventPaths),
+    NL_TEST_DEF("CheckReadClientDataVersions", chip::app::TestReadInteraction::TestReadClientDataVersions),
+    NL_TEST_DEF("CheckSubscriptionPersistence", chip::app::TestReadInteraction::TestSubscriptionPersistence),
     NL_TEST_SENTINEL()
 };
 // clang-format on
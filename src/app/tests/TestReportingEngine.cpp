@@ -54,11 +54,15 @@ constexpr chip::FieldId kTestFieldId1    = 1;
 constexpr chip::FieldId kTestFieldId2    = 2;
 constexpr uint8_t kTestFieldValue1       = 1;
 constexpr uint8_t kTestFieldValue2       = 2;
+constexpr FieldId kTestNumFields         = 12;
+static size_t gReadCount                 = 0;
+static DataVersion gClusterDataVersion   = 3;
 
 namespace app {
 CHIP_ERROR ReadSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVWriter & aWriter)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
+    gReadCount++;
     VerifyOrExit(aAttributePathParams.mClusterId == kTestClusterId && aAttributePathParams.mEndpointId == kTestEndpointId,
                  err = CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -78,11 +82,45 @@ exit:
     return err;
 }
 
+// The test data model has a single cluster, with fields 1 to kTestNumFields.
+bool ExpandAttributePath(const AttributePathParams & aWildcard, AttributePathCursor & aCursor, AttributePathParams & aPath)
+{
+    if (aCursor.mAttributeIndex >= kTestNumFields || !aWildcard.mFlags.Has(AttributePathFlags::kFieldIdWildcard) ||
+        aWildcard.mEndpointId != kTestEndpointId || aWildcard.mClusterId != kTestClusterId)
+    {
+        return false;
+    }
+
+    aPath = AttributePathParams(aWildcard.mNodeId, kTestEndpointId, kTestClusterId,
+                                static_cast<FieldId>(aCursor.mAttributeIndex + 1), 0, AttributePathFlags::kFieldIdValid);
+    return true;
+}
+
+bool GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId, DataVersion & aDataVersion)
+{
+    VerifyOrReturnError(aEndpointId == kTestEndpointId && aClusterId == kTestClusterId, false);
+    aDataVersion = gClusterDataVersion;
+    return true;
+}
+
 namespace reporting {
 class TestReportingEngine
 {
 public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
+    static void TestMarkDirty(nlTestSuite * apSuite, void * apContext);
+    static void TestChunkedReport(nlTestSuite * apSuite, void * apContext);
+    static void TestWildcardReport(nlTestSuite * apSuite, void * apContext);
+    static void TestScheduleRun(nlTestSuite * apSuite, void * apContext);
+    static void TestBatch(nlTestSuite * apSuite, void * apContext);
+    static void TestDataVersionFilter(nlTestSuite * apSuite, void * apContext);
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+    static void TestReportCache(nlTestSuite * apSuite, void * apContext);
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+
+private:
+    static void ReportInChunks(nlTestSuite * apSuite, Engine & aReportingEngine, ReadHandler & aReadHandler, size_t aMaxChunks,
+                               size_t & aNumReported, size_t & aNumChunks);
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -134,6 +172,437 @@ void TestReportingEngine::TestBuildAndSendSingleReportData(nlTestSuite * apSuite
     err = reportingEngine.BuildAndSendSingleReportData(&readHandler);
     NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NOT_CONNECTED);
 }
+
+void TestReportingEngine::TestMarkDirty(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequest::Builder readRequestBuilder;
+    AttributePathList::Builder attributePathListBuilder;
+    AttributePath::Builder attributePathBuilder;
+    ClusterInfo changed;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    Messaging::ExchangeContext * exchangeCtx = gExchangeManager.NewContext({ 0, 0, 0 }, nullptr);
+    TestExchangeDelegate delegate;
+    exchangeCtx->SetDelegate(&delegate);
+
+    writer.Init(std::move(readRequestbuf));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    for (FieldId fieldId : { kTestFieldId1, kTestFieldId2 })
+    {
+        attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+        NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+        attributePathBuilder = attributePathBuilder.NodeId(1)
+                                   .EndpointId(kTestEndpointId)
+                                   .ClusterId(kTestClusterId)
+                                   .FieldId(fieldId)
+                                   .EndOfAttributePath();
+        NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    }
+    attributePathListBuilder.EndOfAttributePathList();
+    readRequestBuilder.EventNumber(1);
+    readRequestBuilder.EndOfReadRequest();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize(&readRequestbuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = readHandler.OnReadRequest(exchangeCtx, std::move(readRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Every path of a new read is dirty; clear them to observe changes.
+    for (ClusterInfo * clusterInfo = readHandler.GetCluterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        NL_TEST_ASSERT(apSuite, clusterInfo->IsDirty());
+        clusterInfo->ClearDirty();
+    }
+
+    // A change to another cluster, or to an attribute whose id does not fit in a field id, marks nothing.
+    changed.mAttributePathParams.mEndpointId = kTestEndpointId;
+    changed.mAttributePathParams.mClusterId  = kTestClusterId + 1;
+    changed.mAttributePathParams.mFieldId    = kTestFieldId2;
+    changed.mAttributePathParams.mFlags.Set(AttributePathFlags::kFieldIdValid);
+    NL_TEST_ASSERT(apSuite, !Engine::MarkDirty(&readHandler, changed));
+
+    changed.mAttributePathParams.mClusterId = kTestClusterId;
+    changed.mAttributePathParams.mFieldId   = 0;
+    changed.mAttributePathParams.mFlags.Clear(AttributePathFlags::kFieldIdValid);
+    NL_TEST_ASSERT(apSuite, !Engine::MarkDirty(&readHandler, changed));
+
+    // Only the path of the changed attribute is marked.
+    changed.mAttributePathParams.mFieldId = kTestFieldId2;
+    changed.mAttributePathParams.mFlags.Set(AttributePathFlags::kFieldIdValid);
+    NL_TEST_ASSERT(apSuite, Engine::MarkDirty(&readHandler, changed));
+    for (ClusterInfo * clusterInfo = readHandler.GetCluterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        NL_TEST_ASSERT(apSuite, clusterInfo->IsDirty() == (clusterInfo->mAttributePathParams.mFieldId == kTestFieldId2));
+    }
+
+    readHandler.Shutdown();
+}
+
+void TestReportingEngine::ReportInChunks(nlTestSuite * apSuite, Engine & aReportingEngine, ReadHandler & aReadHandler,
+                                         size_t aMaxChunks, size_t & aNumReported, size_t & aNumChunks)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    do
+    {
+        uint8_t report[96];
+        TLV::TLVWriter reportWriter;
+        TLV::TLVReader reader;
+        TLV::TLVReader attributeDataListReader;
+        ReportData::Builder reportDataBuilder;
+        ReportData::Parser reportDataParser;
+        AttributeDataList::Parser attributeDataListParser;
+
+        reportWriter.Init(report, sizeof(report));
+        err = reportDataBuilder.Init(&reportWriter);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = aReportingEngine.BuildSingleReportDataAttributeDataList(reportDataBuilder, &aReadHandler);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        reportDataBuilder.MoreChunkedMessages(aReadHandler.IsChunkedReportInProgress()).EndOfReportData();
+        NL_TEST_ASSERT(apSuite, reportDataBuilder.GetError() == CHIP_NO_ERROR);
+        err = reportWriter.Finalize();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        reader.Init(report, reportWriter.GetLengthWritten());
+        err = reader.Next();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = reportDataParser.Init(reader);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = reportDataParser.GetAttributeDataList(&attributeDataListParser);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        attributeDataListParser.GetReader(&attributeDataListReader);
+        while (attributeDataListReader.Next() == CHIP_NO_ERROR)
+        {
+            aNumReported++;
+        }
+        aNumChunks++;
+    } while (aReadHandler.IsChunkedReportInProgress() && aNumChunks <= aMaxChunks);
+}
+
+void TestReportingEngine::TestChunkedReport(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    Engine reportingEngine;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequest::Builder readRequestBuilder;
+    AttributePathList::Builder attributePathListBuilder;
+    AttributePath::Builder attributePathBuilder;
+    constexpr FieldId kNumPaths = IM_SERVER_MAX_NUM_PATH_GROUPS;
+    size_t numReported          = 0;
+    size_t numChunks            = 0;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    Messaging::ExchangeContext * exchangeCtx = gExchangeManager.NewContext({ 0, 0, 0 }, nullptr);
+    TestExchangeDelegate delegate;
+    exchangeCtx->SetDelegate(&delegate);
+
+    writer.Init(std::move(readRequestbuf));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    for (FieldId fieldId = 1; fieldId <= kNumPaths; fieldId++)
+    {
+        attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+        NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+        attributePathBuilder = attributePathBuilder.NodeId(1)
+                                   .EndpointId(kTestEndpointId)
+                                   .ClusterId(kTestClusterId)
+                                   .FieldId(fieldId)
+                                   .EndOfAttributePath();
+        NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    }
+    attributePathListBuilder.EndOfAttributePathList();
+    readRequestBuilder.EventNumber(1);
+    readRequestBuilder.EndOfReadRequest();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize(&readRequestbuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = readHandler.OnReadRequest(exchangeCtx, std::move(readRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reportingEngine.Init();
+
+    // Reports too small for every path are sent in chunks, each resuming where the previous one stopped.
+    ReportInChunks(apSuite, reportingEngine, readHandler, kNumPaths, numReported, numChunks);
+
+    NL_TEST_ASSERT(apSuite, numChunks > 1);
+    NL_TEST_ASSERT(apSuite, numReported == kNumPaths);
+    for (ClusterInfo * clusterInfo = readHandler.GetCluterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        NL_TEST_ASSERT(apSuite, !clusterInfo->IsDirty());
+    }
+
+    readHandler.Shutdown();
+}
+
+void TestReportingEngine::TestDataVersionFilter(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Engine reportingEngine;
+    AttributePathList::Builder attributePathListBuilder;
+    AttributeDataVersionList::Builder dataVersionListBuilder;
+    AttributePath::Builder attributePathBuilder;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reportingEngine.Init();
+
+    // The initiator has the current version of the cluster for the first two paths, a previous one for the third, and none for
+    // the last: only the last two are reported.
+    const DataVersion versions[] = { gClusterDataVersion, gClusterDataVersion, gClusterDataVersion - 1 };
+    for (bool changed : { false, true })
+    {
+        app::ReadHandler readHandler;
+        System::PacketBufferTLVWriter writer;
+        System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+        ReadRequest::Builder readRequestBuilder;
+        size_t numReported = 0;
+        size_t numChunks   = 0;
+
+        Messaging::ExchangeContext * exchangeCtx = gExchangeManager.NewContext({ 0, 0, 0 }, nullptr);
+        TestExchangeDelegate delegate;
+        exchangeCtx->SetDelegate(&delegate);
+
+        writer.Init(std::move(readRequestbuf));
+        err = readRequestBuilder.Init(&writer);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+        NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+        for (FieldId fieldId : { kTestFieldId1, kTestFieldId2, kTestFieldId1, kTestFieldId2 })
+        {
+            attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+            NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+            attributePathBuilder = attributePathBuilder.NodeId(1)
+                                       .EndpointId(kTestEndpointId)
+                                       .ClusterId(kTestClusterId)
+                                       .FieldId(fieldId)
+                                       .EndOfAttributePath();
+            NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+        }
+        attributePathListBuilder.EndOfAttributePathList();
+        dataVersionListBuilder = readRequestBuilder.CreateAttributeDataVersionListBuilder();
+        NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+        for (DataVersion version : versions)
+        {
+            dataVersionListBuilder.AddVersion(version);
+        }
+        dataVersionListBuilder.AddNull().EndOfAttributeDataVersionList();
+        NL_TEST_ASSERT(apSuite, dataVersionListBuilder.GetError() == CHIP_NO_ERROR);
+        readRequestBuilder.EventNumber(1);
+        readRequestBuilder.EndOfReadRequest();
+        NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+        err = writer.Finalize(&readRequestbuf);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        err = readHandler.OnReadRequest(exchangeCtx, std::move(readRequestbuf));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        // A change of the cluster between the request and the report bumps its version, and every path is then reported.
+        if (changed)
+        {
+            gClusterDataVersion++;
+        }
+        ReportInChunks(apSuite, reportingEngine, readHandler, 4, numReported, numChunks);
+        NL_TEST_ASSERT(apSuite, numReported == (changed ? 4u : 2u));
+        for (ClusterInfo * clusterInfo = readHandler.GetCluterInfolist(); clusterInfo != nullptr;
+             clusterInfo               = clusterInfo->mpNext)
+        {
+            NL_TEST_ASSERT(apSuite, !clusterInfo->IsDirty() && !clusterInfo->mHasDataVersion);
+        }
+
+        readHandler.Shutdown();
+    }
+}
+
+void TestReportingEngine::TestWildcardReport(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    Engine reportingEngine;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequest::Builder readRequestBuilder;
+    AttributePathList::Builder attributePathListBuilder;
+    AttributePath::Builder attributePathBuilder;
+    size_t numReported = 0;
+    size_t numChunks   = 0;
+    ClusterInfo * clusterInfo;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    Messaging::ExchangeContext * exchangeCtx = gExchangeManager.NewContext({ 0, 0, 0 }, nullptr);
+    TestExchangeDelegate delegate;
+    exchangeCtx->SetDelegate(&delegate);
+
+    // Every field of the cluster, more of them than there are cluster infos in the pool.
+    writer.Init(std::move(readRequestbuf));
+    err = readRequestBuilder.Init(&writer);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+    NL_TEST_ASSERT(apSuite, attributePathListBuilder.GetError() == CHIP_NO_ERROR);
+    attributePathBuilder =
+        attributePathBuilder.NodeId(1).EndpointId(kTestEndpointId).ClusterId(kTestClusterId).EndOfAttributePath();
+    NL_TEST_ASSERT(apSuite, attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    attributePathListBuilder.EndOfAttributePathList();
+    readRequestBuilder.EventNumber(1);
+    readRequestBuilder.EndOfReadRequest();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    err = writer.Finalize(&readRequestbuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = readHandler.OnReadRequest(exchangeCtx, std::move(readRequestbuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reportingEngine.Init();
+
+    clusterInfo = readHandler.GetCluterInfolist();
+    NL_TEST_ASSERT(apSuite, clusterInfo != nullptr && clusterInfo->mpNext == nullptr);
+    NL_TEST_ASSERT(apSuite, clusterInfo != nullptr && clusterInfo->mAttributePathParams.HasWildcard());
+
+    // The wildcard path is expanded as the chunks go, each resuming on the field the previous one stopped at.
+    ReportInChunks(apSuite, reportingEngine, readHandler, kTestNumFields, numReported, numChunks);
+
+    NL_TEST_ASSERT(apSuite, numChunks > 1);
+    NL_TEST_ASSERT(apSuite, numReported == kTestNumFields);
+    NL_TEST_ASSERT(apSuite, clusterInfo != nullptr && !clusterInfo->IsDirty());
+
+    readHandler.Shutdown();
+}
+
+void TestReportingEngine::TestScheduleRun(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::ReadHandler readHandler;
+    Engine reportingEngine;
+    uint64_t scheduledRunTimeMs;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reportingEngine.Init();
+
+    // A handler that has not reported yet is not held back by its minimum interval.
+    readHandler.SetMinReportInterval(60000);
+    NL_TEST_ASSERT(apSuite, readHandler.GetNextReportTimeMs() == 0);
+
+    // Requests made while a run is pending are merged into it.
+    err = reportingEngine.ScheduleRun();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reportingEngine.mRunScheduled);
+    scheduledRunTimeMs = reportingEngine.mScheduledRunTimeMs;
+    err                = reportingEngine.ScheduleRun();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reportingEngine.mScheduledRunTimeMs == scheduledRunTimeMs);
+
+    gSystemLayer.CancelTimer(Engine::Run, &reportingEngine);
+}
+
+void TestReportingEngine::TestBatch(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Engine reportingEngine;
+
+    err = InteractionModelEngine::GetInstance()->Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reportingEngine.Init();
+
+    // A batch without a change to report schedules nothing.
+    reportingEngine.BeginBatch();
+    err = reportingEngine.EndBatch();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !reportingEngine.mRunScheduled);
+
+    // The run held back for the changes of nested batches is only scheduled once the outermost batch ends.
+    reportingEngine.BeginBatch();
+    reportingEngine.BeginBatch();
+    reportingEngine.mBatchRunPending = true;
+    err                              = reportingEngine.EndBatch();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !reportingEngine.mRunScheduled);
+    err = reportingEngine.EndBatch();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reportingEngine.mRunScheduled && !reportingEngine.mBatchRunPending);
+
+    err = reportingEngine.EndBatch();
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INCORRECT_STATE);
+
+    gSystemLayer.CancelTimer(Engine::Run, &reportingEngine);
+}
+
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+void TestReportingEngine::TestReportCache(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Engine reportingEngine;
+    ClusterInfo clusterInfo;
+    AttributePathParams changed;
+    uint8_t encoded[2][64];
+    uint32_t encodedLength[2];
+
+    reportingEngine.Init();
+    clusterInfo.mAttributePathParams.mNodeId     = 1;
+    clusterInfo.mAttributePathParams.mEndpointId = kTestEndpointId;
+    clusterInfo.mAttributePathParams.mClusterId  = kTestClusterId;
+    clusterInfo.mAttributePathParams.mFieldId    = kTestFieldId1;
+    gReadCount                                   = 0;
+
+    // The second handler reporting the path gets the first one's encoding without reading the attribute again.
+    for (size_t i = 0; i < 2; i++)
+    {
+        TLV::TLVWriter writer;
+        AttributeDataList::Builder attributeDataList;
+
+        writer.Init(encoded[i], sizeof(encoded[i]));
+        err = attributeDataList.Init(&writer);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        clusterInfo.SetDirty();
+        err = reportingEngine.RetrieveCachedClusterData(attributeDataList, clusterInfo);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, !clusterInfo.IsDirty());
+        attributeDataList.EndOfAttributeDataList();
+        NL_TEST_ASSERT(apSuite, attributeDataList.GetError() == CHIP_NO_ERROR);
+        err = writer.Finalize();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        encodedLength[i] = writer.GetLengthWritten();
+    }
+    NL_TEST_ASSERT(apSuite, gReadCount == 1);
+    NL_TEST_ASSERT(apSuite, encodedLength[0] == encodedLength[1] && memcmp(encoded[0], encoded[1], encodedLength[0]) == 0);
+
+    // A change to another attribute keeps the encoding, a change to the reported one drops it.
+    changed.mEndpointId = kTestEndpointId;
+    changed.mClusterId  = kTestClusterId;
+    changed.mFieldId    = kTestFieldId2;
+    changed.mFlags.Set(AttributePathFlags::kFieldIdValid);
+    reportingEngine.InvalidateReportCache(changed);
+    {
+        TLV::TLVWriter writer;
+        AttributeDataList::Builder attributeDataList;
+
+        writer.Init(encoded[1], sizeof(encoded[1]));
+        attributeDataList.Init(&writer);
+        err = reportingEngine.RetrieveCachedClusterData(attributeDataList, clusterInfo);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && gReadCount == 1);
+
+        changed.mFieldId = kTestFieldId1;
+        reportingEngine.InvalidateReportCache(changed);
+        err = reportingEngine.RetrieveCachedClusterData(attributeDataList, clusterInfo);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && gReadCount == 2);
+    }
+}
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -164,6 +633,15 @@ void InitializeChip(nlTestSuite * apSuite)
 const nlTest sTests[] =
         {
                 NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
+                NL_TEST_DEF("CheckMarkDirty", chip::app::reporting::TestReportingEngine::TestMarkDirty),
+                NL_TEST_DEF("CheckChunkedReport", chip::app::reporting::TestReportingEngine::TestChunkedReport),
+                NL_TEST_DEF("CheckWildcardReport", chip::app::reporting::TestReportingEngine::TestWildcardReport),
+                NL_TEST_DEF("CheckScheduleRun", chip::app::reporting::TestReportingEngine::TestScheduleRun),
+                NL_TEST_DEF("CheckBatch", chip::app::reporting::TestReportingEngine::TestBatch),
+                NL_TEST_DEF("CheckDataVersionFilter", chip::app::reporting::TestReportingEngine::TestDataVersionFilter),
+#if CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
+                NL_TEST_DEF("CheckReportCache", chip::app::reporting::TestReportingEngine::TestReportCache),
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES > 0
                 NL_TEST_SENTINEL()
         };
 // clang-format on
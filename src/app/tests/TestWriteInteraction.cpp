@@ -0,0 +1,260 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for CHIP Interaction Model Write Interaction
+ *
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <core/CHIPCore.h>
+#include <core/CHIPTLV.h>
+#include <core/CHIPTLVDebug.hpp>
+#include <core/CHIPTLVUtilities.hpp>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/Flags.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <support/ErrorStr.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/TLVPacketBufferBackingStore.h>
+#include <transport/SecureSessionMgr.h>
+#include <transport/raw/UDP.h>
+
+#include <nlunit-test.h>
+
+namespace chip {
+static System::Layer gSystemLayer;
+static SecureSessionMgr gSessionManager;
+static Messaging::ExchangeManager gExchangeManager;
+static TransportMgr<Transport::UDP> gTransportManager;
+constexpr ClusterId kTestClusterId   = 6;
+constexpr EndpointId kTestEndpointId = 1;
+constexpr FieldId kTestFieldId1      = 1;
+constexpr FieldId kTestFieldId2      = 2;
+static size_t gWriteCount            = 0;
+static uint8_t gLastWrittenValue     = 0;
+
+namespace app {
+CHIP_ERROR WriteSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVReader & aReader)
+{
+    gWriteCount++;
+    VerifyOrReturnError(aAttributePathParams.mClusterId == kTestClusterId && aAttributePathParams.mEndpointId == kTestEndpointId,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aAttributePathParams.mFieldId == kTestFieldId1, CHIP_ERROR_INVALID_ARGUMENT);
+    return aReader.Get(gLastWrittenValue);
+}
+
+class TestWriteInteraction
+{
+public:
+    static void TestWriteClientCoalescing(nlTestSuite * apSuite, void * apContext);
+    static void TestWriteClientWildcardPath(nlTestSuite * apSuite, void * apContext);
+    static void TestWriteHandler(nlTestSuite * apSuite, void * apContext);
+
+private:
+    static void AddAttributeWrite(nlTestSuite * apSuite, WriteClient & aWriteClient, FieldId aFieldId, uint8_t aValue);
+};
+
+class TestWriteDelegate : public InteractionModelDelegate
+{
+public:
+    CHIP_ERROR WriteResponseStatus(const WriteClient * apWriteClient,
+                                   const Protocols::SecureChannel::GeneralStatusCode aGeneralCode, const uint32_t aProtocolId,
+                                   const uint16_t aProtocolCode, AttributePathParams & aAttributePathParams,
+                                   uint8_t aAttributeIndex) override
+    {
+        if (aGeneralCode == Protocols::SecureChannel::GeneralStatusCode::kSuccess)
+        {
+            mNumSuccess++;
+            mLastSuccessFieldId = aAttributePathParams.mFieldId;
+        }
+        else
+        {
+            mNumFailure++;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mNumSuccess          = 0;
+    size_t mNumFailure          = 0;
+    FieldId mLastSuccessFieldId = 0;
+};
+
+void TestWriteInteraction::AddAttributeWrite(nlTestSuite * apSuite, WriteClient & aWriteClient, FieldId aFieldId, uint8_t aValue)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    AttributePathParams attributePathParams(kTestDeviceNodeId, kTestEndpointId, kTestClusterId, aFieldId, 0,
+                                            AttributePathFlags::kFieldIdValid);
+
+    err = aWriteClient.PrepareAttribute(attributePathParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = aWriteClient.GetAttributeDataElementTLVWriter()->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), aValue);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = aWriteClient.FinishAttribute();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+}
+
+void TestWriteInteraction::TestWriteClientCoalescing(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::WriteClient writeClient;
+
+    err = writeClient.Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The writes to the same attribute collapse into the latest one.
+    AddAttributeWrite(apSuite, writeClient, kTestFieldId1, 1);
+    AddAttributeWrite(apSuite, writeClient, kTestFieldId1, 2);
+    AddAttributeWrite(apSuite, writeClient, kTestFieldId2, 3);
+    AddAttributeWrite(apSuite, writeClient, kTestFieldId1, 4);
+    NL_TEST_ASSERT(apSuite, writeClient.mNumWrites == 2);
+
+    writeClient.Shutdown();
+}
+
+void TestWriteInteraction::TestWriteClientWildcardPath(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::WriteClient writeClient;
+    AttributePathParams attributePathParams(kTestDeviceNodeId, kTestEndpointId, kTestClusterId, 0, 0,
+                                            AttributePathFlags::kFieldIdWildcard);
+
+    err = writeClient.Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = writeClient.PrepareAttribute(attributePathParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+
+    writeClient.Shutdown();
+}
+
+void TestWriteInteraction::TestWriteHandler(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    app::WriteClient writeClient;
+    app::WriteHandler writeHandler;
+    TestWriteDelegate delegate;
+    System::PacketBufferHandle writeRequestBuf;
+    System::PacketBufferHandle writeResponseBuf;
+    bool suppressResponse = true;
+
+    err = writeClient.Init(&gExchangeManager, &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    AddAttributeWrite(apSuite, writeClient, kTestFieldId1, 5);
+    AddAttributeWrite(apSuite, writeClient, kTestFieldId2, 6);
+    AddAttributeWrite(apSuite, writeClient, kTestFieldId1, 7);
+
+    err = writeClient.BuildWriteRequest(writeRequestBuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Both attributes are written in one pass, the first with its latest value, and the second fails.
+    gWriteCount = 0;
+    err         = writeHandler.Init(nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = writeHandler.ProcessWriteRequest(std::move(writeRequestBuf), suppressResponse);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !suppressResponse);
+    NL_TEST_ASSERT(apSuite, gWriteCount == 2);
+    NL_TEST_ASSERT(apSuite, gLastWrittenValue == 7);
+
+    // The response answers every attribute of the request with a status.
+    writeHandler.mAttributeStatusListBuilder.EndOfAttributeStatusList();
+    NL_TEST_ASSERT(apSuite, writeHandler.mAttributeStatusListBuilder.GetError() == CHIP_NO_ERROR);
+    writeHandler.mWriteResponseBuilder.EndOfWriteResponse();
+    NL_TEST_ASSERT(apSuite, writeHandler.mWriteResponseBuilder.GetError() == CHIP_NO_ERROR);
+    err = writeHandler.mMessageWriter.Finalize(&writeResponseBuf);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = writeClient.ProcessWriteResponse(std::move(writeResponseBuf));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mNumSuccess == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mNumFailure == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mLastSuccessFieldId == kTestFieldId1);
+
+    writeHandler.Shutdown();
+    writeClient.Shutdown();
+}
+
+} // namespace app
+} // namespace chip
+
+namespace {
+
+void InitializeChip(nlTestSuite * apSuite)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::Optional<chip::Transport::PeerAddress> peer(chip::Transport::Type::kUndefined);
+    chip::Transport::AdminPairingTable admins;
+    chip::Transport::AdminPairingInfo * adminInfo = admins.AssignAdminId(0, chip::kTestDeviceNodeId);
+
+    NL_TEST_ASSERT(apSuite, adminInfo != nullptr);
+
+    err = chip::Platform::MemoryInit();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::gSystemLayer.Init(nullptr);
+
+    err = chip::gSessionManager.Init(chip::kTestDeviceNodeId, &chip::gSystemLayer, &chip::gTransportManager, &admins);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = chip::gExchangeManager.Init(&chip::gSessionManager);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("CheckWriteClientCoalescing", chip::app::TestWriteInteraction::TestWriteClientCoalescing),
+    NL_TEST_DEF("CheckWriteClientWildcardPath", chip::app::TestWriteInteraction::TestWriteClientWildcardPath),
+    NL_TEST_DEF("CheckWriteHandler", chip::app::TestWriteInteraction::TestWriteHandler),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestWriteInteraction()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+	{
+        "TestWriteInteraction",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    InitializeChip(&theSuite);
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestWriteInteraction)
@@ -28,12 +28,15 @@
 
 #include <core/CHIPCore.h>
 #include <inttypes.h>
+#include <string.h>
 
 namespace {
 struct ResponseCallbackInfo
 {
     chip::NodeId nodeId;
     uint8_t sequenceNumber;
+    // Tells the deadline of this registration apart from those of earlier ones, 0 without a deadline.
+    uint32_t generation;
 
     bool operator==(ResponseCallbackInfo const & other) { return nodeId == other.nodeId && sequenceNumber == other.sequenceNumber; }
 };
@@ -51,6 +54,32 @@ struct ReportCallbackInfo
             attributeId == other.attributeId;
     }
 };
+
+// The infos are copied over the mInfoPtr and mInfoScalar members of the callbacks.
+constexpr size_t kCallbackInfoSize =
+    offsetof(chip::Callback::Cancelable, mCancel) - offsetof(chip::Callback::Cancelable, mInfoPtr);
+static_assert(sizeof(ResponseCallbackInfo) <= kCallbackInfoSize, "ResponseCallbackInfo does not fit in a Cancelable");
+static_assert(sizeof(ReportCallbackInfo) <= kCallbackInfoSize, "ReportCallbackInfo does not fit in a Cancelable");
+
+uint64_t Mix(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+}
+
+size_t ResponseBucket(chip::NodeId nodeId, uint8_t sequenceNumber, size_t bucketCount)
+{
+    return static_cast<size_t>(Mix(nodeId ^ (static_cast<uint64_t>(sequenceNumber) << 56)) % bucketCount);
+}
+
+size_t ReportBucket(chip::NodeId nodeId, chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId,
+                    size_t bucketCount)
+{
+    uint64_t key = static_cast<uint64_t>(endpointId) << 32 | static_cast<uint64_t>(clusterId) << 16 | attributeId;
+    return static_cast<size_t>(Mix(nodeId ^ Mix(key)) % bucketCount);
+}
 } // namespace
 
 namespace chip {
@@ -59,29 +88,68 @@ namespace app {
 CHIP_ERROR CHIPDeviceCallbacksMgr::AddResponseCallback(NodeId nodeId, uint8_t sequenceNumber,
                                                        Callback::Cancelable * onSuccessCallback,
                                                        Callback::Cancelable * onFailureCallback)
+{
+    return RegisterResponseCallback(nodeId, sequenceNumber, onSuccessCallback, onFailureCallback, 0);
+}
+
+CHIP_ERROR CHIPDeviceCallbacksMgr::AddResponseCallback(NodeId nodeId, uint8_t sequenceNumber,
+                                                       Callback::Cancelable * onSuccessCallback,
+                                                       Callback::Cancelable * onFailureCallback, System::Timer::Epoch deadline)
 {
     VerifyOrReturnError(onSuccessCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(onFailureCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    ResponseCallbackInfo info = { nodeId, sequenceNumber };
+    if (mResponseDeadlineCount == kMaxResponseDeadlines)
+    {
+        DropStaleResponseDeadlines();
+        VerifyOrReturnError(mResponseDeadlineCount < kMaxResponseDeadlines, CHIP_ERROR_NO_MEMORY);
+    }
+
+    // Generation 0 is that of the registrations without a deadline.
+    if (++mResponseGeneration == 0)
+    {
+        mResponseGeneration = 1;
+    }
+
+    ReturnErrorOnFailure(
+        RegisterResponseCallback(nodeId, sequenceNumber, onSuccessCallback, onFailureCallback, mResponseGeneration));
+    PushResponseDeadline({ deadline, nodeId, mResponseGeneration, sequenceNumber });
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CHIPDeviceCallbacksMgr::RegisterResponseCallback(NodeId nodeId, uint8_t sequenceNumber,
+                                                            Callback::Cancelable * onSuccessCallback,
+                                                            Callback::Cancelable * onFailureCallback, uint32_t generation)
+{
+    VerifyOrReturnError(onSuccessCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(onFailureCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ResponseCallbackInfo info = { nodeId, sequenceNumber, generation };
+    size_t bucket             = ResponseBucket(nodeId, sequenceNumber, kBucketCount);
+
+    // Take ownership of the callbacks first, as they may still be registered, and their infos are overwritten.
+    onSuccessCallback->Cancel();
+    onFailureCallback->Cancel();
     memcpy(&onSuccessCallback->mInfoPtr, &info, sizeof(info));
     memcpy(&onFailureCallback->mInfoPtr, &info, sizeof(info));
 
     // If some callbacks have already been registered for the same ResponseCallbackInfo, it usually means that the response
     // has not been received for a previous command with the same sequenceNumber. Cancel the previously registered callbacks.
-    CancelCallback(info, mResponsesSuccess);
-    CancelCallback(info, mResponsesFailure);
+    CancelCallback(info, mResponsesSuccess[bucket]);
+    CancelCallback(info, mResponsesFailure[bucket]);
 
-    mResponsesSuccess.Enqueue(onSuccessCallback);
-    mResponsesFailure.Enqueue(onFailureCallback);
+    mResponsesSuccess[bucket].Enqueue(onSuccessCallback);
+    mResponsesFailure[bucket].Enqueue(onFailureCallback);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR CHIPDeviceCallbacksMgr::CancelResponseCallback(NodeId nodeId, uint8_t sequenceNumber)
 {
-    ResponseCallbackInfo info = { nodeId, sequenceNumber };
-    CancelCallback(info, mResponsesSuccess);
-    CancelCallback(info, mResponsesFailure);
+    ResponseCallbackInfo info = { nodeId, sequenceNumber, 0 };
+    size_t bucket             = ResponseBucket(nodeId, sequenceNumber, kBucketCount);
+
+    CancelCallback(info, mResponsesSuccess[bucket]);
+    CancelCallback(info, mResponsesFailure[bucket]);
     return CHIP_NO_ERROR;
 }
 
@@ -89,29 +157,67 @@ CHIP_ERROR CHIPDeviceCallbacksMgr::GetResponseCallback(NodeId nodeId, uint8_t se
                                                        Callback::Cancelable ** onSuccessCallback,
                                                        Callback::Cancelable ** onFailureCallback)
 {
-    ResponseCallbackInfo info = { nodeId, sequenceNumber };
+    ResponseCallbackInfo info = { nodeId, sequenceNumber, 0 };
+    size_t bucket             = ResponseBucket(nodeId, sequenceNumber, kBucketCount);
 
-    ReturnErrorOnFailure(GetCallback(info, mResponsesSuccess, onSuccessCallback));
+    ReturnErrorOnFailure(GetCallback(info, mResponsesSuccess[bucket], onSuccessCallback));
     (*onSuccessCallback)->Cancel();
 
-    ReturnErrorOnFailure(GetCallback(info, mResponsesFailure, onFailureCallback));
+    ReturnErrorOnFailure(GetCallback(info, mResponsesFailure[bucket], onFailureCallback));
     (*onFailureCallback)->Cancel();
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CHIPDeviceCallbacksMgr::GetExpiredResponseCallback(System::Timer::Epoch now, NodeId * nodeId, uint8_t * sequenceNumber,
+                                                              Callback::Cancelable ** onSuccessCallback,
+                                                              Callback::Cancelable ** onFailureCallback)
+{
+    VerifyOrReturnError(nodeId != nullptr && sequenceNumber != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    while (mResponseDeadlineCount > 0 && mResponseDeadlines[0].deadline <= now)
+    {
+        ResponseDeadline entry = mResponseDeadlines[0];
+        PopResponseDeadline();
+
+        if (IsResponseDeadlinePending(entry))
+        {
+            *nodeId         = entry.nodeId;
+            *sequenceNumber = entry.sequenceNumber;
+            return GetResponseCallback(entry.nodeId, entry.sequenceNumber, onSuccessCallback, onFailureCallback);
+        }
+    }
+
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
+bool CHIPDeviceCallbacksMgr::GetNextResponseDeadline(System::Timer::Epoch & deadline)
+{
+    while (mResponseDeadlineCount > 0 && !IsResponseDeadlinePending(mResponseDeadlines[0]))
+    {
+        PopResponseDeadline();
+    }
+
+    VerifyOrReturnError(mResponseDeadlineCount > 0, false);
+    deadline = mResponseDeadlines[0].deadline;
+    return true;
+}
+
 CHIP_ERROR CHIPDeviceCallbacksMgr::AddReportCallback(NodeId nodeId, EndpointId endpointId, ClusterId clusterId,
                                                      AttributeId attributeId, Callback::Cancelable * onReportCallback)
 {
     VerifyOrReturnError(onReportCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     ReportCallbackInfo info = { nodeId, endpointId, clusterId, attributeId };
+    size_t bucket           = ReportBucket(nodeId, endpointId, clusterId, attributeId, kBucketCount);
+
+    onReportCallback->Cancel();
     memmove(&onReportCallback->mInfoPtr, &info, sizeof(info));
 
     // If a callback has already been registered for the same ReportCallbackInfo, let's cancel it.
-    CancelCallback(info, mReports);
+    CancelCallback(info, mReports[bucket]);
 
-    mReports.Enqueue(onReportCallback);
+    mReports[bucket].Enqueue(onReportCallback);
     return CHIP_NO_ERROR;
 }
 
@@ -119,11 +225,86 @@ CHIP_ERROR CHIPDeviceCallbacksMgr::GetReportCallback(NodeId nodeId, EndpointId e
                                                      AttributeId attributeId, Callback::Cancelable ** onReportCallback)
 {
     ReportCallbackInfo info = { nodeId, endpointId, clusterId, attributeId };
+    size_t bucket           = ReportBucket(nodeId, endpointId, clusterId, attributeId, kBucketCount);
 
-    ReturnErrorOnFailure(GetCallback(info, mReports, onReportCallback));
+    ReturnErrorOnFailure(GetCallback(info, mReports[bucket], onReportCallback));
 
     return CHIP_NO_ERROR;
 }
 
+bool CHIPDeviceCallbacksMgr::IsResponseDeadlinePending(const ResponseDeadline & entry)
+{
+    ResponseCallbackInfo info = { entry.nodeId, entry.sequenceNumber, 0 };
+    size_t bucket             = ResponseBucket(entry.nodeId, entry.sequenceNumber, kBucketCount);
+    Callback::Cancelable * ca = nullptr;
+
+    // The callbacks of the node and sequence number may have been registered again since, with a later deadline or none.
+    VerifyOrReturnError(GetCallback(info, mResponsesSuccess[bucket], &ca) == CHIP_NO_ERROR, false);
+    return reinterpret_cast<ResponseCallbackInfo *>(&ca->mInfoPtr)->generation == entry.generation;
+}
+
+void CHIPDeviceCallbacksMgr::PushResponseDeadline(const ResponseDeadline & entry)
+{
+    size_t index = mResponseDeadlineCount++;
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (mResponseDeadlines[parent].deadline <= entry.deadline)
+        {
+            break;
+        }
+        mResponseDeadlines[index] = mResponseDeadlines[parent];
+        index                     = parent;
+    }
+    mResponseDeadlines[index] = entry;
+}
+
+void CHIPDeviceCallbacksMgr::PopResponseDeadline()
+{
+    mResponseDeadlines[0] = mResponseDeadlines[--mResponseDeadlineCount];
+    SiftDownResponseDeadline(0);
+}
+
+void CHIPDeviceCallbacksMgr::SiftDownResponseDeadline(size_t index)
+{
+    ResponseDeadline entry = mResponseDeadlines[index];
+
+    while (2 * index + 1 < mResponseDeadlineCount)
+    {
+        size_t child = 2 * index + 1;
+        if (child + 1 < mResponseDeadlineCount && mResponseDeadlines[child + 1].deadline < mResponseDeadlines[child].deadline)
+        {
+            child++;
+        }
+        if (entry.deadline <= mResponseDeadlines[child].deadline)
+        {
+            break;
+        }
+        mResponseDeadlines[index] = mResponseDeadlines[child];
+        index                     = child;
+    }
+    mResponseDeadlines[index] = entry;
+}
+
+void CHIPDeviceCallbacksMgr::DropStaleResponseDeadlines()
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < mResponseDeadlineCount; i++)
+    {
+        if (IsResponseDeadlinePending(mResponseDeadlines[i]))
+        {
+            mResponseDeadlines[count++] = mResponseDeadlines[i];
+        }
+    }
+    mResponseDeadlineCount = count;
+
+    for (size_t i = count / 2; i-- > 0;)
+    {
+        SiftDownResponseDeadline(i);
+    }
+}
+
 } // namespace app
 } // namespace chip
@@ -28,8 +28,12 @@
 
 #include <app/util/basic-types.h>
 #include <core/CHIPCallback.h>
+#include <core/CHIPConfig.h>
 #include <core/CHIPError.h>
 #include <support/DLLUtil.h>
+#include <system/SystemTimer.h>
+
+#include <stddef.h>
 
 namespace chip {
 namespace app {
@@ -49,10 +53,29 @@ public:
 
     CHIP_ERROR AddResponseCallback(NodeId nodeId, uint8_t sequenceNumber, Callback::Cancelable * onSuccessCallback,
                                    Callback::Cancelable * onFailureCallback);
+    /**
+     * Registers the callbacks of a response like the above, and gives up on the response at deadline, after which
+     * GetExpiredResponseCallback returns the callbacks. Returns CHIP_ERROR_NO_MEMORY without registering the callbacks
+     * when CHIP_CONFIG_DEVICE_CALLBACKS_MGR_MAX_RESPONSE_DEADLINES responses already have a deadline.
+     */
+    CHIP_ERROR AddResponseCallback(NodeId nodeId, uint8_t sequenceNumber, Callback::Cancelable * onSuccessCallback,
+                                   Callback::Cancelable * onFailureCallback, System::Timer::Epoch deadline);
     CHIP_ERROR CancelResponseCallback(NodeId nodeId, uint8_t sequenceNumber);
     CHIP_ERROR GetResponseCallback(NodeId nodeId, uint8_t sequenceNumber, Callback::Cancelable ** onSuccessCallback,
                                    Callback::Cancelable ** onFailureCallback);
 
+    /**
+     * Returns, like GetResponseCallback, the callbacks of a response whose deadline is at or before now, or
+     * CHIP_ERROR_KEY_NOT_FOUND when none is. The caller calls the failure callback, and calls this again until
+     * CHIP_ERROR_KEY_NOT_FOUND is returned.
+     */
+    CHIP_ERROR GetExpiredResponseCallback(System::Timer::Epoch now, NodeId * nodeId, uint8_t * sequenceNumber,
+                                          Callback::Cancelable ** onSuccessCallback, Callback::Cancelable ** onFailureCallback);
+    /**
+     * Sets deadline to the earliest deadline of the pending responses, returning false when no pending response has one.
+     */
+    bool GetNextResponseDeadline(System::Timer::Epoch & deadline);
+
     CHIP_ERROR AddReportCallback(NodeId nodeId, EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
                                  Callback::Cancelable * onReportCallback);
     CHIP_ERROR GetReportCallback(NodeId nodeId, EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
@@ -61,6 +84,31 @@ public:
 private:
     CHIPDeviceCallbacksMgr() {}
 
+    static constexpr size_t kBucketCount          = CHIP_CONFIG_DEVICE_CALLBACKS_MGR_BUCKETS;
+    static constexpr size_t kMaxResponseDeadlines = CHIP_CONFIG_DEVICE_CALLBACKS_MGR_MAX_RESPONSE_DEADLINES;
+
+    static_assert(kBucketCount > 0, "The callback tables need at least one bucket");
+
+    // The deadlines of responses are kept in a binary min-heap. A response that is received or cancelled leaves its entry
+    // behind, which the generation tells apart from a later registration of the same node and sequence number, until
+    // the entry reaches the top of the heap, or room is needed.
+    struct ResponseDeadline
+    {
+        System::Timer::Epoch deadline;
+        NodeId nodeId;
+        uint32_t generation;
+        uint8_t sequenceNumber;
+    };
+
+    CHIP_ERROR RegisterResponseCallback(NodeId nodeId, uint8_t sequenceNumber, Callback::Cancelable * onSuccessCallback,
+                                        Callback::Cancelable * onFailureCallback, uint32_t generation);
+
+    bool IsResponseDeadlinePending(const ResponseDeadline & entry);
+    void PushResponseDeadline(const ResponseDeadline & entry);
+    void PopResponseDeadline();
+    void SiftDownResponseDeadline(size_t index);
+    void DropStaleResponseDeadlines();
+
     template <typename T>
     CHIP_ERROR CancelCallback(T & info, Callback::CallbackDeque & queue)
     {
@@ -93,9 +141,14 @@ private:
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
 
-    Callback::CallbackDeque mResponsesSuccess;
-    Callback::CallbackDeque mResponsesFailure;
-    Callback::CallbackDeque mReports;
+    // The callbacks are kept in hash buckets, from which they are dequeued in constant time when cancelled.
+    Callback::CallbackDeque mResponsesSuccess[kBucketCount];
+    Callback::CallbackDeque mResponsesFailure[kBucketCount];
+    Callback::CallbackDeque mReports[kBucketCount];
+
+    ResponseDeadline mResponseDeadlines[kMaxResponseDeadlines];
+    size_t mResponseDeadlineCount = 0;
+    uint32_t mResponseGeneration  = 0;
 };
 
 } // namespace app
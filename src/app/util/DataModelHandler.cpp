@@ -67,7 +67,9 @@ void InitDataModelHandler(chip::Messaging::ExchangeManager * exchangeManager)
 
 void HandleDataModelMessage(Messaging::ExchangeContext * exchange, System::PacketBufferHandle buffer)
 {
-#ifdef USE_ZAP_CONFIG
+#if CHIP_DATA_MODEL_MINIMAL
+    ChipLogDetail(Zcl, "Dropped a legacy data model message");
+#elif defined(USE_ZAP_CONFIG)
     EmberApsFrame frame;
     bool ok = extractApsFrame(buffer->Start(), buffer->DataLength(), &frame) > 0;
     if (ok)
@@ -45,6 +45,8 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <system/SystemTimer.h>
 
+#include <algorithm>
+
 #define EMBER_MAX_EVENT_CONTROL_DELAY_MS (UINT32_MAX / 2)
 #define EMBER_MAX_EVENT_CONTROL_DELAY_QS (EMBER_MAX_EVENT_CONTROL_DELAY_MS >> 8)
 #define EMBER_MAX_EVENT_CONTROL_DELAY_MINUTES (EMBER_MAX_EVENT_CONTROL_DELAY_MS >> 16)
@@ -96,21 +98,77 @@ EmberEventData emAfEvents[] = {
     { NULL, NULL }
 };
 
-void EventControlHandler(chip::System::Layer * systemLayer, void * appState, chip::System::Error error)
+// All events share one timer, armed for the earliest deadline of the active
+// events. The deadline of an event is kept in timeToExecute as a time of the
+// monotonic clock, in milliseconds, which wraps around safely since delays
+// are at most EMBER_MAX_EVENT_CONTROL_DELAY_MS.
+static bool sDispatchingEvents = false;
+
+static uint32_t GetEventClockMS()
+{
+    return static_cast<uint32_t>(chip::System::Layer::GetClock_MonotonicMS());
+}
+
+static bool IsEventDue(const EmberEventControl * control, uint32_t now)
+{
+    return static_cast<int32_t>(now - control->timeToExecute) >= 0;
+}
+
+static void DispatchEvents(chip::System::Layer * systemLayer, void * appState, chip::System::Error error);
+
+static void RescheduleEventTimer()
+{
+    const uint32_t now = GetEventClockMS();
+    bool anyActive     = false;
+    uint32_t delayMs   = 0;
+
+    // Rescheduled once all due events are handled
+    if (sDispatchingEvents)
+    {
+        return;
+    }
+
+    for (auto & event : emAfEvents)
+    {
+        if (event.control == NULL || event.control->status == EMBER_EVENT_INACTIVE)
+        {
+            continue;
+        }
+
+        const uint32_t eventDelayMs = IsEventDue(event.control, now) ? 0 : event.control->timeToExecute - now;
+        if (!anyActive || eventDelayMs < delayMs)
+        {
+            delayMs   = eventDelayMs;
+            anyActive = true;
+        }
+    }
+
+    if (anyActive)
+    {
+        chip::DeviceLayer::SystemLayer.StartTimer(delayMs, DispatchEvents, nullptr);
+    }
+    else
+    {
+        chip::DeviceLayer::SystemLayer.CancelTimer(DispatchEvents, nullptr);
+    }
+}
+
+static void DispatchEvents(chip::System::Layer * systemLayer, void * appState, chip::System::Error error)
 {
-    EmberEventControl * control = reinterpret_cast<EmberEventControl *>(appState);
-    if (control->status != EMBER_EVENT_INACTIVE)
+    const uint32_t now = GetEventClockMS();
+
+    sDispatchingEvents = true;
+    for (auto & event : emAfEvents)
     {
-        for (auto & event : emAfEvents)
+        if (event.control != NULL && event.control->status != EMBER_EVENT_INACTIVE && IsEventDue(event.control, now))
         {
-            if (event.control == control)
-            {
-                control->status = EMBER_EVENT_INACTIVE;
-                event.handler();
-                return;
-            }
+            event.control->status = EMBER_EVENT_INACTIVE;
+            event.handler();
         }
     }
+    sDispatchingEvents = false;
+
+    RescheduleEventTimer();
 }
 
 const char emAfStackEventString[] = "Stack";
@@ -118,8 +176,47 @@ const char emAfStackEventString[] = "Stack";
 // *****************************************************************************
 // Functions
 
+#if defined(EMBER_AF_GENERATED_EVENT_CONTEXT)
+// Indexes of emAfAppEventContext sorted by endpoint, cluster and side, for
+// ticks to find their context without going through the whole table
+static uint16_t sEventContextIndex[EMBER_AF_EVENT_CONTEXT_LENGTH];
+static bool sEventContextIndexBuilt = false;
+
+static bool EventContextLess(const EmberAfEventContext & context, EndpointId endpoint, ClusterId clusterId, bool isClient)
+{
+    if (context.endpoint != endpoint)
+    {
+        return context.endpoint < endpoint;
+    }
+    if (context.clusterId != clusterId)
+    {
+        return context.clusterId < clusterId;
+    }
+    return context.isClient < isClient;
+}
+
+static void BuildEventContextIndex()
+{
+    for (uint16_t i = 0; i < emAfAppEventContextLength; i++)
+    {
+        sEventContextIndex[i] = i;
+    }
+
+    std::sort(sEventContextIndex, sEventContextIndex + emAfAppEventContextLength, [](uint16_t a, uint16_t b) {
+        const EmberAfEventContext & other = emAfAppEventContext[b];
+        return EventContextLess(emAfAppEventContext[a], other.endpoint, other.clusterId, other.isClient);
+    });
+    sEventContextIndexBuilt = true;
+}
+#endif // EMBER_AF_GENERATED_EVENT_CONTEXT
+
 // A function used to initialize events for idling
-void emAfInitEvents(void) {}
+void emAfInitEvents(void)
+{
+#if defined(EMBER_AF_GENERATED_EVENT_CONTEXT)
+    BuildEventContextIndex();
+#endif // EMBER_AF_GENERATED_EVENT_CONTEXT
+}
 
 const char * emberAfGetEventString(uint8_t index)
 {
@@ -129,10 +226,19 @@ const char * emberAfGetEventString(uint8_t index)
 static EmberAfEventContext * findEventContext(EndpointId endpoint, ClusterId clusterId, bool isClient)
 {
 #if defined(EMBER_AF_GENERATED_EVENT_CONTEXT)
-    uint16_t i;
-    for (i = 0; i < emAfAppEventContextLength; i++)
+    if (!sEventContextIndexBuilt)
     {
-        EmberAfEventContext * context = &(emAfAppEventContext[i]);
+        BuildEventContextIndex();
+    }
+
+    const uint16_t * begin = sEventContextIndex;
+    const uint16_t * end   = begin + emAfAppEventContextLength;
+    const uint16_t * found = std::lower_bound(begin, end, 0, [&](uint16_t index, int) {
+        return EventContextLess(emAfAppEventContext[index], endpoint, clusterId, isClient);
+    });
+    if (found != end)
+    {
+        EmberAfEventContext * context = &(emAfAppEventContext[*found]);
         if (context->endpoint == endpoint && context->clusterId == clusterId && context->isClient == isClient)
         {
             return context;
@@ -150,8 +256,9 @@ EmberStatus emberEventControlSetDelayMS(EmberEventControl * control, uint32_t de
     }
     else if (delayMs <= EMBER_MAX_EVENT_CONTROL_DELAY_MS)
     {
-        control->status = EMBER_EVENT_MS_TIME;
-        chip::DeviceLayer::SystemLayer.StartTimer(delayMs, EventControlHandler, control);
+        control->status        = EMBER_EVENT_MS_TIME;
+        control->timeToExecute = GetEventClockMS() + delayMs;
+        RescheduleEventTimer();
     }
     else
     {
@@ -162,11 +269,9 @@ EmberStatus emberEventControlSetDelayMS(EmberEventControl * control, uint32_t de
 
 void emberEventControlSetInactive(EmberEventControl * control)
 {
-    if (control->status != EMBER_EVENT_INACTIVE)
-    {
-        control->status = EMBER_EVENT_INACTIVE;
-        chip::DeviceLayer::SystemLayer.CancelTimer(EventControlHandler, control);
-    }
+    // The shared timer is left armed, it is rescheduled for the next active
+    // event when it fires
+    control->status = EMBER_EVENT_INACTIVE;
 }
 
 bool emberEventControlGetActive(EmberEventControl * control)
@@ -176,8 +281,9 @@ bool emberEventControlGetActive(EmberEventControl * control)
 
 void emberEventControlSetActive(EmberEventControl * control)
 {
-    control->status = EMBER_EVENT_ZERO_DELAY;
-    chip::DeviceLayer::SystemLayer.ScheduleWork(EventControlHandler, control);
+    control->status        = EMBER_EVENT_ZERO_DELAY;
+    control->timeToExecute = GetEventClockMS();
+    RescheduleEventTimer();
 }
 
 EmberStatus emberAfEventControlSetDelayQS(EmberEventControl * control, uint32_t delayQs)
@@ -355,9 +355,8 @@ EmberStatus emberAfSendMulticast(GroupId multicastId, EmberApsFrame * apsFrame,
 
 EmberStatus emberAfSendMulticastToBindings(EmberApsFrame * apsFrame, uint16_t messageLength, uint8_t * message)
 {
-    EmberStatus status = EMBER_INVALID_BINDING_INDEX;
+    EmberStatus status = EMBER_SUCCESS;
     uint8_t i;
-    EmberBindingTableEntry binding;
     GroupId groupDest;
 
     if ((NULL == apsFrame) || (0 == messageLength) || (NULL == message))
@@ -365,20 +364,16 @@ EmberStatus emberAfSendMulticastToBindings(EmberApsFrame * apsFrame, uint16_t me
         return EMBER_BAD_ARGUMENT;
     }
 
-    for (i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
+    for (i = emberFirstBindingIndex(apsFrame->sourceEndpoint, apsFrame->clusterId); i != EMBER_NULL_BINDING_INDEX;
+         i = emberNextBindingIndex(i))
     {
-        status = emberGetBinding(i, &binding);
-        if (status != EMBER_SUCCESS)
-        {
-            return status;
-        }
+        const EmberBindingTableEntry * binding = emberPeekBinding(i);
 
-        if (binding.type == EMBER_MULTICAST_BINDING && binding.local == apsFrame->sourceEndpoint &&
-            binding.clusterId == apsFrame->clusterId)
+        if (binding->type == EMBER_MULTICAST_BINDING)
         {
-            groupDest                     = binding.groupId;
+            groupDest                     = binding->groupId;
             apsFrame->groupId             = groupDest;
-            apsFrame->destinationEndpoint = binding.remote;
+            apsFrame->destinationEndpoint = binding->remote;
 
             status = emberAfSendMulticast(groupDest, // multicast ID
                                           apsFrame, messageLength, message);
@@ -460,21 +455,17 @@ EmberStatus emberAfSendUnicast(EmberOutgoingMessageType type, MessageSendDestina
 EmberStatus emberAfSendUnicastToBindingsWithCallback(EmberApsFrame * apsFrame, uint16_t messageLength, uint8_t * message,
                                                      EmberAfMessageSentFunction callback)
 {
-    EmberStatus status = EMBER_INVALID_BINDING_INDEX;
+    EmberStatus status = EMBER_SUCCESS;
     uint8_t i;
 
-    for (i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
+    for (i = emberFirstBindingIndex(apsFrame->sourceEndpoint, apsFrame->clusterId); i != EMBER_NULL_BINDING_INDEX;
+         i = emberNextBindingIndex(i))
     {
-        EmberBindingTableEntry binding;
-        status = emberGetBinding(i, &binding);
-        if (status != EMBER_SUCCESS)
-        {
-            return status;
-        }
-        if (binding.type == EMBER_UNICAST_BINDING && binding.local == apsFrame->sourceEndpoint &&
-            binding.clusterId == apsFrame->clusterId)
+        const EmberBindingTableEntry * binding = emberPeekBinding(i);
+
+        if (binding->type == EMBER_UNICAST_BINDING)
         {
-            apsFrame->destinationEndpoint = binding.remote;
+            apsFrame->destinationEndpoint = binding->remote;
             status = send(EMBER_OUTGOING_VIA_BINDING, MessageSendDestination(i), apsFrame, messageLength, message,
                           false, // broadcast?
                           0,     // alias
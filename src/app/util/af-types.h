@@ -268,6 +268,23 @@ typedef struct
     uint16_t manufacturerCode;
 } EmberAfAttributeSearchRecord;
 
+/**
+ * @brief An update of a server attribute, applied along with others by
+ * emberAfWriteServerAttributes.
+ */
+typedef struct
+{
+    chip::EndpointId endpoint;
+    chip::ClusterId clusterId;
+    chip::AttributeId attributeId;
+    uint8_t * dataPtr;
+    EmberAfAttributeType dataType;
+    /**
+     * Set to the result of the update once it is applied.
+     */
+    EmberAfStatus status;
+} EmberAfAttributeUpdate;
+
 /**
  * A struct used to construct a table of manufacturer codes for
  * manufacturer specific attributes and clusters.
@@ -523,6 +540,16 @@ typedef struct
      * Meta-data about the endpoint
      */
     EmberAfEndpointBitmask bitmask;
+    /**
+     * Storage of the attributes of a dynamic endpoint, or NULL if they are
+     * stored in attributeData.
+     */
+    uint8_t * dataStorage;
+    /**
+     * Data version of each cluster of endpointType, by index, or NULL if the
+     * versions of the clusters of this endpoint are not kept.
+     */
+    chip::DataVersion * dataVersions;
 } EmberAfDefinedEndpoint;
 
 // Cluster specific types
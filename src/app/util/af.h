@@ -72,6 +72,8 @@
 #include <app/util/debug-printing.h>
 #include <app/util/ember-print.h>
 
+#include <support/Span.h>
+
 /** @name Attribute Storage */
 // @{
 
@@ -205,6 +207,23 @@ EmberAfStatus emberAfWriteAttribute(chip::EndpointId endpoint, chip::ClusterId c
 EmberAfStatus emberAfWriteServerAttribute(chip::EndpointId endpoint, chip::ClusterId cluster, chip::AttributeId attributeID,
                                           uint8_t * dataPtr, EmberAfAttributeType dataType);
 
+/**
+ * @brief write many cluster server attributes at once.
+ *
+ * Each update is applied as emberAfWriteServerAttribute would, with
+ * its callbacks, and its result is set in its status. An update that
+ * fails does not stop the ones after it. The changes are reported
+ * together by one run of the reporting engine, once every update is
+ * applied, rather than have the engine rescheduled for each. This is
+ * meant for a bridge syncing the state of a device it bridges.
+ *
+ * @return EMBER_ZCL_STATUS_SUCCESS if every update succeeded, else
+ *         the status of the first update that failed.
+ *
+ * @see emberAfWriteServerAttribute
+ */
+EmberAfStatus emberAfWriteServerAttributes(EmberAfAttributeUpdate * updates, uint16_t count);
+
 /**
  * @brief write a cluster client attribute.
  *
@@ -345,6 +364,25 @@ EmberAfStatus emberAfReadManufacturerSpecificClientAttribute(chip::EndpointId en
                                                              chip::AttributeId attributeID, uint16_t manufacturerCode,
                                                              uint8_t * dataPtr, uint16_t readLength);
 
+/**
+ * @brief Read the attribute value in place, performing all the checks.
+ *
+ * Rather than copying the attribute into a buffer, this function points
+ * value at the attribute storage, so that a large value can be encoded
+ * from where it is stored. Strings are spanned without their length prefix,
+ * and lists with their number of elements. The span is read-only, and only
+ * valid until the attribute is next written: it must be used before the
+ * event loop gets control back. dataType may be NULL.
+ *
+ * Externally stored attributes are not held in the attribute storage, and
+ * get ::EMBER_ZCL_STATUS_DEFINED_OUT_OF_BAND: they are read with
+ * ::emberAfReadAttribute instead.
+ *
+ * @see emberAfReadAttribute
+ */
+EmberAfStatus emberAfReadAttributeSpan(chip::EndpointId endpoint, chip::ClusterId cluster, chip::AttributeId attributeID,
+                                       uint8_t mask, chip::ByteSpan * value, EmberAfAttributeType * dataType);
+
 /**
  * @brief this function returns the size of the ZCL data in bytes.
  *
@@ -381,6 +419,17 @@ uint8_t emberAfGetDataSize(uint8_t dataType);
  */
 #define emberAfAttributeIsTokenized(metadata) (((metadata)->mask & ATTRIBUTE_MASK_TOKENIZE) != 0)
 
+/**
+ * @brief Writes the tokenized attributes changed since they were last saved
+ * to their tokens.
+ *
+ * With EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT set, the writes of the changes of
+ * tokenized attributes are deferred.  Applications call this before shutting
+ * down, or when the battery runs low, for the changes not to be lost.  It does
+ * nothing if no change is waiting to be written.
+ */
+void emberAfFlushAttributeTokens(void);
+
 /**
  * @brief macro that returns true if attribute is saved in external storage.
  *
@@ -471,6 +520,33 @@ uint8_t emberAfEndpointCount(void);
  */
 uint8_t emberAfFixedEndpointCount(void);
 
+/**
+ * @brief Adds a dynamic endpoint in slot index, of the EMBER_AF_DYNAMIC_ENDPOINT_COUNT
+ * slots, with the clusters of endpointType.
+ *
+ * The storage of its attributes is allocated, they are set to their default values and
+ * the clusters are initialized.  endpointType must outlive the endpoint, and its
+ * attributes must not be singletons.
+ *
+ * @return EMBER_ZCL_STATUS_SUCCESS, EMBER_ZCL_STATUS_INVALID_VALUE if the slot is out of
+ * range or the endpoint id is used, EMBER_ZCL_STATUS_DUPLICATE_EXISTS if the slot is
+ * taken, or EMBER_ZCL_STATUS_INSUFFICIENT_SPACE if the storage could not be allocated.
+ */
+EmberAfStatus emberAfSetDynamicEndpoint(uint8_t index, chip::EndpointId id, EmberAfEndpointType * endpointType, uint16_t deviceId,
+                                        uint8_t deviceVersion);
+
+/**
+ * @brief Removes the dynamic endpoint in slot index and frees the storage of its attributes.
+ *
+ * @return The id of the endpoint removed, or EMBER_BROADCAST_ENDPOINT if the slot was empty.
+ */
+chip::EndpointId emberAfClearDynamicEndpoint(uint8_t index);
+
+/**
+ * @brief Returns the slot of a dynamic endpoint, or 0xFF if it is not one.
+ */
+uint8_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
+
 /**
  * Data types are either analog or discrete. This makes a difference for
  * some of the ZCL global commands
@@ -40,12 +40,21 @@
  ******************************************************************************/
 
 #include "app/util/common.h"
+#include <app/AttributeObserverRegistry.h>
+#include <app/reporting/Engine.h>
 #include <app/util/af.h>
 #include <app/util/attribute-storage.h>
 
 #include "gen/attribute-type.h"
 #include "gen/callback.h"
 
+#include <platform/CHIPDeviceLayer.h>
+#include <support/CHIPMem.h>
+#include <support/RandUtils.h>
+#include <system/SystemTimer.h>
+
+#include <algorithm>
+
 using namespace chip;
 
 //------------------------------------------------------------------------------
@@ -115,8 +124,345 @@ const uint16_t attributeManufacturerCodeCount                   = GENERATED_ATTR
 // Returns endpoint index within a given cluster
 static uint8_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterId, uint8_t mask, uint16_t manufacturerCode);
 
+static void buildAttributeIndex(void);
+
+#if EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+// The endpoint type of the empty dynamic endpoint slots, so that they are walked like the others.
+static EmberAfEndpointType emptyEndpointType = { NULL, 0, 0 };
+
+static void clearDynamicEndpointSlot(uint8_t ep);
+#endif // EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+
+//------------------------------------------------------------------------------
+// Attribute index
+//
+// Sorted by (endpoint, cluster id, attribute id), so that an attribute is
+// found with a binary search instead of a walk of the endpoint, cluster and
+// attribute tables.  Entries with the same ids, e.g. for the client and server
+// sides of a cluster, are adjacent and in table order, and are told apart with
+// emAfMatchCluster/emAfMatchAttribute as in the linear search.
+
+#if EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0 || EMBER_AF_FIXED_ATTRIBUTE_INDEX
+typedef struct
+{
+    EndpointId endpoint;
+    uint8_t endpointIndex;
+    ClusterId clusterId;
+    AttributeId attributeId;
+    uint8_t clusterIndex;
+    uint16_t attributeIndex;
+    // Offset of the attribute in attributeData, or in the storage of a dynamic endpoint.
+    uint16_t dataOffset;
+} EmberAfAttributeIndexEntry;
+
+static bool attributeIndexKeyLess(const EmberAfAttributeIndexEntry & entry, const EmberAfAttributeSearchRecord & record)
+{
+    if (entry.endpoint != record.endpoint)
+    {
+        return entry.endpoint < record.endpoint;
+    }
+    if (entry.clusterId != record.clusterId)
+    {
+        return entry.clusterId < record.clusterId;
+    }
+    return entry.attributeId < record.attributeId;
+}
+
+static constexpr bool attributeIndexEntryLess(const EmberAfAttributeIndexEntry & a, const EmberAfAttributeIndexEntry & b)
+{
+    if (a.endpoint != b.endpoint)
+    {
+        return a.endpoint < b.endpoint;
+    }
+    if (a.clusterId != b.clusterId)
+    {
+        return a.clusterId < b.clusterId;
+    }
+    if (a.attributeId != b.attributeId)
+    {
+        return a.attributeId < b.attributeId;
+    }
+    // Keep table order between entries with the same ids.
+    if (a.endpointIndex != b.endpointIndex)
+    {
+        return a.endpointIndex < b.endpointIndex;
+    }
+    if (a.clusterIndex != b.clusterIndex)
+    {
+        return a.clusterIndex < b.clusterIndex;
+    }
+    return a.attributeIndex < b.attributeIndex;
+}
+
+#if EMBER_AF_FIXED_ATTRIBUTE_INDEX
+static bool fixedEndpointIsUnchanged(uint8_t ep);
+#endif // EMBER_AF_FIXED_ATTRIBUTE_INDEX
+
+// Returns the entry for the attribute described by attRecord in the sorted index [begin, end), or NULL.  Entries
+// of the compile-time index of the fixed endpoints are skipped if the application has since changed the endpoint.
+static const EmberAfAttributeIndexEntry * findAttributeIndexEntry(const EmberAfAttributeIndexEntry * begin,
+                                                                  const EmberAfAttributeIndexEntry * end,
+                                                                  EmberAfAttributeSearchRecord * attRecord, bool fixedIndex)
+{
+    const EmberAfAttributeIndexEntry * entry = std::lower_bound(begin, end, *attRecord, attributeIndexKeyLess);
+
+    for (; entry < end && entry->endpoint == attRecord->endpoint && entry->clusterId == attRecord->clusterId &&
+         entry->attributeId == attRecord->attributeId;
+         entry++)
+    {
+#if EMBER_AF_FIXED_ATTRIBUTE_INDEX
+        if (fixedIndex && !fixedEndpointIsUnchanged(entry->endpointIndex))
+        {
+            continue;
+        }
+#endif // EMBER_AF_FIXED_ATTRIBUTE_INDEX
+        if (!emberAfEndpointIndexIsEnabled(entry->endpointIndex))
+        {
+            continue;
+        }
+
+        EmberAfCluster * cluster      = &(emAfEndpoints[entry->endpointIndex].endpointType->cluster[entry->clusterIndex]);
+        EmberAfAttributeMetadata * am = &(cluster->attributes[entry->attributeIndex]);
+        if (emAfMatchCluster(cluster, attRecord) && emAfMatchAttribute(cluster, am, attRecord))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+#endif // EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0 || EMBER_AF_FIXED_ATTRIBUTE_INDEX
+
+#if EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0
+static EmberAfAttributeIndexEntry attributeIndex[EMBER_AF_ATTRIBUTE_INDEX_SIZE];
+static uint16_t attributeIndexCount = 0;
+static bool attributeIndexValid     = false;
+#endif // EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0
+
+#if EMBER_AF_FIXED_ATTRIBUTE_INDEX
+// Compile-time copies of the ZAP-generated tables for the fixed endpoints.  The
+// ZAP_ macros are expanded where the tables are used, so they are redefined
+// here to keep what can be evaluated by the compiler and drop the pointers.
+
+typedef struct
+{
+} EmberAfFixedAttributeDefault;
+
+typedef struct
+{
+    AttributeId attributeId;
+    EmberAfAttributeType attributeType;
+    uint16_t size;
+    EmberAfAttributeMask mask;
+    EmberAfFixedAttributeDefault defaultValue;
+} EmberAfFixedAttributeMetadata;
+
+typedef struct
+{
+    ClusterId clusterId;
+    uint16_t attributeIndex;
+    uint16_t attributeCount;
+    uint16_t clusterSize;
+    EmberAfClusterMask mask;
+    const EmberAfGenericClusterFunction * functions;
+} EmberAfFixedCluster;
+
+typedef struct
+{
+    uint16_t clusterIndex;
+    uint8_t clusterCount;
+    uint16_t endpointSize;
+} EmberAfFixedEndpointType;
+
+#undef ZAP_LONG_DEFAULTS_INDEX
+#undef ZAP_MIN_MAX_DEFAULTS_INDEX
+#undef ZAP_EMPTY_DEFAULT
+#undef ZAP_SIMPLE_DEFAULT
+#undef ZAP_ATTRIBUTE_INDEX
+#undef ZAP_CLUSTER_INDEX
+#define ZAP_LONG_DEFAULTS_INDEX(index)                                                                                             \
+    {                                                                                                                              \
+    }
+#define ZAP_MIN_MAX_DEFAULTS_INDEX(index)                                                                                          \
+    {                                                                                                                              \
+    }
+#define ZAP_EMPTY_DEFAULT()                                                                                                        \
+    {                                                                                                                              \
+    }
+#define ZAP_SIMPLE_DEFAULT(x)                                                                                                      \
+    {                                                                                                                              \
+    }
+#define ZAP_ATTRIBUTE_INDEX(index) (index)
+#define ZAP_CLUSTER_INDEX(index) (index)
+
+static constexpr EmberAfFixedAttributeMetadata fixedAttributes[] = GENERATED_ATTRIBUTES;
+static constexpr EmberAfFixedCluster fixedClusters[]             = GENERATED_CLUSTERS;
+static constexpr EmberAfFixedEndpointType fixedEndpointTypes[]   = GENERATED_ENDPOINT_TYPES;
+static constexpr EndpointId fixedEndpointNumbers[]               = FIXED_ENDPOINT_ARRAY;
+static constexpr uint8_t fixedEndpointTypeIndices[]              = FIXED_ENDPOINT_TYPES;
+
+static constexpr uint16_t countFixedAttributes(void)
+{
+    uint16_t count = 0;
+
+    for (uint8_t ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
+    {
+        const EmberAfFixedEndpointType & endpointType = fixedEndpointTypes[fixedEndpointTypeIndices[ep]];
+
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType.clusterCount; clusterIndex++)
+        {
+            count = static_cast<uint16_t>(count + fixedClusters[endpointType.clusterIndex + clusterIndex].attributeCount);
+        }
+    }
+
+    return count;
+}
+
+static constexpr uint16_t fixedAttributeCount = countFixedAttributes();
+
+typedef struct
+{
+    EmberAfAttributeIndexEntry entries[fixedAttributeCount > 0 ? fixedAttributeCount : 1];
+} EmberAfFixedAttributeIndex;
+
+// Builds the index of the fixed endpoints the way buildAttributeIndex() does at runtime, sorting by insertion.
+static constexpr EmberAfFixedAttributeIndex buildFixedAttributeIndex(void)
+{
+    EmberAfFixedAttributeIndex index = {};
+    uint16_t count                   = 0;
+    uint16_t endpointOffset          = 0;
+
+    for (uint8_t ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
+    {
+        const EmberAfFixedEndpointType & endpointType = fixedEndpointTypes[fixedEndpointTypeIndices[ep]];
+        uint16_t clusterOffset                        = endpointOffset;
+
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType.clusterCount; clusterIndex++)
+        {
+            const EmberAfFixedCluster & cluster = fixedClusters[endpointType.clusterIndex + clusterIndex];
+            uint16_t dataOffset                 = clusterOffset;
+
+            for (uint16_t attrIndex = 0; attrIndex < cluster.attributeCount; attrIndex++)
+            {
+                const EmberAfFixedAttributeMetadata & am = fixedAttributes[cluster.attributeIndex + attrIndex];
+                const EmberAfAttributeIndexEntry entry   = {
+                    fixedEndpointNumbers[ep], ep, cluster.clusterId, am.attributeId, clusterIndex, attrIndex, dataOffset
+                };
+                uint16_t position = count++;
+
+                for (; position > 0 && attributeIndexEntryLess(entry, index.entries[position - 1]); position--)
+                {
+                    index.entries[position] = index.entries[position - 1];
+                }
+                index.entries[position] = entry;
+
+                if (!(am.mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am.mask & ATTRIBUTE_MASK_SINGLETON))
+                {
+                    dataOffset = static_cast<uint16_t>(dataOffset + am.size);
+                }
+            }
+
+            clusterOffset = static_cast<uint16_t>(clusterOffset + cluster.clusterSize);
+        }
+
+        endpointOffset = static_cast<uint16_t>(endpointOffset + endpointType.endpointSize);
+    }
+
+    return index;
+}
+
+// Kept in flash: built by the compiler rather than by emberAfEndpointConfigure().
+static constexpr EmberAfFixedAttributeIndex fixedAttributeIndex = buildFixedAttributeIndex();
+
+// Returns true if fixed endpoint index ep still describes the endpoint the ZAP configuration defines.
+static bool fixedEndpointIsUnchanged(uint8_t ep)
+{
+    return ep < FIXED_ENDPOINT_COUNT && ep < emberAfEndpointCount() && emAfEndpoints[ep].endpoint == fixedEndpointNumbers[ep] &&
+        emAfEndpoints[ep].endpointType == &(generatedEmberAfEndpointTypes[fixedEndpointTypeIndices[ep]]);
+}
+#endif // EMBER_AF_FIXED_ATTRIBUTE_INDEX
+
+static void buildAttributeIndex(void)
+{
+#if EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0
+    uint16_t endpointOffset = 0;
+
+    attributeIndexCount = 0;
+    attributeIndexValid = false;
+
+    for (uint8_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    {
+        EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+        uint16_t clusterOffset             = (emAfEndpoints[ep].dataStorage != NULL ? 0 : endpointOffset);
+
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+            uint16_t dataOffset      = clusterOffset;
+
+            for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+            {
+                EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+
+                if (attributeIndexCount == EMBER_AF_ATTRIBUTE_INDEX_SIZE)
+                {
+                    // Too many attributes to index: lookups fall back to the linear search.
+                    return;
+                }
+
+                EmberAfAttributeIndexEntry & entry = attributeIndex[attributeIndexCount++];
+                entry.endpoint                     = emAfEndpoints[ep].endpoint;
+                entry.endpointIndex                = ep;
+                entry.clusterId                    = cluster->clusterId;
+                entry.attributeId                  = am->attributeId;
+                entry.clusterIndex                 = clusterIndex;
+                entry.attributeIndex               = attrIndex;
+                entry.dataOffset                   = dataOffset;
+
+                if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                {
+                    dataOffset = static_cast<uint16_t>(dataOffset + emberAfAttributeSize(am));
+                }
+            }
+
+            clusterOffset = static_cast<uint16_t>(clusterOffset + cluster->clusterSize);
+        }
+
+        if (emAfEndpoints[ep].dataStorage == NULL)
+        {
+            endpointOffset = static_cast<uint16_t>(endpointOffset + endpointType->endpointSize);
+        }
+    }
+
+    std::sort(attributeIndex, attributeIndex + attributeIndexCount, attributeIndexEntryLess);
+    attributeIndexValid = true;
+#endif // EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0
+}
+
 //------------------------------------------------------------------------------
 
+// The data versions of the clusters of an endpoint, each starting from a random
+// value for the versions a client cached before a reboot not to match. A NULL
+// return, when there is no memory left, only leaves the clusters unversioned.
+static DataVersion * allocateDataVersions(const EmberAfEndpointType * endpointType)
+{
+    if (endpointType->clusterCount == 0)
+    {
+        return NULL;
+    }
+
+    DataVersion * dataVersions =
+        static_cast<DataVersion *>(chip::Platform::MemoryCalloc(endpointType->clusterCount, sizeof(DataVersion)));
+    if (dataVersions != NULL)
+    {
+        for (uint8_t i = 0; i < endpointType->clusterCount; i++)
+        {
+            dataVersions[i] = chip::GetRandU32();
+        }
+    }
+    return dataVersions;
+}
+
 // Initial configuration
 void emberAfEndpointConfigure(void)
 {
@@ -139,12 +485,25 @@ void emberAfEndpointConfigure(void)
         emAfEndpoints[ep].endpointType  = endpointTypeMacro(ep);
         emAfEndpoints[ep].networkIndex  = endpointNetworkIndex(ep);
         emAfEndpoints[ep].bitmask       = EMBER_AF_ENDPOINT_ENABLED;
+        emAfEndpoints[ep].dataStorage   = NULL;
+        chip::Platform::MemoryFree(emAfEndpoints[ep].dataVersions);
+        emAfEndpoints[ep].dataVersions = allocateDataVersions(emAfEndpoints[ep].endpointType);
     }
+
+#if EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+    for (ep = FIXED_ENDPOINT_COUNT; ep < MAX_ENDPOINT_COUNT; ep++)
+    {
+        clearDynamicEndpointSlot(ep);
+    }
+#endif // EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+
+    buildAttributeIndex();
 }
 
 void emberAfSetEndpointCount(uint8_t dynamicEndpointCount)
 {
     emberEndpointCount = static_cast<uint8_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    buildAttributeIndex();
 }
 
 uint8_t emberAfFixedEndpointCount(void)
@@ -252,6 +611,22 @@ void emAfClusterAttributeChangedCallback(EndpointId endpoint, ClusterId clusterI
                                          uint8_t clientServerMask, uint16_t manufacturerCode)
 {
     EmberAfCluster * cluster = emberAfFindClusterWithMfgCode(endpoint, clusterId, clientServerMask, manufacturerCode);
+
+    if (clientServerMask == CLUSTER_MASK_SERVER)
+    {
+        // Bumped before the change is reported, for the report to carry the new version
+        DataVersion * dataVersion = emberAfDataVersionStorage(endpoint, clusterId);
+        if (dataVersion != NULL)
+        {
+            (*dataVersion)++;
+        }
+        InteractionModelReportingAttributeChangeCallback(endpoint, clusterId, attributeId);
+        if (manufacturerCode == EMBER_AF_NULL_MANUFACTURER_CODE)
+        {
+            app::AttributeObserverRegistry::GetInstance().NotifyAttributeChanged(endpoint, clusterId, attributeId);
+        }
+    }
+
     if (cluster != NULL)
     {
         if (manufacturerCode == EMBER_AF_NULL_MANUFACTURER_CODE)
@@ -337,6 +712,111 @@ void emAfCallInits(void)
     }
 }
 
+#if EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+static void clearDynamicEndpointSlot(uint8_t ep)
+{
+    if (emAfEndpoints[ep].dataStorage != NULL)
+    {
+        chip::Platform::MemoryFree(emAfEndpoints[ep].dataStorage);
+    }
+    chip::Platform::MemoryFree(emAfEndpoints[ep].dataVersions);
+    emAfEndpoints[ep].endpoint      = EMBER_BROADCAST_ENDPOINT;
+    emAfEndpoints[ep].deviceId      = 0;
+    emAfEndpoints[ep].deviceVersion = 0;
+    emAfEndpoints[ep].endpointType  = &emptyEndpointType;
+    emAfEndpoints[ep].networkIndex  = 0;
+    emAfEndpoints[ep].bitmask       = EMBER_AF_ENDPOINT_DISABLED;
+    emAfEndpoints[ep].dataStorage   = NULL;
+    emAfEndpoints[ep].dataVersions  = NULL;
+}
+#endif // EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+
+EmberAfStatus emberAfSetDynamicEndpoint(uint8_t index, EndpointId id, EmberAfEndpointType * endpointType, uint16_t deviceId,
+                                        uint8_t deviceVersion)
+{
+#if EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+    uint8_t ep = static_cast<uint8_t>(FIXED_ENDPOINT_COUNT + index);
+    uint8_t * dataStorage;
+
+    if (index >= EMBER_AF_DYNAMIC_ENDPOINT_COUNT || id == EMBER_BROADCAST_ENDPOINT ||
+        emberAfIndexFromEndpointIncludingDisabledEndpoints(id) != 0xFF)
+    {
+        return EMBER_ZCL_STATUS_INVALID_VALUE;
+    }
+    if (emAfEndpoints[ep].endpointType != &emptyEndpointType)
+    {
+        return EMBER_ZCL_STATUS_DUPLICATE_EXISTS;
+    }
+
+    // At least one byte, as a dynamic endpoint is told apart by its storage.
+    dataStorage =
+        static_cast<uint8_t *>(chip::Platform::MemoryCalloc(1, endpointType->endpointSize > 0 ? endpointType->endpointSize : 1));
+    if (dataStorage == NULL)
+    {
+        return EMBER_ZCL_STATUS_INSUFFICIENT_SPACE;
+    }
+
+    emAfEndpoints[ep].endpoint      = id;
+    emAfEndpoints[ep].deviceId      = deviceId;
+    emAfEndpoints[ep].deviceVersion = deviceVersion;
+    emAfEndpoints[ep].endpointType  = endpointType;
+    emAfEndpoints[ep].networkIndex  = 0;
+    emAfEndpoints[ep].bitmask       = EMBER_AF_ENDPOINT_ENABLED;
+    emAfEndpoints[ep].dataStorage   = dataStorage;
+    emAfEndpoints[ep].dataVersions  = allocateDataVersions(endpointType);
+
+    if (ep >= emberEndpointCount)
+    {
+        emberEndpointCount = static_cast<uint8_t>(ep + 1);
+    }
+    buildAttributeIndex();
+
+    emAfLoadAttributeDefaults(id, false);
+    initializeEndpoint(&(emAfEndpoints[ep]));
+    return EMBER_ZCL_STATUS_SUCCESS;
+#else
+    return EMBER_ZCL_STATUS_INVALID_VALUE;
+#endif // EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+}
+
+EndpointId emberAfClearDynamicEndpoint(uint8_t index)
+{
+    EndpointId id = EMBER_BROADCAST_ENDPOINT;
+
+#if EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+    uint8_t ep = static_cast<uint8_t>(FIXED_ENDPOINT_COUNT + index);
+
+    if (index < EMBER_AF_DYNAMIC_ENDPOINT_COUNT && emAfEndpoints[ep].dataStorage != NULL)
+    {
+        id = emAfEndpoints[ep].endpoint;
+        // Write the changes of its tokenized attributes while they are still stored
+        emberAfFlushAttributeTokens();
+        clearDynamicEndpointSlot(ep);
+
+        // Drop the empty slots at the end, so that the walks of the endpoints stop at the last one in use.
+        while (emberEndpointCount > FIXED_ENDPOINT_COUNT &&
+               emAfEndpoints[emberEndpointCount - 1].endpointType == &emptyEndpointType)
+        {
+            emberEndpointCount--;
+        }
+        buildAttributeIndex();
+    }
+#endif // EMBER_AF_DYNAMIC_ENDPOINT_COUNT > 0
+
+    return id;
+}
+
+uint8_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
+{
+    uint8_t ep = emberAfIndexFromEndpointIncludingDisabledEndpoints(id);
+
+    if (id == EMBER_BROADCAST_ENDPOINT || ep == 0xFF || emAfEndpoints[ep].dataStorage == NULL)
+    {
+        return 0xFF;
+    }
+    return static_cast<uint8_t>(ep - FIXED_ENDPOINT_COUNT);
+}
+
 // Returns the pointer to metadata, or null if it is not found
 EmberAfAttributeMetadata * emberAfLocateAttributeMetadata(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId,
                                                           uint8_t mask, uint16_t manufacturerCode)
@@ -508,6 +988,151 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
              (emAfGetManufacturerCodeForAttribute(cluster, am) == attRecord->manufacturerCode)));
 }
 
+// Reads or writes the attribute found for attRecord, stored at attributeStorage unless it is a
+// singleton or externally stored.
+static EmberAfStatus readOrWriteFoundAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster * cluster,
+                                               EmberAfAttributeMetadata * am, uint8_t * attributeStorage,
+                                               EmberAfAttributeMetadata ** metadata, uint8_t * buffer, uint16_t readLength,
+                                               bool write, int32_t index)
+{
+    // If passed metadata location is not null, populate
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+
+    uint8_t * attributeLocation = (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am) : attributeStorage);
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                 emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+    else
+    {
+        if (buffer == NULL)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+
+    return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
+                ? (write) ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                  emAfGetManufacturerCodeForAttribute(cluster, am), buffer)
+                          : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                 emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
+                                                                 emberAfAttributeSize(am))
+                : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
+}
+
+// Finds the attribute of attRecord, and its storage in the endpoint storage, which singletons and externally stored
+// attributes do not use.
+static bool locateAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster ** foundCluster,
+                            EmberAfAttributeMetadata ** foundMetadata, uint8_t ** foundStorage)
+{
+    uint8_t i;
+    uint16_t endpointOffset = 0;
+
+#if EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0 || EMBER_AF_FIXED_ATTRIBUTE_INDEX
+    const EmberAfAttributeIndexEntry * entry = NULL;
+
+#if EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0
+    if (attributeIndexValid)
+    {
+        entry = findAttributeIndexEntry(attributeIndex, attributeIndex + attributeIndexCount, attRecord, false);
+        if (entry == NULL)
+        {
+            return false;
+        }
+    }
+#endif // EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0
+
+#if EMBER_AF_FIXED_ATTRIBUTE_INDEX
+    // Attributes not found on the fixed endpoints may be on dynamic ones, and are left to the linear search.
+    if (entry == NULL)
+    {
+        entry = findAttributeIndexEntry(fixedAttributeIndex.entries, fixedAttributeIndex.entries + fixedAttributeCount, attRecord,
+                                        true);
+    }
+#endif // EMBER_AF_FIXED_ATTRIBUTE_INDEX
+
+    if (entry != NULL)
+    {
+        EmberAfDefinedEndpoint * de = &(emAfEndpoints[entry->endpointIndex]);
+        *foundCluster               = &(de->endpointType->cluster[entry->clusterIndex]);
+        *foundMetadata              = &((*foundCluster)->attributes[entry->attributeIndex]);
+        *foundStorage               = (de->dataStorage != NULL ? de->dataStorage : attributeData) + entry->dataOffset;
+        return true;
+    }
+#endif // EMBER_AF_ATTRIBUTE_INDEX_SIZE > 0 || EMBER_AF_FIXED_ATTRIBUTE_INDEX
+
+    for (i = 0; i < emberAfEndpointCount(); i++)
+    {
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        uint8_t * endpointStorage          = emAfEndpoints[i].dataStorage;
+        uint16_t attributeOffsetIndex      = 0;
+        uint8_t clusterIndex;
+
+        // Dynamic endpoints have storage of their own, and take no room in attributeData.
+        if (endpointStorage == NULL)
+        {
+            endpointStorage = attributeData + endpointOffset;
+            endpointOffset  = static_cast<uint16_t>(endpointOffset + endpointType->endpointSize);
+        }
+
+        if (emAfEndpoints[i].endpoint != attRecord->endpoint || !emberAfEndpointIndexIsEnabled(i))
+        { // Not the endpoint we are looking for
+            continue;
+        }
+
+        for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+            if (emAfMatchCluster(cluster, attRecord))
+            { // Got the cluster
+                uint16_t attrIndex;
+                for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                {
+                    EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                    if (emAfMatchAttribute(cluster, am, attRecord))
+                    { // Got the attribute
+                        *foundCluster  = cluster;
+                        *foundMetadata = am;
+                        *foundStorage  = endpointStorage + attributeOffsetIndex;
+                        return true;
+                    }
+                    else
+                    { // Not the attribute we are looking for
+                        // Increase the index if attribute is not externally stored
+                        if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                        {
+                            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                        }
+                    }
+                }
+            }
+            else
+            { // Not the cluster we are looking for
+                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+            }
+        }
+    }
+    return false;
+}
+
 // When reading non-string attributes, this function returns an error when destination
 // buffer isn't large enough to accommodate the attribute type.  For strings, the
 // function will copy at most readLength bytes.  This means the resulting string
@@ -524,102 +1149,83 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write, int32_t index)
 {
-    uint8_t i;
-    uint16_t attributeOffsetIndex = 0;
+    EmberAfCluster * cluster;
+    EmberAfAttributeMetadata * am;
+    uint8_t * storage;
 
-    for (i = 0; i < emberAfEndpointCount(); i++)
+    if (!locateAttribute(attRecord, &cluster, &am, &storage))
     {
-        if (emAfEndpoints[i].endpoint == attRecord->endpoint)
-        {
-            EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(i))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
-            {
-                EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != NULL)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                             am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == NULL)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                            am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
-                                            ? (write) ? emberAfExternalAttributeWriteCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer)
-                                                      : emberAfExternalAttributeReadCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
-                                                            emberAfAttributeSize(am))
-                                            : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
-                    }
-                }
-                else
-                { // Not the cluster we are looking for
-                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
-                }
-            }
-        }
-        else
-        { // Not the endpoint we are looking for
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
-        }
+        return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+    }
+    return readOrWriteFoundAttribute(attRecord, cluster, am, storage, metadata, buffer, readLength, write, index);
+}
+
+bool emAfLocateAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeLocation * location)
+{
+    return locateAttribute(attRecord, &location->cluster, &location->metadata, &location->storage);
+}
+
+EmberAfStatus emAfWriteLocatedAttribute(EmberAfAttributeSearchRecord * attRecord, const EmberAfAttributeLocation * location,
+                                        uint8_t * buffer)
+{
+    return readOrWriteFoundAttribute(attRecord, location->cluster, location->metadata, location->storage,
+                                     NULL, // metadata
+                                     buffer,
+                                     0,    // buffer size - unused
+                                     true, // write?
+                                     -1);  // index
+}
+
+// Reads the attribute found for attRecord without copying it, see emberAfReadAttributeSpan.
+EmberAfStatus emAfReadAttributeSpan(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                    ByteSpan * value)
+{
+    EmberAfCluster * cluster;
+    EmberAfAttributeMetadata * am;
+    uint8_t * storage;
+
+    if (!locateAttribute(attRecord, &cluster, &am, &storage))
+    {
+        return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE;
+    }
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                            emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+    {
+        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+    }
+    if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+    {
+        // The value is kept by the application, it can only be copied out through emAfReadOrWriteAttribute.
+        return EMBER_ZCL_STATUS_DEFINED_OUT_OF_BAND;
+    }
+
+    const uint8_t * location = (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am) : storage);
+    const uint16_t size      = emberAfAttributeSize(am);
+
+    // Strings are spanned without their length prefix, and never past their storage if the prefix is corrupted.
+    if (emberAfIsStringAttributeType(am->attributeType))
+    {
+        VerifyOrReturnError(size >= 1, EMBER_ZCL_STATUS_INSUFFICIENT_SPACE);
+        *value = ByteSpan(location + 1, std::min<uint16_t>(emberAfStringLength(location), static_cast<uint16_t>(size - 1)));
+    }
+    else if (emberAfIsLongStringAttributeType(am->attributeType))
+    {
+        VerifyOrReturnError(size >= 2, EMBER_ZCL_STATUS_INSUFFICIENT_SPACE);
+        *value = ByteSpan(location + 2, std::min<uint16_t>(emberAfLongStringLength(location), static_cast<uint16_t>(size - 2)));
+    }
+    else if (emberAfIsThisDataTypeAListType(am->attributeType))
+    {
+        *value = ByteSpan(location, std::min(emberAfAttributeValueListSize(attRecord->clusterId, am->attributeId, location), size));
     }
-    return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+    else
+    {
+        *value = ByteSpan(location, size);
+    }
+    return EMBER_ZCL_STATUS_SUCCESS;
 }
 
 // Check if a cluster is implemented or not. If yes, the cluster is returned.
@@ -658,6 +1264,26 @@ EmberAfCluster * emberAfFindClusterInType(EmberAfEndpointType * endpointType, Cl
     return emberAfFindClusterInTypeWithMfgCode(endpointType, clusterId, mask, EMBER_AF_NULL_MANUFACTURER_CODE);
 }
 
+DataVersion * emberAfDataVersionStorage(EndpointId endpoint, ClusterId clusterId)
+{
+    uint8_t ep = emberAfIndexFromEndpoint(endpoint);
+    if (ep == 0xFF || emAfEndpoints[ep].dataVersions == NULL)
+    {
+        return NULL;
+    }
+
+    EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+    for (uint8_t i = 0; i < endpointType->clusterCount; i++)
+    {
+        EmberAfCluster * cluster = &(endpointType->cluster[i]);
+        if (cluster->clusterId == clusterId && emberAfClusterIsServer(cluster))
+        {
+            return &(emAfEndpoints[ep].dataVersions[i]);
+        }
+    }
+    return NULL;
+}
+
 // This code is used during unit tests for clusters that do not involve manufacturer code.
 // Should this code be used in other locations, manufacturerCode should be added.
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
@@ -1174,6 +1800,39 @@ void emAfLoadAttributesFromTokens(EndpointId endpoint)
 // 'data' argument may be null, since we changed the ptrToDefaultValue
 // to be null instead of pointing to all zeroes.
 // This function has to be able to deal with that.
+static void saveAttributeToTokenNow(uint8_t * data, EndpointId endpoint, ClusterId clusterId, EmberAfAttributeMetadata * metadata)
+{
+// On EZSP host we currently do not support this. We need to come up with some
+// callbacks.
+#ifndef EZSP_HOST
+    GENERATED_TOKEN_SAVER;
+#endif // EZSP_HOST
+}
+
+#if EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT > 0
+namespace {
+
+struct DeferredTokenWrite
+{
+    EndpointId endpoint;
+    ClusterId clusterId;
+    EmberAfAttributeMetadata * metadata;
+};
+
+// The tokenized attributes changed since they were last written, each one once
+DeferredTokenWrite deferredTokenWrites[EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT];
+uint8_t deferredTokenWriteCount = 0;
+// When the first of them changed, for a stream of changes not to defer the write forever
+uint64_t firstDeferredTokenWriteMs = 0;
+
+void handleDeferredTokenWriteTimer(System::Layer * systemLayer, void * appState, System::Error error)
+{
+    emberAfFlushAttributeTokens();
+}
+
+} // namespace
+#endif // EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT > 0
+
 void emAfSaveAttributeToToken(uint8_t * data, EndpointId endpoint, ClusterId clusterId, EmberAfAttributeMetadata * metadata)
 {
     // Get out of here if this attribute doesn't have a token.
@@ -1182,11 +1841,85 @@ void emAfSaveAttributeToToken(uint8_t * data, EndpointId endpoint, ClusterId clu
         return;
     }
 
-// On EZSP host we currently do not support this. We need to come up with some
-// callbacks.
-#ifndef EZSP_HOST
-    GENERATED_TOKEN_SAVER;
-#endif // EZSP_HOST
+#if EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT > 0
+    // The value is read back from the attribute storage when the write is made.
+    const uint64_t now = System::Layer::GetClock_MonotonicMS();
+    uint8_t index      = 0;
+
+    while (index < deferredTokenWriteCount &&
+           !(deferredTokenWrites[index].endpoint == endpoint && deferredTokenWrites[index].clusterId == clusterId &&
+             deferredTokenWrites[index].metadata == metadata))
+    {
+        index++;
+    }
+
+    if (index == deferredTokenWriteCount)
+    {
+        if (deferredTokenWriteCount == 0)
+        {
+            firstDeferredTokenWriteMs = now;
+        }
+        deferredTokenWrites[deferredTokenWriteCount++] = { endpoint, clusterId, metadata };
+
+        if (deferredTokenWriteCount == EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT)
+        {
+            emberAfFlushAttributeTokens();
+            return;
+        }
+    }
+
+    // Each change restarts the quiet period, up to the longest delay of the first change
+    const uint64_t deadlineMs = firstDeferredTokenWriteMs + EMBER_AF_DEFERRED_TOKEN_WRITE_MAX_DELAY_MS;
+    uint32_t delayMs          = EMBER_AF_DEFERRED_TOKEN_WRITE_DELAY_MS;
+    if (deadlineMs <= now)
+    {
+        delayMs = 0;
+    }
+    else if (deadlineMs - now < delayMs)
+    {
+        delayMs = static_cast<uint32_t>(deadlineMs - now);
+    }
+    chip::DeviceLayer::SystemLayer.StartTimer(delayMs, handleDeferredTokenWriteTimer, nullptr);
+#else
+    saveAttributeToTokenNow(data, endpoint, clusterId, metadata);
+#endif // EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT > 0
+}
+
+void emberAfFlushAttributeTokens(void)
+{
+#if EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT > 0
+    uint8_t data[ATTRIBUTE_LARGEST];
+    const uint8_t count = deferredTokenWriteCount;
+
+    chip::DeviceLayer::SystemLayer.CancelTimer(handleDeferredTokenWriteTimer, nullptr);
+    // Changes made while writing are deferred again
+    deferredTokenWriteCount = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const DeferredTokenWrite & write = deferredTokenWrites[i];
+        EmberAfClusterMask clusterMask   = emberAfAttributeIsClient(write.metadata) ? CLUSTER_MASK_CLIENT : CLUSTER_MASK_SERVER;
+
+        // The endpoint may have been removed since
+        EmberAfCluster * cluster = emberAfFindClusterIncludingDisabledEndpoints(write.endpoint, write.clusterId, clusterMask);
+        if (cluster == NULL)
+        {
+            continue;
+        }
+
+        EmberAfAttributeSearchRecord record;
+        record.endpoint         = write.endpoint;
+        record.clusterId        = write.clusterId;
+        record.clusterMask      = clusterMask;
+        record.attributeId      = write.metadata->attributeId;
+        record.manufacturerCode = emAfGetManufacturerCodeForAttribute(cluster, write.metadata);
+
+        if (emAfReadOrWriteAttribute(&record, NULL, data, sizeof(data), false) == EMBER_ZCL_STATUS_SUCCESS)
+        {
+            saveAttributeToTokenNow(data, write.endpoint, write.clusterId, write.metadata);
+        }
+    }
+#endif // EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT > 0
 }
 
 // This function returns the actual function point from the array,
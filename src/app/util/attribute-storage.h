@@ -63,9 +63,9 @@
 #include ATTRIBUTE_STORAGE_CONFIGURATION
 #endif
 
-// If we have fixed number of endpoints, then max is the same.
+// If we have fixed number of endpoints, then max is the same, plus the slots for dynamic endpoints.
 #ifdef FIXED_ENDPOINT_COUNT
-#define MAX_ENDPOINT_COUNT FIXED_ENDPOINT_COUNT
+#define MAX_ENDPOINT_COUNT (FIXED_ENDPOINT_COUNT + EMBER_AF_DYNAMIC_ENDPOINT_COUNT)
 #endif
 
 #define CLUSTER_TICK_FREQ_ALL (0x00)
@@ -95,6 +95,20 @@ bool emberAfExtractCommandIds(bool outgoing, EmberAfClusterCommand * cmd, chip::
 
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write, int32_t index = -1);
+EmberAfStatus emAfReadAttributeSpan(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                    chip::ByteSpan * value);
+
+// Where an attribute found by emAfLocateAttribute is kept, for it to be written without being searched for again.
+typedef struct
+{
+    EmberAfCluster * cluster;
+    EmberAfAttributeMetadata * metadata;
+    uint8_t * storage;
+} EmberAfAttributeLocation;
+
+bool emAfLocateAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeLocation * location);
+EmberAfStatus emAfWriteLocatedAttribute(EmberAfAttributeSearchRecord * attRecord, const EmberAfAttributeLocation * location,
+                                        uint8_t * buffer);
 
 bool emAfMatchCluster(EmberAfCluster * cluster, EmberAfAttributeSearchRecord * attRecord);
 bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am, EmberAfAttributeSearchRecord * attRecord);
@@ -116,6 +130,11 @@ EmberAfCluster * emberAfFindClusterInType(EmberAfEndpointType * endpointType, ch
 //    clusterIndex(Y,12,CLUSTER_MASK_SERVER) returns 0xFF
 uint8_t emberAfClusterIndex(chip::EndpointId endpoint, chip::ClusterId clusterId, EmberAfClusterMask mask);
 
+// Returns the data version of the server cluster on the endpoint, which
+// changes whenever one of its attributes does, or NULL if the cluster is not
+// there or its version is not kept.
+chip::DataVersion * emberAfDataVersionStorage(chip::EndpointId endpoint, chip::ClusterId clusterId);
+
 // If server == true, returns the number of server clusters,
 // otherwise number of client clusters on this endpoint
 uint8_t emberAfClusterCount(chip::EndpointId endpoint, bool server);
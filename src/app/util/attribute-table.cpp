@@ -50,6 +50,7 @@
 #include "gen/callback.h"
 #include <app/util/af-main.h>
 
+#include <app/reporting/Engine.h>
 #include <app/reporting/reporting.h>
 
 using namespace chip;
@@ -110,6 +111,29 @@ EmberAfStatus emberAfWriteServerAttribute(EndpointId endpoint, ClusterId cluster
                               false); // just test?
 }
 
+EmberAfStatus emberAfWriteServerAttributes(EmberAfAttributeUpdate * updates, uint16_t count)
+{
+    EmberAfStatus status = EMBER_ZCL_STATUS_SUCCESS;
+
+    InteractionModelReportingBeginBatch();
+    for (uint16_t i = 0; i < count; i++)
+    {
+        EmberAfAttributeUpdate * update = &updates[i];
+
+        update->status = emAfWriteAttribute(update->endpoint, update->clusterId, update->attributeId, CLUSTER_MASK_SERVER,
+                                            EMBER_AF_NULL_MANUFACTURER_CODE, update->dataPtr, update->dataType,
+                                            true,   // override read-only?
+                                            false); // just test?
+        if (update->status != EMBER_ZCL_STATUS_SUCCESS && status == EMBER_ZCL_STATUS_SUCCESS)
+        {
+            status = update->status;
+        }
+    }
+    InteractionModelReportingEndBatch();
+
+    return status;
+}
+
 EmberAfStatus emberAfWriteManufacturerSpecificClientAttribute(EndpointId endpoint, ClusterId cluster, AttributeId attributeID,
                                                               uint16_t manufacturerCode, uint8_t * dataPtr,
                                                               EmberAfAttributeType dataType)
@@ -168,6 +192,26 @@ EmberAfStatus emberAfReadManufacturerSpecificClientAttribute(EndpointId endpoint
     return emAfReadAttribute(endpoint, cluster, attributeID, CLUSTER_MASK_CLIENT, manufacturerCode, dataPtr, readLength, NULL);
 }
 
+EmberAfStatus emberAfReadAttributeSpan(EndpointId endpoint, ClusterId cluster, AttributeId attributeID, uint8_t mask,
+                                       ByteSpan * value, EmberAfAttributeType * dataType)
+{
+    EmberAfAttributeMetadata * metadata = NULL;
+    EmberAfAttributeSearchRecord record;
+    EmberAfStatus status;
+    record.endpoint         = endpoint;
+    record.clusterId        = cluster;
+    record.clusterMask      = mask;
+    record.attributeId      = attributeID;
+    record.manufacturerCode = EMBER_AF_NULL_MANUFACTURER_CODE;
+    status                  = emAfReadAttributeSpan(&record, &metadata, value);
+
+    if (status == EMBER_ZCL_STATUS_SUCCESS && dataType != NULL)
+    {
+        (*dataType) = metadata->attributeType;
+    }
+    return status;
+}
+
 bool emberAfReadSequentialAttributesAddToResponse(EndpointId endpoint, ClusterId clusterId, AttributeId startAttributeId,
                                                   uint8_t mask, uint16_t manufacturerCode, uint8_t maxAttributeIds,
                                                   bool includeAccessControl)
@@ -488,16 +532,19 @@ EmberAfStatus emAfWriteAttribute(EndpointId endpoint, ClusterId cluster, Attribu
                                  bool overrideReadOnlyAndDataType, bool justTest)
 {
     EmberAfAttributeMetadata * metadata = NULL;
+    EmberAfAttributeLocation location;
     EmberAfAttributeSearchRecord record;
     record.endpoint         = endpoint;
     record.clusterId        = cluster;
     record.clusterMask      = mask;
     record.attributeId      = attributeID;
     record.manufacturerCode = manufacturerCode;
-    emAfReadOrWriteAttribute(&record, &metadata,
-                             NULL,   // buffer
-                             0,      // buffer size
-                             false); // write?
+
+    // The attribute is searched for once, and written where it was found.
+    if (emAfLocateAttribute(&record, &location))
+    {
+        metadata = location.metadata;
+    }
 
     // if we dont support that attribute
     if (metadata == NULL)
@@ -585,11 +632,7 @@ EmberAfStatus emAfWriteAttribute(EndpointId endpoint, ClusterId cluster, Attribu
         }
 
         // write the attribute
-        status = emAfReadOrWriteAttribute(&record,
-                                          NULL, // metadata
-                                          data,
-                                          0,     // buffer size - unused
-                                          true); // write?
+        status = emAfWriteLocatedAttribute(&record, &location, data);
 
         if (status != EMBER_ZCL_STATUS_SUCCESS)
         {
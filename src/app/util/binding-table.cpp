@@ -22,8 +22,86 @@
 #include "gen/gen_config.h"
 #include <app/util/binding-table.h>
 
+#include <string.h>
+
+using namespace chip;
+
 static EmberBindingTableEntry bindingTable[EMBER_BINDING_TABLE_SIZE];
 
+// Secondary index of the used bindings, hashed by local endpoint and cluster
+// into buckets chained in table order.  It is built on first use and kept up to
+// date by emberSetBinding() and emberDeleteBinding().
+static bool bindingIndexBuilt = false;
+// First binding of each bucket, and next binding in the bucket of each binding, or EMBER_NULL_BINDING_INDEX.
+static uint8_t bindingIndexBuckets[EMBER_BINDING_TABLE_SIZE];
+static uint8_t bindingIndexNext[EMBER_BINDING_TABLE_SIZE];
+
+static uint32_t bindingTableChangeCount = 0;
+
+static uint8_t * bindingIndexBucket(EndpointId local, ClusterId clusterId)
+{
+    uint32_t hash = (static_cast<uint32_t>(clusterId) << 8 | local) * 2654435761u;
+    return &bindingIndexBuckets[(hash >> 16) % EMBER_BINDING_TABLE_SIZE];
+}
+
+static void linkBinding(uint8_t index)
+{
+    const EmberBindingTableEntry & entry = bindingTable[index];
+
+    if (entry.type == EMBER_UNUSED_BINDING)
+    {
+        return;
+    }
+
+    uint8_t * link = bindingIndexBucket(entry.local, entry.clusterId);
+    while (*link != EMBER_NULL_BINDING_INDEX && *link < index)
+    {
+        link = &bindingIndexNext[*link];
+    }
+    bindingIndexNext[index] = *link;
+    *link                   = index;
+}
+
+static void unlinkBinding(uint8_t index)
+{
+    const EmberBindingTableEntry & entry = bindingTable[index];
+
+    if (entry.type == EMBER_UNUSED_BINDING)
+    {
+        return;
+    }
+
+    uint8_t * link = bindingIndexBucket(entry.local, entry.clusterId);
+    while (*link != index)
+    {
+        link = &bindingIndexNext[*link];
+    }
+    *link = bindingIndexNext[index];
+}
+
+static void buildBindingIndex(void)
+{
+    memset(bindingIndexBuckets, EMBER_NULL_BINDING_INDEX, sizeof(bindingIndexBuckets));
+    for (uint8_t i = 0; i < EMBER_BINDING_TABLE_SIZE; i++)
+    {
+        linkBinding(i);
+    }
+    bindingIndexBuilt = true;
+}
+
+// Returns the first binding of local and clusterId in the chain starting at index.
+static uint8_t findBinding(uint8_t index, EndpointId local, ClusterId clusterId)
+{
+    for (; index != EMBER_NULL_BINDING_INDEX; index = bindingIndexNext[index])
+    {
+        if (bindingTable[index].local == local && bindingTable[index].clusterId == clusterId)
+        {
+            return index;
+        }
+    }
+    return EMBER_NULL_BINDING_INDEX;
+}
+
 EmberStatus emberGetBinding(uint8_t index, EmberBindingTableEntry * result)
 {
     if (index >= EMBER_BINDING_TABLE_SIZE)
@@ -42,7 +120,16 @@ EmberStatus emberSetBinding(uint8_t index, EmberBindingTableEntry * result)
         return EMBER_BAD_ARGUMENT;
     }
 
+    if (bindingIndexBuilt)
+    {
+        unlinkBinding(index);
+    }
     bindingTable[index] = *result;
+    bindingTableChangeCount++;
+    if (bindingIndexBuilt)
+    {
+        linkBinding(index);
+    }
     return EMBER_SUCCESS;
 }
 
@@ -53,6 +140,46 @@ EmberStatus emberDeleteBinding(uint8_t index)
         return EMBER_BAD_ARGUMENT;
     }
 
+    if (bindingIndexBuilt)
+    {
+        unlinkBinding(index);
+    }
     bindingTable[index].type = EMBER_UNUSED_BINDING;
+    bindingTableChangeCount++;
     return EMBER_SUCCESS;
 }
+
+const EmberBindingTableEntry * emberPeekBinding(uint8_t index)
+{
+    if (index >= EMBER_BINDING_TABLE_SIZE)
+    {
+        return NULL;
+    }
+
+    return &bindingTable[index];
+}
+
+uint8_t emberFirstBindingIndex(EndpointId local, ClusterId clusterId)
+{
+    if (!bindingIndexBuilt)
+    {
+        buildBindingIndex();
+    }
+
+    return findBinding(*bindingIndexBucket(local, clusterId), local, clusterId);
+}
+
+uint8_t emberNextBindingIndex(uint8_t index)
+{
+    if (index >= EMBER_BINDING_TABLE_SIZE || !bindingIndexBuilt || bindingTable[index].type == EMBER_UNUSED_BINDING)
+    {
+        return EMBER_NULL_BINDING_INDEX;
+    }
+
+    return findBinding(bindingIndexNext[index], bindingTable[index].local, bindingTable[index].clusterId);
+}
+
+uint32_t emberBindingTableChangeCount(void)
+{
+    return bindingTableChangeCount;
+}
@@ -31,3 +31,33 @@ EmberStatus emberGetBinding(uint8_t index, EmberBindingTableEntry * result);
 EmberStatus emberSetBinding(uint8_t index, EmberBindingTableEntry * result);
 
 EmberStatus emberDeleteBinding(uint8_t index);
+
+#define EMBER_NULL_BINDING_INDEX 0xFF
+
+/**
+ * Returns the binding at index without copying it, or NULL if index is out of
+ * range.  The entry is only valid until the table is next changed.
+ */
+const EmberBindingTableEntry * emberPeekBinding(uint8_t index);
+
+/**
+ * Returns the index of the first used binding of a local endpoint and cluster,
+ * in table order, or EMBER_NULL_BINDING_INDEX if there is none.  All of them
+ * are visited with:
+ *
+ *   for (uint8_t i = emberFirstBindingIndex(local, clusterId); i != EMBER_NULL_BINDING_INDEX; i = emberNextBindingIndex(i))
+ */
+uint8_t emberFirstBindingIndex(chip::EndpointId local, chip::ClusterId clusterId);
+
+/**
+ * Returns the index of the next used binding, in table order, of the local
+ * endpoint and cluster of the binding at index, or EMBER_NULL_BINDING_INDEX.
+ */
+uint8_t emberNextBindingIndex(uint8_t index);
+
+/**
+ * Returns the number of changes made to the table so far.  Code that keeps a
+ * view of the bindings can compare it with the count it last saw to know
+ * whether the view has to be built again.
+ */
+uint32_t emberBindingTableChangeCount(void);
@@ -188,6 +188,55 @@
 #define EMBER_AF_MESSAGE_SENT_CALLBACK_TABLE_SIZE EMBER_APS_UNICAST_MESSAGE_COUNT
 #endif // EMBER_AF_MESSAGE_SENT_CALLBACK_TABLE_SIZE
 
+// The number of attribute instances, across all endpoints, that the attribute
+// storage can index for lookups by endpoint, cluster and attribute id.  The
+// index replaces the linear walk of the endpoint table on every attribute
+// read and write, at a cost of 12 bytes of RAM per entry.  It is not used if
+// set to 0, or if the endpoints have more attributes than it can hold.
+#ifndef EMBER_AF_ATTRIBUTE_INDEX_SIZE
+#define EMBER_AF_ATTRIBUTE_INDEX_SIZE 0
+#endif // EMBER_AF_ATTRIBUTE_INDEX_SIZE
+
+// If set to 1, the compiler builds the attribute index for the fixed
+// endpoints of the ZAP configuration and places it in flash, along with the
+// storage offset of each attribute.  Unlike EMBER_AF_ATTRIBUTE_INDEX_SIZE, it
+// takes no RAM, but it does not cover dynamic endpoints, which are still found
+// by the linear search unless both are enabled.
+#ifndef EMBER_AF_FIXED_ATTRIBUTE_INDEX
+#define EMBER_AF_FIXED_ATTRIBUTE_INDEX 0
+#endif // EMBER_AF_FIXED_ATTRIBUTE_INDEX
+
+// The number of endpoints, beyond the fixed endpoints of the ZAP
+// configuration, that the application can add and remove at runtime with
+// emberAfSetDynamicEndpoint() and emberAfClearDynamicEndpoint(), e.g. for the
+// devices behind a bridge.  The attributes of each one are stored in memory
+// allocated when it is added and freed when it is removed, rather than in
+// attributeData.
+#ifndef EMBER_AF_DYNAMIC_ENDPOINT_COUNT
+#define EMBER_AF_DYNAMIC_ENDPOINT_COUNT 0
+#endif // EMBER_AF_DYNAMIC_ENDPOINT_COUNT
+
+// The number of tokenized attributes whose writes to their tokens can be
+// deferred.  If set, a change of such an attribute only marks it dirty: the
+// dirty attributes are written together once they have not changed for
+// EMBER_AF_DEFERRED_TOKEN_WRITE_DELAY_MS, at most
+// EMBER_AF_DEFERRED_TOKEN_WRITE_MAX_DELAY_MS after the first change, when this
+// many are dirty, or when the application calls
+// emberAfFlushAttributeTokens().  A transition changing an attribute at tick
+// rate then writes it once, at the cost of the changes made since the last
+// write being lost on a reset.  Changes are written at once if set to 0.
+#ifndef EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT
+#define EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT 0
+#endif // EMBER_AF_DEFERRED_TOKEN_WRITE_COUNT
+
+#ifndef EMBER_AF_DEFERRED_TOKEN_WRITE_DELAY_MS
+#define EMBER_AF_DEFERRED_TOKEN_WRITE_DELAY_MS 1000
+#endif // EMBER_AF_DEFERRED_TOKEN_WRITE_DELAY_MS
+
+#ifndef EMBER_AF_DEFERRED_TOKEN_WRITE_MAX_DELAY_MS
+#define EMBER_AF_DEFERRED_TOKEN_WRITE_MAX_DELAY_MS 10000
+#endif // EMBER_AF_DEFERRED_TOKEN_WRITE_MAX_DELAY_MS
+
 #define EMBER_APPLICATION_HAS_COMMAND_ACTION_HANDLER
 
 // *******************************************************************
@@ -39,6 +39,11 @@
 
 #include "debug-printing-test.h"
 
+// Builds with CHIP_DATA_MODEL_MINIMAL compile the cluster print paths below out.
+#if CHIP_DATA_MODEL_MINIMAL
+#undef EMBER_AF_PRINT_ENABLE
+#endif // CHIP_DATA_MODEL_MINIMAL
+
 // Printing macros for cluster: Basic
 #if defined(EMBER_AF_PRINT_ENABLE) && defined(EMBER_AF_PRINT_BASIC_CLUSTER)
 #define emberAfBasicClusterPrint(...) emberAfPrint(EMBER_AF_PRINT_BASIC_CLUSTER, __VA_ARGS__)
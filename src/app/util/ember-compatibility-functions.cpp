@@ -24,11 +24,21 @@
 #include <app/util/ember-compatibility-functions.h>
 
 #include <app/Command.h>
+#include <app/InteractionModelEngine.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/attribute-table.h>
 #include <app/util/util.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/CodeUtils.h>
 
+#include "gen/attribute-type.h"
+
+#ifdef EMBER_AF_PLUGIN_GROUPS_SERVER
+#include <app/clusters/groups-server/groups-server.h>
+#endif // EMBER_AF_PLUGIN_GROUPS_SERVER
+
 namespace chip {
 namespace app {
 namespace Compatibility {
@@ -65,7 +75,8 @@ bool IMEmberAfSendDefaultResponseWithCallback(EmberAfStatus status)
         return false;
     }
 
-    chip::app::CommandPathParams returnStatusParam = { imCompatibilityEmberApsFrame.sourceEndpoint,
+    // The status has the path of the command, for the sender to match it with the command of its request.
+    chip::app::CommandPathParams returnStatusParam = { imCompatibilityEmberApsFrame.destinationEndpoint,
                                                        0, // GroupId
                                                        imCompatibilityEmberApsFrame.clusterId,
                                                        imCompatibilityEmberAfCluster.commandId,
@@ -84,5 +95,256 @@ void ResetEmberAfObjects()
 }
 
 } // namespace Compatibility
+
+bool ExpandAttributePath(const AttributePathParams & aWildcard, AttributePathCursor & aCursor, AttributePathParams & aPath)
+{
+    // Every loop resets the cursors within it when it moves on, so that the walk resumes exactly where it was left.
+    for (; aCursor.mEndpointIndex < emberAfEndpointCount();
+         aCursor.mEndpointIndex++, aCursor.mClusterIndex = 0, aCursor.mAttributeIndex = 0)
+    {
+        EndpointId endpoint = emberAfEndpointFromIndex(aCursor.mEndpointIndex);
+
+        if (!emberAfEndpointIndexIsEnabled(aCursor.mEndpointIndex) ||
+            (!aWildcard.mFlags.Has(AttributePathFlags::kEndpointIdWildcard) && endpoint != aWildcard.mEndpointId))
+        {
+            continue;
+        }
+
+        for (; aCursor.mClusterIndex < emberAfClusterCount(endpoint, true); aCursor.mClusterIndex++, aCursor.mAttributeIndex = 0)
+        {
+            const EmberAfCluster * cluster = emberAfGetNthCluster(endpoint, aCursor.mClusterIndex, true);
+
+            if (!aWildcard.mFlags.Has(AttributePathFlags::kClusterIdWildcard) && cluster->clusterId != aWildcard.mClusterId)
+            {
+                continue;
+            }
+
+            for (; aCursor.mAttributeIndex < cluster->attributeCount; aCursor.mAttributeIndex++)
+            {
+                AttributeId attributeId = cluster->attributes[aCursor.mAttributeIndex].attributeId;
+
+                // Field ids are 8 bits: the attributes above them cannot be reported on their own.
+                if (attributeId > UINT8_MAX ||
+                    (!aWildcard.mFlags.Has(AttributePathFlags::kFieldIdWildcard) && attributeId != aWildcard.mFieldId))
+                {
+                    continue;
+                }
+
+                aPath = AttributePathParams(aWildcard.mNodeId, endpoint, cluster->clusterId, static_cast<FieldId>(attributeId), 0,
+                                            AttributePathFlags::kFieldIdValid);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+namespace {
+
+// Encodes a value in the layout of the attribute store, with strings spanned without their length prefix.
+CHIP_ERROR EncodeAttributeValue(TLV::TLVWriter & aWriter, uint64_t aTag, EmberAfAttributeType aAttributeType, ByteSpan aValue)
+{
+    if (aAttributeType == ZCL_CHAR_STRING_ATTRIBUTE_TYPE || aAttributeType == ZCL_LONG_CHAR_STRING_ATTRIBUTE_TYPE)
+    {
+        return aWriter.PutString(aTag, reinterpret_cast<const char *>(aValue.data()), static_cast<uint32_t>(aValue.size()));
+    }
+    if (emberAfIsStringAttributeType(aAttributeType) || emberAfIsLongStringAttributeType(aAttributeType))
+    {
+        return aWriter.PutBytes(aTag, aValue.data(), static_cast<uint32_t>(aValue.size()));
+    }
+
+    // The elements of lists are structures of their cluster, which have no encoding in the data model yet.
+    VerifyOrReturnError(!emberAfIsThisDataTypeAListType(aAttributeType), CHIP_ERROR_NOT_IMPLEMENTED);
+    VerifyOrReturnError(aValue.size() <= sizeof(uint64_t), CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint64_t value = 0;
+    for (size_t i = 0; i < aValue.size(); i++)
+    {
+#if (BIGENDIAN_CPU)
+        value = (value << 8) | aValue.data()[i];
+#else
+        value |= static_cast<uint64_t>(aValue.data()[i]) << (8 * i);
+#endif
+    }
+
+    if (aAttributeType == ZCL_BOOLEAN_ATTRIBUTE_TYPE)
+    {
+        return aWriter.PutBoolean(aTag, value != 0);
+    }
+    if (emberAfIsTypeSigned(aAttributeType))
+    {
+        // Extend the sign of the narrower types.
+        if (aValue.size() > 0 && aValue.size() < sizeof(uint64_t))
+        {
+            const uint64_t signBit = 1ull << (8 * aValue.size() - 1);
+            value                  = (value ^ signBit) - signBit;
+        }
+        return aWriter.Put(aTag, static_cast<int64_t>(value));
+    }
+    return aWriter.Put(aTag, value);
+}
+
+} // namespace
+
+CHIP_ERROR ReadSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVWriter & aWriter)
+{
+    ByteSpan value;
+    EmberAfAttributeType attributeType;
+    EmberAfStatus status;
+
+    // Only whole attributes are read, not the items of a list.
+    VerifyOrReturnError(aAttributePathParams.mFlags.Has(AttributePathFlags::kFieldIdValid), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The value is encoded from the attribute store, without an intermediate copy.
+    status = emberAfReadAttributeSpan(aAttributePathParams.mEndpointId, aAttributePathParams.mClusterId,
+                                      aAttributePathParams.mFieldId, CLUSTER_MASK_SERVER, &value, &attributeType);
+    if (status == EMBER_ZCL_STATUS_DEFINED_OUT_OF_BAND)
+    {
+        // Externally stored attributes are held by the application, and copied out of it.
+        uint8_t data[ATTRIBUTE_LARGEST];
+
+        status = emberAfReadAttribute(aAttributePathParams.mEndpointId, aAttributePathParams.mClusterId,
+                                      aAttributePathParams.mFieldId, CLUSTER_MASK_SERVER, data, sizeof(data), &attributeType);
+        if (status == EMBER_ZCL_STATUS_SUCCESS)
+        {
+            EmberAfAttributeMetadata * metadata =
+                emberAfLocateAttributeMetadata(aAttributePathParams.mEndpointId, aAttributePathParams.mClusterId,
+                                               aAttributePathParams.mFieldId, CLUSTER_MASK_SERVER, EMBER_AF_NULL_MANUFACTURER_CODE);
+            VerifyOrReturnError(metadata != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+            if (emberAfIsStringAttributeType(attributeType))
+            {
+                value = ByteSpan(data + 1, emberAfStringLength(data));
+            }
+            else if (emberAfIsLongStringAttributeType(attributeType))
+            {
+                value = ByteSpan(data + 2, emberAfLongStringLength(data));
+            }
+            else
+            {
+                value = ByteSpan(data, emberAfAttributeSize(metadata));
+            }
+            return EncodeAttributeValue(aWriter, TLV::ContextTag(aAttributePathParams.mFieldId), attributeType, value);
+        }
+    }
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        ChipLogError(DataManagement, "Failed to read attribute %" PRIx16 " of cluster %" PRIx16 ": status %x",
+                     aAttributePathParams.mFieldId, aAttributePathParams.mClusterId, status);
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    return EncodeAttributeValue(aWriter, TLV::ContextTag(aAttributePathParams.mFieldId), attributeType, value);
+}
+
+CHIP_ERROR WriteSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVReader & aReader)
+{
+    uint8_t data[ATTRIBUTE_LARGEST];
+    EmberAfAttributeMetadata * metadata = nullptr;
+    EmberAfStatus status;
+    uint16_t size;
+
+    // Only whole attributes are written, not the items of a list.
+    VerifyOrReturnError(aAttributePathParams.mFlags.Has(AttributePathFlags::kFieldIdValid), CHIP_ERROR_INVALID_ARGUMENT);
+
+    metadata = emberAfLocateAttributeMetadata(aAttributePathParams.mEndpointId, aAttributePathParams.mClusterId,
+                                              aAttributePathParams.mFieldId, CLUSTER_MASK_SERVER, EMBER_AF_NULL_MANUFACTURER_CODE);
+    VerifyOrReturnError(metadata != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    size = emberAfAttributeSize(metadata);
+    VerifyOrReturnError(size <= sizeof(data), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // The TLV value is turned into the buffer, in the layout of the attribute type, the attribute store works with.
+    if (emberAfIsStringAttributeType(metadata->attributeType) || emberAfIsLongStringAttributeType(metadata->attributeType))
+    {
+        const uint16_t prefixLength = emberAfIsLongStringAttributeType(metadata->attributeType) ? 2 : 1;
+        const uint32_t length       = aReader.GetLength();
+
+        VerifyOrReturnError(length + prefixLength <= size && length < (prefixLength == 1 ? UINT8_MAX : UINT16_MAX),
+                            CHIP_ERROR_BUFFER_TOO_SMALL);
+        ReturnErrorOnFailure(aReader.GetBytes(data + prefixLength, static_cast<uint32_t>(sizeof(data) - prefixLength)));
+        data[0] = EMBER_LOW_BYTE(length);
+        if (prefixLength == 2)
+        {
+            data[1] = EMBER_HIGH_BYTE(length);
+        }
+    }
+    else
+    {
+        uint64_t value = 0;
+
+        VerifyOrReturnError(size <= sizeof(value), CHIP_ERROR_INVALID_ARGUMENT);
+        if (aReader.GetType() == TLV::kTLVType_Boolean)
+        {
+            bool boolValue;
+            ReturnErrorOnFailure(aReader.Get(boolValue));
+            value = boolValue ? 1 : 0;
+        }
+        else if (emberAfIsTypeSigned(metadata->attributeType))
+        {
+            int64_t signedValue;
+            ReturnErrorOnFailure(aReader.Get(signedValue));
+            value = static_cast<uint64_t>(signedValue);
+        }
+        else
+        {
+            ReturnErrorOnFailure(aReader.Get(value));
+        }
+
+        for (uint16_t i = 0; i < size; i++)
+        {
+#if (BIGENDIAN_CPU)
+            data[size - 1 - i] = static_cast<uint8_t>(value >> (8 * i));
+#else
+            data[i] = static_cast<uint8_t>(value >> (8 * i));
+#endif
+        }
+    }
+
+    // Through the checks of a write from the network: type, access and range, then the callbacks of the attribute.
+    status = emAfWriteAttribute(aAttributePathParams.mEndpointId, aAttributePathParams.mClusterId, aAttributePathParams.mFieldId,
+                                CLUSTER_MASK_SERVER, EMBER_AF_NULL_MANUFACTURER_CODE, data, metadata->attributeType,
+                                false /* overrideReadOnlyAndDataType */, false /* justTest */);
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        ChipLogError(DataManagement, "Failed to write attribute %" PRIx16 " of cluster %" PRIx16 ": status %x",
+                     aAttributePathParams.mFieldId, aAttributePathParams.mClusterId, status);
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    return CHIP_NO_ERROR;
+}
+
+bool NextGroupEndpoint(GroupId aGroupId, uint16_t & aEndpointIndex, EndpointId & aEndpointId)
+{
+#ifdef EMBER_AF_PLUGIN_GROUPS_SERVER
+    // One lookup of the group, which most group messages a device gets are not for.
+    const uint8_t * members = emberAfGroupsClusterGroupMembers(aGroupId);
+
+    for (; members != nullptr && aEndpointIndex < emberAfEndpointCount(); aEndpointIndex++)
+    {
+        EndpointId endpoint = emberAfEndpointFromIndex(static_cast<uint8_t>(aEndpointIndex));
+
+        if ((members[endpoint / 8] & EMBER_BIT(endpoint % 8)) != 0 &&
+            emberAfEndpointIndexIsEnabled(static_cast<uint8_t>(aEndpointIndex)))
+        {
+            aEndpointId = endpoint;
+            return true;
+        }
+    }
+#endif // EMBER_AF_PLUGIN_GROUPS_SERVER
+
+    // Without the groups server, no endpoint is a member of any group.
+    return false;
+}
+
+bool GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId, DataVersion & aDataVersion)
+{
+    const DataVersion * dataVersion = emberAfDataVersionStorage(aEndpointId, aClusterId);
+    VerifyOrReturnError(dataVersion != nullptr, false);
+
+    aDataVersion = *dataVersion;
+    return true;
+}
+
 } // namespace app
 } // namespace chip
@@ -0,0 +1,271 @@
+/**
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/****************************************************************************
+ * @file
+ * @brief Transitions of attributes over time.  The value of a transition is
+ * interpolated in fixed point from the time it started, so a late or missed
+ * tick does not slow it down, and is kept here rather than read back from the
+ * attribute on every tick.
+ *******************************************************************************
+ ******************************************************************************/
+
+#include <app/util/transition-engine.h>
+
+#include <app/reporting/reporting.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemLayer.h>
+
+using namespace chip;
+
+static EmberAfTransition transitionTable[EMBER_AF_TRANSITION_TABLE_SIZE];
+static bool transitionInUse[EMBER_AF_TRANSITION_TABLE_SIZE];
+static bool tickScheduled = false;
+
+static void transitionTick(System::Layer * systemLayer, void * appState, System::Error error);
+
+static uint32_t nowMs(void)
+{
+    return static_cast<uint32_t>(System::Layer::GetClock_MonotonicMS());
+}
+
+static int32_t wrapValue(const EmberAfTransition * transition, int64_t value)
+{
+    if (transition->modulus == 0)
+    {
+        return static_cast<int32_t>(value);
+    }
+    int64_t modulus = transition->modulus;
+    return static_cast<int32_t>(((value % modulus) + modulus) % modulus);
+}
+
+// The distance between two values of a transition, the short way around if they wrap.
+static uint32_t valueDistance(const EmberAfTransition * transition, int32_t a, int32_t b)
+{
+    uint32_t distance = static_cast<uint32_t>(a > b ? static_cast<int64_t>(a) - b : static_cast<int64_t>(b) - a);
+    if (transition->modulus != 0 && distance > transition->modulus / 2)
+    {
+        distance = transition->modulus - distance;
+    }
+    return distance;
+}
+
+static uint8_t findTransition(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+    for (uint8_t i = 0; i < EMBER_AF_TRANSITION_TABLE_SIZE; i++)
+    {
+        const EmberAfTransition * transition = &transitionTable[i];
+        if (transitionInUse[i] && transition->endpoint == endpoint && transition->clusterId == clusterId &&
+            transition->attributeId == attributeId)
+        {
+            return i;
+        }
+    }
+    return EMBER_AF_TRANSITION_TABLE_SIZE;
+}
+
+static void scheduleTick(uint32_t delayMs)
+{
+    if (delayMs == 0 || !tickScheduled)
+    {
+        tickScheduled = true;
+        DeviceLayer::SystemLayer.StartTimer(delayMs, transitionTick, nullptr);
+    }
+}
+
+static bool writeValue(EmberAfTransition * transition)
+{
+    uint8_t dataSize = emberAfGetDataSize(transition->attributeType);
+    uint32_t value   = static_cast<uint32_t>(transition->currentValue);
+    uint8_t value8   = static_cast<uint8_t>(value);
+    uint16_t value16 = static_cast<uint16_t>(value);
+    uint8_t * data   = (dataSize == 1 ? &value8 : dataSize == 2 ? reinterpret_cast<uint8_t *>(&value16)
+                                                             : reinterpret_cast<uint8_t *>(&value));
+    EmberAfStatus status = emberAfWriteServerAttribute(transition->endpoint, transition->clusterId, transition->attributeId, data,
+                                                       transition->attributeType);
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        emberAfCorePrintln("ERR: writing transition of attribute 0x%2x: 0x%x", transition->attributeId, status);
+        return false;
+    }
+    transition->writtenValue = transition->currentValue;
+    return true;
+}
+
+// Ends the transition of a slot.  The callback gets a copy, as it may start a
+// new transition in the same slot.
+static void endTransition(uint8_t index, EmberAfTransitionStatus status)
+{
+    EmberAfTransition transition = transitionTable[index];
+    bool written                 = false;
+
+    transitionInUse[index] = false;
+    transition.status      = status;
+    if (transition.currentValue != transition.writtenValue)
+    {
+        written = writeValue(&transition);
+    }
+    if (transition.callback != NULL)
+    {
+        transition.callback(&transition, written);
+    }
+}
+
+static void advanceTransition(uint8_t index, uint32_t timeMs)
+{
+    EmberAfTransition * transition = &transitionTable[index];
+    uint32_t elapsedMs             = timeMs - transition->startTimeMs;
+    bool written                   = false;
+
+    if (transition->repeat && transition->durationMs > 0)
+    {
+        // Move the start along by whole periods, so the elapsed time stays
+        // within one and the product below cannot overflow.
+        while (elapsedMs >= transition->durationMs)
+        {
+            int32_t delta            = transition->targetValue - transition->startValue;
+            transition->startValue   = wrapValue(transition, transition->targetValue);
+            transition->targetValue  = transition->startValue + delta;
+            transition->startTimeMs += transition->durationMs;
+            elapsedMs -= transition->durationMs;
+        }
+    }
+    else if (elapsedMs >= transition->durationMs)
+    {
+        transition->currentValue = wrapValue(transition, transition->targetValue);
+        endTransition(index, EMBER_AF_TRANSITION_DONE);
+        return;
+    }
+
+    transition->currentValue =
+        wrapValue(transition, transition->startValue + (transition->slope * static_cast<int64_t>(elapsedMs)) / 65536);
+    if (valueDistance(transition, transition->currentValue, transition->writtenValue) >= transition->writeStep)
+    {
+        written = writeValue(transition);
+    }
+    if (transition->callback != NULL)
+    {
+        transition->callback(transition, written);
+    }
+}
+
+static void transitionTick(System::Layer * systemLayer, void * appState, System::Error error)
+{
+    uint32_t timeMs = nowMs();
+    bool inUse      = false;
+
+    tickScheduled = false;
+    for (uint8_t i = 0; i < EMBER_AF_TRANSITION_TABLE_SIZE; i++)
+    {
+        if (transitionInUse[i])
+        {
+            advanceTransition(i, timeMs);
+        }
+    }
+
+    // A callback may have started or stopped transitions, so look again.
+    for (uint8_t i = 0; i < EMBER_AF_TRANSITION_TABLE_SIZE; i++)
+    {
+        inUse = inUse || transitionInUse[i];
+    }
+    if (inUse)
+    {
+        scheduleTick(EMBER_AF_TRANSITION_TICK_MS);
+    }
+}
+
+EmberAfStatus emberAfTransitionStart(const EmberAfTransition * transition)
+{
+    uint8_t index = findTransition(transition->endpoint, transition->clusterId, transition->attributeId);
+    EmberAfTransition * entry;
+
+    if (index == EMBER_AF_TRANSITION_TABLE_SIZE)
+    {
+        for (index = 0; index < EMBER_AF_TRANSITION_TABLE_SIZE && transitionInUse[index]; index++)
+        {
+        }
+        if (index == EMBER_AF_TRANSITION_TABLE_SIZE)
+        {
+            return EMBER_ZCL_STATUS_INSUFFICIENT_SPACE;
+        }
+    }
+
+    entry               = &transitionTable[index];
+    *entry              = *transition;
+    entry->status       = EMBER_AF_TRANSITION_RUNNING;
+    entry->startValue   = wrapValue(entry, entry->startValue);
+    entry->targetValue  = entry->startValue + (transition->targetValue - transition->startValue);
+    entry->currentValue = entry->startValue;
+    entry->writtenValue = entry->startValue;
+    entry->startTimeMs  = nowMs();
+    entry->slope        = 0;
+    if (entry->durationMs > 0)
+    {
+        entry->slope = (static_cast<int64_t>(entry->targetValue - entry->startValue) * 65536) / entry->durationMs;
+    }
+
+    // Only write the changes a report would be sent for, or else every change of the value.
+    entry->writeStep = emberAfPluginReportingGetReportableChange(entry->endpoint, entry->clusterId, entry->attributeId,
+                                                                 CLUSTER_MASK_SERVER, EMBER_AF_NULL_MANUFACTURER_CODE);
+    if (entry->writeStep == 0)
+    {
+        entry->writeStep = 1;
+    }
+
+    transitionInUse[index] = true;
+    scheduleTick(entry->durationMs == 0 ? 0 : EMBER_AF_TRANSITION_TICK_MS);
+    return EMBER_ZCL_STATUS_SUCCESS;
+}
+
+void emberAfTransitionStop(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+    uint8_t index = findTransition(endpoint, clusterId, attributeId);
+    if (index != EMBER_AF_TRANSITION_TABLE_SIZE)
+    {
+        endTransition(index, EMBER_AF_TRANSITION_STOPPED);
+    }
+}
+
+void emberAfTransitionStopCluster(EndpointId endpoint, ClusterId clusterId)
+{
+    for (uint8_t i = 0; i < EMBER_AF_TRANSITION_TABLE_SIZE; i++)
+    {
+        if (transitionInUse[i] && transitionTable[i].endpoint == endpoint && transitionTable[i].clusterId == clusterId)
+        {
+            endTransition(i, EMBER_AF_TRANSITION_STOPPED);
+        }
+    }
+}
+
+const EmberAfTransition * emberAfTransitionFind(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+    uint8_t index = findTransition(endpoint, clusterId, attributeId);
+    return (index == EMBER_AF_TRANSITION_TABLE_SIZE ? NULL : &transitionTable[index]);
+}
+
+uint32_t emberAfTransitionGetRemainingMs(const EmberAfTransition * transition)
+{
+    uint32_t elapsedMs = nowMs() - transition->startTimeMs;
+    if (transition->status != EMBER_AF_TRANSITION_RUNNING || transition->repeat || elapsedMs >= transition->durationMs)
+    {
+        return 0;
+    }
+    return transition->durationMs - elapsedMs;
+}
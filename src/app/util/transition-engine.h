@@ -0,0 +1,125 @@
+/**
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/****************************************************************************
+ * @file
+ * @brief Transitions of attributes over time, such as those of the level
+ * and color of a light.  Every transition in progress, on any endpoint, is
+ * advanced by one timer, and its attribute is only written when it has moved
+ * by a reportable change.
+ *******************************************************************************
+ ******************************************************************************/
+
+#pragma once
+
+#include <app/util/af-types.h>
+
+/**
+ * The number of attributes that can be in transition at once, across all
+ * endpoints.  A light in transition uses one for its level, and one or two for
+ * its color.
+ */
+#ifndef EMBER_AF_TRANSITION_TABLE_SIZE
+#define EMBER_AF_TRANSITION_TABLE_SIZE 16
+#endif
+
+/**
+ * The period of the timer that advances the transitions, in milliseconds.
+ */
+#ifndef EMBER_AF_TRANSITION_TICK_MS
+#define EMBER_AF_TRANSITION_TICK_MS 20
+#endif
+
+typedef enum
+{
+    EMBER_AF_TRANSITION_RUNNING = 0,
+    // The transition reached its target value.
+    EMBER_AF_TRANSITION_DONE = 1,
+    // The transition was stopped before it reached its target value.
+    EMBER_AF_TRANSITION_STOPPED = 2,
+} EmberAfTransitionStatus;
+
+typedef struct EmberAfTransition EmberAfTransition;
+
+/** @brief Called on every tick of a transition, with written set if the
+ * attribute was written on this tick, then once more when it is done or
+ * stopped.
+ */
+typedef void (*EmberAfTransitionCallback)(const EmberAfTransition * transition, bool written);
+
+struct EmberAfTransition
+{
+    chip::EndpointId endpoint;
+    chip::ClusterId clusterId;
+    chip::AttributeId attributeId;
+    // An unsigned integer type, of up to 4 bytes.
+    EmberAfAttributeType attributeType;
+    int32_t startValue;
+    int32_t targetValue;
+    uint32_t durationMs;
+    // If not 0, the values wrap around it, as a hue does, and targetValue may
+    // be past it to go the other way around.
+    uint32_t modulus;
+    // If set, the transition moves by targetValue - startValue every
+    // durationMs until it is stopped.
+    bool repeat;
+    EmberAfTransitionCallback callback;
+
+    // Set by the engine.
+    EmberAfTransitionStatus status;
+    // The value the transition has reached, which a driver can follow more
+    // closely than the attribute.
+    int32_t currentValue;
+    // The value last written to the attribute.
+    int32_t writtenValue;
+    // The smallest change that is written to the attribute.
+    uint32_t writeStep;
+    uint32_t startTimeMs;
+    // The change of the value per millisecond, in Q16.16 fixed point.
+    int64_t slope;
+};
+
+/** @brief Starts a transition of an attribute from the transition's
+ * startValue, which should be the value of the attribute, to its targetValue,
+ * in place of any transition of the same attribute.  A transition with a
+ * durationMs of 0 is done on the next tick.
+ *
+ * @return EMBER_ZCL_STATUS_INSUFFICIENT_SPACE if EMBER_AF_TRANSITION_TABLE_SIZE
+ * transitions are already in progress.
+ */
+EmberAfStatus emberAfTransitionStart(const EmberAfTransition * transition);
+
+/** @brief Stops the transition of an attribute, if any, leaving the attribute
+ * at the value the transition has reached.
+ */
+void emberAfTransitionStop(chip::EndpointId endpoint, chip::ClusterId clusterId, chip::AttributeId attributeId);
+
+/** @brief Stops the transitions of all the attributes of a cluster.
+ */
+void emberAfTransitionStopCluster(chip::EndpointId endpoint, chip::ClusterId clusterId);
+
+/** @brief Returns the transition of an attribute in progress, or NULL.  A
+ * driver can read the currentValue and targetValue of the transition instead
+ * of the attribute.
+ */
+const EmberAfTransition * emberAfTransitionFind(chip::EndpointId endpoint, chip::ClusterId clusterId,
+                                                chip::AttributeId attributeId);
+
+/** @brief Returns the time a transition has left before it is done, in
+ * milliseconds.
+ */
+uint32_t emberAfTransitionGetRemainingMs(const EmberAfTransition * transition);
@@ -433,6 +433,9 @@ uint16_t emberAfGetMfgCodeFromCurrentCommand(void)
     }
 }
 
+// Builds with CHIP_DATA_MODEL_MINIMAL only take commands through the interaction model, so they leave out the
+// processing of legacy ZCL messages, along with the global and cluster-specific command handlers it dispatches to.
+#if !CHIP_DATA_MODEL_MINIMAL
 static void printIncomingZclMessage(const EmberAfClusterCommand * cmd)
 {
 #if defined(EMBER_AF_PRINT_ENABLE) && defined(EMBER_AF_PRINT_APP)
@@ -610,6 +613,7 @@ kickout:
     emAfCurrentCommand = NULL;
     return msgHandled;
 }
+#endif // !CHIP_DATA_MODEL_MINIMAL
 
 uint8_t emberAfNextSequence(void)
 {
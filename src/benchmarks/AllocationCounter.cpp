@@ -0,0 +1,86 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file counts the heap allocations of a benchmark executable.
+ *      With glibc, malloc, calloc and realloc are replaced by versions that
+ *      count their calls, then call the glibc implementations; elsewhere,
+ *      allocations are not counted.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <stdlib.h>
+
+#include <atomic>
+
+namespace {
+
+std::atomic<uint64_t> sAllocationCount{ 0 };
+
+} // namespace
+
+#if defined(__GLIBC__)
+
+extern "C" {
+
+void * __libc_malloc(size_t size);
+void * __libc_calloc(size_t count, size_t size);
+void * __libc_realloc(void * ptr, size_t size);
+
+void * malloc(size_t size) noexcept
+{
+    sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void * calloc(size_t count, size_t size) noexcept
+{
+    sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void * realloc(void * ptr, size_t size) noexcept
+{
+    sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+} // extern "C"
+
+#endif // defined(__GLIBC__)
+
+namespace chip {
+namespace Benchmark {
+
+uint64_t GetAllocationCount()
+{
+    return sAllocationCount.load(std::memory_order_relaxed);
+}
+
+bool IsAllocationCountingSupported()
+{
+#if defined(__GLIBC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace Benchmark
+} // namespace chip
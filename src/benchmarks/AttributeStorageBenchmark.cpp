@@ -0,0 +1,86 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks of the attribute metadata lookup the
+ *      data model makes for every attribute read, written or reported, on
+ *      an endpoint configured with the clusters of the Python controller.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+
+#include "gen/attribute-id.h"
+#include "gen/cluster-id.h"
+
+using namespace chip;
+
+namespace {
+
+constexpr EndpointId kEndpointId = 1;
+
+void ConfigureEndpoints()
+{
+    static bool sConfigured = false;
+
+    if (!sConfigured)
+    {
+        emberAfEndpointConfigure();
+        sConfigured = true;
+    }
+}
+
+void BenchmarkLocateAttribute(Benchmark::State & state, ClusterId clusterId, AttributeId attributeId, bool expectFound)
+{
+    ConfigureEndpoints();
+
+    while (state.KeepRunning())
+    {
+        EmberAfAttributeMetadata * metadata = emberAfLocateAttributeMetadata(kEndpointId, clusterId, attributeId,
+                                                                             CLUSTER_MASK_CLIENT, EMBER_AF_NULL_MANUFACTURER_CODE);
+        if ((metadata != nullptr) != expectFound)
+        {
+            state.SetError("Unexpected lookup result");
+        }
+    }
+}
+
+// The first cluster of the endpoint
+void BenchmarkLocateAttributeMetadataFirstCluster(Benchmark::State & state)
+{
+    BenchmarkLocateAttribute(state, ZCL_IDENTIFY_CLUSTER_ID, ZCL_CLUSTER_REVISION_CLIENT_ATTRIBUTE_ID, true);
+}
+CHIP_BENCHMARK(BenchmarkLocateAttributeMetadataFirstCluster);
+
+// The last cluster of the endpoint, the worst case of a successful lookup
+void BenchmarkLocateAttributeMetadataLastCluster(Benchmark::State & state)
+{
+    BenchmarkLocateAttribute(state, ZCL_BINDING_CLUSTER_ID, ZCL_CLUSTER_REVISION_CLIENT_ATTRIBUTE_ID, true);
+}
+CHIP_BENCHMARK(BenchmarkLocateAttributeMetadataLastCluster);
+
+// An attribute the cluster does not have, as read by a client asking for an unsupported one
+void BenchmarkLocateAttributeMetadataMissing(Benchmark::State & state)
+{
+    BenchmarkLocateAttribute(state, ZCL_BINDING_CLUSTER_ID, 0x0042, false);
+}
+CHIP_BENCHMARK(BenchmarkLocateAttributeMetadataMissing);
+
+} // namespace
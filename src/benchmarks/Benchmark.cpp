@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the runner of the benchmarks registered with
+ *      CHIP_BENCHMARK().
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace chip {
+namespace Benchmark {
+namespace {
+
+constexpr uint64_t kDefaultMinTimeNs = 100 * 1000 * 1000;
+constexpr size_t kMaxIterations      = 1000 * 1000 * 1000;
+
+// Registrations are static objects, linked in the order of their construction
+Registration * sFirstRegistration = nullptr;
+Registration * sLastRegistration  = nullptr;
+
+const char * GetArgument(const char * arg, const char * name)
+{
+    size_t length = strlen(name);
+    return (strncmp(arg, name, length) == 0) ? arg + length : nullptr;
+}
+
+// Runs the benchmark for more and more iterations, until a run lasts at least minTimeNs.
+bool RunBenchmark(const Registration & benchmark, uint64_t minTimeNs)
+{
+    size_t iterations = 1;
+
+    for (;;)
+    {
+        State state(iterations);
+        benchmark.mFunction(state);
+
+        if (state.GetError() != nullptr)
+        {
+            printf("{\"benchmark\":\"%s\",\"error\":\"%s\"}\n", benchmark.mName, state.GetError());
+            return false;
+        }
+
+        uint64_t elapsedNs = state.GetElapsedNs();
+        if (elapsedNs >= minTimeNs || iterations >= kMaxIterations)
+        {
+            double iterationCount = static_cast<double>(iterations);
+            printf("{\"benchmark\":\"%s\",\"iterations\":%zu,\"ns_per_op\":%.1f,", benchmark.mName, iterations,
+                   static_cast<double>(elapsedNs) / iterationCount);
+            if (state.GetBytesPerIteration() > 0 && elapsedNs > 0)
+            {
+                // Bytes per ns, times 1000 for megabytes per second
+                printf("\"mb_per_s\":%.1f,",
+                       static_cast<double>(state.GetBytesPerIteration()) * iterationCount * 1000 / static_cast<double>(elapsedNs));
+            }
+            if (IsAllocationCountingSupported())
+            {
+                printf("\"allocs_per_op\":%.2f}\n", static_cast<double>(state.GetAllocations()) / iterationCount);
+            }
+            else
+            {
+                printf("\"allocs_per_op\":null}\n");
+            }
+            return true;
+        }
+
+        // Aim a little past the minimum time, growing at most tenfold at a time
+        uint64_t next = (elapsedNs > 0) ? iterations * minTimeNs * 14 / 10 / elapsedNs : iterations * 10;
+        if (next < iterations * 2)
+        {
+            next = iterations * 2;
+        }
+        if (next > iterations * 10)
+        {
+            next = iterations * 10;
+        }
+        iterations = (next < kMaxIterations) ? static_cast<size_t>(next) : kMaxIterations;
+    }
+}
+
+} // namespace
+
+Registration::Registration(const char * name, BenchmarkFunction function) : mName(name), mFunction(function), mNext(nullptr)
+{
+    if (sLastRegistration == nullptr)
+    {
+        sFirstRegistration = this;
+    }
+    else
+    {
+        sLastRegistration->mNext = this;
+    }
+    sLastRegistration = this;
+}
+
+int RunBenchmarks(int argc, char ** argv)
+{
+    const char * filter = nullptr;
+    uint64_t minTimeNs  = kDefaultMinTimeNs;
+    bool succeeded      = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char * value;
+
+        if ((value = GetArgument(argv[i], "--filter=")) != nullptr)
+        {
+            filter = value;
+        }
+        else if ((value = GetArgument(argv[i], "--min-time-ms=")) != nullptr)
+        {
+            minTimeNs = strtoull(value, nullptr, 10) * 1000 * 1000;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--filter=<substring>] [--min-time-ms=<ms>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    for (const Registration * benchmark = sFirstRegistration; benchmark != nullptr; benchmark = benchmark->mNext)
+    {
+        if (filter == nullptr || strstr(benchmark->mName, filter) != nullptr)
+        {
+            succeeded = RunBenchmark(*benchmark, minTimeNs) && succeeded;
+            fflush(stdout);
+        }
+    }
+
+    return succeeded ? 0 : 1;
+}
+
+} // namespace Benchmark
+} // namespace chip
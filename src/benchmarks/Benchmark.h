@@ -0,0 +1,185 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a minimal microbenchmark runner. Benchmarks
+ *      registered with CHIP_BENCHMARK() are run by the executables built
+ *      with the chip_benchmark GN template, which print one JSON object per
+ *      benchmark, giving its time and heap allocations per operation.
+ *
+ *      A benchmark times its loop over State::KeepRunning():
+ *
+ *      @code
+ *      void BenchmarkPacketHeaderEncode(chip::Benchmark::State & state)
+ *      {
+ *          while (state.KeepRunning())
+ *          {
+ *              ...
+ *          }
+ *      }
+ *      CHIP_BENCHMARK(BenchmarkPacketHeaderEncode);
+ *      @endcode
+ */
+
+#pragma once
+
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Benchmark {
+
+/**
+ * The number of heap allocations (malloc, calloc, realloc and thus operator new) made by the process until now.
+ */
+uint64_t GetAllocationCount();
+
+/**
+ * Whether GetAllocationCount() counts anything on this platform.
+ */
+bool IsAllocationCountingSupported();
+
+/**
+ * The state of one run of a benchmark, for a number of iterations chosen by the runner.
+ */
+class State
+{
+public:
+    explicit State(size_t iterations) : mIterations(iterations), mRemaining(iterations) {}
+
+    /**
+     * Whether to run the next iteration. Timing starts on the first call, and stops once every iteration has run.
+     */
+    bool KeepRunning()
+    {
+        if (mRemaining == mIterations && !mRunning)
+        {
+            ResumeTiming();
+        }
+        if (mRemaining > 0 && mError == nullptr)
+        {
+            mRemaining--;
+            return true;
+        }
+        PauseTiming();
+        return false;
+    }
+
+    /**
+     * Stop timing, for work of an iteration that is not to be measured.
+     */
+    void PauseTiming()
+    {
+        if (mRunning)
+        {
+            mElapsed += std::chrono::steady_clock::now() - mStart;
+            mAllocations += GetAllocationCount() - mStartAllocations;
+            mRunning = false;
+        }
+    }
+
+    /**
+     * Resume timing, after PauseTiming().
+     */
+    void ResumeTiming()
+    {
+        if (!mRunning)
+        {
+            mRunning          = true;
+            mStartAllocations = GetAllocationCount();
+            mStart            = std::chrono::steady_clock::now();
+        }
+    }
+
+    /**
+     * Fail the benchmark, which stops at the next call to KeepRunning().
+     *
+     * @param message  A string literal describing the failure.
+     */
+    void SetError(const char * message) { mError = message; }
+
+    /**
+     * Report the throughput of the benchmark, given the number of bytes each iteration processes.
+     */
+    void SetBytesPerIteration(uint64_t bytes) { mBytesPerIteration = bytes; }
+
+    size_t GetIterations() const { return mIterations; }
+    const char * GetError() const { return mError; }
+    uint64_t GetElapsedNs() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(mElapsed).count());
+    }
+    uint64_t GetAllocations() const { return mAllocations; }
+    uint64_t GetBytesPerIteration() const { return mBytesPerIteration; }
+
+private:
+    const size_t mIterations;
+    size_t mRemaining;
+    bool mRunning = false;
+    std::chrono::steady_clock::time_point mStart;
+    std::chrono::steady_clock::duration mElapsed{ 0 };
+    uint64_t mStartAllocations  = 0;
+    uint64_t mAllocations       = 0;
+    uint64_t mBytesPerIteration = 0;
+    const char * mError         = nullptr;
+};
+
+using BenchmarkFunction = void (*)(State & state);
+
+/**
+ * Registers a benchmark on construction. Use through CHIP_BENCHMARK().
+ */
+class Registration
+{
+public:
+    Registration(const char * name, BenchmarkFunction function);
+
+    const char * mName;
+    BenchmarkFunction mFunction;
+    Registration * mNext;
+};
+
+/**
+ * Run the registered benchmarks, in the order they were registered, printing a JSON object per line for each:
+ *
+ *   {"benchmark":"<name>","iterations":<n>,"ns_per_op":<t>,"allocs_per_op":<a>}
+ *
+ * allocs_per_op is null where allocations cannot be counted, and a failed benchmark has an "error" member instead.
+ * Benchmarks that call State::SetBytesPerIteration() also have "mb_per_s":<throughput> before allocs_per_op.
+ *
+ * Arguments: --filter=<substring> runs the benchmarks whose name contains it, and --min-time-ms=<ms> sets how long
+ * each benchmark runs for at least (100 ms by default).
+ *
+ * @return 0 if every benchmark run succeeded, 1 otherwise.
+ */
+int RunBenchmarks(int argc, char ** argv);
+
+/**
+ * Keep the compiler from optimizing away a value computed by a benchmark.
+ */
+template <typename T>
+inline void DoNotOptimize(const T & value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace Benchmark
+} // namespace chip
+
+#define CHIP_BENCHMARK(function) static ::chip::Benchmark::Registration sBenchmarkRegistration_##function(#function, function)
@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks of the base-64 and hex encodings of
+ *      payloads the size of a certificate, with the default alphabets and,
+ *      for base-64, with character conversion functions, which only the
+ *      scalar code supports.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <support/Base64.h>
+#include <support/BytesToHex.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint16_t kPayloadLength = 1024;
+
+const char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+char ValToChar(uint8_t val)
+{
+    return (val < 64) ? kBase64Chars[val] : '=';
+}
+
+uint8_t CharToVal(uint8_t c)
+{
+    for (uint8_t val = 0; val < 64; val++)
+    {
+        if (kBase64Chars[val] == static_cast<char>(c))
+        {
+            return val;
+        }
+    }
+    return UINT8_MAX;
+}
+
+struct Payload
+{
+    Payload()
+    {
+        for (uint16_t i = 0; i < kPayloadLength; i++)
+        {
+            bytes[i] = static_cast<uint8_t>(i * 167 + 13);
+        }
+        encodedLength = Base64Encode(bytes, kPayloadLength, encoded);
+    }
+
+    uint8_t bytes[kPayloadLength];
+    char encoded[BASE64_ENCODED_LEN(kPayloadLength)];
+    uint16_t encodedLength;
+};
+
+const Payload sPayload;
+
+void BenchmarkBase64Encode(Benchmark::State & state)
+{
+    char out[BASE64_ENCODED_LEN(kPayloadLength)];
+
+    while (state.KeepRunning())
+    {
+        Benchmark::DoNotOptimize(Base64Encode(sPayload.bytes, kPayloadLength, out));
+        Benchmark::DoNotOptimize(out[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkBase64Encode);
+
+void BenchmarkBase64EncodeFunct(Benchmark::State & state)
+{
+    char out[BASE64_ENCODED_LEN(kPayloadLength)];
+
+    while (state.KeepRunning())
+    {
+        Benchmark::DoNotOptimize(Base64Encode(sPayload.bytes, kPayloadLength, out, ValToChar));
+        Benchmark::DoNotOptimize(out[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkBase64EncodeFunct);
+
+void BenchmarkBase64Decode(Benchmark::State & state)
+{
+    uint8_t out[kPayloadLength];
+
+    while (state.KeepRunning())
+    {
+        if (Base64Decode(sPayload.encoded, sPayload.encodedLength, out) != kPayloadLength)
+        {
+            state.SetError("Decoding failed");
+        }
+        Benchmark::DoNotOptimize(out[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkBase64Decode);
+
+void BenchmarkBase64DecodeFunct(Benchmark::State & state)
+{
+    uint8_t out[kPayloadLength];
+
+    while (state.KeepRunning())
+    {
+        if (Base64Decode(sPayload.encoded, sPayload.encodedLength, out, CharToVal) != kPayloadLength)
+        {
+            state.SetError("Decoding failed");
+        }
+        Benchmark::DoNotOptimize(out[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkBase64DecodeFunct);
+
+void BenchmarkBytesToHex(Benchmark::State & state)
+{
+    char out[2 * kPayloadLength + 1];
+
+    while (state.KeepRunning())
+    {
+        if (Encoding::BytesToLowercaseHexString(sPayload.bytes, kPayloadLength, out, sizeof(out)) != CHIP_NO_ERROR)
+        {
+            state.SetError("Encoding failed");
+        }
+        Benchmark::DoNotOptimize(out[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkBytesToHex);
+
+} // namespace
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the ExchangeManager dispatch of
+ *      an unsolicited message: sending it on a new exchange, encrypting and
+ *      decrypting it through a loopback transport, and handing it to the
+ *      registered handler on a new responder exchange.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/Flags.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/Protocols.h>
+#include <transport/SecureSessionMgr.h>
+#include <transport/TransportMgr.h>
+
+#include <utility>
+
+using namespace chip;
+using namespace chip::Messaging;
+
+namespace {
+
+const Protocols::Id kProtocol(VendorId::Common, 0x0001);
+const uint8_t kPayload[64] = { 0xa5 };
+
+class LoopbackTransport : public Transport::Base
+{
+public:
+    /// Transports are required to have a constructor that takes exactly one argument
+    CHIP_ERROR Init(const char * unused) { return CHIP_NO_ERROR; }
+
+    CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle msgBuf) override
+    {
+        HandleMessageReceived(address, std::move(msgBuf));
+        return CHIP_NO_ERROR;
+    }
+
+    bool CanSendToPeer(const Transport::PeerAddress & address) override { return true; }
+};
+
+class ResponderDelegate : public ExchangeDelegate
+{
+public:
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle buffer) override
+    {
+        mReceivedCount++;
+        ec->Close();
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    size_t mReceivedCount = 0;
+};
+
+TransportMgr<LoopbackTransport> sTransportMgr;
+Test::MessagingContext sContext;
+ResponderDelegate sResponder;
+
+// The messaging layers are set up once, on the first run, and left up until the process exits.
+CHIP_ERROR InitMessaging()
+{
+    static bool sInitialized = false;
+
+    if (!sInitialized)
+    {
+        ReturnErrorOnFailure(sTransportMgr.Init("LOOPBACK"));
+        ReturnErrorOnFailure(sContext.Init(nullptr, &sTransportMgr));
+        ReturnErrorOnFailure(sContext.GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(kProtocol, &sResponder));
+        sInitialized = true;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void BenchmarkExchangeManagerDispatch(Benchmark::State & state)
+{
+    if (InitMessaging() != CHIP_NO_ERROR)
+    {
+        state.SetError("Messaging initialization failed");
+    }
+
+    size_t expectedCount = sResponder.mReceivedCount;
+    while (state.KeepRunning())
+    {
+        ExchangeContext * ec = sContext.NewExchangeToPeer(nullptr);
+        if (ec == nullptr)
+        {
+            state.SetError("Exchange allocation failed");
+            break;
+        }
+        CHIP_ERROR err = ec->SendMessage(kProtocol, 0x0001, MessagePacketBuffer::NewWithData(kPayload, sizeof(kPayload)),
+                                         SendFlags(SendMessageFlags::kNoAutoRequestAck));
+        ec->Close();
+
+        if (err != CHIP_NO_ERROR || sResponder.mReceivedCount != ++expectedCount)
+        {
+            state.SetError("Message not dispatched");
+        }
+    }
+}
+CHIP_BENCHMARK(BenchmarkExchangeManagerDispatch);
+
+} // namespace
@@ -0,0 +1,643 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a scale benchmark of a controller: one
+ *      controller and N simulated devices, each with its own session and
+ *      exchange managers and attribute values, in one process on a shared
+ *      system layer, connected by a simulated network of a given latency,
+ *      loss and bandwidth. The controller polls the devices in turn with
+ *      read requests, over a limited number of sessions at a time, and
+ *      once the run is over the benchmark prints a JSON object giving the
+ *      throughput and latency percentiles of the reads, how many of the
+ *      devices were polled, the traffic of the network and the CPU time
+ *      and peak memory the process used.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/MessageDef/AttributeDataElement.h>
+#include <app/MessageDef/AttributeDataList.h>
+#include <app/MessageDef/AttributePath.h>
+#include <app/MessageDef/AttributePathList.h>
+#include <app/MessageDef/ReadRequest.h>
+#include <app/MessageDef/ReportData.h>
+#include <core/CHIPCore.h>
+#include <inet/tests/TestInetCommon.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/Flags.h>
+#include <protocols/interaction_model/Constants.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/TLVPacketBufferBackingStore.h>
+#include <transport/AdminPairingTable.h>
+#include <transport/SecureSessionMgr.h>
+#include <transport/TransportMgr.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+#include <transport/raw/tests/SimulatedNetwork.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <utility>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Messaging;
+
+namespace {
+
+constexpr NodeId kControllerNodeId          = 0x0000000000C0A000;
+constexpr NodeId kFirstDeviceNodeId         = 0x0000000000DE0000;
+constexpr Transport::AdminId kAdminId       = 0;
+constexpr EndpointId kEndpointId            = 1;
+constexpr ClusterId kClusterId              = 6;
+constexpr size_t kAttributeCount            = 4;
+constexpr uint32_t kDefaultResponseTimeout  = 2000;
+constexpr uint32_t kDefaultDurationMs       = 5000;
+constexpr uint32_t kDefaultWarmupMs         = 500;
+constexpr size_t kDefaultDeviceCount        = 2;
+constexpr size_t kDefaultSessionCount       = 2;
+constexpr uint32_t kDrainMs                 = 10000;
+constexpr uint32_t kEventLoopSleepMs        = 10;
+constexpr size_t kControllerNode            = 0;
+constexpr size_t kFirstDeviceNode           = 1;
+constexpr size_t kMaxSessions               = CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE;
+constexpr uint16_t kMaxKeyId                = UINT16_MAX - 1;
+
+// Every node arms the send queue timer of its session manager, its session expiry timer when sessions expire
+// (CHIP_CONFIG_SESSION_REKEYING), and the retransmission timer of its exchange manager. The controller also arms the
+// response timer its exchange manager shares among the sessions, and the network one timer of its own.
+constexpr size_t kTimersPerNode = 3;
+
+size_t GetMaxDeviceCount()
+{
+    const size_t controllerTimers = kTimersPerNode + 2;
+    return (CHIP_SYSTEM_CONFIG_NUM_TIMERS > controllerTimers) ? (CHIP_SYSTEM_CONFIG_NUM_TIMERS - controllerTimers) / kTimersPerNode
+                                                              : 0;
+}
+
+/**
+ * The outcomes of the reads made after the warmup.
+ */
+struct ReadStats
+{
+    std::vector<uint32_t> mLatenciesUs;
+    size_t mErrors  = 0;
+    size_t mTimeout = 0;
+};
+
+ReadStats sStats;
+bool sRecording = false;
+
+/**
+ * The session, exchange and admin state of one node of the network.
+ */
+struct Stack
+{
+    CHIP_ERROR Init(NodeId nodeId, System::Layer * systemLayer, Test::SimulatedNetwork * network)
+    {
+        ReturnErrorOnFailure(mTransportMgr.Init(network));
+        ReturnErrorOnFailure(mSessionMgr.Init(nodeId, systemLayer, &mTransportMgr, &mAdmins));
+        ReturnErrorOnFailure(mExchangeMgr.Init(&mSessionMgr));
+        VerifyOrReturnError(mAdmins.AssignAdminId(kAdminId, nodeId) != nullptr, CHIP_ERROR_NO_MEMORY);
+        return CHIP_NO_ERROR;
+    }
+
+    void Shutdown()
+    {
+        mExchangeMgr.Shutdown();
+        mSessionMgr.Shutdown();
+        mTransportMgr.Close();
+    }
+
+    TransportMgr<Test::SimulatedTransport> mTransportMgr;
+    SecureSessionMgr mSessionMgr;
+    ExchangeManager mExchangeMgr;
+    Transport::AdminPairingTable mAdmins;
+};
+
+/**
+ * A device, which answers every read request with a report of all its attributes. The first attribute counts the reads it
+ * served, for the reports of a device to change as they would with a live attribute.
+ */
+class SimulatedDevice : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR Init(size_t index, System::Layer * systemLayer, Test::SimulatedNetwork * network)
+    {
+        mNodeId = kFirstDeviceNodeId + index;
+        for (size_t i = 0; i < kAttributeCount; i++)
+        {
+            mAttributes[i] = static_cast<uint32_t>(index + i);
+        }
+        // The devices are attached to the network after the controller, in order
+        mAddress = Test::SimulatedNetwork::GetAddress(kFirstDeviceNode + index);
+        ReturnErrorOnFailure(mStack.Init(mNodeId, systemLayer, network));
+        VerifyOrReturnError(network->GetNodeCount() == kFirstDeviceNode + index + 1, CHIP_ERROR_INCORRECT_STATE);
+        return mStack.mExchangeMgr.RegisterUnsolicitedMessageHandlerForType(Protocols::InteractionModel::MsgType::ReadRequest,
+                                                                            this);
+    }
+
+    void Shutdown() { mStack.Shutdown(); }
+
+    /**
+     * Set up the session of the controller with the device, which replaces the one it had before, as a session establishment
+     * would, with no messages exchanged: both ends derive it from the test secret.
+     */
+    CHIP_ERROR NewPairing(uint16_t keyId, const Transport::PeerAddress & controllerAddress)
+    {
+        SecurePairingUsingTestSecret pairing(keyId, keyId);
+        return mStack.mSessionMgr.NewPairing(Optional<Transport::PeerAddress>::Value(controllerAddress), kControllerNodeId,
+                                             &pairing, SecureSessionMgr::PairingDirection::kResponder, kAdminId);
+    }
+
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle payload) override
+    {
+        System::PacketBufferHandle msgBuf;
+        CHIP_ERROR err = EncodeReport(msgBuf);
+
+        if (err == CHIP_NO_ERROR)
+        {
+            mAttributes[0]++;
+            err = ec->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(msgBuf),
+                                  SendFlags(SendMessageFlags::kNone));
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(AppServer, "Failed to send the report: %s", ErrorStr(err));
+        }
+        ec->Close();
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    const Transport::PeerAddress & GetAddress() const { return mAddress; }
+    NodeId GetNodeId() const { return mNodeId; }
+    size_t GetContextsInUse() const { return mStack.mExchangeMgr.GetContextsInUse(); }
+
+    // Whether the device answered a read since the warmup.
+    bool mPolled = false;
+
+private:
+    CHIP_ERROR EncodeReport(System::PacketBufferHandle & msgBuf)
+    {
+        System::PacketBufferTLVWriter writer;
+        ReportData::Builder report;
+
+        msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+        VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+        writer.Init(std::move(msgBuf));
+
+        ReturnErrorOnFailure(report.Init(&writer));
+        AttributeDataList::Builder & attributeDataList = report.CreateAttributeDataListBuilder();
+        ReturnErrorOnFailure(attributeDataList.GetError());
+        for (size_t i = 0; i < kAttributeCount; i++)
+        {
+            AttributeDataElement::Builder & element = attributeDataList.CreateAttributeDataElementBuilder();
+            element.EncodeAttributePath(mNodeId, kEndpointId, kClusterId, static_cast<FieldId>(i));
+            ReturnErrorOnFailure(element.GetError());
+
+            TLV::TLVWriter * dataWriter = element.GetWriter();
+            TLV::TLVType dataContainer;
+            ReturnErrorOnFailure(dataWriter->StartContainer(TLV::ContextTag(AttributeDataElement::kCsTag_Data),
+                                                            TLV::kTLVType_Structure, dataContainer));
+            ReturnErrorOnFailure(dataWriter->Put(TLV::ContextTag(static_cast<uint8_t>(i)), mAttributes[i]));
+            ReturnErrorOnFailure(dataWriter->EndContainer(dataContainer));
+
+            element.DataVersion(0).MoreClusterData(false).EndOfAttributeDataElement();
+            ReturnErrorOnFailure(element.GetError());
+        }
+        attributeDataList.EndOfAttributeDataList();
+        ReturnErrorOnFailure(attributeDataList.GetError());
+        report.EndOfReportData();
+        ReturnErrorOnFailure(report.GetError());
+        return writer.Finalize(&msgBuf);
+    }
+
+    Stack mStack;
+    NodeId mNodeId = kUndefinedNodeId;
+    Transport::PeerAddress mAddress;
+    uint32_t mAttributes[kAttributeCount];
+};
+
+struct Options
+{
+    size_t mDeviceCount          = kDefaultDeviceCount;
+    size_t mSessionCount         = kDefaultSessionCount;
+    uint32_t mDurationMs         = kDefaultDurationMs;
+    uint32_t mWarmupMs           = kDefaultWarmupMs;
+    uint32_t mResponseTimeoutMs  = kDefaultResponseTimeout;
+    uint32_t mSeed               = 1;
+    Test::SimulatedLinkParams mLink;
+};
+
+Test::SimulatedNetwork sNetwork;
+Stack sController;
+std::vector<std::unique_ptr<SimulatedDevice>> sDevices;
+
+CHIP_ERROR EncodeReadRequest(System::PacketBufferTLVWriter & writer, NodeId nodeId)
+{
+    ReadRequest::Builder request;
+
+    ReturnErrorOnFailure(request.Init(&writer));
+    AttributePathList::Builder attributePathList = request.CreateAttributePathListBuilder();
+    ReturnErrorOnFailure(attributePathList.GetError());
+    AttributePath::Builder attributePath = attributePathList.CreateAttributePathBuilder();
+    // The whole cluster
+    attributePath.NodeId(nodeId).EndpointId(kEndpointId).ClusterId(kClusterId).EndOfAttributePath();
+    ReturnErrorOnFailure(attributePath.GetError());
+    attributePathList.EndOfAttributePathList();
+    ReturnErrorOnFailure(attributePathList.GetError());
+    request.EndOfReadRequest();
+    return request.GetError();
+}
+
+/**
+ * One of the sessions of the controller, which polls the devices of its share in turn, one read at a time: those whose index
+ * is the index of the poller modulo the number of pollers. Moving on to another device replaces the session of the poller.
+ */
+class DevicePoller : public ExchangeDelegate
+{
+public:
+    void Init(size_t index, size_t pollerCount, uint32_t responseTimeoutMs)
+    {
+        mIndex             = index;
+        mPollerCount       = pollerCount;
+        mNextDevice        = index;
+        mResponseTimeoutMs = responseTimeoutMs;
+        // The key ids only need to be unique within each session manager
+        mKeyId = static_cast<uint16_t>(index % kMaxKeyId + 1);
+    }
+
+    bool IsIdle() const { return mExchange == nullptr; }
+
+    void SendNextRead()
+    {
+        CHIP_ERROR err = SendRead();
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(AppServer, "Failed to send the read request: %s", ErrorStr(err));
+            if (mExchange != nullptr)
+            {
+                mExchange->Abort();
+                mExchange = nullptr;
+            }
+            Complete(false, &ReadStats::mErrors);
+        }
+    }
+
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle payload) override
+    {
+        bool isReport = payloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::ReportData);
+
+        ec->Close();
+        mExchange = nullptr;
+        Complete(isReport, isReport ? nullptr : &ReadStats::mErrors);
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override
+    {
+        ec->Close();
+        mExchange = nullptr;
+        Complete(false, &ReadStats::mTimeout);
+    }
+
+private:
+    SecureSessionHandle GetSession(SimulatedDevice & device) const { return { device.GetNodeId(), mKeyId, kAdminId }; }
+
+    // Moves on to the next device of the share of the poller, pairing with it unless it is the device of the last read.
+    CHIP_ERROR SelectNextDevice()
+    {
+        size_t device = mNextDevice;
+
+        mNextDevice += mPollerCount;
+        if (mNextDevice >= sDevices.size())
+        {
+            mNextDevice = mIndex;
+        }
+        VerifyOrReturnError(device != mDevice, CHIP_NO_ERROR);
+
+        if (mDevice < sDevices.size())
+        {
+#if CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+            // The acknowledgement of the last report may still be queued on the session
+            sController.mSessionMgr.FlushSendQueue();
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+            sController.mSessionMgr.ExpirePairing(GetSession(*sDevices[mDevice]));
+        }
+        mDevice = device;
+
+        SimulatedDevice & next = *sDevices[device];
+        SecurePairingUsingTestSecret pairing(mKeyId, mKeyId);
+        ReturnErrorOnFailure(next.NewPairing(mKeyId, Test::SimulatedNetwork::GetAddress(kControllerNode)));
+        return sController.mSessionMgr.NewPairing(Optional<Transport::PeerAddress>::Value(next.GetAddress()), next.GetNodeId(),
+                                                  &pairing, SecureSessionMgr::PairingDirection::kInitiator, kAdminId);
+    }
+
+    CHIP_ERROR SendRead()
+    {
+        System::PacketBufferTLVWriter writer;
+        System::PacketBufferHandle msgBuf;
+
+        ReturnErrorOnFailure(SelectNextDevice());
+        SimulatedDevice & device = *sDevices[mDevice];
+
+        msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+        VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+        writer.Init(std::move(msgBuf));
+        ReturnErrorOnFailure(EncodeReadRequest(writer, device.GetNodeId()));
+        ReturnErrorOnFailure(writer.Finalize(&msgBuf));
+
+        mExchange = sController.mExchangeMgr.NewContext(GetSession(device), this);
+        VerifyOrReturnError(mExchange != nullptr, CHIP_ERROR_NO_MEMORY);
+        mExchange->SetResponseTimeout(mResponseTimeoutMs);
+
+        mStartUs = System::Layer::GetClock_MonotonicHiRes();
+        return mExchange->SendMessage(Protocols::InteractionModel::MsgType::ReadRequest, std::move(msgBuf),
+                                      SendFlags(SendMessageFlags::kExpectResponse));
+    }
+
+    // Records the outcome of the read, which is a latency sample for a report, and a count for the others.
+    void Complete(bool polled, size_t ReadStats::*outcome)
+    {
+        if (!sRecording)
+        {
+            return;
+        }
+
+        if (outcome == nullptr)
+        {
+            uint64_t latencyUs = System::Layer::GetClock_MonotonicHiRes() - mStartUs;
+            sStats.mLatenciesUs.push_back(static_cast<uint32_t>(std::min<uint64_t>(latencyUs, UINT32_MAX)));
+        }
+        else
+        {
+            (sStats.*outcome)++;
+        }
+        if (polled && mDevice < sDevices.size())
+        {
+            sDevices[mDevice]->mPolled = true;
+        }
+    }
+
+    ExchangeContext * mExchange = nullptr;
+    size_t mIndex               = 0;
+    size_t mPollerCount         = 1;
+    size_t mNextDevice          = 0;
+    size_t mDevice              = SIZE_MAX;
+    uint16_t mKeyId             = 1;
+    uint32_t mResponseTimeoutMs = kDefaultResponseTimeout;
+    uint64_t mStartUs           = 0;
+};
+
+DevicePoller sPollers[kMaxSessions];
+
+const char * GetArgument(const char * arg, const char * name)
+{
+    size_t length = strlen(name);
+    return (strncmp(arg, name, length) == 0) ? arg + length : nullptr;
+}
+
+bool ParseOptions(int argc, char ** argv, Options & options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char * value;
+
+        if ((value = GetArgument(argv[i], "--devices=")) != nullptr)
+        {
+            options.mDeviceCount = strtoul(value, nullptr, 10);
+        }
+        else if ((value = GetArgument(argv[i], "--sessions=")) != nullptr)
+        {
+            options.mSessionCount = strtoul(value, nullptr, 10);
+        }
+        else if ((value = GetArgument(argv[i], "--duration-ms=")) != nullptr)
+        {
+            options.mDurationMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--warmup-ms=")) != nullptr)
+        {
+            options.mWarmupMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--timeout-ms=")) != nullptr)
+        {
+            options.mResponseTimeoutMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--latency-ms=")) != nullptr)
+        {
+            options.mLink.mLatencyMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--jitter-ms=")) != nullptr)
+        {
+            options.mLink.mJitterMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--loss-permille=")) != nullptr)
+        {
+            options.mLink.mLossPermille = static_cast<uint16_t>(std::min<unsigned long>(strtoul(value, nullptr, 10), 1000));
+        }
+        else if ((value = GetArgument(argv[i], "--bandwidth-kbps=")) != nullptr)
+        {
+            options.mLink.mBandwidthBytesPerSecond = static_cast<uint32_t>(strtoul(value, nullptr, 10) * 1000 / 8);
+        }
+        else if ((value = GetArgument(argv[i], "--seed=")) != nullptr)
+        {
+            options.mSeed = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return options.mSessionCount > 0 && options.mSessionCount <= kMaxSessions && options.mDeviceCount > 0 &&
+        options.mDeviceCount <= GetMaxDeviceCount() && options.mDurationMs > 0 &&
+        options.mResponseTimeoutMs > 0;
+}
+
+/**
+ * Set up the network, then the controller, which is its first node, and the devices.
+ */
+CHIP_ERROR InitStacks(System::Layer * systemLayer, const Options & options)
+{
+    ReturnErrorOnFailure(sNetwork.Init(systemLayer, options.mLink, options.mSeed));
+    ReturnErrorOnFailure(sController.Init(kControllerNodeId, systemLayer, &sNetwork));
+    VerifyOrReturnError(sNetwork.GetNodeCount() == kControllerNode + 1, CHIP_ERROR_INCORRECT_STATE);
+
+    sDevices.reserve(options.mDeviceCount);
+    for (size_t i = 0; i < options.mDeviceCount; i++)
+    {
+        sDevices.emplace_back(new SimulatedDevice());
+        ReturnErrorOnFailure(sDevices.back()->Init(i, systemLayer, &sNetwork));
+    }
+
+    // There is no use for more sessions than devices
+    for (size_t i = 0; i < std::min(options.mSessionCount, options.mDeviceCount); i++)
+    {
+        sPollers[i].Init(i, std::min(options.mSessionCount, options.mDeviceCount), options.mResponseTimeoutMs);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void RunEvents()
+{
+    struct timeval sleepTime = { 0, kEventLoopSleepMs * 1000 };
+
+    ServiceEvents(sleepTime);
+}
+
+bool IsIdle(size_t pollerCount)
+{
+    if (!std::all_of(sPollers, sPollers + pollerCount, [](const DevicePoller & poller) { return poller.IsIdle(); }))
+    {
+        return false;
+    }
+    // The devices may still be retransmitting reports whose acknowledgements were lost
+    return sNetwork.GetInFlightCount() == 0 && sController.mExchangeMgr.GetContextsInUse() == 0 &&
+        std::all_of(sDevices.begin(), sDevices.end(),
+                    [](const std::unique_ptr<SimulatedDevice> & device) { return device->GetContextsInUse() == 0; });
+}
+
+void RunLoad(const Options & options)
+{
+    const size_t pollerCount = std::min(options.mSessionCount, options.mDeviceCount);
+    const uint64_t startMs   = System::Layer::GetClock_MonotonicMS();
+    const uint64_t recordMs  = startMs + options.mWarmupMs;
+    const uint64_t endMs     = recordMs + options.mDurationMs;
+    uint64_t nowMs;
+
+    for (nowMs = startMs; nowMs < endMs; nowMs = System::Layer::GetClock_MonotonicMS())
+    {
+        sRecording = (nowMs >= recordMs);
+        for (size_t i = 0; i < pollerCount; i++)
+        {
+            if (sPollers[i].IsIdle())
+            {
+                sPollers[i].SendNextRead();
+            }
+        }
+        RunEvents();
+    }
+    sRecording = false;
+
+    // Let the exchanges still open complete, so that every exchange is closed before the stacks shut down
+    for (const uint64_t drainEndMs = nowMs + kDrainMs; !IsIdle(pollerCount) && nowMs < drainEndMs;
+         nowMs = System::Layer::GetClock_MonotonicMS())
+    {
+        RunEvents();
+    }
+}
+
+void PrintResults(const Options & options, uint64_t setupMs)
+{
+    struct rusage usage;
+    const double durationS            = options.mDurationMs / 1000.0;
+    std::vector<uint32_t> & latencies = sStats.mLatenciesUs;
+    const Test::SimulatedNetworkStats & network = sNetwork.GetStats();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](size_t percent) -> uint32_t {
+        return latencies.empty() ? 0 : latencies[(latencies.size() - 1) * percent / 100];
+    };
+    size_t polledCount = static_cast<size_t>(std::count_if(
+        sDevices.begin(), sDevices.end(), [](const std::unique_ptr<SimulatedDevice> & device) { return device->mPolled; }));
+
+    printf("{\"devices\":%zu,\"sessions\":%zu,\"duration_ms\":%" PRIu32 ",\"setup_ms\":%" PRIu64, options.mDeviceCount,
+           options.mSessionCount, options.mDurationMs, setupMs);
+    printf(",\"reads\":{\"count\":%zu,\"errors\":%zu,\"timeouts\":%zu,\"ops_per_s\":%.1f,\"p50_us\":%" PRIu32 ",\"p99_us\":%" PRIu32
+           ",\"max_us\":%" PRIu32 "}",
+           latencies.size(), sStats.mErrors, sStats.mTimeout, static_cast<double>(latencies.size()) / durationS, percentile(50),
+           percentile(99), percentile(100));
+    printf(",\"devices_polled\":%zu", polledCount);
+    printf(",\"network\":{\"sent\":%" PRIu64 ",\"bytes\":%" PRIu64 ",\"delivered\":%" PRIu64 ",\"lost\":%" PRIu64
+           ",\"unreachable\":%" PRIu64 "}",
+           network.mSent, network.mBytesSent, network.mDelivered, network.mLost, network.mUnreachable);
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        double userS = static_cast<double>(usage.ru_utime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec) / 1e6;
+        double sysS  = static_cast<double>(usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_stime.tv_usec) / 1e6;
+        double runS  = static_cast<double>(options.mWarmupMs + options.mDurationMs) / 1000.0;
+        printf(",\"cpu_user_s\":%.3f,\"cpu_sys_s\":%.3f,\"cpu_percent\":%.1f,\"max_rss_kb\":%ld", userS, sysS,
+               (userS + sysS) * 100 / runS, usage.ru_maxrss);
+    }
+    printf("}\n");
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Test::IOContext ioContext;
+    Options options;
+    uint64_t setupMs;
+
+    if (!ParseOptions(argc, argv, options))
+    {
+        fprintf(stderr,
+                "Usage: %s [--devices=<n>] [--sessions=<1..%zu>] [--duration-ms=<ms>] [--warmup-ms=<ms>] [--timeout-ms=<ms>] "
+                "[--latency-ms=<ms>] [--jitter-ms=<ms>] [--loss-permille=<0..1000>] [--bandwidth-kbps=<kbit/s>] [--seed=<n>]\n"
+                "CHIP_SYSTEM_CONFIG_NUM_TIMERS allows up to %zu devices\n",
+                argv[0], kMaxSessions, GetMaxDeviceCount());
+        return EXIT_FAILURE;
+    }
+
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+
+    err = ioContext.Init(nullptr);
+    SuccessOrExit(err);
+
+    setupMs = System::Layer::GetClock_MonotonicMS();
+    err     = InitStacks(&ioContext.GetSystemLayer(), options);
+    SuccessOrExit(err);
+    setupMs = System::Layer::GetClock_MonotonicMS() - setupMs;
+
+    RunLoad(options);
+    PrintResults(options, setupMs);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Fleet benchmark failed, err:%s\n", ErrorStr(err));
+        return EXIT_FAILURE;
+    }
+
+    for (auto & device : sDevices)
+    {
+        device->Shutdown();
+    }
+    sController.Shutdown();
+    sNetwork.Shutdown();
+    ioContext.Shutdown();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,680 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements an end-to-end benchmark of the Interaction
+ *      Model: N simulated controllers and a device, each with its own
+ *      session and exchange managers, in one process and connected by an
+ *      in-memory transport. Every controller keeps one invoke or read
+ *      request outstanding at a time, and once the run is over the
+ *      benchmark prints a JSON object giving the throughput and the
+ *      latency percentiles of each kind of request, along with the CPU
+ *      time and peak memory the process used.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/MessageDef/AttributePath.h>
+#include <app/MessageDef/AttributePathList.h>
+#include <app/MessageDef/CommandDataElement.h>
+#include <app/MessageDef/CommandList.h>
+#include <app/MessageDef/InvokeCommand.h>
+#include <app/MessageDef/ReadRequest.h>
+#include <core/CHIPCore.h>
+#include <inet/tests/TestInetCommon.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/Flags.h>
+#include <protocols/interaction_model/Constants.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <protocols/secure_channel/StatusReport.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/TLVPacketBufferBackingStore.h>
+#include <transport/AdminPairingTable.h>
+#include <transport/SecureSessionMgr.h>
+#include <transport/TransportMgr.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <algorithm>
+#include <deque>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <utility>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Messaging;
+
+namespace {
+
+constexpr NodeId kDeviceNodeId              = 0x0000000000BE1C00;
+constexpr NodeId kFirstControllerNodeId     = 0x0000000000C0A000;
+constexpr Transport::AdminId kDeviceAdminId = 0;
+constexpr EndpointId kEndpointId            = 1;
+constexpr ClusterId kClusterId              = 6;
+constexpr CommandId kCommandId              = 40;
+constexpr FieldId kFirstFieldId             = 1;
+constexpr FieldId kLastFieldId              = 2;
+constexpr uint32_t kResponseTimeoutMs       = 1000;
+constexpr uint32_t kDefaultDurationMs       = 5000;
+constexpr uint32_t kDefaultWarmupMs         = 500;
+constexpr size_t kDefaultControllerCount    = 1;
+constexpr unsigned kDefaultInvokeWeight     = 1;
+constexpr unsigned kDefaultReadWeight       = 1;
+constexpr size_t kDeviceEnd                 = 0;
+constexpr size_t kControllersEnd            = 1;
+
+// Each controller needs an admin on the controller side, and a session on either side, for itself
+constexpr size_t kMaxControllers = std::min(CHIP_CONFIG_MAX_DEVICE_ADMINS, CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE);
+
+/**
+ * The kinds of requests the controllers make.
+ */
+enum class RequestType : uint8_t
+{
+    kInvoke,
+    kRead,
+    kCount,
+};
+
+const char * const kRequestTypeNames[] = { "invoke", "read" };
+
+/**
+ * The outcomes of the requests of one kind, made after the warmup.
+ */
+struct RequestStats
+{
+    std::vector<uint32_t> mLatenciesUs;
+    size_t mBusy    = 0;
+    size_t mErrors  = 0;
+    size_t mTimeout = 0;
+};
+
+RequestStats sStats[static_cast<size_t>(RequestType::kCount)];
+bool sRecording = false;
+
+class LoopbackLink;
+
+/**
+ * A transport that passes the messages it is given to the transport at the other end of its link.
+ */
+class LoopbackTransport : public Transport::Base
+{
+public:
+    /// Transports are required to have a constructor that takes exactly one argument
+    CHIP_ERROR Init(LoopbackLink * link);
+
+    CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle msgBuf) override;
+
+    bool CanSendToPeer(const Transport::PeerAddress & address) override { return true; }
+
+    void Deliver(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf)
+    {
+        HandleMessageReceived(source, std::move(msgBuf));
+    }
+
+    const Transport::PeerAddress & GetAddress() const { return mAddress; }
+
+private:
+    LoopbackLink * mLink = nullptr;
+    Transport::PeerAddress mAddress;
+};
+
+/**
+ * Connects two loopback transports. The messages sent are queued, instead of being delivered from within the sending call,
+ * so that every message is received from the event loop of the benchmark, as it would be from a socket.
+ */
+class LoopbackLink
+{
+public:
+    /**
+     * The address of the transport attached to the given end of the link, from which its messages are received.
+     */
+    static Transport::PeerAddress GetAddress(size_t end)
+    {
+        Inet::IPAddress address;
+        Inet::IPAddress::FromString("127.0.0.1", address);
+        return Transport::PeerAddress::UDP(address, static_cast<uint16_t>(CHIP_PORT + end));
+    }
+
+    CHIP_ERROR Attach(LoopbackTransport * transport, Transport::PeerAddress & address)
+    {
+        for (size_t end = 0; end < ArraySize(mEnds); end++)
+        {
+            if (mEnds[end] == nullptr)
+            {
+                mEnds[end] = transport;
+                address    = GetAddress(end);
+                return CHIP_NO_ERROR;
+            }
+        }
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    void Send(LoopbackTransport * sender, System::PacketBufferHandle && msgBuf)
+    {
+        LoopbackTransport * receiver = (mEnds[0] == sender) ? mEnds[1] : mEnds[0];
+        mPending.push_back({ receiver, sender->GetAddress(), std::move(msgBuf) });
+    }
+
+    /**
+     * Deliver the messages queued until now. Those that their receivers send in turn wait for the next call.
+     *
+     * @return The number of messages delivered.
+     */
+    size_t DeliverPending()
+    {
+        size_t count = mPending.size();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Message message = std::move(mPending.front());
+            mPending.pop_front();
+            if (message.mReceiver != nullptr)
+            {
+                message.mReceiver->Deliver(message.mSource, std::move(message.mBuffer));
+            }
+        }
+        return count;
+    }
+
+private:
+    struct Message
+    {
+        LoopbackTransport * mReceiver;
+        Transport::PeerAddress mSource;
+        System::PacketBufferHandle mBuffer;
+    };
+
+    LoopbackTransport * mEnds[2] = {};
+    std::deque<Message> mPending;
+};
+
+CHIP_ERROR LoopbackTransport::Init(LoopbackLink * link)
+{
+    ReturnErrorOnFailure(link->Attach(this, mAddress));
+    mLink = link;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LoopbackTransport::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle msgBuf)
+{
+    VerifyOrReturnError(mLink != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    // The sender may keep the buffer for retransmission, while the receiver decrypts it in place: pass a copy, as a network would
+    System::PacketBufferHandle copy = msgBuf.CloneData();
+    VerifyOrReturnError(!copy.IsNull(), CHIP_ERROR_NO_MEMORY);
+    mLink->Send(this, std::move(copy));
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * The session, exchange and admin state of one end of the link.
+ */
+struct Stack
+{
+    CHIP_ERROR Init(NodeId nodeId, System::Layer * systemLayer, LoopbackLink * link)
+    {
+        ReturnErrorOnFailure(mTransportMgr.Init(link));
+        ReturnErrorOnFailure(mSessionMgr.Init(nodeId, systemLayer, &mTransportMgr, &mAdmins));
+        return mExchangeMgr.Init(&mSessionMgr);
+    }
+
+    void Shutdown()
+    {
+        mExchangeMgr.Shutdown();
+        mTransportMgr.Close();
+    }
+
+    TransportMgr<LoopbackTransport> mTransportMgr;
+    SecureSessionMgr mSessionMgr;
+    ExchangeManager mExchangeMgr;
+    Transport::AdminPairingTable mAdmins;
+};
+
+CHIP_ERROR EncodeInvokeCommand(System::PacketBufferTLVWriter & writer)
+{
+    InvokeCommand::Builder invokeCommand;
+    TLV::TLVType dataContainer;
+
+    ReturnErrorOnFailure(invokeCommand.Init(&writer));
+    CommandList::Builder & commandList            = invokeCommand.CreateCommandListBuilder();
+    CommandDataElement::Builder & commandDataElem = commandList.CreateCommandDataElementBuilder();
+    commandDataElem.EncodeCommandPath(kEndpointId, kClusterId, kCommandId);
+    ReturnErrorOnFailure(commandDataElem.GetError());
+
+    TLV::TLVWriter * dataWriter = commandDataElem.GetWriter();
+    ReturnErrorOnFailure(
+        dataWriter->StartContainer(TLV::ContextTag(CommandDataElement::kCsTag_Data), TLV::kTLVType_Structure, dataContainer));
+    ReturnErrorOnFailure(dataWriter->Put(TLV::ContextTag(kFirstFieldId), static_cast<uint8_t>(kFirstFieldId)));
+    ReturnErrorOnFailure(dataWriter->EndContainer(dataContainer));
+
+    commandDataElem.EndOfCommandDataElement();
+    commandList.EndOfCommandList();
+    invokeCommand.EndOfInvokeCommand();
+    return invokeCommand.GetError();
+}
+
+CHIP_ERROR EncodeReadRequest(System::PacketBufferTLVWriter & writer)
+{
+    ReadRequest::Builder request;
+
+    ReturnErrorOnFailure(request.Init(&writer));
+    AttributePathList::Builder attributePathList = request.CreateAttributePathListBuilder();
+    ReturnErrorOnFailure(attributePathList.GetError());
+    for (FieldId fieldId = kFirstFieldId; fieldId <= kLastFieldId; fieldId++)
+    {
+        AttributePath::Builder attributePath = attributePathList.CreateAttributePathBuilder();
+        attributePath.NodeId(kDeviceNodeId).EndpointId(kEndpointId).ClusterId(kClusterId).FieldId(fieldId).EndOfAttributePath();
+        ReturnErrorOnFailure(attributePath.GetError());
+    }
+    attributePathList.EndOfAttributePathList();
+    ReturnErrorOnFailure(attributePathList.GetError());
+    request.EndOfReadRequest();
+    return request.GetError();
+}
+
+/**
+ * A controller, which sends its requests on exchanges of its own session with the device, one at a time.
+ */
+class SimulatedController : public ExchangeDelegate
+{
+public:
+    void Init(ExchangeManager * exchangeMgr, SecureSessionHandle session, unsigned invokeWeight, unsigned readWeight)
+    {
+        mExchangeMgr  = exchangeMgr;
+        mSession      = session;
+        mInvokeWeight = invokeWeight;
+        mReadWeight   = readWeight;
+    }
+
+    bool IsIdle() const { return mExchange == nullptr; }
+
+    /**
+     * Send the next request of the mix, which is made of invokeWeight invoke requests for every readWeight read requests.
+     */
+    void SendNextRequest()
+    {
+        RequestType type = ((mRequestCount++ % (mInvokeWeight + mReadWeight)) < mInvokeWeight) ? RequestType::kInvoke
+                                                                                                : RequestType::kRead;
+        CHIP_ERROR err = SendRequest(type);
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(AppServer, "Failed to send the %s request: %s", kRequestTypeNames[static_cast<size_t>(type)],
+                          ErrorStr(err));
+            if (mExchange != nullptr)
+            {
+                mExchange->Abort();
+                mExchange = nullptr;
+            }
+            Complete(type, &RequestStats::mErrors);
+        }
+    }
+
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle payload) override
+    {
+        size_t RequestStats::*outcome = &RequestStats::mErrors;
+
+        if (payloadHeader.HasMessageType(mPendingType == RequestType::kInvoke
+                                             ? Protocols::InteractionModel::MsgType::InvokeCommandResponse
+                                             : Protocols::InteractionModel::MsgType::ReportData))
+        {
+            outcome = nullptr;
+        }
+        else if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
+        {
+            Protocols::SecureChannel::StatusReport report;
+            if (report.Parse(std::move(payload)) == CHIP_NO_ERROR &&
+                report.GetGeneralCode() == Protocols::SecureChannel::GeneralStatusCode::kBusy)
+            {
+                outcome = &RequestStats::mBusy;
+            }
+        }
+
+        ec->Close();
+        mExchange = nullptr;
+        Complete(mPendingType, outcome);
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override
+    {
+        ec->Close();
+        mExchange = nullptr;
+        Complete(mPendingType, &RequestStats::mTimeout);
+    }
+
+private:
+    CHIP_ERROR SendRequest(RequestType type)
+    {
+        System::PacketBufferTLVWriter writer;
+        System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+        VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        writer.Init(std::move(msgBuf));
+        ReturnErrorOnFailure((type == RequestType::kInvoke) ? EncodeInvokeCommand(writer) : EncodeReadRequest(writer));
+        ReturnErrorOnFailure(writer.Finalize(&msgBuf));
+
+        mExchange = mExchangeMgr->NewContext(mSession, this);
+        VerifyOrReturnError(mExchange != nullptr, CHIP_ERROR_NO_MEMORY);
+        mExchange->SetResponseTimeout(kResponseTimeoutMs);
+
+        mPendingType = type;
+        mStartUs     = System::Layer::GetClock_MonotonicHiRes();
+        return (type == RequestType::kInvoke)
+            ? mExchange->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandRequest, std::move(msgBuf),
+                                     SendFlags(SendMessageFlags::kExpectResponse))
+            : mExchange->SendMessage(Protocols::InteractionModel::MsgType::ReadRequest, std::move(msgBuf),
+                                     SendFlags(SendMessageFlags::kExpectResponse));
+    }
+
+    // Records the outcome of the request, which is a latency sample for a response, and a count for the others.
+    void Complete(RequestType type, size_t RequestStats::*outcome)
+    {
+        if (!sRecording)
+        {
+            return;
+        }
+
+        RequestStats & stats = sStats[static_cast<size_t>(type)];
+        if (outcome == nullptr)
+        {
+            uint64_t latencyUs = System::Layer::GetClock_MonotonicHiRes() - mStartUs;
+            stats.mLatenciesUs.push_back(static_cast<uint32_t>(std::min<uint64_t>(latencyUs, UINT32_MAX)));
+        }
+        else
+        {
+            (stats.*outcome)++;
+        }
+    }
+
+    ExchangeManager * mExchangeMgr = nullptr;
+    ExchangeContext * mExchange    = nullptr;
+    SecureSessionHandle mSession;
+    unsigned mInvokeWeight   = kDefaultInvokeWeight;
+    unsigned mReadWeight     = kDefaultReadWeight;
+    uint64_t mRequestCount   = 0;
+    RequestType mPendingType = RequestType::kInvoke;
+    uint64_t mStartUs        = 0;
+};
+
+struct Options
+{
+    size_t mControllerCount = kDefaultControllerCount;
+    uint32_t mDurationMs    = kDefaultDurationMs;
+    uint32_t mWarmupMs      = kDefaultWarmupMs;
+    unsigned mInvokeWeight  = kDefaultInvokeWeight;
+    unsigned mReadWeight    = kDefaultReadWeight;
+};
+
+LoopbackLink sLink;
+Stack sDevice;
+Stack sControllers;
+SimulatedController sSimulatedControllers[kMaxControllers];
+SecurePairingUsingTestSecret sDevicePairings[kMaxControllers];
+SecurePairingUsingTestSecret sControllerPairings[kMaxControllers];
+InteractionModelDelegate sInteractionModelDelegate;
+
+const char * GetArgument(const char * arg, const char * name)
+{
+    size_t length = strlen(name);
+    return (strncmp(arg, name, length) == 0) ? arg + length : nullptr;
+}
+
+bool ParseOptions(int argc, char ** argv, Options & options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char * value;
+
+        if ((value = GetArgument(argv[i], "--controllers=")) != nullptr)
+        {
+            options.mControllerCount = strtoul(value, nullptr, 10);
+        }
+        else if ((value = GetArgument(argv[i], "--duration-ms=")) != nullptr)
+        {
+            options.mDurationMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--warmup-ms=")) != nullptr)
+        {
+            options.mWarmupMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--invoke=")) != nullptr)
+        {
+            options.mInvokeWeight = static_cast<unsigned>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = GetArgument(argv[i], "--read=")) != nullptr)
+        {
+            options.mReadWeight = static_cast<unsigned>(strtoul(value, nullptr, 10));
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return options.mControllerCount > 0 && options.mControllerCount <= kMaxControllers && options.mDurationMs > 0 &&
+        options.mInvokeWeight + options.mReadWeight > 0;
+}
+
+/**
+ * Set up the device, which serves the Interaction Model on admin kDeviceAdminId, and the controllers, each of which has an
+ * admin and a session of its own.
+ */
+CHIP_ERROR InitStacks(System::Layer * systemLayer, const Options & options)
+{
+    // The device is attached first, to end kDeviceEnd of the link
+    ReturnErrorOnFailure(sDevice.Init(kDeviceNodeId, systemLayer, &sLink));
+    ReturnErrorOnFailure(sControllers.Init(kFirstControllerNodeId, systemLayer, &sLink));
+    ReturnErrorOnFailure(InteractionModelEngine::GetInstance()->Init(&sDevice.mExchangeMgr, &sInteractionModelDelegate));
+
+    VerifyOrReturnError(sDevice.mAdmins.AssignAdminId(kDeviceAdminId, kDeviceNodeId) != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < options.mControllerCount; i++)
+    {
+        // The key ids only need to be unique within each session manager
+        const auto adminId  = static_cast<Transport::AdminId>(i);
+        const auto keyId    = static_cast<uint16_t>(i + 1);
+        const NodeId nodeId = kFirstControllerNodeId + i;
+
+        VerifyOrReturnError(sControllers.mAdmins.AssignAdminId(adminId, nodeId) != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        sControllerPairings[i] = SecurePairingUsingTestSecret(keyId, keyId);
+        sDevicePairings[i]     = SecurePairingUsingTestSecret(keyId, keyId);
+        ReturnErrorOnFailure(sControllers.mSessionMgr.NewPairing(
+            Optional<Transport::PeerAddress>::Value(LoopbackLink::GetAddress(kDeviceEnd)), kDeviceNodeId, &sControllerPairings[i],
+            SecureSessionMgr::PairingDirection::kInitiator, adminId));
+        ReturnErrorOnFailure(sDevice.mSessionMgr.NewPairing(
+            Optional<Transport::PeerAddress>::Value(LoopbackLink::GetAddress(kControllersEnd)), nodeId, &sDevicePairings[i],
+            SecureSessionMgr::PairingDirection::kResponder, kDeviceAdminId));
+
+        sSimulatedControllers[i].Init(&sControllers.mExchangeMgr, { kDeviceNodeId, keyId, adminId }, options.mInvokeWeight,
+                                      options.mReadWeight);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+// Delivers the messages in flight and runs the timers and the work scheduled by the stacks, such as the reporting engine.
+void RunEvents()
+{
+    struct timeval sleepTime = { 0, 0 };
+
+    while (sLink.DeliverPending() > 0)
+    {
+    }
+    ServiceEvents(sleepTime);
+}
+
+void RunLoad(const Options & options)
+{
+    const uint64_t startMs  = System::Layer::GetClock_MonotonicMS();
+    const uint64_t recordMs = startMs + options.mWarmupMs;
+    const uint64_t endMs    = recordMs + options.mDurationMs;
+    uint64_t nowMs;
+
+    for (nowMs = startMs; nowMs < endMs; nowMs = System::Layer::GetClock_MonotonicMS())
+    {
+        sRecording = (nowMs >= recordMs);
+        for (size_t i = 0; i < options.mControllerCount; i++)
+        {
+            if (sSimulatedControllers[i].IsIdle())
+            {
+                sSimulatedControllers[i].SendNextRequest();
+            }
+        }
+        RunEvents();
+    }
+    sRecording = false;
+
+    // Let the requests still outstanding complete, so that every exchange is closed before the stacks shut down
+    auto isIdle = [&options]() {
+        return std::all_of(sSimulatedControllers, sSimulatedControllers + options.mControllerCount,
+                           [](const SimulatedController & controller) { return controller.IsIdle(); });
+    };
+    for (const uint64_t drainEndMs = nowMs + 2 * kResponseTimeoutMs; !isIdle() && nowMs < drainEndMs;
+         nowMs = System::Layer::GetClock_MonotonicMS())
+    {
+        RunEvents();
+    }
+    RunEvents();
+}
+
+void PrintResults(const Options & options)
+{
+    struct rusage usage;
+    const double durationS = options.mDurationMs / 1000.0;
+    size_t totalCount      = 0;
+
+    printf("{\"controllers\":%zu,\"duration_ms\":%" PRIu32, options.mControllerCount, options.mDurationMs);
+    for (size_t type = 0; type < static_cast<size_t>(RequestType::kCount); type++)
+    {
+        std::vector<uint32_t> & latencies = sStats[type].mLatenciesUs;
+        std::sort(latencies.begin(), latencies.end());
+
+        auto percentile = [&latencies](size_t percent) -> uint32_t {
+            return latencies.empty() ? 0 : latencies[(latencies.size() - 1) * percent / 100];
+        };
+
+        printf(",\"%s\":{\"count\":%zu,\"busy\":%zu,\"errors\":%zu,\"timeouts\":%zu,\"ops_per_s\":%.1f,\"p50_us\":%" PRIu32
+               ",\"p99_us\":%" PRIu32 ",\"max_us\":%" PRIu32 "}",
+               kRequestTypeNames[type], latencies.size(), sStats[type].mBusy, sStats[type].mErrors, sStats[type].mTimeout,
+               static_cast<double>(latencies.size()) / durationS, percentile(50), percentile(99), percentile(100));
+        totalCount += latencies.size();
+    }
+    printf(",\"ops_per_s\":%.1f", static_cast<double>(totalCount) / durationS);
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        double userS = static_cast<double>(usage.ru_utime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec) / 1e6;
+        double sysS  = static_cast<double>(usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_stime.tv_usec) / 1e6;
+        double runS  = static_cast<double>(options.mWarmupMs + options.mDurationMs) / 1000.0;
+        printf(",\"cpu_user_s\":%.3f,\"cpu_sys_s\":%.3f,\"cpu_percent\":%.1f,\"max_rss_kb\":%ld", userS, sysS,
+               (userS + sysS) * 100 / runS, usage.ru_maxrss);
+    }
+    printf("}\n");
+}
+
+} // namespace
+
+namespace chip {
+namespace app {
+
+// The device serves a cluster with one command, which answers with the values of both its fields, and both fields as attributes.
+void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
+                                  chip::TLV::TLVReader & aReader, Command * apCommandObj)
+{
+    CommandPathParams commandPathParams = { kEndpointId, 0, kClusterId, kCommandId, CommandPathFlags::kEndpointIdValid };
+    TLV::TLVWriter * writer;
+
+    VerifyOrReturn(aClusterId == kClusterId && aCommandId == kCommandId && aEndPointId == kEndpointId);
+    SuccessOrExit(apCommandObj->PrepareCommand(&commandPathParams));
+    writer = apCommandObj->GetCommandDataElementTLVWriter();
+    for (FieldId fieldId = kFirstFieldId; fieldId <= kLastFieldId; fieldId++)
+    {
+        SuccessOrExit(writer->Put(TLV::ContextTag(fieldId), static_cast<uint8_t>(fieldId)));
+    }
+    SuccessOrExit(apCommandObj->FinishCommand());
+
+exit:
+    return;
+}
+
+CHIP_ERROR ReadSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVWriter & aWriter)
+{
+    VerifyOrReturnError(aAttributePathParams.mClusterId == kClusterId && aAttributePathParams.mEndpointId == kEndpointId,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aAttributePathParams.mFieldId >= kFirstFieldId && aAttributePathParams.mFieldId <= kLastFieldId,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    return aWriter.Put(TLV::ContextTag(aAttributePathParams.mFieldId), static_cast<uint8_t>(aAttributePathParams.mFieldId));
+}
+
+CHIP_ERROR WriteSingleClusterData(AttributePathParams & aAttributePathParams, TLV::TLVReader & aReader)
+{
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
+
+int main(int argc, char * argv[])
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Test::IOContext ioContext;
+    Options options;
+
+    if (!ParseOptions(argc, argv, options))
+    {
+        fprintf(stderr,
+                "Usage: %s [--controllers=<1..%zu>] [--duration-ms=<ms>] [--warmup-ms=<ms>] [--invoke=<weight>] "
+                "[--read=<weight>]\n",
+                argv[0], kMaxControllers);
+        return EXIT_FAILURE;
+    }
+
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+
+    err = ioContext.Init(nullptr);
+    SuccessOrExit(err);
+
+    err = InitStacks(&ioContext.GetSystemLayer(), options);
+    SuccessOrExit(err);
+
+    RunLoad(options);
+    PrintResults(options);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "IM loopback benchmark failed, err:%s\n", ErrorStr(err));
+        return EXIT_FAILURE;
+    }
+
+    InteractionModelEngine::GetInstance()->Shutdown();
+    sControllers.Shutdown();
+    sDevice.Shutdown();
+    ioContext.Shutdown();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks of the encoding and decoding of the
+ *      packet header of a secure unicast message, with both node ids, and
+ *      of the payload header of a message acknowledging another.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <protocols/echo/Echo.h>
+#include <transport/raw/MessageHeader.h>
+
+using namespace chip;
+
+namespace {
+
+PacketHeader MakePacketHeader()
+{
+    PacketHeader header;
+    header.SetSourceNodeId(0x0011223344556677ull)
+        .SetDestinationNodeId(0x8899aabbccddeeffull)
+        .SetMessageId(0x12345678)
+        .SetEncryptionKeyID(1)
+        .SetEncryptionType(Header::EncryptionType::kAESCCMTagLen16);
+    return header;
+}
+
+void BenchmarkPacketHeaderEncode(Benchmark::State & state)
+{
+    const PacketHeader header = MakePacketHeader();
+    uint8_t buffer[64];
+    uint16_t encodeSize;
+
+    while (state.KeepRunning())
+    {
+        if (header.Encode(buffer, &encodeSize) != CHIP_NO_ERROR)
+        {
+            state.SetError("Encoding failed");
+        }
+        Benchmark::DoNotOptimize(buffer[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkPacketHeaderEncode);
+
+void BenchmarkPacketHeaderDecode(Benchmark::State & state)
+{
+    uint8_t buffer[64];
+    uint16_t encodeSize = 0;
+    uint16_t decodeSize;
+
+    if (MakePacketHeader().Encode(buffer, &encodeSize) != CHIP_NO_ERROR)
+    {
+        state.SetError("Encoding failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        PacketHeader header;
+        if (header.Decode(buffer, encodeSize, &decodeSize) != CHIP_NO_ERROR)
+        {
+            state.SetError("Decoding failed");
+        }
+        Benchmark::DoNotOptimize(header);
+    }
+}
+CHIP_BENCHMARK(BenchmarkPacketHeaderDecode);
+
+void BenchmarkPayloadHeaderDecode(Benchmark::State & state)
+{
+    PayloadHeader payloadHeader;
+    uint8_t buffer[64];
+    uint16_t encodeSize = 0;
+    uint16_t decodeSize;
+
+    payloadHeader.SetMessageType(Protocols::Echo::MsgType::EchoRequest).SetExchangeID(0x1234).SetAckId(0x12345678);
+    if (payloadHeader.Encode(buffer, &encodeSize) != CHIP_NO_ERROR)
+    {
+        state.SetError("Encoding failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        PayloadHeader header;
+        if (header.Decode(buffer, encodeSize, &decodeSize) != CHIP_NO_ERROR)
+        {
+            state.SetError("Decoding failed");
+        }
+        Benchmark::DoNotOptimize(header);
+    }
+}
+CHIP_BENCHMARK(BenchmarkPayloadHeaderDecode);
+
+} // namespace
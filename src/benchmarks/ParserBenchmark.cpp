@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks replaying the corpus of recorded
+ *      messages through the parsers of ParserTargets.h. Each operation
+ *      parses every message of the corpus of a parser once.
+ *
+ *      The corpus is read from the directory named by the
+ *      CHIP_BENCHMARK_CORPUS_DIR environment variable, or else from
+ *      src/benchmarks/corpus in the source tree.
+ */
+
+#include <benchmarks/Benchmark.h>
+#include <benchmarks/ParserTargets.h>
+
+#include <algorithm>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+using Message = std::vector<uint8_t>;
+
+struct Corpus
+{
+    bool mLoaded = false;
+    std::vector<Message> mMessages;
+    uint64_t mBytes = 0;
+};
+
+const char * GetCorpusDir()
+{
+    const char * dir = getenv("CHIP_BENCHMARK_CORPUS_DIR");
+#ifdef CHIP_BENCHMARK_CORPUS_DIR
+    if (dir == nullptr)
+    {
+        dir = CHIP_BENCHMARK_CORPUS_DIR;
+    }
+#endif
+    return dir;
+}
+
+bool ReadFile(const std::string & path, Message & message)
+{
+    FILE * file = fopen(path.c_str(), "rb");
+    uint8_t buffer[512];
+    size_t read;
+
+    if (file == nullptr)
+    {
+        return false;
+    }
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        message.insert(message.end(), buffer, buffer + read);
+    }
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    return ok;
+}
+
+// Appends the messages of a corpus directory, one per file, in the order of their names
+bool LoadCorpusDir(const char * name, Corpus & corpus)
+{
+    const char * root = GetCorpusDir();
+    if (root == nullptr)
+    {
+        return false;
+    }
+
+    std::string path = std::string(root) + "/" + name;
+    DIR * dir        = opendir(path.c_str());
+    if (dir == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<std::string> files;
+    struct dirent * entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        if (entry->d_name[0] != '.')
+        {
+            files.push_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(files.begin(), files.end());
+
+    for (const std::string & file : files)
+    {
+        Message message;
+        if (!ReadFile(path + "/" + file, message))
+        {
+            return false;
+        }
+        corpus.mBytes += message.size();
+        corpus.mMessages.push_back(std::move(message));
+    }
+    return !corpus.mMessages.empty();
+}
+
+void BenchmarkParser(Benchmark::State & state, const char * parserName, const char * const * corpusNames, Corpus & corpus)
+{
+    const Benchmark::ParserTarget * target = Benchmark::FindParserTarget(parserName);
+
+    if (!corpus.mLoaded)
+    {
+        for (const char * const * name = corpusNames; *name != nullptr; name++)
+        {
+            if (!LoadCorpusDir(*name, corpus))
+            {
+                corpus = Corpus();
+                state.SetError("Cannot read the corpus, see CHIP_BENCHMARK_CORPUS_DIR");
+                return;
+            }
+        }
+        corpus.mLoaded = true;
+    }
+
+    // The corpus holds valid messages only, so that a parser rejecting one is caught as a regression.
+    for (const Message & message : corpus.mMessages)
+    {
+        if (target->mParse(message.data(), message.size()) != CHIP_NO_ERROR)
+        {
+            state.SetError("A message of the corpus does not parse");
+            return;
+        }
+    }
+
+    state.SetBytesPerIteration(corpus.mBytes);
+    while (state.KeepRunning())
+    {
+        for (const Message & message : corpus.mMessages)
+        {
+            Benchmark::DoNotOptimize(target->mParse(message.data(), message.size()));
+        }
+    }
+}
+
+void BenchmarkParseTLV(Benchmark::State & state)
+{
+    // Any Interaction Model payload is TLV
+    static const char * const kCorpus[] = { "attribute-data-element", "report-data", "invoke-command", nullptr };
+    static Corpus sCorpus;
+    BenchmarkParser(state, "tlv", kCorpus, sCorpus);
+}
+CHIP_BENCHMARK(BenchmarkParseTLV);
+
+void BenchmarkParseAttributeDataElement(Benchmark::State & state)
+{
+    static const char * const kCorpus[] = { "attribute-data-element", nullptr };
+    static Corpus sCorpus;
+    BenchmarkParser(state, "attribute-data-element", kCorpus, sCorpus);
+}
+CHIP_BENCHMARK(BenchmarkParseAttributeDataElement);
+
+void BenchmarkParseReportData(Benchmark::State & state)
+{
+    static const char * const kCorpus[] = { "report-data", nullptr };
+    static Corpus sCorpus;
+    BenchmarkParser(state, "report-data", kCorpus, sCorpus);
+}
+CHIP_BENCHMARK(BenchmarkParseReportData);
+
+void BenchmarkParseInvokeCommand(Benchmark::State & state)
+{
+    static const char * const kCorpus[] = { "invoke-command", nullptr };
+    static Corpus sCorpus;
+    BenchmarkParser(state, "invoke-command", kCorpus, sCorpus);
+}
+CHIP_BENCHMARK(BenchmarkParseInvokeCommand);
+
+void BenchmarkParseMdnsPacket(Benchmark::State & state)
+{
+    static const char * const kCorpus[] = { "mdns-packet", nullptr };
+    static Corpus sCorpus;
+    BenchmarkParser(state, "mdns-packet", kCorpus, sCorpus);
+}
+CHIP_BENCHMARK(BenchmarkParseMdnsPacket);
+
+} // namespace
@@ -0,0 +1,46 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the libFuzzer entry point of a fuzzer of one of
+ *      the parsers of ParserTargets.h, the one named by
+ *      CHIP_FUZZ_PARSER_TARGET. The corpus directory of the parser, in
+ *      src/benchmarks/corpus, is its seed corpus.
+ */
+
+#include <benchmarks/ParserTargets.h>
+
+#include <stdlib.h>
+
+#ifndef CHIP_FUZZ_PARSER_TARGET
+#error "CHIP_FUZZ_PARSER_TARGET must name the parser to fuzz"
+#endif
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size)
+{
+    static const chip::Benchmark::ParserTarget * sTarget = chip::Benchmark::FindParserTarget(CHIP_FUZZ_PARSER_TARGET);
+
+    if (sTarget == nullptr)
+    {
+        abort();
+    }
+
+    // Errors are expected from malformed input, only crashes and sanitizer reports are findings.
+    sTarget->mParse(data, size);
+    return 0;
+}
@@ -0,0 +1,363 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the parsers that the corpus of recorded messages
+ *      is replayed through.
+ */
+
+#include <benchmarks/ParserTargets.h>
+
+#include <app/MessageDef/AttributeDataElement.h>
+#include <app/MessageDef/AttributePath.h>
+#include <app/MessageDef/CommandDataElement.h>
+#include <app/MessageDef/CommandList.h>
+#include <app/MessageDef/CommandPath.h>
+#include <app/MessageDef/InvokeCommand.h>
+#include <app/MessageDef/ReportData.h>
+#include <core/CHIPTLV.h>
+#include <inet/IPAddress.h>
+#include <mdns/minimal/Parser.h>
+#include <mdns/minimal/RecordData.h>
+#include <support/CodeUtils.h>
+#include <support/SafeInt.h>
+
+#include <string.h>
+
+using namespace chip::app;
+
+namespace chip {
+namespace Benchmark {
+namespace {
+
+// Deep enough for any message, and keeps malformed input from exhausting the stack
+constexpr uint8_t kMaxTLVDepth = 16;
+
+CHIP_ERROR WalkTLV(TLV::TLVReader & reader, uint8_t depth)
+{
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        switch (reader.GetType())
+        {
+        case TLV::kTLVType_Structure:
+        case TLV::kTLVType_Array:
+        case TLV::kTLVType_List: {
+            TLV::TLVType containerType;
+            VerifyOrReturnError(depth < kMaxTLVDepth, CHIP_ERROR_INVALID_TLV_ELEMENT);
+            ReturnErrorOnFailure(reader.EnterContainer(containerType));
+            ReturnErrorOnFailure(WalkTLV(reader, static_cast<uint8_t>(depth + 1)));
+            ReturnErrorOnFailure(reader.ExitContainer(containerType));
+            break;
+        }
+        case TLV::kTLVType_UTF8String:
+        case TLV::kTLVType_ByteString: {
+            const uint8_t * data;
+            ReturnErrorOnFailure(reader.GetDataPtr(data));
+            break;
+        }
+        case TLV::kTLVType_SignedInteger: {
+            int64_t value;
+            ReturnErrorOnFailure(reader.Get(value));
+            break;
+        }
+        case TLV::kTLVType_UnsignedInteger: {
+            uint64_t value;
+            ReturnErrorOnFailure(reader.Get(value));
+            break;
+        }
+        case TLV::kTLVType_Boolean: {
+            bool value;
+            ReturnErrorOnFailure(reader.Get(value));
+            break;
+        }
+        case TLV::kTLVType_FloatingPointNumber: {
+            double value;
+            ReturnErrorOnFailure(reader.Get(value));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+// Positions the reader on the single top-level element of a payload
+CHIP_ERROR InitPayloadReader(TLV::TLVReader & reader, const uint8_t * data, size_t length)
+{
+    VerifyOrReturnError(CanCastTo<uint32_t>(length), CHIP_ERROR_MESSAGE_TOO_LONG);
+    reader.Init(data, static_cast<uint32_t>(length));
+    return reader.Next();
+}
+
+CHIP_ERROR ParseTLV(const uint8_t * data, size_t length)
+{
+    TLV::TLVReader reader;
+
+    VerifyOrReturnError(CanCastTo<uint32_t>(length), CHIP_ERROR_MESSAGE_TOO_LONG);
+    reader.Init(data, static_cast<uint32_t>(length));
+    return WalkTLV(reader, 0);
+}
+
+CHIP_ERROR ParseAttributeDataElement(const TLV::TLVReader & elementReader)
+{
+    AttributeDataElement::Parser element;
+    AttributePath::Parser path;
+    NodeId nodeId;
+    EndpointId endpointId;
+    ClusterId clusterId;
+    FieldId fieldId;
+    ListIndex listIndex;
+    uint32_t presenceMask = 0;
+    DataVersion version;
+    TLV::TLVReader dataReader;
+
+    ReturnErrorOnFailure(element.Init(elementReader));
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    ReturnErrorOnFailure(element.CheckSchemaValidity());
+#endif
+    ReturnErrorOnFailure(element.GetAttributePath(&path));
+    ReturnErrorOnFailure(path.DecodeAttributePath(&nodeId, &endpointId, &clusterId, &fieldId, &listIndex, &presenceMask));
+
+    // The data version is optional.
+    CHIP_ERROR err = element.GetDataVersion(&version);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(element.GetData(&dataReader));
+    if (TLV::TLVTypeIsContainer(dataReader.GetType()))
+    {
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(dataReader.EnterContainer(containerType));
+        ReturnErrorOnFailure(WalkTLV(dataReader, 1));
+        ReturnErrorOnFailure(dataReader.ExitContainer(containerType));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ParseAttributeDataElementPayload(const uint8_t * data, size_t length)
+{
+    TLV::TLVReader reader;
+
+    ReturnErrorOnFailure(InitPayloadReader(reader, data, length));
+    return ParseAttributeDataElement(reader);
+}
+
+CHIP_ERROR ParseReportData(const uint8_t * data, size_t length)
+{
+    TLV::TLVReader reader;
+    ReportData::Parser report;
+    AttributeDataList::Parser attributeDataList;
+    EventList::Parser eventList;
+    bool flag;
+    CHIP_ERROR err;
+
+    ReturnErrorOnFailure(InitPayloadReader(reader, data, length));
+    ReturnErrorOnFailure(report.Init(reader));
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    ReturnErrorOnFailure(report.CheckSchemaValidity());
+#endif
+
+    err = report.GetSuppressResponse(&flag);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+    err = report.GetMoreChunkedMessages(&flag);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+
+    err = report.GetEventDataList(&eventList);
+    if (err == CHIP_NO_ERROR)
+    {
+        TLV::TLVReader eventListReader;
+        eventList.GetReader(&eventListReader);
+        ReturnErrorOnFailure(WalkTLV(eventListReader, 1));
+    }
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+
+    err = report.GetAttributeDataList(&attributeDataList);
+    if (err == CHIP_NO_ERROR)
+    {
+        TLV::TLVReader listReader;
+        attributeDataList.GetReader(&listReader);
+        while ((err = listReader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(ParseAttributeDataElement(listReader));
+        }
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+CHIP_ERROR ParseInvokeCommand(const uint8_t * data, size_t length)
+{
+    TLV::TLVReader reader;
+    TLV::TLVReader commandListReader;
+    InvokeCommand::Parser invokeCommand;
+    CommandList::Parser commandList;
+    CHIP_ERROR err;
+
+    ReturnErrorOnFailure(InitPayloadReader(reader, data, length));
+    ReturnErrorOnFailure(invokeCommand.Init(reader));
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    ReturnErrorOnFailure(invokeCommand.CheckSchemaValidity());
+#endif
+    ReturnErrorOnFailure(invokeCommand.GetCommandList(&commandList));
+
+    commandList.GetReader(&commandListReader);
+    while ((err = commandListReader.Next()) == CHIP_NO_ERROR)
+    {
+        CommandDataElement::Parser element;
+        CommandPath::Parser path;
+        EndpointId endpointId;
+        GroupId groupId;
+        ClusterId clusterId;
+        CommandId commandId;
+        uint32_t presenceMask = 0;
+        TLV::TLVReader dataReader;
+
+        VerifyOrReturnError(commandListReader.GetTag() == TLV::AnonymousTag, CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(commandListReader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+
+        ReturnErrorOnFailure(element.Init(commandListReader));
+        ReturnErrorOnFailure(element.GetCommandPath(&path));
+        ReturnErrorOnFailure(path.DecodeCommandPath(&endpointId, &groupId, &clusterId, &commandId, &presenceMask));
+
+        // A command carries either data or a status.
+        err = element.GetData(&dataReader);
+        if (err == CHIP_NO_ERROR && TLV::TLVTypeIsContainer(dataReader.GetType()))
+        {
+            TLV::TLVType containerType;
+            ReturnErrorOnFailure(dataReader.EnterContainer(containerType));
+            ReturnErrorOnFailure(WalkTLV(dataReader, 1));
+            ReturnErrorOnFailure(dataReader.ExitContainer(containerType));
+        }
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+class TxtRecordWalker : public mdns::Minimal::TxtRecordDelegate
+{
+public:
+    void OnRecord(const mdns::Minimal::BytesRange & name, const mdns::Minimal::BytesRange & value) override
+    {
+        mLength += name.Size() + value.Size();
+    }
+
+    size_t mLength = 0;
+};
+
+// Decodes every record of a packet, as the resolver does with the records that answer its queries
+class PacketWalker : public mdns::Minimal::ParserDelegate
+{
+public:
+    explicit PacketWalker(const mdns::Minimal::BytesRange & packet) : mPacket(packet) {}
+
+    void OnHeader(mdns::Minimal::ConstHeaderRef & header) override {}
+
+    void OnQuery(const mdns::Minimal::QueryData & data) override { WalkName(data.GetName()); }
+
+    void OnResource(mdns::Minimal::ResourceType type, const mdns::Minimal::ResourceData & data) override
+    {
+        WalkName(data.GetName());
+
+        switch (data.GetType())
+        {
+        case mdns::Minimal::QType::PTR: {
+            mdns::Minimal::SerializedQNameIterator name;
+            mValid = mdns::Minimal::ParsePtrRecord(data.GetData(), mPacket, &name) && mValid;
+            WalkName(name);
+            break;
+        }
+        case mdns::Minimal::QType::SRV: {
+            mdns::Minimal::SrvRecord srv;
+            mValid = srv.Parse(data.GetData(), mPacket) && mValid;
+            WalkName(srv.GetName());
+            break;
+        }
+        case mdns::Minimal::QType::TXT: {
+            TxtRecordWalker txt;
+            mValid = mdns::Minimal::ParseTxtRecord(data.GetData(), &txt) && mValid;
+            break;
+        }
+        case mdns::Minimal::QType::A: {
+            Inet::IPAddress addr;
+            mValid = mdns::Minimal::ParseARecord(data.GetData(), &addr) && mValid;
+            break;
+        }
+        case mdns::Minimal::QType::AAAA: {
+            Inet::IPAddress addr;
+            mValid = mdns::Minimal::ParseAAAARecord(data.GetData(), &addr) && mValid;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    bool IsValid() const { return mValid; }
+
+private:
+    void WalkName(mdns::Minimal::SerializedQNameIterator name)
+    {
+        while (name.Next())
+        {
+            mNameLength += strlen(name.Value());
+        }
+        mValid = name.IsValid() && mValid;
+    }
+
+    mdns::Minimal::BytesRange mPacket;
+    size_t mNameLength = 0;
+    bool mValid        = true;
+};
+
+CHIP_ERROR ParseMdnsPacket(const uint8_t * data, size_t length)
+{
+    mdns::Minimal::BytesRange packet(data, data + length);
+    PacketWalker walker(packet);
+
+    VerifyOrReturnError(mdns::Minimal::ParsePacket(packet, &walker), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    return walker.IsValid() ? CHIP_NO_ERROR : CHIP_ERROR_INVALID_ARGUMENT;
+}
+
+} // namespace
+
+const ParserTarget kParserTargets[] = {
+    { "tlv", ParseTLV },
+    { "attribute-data-element", ParseAttributeDataElementPayload },
+    { "report-data", ParseReportData },
+    { "invoke-command", ParseInvokeCommand },
+    { "mdns-packet", ParseMdnsPacket },
+    { nullptr, nullptr },
+};
+
+const ParserTarget * FindParserTarget(const char * name)
+{
+    for (const ParserTarget * target = kParserTargets; target->mName != nullptr; target++)
+    {
+        if (strcmp(target->mName, name) == 0)
+        {
+            return target;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,61 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the parsers that the corpus of recorded messages
+ *      in src/benchmarks/corpus is replayed through, by the parser
+ *      benchmarks and by the fuzzers built with the chip_fuzz_target GN
+ *      template. Each parser handles a message the way the device or the
+ *      controller does on reception, and rejects malformed input with an
+ *      error.
+ */
+
+#pragma once
+
+#include <core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Benchmark {
+
+struct ParserTarget
+{
+    const char * mName; /**< Also the name of the corpus directory of the parser. */
+    CHIP_ERROR (*mParse)(const uint8_t * data, size_t length);
+};
+
+/**
+ * The parsers, terminated by an entry with a null name:
+ *
+ *   - "tlv": reads every element of a TLV encoding, entering every container.
+ *   - "attribute-data-element": an AttributeDataElement, as found in the list of a report.
+ *   - "report-data": a ReportData payload, as processed by the ReadClient.
+ *   - "invoke-command": an InvokeCommand payload, as processed by a command handler.
+ *   - "mdns-packet": an mDNS packet, with the PTR, SRV, TXT, A and AAAA records decoded, as done by the resolver.
+ */
+extern const ParserTarget kParserTargets[];
+
+/**
+ * @return The parser of the given name, or nullptr if there is none.
+ */
+const ParserTarget * FindParserTarget(const char * name);
+
+} // namespace Benchmark
+} // namespace chip
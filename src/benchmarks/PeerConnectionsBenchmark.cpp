@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks of the peer connection state lookups
+ *      made for every message, on a full pool, with and without the hash
+ *      indexes of CHIP_CONFIG_PEER_CONNECTION_INDEX.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <transport/PeerConnections.h>
+
+using namespace chip;
+using namespace chip::Transport;
+
+namespace {
+
+constexpr size_t kPoolSize    = CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE;
+constexpr NodeId kBaseNodeId  = 0x0011223344550000ull;
+constexpr uint16_t kBaseKeyId = 0x100;
+constexpr uint16_t kPeerKeyId = 0x200;
+
+template <bool kIndexed>
+using Pool = PeerConnections<kPoolSize, Time::Source::kTest, kIndexed>;
+
+template <bool kIndexed>
+bool FillPool(Pool<kIndexed> & pool)
+{
+    for (size_t i = 0; i < kPoolSize; i++)
+    {
+        PeerConnectionState * state;
+        if (pool.CreateNewPeerConnectionState(Optional<NodeId>::Value(kBaseNodeId + i), kPeerKeyId,
+                                              static_cast<uint16_t>(kBaseKeyId + i), &state) != CHIP_NO_ERROR)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Looks up every state in turn, so the average covers the positions in the pool.
+template <bool kIndexed>
+void BenchmarkFindByNodeId(Benchmark::State & state)
+{
+    Pool<kIndexed> pool;
+    size_t i = 0;
+
+    if (!FillPool(pool))
+    {
+        state.SetError("Pool initialization failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        if (pool.FindPeerConnectionState(kBaseNodeId + i, nullptr) == nullptr)
+        {
+            state.SetError("State not found");
+        }
+        i = (i + 1) % kPoolSize;
+    }
+}
+
+template <bool kIndexed>
+void BenchmarkFindByLocalKey(Benchmark::State & state)
+{
+    Pool<kIndexed> pool;
+    size_t i = 0;
+
+    if (!FillPool(pool))
+    {
+        state.SetError("Pool initialization failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        if (pool.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Value(kBaseNodeId + i), static_cast<uint16_t>(kBaseKeyId + i),
+                                                   nullptr) == nullptr)
+        {
+            state.SetError("State not found");
+        }
+        i = (i + 1) % kPoolSize;
+    }
+}
+
+void BenchmarkFindPeerConnectionStateByNodeId(Benchmark::State & state)
+{
+    BenchmarkFindByNodeId<false>(state);
+}
+CHIP_BENCHMARK(BenchmarkFindPeerConnectionStateByNodeId);
+
+void BenchmarkFindPeerConnectionStateByNodeIdIndexed(Benchmark::State & state)
+{
+    BenchmarkFindByNodeId<true>(state);
+}
+CHIP_BENCHMARK(BenchmarkFindPeerConnectionStateByNodeIdIndexed);
+
+void BenchmarkFindPeerConnectionStateByLocalKey(Benchmark::State & state)
+{
+    BenchmarkFindByLocalKey<false>(state);
+}
+CHIP_BENCHMARK(BenchmarkFindPeerConnectionStateByLocalKey);
+
+void BenchmarkFindPeerConnectionStateByLocalKeyIndexed(Benchmark::State & state)
+{
+    BenchmarkFindByLocalKey<true>(state);
+}
+CHIP_BENCHMARK(BenchmarkFindPeerConnectionStateByLocalKeyIndexed);
+
+} // namespace
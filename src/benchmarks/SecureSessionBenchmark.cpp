@@ -0,0 +1,132 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks of the AES-CCM encryption and
+ *      decryption of a message payload by a secure session.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <transport/SecureSession.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+// About the size of an Interaction Model command or report payload
+constexpr size_t kPayloadLength = 64;
+
+const uint8_t kSecret[] = { 0x5a, 0x0f, 0xe3, 0x1c, 0x44, 0x9b, 0x70, 0xd2, 0x81, 0x36, 0xa7, 0x2e, 0xc5, 0x19, 0x6b, 0xf0 };
+const char kSalt[]      = "Benchmark Salt";
+const char kInfo[]      = "Benchmark Info";
+
+CHIP_ERROR InitSession(SecureSession & session)
+{
+    return session.InitFromSecret(kSecret, sizeof(kSecret), reinterpret_cast<const uint8_t *>(kSalt), sizeof(kSalt),
+                                  reinterpret_cast<const uint8_t *>(kInfo), sizeof(kInfo));
+}
+
+PacketHeader MakePacketHeader()
+{
+    PacketHeader header;
+    header.SetSourceNodeId(0x0011223344556677ull).SetMessageId(0x12345678).SetEncryptionKeyID(1);
+    return header;
+}
+
+void BenchmarkSecureSessionEncrypt(Benchmark::State & state)
+{
+    SecureSession session;
+    PacketHeader header = MakePacketHeader();
+    MessageAuthenticationCode mac;
+    uint8_t plainText[kPayloadLength];
+    uint8_t encrypted[kPayloadLength];
+
+    memset(plainText, 0xa5, sizeof(plainText));
+    if (InitSession(session) != CHIP_NO_ERROR)
+    {
+        state.SetError("Session initialization failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        if (session.Encrypt(plainText, sizeof(plainText), encrypted, header, mac) != CHIP_NO_ERROR)
+        {
+            state.SetError("Encryption failed");
+        }
+        Benchmark::DoNotOptimize(encrypted[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkSecureSessionEncrypt);
+
+void BenchmarkSecureSessionDecrypt(Benchmark::State & state)
+{
+    SecureSession session;
+    PacketHeader header = MakePacketHeader();
+    MessageAuthenticationCode mac;
+    uint8_t plainText[kPayloadLength];
+    uint8_t encrypted[kPayloadLength];
+
+    memset(plainText, 0xa5, sizeof(plainText));
+    if (InitSession(session) != CHIP_NO_ERROR ||
+        session.Encrypt(plainText, sizeof(plainText), encrypted, header, mac) != CHIP_NO_ERROR)
+    {
+        state.SetError("Encryption failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        if (session.Decrypt(encrypted, sizeof(encrypted), plainText, header, mac) != CHIP_NO_ERROR)
+        {
+            state.SetError("Decryption failed");
+        }
+        Benchmark::DoNotOptimize(plainText[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkSecureSessionDecrypt);
+
+// The in-place variants are the ones SecureMessageCodec uses on packet buffers.
+void BenchmarkSecureSessionEncryptDecryptInPlace(Benchmark::State & state)
+{
+    SecureSession session;
+    PacketHeader header = MakePacketHeader();
+    uint8_t data[kPayloadLength + kMaxTagLen];
+    uint16_t tagLength;
+
+    memset(data, 0xa5, sizeof(data));
+    if (InitSession(session) != CHIP_NO_ERROR)
+    {
+        state.SetError("Session initialization failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        if (session.EncryptInPlace(data, kPayloadLength, sizeof(data) - kPayloadLength, header, tagLength) != CHIP_NO_ERROR ||
+            session.DecryptInPlace(data, kPayloadLength, header) != CHIP_NO_ERROR)
+        {
+            state.SetError("Encryption or decryption failed");
+        }
+        Benchmark::DoNotOptimize(data[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkSecureSessionEncryptDecryptInPlace);
+
+} // namespace
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks of the TLV encoding and decoding of
+ *      an Interaction Model InvokeCommand message, as sent for a cluster
+ *      command with a few arguments.
+ */
+
+#include <benchmarks/Benchmark.h>
+
+#include <app/MessageDef/CommandDataElement.h>
+#include <app/MessageDef/CommandList.h>
+#include <app/MessageDef/InvokeCommand.h>
+#include <core/CHIPTLV.h>
+#include <support/CodeUtils.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr EndpointId kEndpointId = 1;
+constexpr ClusterId kClusterId   = 0x0006;
+constexpr CommandId kCommandId   = 0x40;
+
+CHIP_ERROR EncodeInvokeCommand(TLV::TLVWriter & writer)
+{
+    InvokeCommand::Builder invokeCommand;
+    TLV::TLVType dataContainer;
+
+    ReturnErrorOnFailure(invokeCommand.Init(&writer));
+    CommandList::Builder & commandList            = invokeCommand.CreateCommandListBuilder();
+    CommandDataElement::Builder & commandDataElem = commandList.CreateCommandDataElementBuilder();
+    commandDataElem.EncodeCommandPath(kEndpointId, kClusterId, kCommandId);
+    ReturnErrorOnFailure(commandDataElem.GetError());
+
+    TLV::TLVWriter * dataWriter = commandDataElem.GetWriter();
+    ReturnErrorOnFailure(
+        dataWriter->StartContainer(TLV::ContextTag(CommandDataElement::kCsTag_Data), TLV::kTLVType_Structure, dataContainer));
+    ReturnErrorOnFailure(dataWriter->Put(TLV::ContextTag(0), static_cast<uint8_t>(0x2a)));
+    ReturnErrorOnFailure(dataWriter->Put(TLV::ContextTag(1), static_cast<uint16_t>(300)));
+    ReturnErrorOnFailure(dataWriter->PutBoolean(TLV::ContextTag(2), true));
+    ReturnErrorOnFailure(dataWriter->PutString(TLV::ContextTag(3), "benchmark"));
+    ReturnErrorOnFailure(dataWriter->EndContainer(dataContainer));
+
+    commandDataElem.EndOfCommandDataElement();
+    commandList.EndOfCommandList();
+    invokeCommand.EndOfInvokeCommand();
+    ReturnErrorOnFailure(invokeCommand.GetError());
+    return writer.Finalize();
+}
+
+// Walks the message as CommandHandler does, down to the command arguments.
+CHIP_ERROR DecodeInvokeCommand(const uint8_t * data, uint32_t length, uint32_t & sum)
+{
+    TLV::TLVReader reader;
+    TLV::TLVReader commandListReader;
+    InvokeCommand::Parser invokeCommand;
+    CommandList::Parser commandList;
+    CHIP_ERROR err;
+
+    reader.Init(data, length);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(invokeCommand.Init(reader));
+    ReturnErrorOnFailure(invokeCommand.GetCommandList(&commandList));
+    commandList.GetReader(&commandListReader);
+
+    while ((err = commandListReader.Next()) == CHIP_NO_ERROR)
+    {
+        CommandDataElement::Parser commandDataElem;
+        CommandPath::Parser commandPath;
+        TLV::TLVReader dataReader;
+        TLV::TLVType dataContainer;
+        EndpointId endpointId;
+        GroupId groupId;
+        ClusterId clusterId;
+        CommandId commandId;
+        uint32_t presenceMask = 0;
+
+        ReturnErrorOnFailure(commandDataElem.Init(commandListReader));
+        ReturnErrorOnFailure(commandDataElem.GetCommandPath(&commandPath));
+        ReturnErrorOnFailure(commandPath.DecodeCommandPath(&endpointId, &groupId, &clusterId, &commandId, &presenceMask));
+        sum += endpointId + clusterId + commandId;
+
+        ReturnErrorOnFailure(commandDataElem.GetData(&dataReader));
+        ReturnErrorOnFailure(dataReader.EnterContainer(dataContainer));
+        while ((err = dataReader.Next()) == CHIP_NO_ERROR)
+        {
+            sum += dataReader.GetLength();
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(dataReader.ExitContainer(dataContainer));
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+void BenchmarkTLVWriterInvokeCommand(Benchmark::State & state)
+{
+    uint8_t buffer[256];
+
+    while (state.KeepRunning())
+    {
+        TLV::TLVWriter writer;
+        writer.Init(buffer, sizeof(buffer));
+        if (EncodeInvokeCommand(writer) != CHIP_NO_ERROR)
+        {
+            state.SetError("Encoding failed");
+        }
+        Benchmark::DoNotOptimize(buffer[0]);
+    }
+}
+CHIP_BENCHMARK(BenchmarkTLVWriterInvokeCommand);
+
+void BenchmarkTLVReaderInvokeCommand(Benchmark::State & state)
+{
+    uint8_t buffer[256];
+    uint32_t sum = 0;
+    TLV::TLVWriter writer;
+
+    writer.Init(buffer, sizeof(buffer));
+    if (EncodeInvokeCommand(writer) != CHIP_NO_ERROR)
+    {
+        state.SetError("Encoding failed");
+    }
+
+    while (state.KeepRunning())
+    {
+        if (DecodeInvokeCommand(buffer, writer.GetLengthWritten(), sum) != CHIP_NO_ERROR)
+        {
+            state.SetError("Decoding failed");
+        }
+    }
+    Benchmark::DoNotOptimize(sum);
+}
+CHIP_BENCHMARK(BenchmarkTLVReaderInvokeCommand);
+
+} // namespace
@@ -605,9 +605,13 @@ BLE_ERROR BLEEndPoint::SendCharacteristic(PacketBufferHandle && buf)
 {
     BLE_ERROR err = BLE_NO_ERROR;
 
+    // Unless it closes the remote receive window, a fragment may be sent without GATT confirmation: the BTP ack
+    // the window waits for anyway confirms its receipt.
+    const bool acknowledged = !BLE_CONFIG_UNACKNOWLEDGED_GATT_SENDS || mRemoteReceiveWindowSize <= 1;
+
     if (mRole == kBleRole_Central)
     {
-        if (!SendWrite(std::move(buf)))
+        if (!SendWrite(std::move(buf), acknowledged))
         {
             err = BLE_ERROR_GATT_WRITE_FAILED;
         }
@@ -620,7 +624,7 @@ BLE_ERROR BLEEndPoint::SendCharacteristic(PacketBufferHandle && buf)
     }
     else // (mRole == kBleRole_Peripheral), verified on Init
     {
-        if (!SendIndication(std::move(buf)))
+        if (!SendIndication(std::move(buf), acknowledged))
         {
             err = BLE_ERROR_GATT_INDICATE_FAILED;
         }
@@ -1463,17 +1467,28 @@ exit:
     return err;
 }
 
-bool BLEEndPoint::SendWrite(PacketBufferHandle && buf)
+bool BLEEndPoint::SendWrite(PacketBufferHandle && buf, bool acknowledged)
 {
+    // The platform reports when an unacknowledged write has been handed to its BLE stack as it would a confirmation.
     mConnStateFlags.Set(ConnectionStateFlag::kGattOperationInFlight);
 
+    if (!acknowledged)
+    {
+        return mBle->mPlatformDelegate->SendWriteWithoutResponse(mConnObj, &CHIP_BLE_SVC_ID, &mBle->CHIP_BLE_CHAR_1_ID,
+                                                                 std::move(buf));
+    }
     return mBle->mPlatformDelegate->SendWriteRequest(mConnObj, &CHIP_BLE_SVC_ID, &mBle->CHIP_BLE_CHAR_1_ID, std::move(buf));
 }
 
-bool BLEEndPoint::SendIndication(PacketBufferHandle && buf)
+bool BLEEndPoint::SendIndication(PacketBufferHandle && buf, bool acknowledged)
 {
+    // The platform reports when a notification has been handed to its BLE stack as it would a confirmation.
     mConnStateFlags.Set(ConnectionStateFlag::kGattOperationInFlight);
 
+    if (!acknowledged)
+    {
+        return mBle->mPlatformDelegate->SendNotification(mConnObj, &CHIP_BLE_SVC_ID, &mBle->CHIP_BLE_CHAR_2_ID, std::move(buf));
+    }
     return mBle->mPlatformDelegate->SendIndication(mConnObj, &CHIP_BLE_SVC_ID, &mBle->CHIP_BLE_CHAR_2_ID, std::move(buf));
 }
 
@@ -183,8 +183,8 @@ private:
     BLE_ERROR ContinueMessageSend();
     BLE_ERROR DoSendStandAloneAck();
     BLE_ERROR SendCharacteristic(PacketBufferHandle && buf);
-    bool SendIndication(PacketBufferHandle && buf);
-    bool SendWrite(PacketBufferHandle && buf);
+    bool SendIndication(PacketBufferHandle && buf, bool acknowledged = true);
+    bool SendWrite(PacketBufferHandle && buf, bool acknowledged = true);
 
     // Receive path:
     BLE_ERROR HandleConnectComplete();
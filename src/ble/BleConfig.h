@@ -163,6 +163,9 @@
  *    Default value of 3 is absolute minimum for stable performance, and an attempt to ensure safe window sizes on new
  *    platforms.
  *
+ *    Platforms with enough GATT buffers should raise it, in particular along with BLE_CONFIG_UNACKNOWLEDGED_GATT_SENDS:
+ *    the window bounds the fragments a sender may have in flight before it waits for a BTP acknowledgement.
+ *
  */
 #ifndef BLE_MAX_RECEIVE_WINDOW_SIZE
 #define BLE_MAX_RECEIVE_WINDOW_SIZE                            3
@@ -172,6 +175,46 @@
 #error "BLE_MAX_RECEIVE_WINDOW_SIZE must be greater than 2 for BLE transport protocol stability."
 #endif
 
+/**
+ *  @def BLE_CONFIG_MAX_FRAGMENT_SIZE
+ *
+ *  @brief
+ *    This is the largest BTP fragment size, in bytes, that a BLE end point will negotiate. The fragment size of a
+ *    connection is the smaller of this value and the ATT MTU of the connection less the 3 bytes of the ATT header.
+ *
+ *    The CHIPoBLE write and indication characteristics of the platform must accept values of this size. Platforms
+ *    that negotiate large ATT MTUs, e.g. with LE Data Length Extension, may raise it up to the 512-byte maximum
+ *    length of an attribute value to send fewer, larger fragments.
+ *
+ */
+#ifndef BLE_CONFIG_MAX_FRAGMENT_SIZE
+#define BLE_CONFIG_MAX_FRAGMENT_SIZE                           128
+#endif
+
+#if (BLE_CONFIG_MAX_FRAGMENT_SIZE < 20) || (BLE_CONFIG_MAX_FRAGMENT_SIZE > 512)
+#error "BLE_CONFIG_MAX_FRAGMENT_SIZE must be between the 20-byte minimum fragment size and the 512-byte attribute length limit."
+#endif
+
+/**
+ *  @def BLE_CONFIG_UNACKNOWLEDGED_GATT_SENDS
+ *
+ *  @brief
+ *    Enable (1) or disable (0) sending the BTP data fragments with GATT writes without response and notifications
+ *    instead of writes and indications, so that a BLE end point does not wait a round trip for each GATT
+ *    confirmation and the platform may send several fragments per connection event. The BTP acknowledgements still
+ *    provide reliability and flow control: the handshake, and the fragment which closes the remote receive window,
+ *    are always sent with acknowledged GATT operations.
+ *
+ *    The platform must call BleLayer::HandleWriteConfirmation or BleLayer::HandleIndicationConfirmation once an
+ *    unacknowledged send has been handed to its BLE stack, see BlePlatformDelegate::SendWriteWithoutResponse and
+ *    BlePlatformDelegate::SendNotification. The CHIPoBLE write characteristic of the peripheral must then permit
+ *    writes without response.
+ *
+ */
+#ifndef BLE_CONFIG_UNACKNOWLEDGED_GATT_SENDS
+#define BLE_CONFIG_UNACKNOWLEDGED_GATT_SENDS                   0
+#endif
+
 /**
  *  @def BLE_CONFIG_ERROR_TYPE
  *
@@ -403,6 +403,21 @@ BLE_ERROR BleLayer::NewBleConnectionByDiscriminator(uint16_t connDiscriminator)
     return BLE_NO_ERROR;
 }
 
+BLE_ERROR BleLayer::NewBleConnectionByDiscriminator(uint16_t connDiscriminator, void * appState,
+                                                    BleConnectionDelegate::OnConnectionCompleteFunct onSuccess,
+                                                    BleConnectionDelegate::OnConnectionErrorFunct onError)
+{
+    VerifyOrReturnError(mState == kState_Initialized, BLE_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mConnectionDelegate != nullptr, BLE_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(onSuccess != nullptr && onError != nullptr, BLE_ERROR_BAD_ARGS);
+
+    mConnectionDelegate->OnConnectionComplete = onSuccess;
+    mConnectionDelegate->OnConnectionError    = onError;
+    mConnectionDelegate->NewConnection(this, appState, connDiscriminator);
+
+    return BLE_NO_ERROR;
+}
+
 BLE_ERROR BleLayer::NewBleConnectionByObject(BLE_CONNECTION_OBJECT connObj)
 {
     VerifyOrReturnError(mState == kState_Initialized, BLE_ERROR_INCORRECT_STATE);
@@ -247,6 +247,12 @@ public:
 
     BLE_ERROR CancelBleIncompleteConnection();
     BLE_ERROR NewBleConnectionByDiscriminator(uint16_t connDiscriminator);
+    // Connect to the device with the given discriminator and report the connection to onSuccess (which may create its
+    // end point with NewBleEndPoint) or onError, with appState, instead of to the BLE transport. Connection delegates
+    // which support it serve several of these requests at once; the concurrent ones must share the same callbacks.
+    BLE_ERROR NewBleConnectionByDiscriminator(uint16_t connDiscriminator, void * appState,
+                                              BleConnectionDelegate::OnConnectionCompleteFunct onSuccess,
+                                              BleConnectionDelegate::OnConnectionErrorFunct onError);
     BLE_ERROR NewBleConnectionByObject(BLE_CONNECTION_OBJECT connObj);
     BLE_ERROR NewBleEndPoint(BLEEndPoint ** retEndPoint, BLE_CONNECTION_OBJECT connObj, BleRole role, bool autoClose);
 
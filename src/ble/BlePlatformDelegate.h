@@ -70,6 +70,25 @@ public:
     virtual bool SendWriteRequest(BLE_CONNECTION_OBJECT connObj, const ChipBleUUID * svcId, const ChipBleUUID * charId,
                                   PacketBufferHandle pBuf) = 0;
 
+    // Following APIs may be implemented by platform to support BLE_CONFIG_UNACKNOWLEDGED_GATT_SENDS:
+    //   The platform must call BleLayer::HandleIndicationConfirmation or BleLayer::HandleWriteConfirmation once the
+    //   notification or write without response has been handed to its BLE stack, as no GATT confirmation will come.
+    //   By default, they send the acknowledged GATT operations.
+
+    // Send GATT characteristic notification
+    virtual bool SendNotification(BLE_CONNECTION_OBJECT connObj, const ChipBleUUID * svcId, const ChipBleUUID * charId,
+                                  PacketBufferHandle pBuf)
+    {
+        return SendIndication(connObj, svcId, charId, std::move(pBuf));
+    }
+
+    // Send GATT characteristic write without response
+    virtual bool SendWriteWithoutResponse(BLE_CONNECTION_OBJECT connObj, const ChipBleUUID * svcId, const ChipBleUUID * charId,
+                                          PacketBufferHandle pBuf)
+    {
+        return SendWriteRequest(connObj, svcId, charId, std::move(pBuf));
+    }
+
     // Send GATT characteristic read request
     virtual bool SendReadRequest(BLE_CONNECTION_OBJECT connObj, const ChipBleUUID * svcId, const ChipBleUUID * charId,
                                  PacketBufferHandle pBuf) = 0;
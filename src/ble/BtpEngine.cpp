@@ -73,8 +73,8 @@ static void PrintBufDebug(const System::PacketBufferHandle & buf)
 #endif
 }
 
-const uint16_t BtpEngine::sDefaultFragmentSize = 20;  // 23-byte minimum ATT_MTU - 3 bytes for ATT operation header
-const uint16_t BtpEngine::sMaxFragmentSize     = 128; // Size of write and indication characteristics
+const uint16_t BtpEngine::sDefaultFragmentSize = 20;                           // 23-byte minimum ATT_MTU - 3 bytes for ATT operation header
+const uint16_t BtpEngine::sMaxFragmentSize     = BLE_CONFIG_MAX_FRAGMENT_SIZE; // Size of write and indication characteristics
 
 BLE_ERROR BtpEngine::Init(void * an_app_state, bool expect_first_ack)
 {
@@ -317,13 +317,23 @@ BLE_ERROR BtpEngine::HandleCharacteristicReceived(System::PacketBufferHandle dat
 
         data->ConsumeHead(startReader.OctetsRead());
 
-        // Create a new buffer for use as the Rx re-assembly area.
-        mRxBuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+        if (data->AllocSize() >= mRxLength)
+        {
+            // The buffer of the first fragment can hold the whole message, so reassemble the message in it rather than
+            // in a buffer of its own: the subsequent fragments are appended to it without an extra allocation.
+            mRxBuf = std::move(data);
+            mRxBuf->CompactHead(); // moves the payload to the start of the buffer, past its spent header room
+        }
+        else
+        {
+            // Create a new buffer for use as the Rx re-assembly area.
+            mRxBuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
 
-        VerifyOrExit(!mRxBuf.IsNull(), err = BLE_ERROR_NO_MEMORY);
+            VerifyOrExit(!mRxBuf.IsNull(), err = BLE_ERROR_NO_MEMORY);
 
-        mRxBuf->AddToEnd(std::move(data));
-        mRxBuf->CompactHead(); // will free 'data' and adjust rx buf's end/length
+            mRxBuf->AddToEnd(std::move(data));
+            mRxBuf->CompactHead(); // will free 'data' and adjust rx buf's end/length
+        }
     }
     else if (mRxState == kState_InProgress)
     {
@@ -66,6 +66,8 @@ bool ChannelContext::MatchTransport(Transport::Type transport)
         switch (mStateVars.mPreparing.mBuilder.GetTransportPreference())
         {
         case ChannelBuilder::TransportPreference::kPreferConnectionOriented:
+            // The channel may end up on either transport
+            return false;
         case ChannelBuilder::TransportPreference::kConnectionOriented:
             return transport == Transport::Type::kTcp;
         case ChannelBuilder::TransportPreference::kConnectionless:
@@ -88,6 +90,8 @@ bool ChannelContext::MatchTransportPreference(ChannelBuilder::TransportPreferenc
     switch (transport)
     {
     case ChannelBuilder::TransportPreference::kPreferConnectionOriented:
+        // Either transport will do, so share any channel to the peer, whether ready or still being set up
+        return mState == ChannelState::kPreparing || mState == ChannelState::kReady;
     case ChannelBuilder::TransportPreference::kConnectionOriented:
         return MatchTransport(Transport::Type::kTcp);
     case ChannelBuilder::TransportPreference::kConnectionless:
@@ -326,6 +330,11 @@ void ChannelContext::EnterReadyState(SecureSessionHandle session)
     mState = ChannelState::kReady;
 
     mStateVars.mReady.mSession = session;
+
+    // Keep the channel open once its handles are released, for the next EstablishChannel to the peer
+    mPooled = true;
+    Retain();
+
     mChannelManager->NotifyChannelEvent(this, [](ChannelDelegate * delegate) { delegate->OnEstablished(); });
 }
 
@@ -351,12 +360,24 @@ void ChannelContext::EnterFailedState(CHIP_ERROR error)
 {
     mState = ChannelState::kFailed;
     mChannelManager->NotifyChannelEvent(this, [error](ChannelDelegate * delegate) { delegate->OnFail(error); });
+    // May free the channel, keep last
+    ReleasePooled();
 }
 
 void ChannelContext::EnterClosedState()
 {
     mState = ChannelState::kClosed;
     mChannelManager->NotifyChannelEvent(this, [](ChannelDelegate * delegate) { delegate->OnClosed(); });
+    // May free the channel, keep last
+    ReleasePooled();
+}
+
+void ChannelContext::ReleasePooled()
+{
+    if (!mPooled)
+        return;
+    mPooled = false;
+    Release();
 }
 
 } // namespace Messaging
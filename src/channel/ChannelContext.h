@@ -103,6 +103,19 @@ public:
     bool MatchesBuilder(const ChannelBuilder & builder);
     bool MatchesSession(SecureSessionHandle session, SecureSessionMgr * ssm);
 
+    /*
+     * @brief
+     *  Whether the channel is ready but used by no handle, only kept open by the channel manager so that a later
+     *  EstablishChannel to the same peer reuses it instead of pairing again.
+     */
+    bool IsIdle() const { return mPooled && GetReferenceCount() == 1; }
+
+    /*
+     * @brief
+     *  Drop the reference the channel manager keeps on a ready channel, which frees the channel if it is idle.
+     */
+    void ReleasePooled();
+
     // events of ResolveDelegate, propagated from ExchangeManager
     void HandleNodeIdResolve(CHIP_ERROR error, uint64_t nodeId, const Mdns::MdnsService & address);
 
@@ -121,6 +134,7 @@ private:
     ChannelState mState;
     ExchangeManager * mExchangeManager;
     ChannelManager * mChannelManager;
+    bool mPooled = false; // Whether the channel manager holds a reference on the channel, from the ready state on
 
     enum class PrepareState
     {
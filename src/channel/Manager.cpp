@@ -24,7 +24,8 @@ ChannelHandle ChannelManager::EstablishChannel(const ChannelBuilder & builder, C
 {
     ChannelContext * channelContext = nullptr;
 
-    // Find an existing Channel matching the builder
+    // Find an existing Channel matching the builder, so that concurrent requests to a peer share one pairing, and a ready
+    // channel, idle or not, is reused
     mChannelContexts.ForEachActiveObject([&](ChannelContext * context) {
         if (context->MatchesBuilder(builder))
         {
@@ -36,8 +37,10 @@ ChannelHandle ChannelManager::EstablishChannel(const ChannelBuilder & builder, C
 
     if (channelContext == nullptr)
     {
-        // create a new channel if not found
+        // create a new channel if not found, closing an idle one if the pool is full
         channelContext = mChannelContexts.CreateObject(mExchangeManager, this);
+        if (channelContext == nullptr && ReleaseIdleChannel())
+            channelContext = mChannelContexts.CreateObject(mExchangeManager, this);
         if (channelContext == nullptr)
             return ChannelHandle{ nullptr };
         channelContext->Start(builder);
@@ -52,5 +55,25 @@ ChannelHandle ChannelManager::EstablishChannel(const ChannelBuilder & builder, C
     return ChannelHandle{ association };
 }
 
+bool ChannelManager::ReleaseIdleChannel()
+{
+    ChannelContext * idleContext = nullptr;
+
+    mChannelContexts.ForEachActiveObject([&](ChannelContext * context) {
+        if (context->IsIdle())
+        {
+            idleContext = context;
+            return false;
+        }
+        return true;
+    });
+
+    if (idleContext == nullptr)
+        return false;
+
+    idleContext->ReleasePooled();
+    return true;
+}
+
 } // namespace Messaging
 } // namespace chip
@@ -83,6 +83,9 @@ public:
     }
 
 private:
+    // Frees an idle channel, to make room for a new one. Returns false if no channel is idle.
+    bool ReleaseIdleChannel();
+
     BitMapObjectPool<ChannelContext, CHIP_CONFIG_MAX_ACTIVE_CHANNELS> mChannelContexts;
     BitMapObjectPool<ChannelContextHandleAssociation, CHIP_CONFIG_MAX_CHANNEL_HANDLES> mChannelHandles;
     ExchangeManager * mExchangeManager;
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    This file contains the implementation of the attribute cache of a
+ *    device object.
+ */
+
+#include <controller/AttributeCache.h>
+
+#include <support/CodeUtils.h>
+
+#if CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
+
+namespace chip {
+namespace Controller {
+
+void AttributeCache::Put(const app::AttributePathParams & path, const DataVersion * dataVersion, TLV::TLVReader data,
+                         System::Timer::Epoch now)
+{
+    TLV::TLVWriter writer;
+    Entry * entry;
+
+    VerifyOrReturn(IsEnabled() && IsCacheable(path));
+
+    if (dataVersion != nullptr)
+    {
+        // The data version is the one of the cluster instance, which changes with any of its attributes.
+        for (Entry & other : mEntries)
+        {
+            if (other.mLength != 0 && other.mHasDataVersion && other.mDataVersion != *dataVersion &&
+                other.mPath.mEndpointId == path.mEndpointId && other.mPath.mClusterId == path.mClusterId)
+            {
+                other.mLength = 0;
+            }
+        }
+    }
+
+    entry          = FindOrEvict(path);
+    entry->mLength = 0;
+
+    // Values at the top level of the cache have no context to give their tag a meaning, so they are anonymous.
+    writer.Init(entry->mData, sizeof(entry->mData));
+    VerifyOrReturn(writer.CopyElement(TLV::AnonymousTag, data) == CHIP_NO_ERROR);
+    VerifyOrReturn(writer.Finalize() == CHIP_NO_ERROR);
+
+    entry->mPath           = path;
+    entry->mReceivedAt     = now;
+    entry->mHasDataVersion = (dataVersion != nullptr);
+    entry->mDataVersion    = (dataVersion != nullptr) ? *dataVersion : 0;
+    entry->mLength         = static_cast<uint16_t>(writer.GetLengthWritten());
+}
+
+CHIP_ERROR AttributeCache::Get(const app::AttributePathParams & path, System::Timer::Epoch now, TLV::TLVReader & reader) const
+{
+    VerifyOrReturnError(IsEnabled() && IsCacheable(path), CHIP_ERROR_KEY_NOT_FOUND);
+
+    const Entry * entry = Find(path);
+    VerifyOrReturnError(entry != nullptr && now - entry->mReceivedAt <= mFreshnessMs, CHIP_ERROR_KEY_NOT_FOUND);
+
+    reader.Init(entry->mData, entry->mLength);
+    return reader.Next();
+}
+
+void AttributeCache::Clear()
+{
+    for (Entry & entry : mEntries)
+    {
+        entry.mLength = 0;
+    }
+}
+
+const AttributeCache::Entry * AttributeCache::Find(const app::AttributePathParams & path) const
+{
+    for (const Entry & entry : mEntries)
+    {
+        if (entry.mLength != 0 && entry.mPath.IsSamePath(path))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+AttributeCache::Entry * AttributeCache::FindOrEvict(const app::AttributePathParams & path)
+{
+    Entry * oldest = &mEntries[0];
+
+    for (Entry & entry : mEntries)
+    {
+        if (entry.mLength != 0 && entry.mPath.IsSamePath(path))
+        {
+            return &entry;
+        }
+        // A free entry is older than any value.
+        if (oldest->mLength != 0 && (entry.mLength == 0 || entry.mReceivedAt < oldest->mReceivedAt))
+        {
+            oldest = &entry;
+        }
+    }
+    return oldest;
+}
+
+} // namespace Controller
+} // namespace chip
+
+#endif // CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    This file contains the definition of the attribute cache of a device
+ *    object, which keeps the values of the attributes that Read Requests
+ *    received, so that the reads of the same attributes within a freshness
+ *    bound are served without a request.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <core/CHIPConfig.h>
+#include <core/CHIPError.h>
+#include <core/CHIPTLV.h>
+#include <system/SystemTimer.h>
+
+#if CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
+
+namespace chip {
+namespace Controller {
+
+class AttributeCache
+{
+public:
+    /**
+     * Set how long, in milliseconds, a cached value is served. 0 disables the cache.
+     */
+    void SetFreshness(uint32_t freshnessMs) { mFreshnessMs = freshnessMs; }
+    bool IsEnabled() const { return mFreshnessMs != 0; }
+
+    /**
+     * Cache the value of the attribute of a concrete path, data being positioned on it. A data version, when given,
+     * invalidates the values of the other attributes of the cluster instance received with another data version.
+     * Values too large for an entry are not cached.
+     */
+    void Put(const app::AttributePathParams & path, const DataVersion * dataVersion, TLV::TLVReader data,
+             System::Timer::Epoch now);
+
+    /**
+     * Position reader on the value of the attribute of a concrete path, if cached within the freshness bound.
+     *
+     * @return CHIP_ERROR   CHIP_ERROR_KEY_NOT_FOUND if no such value is cached
+     */
+    CHIP_ERROR Get(const app::AttributePathParams & path, System::Timer::Epoch now, TLV::TLVReader & reader) const;
+
+    void Clear();
+
+private:
+    struct Entry
+    {
+        app::AttributePathParams mPath;
+        System::Timer::Epoch mReceivedAt = 0;
+        DataVersion mDataVersion         = 0;
+        bool mHasDataVersion             = false;
+        // 0 for a free entry
+        uint16_t mLength = 0;
+        uint8_t mData[CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRY_SIZE];
+    };
+
+    static bool IsCacheable(const app::AttributePathParams & path) { return path.mFlags == app::AttributePathFlags::kFieldIdValid; }
+
+    const Entry * Find(const app::AttributePathParams & path) const;
+    Entry * FindOrEvict(const app::AttributePathParams & path);
+
+    Entry mEntries[CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES];
+    uint32_t mFreshnessMs = 0;
+};
+
+} // namespace Controller
+} // namespace chip
+
+#endif // CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
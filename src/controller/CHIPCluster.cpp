@@ -81,5 +81,49 @@ exit:
     return err;
 }
 
+CHIP_ERROR ClusterBase::AddReadAttribute(AttributeId attributeId, Callback::Cancelable * onReadCallback)
+{
+    VerifyOrReturnError(mDevice != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mDevice->AddReadAttribute(mEndpoint, mClusterId, attributeId, onReadCallback);
+}
+
+BitMapObjectPool<ClusterBase::PendingResponse, CHIP_CONFIG_CONTROLLER_MAX_PENDING_RESPONSES> ClusterBase::PendingResponse::sPool;
+
+ClusterBase::PendingResponse * ClusterBase::PendingResponse::Allocate()
+{
+    PendingResponse * response = sPool.CreateObject();
+    if (response == nullptr)
+    {
+        // The responses whose callbacks were cancelled without being called are only reclaimed when the pool runs out.
+        sPool.ForEachActiveObject([](PendingResponse * abandoned) {
+            if (abandoned->IsAbandoned())
+            {
+                abandoned->Release();
+            }
+            return true;
+        });
+        response = sPool.CreateObject();
+    }
+    return response;
+}
+
+void ClusterBase::PendingResponse::Release()
+{
+    sPool.ReleaseObject(this);
+}
+
+void ClusterBase::PendingResponse::OnFailure(void * context, uint8_t status)
+{
+    PendingResponse * response = static_cast<PendingResponse *>(context);
+    response->mInvoking        = true;
+    response->mFailureHandler(status);
+    response->Release();
+}
+
+bool ClusterBase::PendingResponse::IsAbandoned()
+{
+    return !mInvoking && mSuccessCallback->mCancel == nullptr && !mFailureCallback.IsRegistered();
+}
+
 } // namespace Controller
 } // namespace chip
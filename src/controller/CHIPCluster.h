@@ -27,6 +27,12 @@
 #pragma once
 
 #include <controller/CHIPDevice.h>
+#include <core/CHIPCallback.h>
+#include <support/InlineCallable.h>
+#include <support/Pool.h>
+
+#include <new>
+#include <utility>
 
 namespace chip {
 namespace Controller {
@@ -58,6 +64,38 @@ protected:
     CHIP_ERROR SendCommand(uint8_t seqNum, chip::System::PacketBufferHandle payload, Callback::Cancelable * successHandler,
                            Callback::Cancelable * failureHandler);
 
+    /// Handles the failure of a command, with the status of the response, once.
+    using FailureHandler = InlineCallable<void(uint8_t status)>;
+
+    /**
+     * @brief
+     *   Send the command like the above, with handlers held in a pool of pending responses instead of Callback objects
+     *   owned by the caller. The handler that is called is destroyed once it returns, along with the other one, so the
+     *   captures of the handlers live as long as the response is pending, and no allocation is made per command.
+     *
+     * @param[in] seqNum            The sequence number identifier of the command
+     * @param[in] payload           The payload of the encoded command
+     * @param[in] successHandler    Called with the arguments of the Callback<void (*)(void *, Args...)> of the response
+     * @param[in] failureHandler    Called with the status of a failed response
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY If #CHIP_CONFIG_CONTROLLER_MAX_PENDING_RESPONSES responses are pending.
+     */
+    template <typename... Args>
+    CHIP_ERROR SendCommand(uint8_t seqNum, chip::System::PacketBufferHandle payload, InlineCallable<void(Args...)> successHandler,
+                           FailureHandler failureHandler)
+    {
+        PendingResponse * response = PendingResponse::Create(std::move(successHandler), std::move(failureHandler));
+        VerifyOrReturnError(response != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        CHIP_ERROR err =
+            SendCommand(seqNum, std::move(payload), response->GetSuccessCallback(), response->GetFailureCallback());
+        if (err != CHIP_NO_ERROR)
+        {
+            response->Release();
+        }
+        return err;
+    }
+
     /**
      * @brief
      *   Request attribute reports from the device. Add a callback
@@ -71,9 +109,103 @@ protected:
      */
     CHIP_ERROR RequestAttributeReporting(AttributeId attributeId, Callback::Cancelable * reportHandler);
 
+    /**
+     * @brief
+     *   Add the read of an attribute to the Read Request that the next Device::SendReadAttributes sends
+     *   to the device, along with the reads of the other clusters of the device.
+     *
+     * @param[in] attributeId       The attribute id
+     * @param[in] readHandler       A Callback<ReadAttributeCallback>, called with the data of the attribute
+     */
+    CHIP_ERROR AddReadAttribute(AttributeId attributeId, Callback::Cancelable * readHandler);
+
     const ClusterId mClusterId;
     Device * mDevice;
     EndpointId mEndpoint;
+
+private:
+    /**
+     * The handlers of a command response, with the Callback objects registered for them, which call them through the
+     * same dispatch as the Callback objects of the callers.
+     */
+    class PendingResponse
+    {
+    public:
+        template <typename... Args>
+        static PendingResponse * Create(InlineCallable<void(Args...)> && successHandler, FailureHandler && failureHandler)
+        {
+            static_assert(sizeof(SuccessHandler<Args...>) == sizeof(SuccessHandler<>), "Success handlers differ in size");
+            static_assert(alignof(SuccessHandler<Args...>) == alignof(SuccessHandler<>), "Success handlers differ in alignment");
+
+            PendingResponse * response = Allocate();
+            VerifyOrReturnError(response != nullptr, nullptr);
+
+            SuccessHandler<Args...> * success =
+                new (response->mSuccess) SuccessHandler<Args...>(std::move(successHandler), response);
+            response->mSuccessCallback = success->mCallback.Cancel();
+            response->mDestroySuccess  = DestroySuccess<Args...>;
+            response->mFailureHandler  = std::move(failureHandler);
+            return response;
+        }
+
+        PendingResponse() : mFailureCallback(OnFailure, this) {}
+        ~PendingResponse() { mDestroySuccess(this); }
+
+        Callback::Cancelable * GetSuccessCallback() { return mSuccessCallback; }
+        Callback::Cancelable * GetFailureCallback() { return mFailureCallback.Cancel(); }
+
+        /**
+         * Destroy the handlers, cancelling their Callback objects, and return the response to the pool.
+         */
+        void Release();
+
+    private:
+        using FailureCallbackFn = void (*)(void * context, uint8_t status);
+
+        template <typename... Args>
+        struct SuccessHandler
+        {
+            SuccessHandler(InlineCallable<void(Args...)> && handler, PendingResponse * response) :
+                mHandler(std::move(handler)), mCallback(OnSuccess, response)
+            {}
+
+            static void OnSuccess(void * context, Args... args)
+            {
+                PendingResponse * response = static_cast<PendingResponse *>(context);
+                response->mInvoking        = true;
+                reinterpret_cast<SuccessHandler *>(response->mSuccess)->mHandler(std::forward<Args>(args)...);
+                response->Release();
+            }
+
+            InlineCallable<void(Args...)> mHandler;
+            Callback::Callback<void (*)(void *, Args...)> mCallback;
+        };
+
+        template <typename... Args>
+        static void DestroySuccess(PendingResponse * response)
+        {
+            reinterpret_cast<SuccessHandler<Args...> *>(response->mSuccess)->~SuccessHandler<Args...>();
+        }
+
+        static void OnFailure(void * context, uint8_t status);
+
+        static PendingResponse * Allocate();
+
+        /**
+         * Whether no Callback object of the response is registered any more, and no handler is running, which happens when
+         * the callbacks of the response are cancelled or replaced instead of being called.
+         */
+        bool IsAbandoned();
+
+        alignas(SuccessHandler<>) uint8_t mSuccess[sizeof(SuccessHandler<>)];
+        Callback::Cancelable * mSuccessCallback;
+        void (*mDestroySuccess)(PendingResponse * response);
+        FailureHandler mFailureHandler;
+        Callback::Callback<FailureCallbackFn> mFailureCallback;
+        bool mInvoking = false;
+
+        static BitMapObjectPool<PendingResponse, CHIP_CONFIG_CONTROLLER_MAX_PENDING_RESPONSES> sPool;
+    };
 };
 
 } // namespace Controller
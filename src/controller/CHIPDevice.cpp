@@ -111,6 +111,15 @@ CHIP_ERROR Device::SendMessage(Protocols::Id protocolId, uint8_t msgType, System
     return err;
 }
 
+CHIP_ERROR Device::LoadSecureSession(SecureSessionHandle & session)
+{
+    bool loadedSecureSession = false;
+
+    ReturnErrorOnFailure(LoadSecureSessionParametersIfNeeded(loadedSecureSession));
+    session = mSecureSession;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Device::LoadSecureSessionParametersIfNeeded(bool & didLoad)
 {
     didLoad = false;
@@ -142,11 +151,58 @@ CHIP_ERROR Device::LoadSecureSessionParametersIfNeeded(bool & didLoad)
 CHIP_ERROR Device::SendCommands()
 {
     bool loadedSecureSession = false;
+
+    if (mCommandBatchStarted)
+    {
+        // The command is sent with the rest of the batch.
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(LoadSecureSessionParametersIfNeeded(loadedSecureSession));
     VerifyOrReturnError(mCommandSender != nullptr, CHIP_ERROR_INCORRECT_STATE);
     return mCommandSender->SendCommandRequest(mDeviceId, mAdminId);
 }
 
+CHIP_ERROR Device::StartCommandBatch()
+{
+    VerifyOrReturnError(!mCommandBatchStarted && mOnCommandBatchDoneCallback == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // The responses to the batch are routed by the device, so the command sender is one with the device as its delegate.
+    InitCommandSender(this);
+    VerifyOrReturnError(mCommandSender != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mCommandBatchStarted = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::SendCommandBatch(Callback::Cancelable * onStatusCallback, Callback::Cancelable * onDoneCallback)
+{
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    bool loadedSecureSession = false;
+
+    VerifyOrReturnError(onDoneCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mCommandBatchStarted, CHIP_ERROR_INCORRECT_STATE);
+
+    mCommandBatchStarted = false;
+
+    err = LoadSecureSessionParametersIfNeeded(loadedSecureSession);
+    SuccessOrExit(err);
+    VerifyOrExit(mCommandSender != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    err = mCommandSender->SendCommandRequest(mDeviceId, mAdminId);
+    SuccessOrExit(err);
+
+    mOnCommandStatusCallback    = onStatusCallback;
+    mOnCommandBatchDoneCallback = onDoneCallback;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        // The commands of the batch are dropped with the command sender.
+        InitCommandSender();
+    }
+    return err;
+}
+
 CHIP_ERROR Device::Serialize(SerializedDevice & output)
 {
     CHIP_ERROR error       = CHIP_NO_ERROR;
@@ -404,7 +460,206 @@ void Device::AddReportHandler(EndpointId endpoint, ClusterId cluster, AttributeI
     mCallbacksMgr.AddReportCallback(mDeviceId, endpoint, cluster, attribute, onReportCallback);
 }
 
-void Device::InitCommandSender()
+CHIP_ERROR Device::AddReadAttribute(EndpointId endpoint, ClusterId cluster, AttributeId attribute,
+                                    Callback::Cancelable * onReadCallback)
+{
+    // Field ids are 8 bits.
+    VerifyOrReturnError(attribute <= UINT8_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return AddReadAttribute(app::AttributePathParams(mDeviceId, endpoint, cluster, static_cast<FieldId>(attribute), 0,
+                                                     app::AttributePathFlags::kFieldIdValid),
+                            onReadCallback);
+}
+
+CHIP_ERROR Device::AddReadAttribute(const app::AttributePathParams & path, Callback::Cancelable * onReadCallback)
+{
+    VerifyOrReturnError(onReadCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mReadClient == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mReadAttributeCount < CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES, CHIP_ERROR_NO_MEMORY);
+
+    mReadAttributePaths[mReadAttributeCount]         = path;
+    mReadAttributePaths[mReadAttributeCount].mNodeId = mDeviceId;
+    mReadAttributeCallbacks[mReadAttributeCount]     = onReadCallback;
+    mReadAttributeCount++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::SendReadAttributes(Callback::Cancelable * onDoneCallback)
+{
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    bool loadedSecureSession = false;
+
+    VerifyOrReturnError(onDoneCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mReadClient == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mReadAttributeCount != 0, CHIP_ERROR_INCORRECT_STATE);
+
+    ServeCachedReadAttributes();
+    if (mReadAttributeCount == 0)
+    {
+        Callback::Callback<ReadAttributesDoneCallback> * cb =
+            Callback::Callback<ReadAttributesDoneCallback>::FromCancelable(onDoneCallback);
+        cb->mCall(cb->mContext, CHIP_NO_ERROR);
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(LoadSecureSessionParametersIfNeeded(loadedSecureSession));
+
+    // The ReadClient is only held for the duration of the read, so that the pool of the engine is shared by all
+    // the devices.
+    ReturnErrorOnFailure(chip::app::InteractionModelEngine::GetInstance()->NewReadClient(&mReadClient, this));
+    err = mReadClient->SendReadRequest(mDeviceId, mAdminId, nullptr, 0, mReadAttributePaths, mReadAttributeCount);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The reads stay added, for the request to be sent again.
+        mReadClient->Shutdown();
+        mReadClient = nullptr;
+        return err;
+    }
+
+    mOnReadDoneCallback = onDoneCallback;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::AttributeDataReceived(const app::ReadClient * apReadClient,
+                                         const app::AttributePathParams & aAttributePathParams, TLV::TLVReader & aReader)
+{
+    VerifyOrReturnError(apReadClient == mReadClient, CHIP_ERROR_INCORRECT_STATE);
+
+#if CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
+    DataVersion dataVersion;
+    mAttributeCache.Put(aAttributePathParams,
+                        (apReadClient->GetAttributeDataVersion(dataVersion) == CHIP_NO_ERROR) ? &dataVersion : nullptr, aReader,
+                        System::Timer::GetCurrentEpoch());
+#endif
+
+    for (size_t i = 0; i < mReadAttributeCount; i++)
+    {
+        if (!mReadAttributePaths[i].Covers(aAttributePathParams))
+        {
+            continue;
+        }
+
+        // Every callback gets a reader of its own in case the same attribute was added more than once.
+        TLV::TLVReader reader = aReader;
+        Callback::Callback<ReadAttributeCallback> * cb =
+            Callback::Callback<ReadAttributeCallback>::FromCancelable(mReadAttributeCallbacks[i]);
+        cb->mCall(cb->mContext, aAttributePathParams, reader);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::ReportProcessed(const app::ReadClient * apReadClient)
+{
+    VerifyOrReturnError(apReadClient == mReadClient, CHIP_ERROR_INCORRECT_STATE);
+    ReadAttributesDone(CHIP_NO_ERROR);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::ReportError(const app::ReadClient * apReadClient, CHIP_ERROR aError)
+{
+    VerifyOrReturnError(apReadClient == mReadClient, CHIP_ERROR_INCORRECT_STATE);
+    ReadAttributesDone(aError);
+    return CHIP_NO_ERROR;
+}
+
+void Device::ServeCachedReadAttributes()
+{
+#if CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
+    System::Timer::Epoch now = System::Timer::GetCurrentEpoch();
+    size_t count             = 0;
+
+    VerifyOrReturn(mAttributeCache.IsEnabled());
+
+    // The reads served from the cache are removed, the others are kept in order for the request.
+    for (size_t i = 0; i < mReadAttributeCount; i++)
+    {
+        TLV::TLVReader reader;
+        if (mAttributeCache.Get(mReadAttributePaths[i], now, reader) == CHIP_NO_ERROR)
+        {
+            Callback::Callback<ReadAttributeCallback> * cb =
+                Callback::Callback<ReadAttributeCallback>::FromCancelable(mReadAttributeCallbacks[i]);
+            cb->mCall(cb->mContext, mReadAttributePaths[i], reader);
+            continue;
+        }
+
+        mReadAttributePaths[count]     = mReadAttributePaths[i];
+        mReadAttributeCallbacks[count] = mReadAttributeCallbacks[i];
+        count++;
+    }
+    mReadAttributeCount = count;
+#endif // CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
+}
+
+void Device::ReadAttributesDone(CHIP_ERROR error)
+{
+    Callback::Callback<ReadAttributesDoneCallback> * cb =
+        Callback::Callback<ReadAttributesDoneCallback>::FromCancelable(mOnReadDoneCallback);
+
+    // Done before the callback, which may add reads and send them.
+    mReadClient->Shutdown();
+    mReadClient         = nullptr;
+    mOnReadDoneCallback = nullptr;
+    mReadAttributeCount = 0;
+
+    cb->mCall(cb->mContext, error);
+}
+
+CHIP_ERROR Device::CommandResponseStatus(const app::CommandSender * apCommandSender,
+                                         const Protocols::SecureChannel::GeneralStatusCode aGeneralCode, const uint32_t aProtocolId,
+                                         const uint16_t aProtocolCode, EndpointId aEndpointId, const ClusterId aClusterId,
+                                         CommandId aCommandId, uint8_t aCommandIndex)
+{
+    VerifyOrReturnError(apCommandSender == mCommandSender, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mOnCommandStatusCallback != nullptr)
+    {
+        app::CommandPathParams path(aEndpointId, /* group id */ 0, aClusterId, aCommandId, app::CommandPathFlags::kEndpointIdValid);
+        Callback::Callback<CommandStatusCallback> * cb =
+            Callback::Callback<CommandStatusCallback>::FromCancelable(mOnCommandStatusCallback);
+        cb->mCall(cb->mContext, path, aCommandIndex, aGeneralCode, aProtocolId, aProtocolCode);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::CommandResponseProtocolError(const app::CommandSender * apCommandSender, uint8_t aCommandIndex)
+{
+    ChipLogError(Controller, "Failed to process the response %u to a command batch", aCommandIndex);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::CommandResponseProcessed(const app::CommandSender * apCommandSender)
+{
+    VerifyOrReturnError(apCommandSender == mCommandSender, CHIP_ERROR_INCORRECT_STATE);
+    CommandBatchDone(CHIP_NO_ERROR);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::CommandResponseError(const app::CommandSender * apCommandSender, CHIP_ERROR aError)
+{
+    VerifyOrReturnError(apCommandSender == mCommandSender, CHIP_ERROR_INCORRECT_STATE);
+    CommandBatchDone(aError);
+    return CHIP_NO_ERROR;
+}
+
+void Device::CommandBatchDone(CHIP_ERROR error)
+{
+    Callback::Callback<CommandBatchDoneCallback> * cb =
+        Callback::Callback<CommandBatchDoneCallback>::FromCancelable(mOnCommandBatchDoneCallback);
+
+    VerifyOrReturn(cb != nullptr);
+
+    mOnCommandStatusCallback    = nullptr;
+    mOnCommandBatchDoneCallback = nullptr;
+
+    // The commands sent after the batch go back to the command sender of the InteractionModelEngine delegate.
+    InitCommandSender();
+
+    cb->mCall(cb->mContext, error);
+}
+
+void Device::InitCommandSender(app::InteractionModelDelegate * delegate)
 {
     if (mCommandSender != nullptr)
     {
@@ -412,7 +667,7 @@ void Device::InitCommandSender()
         mCommandSender = nullptr;
     }
 #if CHIP_ENABLE_INTERACTION_MODEL
-    CHIP_ERROR err = chip::app::InteractionModelEngine::GetInstance()->NewCommandSender(&mCommandSender);
+    CHIP_ERROR err = chip::app::InteractionModelEngine::GetInstance()->NewCommandSender(&mCommandSender, delegate);
     ChipLogFunctError(err);
 #endif
 }
@@ -30,6 +30,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/util/CHIPDeviceCallbacksMgr.h>
 #include <app/util/basic-types.h>
+#include <controller/AttributeCache.h>
 #include <core/CHIPCallback.h>
 #include <core/CHIPCore.h>
 #include <messaging/ExchangeContext.h>
@@ -58,6 +59,17 @@ struct SerializedDevice;
 
 constexpr size_t kMaxBlePendingPackets = 1;
 
+/// Called with the data of an attribute read by Device::SendReadAttributes, through a Callback<ReadAttributeCallback>.
+typedef void (*ReadAttributeCallback)(void * context, const app::AttributePathParams & path, TLV::TLVReader & data);
+/// Called once a Read Request sent by Device::SendReadAttributes is done, with the error if it failed.
+typedef void (*ReadAttributesDoneCallback)(void * context, CHIP_ERROR error);
+/// Called with the status the device answered a command of a batch sent by Device::SendCommandBatch with.
+typedef void (*CommandStatusCallback)(void * context, const app::CommandPathParams & path, uint8_t commandIndex,
+                                      Protocols::SecureChannel::GeneralStatusCode generalCode, uint32_t protocolId,
+                                      uint16_t protocolCode);
+/// Called once the Invoke Command Request sent by Device::SendCommandBatch is done, with the error if it failed.
+typedef void (*CommandBatchDoneCallback)(void * context, CHIP_ERROR error);
+
 using DeviceTransportMgr = TransportMgr<Transport::UDP /* IPv6 */
 #if INET_CONFIG_ENABLE_IPV4
                                         ,
@@ -78,9 +90,11 @@ struct ControllerDeviceInitParams
 #if CONFIG_NETWORK_LAYER_BLE
     Ble::BleLayer * bleLayer = nullptr;
 #endif
+    /// How long the values of the attribute cache are served, 0 to always read attributes from the device.
+    uint32_t attributeCacheFreshnessMs = 0;
 };
 
-class DLL_EXPORT Device : public Messaging::ExchangeDelegate
+class DLL_EXPORT Device : public Messaging::ExchangeDelegate, public app::InteractionModelDelegate
 {
 public:
     ~Device()
@@ -98,6 +112,12 @@ public:
             mCommandSender->Shutdown();
             mCommandSender = nullptr;
         }
+
+        if (mReadClient != nullptr)
+        {
+            mReadClient->Shutdown();
+            mReadClient = nullptr;
+        }
     }
 
     enum class PairingWindowOption
@@ -132,12 +152,81 @@ public:
 
     /**
      * @brief
-     *   Send the command in internal command sender.
+     *   Establish the secure session with the device if needed, to run over it protocols the device object does not
+     *   implement, e.g. Echo, with exchanges opened on GetExchangeManager().
+     *
+     * @param[out] session  The session with the device
+     */
+    CHIP_ERROR LoadSecureSession(SecureSessionHandle & session);
+
+    Messaging::ExchangeManager * GetExchangeManager() const { return mExchangeMgr; }
+
+    /**
+     * @brief
+     *   Send the command in internal command sender. Between StartCommandBatch and SendCommandBatch, the command is
+     *   kept for the batch instead.
      */
     CHIP_ERROR SendCommands();
 
+    /**
+     * @brief
+     *   Start a batch of commands: the commands of the clusters of the device are then put in the same Invoke Command
+     *   Request, sent by SendCommandBatch, instead of a request each. The device answers all of them in a single response.
+     */
+    CHIP_ERROR StartCommandBatch();
+
+    /**
+     * @brief
+     *   Send the commands of the batch started by StartCommandBatch in a single Invoke Command Request. The status of
+     *   every command the device answers with one is passed to onStatusCallback, a Callback<CommandStatusCallback>, with
+     *   the path of the command and the index of the response in the batch, from 1; the responses carrying data go to the
+     *   callbacks of their cluster, as for a single command. onDoneCallback, a Callback<CommandBatchDoneCallback>, is called
+     *   once the response has been processed, or the request failed. No batch can be started until then.
+     *
+     * @param[in] onStatusCallback  The handler of the status responses, may be nullptr
+     * @param[in] onDoneCallback    The handler called once the batch is done
+     */
+    CHIP_ERROR SendCommandBatch(Callback::Cancelable * onStatusCallback, Callback::Cancelable * onDoneCallback);
+
     app::CommandSender * GetCommandSender() { return mCommandSender; }
 
+    /**
+     * @brief
+     *   Add the read of an attribute to the Read Request sent by the next SendReadAttributes. The attributes of
+     *   any endpoints and clusters of the device can be read by the same request.
+     *
+     * @param[in] endpoint        The endpoint of the attribute
+     * @param[in] cluster         The cluster of the attribute
+     * @param[in] attribute       The attribute id
+     * @param[in] onReadCallback  A Callback<ReadAttributeCallback>, called with the data of the attribute
+     *
+     * @return CHIP_ERROR   CHIP_ERROR_NO_MEMORY if CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES reads were already added
+     */
+    CHIP_ERROR AddReadAttribute(EndpointId endpoint, ClusterId cluster, AttributeId attribute,
+                                Callback::Cancelable * onReadCallback);
+
+    /**
+     * @brief
+     *   Add the read of the attributes of a path, which may be a wildcard path, for instance to read every attribute of
+     *   a cluster on every endpoint. The callback is called for every attribute in the response that the path covers.
+     *   The node id of the path is the one of the device.
+     */
+    CHIP_ERROR AddReadAttribute(const app::AttributePathParams & path, Callback::Cancelable * onReadCallback);
+
+    /**
+     * @brief
+     *   Send the attribute reads added by AddReadAttribute in a single Read Request. The data of every attribute
+     *   in the response is passed to the callback of its path, then onDoneCallback, a Callback<ReadAttributesDoneCallback>,
+     *   is called. The attributes missing from the response get no call. No reads can be added until onDoneCallback is called.
+     *
+     *   With the attribute cache enabled, the reads of concrete paths whose values were received within the freshness
+     *   bound are served from the cache before the request is sent, and onDoneCallback is called right away when no read
+     *   is left to send.
+     *
+     * @param[in] onDoneCallback  The handler called once the response has been processed, or the read failed
+     */
+    CHIP_ERROR SendReadAttributes(Callback::Cancelable * onDoneCallback);
+
     /**
      * @brief Get the IP address and port assigned to the device.
      *
@@ -175,6 +264,10 @@ public:
 #if CONFIG_NETWORK_LAYER_BLE
         mBleLayer = params.bleLayer;
 #endif
+#if CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
+        mAttributeCache.Clear();
+        mAttributeCache.SetFreshness(params.attributeCacheFreshnessMs);
+#endif
 
 #if CHIP_ENABLE_INTERACTION_MODEL
         InitCommandSender();
@@ -371,6 +464,20 @@ private:
 
     app::CommandSender * mCommandSender = nullptr;
 
+    bool mCommandBatchStarted                          = false;
+    Callback::Cancelable * mOnCommandStatusCallback    = nullptr;
+    Callback::Cancelable * mOnCommandBatchDoneCallback = nullptr;
+
+    app::ReadClient * mReadClient              = nullptr;
+    Callback::Cancelable * mOnReadDoneCallback = nullptr;
+    app::AttributePathParams mReadAttributePaths[CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES];
+    Callback::Cancelable * mReadAttributeCallbacks[CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES];
+    size_t mReadAttributeCount = 0;
+
+#if CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES > 0
+    AttributeCache mAttributeCache;
+#endif
+
     SecureSessionHandle mSecureSession = {};
 
     uint8_t mSequenceNumber = 0;
@@ -401,8 +508,36 @@ private:
      * @brief
      *   Initialize internal command sender, required for sending commands over interaction model.
      *   It's safe to call InitCommandSender multiple times, but only one will be available.
+     *
+     * @param[in] delegate   The delegate of the command sender, the one of the InteractionModelEngine if nullptr
+     */
+    void InitCommandSender(app::InteractionModelDelegate * delegate = nullptr);
+
+    /**
+     * @brief
+     *   InteractionModelDelegate implementation for the ReadClient of SendReadAttributes.
+     */
+    CHIP_ERROR AttributeDataReceived(const app::ReadClient * apReadClient, const app::AttributePathParams & aAttributePathParams,
+                                     TLV::TLVReader & aReader) override;
+    CHIP_ERROR ReportProcessed(const app::ReadClient * apReadClient) override;
+    CHIP_ERROR ReportError(const app::ReadClient * apReadClient, CHIP_ERROR aError) override;
+
+    void ReadAttributesDone(CHIP_ERROR error);
+    void ServeCachedReadAttributes();
+
+    /**
+     * @brief
+     *   InteractionModelDelegate implementation for the CommandSender of SendCommandBatch.
      */
-    void InitCommandSender();
+    CHIP_ERROR CommandResponseStatus(const app::CommandSender * apCommandSender,
+                                     const Protocols::SecureChannel::GeneralStatusCode aGeneralCode, const uint32_t aProtocolId,
+                                     const uint16_t aProtocolCode, EndpointId aEndpointId, const ClusterId aClusterId,
+                                     CommandId aCommandId, uint8_t aCommandIndex) override;
+    CHIP_ERROR CommandResponseProtocolError(const app::CommandSender * apCommandSender, uint8_t aCommandIndex) override;
+    CHIP_ERROR CommandResponseProcessed(const app::CommandSender * apCommandSender) override;
+    CHIP_ERROR CommandResponseError(const app::CommandSender * apCommandSender, CHIP_ERROR aError) override;
+
+    void CommandBatchDone(CHIP_ERROR error);
 
     uint16_t mListenPort;
 
@@ -49,6 +49,7 @@
 #include <support/CHIPMem.h>
 #include <support/CodeUtils.h>
 #include <support/ErrorStr.h>
+#include <support/RandUtils.h>
 #include <support/SafeInt.h>
 #include <support/TimeUtils.h>
 #include <support/logging/CHIPLogging.h>
@@ -58,6 +59,7 @@
 #include <transport/raw/BLE.h>
 #endif
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 #include <stdint.h>
@@ -72,9 +74,8 @@ namespace Controller {
 
 using namespace chip::Encoding;
 
-constexpr const char kPairedDeviceListKeyPrefix[] = "ListPairedDevices";
-constexpr const char kPairedDeviceKeyPrefix[]     = "PairedDevice";
-constexpr const char kNextAvailableKeyID[]        = "StartKeyID";
+constexpr const char kPairedDeviceKeyPrefix[] = "PairedDevice";
+constexpr const char kNextAvailableKeyID[]    = "StartKeyID";
 
 #if CHIP_DEVICE_CONFIG_ENABLE_MDNS
 constexpr uint16_t kMdnsPort = 5353;
@@ -103,8 +104,15 @@ DeviceController::DeviceController()
     mExchangeMgr              = nullptr;
     mLocalDeviceId            = 0;
     mStorageDelegate          = nullptr;
-    mPairedDevicesInitialized = false;
     mListenPort               = CHIP_PORT;
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
+    {
+        mIndexedDeviceIds[i] = kUndefinedNodeId;
+        mDeviceLastUsed[i]   = 0;
+    }
+    mDeviceCacheStats = {};
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
 }
 
 CHIP_ERROR DeviceController::Init(NodeId localDeviceId, ControllerInitParams params)
@@ -134,7 +142,8 @@ CHIP_ERROR DeviceController::Init(NodeId localDeviceId, ControllerInitParams par
     VerifyOrExit(mSystemLayer != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(mInetLayer != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
 
-    mStorageDelegate = params.storageDelegate;
+    mStorageDelegate           = params.storageDelegate;
+    mAttributeCacheFreshnessMs = params.attributeCacheFreshnessMs;
 #if CONFIG_NETWORK_LAYER_BLE
 #if CONFIG_DEVICE_LAYER
     if (params.bleLayer == nullptr)
@@ -211,6 +220,10 @@ CHIP_ERROR DeviceController::Shutdown()
 
     mState = State::NotInitialized;
 
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
+    FinishPrewarm(false);
+#endif
+
 #if CONFIG_DEVICE_LAYER
     ReturnErrorOnFailure(DeviceLayer::PlatformMgr().Shutdown());
 #else
@@ -277,10 +290,16 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, const SerializedDevice &
     if (index < kNumMaxActiveDevices)
     {
         device = &mActiveDevices[index];
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+        mDeviceCacheStats.mHits++;
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
     }
     else
     {
-        VerifyOrReturnError(mPairedDevices.Contains(deviceId), CHIP_ERROR_NOT_CONNECTED);
+        VerifyOrReturnError(IsPairedDevice(deviceId), CHIP_ERROR_NOT_CONNECTED);
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+        mDeviceCacheStats.mMisses++;
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
 
         index = GetInactiveDeviceIndex();
         VerifyOrReturnError(index < kNumMaxActiveDevices, CHIP_ERROR_NO_MEMORY);
@@ -294,8 +313,12 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, const SerializedDevice &
         }
 
         device->Init(GetControllerDeviceInitParams(), mListenPort, mAdminId);
+        AddToDeviceIndex(index);
     }
 
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    TouchDevice(index);
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
     *out_device = device;
     return CHIP_NO_ERROR;
 }
@@ -312,13 +335,16 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
     if (index < kNumMaxActiveDevices)
     {
         device = &mActiveDevices[index];
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+        mDeviceCacheStats.mHits++;
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
     }
     else
     {
-        err = InitializePairedDeviceList();
-        SuccessOrExit(err);
-
-        VerifyOrExit(mPairedDevices.Contains(deviceId), err = CHIP_ERROR_NOT_CONNECTED);
+        VerifyOrExit(mStorageDelegate != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+        mDeviceCacheStats.mMisses++;
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
 
         index = GetInactiveDeviceIndex();
         VerifyOrExit(index < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
@@ -328,8 +354,10 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
             SerializedDevice deviceInfo;
             uint16_t size = sizeof(deviceInfo.inner);
 
+            // Only the paired devices have a record.
             PERSISTENT_KEY_OP(deviceId, kPairedDeviceKeyPrefix, key,
                               err = mStorageDelegate->SyncGetKeyValue(key, deviceInfo.inner, size));
+            VerifyOrExit(err != CHIP_ERROR_KEY_NOT_FOUND, err = CHIP_ERROR_NOT_CONNECTED);
             SuccessOrExit(err);
             VerifyOrExit(size <= sizeof(deviceInfo.inner), err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
 
@@ -337,9 +365,13 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
             VerifyOrExit(err == CHIP_NO_ERROR, ReleaseDevice(device));
 
             device->Init(GetControllerDeviceInitParams(), mListenPort, mAdminId);
+            AddToDeviceIndex(index);
         }
     }
 
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    TouchDevice(index);
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
     *out_device = device;
 
 exit:
@@ -419,6 +451,9 @@ void DeviceController::OnMessageReceived(Messaging::ExchangeContext * ec, const
     VerifyOrExit(index < kNumMaxActiveDevices, ChipLogError(Controller, "OnMessageReceived was called for unknown device object"));
 
     needClose = false; // Device will handle it
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    TouchDevice(index);
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
     mActiveDevices[index].OnMessageReceived(ec, packetHeader, payloadHeader, std::move(msgBuf));
 
 exit:
@@ -460,6 +495,12 @@ uint16_t DeviceController::GetInactiveDeviceIndex()
     uint16_t i = 0;
     while (i < kNumMaxActiveDevices && mActiveDevices[i].IsActive())
         i++;
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    if (i == kNumMaxActiveDevices)
+    {
+        i = EvictLeastRecentlyUsedDevice();
+    }
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
     if (i < kNumMaxActiveDevices)
     {
         mActiveDevices[i].SetActive(true);
@@ -468,8 +509,63 @@ uint16_t DeviceController::GetInactiveDeviceIndex()
     return i;
 }
 
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+uint16_t DeviceController::EvictLeastRecentlyUsedDevice()
+{
+    uint16_t victim = kNumMaxActiveDevices;
+
+    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
+    {
+        if (CanEvictDevice(i) && (victim == kNumMaxActiveDevices || mDeviceLastUsed[i] < mDeviceLastUsed[victim]))
+        {
+            victim = i;
+        }
+    }
+
+    if (victim < kNumMaxActiveDevices)
+    {
+        ChipLogDetail(Controller, "Evicting device 0x%" PRIx64 " from the device cache", mActiveDevices[victim].GetDeviceId());
+        PersistDevice(&mActiveDevices[victim]);
+        ReleaseDevice(&mActiveDevices[victim]);
+        mDeviceCacheStats.mEvictions++;
+    }
+
+    return victim;
+}
+
+bool DeviceController::CanEvictDevice(uint16_t index)
+{
+    // Every active device but those being paired was loaded from its record, or persisted once paired.
+    return mStorageDelegate != nullptr && mActiveDevices[index].IsActive();
+}
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+
+void DeviceController::AddToDeviceIndex(uint16_t index)
+{
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    RemoveFromDeviceIndex(index);
+    mIndexedDeviceIds[index] = mActiveDevices[index].GetDeviceId();
+    mDeviceIdIndex.Insert(index, mIndexedDeviceIds[index]);
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+}
+
+void DeviceController::RemoveFromDeviceIndex(uint16_t index)
+{
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    if (mIndexedDeviceIds[index] != kUndefinedNodeId)
+    {
+        mDeviceIdIndex.Remove(index, mIndexedDeviceIds[index]);
+        mIndexedDeviceIds[index] = kUndefinedNodeId;
+    }
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+}
+
 void DeviceController::ReleaseDevice(Device * device)
 {
+    if (device >= mActiveDevices && device < mActiveDevices + kNumMaxActiveDevices)
+    {
+        RemoveFromDeviceIndex(static_cast<uint16_t>(device - mActiveDevices));
+    }
     device->Reset();
 }
 
@@ -516,78 +612,36 @@ uint16_t DeviceController::FindDeviceIndex(SecureSessionHandle session)
 
 uint16_t DeviceController::FindDeviceIndex(NodeId id)
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices)
-    {
-        if (mActiveDevices[i].IsActive() && mActiveDevices[i].GetDeviceId() == id)
-        {
-            return i;
-        }
-        i++;
-    }
-    return i;
+    return static_cast<uint16_t>(mDeviceIdIndex.FindFirst(id, 0, [this, id](size_t slot) {
+        return mActiveDevices[slot].IsActive() && mActiveDevices[slot].GetDeviceId() == id;
+    }));
 }
 
 CHIP_ERROR DeviceController::InitializePairedDeviceList()
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    char * buffer  = nullptr;
+    VerifyOrReturnError(mStorageDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mPairedDevices.IsInitialized(), CHIP_NO_ERROR);
 
-    VerifyOrExit(mStorageDelegate != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
-
-    if (!mPairedDevicesInitialized)
-    {
-        constexpr uint16_t max_size = CHIP_MAX_SERIALIZED_SIZE_U64(kNumMaxPairedDevices);
-        buffer                      = static_cast<char *>(chip::Platform::MemoryAlloc(max_size));
-        uint16_t size               = max_size;
-
-        VerifyOrExit(buffer != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
+    return mPairedDevices.Init(mStorageDelegate);
+}
 
-        CHIP_ERROR lookupError = CHIP_NO_ERROR;
-        PERSISTENT_KEY_OP(static_cast<uint64_t>(0), kPairedDeviceListKeyPrefix, key,
-                          lookupError = mStorageDelegate->SyncGetKeyValue(key, buffer, size));
+bool DeviceController::IsPairedDevice(NodeId deviceId)
+{
+    CHIP_ERROR err = CHIP_ERROR_KEY_NOT_FOUND;
+    uint8_t probe[1];
+    uint16_t size = sizeof(probe);
 
-        // It's ok to not have an entry for the Paired Device list. We treat it the same as having an empty list.
-        if (lookupError != CHIP_ERROR_KEY_NOT_FOUND)
-        {
-            VerifyOrExit(size <= max_size, err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
-            err = SetPairedDeviceList(buffer);
-            SuccessOrExit(err);
-        }
-    }
+    VerifyOrReturnError(mStorageDelegate != nullptr, false);
 
-exit:
-    if (buffer != nullptr)
-    {
-        chip::Platform::MemoryFree(buffer);
-    }
-    if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(Controller, "Failed to initialize the device list\n");
-    }
-
-    return err;
+    // The record is larger than the probe, which only tells whether it exists.
+    PERSISTENT_KEY_OP(deviceId, kPairedDeviceKeyPrefix, key, err = mStorageDelegate->SyncGetKeyValue(key, probe, size));
+    return err != CHIP_ERROR_KEY_NOT_FOUND;
 }
 
-CHIP_ERROR DeviceController::SetPairedDeviceList(const char * serialized)
+CHIP_ERROR DeviceController::ForEachPairedDevice(PairedDeviceIndex::Visitor visitor, void * context)
 {
-    CHIP_ERROR err  = CHIP_NO_ERROR;
-    size_t len      = strlen(serialized) + 1;
-    uint16_t lenU16 = static_cast<uint16_t>(len);
-    VerifyOrExit(CanCastTo<uint16_t>(len), err = CHIP_ERROR_INVALID_ARGUMENT);
-    err = mPairedDevices.DeserializeBase64(serialized, lenU16);
-
-exit:
-    if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(Controller, "Failed to recreate the device list\n");
-    }
-    else
-    {
-        mPairedDevicesInitialized = true;
-    }
-
-    return err;
+    ReturnErrorOnFailure(InitializePairedDeviceList());
+    return mPairedDevices.ForEach(visitor, context);
 }
 
 #if CHIP_DEVICE_CONFIG_ENABLE_MDNS
@@ -605,10 +659,7 @@ void DeviceController::OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & nod
     PersistDevice(device);
 
 exit:
-    if (mDeviceAddressUpdateDelegate != nullptr)
-    {
-        mDeviceAddressUpdateDelegate->OnAddressUpdateComplete(nodeData.mPeerId.GetNodeId(), err);
-    }
+    NotifyAddressUpdate(nodeData.mPeerId.GetNodeId(), err);
     return;
 };
 
@@ -616,25 +667,149 @@ void DeviceController::OnNodeIdResolutionFailed(const chip::PeerId & peer, CHIP_
 {
     ChipLogError(Controller, "Error resolving node id: %s", ErrorStr(error));
 
+    NotifyAddressUpdate(peer.GetNodeId(), error);
+};
+
+void DeviceController::NotifyAddressUpdate(NodeId nodeId, CHIP_ERROR error)
+{
+#if CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
+    // The updates of prewarmed devices are delivered together when the prewarm finishes.
+    if (CompletePrewarmResolution(nodeId, error))
+    {
+        return;
+    }
+#endif // CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
+
     if (mDeviceAddressUpdateDelegate != nullptr)
     {
-        mDeviceAddressUpdateDelegate->OnAddressUpdateComplete(peer.GetNodeId(), error);
+        mDeviceAddressUpdateDelegate->OnAddressUpdateComplete(nodeId, error);
     }
-};
+}
+
+#if CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
+CHIP_ERROR DeviceController::PrewarmDevices(uint64_t fabricId)
+{
+    VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceAddressUpdateDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mPrewarming, CHIP_ERROR_INCORRECT_STATE);
+
+    mPrewarmCount = 0;
+    ReturnErrorOnFailure(ForEachPairedDevice(AddPrewarmDevice, this));
+    if (mPrewarmCount == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(Mdns::Resolver::Instance().StartResolver(mInetLayer, kMdnsPort));
+    ReturnErrorOnFailure(mSystemLayer->StartTimer(CHIP_CONFIG_CONTROLLER_PREWARM_TIMEOUT_MS, OnPrewarmTimeout, this));
+
+    ChipLogProgress(Controller, "Prewarming %u paired devices", mPrewarmCount);
+
+    mPrewarmFabricId = fabricId;
+    mPrewarmNext     = 0;
+    mPrewarmPending  = mPrewarmCount;
+    mPrewarmInFlight = 0;
+    mPrewarming      = true;
+    StartPrewarmResolutions();
+    return CHIP_NO_ERROR;
+}
+
+bool DeviceController::AddPrewarmDevice(void * context, NodeId deviceId)
+{
+    DeviceController * controller = static_cast<DeviceController *>(context);
+
+    controller->mPrewarmUpdates[controller->mPrewarmCount] = { deviceId, CHIP_ERROR_TIMEOUT };
+    controller->mPrewarmDone[controller->mPrewarmCount]    = false;
+    controller->mPrewarmCount++;
+    return controller->mPrewarmCount < kNumMaxPrewarmDevices;
+}
+
+void DeviceController::StartPrewarmResolutions()
+{
+    // A resolution may complete before ResolveNodeId returns, so the next entry is claimed before starting it.
+    while (mPrewarming && mPrewarmNext < mPrewarmCount && mPrewarmInFlight < CHIP_CONFIG_CONTROLLER_PREWARM_CONCURRENCY)
+    {
+        uint16_t index = mPrewarmNext++;
+        mPrewarmInFlight++;
+
+        CHIP_ERROR err = Mdns::Resolver::Instance().ResolveNodeId(
+            chip::PeerId().SetNodeId(mPrewarmUpdates[index].nodeId).SetFabricId(mPrewarmFabricId), chip::Inet::kIPAddressType_Any);
+        if (err != CHIP_NO_ERROR)
+        {
+            CompletePrewarmResolution(mPrewarmUpdates[index].nodeId, err);
+        }
+    }
+}
+
+bool DeviceController::CompletePrewarmResolution(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturnError(mPrewarming, false);
+
+    for (uint16_t i = 0; i < mPrewarmNext; i++)
+    {
+        if (mPrewarmUpdates[i].nodeId == deviceId && !mPrewarmDone[i])
+        {
+            mPrewarmUpdates[i].error = error;
+            mPrewarmDone[i]          = true;
+            mPrewarmInFlight--;
+            mPrewarmPending--;
+
+            if (mPrewarmPending == 0)
+            {
+                FinishPrewarm(true);
+            }
+            else
+            {
+                StartPrewarmResolutions();
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DeviceController::FinishPrewarm(bool notify)
+{
+    VerifyOrReturn(mPrewarming);
+
+    mPrewarming = false;
+    mSystemLayer->CancelTimer(OnPrewarmTimeout, this);
+
+    if (notify && mDeviceAddressUpdateDelegate != nullptr)
+    {
+        mDeviceAddressUpdateDelegate->OnAddressUpdatesComplete(mPrewarmUpdates, mPrewarmCount);
+    }
+}
+
+void DeviceController::OnPrewarmTimeout(System::Layer * aLayer, void * aAppState, System::Error aError)
+{
+    DeviceController * controller = static_cast<DeviceController *>(aAppState);
+
+    // The devices not resolved yet keep the CHIP_ERROR_TIMEOUT they were added with.
+    ChipLogError(Controller, "Timed out prewarming %u of %u devices", controller->mPrewarmPending, controller->mPrewarmCount);
+    controller->FinishPrewarm(true);
+}
+#endif // CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
 #endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS
 
 ControllerDeviceInitParams DeviceController::GetControllerDeviceInitParams()
 {
-    return ControllerDeviceInitParams{
+    ControllerDeviceInitParams params{
         .transportMgr = mTransportMgr, .sessionMgr = mSessionMgr, .exchangeMgr = mExchangeMgr, .inetLayer = mInetLayer
     };
+    params.attributeCacheFreshnessMs = mAttributeCacheFreshnessMs;
+    return params;
 }
 
 DeviceCommissioner::DeviceCommissioner()
 {
-    mPairingDelegate      = nullptr;
-    mDeviceBeingPaired    = kNumMaxActiveDevices;
-    mPairedDevicesUpdated = false;
+    mPairingDelegate = nullptr;
+
+    for (PairingSlot & slot : mPairingSlots)
+    {
+        slot.mCommissioner = this;
+    }
 }
 
 CHIP_ERROR DeviceCommissioner::Init(NodeId localDeviceId, CommissionerInitParams params)
@@ -648,6 +823,16 @@ CHIP_ERROR DeviceCommissioner::Init(NodeId localDeviceId, CommissionerInitParams
         mNextKeyId = 0;
     }
 
+    if (params.cryptoWorkerThreadCount > 0)
+    {
+        ReturnErrorOnFailure(mCryptoWorkerPool.Init(mSystemLayer, params.cryptoWorkerThreadCount));
+
+        for (PairingSlot & slot : mPairingSlots)
+        {
+            slot.mPairingSession.SetCryptoWorkerPool(&mCryptoWorkerPool);
+        }
+    }
+
     mPairingDelegate = params.pairingDelegate;
     return CHIP_NO_ERROR;
 }
@@ -658,10 +843,21 @@ CHIP_ERROR DeviceCommissioner::Shutdown()
 
     ChipLogDetail(Controller, "Shutting down the commissioner");
 
-    PersistDeviceList();
+    for (PairingSlot & slot : mPairingSlots)
+    {
+        if (slot.IsInUse())
+        {
+            mSystemLayer->CancelTimer(OnSessionEstablishmentTimeoutCallback, &slot);
+            mSystemLayer->CancelTimer(OnPairingRetryCallback, &slot);
+            slot.mPairingSession.Clear();
+            slot.mDeviceBeingPaired = kNumMaxActiveDevices;
+        }
+    }
 
     FreeRendezvousSession();
 
+    mCryptoWorkerPool.Shutdown();
+
     DeviceController::Shutdown();
     return CHIP_NO_ERROR;
 }
@@ -670,6 +866,8 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
 {
     CHIP_ERROR err                     = CHIP_NO_ERROR;
     Device * device                    = nullptr;
+    PairingSlot * slot                 = nullptr;
+    bool isIPRendezvous                = false;
     Transport::PeerAddress peerAddress = Transport::PeerAddress::UDP(Inet::IPAddress::Any);
 
     Messaging::ExchangeContext * exchangeCtxt = nullptr;
@@ -678,7 +876,7 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
 
     VerifyOrExit(remoteDeviceId != kAnyNodeId && remoteDeviceId != kUndefinedNodeId, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(FindPairingSlot(remoteDeviceId) == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(admin != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     err = InitializePairedDeviceList();
@@ -705,19 +903,39 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
                                                   params.GetPeerAddress().GetInterface());
     }
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    isIPRendezvous = (params.GetPeerAddress().GetTransportType() != Transport::Type::kBle);
 
-    mIsIPRendezvous = (params.GetPeerAddress().GetTransportType() != Transport::Type::kBle);
+    // Take a free pairing slot. BLE connections are not told apart, so only one device can be paired over BLE at a time.
+    for (PairingSlot & candidate : mPairingSlots)
+    {
+        if (candidate.IsInUse())
+        {
+            VerifyOrExit(candidate.mIsIPRendezvous || isIPRendezvous, err = CHIP_ERROR_INCORRECT_STATE);
+        }
+        else if (slot == nullptr)
+        {
+            slot = &candidate;
+        }
+    }
+    VerifyOrExit(slot != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    err = mPairingSession.MessageDispatch().Init(mTransportMgr);
+    slot->mDeviceBeingPaired = GetInactiveDeviceIndex();
+    VerifyOrExit(slot->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
+    device = &mActiveDevices[slot->mDeviceBeingPaired];
+
+    slot->mIsIPRendezvous = isIPRendezvous;
+    slot->mPeerAddress    = params.GetPeerAddress();
+    slot->mSetupPINCode   = params.GetSetupPINCode();
+    slot->mRetryCount     = 0;
+
+    err = slot->mPairingSession.MessageDispatch().Init(mTransportMgr);
     SuccessOrExit(err);
-    mPairingSession.MessageDispatch().SetPeerAddress(params.GetPeerAddress());
+    slot->mPairingSession.MessageDispatch().SetPeerAddress(params.GetPeerAddress());
 
     device->Init(GetControllerDeviceInitParams(), mListenPort, remoteDeviceId, peerAddress, admin->GetAdminId());
+    AddToDeviceIndex(slot->mDeviceBeingPaired);
 
-    mSystemLayer->StartTimer(kSessionEstablishmentTimeout, OnSessionEstablishmentTimeoutCallback, this);
+    mSystemLayer->StartTimer(kSessionEstablishmentTimeout, OnSessionEstablishmentTimeoutCallback, slot);
     if (params.GetPeerAddress().GetTransportType() != Transport::Type::kBle)
     {
         device->SetAddress(params.GetPeerAddress().GetIPAddress());
@@ -739,24 +957,25 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
         }
     }
 #endif
-    exchangeCtxt = mExchangeMgr->NewContext(SecureSessionHandle(), &mPairingSession);
+    exchangeCtxt = mExchangeMgr->NewContext(SecureSessionHandle(), &slot->mPairingSession);
     VerifyOrExit(exchangeCtxt != nullptr, err = CHIP_ERROR_INTERNAL);
 
-    err = mPairingSession.Pair(params.GetPeerAddress(), params.GetSetupPINCode(), mNextKeyId++, exchangeCtxt, this);
+    err = slot->mPairingSession.Pair(params.GetPeerAddress(), params.GetSetupPINCode(), mNextKeyId++, exchangeCtxt, slot);
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        // Delete the current rendezvous session only if a device is not currently being paired.
-        if (mDeviceBeingPaired == kNumMaxActiveDevices)
+        // Delete the rendezvous session only if it was started by this call.
+        if (slot != nullptr)
         {
+            mSystemLayer->CancelTimer(OnSessionEstablishmentTimeoutCallback, slot);
             FreeRendezvousSession();
-        }
 
-        if (device != nullptr)
-        {
-            ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+            if (device != nullptr)
+            {
+                ReleaseDevice(device);
+            }
+            slot->mDeviceBeingPaired = kNumMaxActiveDevices;
         }
     }
 
@@ -766,8 +985,9 @@ exit:
 CHIP_ERROR DeviceCommissioner::PairTestDeviceWithoutSecurity(NodeId remoteDeviceId, const Transport::PeerAddress & peerAddress,
                                                              SerializedDevice & serialized)
 {
-    CHIP_ERROR err  = CHIP_NO_ERROR;
-    Device * device = nullptr;
+    CHIP_ERROR err     = CHIP_NO_ERROR;
+    Device * device    = nullptr;
+    PairingSlot * slot = nullptr;
 
     SecurePairingUsingTestSecret * testSecurePairingSecret = nullptr;
 
@@ -775,22 +995,33 @@ CHIP_ERROR DeviceCommissioner::PairTestDeviceWithoutSecurity(NodeId remoteDevice
     VerifyOrExit(remoteDeviceId != kUndefinedNodeId && remoteDeviceId != kAnyNodeId, err = CHIP_ERROR_INVALID_ARGUMENT);
 
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(FindPairingSlot(remoteDeviceId) == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    for (PairingSlot & candidate : mPairingSlots)
+    {
+        if (!candidate.IsInUse())
+        {
+            slot = &candidate;
+            break;
+        }
+    }
+    VerifyOrExit(slot != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     testSecurePairingSecret = chip::Platform::New<SecurePairingUsingTestSecret>();
     VerifyOrExit(testSecurePairingSecret != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    slot->mDeviceBeingPaired = GetInactiveDeviceIndex();
+    VerifyOrExit(slot->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
+    device = &mActiveDevices[slot->mDeviceBeingPaired];
 
     testSecurePairingSecret->ToSerializable(device->GetPairing());
 
     device->Init(GetControllerDeviceInitParams(), mListenPort, remoteDeviceId, peerAddress, mAdminId);
+    AddToDeviceIndex(slot->mDeviceBeingPaired);
 
     device->Serialize(serialized);
 
-    OnSessionEstablished();
+    OnSessionEstablished(*slot);
 
 exit:
     if (testSecurePairingSecret != nullptr)
@@ -803,7 +1034,10 @@ exit:
         if (device != nullptr)
         {
             ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+        }
+        if (slot != nullptr)
+        {
+            slot->mDeviceBeingPaired = kNumMaxActiveDevices;
         }
     }
 
@@ -813,15 +1047,25 @@ exit:
 CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
-    VerifyOrReturnError(device->GetDeviceId() == remoteDeviceId, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+    PairingSlot * slot = FindPairingSlot(remoteDeviceId);
+    if (slot == nullptr)
+    {
+        for (const PairingSlot & other : mPairingSlots)
+        {
+            VerifyOrReturnError(!other.IsInUse(), CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+        }
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    mSystemLayer->CancelTimer(OnSessionEstablishmentTimeoutCallback, slot);
+    mSystemLayer->CancelTimer(OnPairingRetryCallback, slot);
+    slot->mPairingSession.Clear();
 
     FreeRendezvousSession();
 
-    ReleaseDevice(device);
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    ReleaseDevice(&mActiveDevices[slot->mDeviceBeingPaired]);
+    slot->mDeviceBeingPaired = kNumMaxActiveDevices;
     return CHIP_NO_ERROR;
 }
 
@@ -831,22 +1075,21 @@ CHIP_ERROR DeviceCommissioner::UnpairDevice(NodeId remoteDeviceId)
 
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
 
-    if (mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (FindPairingSlot(remoteDeviceId) != nullptr)
     {
-        Device * device = &mActiveDevices[mDeviceBeingPaired];
-        if (device->GetDeviceId() == remoteDeviceId)
-        {
-            FreeRendezvousSession();
-        }
+        ReturnErrorOnFailure(StopPairing(remoteDeviceId));
     }
 
     if (mStorageDelegate != nullptr)
     {
         PERSISTENT_KEY_OP(remoteDeviceId, kPairedDeviceKeyPrefix, key, mStorageDelegate->SyncDeleteKeyValue(key));
+
+        if (InitializePairedDeviceList() == CHIP_NO_ERROR)
+        {
+            mPairedDevices.Remove(remoteDeviceId);
+        }
     }
 
-    mPairedDevices.Remove(remoteDeviceId);
-    mPairedDevicesUpdated = true;
     ReleaseDeviceById(remoteDeviceId);
 
     return CHIP_NO_ERROR;
@@ -857,100 +1100,117 @@ void DeviceCommissioner::FreeRendezvousSession()
     PersistNextKeyId();
 }
 
-void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
+DeviceCommissioner::PairingSlot * DeviceCommissioner::FindPairingSlot(NodeId remoteDeviceId)
+{
+    for (PairingSlot & slot : mPairingSlots)
+    {
+        if (slot.IsInUse() && mActiveDevices[slot.mDeviceBeingPaired].GetDeviceId() == remoteDeviceId)
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+NodeId DeviceCommissioner::GetDeviceBeingPairedId(const PairingSlot & slot) const
 {
+    return slot.IsInUse() ? mActiveDevices[slot.mDeviceBeingPaired].GetDeviceId() : kUndefinedNodeId;
+}
+
+void DeviceCommissioner::RendezvousCleanup(PairingSlot & slot, CHIP_ERROR status)
+{
+    const NodeId deviceId = GetDeviceBeingPairedId(slot);
+
     mRendezvousAdvDelegate.StopAdvertisement();
     mRendezvousAdvDelegate.RendezvousComplete();
 
     FreeRendezvousSession();
 
     // TODO: make mStorageDelegate mandatory once all controller applications implement the interface.
-    if (mDeviceBeingPaired != kNumMaxActiveDevices && mStorageDelegate != nullptr)
+    if (slot.IsInUse() && mStorageDelegate != nullptr)
     {
         // Let's release the device that's being paired.
         // If pairing was successful, its information is
         // already persisted. The application will use GetDevice()
         // method to get access to the device, which will fetch
         // the device information from the persistent storage.
-        DeviceController::ReleaseDevice(mDeviceBeingPaired);
+        DeviceController::ReleaseDevice(slot.mDeviceBeingPaired);
     }
 
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    slot.mDeviceBeingPaired = kNumMaxActiveDevices;
 
     if (mPairingDelegate != nullptr)
     {
-        mPairingDelegate->OnPairingComplete(status);
+        mPairingDelegate->OnDevicePairingComplete(deviceId, status);
     }
 }
 
-void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
+void DeviceCommissioner::OnSessionEstablishmentError(PairingSlot & slot, CHIP_ERROR err)
 {
-    mSystemLayer->CancelTimer(OnSessionEstablishmentTimeoutCallback, this);
+    mSystemLayer->CancelTimer(OnSessionEstablishmentTimeoutCallback, &slot);
+
+    // A device busy with other handshakes is asked again later, rather than have the pairing fail. The device of a BLE
+    // rendezvous is not, which only one controller can be connected to.
+    if (err == CHIP_ERROR_BUSY && slot.IsInUse() && slot.mIsIPRendezvous &&
+        slot.mRetryCount < CHIP_CONFIG_CONTROLLER_PAIRING_MAX_RETRIES)
+    {
+        const uint32_t delayMs = GetPairingRetryDelayMs(slot.mRetryCount++, slot.mPairingSession.GetPeerRetryAfterMs());
+        if (mSystemLayer->StartTimer(delayMs, OnPairingRetryCallback, &slot) == CHIP_NO_ERROR)
+        {
+            ChipLogProgress(Controller, "Device 0x%" PRIx64 " is busy, pairing again in %" PRIu32 " ms",
+                            GetDeviceBeingPairedId(slot), delayMs);
+            return;
+        }
+    }
 
     if (mPairingDelegate != nullptr)
     {
-        mPairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingFailed);
+        mPairingDelegate->OnDeviceStatusUpdate(GetDeviceBeingPairedId(slot), DevicePairingDelegate::SecurePairingFailed);
     }
 
-    RendezvousCleanup(err);
+    RendezvousCleanup(slot, err);
 }
 
-void DeviceCommissioner::OnSessionEstablished()
+void DeviceCommissioner::OnSessionEstablished(PairingSlot & slot)
 {
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
+    VerifyOrReturn(slot.IsInUse(), OnSessionEstablishmentError(slot, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device              = &mActiveDevices[slot.mDeviceBeingPaired];
+    PASESession & pairingSession = slot.mPairingSession;
 
-    mPairingSession.PeerConnection().SetPeerNodeId(device->GetDeviceId());
+    pairingSession.PeerConnection().SetPeerNodeId(device->GetDeviceId());
 
     CHIP_ERROR err =
-        mSessionMgr->NewPairing(Optional<Transport::PeerAddress>::Value(mPairingSession.PeerConnection().GetPeerAddress()),
-                                mPairingSession.PeerConnection().GetPeerNodeId(), &mPairingSession,
+        mSessionMgr->NewPairing(Optional<Transport::PeerAddress>::Value(pairingSession.PeerConnection().GetPeerAddress()),
+                                pairingSession.PeerConnection().GetPeerNodeId(), &pairingSession,
                                 SecureSessionMgr::PairingDirection::kInitiator, mAdminId, nullptr);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Ble, "Failed in setting up secure channel: err %s", ErrorStr(err));
-        OnSessionEstablishmentError(err);
+        OnSessionEstablishmentError(slot, err);
         return;
     }
 
     ChipLogDetail(Controller, "Remote device completed SPAKE2+ handshake\n");
-    mPairingSession.ToSerializable(device->GetPairing());
-    mSystemLayer->CancelTimer(OnSessionEstablishmentTimeoutCallback, this);
-
-    mPairedDevices.Insert(device->GetDeviceId());
-    mPairedDevicesUpdated = true;
+    pairingSession.ToSerializable(device->GetPairing());
+    mSystemLayer->CancelTimer(OnSessionEstablishmentTimeoutCallback, &slot);
 
+    bool wasPaired = IsPairedDevice(device->GetDeviceId());
     PersistDevice(device);
 
-    if (mPairingDelegate != nullptr)
+    // A device paired again keeps its entry in the index of the paired devices.
+    if (mStorageDelegate != nullptr && !wasPaired &&
+        (InitializePairedDeviceList() != CHIP_NO_ERROR || mPairedDevices.Add(device->GetDeviceId()) != CHIP_NO_ERROR))
     {
-        mPairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingSuccess);
+        ChipLogError(Controller, "Failed to add device 0x%" PRIx64 " to the paired device index", device->GetDeviceId());
     }
 
-    RendezvousCleanup(CHIP_NO_ERROR);
-}
-
-void DeviceCommissioner::PersistDeviceList()
-{
-    if (mStorageDelegate != nullptr && mPairedDevicesUpdated)
+    if (mPairingDelegate != nullptr)
     {
-        constexpr uint16_t size = CHIP_MAX_SERIALIZED_SIZE_U64(kNumMaxPairedDevices);
-        char * serialized       = static_cast<char *>(chip::Platform::MemoryAlloc(size));
-        uint16_t requiredSize   = size;
-        if (serialized != nullptr)
-        {
-            const char * value = mPairedDevices.SerializeBase64(serialized, requiredSize);
-            if (value != nullptr && requiredSize <= size)
-            {
-                // TODO: no need to base64 again the value
-                PERSISTENT_KEY_OP(static_cast<uint64_t>(0), kPairedDeviceListKeyPrefix, key,
-                                  mStorageDelegate->SyncSetKeyValue(key, value, requiredSize));
-                mPairedDevicesUpdated = false;
-            }
-            chip::Platform::MemoryFree(serialized);
-        }
+        mPairingDelegate->OnDeviceStatusUpdate(device->GetDeviceId(), DevicePairingDelegate::SecurePairingSuccess);
     }
+
+    RendezvousCleanup(slot, CHIP_NO_ERROR);
 }
 
 void DeviceCommissioner::PersistNextKeyId()
@@ -961,39 +1221,84 @@ void DeviceCommissioner::PersistNextKeyId()
     }
 }
 
-void DeviceCommissioner::ReleaseDevice(Device * device)
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+bool DeviceCommissioner::CanEvictDevice(uint16_t index)
 {
-    PersistDeviceList();
-    DeviceController::ReleaseDevice(device);
+    for (const PairingSlot & slot : mPairingSlots)
+    {
+        VerifyOrReturnError(slot.mDeviceBeingPaired != index, false);
+    }
+    return DeviceController::CanEvictDevice(index);
 }
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
 
 #if CONFIG_NETWORK_LAYER_BLE
 CHIP_ERROR DeviceCommissioner::CloseBleConnection()
 {
-    // It is fine since we can only commission one device at the same time.
+    // It is fine since we can only commission one device at the same time over BLE.
     // We should be able to distinguish different BLE connections if we want
     // to commission multiple devices at the same time over BLE.
     return mBleLayer->CloseAllBleConnections();
 }
 #endif
 
-void DeviceCommissioner::OnSessionEstablishmentTimeout()
+void DeviceCommissioner::OnSessionEstablishmentTimeout(PairingSlot & slot)
 {
     VerifyOrReturn(mState == State::Initialized);
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices);
+    VerifyOrReturn(slot.IsInUse());
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
-    StopPairing(device->GetDeviceId());
+    const NodeId deviceId = GetDeviceBeingPairedId(slot);
+    StopPairing(deviceId);
 
     if (mPairingDelegate != nullptr)
     {
-        mPairingDelegate->OnPairingComplete(CHIP_ERROR_TIMEOUT);
+        mPairingDelegate->OnDevicePairingComplete(deviceId, CHIP_ERROR_TIMEOUT);
     }
 }
 
 void DeviceCommissioner::OnSessionEstablishmentTimeoutCallback(System::Layer * aLayer, void * aAppState, System::Error aError)
 {
-    reinterpret_cast<DeviceCommissioner *>(aAppState)->OnSessionEstablishmentTimeout();
+    PairingSlot * slot = reinterpret_cast<PairingSlot *>(aAppState);
+    slot->mCommissioner->OnSessionEstablishmentTimeout(*slot);
+}
+
+void DeviceCommissioner::OnPairingRetry(PairingSlot & slot)
+{
+    VerifyOrReturn(mState == State::Initialized);
+    VerifyOrReturn(slot.IsInUse());
+
+    CHIP_ERROR err                            = CHIP_NO_ERROR;
+    Messaging::ExchangeContext * exchangeCtxt = mExchangeMgr->NewContext(SecureSessionHandle(), &slot.mPairingSession);
+    VerifyOrExit(exchangeCtxt != nullptr, err = CHIP_ERROR_INTERNAL);
+
+    mSystemLayer->StartTimer(kSessionEstablishmentTimeout, OnSessionEstablishmentTimeoutCallback, &slot);
+    err = slot.mPairingSession.Pair(slot.mPeerAddress, slot.mSetupPINCode, mNextKeyId++, exchangeCtxt, &slot);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        OnSessionEstablishmentError(slot, err);
+    }
+}
+
+void DeviceCommissioner::OnPairingRetryCallback(System::Layer * aLayer, void * aAppState, System::Error aError)
+{
+    PairingSlot * slot = reinterpret_cast<PairingSlot *>(aAppState);
+    slot->mCommissioner->OnPairingRetry(*slot);
+}
+
+uint32_t DeviceCommissioner::GetPairingRetryDelayMs(uint8_t retryCount, uint16_t peerRetryAfterMs)
+{
+    uint32_t backoffMs = CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_BASE_MS;
+    for (uint8_t i = 0; i < retryCount && backoffMs < CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_MAX_MS; i++)
+    {
+        backoffMs *= 2;
+    }
+    backoffMs = std::min<uint32_t>(backoffMs, CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_MAX_MS);
+
+    // Half of the backoff is random, for the controllers turned away at the same time not to come back at the same time
+    const uint32_t halfMs = backoffMs / 2;
+    return std::max<uint32_t>(halfMs, peerRetryAfterMs) + GetRandU32() % (halfMs + 1);
 }
 
 } // namespace Controller
@@ -30,6 +30,7 @@
 
 #include <app/InteractionModelDelegate.h>
 #include <controller/CHIPDevice.h>
+#include <controller/PairedDeviceIndex.h>
 #include <core/CHIPCore.h>
 #include <core/CHIPPersistentStorageDelegate.h>
 #include <core/CHIPTLV.h>
@@ -38,7 +39,9 @@
 #include <protocols/secure_channel/RendezvousParameters.h>
 #include <support/DLLUtil.h>
 #include <support/SerializableIntegerSet.h>
+#include <system/SystemWorkerPool.h>
 #include <transport/AdminPairingTable.h>
+#include <transport/PeerConnectionIndex.h>
 #include <transport/SecureSessionMgr.h>
 #include <transport/TransportMgr.h>
 #include <transport/raw/UDP.h>
@@ -59,8 +62,13 @@ namespace chip {
 
 namespace Controller {
 
-constexpr uint16_t kNumMaxActiveDevices = 64;
-constexpr uint16_t kNumMaxPairedDevices = 128;
+constexpr uint16_t kNumMaxActiveDevices = CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES;
+constexpr uint16_t kNumMaxPairedDevices = CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES;
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
+constexpr uint16_t kNumMaxPrewarmDevices = CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES;
+
+static_assert(kNumMaxPrewarmDevices <= kNumMaxActiveDevices, "Prewarmed devices must fit in the active devices");
+#endif
 
 struct ControllerInitParams
 {
@@ -77,6 +85,9 @@ struct ControllerInitParams
 #if CHIP_DEVICE_CONFIG_ENABLE_MDNS
     DeviceAddressUpdateDelegate * mDeviceAddressUpdateDelegate = nullptr;
 #endif
+    /// How long the devices serve the attribute values of their caches, in milliseconds, 0 to always read attributes
+    /// from the devices. Only effective with CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES above 0.
+    uint32_t attributeCacheFreshnessMs = 0;
 };
 
 class DLL_EXPORT DevicePairingDelegate
@@ -106,6 +117,26 @@ public:
      */
     virtual void OnPairingComplete(CHIP_ERROR error) {}
 
+    /**
+     * @brief
+     *   Called when the pairing of a given device reaches a certain stage. Unless overridden, forwards to OnStatusUpdate().
+     *   Commissioners pairing several devices at the same time should override it.
+     *
+     * @param deviceId Id of the device being paired
+     * @param status   Current status of pairing
+     */
+    virtual void OnDeviceStatusUpdate(NodeId deviceId, DevicePairingDelegate::Status status) { OnStatusUpdate(status); }
+
+    /**
+     * @brief
+     *   Called when the pairing of a given device is complete (with success or error). Unless overridden, forwards to
+     *   OnPairingComplete().
+     *
+     * @param deviceId Id of the device being paired
+     * @param error    Error cause, if any
+     */
+    virtual void OnDevicePairingComplete(NodeId deviceId, CHIP_ERROR error) { OnPairingComplete(error); }
+
     /**
      * @brief
      *   Called when the pairing is deleted (with success or error)
@@ -118,6 +149,9 @@ public:
 struct CommissionerInitParams : public ControllerInitParams
 {
     DevicePairingDelegate * pairingDelegate = nullptr;
+
+    /* Number of threads running the SPAKE2+ computations of the pairings, 0 to run them on the CHIP thread. */
+    size_t cryptoWorkerThreadCount = 0;
 };
 
 /**
@@ -155,6 +189,9 @@ public:
      * @param[out] device    The output device object
      *
      * @return CHIP_ERROR CHIP_NO_ERROR on success, or corresponding error code.
+     *
+     * With CHIP_CONFIG_CONTROLLER_DEVICE_CACHE, getting a device that is not active while all the device objects are in use
+     * persists and releases the least recently used device, which invalidates the object previously returned for it.
      */
     CHIP_ERROR GetDevice(NodeId deviceId, const SerializedDevice & deviceInfo, Device ** device);
 
@@ -170,6 +207,15 @@ public:
      */
     CHIP_ERROR GetDevice(NodeId deviceId, Device ** device);
 
+    /**
+     * @brief
+     *   Call visitor with the node ID of every paired device, until it returns false. The node IDs are read from the
+     *   persistent storage a page at a time.
+     *
+     * @return CHIP_ERROR CHIP_NO_ERROR on success, or corresponding error code.
+     */
+    CHIP_ERROR ForEachPairedDevice(PairedDeviceIndex::Visitor visitor, void * context);
+
     /**
      * @brief
      *   This function update the device informations asynchronously using mdns.
@@ -182,12 +228,41 @@ public:
      */
     CHIP_ERROR UpdateDevice(Device * device, uint64_t fabricId);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
+    /**
+     * @brief
+     *   Get paired devices ready for use in the background, typically at startup, so that the first command
+     *   sent to one of them finds its address and secure session already set up. The addresses of up to
+     *   kNumMaxPrewarmDevices paired devices are resolved using mdns, CHIP_CONFIG_CONTROLLER_PREWARM_CONCURRENCY
+     *   at a time, and each resolved device is loaded and updated as by UpdateDevice(). Their address updates
+     *   are then delivered together to DeviceAddressUpdateDelegate::OnAddressUpdatesComplete, once all of them
+     *   completed or CHIP_CONFIG_CONTROLLER_PREWARM_TIMEOUT_MS elapsed.
+     *
+     * @param[in] fabricId  The fabricId used for mdns resolution
+     *
+     * @return CHIP_ERROR CHIP_NO_ERROR on success, CHIP_ERROR_INCORRECT_STATE without a DeviceAddressUpdateDelegate
+     *         or while a prewarm is in progress, or corresponding error code.
+     */
+    CHIP_ERROR PrewarmDevices(uint64_t fabricId);
+#endif
+
     void PersistDevice(Device * device);
 
     CHIP_ERROR SetUdpListenPort(uint16_t listenPort);
 
     virtual void ReleaseDevice(Device * device);
 
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    struct DeviceCacheStats
+    {
+        uint32_t mHits;      /**< GetDevice() calls that found the device active. */
+        uint32_t mMisses;    /**< GetDevice() calls that had to load the device. */
+        uint32_t mEvictions; /**< Devices released to make room for another one. */
+    };
+
+    const DeviceCacheStats & GetDeviceCacheStats() const { return mDeviceCacheStats; }
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+
     // ----- IO -----
     /**
      * @brief
@@ -219,8 +294,7 @@ protected:
     */
     Device mActiveDevices[kNumMaxActiveDevices];
 
-    SerializableU64Set<kNumMaxPairedDevices> mPairedDevices;
-    bool mPairedDevicesInitialized;
+    PairedDeviceIndex mPairedDevices;
 
     NodeId mLocalDeviceId;
     DeviceTransportMgr * mTransportMgr;
@@ -237,19 +311,47 @@ protected:
     System::Layer * mSystemLayer;
 
     uint16_t mListenPort;
+    uint32_t mAttributeCacheFreshnessMs = 0;
     uint16_t GetInactiveDeviceIndex();
     uint16_t FindDeviceIndex(SecureSessionHandle session);
     uint16_t FindDeviceIndex(NodeId id);
     void ReleaseDevice(uint16_t index);
     void ReleaseDeviceById(NodeId remoteDeviceId);
+    void AddToDeviceIndex(uint16_t index);
+    void RemoveFromDeviceIndex(uint16_t index);
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    void TouchDevice(uint16_t index) { mDeviceLastUsed[index] = ++mDeviceUseCounter; }
+    uint16_t EvictLeastRecentlyUsedDevice();
+
+    /**
+     * Whether the active device at the given index may be persisted and released to make room for another one. Only paired
+     * devices can be evicted, since they are reloaded from the persistent storage the next time they are needed.
+     */
+    virtual bool CanEvictDevice(uint16_t index);
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
     CHIP_ERROR InitializePairedDeviceList();
-    CHIP_ERROR SetPairedDeviceList(const char * pairedDeviceSerializedSet);
+    /**
+     * Whether the device is paired, which is whether its record is in the persistent storage. The index of the paired
+     * devices only serves to list them.
+     */
+    bool IsPairedDevice(NodeId deviceId);
     ControllerDeviceInitParams GetControllerDeviceInitParams();
 
     Transport::AdminId mAdminId = 0;
     Transport::AdminPairingTable mAdmins;
 
 private:
+    /* Active devices by node ID. Slots are recorded under the ID they had when indexed, so that a
+       slot is never indexed twice. */
+    Transport::PeerConnectionIndex<kNumMaxActiveDevices, NodeId, CHIP_CONFIG_CONTROLLER_DEVICE_CACHE != 0> mDeviceIdIndex;
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    NodeId mIndexedDeviceIds[kNumMaxActiveDevices];
+    uint64_t mDeviceLastUsed[kNumMaxActiveDevices];
+    uint64_t mDeviceUseCounter = 0;
+    DeviceCacheStats mDeviceCacheStats;
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+
+
     //////////// ExchangeDelegate Implementation ///////////////
     void OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                            System::PacketBufferHandle msgBuf) override;
@@ -263,6 +365,28 @@ private:
     //////////// ResolverDelegate Implementation ///////////////
     void OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & nodeData) override;
     void OnNodeIdResolutionFailed(const chip::PeerId & peerId, CHIP_ERROR error) override;
+
+    void NotifyAddressUpdate(NodeId nodeId, CHIP_ERROR error);
+
+#if CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
+    /* The devices being prewarmed, in the order their resolutions are started. The entries before mPrewarmNext have
+       been started, and mPrewarmDone tells which of them completed. */
+    AddressUpdate mPrewarmUpdates[kNumMaxPrewarmDevices];
+    bool mPrewarmDone[kNumMaxPrewarmDevices];
+    uint64_t mPrewarmFabricId = 0;
+    uint16_t mPrewarmCount    = 0;
+    uint16_t mPrewarmNext     = 0;
+    uint16_t mPrewarmPending  = 0;
+    uint16_t mPrewarmInFlight = 0;
+    bool mPrewarming          = false;
+
+    static bool AddPrewarmDevice(void * context, NodeId deviceId);
+    void StartPrewarmResolutions();
+    /// Completes the prewarm resolution of the device, returning false if the device is not being prewarmed.
+    bool CompletePrewarmResolution(NodeId deviceId, CHIP_ERROR error);
+    void FinishPrewarm(bool notify);
+    static void OnPrewarmTimeout(System::Layer * aLayer, void * aAppState, System::Error aError);
+#endif // CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES > 0
 #endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS
 
     void ReleaseAllDevices();
@@ -295,7 +419,7 @@ public:
  *   required to provide write access to the persistent storage, where the paired device information
  *   will be stored.
  */
-class DLL_EXPORT DeviceCommissioner : public DeviceController, public SessionEstablishmentDelegate
+class DLL_EXPORT DeviceCommissioner : public DeviceController
 {
 public:
     DeviceCommissioner();
@@ -315,7 +439,8 @@ public:
      * @brief
      *   Pair a CHIP device with the provided Rendezvous connection parameters.
      *   Use registered DevicePairingDelegate object to receive notifications on
-     *   pairing status updates.
+     *   pairing status updates. Up to CHIP_CONFIG_CONTROLLER_MAX_CONCURRENT_PAIRINGS
+     *   devices can be paired at the same time, at most one of them over BLE.
      *
      *   Note: Pairing process requires that the caller has registered PersistentStorageDelegate
      *         in the Init() call.
@@ -349,13 +474,9 @@ public:
      */
     CHIP_ERROR UnpairDevice(NodeId remoteDeviceId);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished() override;
-
-    void RendezvousCleanup(CHIP_ERROR status);
-
-    void ReleaseDevice(Device * device) override;
+#if CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+    bool CanEvictDevice(uint16_t index) override;
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
 
 #if CONFIG_NETWORK_LAYER_BLE
     /**
@@ -369,27 +490,42 @@ public:
 #endif
 
 private:
-    DevicePairingDelegate * mPairingDelegate;
+    /**
+     * A device being paired, and the PASE session it is being paired with.
+     */
+    class PairingSlot : public SessionEstablishmentDelegate
+    {
+    public:
+        //////////// SessionEstablishmentDelegate Implementation ///////////////
+        void OnSessionEstablishmentError(CHIP_ERROR error) override { mCommissioner->OnSessionEstablishmentError(*this, error); }
+        void OnSessionEstablished() override { mCommissioner->OnSessionEstablished(*this); }
 
-    /* This field is an index in mActiveDevices list. The object at this index in the list
-       contains the device object that's tracking the state of the device that's being paired.
-       If no device is currently being paired, this value will be kNumMaxPairedDevices.  */
-    uint16_t mDeviceBeingPaired;
+        bool IsInUse() const { return mDeviceBeingPaired != kNumMaxActiveDevices; }
 
-    /* TODO: BLE rendezvous and IP rendezvous should share the same procedure, so this is just a
-       workaround-like flag and should be removed in the future.
-       When using IP rendezvous, we need to disable network provisioning. In the future, network
-       provisioning will no longer be a part of rendezvous procedure. */
-    bool mIsIPRendezvous;
+        DeviceCommissioner * mCommissioner = nullptr;
 
-    /* This field is true when device pairing information changes, e.g. a new device is paired, or
-       the pairing for a device is removed. The DeviceCommissioner uses this to decide when to
-       persist the device list */
-    bool mPairedDevicesUpdated;
+        /* This field is an index in mActiveDevices list. The object at this index in the list
+           contains the device object that's tracking the state of the device that's being paired.
+           If the slot is free, this value will be kNumMaxActiveDevices.  */
+        uint16_t mDeviceBeingPaired = kNumMaxActiveDevices;
 
-    DeviceCommissionerRendezvousAdvertisementDelegate mRendezvousAdvDelegate;
+        /* TODO: BLE rendezvous and IP rendezvous should share the same procedure, so this is just a
+           workaround-like flag and should be removed in the future.
+           When using IP rendezvous, we need to disable network provisioning. In the future, network
+           provisioning will no longer be a part of rendezvous procedure. */
+        bool mIsIPRendezvous = false;
+
+        /* What the pairing is started again with, after a backoff, when the device answers that it is busy. */
+        Transport::PeerAddress mPeerAddress;
+        uint32_t mSetupPINCode = 0;
+        uint8_t mRetryCount    = 0;
+
+        PASESession mPairingSession;
+    };
+
+    DevicePairingDelegate * mPairingDelegate;
 
-    void PersistDeviceList();
+    DeviceCommissionerRendezvousAdvertisementDelegate mRendezvousAdvDelegate;
 
     void PersistNextKeyId();
 
@@ -397,13 +533,31 @@ private:
 
     CHIP_ERROR LoadKeyId(PersistentStorageDelegate * delegate, uint16_t & out);
 
-    void OnSessionEstablishmentTimeout();
+    PairingSlot * FindPairingSlot(NodeId remoteDeviceId);
+    NodeId GetDeviceBeingPairedId(const PairingSlot & slot) const;
+
+    void OnSessionEstablishmentError(PairingSlot & slot, CHIP_ERROR error);
+    void OnSessionEstablished(PairingSlot & slot);
+
+    void RendezvousCleanup(PairingSlot & slot, CHIP_ERROR status);
+
+    void OnSessionEstablishmentTimeout(PairingSlot & slot);
 
     static void OnSessionEstablishmentTimeoutCallback(System::Layer * aLayer, void * aAppState, System::Error aError);
 
+    void OnPairingRetry(PairingSlot & slot);
+
+    static void OnPairingRetryCallback(System::Layer * aLayer, void * aAppState, System::Error aError);
+
+    /* The backoff before the retry of a pairing the device was busy for, which is the wait it asked for at least. */
+    static uint32_t GetPairingRetryDelayMs(uint8_t retryCount, uint16_t peerRetryAfterMs);
+
     uint16_t mNextKeyId = 0;
 
-    PASESession mPairingSession;
+    /* Declared before the pairing sessions, which cancel their computations when destroyed. */
+    System::WorkerPool mCryptoWorkerPool;
+
+    PairingSlot mPairingSlots[CHIP_CONFIG_CONTROLLER_MAX_CONCURRENT_PAIRINGS];
 };
 
 } // namespace Controller
@@ -18,18 +18,38 @@
 
 #pragma once
 
+#include <core/CHIPError.h>
 #include <support/DLLUtil.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <stddef.h>
+
 namespace chip {
 namespace Controller {
 
+/// The outcome of the address resolution of a device
+struct AddressUpdate
+{
+    NodeId nodeId;
+    CHIP_ERROR error;
+};
+
 /// Callbacks for CHIP device address resolution
 class DLL_EXPORT DeviceAddressUpdateDelegate
 {
 public:
     virtual ~DeviceAddressUpdateDelegate() {}
     virtual void OnAddressUpdateComplete(NodeId nodeId, CHIP_ERROR error) = 0;
+
+    /// Called once with the address updates of all the devices prewarmed by DeviceController::PrewarmDevices(). By default,
+    /// each of them is passed to OnAddressUpdateComplete.
+    virtual void OnAddressUpdatesComplete(const AddressUpdate * updates, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            OnAddressUpdateComplete(updates[i].nodeId, updates[i].error);
+        }
+    }
 };
 
 } // namespace Controller
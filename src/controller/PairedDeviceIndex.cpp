@@ -0,0 +1,321 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    This file contains the implementation of the persisted index of the
+ *    node IDs of the devices paired by a CHIP device commissioner.
+ */
+
+#include <controller/PairedDeviceIndex.h>
+
+#include <core/CHIPEncoding.h>
+#include <support/Base64.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/SerializableIntegerSet.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <stdio.h>
+
+namespace chip {
+namespace Controller {
+
+namespace {
+
+constexpr const char kPageCountKey[]     = "PairedDeviceIndex";
+constexpr const char kPageKeyPrefix[]    = "PairedDeviceIndex";
+constexpr const char kDeviceListKey[]    = "ListPairedDevices0";
+constexpr uint16_t kMaxDeviceListLength  = CHIP_MAX_SERIALIZED_SIZE_U64(CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES);
+constexpr size_t kMaxPageKeyLength       = sizeof(kPageKeyPrefix) + 4;
+constexpr uint16_t kNodeIdEncodingLength = sizeof(uint64_t);
+
+void GetPageKey(uint16_t index, char (&key)[kMaxPageKeyLength])
+{
+    snprintf(key, sizeof(key), "%s%x", kPageKeyPrefix, index);
+}
+
+} // namespace
+
+CHIP_ERROR PairedDeviceIndex::Init(PersistentStorageDelegate * storage)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t value[sizeof(uint16_t)];
+    uint16_t size = sizeof(value);
+
+    VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mStorage         = storage;
+    mPageCount       = 0;
+    mLastPage.mCount = 0;
+
+    err = mStorage->SyncGetKeyValue(kPageCountKey, value, size);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        err = MigrateDeviceList();
+    }
+    else if (err == CHIP_NO_ERROR)
+    {
+        VerifyOrExit(size == sizeof(value), err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+        mPageCount = Encoding::LittleEndian::Get16(value);
+        VerifyOrExit(mPageCount <= kMaxPages, err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+        if (mPageCount > 0)
+        {
+            err = LoadPage(static_cast<uint16_t>(mPageCount - 1), mLastPage);
+        }
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to initialize the paired device index: %s", ErrorStr(err));
+        mStorage = nullptr;
+    }
+    return err;
+}
+
+CHIP_ERROR PairedDeviceIndex::Add(NodeId deviceId)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (mPageCount == 0 || mLastPage.mCount == kPageSize)
+    {
+        Page page;
+
+        VerifyOrReturnError(mPageCount < kMaxPages, CHIP_ERROR_NO_MEMORY);
+
+        // The page is written before it is counted, so that an interrupted update leaves no count without its page.
+        page.mIds[0] = deviceId;
+        page.mCount  = 1;
+        ReturnErrorOnFailure(StorePage(mPageCount, page));
+
+        mPageCount++;
+        CHIP_ERROR err = StorePageCount();
+        if (err != CHIP_NO_ERROR)
+        {
+            mPageCount--;
+            return err;
+        }
+
+        mLastPage = page;
+        return CHIP_NO_ERROR;
+    }
+
+    mLastPage.mIds[mLastPage.mCount++] = deviceId;
+    CHIP_ERROR err                     = StorePage(static_cast<uint16_t>(mPageCount - 1), mLastPage);
+    if (err != CHIP_NO_ERROR)
+    {
+        mLastPage.mCount--;
+    }
+    return err;
+}
+
+CHIP_ERROR PairedDeviceIndex::Remove(NodeId deviceId)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    for (uint16_t index = 0; index < mPageCount; index++)
+    {
+        bool isLastPage = (index == mPageCount - 1);
+        Page loadedPage;
+        Page & page = isLastPage ? mLastPage : loadedPage;
+
+        if (!isLastPage)
+        {
+            ReturnErrorOnFailure(LoadPage(index, loadedPage));
+        }
+
+        for (uint16_t i = 0; i < page.mCount; i++)
+        {
+            if (page.mIds[i] != deviceId)
+            {
+                continue;
+            }
+
+            // The last node ID fills the hole, which keeps every page but the last one full. It is written to its new
+            // page first, so that an interrupted update duplicates it rather than losing it.
+            page.mIds[i] = mLastPage.mIds[mLastPage.mCount - 1];
+            if (!isLastPage)
+            {
+                ReturnErrorOnFailure(StorePage(index, page));
+            }
+            return RemoveLastId();
+        }
+    }
+
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
+CHIP_ERROR PairedDeviceIndex::ForEach(Visitor visitor, void * context)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(visitor != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (uint16_t index = 0; index < mPageCount; index++)
+    {
+        Page loadedPage;
+        const Page * page = &mLastPage;
+
+        if (index != mPageCount - 1)
+        {
+            ReturnErrorOnFailure(LoadPage(index, loadedPage));
+            page = &loadedPage;
+        }
+
+        for (uint16_t i = 0; i < page->mCount; i++)
+        {
+            VerifyOrReturnError(visitor(context, page->mIds[i]), CHIP_NO_ERROR);
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PairedDeviceIndex::LoadPage(uint16_t index, Page & page)
+{
+    uint8_t value[kPageSize * kNodeIdEncodingLength];
+    uint16_t size = sizeof(value);
+    char key[kMaxPageKeyLength];
+
+    GetPageKey(index, key);
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key, value, size));
+    VerifyOrReturnError(size <= sizeof(value) && size % kNodeIdEncodingLength == 0, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+
+    page.mCount = static_cast<uint16_t>(size / kNodeIdEncodingLength);
+    for (uint16_t i = 0; i < page.mCount; i++)
+    {
+        page.mIds[i] = Encoding::LittleEndian::Get64(&value[i * kNodeIdEncodingLength]);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PairedDeviceIndex::StorePage(uint16_t index, const Page & page)
+{
+    uint8_t value[kPageSize * kNodeIdEncodingLength];
+    char key[kMaxPageKeyLength];
+
+    for (uint16_t i = 0; i < page.mCount; i++)
+    {
+        Encoding::LittleEndian::Put64(&value[i * kNodeIdEncodingLength], page.mIds[i]);
+    }
+
+    GetPageKey(index, key);
+    return mStorage->SyncSetKeyValue(key, value, static_cast<uint16_t>(page.mCount * kNodeIdEncodingLength));
+}
+
+CHIP_ERROR PairedDeviceIndex::StorePageCount()
+{
+    uint8_t value[sizeof(uint16_t)];
+
+    Encoding::LittleEndian::Put16(value, mPageCount);
+    return mStorage->SyncSetKeyValue(kPageCountKey, value, sizeof(value));
+}
+
+CHIP_ERROR PairedDeviceIndex::RemoveLastId()
+{
+    char key[kMaxPageKeyLength];
+
+    mLastPage.mCount--;
+    if (mLastPage.mCount > 0)
+    {
+        return StorePage(static_cast<uint16_t>(mPageCount - 1), mLastPage);
+    }
+
+    // An empty last page is dropped, and the page before it becomes the last one.
+    mPageCount--;
+    ReturnErrorOnFailure(StorePageCount());
+    GetPageKey(mPageCount, key);
+    mStorage->SyncDeleteKeyValue(key);
+
+    if (mPageCount > 0)
+    {
+        ReturnErrorOnFailure(LoadPage(static_cast<uint16_t>(mPageCount - 1), mLastPage));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PairedDeviceIndex::MigrateDeviceList()
+{
+    CHIP_ERROR err     = CHIP_NO_ERROR;
+    char * serialized  = static_cast<char *>(chip::Platform::MemoryAlloc(kMaxDeviceListLength));
+    uint8_t * decoded  = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(kMaxDeviceListLength));
+    uint16_t size      = kMaxDeviceListLength;
+    uint16_t decodeLen = 0;
+
+    VerifyOrExit(serialized != nullptr && decoded != nullptr, err = CHIP_ERROR_NO_MEMORY);
+
+    err = mStorage->SyncGetKeyValue(kDeviceListKey, serialized, size);
+    // Without a list there is nothing to move, and the pages are counted once a device is added.
+    VerifyOrExit(err != CHIP_ERROR_KEY_NOT_FOUND, err = CHIP_NO_ERROR);
+    SuccessOrExit(err);
+    VerifyOrExit(size <= kMaxDeviceListLength, err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+
+    // The list may have been stored with its null terminator.
+    while (size > 0 && serialized[size - 1] == '\0')
+    {
+        size--;
+    }
+    decodeLen = Base64Decode(serialized, size, decoded);
+    VerifyOrExit(decodeLen != UINT16_MAX && decodeLen % kNodeIdEncodingLength == 0, err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+
+    for (uint16_t offset = 0; offset < decodeLen; offset = static_cast<uint16_t>(offset + kNodeIdEncodingLength))
+    {
+        NodeId deviceId = Encoding::LittleEndian::Get64(&decoded[offset]);
+
+        // The list has holes where devices were removed.
+        if (deviceId == kUndefinedNodeId)
+        {
+            continue;
+        }
+
+        if (mPageCount == 0 || mLastPage.mCount == kPageSize)
+        {
+            VerifyOrExit(mPageCount < kMaxPages, err = CHIP_ERROR_NO_MEMORY);
+            if (mPageCount > 0)
+            {
+                SuccessOrExit(err = StorePage(static_cast<uint16_t>(mPageCount - 1), mLastPage));
+            }
+            mPageCount++;
+            mLastPage.mCount = 0;
+        }
+        mLastPage.mIds[mLastPage.mCount++] = deviceId;
+    }
+
+    if (mPageCount > 0)
+    {
+        SuccessOrExit(err = StorePage(static_cast<uint16_t>(mPageCount - 1), mLastPage));
+    }
+    SuccessOrExit(err = StorePageCount());
+
+    mStorage->SyncDeleteKeyValue(kDeviceListKey);
+    ChipLogProgress(Controller, "Moved the paired device list to %u index pages", mPageCount);
+
+exit:
+    chip::Platform::MemoryFree(serialized);
+    chip::Platform::MemoryFree(decoded);
+    if (err != CHIP_NO_ERROR)
+    {
+        mPageCount       = 0;
+        mLastPage.mCount = 0;
+    }
+    return err;
+}
+
+} // namespace Controller
+} // namespace chip
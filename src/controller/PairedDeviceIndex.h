@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    This file contains the definition of the persisted index of the node IDs
+ *    of the devices paired by a CHIP device commissioner.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <core/CHIPError.h>
+#include <core/CHIPPersistentStorageDelegate.h>
+#include <transport/raw/MessageHeader.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * The node IDs of the paired devices, persisted in pages of kPageSize IDs that are stored under keys of their own, along
+ * with the number of pages. Every page but the last one is full, so that pairing a device only rewrites the last page,
+ * and unpairing one rewrites its page and the last one. Only the last page is held in memory.
+ *
+ * The paired node IDs of earlier controllers, persisted as a single base64 encoded SerializableU64Set, are moved to the
+ * pages when the index is first initialized.
+ */
+class PairedDeviceIndex
+{
+public:
+    static constexpr uint16_t kPageSize = CHIP_CONFIG_CONTROLLER_PAIRED_DEVICE_INDEX_PAGE_SIZE;
+    static constexpr uint16_t kMaxPages =
+        static_cast<uint16_t>((CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES + kPageSize - 1) / kPageSize);
+
+    static_assert(kPageSize > 0, "The pages of the paired device index need room for a node ID");
+
+    /// Called with every paired node ID by ForEach, which stops when it returns false.
+    typedef bool (*Visitor)(void * context, NodeId deviceId);
+
+    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+
+    /**
+     * Add a node ID, which must not be in the index already.
+     *
+     * @return CHIP_ERROR   CHIP_ERROR_NO_MEMORY if CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES node IDs are in the index
+     */
+    CHIP_ERROR Add(NodeId deviceId);
+
+    /**
+     * @return CHIP_ERROR   CHIP_ERROR_KEY_NOT_FOUND if the node ID is not in the index
+     */
+    CHIP_ERROR Remove(NodeId deviceId);
+
+    CHIP_ERROR ForEach(Visitor visitor, void * context);
+
+    bool IsInitialized() const { return mStorage != nullptr; }
+
+private:
+    struct Page
+    {
+        NodeId mIds[kPageSize];
+        uint16_t mCount = 0;
+    };
+
+    CHIP_ERROR LoadPage(uint16_t index, Page & page);
+    CHIP_ERROR StorePage(uint16_t index, const Page & page);
+    CHIP_ERROR StorePageCount();
+    CHIP_ERROR RemoveLastId();
+    CHIP_ERROR MigrateDeviceList();
+
+    PersistentStorageDelegate * mStorage = nullptr;
+    uint16_t mPageCount                  = 0;
+    // The last page, mPageCount - 1
+    Page mLastPage;
+};
+
+} // namespace Controller
+} // namespace chip
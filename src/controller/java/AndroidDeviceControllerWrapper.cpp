@@ -21,7 +21,9 @@
 #include <algorithm>
 #include <memory>
 
+#include <core/CHIPEncoding.h>
 #include <platform/KeyValueStoreManager.h>
+#include <support/SafeInt.h>
 #include <support/ThreadOperationalDataset.h>
 
 using chip::Controller::DeviceCommissioner;
@@ -55,23 +57,14 @@ bool FindMethod(JNIEnv * env, jobject object, const char * methodName, const cha
     return true;
 }
 
-void CallVoidInt(JNIEnv * env, jobject object, const char * methodName, jint argument)
-{
-    jmethodID method;
-
-    if (!FindMethod(env, object, methodName, "(I)V", &method))
-    {
-        return;
-    }
-
-    env->ExceptionClear();
-    env->CallVoidMethod(object, method, argument);
-}
-
 } // namespace
 
 AndroidDeviceControllerWrapper::~AndroidDeviceControllerWrapper()
 {
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(DeliverMessages, this);
+    }
     if ((mJavaVM != nullptr) && (mJavaObjectRef != nullptr))
     {
         GetJavaEnv()->DeleteGlobalRef(mJavaObjectRef);
@@ -81,21 +74,113 @@ AndroidDeviceControllerWrapper::~AndroidDeviceControllerWrapper()
 
 void AndroidDeviceControllerWrapper::SetJavaObjectRef(JavaVM * vm, jobject obj)
 {
+    JNIEnv * env;
+
     mJavaVM        = vm;
-    mJavaObjectRef = GetJavaEnv()->NewGlobalRef(obj);
+    env            = GetJavaEnv();
+    mJavaObjectRef = env->NewGlobalRef(obj);
+
+    // Method ids stay valid as long as the class is loaded, which the global reference guarantees.
+    FindMethod(env, mJavaObjectRef, "onStatusUpdate", "(I)V", &mOnStatusUpdateMethod);
+    FindMethod(env, mJavaObjectRef, "onPairingComplete", "(I)V", &mOnPairingCompleteMethod);
+    FindMethod(env, mJavaObjectRef, "onPairingDeleted", "(I)V", &mOnPairingDeletedMethod);
+    FindMethod(env, mJavaObjectRef, "onConnectDeviceComplete", "()V", &mOnConnectDeviceCompleteMethod);
+    FindMethod(env, mJavaObjectRef, "onMessagesReceived", "(Ljava/nio/ByteBuffer;I)V", &mOnMessagesReceivedMethod);
 }
 
-JNIEnv * AndroidDeviceControllerWrapper::GetJavaEnv()
+CHIP_ERROR AndroidDeviceControllerWrapper::EnableMessageDelivery(chip::Controller::Device * device)
 {
-    if (mJavaVM == nullptr)
+    VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mOnMessagesReceivedMethod != nullptr, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+
+    std::unique_ptr<MessageForwarder> & forwarder = mMessageForwarders[device->GetDeviceId()];
+    if (!forwarder)
     {
-        return nullptr;
+        forwarder.reset(new MessageForwarder(this, device->GetDeviceId()));
+        VerifyOrReturnError(forwarder, CHIP_ERROR_NO_MEMORY);
+    }
+    device->SetDelegate(forwarder.get());
+    return CHIP_NO_ERROR;
+}
+
+void AndroidDeviceControllerWrapper::CallVoidInt(jmethodID method, jint argument)
+{
+    JNIEnv * env = GetJavaEnv();
+
+    if ((env == nullptr) || (mJavaObjectRef == nullptr) || (method == nullptr))
+    {
+        return;
+    }
+
+    env->ExceptionClear();
+    env->CallVoidMethod(mJavaObjectRef, method, argument);
+}
+
+void AndroidDeviceControllerWrapper::QueueMessage(chip::NodeId nodeId, chip::System::PacketBufferHandle msg)
+{
+    using namespace chip::Encoding;
+
+    VerifyOrReturn(!msg.IsNull() && !msg->HasChainedBuffer());
+    VerifyOrReturn(chip::CanCastTo<uint16_t>(msg->DataLength()));
+
+    const uint16_t length = static_cast<uint16_t>(msg->DataLength());
+    const size_t offset   = mPendingMessages.size();
+
+    if (offset + sizeof(uint64_t) + sizeof(uint16_t) + length > kMaxPendingMessagesSize && mPendingMessageCount > 0)
+    {
+        mSystemLayer->CancelTimer(DeliverMessages, this);
+        DeliverMessages();
+        QueueMessage(nodeId, std::move(msg));
+        return;
+    }
+
+    // The first message of a batch schedules its delivery, after the events being handled.
+    if (mPendingMessageCount == 0 &&
+        (mSystemLayer == nullptr || mSystemLayer->ScheduleWork(DeliverMessages, this) != CHIP_SYSTEM_NO_ERROR))
+    {
+        ChipLogError(Controller, "Failed to schedule the delivery of a message");
+        return;
     }
 
-    JNIEnv * env = nullptr;
-    mJavaVM->GetEnv((void **) &env, JNI_VERSION_1_6);
+    // Big endian, as java.nio.ByteBuffer reads by default
+    mPendingMessages.resize(offset + sizeof(uint64_t) + sizeof(uint16_t) + length);
+    uint8_t * p = &mPendingMessages[offset];
+    BigEndian::Write64(p, nodeId);
+    BigEndian::Write16(p, length);
+    memcpy(p, msg->Start(), length);
+    mPendingMessageCount++;
+}
+
+void AndroidDeviceControllerWrapper::DeliverMessages(chip::System::Layer * layer, void * appState, chip::System::Error error)
+{
+    static_cast<AndroidDeviceControllerWrapper *>(appState)->DeliverMessages();
+}
+
+void AndroidDeviceControllerWrapper::DeliverMessages()
+{
+    JNIEnv * env     = GetJavaEnv();
+    jobject messages = nullptr;
+
+    VerifyOrReturn(mPendingMessageCount > 0);
+    VerifyOrExit(env != nullptr, ChipLogError(Controller, "Missing java environment"));
+
+    // The buffer wraps the pending messages without copying them, and is only valid during the call.
+    messages = env->NewDirectByteBuffer(mPendingMessages.data(), static_cast<jlong>(mPendingMessages.size()));
+    VerifyOrExit(messages != nullptr, ChipLogError(Controller, "Failed to wrap the received messages"));
+
+    env->ExceptionClear();
+    env->CallVoidMethod(mJavaObjectRef, mOnMessagesReceivedMethod, messages, static_cast<jint>(mPendingMessageCount));
+    if (env->ExceptionCheck())
+    {
+        ChipLogError(Controller, "Java exception thrown in onMessagesReceived");
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+    env->DeleteLocalRef(messages);
 
-    return env;
+exit:
+    mPendingMessages.clear();
+    mPendingMessageCount = 0;
 }
 
 AndroidDeviceControllerWrapper * AndroidDeviceControllerWrapper::AllocateNew(JavaVM * vm, jobject deviceControllerObj,
@@ -132,6 +217,7 @@ AndroidDeviceControllerWrapper * AndroidDeviceControllerWrapper::AllocateNew(Jav
     }
     std::unique_ptr<AndroidDeviceControllerWrapper> wrapper(new AndroidDeviceControllerWrapper(std::move(controller)));
 
+    wrapper->mSystemLayer = systemLayer;
     wrapper->SetJavaObjectRef(vm, deviceControllerObj);
     wrapper->Controller()->SetUdpListenPort(CHIP_PORT + 1);
 
@@ -162,17 +248,17 @@ AndroidDeviceControllerWrapper * AndroidDeviceControllerWrapper::AllocateNew(Jav
 
 void AndroidDeviceControllerWrapper::OnStatusUpdate(chip::Controller::DevicePairingDelegate::Status status)
 {
-    CallVoidInt(GetJavaEnv(), mJavaObjectRef, "onStatusUpdate", static_cast<jint>(status));
+    CallVoidInt(mOnStatusUpdateMethod, static_cast<jint>(status));
 }
 
 void AndroidDeviceControllerWrapper::OnPairingComplete(CHIP_ERROR error)
 {
-    CallVoidInt(GetJavaEnv(), mJavaObjectRef, "onPairingComplete", static_cast<jint>(error));
+    CallVoidInt(mOnPairingCompleteMethod, static_cast<jint>(error));
 }
 
 void AndroidDeviceControllerWrapper::OnPairingDeleted(CHIP_ERROR error)
 {
-    CallVoidInt(GetJavaEnv(), mJavaObjectRef, "onPairingDeleted", static_cast<jint>(error));
+    CallVoidInt(mOnPairingDeletedMethod, static_cast<jint>(error));
 }
 
 void AndroidDeviceControllerWrapper::OnMessage(chip::System::PacketBufferHandle msg) {}
@@ -18,6 +18,8 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <jni.h>
 
@@ -40,6 +42,14 @@ public:
     chip::Controller::DeviceCommissioner * Controller() { return mController.get(); }
     void SetJavaObjectRef(JavaVM * vm, jobject obj);
 
+    /**
+     * Delivers the messages of device to the onMessagesReceived method of the java object, rather than to the callbacks of
+     * the device.
+     *
+     * The messages received while the stack handles a batch of events are delivered together, in a single direct ByteBuffer.
+     */
+    CHIP_ERROR EnableMessageDelivery(chip::Controller::Device * device);
+
     // DevicePairingDelegate implementation
     void OnStatusUpdate(chip::Controller::DevicePairingDelegate::Status status) override;
     void OnPairingComplete(CHIP_ERROR error) override;
@@ -61,6 +71,7 @@ public:
     }
 
     jobject JavaObjectRef() { return mJavaObjectRef; }
+    jmethodID OnConnectDeviceCompleteMethod() { return mOnConnectDeviceCompleteMethod; }
 
     static AndroidDeviceControllerWrapper * FromJNIHandle(jlong handle)
     {
@@ -74,13 +85,49 @@ public:
 private:
     using ChipDeviceControllerPtr = std::unique_ptr<chip::Controller::DeviceCommissioner>;
 
+    // Forwards the messages of one device, tagged with its node id.
+    class MessageForwarder : public chip::Controller::DeviceStatusDelegate
+    {
+    public:
+        MessageForwarder(AndroidDeviceControllerWrapper * wrapper, chip::NodeId nodeId) : mWrapper(wrapper), mNodeId(nodeId) {}
+
+        void OnMessage(chip::System::PacketBufferHandle msg) override { mWrapper->QueueMessage(mNodeId, std::move(msg)); }
+        void OnStatusChange(void) override {}
+
+    private:
+        AndroidDeviceControllerWrapper * mWrapper;
+        chip::NodeId mNodeId;
+    };
+
+    // The size above which the pending messages are delivered without waiting for the end of the batch
+    static constexpr size_t kMaxPendingMessagesSize = 16 * 1024;
+
     ChipDeviceControllerPtr mController;
+    chip::System::Layer * mSystemLayer = nullptr;
 
     JavaVM * mJavaVM       = nullptr;
     jobject mJavaObjectRef = nullptr;
 
+    // The methods of the java object, looked up once
+    jmethodID mOnStatusUpdateMethod          = nullptr;
+    jmethodID mOnPairingCompleteMethod       = nullptr;
+    jmethodID mOnPairingDeletedMethod        = nullptr;
+    jmethodID mOnConnectDeviceCompleteMethod = nullptr;
+    jmethodID mOnMessagesReceivedMethod      = nullptr;
+
+    std::unordered_map<chip::NodeId, std::unique_ptr<MessageForwarder>> mMessageForwarders;
+
+    // The messages not delivered yet, each as its node id, length and payload
+    std::vector<uint8_t> mPendingMessages;
+    uint32_t mPendingMessageCount = 0;
+
     JNIEnv * GetJavaEnv();
 
+    void CallVoidInt(jmethodID method, jint argument);
+    void QueueMessage(chip::NodeId nodeId, chip::System::PacketBufferHandle msg);
+    void DeliverMessages();
+    static void DeliverMessages(chip::System::Layer * layer, void * appState, chip::System::Error error);
+
     jclass GetPersistentStorageClass() { return GetJavaEnv()->FindClass("chip/devicecontroller/PersistentStorage"); }
 
     AndroidDeviceControllerWrapper(ChipDeviceControllerPtr controller) : mController(std::move(controller)) {}
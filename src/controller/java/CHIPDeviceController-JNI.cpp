@@ -96,6 +96,17 @@ bool sShutdown             = false;
 
 jclass sAndroidChipStackCls              = NULL;
 jclass sChipDeviceControllerExceptionCls = NULL;
+jclass sChipCommandTypeCls               = NULL;
+
+// Methods looked up once at load, rather than on each call
+jmethodID sOnNotifyChipConnectionClosedMethod      = NULL;
+jmethodID sOnSendCharacteristicMethod              = NULL;
+jmethodID sOnSubscribeCharacteristicMethod         = NULL;
+jmethodID sOnUnsubscribeCharacteristicMethod       = NULL;
+jmethodID sOnCloseConnectionMethod                 = NULL;
+jmethodID sOnGetMTUMethod                          = NULL;
+jmethodID sChipDeviceControllerExceptionCtorMethod = NULL;
+jmethodID sChipCommandTypeGetValueMethod           = NULL;
 
 /** A scoped lock/unlock around a mutex. */
 class ScopedPthreadLock
@@ -158,8 +169,30 @@ jint JNI_OnLoad(JavaVM * jvm, void * reserved)
     SuccessOrExit(err);
     err = GetClassRef(env, "chip/devicecontroller/ChipDeviceControllerException", sChipDeviceControllerExceptionCls);
     SuccessOrExit(err);
+    err = GetClassRef(env, "chip/devicecontroller/ChipCommandType", sChipCommandTypeCls);
+    SuccessOrExit(err);
     ChipLogProgress(Controller, "Java class references loaded.");
 
+    err = GetStaticMethodRef(env, sAndroidChipStackCls, "onNotifyChipConnectionClosed", "(I)V",
+                             sOnNotifyChipConnectionClosedMethod);
+    SuccessOrExit(err);
+    err = GetStaticMethodRef(env, sAndroidChipStackCls, "onSendCharacteristic", "(I[B[B[B)Z", sOnSendCharacteristicMethod);
+    SuccessOrExit(err);
+    err = GetStaticMethodRef(env, sAndroidChipStackCls, "onSubscribeCharacteristic", "(I[B[B)Z", sOnSubscribeCharacteristicMethod);
+    SuccessOrExit(err);
+    err = GetStaticMethodRef(env, sAndroidChipStackCls, "onUnsubscribeCharacteristic", "(I[B[B)Z",
+                             sOnUnsubscribeCharacteristicMethod);
+    SuccessOrExit(err);
+    err = GetStaticMethodRef(env, sAndroidChipStackCls, "onCloseConnection", "(I)Z", sOnCloseConnectionMethod);
+    SuccessOrExit(err);
+    err = GetStaticMethodRef(env, sAndroidChipStackCls, "onGetMTU", "(I)I", sOnGetMTUMethod);
+    SuccessOrExit(err);
+    err = GetMethodRef(env, sChipDeviceControllerExceptionCls, "<init>", "(ILjava/lang/String;)V",
+                       sChipDeviceControllerExceptionCtorMethod);
+    SuccessOrExit(err);
+    err = GetMethodRef(env, sChipCommandTypeCls, "getValue", "()I", sChipCommandTypeGetValueMethod);
+    SuccessOrExit(err);
+
     // Initialize the CHIP System Layer.
     err = sSystemLayer.Init(NULL);
     SuccessOrExit(err);
@@ -452,6 +485,67 @@ JNI_METHOD(void, sendMessage)(JNIEnv * env, jobject self, jlong handle, jlong de
     }
 }
 
+JNI_METHOD(void, sendMessageBuffer)
+(JNIEnv * env, jobject self, jlong handle, jlong deviceId, jobject bufferObj, jint offset, jint length)
+{
+    CHIP_ERROR err      = CHIP_NO_ERROR;
+    Device * chipDevice = nullptr;
+
+    // The payload is read in place from the direct buffer, without a java array copy.
+    const uint8_t * data = static_cast<const uint8_t *>(env->GetDirectBufferAddress(bufferObj));
+    jlong capacity       = env->GetDirectBufferCapacity(bufferObj);
+
+    VerifyOrExit(data != nullptr && offset >= 0 && length >= 0 && offset <= capacity - length, err = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(CanCastTo<uint16_t>(length), err = CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    GetCHIPDevice(env, handle, deviceId, &chipDevice);
+    // GetCHIPDevice has thrown the error
+    VerifyOrReturn(chipDevice != nullptr);
+
+    {
+        ScopedPthreadLock lock(&sStackLock);
+
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::NewWithData(data + offset, static_cast<size_t>(length));
+        if (buffer.IsNull())
+        {
+            err = CHIP_ERROR_NO_MEMORY;
+        }
+        else
+        {
+            err = chipDevice->SendMessage(Protocols::TempZCL::Id, 0, std::move(buffer));
+        }
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to send message.");
+        ThrowError(env, err);
+    }
+}
+
+JNI_METHOD(void, enableMessageDelivery)(JNIEnv * env, jobject self, jlong handle, jlong deviceId)
+{
+    AndroidDeviceControllerWrapper * wrapper = AndroidDeviceControllerWrapper::FromJNIHandle(handle);
+    CHIP_ERROR err                           = CHIP_NO_ERROR;
+    Device * chipDevice                      = nullptr;
+
+    {
+        ScopedPthreadLock lock(&sStackLock);
+        err = wrapper->Controller()->GetDevice(deviceId, &chipDevice);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = wrapper->EnableMessageDelivery(chipDevice);
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to enable the delivery of messages.");
+        ThrowError(env, err);
+    }
+}
+
 JNI_METHOD(void, sendCommand)(JNIEnv * env, jobject self, jlong handle, jlong deviceId, jobject commandObj, jint aValue)
 {
     CHIP_ERROR err      = CHIP_NO_ERROR;
@@ -461,9 +555,7 @@ JNI_METHOD(void, sendCommand)(JNIEnv * env, jobject self, jlong handle, jlong de
 
     ChipLogProgress(Controller, "sendCommand() called");
 
-    jclass commandCls         = env->GetObjectClass(commandObj);
-    jmethodID commandMethodID = env->GetMethodID(commandCls, "getValue", "()I");
-    jint commandID            = env->CallIntMethod(commandObj, commandMethodID);
+    jint commandID = env->CallIntMethod(commandObj, sChipCommandTypeGetValueMethod);
 
     {
         ScopedPthreadLock lock(&sStackLock);
@@ -654,21 +746,17 @@ void HandleNotifyChipConnectionClosed(BLE_CONNECTION_OBJECT connObj)
     StackUnlockGuard unlockGuard;
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env;
-    jmethodID method;
     intptr_t tmpConnObj;
 
     ChipLogProgress(Controller, "Received NotifyChipConnectionClosed");
 
     sJVM->GetEnv((void **) &env, JNI_VERSION_1_6);
 
-    method = env->GetStaticMethodID(sAndroidChipStackCls, "onNotifyChipConnectionClosed", "(I)V");
-    VerifyOrExit(method != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
-
     ChipLogProgress(Controller, "Calling Java NotifyChipConnectionClosed");
 
     env->ExceptionClear();
     tmpConnObj = reinterpret_cast<intptr_t>(connObj);
-    env->CallStaticVoidMethod(sAndroidChipStackCls, method, static_cast<jint>(tmpConnObj));
+    env->CallStaticVoidMethod(sAndroidChipStackCls, sOnNotifyChipConnectionClosedMethod, static_cast<jint>(tmpConnObj));
     VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
 
 exit:
@@ -688,7 +776,6 @@ bool HandleSendCharacteristic(BLE_CONNECTION_OBJECT connObj, const uint8_t * svc
     jbyteArray svcIdObj;
     jbyteArray charIdObj;
     jbyteArray characteristicDataObj;
-    jmethodID method;
     intptr_t tmpConnObj;
     bool rc = false;
 
@@ -705,15 +792,12 @@ bool HandleSendCharacteristic(BLE_CONNECTION_OBJECT connObj, const uint8_t * svc
     err = N2J_ByteArray(env, characteristicData, characteristicDataLen, characteristicDataObj);
     SuccessOrExit(err);
 
-    method = env->GetStaticMethodID(sAndroidChipStackCls, "onSendCharacteristic", "(I[B[B[B)Z");
-    VerifyOrExit(method != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
-
     ChipLogProgress(Controller, "Calling Java SendCharacteristic");
 
     env->ExceptionClear();
     tmpConnObj = reinterpret_cast<intptr_t>(connObj);
-    rc = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, method, static_cast<jint>(tmpConnObj), svcIdObj, charIdObj,
-                                             characteristicDataObj);
+    rc = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, sOnSendCharacteristicMethod, static_cast<jint>(tmpConnObj),
+                                             svcIdObj, charIdObj, characteristicDataObj);
     VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
 
 exit:
@@ -734,7 +818,6 @@ bool HandleSubscribeCharacteristic(BLE_CONNECTION_OBJECT connObj, const uint8_t
     JNIEnv * env;
     jbyteArray svcIdObj;
     jbyteArray charIdObj;
-    jmethodID method;
     intptr_t tmpConnObj;
     bool rc = false;
 
@@ -748,14 +831,12 @@ bool HandleSubscribeCharacteristic(BLE_CONNECTION_OBJECT connObj, const uint8_t
     err = N2J_ByteArray(env, charId, 16, charIdObj);
     SuccessOrExit(err);
 
-    method = env->GetStaticMethodID(sAndroidChipStackCls, "onSubscribeCharacteristic", "(I[B[B)Z");
-    VerifyOrExit(method != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
-
     ChipLogProgress(Controller, "Calling Java SubscribeCharacteristic");
 
     env->ExceptionClear();
     tmpConnObj = reinterpret_cast<intptr_t>(connObj);
-    rc = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, method, static_cast<jint>(tmpConnObj), svcIdObj, charIdObj);
+    rc = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, sOnSubscribeCharacteristicMethod, static_cast<jint>(tmpConnObj),
+                                             svcIdObj, charIdObj);
     VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
 
 exit:
@@ -776,7 +857,6 @@ bool HandleUnsubscribeCharacteristic(BLE_CONNECTION_OBJECT connObj, const uint8_
     JNIEnv * env;
     jbyteArray svcIdObj;
     jbyteArray charIdObj;
-    jmethodID method;
     intptr_t tmpConnObj;
     bool rc = false;
 
@@ -790,14 +870,12 @@ bool HandleUnsubscribeCharacteristic(BLE_CONNECTION_OBJECT connObj, const uint8_
     err = N2J_ByteArray(env, charId, 16, charIdObj);
     SuccessOrExit(err);
 
-    method = env->GetStaticMethodID(sAndroidChipStackCls, "onUnsubscribeCharacteristic", "(I[B[B)Z");
-    VerifyOrExit(method != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
-
     ChipLogProgress(Controller, "Calling Java UnsubscribeCharacteristic");
 
     env->ExceptionClear();
     tmpConnObj = reinterpret_cast<intptr_t>(connObj);
-    rc = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, method, static_cast<jint>(tmpConnObj), svcIdObj, charIdObj);
+    rc = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, sOnUnsubscribeCharacteristicMethod,
+                                             static_cast<jint>(tmpConnObj), svcIdObj, charIdObj);
     VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
 
 exit:
@@ -816,7 +894,6 @@ bool HandleCloseConnection(BLE_CONNECTION_OBJECT connObj)
     StackUnlockGuard unlockGuard;
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env;
-    jmethodID method;
     intptr_t tmpConnObj;
     bool rc = false;
 
@@ -824,14 +901,11 @@ bool HandleCloseConnection(BLE_CONNECTION_OBJECT connObj)
 
     sJVM->GetEnv((void **) &env, JNI_VERSION_1_6);
 
-    method = env->GetStaticMethodID(sAndroidChipStackCls, "onCloseConnection", "(I)Z");
-    VerifyOrExit(method != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
-
     ChipLogProgress(Controller, "Calling Java CloseConnection");
 
     env->ExceptionClear();
     tmpConnObj = reinterpret_cast<intptr_t>(connObj);
-    rc         = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, method, static_cast<jint>(tmpConnObj));
+    rc         = (bool) env->CallStaticBooleanMethod(sAndroidChipStackCls, sOnCloseConnectionMethod, static_cast<jint>(tmpConnObj));
     VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
 
 exit:
@@ -849,7 +923,6 @@ uint16_t HandleGetMTU(BLE_CONNECTION_OBJECT connObj)
     StackUnlockGuard unlockGuard;
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env;
-    jmethodID method;
     intptr_t tmpConnObj;
     uint16_t mtu = 0;
 
@@ -857,14 +930,11 @@ uint16_t HandleGetMTU(BLE_CONNECTION_OBJECT connObj)
 
     sJVM->GetEnv((void **) &env, JNI_VERSION_1_6);
 
-    method = env->GetStaticMethodID(sAndroidChipStackCls, "onGetMTU", "(I)I");
-    VerifyOrExit(method != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
-
     ChipLogProgress(Controller, "Calling Java onGetMTU");
 
     env->ExceptionClear();
     tmpConnObj = reinterpret_cast<intptr_t>(connObj);
-    mtu        = (int16_t) env->CallStaticIntMethod(sAndroidChipStackCls, method, static_cast<jint>(tmpConnObj));
+    mtu        = (int16_t) env->CallStaticIntMethod(sAndroidChipStackCls, sOnGetMTUMethod, static_cast<jint>(tmpConnObj));
     VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
 
 exit:
@@ -883,19 +953,14 @@ void HandleNewConnection(void * appState, const uint16_t discriminator)
     StackUnlockGuard unlockGuard;
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env;
-    jmethodID method;
-    jclass deviceControllerCls;
     AndroidDeviceControllerWrapper * wrapper = reinterpret_cast<AndroidDeviceControllerWrapper *>(appState);
     jobject self                             = wrapper->JavaObjectRef();
+    jmethodID method                         = wrapper->OnConnectDeviceCompleteMethod();
 
     ChipLogProgress(Controller, "Received New Connection");
 
     sJVM->GetEnv((void **) &env, JNI_VERSION_1_6);
 
-    deviceControllerCls = env->GetObjectClass(self);
-    VerifyOrExit(deviceControllerCls != NULL, err = CHIP_JNI_ERROR_TYPE_NOT_FOUND);
-
-    method = env->GetMethodID(deviceControllerCls, "onConnectDeviceComplete", "()V");
     VerifyOrExit(method != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
 
     ChipLogProgress(Controller, "Calling Java onConnectDeviceComplete");
@@ -1039,10 +1104,8 @@ CHIP_ERROR N2J_Error(JNIEnv * env, CHIP_ERROR inErr, jthrowable & outEx)
     CHIP_ERROR err      = CHIP_NO_ERROR;
     const char * errStr = NULL;
     jstring errStrObj   = NULL;
-    jmethodID constructor;
 
-    constructor = env->GetMethodID(sChipDeviceControllerExceptionCls, "<init>", "(ILjava/lang/String;)V");
-    VerifyOrExit(constructor != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+    VerifyOrExit(sChipDeviceControllerExceptionCtorMethod != NULL, err = CHIP_JNI_ERROR_METHOD_NOT_FOUND);
 
     switch (inErr)
     {
@@ -1062,7 +1125,8 @@ CHIP_ERROR N2J_Error(JNIEnv * env, CHIP_ERROR inErr, jthrowable & outEx)
     errStrObj = (errStr != NULL) ? env->NewStringUTF(errStr) : NULL;
 
     env->ExceptionClear();
-    outEx = (jthrowable) env->NewObject(sChipDeviceControllerExceptionCls, constructor, (jint) inErr, errStrObj);
+    outEx = (jthrowable) env->NewObject(sChipDeviceControllerExceptionCls, sChipDeviceControllerExceptionCtorMethod, (jint) inErr,
+                                        errStrObj);
     VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
 
 exit:
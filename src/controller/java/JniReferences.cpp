@@ -36,3 +36,18 @@ exit:
     env->DeleteLocalRef(cls);
     return err;
 }
+
+CHIP_ERROR GetMethodRef(JNIEnv * env, jclass cls, const char * methodName, const char * methodSignature, jmethodID & outMethod)
+{
+    outMethod = env->GetMethodID(cls, methodName, methodSignature);
+    VerifyOrReturnError(outMethod != NULL, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR GetStaticMethodRef(JNIEnv * env, jclass cls, const char * methodName, const char * methodSignature,
+                              jmethodID & outMethod)
+{
+    outMethod = env->GetStaticMethodID(cls, methodName, methodSignature);
+    VerifyOrReturnError(outMethod != NULL, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+    return CHIP_NO_ERROR;
+}
@@ -22,3 +22,10 @@
 #include <core/CHIPError.h>
 
 CHIP_ERROR GetClassRef(JNIEnv * env, const char * clsType, jclass & outCls);
+
+/**
+ * Looks up a method of cls, to be cached along with a global reference to cls.
+ */
+CHIP_ERROR GetMethodRef(JNIEnv * env, jclass cls, const char * methodName, const char * methodSignature, jmethodID & outMethod);
+CHIP_ERROR GetStaticMethodRef(JNIEnv * env, jclass cls, const char * methodName, const char * methodSignature,
+                              jmethodID & outMethod);
@@ -20,6 +20,7 @@ package chip.devicecontroller;
 import android.bluetooth.BluetoothGatt;
 import android.bluetooth.BluetoothGattCallback;
 import android.util.Log;
+import java.nio.ByteBuffer;
 
 /** Controller to interact with the CHIP device. */
 public class ChipDeviceController {
@@ -29,6 +30,7 @@ public class ChipDeviceController {
   private int connectionId;
   private BluetoothGatt bleGatt;
   private CompletionListener completionListener;
+  private MessageListener messageListener;
 
   public ChipDeviceController() {
     deviceControllerPtr = newDeviceController();
@@ -38,6 +40,10 @@ public class ChipDeviceController {
     completionListener = listener;
   }
 
+  public void setMessageListener(MessageListener listener) {
+    messageListener = listener;
+  }
+
   public BluetoothGatt getBluetoothGatt() {
     return bleGatt;
   }
@@ -160,6 +166,29 @@ public class ChipDeviceController {
     sendMessage(deviceControllerPtr, deviceId, message);
   }
 
+  /**
+   * Sends the remaining bytes of payload, which must be a direct buffer, without copying them to a
+   * Java array.
+   */
+  public void sendMessage(long deviceId, ByteBuffer payload) {
+    if (!payload.isDirect()) {
+      throw new IllegalArgumentException("payload must be a direct ByteBuffer");
+    }
+    sendMessageBuffer(
+        deviceControllerPtr, deviceId, payload, payload.position(), payload.remaining());
+  }
+
+  /** Delivers the messages received from the device to the message listener. */
+  public void enableMessageDelivery(long deviceId) {
+    enableMessageDelivery(deviceControllerPtr, deviceId);
+  }
+
+  public void onMessagesReceived(ByteBuffer messages, int count) {
+    if (messageListener != null) {
+      messageListener.onMessagesReceived(messages, count);
+    }
+  }
+
   public void sendCommand(long deviceId, ChipCommandType command, int value) {
     sendCommand(deviceControllerPtr, deviceId, command, value);
   }
@@ -189,6 +218,11 @@ public class ChipDeviceController {
 
   private native void sendMessage(long deviceControllerPtr, long deviceId, String message);
 
+  private native void sendMessageBuffer(
+      long deviceControllerPtr, long deviceId, ByteBuffer payload, int offset, int length);
+
+  private native void enableMessageDelivery(long deviceControllerPtr, long deviceId);
+
   private native void sendCommand(
       long deviceControllerPtr, long deviceId, ChipCommandType command, int value);
 
@@ -237,4 +271,14 @@ public class ChipDeviceController {
     /** Notifies the listener of the error. */
     void onError(Throwable error);
   }
+
+  /** Interface to receive the messages of the devices for which delivery was enabled. */
+  public interface MessageListener {
+
+    /**
+     * Notifies a batch of count messages, each as its 8 byte sender node id, 2 byte payload length
+     * and payload, from the position of messages. messages is only valid during the call.
+     */
+    void onMessagesReceived(ByteBuffer messages, int count);
+  }
 }
@@ -50,6 +50,7 @@
 #include <controller/CHIPDevice.h>
 #include <controller/CHIPDeviceController.h>
 #include <mdns/Resolver.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <support/CHIPMem.h>
 #include <support/CodeUtils.h>
 #include <support/DLLUtil.h>
@@ -110,6 +111,8 @@ CHIP_ERROR pychip_Stack_Shutdown();
 const char * pychip_Stack_ErrorToString(CHIP_ERROR err);
 const char * pychip_Stack_StatusReportToString(uint32_t profileId, uint16_t statusCode);
 void pychip_Stack_SetLogFunct(LogMessageFunct logFunct);
+void pychip_Stack_LockChipStack();
+void pychip_Stack_UnlockChipStack();
 
 CHIP_ERROR pychip_GetDeviceByNodeId(chip::Controller::DeviceCommissioner * devCtrl, chip::NodeId nodeId,
                                     chip::Controller::Device ** device);
@@ -302,6 +305,16 @@ uint64_t pychip_GetCommandSenderHandle(chip::Controller::Device * device)
     return sender == nullptr ? 0 : reinterpret_cast<uint64_t>(sender);
 }
 
+void pychip_Stack_LockChipStack()
+{
+    chip::DeviceLayer::PlatformMgr().LockChipStack();
+}
+
+void pychip_Stack_UnlockChipStack()
+{
+    chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+}
+
 void pychip_Stack_SetLogFunct(LogMessageFunct logFunct)
 {
     // TODO: determine if log redirection is supposed to be functioning in CHIP
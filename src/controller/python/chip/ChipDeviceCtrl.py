@@ -27,6 +27,7 @@
 
 from __future__ import absolute_import
 from __future__ import print_function
+import asyncio
 import time
 from threading import Thread
 from ctypes import *
@@ -197,6 +198,39 @@ class ChipDeviceController(object):
             return im.WaitCommandIndexStatus(commandSenderHandle, 1)
         return (0, None)
 
+    async def ZCLSendBatch(self, completionQueue, requests):
+        """Sends the cluster commands of requests, each a (cluster, command, nodeid, endpoint, groupid, args) tuple,
+        in a single call, then waits for them all without blocking the event loop. completionQueue is an
+        im.CompletionQueue started on the running event loop. Returns, in the order of requests, the
+        (error, status) of each command or the exception that failed to send it."""
+        requests = list(requests)
+        nodeids = [request[2] for request in requests]
+        if len(set(nodeids)) != len(nodeids):
+            raise ValueError("Each command of a batch must be sent to a different node")
+
+        def Send(cluster, command, nodeid, endpoint, groupid, args):
+            device = c_void_p(None)
+            res = self._dmLib.pychip_GetDeviceByNodeId(self.devCtrl, nodeid, pointer(device))
+            if res != 0:
+                return self._ChipStack.ErrorToException(res)
+            commandSenderHandle = self._dmLib.pychip_GetCommandSenderHandle(device)
+            if commandSenderHandle == 0:
+                return ChipStackError(0, "Node {} does not use the interaction model".format(nodeid))
+            try:
+                sendCommand = self._Cluster.PrepareCommand(device, cluster, command, endpoint, groupid, args)
+                future = completionQueue.Expect(commandSenderHandle)
+            except Exception as ex:
+                return ex
+            res = sendCommand()
+            if res != 0:
+                completionQueue.Forget(commandSenderHandle)
+                return self._ChipStack.ErrorToException(res)
+            return future
+
+        sent = self._ChipStack.CallBatch(
+            [lambda request=request: Send(*request) for request in requests])
+        return [(await result) if isinstance(result, asyncio.Future) else result for result in sent]
+
     def ZCLReadAttribute(self, cluster, attribute, nodeid, endpoint, groupid, blocking=True):
         device = c_void_p(None)
         res = self._ChipStack.Call(lambda: self._dmLib.pychip_GetDeviceByNodeId(
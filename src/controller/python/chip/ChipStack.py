@@ -287,6 +287,16 @@ class ChipStack(object):
             raise self.callbackRes
         return self.callbackRes
 
+    def CallBatch(self, callFuncts):
+        """Calls each of callFuncts with the CHIP stack locked once for them all, so that many requests are
+        started without the CHIP thread running in between. Returns the list of their results."""
+        with self.networkLock:
+            self._ChipStackLib.pychip_Stack_LockChipStack()
+            try:
+                return [callFunct() for callFunct in callFuncts]
+            finally:
+                self._ChipStackLib.pychip_Stack_UnlockChipStack()
+
     def ErrorToException(self, err, devStatusPtr=None):
         if err == 4044 and devStatusPtr:
             devStatus = devStatusPtr.contents
@@ -376,6 +386,10 @@ class ChipStack(object):
             self._ChipStackLib.pychip_Stack_ErrorToString.restype = c_char_p
             self._ChipStackLib.pychip_Stack_SetLogFunct.argtypes = [_LogMessageFunct]
             self._ChipStackLib.pychip_Stack_SetLogFunct.restype = c_uint32
+            self._ChipStackLib.pychip_Stack_LockChipStack.argtypes = []
+            self._ChipStackLib.pychip_Stack_LockChipStack.restype = None
+            self._ChipStackLib.pychip_Stack_UnlockChipStack.argtypes = []
+            self._ChipStackLib.pychip_Stack_UnlockChipStack.restype = None
 
             self._ChipStackLib.pychip_BLEMgrImpl_ConfigureBle.argtypes = [c_uint32]
             self._ChipStackLib.pychip_BLEMgrImpl_ConfigureBle.restype = c_uint32
@@ -19,6 +19,8 @@
 
 #include <support/logging/CHIPLogging.h>
 
+#include <chrono>
+
 using namespace chip::app;
 
 namespace chip {
@@ -33,6 +35,10 @@ CHIP_ERROR PythonInteractionModelDelegate::CommandResponseStatus(const CommandSe
                                                                  chip::CommandId aCommandId, uint8_t aCommandIndex)
 {
     CommandStatus status{ aProtocolId, aProtocolCode, aEndpointId, aClusterId, aCommandId, aCommandIndex };
+    if (QueueStatus(status, reinterpret_cast<uint64_t>(apCommandSender)))
+    {
+        return CHIP_NO_ERROR;
+    }
     if (commandResponseStatusFunct != nullptr)
     {
         commandResponseStatusFunct(reinterpret_cast<uint64_t>(apCommandSender), &status, sizeof(status));
@@ -52,6 +58,10 @@ CHIP_ERROR PythonInteractionModelDelegate::CommandResponseProtocolError(const Co
 
 CHIP_ERROR PythonInteractionModelDelegate::CommandResponseError(const CommandSender * apCommandSender, CHIP_ERROR aError)
 {
+    if (QueueCompletion(reinterpret_cast<uint64_t>(apCommandSender), aError))
+    {
+        return CHIP_NO_ERROR;
+    }
     if (commandResponseErrorFunct != nullptr)
     {
         commandResponseErrorFunct(reinterpret_cast<uint64_t>(apCommandSender), aError);
@@ -64,6 +74,71 @@ CHIP_ERROR PythonInteractionModelDelegate::CommandResponseProcessed(const app::C
     return this->CommandResponseError(apCommandSender, CHIP_NO_ERROR);
 }
 
+void PythonInteractionModelDelegate::SetCompletionQueueEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(mCompletionLock);
+    mCompletionQueueEnabled = enabled;
+    if (!enabled)
+    {
+        mCompletions.clear();
+        mPendingStatuses.clear();
+    }
+}
+
+uint32_t PythonInteractionModelDelegate::WaitForCompletions(CommandCompletion * completions, uint32_t maxCompletions,
+                                                            uint32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(mCompletionLock);
+    uint32_t count = 0;
+
+    mCompletionCondition.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                                  [this] { return !mCompletions.empty() || mWakeRequested; });
+    mWakeRequested = false;
+
+    while (count < maxCompletions && !mCompletions.empty())
+    {
+        completions[count++] = mCompletions.front();
+        mCompletions.pop_front();
+    }
+    return count;
+}
+
+void PythonInteractionModelDelegate::WakeCompletionWaiter()
+{
+    std::lock_guard<std::mutex> lock(mCompletionLock);
+    mWakeRequested = true;
+    mCompletionCondition.notify_all();
+}
+
+bool PythonInteractionModelDelegate::QueueStatus(const CommandStatus & status, uint64_t commandSenderHandle)
+{
+    std::lock_guard<std::mutex> lock(mCompletionLock);
+    VerifyOrReturnError(mCompletionQueueEnabled, false);
+    mPendingStatuses[commandSenderHandle] = status;
+    return true;
+}
+
+bool PythonInteractionModelDelegate::QueueCompletion(uint64_t commandSenderHandle, CHIP_ERROR error)
+{
+    CommandCompletion completion{ commandSenderHandle, static_cast<uint32_t>(error), 0, {} };
+
+    {
+        std::lock_guard<std::mutex> lock(mCompletionLock);
+        VerifyOrReturnError(mCompletionQueueEnabled, false);
+
+        auto status = mPendingStatuses.find(commandSenderHandle);
+        if (status != mPendingStatuses.end())
+        {
+            completion.HasStatus = 1;
+            completion.Status    = status->second;
+            mPendingStatuses.erase(status);
+        }
+        mCompletions.push_back(completion);
+    }
+    mCompletionCondition.notify_all();
+    return true;
+}
+
 void pychip_InteractionModelDelegate_SetCommandResponseStatusCallback(
     PythonInteractionModelDelegate_OnCommandResponseStatusCodeReceivedFunct f)
 {
@@ -81,6 +156,22 @@ void pychip_InteractionModelDelegate_SetCommandResponseErrorCallback(PythonInter
     gPythonInteractionModelDelegate.SetOnCommandResponseCallback(f);
 }
 
+void pychip_InteractionModelDelegate_SetCompletionQueueEnabled(bool enabled)
+{
+    gPythonInteractionModelDelegate.SetCompletionQueueEnabled(enabled);
+}
+
+uint32_t pychip_InteractionModelDelegate_WaitForCompletions(CommandCompletion * completions, uint32_t maxCompletions,
+                                                            uint32_t timeoutMs)
+{
+    return gPythonInteractionModelDelegate.WaitForCompletions(completions, maxCompletions, timeoutMs);
+}
+
+void pychip_InteractionModelDelegate_WakeCompletionWaiter()
+{
+    gPythonInteractionModelDelegate.WakeCompletionWaiter();
+}
+
 PythonInteractionModelDelegate & PythonInteractionModelDelegate::Instance()
 {
     return gPythonInteractionModelDelegate;
@@ -19,6 +19,11 @@
 
 #include <app/InteractionModelDelegate.h>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 namespace chip {
 namespace Controller {
 
@@ -34,6 +39,15 @@ struct __attribute__((packed)) CommandStatus
     uint8_t CommandIndex;
 };
 
+// A command request done while the completion queue is enabled, with the last status received for it, if any.
+struct __attribute__((packed)) CommandCompletion
+{
+    uint64_t CommandSenderHandle;
+    uint32_t Error;
+    uint8_t HasStatus;
+    CommandStatus Status;
+};
+
 extern "C" {
 typedef void (*PythonInteractionModelDelegate_OnCommandResponseStatusCodeReceivedFunct)(uint64_t commandSenderPtr,
                                                                                         void * commandStatusBuf,
@@ -46,6 +60,11 @@ void pychip_InteractionModelDelegate_SetCommandResponseStatusCallback(
 void pychip_InteractionModelDelegate_SetCommandResponseProtocolErrorCallback(
     PythonInteractionModelDelegate_OnCommandResponseProtocolErrorFunct f);
 void pychip_InteractionModelDelegate_SetCommandResponseErrorCallback(PythonInteractionModelDelegate_OnCommandResponseFunct f);
+
+void pychip_InteractionModelDelegate_SetCompletionQueueEnabled(bool enabled);
+uint32_t pychip_InteractionModelDelegate_WaitForCompletions(CommandCompletion * completions, uint32_t maxCompletions,
+                                                            uint32_t timeoutMs);
+void pychip_InteractionModelDelegate_WakeCompletionWaiter();
 }
 
 class PythonInteractionModelDelegate : public chip::app::InteractionModelDelegate
@@ -76,10 +95,34 @@ public:
 
     void SetOnCommandResponseCallback(PythonInteractionModelDelegate_OnCommandResponseFunct f) { commandResponseErrorFunct = f; }
 
+    /**
+     * While the completion queue is enabled, the statuses and completions of command requests are queued for
+     * WaitForCompletions() rather than passed to the python callbacks one at a time from the CHIP thread.
+     */
+    void SetCompletionQueueEnabled(bool enabled);
+
+    /**
+     * Waits up to timeoutMs for a command request to complete, or for WakeCompletionWaiter(), then takes as
+     * many of the queued completions as fit in completions. Returns the number of completions taken.
+     */
+    uint32_t WaitForCompletions(CommandCompletion * completions, uint32_t maxCompletions, uint32_t timeoutMs);
+
+    void WakeCompletionWaiter();
+
 private:
+    bool QueueStatus(const CommandStatus & status, uint64_t commandSenderHandle);
+    bool QueueCompletion(uint64_t commandSenderHandle, CHIP_ERROR error);
+
     PythonInteractionModelDelegate_OnCommandResponseStatusCodeReceivedFunct commandResponseStatusFunct   = nullptr;
     PythonInteractionModelDelegate_OnCommandResponseProtocolErrorFunct commandResponseProtocolErrorFunct = nullptr;
     PythonInteractionModelDelegate_OnCommandResponseFunct commandResponseErrorFunct                      = nullptr;
+
+    std::mutex mCompletionLock;
+    std::condition_variable mCompletionCondition;
+    std::deque<CommandCompletion> mCompletions;
+    std::unordered_map<uint64_t, CommandStatus> mPendingStatuses;
+    bool mCompletionQueueEnabled = false;
+    bool mWakeRequested          = false;
 };
 
 } // namespace Controller
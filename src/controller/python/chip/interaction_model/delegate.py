@@ -14,8 +14,8 @@
    limitations under the License.
 '''
 
-from construct import Struct, Int32ul, Int16ul, Int8ul
-from ctypes import CFUNCTYPE, c_void_p, c_size_t, c_uint32, c_uint64, c_uint8
+from construct import Struct, Int64ul, Int32ul, Int16ul, Int8ul, Array
+from ctypes import CFUNCTYPE, c_void_p, c_size_t, c_uint32, c_uint64, c_uint8, c_bool
 import ctypes
 import chip.native
 import threading
@@ -29,6 +29,13 @@ IMCommandStatus = Struct(
     "CommandIndex" / Int8ul,
 )
 
+IMCommandCompletion = Struct(
+    "CommandSenderHandle" / Int64ul,
+    "Error" / Int32ul,
+    "HasStatus" / Int8ul,
+    "Status" / IMCommandStatus,
+)
+
 # typedef void (*PythonInteractionModelDelegate_OnCommandResponseStatusCodeReceivedFunct)(uint64_t commandSenderPtr,
 #                                                                                         void * commandStatusBuf);
 # typedef void (*PythonInteractionModelDelegate_OnCommandResponseProtocolErrorFunct)(uint64_t commandSenderPtr, uint8_t commandIndex);
@@ -88,6 +95,10 @@ def InitIMDelegate():
         handle.pychip_InteractionModelDelegate_SetCommandResponseProtocolErrorCallback(_OnCommandResponseProtocolError)
         handle.pychip_InteractionModelDelegate_SetCommandResponseErrorCallback(_OnCommandResponse)
 
+        setter.Set("pychip_InteractionModelDelegate_SetCompletionQueueEnabled", None, [c_bool])
+        setter.Set("pychip_InteractionModelDelegate_WaitForCompletions", c_uint32, [c_void_p, c_uint32, c_uint32])
+        setter.Set("pychip_InteractionModelDelegate_WakeCompletionWaiter", None, [])
+
 def ClearCommandStatus(commandHandle: int):
     """
     Clear internal state and prepare for next command, should be called before sending commands.
@@ -126,3 +137,80 @@ def WaitCommandIndexStatus(commandHandle: int, commandIndex: int):
         return (0, None)
     err = WaitCommandStatus(commandHandle)
     return (err, _GetCommandIndexStatus(commandHandle, commandIndex))
+
+
+class CompletionQueue:
+    """
+    Delivers the completions of command requests to an asyncio event loop, in batches.
+
+    While the queue is started, the command responses are queued by the native delegate rather than passed
+    to the callbacks above, and WaitCommandStatus no longer returns. A thread waits for them in native code,
+    without holding the GIL, and hands each batch it takes to the event loop at once. Each completion
+    resolves the future Expect returned for its command sender with (error, status), status being None when
+    the device returned a command rather than a status. The command sender of a device is only ever waited
+    for by one future at a time.
+    """
+
+    _BatchSize = 64
+    _WaitTimeoutMs = 100
+
+    def __init__(self, loop):
+        self._loop = loop
+        self._futures = {}
+        self._thread = None
+        self._stopped = threading.Event()
+        self._handle = chip.native.GetLibraryHandle()
+
+    def Start(self):
+        InitIMDelegate()
+        self._stopped.clear()
+        self._handle.pychip_InteractionModelDelegate_SetCompletionQueueEnabled(True)
+        self._thread = threading.Thread(target=self._Run, name="CHIP IM completions", daemon=True)
+        self._thread.start()
+
+    def Stop(self):
+        self._stopped.set()
+        self._handle.pychip_InteractionModelDelegate_WakeCompletionWaiter()
+        self._thread.join()
+        self._thread = None
+        self._handle.pychip_InteractionModelDelegate_SetCompletionQueueEnabled(False)
+        for future in self._futures.values():
+            future.cancel()
+        self._futures.clear()
+
+    def Expect(self, commandHandle: int):
+        """
+        Returns the future of the next completion of commandHandle; must be called from the event loop
+        before the command is sent.
+        """
+        if commandHandle in self._futures:
+            raise ValueError("A command is already outstanding on command sender {}".format(commandHandle))
+        future = self._loop.create_future()
+        self._futures[commandHandle] = future
+        return future
+
+    def Forget(self, commandHandle: int):
+        """
+        Drops the future of commandHandle, for a command that failed to send.
+        """
+        future = self._futures.pop(commandHandle, None)
+        if future is not None:
+            future.cancel()
+
+    def _Run(self):
+        buf = ctypes.create_string_buffer(IMCommandCompletion.sizeof() * self._BatchSize)
+        while not self._stopped.is_set():
+            count = self._handle.pychip_InteractionModelDelegate_WaitForCompletions(
+                buf, self._BatchSize, self._WaitTimeoutMs)
+            if count == 0:
+                continue
+            batch = Array(count, IMCommandCompletion).parse(buf.raw[:IMCommandCompletion.sizeof() * count])
+            self._loop.call_soon_threadsafe(self._Deliver, batch)
+
+    def _Deliver(self, batch):
+        for completion in batch:
+            future = self._futures.pop(completion["CommandSenderHandle"], None)
+            if future is None or future.done():
+                continue
+            status = completion["Status"] if completion["HasStatus"] else None
+            future.set_result((completion["Error"], status))
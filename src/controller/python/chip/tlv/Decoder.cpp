@@ -0,0 +1,189 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Decodes a whole TLV buffer for the chip.tlv python module, as a flat
+ *      list of elements in encoding order, each container being followed by
+ *      its members and an end of container element.
+ */
+
+#include <core/CHIPTLV.h>
+#include <support/CodeUtils.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+// use packed attribute so we can unpack it from python and no need to worry about padding.
+struct __attribute__((packed)) DecodedElement
+{
+    uint8_t Type;       // The TLVType of the element, or kEndOfContainer
+    uint8_t TagControl; // The tag control bits of the control byte
+    uint16_t Reserved;
+    uint32_t ProfileId;
+    uint32_t TagNumber;
+    uint32_t DataLength; // For strings only, the length of the string
+    uint64_t Value;      // The integer, boolean or double bits of the value, or the offset of a string in the buffer
+};
+
+constexpr uint8_t kEndOfContainer = 0x18;
+
+// Bounds the recursion on the containers of an untrusted encoding.
+constexpr uint32_t kMaxDepth = 64;
+
+class Decoder
+{
+public:
+    Decoder(const uint8_t * tlv, DecodedElement * elements, uint32_t maxElements) :
+        mTlv(tlv), mElements(elements), mMaxElements(maxElements)
+    {}
+
+    CHIP_ERROR DecodeMembers(TLVReader & reader, uint32_t depth)
+    {
+        CHIP_ERROR err;
+
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            DecodedElement element = {};
+            TLVType type           = reader.GetType();
+            uint64_t tag           = reader.GetTag();
+
+            element.Type       = static_cast<uint8_t>(type);
+            element.TagControl = static_cast<uint8_t>(reader.GetControlByte() & kTLVTagControlMask);
+            if (IsProfileTag(tag))
+            {
+                // The python module reads the vendor id and profile number as one little endian 32 bit profile id.
+                element.ProfileId = static_cast<uint32_t>(ProfileNumFromTag(tag)) << 16 | VendorIdFromTag(tag);
+            }
+            if (tag != AnonymousTag)
+            {
+                element.TagNumber = TagNumFromTag(tag);
+            }
+            ReturnErrorOnFailure(DecodeValue(reader, type, element));
+            ReturnErrorOnFailure(Append(element));
+
+            if (TLVTypeIsContainer(type))
+            {
+                TLVType outerContainerType;
+
+                VerifyOrReturnError(depth < kMaxDepth, CHIP_ERROR_INVALID_TLV_ELEMENT);
+                ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+                ReturnErrorOnFailure(DecodeMembers(reader, depth + 1));
+                ReturnErrorOnFailure(reader.ExitContainer(outerContainerType));
+
+                DecodedElement end = {};
+                end.Type           = kEndOfContainer;
+                ReturnErrorOnFailure(Append(end));
+            }
+        }
+
+        return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+    }
+
+    uint32_t GetElementCount() const { return mElementCount; }
+
+private:
+    CHIP_ERROR DecodeValue(TLVReader & reader, TLVType type, DecodedElement & element)
+    {
+        switch (type)
+        {
+        case kTLVType_SignedInteger: {
+            int64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+            element.Value = static_cast<uint64_t>(v);
+            break;
+        }
+        case kTLVType_UnsignedInteger: {
+            uint64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+            element.Value = v;
+            break;
+        }
+        case kTLVType_Boolean: {
+            bool v;
+            ReturnErrorOnFailure(reader.Get(v));
+            element.Value = v ? 1 : 0;
+            break;
+        }
+        case kTLVType_FloatingPointNumber: {
+            double v;
+            ReturnErrorOnFailure(reader.Get(v));
+            memcpy(&element.Value, &v, sizeof(v));
+            break;
+        }
+        case kTLVType_UTF8String:
+        case kTLVType_ByteString: {
+            const uint8_t * data;
+            element.DataLength = reader.GetLength();
+            if (element.DataLength > 0)
+            {
+                ReturnErrorOnFailure(reader.GetDataPtr(data));
+                element.Value = static_cast<uint64_t>(data - mTlv);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Append(const DecodedElement & element)
+    {
+        // Without a destination, the elements are only counted.
+        if (mElements != nullptr)
+        {
+            VerifyOrReturnError(mElementCount < mMaxElements, CHIP_ERROR_BUFFER_TOO_SMALL);
+            mElements[mElementCount] = element;
+        }
+        mElementCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    const uint8_t * mTlv;
+    DecodedElement * mElements;
+    uint32_t mMaxElements;
+    uint32_t mElementCount = 0;
+};
+
+} // namespace
+
+/**
+ * Decodes the TLV elements of tlv into elements. With elements null, only counts the elements, so that
+ * the caller can size elements.
+ */
+extern "C" CHIP_ERROR pychip_TLV_Decode(const uint8_t * tlv, uint32_t tlvLen, DecodedElement * elements, uint32_t maxElements,
+                                        uint32_t * elementCount)
+{
+    TLVReader reader;
+    Decoder decoder(tlv, elements, maxElements);
+
+    VerifyOrReturnError(tlv != nullptr || tlvLen == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(elementCount != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    reader.Init(tlv, tlvLen);
+    // The tag control tells implicit profile tags apart, whatever their profile id is.
+    reader.ImplicitProfileId = kCommonProfileId;
+
+    CHIP_ERROR err = decoder.DecodeMembers(reader, 0);
+    *elementCount  = decoder.GetElementCount();
+    return err;
+}
@@ -635,6 +635,111 @@ class TLVReader(object):
                     raise ValueError("Attempt to decode unsupported TLV tag")
 
 
+_DecodedElement = struct.Struct("=BBxxIIIQ")
+_nativeDecode = None
+
+
+def _getNativeDecode():
+    """Returns pychip_TLV_Decode of the CHIP library, or None when the library cannot be loaded."""
+    global _nativeDecode
+    if _nativeDecode is None:
+        try:
+            import ctypes
+            import chip.native
+
+            setter = chip.native.NativeLibraryHandleMethodArguments(chip.native.GetLibraryHandle())
+            setter.Set(
+                "pychip_TLV_Decode",
+                ctypes.c_uint32,
+                [
+                    ctypes.c_char_p,
+                    ctypes.c_uint32,
+                    ctypes.c_void_p,
+                    ctypes.c_uint32,
+                    ctypes.POINTER(ctypes.c_uint32),
+                ],
+            )
+            _nativeDecode = chip.native.GetLibraryHandle().pychip_TLV_Decode
+        except Exception:
+            _nativeDecode = False
+    return _nativeDecode or None
+
+
+def decode(tlv):
+    """Decode a whole TLV buffer at once, with the CHIP library when it is available.
+
+    Returns the same dictionary as TLVReader(tlv).get(), without the element decodings,
+    except that the elements of an array are all appended to its list, whatever their tag.
+    """
+    nativeDecode = _getNativeDecode()
+    if nativeDecode is None:
+        return TLVReader(tlv).get()
+
+    import ctypes
+
+    tlv = bytes(tlv)
+    count = ctypes.c_uint32(0)
+    err = nativeDecode(tlv, len(tlv), None, 0, ctypes.byref(count))
+    if err != 0:
+        raise ValueError("Invalid TLV encoding (error {})".format(err))
+    elements = ctypes.create_string_buffer(_DecodedElement.size * count.value)
+    err = nativeDecode(tlv, len(tlv), elements, count.value, ctypes.byref(count))
+    if err != 0:
+        raise ValueError("Invalid TLV encoding (error {})".format(err))
+
+    out = {}
+    container = out
+    containers = []
+    for elementType, tagControl, profile, tagNum, dataLen, val in _DecodedElement.iter_unpack(elements.raw):
+        if elementType == TLVEndOfContainer:
+            container = containers.pop()
+            continue
+
+        if elementType == TLV_TYPE_UNSIGNED_INTEGER:
+            pass
+        elif elementType == TLV_TYPE_SIGNED_INTEGER:
+            if val > INT64_MAX:
+                val -= UINT64_MAX + 1
+        elif elementType == TLV_TYPE_UTF8_STRING:
+            val = tlv[val : val + dataLen]
+            try:
+                val = str(val, "utf-8")
+            except Exception:
+                pass
+        elif elementType == TLV_TYPE_BYTE_STRING:
+            val = tlv[val : val + dataLen]
+        elif elementType == TLV_TYPE_STRUCTURE:
+            val = {}
+        elif elementType == TLV_TYPE_ARRAY or elementType == TLV_TYPE_PATH:
+            val = []
+        elif elementType == TLV_TYPE_BOOLEAN:
+            val = val != 0
+        elif elementType == TLV_TYPE_NULL:
+            val = None
+        else:
+            (val,) = struct.unpack("=d", struct.pack("=Q", val))
+
+        if isinstance(container, list):
+            container.append(val)
+        elif tagControl == TLV_TAG_CONTROL_ANONYMOUS:
+            container["Any"] = val
+        elif tagControl == TLV_TAG_CONTROL_CONTEXT_SPECIFIC:
+            container[tagNum] = val
+        elif (
+            tagControl == TLV_TAG_CONTROL_IMPLICIT_PROFILE_2Bytes
+            or tagControl == TLV_TAG_CONTROL_IMPLICIT_PROFILE_4Bytes
+        ):
+            container[(None, tagNum)] = val
+        else:
+            container[(profile, tagNum)] = val
+
+        if elementType >= TLV_TYPE_STRUCTURE:
+            containers.append(container)
+            container = val
+
+    return out
+
+
 def tlvTagToSortKey(tag):
     if tag is None:
         return -1
@@ -675,7 +780,7 @@ if __name__ == "__main__":
     print("TLVReader input: " + str(val))
     print("TLVReader output: " + str(out["Any"]))
 
-    if val == out["Any"]:
+    if val == out["Any"] and decode(writer.encoding) == out:
         print("Test Success")
     else:
         print("Test Failure")
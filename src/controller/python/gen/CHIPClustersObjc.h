@@ -22,6 +22,7 @@
 
 #import <Foundation/Foundation.h>
 
+@class CHIPAttributeReportBatcher;
 @class CHIPDevice;
 
 typedef void (^ResponseHandler)(NSError * _Nullable error, NSDictionary * _Nullable values);
@@ -262,12 +263,14 @@ NS_ASSUME_NONNULL_BEGIN
                                              change:(uint8_t)change
                                     responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentHueWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentHueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeCurrentSaturationWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentSaturationWithMinInterval:(uint16_t)minInterval
                                                maxInterval:(uint16_t)maxInterval
                                                     change:(uint8_t)change
                                            responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentSaturationWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentSaturationToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeRemainingTimeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeCurrentXWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentXWithMinInterval:(uint16_t)minInterval
@@ -275,12 +278,14 @@ NS_ASSUME_NONNULL_BEGIN
                                            change:(uint16_t)change
                                   responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentXWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentXToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeCurrentYWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentYWithMinInterval:(uint16_t)minInterval
                                       maxInterval:(uint16_t)maxInterval
                                            change:(uint16_t)change
                                   responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentYWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentYToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeDriftCompensationWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeCompensationTextWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeColorTemperatureWithResponseHandler:(ResponseHandler)responseHandler;
@@ -289,6 +294,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                    change:(uint16_t)change
                                           responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeColorTemperatureWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeColorTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeColorModeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeColorControlOptionsWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)writeAttributeColorControlOptionsWithValue:(uint8_t)value responseHandler:(ResponseHandler)responseHandler;
@@ -435,6 +441,7 @@ NS_ASSUME_NONNULL_BEGIN
                                        maxInterval:(uint16_t)maxInterval
                                    responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeLockStateWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeLockStateToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeLockTypeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeActuatorEnabledWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
@@ -561,6 +568,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                change:(uint8_t)change
                                       responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentLevelWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentLevelToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
 
 @end
@@ -676,6 +684,7 @@ NS_ASSUME_NONNULL_BEGIN
                                    maxInterval:(uint16_t)maxInterval
                                responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeOnOffWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeOnOffToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
 
 @end
@@ -715,6 +724,7 @@ NS_ASSUME_NONNULL_BEGIN
                                            change:(int16_t)change
                                   responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCapacityWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCapacityToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeOperationModeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)writeAttributeOperationModeWithValue:(uint8_t)value responseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
@@ -767,6 +777,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                   change:(uint8_t)change
                                          responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentPositionWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentPositionToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
 
 @end
@@ -815,6 +826,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                 change:(int16_t)change
                                        responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeMeasuredValueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeMinMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeMaxMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
@@ -890,6 +902,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                    change:(int16_t)change
                                           responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeLocalTemperatureWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeLocalTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeOccupiedCoolingSetpointWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)writeAttributeOccupiedCoolingSetpointWithValue:(int16_t)value responseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeOccupiedHeatingSetpointWithResponseHandler:(ResponseHandler)responseHandler;
@@ -932,23 +945,27 @@ NS_ASSUME_NONNULL_BEGIN
                                                 maxInterval:(uint16_t)maxInterval
                                             responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeWindowCoveringTypeWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeWindowCoveringTypeToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeCurrentPositionLiftWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentPositionLiftWithMinInterval:(uint16_t)minInterval
                                                  maxInterval:(uint16_t)maxInterval
                                                       change:(uint16_t)change
                                              responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentPositionLiftWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentPositionLiftToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeCurrentPositionTiltWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentPositionTiltWithMinInterval:(uint16_t)minInterval
                                                  maxInterval:(uint16_t)maxInterval
                                                       change:(uint16_t)change
                                              responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentPositionTiltWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentPositionTiltToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeConfigStatusWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeConfigStatusWithMinInterval:(uint16_t)minInterval
                                           maxInterval:(uint16_t)maxInterval
                                       responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeConfigStatusWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeConfigStatusToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeInstalledOpenLimitLiftWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeInstalledClosedLimitLiftWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeInstalledOpenLimitTiltWithResponseHandler:(ResponseHandler)responseHandler;
@@ -19,6 +19,7 @@
 
 #import <Foundation/Foundation.h>
 
+#import "CHIPAttributeReportBatcher_Internal.h"
 #import "CHIPDevice.h"
 #import "CHIPDevice_Internal.h"
 #import "CHIPError.h"
@@ -2812,6 +2813,7 @@ private:
 @interface CHIPCluster ()
 @property (readonly, nonatomic) dispatch_queue_t callbackQueue;
 @property (readonly, nonatomic) dispatch_queue_t chipWorkQueue;
+@property (readonly, nonatomic) EndpointId endpoint;
 - (Controller::ClusterBase *)getCluster;
 @end
 
@@ -2839,6 +2841,7 @@ private:
         }
 
         _callbackQueue = queue;
+        _endpoint = endpoint;
     }
     return self;
 }
@@ -4859,6 +4862,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentHueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentHue(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeCurrentSaturationWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -4936,6 +4966,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentSaturationToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0001);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentSaturation(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeRemainingTimeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -5040,6 +5097,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentXToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0003);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentX(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeCurrentYWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -5117,6 +5201,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentYToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0004);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentY(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeDriftCompensationWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -5249,6 +5360,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeColorTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0007);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeColorTemperature(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeColorModeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -7816,6 +7954,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeLockStateToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeLockState(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeLockTypeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -8972,6 +9137,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentLevelToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentLevel(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -10066,6 +10258,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeOnOffToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<BooleanAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<BooleanAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeOnOff(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -10471,6 +10690,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCapacityToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0013);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCapacity(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeOperationModeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -11046,6 +11292,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentPositionToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0001);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentPosition(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -11469,6 +11742,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeMeasuredValueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeMeasuredValue(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeMinMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16sAttributeCallbackBridge * onSuccess = new CHIPInt16sAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -12790,6 +13090,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeLocalTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeLocalTemperature(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeOccupiedCoolingSetpointWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16sAttributeCallbackBridge * onSuccess = new CHIPInt16sAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -13373,6 +13700,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeWindowCoveringTypeToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeWindowCoveringType(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeCurrentPositionLiftWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -13450,6 +13804,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentPositionLiftToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0003);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentPositionLift(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeCurrentPositionTiltWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -13527,6 +13908,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentPositionTiltToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0004);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentPositionTilt(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeConfigStatusWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -13602,6 +14010,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeConfigStatusToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0007);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeConfigStatus(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeInstalledOpenLimitLiftWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -61,6 +61,13 @@ ChipCertificateSet::ChipCertificateSet()
     mDecodeBuf           = nullptr;
     mDecodeBufSize       = 0;
     mMemoryAllocInternal = false;
+#if CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+    mVerifiedSignatureCount = 0;
+    mNextVerifiedSignature  = 0;
+#endif // CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+#if CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+    mVerifierCache = nullptr;
+#endif // CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
 }
 
 ChipCertificateSet::~ChipCertificateSet()
@@ -76,9 +83,11 @@ CHIP_ERROR ChipCertificateSet::Init(uint8_t maxCertsArraySize, uint16_t decodeBu
     mCerts = reinterpret_cast<ChipCertificateData *>(chip::Platform::MemoryAlloc(sizeof(ChipCertificateData) * maxCertsArraySize));
     VerifyOrExit(mCerts != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
-    VerifyOrExit(decodeBufSize > 0, err = CHIP_ERROR_INVALID_ARGUMENT);
-    mDecodeBuf = reinterpret_cast<uint8_t *>(chip::Platform::MemoryAlloc(decodeBufSize));
-    VerifyOrExit(mDecodeBuf != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    if (decodeBufSize > 0)
+    {
+        mDecodeBuf = reinterpret_cast<uint8_t *>(chip::Platform::MemoryAlloc(decodeBufSize));
+        VerifyOrExit(mDecodeBuf != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    }
 
     mMaxCerts            = maxCertsArraySize;
     mDecodeBufSize       = decodeBufSize;
@@ -102,8 +111,7 @@ CHIP_ERROR ChipCertificateSet::Init(ChipCertificateData * certsArray, uint8_t ce
 
     VerifyOrExit(certsArray != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(certsArraySize > 0, err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(decodeBuf != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(decodeBufSize > 0, err = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(decodeBuf != nullptr || decodeBufSize == 0, err = CHIP_ERROR_INVALID_ARGUMENT);
 
     mCerts               = certsArray;
     mMaxCerts            = certsArraySize;
@@ -133,6 +141,15 @@ void ChipCertificateSet::Release()
             mDecodeBuf = nullptr;
         }
     }
+
+#if CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+    mVerifiedSignatureCount = 0;
+    mNextVerifiedSignature  = 0;
+#endif // CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+#if CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+    chip::Platform::Delete(mVerifierCache);
+    mVerifierCache = nullptr;
+#endif // CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
 }
 
 void ChipCertificateSet::Clear()
@@ -145,28 +162,61 @@ void ChipCertificateSet::Clear()
     mCertCount = 0;
 }
 
-CHIP_ERROR ChipCertificateSet::LoadCert(const uint8_t * chipCert, uint32_t chipCertLen, BitFlags<CertDecodeFlags> decodeFlags)
-{
-    CHIP_ERROR err;
-    TLVReader reader;
+namespace {
 
+CHIP_ERROR InitCertReader(TLVReader & reader, const uint8_t * chipCert, uint32_t chipCertLen)
+{
     reader.Init(chipCert, chipCertLen);
     reader.ImplicitProfileId = Protocols::OpCredentials::Id.ToTLVProfileId();
 
-    err = reader.Next(kTLVType_Structure, ProfileTag(Protocols::OpCredentials::Id.ToTLVProfileId(), kTag_ChipCertificate));
-    SuccessOrExit(err);
+    return reader.Next(kTLVType_Structure, ProfileTag(Protocols::OpCredentials::Id.ToTLVProfileId(), kTag_ChipCertificate));
+}
 
-    err = LoadCert(reader, decodeFlags);
+// Upper bound of the constructed and encapsulating elements in the TBS portion of a certificate.
+constexpr uint16_t kMaxTBSCertLengths = 64;
 
-exit:
-    return err;
+ASN1_ERROR HashTBSCertOutput(void * context, const uint8_t * data, uint32_t dataLen)
+{
+    return static_cast<Hash_SHA256_stream *>(context)->AddData(data, dataLen);
+}
+
+} // namespace
+
+CHIP_ERROR ChipCertificateSet::LoadCert(const uint8_t * chipCert, uint32_t chipCertLen, BitFlags<CertDecodeFlags> decodeFlags)
+{
+    TLVReader reader;
+
+    ReturnErrorOnFailure(InitCertReader(reader, chipCert, chipCertLen));
+    return DecodeAndAddCert(reader, decodeFlags, nullptr);
 }
 
 CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags)
+{
+    return DecodeAndAddCert(reader, decodeFlags, nullptr);
+}
+
+CHIP_ERROR ChipCertificateSet::LoadCert(const uint8_t * chipCert, uint32_t chipCertLen, BitFlags<CertDecodeFlags> decodeFlags,
+                                        const uint8_t (&tbsHash)[kSHA256_Hash_Length])
+{
+    TLVReader reader;
+
+    ReturnErrorOnFailure(InitCertReader(reader, chipCert, chipCertLen));
+    return DecodeAndAddCert(reader, decodeFlags, tbsHash);
+}
+
+CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags,
+                                        const uint8_t (&tbsHash)[kSHA256_Hash_Length])
+{
+    return DecodeAndAddCert(reader, decodeFlags, tbsHash);
+}
+
+CHIP_ERROR ChipCertificateSet::DecodeAndAddCert(TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags,
+                                                const uint8_t * cachedTBSHash)
 {
     CHIP_ERROR err;
     ASN1Writer writer; // ASN1Writer is used to encode TBS portion of the certificate for the purpose of signature
                        // validation, which should be performed on the TBS data encoded in ASN.1 DER form.
+    Hash_SHA256_stream tbsHash;
     ChipCertificateData * cert = nullptr;
 
     // Must be positioned on the structure element representing the certificate.
@@ -184,10 +234,40 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
         err = reader.EnterContainer(containerType);
         SuccessOrExit(err);
 
-        // Initialize an ASN1Writer and convert the TBS (to-be-signed) portion of the certificate to ASN.1 DER
-        // encoding.  At the same time, parse various components within the certificate and set the corresponding
-        // fields in the CertificateData object.
-        writer.Init(mDecodeBuf, mDecodeBufSize);
+        // A TBS hash computed before is used as is, and the kGenerateTBSHash flag is then ignored.
+        if (cachedTBSHash != nullptr)
+        {
+            decodeFlags.Clear(CertDecodeFlags::kGenerateTBSHash);
+        }
+
+        // Convert the TBS (to-be-signed) portion of the certificate to ASN.1 DER encoding.  At the same time, parse
+        // various components within the certificate and set the corresponding fields in the CertificateData object.
+        if (decodeFlags.Has(CertDecodeFlags::kGenerateTBSHash))
+        {
+            // The encoding is hashed as it is written, which takes two conversions: the first one records the lengths
+            // of the elements, which DER encodes ahead of their contents, and the second one writes the encoding.
+            uint16_t tbsLengths[kMaxTBSCertLengths];
+            TLVReader tbsReader;
+
+            tbsReader.Init(reader);
+            writer.InitLengthCounter(tbsLengths, kMaxTBSCertLengths);
+            err = DecodeConvertTBSCert(tbsReader, writer, *cert);
+            SuccessOrExit(err);
+
+            err = writer.Finalize();
+            SuccessOrExit(err);
+
+            cert->Clear();
+
+            err = tbsHash.Begin();
+            SuccessOrExit(err);
+
+            writer.InitStreamWriter(HashTBSCertOutput, &tbsHash, tbsLengths, writer.GetLengthCount());
+        }
+        else
+        {
+            writer.InitNullWriter();
+        }
         err = DecodeConvertTBSCert(reader, writer, *cert);
         SuccessOrExit(err);
 
@@ -206,11 +286,17 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
             err = writer.Finalize();
             SuccessOrExit(err);
 
-            // Generate a SHA hash of the encoded TBS certificate.
-            chip::Crypto::Hash_SHA256(mDecodeBuf, writer.GetLengthWritten(), cert->mTBSHash);
+            // Complete the SHA hash of the encoded TBS certificate.
+            err = tbsHash.Finish(cert->mTBSHash);
+            SuccessOrExit(err);
 
             cert->mCertFlags.Set(CertFlags::kTBSHashPresent);
         }
+        else if (cachedTBSHash != nullptr)
+        {
+            memcpy(cert->mTBSHash, cachedTBSHash, sizeof(cert->mTBSHash));
+            cert->mCertFlags.Set(CertFlags::kTBSHashPresent);
+        }
 
         // Decode the certificate's signature...
         err = DecodeECDSASignature(reader, *cert);
@@ -376,15 +462,15 @@ exit:
     return err;
 }
 
-CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert, const ChipCertificateData * caCert)
+namespace {
+
+CHIP_ERROR EncodeCertSignature(const ChipCertificateData * cert, P256ECDSASignature & signature)
 {
     static constexpr size_t kMaxBytesForDeferredLenList = sizeof(uint8_t *) + // size of a single pointer in the deferred list
         4 + // extra memory allocated for the deferred length field (kLengthFieldReserveSize - 1)
         3;  // the deferred length list is alligned to 32bit boundary
 
     CHIP_ERROR err;
-    P256PublicKey caPublicKey;
-    P256ECDSASignature signature;
     uint8_t tmpBuf[signature.Capacity() + kMaxBytesForDeferredLenList];
     ASN1Writer writer;
 
@@ -412,15 +498,24 @@ CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert,
     err = signature.SetLength(writer.GetLengthWritten());
     SuccessOrExit(err);
 
-    memcpy(caPublicKey, caCert->mPublicKey, caCert->mPublicKeyLen);
-
-    err = caPublicKey.ECDSA_validate_hash_signature(cert->mTBSHash, chip::Crypto::kSHA256_Hash_Length, signature);
-    SuccessOrExit(err);
-
 exit:
     return err;
 }
 
+} // namespace
+
+CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert, const ChipCertificateData * caCert)
+{
+    P256PublicKey caPublicKey;
+    P256ECDSASignature signature;
+
+    ReturnErrorOnFailure(EncodeCertSignature(cert, signature));
+
+    memcpy(caPublicKey, caCert->mPublicKey, caCert->mPublicKeyLen);
+
+    return caPublicKey.ECDSA_validate_hash_signature(cert->mTBSHash, chip::Crypto::kSHA256_Hash_Length, signature);
+}
+
 CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, ValidationContext & context,
                                             BitFlags<CertValidateFlags> validateFlags, uint8_t depth)
 {
@@ -535,13 +630,110 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
     // succeeds, the current certificate is valid.
-    err = VerifySignature(cert, caCert);
+    err = VerifySignatureCached(cert, caCert);
     SuccessOrExit(err);
 
 exit:
     return err;
 }
 
+#if CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+static_assert(CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE <= UINT8_MAX, "The verified signature cache is indexed by uint8_t");
+#endif // CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+
+CHIP_ERROR ChipCertificateSet::VerifySignatureCached(const ChipCertificateData * cert, const ChipCertificateData * caCert)
+{
+#if CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+    Hash_SHA256_stream hash;
+    uint8_t digest[kSHA256_Hash_Length];
+
+    // The digest covers everything the signature verification depends on: the TBS hash, the signature and the CA public key.
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(cert->mTBSHash, sizeof(cert->mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(&cert->mSignature.RLen, sizeof(cert->mSignature.RLen)));
+    ReturnErrorOnFailure(hash.AddData(cert->mSignature.R, cert->mSignature.RLen));
+    ReturnErrorOnFailure(hash.AddData(&cert->mSignature.SLen, sizeof(cert->mSignature.SLen)));
+    ReturnErrorOnFailure(hash.AddData(cert->mSignature.S, cert->mSignature.SLen));
+    ReturnErrorOnFailure(hash.AddData(caCert->mPublicKey, caCert->mPublicKeyLen));
+    ReturnErrorOnFailure(hash.Finish(digest));
+
+    for (uint8_t i = 0; i < mVerifiedSignatureCount; i++)
+    {
+        if (memcmp(mVerifiedSignatures[i], digest, sizeof(digest)) == 0)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    ReturnErrorOnFailure(VerifySignatureWithCAVerifier(cert, caCert));
+
+    // Only successes are remembered. Replace the oldest entry once the cache is full.
+    memcpy(mVerifiedSignatures[mNextVerifiedSignature], digest, sizeof(digest));
+    mNextVerifiedSignature = static_cast<uint8_t>((mNextVerifiedSignature + 1) % CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE);
+    if (mVerifiedSignatureCount < CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE)
+    {
+        mVerifiedSignatureCount++;
+    }
+
+    return CHIP_NO_ERROR;
+#else
+    return VerifySignatureWithCAVerifier(cert, caCert);
+#endif // CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+}
+
+#if CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+static_assert(CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE <= UINT8_MAX, "The signature verifier cache is indexed by uint8_t");
+
+struct ChipCertificateSet::SignatureVerifierCache
+{
+    P256SignatureVerifier mVerifiers[CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE];
+    uint8_t mNextVerifier = 0; /**< Entry of mVerifiers to replace next. */
+};
+#endif // CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+
+CHIP_ERROR ChipCertificateSet::VerifySignatureWithCAVerifier(const ChipCertificateData * cert, const ChipCertificateData * caCert)
+{
+#if CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+    P256PublicKey caPublicKey;
+    P256ECDSASignature signature;
+    P256SignatureVerifier * verifier = nullptr;
+
+    if (mVerifierCache == nullptr)
+    {
+        mVerifierCache = chip::Platform::New<SignatureVerifierCache>();
+
+        // Without memory for the cache, the CA public key is decoded for this signature only.
+        VerifyOrReturnError(mVerifierCache != nullptr, VerifySignature(cert, caCert));
+    }
+
+    ReturnErrorOnFailure(EncodeCertSignature(cert, signature));
+
+    memcpy(caPublicKey, caCert->mPublicKey, caCert->mPublicKeyLen);
+
+    for (P256SignatureVerifier & cached : mVerifierCache->mVerifiers)
+    {
+        if (cached.IsKey(caPublicKey))
+        {
+            verifier = &cached;
+            break;
+        }
+    }
+
+    if (verifier == nullptr)
+    {
+        // Replace the verifier of the oldest key once the cache is full.
+        verifier = &mVerifierCache->mVerifiers[mVerifierCache->mNextVerifier];
+        mVerifierCache->mNextVerifier =
+            static_cast<uint8_t>((mVerifierCache->mNextVerifier + 1) % CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE);
+        ReturnErrorOnFailure(verifier->Init(caPublicKey));
+    }
+
+    return verifier->ValidateHashSignature(cert->mTBSHash, chip::Crypto::kSHA256_Hash_Length, signature);
+#else
+    return VerifySignature(cert, caCert);
+#endif // CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+}
+
 CHIP_ERROR ChipCertificateSet::FindValidCert(const ChipDN & subjectDN, const CertificateKeyId & subjectKeyId,
                                              ValidationContext & context, BitFlags<CertValidateFlags> validateFlags, uint8_t depth,
                                              ChipCertificateData *& cert)
@@ -371,6 +371,15 @@ public:
         aOther.mDecodeBuf    = nullptr;
         mDecodeBufSize       = aOther.mDecodeBufSize;
         mMemoryAllocInternal = aOther.mMemoryAllocInternal;
+#if CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+        memcpy(mVerifiedSignatures, aOther.mVerifiedSignatures, sizeof(mVerifiedSignatures));
+        mVerifiedSignatureCount = aOther.mVerifiedSignatureCount;
+        mNextVerifiedSignature  = aOther.mNextVerifiedSignature;
+#endif // CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+#if CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+        mVerifierCache        = aOther.mVerifierCache;
+        aOther.mVerifierCache = nullptr;
+#endif // CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
 
         return *this;
     }
@@ -382,6 +391,7 @@ public:
      *
      * @param maxCertsArraySize  Maximum number of CHIP certificates to be loaded to the set.
      * @param decodeBufSize      Size of the buffer that should be allocated to perform CHIP certificate decoding.
+     *                           Certificates are loaded without it, so it may be 0; the buffer is then not allocated.
      *
      * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
      **/
@@ -395,7 +405,8 @@ public:
      * @param certsArray      A pointer to the array of the ChipCertificateData structures.
      * @param certsArraySize  Number of ChipCertificateData entries in the array.
      * @param decodeBuf       Buffer to use for temporary storage of intermediate processing results.
-     * @param decodeBufSize   Size of decoding buffer.
+     * @param decodeBufSize   Size of decoding buffer. Certificates are loaded without it, so it may be 0, with a null
+     *                        decodeBuf.
      *
      * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
      **/
@@ -438,6 +449,48 @@ public:
      **/
     CHIP_ERROR LoadCert(chip::TLV::TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags);
 
+    /**
+     * @brief Load CHIP certificate into set, with the to-be-signed (TBS) hash computed when the certificate
+     *        was loaded before, instead of converting the certificate to X.509 again to compute it.
+     *        The TBS hash of a loaded certificate is found in ChipCertificateData::mTBSHash, and can be stored
+     *        alongside the certificate. The kGenerateTBSHash flag is then ignored.
+     *
+     * @note  The TBS hash is trusted input: it is not checked against the certificate, and the signature is verified
+     *        against it alone. A hash and signature taken from a genuinely signed certificate, given with edited
+     *        certificate bytes (e.g. another subject or public key), make the edited certificate validate, and hit the
+     *        verified signature cache. Only pass a hash kept in storage with the same integrity protection as the trust
+     *        anchors; otherwise load the certificate without one.
+     *
+     *        It is required that the CHIP certificate in the chipCert buffer stays valid while
+     *        the certificate data in the set is used.
+     *        In case of an error the certificate set is left in the same state as prior to this call.
+     *
+     * @param chipCert     Buffer containing certificate encoded in CHIP format.
+     * @param chipCertLen  The length of the certificate buffer.
+     * @param decodeFlags  Certificate decoding option flags.
+     * @param tbsHash      The TBS hash of the certificate.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR LoadCert(const uint8_t * chipCert, uint32_t chipCertLen, BitFlags<CertDecodeFlags> decodeFlags,
+                        const uint8_t (&tbsHash)[chip::Crypto::kSHA256_Hash_Length]);
+
+    /**
+     * @brief Load CHIP certificate into set, with the to-be-signed (TBS) hash computed when the certificate
+     *        was loaded before, see above. The TBS hash is trusted input, as for the overload above.
+     *        It is required that the CHIP certificate in the reader's underlying buffer stays valid while
+     *        the certificate data in the set is used.
+     *        In case of an error the certificate set is left in the same state as prior to this call.
+     *
+     * @param reader       A TLVReader positioned at the CHIP certificate TLV structure.
+     * @param decodeFlags  Certificate decoding option flags.
+     * @param tbsHash      The TBS hash of the certificate.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR LoadCert(chip::TLV::TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags,
+                        const uint8_t (&tbsHash)[chip::Crypto::kSHA256_Hash_Length]);
+
     /**
      * @brief Load CHIP certificates into set.
      *        It is required that the CHIP certificates in the chipCerts buffer stays valid while
@@ -547,6 +600,54 @@ private:
     uint16_t mDecodeBufSize;      /**< Certificate decode buffer size. */
     bool mMemoryAllocInternal;    /**< Indicates whether temporary memory buffers are allocated internally. */
 
+#if CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+    /**
+     * Digests of the certificate signatures that verified successfully, see VerifySignatureCached().
+     */
+    uint8_t mVerifiedSignatures[CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE][chip::Crypto::kSHA256_Hash_Length];
+    uint8_t mVerifiedSignatureCount; /**< Number of valid entries in mVerifiedSignatures. */
+    uint8_t mNextVerifiedSignature;  /**< Entry of mVerifiedSignatures to replace next. */
+#endif // CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+
+#if CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+    struct SignatureVerifierCache;
+    SignatureVerifierCache * mVerifierCache; /**< Verifiers of the recently used CA public keys, allocated on first use. */
+#endif // CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE > 0
+
+    /**
+     * @brief Verify CHIP certificate signature, unless the same signature of the same certificate
+     *        was already verified with the same CA public key.
+     *
+     * @param cert    Pointer to the CHIP certificiate which signature should be validated.
+     * @param caCert  Pointer to the CA certificate of the verified certificate.
+     *
+     * @return Returns a CHIP_ERROR on validation or other error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR VerifySignatureCached(const ChipCertificateData * cert, const ChipCertificateData * caCert);
+
+    /**
+     * @brief Verify CHIP certificate signature with a verifier kept for the CA public key, so that the key is
+     *        only decoded and validated the first time one of its signatures is verified.
+     *
+     * @param cert    Pointer to the CHIP certificiate which signature should be validated.
+     * @param caCert  Pointer to the CA certificate of the verified certificate.
+     *
+     * @return Returns a CHIP_ERROR on validation or other error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR VerifySignatureWithCAVerifier(const ChipCertificateData * cert, const ChipCertificateData * caCert);
+
+    /**
+     * @brief Decode CHIP certificate and add it to the set.
+     *
+     * @param reader         A TLVReader positioned at the CHIP certificate TLV structure.
+     * @param decodeFlags    Certificate decoding option flags.
+     * @param cachedTBSHash  The TBS hash of the certificate, computed when it was loaded before, or nullptr.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR DecodeAndAddCert(chip::TLV::TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags,
+                                const uint8_t * cachedTBSHash);
+
     /**
      * @brief Find and validate CHIP certificate.
      *
@@ -215,44 +215,30 @@ static CHIP_ERROR ConvertSubjectPublicKeyInfo(ASN1Reader & reader, TLVWriter & w
     {
         // algorithm AlgorithmIdentifier,
         // AlgorithmIdentifier ::= SEQUENCE
-        ASN1_PARSE_ENTER_SEQUENCE
-        {
-            // algorithm OBJECT IDENTIFIER,
-            ASN1_PARSE_OBJECT_ID(pubKeyAlgoOID);
-
-            // Verify that the algorithm type is supported.
-            VerifyOrExit(pubKeyAlgoOID == kOID_PubKeyAlgo_ECPublicKey, err = ASN1_ERROR_UNSUPPORTED_ENCODING);
-
-            err = writer.Put(ContextTag(kTag_PublicKeyAlgorithm), GetOIDEnum(pubKeyAlgoOID));
-            SuccessOrExit(err);
-
-            // EcpkParameters ::= CHOICE {
-            //     ecParameters  ECParameters,
-            //     namedCurve    OBJECT IDENTIFIER,
-            //     implicitlyCA  NULL }
-            ASN1_PARSE_ANY;
-
-            // ecParameters and implicitlyCA not supported.
-            if (reader.GetClass() == kASN1TagClass_Universal && reader.GetTag() == kASN1UniversalTag_Sequence)
-            {
-                ExitNow(err = ASN1_ERROR_UNSUPPORTED_ENCODING);
-            }
-            if (reader.GetClass() == kASN1TagClass_Universal && reader.GetTag() == kASN1UniversalTag_Null)
-            {
-                ExitNow(err = ASN1_ERROR_UNSUPPORTED_ENCODING);
-            }
+        //     algorithm OBJECT IDENTIFIER,
+        //     parameters EcpkParameters
+        //
+        // EcpkParameters ::= CHOICE {
+        //     ecParameters  ECParameters,
+        //     namedCurve    OBJECT IDENTIFIER,
+        //     implicitlyCA  NULL }
+        //
+        // (Only namedCurve supported, ecParameters and implicitlyCA are rejected by GetAlgorithmIdentifier()).
+        ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_Sequence);
+        err = reader.GetAlgorithmIdentifier(pubKeyAlgoOID, pubKeyCurveOID);
+        SuccessOrExit(err);
 
-            ASN1_VERIFY_TAG(kASN1TagClass_Universal, kASN1UniversalTag_ObjectId);
+        // Verify that the algorithm type is supported.
+        VerifyOrExit(pubKeyAlgoOID == kOID_PubKeyAlgo_ECPublicKey, err = ASN1_ERROR_UNSUPPORTED_ENCODING);
 
-            ASN1_GET_OBJECT_ID(pubKeyCurveOID);
+        err = writer.Put(ContextTag(kTag_PublicKeyAlgorithm), GetOIDEnum(pubKeyAlgoOID));
+        SuccessOrExit(err);
 
-            // Verify the curve name is recognized.
-            VerifyOrExit(GetOIDCategory(pubKeyCurveOID) == kOIDCategory_EllipticCurve, err = ASN1_ERROR_UNSUPPORTED_ENCODING);
+        // Verify the curve name is recognized.
+        VerifyOrExit(GetOIDCategory(pubKeyCurveOID) == kOIDCategory_EllipticCurve, err = ASN1_ERROR_UNSUPPORTED_ENCODING);
 
-            err = writer.Put(ContextTag(kTag_EllipticCurveIdentifier), GetOIDEnum(pubKeyCurveOID));
-            SuccessOrExit(err);
-        }
-        ASN1_EXIT_SEQUENCE;
+        err = writer.Put(ContextTag(kTag_EllipticCurveIdentifier), GetOIDEnum(pubKeyCurveOID));
+        SuccessOrExit(err);
 
         // subjectPublicKey BIT STRING
         ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_BitString);
@@ -553,17 +539,20 @@ static CHIP_ERROR ConvertCertificate(ASN1Reader & reader, TLVWriter & writer)
 
             // signature AlgorithmIdentifier
             // AlgorithmIdentifier ::= SEQUENCE
-            ASN1_PARSE_ENTER_SEQUENCE
             {
-                // algorithm OBJECT IDENTIFIER,
-                ASN1_PARSE_OBJECT_ID(sigAlgoOID);
+                OID sigAlgoParamOID;
 
-                VerifyOrExit(sigAlgoOID == kOID_SigAlgo_ECDSAWithSHA256, err = ASN1_ERROR_UNSUPPORTED_ENCODING);
+                ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_Sequence);
+                err = reader.GetAlgorithmIdentifier(sigAlgoOID, sigAlgoParamOID);
+                SuccessOrExit(err);
+
+                // ECDSA signature algorithms take no parameters.
+                VerifyOrExit(sigAlgoOID == kOID_SigAlgo_ECDSAWithSHA256 && sigAlgoParamOID == kOID_NotSpecified,
+                             err = ASN1_ERROR_UNSUPPORTED_ENCODING);
 
                 err = writer.Put(ContextTag(kTag_SignatureAlgorithm), GetOIDEnum(sigAlgoOID));
                 SuccessOrExit(err);
             }
-            ASN1_EXIT_SEQUENCE;
 
             // issuer Name
             err = ConvertDistinguishedName(reader, writer, ContextTag(kTag_Issuer));
@@ -618,17 +607,17 @@ static CHIP_ERROR ConvertCertificate(ASN1Reader & reader, TLVWriter & writer)
 
         // signatureAlgorithm AlgorithmIdentifier
         // AlgorithmIdentifier ::= SEQUENCE
-        ASN1_PARSE_ENTER_SEQUENCE
         {
-            OID localSigAlgoOID;
+            OID localSigAlgoOID, localSigAlgoParamOID;
 
-            // algorithm OBJECT IDENTIFIER,
-            ASN1_PARSE_OBJECT_ID(localSigAlgoOID);
+            ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_Sequence);
+            err = reader.GetAlgorithmIdentifier(localSigAlgoOID, localSigAlgoParamOID);
+            SuccessOrExit(err);
 
             // Verify that the signatureAlgorithm is the same as the "signature" field in TBSCertificate.
-            VerifyOrExit(localSigAlgoOID == sigAlgoOID, err = ASN1_ERROR_UNSUPPORTED_ENCODING);
+            VerifyOrExit(localSigAlgoOID == sigAlgoOID && localSigAlgoParamOID == kOID_NotSpecified,
+                         err = ASN1_ERROR_UNSUPPORTED_ENCODING);
         }
-        ASN1_EXIT_SEQUENCE;
 
         // signatureValue BIT STRING
         ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_BitString);
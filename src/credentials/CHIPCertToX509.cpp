@@ -263,21 +263,18 @@ static CHIP_ERROR DecodeConvertSubjectPublicKeyInfo(TLVReader & reader, ASN1Writ
     {
         // algorithm AlgorithmIdentifier,
         // AlgorithmIdentifier ::= SEQUENCE
-        ASN1_START_SEQUENCE
-        {
-            // algorithm OBJECT IDENTIFIER,
-            ASN1_ENCODE_OBJECT_ID(pubKeyAlgoOID);
-
-            // EcpkParameters ::= CHOICE {
-            //     ecParameters  ECParameters,
-            //     namedCurve    OBJECT IDENTIFIER,
-            //     implicitlyCA  NULL }
-            //
-            // (Only namedCurve supported).
-            //
-            ASN1_ENCODE_OBJECT_ID(certData.mPubKeyCurveOID);
-        }
-        ASN1_END_SEQUENCE;
+        //     algorithm OBJECT IDENTIFIER,
+        //     parameters EcpkParameters
+        //
+        // EcpkParameters ::= CHOICE {
+        //     ecParameters  ECParameters,
+        //     namedCurve    OBJECT IDENTIFIER,
+        //     implicitlyCA  NULL }
+        //
+        // (Only namedCurve supported).
+        //
+        err = writer.PutAlgorithmIdentifier(pubKeyAlgoOID, certData.mPubKeyCurveOID);
+        SuccessOrExit(err);
 
         err = reader.Next(kTLVType_ByteString, ContextTag(kTag_EllipticCurvePublicKey));
         SuccessOrExit(err);
@@ -790,7 +787,6 @@ CHIP_ERROR DecodeConvertTBSCert(TLVReader & reader, ASN1Writer & writer, ChipCer
 
         // signature AlgorithmIdentifier
         // AlgorithmIdentifier ::= SEQUENCE
-        ASN1_START_SEQUENCE
         {
             uint64_t sigAlgoId;
             OID sigAlgoOID;
@@ -804,11 +800,11 @@ CHIP_ERROR DecodeConvertTBSCert(TLVReader & reader, ASN1Writer & writer, ChipCer
             VerifyOrExit(sigAlgoId <= UINT8_MAX, err = CHIP_ERROR_UNSUPPORTED_CERT_FORMAT);
 
             sigAlgoOID = GetOID(kOIDCategory_SigAlgo, static_cast<uint8_t>(sigAlgoId));
-            ASN1_ENCODE_OBJECT_ID(sigAlgoOID);
+            err        = writer.PutAlgorithmIdentifier(sigAlgoOID);
+            SuccessOrExit(err);
 
             certData.mSigAlgoOID = sigAlgoOID;
         }
-        ASN1_END_SEQUENCE;
 
         // issuer Name
         err = reader.Next(kTLVType_List, ContextTag(kTag_Issuer));
@@ -868,8 +864,8 @@ static CHIP_ERROR DecodeConvertCert(TLVReader & reader, ASN1Writer & writer, Chi
 
         // signatureAlgorithm   AlgorithmIdentifier
         // AlgorithmIdentifier ::= SEQUENCE
-        ASN1_START_SEQUENCE { ASN1_ENCODE_OBJECT_ID(static_cast<OID>(certData.mSigAlgoOID)); }
-        ASN1_END_SEQUENCE;
+        err = writer.PutAlgorithmIdentifier(static_cast<OID>(certData.mSigAlgoOID));
+        SuccessOrExit(err);
 
         // signatureValue BIT STRING
         err = DecodeConvertECDSASignature(reader, writer, certData);
@@ -66,12 +66,7 @@ CHIP_ERROR EncodeSubjectPublicKeyInfo(const Crypto::P256PublicKey & pubkey, ASN1
 
     ASN1_START_SEQUENCE
     {
-        ASN1_START_SEQUENCE
-        {
-            ASN1_ENCODE_OBJECT_ID(kOID_PubKeyAlgo_ECPublicKey);
-            ASN1_ENCODE_OBJECT_ID(kOID_EllipticCurve_prime256v1);
-        }
-        ASN1_END_SEQUENCE;
+        ReturnErrorOnFailure(writer.PutAlgorithmIdentifier(kOID_PubKeyAlgo_ECPublicKey, kOID_EllipticCurve_prime256v1));
 
         ReturnErrorOnFailure(writer.PutBitString(0, pubkey, static_cast<uint8_t>(pubkey.Length())));
     }
@@ -350,8 +345,7 @@ CHIP_ERROR EncodeTBSCert(const X509CertRequestParams & requestParams, Certificat
 
         ReturnErrorOnFailure(writer.PutInteger(requestParams.SerialNumber));
 
-        ASN1_START_SEQUENCE { ASN1_ENCODE_OBJECT_ID(kOID_SigAlgo_ECDSAWithSHA256); }
-        ASN1_END_SEQUENCE;
+        ReturnErrorOnFailure(writer.PutAlgorithmIdentifier(kOID_SigAlgo_ECDSAWithSHA256));
 
         // Issuer OID depends on if cert is being signed by the root CA
         if (issuerLevel == kIssuerIsRootCA)
@@ -421,8 +415,7 @@ CHIP_ERROR NewChipX509Cert(const X509CertRequestParams & requestParams, Certific
     {
         ReturnErrorOnFailure(EncodeTBSCert(requestParams, issuerLevel, subject, subjectPubkey, issuerKeypair.Pubkey(), writer));
 
-        ASN1_START_SEQUENCE { ASN1_ENCODE_OBJECT_ID(kOID_SigAlgo_ECDSAWithSHA256); }
-        ASN1_END_SEQUENCE;
+        ReturnErrorOnFailure(writer.PutAlgorithmIdentifier(kOID_SigAlgo_ECDSAWithSHA256));
 
         ReturnErrorOnFailure(EncodeChipECDSASignature(signature, writer));
     }
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the NOCBatchIssuer.
+ */
+
+#include <credentials/NOCBatchIssuer.h>
+
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace Credentials {
+
+CHIP_ERROR NOCBatchIssuer::Init(Crypto::P256Keypair & issuerKeypair, CertificateIssuerLevel issuerLevel, Delegate * delegate,
+                                System::WorkerPool * pool)
+{
+    VerifyOrReturnError(!IsBusy(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mIssuerKeypair = &issuerKeypair;
+    mIssuerLevel   = issuerLevel;
+    mDelegate      = delegate;
+    mPool          = pool;
+
+    for (Slot & slot : mSlots)
+    {
+        slot.mIssuer = this;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR NOCBatchIssuer::Issue(NOCRequest * requests, size_t numRequests)
+{
+    VerifyOrReturnError(mIssuerKeypair != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!IsBusy(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(requests != nullptr || numRequests == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mRequests    = requests;
+    mNumRequests = numRequests;
+    mNextRequest = 0;
+    mNumDone     = 0;
+    mNumFailed   = 0;
+
+    if (numRequests == 0)
+    {
+        mDelegate->OnBatchComplete(0, 0);
+        return CHIP_NO_ERROR;
+    }
+
+    for (Slot & slot : mSlots)
+    {
+        if (mNextRequest == mNumRequests)
+        {
+            break;
+        }
+        StartNext(slot);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void NOCBatchIssuer::Cancel()
+{
+    for (Slot & slot : mSlots)
+    {
+        if (mPool != nullptr)
+        {
+            mPool->Cancel(slot.mJob);
+        }
+        slot.mRequest = nullptr;
+    }
+
+    mRequests    = nullptr;
+    mNumRequests = 0;
+    mNextRequest = 0;
+    mNumDone     = 0;
+    mNumFailed   = 0;
+}
+
+CHIP_ERROR NOCBatchIssuer::IssueOne(NOCRequest & request) const
+{
+    Crypto::P256PublicKey subjectPubkey;
+
+    VerifyOrReturnError(request.CSR != nullptr && request.CertBuf != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(Crypto::VerifyCertificateSigningRequest(request.CSR, request.CSRLength, subjectPubkey));
+
+    return NewNodeOperationalX509Cert(request.Params, mIssuerLevel, subjectPubkey, *mIssuerKeypair, request.CertBuf,
+                                      request.CertBufSize, request.CertLen);
+}
+
+void NOCBatchIssuer::StartNext(Slot & slot)
+{
+    slot.mRequest = nullptr;
+
+    while (mNextRequest < mNumRequests)
+    {
+        NOCRequest & request = mRequests[mNextRequest++];
+
+        slot.mRequest = &request;
+        if (mPool != nullptr && mPool->Post(slot.mJob, HandleWork, HandleComplete, &slot) == CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        // Without a running pool, the request is issued on the calling thread.
+        slot.mRequest  = nullptr;
+        request.Status = IssueOne(request);
+        Complete(request);
+    }
+}
+
+void NOCBatchIssuer::Complete(NOCRequest & request)
+{
+    mNumDone++;
+    if (request.Status != CHIP_NO_ERROR)
+    {
+        mNumFailed++;
+    }
+
+    mDelegate->OnNOCIssued(request);
+
+    if (mNumRequests > 0 && mNumDone == mNumRequests)
+    {
+        mDelegate->OnBatchComplete(mNumDone - mNumFailed, mNumFailed);
+    }
+}
+
+void NOCBatchIssuer::HandleWork(void * appState)
+{
+    Slot * slot = static_cast<Slot *>(appState);
+
+    slot->mRequest->Status = slot->mIssuer->IssueOne(*slot->mRequest);
+}
+
+void NOCBatchIssuer::HandleComplete(void * appState)
+{
+    Slot * slot           = static_cast<Slot *>(appState);
+    NOCBatchIssuer * self = slot->mIssuer;
+    NOCRequest & request  = *slot->mRequest;
+
+    // Keep the workers busy while the delegate handles the certificate.
+    self->StartNext(*slot);
+    self->Complete(request);
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the NOCBatchIssuer, which issues node operational
+ *      certificates for a batch of certificate signing requests, verifying
+ *      and signing them on a System::WorkerPool.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <support/DLLUtil.h>
+#include <system/SystemWorkerPool.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * A node operational certificate to issue, from the certificate signing request of the node.
+ */
+struct NOCRequest
+{
+    X509CertRequestParams Params; /**< Must have a node ID and a fabric ID. */
+    const uint8_t * CSR  = nullptr;
+    size_t CSRLength     = 0;
+    uint8_t * CertBuf    = nullptr; /**< Receives the X.509 DER encoded certificate. */
+    uint32_t CertBufSize = 0;
+
+    uint32_t CertLen  = 0;             /**< Set once the request is done. */
+    CHIP_ERROR Status = CHIP_NO_ERROR; /**< Set once the request is done. */
+};
+
+/**
+ * @class NOCBatchIssuer
+ *
+ * @brief
+ *   Issues the node operational certificates of a batch of NOCRequest. Verifying a CSR and signing its certificate are the
+ *   expensive parts of issuance, and they run on the worker threads of a System::WorkerPool, up to
+ *   CHIP_CONFIG_NOC_BATCH_MAX_IN_FLIGHT requests at a time. Each request is handed to the delegate on the CHIP thread as soon
+ *   as it is done, so that its certificate can be sent or stored while the rest of the batch is signed.
+ *
+ *   Without a running pool, the requests are issued one by one on the calling thread, before Issue() returns.
+ *
+ *   The issuer keypair signs on several worker threads at the same time, so its ECDSA_sign_msg() must allow it. That is the
+ *   case of the OpenSSL keypair, and of the mbedTLS one with CHIP_CONFIG_DRBG_PER_THREAD. A keypair kept in an HSM that
+ *   serves a single session at a time is used with a pool of one thread.
+ */
+class DLL_EXPORT NOCBatchIssuer
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() {}
+
+        /**
+         * Called on the CHIP thread for each request once it is done, in the order the requests complete. The request
+         * holds its certificate if its Status is CHIP_NO_ERROR.
+         */
+        virtual void OnNOCIssued(NOCRequest & request) = 0;
+
+        /**
+         * Called on the CHIP thread once every request of the batch is done.
+         */
+        virtual void OnBatchComplete(size_t numIssued, size_t numFailed) {}
+    };
+
+    NOCBatchIssuer() {}
+    ~NOCBatchIssuer() { Cancel(); }
+
+    /**
+     * @param[in] issuerKeypair   The key signing the certificates. It must outlive the issuer.
+     * @param[in] issuerLevel     Whether the certificates are issued by the root CA or by an intermediate CA.
+     * @param[in] delegate        Receives the requests as they are done.
+     * @param[in] pool            The pool to sign on, or nullptr to sign on the calling thread.
+     */
+    CHIP_ERROR Init(Crypto::P256Keypair & issuerKeypair, CertificateIssuerLevel issuerLevel, Delegate * delegate,
+                    System::WorkerPool * pool);
+
+    /**
+     * Start issuing the certificates of a batch. The requests must stay in place until the batch completes or is cancelled.
+     * Must not be called while a batch is in progress, nor from the delegate callbacks.
+     */
+    CHIP_ERROR Issue(NOCRequest * requests, size_t numRequests);
+
+    /**
+     * Stop the batch in progress. The requests that are not done are left untouched and are not handed to the delegate.
+     */
+    void Cancel();
+
+    bool IsBusy() const { return mNumDone < mNumRequests; }
+
+private:
+    struct Slot
+    {
+        NOCBatchIssuer * mIssuer = nullptr;
+        NOCRequest * mRequest    = nullptr;
+        System::WorkerJob mJob;
+    };
+
+    static void HandleWork(void * appState);
+    static void HandleComplete(void * appState);
+
+    CHIP_ERROR IssueOne(NOCRequest & request) const;
+    void StartNext(Slot & slot);
+    void Complete(NOCRequest & request);
+
+    Crypto::P256Keypair * mIssuerKeypair = nullptr;
+    CertificateIssuerLevel mIssuerLevel  = kIssuerIsRootCA;
+    Delegate * mDelegate                 = nullptr;
+    System::WorkerPool * mPool           = nullptr;
+
+    NOCRequest * mRequests = nullptr;
+    size_t mNumRequests    = 0;
+    size_t mNextRequest    = 0;
+    size_t mNumDone        = 0;
+    size_t mNumFailed      = 0;
+
+    Slot mSlots[CHIP_CONFIG_NOC_BATCH_MAX_IN_FLIGHT];
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -34,6 +34,8 @@
 
 #include <nlunit-test.h>
 
+#include <utility>
+
 #include "CHIPCert_test_vectors.h"
 
 using namespace chip;
@@ -482,6 +484,189 @@ static void TestChipCert_CertValidTime(nlTestSuite * inSuite, void * inContext)
     certSet.Release();
 }
 
+static void TestChipCert_NoDecodeBuffer(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+
+    // The TBS hashes are computed while the certificates are decoded, without a decode buffer.
+    err = certSet.Init(kStandardCertsCount, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = LoadTestCertSet01(certSet);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2021, 1, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    certSet.Release();
+}
+
+static void TestChipCert_CertSignatureCache(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+
+    certSet.Init(kStandardCertsCount, kTestCertBufSize);
+
+    err = LoadTestCertSet01(certSet);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2021, 1, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    // Validate the chain twice, the second time from remembered signatures.
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // A certificate whose content changed must not validate from a remembered signature.
+    ChipCertificateData * nodeCert = const_cast<ChipCertificateData *>(certSet.GetLastCert());
+    nodeCert->mTBSHash[0] ^= 0x01;
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    nodeCert->mTBSHash[0] ^= 0x01;
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The remembered signatures stay valid when the same certificates are loaded again.
+    certSet.Clear();
+    err = LoadTestCertSet01(certSet);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    certSet.Release();
+}
+
+static void TestChipCert_CertSignatureVerifierCache(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    ChipCertificateData certsArray[kStandardCertsCount];
+    uint8_t decodeBuf[kTestCertBufSize];
+    ChipCertificateSet certSet;
+    ChipCertificateSet movedCertSet;
+    ValidationContext validContext;
+
+    // The verifiers are allocated on first use, also for a set that was given its memory.
+    err = certSet.Init(certsArray, kStandardCertsCount, decodeBuf, sizeof(decodeBuf));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = LoadTestCertSet01(certSet);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2021, 1, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The verifiers follow the certificates when the set is moved, and still reject a changed certificate.
+    movedCertSet = std::move(certSet);
+
+    ChipCertificateData * nodeCert = const_cast<ChipCertificateData *>(movedCertSet.GetLastCert());
+    nodeCert->mTBSHash[0] ^= 0x02;
+    err = movedCertSet.ValidateCert(movedCertSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    nodeCert->mTBSHash[0] ^= 0x02;
+    err = movedCertSet.ValidateCert(movedCertSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    movedCertSet.Release();
+    certSet.Release();
+}
+
+static void TestChipCert_LoadCertWithTBSHash(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    ChipCertificateSet certSet;
+    ChipCertificateSet cachedCertSet;
+    ValidationContext validContext;
+    uint8_t tbsHashes[2][kSHA256_Hash_Length];
+    const uint8_t * icaCert;
+    uint32_t icaCertLen;
+    const uint8_t * nodeCert;
+    uint32_t nodeCertLen;
+
+    certSet.Init(kStandardCertsCount, 0);
+    cachedCertSet.Init(kStandardCertsCount, 0);
+
+    err = LoadTestCertSet01(certSet);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    memcpy(tbsHashes[0], certSet.GetCertSet()[1].mTBSHash, kSHA256_Hash_Length);
+    memcpy(tbsHashes[1], certSet.GetCertSet()[2].mTBSHash, kSHA256_Hash_Length);
+
+    err = GetTestCert(TestCert::kICA01, sNullLoadFlag, icaCert, icaCertLen);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = GetTestCert(TestCert::kNode01_01, sNullLoadFlag, nodeCert, nodeCertLen);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The certificates loaded with the TBS hashes computed above decode the same.
+    err = LoadTestCert(cachedCertSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = cachedCertSet.LoadCert(icaCert, icaCertLen, sNullDecodeFlag, tbsHashes[0]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = cachedCertSet.LoadCert(nodeCert, nodeCertLen, sNullDecodeFlag, tbsHashes[1]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (uint8_t i = 1; i < 3; i++)
+    {
+        const ChipCertificateData & cert       = certSet.GetCertSet()[i];
+        const ChipCertificateData & cachedCert = cachedCertSet.GetCertSet()[i];
+
+        NL_TEST_ASSERT(inSuite, cachedCert.mCertFlags.Has(CertFlags::kTBSHashPresent));
+        NL_TEST_ASSERT(inSuite, memcmp(cachedCert.mTBSHash, cert.mTBSHash, kSHA256_Hash_Length) == 0);
+        NL_TEST_ASSERT(inSuite, cachedCert.mSubjectDN.IsEqual(cert.mSubjectDN));
+        NL_TEST_ASSERT(inSuite, cachedCert.mSubjectKeyId.IsEqual(cert.mSubjectKeyId));
+        NL_TEST_ASSERT(inSuite, cachedCert.mPublicKeyLen == cert.mPublicKeyLen);
+    }
+
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2021, 1, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    err = cachedCertSet.ValidateCert(cachedCertSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // A TBS hash that does not belong to the certificate fails its signature verification.
+    cachedCertSet.Clear();
+    err = LoadTestCert(cachedCertSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = cachedCertSet.LoadCert(icaCert, icaCertLen, sNullDecodeFlag, tbsHashes[0]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = cachedCertSet.LoadCert(nodeCert, nodeCertLen, sGenTBSHashFlag, tbsHashes[0]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    validContext.Reset();
+    err = SetEffectiveTime(validContext, 2021, 1, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    err = cachedCertSet.ValidateCert(cachedCertSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+
+    certSet.Release();
+    cachedCertSet.Release();
+}
+
 static void TestChipCert_CertUsage(nlTestSuite * inSuite, void * inContext)
 {
     CHIP_ERROR err;
@@ -927,6 +1112,10 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test CHIP Certificate X509 to CHIP Conversion", TestChipCert_X509ToChip),
     NL_TEST_DEF("Test CHIP Certificate Validation", TestChipCert_CertValidation),
     NL_TEST_DEF("Test CHIP Certificate Validation time", TestChipCert_CertValidTime),
+    NL_TEST_DEF("Test CHIP Certificate Signature Cache", TestChipCert_CertSignatureCache),
+    NL_TEST_DEF("Test CHIP Certificate Signature Verifier Cache", TestChipCert_CertSignatureVerifierCache),
+    NL_TEST_DEF("Test CHIP Certificate Load With TBS Hash", TestChipCert_LoadCertWithTBSHash),
+    NL_TEST_DEF("Test CHIP Certificate Set Without Decode Buffer", TestChipCert_NoDecodeBuffer),
     NL_TEST_DEF("Test CHIP Certificate Usage", TestChipCert_CertUsage),
     NL_TEST_DEF("Test CHIP Certificate Type", TestChipCert_CertType),
     NL_TEST_DEF("Test CHIP Generate Root Certificate", TestChipCert_GenerateRootCert),
@@ -0,0 +1,339 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests and a benchmark of the NOCBatchIssuer. The benchmark
+ *      issues a batch of node operational certificates on the calling
+ *      thread, then on a System::WorkerPool, and prints the certificates
+ *      per second of each. Its assertions only check that every
+ *      certificate was issued.
+ *
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/NOCBatchIssuer.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemLayer.h>
+#include <system/SystemWorkerPool.h>
+
+#include <nlunit-test.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#include <sys/select.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+#include <inttypes.h>
+#include <stdio.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kNumRequests     = 32;
+constexpr uint32_t kCertBufSize   = 1024;
+constexpr size_t kMaxWorkers      = CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS;
+constexpr size_t kNumWorkers      = (kMaxWorkers < 4) ? kMaxWorkers : 4;
+constexpr uint64_t kMaxWaitUs     = 30000000;
+constexpr uint64_t kTestFabricId  = 0xFAB000000000001D;
+constexpr uint64_t kTestRootId    = 0xCACACACA00000001;
+constexpr uint64_t kTestNodeId    = 0xDEDEDEDE00010001;
+
+#define TEST_POOL_ENABLED (CHIP_SYSTEM_CONFIG_POSIX_LOCKING && CHIP_SYSTEM_CONFIG_USE_SOCKETS)
+
+class CountingDelegate : public NOCBatchIssuer::Delegate
+{
+public:
+    void OnNOCIssued(NOCRequest & request) override { mNumHandled++; }
+
+    void OnBatchComplete(size_t numIssued, size_t numFailed) override
+    {
+        mNumIssued = numIssued;
+        mNumFailed = numFailed;
+        mNumBatches++;
+    }
+
+    size_t mNumHandled = 0;
+    size_t mNumIssued  = 0;
+    size_t mNumFailed  = 0;
+    size_t mNumBatches = 0;
+};
+
+struct BatchContext
+{
+    P256Keypair mRootKeypair;
+    P256Keypair mNodeKeypairs[kNumRequests];
+    uint8_t mCSRs[kNumRequests][kMAX_CSR_Length];
+    size_t mCSRLengths[kNumRequests];
+    uint8_t mCerts[kNumRequests][kCertBufSize];
+    NOCRequest mRequests[kNumRequests];
+    System::Layer mSystemLayer;
+};
+
+// Heap allocated, the keypairs and certificates are too large for the stack of some test targets.
+BatchContext * gContext;
+
+void ResetRequests()
+{
+    for (size_t i = 0; i < kNumRequests; i++)
+    {
+        NOCRequest & request = gContext->mRequests[i];
+        int64_t serialNumber = static_cast<int64_t>(i + 1);
+
+        request             = NOCRequest();
+        request.Params      = { serialNumber, kTestRootId, 9876, 98790000, true, kTestFabricId, true, kTestNodeId + i };
+        request.CSR         = gContext->mCSRs[i];
+        request.CSRLength   = gContext->mCSRLengths[i];
+        request.CertBuf     = gContext->mCerts[i];
+        request.CertBufSize = kCertBufSize;
+    }
+}
+
+/**
+ * Check that every request holds the certificate of its node, signed by the root.
+ */
+bool CheckCertificates()
+{
+    for (size_t i = 0; i < kNumRequests; i++)
+    {
+        const NOCRequest & request       = gContext->mRequests[i];
+        const P256PublicKey & nodePubkey = gContext->mNodeKeypairs[i].Pubkey();
+        uint8_t chipCert[kCertBufSize];
+        uint32_t chipCertLen;
+        ChipCertificateData certData;
+
+        VerifyOrReturnError(request.Status == CHIP_NO_ERROR, false);
+        VerifyOrReturnError(ConvertX509CertToChipCert(request.CertBuf, request.CertLen, chipCert, sizeof(chipCert), chipCertLen) ==
+                                CHIP_NO_ERROR,
+                            false);
+        VerifyOrReturnError(DecodeChipCert(chipCert, chipCertLen, certData) == CHIP_NO_ERROR, false);
+        VerifyOrReturnError(certData.mPublicKeyLen == nodePubkey.Length(), false);
+        VerifyOrReturnError(memcmp(certData.mPublicKey, nodePubkey, nodePubkey.Length()) == 0, false);
+    }
+    return true;
+}
+
+#if TEST_POOL_ENABLED
+void ServiceEvents(System::Layer & layer)
+{
+    fd_set readFDs, writeFDs, exceptFDs;
+    int numFDs        = 0;
+    timeval sleepTime = { 0, 10000 };
+
+    FD_ZERO(&readFDs);
+    FD_ZERO(&writeFDs);
+    FD_ZERO(&exceptFDs);
+
+    layer.PrepareSelect(numFDs, &readFDs, &writeFDs, &exceptFDs, sleepTime);
+    int selectRes = select(numFDs, &readFDs, &writeFDs, &exceptFDs, &sleepTime);
+    layer.HandleSelectResult(selectRes, &readFDs, &writeFDs, &exceptFDs);
+}
+
+void DriveUntilComplete(NOCBatchIssuer & issuer)
+{
+    const uint64_t begin = System::Layer::GetClock_MonotonicHiRes();
+
+    while (issuer.IsBusy() && System::Layer::GetClock_MonotonicHiRes() - begin < kMaxWaitUs)
+    {
+        ServiceEvents(gContext->mSystemLayer);
+    }
+}
+#endif // TEST_POOL_ENABLED
+
+/**
+ * Issue the requests and return the elapsed time in microseconds.
+ */
+uint64_t IssueBatch(nlTestSuite * inSuite, System::WorkerPool * pool)
+{
+    NOCBatchIssuer issuer;
+    CountingDelegate delegate;
+
+    ResetRequests();
+    NL_TEST_ASSERT(inSuite, issuer.Init(gContext->mRootKeypair, kIssuerIsRootCA, &delegate, pool) == CHIP_NO_ERROR);
+
+    const uint64_t begin = System::Layer::GetClock_MonotonicHiRes();
+
+    NL_TEST_ASSERT(inSuite, issuer.Issue(gContext->mRequests, kNumRequests) == CHIP_NO_ERROR);
+#if TEST_POOL_ENABLED
+    DriveUntilComplete(issuer);
+#endif // TEST_POOL_ENABLED
+
+    const uint64_t elapsed = System::Layer::GetClock_MonotonicHiRes() - begin;
+
+    NL_TEST_ASSERT(inSuite, !issuer.IsBusy());
+    NL_TEST_ASSERT(inSuite, delegate.mNumBatches == 1);
+    NL_TEST_ASSERT(inSuite, delegate.mNumHandled == kNumRequests);
+    NL_TEST_ASSERT(inSuite, delegate.mNumIssued == kNumRequests);
+    NL_TEST_ASSERT(inSuite, delegate.mNumFailed == 0);
+
+    return elapsed;
+}
+
+void TestNOCBatchIssuer_Inline(nlTestSuite * inSuite, void * inContext)
+{
+    NOCBatchIssuer issuer;
+    CountingDelegate delegate;
+
+    IssueBatch(inSuite, nullptr);
+    NL_TEST_ASSERT(inSuite, CheckCertificates());
+
+    // Requests that cannot be issued are reported as failed, without stopping the batch.
+    ResetRequests();
+    gContext->mRequests[1].CSR              = nullptr;
+    gContext->mRequests[2].CSR              = gContext->mCSRs[3];
+    gContext->mRequests[2].CSRLength        = gContext->mCSRLengths[3] - 1;
+    gContext->mRequests[3].Params.HasNodeID = false;
+
+    NL_TEST_ASSERT(inSuite, issuer.Init(gContext->mRootKeypair, kIssuerIsRootCA, &delegate, nullptr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, issuer.Issue(gContext->mRequests, kNumRequests) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !issuer.IsBusy());
+    NL_TEST_ASSERT(inSuite, delegate.mNumHandled == kNumRequests);
+    NL_TEST_ASSERT(inSuite, delegate.mNumIssued == kNumRequests - 3);
+    NL_TEST_ASSERT(inSuite, delegate.mNumFailed == 3);
+    NL_TEST_ASSERT(inSuite, gContext->mRequests[0].Status == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gContext->mRequests[1].Status == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, gContext->mRequests[2].Status != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gContext->mRequests[3].Status == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // An empty batch completes at once.
+    NL_TEST_ASSERT(inSuite, issuer.Issue(nullptr, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, delegate.mNumBatches == 2);
+    NL_TEST_ASSERT(inSuite, delegate.mNumIssued == 0);
+}
+
+void TestNOCBatchIssuer_WorkerPool(nlTestSuite * inSuite, void * inContext)
+{
+#if TEST_POOL_ENABLED
+    System::WorkerPool pool;
+    NOCBatchIssuer issuer;
+    CountingDelegate delegate;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&gContext->mSystemLayer, kNumWorkers) == CHIP_NO_ERROR);
+
+    IssueBatch(inSuite, &pool);
+    NL_TEST_ASSERT(inSuite, CheckCertificates());
+
+    // A batch cannot start while another is in progress, and a cancelled batch does not complete.
+    ResetRequests();
+    NL_TEST_ASSERT(inSuite, issuer.Init(gContext->mRootKeypair, kIssuerIsRootCA, &delegate, &pool) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, issuer.Issue(gContext->mRequests, kNumRequests) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, issuer.IsBusy());
+    NL_TEST_ASSERT(inSuite, issuer.Issue(gContext->mRequests, kNumRequests) == CHIP_ERROR_INCORRECT_STATE);
+
+    issuer.Cancel();
+    NL_TEST_ASSERT(inSuite, !issuer.IsBusy());
+    for (int i = 0; i < 10; i++)
+    {
+        ServiceEvents(gContext->mSystemLayer);
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mNumHandled == 0);
+    NL_TEST_ASSERT(inSuite, delegate.mNumBatches == 0);
+
+    pool.Shutdown();
+
+    // A stopped pool leaves the batch to the calling thread.
+    IssueBatch(inSuite, &pool);
+    NL_TEST_ASSERT(inSuite, CheckCertificates());
+#endif // TEST_POOL_ENABLED
+}
+
+void PrintResult(const char * aName, uint64_t aElapsedUs)
+{
+    printf("    %-28s %8" PRIu64 " us total, %6" PRIu64 " certificates/s (%u certificates)\n", aName, aElapsedUs,
+           (aElapsedUs > 0) ? (kNumRequests * UINT64_C(1000000) / aElapsedUs) : 0, static_cast<unsigned>(kNumRequests));
+}
+
+void BenchmarkNOCBatchIssuer(nlTestSuite * inSuite, void * inContext)
+{
+    PrintResult("Inline", IssueBatch(inSuite, nullptr));
+
+#if TEST_POOL_ENABLED
+    System::WorkerPool pool;
+    char name[32];
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&gContext->mSystemLayer, kNumWorkers) == CHIP_NO_ERROR);
+    snprintf(name, sizeof(name), "%u worker threads", static_cast<unsigned>(kNumWorkers));
+    PrintResult(name, IssueBatch(inSuite, &pool));
+#endif // TEST_POOL_ENABLED
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test NOC batch issuance inline", TestNOCBatchIssuer_Inline),
+    NL_TEST_DEF("Test NOC batch issuance on a worker pool", TestNOCBatchIssuer_WorkerPool),
+    NL_TEST_DEF("Benchmark NOC batch issuance", BenchmarkNOCBatchIssuer),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSetup(void * inContext)
+{
+    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+
+    gContext = chip::Platform::New<BatchContext>();
+    VerifyOrReturnError(gContext != nullptr, FAILURE);
+
+    VerifyOrReturnError(gContext->mSystemLayer.Init(nullptr) == CHIP_SYSTEM_NO_ERROR, FAILURE);
+    VerifyOrReturnError(gContext->mRootKeypair.Initialize() == CHIP_NO_ERROR, FAILURE);
+
+    for (size_t i = 0; i < kNumRequests; i++)
+    {
+        gContext->mCSRLengths[i] = sizeof(gContext->mCSRs[i]);
+        VerifyOrReturnError(gContext->mNodeKeypairs[i].Initialize() == CHIP_NO_ERROR, FAILURE);
+        VerifyOrReturnError(gContext->mNodeKeypairs[i].NewCertificateSigningRequest(gContext->mCSRs[i], gContext->mCSRLengths[i]) ==
+                                CHIP_NO_ERROR,
+                            FAILURE);
+    }
+
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    gContext->mSystemLayer.Shutdown();
+
+    chip::Platform::Delete(gContext);
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestNOCBatchIssuer()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Credentials-NOC-Batch-Issuer",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestNOCBatchIssuer)
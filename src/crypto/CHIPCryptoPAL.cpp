@@ -440,5 +440,27 @@ exit:
     return error;
 }
 
+AES_CCM_cipher::AES_CCM_cipher(const AES_CCM_cipher & other) : AES_CCM_cipher()
+{
+    *this = other;
+}
+
+AES_CCM_cipher & AES_CCM_cipher::operator=(const AES_CCM_cipher & other)
+{
+    if (this != &other)
+    {
+        Clear();
+
+        // The backend context cannot be shared, so the copy gets its own. If that fails the copy
+        // is left without a key, and Encrypt() and Decrypt() report CHIP_ERROR_INCORRECT_STATE.
+        if (other.IsInitialized())
+        {
+            Init(other.mKey, other.mKeyLength);
+        }
+    }
+
+    return *this;
+}
+
 } // namespace Crypto
 } // namespace chip
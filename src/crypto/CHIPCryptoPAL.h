@@ -57,9 +57,12 @@ const size_t kP256_PublicKey_Length  = 65;
  * in a public interface file. The validity of these sizes is verified by static_assert in
  * the implementation files.
  */
-const size_t kMAX_Spake2p_Context_Size     = 1024;
-const size_t kMAX_Hash_SHA256_Context_Size = 296;
-const size_t kMAX_P256Keypair_Context_Size = 512;
+const size_t kMAX_Spake2p_Context_Size      = 1024;
+const size_t kMAX_Hash_SHA256_Context_Size  = 296;
+const size_t kMAX_P256Keypair_Context_Size  = 512;
+const size_t kMAX_P256Verifier_Context_Size = 512;
+const size_t kMAX_AES_CCM_Context_Size      = 128;
+const size_t kMAX_AES_CCM_Key_Length        = 32;
 
 /**
  * Spake2+ parameters for P256
@@ -306,6 +309,62 @@ private:
     bool mInitialized = false;
 };
 
+struct alignas(size_t) P256SignatureVerifierContext
+{
+    uint8_t mBytes[kMAX_P256Verifier_Context_Size];
+};
+
+/**
+ * @brief Verifies ECDSA signatures made with one P256 public key.
+ *
+ * P256PublicKey decodes and validates the key for every signature. A verifier does it once, in Init(), and keeps
+ * whatever the crypto library precomputes for the key and its curve. Each verification then costs only the
+ * verification itself. It is meant for issuer keys that verify many signatures, such as root and intermediate CA keys.
+ *
+ * A verifier may update its precomputed state while verifying, so it must only be used by one thread at a time.
+ */
+class P256SignatureVerifier
+{
+public:
+    P256SignatureVerifier() {}
+    ~P256SignatureVerifier() { Clear(); }
+
+    P256SignatureVerifier(const P256SignatureVerifier &) = delete;
+    P256SignatureVerifier & operator=(const P256SignatureVerifier &) = delete;
+
+    /**
+     * @brief Decode and validate the public key that signatures are verified with.
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Init(const P256PublicKey & publicKey);
+
+    /** @brief Release the decoded key. The verifier must be initialized again before use.
+     **/
+    void Clear();
+
+    bool IsInitialized() const { return mInitialized; }
+
+    /** @brief Return whether the verifier was initialized with the given public key.
+     **/
+    bool IsKey(const P256PublicKey & publicKey) const
+    {
+        return mInitialized && memcmp(mPublicKey, publicKey, kP256_PublicKey_Length) == 0;
+    }
+
+    /** @brief Same as P256PublicKey::ECDSA_validate_msg_signature(), with the key of the verifier.
+     **/
+    CHIP_ERROR ValidateMsgSignature(const uint8_t * msg, size_t msg_length, const P256ECDSASignature & signature);
+
+    /** @brief Same as P256PublicKey::ECDSA_validate_hash_signature(), with the key of the verifier.
+     **/
+    CHIP_ERROR ValidateHashSignature(const uint8_t * hash, size_t hash_length, const P256ECDSASignature & signature);
+
+private:
+    P256PublicKey mPublicKey;
+    P256SignatureVerifierContext mContext;
+    bool mInitialized = false;
+};
+
 /**
  * @brief A function that implements AES-CCM encryption
  * @param plaintext Plaintext to encrypt
@@ -345,6 +404,58 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext);
 
+struct alignas(size_t) AESCCMOpaqueContext
+{
+    uint8_t mOpaque[kMAX_AES_CCM_Context_Size];
+};
+
+/**
+ * @brief A class that implements AES-CCM encryption and decryption of many messages under one key.
+ *        Unlike AES_CCM_encrypt() and AES_CCM_decrypt(), the cipher context and key schedule are set up
+ *        once and reused for every message until the key is cleared.
+ *        Copying an initialized object sets up a separate context holding the same key.
+ **/
+class AES_CCM_cipher
+{
+public:
+    AES_CCM_cipher();
+    AES_CCM_cipher(const AES_CCM_cipher & other);
+    AES_CCM_cipher & operator=(const AES_CCM_cipher & other);
+    ~AES_CCM_cipher();
+
+    /**
+     * @brief Sets up the cipher context for a key, replacing any previous one
+     * @param key Encryption key
+     * @param key_length Length of encryption key (in bytes)
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Init(const uint8_t * key, size_t key_length);
+
+    bool IsInitialized() const { return mKeyLength != 0; }
+
+    /**
+     * @brief Encrypts a message with the key given to Init(). Arguments are as for AES_CCM_encrypt().
+     **/
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Decrypts a message with the key given to Init(). Arguments are as for AES_CCM_decrypt().
+     **/
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length, uint8_t * plaintext);
+
+    /**
+     * @brief Releases the cipher context and zeroes the key.
+     **/
+    void Clear();
+
+private:
+    uint8_t mKey[kMAX_AES_CCM_Key_Length];
+    size_t mKeyLength = 0;
+    AESCCMOpaqueContext mContext;
+};
+
 /**
  * @brief Verify the Certificate Signing Request (CSR). If successfully verified, it outputs the public key from the CSR.
  * @param csr CSR in DER format
@@ -416,6 +527,31 @@ private:
 CHIP_ERROR HKDF_SHA256(const uint8_t * secret, size_t secret_length, const uint8_t * salt, size_t salt_length, const uint8_t * info,
                        size_t info_length, uint8_t * out_buffer, size_t out_length);
 
+/**
+ * @brief One key derived by HKDF_SHA256_Batch
+ **/
+struct HKDFOutput
+{
+    const uint8_t * info;
+    size_t info_length;
+    uint8_t * out_buffer;
+    size_t out_length;
+};
+
+/**
+ * @brief A function that derives several keys from the same secret and salt with SHA-256 based HKDF. The extract step
+ *        is run once and shared by the expand steps of all the outputs, which produce the same keys as HKDF_SHA256.
+ * @param secret The secret to use as the key to the HKDF
+ * @param secret_length Length of the secret
+ * @param salt Optional salt to use as input to the HKDF
+ * @param salt_length Length of the salt
+ * @param outputs The info and output buffer of each key to derive
+ * @param output_count Number of keys to derive
+ * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR HKDF_SHA256_Batch(const uint8_t * secret, size_t secret_length, const uint8_t * salt, size_t salt_length,
+                             const HKDFOutput * outputs, size_t output_count);
+
 /**
  * @brief A cryptographically secure random number generator based on NIST SP800-90A
  * @param out_buffer Buffer to write random bytes into
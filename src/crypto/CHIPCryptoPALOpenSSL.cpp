@@ -21,6 +21,7 @@
  */
 
 #include "CHIPCryptoPAL.h"
+#include "DRBGPool.h"
 
 #include <type_traits>
 
@@ -47,6 +48,10 @@
 
 #include <string.h>
 
+#if CHIP_CONFIG_DRBG_PER_THREAD
+#include <pthread.h>
+#endif
+
 namespace chip {
 namespace Crypto {
 
@@ -281,6 +286,210 @@ exit:
     return error;
 }
 
+typedef struct
+{
+    EVP_CIPHER_CTX * mCipherCtx;
+    // OpenSSL fixes the nonce and tag lengths and the direction together with the key, so the key
+    // schedule is set up on first use and again only when one of them changes. A secure session
+    // only ever encrypts or only ever decrypts, so in practice that happens once.
+    size_t mIVLength;
+    size_t mTagLength;
+    bool mEncrypt;
+} AES_CCM_Context;
+
+static inline AES_CCM_Context * to_inner_aes_ccm_context(AESCCMOpaqueContext * context)
+{
+    return SafePointerCast<AES_CCM_Context *>(context);
+}
+
+AES_CCM_cipher::AES_CCM_cipher()
+{
+    memset(&mContext, 0, sizeof(mContext));
+}
+
+AES_CCM_cipher::~AES_CCM_cipher()
+{
+    Clear();
+}
+
+CHIP_ERROR AES_CCM_cipher::Init(const uint8_t * key, size_t key_length)
+{
+    Clear();
+
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidKeyLength(key_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    AES_CCM_Context * context = to_inner_aes_ccm_context(&mContext);
+
+    context->mCipherCtx = EVP_CIPHER_CTX_new();
+    VerifyOrReturnError(context->mCipherCtx != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    memcpy(mKey, key, key_length);
+    mKeyLength = key_length;
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR _setAESCCMKey(AES_CCM_Context * context, const uint8_t * key, size_t key_length, size_t iv_length,
+                                size_t tag_length, bool encrypt)
+{
+    int result = 1;
+
+    if (context->mIVLength == iv_length && context->mTagLength == tag_length && context->mEncrypt == encrypt)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // Forget the previous lengths in case setting up the new ones fails halfway.
+    context->mIVLength  = 0;
+    context->mTagLength = 0;
+
+    // 16 bytes key for AES-CCM-128
+    const EVP_CIPHER * type = (key_length == 16) ? EVP_aes_128_ccm() : EVP_aes_256_ccm();
+
+    // Pass in cipher
+    result = EVP_CipherInit_ex(context->mCipherCtx, type, nullptr, nullptr, nullptr, encrypt ? 1 : 0);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in IV length.  Cast is safe because the caller checked with CanCastTo.
+    result = EVP_CIPHER_CTX_ctrl(context->mCipherCtx, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(iv_length), nullptr);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in tag length. Cast is safe because the caller checked _isValidTagLength.
+    result = EVP_CIPHER_CTX_ctrl(context->mCipherCtx, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in key
+    result = EVP_CipherInit_ex(context->mCipherCtx, nullptr, nullptr, Uint8::to_const_uchar(key), nullptr, encrypt ? 1 : 0);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    context->mIVLength  = iv_length;
+    context->mTagLength = tag_length;
+    context->mEncrypt   = encrypt;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_cipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    AES_CCM_Context * context = to_inner_aes_ccm_context(&mContext);
+    int bytesWritten          = 0;
+    size_t ciphertext_length  = 0;
+    int result                = 1;
+
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(iv_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(_setAESCCMKey(context, mKey, mKeyLength, iv_length, tag_length, true));
+
+    // Pass in iv, keeping the key schedule
+    result = EVP_EncryptInit_ex(context->mCipherCtx, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in plain text length
+    result = EVP_EncryptUpdate(context->mCipherCtx, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in AAD
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_EncryptUpdate(context->mCipherCtx, nullptr, &bytesWritten, Uint8::to_const_uchar(aad),
+                                   static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    // Encrypt
+    result = EVP_EncryptUpdate(context->mCipherCtx, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                               static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten >= 0, CHIP_ERROR_INTERNAL);
+    ciphertext_length = static_cast<unsigned int>(bytesWritten);
+
+    // Finalize encryption
+    result = EVP_EncryptFinal_ex(context->mCipherCtx, ciphertext + ciphertext_length, &bytesWritten);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Get tag
+    result = EVP_CIPHER_CTX_ctrl(context->mCipherCtx, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_cipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length, uint8_t * plaintext)
+{
+    AES_CCM_Context * context = to_inner_aes_ccm_context(&mContext);
+    int bytesOutput           = 0;
+    int result                = 1;
+
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(iv_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(_setAESCCMKey(context, mKey, mKeyLength, iv_length, tag_length, false));
+
+    // Pass in iv, keeping the key schedule
+    result = EVP_DecryptInit_ex(context->mCipherCtx, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in expected tag
+    // Removing "const" from |tag| here should hopefully be safe as
+    // we're writing the tag, not reading.
+    result = EVP_CIPHER_CTX_ctrl(context->mCipherCtx, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                 const_cast<void *>(static_cast<const void *>(tag)));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in cipher text length
+    result = EVP_DecryptUpdate(context->mCipherCtx, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in aad
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_DecryptUpdate(context->mCipherCtx, nullptr, &bytesOutput, Uint8::to_const_uchar(aad),
+                                   static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in ciphertext. We wont get anything if validation fails.
+    result = EVP_DecryptUpdate(context->mCipherCtx, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                               static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM_cipher::Clear()
+{
+    AES_CCM_Context * context = to_inner_aes_ccm_context(&mContext);
+
+    if (context->mCipherCtx != nullptr)
+    {
+        EVP_CIPHER_CTX_free(context->mCipherCtx);
+    }
+
+    memset(&mContext, 0, sizeof(mContext));
+    ClearSecretData(mKey, sizeof(mKey));
+    mKeyLength = 0;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     CHIP_ERROR error = CHIP_NO_ERROR;
@@ -361,8 +570,11 @@ void Hash_SHA256_stream::Clear()
     memset(this, 0, sizeof(*this));
 }
 
-CHIP_ERROR HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
-                       const uint8_t * info, const size_t info_length, uint8_t * out_buffer, size_t out_length)
+// Runs the steps of HKDF selected by mode: the info is not used by EVP_PKEY_HKDEF_MODE_EXTRACT_ONLY, and the secret is the
+// pseudorandom key for EVP_PKEY_HKDEF_MODE_EXPAND_ONLY.
+static CHIP_ERROR HKDF_SHA256_Mode(int mode, const uint8_t * secret, const size_t secret_length, const uint8_t * salt,
+                                   const size_t salt_length, const uint8_t * info, const size_t info_length, uint8_t * out_buffer,
+                                   size_t out_length)
 {
     EVP_PKEY_CTX * context;
     CHIP_ERROR error = CHIP_NO_ERROR;
@@ -380,8 +592,11 @@ CHIP_ERROR HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const
         VerifyOrExit(salt != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
     }
 
-    VerifyOrExit(info_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(info != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    if (mode != EVP_PKEY_HKDEF_MODE_EXTRACT_ONLY)
+    {
+        VerifyOrExit(info_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(info != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    }
     VerifyOrExit(out_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(out_buffer != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -402,14 +617,17 @@ CHIP_ERROR HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const
         VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
     }
 
-    VerifyOrExit(CanCastTo<int>(info_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_PKEY_CTX_add1_hkdf_info(context, Uint8::to_const_uchar(info), static_cast<int>(info_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    if (mode != EVP_PKEY_HKDEF_MODE_EXTRACT_ONLY)
+    {
+        VerifyOrExit(CanCastTo<int>(info_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_PKEY_CTX_add1_hkdf_info(context, Uint8::to_const_uchar(info), static_cast<int>(info_length));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
-    result = EVP_PKEY_CTX_hkdf_mode(context, EVP_PKEY_HKDEF_MODE_EXTRACT_AND_EXPAND);
+    result = EVP_PKEY_CTX_hkdf_mode(context, mode);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Get the OKM (Output Key Material)
+    // Get the OKM (Output Key Material), or the PRK (Pseudorandom Key) when only extracting
     result = EVP_PKEY_derive(context, Uint8::to_uchar(out_buffer), &out_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
@@ -421,6 +639,43 @@ exit:
     return error;
 }
 
+CHIP_ERROR HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
+                       const uint8_t * info, const size_t info_length, uint8_t * out_buffer, size_t out_length)
+{
+    return HKDF_SHA256_Mode(EVP_PKEY_HKDEF_MODE_EXTRACT_AND_EXPAND, secret, secret_length, salt, salt_length, info, info_length,
+                            out_buffer, out_length);
+}
+
+CHIP_ERROR HKDF_SHA256_Batch(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
+                             const HKDFOutput * outputs, const size_t output_count)
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    uint8_t prk[kSHA256_Hash_Length];
+
+    VerifyOrExit(outputs != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(output_count > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+    for (size_t i = 0; i < output_count; i++)
+    {
+        VerifyOrExit(outputs[i].info_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(outputs[i].info != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    error = HKDF_SHA256_Mode(EVP_PKEY_HKDEF_MODE_EXTRACT_ONLY, secret, secret_length, salt, salt_length, nullptr, 0, prk,
+                             sizeof(prk));
+    SuccessOrExit(error);
+
+    for (size_t i = 0; i < output_count; i++)
+    {
+        error = HKDF_SHA256_Mode(EVP_PKEY_HKDEF_MODE_EXPAND_ONLY, prk, sizeof(prk), nullptr, 0, outputs[i].info,
+                                 outputs[i].info_length, outputs[i].out_buffer, outputs[i].out_length);
+        SuccessOrExit(error);
+    }
+
+exit:
+    ClearSecretData(prk, sizeof(prk));
+    return error;
+}
+
 CHIP_ERROR PBKDF2_sha256::pbkdf2_sha256(const uint8_t * password, size_t plen, const uint8_t * salt, size_t slen,
                                         unsigned int iteration_count, uint32_t key_length, uint8_t * output)
 {
@@ -463,17 +718,44 @@ CHIP_ERROR add_entropy_source(entropy_source fn_source, void * p_source, size_t
     return CHIP_NO_ERROR;
 }
 
+static CHIP_ERROR RandPrivBytes(uint8_t * out_buffer, size_t out_length)
+{
+    VerifyOrReturnError(CanCastTo<int>(out_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(RAND_priv_bytes(Uint8::to_uchar(out_buffer), static_cast<int>(out_length)) == 1, CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_CONFIG_DRBG_POOL_SIZE > 0
+// OpenSSL already keeps a private DRBG for each thread, so only the pool is kept here
+static CHIP_DRBG_THREAD_LOCAL DRBGPool<CHIP_CONFIG_DRBG_POOL_SIZE> gsDRBGPool;
+
+#if CHIP_CONFIG_DRBG_PER_THREAD
+static void DRBGForkChild()
+{
+    // The forking thread is the only one left in the child, which must not hand out the bytes of the parent
+    gsDRBGPool.Clear();
+}
+#endif // CHIP_CONFIG_DRBG_PER_THREAD
+#endif // CHIP_CONFIG_DRBG_POOL_SIZE > 0
+
 CHIP_ERROR DRBG_get_bytes(uint8_t * out_buffer, const size_t out_length)
 {
     CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 0;
 
     VerifyOrExit(out_buffer != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(out_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
 
-    VerifyOrExit(CanCastTo<int>(out_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = RAND_priv_bytes(Uint8::to_uchar(out_buffer), static_cast<int>(out_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+#if CHIP_CONFIG_DRBG_POOL_SIZE > 0
+#if CHIP_CONFIG_DRBG_PER_THREAD
+    {
+        static const int atForkStatus = pthread_atfork(nullptr, nullptr, DRBGForkChild);
+        VerifyOrExit(atForkStatus == 0, error = CHIP_ERROR_INTERNAL);
+    }
+#endif
+    error = gsDRBGPool.GetBytes(out_buffer, out_length, RandPrivBytes);
+#else
+    error = RandPrivBytes(out_buffer, out_length);
+#endif
 
 exit:
     return error;
@@ -761,6 +1043,110 @@ exit:
     return error;
 }
 
+static inline EC_KEY * to_EC_KEY(P256SignatureVerifierContext * context)
+{
+    return *SafePointerCast<EC_KEY **>(context);
+}
+
+CHIP_ERROR P256SignatureVerifier::Init(const P256PublicKey & publicKey)
+{
+    ERR_clear_error();
+    CHIP_ERROR error     = CHIP_ERROR_INTERNAL;
+    int nid              = NID_undef;
+    EC_KEY * ec_key      = nullptr;
+    EC_POINT * key_point = nullptr;
+    int result           = 0;
+
+    Clear();
+
+    nid = _nidForCurve(MapECName(publicKey.Type()));
+    VerifyOrExit(nid != NID_undef, error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    ec_key = EC_KEY_new_by_curve_name(nid);
+    VerifyOrExit(ec_key != nullptr, error = CHIP_ERROR_INTERNAL);
+
+    key_point = EC_POINT_new(EC_KEY_get0_group(ec_key));
+    VerifyOrExit(key_point != nullptr, error = CHIP_ERROR_INTERNAL);
+
+    result = EC_POINT_oct2point(EC_KEY_get0_group(ec_key), key_point, Uint8::to_const_uchar(publicKey), publicKey.Length(),
+                                nullptr);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    result = EC_KEY_set_public_key(ec_key, key_point);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Done once here rather than for every signature, as it is as expensive as a verification.
+    result = EC_KEY_check_key(ec_key);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Curves without a built-in generator table compute one for the group of the key, which all verifications share.
+    result = EC_KEY_precompute_mult(ec_key, nullptr);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    memcpy(mPublicKey, publicKey, kP256_PublicKey_Length);
+    *SafePointerCast<EC_KEY **>(&mContext) = ec_key;
+    ec_key                                = nullptr;
+    mInitialized                          = true;
+    error                                 = CHIP_NO_ERROR;
+
+exit:
+    _logSSLError();
+    if (key_point != nullptr)
+    {
+        EC_POINT_free(key_point);
+        key_point = nullptr;
+    }
+    if (ec_key != nullptr)
+    {
+        EC_KEY_free(ec_key);
+        ec_key = nullptr;
+    }
+    return error;
+}
+
+void P256SignatureVerifier::Clear()
+{
+    if (mInitialized)
+    {
+        EC_KEY_free(to_EC_KEY(&mContext));
+        mInitialized = false;
+    }
+}
+
+CHIP_ERROR P256SignatureVerifier::ValidateMsgSignature(const uint8_t * msg, size_t msg_length,
+                                                       const P256ECDSASignature & signature)
+{
+    uint8_t digest[kSHA256_Hash_Length];
+
+    VerifyOrReturnError(msg != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(msg_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(Hash_SHA256(msg, msg_length, digest));
+
+    return ValidateHashSignature(digest, sizeof(digest), signature);
+}
+
+CHIP_ERROR P256SignatureVerifier::ValidateHashSignature(const uint8_t * hash, size_t hash_length,
+                                                        const P256ECDSASignature & signature)
+{
+    ERR_clear_error();
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    int result       = 0;
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(hash != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(hash_length == kSHA256_Hash_Length, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The cast for length arguments is safe because values are small enough to fit.
+    result = ECDSA_verify(0, hash, static_cast<int>(hash_length), Uint8::to_const_uchar(signature),
+                          static_cast<int>(signature.Length()), to_EC_KEY(&mContext));
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INVALID_SIGNATURE);
+
+exit:
+    _logSSLError();
+    return error;
+}
+
 // helper function to populate octet key into EVP_PKEY out_evp_pkey. Caller must free out_evp_pkey
 static CHIP_ERROR _create_evp_key_from_binary_p256_key(const P256PublicKey & key, EVP_PKEY ** out_evp_pkey)
 {
@@ -1445,13 +1831,161 @@ exit:
     return error;
 }
 
+#if CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES
+
+/**
+ * Copies of the P-256 group whose generators are the SPAKE2+ points M and N, with precomputed multiples of those. They are
+ * built on first use, never freed, and only read by the Spake2p contexts, which may run on several threads.
+ */
+typedef struct Spake2p_FixedBaseTables
+{
+    EC_GROUP * M;
+    EC_GROUP * N;
+    EC_POINT * minusM; /* ComputeRoundTwo() inverts M or N in place. */
+    EC_POINT * minusN;
+} Spake2p_FixedBaseTables;
+
+static EC_GROUP * NewFixedBaseGroup(const uint8_t * point, size_t point_len, BN_CTX * bn_ctx)
+{
+    EC_GROUP * group     = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
+    EC_POINT * generator = (group != nullptr) ? EC_POINT_new(group) : nullptr;
+    bool success         = false;
+
+    VerifyOrExit(generator != nullptr, );
+    VerifyOrExit(EC_POINT_oct2point(group, generator, Uint8::to_const_uchar(point), point_len, bn_ctx) == 1, );
+    VerifyOrExit(EC_GROUP_set_generator(group, generator, EC_GROUP_get0_order(group), EC_GROUP_get0_cofactor(group)) == 1, );
+    VerifyOrExit(EC_GROUP_precompute_mult(group, bn_ctx) == 1, );
+
+    success = true;
+exit:
+    EC_POINT_free(generator);
+    if (!success)
+    {
+        EC_GROUP_free(group);
+        group = nullptr;
+    }
+    return group;
+}
+
+static EC_POINT * NewInvertedGenerator(const EC_GROUP * group, BN_CTX * bn_ctx)
+{
+    EC_POINT * point = EC_POINT_dup(EC_GROUP_get0_generator(group), group);
+
+    if (point != nullptr && EC_POINT_invert(group, point, bn_ctx) != 1)
+    {
+        EC_POINT_free(point);
+        point = nullptr;
+    }
+    return point;
+}
+
+static bool InitFixedBaseTables(Spake2p_FixedBaseTables & tables)
+{
+    BN_CTX * bn_ctx = BN_CTX_new();
+
+    VerifyOrReturnError(bn_ctx != nullptr, false);
+
+    tables.M      = NewFixedBaseGroup(spake2p_M_p256, sizeof(spake2p_M_p256), bn_ctx);
+    tables.N      = NewFixedBaseGroup(spake2p_N_p256, sizeof(spake2p_N_p256), bn_ctx);
+    tables.minusM = (tables.M != nullptr) ? NewInvertedGenerator(tables.M, bn_ctx) : nullptr;
+    tables.minusN = (tables.N != nullptr) ? NewInvertedGenerator(tables.N, bn_ctx) : nullptr;
+
+    BN_CTX_free(bn_ctx);
+
+    if (tables.minusM == nullptr || tables.minusN == nullptr)
+    {
+        ChipLogError(Crypto, "Failed to precompute the SPAKE2+ tables");
+        EC_POINT_free(tables.minusN);
+        EC_POINT_free(tables.minusM);
+        EC_GROUP_free(tables.N);
+        EC_GROUP_free(tables.M);
+        return false;
+    }
+    return true;
+}
+
+static const Spake2p_FixedBaseTables * GetFixedBaseTables()
+{
+    // Function statics are initialized once, even if several threads get here at the same time.
+    static Spake2p_FixedBaseTables sTables;
+    static const bool sInitialized = InitFixedBaseTables(sTables);
+
+    return sInitialized ? &sTables : nullptr;
+}
+
+#endif // CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES
+
+/**
+ * Compute R = fe * P from a table of precomputed multiples of P if there is one, i.e. if P is the generator or, with
+ * CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES, M, N or their inverse. Sets found to false otherwise.
+ */
+static CHIP_ERROR FixedBaseMul(Spake2p_Context * context, EC_POINT * R, const EC_POINT * P, const BIGNUM * fe, bool & found)
+{
+    const EC_GROUP * group = nullptr;
+    bool invert            = false;
+    int error_openssl      = 0;
+
+    if (EC_POINT_cmp(context->curve, P, EC_GROUP_get0_generator(context->curve), context->bn_ctx) == 0)
+    {
+        group = context->curve;
+    }
+#if CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES
+    else
+    {
+        const Spake2p_FixedBaseTables * tables = GetFixedBaseTables();
+
+        if (tables == nullptr)
+        {
+            // Use the generic multiplication.
+        }
+        else if (EC_POINT_cmp(context->curve, P, EC_GROUP_get0_generator(tables->M), context->bn_ctx) == 0)
+        {
+            group = tables->M;
+        }
+        else if (EC_POINT_cmp(context->curve, P, EC_GROUP_get0_generator(tables->N), context->bn_ctx) == 0)
+        {
+            group = tables->N;
+        }
+        else if (EC_POINT_cmp(context->curve, P, tables->minusM, context->bn_ctx) == 0)
+        {
+            group  = tables->M;
+            invert = true;
+        }
+        else if (EC_POINT_cmp(context->curve, P, tables->minusN, context->bn_ctx) == 0)
+        {
+            group  = tables->N;
+            invert = true;
+        }
+    }
+#endif // CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES
+
+    found = (group != nullptr);
+    VerifyOrReturnError(found, CHIP_NO_ERROR);
+
+    error_openssl = EC_POINT_mul(group, R, fe, nullptr, nullptr, context->bn_ctx);
+    VerifyOrReturnError(error_openssl == 1, CHIP_ERROR_INTERNAL);
+
+    if (invert)
+    {
+        error_openssl = EC_POINT_invert(context->curve, R, context->bn_ctx);
+        VerifyOrReturnError(error_openssl == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Spake2p_P256_SHA256_HKDF_HMAC::PointMul(void * R, const void * P1, const void * fe1)
 {
     CHIP_ERROR error  = CHIP_ERROR_INTERNAL;
     int error_openssl = 0;
+    bool found        = false;
 
     Spake2p_Context * context = to_inner_spake2p_context(&mSpake2pContext);
 
+    error = FixedBaseMul(context, static_cast<EC_POINT *>(R), static_cast<const EC_POINT *>(P1), static_cast<const BIGNUM *>(fe1),
+                         found);
+    VerifyOrExit(error == CHIP_NO_ERROR && !found, );
+
     error_openssl = EC_POINT_mul(context->curve, static_cast<EC_POINT *>(R), nullptr, static_cast<const EC_POINT *>(P1),
                                  static_cast<const BIGNUM *>(fe1), context->bn_ctx);
     VerifyOrExit(error_openssl == 1, error = CHIP_ERROR_INTERNAL);
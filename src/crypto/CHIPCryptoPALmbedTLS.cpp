@@ -21,6 +21,7 @@
  */
 
 #include "CHIPCryptoPAL.h"
+#include "DRBGPool.h"
 
 #include <type_traits>
 
@@ -47,6 +48,11 @@
 
 #include <string.h>
 
+#if CHIP_CONFIG_DRBG_PER_THREAD
+#include <mutex>
+#include <pthread.h>
+#endif
+
 namespace chip {
 namespace Crypto {
 
@@ -56,13 +62,71 @@ namespace Crypto {
 typedef struct
 {
     bool mInitialized;
-    bool mDRBGSeeded;
-    mbedtls_ctr_drbg_context mDRBGCtxt;
     mbedtls_entropy_context mEntropy;
 } EntropyContext;
 
 static EntropyContext gsEntropyContext;
 
+// The DRBG state of a thread, or of the process without CHIP_CONFIG_DRBG_PER_THREAD
+struct DRBGContext
+{
+    ~DRBGContext()
+    {
+        if (mInitialized)
+        {
+            mbedtls_ctr_drbg_free(&mDRBGCtxt);
+        }
+    }
+
+    bool mInitialized = false;
+    bool mDRBGSeeded  = false;
+#if CHIP_CONFIG_DRBG_PER_THREAD
+    // Set in a forked child, whose DRBG was seeded in the parent and must be reseeded before its next use
+    bool mDRBGForked = false;
+#endif
+    mbedtls_ctr_drbg_context mDRBGCtxt;
+#if CHIP_CONFIG_DRBG_POOL_SIZE > 0
+    // Requests served since the DRBG was last reseeded, as most of them do not reach the DRBG
+    uint32_t mRequests = 0;
+    DRBGPool<CHIP_CONFIG_DRBG_POOL_SIZE> mPool;
+#endif
+};
+
+static CHIP_DRBG_THREAD_LOCAL DRBGContext gsDRBGContext;
+
+#if CHIP_CONFIG_DRBG_PER_THREAD
+// The entropy context is shared by the DRBGs of all threads
+static std::mutex gsEntropyMutex;
+
+static int LockedEntropyFunc(void * data, unsigned char * output, size_t len)
+{
+    std::lock_guard<std::mutex> lock(gsEntropyMutex);
+    return mbedtls_entropy_func(data, output, len);
+}
+
+// Hold the entropy mutex across fork(), so that the child does not inherit it locked by a thread that is not copied
+static void DRBGForkPrepare()
+{
+    gsEntropyMutex.lock();
+}
+
+static void DRBGForkParent()
+{
+    gsEntropyMutex.unlock();
+}
+
+static void DRBGForkChild()
+{
+    gsEntropyMutex.unlock();
+
+    // The forking thread is the only one left in the child, which must not reuse the DRBG state of the parent
+    gsDRBGContext.mDRBGForked = gsDRBGContext.mDRBGSeeded;
+#if CHIP_CONFIG_DRBG_POOL_SIZE > 0
+    gsDRBGContext.mPool.Clear();
+#endif
+}
+#endif // CHIP_CONFIG_DRBG_PER_THREAD
+
 static void _log_mbedTLS_error(int error_code)
 {
     if (error_code != 0)
@@ -174,6 +238,107 @@ exit:
     return error;
 }
 
+static inline mbedtls_ccm_context * to_inner_aes_ccm_context(AESCCMOpaqueContext * context)
+{
+    return SafePointerCast<mbedtls_ccm_context *>(context);
+}
+
+AES_CCM_cipher::AES_CCM_cipher(void)
+{
+    mbedtls_ccm_init(to_inner_aes_ccm_context(&mContext));
+}
+
+AES_CCM_cipher::~AES_CCM_cipher(void)
+{
+    Clear();
+}
+
+CHIP_ERROR AES_CCM_cipher::Init(const uint8_t * key, size_t key_length)
+{
+    int result = 1;
+
+    Clear();
+
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidKeyLength(key_length), CHIP_ERROR_UNSUPPORTED_ENCRYPTION_TYPE);
+
+    // Size of key = key_length * number of bits in a byte (8)
+    // Cast is safe because we called _isValidKeyLength above.
+    result = mbedtls_ccm_setkey(to_inner_aes_ccm_context(&mContext), MBEDTLS_CIPHER_ID_AES, Uint8::to_const_uchar(key),
+                                static_cast<unsigned int>(key_length * 8));
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    memcpy(mKey, key, key_length);
+    mKeyLength = key_length;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_cipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    int result = 1;
+
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    if (aad_length > 0)
+    {
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    // Encrypt
+    result = mbedtls_ccm_encrypt_and_tag(to_inner_aes_ccm_context(&mContext), plaintext_length, Uint8::to_const_uchar(iv),
+                                         iv_length, Uint8::to_const_uchar(aad), aad_length, Uint8::to_const_uchar(plaintext),
+                                         Uint8::to_uchar(ciphertext), Uint8::to_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_cipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length, uint8_t * plaintext)
+{
+    int result = 1;
+
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    if (aad_length > 0)
+    {
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    // Decrypt
+    result = mbedtls_ccm_auth_decrypt(to_inner_aes_ccm_context(&mContext), ciphertext_length, Uint8::to_const_uchar(iv), iv_length,
+                                      Uint8::to_const_uchar(aad), aad_length, Uint8::to_const_uchar(ciphertext),
+                                      Uint8::to_uchar(plaintext), Uint8::to_const_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM_cipher::Clear(void)
+{
+    mbedtls_ccm_context * context = to_inner_aes_ccm_context(&mContext);
+
+    // mbedtls_ccm_free() zeroes the context, leaving it ready for another mbedtls_ccm_setkey().
+    mbedtls_ccm_free(context);
+    ClearSecretData(mKey, sizeof(mKey));
+    mKeyLength = 0;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     CHIP_ERROR error = CHIP_NO_ERROR;
@@ -292,6 +457,54 @@ exit:
     return error;
 }
 
+CHIP_ERROR HKDF_SHA256_Batch(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
+                             const HKDFOutput * outputs, const size_t output_count)
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    int result       = 1;
+    const mbedtls_md_info_t * md;
+    uint8_t prk[kSHA256_Hash_Length];
+
+    VerifyOrExit(secret != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(secret_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Salt is optional
+    if (salt_length > 0)
+    {
+        VerifyOrExit(salt != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    VerifyOrExit(outputs != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(output_count > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+    for (size_t i = 0; i < output_count; i++)
+    {
+        VerifyOrExit(outputs[i].info_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(outputs[i].info != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(outputs[i].out_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(outputs[i].out_buffer != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    md = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    VerifyOrExit(md != nullptr, error = CHIP_ERROR_INTERNAL);
+
+    result = mbedtls_hkdf_extract(md, Uint8::to_const_uchar(salt), salt_length, Uint8::to_const_uchar(secret), secret_length,
+                                  Uint8::to_uchar(prk));
+    _log_mbedTLS_error(result);
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+
+    for (size_t i = 0; i < output_count; i++)
+    {
+        result = mbedtls_hkdf_expand(md, Uint8::to_const_uchar(prk), sizeof(prk), Uint8::to_const_uchar(outputs[i].info),
+                                     outputs[i].info_length, Uint8::to_uchar(outputs[i].out_buffer), outputs[i].out_length);
+        _log_mbedTLS_error(result);
+        VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+    }
+
+exit:
+    ClearSecretData(prk, sizeof(prk));
+    return error;
+}
+
 CHIP_ERROR PBKDF2_sha256::pbkdf2_sha256(const uint8_t * password, size_t plen, const uint8_t * salt, size_t slen,
                                         unsigned int iteration_count, uint32_t key_length, uint8_t * output)
 {
@@ -341,7 +554,6 @@ static EntropyContext * get_entropy_context()
     if (!gsEntropyContext.mInitialized)
     {
         mbedtls_entropy_init(&gsEntropyContext.mEntropy);
-        mbedtls_ctr_drbg_init(&gsEntropyContext.mDRBGCtxt);
 
         gsEntropyContext.mInitialized = true;
     }
@@ -351,18 +563,47 @@ static EntropyContext * get_entropy_context()
 
 static mbedtls_ctr_drbg_context * get_drbg_context()
 {
-    EntropyContext * context = get_entropy_context();
+    DRBGContext * context = &gsDRBGContext;
 
     mbedtls_ctr_drbg_context * drbgCtxt = &context->mDRBGCtxt;
 
+    if (!context->mInitialized)
+    {
+        mbedtls_ctr_drbg_init(drbgCtxt);
+        context->mInitialized = true;
+    }
+
     if (!context->mDRBGSeeded)
     {
-        int status = mbedtls_ctr_drbg_seed(drbgCtxt, mbedtls_entropy_func, &context->mEntropy, nullptr, 0);
+#if CHIP_CONFIG_DRBG_PER_THREAD
+        static const int atForkStatus = pthread_atfork(DRBGForkPrepare, DRBGForkParent, DRBGForkChild);
+        VerifyOrExit(atForkStatus == 0, ChipLogError(Crypto, "pthread_atfork failed: %d", atForkStatus));
+
+        EntropyContext * entropyCtxt = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(gsEntropyMutex);
+            entropyCtxt = get_entropy_context();
+        }
+        int status = mbedtls_ctr_drbg_seed(drbgCtxt, LockedEntropyFunc, &entropyCtxt->mEntropy, nullptr, 0);
+#else
+        int status = mbedtls_ctr_drbg_seed(drbgCtxt, mbedtls_entropy_func, &get_entropy_context()->mEntropy, nullptr, 0);
+#endif
         VerifyOrExit(status == 0, _log_mbedTLS_error(status));
 
         context->mDRBGSeeded = true;
     }
 
+#if CHIP_CONFIG_DRBG_PER_THREAD
+    if (context->mDRBGForked)
+    {
+        // The context is already seeded; reseeding it draws fresh entropy without leaking the one set up in the parent
+        int status = mbedtls_ctr_drbg_reseed(drbgCtxt, nullptr, 0);
+        VerifyOrExit(status == 0, _log_mbedTLS_error(status));
+
+        context->mDRBGForked = false;
+    }
+#endif
+
     return drbgCtxt;
 
 exit:
@@ -375,6 +616,10 @@ CHIP_ERROR add_entropy_source(entropy_source fn_source, void * p_source, size_t
     int result                    = 0;
     EntropyContext * entropy_ctxt = nullptr;
 
+#if CHIP_CONFIG_DRBG_PER_THREAD
+    std::lock_guard<std::mutex> lock(gsEntropyMutex);
+#endif
+
     VerifyOrExit(fn_source != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
 
     entropy_ctxt = get_entropy_context();
@@ -399,8 +644,22 @@ CHIP_ERROR DRBG_get_bytes(uint8_t * out_buffer, const size_t out_length)
     drbg_ctxt = get_drbg_context();
     VerifyOrExit(drbg_ctxt != nullptr, error = CHIP_ERROR_INTERNAL);
 
+#if CHIP_CONFIG_DRBG_POOL_SIZE > 0
+    // Reseed as often as the DRBG would if every request reached it
+    if (++gsDRBGContext.mRequests >= MBEDTLS_CTR_DRBG_RESEED_INTERVAL)
+    {
+        gsDRBGContext.mRequests = 0;
+        result                  = mbedtls_ctr_drbg_reseed(drbg_ctxt, nullptr, 0);
+        VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+    }
+
+    error = gsDRBGContext.mPool.GetBytes(out_buffer, out_length, [drbg_ctxt](uint8_t * buffer, size_t length) {
+        return mbedtls_ctr_drbg_random(drbg_ctxt, Uint8::to_uchar(buffer), length) == 0 ? CHIP_NO_ERROR : CHIP_ERROR_INTERNAL;
+    });
+#else
     result = mbedtls_ctr_drbg_random(drbg_ctxt, Uint8::to_uchar(out_buffer), out_length);
     VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+#endif
 
 exit:
     return error;
@@ -568,6 +827,86 @@ exit:
     return error;
 }
 
+static inline mbedtls_ecdsa_context * to_ecdsa_context(P256SignatureVerifierContext * context)
+{
+    return SafePointerCast<mbedtls_ecdsa_context *>(context);
+}
+
+CHIP_ERROR P256SignatureVerifier::Init(const P256PublicKey & publicKey)
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    int result       = 0;
+
+    Clear();
+
+    mbedtls_ecdsa_context * ecdsa_ctxt = to_ecdsa_context(&mContext);
+    mbedtls_ecdsa_init(ecdsa_ctxt);
+
+    result = mbedtls_ecp_group_load(&ecdsa_ctxt->grp, MapECPGroupId(publicKey.Type()));
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    result = mbedtls_ecp_point_read_binary(&ecdsa_ctxt->grp, &ecdsa_ctxt->Q, Uint8::to_const_uchar(publicKey),
+                                           publicKey.Length());
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    result = mbedtls_ecp_check_pubkey(&ecdsa_ctxt->grp, &ecdsa_ctxt->Q);
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    memcpy(mPublicKey, publicKey, kP256_PublicKey_Length);
+    mInitialized = true;
+
+exit:
+    if (error != CHIP_NO_ERROR)
+    {
+        mbedtls_ecdsa_free(ecdsa_ctxt);
+    }
+    _log_mbedTLS_error(result);
+    return error;
+}
+
+void P256SignatureVerifier::Clear()
+{
+    if (mInitialized)
+    {
+        mbedtls_ecdsa_free(to_ecdsa_context(&mContext));
+        mInitialized = false;
+    }
+}
+
+CHIP_ERROR P256SignatureVerifier::ValidateMsgSignature(const uint8_t * msg, size_t msg_length,
+                                                       const P256ECDSASignature & signature)
+{
+    uint8_t hash[NUM_BYTES_IN_SHA256_HASH];
+
+    VerifyOrReturnError(msg != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(msg_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    VerifyOrReturnError(mbedtls_sha256_ret(Uint8::to_const_uchar(msg), msg_length, hash, 0) == 0, CHIP_ERROR_INTERNAL);
+
+    return ValidateHashSignature(hash, sizeof(hash), signature);
+}
+
+CHIP_ERROR P256SignatureVerifier::ValidateHashSignature(const uint8_t * hash, size_t hash_length,
+                                                        const P256ECDSASignature & signature)
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    int result       = 0;
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(hash != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(hash_length == NUM_BYTES_IN_SHA256_HASH, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The group is kept loaded between verifications, so the comb table that mbedTLS computes for the generator on
+    // the first one, and stores in the group, is reused by the next ones.
+    result = mbedtls_ecdsa_read_signature(to_ecdsa_context(&mContext), hash, hash_length, Uint8::to_const_uchar(signature),
+                                          signature.Length());
+    VerifyOrExit(result == 0, error = CHIP_ERROR_INVALID_SIGNATURE);
+
+exit:
+    _log_mbedTLS_error(result);
+    return error;
+}
+
 CHIP_ERROR P256Keypair::ECDH_derive_secret(const P256PublicKey & remote_public_key, P256ECDHDerivedSecret & out_secret) const
 {
     CHIP_ERROR error     = CHIP_NO_ERROR;
@@ -1076,10 +1415,169 @@ CHIP_ERROR Spake2p_P256_SHA256_HKDF_HMAC::PointWrite(const void * R, uint8_t * o
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES && !defined(MBEDTLS_ECP_ALT)
+
+/**
+ * Copies of the P-256 group whose generators are G, M and N. mbedTLS caches the comb table of the generator of a group in
+ * the group on its first multiplication, so these are shared by all the Spake2p contexts of the process rather than rebuilt
+ * by each of them. They are built and warmed up on first use, never freed, and only read afterwards, from any thread.
+ */
+typedef struct Spake2p_FixedBaseTables
+{
+    mbedtls_ecp_group G;
+    mbedtls_ecp_group M;
+    mbedtls_ecp_group N;
+    mbedtls_ecp_point minusM; /* ComputeRoundTwo() inverts M or N in place. */
+    mbedtls_ecp_point minusN;
+} Spake2p_FixedBaseTables;
+
+static int InitFixedBaseGroup(mbedtls_ecp_group & group, const uint8_t * point, size_t point_len, const mbedtls_mpi & one)
+{
+    mbedtls_ecp_point scratch;
+    int result = 0;
+
+    mbedtls_ecp_point_init(&scratch);
+    mbedtls_ecp_group_init(&group);
+    result = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256R1);
+    VerifyOrExit(result == 0, );
+
+    if (point != nullptr)
+    {
+        // Drop the generator and the comb table of the curve, which may both point to static data, for those of the point.
+        mbedtls_ecp_point_init(&group.G);
+        group.T      = nullptr;
+        group.T_size = 0;
+
+        result = mbedtls_ecp_point_read_binary(&group, &group.G, Uint8::to_const_uchar(point), point_len);
+        VerifyOrExit(result == 0, );
+    }
+
+    // Build the comb table now, so that the group is never written to once shared.
+    result = mbedtls_ecp_mul(&group, &scratch, &one, &group.G, CryptoRNG, nullptr);
+
+exit:
+    mbedtls_ecp_point_free(&scratch);
+    return result;
+}
+
+static int InitInvertedGenerator(mbedtls_ecp_point & point, const mbedtls_ecp_group & group)
+{
+    int result = 0;
+
+    mbedtls_ecp_point_init(&point);
+    result = mbedtls_ecp_copy(&point, &group.G);
+    VerifyOrReturnError(result == 0, result);
+
+    return mbedtls_mpi_sub_mpi(&point.Y, &group.P, &point.Y);
+}
+
+static bool InitFixedBaseTables(Spake2p_FixedBaseTables & tables)
+{
+    mbedtls_mpi one;
+    int result = 0;
+
+    mbedtls_mpi_init(&one);
+    result = mbedtls_mpi_lset(&one, 1);
+    VerifyOrExit(result == 0, );
+
+    result = InitFixedBaseGroup(tables.G, nullptr, 0, one);
+    VerifyOrExit(result == 0, );
+    result = InitFixedBaseGroup(tables.M, spake2p_M_p256, sizeof(spake2p_M_p256), one);
+    VerifyOrExit(result == 0, );
+    result = InitFixedBaseGroup(tables.N, spake2p_N_p256, sizeof(spake2p_N_p256), one);
+    VerifyOrExit(result == 0, );
+    result = InitInvertedGenerator(tables.minusM, tables.M);
+    VerifyOrExit(result == 0, );
+    result = InitInvertedGenerator(tables.minusN, tables.N);
+
+exit:
+    mbedtls_mpi_free(&one);
+    if (result != 0)
+    {
+        ChipLogError(Crypto, "Failed to precompute the SPAKE2+ tables");
+        _log_mbedTLS_error(result);
+    }
+    return result == 0;
+}
+
+static Spake2p_FixedBaseTables * GetFixedBaseTables()
+{
+    // Function statics are initialized once, even if several threads get here at the same time.
+    static Spake2p_FixedBaseTables sTables;
+    static const bool sInitialized = InitFixedBaseTables(sTables);
+
+    return sInitialized ? &sTables : nullptr;
+}
+
+/**
+ * Return the shared group whose generator is P or, setting invert, the inverse of P, or nullptr if there is none.
+ */
+static mbedtls_ecp_group * FindFixedBaseGroup(const mbedtls_ecp_point * P, bool & invert)
+{
+    Spake2p_FixedBaseTables * tables = GetFixedBaseTables();
+
+    invert = false;
+    VerifyOrReturnError(tables != nullptr, nullptr);
+
+    if (mbedtls_ecp_point_cmp(P, &tables->G.G) == 0)
+    {
+        return &tables->G;
+    }
+    if (mbedtls_ecp_point_cmp(P, &tables->M.G) == 0)
+    {
+        return &tables->M;
+    }
+    if (mbedtls_ecp_point_cmp(P, &tables->N.G) == 0)
+    {
+        return &tables->N;
+    }
+
+    invert = true;
+    if (mbedtls_ecp_point_cmp(P, &tables->minusM) == 0)
+    {
+        return &tables->M;
+    }
+    if (mbedtls_ecp_point_cmp(P, &tables->minusN) == 0)
+    {
+        return &tables->N;
+    }
+    return nullptr;
+}
+
+/**
+ * Compute R = fe * P from the comb table of a shared group if P is G, M, N or the inverse of M or N. Sets found to false
+ * otherwise.
+ */
+static CHIP_ERROR FixedBaseMul(mbedtls_ecp_point * R, const mbedtls_ecp_point * P, const mbedtls_mpi * fe, bool & found)
+{
+    bool invert               = false;
+    mbedtls_ecp_group * group = FindFixedBaseGroup(P, invert);
+
+    found = (group != nullptr);
+    VerifyOrReturnError(found, CHIP_NO_ERROR);
+
+    VerifyOrReturnError(mbedtls_ecp_mul(group, R, fe, &group->G, CryptoRNG, nullptr) == 0, CHIP_ERROR_INTERNAL);
+
+    if (invert)
+    {
+        VerifyOrReturnError(mbedtls_mpi_sub_mpi(&R->Y, &group->P, &R->Y) == 0, CHIP_ERROR_INTERNAL);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+#endif // CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES && !defined(MBEDTLS_ECP_ALT)
+
 CHIP_ERROR Spake2p_P256_SHA256_HKDF_HMAC::PointMul(void * R, const void * P1, const void * fe1)
 {
     Spake2p_Context * context = to_inner_spake2p_context(&mSpake2pContext);
 
+#if CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES && !defined(MBEDTLS_ECP_ALT)
+    bool found       = false;
+    CHIP_ERROR error = FixedBaseMul((mbedtls_ecp_point *) R, (const mbedtls_ecp_point *) P1, (const mbedtls_mpi *) fe1, found);
+    VerifyOrReturnError(error != CHIP_NO_ERROR || !found, error);
+#endif // CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES && !defined(MBEDTLS_ECP_ALT)
+
     if (mbedtls_ecp_mul(&context->curve, (mbedtls_ecp_point *) R, (const mbedtls_mpi *) fe1, (const mbedtls_ecp_point *) P1,
                         CryptoRNG, nullptr) != 0)
     {
@@ -1094,6 +1592,41 @@ CHIP_ERROR Spake2p_P256_SHA256_HKDF_HMAC::PointAddMul(void * R, const void * P1,
 {
     Spake2p_Context * context = to_inner_spake2p_context(&mSpake2pContext);
 
+#if CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES && !defined(MBEDTLS_ECP_ALT)
+    bool invert = false;
+
+    // mbedtls_ecp_muladd() does not use the comb tables, so add up two multiplications instead if either point has one.
+    if (FindFixedBaseGroup((const mbedtls_ecp_point *) P1, invert) != nullptr ||
+        FindFixedBaseGroup((const mbedtls_ecp_point *) P2, invert) != nullptr)
+    {
+        CHIP_ERROR error = CHIP_NO_ERROR;
+        mbedtls_ecp_point scratch;
+        mbedtls_mpi one;
+
+        mbedtls_ecp_point_init(&scratch);
+        mbedtls_mpi_init(&one);
+
+        error = PointMul(&scratch, P1, fe1);
+        if (error == CHIP_NO_ERROR)
+        {
+            error = PointMul(R, P2, fe2);
+        }
+
+        // Multiplications by one are shortcuts, so this only adds the points.
+        if (error == CHIP_NO_ERROR &&
+            (mbedtls_mpi_lset(&one, 1) != 0 ||
+             mbedtls_ecp_muladd(&context->curve, (mbedtls_ecp_point *) R, &one, &scratch, &one,
+                                (const mbedtls_ecp_point *) R) != 0))
+        {
+            error = CHIP_ERROR_INTERNAL;
+        }
+
+        mbedtls_mpi_free(&one);
+        mbedtls_ecp_point_free(&scratch);
+        return error;
+    }
+#endif // CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES && !defined(MBEDTLS_ECP_ALT)
+
     if (mbedtls_ecp_muladd(&context->curve, (mbedtls_ecp_point *) R, (const mbedtls_mpi *) fe1, (const mbedtls_ecp_point *) P1,
                            (const mbedtls_mpi *) fe2, (const mbedtls_ecp_point *) P2) != 0)
     {
@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Pool of random bytes drawn from a DRBG in blocks, used by the
+ *      DRBG_get_bytes implementations of the crypto PAL.
+ */
+
+#pragma once
+
+#include "CHIPCryptoPAL.h"
+
+#include <core/CHIPConfig.h>
+#include <support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if CHIP_CONFIG_DRBG_PER_THREAD
+#define CHIP_DRBG_THREAD_LOCAL thread_local
+#else
+#define CHIP_DRBG_THREAD_LOCAL
+#endif
+
+namespace chip {
+namespace Crypto {
+
+/**
+ * Random bytes drawn from a DRBG N at a time, so that the small requests most callers make are copied out of the pool
+ * instead of each going through the DRBG. Bytes are cleared from the pool as they are handed out.
+ */
+template <size_t N>
+class DRBGPool
+{
+public:
+    static_assert(N > 0, "The pool cannot be empty");
+
+    ~DRBGPool() { Clear(); }
+
+    /**
+     * Copy out_length random bytes to out_buffer. The pool is refilled with fill(buffer, length) when it runs out, and
+     * requests of N bytes or more are passed to fill directly.
+     */
+    template <typename Fill>
+    CHIP_ERROR GetBytes(uint8_t * out_buffer, size_t out_length, Fill fill)
+    {
+        if (out_length >= N)
+        {
+            return fill(out_buffer, out_length);
+        }
+
+        if (out_length > mAvailable)
+        {
+            mAvailable = 0;
+            ReturnErrorOnFailure(fill(mBytes, N));
+            mAvailable = N;
+        }
+
+        uint8_t * bytes = &mBytes[N - mAvailable];
+        memcpy(out_buffer, bytes, out_length);
+        ClearSecretData(bytes, static_cast<uint32_t>(out_length));
+        mAvailable -= out_length;
+
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Drop the bytes left in the pool, e.g. in the child of a fork, which must not hand out the same bytes as its parent.
+     */
+    void Clear()
+    {
+        ClearSecretData(mBytes, static_cast<uint32_t>(N));
+        mAvailable = 0;
+    }
+
+private:
+    uint8_t mBytes[N];
+    size_t mAvailable = 0;
+};
+
+} // namespace Crypto
+} // namespace chip
@@ -44,13 +44,8 @@ void Spake2p_Finish_HSM(hsm_pake_context_t * phsm_pake_context)
 #if ENABLE_REENTRANCY
     if (gex_sss_chip_ctx.ks.session != NULL)
     {
-        Se05x_API_DeleteCryptoObject(&((sss_se05x_session_t *) &gex_sss_chip_ctx.session)->s_ctx, phsm_pake_context->spake_objId);
-        setObjID(phsm_pake_context->spake_objId, OBJ_ID_TABLE_OBJID_STATUS_FREE);
-
-        if (spake_objects_created > 0)
-        {
-            spake_objects_created--;
-        }
+        /* Keep the crypto object in se05x for the next spake, which initialises it again */
+        setObjID(phsm_pake_context->spake_objId, OBJ_ID_TABLE_OBJID_STATUS_IDLE);
     }
 #endif //#if ENABLE_REENTRANCY
     return;
@@ -63,7 +58,8 @@ CHIP_ERROR create_init_crypto_obj(chip::Crypto::CHIP_SPAKE2P_ROLE role, hsm_pake
     SE05x_CryptoModeSubType_t subtype;
 
 #if ENABLE_REENTRANCY
-    SE05x_CryptoObjectID_t spakeObjectId = getObjID();
+    bool objectCreated                   = false;
+    SE05x_CryptoObjectID_t spakeObjectId = getObjID(&objectCreated);
 #else
     SE05x_CryptoObjectID_t spakeObjectId =
         (role == chip::Crypto::CHIP_SPAKE2P_ROLE::VERIFIER) ? kSE05x_CryptoObject_SPAKE_VERIFIER : kSE05x_CryptoObject_SPAKE_PROVER;
@@ -73,6 +69,10 @@ CHIP_ERROR create_init_crypto_obj(chip::Crypto::CHIP_SPAKE2P_ROLE role, hsm_pake
     size_t listlen            = sizeof(list);
     size_t i                  = 0;
     uint8_t create_crypto_obj = 1;
+    /* Whether the crypto object of each role is known to exist in se05x, so that the list is only read once */
+    static uint8_t verifier_obj_created = 0;
+    static uint8_t prover_obj_created   = 0;
+    uint8_t * obj_created = (role == chip::Crypto::CHIP_SPAKE2P_ROLE::VERIFIER) ? &verifier_obj_created : &prover_obj_created;
 #endif
 
     ChipLogProgress(Crypto, "Using Object Id --> %d \n", spakeObjectId);
@@ -88,14 +88,12 @@ CHIP_ERROR create_init_crypto_obj(chip::Crypto::CHIP_SPAKE2P_ROLE role, hsm_pake
 
     se05x_sessionOpen();
 
-    se05x_delete_key(m_id);
-    error = se05x_set_key(m_id, chip::Crypto::spake2p_M_p256, sizeof(chip::Crypto::spake2p_M_p256), kSSS_KeyPart_Public,
-                          kSSS_CipherType_EC_NIST_P);
+    error = se05x_set_key_cached(m_id, chip::Crypto::spake2p_M_p256, sizeof(chip::Crypto::spake2p_M_p256), kSSS_KeyPart_Public,
+                                 kSSS_CipherType_EC_NIST_P);
     VerifyOrExit(error == CHIP_NO_ERROR, error = CHIP_ERROR_INTERNAL);
 
-    se05x_delete_key(n_id);
-    error = se05x_set_key(n_id, chip::Crypto::spake2p_N_p256, sizeof(chip::Crypto::spake2p_N_p256), kSSS_KeyPart_Public,
-                          kSSS_CipherType_EC_NIST_P);
+    error = se05x_set_key_cached(n_id, chip::Crypto::spake2p_N_p256, sizeof(chip::Crypto::spake2p_N_p256), kSSS_KeyPart_Public,
+                                 kSSS_CipherType_EC_NIST_P);
     VerifyOrExit(error == CHIP_NO_ERROR, error = CHIP_ERROR_INTERNAL);
 
     VerifyOrExit(gex_sss_chip_ctx.ks.session != NULL, error = CHIP_ERROR_INTERNAL);
@@ -103,31 +101,39 @@ CHIP_ERROR create_init_crypto_obj(chip::Crypto::CHIP_SPAKE2P_ROLE role, hsm_pake
     subtype.spakeAlgo = kSE05x_SpakeAlgo_P256_SHA256_HKDF_HMAC;
 
 #if ENABLE_REENTRANCY
-    VerifyOrExit(spake_objects_created < LIMIT_CRYPTO_OBJECTS, error = CHIP_ERROR_INTERNAL);
+    if (!objectCreated)
+    {
+        VerifyOrExit(spake_objects_created < LIMIT_CRYPTO_OBJECTS, error = CHIP_ERROR_INTERNAL);
 
-    smstatus = Se05x_API_CreateCryptoObject(&((sss_se05x_session_t *) &gex_sss_chip_ctx.session)->s_ctx, spakeObjectId,
-                                            kSE05x_CryptoContext_SPAKE, subtype);
-    VerifyOrExit(smstatus == SM_OK, error = CHIP_ERROR_INTERNAL);
+        smstatus = Se05x_API_CreateCryptoObject(&((sss_se05x_session_t *) &gex_sss_chip_ctx.session)->s_ctx, spakeObjectId,
+                                                kSE05x_CryptoContext_SPAKE, subtype);
+        VerifyOrExit(smstatus == SM_OK, error = CHIP_ERROR_INTERNAL);
 
-    /* Increment number of crypto objects created */
-    spake_objects_created++;
+        /* Increment number of crypto objects created */
+        spake_objects_created++;
+    }
 
 #else
-    smstatus = Se05x_API_ReadCryptoObjectList(&((sss_se05x_session_t *) &gex_sss_chip_ctx.session)->s_ctx, list, &listlen);
-    for (i = 0; i < listlen; i += 4)
+    if (*obj_created == 0)
     {
-        uint32_t cryptoObjectId = static_cast<uint32_t>(list[i + 1] | (list[i + 0] << 8));
-        if (cryptoObjectId == spakeObjectId)
+        smstatus = Se05x_API_ReadCryptoObjectList(&((sss_se05x_session_t *) &gex_sss_chip_ctx.session)->s_ctx, list, &listlen);
+        for (i = 0; i < listlen; i += 4)
         {
-            create_crypto_obj = 0;
+            uint32_t cryptoObjectId = static_cast<uint32_t>(list[i + 1] | (list[i + 0] << 8));
+            if (cryptoObjectId == spakeObjectId)
+            {
+                create_crypto_obj = 0;
+            }
         }
-    }
 
-    if (create_crypto_obj)
-    {
-        smstatus = Se05x_API_CreateCryptoObject(&((sss_se05x_session_t *) &gex_sss_chip_ctx.session)->s_ctx, spakeObjectId,
-                                                kSE05x_CryptoContext_SPAKE, subtype);
-        VerifyOrExit(smstatus == SM_OK, error = CHIP_ERROR_INTERNAL);
+        if (create_crypto_obj)
+        {
+            smstatus = Se05x_API_CreateCryptoObject(&((sss_se05x_session_t *) &gex_sss_chip_ctx.session)->s_ctx, spakeObjectId,
+                                                    kSE05x_CryptoContext_SPAKE, subtype);
+            VerifyOrExit(smstatus == SM_OK, error = CHIP_ERROR_INTERNAL);
+        }
+
+        *obj_created = 1;
     }
 #endif
 
@@ -345,10 +351,10 @@ CHIP_ERROR Spake2pHSM_P256_SHA256_HKDF_HMAC::BeginVerifier(const uint8_t * my_id
     VerifyOrExit(smstatus == SM_OK, error = CHIP_ERROR_INTERNAL);
 #endif
 
-    error = se05x_set_key(w0in_id_v, w0in_mod, w0in_mod_len, kSSS_KeyPart_Default, kSSS_CipherType_AES);
+    error = se05x_set_key_cached(w0in_id_v, w0in_mod, w0in_mod_len, kSSS_KeyPart_Default, kSSS_CipherType_AES);
     VerifyOrExit(error == CHIP_NO_ERROR, error = CHIP_ERROR_INTERNAL);
 
-    error = se05x_set_key(Lin_id_v, Lin, Lin_len, kSSS_KeyPart_Public, kSSS_CipherType_EC_NIST_P);
+    error = se05x_set_key_cached(Lin_id_v, Lin, Lin_len, kSSS_KeyPart_Public, kSSS_CipherType_EC_NIST_P);
     VerifyOrExit(error == CHIP_NO_ERROR, error = CHIP_ERROR_INTERNAL);
 
 #if SSS_HAVE_SE05X_VER_GTE_16_02
@@ -431,10 +437,10 @@ CHIP_ERROR Spake2pHSM_P256_SHA256_HKDF_HMAC::BeginProver(const uint8_t * my_iden
     VerifyOrExit(smstatus == SM_OK, error = CHIP_ERROR_INTERNAL);
 #endif
 
-    error = se05x_set_key(w0in_id_p, w0in_mod, w0in_mod_len, kSSS_KeyPart_Default, kSSS_CipherType_AES);
+    error = se05x_set_key_cached(w0in_id_p, w0in_mod, w0in_mod_len, kSSS_KeyPart_Default, kSSS_CipherType_AES);
     VerifyOrExit(error == CHIP_NO_ERROR, error = CHIP_ERROR_INTERNAL);
 
-    error = se05x_set_key(w1in_id_p, w1in_mod, w1in_mod_len, kSSS_KeyPart_Default, kSSS_CipherType_AES);
+    error = se05x_set_key_cached(w1in_id_p, w1in_mod, w1in_mod_len, kSSS_KeyPart_Default, kSSS_CipherType_AES);
     VerifyOrExit(error == CHIP_NO_ERROR, error = CHIP_ERROR_INTERNAL);
 
 #if SSS_HAVE_SE05X_VER_GTE_16_02
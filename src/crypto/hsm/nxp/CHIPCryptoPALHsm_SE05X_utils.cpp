@@ -26,6 +26,21 @@
 
 ex_sss_boot_ctx_t gex_sss_chip_ctx;
 
+/* Values last written to keys of se05x in this session. Each PASE sets the same spake points, and
+ * usually the same credentials, so they are only written again when they change. */
+#define MAX_CACHED_KEYS 8
+#define MAX_CACHED_KEY_LEN 65
+
+typedef struct
+{
+    uint32_t keyid;
+    size_t keylen; /* 0 if the value is unknown */
+    uint8_t key[MAX_CACHED_KEY_LEN];
+} cached_key_t;
+
+static cached_key_t cachedKeys[MAX_CACHED_KEYS];
+static size_t cachedKeysCount = 0;
+
 #if ENABLE_REENTRANCY
 
 uint8_t objIDtable[MAX_SPAKE_CRYPTO_OBJECT][2] = {
@@ -197,6 +212,54 @@ exit:
     return error;
 }
 
+/* Set key in se05x, unless it was last set to the same value in this session */
+CHIP_ERROR se05x_set_key_cached(uint32_t keyid, const uint8_t * key, size_t keylen, sss_key_part_t keyPart,
+                                sss_cipher_type_t cipherType)
+{
+    cached_key_t * cached = nullptr;
+
+    for (size_t i = 0; i < cachedKeysCount; i++)
+    {
+        if (cachedKeys[i].keyid == keyid)
+        {
+            cached = &cachedKeys[i];
+            break;
+        }
+    }
+
+    if (cached != nullptr && cached->keylen == keylen && memcmp(cached->key, key, keylen) == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    if (cached == nullptr)
+    {
+        /* First use of the key in this session, it may hold another object from a previous run. */
+        se05x_delete_key(keyid);
+
+        if (cachedKeysCount < MAX_CACHED_KEYS)
+        {
+            cached        = &cachedKeys[cachedKeysCount++];
+            cached->keyid = keyid;
+        }
+    }
+
+    if (cached != nullptr)
+    {
+        cached->keylen = 0;
+    }
+
+    ReturnErrorOnFailure(se05x_set_key(keyid, key, keylen, keyPart, cipherType));
+
+    if (cached != nullptr && keylen <= sizeof(cached->key))
+    {
+        memcpy(cached->key, key, keylen);
+        cached->keylen = keylen;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 #if ENABLE_REENTRANCY
 
 /* Init crypto object mutext */
@@ -245,14 +308,26 @@ void delete_crypto_objects(void)
     return;
 }
 
-/* Get unused object id */
-SE05x_CryptoObjectID_t getObjID(void)
+/* Get unused object id, and whether its crypto object is already created */
+SE05x_CryptoObjectID_t getObjID(bool * created)
 {
     SE05x_CryptoObjectID_t objId = (SE05x_CryptoObjectID_t) 0;
     SE05x_Result_t exists        = kSE05x_Result_NA;
 
     LOCK_SECURE_ELEMENT();
 
+    /* Reuse a crypto object created for a previous spake, which saves creating and deleting one per spake. */
+    for (int i = 0; i < MAX_SPAKE_CRYPTO_OBJECT; i++)
+    {
+        if (objIDtable[i][OBJ_ID_TABLE_IDX_STATUS] == OBJ_ID_TABLE_OBJID_STATUS_IDLE)
+        {
+            objId                                  = (SE05x_CryptoObjectID_t) objIDtable[i][OBJ_ID_TABLE_IDX_OBJID];
+            objIDtable[i][OBJ_ID_TABLE_IDX_STATUS] = OBJ_ID_TABLE_OBJID_STATUS_USED;
+            *created                               = true;
+            goto exit;
+        }
+    }
+
     for (int i = 0; i < MAX_SPAKE_CRYPTO_OBJECT; i++)
     {
         if (objIDtable[i][OBJ_ID_TABLE_IDX_STATUS] == OBJ_ID_TABLE_OBJID_STATUS_FREE)
@@ -267,6 +342,7 @@ SE05x_CryptoObjectID_t getObjID(void)
             }
             objId                                  = (SE05x_CryptoObjectID_t) objIDtable[i][OBJ_ID_TABLE_IDX_OBJID];
             objIDtable[i][OBJ_ID_TABLE_IDX_STATUS] = OBJ_ID_TABLE_OBJID_STATUS_USED;
+            *created                               = false;
             goto exit;
         }
     }
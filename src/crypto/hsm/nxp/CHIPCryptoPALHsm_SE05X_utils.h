@@ -55,6 +55,7 @@ enum keyid_values
 #define OBJ_ID_TABLE_IDX_STATUS 1
 #define OBJ_ID_TABLE_OBJID_STATUS_USED 1
 #define OBJ_ID_TABLE_OBJID_STATUS_FREE 0
+#define OBJ_ID_TABLE_OBJID_STATUS_IDLE 2 /* Created in se05x, and free for another spake */
 #define LIMIT_CRYPTO_OBJECTS 2
 #endif
 
@@ -76,6 +77,10 @@ void se05x_delete_key(uint32_t keyid);
 /* Set key in se05x */
 CHIP_ERROR se05x_set_key(uint32_t keyid, const uint8_t * key, size_t keylen, sss_key_part_t keyPart, sss_cipher_type_t cipherType);
 
+/* Set key in se05x, unless it was last set to the same value in this session */
+CHIP_ERROR se05x_set_key_cached(uint32_t keyid, const uint8_t * key, size_t keylen, sss_key_part_t keyPart,
+                                sss_cipher_type_t cipherType);
+
 #if ENABLE_REENTRANCY
 
 /* Init crypto object mutext */
@@ -84,8 +89,8 @@ void init_cryptoObj_mutex(void);
 /* Delete all crypto objects in se05x */
 void delete_crypto_objects(void);
 
-/* Get unused object id */
-SE05x_CryptoObjectID_t getObjID(void);
+/* Get unused object id, and whether its crypto object is already created */
+SE05x_CryptoObjectID_t getObjID(bool * created);
 
 /* Set object id status */
 void setObjID(SE05x_CryptoObjectID_t objId, uint8_t status);
@@ -49,6 +49,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if CHIP_CONFIG_DRBG_PER_THREAD
+#include <atomic>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #define HSM_ECC_KEYID 0x11223344
 
 using namespace chip;
@@ -581,6 +588,108 @@ static void TestAES_CCM_128DecryptInvalidIVLen(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
 }
 
+static void TestAES_CCM_128CipherTestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+            out_ct.Alloc(vector->ct_len);
+            NL_TEST_ASSERT(inSuite, out_ct);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+            out_tag.Alloc(vector->tag_len);
+            NL_TEST_ASSERT(inSuite, out_tag);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            out_pt.Alloc(vector->pt_len);
+            NL_TEST_ASSERT(inSuite, out_pt);
+
+            AES_CCM_cipher cipher;
+            NL_TEST_ASSERT(inSuite, cipher.Init(vector->key, vector->key_len) == CHIP_NO_ERROR);
+
+            CHIP_ERROR err = cipher.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                            vector->iv, vector->iv_len, out_pt.Get());
+            NL_TEST_ASSERT(inSuite, err == vector->result);
+            if (vector->result != CHIP_NO_ERROR)
+            {
+                continue;
+            }
+            NL_TEST_ASSERT(inSuite, memcmp(vector->pt, out_pt.Get(), vector->pt_len) == 0);
+
+            // The same context encrypts and decrypts repeatedly, including after a change of tag length.
+            const size_t other_tag_len = (vector->tag_len == 16) ? 8 : 16;
+            uint8_t other_tag[16];
+            uint8_t expected_tag[16];
+            for (int pass = 0; pass < 2; pass++)
+            {
+                err = cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len,
+                                     out_ct.Get(), out_tag.Get(), vector->tag_len);
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(out_ct.Get(), vector->ct, vector->ct_len) == 0);
+                NL_TEST_ASSERT(inSuite, memcmp(out_tag.Get(), vector->tag, vector->tag_len) == 0);
+
+                err = cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len,
+                                     out_ct.Get(), other_tag, other_tag_len);
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                err = AES_CCM_encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->key, vector->key_len,
+                                      vector->iv, vector->iv_len, out_ct.Get(), expected_tag, other_tag_len);
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(other_tag, expected_tag, other_tag_len) == 0);
+            }
+
+            // A copy holds its own context for the same key.
+            AES_CCM_cipher copy(cipher);
+            cipher.Clear();
+            NL_TEST_ASSERT(inSuite, !cipher.IsInitialized());
+            err = cipher.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len, vector->iv,
+                                 vector->iv_len, out_pt.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+
+            memset(out_pt.Get(), 0, vector->pt_len);
+            err = copy.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len, vector->iv,
+                               vector->iv_len, out_pt.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(vector->pt, out_pt.Get(), vector->pt_len) == 0);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+}
+
+static void TestAES_CCM_CipherInvalidParams(nlTestSuite * inSuite, void * inContext)
+{
+    const ccm_128_test_vector * vector = ccm_128_test_vectors[0];
+    uint8_t out_ct[64];
+    uint8_t out_tag[16];
+
+    AES_CCM_cipher cipher;
+    NL_TEST_ASSERT(inSuite, !cipher.IsInitialized());
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len, out_ct,
+                                  out_tag, vector->tag_len) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(inSuite, cipher.Init(nullptr, vector->key_len) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cipher.Init(vector->key, vector->key_len - 1) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !cipher.IsInitialized());
+
+    NL_TEST_ASSERT(inSuite, cipher.Init(vector->key, vector->key_len) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(nullptr, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len, out_ct, out_tag,
+                                  vector->tag_len) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, 0, out_ct, out_tag,
+                                  vector->tag_len) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len, out_ct,
+                                  out_tag, 13) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Decrypt(vector->ct, 0, vector->aad, vector->aad_len, vector->tag, vector->tag_len, vector->iv,
+                                  vector->iv_len, out_ct) == CHIP_ERROR_INVALID_ARGUMENT);
+}
+
 static void TestHash_SHA256(nlTestSuite * inSuite, void * inContext)
 {
     int numOfTestCases     = ArraySize(hash_sha256_test_vectors);
@@ -659,6 +768,42 @@ static void TestHKDF_SHA256(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, numOfTestsExecuted == 3);
 }
 
+static void TestHKDF_SHA256_Batch(nlTestSuite * inSuite, void * inContext)
+{
+    const char * secondInfo = "Second Info";
+
+    for (const hkdf_sha256_vector & v : hkdf_sha256_test_vectors)
+    {
+        uint8_t out1[128];
+        uint8_t out2[16];
+        uint8_t expected2[sizeof(out2)];
+        NL_TEST_ASSERT(inSuite, v.output_key_material_length <= sizeof(out1));
+
+        // The first output matches the test vector, and the second the key HKDF_SHA256 derives with its info
+        const HKDFOutput outputs[] = {
+            { v.info, v.info_length, out1, v.output_key_material_length },
+            { reinterpret_cast<const uint8_t *>(secondInfo), strlen(secondInfo), out2, sizeof(out2) },
+        };
+        NL_TEST_ASSERT(inSuite,
+                       HKDF_SHA256_Batch(v.initial_key_material, v.initial_key_material_length, v.salt, v.salt_length, outputs,
+                                         ArraySize(outputs)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       HKDF_SHA256(v.initial_key_material, v.initial_key_material_length, v.salt, v.salt_length,
+                                   reinterpret_cast<const uint8_t *>(secondInfo), strlen(secondInfo), expected2,
+                                   sizeof(expected2)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(v.output_key_material, out1, v.output_key_material_length) == 0);
+        NL_TEST_ASSERT(inSuite, memcmp(expected2, out2, sizeof(out2)) == 0);
+
+        // Invalid inputs
+        NL_TEST_ASSERT(inSuite,
+                       HKDF_SHA256_Batch(v.initial_key_material, v.initial_key_material_length, v.salt, v.salt_length, nullptr,
+                                         0) == CHIP_ERROR_INVALID_ARGUMENT);
+        NL_TEST_ASSERT(inSuite,
+                       HKDF_SHA256_Batch(nullptr, 0, v.salt, v.salt_length, outputs, ArraySize(outputs)) ==
+                           CHIP_ERROR_INVALID_ARGUMENT);
+    }
+}
+
 static void TestDRBG_InvalidInputs(nlTestSuite * inSuite, void * inContext)
 {
     CHIP_ERROR error = CHIP_NO_ERROR;
@@ -682,6 +827,82 @@ static void TestDRBG_Output(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(out_buf, orig_buf, sizeof(out_buf)) != 0);
 }
 
+static void TestDRBG_SmallRequests(nlTestSuite * inSuite, void * inContext)
+{
+    // Small requests are served from a pool of random bytes; check that no bytes are handed out twice across refills
+    uint8_t out_buf[7 * 64] = { 0 };
+    uint8_t orig_buf[7]     = { 0 };
+
+    for (size_t i = 0; i < sizeof(out_buf); i += sizeof(orig_buf))
+    {
+        NL_TEST_ASSERT(inSuite, DRBG_get_bytes(&out_buf[i], sizeof(orig_buf)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(&out_buf[i], orig_buf, sizeof(orig_buf)) != 0);
+    }
+
+    for (size_t i = sizeof(orig_buf); i < sizeof(out_buf); i += sizeof(orig_buf))
+    {
+        NL_TEST_ASSERT(inSuite, memcmp(&out_buf[i], &out_buf[i - sizeof(orig_buf)], sizeof(orig_buf)) != 0);
+    }
+}
+
+#if CHIP_CONFIG_DRBG_PER_THREAD
+static std::atomic<bool> sDRBGThreadRunning;
+
+static void * DRBGThreadMain(void * context)
+{
+    uint8_t buffer[7];
+
+    while (sDRBGThreadRunning)
+    {
+        (void) DRBG_get_bytes(buffer, sizeof(buffer));
+    }
+
+    return nullptr;
+}
+
+static void TestDRBG_Fork(nlTestSuite * inSuite, void * inContext)
+{
+    // Fork while another thread draws random bytes; the child must neither block on the entropy source nor repeat the parent
+    uint8_t parent_buf[7] = { 0 };
+    uint8_t child_buf[7]  = { 0 };
+    int fds[2];
+    pthread_t thread;
+
+    NL_TEST_ASSERT(inSuite, DRBG_get_bytes(parent_buf, sizeof(parent_buf)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pipe(fds) == 0);
+
+    sDRBGThreadRunning = true;
+    NL_TEST_ASSERT(inSuite, pthread_create(&thread, nullptr, DRBGThreadMain, nullptr) == 0);
+
+    for (int i = 0; i < 16; i++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            alarm(10);
+            bool ok = DRBG_get_bytes(child_buf, sizeof(child_buf)) == CHIP_NO_ERROR &&
+                write(fds[1], child_buf, sizeof(child_buf)) == static_cast<ssize_t>(sizeof(child_buf));
+            _exit(ok ? 0 : 1);
+        }
+        NL_TEST_ASSERT(inSuite, pid > 0);
+
+        NL_TEST_ASSERT(inSuite, DRBG_get_bytes(parent_buf, sizeof(parent_buf)) == CHIP_NO_ERROR);
+
+        int status = 0;
+        NL_TEST_ASSERT(inSuite, waitpid(pid, &status, 0) == pid);
+        NL_TEST_ASSERT(inSuite, WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        NL_TEST_ASSERT(inSuite, read(fds[0], child_buf, sizeof(child_buf)) == static_cast<ssize_t>(sizeof(child_buf)));
+        NL_TEST_ASSERT(inSuite, memcmp(child_buf, parent_buf, sizeof(child_buf)) != 0);
+    }
+
+    sDRBGThreadRunning = false;
+    NL_TEST_ASSERT(inSuite, pthread_join(thread, nullptr) == 0);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+#endif // CHIP_CONFIG_DRBG_PER_THREAD
+
 static void TestECDSA_Signing_SHA256_Msg(nlTestSuite * inSuite, void * inContext)
 {
     const char * msg  = "Hello World!";
@@ -874,6 +1095,60 @@ static void TestECDSA_ValidationHashInvalidParam(nlTestSuite * inSuite, void * i
     signing_error = CHIP_NO_ERROR;
 }
 
+static void TestECDSA_SignatureVerifier(nlTestSuite * inSuite, void * inContext)
+{
+    const char * msg  = "Hello World!";
+    size_t msg_length = strlen(msg);
+    uint8_t hash[kSHA256_Hash_Length];
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair otherKeypair;
+    NL_TEST_ASSERT(inSuite, otherKeypair.Initialize() == CHIP_NO_ERROR);
+
+    P256ECDSASignature signature;
+    NL_TEST_ASSERT(inSuite, keypair.ECDSA_sign_msg(Uint8::from_const_char(msg), msg_length, signature) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Hash_SHA256(Uint8::from_const_char(msg), msg_length, hash) == CHIP_NO_ERROR);
+
+    P256SignatureVerifier verifier;
+    NL_TEST_ASSERT(inSuite, !verifier.IsInitialized());
+    NL_TEST_ASSERT(inSuite, verifier.ValidateHashSignature(hash, sizeof(hash), signature) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(inSuite, verifier.Init(keypair.Pubkey()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, verifier.IsKey(keypair.Pubkey()));
+    NL_TEST_ASSERT(inSuite, !verifier.IsKey(otherKeypair.Pubkey()));
+
+    // The same verifier checks many signatures
+    for (int i = 0; i < 3; i++)
+    {
+        NL_TEST_ASSERT(inSuite, verifier.ValidateMsgSignature(Uint8::from_const_char(msg), msg_length, signature) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, verifier.ValidateHashSignature(hash, sizeof(hash), signature) == CHIP_NO_ERROR);
+    }
+
+    hash[0] ^= 0x01;
+    NL_TEST_ASSERT(inSuite, verifier.ValidateHashSignature(hash, sizeof(hash), signature) == CHIP_ERROR_INVALID_SIGNATURE);
+    NL_TEST_ASSERT(inSuite, verifier.ValidateHashSignature(nullptr, sizeof(hash), signature) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, verifier.ValidateHashSignature(hash, sizeof(hash) - 5, signature) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, verifier.ValidateMsgSignature(nullptr, msg_length, signature) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Switching keys rejects the signatures of the previous one
+    NL_TEST_ASSERT(inSuite, verifier.Init(otherKeypair.Pubkey()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   verifier.ValidateMsgSignature(Uint8::from_const_char(msg), msg_length, signature) ==
+                       CHIP_ERROR_INVALID_SIGNATURE);
+
+    // A point that is not on the curve is rejected up front
+    P256PublicKey invalidKey;
+    memcpy(invalidKey, keypair.Pubkey(), kP256_PublicKey_Length);
+    invalidKey[kP256_PublicKey_Length - 1] ^= 0x01;
+    NL_TEST_ASSERT(inSuite, verifier.Init(invalidKey) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !verifier.IsInitialized());
+
+    verifier.Clear();
+    NL_TEST_ASSERT(inSuite, !verifier.IsInitialized());
+}
+
 static void TestECDH_EstablishSecret(nlTestSuite * inSuite, void * inContext)
 {
     Test_P256Keypair keypair1;
@@ -1436,6 +1711,8 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid ct", TestAES_CCM_128DecryptInvalidCipherText),
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid key", TestAES_CCM_128DecryptInvalidKey),
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid IV", TestAES_CCM_128DecryptInvalidIVLen),
+    NL_TEST_DEF("Test AES-CCM-128 cipher context test vectors", TestAES_CCM_128CipherTestVectors),
+    NL_TEST_DEF("Test AES-CCM cipher context invalid parameters", TestAES_CCM_CipherInvalidParams),
     NL_TEST_DEF("Test encrypting AES-CCM-256 test vectors", TestAES_CCM_256EncryptTestVectors),
     NL_TEST_DEF("Test decrypting AES-CCM-256 test vectors", TestAES_CCM_256DecryptTestVectors),
     NL_TEST_DEF("Test encrypting AES-CCM-256 invalid plain text", TestAES_CCM_256EncryptInvalidPlainText),
@@ -1456,11 +1733,17 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test ECDSA sign hash invalid parameters", TestECDSA_SigningHashInvalidParams),
     NL_TEST_DEF("Test ECDSA msg signature validation invalid parameters", TestECDSA_ValidationMsgInvalidParam),
     NL_TEST_DEF("Test ECDSA hash signature validation invalid parameters", TestECDSA_ValidationHashInvalidParam),
+    NL_TEST_DEF("Test ECDSA signature verifier", TestECDSA_SignatureVerifier),
     NL_TEST_DEF("Test Hash SHA 256", TestHash_SHA256),
     NL_TEST_DEF("Test Hash SHA 256 Stream", TestHash_SHA256_Stream),
     NL_TEST_DEF("Test HKDF SHA 256", TestHKDF_SHA256),
+    NL_TEST_DEF("Test HKDF SHA 256 Batch", TestHKDF_SHA256_Batch),
     NL_TEST_DEF("Test DRBG invalid inputs", TestDRBG_InvalidInputs),
     NL_TEST_DEF("Test DRBG output", TestDRBG_Output),
+    NL_TEST_DEF("Test DRBG small requests", TestDRBG_SmallRequests),
+#if CHIP_CONFIG_DRBG_PER_THREAD
+    NL_TEST_DEF("Test DRBG across fork", TestDRBG_Fork),
+#endif
     NL_TEST_DEF("Test ECDH derive shared secret", TestECDH_EstablishSecret),
     NL_TEST_DEF("Test adding entropy sources", TestAddEntropySources),
     NL_TEST_DEF("Test PBKDF2 SHA256", TestPBKDF2_SHA256_TestVectors),
@@ -0,0 +1,58 @@
+/**
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef CHIP_ATTRIBUTE_REPORT_BATCHER_H
+#define CHIP_ATTRIBUTE_REPORT_BATCHER_H
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A report of an attribute value. Signed values are sign extended, and are read back by casting value to int64_t.
+ */
+typedef struct {
+    uint16_t cluster;
+    uint16_t attribute;
+    uint8_t endpoint;
+    uint64_t value;
+} CHIPAttributeReport;
+
+/**
+ * The handler of a batch of reports, which are only valid during the call.
+ */
+typedef void (^CHIPAttributeReportBatchHandler)(const CHIPAttributeReport * reports, NSUInteger count);
+
+/**
+ * CHIPAttributeReportBatcher
+ *    Collects the reports of attributes for an interval, and delivers them in a single block on the queue, in the
+ *    order they were received. The reports are sent to the batcher with the reportAttribute...ToBatcher:error:
+ *    methods of the clusters.
+ */
+@interface CHIPAttributeReportBatcher : NSObject
+
+- (instancetype)initWithQueue:(dispatch_queue_t)queue
+                     interval:(NSTimeInterval)interval
+                      handler:(CHIPAttributeReportBatchHandler)handler NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* CHIP_ATTRIBUTE_REPORT_BATCHER_H */
@@ -0,0 +1,69 @@
+/**
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#import "CHIPAttributeReportBatcher_Internal.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+@interface CHIPAttributeReportBatcher ()
+
+@property (readonly, nonatomic) dispatch_queue_t queue;
+@property (readonly, nonatomic) dispatch_queue_t chipWorkQueue;
+@property (readonly, nonatomic) NSTimeInterval interval;
+@property (readonly, nonatomic) CHIPAttributeReportBatchHandler handler;
+// The reports of the current batch, only accessed on the CHIP work queue
+@property (nonatomic, strong) NSMutableData * pendingReports;
+
+@end
+
+@implementation CHIPAttributeReportBatcher
+
+- (instancetype)initWithQueue:(dispatch_queue_t)queue interval:(NSTimeInterval)interval handler:(CHIPAttributeReportBatchHandler)handler
+{
+    if (self = [super init]) {
+        _queue = queue;
+        _chipWorkQueue = chip::DeviceLayer::PlatformMgrImpl().GetWorkQueue();
+        _interval = interval;
+        _handler = handler;
+    }
+    return self;
+}
+
+- (void)addReport:(const CHIPAttributeReport &)report
+{
+    // The first report of a batch schedules its delivery at the end of the interval.
+    if (self.pendingReports == nil) {
+        self.pendingReports = [NSMutableData data];
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (self.interval * NSEC_PER_SEC)), self.chipWorkQueue, ^{
+            [self deliverReports];
+        });
+    }
+    [self.pendingReports appendBytes:&report length:sizeof(report)];
+}
+
+- (void)deliverReports
+{
+    NSData * reports = self.pendingReports;
+    CHIPAttributeReportBatchHandler handler = self.handler;
+
+    self.pendingReports = nil;
+    dispatch_async(self.queue, ^{
+        handler(static_cast<const CHIPAttributeReport *>(reports.bytes), reports.length / sizeof(CHIPAttributeReport));
+    });
+}
+
+@end
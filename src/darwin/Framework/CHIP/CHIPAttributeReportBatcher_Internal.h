@@ -0,0 +1,73 @@
+/**
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef CHIP_ATTRIBUTE_REPORT_BATCHER_INTERNAL_H
+#define CHIP_ATTRIBUTE_REPORT_BATCHER_INTERNAL_H
+
+#import "CHIPAttributeReportBatcher.h"
+#import <Foundation/Foundation.h>
+
+#include <app/util/basic-types.h>
+#include <core/CHIPCallback.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface CHIPAttributeReportBatcher ()
+
+// Must be called on the CHIP work queue.
+- (void)addReport:(const CHIPAttributeReport &)report;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+/**
+ * Sends the reports of an attribute, whose callback type is Fn, to a batcher rather than to a handler of its own.
+ */
+template <typename Fn> class CHIPAttributeReportBatchCallbackBridge;
+
+template <typename T>
+class CHIPAttributeReportBatchCallbackBridge<void (*)(void *, T)> : public chip::Callback::Callback<void (*)(void *, T)> {
+public:
+    CHIPAttributeReportBatchCallbackBridge(
+        CHIPAttributeReportBatcher * batcher, chip::EndpointId endpoint, chip::ClusterId cluster, chip::AttributeId attribute)
+        : chip::Callback::Callback<void (*)(void *, T)>(CallbackFn, this)
+        , mBatcher(batcher)
+    {
+        mReport.cluster = cluster;
+        mReport.attribute = attribute;
+        mReport.endpoint = endpoint;
+    }
+
+    ~CHIPAttributeReportBatchCallbackBridge() {};
+
+    static void CallbackFn(void * context, T value)
+    {
+        CHIPAttributeReportBatchCallbackBridge * callback = reinterpret_cast<CHIPAttributeReportBatchCallbackBridge *>(context);
+        if (callback && callback->mBatcher) {
+            CHIPAttributeReport report = callback->mReport;
+            report.value = static_cast<uint64_t>(value);
+            [callback->mBatcher addReport:report];
+        }
+    };
+
+private:
+    CHIPAttributeReportBatcher * mBatcher;
+    CHIPAttributeReport mReport = {};
+};
+
+#endif /* CHIP_ATTRIBUTE_REPORT_BATCHER_INTERNAL_H */
@@ -23,6 +23,9 @@ NS_ASSUME_NONNULL_BEGIN
  * The protocol definition for the CHIPPersistenStorageDelegate
  *
  * All delegate methods will be called on the supplied Delegate Queue.
+ *
+ * The framework caches the values it gets, sets and deletes: each key is only got once, and sets and deletes are made in the
+ * background, the last value of a key set several times in a row being the only one written.
  */
 @protocol CHIPPersistentStorageDelegate <NSObject>
 @required
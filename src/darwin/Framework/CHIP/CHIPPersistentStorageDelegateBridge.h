@@ -22,6 +22,13 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ * Bridges the framework storage delegate to the CHIP stack, caching every key it gets, sets or deletes.
+ *
+ * Gets are served from the cache once a key is known, without hopping to the delegate queue. Sets and deletes update the
+ * cache and are written back to the delegate, on its queue, in the background: the writes made while the previous ones are
+ * on their way are coalesced into the next batch, only the last value of each key being written.
+ */
 class CHIPPersistentStorageDelegateBridge : public chip::PersistentStorageDelegate
 {
 public:
@@ -37,11 +44,23 @@ public:
     CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
 
 private:
+    void WriteBack(NSString * key, id value);
+    void ScheduleWriteBack();
+
     id<CHIPPersistentStorageDelegate> mDelegate;
     dispatch_queue_t mQueue;
+    // A serial queue targeting mQueue, for the batches written back to the delegate not to overlap on a concurrent queue
+    dispatch_queue_t mDelegateQueue;
 
     NSUserDefaults * mDefaultPersistentStorage;
     dispatch_queue_t mWorkQueue;
+
+    // The following are only accessed on mWorkQueue.
+    // The value of every key known, as NSData, or NSNull for those known not to exist. Keys are never evicted: a key written
+    // back is always found here, and never read from the delegate before its write reaches it.
+    NSMutableDictionary<NSString *, id> * mCache;
+    // The writes not yet taken by a batch, the last value of each key, or NSNull for a deletion
+    NSMutableDictionary<NSString *, id> * mPendingWrites;
 };
 
 NS_ASSUME_NONNULL_END
@@ -56,30 +56,55 @@ CHIPPersistentStorageDelegateBridge::CHIPPersistentStorageDelegateBridge(void)
 {
     mDefaultPersistentStorage = [[NSUserDefaults alloc] init];
     mWorkQueue = dispatch_queue_create("com.zigbee.chip.framework.storage.workqueue", DISPATCH_QUEUE_SERIAL);
+    mCache = [NSMutableDictionary dictionary];
+    mPendingWrites = [NSMutableDictionary dictionary];
 }
 
+// The batches already scheduled hold on to what they need, and are still written back after the bridge is gone.
 CHIPPersistentStorageDelegateBridge::~CHIPPersistentStorageDelegateBridge(void) {}
 
 void CHIPPersistentStorageDelegateBridge::setFrameworkDelegate(
     _Nullable id<CHIPPersistentStorageDelegate> delegate, _Nullable dispatch_queue_t queue)
 {
     dispatch_async(mWorkQueue, ^{
+        if (!delegate || !queue) {
+            if (mDelegate == nil) {
+                return;
+            }
+        } else if (delegate == mDelegate && queue == mQueue) {
+            return;
+        }
+
+        // The keys of another store are not known yet. The writes pending for the previous delegate are still written back to
+        // it, by the batch already scheduled, which holds on to them.
+        [mCache removeAllObjects];
+        mPendingWrites = [NSMutableDictionary dictionary];
+
         if (delegate && queue) {
             mDelegate = delegate;
             mQueue = queue;
+            mDelegateQueue = dispatch_queue_create("com.zigbee.chip.framework.storage.delegatequeue", DISPATCH_QUEUE_SERIAL);
+            dispatch_set_target_queue(mDelegateQueue, queue);
         } else {
             mDelegate = nil;
             mQueue = nil;
+            mDelegateQueue = nil;
         }
     });
 }
 
 CHIP_ERROR CHIPPersistentStorageDelegateBridge::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
 {
-    __block CHIP_ERROR error = CHIP_NO_ERROR;
+    __block id value = nil;
     NSString * keyString = [NSString stringWithUTF8String:key];
 
+    // The work queue runs nothing but short updates of the cache, and never waits for the delegate queue.
     dispatch_sync(mWorkQueue, ^{
+        value = mCache[keyString];
+        if (value != nil) {
+            return;
+        }
+
         NSLog(@"PersistentStorageDelegate Sync Get Value for Key: %@", keyString);
 
         NSString * valueString = nil;
@@ -93,45 +118,43 @@ CHIP_ERROR CHIPPersistentStorageDelegateBridge::SyncGetKeyValue(const char * key
 
         if (valueString != nil) {
             std::string decoded = Base64ToString([valueString UTF8String]);
-
-            if (decoded.length() > UINT16_MAX) {
-                error = CHIP_ERROR_BUFFER_TOO_SMALL;
-            } else {
-                if (buffer != nullptr) {
-                    memcpy(buffer, decoded.data(), std::min<size_t>(decoded.length(), size));
-                    if (size < decoded.length()) {
-                        error = CHIP_ERROR_NO_MEMORY;
-                    }
-                } else {
-                    error = CHIP_ERROR_NO_MEMORY;
-                }
-                size = static_cast<uint16_t>(decoded.length());
-            }
+            value = [NSData dataWithBytes:decoded.data() length:decoded.length()];
         } else {
-            error = CHIP_ERROR_KEY_NOT_FOUND;
+            value = [NSNull null];
         }
+        mCache[keyString] = value;
     });
+
+    if (value == [NSNull null]) {
+        return CHIP_ERROR_KEY_NOT_FOUND;
+    }
+
+    NSData * data = value;
+    if (data.length > UINT16_MAX) {
+        return CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    if (buffer != nullptr) {
+        memcpy(buffer, data.bytes, std::min<size_t>(data.length, size));
+        if (size < data.length) {
+            error = CHIP_ERROR_NO_MEMORY;
+        }
+    } else {
+        error = CHIP_ERROR_NO_MEMORY;
+    }
+    size = static_cast<uint16_t>(data.length);
     return error;
 }
 
 CHIP_ERROR CHIPPersistentStorageDelegateBridge::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
 {
-    std::string base64Value = StringToBase64(std::string(static_cast<const char *>(value), size));
-
     NSString * keyString = [NSString stringWithUTF8String:key];
-    NSString * valueString = [NSString stringWithUTF8String:base64Value.c_str()];
-
-    dispatch_sync(mWorkQueue, ^{
-        NSLog(@"PersistentStorageDelegate Set Key %@", keyString);
+    NSData * data = [NSData dataWithBytes:value length:size];
 
-        id<CHIPPersistentStorageDelegate> strongDelegate = mDelegate;
-        if (strongDelegate && mQueue) {
-            dispatch_sync(mQueue, ^{
-                [strongDelegate CHIPSetKeyValue:keyString value:valueString];
-            });
-        } else {
-            [mDefaultPersistentStorage setObject:valueString forKey:keyString];
-        }
+    dispatch_async(mWorkQueue, ^{
+        mCache[keyString] = data;
+        WriteBack(keyString, data);
     });
 
     // TODO: ideally the error from the dispatch should be returned
@@ -144,17 +167,10 @@ CHIP_ERROR CHIPPersistentStorageDelegateBridge::SyncSetKeyValue(const char * key
 CHIP_ERROR CHIPPersistentStorageDelegateBridge::SyncDeleteKeyValue(const char * key)
 {
     NSString * keyString = [NSString stringWithUTF8String:key];
-    dispatch_sync(mWorkQueue, ^{
-        NSLog(@"PersistentStorageDelegate Delete Key: %@", keyString);
 
-        id<CHIPPersistentStorageDelegate> strongDelegate = mDelegate;
-        if (strongDelegate && mQueue) {
-            dispatch_sync(mQueue, ^{
-                [strongDelegate CHIPDeleteKeyValue:keyString];
-            });
-        } else {
-            [mDefaultPersistentStorage removeObjectForKey:keyString];
-        }
+    dispatch_async(mWorkQueue, ^{
+        mCache[keyString] = [NSNull null];
+        WriteBack(keyString, [NSNull null]);
     });
 
     // TODO: ideally the error from the dispatch should be returned
@@ -163,3 +179,51 @@ CHIP_ERROR CHIPPersistentStorageDelegateBridge::SyncDeleteKeyValue(const char *
 
     return CHIP_NO_ERROR;
 }
+
+void CHIPPersistentStorageDelegateBridge::WriteBack(NSString * key, id value)
+{
+    if (mDelegate == nil) {
+        if (value == [NSNull null]) {
+            [mDefaultPersistentStorage removeObjectForKey:key];
+        } else {
+            NSData * data = value;
+            std::string base64Value = StringToBase64(std::string(static_cast<const char *>(data.bytes), data.length));
+            [mDefaultPersistentStorage setObject:[NSString stringWithUTF8String:base64Value.c_str()] forKey:key];
+        }
+        return;
+    }
+
+    // The first write of a batch schedules it: those made until the delegate queue gets to it join the batch.
+    if (mPendingWrites.count == 0) {
+        ScheduleWriteBack();
+    }
+    mPendingWrites[key] = value;
+}
+
+void CHIPPersistentStorageDelegateBridge::ScheduleWriteBack()
+{
+    id<CHIPPersistentStorageDelegate> strongDelegate = mDelegate;
+    NSMutableDictionary<NSString *, id> * pendingWrites = mPendingWrites;
+    dispatch_queue_t workQueue = mWorkQueue;
+
+    dispatch_async(mDelegateQueue, ^{
+        __block NSDictionary<NSString *, id> * batch = nil;
+        dispatch_sync(workQueue, ^{
+            batch = [pendingWrites copy];
+            [pendingWrites removeAllObjects];
+        });
+
+        NSLog(@"PersistentStorageDelegate Write Back %lu Keys", static_cast<unsigned long>(batch.count));
+
+        [batch enumerateKeysAndObjectsUsingBlock:^(NSString * keyString, id value, BOOL * stop) {
+            if (value == [NSNull null]) {
+                [strongDelegate CHIPDeleteKeyValue:keyString];
+                return;
+            }
+
+            NSData * data = value;
+            std::string base64Value = StringToBase64(std::string(static_cast<const char *>(data.bytes), data.length));
+            [strongDelegate CHIPSetKeyValue:keyString value:[NSString stringWithUTF8String:base64Value.c_str()]];
+        }];
+    });
+}
@@ -22,6 +22,7 @@
 
 #import <Foundation/Foundation.h>
 
+@class CHIPAttributeReportBatcher;
 @class CHIPDevice;
 
 typedef void (^ResponseHandler)(NSError * _Nullable error, NSDictionary * _Nullable values);
@@ -219,12 +220,14 @@ NS_ASSUME_NONNULL_BEGIN
                                              change:(uint8_t)change
                                     responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentHueWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentHueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeCurrentSaturationWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentSaturationWithMinInterval:(uint16_t)minInterval
                                                maxInterval:(uint16_t)maxInterval
                                                     change:(uint8_t)change
                                            responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentSaturationWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentSaturationToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeRemainingTimeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeCurrentXWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentXWithMinInterval:(uint16_t)minInterval
@@ -232,12 +235,14 @@ NS_ASSUME_NONNULL_BEGIN
                                            change:(uint16_t)change
                                   responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentXWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentXToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeCurrentYWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)configureAttributeCurrentYWithMinInterval:(uint16_t)minInterval
                                       maxInterval:(uint16_t)maxInterval
                                            change:(uint16_t)change
                                   responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentYWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentYToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeDriftCompensationWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeCompensationTextWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeColorTemperatureWithResponseHandler:(ResponseHandler)responseHandler;
@@ -246,6 +251,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                    change:(uint16_t)change
                                           responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeColorTemperatureWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeColorTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeColorModeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeColorControlOptionsWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)writeAttributeColorControlOptionsWithValue:(uint8_t)value responseHandler:(ResponseHandler)responseHandler;
@@ -377,6 +383,7 @@ NS_ASSUME_NONNULL_BEGIN
                                        maxInterval:(uint16_t)maxInterval
                                    responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeLockStateWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeLockStateToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeLockTypeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeActuatorEnabledWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
@@ -491,6 +498,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                change:(uint8_t)change
                                       responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentLevelWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentLevelToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
 
 @end
@@ -568,6 +576,7 @@ NS_ASSUME_NONNULL_BEGIN
                                    maxInterval:(uint16_t)maxInterval
                                responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeOnOffWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeOnOffToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
 
 @end
@@ -607,6 +616,7 @@ NS_ASSUME_NONNULL_BEGIN
                                            change:(int16_t)change
                                   responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCapacityWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCapacityToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeOperationModeWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)writeAttributeOperationModeWithValue:(uint8_t)value responseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
@@ -659,6 +669,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                   change:(uint8_t)change
                                          responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeCurrentPositionWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeCurrentPositionToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
 
 @end
@@ -675,6 +686,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                 change:(int16_t)change
                                        responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeMeasuredValueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeMinMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeMaxMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler;
@@ -750,6 +762,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                    change:(int16_t)change
                                           responseHandler:(ResponseHandler)responseHandler;
 - (void)reportAttributeLocalTemperatureWithResponseHandler:(ResponseHandler)responseHandler;
+- (BOOL)reportAttributeLocalTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error;
 - (void)readAttributeOccupiedCoolingSetpointWithResponseHandler:(ResponseHandler)responseHandler;
 - (void)writeAttributeOccupiedCoolingSetpointWithValue:(int16_t)value responseHandler:(ResponseHandler)responseHandler;
 - (void)readAttributeOccupiedHeatingSetpointWithResponseHandler:(ResponseHandler)responseHandler;
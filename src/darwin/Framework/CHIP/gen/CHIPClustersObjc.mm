@@ -19,6 +19,7 @@
 
 #import <Foundation/Foundation.h>
 
+#import "CHIPAttributeReportBatcher_Internal.h"
 #import "CHIPDevice.h"
 #import "CHIPDevice_Internal.h"
 #import "CHIPError.h"
@@ -2235,6 +2236,7 @@ private:
 @interface CHIPCluster ()
 @property (readonly, nonatomic) dispatch_queue_t callbackQueue;
 @property (readonly, nonatomic) dispatch_queue_t chipWorkQueue;
+@property (readonly, nonatomic) EndpointId endpoint;
 - (Controller::ClusterBase *)getCluster;
 @end
 
@@ -2262,6 +2264,7 @@ private:
         }
 
         _callbackQueue = queue;
+        _endpoint = endpoint;
     }
     return self;
 }
@@ -3955,6 +3958,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentHueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentHue(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeCurrentSaturationWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -4032,6 +4062,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentSaturationToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0001);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentSaturation(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeRemainingTimeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -4136,6 +4193,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentXToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0003);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentX(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeCurrentYWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -4213,6 +4297,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentYToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0004);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentY(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeDriftCompensationWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -4345,6 +4456,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeColorTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0007);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeColorTemperature(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeColorModeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -6755,6 +6893,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeLockStateToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeLockState(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeLockTypeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -7843,6 +8008,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentLevelToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentLevel(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -8424,6 +8616,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeOnOffToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<BooleanAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<BooleanAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeOnOff(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -8829,6 +9048,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCapacityToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0013);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCapacity(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeOperationModeWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt8uAttributeCallbackBridge * onSuccess = new CHIPInt8uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -9404,6 +9650,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeCurrentPositionToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int8uAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0001);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeCurrentPosition(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeClusterRevisionWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16uAttributeCallbackBridge * onSuccess = new CHIPInt16uAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -9521,6 +9794,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeMeasuredValueToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeMeasuredValue(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeMinMeasuredValueWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16sAttributeCallbackBridge * onSuccess = new CHIPInt16sAttributeCallbackBridge(responseHandler, [self callbackQueue]);
@@ -10842,6 +11142,33 @@ private:
     }
 }
 
+- (BOOL)reportAttributeLocalTemperatureToBatcher:(CHIPAttributeReportBatcher *)batcher error:(NSError * __autoreleasing *)error
+{
+    CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback> * onReport
+        = new CHIPAttributeReportBatchCallbackBridge<Int16sAttributeCallback>(
+            batcher, [self endpoint], self.cppCluster.GetClusterId(), 0x0000);
+    if (!onReport) {
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:CHIP_ERROR_INCORRECT_STATE];
+        }
+        return NO;
+    }
+
+    __block CHIP_ERROR err;
+    dispatch_sync([self chipWorkQueue], ^{
+        err = self.cppCluster.ReportAttributeLocalTemperature(onReport->Cancel());
+    });
+
+    if (err != CHIP_NO_ERROR) {
+        delete onReport;
+        if (error) {
+            *error = [CHIPError errorForCHIPErrorCode:err];
+        }
+        return NO;
+    }
+    return YES;
+}
+
 - (void)readAttributeOccupiedCoolingSetpointWithResponseHandler:(ResponseHandler)responseHandler
 {
     CHIPInt16sAttributeCallbackBridge * onSuccess = new CHIPInt16sAttributeCallbackBridge(responseHandler, [self callbackQueue]);
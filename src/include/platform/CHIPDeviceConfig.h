@@ -91,6 +91,19 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS
+ *
+ * The number of threads of the worker pool of the PlatformManager, which runs blocking or expensive operations, such as
+ * the PBKDF2 and SPAKE2+ computations of commissioning, off the chip task. 0 disables the pool.
+ *
+ * The pool is only started on platforms with CHIP_SYSTEM_CONFIG_POSIX_LOCKING, and has at most
+ * CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS threads.
+ */
+#ifndef CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS
+#define CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS 2
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_FACTORY_PROVISIONING
  *
@@ -221,6 +234,17 @@
 #define CHIP_DEVICE_CONFIG_USER_SELECTED_MODE_TIMEOUT_SEC 30
 #endif // CHIP_DEVICE_CONFIG_USER_SELECTED_MODE_TIMEOUT_SEC
 
+/**
+ * CHIP_DEVICE_CONFIG_CACHE_SETUP_PASE_VERIFIER
+ *
+ * Enables storing the Spake2+ verifier of the setup PIN code in Chip NV storage the first time
+ * the pairing window opens, if none was stored at provisioning time.  Later commissioning attempts,
+ * including after a reboot, then skip the PBKDF2 computation.
+ */
+#ifndef CHIP_DEVICE_CONFIG_CACHE_SETUP_PASE_VERIFIER
+#define CHIP_DEVICE_CONFIG_CACHE_SETUP_PASE_VERIFIER 0
+#endif
+
 // -------------------- WiFi Station Configuration --------------------
 
 /**
@@ -261,6 +285,26 @@
 #define CHIP_DEVICE_CONFIG_WIFI_SCAN_COMPLETION_TIMEOUT 10000
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_SIZE
+ *
+ * The number of BSSs found by recent WiFi scans that the chip platform remembers, to take the
+ * BSSID and channel of a network being provisioned from without scanning for it again.
+ */
+#ifndef CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_SIZE
+#define CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_SIZE 8
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE
+ *
+ * The amount of time (in milliseconds) after which a BSS found by a WiFi scan is no longer used
+ * as a hint for the network being provisioned.
+ */
+#ifndef CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE
+#define CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE 30000
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_WIFI_CONNECTIVITY_TIMEOUT
  *
@@ -637,6 +681,64 @@
 #define CHIP_DEVICE_CONFIG_THREAD_SRP_MAX_SERVICES 3
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_INTERVAL
+ *
+ * The lease interval (in seconds) of the services advertised using SRP without one.
+ */
+#ifndef CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_INTERVAL
+#define CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_INTERVAL 7200
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_JITTER_PERCENT
+ *
+ * The maximal share (in percent) of the SRP lease interval each device shortens it by, at random,
+ * so that devices started at the same time, as after a power restore, do not all refresh their
+ * leases at the same time.
+ */
+#ifndef CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_JITTER_PERCENT
+#define CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_JITTER_PERCENT 10
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+ *
+ * Enable support to DNS-SD service discovery through unicast DNS queries to the SRP server of the
+ * Thread network, rather than multicast across the mesh.
+ */
+#ifndef CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+#define CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT 0
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_QUERIES
+ *
+ * Amount of DNS-SD browse and resolve queries that can be pending at the same time.
+ */
+#ifndef CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_QUERIES
+#define CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_QUERIES 2
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_BROWSE_RESULTS
+ *
+ * Amount of service instances returned by a DNS-SD browse query.
+ */
+#ifndef CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_BROWSE_RESULTS
+#define CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_BROWSE_RESULTS 4
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_CACHE_SIZE
+ *
+ * Amount of resolved services kept until their records expire, so that resolving them again does
+ * not query the SRP server.
+ */
+#ifndef CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_CACHE_SIZE
+#define CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_CACHE_SIZE 4
+#endif
+
 // -------------------- Thread Configuration --------------------
 
 /**
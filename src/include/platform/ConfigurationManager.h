@@ -85,6 +85,7 @@ public:
     CHIP_ERROR GetManufacturerDevicePrivateKey(uint8_t * buf, size_t bufSize, size_t & keyLen);
     CHIP_ERROR GetSetupPinCode(uint32_t & setupPinCode);
     CHIP_ERROR GetSetupDiscriminator(uint16_t & setupDiscriminator);
+    CHIP_ERROR GetSetupPASEVerifier(uint8_t * buf, size_t bufSize, size_t & verifierLen);
     CHIP_ERROR GetServiceId(uint64_t & serviceId);
     CHIP_ERROR GetFabricId(uint64_t & fabricId);
     CHIP_ERROR GetServiceConfig(uint8_t * buf, size_t bufSize, size_t & serviceConfigLen);
@@ -114,6 +115,7 @@ public:
     CHIP_ERROR StoreManufacturerDevicePrivateKey(const uint8_t * key, size_t keyLen);
     CHIP_ERROR StoreSetupPinCode(uint32_t setupPinCode);
     CHIP_ERROR StoreSetupDiscriminator(uint16_t setupDiscriminator);
+    CHIP_ERROR StoreSetupPASEVerifier(const uint8_t * verifier, size_t verifierLen);
     CHIP_ERROR StoreServiceProvisioningData(uint64_t serviceId, const uint8_t * serviceConfig, size_t serviceConfigLen,
                                             const char * accountId, size_t accountIdLen);
     CHIP_ERROR ClearServiceProvisioningData();
@@ -147,6 +149,15 @@ public:
 
     void LogDeviceConfig();
 
+    /**
+     * Gathers the configuration writes made until the matching CommitConfigTransaction(), so that the
+     * platform can write them to its non-volatile storage together. Transactions nest: the writes are
+     * committed by the outermost one. The configuration read meanwhile includes the writes not committed yet.
+     * On platforms that write every value right away, both calls do nothing.
+     */
+    CHIP_ERROR BeginConfigTransaction();
+    CHIP_ERROR CommitConfigTransaction();
+
 private:
     // ===== Members for internal use by the following friends.
 
@@ -350,6 +361,16 @@ inline CHIP_ERROR ConfigurationManager::GetSetupDiscriminator(uint16_t & setupDi
     return static_cast<ImplClass *>(this)->_GetSetupDiscriminator(setupDiscriminator);
 }
 
+/**
+ * Read the Spake2+ verifier precomputed from the setup PIN code, so that pairing does not run PBKDF2 again.
+ *
+ * Returns CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND if none is stored.
+ */
+inline CHIP_ERROR ConfigurationManager::GetSetupPASEVerifier(uint8_t * buf, size_t bufSize, size_t & verifierLen)
+{
+    return static_cast<ImplClass *>(this)->_GetSetupPASEVerifier(buf, bufSize, verifierLen);
+}
+
 inline CHIP_ERROR ConfigurationManager::GetServiceId(uint64_t & serviceId)
 {
     return static_cast<ImplClass *>(this)->_GetServiceId(serviceId);
@@ -476,6 +497,15 @@ inline CHIP_ERROR ConfigurationManager::StoreSetupDiscriminator(uint16_t setupDi
     return static_cast<ImplClass *>(this)->_StoreSetupDiscriminator(setupDiscriminator);
 }
 
+/**
+ * Store the Spake2+ verifier of the setup PIN code, computed with the default PBKDF2 salt and iteration count.
+ * It is cleared whenever a new setup PIN code is stored.
+ */
+inline CHIP_ERROR ConfigurationManager::StoreSetupPASEVerifier(const uint8_t * verifier, size_t verifierLen)
+{
+    return static_cast<ImplClass *>(this)->_StoreSetupPASEVerifier(verifier, verifierLen);
+}
+
 inline CHIP_ERROR ConfigurationManager::StoreServiceProvisioningData(uint64_t serviceId, const uint8_t * serviceConfig,
                                                                      size_t serviceConfigLen, const char * accountId,
                                                                      size_t accountIdLen)
@@ -628,5 +658,15 @@ inline void ConfigurationManager::LogDeviceConfig()
     static_cast<ImplClass *>(this)->_LogDeviceConfig();
 }
 
+inline CHIP_ERROR ConfigurationManager::BeginConfigTransaction()
+{
+    return static_cast<ImplClass *>(this)->_BeginConfigTransaction();
+}
+
+inline CHIP_ERROR ConfigurationManager::CommitConfigTransaction()
+{
+    return static_cast<ImplClass *>(this)->_CommitConfigTransaction();
+}
+
 } // namespace DeviceLayer
 } // namespace chip
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <platform/CHIPDeviceEvent.h>
+#include <system/SystemWorkerPool.h>
 
 namespace chip {
 namespace System {
@@ -86,13 +87,23 @@ public:
     CHIP_ERROR InitChipStack();
     CHIP_ERROR AddEventHandler(EventHandlerFunct handler, intptr_t arg = 0);
     void RemoveEventHandler(EventHandlerFunct handler, intptr_t arg = 0);
-    void ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg = 0);
+    CHIP_ERROR ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg = 0);
     void RunEventLoop();
     CHIP_ERROR StartEventLoopTask();
     void LockChipStack();
     bool TryLockChipStack();
     void UnlockChipStack();
+
+    /**
+     * Lock the stack for calls that only read its state, e.g. looking up an admin or a session, that
+     * other threads holding this lock may make at the same time. The CHIP task holds the lock of
+     * LockChipStack() while processing events, so this still waits for the event being processed.
+     * On platforms without a shared lock, it is the lock of LockChipStack().
+     */
+    void LockChipStackShared();
+    void UnlockChipStackShared();
     CHIP_ERROR Shutdown();
+    System::WorkerPool & GetWorkerPool();
 
 private:
     // ===== Members for internal use by the following friends.
@@ -132,7 +143,7 @@ private:
     friend ::chip::System::Error(::chip::System::Platform::Layer::StartTimer)(::chip::System::Layer & aLayer, void * aContext,
                                                                               uint32_t aMilliseconds);
 
-    void PostEvent(const ChipDeviceEvent * event);
+    CHIP_ERROR PostEvent(const ChipDeviceEvent * event);
     void DispatchEvent(const ChipDeviceEvent * event);
     CHIP_ERROR StartChipTimer(uint32_t durationMS);
 
@@ -194,9 +205,9 @@ inline void PlatformManager::RemoveEventHandler(EventHandlerFunct handler, intpt
     static_cast<ImplClass *>(this)->_RemoveEventHandler(handler, arg);
 }
 
-inline void PlatformManager::ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg)
+inline CHIP_ERROR PlatformManager::ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg)
 {
-    static_cast<ImplClass *>(this)->_ScheduleWork(workFunct, arg);
+    return static_cast<ImplClass *>(this)->_ScheduleWork(workFunct, arg);
 }
 
 inline void PlatformManager::RunEventLoop()
@@ -224,9 +235,19 @@ inline void PlatformManager::UnlockChipStack()
     static_cast<ImplClass *>(this)->_UnlockChipStack();
 }
 
-inline void PlatformManager::PostEvent(const ChipDeviceEvent * event)
+inline void PlatformManager::LockChipStackShared()
+{
+    static_cast<ImplClass *>(this)->_LockChipStackShared();
+}
+
+inline void PlatformManager::UnlockChipStackShared()
+{
+    static_cast<ImplClass *>(this)->_UnlockChipStackShared();
+}
+
+inline CHIP_ERROR PlatformManager::PostEvent(const ChipDeviceEvent * event)
 {
-    static_cast<ImplClass *>(this)->_PostEvent(event);
+    return static_cast<ImplClass *>(this)->_PostEvent(event);
 }
 
 inline void PlatformManager::DispatchEvent(const ChipDeviceEvent * event)
@@ -244,5 +265,16 @@ inline CHIP_ERROR PlatformManager::Shutdown()
     return static_cast<ImplClass *>(this)->_Shutdown();
 }
 
+/**
+ * Returns the pool of threads that runs blocking operations off the chip task, and completes them back on it.
+ *
+ * The pool is not running if CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS is 0, or if the platform has no threads for it, in
+ * which case its users do their operations inline.
+ */
+inline System::WorkerPool & PlatformManager::GetWorkerPool()
+{
+    return static_cast<ImplClass *>(this)->_GetWorkerPool();
+}
+
 } // namespace DeviceLayer
 } // namespace chip
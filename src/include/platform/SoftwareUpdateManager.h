@@ -172,7 +172,9 @@ public:
          *  Compute an image integrity check value
          *
          *  Requests the application to compute an integrity check value over the downloaded
-         *  image. Generated once downloading is complete.
+         *  image. Generated once downloading is complete, unless the integrity type is SHA-256
+         *  and the whole image was downloaded in one go, in which case the SoftwareUpdateManager
+         *  hashes the image blocks as they are stored.
          */
         kEvent_ComputeImageIntegrity,
 
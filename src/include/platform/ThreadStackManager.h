@@ -29,6 +29,10 @@ namespace chip {
 
 namespace Mdns {
 struct TextEntry;
+struct MdnsService;
+enum class MdnsServiceProtocol : uint8_t;
+using MdnsResolveCallback = void (*)(void * context, MdnsService * result, CHIP_ERROR error);
+using MdnsBrowseCallback  = void (*)(void * context, MdnsService * services, size_t servicesSize, CHIP_ERROR error);
 }
 
 namespace DeviceLayer {
@@ -91,9 +95,17 @@ public:
                              size_t aTxtEntiresSize, uint32_t aLeaseInterval, uint32_t aKeyLeaseInterval);
     CHIP_ERROR RemoveSrpService(const char * aInstanceName, const char * aName);
     CHIP_ERROR RemoveAllSrpServices();
+    CHIP_ERROR InvalidateAllSrpServices();
+    CHIP_ERROR RemoveInvalidSrpServices();
     CHIP_ERROR SetupSrpHost(const char * aHostName);
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+    CHIP_ERROR DnsBrowse(const char * aType, chip::Mdns::MdnsServiceProtocol aProtocol, chip::Mdns::MdnsBrowseCallback aCallback,
+                         void * aContext);
+    CHIP_ERROR DnsResolve(chip::Mdns::MdnsService * aService, chip::Mdns::MdnsResolveCallback aCallback, void * aContext);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
 private:
     // ===== Members for internal use by the following friends.
 
@@ -246,12 +258,36 @@ inline CHIP_ERROR ThreadStackManager::RemoveAllSrpServices()
     return static_cast<ImplClass *>(this)->_RemoveAllSrpServices();
 }
 
+inline CHIP_ERROR ThreadStackManager::InvalidateAllSrpServices()
+{
+    return static_cast<ImplClass *>(this)->_InvalidateAllSrpServices();
+}
+
+inline CHIP_ERROR ThreadStackManager::RemoveInvalidSrpServices()
+{
+    return static_cast<ImplClass *>(this)->_RemoveInvalidSrpServices();
+}
+
 inline CHIP_ERROR ThreadStackManager::SetupSrpHost(const char * aHostName)
 {
     return static_cast<ImplClass *>(this)->_SetupSrpHost(aHostName);
 }
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+inline CHIP_ERROR ThreadStackManager::DnsBrowse(const char * aType, chip::Mdns::MdnsServiceProtocol aProtocol,
+                                                chip::Mdns::MdnsBrowseCallback aCallback, void * aContext)
+{
+    return static_cast<ImplClass *>(this)->_DnsBrowse(aType, aProtocol, aCallback, aContext);
+}
+
+inline CHIP_ERROR ThreadStackManager::DnsResolve(chip::Mdns::MdnsService * aService, chip::Mdns::MdnsResolveCallback aCallback,
+                                                 void * aContext)
+{
+    return static_cast<ImplClass *>(this)->_DnsResolve(aService, aCallback, aContext);
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
 inline bool ThreadStackManager::IsThreadProvisioned()
 {
     return static_cast<ImplClass *>(this)->_IsThreadProvisioned();
@@ -586,6 +586,13 @@ exit:
 template <class ImplClass>
 CHIP_ERROR GenericConfigurationManagerImpl<ImplClass>::_StoreSetupPinCode(uint32_t setupPinCode)
 {
+    // The stored verifier was derived from the previous PIN code.
+    CHIP_ERROR err = Impl()->ClearConfigValue(ImplClass::kConfigKey_SetupPASEVerifier);
+    if (err != CHIP_NO_ERROR && err != CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND)
+    {
+        return err;
+    }
+
     return Impl()->WriteConfigValue(ImplClass::kConfigKey_SetupPinCode, setupPinCode);
 }
 
@@ -617,6 +624,18 @@ CHIP_ERROR GenericConfigurationManagerImpl<ImplClass>::_StoreSetupDiscriminator(
     return Impl()->WriteConfigValue(ImplClass::kConfigKey_SetupDiscriminator, static_cast<uint32_t>(setupDiscriminator));
 }
 
+template <class ImplClass>
+CHIP_ERROR GenericConfigurationManagerImpl<ImplClass>::_GetSetupPASEVerifier(uint8_t * buf, size_t bufSize, size_t & verifierLen)
+{
+    return Impl()->ReadConfigValueBin(ImplClass::kConfigKey_SetupPASEVerifier, buf, bufSize, verifierLen);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericConfigurationManagerImpl<ImplClass>::_StoreSetupPASEVerifier(const uint8_t * verifier, size_t verifierLen)
+{
+    return Impl()->WriteConfigValueBin(ImplClass::kConfigKey_SetupPASEVerifier, verifier, verifierLen);
+}
+
 template <class ImplClass>
 CHIP_ERROR GenericConfigurationManagerImpl<ImplClass>::_GetFabricId(uint64_t & fabricId)
 {
@@ -754,13 +773,24 @@ CHIP_ERROR GenericConfigurationManagerImpl<ImplClass>::_StoreServiceProvisioning
 {
     CHIP_ERROR err;
 
-    err = Impl()->WriteConfigValue(ImplClass::kConfigKey_ServiceId, serviceId);
+    err = Impl()->_BeginConfigTransaction();
     SuccessOrExit(err);
 
-    err = _StoreServiceConfig(serviceConfig, serviceConfigLen);
-    SuccessOrExit(err);
+    err = Impl()->WriteConfigValue(ImplClass::kConfigKey_ServiceId, serviceId);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = _StoreServiceConfig(serviceConfig, serviceConfigLen);
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = _StorePairedAccountId(accountId, accountIdLen);
+    }
 
-    err = _StorePairedAccountId(accountId, accountIdLen);
+    // Commit whatever was written, the values are cleared below on failure.
+    {
+        CHIP_ERROR commitErr = Impl()->_CommitConfigTransaction();
+        err                  = (err == CHIP_NO_ERROR) ? commitErr : err;
+    }
     SuccessOrExit(err);
 
     mFlags.Set(Flags::kIsServiceProvisioned);
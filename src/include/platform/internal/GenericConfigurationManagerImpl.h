@@ -97,6 +97,8 @@ public:
     CHIP_ERROR _StoreSetupPinCode(uint32_t setupPinCode);
     CHIP_ERROR _GetSetupDiscriminator(uint16_t & setupDiscriminator);
     CHIP_ERROR _StoreSetupDiscriminator(uint16_t setupDiscriminator);
+    CHIP_ERROR _GetSetupPASEVerifier(uint8_t * buf, size_t bufSize, size_t & verifierLen);
+    CHIP_ERROR _StoreSetupPASEVerifier(const uint8_t * verifier, size_t verifierLen);
     CHIP_ERROR _GetFabricId(uint64_t & fabricId);
     CHIP_ERROR _StoreFabricId(uint64_t fabricId);
 #if CHIP_ENABLE_ROTATING_DEVICE_ID
@@ -136,6 +138,8 @@ public:
     void _UseManufacturerCredentialsAsOperational(bool val);
 #endif
     void _LogDeviceConfig();
+    CHIP_ERROR _BeginConfigTransaction() { return CHIP_NO_ERROR; }
+    CHIP_ERROR _CommitConfigTransaction() { return CHIP_NO_ERROR; }
 
 protected:
     enum class Flags : uint8_t
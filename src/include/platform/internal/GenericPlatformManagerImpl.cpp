@@ -73,6 +73,22 @@ CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_InitChipStack()
     }
     SuccessOrExit(err);
 
+#if CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS
+    // Start the worker threads, on the platforms that have them.
+    static_assert(CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS <= CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS,
+                  "The worker pool cannot have that many threads");
+    err = mWorkerPool.Init(&SystemLayer, CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS);
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    else if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Worker pool initialization failed: %s", ErrorStr(err));
+    }
+    SuccessOrExit(err);
+#endif // CHIP_DEVICE_CONFIG_WORKER_POOL_THREADS
+
     // Initialize the CHIP Inet layer.
     new (&InetLayer) Inet::InetLayer();
     err = InetLayer.Init(SystemLayer, nullptr);
@@ -124,6 +140,8 @@ template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_Shutdown()
 {
     CHIP_ERROR err;
+    ChipLogError(DeviceLayer, "Worker pool shutdown");
+    mWorkerPool.Shutdown();
     ChipLogError(DeviceLayer, "System Layer shutdown");
     err = SystemLayer.Shutdown();
     ChipLogError(DeviceLayer, "Inet Layer shutdown");
@@ -186,14 +204,14 @@ void GenericPlatformManagerImpl<ImplClass>::_RemoveEventHandler(PlatformManager:
 }
 
 template <class ImplClass>
-void GenericPlatformManagerImpl<ImplClass>::_ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg)
+CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg)
 {
     ChipDeviceEvent event;
     event.Type                    = DeviceEventType::kCallWorkFunct;
     event.CallWorkFunct.WorkFunct = workFunct;
     event.CallWorkFunct.Arg       = arg;
 
-    Impl()->PostEvent(&event);
+    return Impl()->PostEvent(&event);
 }
 
 template <class ImplClass>
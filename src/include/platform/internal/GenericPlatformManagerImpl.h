@@ -55,8 +55,11 @@ protected:
     CHIP_ERROR _Shutdown();
     CHIP_ERROR _AddEventHandler(PlatformManager::EventHandlerFunct handler, intptr_t arg);
     void _RemoveEventHandler(PlatformManager::EventHandlerFunct handler, intptr_t arg);
-    void _ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg);
+    CHIP_ERROR _ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg);
     void _DispatchEvent(const ChipDeviceEvent * event);
+    void _LockChipStackShared() { Impl()->LockChipStack(); }
+    void _UnlockChipStackShared() { Impl()->UnlockChipStack(); }
+    System::WorkerPool & _GetWorkerPool() { return mWorkerPool; }
 
     // ===== Support methods that can be overridden by the implementation subclass.
 
@@ -67,6 +70,7 @@ protected:
 
 private:
     bool mMsgLayerWasActive;
+    System::WorkerPool mWorkerPool;
 
     ImplClass * Impl() { return static_cast<ImplClass *>(this); }
 };
@@ -98,15 +98,17 @@ void GenericPlatformManagerImpl_FreeRTOS<ImplClass>::_UnlockChipStack(void)
 }
 
 template <class ImplClass>
-void GenericPlatformManagerImpl_FreeRTOS<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
+CHIP_ERROR GenericPlatformManagerImpl_FreeRTOS<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
 {
-    if (mChipEventQueue != NULL)
+    VerifyOrReturnError(mChipEventQueue != NULL, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!xQueueSend(mChipEventQueue, event, 1))
     {
-        if (!xQueueSend(mChipEventQueue, event, 1))
-        {
-            ChipLogError(DeviceLayer, "Failed to post event to CHIP Platform event queue");
-        }
+        ChipLogError(DeviceLayer, "Failed to post event to CHIP Platform event queue");
+        return CHIP_ERROR_NO_MEMORY;
     }
+
+    return CHIP_NO_ERROR;
 }
 
 template <class ImplClass>
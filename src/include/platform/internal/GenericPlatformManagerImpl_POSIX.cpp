@@ -65,7 +65,27 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_InitChipStack()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    mChipStackLock = PTHREAD_MUTEX_INITIALIZER;
+    if (!mChipStackLockInitialized)
+    {
+        pthread_rwlockattr_t lockAttr;
+        int lockErr;
+
+        pthread_rwlockattr_init(&lockAttr);
+#if defined(__GLIBC__)
+        // glibc lets new readers in while a writer waits by default, which would keep the CHIP task waiting
+        // for as long as the readers of other threads overlap.
+        pthread_rwlockattr_setkind_np(&lockAttr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+        lockErr = pthread_rwlock_init(&mChipStackLock, &lockAttr);
+        pthread_rwlockattr_destroy(&lockAttr);
+        VerifyOrReturnError(lockErr == 0, System::MapErrorPOSIX(lockErr));
+        mChipStackLockInitialized = true;
+    }
+
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER && CHIP_DEVICE_CONFIG_ENABLE_MDNS
+    FD_ZERO(&mMdnsFdSet);
+    mMdnsMaxFd = -1;
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER && CHIP_DEVICE_CONFIG_ENABLE_MDNS
 
     // Call up to the base class _InitChipStack() to perform the bulk of the initialization.
     err = GenericPlatformManagerImpl<ImplClass>::_InitChipStack();
@@ -80,20 +100,34 @@ exit:
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_LockChipStack()
 {
-    int err = pthread_mutex_lock(&mChipStackLock);
+    int err = pthread_rwlock_wrlock(&mChipStackLock);
     assert(err == 0);
 }
 
 template <class ImplClass>
 bool GenericPlatformManagerImpl_POSIX<ImplClass>::_TryLockChipStack()
 {
-    return pthread_mutex_trylock(&mChipStackLock) == 0;
+    return pthread_rwlock_trywrlock(&mChipStackLock) == 0;
 }
 
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_UnlockChipStack()
 {
-    int err = pthread_mutex_unlock(&mChipStackLock);
+    int err = pthread_rwlock_unlock(&mChipStackLock);
+    assert(err == 0);
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_LockChipStackShared()
+{
+    int err = pthread_rwlock_rdlock(&mChipStackLock);
+    assert(err == 0);
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_UnlockChipStackShared()
+{
+    int err = pthread_rwlock_unlock(&mChipStackLock);
     assert(err == 0);
 }
 
@@ -105,19 +139,37 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartChipTimer(int64_t
 }
 
 template <class ImplClass>
-void GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
 {
-    mChipEventQueue.push(*event); // Thread safe due to ChipStackLock taken by App thread
-    SysOnEventSignal(this);       // Trigger wake select on CHIP thread
+    if (!mChipEventQueue.Push(*event))
+    {
+        ChipLogError(DeviceLayer, "Failed to post event to CHIP Platform event queue");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    // Only the first event posted since the CHIP task started dispatching needs to wake it.
+    if (!mEventWakePending.exchange(true))
+    {
+        SysOnEventSignal(this); // Trigger wake select on CHIP thread
+    }
+
+    return CHIP_NO_ERROR;
 }
 
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.empty())
+    ChipDeviceEvent event;
+
+    // Events posted from now on wake the CHIP task again, so only the events already queued are dispatched, and handlers
+    // posting further events do not hold up the rest of the event loop.
+    mEventWakePending.exchange(false);
+    size_t count = mChipEventQueue.GetCount();
+
+    while (count > 0 && mChipEventQueue.Pop(event))
     {
-        Impl()->DispatchEvent(&mChipEventQueue.front());
-        mChipEventQueue.pop();
+        Impl()->DispatchEvent(&event);
+        count--;
     }
 }
 
@@ -127,6 +179,114 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::SysOnEventSignal(void * arg)
     SystemLayer.WakeSelect();
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::SysUpdate()
+{
+    System::EventPoller & poller = SystemLayer.GetEventPoller();
+
+    // Max out this duration and let CHIP set it appropriately.
+    mNextTimeout.tv_sec  = DEFAULT_MIN_SLEEP_PERIOD;
+    mNextTimeout.tv_usec = 0;
+
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS
+    // The mDNS backends still describe their (few, long-lived) descriptors with fd_sets; bridge them to the poller.
+    FD_ZERO(&mReadSet);
+    FD_ZERO(&mWriteSet);
+    FD_ZERO(&mErrorSet);
+    mMaxFd = 0;
+    chip::Mdns::UpdateMdnsDataset(mReadSet, mWriteSet, mErrorSet, mMaxFd, mNextTimeout);
+
+    // Descriptors the mDNS backend stopped watching may have been closed; drop them before their numbers are reused.
+    for (int fd = 0; fd <= mMdnsMaxFd; fd++)
+    {
+        const bool stillWatched = FD_ISSET(fd, &mReadSet) || FD_ISSET(fd, &mWriteSet) || FD_ISSET(fd, &mErrorSet);
+        if (FD_ISSET(fd, &mMdnsFdSet) && !stillWatched)
+        {
+            poller.Forget(fd);
+        }
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS
+
+    if (SystemLayer.State() == System::kLayerState_Initialized)
+    {
+        SystemLayer.PrepareEvents(mNextTimeout);
+    }
+
+    if (InetLayer.State == InetLayer::kState_Initialized)
+    {
+        InetLayer.PrepareEvents();
+    }
+
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS
+    FD_ZERO(&mMdnsFdSet);
+    mMdnsMaxFd = (mMaxFd < FD_SETSIZE) ? mMaxFd : FD_SETSIZE - 1;
+    for (int fd = 0; fd <= mMdnsMaxFd; fd++)
+    {
+        const uint8_t events = static_cast<uint8_t>((FD_ISSET(fd, &mReadSet) ? System::EventPoller::kRead : 0) |
+                                                    (FD_ISSET(fd, &mWriteSet) ? System::EventPoller::kWrite : 0) |
+                                                    (FD_ISSET(fd, &mErrorSet) ? System::EventPoller::kError : 0));
+        if (events != 0)
+        {
+            poller.Request(fd, events);
+            FD_SET(fd, &mMdnsFdSet);
+        }
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::SysProcess()
+{
+    System::EventPoller & poller = SystemLayer.GetEventPoller();
+    System::Error err;
+    int numReady;
+
+    _StartChipTimer(mNextTimeout.tv_sec * 1000 + mNextTimeout.tv_usec / 1000);
+
+    Impl()->UnlockChipStack();
+    err = poller.Wait(mNextTimeout, numReady);
+    Impl()->LockChipStack();
+
+    if (err != CHIP_SYSTEM_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "event poller wait failed: %s\n", ErrorStr(err));
+        return;
+    }
+
+    if (SystemLayer.State() == System::kLayerState_Initialized)
+    {
+        SystemLayer.HandleEvents();
+    }
+
+    if (InetLayer.State == InetLayer::kState_Initialized)
+    {
+        InetLayer.HandleEvents(numReady);
+    }
+
+    ProcessDeviceEvents();
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS
+    FD_ZERO(&mReadSet);
+    FD_ZERO(&mWriteSet);
+    FD_ZERO(&mErrorSet);
+    for (int fd = 0; fd <= mMdnsMaxFd; fd++)
+    {
+        const uint8_t events = FD_ISSET(fd, &mMdnsFdSet) ? poller.Pending(fd) : 0;
+
+        if (events & System::EventPoller::kRead)
+            FD_SET(fd, &mReadSet);
+        if (events & System::EventPoller::kWrite)
+            FD_SET(fd, &mWriteSet);
+        if (events & System::EventPoller::kError)
+            FD_SET(fd, &mErrorSet);
+    }
+    chip::Mdns::ProcessMdns(mReadSet, mWriteSet, mErrorSet);
+#endif
+}
+
+#else // !CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::SysUpdate()
 {
@@ -192,6 +352,8 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::SysProcess()
 #endif
 }
 
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunEventLoop()
 {
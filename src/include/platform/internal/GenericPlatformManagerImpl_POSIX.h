@@ -25,6 +25,7 @@
 #pragma once
 
 #include <platform/internal/GenericPlatformManagerImpl.h>
+#include <support/LockFreeQueue.h>
 
 #include <fcntl.h>
 #include <sched.h>
@@ -34,12 +35,16 @@
 
 #include <atomic>
 #include <pthread.h>
-#include <queue>
 
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+constexpr size_t RoundUpToPowerOfTwo(size_t n)
+{
+    return (n <= 1) ? 1 : 2 * RoundUpToPowerOfTwo((n + 1) / 2);
+}
+
 /**
  * Provides a generic implementation of PlatformManager features that works on any OSAL platform.
  *
@@ -58,10 +63,24 @@ protected:
     fd_set mWriteSet;
     fd_set mErrorSet;
     struct timeval mNextTimeout;
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER && CHIP_DEVICE_CONFIG_ENABLE_MDNS
+    // mDNS descriptors bridged to the system layer's event poller on the previous iteration.
+    fd_set mMdnsFdSet;
+    int mMdnsMaxFd;
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER && CHIP_DEVICE_CONFIG_ENABLE_MDNS
 
     // OS-specific members (pthread)
-    pthread_mutex_t mChipStackLock;
-    std::queue<ChipDeviceEvent> mChipEventQueue;
+    // Held for reading by LockChipStackShared(), and for writing by LockChipStack().
+    pthread_rwlock_t mChipStackLock;
+    // The lock is initialised by the first _InitChipStack() and kept across _Shutdown(), which may run on the CHIP task
+    // with the lock held, so that initialising the stack again does not initialise a lock that is still in use.
+    bool mChipStackLockInitialized = false;
+    // Events are posted from any thread into a lock-free queue, so that posting does not wait for the CHIP task. It holds
+    // CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE events, rounded up to a power of two; posting to a full queue fails with
+    // CHIP_ERROR_NO_MEMORY.
+    LockFreeQueue<ChipDeviceEvent, RoundUpToPowerOfTwo(CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE)> mChipEventQueue;
+    // Whether the CHIP task has been woken for events that it has not started dispatching yet.
+    std::atomic<bool> mEventWakePending{ false };
 
     pthread_t mChipTask;
     pthread_attr_t mChipTaskAttr;
@@ -74,7 +93,9 @@ protected:
     void _LockChipStack();
     bool _TryLockChipStack();
     void _UnlockChipStack();
-    void _PostEvent(const ChipDeviceEvent * event);
+    void _LockChipStackShared();
+    void _UnlockChipStackShared();
+    CHIP_ERROR _PostEvent(const ChipDeviceEvent * event);
     void _RunEventLoop();
     CHIP_ERROR _StartEventLoopTask();
     CHIP_ERROR _StartChipTimer(int64_t durationMS);
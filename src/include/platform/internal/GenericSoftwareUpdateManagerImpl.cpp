@@ -59,6 +59,7 @@ void GenericSoftwareUpdateManagerImpl<ImplClass>::DoInit()
     mShouldRetry           = false;
     mScheduledCheckEnabled = false;
     mIgnorePartialImage    = false;
+    mImageHashActive       = false;
 
     mEventHandlerCallback = NULL;
     mRetryPolicyCallback  = DefaultRetryPolicyCallback;
@@ -778,6 +779,12 @@ CHIP_ERROR GenericSoftwareUpdateManagerImpl<ImplClass>::StoreImageBlock(uint32_t
     err = outParam.StoreImageBlock.Error;
     SuccessOrExit(err);
 
+    // If the block cannot be hashed, fall back to asking the application for the integrity of the image.
+    if (mImageHashActive && mImageHash.AddData(aData, aLength) != CHIP_NO_ERROR)
+    {
+        mImageHashActive = false;
+    }
+
 exit:
     return err;
 }
@@ -822,6 +829,10 @@ void GenericSoftwareUpdateManagerImpl<ImplClass>::StartDownload(intptr_t arg)
     err = self->Impl()->StartImageDownload(self->mURI, self->mStartOffset);
     SuccessOrExit(err);
 
+    // Hash the image as it is stored, unless the download resumes a partial image whose first blocks were not hashed.
+    self->mImageHashActive = (self->mStartOffset == 0 && self->mIntegritySpec.type == kIntegrityType_SHA256 &&
+                              self->mImageHash.Begin() == CHIP_NO_ERROR);
+
     {
         DownloadStartEvent ev;
         EventOptions evOptions(true);
@@ -885,17 +896,27 @@ void GenericSoftwareUpdateManagerImpl<ImplClass>::CheckImageIntegrity(void)
 
     uint8_t computedIntegrityValue[typeLength];
 
-    inParam.ComputeImageIntegrity.IntegrityType        = mIntegritySpec.type;
-    inParam.ComputeImageIntegrity.IntegrityValueBuf    = computedIntegrityValue;
-    inParam.ComputeImageIntegrity.IntegrityValueBufLen = typeLength;
-    outParam.ComputeImageIntegrity.Error               = CHIP_NO_ERROR;
-
-    // Request the application to compute an integrity check value for the stored image.
-    // Fail if the application returns an error.
-    mEventHandlerCallback(mAppState, SoftwareUpdateManager::kEvent_ComputeImageIntegrity, inParam, outParam);
-    VerifyOrExit(mState == SoftwareUpdateManager::kState_Download, err = CHIP_DEVICE_ERROR_SOFTWARE_UPDATE_ABORTED);
-    err = outParam.ComputeImageIntegrity.Error;
-    SuccessOrExit(err);
+    if (mImageHashActive)
+    {
+        // The image was hashed as it was stored, so it does not need to be read back.
+        mImageHashActive = false;
+        err              = mImageHash.Finish(computedIntegrityValue);
+        SuccessOrExit(err);
+    }
+    else
+    {
+        inParam.ComputeImageIntegrity.IntegrityType        = mIntegritySpec.type;
+        inParam.ComputeImageIntegrity.IntegrityValueBuf    = computedIntegrityValue;
+        inParam.ComputeImageIntegrity.IntegrityValueBufLen = typeLength;
+        outParam.ComputeImageIntegrity.Error               = CHIP_NO_ERROR;
+
+        // Request the application to compute an integrity check value for the stored image.
+        // Fail if the application returns an error.
+        mEventHandlerCallback(mAppState, SoftwareUpdateManager::kEvent_ComputeImageIntegrity, inParam, outParam);
+        VerifyOrExit(mState == SoftwareUpdateManager::kState_Download, err = CHIP_DEVICE_ERROR_SOFTWARE_UPDATE_ABORTED);
+        err = outParam.ComputeImageIntegrity.Error;
+        SuccessOrExit(err);
+    }
 
     // Verify the computed integrity value matches the expected value given
     // in the SoftwareUpdate:ImageQueryResponse.
@@ -988,7 +1009,9 @@ exit:
 
 template <class ImplClass>
 void GenericSoftwareUpdateManagerImpl<ImplClass>::Cleanup(void)
-{}
+{
+    mImageHashActive = false;
+}
 
 template <class ImplClass>
 CHIP_ERROR GenericSoftwareUpdateManagerImpl<ImplClass>::_Abort(void)
@@ -28,6 +28,7 @@
 
 #include <platform/SoftwareUpdateManager.h>
 
+#include <crypto/CHIPCryptoPAL.h>
 #include <system/SystemPacketBuffer.h>
 
 namespace chip {
@@ -111,9 +112,14 @@ private:
 
     chip::System::PacketBuffer * mImageQueryPacketBuffer;
 
+    // SHA-256 of the blocks stored since a download started from offset 0, which lets
+    // CheckImageIntegrity() verify the image without reading it back from storage.
+    chip::Crypto::Hash_SHA256_stream mImageHash;
+
     bool mScheduledCheckEnabled;
     bool mShouldRetry;
     bool mIgnorePartialImage;
+    bool mImageHashActive;
 
     uint64_t mNumBytesToDownload;
     uint64_t mStartOffset;
@@ -26,6 +26,8 @@
 #include <support/CodeUtils.h>
 #include <support/logging/CHIPLogging.h>
 
+#include <algorithm>
+
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -59,6 +61,13 @@ INET_ERROR AsyncDNSResolverSockets::Init(InetLayer * aInet)
     mAsyncDNSQueueHead = nullptr;
     mAsyncDNSQueueTail = nullptr;
 
+#if INET_CONFIG_DNS_CACHE_SIZE > 0
+    for (CacheEntry & entry : mCache)
+    {
+        entry.mState = kCacheEntryState_Free;
+    }
+#endif // INET_CONFIG_DNS_CACHE_SIZE > 0
+
     pthreadErr = pthread_cond_init(&mAsyncDNSCondVar, nullptr);
     VerifyOrDie(pthreadErr == 0);
 
@@ -176,6 +185,49 @@ INET_ERROR AsyncDNSResolverSockets::EnqueueRequest(DNSResolver & resolver)
 
     AsyncMutexLock();
 
+#if INET_CONFIG_DNS_CACHE_SIZE > 0
+    if (resolver.MaxAddrs <= INET_CONFIG_MAX_DNS_ADDRS)
+    {
+        const uint64_t nowMs = System::Layer::GetClock_MonotonicMS();
+        CacheEntry * entry   = FindCacheEntry(resolver, nowMs);
+
+        if (entry != nullptr && entry->mState == kCacheEntryState_Resolved)
+        {
+            // Answer from the cache, but still from the event loop, as the callers expect.
+            std::copy(entry->mAddrs, entry->mAddrs + entry->mNumAddrs, resolver.AddrArray);
+            resolver.NumAddrs  = entry->mNumAddrs;
+            resolver.mState    = DNSResolver::kState_Complete;
+            entry->mLastUsedMs = nowMs;
+
+            AsyncMutexUnlock();
+
+            NotifyChipThread(&resolver);
+            return err;
+        }
+
+        if (entry != nullptr)
+        {
+            // Wait for the lookup in progress.
+            resolver.pNextAsyncDNSResolver = entry->mWaiters;
+            entry->mWaiters                = &resolver;
+
+            AsyncMutexUnlock();
+            return err;
+        }
+
+        // When the cache only holds lookups in progress, the request is made uncached.
+        entry = AllocateCacheEntry(nowMs);
+        if (entry != nullptr)
+        {
+            strcpy(entry->mHostName, resolver.asyncHostNameBuf);
+            entry->mDNSOptions = resolver.DNSOptions;
+            entry->mMaxAddrs   = resolver.MaxAddrs;
+            entry->mWaiters    = nullptr;
+            entry->mState      = kCacheEntryState_Pending;
+        }
+    }
+#endif // INET_CONFIG_DNS_CACHE_SIZE > 0
+
     // Add the DNSResolver object to the queue.
     if (mAsyncDNSQueueHead == nullptr)
     {
@@ -270,11 +322,132 @@ void AsyncDNSResolverSockets::UpdateDNSResult(DNSResolver & resolver, struct add
     }
 }
 
+#if INET_CONFIG_DNS_CACHE_SIZE > 0
+
+/**
+ *  Find the unexpired cache entry of the host name, options and maximum number of addresses of a request.
+ *
+ *  Must be called with the mutex held.
+ */
+AsyncDNSResolverSockets::CacheEntry * AsyncDNSResolverSockets::FindCacheEntry(const DNSResolver & resolver, uint64_t nowMs)
+{
+    for (CacheEntry & entry : mCache)
+    {
+        if (entry.mState == kCacheEntryState_Free || entry.mDNSOptions != resolver.DNSOptions ||
+            entry.mMaxAddrs != resolver.MaxAddrs || strcmp(entry.mHostName, resolver.asyncHostNameBuf) != 0)
+        {
+            continue;
+        }
+
+        if (entry.mState == kCacheEntryState_Resolved && nowMs >= entry.mExpiryMs)
+        {
+            entry.mState = kCacheEntryState_Free;
+            return nullptr;
+        }
+
+        return &entry;
+    }
+
+    return nullptr;
+}
+
+/**
+ *  Return a free or expired cache entry, or else the least recently used resolved one, or nullptr if all the entries
+ *  are being looked up.
+ *
+ *  Must be called with the mutex held.
+ */
+AsyncDNSResolverSockets::CacheEntry * AsyncDNSResolverSockets::AllocateCacheEntry(uint64_t nowMs)
+{
+    CacheEntry * oldest = nullptr;
+
+    for (CacheEntry & entry : mCache)
+    {
+        if (entry.mState == kCacheEntryState_Free || (entry.mState == kCacheEntryState_Resolved && nowMs >= entry.mExpiryMs))
+        {
+            return &entry;
+        }
+
+        if (entry.mState == kCacheEntryState_Resolved && (oldest == nullptr || entry.mLastUsedMs < oldest->mLastUsedMs))
+        {
+            oldest = &entry;
+        }
+    }
+
+    return oldest;
+}
+
+/**
+ *  Copy the result of a lookup, held by the cache entry, to the request that made it and to the requests waiting for
+ *  it, and cache the addresses if the lookup succeeded.
+ *
+ *  Must be called with the mutex held.
+ *
+ *  @return the list of the waiting requests, which must be notified too.
+ */
+DNSResolver * AsyncDNSResolverSockets::CompleteCacheEntry(CacheEntry & entry, DNSResolver & resolver, uint64_t nowMs)
+{
+    DNSResolver * const waiters = entry.mWaiters;
+
+    for (DNSResolver * request = &resolver; request != nullptr;
+         request               = (request == &resolver) ? waiters : request->pNextAsyncDNSResolver)
+    {
+        if (request->mState == DNSResolver::kState_Canceled)
+        {
+            continue;
+        }
+
+        request->asyncDNSResolveResult = resolver.asyncDNSResolveResult;
+        request->NumAddrs              = entry.mNumAddrs;
+        request->mState                = DNSResolver::kState_Complete;
+        std::copy(entry.mAddrs, entry.mAddrs + entry.mNumAddrs, request->AddrArray);
+    }
+
+    entry.mWaiters = nullptr;
+
+    if (resolver.asyncDNSResolveResult == INET_NO_ERROR)
+    {
+        entry.mState      = kCacheEntryState_Resolved;
+        entry.mExpiryMs   = nowMs + INET_CONFIG_DNS_CACHE_TTL_SEC * UINT64_C(1000);
+        entry.mLastUsedMs = nowMs;
+    }
+    else
+    {
+        entry.mState = kCacheEntryState_Free;
+    }
+
+    return waiters;
+}
+
+#endif // INET_CONFIG_DNS_CACHE_SIZE > 0
+
 void AsyncDNSResolverSockets::Resolve(DNSResolver & resolver)
 {
     struct addrinfo gaiHints;
     struct addrinfo * gaiResults = nullptr;
     int gaiReturnCode;
+    DNSResolver * waiters = nullptr;
+
+#if INET_CONFIG_DNS_CACHE_SIZE > 0
+    AsyncMutexLock();
+
+    CacheEntry * entry  = FindCacheEntry(resolver, System::Layer::GetClock_MonotonicMS());
+    const bool pending  = (entry != nullptr && entry->mState == kCacheEntryState_Pending);
+    const bool awaited  = (pending && entry->mWaiters != nullptr);
+    const bool canceled = (resolver.mState == DNSResolver::kState_Canceled);
+
+    // A canceled request is still looked up for the requests waiting for it.
+    if (canceled && pending && !awaited)
+    {
+        entry->mState = kCacheEntryState_Free;
+    }
+
+    AsyncMutexUnlock();
+
+    VerifyOrReturn(!canceled || awaited);
+#else  // INET_CONFIG_DNS_CACHE_SIZE == 0
+    VerifyOrReturn(resolver.mState != DNSResolver::kState_Canceled);
+#endif // INET_CONFIG_DNS_CACHE_SIZE > 0
 
     // Configure the hints argument for getaddrinfo()
     resolver.InitAddrInfoHints(gaiHints);
@@ -285,15 +458,43 @@ void AsyncDNSResolverSockets::Resolve(DNSResolver & resolver)
     // Mutex protects the read and write operation on resolver->mState
     AsyncMutexLock();
 
-    // Process the return code and results list returned by getaddrinfo(). If the call
-    // was successful this will copy the resultant addresses into the caller's array.
-    resolver.asyncDNSResolveResult = resolver.ProcessGetAddrInfoResult(gaiReturnCode, gaiResults);
+#if INET_CONFIG_DNS_CACHE_SIZE > 0
+    // Any lookup of the host name serves the requests waiting for it, even one made uncached.
+    const uint64_t nowMs = System::Layer::GetClock_MonotonicMS();
+    entry                = FindCacheEntry(resolver, nowMs);
 
-    // Set the DNS resolver state.
-    resolver.mState = DNSResolver::kState_Complete;
+    if (entry != nullptr && entry->mState == kCacheEntryState_Pending)
+    {
+        // Process the results into the cache entry, the caller's array of a canceled request may be gone.
+        IPAddress * const addrArray    = resolver.AddrArray;
+        resolver.AddrArray             = entry->mAddrs;
+        resolver.asyncDNSResolveResult = resolver.ProcessGetAddrInfoResult(gaiReturnCode, gaiResults);
+        resolver.AddrArray             = addrArray;
+        entry->mNumAddrs               = resolver.NumAddrs;
+
+        waiters = CompleteCacheEntry(*entry, resolver, nowMs);
+    }
+    else
+#endif // INET_CONFIG_DNS_CACHE_SIZE > 0
+    {
+        // Process the return code and results list returned by getaddrinfo(). If the call
+        // was successful this will copy the resultant addresses into the caller's array.
+        resolver.asyncDNSResolveResult = resolver.ProcessGetAddrInfoResult(gaiReturnCode, gaiResults);
+
+        // Set the DNS resolver state.
+        resolver.mState = DNSResolver::kState_Complete;
+    }
 
     // Release lock.
     AsyncMutexUnlock();
+
+    // The waiting requests are not touched by the other threads until they are notified.
+    while (waiters != nullptr)
+    {
+        DNSResolver * const next = waiters->pNextAsyncDNSResolver;
+        NotifyChipThread(waiters);
+        waiters = next;
+    }
 }
 
 /* Event handler function for asynchronous DNS notification */
@@ -334,10 +535,7 @@ void * AsyncDNSResolverSockets::AsyncDNSThreadRun(void * args)
         // In that case, break out of the loop and exit thread.
         VerifyOrExit(err == INET_NO_ERROR && request != nullptr, );
 
-        if (request->mState != DNSResolver::kState_Canceled)
-        {
-            asyncResolver->Resolve(*request);
-        }
+        asyncResolver->Resolve(*request);
 
         asyncResolver->NotifyChipThread(request);
     }
@@ -48,6 +48,10 @@ namespace Inet {
  *    Asynchronous Domain Name System (DNS) resolution in InetLayer.
  *    There is no public interface available for the application layer.
  *
+ *    It remembers the addresses of the host names resolved recently, and
+ *    makes a single lookup for the requests of a same host name, see
+ *    INET_CONFIG_DNS_CACHE_SIZE.
+ *
  */
 class AsyncDNSResolverSockets
 {
@@ -74,6 +78,37 @@ private:
     volatile DNSResolver * mAsyncDNSQueueHead; /* The head of the asynchronous DNSResolver object queue. */
     volatile DNSResolver * mAsyncDNSQueueTail; /* The tail of the asynchronous DNSResolver object queue. */
     InetLayer * mInet;                         /* The pointer to the InetLayer. */
+
+#if INET_CONFIG_DNS_CACHE_SIZE > 0
+    enum CacheEntryState : uint8_t
+    {
+        kCacheEntryState_Free,
+        kCacheEntryState_Pending,  /* Being looked up, by the request that allocated the entry. */
+        kCacheEntryState_Resolved, /* Holds the addresses until mExpiryMs. */
+    };
+
+    struct CacheEntry
+    {
+        char mHostName[NL_DNS_HOSTNAME_MAX_LEN + 1];
+        IPAddress mAddrs[INET_CONFIG_MAX_DNS_ADDRS];
+        uint64_t mExpiryMs;
+        uint64_t mLastUsedMs;
+        DNSResolver * mWaiters; /* The other requests for the lookup in progress, linked by pNextAsyncDNSResolver. */
+        uint8_t mDNSOptions;
+        uint8_t mMaxAddrs;
+        uint8_t mNumAddrs;
+        CacheEntryState mState;
+    };
+
+    CacheEntry mCache[INET_CONFIG_DNS_CACHE_SIZE]; /* Protected by mAsyncDNSMutex. */
+
+    CacheEntry * FindCacheEntry(const DNSResolver & resolver, uint64_t nowMs);
+
+    CacheEntry * AllocateCacheEntry(uint64_t nowMs);
+
+    DNSResolver * CompleteCacheEntry(CacheEntry & entry, DNSResolver & resolver, uint64_t nowMs);
+#endif // INET_CONFIG_DNS_CACHE_SIZE > 0
+
     static void
     DNSResultEventHandler(chip::System::Layer * aLayer, void * aAppState,
                           chip::System::Error aError); /* Timer event handler function for asynchronous DNS notification */
@@ -23,123 +23,317 @@
  *
  */
 
-#ifndef __STDC_LIMIT_MACROS
-#define __STDC_LIMIT_MACROS
-#endif
-#include <limits>
 #include <stdint.h>
 #include <string.h>
 
 #include <inet/InetLayer.h>
+#include <support/BufferWriter.h>
 #include <support/CodeUtils.h>
 
-#if !CHIP_SYSTEM_CONFIG_USE_LWIP
-#include <arpa/inet.h>
-#endif
-
 namespace chip {
 namespace Inet {
 
-char * IPAddress::ToString(char * buf, uint32_t bufSize) const
+// The text forms are formatted and scanned here rather than by inet_ntop()/inet_pton() or their LwIP equivalents, so that
+// every platform produces the same RFC 5952 text and neither direction needs a NUL terminated copy of its input. Both only
+// ever look at the 16 bytes of the address and at most INET6_ADDRSTRLEN characters of text.
+
+namespace {
+
+constexpr size_t kIPv6Groups          = 8;
+constexpr size_t kIPv4Bytes           = 4;
+constexpr size_t kMaxPresentationSize = 45; // "ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255"
+
+constexpr uint8_t kIPv4MappedPrefix[12] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff };
+
+void LoadBytes(const IPAddress & addr, uint8_t (&bytes)[16])
 {
-#if CHIP_SYSTEM_CONFIG_USE_LWIP
-#if INET_CONFIG_ENABLE_IPV4
-    if (IsIPv4())
+    memcpy(bytes, addr.Addr, sizeof(bytes));
+}
+
+void StoreBytes(const uint8_t (&bytes)[16], IPAddress & addr)
+{
+    memcpy(addr.Addr, bytes, sizeof(bytes));
+}
+
+bool IsIPv4Mapped(const uint8_t (&bytes)[16])
+{
+    return memcmp(bytes, kIPv4MappedPrefix, sizeof(kIPv4MappedPrefix)) == 0;
+}
+
+void PutDecimal(Encoding::BufferWriter & writer, uint8_t value)
+{
+    if (value >= 100)
     {
-#if LWIP_VERSION_MAJOR > 1 || LWIP_VERSION_MINOR >= 5
-        ip4_addr_t ip4_addr = ToIPv4();
-        ip4addr_ntoa_r(&ip4_addr, buf, (int) bufSize);
-#else  // LWIP_VERSION_MAJOR <= 1
-        ip_addr_t ip4_addr = ToIPv4();
-        ipaddr_ntoa_r(&ip4_addr, buf, (int) bufSize);
-#endif // LWIP_VERSION_MAJOR <= 1
+        writer.Put(static_cast<uint8_t>('0' + value / 100));
     }
-    else
-#endif // INET_CONFIG_ENABLE_IPV4
+    if (value >= 10)
     {
-        ip6_addr_t ip6_addr = ToIPv6();
-        ip6addr_ntoa_r(&ip6_addr, buf, (int) bufSize);
+        writer.Put(static_cast<uint8_t>('0' + (value / 10) % 10));
     }
-#else // !CHIP_SYSTEM_CONFIG_USE_LWIP
-    // socklen_t is sometimes signed, sometimes not, so the only safe way to do
-    // this is to promote everything to an unsigned type that's known to be big
-    // enough for everything, then cast back to uint32_t after taking the min.
-    bufSize =
-        static_cast<uint32_t>(min(static_cast<uintmax_t>(std::numeric_limits<socklen_t>::max()), static_cast<uintmax_t>(bufSize)));
-#if INET_CONFIG_ENABLE_IPV4
-    if (IsIPv4())
+    writer.Put(static_cast<uint8_t>('0' + value % 10));
+}
+
+void PutHexGroup(Encoding::BufferWriter & writer, uint16_t value)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+    bool leading                   = true;
+
+    for (int shift = 12; shift >= 0; shift -= 4)
+    {
+        const uint8_t nibble = static_cast<uint8_t>((value >> shift) & 0xf);
+        if (leading && nibble == 0 && shift != 0)
+        {
+            continue;
+        }
+        leading = false;
+        writer.Put(static_cast<uint8_t>(kHexDigits[nibble]));
+    }
+}
+
+void PutIPv4(Encoding::BufferWriter & writer, const uint8_t * bytes)
+{
+    for (size_t i = 0; i < kIPv4Bytes; i++)
+    {
+        if (i != 0)
+        {
+            writer.Put('.');
+        }
+        PutDecimal(writer, bytes[i]);
+    }
+}
+
+void PutIPv6(Encoding::BufferWriter & writer, const uint8_t (&bytes)[16])
+{
+    uint16_t groups[kIPv6Groups];
+    // An address mapping an IPv4 one keeps its last 32 bits in dotted form.
+    const size_t hexGroups = IsIPv4Mapped(bytes) ? kIPv6Groups - 2 : kIPv6Groups;
+    size_t bestStart       = kIPv6Groups;
+    size_t bestLength      = 1;
+
+    for (size_t i = 0; i < kIPv6Groups; i++)
+    {
+        groups[i] = static_cast<uint16_t>((bytes[2 * i] << 8) | bytes[2 * i + 1]);
+    }
+
+    // RFC 5952 section 4.2: the longest run of two or more zero groups, the first of those of equal length, becomes "::".
+    for (size_t i = 0; i < hexGroups;)
+    {
+        size_t length = 0;
+        while (i + length < hexGroups && groups[i + length] == 0)
+        {
+            length++;
+        }
+        if (length > bestLength)
+        {
+            bestStart  = i;
+            bestLength = length;
+        }
+        i += (length > 0) ? length : 1;
+    }
+
+    for (size_t i = 0; i < hexGroups; i++)
+    {
+        if (i == bestStart)
+        {
+            writer.Put("::");
+            i += bestLength - 1;
+            continue;
+        }
+        if (i != 0 && i != bestStart + bestLength)
+        {
+            writer.Put(':');
+        }
+        PutHexGroup(writer, groups[i]);
+    }
+
+    if (hexGroups != kIPv6Groups)
+    {
+        if (bestStart + bestLength != hexGroups)
+        {
+            writer.Put(':');
+        }
+        PutIPv4(writer, &bytes[12]);
+    }
+}
+
+int HexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
     {
-        const void * addr = &Addr[3];
-        const char * s    = inet_ntop(AF_INET, addr, buf, static_cast<socklen_t>(bufSize));
-        // This cast is safe because |s| points into |buf| which is not const.
-        buf = const_cast<char *>(s);
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// Scan exactly a dotted quad, without leading zeros, as inet_pton() does.
+bool ScanIPv4(const char * str, size_t strLen, uint8_t * bytes)
+{
+    size_t pos = 0;
+
+    for (size_t i = 0; i < kIPv4Bytes; i++)
+    {
+        unsigned value = 0;
+        size_t digits  = 0;
+
+        if (i != 0)
+        {
+            VerifyOrReturnError(pos < strLen && str[pos] == '.', false);
+            pos++;
+        }
+
+        while (pos < strLen && str[pos] >= '0' && str[pos] <= '9' && digits < 3)
+        {
+            VerifyOrReturnError(digits == 0 || value != 0, false);
+            value = value * 10 + static_cast<unsigned>(str[pos] - '0');
+            digits++;
+            pos++;
+        }
+        VerifyOrReturnError(digits > 0 && value <= UINT8_MAX, false);
+        bytes[i] = static_cast<uint8_t>(value);
+    }
+
+    return pos == strLen;
+}
+
+bool ScanIPv6(const char * str, size_t strLen, uint8_t (&bytes)[16])
+{
+    size_t pos        = 0;
+    size_t written    = 0;
+    size_t compressAt = sizeof(bytes) + 1; // none yet
+
+    memset(bytes, 0, sizeof(bytes));
+
+    if (strLen >= 2 && str[0] == ':' && str[1] == ':')
+    {
+        compressAt = 0;
+        pos        = 2;
     }
     else
-#endif // INET_CONFIG_ENABLE_IPV4
     {
-        const void * addr = &Addr[0];
-        const char * s    = inet_ntop(AF_INET6, addr, buf, static_cast<socklen_t>(bufSize));
-        // This cast is safe because |s| points into |buf| which is not const.
-        buf = const_cast<char *>(s);
+        VerifyOrReturnError(strLen > 0 && str[0] != ':', false);
     }
-#endif // !CHIP_SYSTEM_CONFIG_USE_LWIP
 
-    return buf;
+    while (pos < strLen)
+    {
+        const size_t groupStart = pos;
+        unsigned value          = 0;
+        int digit;
+
+        while (pos < strLen && pos - groupStart < 4 && (digit = HexValue(str[pos])) >= 0)
+        {
+            value = (value << 4) | static_cast<unsigned>(digit);
+            pos++;
+        }
+
+        if (pos < strLen && str[pos] == '.')
+        {
+            // A trailing dotted quad fills the last 32 bits.
+            VerifyOrReturnError(written + kIPv4Bytes <= sizeof(bytes), false);
+            VerifyOrReturnError(ScanIPv4(&str[groupStart], strLen - groupStart, &bytes[written]), false);
+            written += kIPv4Bytes;
+            pos = strLen;
+            break;
+        }
+
+        VerifyOrReturnError(pos > groupStart && written + 2 <= sizeof(bytes), false);
+        bytes[written++] = static_cast<uint8_t>(value >> 8);
+        bytes[written++] = static_cast<uint8_t>(value);
+
+        if (pos == strLen)
+        {
+            break;
+        }
+        VerifyOrReturnError(str[pos] == ':', false);
+        pos++;
+
+        if (pos < strLen && str[pos] == ':')
+        {
+            VerifyOrReturnError(compressAt > sizeof(bytes), false);
+            compressAt = written;
+            pos++;
+        }
+        else
+        {
+            VerifyOrReturnError(pos < strLen, false);
+        }
+    }
+
+    if (compressAt > sizeof(bytes))
+    {
+        return written == sizeof(bytes);
+    }
+
+    // "::" stands for at least one zero group.
+    VerifyOrReturnError(written + 2 <= sizeof(bytes), false);
+    const size_t tail = written - compressAt;
+    memmove(&bytes[sizeof(bytes) - tail], &bytes[compressAt], tail);
+    memset(&bytes[compressAt], 0, sizeof(bytes) - tail - compressAt);
+    return true;
 }
 
-bool IPAddress::FromString(const char * str, IPAddress & output)
+} // namespace
+
+char * IPAddress::ToString(char * buf, uint32_t bufSize) const
 {
+    uint8_t bytes[16];
+
+    VerifyOrReturnError(buf != nullptr && bufSize > 0, nullptr);
+
+    // One byte is kept back for the NUL termination.
+    Encoding::BufferWriter writer(reinterpret_cast<uint8_t *>(buf), bufSize - 1);
+    size_t written;
+
+    LoadBytes(*this, bytes);
 #if INET_CONFIG_ENABLE_IPV4
-    if (strchr(str, ':') == nullptr)
-    {
-#if CHIP_SYSTEM_CONFIG_USE_LWIP
-#if LWIP_VERSION_MAJOR > 1 || LWIP_VERSION_MINOR >= 5
-        ip4_addr_t ipv4Addr;
-        if (!ip4addr_aton(str, &ipv4Addr))
-            return false;
-#else  // LWIP_VERSION_MAJOR <= 1
-        ip_addr_t ipv4Addr;
-        if (!ipaddr_aton(str, &ipv4Addr))
-            return false;
-#endif // LWIP_VERSION_MAJOR <= 1
-#else  // !CHIP_SYSTEM_CONFIG_USE_LWIP
-        struct in_addr ipv4Addr;
-        if (inet_pton(AF_INET, str, &ipv4Addr) < 1)
-            return false;
-#endif // !CHIP_SYSTEM_CONFIG_USE_LWIP
-        output = FromIPv4(ipv4Addr);
+    if (IsIPv4())
+    {
+        PutIPv4(writer, &bytes[12]);
     }
     else
 #endif // INET_CONFIG_ENABLE_IPV4
     {
-#if CHIP_SYSTEM_CONFIG_USE_LWIP
-        ip6_addr_t ipv6Addr;
-        if (!ip6addr_aton(str, &ipv6Addr))
-            return false;
-#else  // !CHIP_SYSTEM_CONFIG_USE_LWIP
-        struct in6_addr ipv6Addr;
-        if (inet_pton(AF_INET6, str, &ipv6Addr) < 1)
-            return false;
-#endif // !CHIP_SYSTEM_CONFIG_USE_LWIP
-        output = FromIPv6(ipv6Addr);
+        PutIPv6(writer, bytes);
     }
 
-    return true;
+    const bool fit = writer.Fit(written);
+    buf[written]   = '\0';
+    return fit ? buf : nullptr;
+}
+
+bool IPAddress::FromString(const char * str, IPAddress & output)
+{
+    VerifyOrReturnError(str != nullptr, false);
+    return FromString(str, strnlen(str, kMaxPresentationSize + 1), output);
 }
 
 bool IPAddress::FromString(const char * str, size_t strLen, IPAddress & output)
 {
-    bool res = false;
+    uint8_t bytes[16];
+
+    VerifyOrReturnError(str != nullptr && strLen <= kMaxPresentationSize, false);
 
-    if (strLen < INET6_ADDRSTRLEN)
+#if INET_CONFIG_ENABLE_IPV4
+    if (memchr(str, ':', strLen) == nullptr)
+    {
+        VerifyOrReturnError(ScanIPv4(str, strLen, &bytes[12]), false);
+        memcpy(bytes, kIPv4MappedPrefix, sizeof(kIPv4MappedPrefix));
+    }
+    else
+#endif // INET_CONFIG_ENABLE_IPV4
     {
-        char hostNameBuf[INET6_ADDRSTRLEN];
-        memcpy(hostNameBuf, str, strLen);
-        hostNameBuf[strLen] = 0;
-        res                 = IPAddress::FromString(hostNameBuf, output);
+        VerifyOrReturnError(ScanIPv6(str, strLen, bytes), false);
     }
 
-    return res;
+    StoreBytes(bytes, output);
+    return true;
 }
 
 } // namespace Inet
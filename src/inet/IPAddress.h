@@ -330,10 +330,11 @@ public:
      *  located at \c buf and extending as much as \c bufSize bytes, including
      *  its NUL termination character.
      *
-     *  Note Well: not compliant with RFC 5952 on some platforms. Specifically,
-     *  zero compression may not be applied according to section 4.2.
+     *  The text is the RFC 5952 canonical form on every platform, with an
+     *  IPv4-mapped IPv6 address keeping its last 32 bits in dotted form.
      *
      * @return  The argument \c buf if no formatting error, or zero otherwise.
+     *          When \c buf is too small it still holds the truncated text.
      */
     char * ToString(char * buf, uint32_t bufSize) const;
 
@@ -373,7 +374,7 @@ public:
      * @details
      *  Use <tt>FromString(const char *str, size_t strLen, IPAddress& output)</tt> to
      *  overwrite an IP address by scanning the conventional text presentation
-     *  located at \c str.
+     *  located at \c str. The text does not need to be NUL terminated.
      *
      * @retval true  The presentation format is valid
      * @retval false Otherwise
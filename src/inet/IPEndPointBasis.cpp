@@ -106,11 +106,19 @@ union PeerSockAddr
     sockaddr_in in;
     sockaddr_in6 in6;
 };
+
+// recvmmsg() and sendmmsg() come with MSG_WAITFORONE.
+#if INET_CONFIG_UDP_BATCH_SIZE > 1 && defined(MSG_WAITFORONE)
+#define HAVE_UDP_BATCH_IO 1
+#else
+#define HAVE_UDP_BATCH_IO 0
+#endif // INET_CONFIG_UDP_BATCH_SIZE > 1 && defined(MSG_WAITFORONE)
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 IPEndPointBasis::JoinMulticastGroupHandler IPEndPointBasis::sJoinMulticastGroupHandler;
 IPEndPointBasis::LeaveMulticastGroupHandler IPEndPointBasis::sLeaveMulticastGroupHandler;
+MulticastGroupTable<INET_CONFIG_MAX_PLATFORM_MULTICAST_GROUPS> IPEndPointBasis::sPlatformMulticastGroups;
 #endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
@@ -355,6 +363,37 @@ static INET_ERROR SocketsIPv6LeaveMulticastGroup(int aSocket, InterfaceId aInter
 #endif
 }
 
+/*
+ * Where the kernel supports it, have it deliver to the socket only the
+ * traffic of the groups the socket joined, rather than that of any group
+ * joined on the host, for the packets of the other groups to be dropped
+ * before they reach the end point.  Kernels without the option deliver
+ * them as before.
+ */
+static void SocketsFilterMulticastGroups(int aSocket, IPAddressType aAddressType)
+{
+    const int lMulticastAll = 0;
+
+    switch (aAddressType)
+    {
+#if INET_CONFIG_ENABLE_IPV4 && defined(IP_MULTICAST_ALL)
+    case kIPAddressType_IPv4:
+        setsockopt(aSocket, IPPROTO_IP, IP_MULTICAST_ALL, &lMulticastAll, sizeof(lMulticastAll));
+        break;
+#endif // INET_CONFIG_ENABLE_IPV4 && defined(IP_MULTICAST_ALL)
+
+#if defined(IPV6_MULTICAST_ALL)
+    case kIPAddressType_IPv6:
+        setsockopt(aSocket, IPPROTO_IPV6, IPV6_MULTICAST_ALL, &lMulticastAll, sizeof(lMulticastAll));
+        break;
+#endif // defined(IPV6_MULTICAST_ALL)
+
+    default:
+        (void) lMulticastAll;
+        break;
+    }
+}
+
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 /**
@@ -470,6 +509,37 @@ exit:
  *
  */
 INET_ERROR IPEndPointBasis::JoinMulticastGroup(InterfaceId aInterfaceId, const IPAddress & aAddress)
+{
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    INET_ERROR lRetval = CheckMulticastGroupArgs(aInterfaceId, aAddress);
+    bool lIsFirst      = false;
+    bool lIsLast       = false;
+    SuccessOrExit(lRetval);
+
+    // A group the socket already joined on the interface is not joined again
+    lRetval = mMulticastGroups.Join(aInterfaceId, aAddress, lIsFirst);
+    SuccessOrExit(lRetval);
+    VerifyOrExit(lIsFirst, lRetval = INET_NO_ERROR);
+
+    if (mMulticastGroups.GetCount() == 1)
+    {
+        SocketsFilterMulticastGroups(mSocket, aAddress.Type());
+    }
+
+    lRetval = JoinMulticastGroupImpl(aInterfaceId, aAddress);
+    if (lRetval != INET_NO_ERROR)
+    {
+        mMulticastGroups.Leave(aInterfaceId, aAddress, lIsLast);
+    }
+
+exit:
+    return (lRetval);
+#else  // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    return JoinMulticastGroupImpl(aInterfaceId, aAddress);
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+}
+
+INET_ERROR IPEndPointBasis::JoinMulticastGroupImpl(InterfaceId aInterfaceId, const IPAddress & aAddress)
 {
     INET_ERROR lRetval = INET_ERROR_NOT_IMPLEMENTED;
 
@@ -504,7 +574,20 @@ INET_ERROR IPEndPointBasis::JoinMulticastGroup(InterfaceId aInterfaceId, const I
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
         if (sJoinMulticastGroupHandler != nullptr)
         {
-            return sJoinMulticastGroupHandler(aInterfaceId, aAddress);
+            bool lIsFirst = false;
+            bool lIsLast  = false;
+
+            // The platform only joins a group joined by several end points once
+            lRetval = sPlatformMulticastGroups.Join(aInterfaceId, aAddress, lIsFirst);
+            SuccessOrExit(lRetval);
+            VerifyOrExit(lIsFirst, lRetval = INET_NO_ERROR);
+
+            lRetval = sJoinMulticastGroupHandler(aInterfaceId, aAddress);
+            if (lRetval != INET_NO_ERROR)
+            {
+                sPlatformMulticastGroups.Leave(aInterfaceId, aAddress, lIsLast);
+            }
+            ExitNow();
         }
 #endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 
@@ -562,6 +645,27 @@ exit:
  *
  */
 INET_ERROR IPEndPointBasis::LeaveMulticastGroup(InterfaceId aInterfaceId, const IPAddress & aAddress)
+{
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    INET_ERROR lRetval = CheckMulticastGroupArgs(aInterfaceId, aAddress);
+    bool lIsLast       = false;
+    SuccessOrExit(lRetval);
+
+    // The socket stays joined to the group until it is left as many times as it was joined
+    lRetval = mMulticastGroups.Leave(aInterfaceId, aAddress, lIsLast);
+    SuccessOrExit(lRetval);
+    VerifyOrExit(lIsLast, lRetval = INET_NO_ERROR);
+
+    lRetval = LeaveMulticastGroupImpl(aInterfaceId, aAddress);
+
+exit:
+    return (lRetval);
+#else  // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    return LeaveMulticastGroupImpl(aInterfaceId, aAddress);
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+}
+
+INET_ERROR IPEndPointBasis::LeaveMulticastGroupImpl(InterfaceId aInterfaceId, const IPAddress & aAddress)
 {
     INET_ERROR lRetval = INET_ERROR_NOT_IMPLEMENTED;
 
@@ -596,7 +700,14 @@ INET_ERROR IPEndPointBasis::LeaveMulticastGroup(InterfaceId aInterfaceId, const
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
         if (sLeaveMulticastGroupHandler != nullptr)
         {
-            return sLeaveMulticastGroupHandler(aInterfaceId, aAddress);
+            bool lIsLast = false;
+
+            lRetval = sPlatformMulticastGroups.Leave(aInterfaceId, aAddress, lIsLast);
+            SuccessOrExit(lRetval);
+            VerifyOrExit(lIsLast, lRetval = INET_NO_ERROR);
+
+            lRetval = sLeaveMulticastGroupHandler(aInterfaceId, aAddress);
+            ExitNow();
         }
 #endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 
@@ -632,9 +743,34 @@ void IPEndPointBasis::Init(InetLayer * aInetLayer)
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     mBoundIntfId = INET_NULL_INTERFACEID;
+    mMulticastGroups.Clear();
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+/*
+ * Forget the groups of the end point, whose socket is closed.  Closing the
+ * socket leaves its groups, but not those joined through the platform, which
+ * are left once no other end point is joined to them.
+ */
+void IPEndPointBasis::ReleaseMulticastGroups()
+{
+#if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
+    mMulticastGroups.ForEach([](InterfaceId aInterfaceId, const IPAddress & aAddress) {
+        bool lIsLast = false;
+
+        if (aAddress.IsIPv6() && sLeaveMulticastGroupHandler != nullptr &&
+            sPlatformMulticastGroups.Leave(aInterfaceId, aAddress, lIsLast) == INET_NO_ERROR && lIsLast)
+        {
+            sLeaveMulticastGroupHandler(aInterfaceId, aAddress);
+        }
+    });
+#endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
+
+    mMulticastGroups.Clear();
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 void IPEndPointBasis::HandleDataReceived(System::PacketBufferHandle aBuffer)
 {
@@ -834,32 +970,56 @@ INET_ERROR IPEndPointBasis::BindInterface(IPAddressType aAddressType, InterfaceI
     return (lRetval);
 }
 
-INET_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle aBuffer, uint16_t aSendFlags)
+namespace {
+
+// Storage for the header of one outgoing datagram, which refers to the other fields.
+struct SendMsgStorage
 {
-    INET_ERROR res = INET_NO_ERROR;
     PeerSockAddr peerSockAddr;
-    struct iovec msgIOV;
+    struct iovec msgIOV[INET_CONFIG_MAX_SEND_IOV];
     uint8_t controlData[256];
     struct msghdr msgHeader;
-    InterfaceId intfId = aPktInfo->Interface;
+    size_t msgLength;
+};
 
-    // Ensure the destination address type is compatible with the endpoint address type.
-    VerifyOrExit(mAddrType == aPktInfo->DestAddress.Type(), res = INET_ERROR_BAD_ARGS);
+INET_ERROR BuildSendMsg(IPAddressType aAddrType, InterfaceId aBoundIntfId, const IPPacketInfo * aPktInfo,
+                        const chip::System::PacketBufferHandle & aBuffer, SendMsgStorage & aStorage)
+{
+    INET_ERROR res              = INET_NO_ERROR;
+    PeerSockAddr & peerSockAddr = aStorage.peerSockAddr;
+    struct msghdr & msgHeader   = aStorage.msgHeader;
+    uint8_t * const controlData = aStorage.controlData;
+    size_t msgIOVCount          = 0;
+    InterfaceId intfId          = aPktInfo->Interface;
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrExit(!aBuffer->HasChainedBuffer(), res = INET_ERROR_MESSAGE_TOO_LONG);
+    // Ensure the destination address type is compatible with the endpoint address type.
+    VerifyOrExit(aAddrType == aPktInfo->DestAddress.Type(), res = INET_ERROR_BAD_ARGS);
 
     memset(&msgHeader, 0, sizeof(msgHeader));
+    aStorage.msgLength = 0;
 
-    msgIOV.iov_base      = aBuffer->Start();
-    msgIOV.iov_len       = aBuffer->DataLength();
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    // Gather the buffers of the chain into a single datagram.
+    for (chip::System::PacketBufferHandle buffer = aBuffer.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        if (buffer->DataLength() == 0)
+        {
+            continue;
+        }
+
+        VerifyOrExit(msgIOVCount < INET_CONFIG_MAX_SEND_IOV, res = INET_ERROR_MESSAGE_TOO_LONG);
+        aStorage.msgIOV[msgIOVCount].iov_base = buffer->Start();
+        aStorage.msgIOV[msgIOVCount].iov_len  = buffer->DataLength();
+        aStorage.msgLength += buffer->DataLength();
+        msgIOVCount++;
+    }
+
+    msgHeader.msg_iov    = aStorage.msgIOV;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(msgIOVCount);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == kIPAddressType_IPv6)
+    if (aAddrType == kIPAddressType_IPv6)
     {
         peerSockAddr.in6.sin6_family = AF_INET6;
         peerSockAddr.in6.sin6_port   = htons(aPktInfo->DestPort);
@@ -885,7 +1045,7 @@ INET_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     // don't seem to get sent out the correct interface, despite
     // the socket being bound.
     if (intfId == INET_NULL_INTERFACEID)
-        intfId = mBoundIntfId;
+        intfId = aBoundIntfId;
 
     // If the packet should be sent over a specific interface, or with a specific source
     // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
@@ -894,15 +1054,15 @@ INET_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     if (intfId != INET_NULL_INTERFACEID || aPktInfo->SrcAddress.Type() != kIPAddressType_Any)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        memset(controlData, 0, sizeof(controlData));
+        memset(controlData, 0, sizeof(aStorage.controlData));
         msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_controllen = sizeof(aStorage.controlData);
 
         struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader);
 
 #if INET_CONFIG_ENABLE_IPV4
 
-        if (mAddrType == kIPAddressType_IPv4)
+        if (aAddrType == kIPAddressType_IPv4)
         {
 #if defined(IP_PKTINFO)
             controlHdr->cmsg_level = IPPROTO_IP;
@@ -926,7 +1086,7 @@ INET_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
 
 #endif // INET_CONFIG_ENABLE_IPV4
 
-        if (mAddrType == kIPAddressType_IPv6)
+        if (aAddrType == kIPAddressType_IPv6)
         {
 #if defined(IPV6_PKTINFO)
             controlHdr->cmsg_level = IPPROTO_IPV6;
@@ -953,17 +1113,90 @@ INET_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
 #endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
     }
 
+exit:
+    return (res);
+}
+
+} // namespace
+
+INET_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle aBuffer, uint16_t aSendFlags)
+{
+    SendMsgStorage storage;
+
+    ReturnErrorOnFailure(BuildSendMsg(mAddrType, mBoundIntfId, aPktInfo, aBuffer, storage));
+
     // Send IP packet.
+    const ssize_t lenSent = sendmsg(mSocket, &storage.msgHeader, 0);
+    if (lenSent == -1)
+        return chip::System::MapErrorPOSIX(errno);
+    if (static_cast<size_t>(lenSent) != storage.msgLength)
+        return INET_ERROR_OUTBOUND_MESSAGE_TRUNCATED;
+
+    return INET_NO_ERROR;
+}
+
+INET_ERROR IPEndPointBasis::SendMsgs(const IPPacketInfo * aPktInfos, const chip::System::PacketBufferHandle * aBuffers,
+                                     size_t aCount, size_t & aSentCount)
+{
+    aSentCount = 0;
+
+#if HAVE_UDP_BATCH_IO
+    while (aSentCount < aCount)
+    {
+        SendMsgStorage storage[INET_CONFIG_UDP_BATCH_SIZE];
+        struct mmsghdr msgs[INET_CONFIG_UDP_BATCH_SIZE];
+        INET_ERROR res     = INET_NO_ERROR;
+        unsigned int count = 0;
+
+        // Stop the batch at the first message that cannot be sent, after sending the ones before it.
+        while (count < INET_CONFIG_UDP_BATCH_SIZE && aSentCount + count < aCount)
+        {
+            const size_t next = aSentCount + count;
+
+            res = BuildSendMsg(mAddrType, mBoundIntfId, &aPktInfos[next], aBuffers[next], storage[count]);
+            if (res != INET_NO_ERROR)
+            {
+                break;
+            }
+            msgs[count].msg_hdr = storage[count].msgHeader;
+            msgs[count].msg_len = 0;
+            count++;
+        }
+
+        if (count > 0)
+        {
+            const int numSent = sendmmsg(mSocket, msgs, count, 0);
+            if (numSent <= 0)
+            {
+                return chip::System::MapErrorPOSIX((numSent == 0) ? EAGAIN : errno);
+            }
+
+            for (int i = 0; i < numSent; i++)
+            {
+                if (msgs[i].msg_len != storage[i].msgLength)
+                {
+                    return INET_ERROR_OUTBOUND_MESSAGE_TRUNCATED;
+                }
+                aSentCount++;
+            }
+
+            // sendmmsg() stops at the first message it fails to send, and reports the error on the next call.
+            if (static_cast<unsigned int>(numSent) < count)
+            {
+                continue;
+            }
+        }
+
+        ReturnErrorOnFailure(res);
+    }
+#else  // !HAVE_UDP_BATCH_IO
+    for (; aSentCount < aCount; aSentCount++)
     {
-        const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
-        if (lenSent == -1)
-            res = chip::System::MapErrorPOSIX(errno);
-        else if (lenSent != aBuffer->DataLength())
-            res = INET_ERROR_OUTBOUND_MESSAGE_TRUNCATED;
+        ReturnErrorOnFailure(SendMsg(&aPktInfos[aSentCount], aBuffers[aSentCount].Retain(), 0));
     }
+#endif // !HAVE_UDP_BATCH_IO
 
-exit:
-    return (res);
+    return INET_NO_ERROR;
 }
 
 INET_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int aProtocol)
@@ -1078,8 +1311,106 @@ INET_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int
     return INET_NO_ERROR;
 }
 
+namespace {
+
+// Storage for the header of one incoming datagram, which refers to these fields.
+struct ReceiveMsgStorage
+{
+    PeerSockAddr peerSockAddr;
+    struct iovec msgIOV;
+    uint8_t controlData[256];
+};
+
+void PrepareReceiveMsg(const System::PacketBufferHandle & aBuffer, ReceiveMsgStorage & aStorage, struct msghdr & aMsgHeader)
+{
+    aStorage.msgIOV.iov_base = aBuffer->Start();
+    aStorage.msgIOV.iov_len  = aBuffer->AvailableDataLength();
+
+    memset(&aStorage.peerSockAddr, 0, sizeof(aStorage.peerSockAddr));
+
+    memset(&aMsgHeader, 0, sizeof(aMsgHeader));
+
+    aMsgHeader.msg_name       = &aStorage.peerSockAddr;
+    aMsgHeader.msg_namelen    = sizeof(aStorage.peerSockAddr);
+    aMsgHeader.msg_iov        = &aStorage.msgIOV;
+    aMsgHeader.msg_iovlen     = 1;
+    aMsgHeader.msg_control    = aStorage.controlData;
+    aMsgHeader.msg_controllen = sizeof(aStorage.controlData);
+}
+
+INET_ERROR ParseReceivedMsg(struct msghdr & aMsgHeader, const ReceiveMsgStorage & aStorage, size_t aRcvLen,
+                            System::PacketBufferHandle & aBuffer, IPPacketInfo & aPacketInfo)
+{
+    const PeerSockAddr & lPeerSockAddr = aStorage.peerSockAddr;
+
+    if (aRcvLen > aBuffer->AvailableDataLength())
+    {
+        return INET_ERROR_INBOUND_MESSAGE_TOO_BIG;
+    }
+
+    aBuffer->SetDataLength(static_cast<uint16_t>(aRcvLen));
+
+    if (lPeerSockAddr.any.sa_family == AF_INET6)
+    {
+        aPacketInfo.SrcAddress = IPAddress::FromIPv6(lPeerSockAddr.in6.sin6_addr);
+        aPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (lPeerSockAddr.any.sa_family == AF_INET)
+    {
+        aPacketInfo.SrcAddress = IPAddress::FromIPv4(lPeerSockAddr.in.sin_addr);
+        aPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return INET_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&aMsgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&aMsgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex))
+            {
+                return INET_ERROR_INCORRECT_STATE;
+            }
+            aPacketInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
+            aPacketInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex))
+            {
+                return INET_ERROR_INCORRECT_STATE;
+            }
+            aPacketInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
+            aPacketInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return INET_NO_ERROR;
+}
+
+} // namespace
+
 void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
 {
+#if HAVE_UDP_BATCH_IO
+    HandlePendingIOBatch(aPort);
+#else  // !HAVE_UDP_BATCH_IO
     INET_ERROR lStatus = INET_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -1091,24 +1422,10 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
 
     if (!lBuffer.IsNull())
     {
-        struct iovec msgIOV;
-        PeerSockAddr lPeerSockAddr;
-        uint8_t controlData[256];
+        ReceiveMsgStorage lStorage;
         struct msghdr msgHeader;
 
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
-
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
-
-        memset(&msgHeader, 0, sizeof(msgHeader));
-
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
-        msgHeader.msg_iov        = &msgIOV;
-        msgHeader.msg_iovlen     = 1;
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        PrepareReceiveMsg(lBuffer, lStorage, msgHeader);
 
         ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
 
@@ -1116,69 +1433,9 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
         {
             lStatus = chip::System::MapErrorPOSIX(errno);
         }
-        else if (rcvLen > lBuffer->AvailableDataLength())
-        {
-            lStatus = INET_ERROR_INBOUND_MESSAGE_TOO_BIG;
-        }
         else
         {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv6(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv4(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = INET_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == INET_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = INET_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = INET_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ParseReceivedMsg(msgHeader, lStorage, static_cast<size_t>(rcvLen), lBuffer, lPacketInfo);
         }
     }
     else
@@ -1196,7 +1453,72 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
         if (OnReceiveError != nullptr && lStatus != chip::System::MapErrorPOSIX(EAGAIN))
             OnReceiveError(this, lStatus, nullptr);
     }
+#endif // !HAVE_UDP_BATCH_IO
+}
+
+#if HAVE_UDP_BATCH_IO
+void IPEndPointBasis::HandlePendingIOBatch(uint16_t aPort)
+{
+    System::PacketBufferHandle lBuffers[INET_CONFIG_UDP_BATCH_SIZE];
+    ReceiveMsgStorage lStorage[INET_CONFIG_UDP_BATCH_SIZE];
+    struct mmsghdr lMsgs[INET_CONFIG_UDP_BATCH_SIZE];
+    unsigned int lCount = 0;
+    int lReceived;
+
+    for (; lCount < INET_CONFIG_UDP_BATCH_SIZE; lCount++)
+    {
+        lBuffers[lCount] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (lBuffers[lCount].IsNull())
+        {
+            break;
+        }
+        PrepareReceiveMsg(lBuffers[lCount], lStorage[lCount], lMsgs[lCount].msg_hdr);
+        lMsgs[lCount].msg_len = 0;
+    }
+
+    if (lCount == 0)
+    {
+        if (OnReceiveError != nullptr)
+            OnReceiveError(this, INET_ERROR_NO_MEMORY, nullptr);
+        return;
+    }
+
+    lReceived = recvmmsg(mSocket, lMsgs, lCount, MSG_DONTWAIT, nullptr);
+    if (lReceived < 0)
+    {
+        const INET_ERROR lStatus = chip::System::MapErrorPOSIX(errno);
+
+        if (OnReceiveError != nullptr && lStatus != chip::System::MapErrorPOSIX(EAGAIN))
+            OnReceiveError(this, lStatus, nullptr);
+        return;
+    }
+
+    for (int i = 0; i < lReceived; i++)
+    {
+        IPPacketInfo lPacketInfo;
+
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort = aPort;
+
+        const INET_ERROR lStatus = ParseReceivedMsg(lMsgs[i].msg_hdr, lStorage[i], lMsgs[i].msg_len, lBuffers[i], lPacketInfo);
+        if (lStatus == INET_NO_ERROR)
+        {
+            lBuffers[i].RightSize();
+            OnMessageReceived(this, std::move(lBuffers[i]), &lPacketInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+
+        // The handler may have closed the endpoint; any remaining datagrams are dropped, as they would be by the close.
+        if (mState != kState_Listening || OnMessageReceived == nullptr)
+        {
+            break;
+        }
+    }
 }
+#endif // HAVE_UDP_BATCH_IO
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
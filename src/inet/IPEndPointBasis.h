@@ -27,6 +27,7 @@
 #pragma once
 
 #include <inet/EndPointBasis.h>
+#include <inet/MulticastGroupTable.h>
 
 #include <system/SystemPacketBuffer.h>
 
@@ -133,12 +134,19 @@ protected:
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     InterfaceId mBoundIntfId;
+    // The groups the socket is joined to, for each one to be joined once
+    MulticastGroupTable<INET_CONFIG_MAX_MULTICAST_GROUPS_PER_ENDPOINT> mMulticastGroups;
+
+    void ReleaseMulticastGroups();
 
     INET_ERROR Bind(IPAddressType aAddressType, const IPAddress & aAddress, uint16_t aPort, InterfaceId aInterfaceId);
     INET_ERROR BindInterface(IPAddressType aAddressType, InterfaceId aInterfaceId);
     INET_ERROR SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle aBuffer, uint16_t aSendFlags);
+    INET_ERROR SendMsgs(const IPPacketInfo * aPktInfos, const chip::System::PacketBufferHandle * aBuffers, size_t aCount,
+                        size_t & aSentCount);
     INET_ERROR GetSocket(IPAddressType aAddressType, int aType, int aProtocol);
     void HandlePendingIO(uint16_t aPort);
+    void HandlePendingIOBatch(uint16_t aPort);
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
@@ -175,9 +183,14 @@ public:
 private:
     static JoinMulticastGroupHandler sJoinMulticastGroupHandler;
     static LeaveMulticastGroupHandler sLeaveMulticastGroupHandler;
+    // The groups joined through the handlers, which all the end points share
+    static MulticastGroupTable<INET_CONFIG_MAX_PLATFORM_MULTICAST_GROUPS> sPlatformMulticastGroups;
 #endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 
 private:
+    INET_ERROR JoinMulticastGroupImpl(InterfaceId aInterfaceId, const IPAddress & aAddress);
+    INET_ERROR LeaveMulticastGroupImpl(InterfaceId aInterfaceId, const IPAddress & aAddress);
+
     IPEndPointBasis()                        = delete;
     IPEndPointBasis(const IPEndPointBasis &) = delete;
     ~IPEndPointBasis()                       = delete;
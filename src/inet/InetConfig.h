@@ -259,6 +259,38 @@
 #define INET_CONFIG_NUM_UDP_ENDPOINTS                       64
 #endif // INET_CONFIG_NUM_UDP_ENDPOINTS
 
+/**
+ *  @def INET_CONFIG_MAX_MULTICAST_GROUPS_PER_ENDPOINT
+ *
+ *  @brief
+ *    This is the number of multicast groups, counting each interface
+ *    a group is joined on, that a socket end point can join.
+ *
+ *    Joining a group the end point has already joined on the interface
+ *    only counts the join, without another socket option, and the group
+ *    is left when it has been left as many times.
+ *
+ */
+#ifndef INET_CONFIG_MAX_MULTICAST_GROUPS_PER_ENDPOINT
+#define INET_CONFIG_MAX_MULTICAST_GROUPS_PER_ENDPOINT       8
+#endif // INET_CONFIG_MAX_MULTICAST_GROUPS_PER_ENDPOINT
+
+/**
+ *  @def INET_CONFIG_MAX_PLATFORM_MULTICAST_GROUPS
+ *
+ *  @brief
+ *    This is the number of multicast groups, counting each interface
+ *    a group is joined on, that the end points can join through the
+ *    handlers of CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API.
+ *
+ *    The memberships of the platform are shared by all the end points:
+ *    a group is only joined by the first of them and left by the last.
+ *
+ */
+#ifndef INET_CONFIG_MAX_PLATFORM_MULTICAST_GROUPS
+#define INET_CONFIG_MAX_PLATFORM_MULTICAST_GROUPS           16
+#endif // INET_CONFIG_MAX_PLATFORM_MULTICAST_GROUPS
+
 /**
  *  @def INET_CONFIG_NUM_DNS_RESOLVERS
  *
@@ -400,6 +432,39 @@
 #define INET_CONFIG_DNS_ASYNC_MAX_THREAD_COUNT             2
 #endif // INET_CONFIG_DNS_ASYNC_MAX_THREAD_COUNT
 
+/**
+ * @def INET_CONFIG_DNS_CACHE_SIZE
+ *
+ * @brief The number of host names whose addresses the asynchronous
+ * DNS resolver remembers.
+ *
+ * @details
+ *   Requests for a host name that is being resolved wait for the
+ *   lookup in progress instead of making their own, and requests
+ *   for a host name resolved less than INET_CONFIG_DNS_CACHE_TTL_SEC
+ *   ago are answered without a lookup. Only the requests for at most
+ *   INET_CONFIG_MAX_DNS_ADDRS addresses are cached. Set to 0 to look
+ *   every name up.
+ */
+#ifndef INET_CONFIG_DNS_CACHE_SIZE
+#define INET_CONFIG_DNS_CACHE_SIZE                         4
+#endif // INET_CONFIG_DNS_CACHE_SIZE
+
+/**
+ * @def INET_CONFIG_DNS_CACHE_TTL_SEC
+ *
+ * @brief The number of seconds the asynchronous DNS resolver keeps
+ * the addresses of a host name.
+ *
+ * @details
+ *   getaddrinfo() does not tell the TTL of the records, so the
+ *   addresses are kept for this fixed time, which should not be
+ *   longer than the TTLs used by the resolved hosts.
+ */
+#ifndef INET_CONFIG_DNS_CACHE_TTL_SEC
+#define INET_CONFIG_DNS_CACHE_TTL_SEC                      30
+#endif // INET_CONFIG_DNS_CACHE_TTL_SEC
+
 /**
  *  @def INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
  *
@@ -508,4 +573,59 @@
 #ifndef INET_CONFIG_IP_MULTICAST_HOP_LIMIT
 #define INET_CONFIG_IP_MULTICAST_HOP_LIMIT                 (64)
 #endif // INET_CONFIG_IP_MULTICAST_HOP_LIMIT
+
+/**
+ *  @def INET_CONFIG_MAX_SEND_IOV
+ *
+ *  @brief
+ *    The maximum number of chained packet buffers a socket-based
+ *    UDP endpoint sends as a single datagram.
+ *
+ *  @details
+ *    Each buffer of the chain is passed to sendmsg() as its own
+ *    I/O vector, so a message built from separate header and
+ *    payload buffers is sent without being consolidated first.
+ *    Longer chains are rejected with
+ *    INET_ERROR_MESSAGE_TOO_LONG. Setting this to 1 only allows
+ *    unchained buffers.
+ */
+#ifndef INET_CONFIG_MAX_SEND_IOV
+#define INET_CONFIG_MAX_SEND_IOV                           (8)
+#endif // INET_CONFIG_MAX_SEND_IOV
+
+/**
+ *  @def INET_CONFIG_UDP_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams a socket-based UDP endpoint
+ *    receives or sends with a single system call.
+ *
+ *  @details
+ *    When greater than 1, and the platform provides recvmmsg() and
+ *    sendmmsg(), each readiness event drains up to this many
+ *    datagrams, and UDPEndPoint::SendMsgs() sends its messages in
+ *    batches of this size. Each message of a batch uses a packet
+ *    buffer and roughly 400 bytes of stack.
+ */
+#ifndef INET_CONFIG_UDP_BATCH_SIZE
+#define INET_CONFIG_UDP_BATCH_SIZE                         (1)
+#endif // INET_CONFIG_UDP_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_CACHE_INTERFACE_LIST
+ *
+ *  @brief
+ *    Share one snapshot of the system's network interfaces and
+ *    interface addresses between the interface iterators.
+ *
+ *  @details
+ *    On Linux and Darwin sockets-based systems, when set, the
+ *    snapshot is only retaken once the system reports a change of
+ *    its interfaces or addresses on a netlink or routing socket,
+ *    instead of calling if_nameindex() and getifaddrs() for each
+ *    InterfaceIterator and InterfaceAddressIterator.
+ */
+#ifndef INET_CONFIG_CACHE_INTERFACE_LIST
+#define INET_CONFIG_CACHE_INTERFACE_LIST                   1
+#endif // INET_CONFIG_CACHE_INTERFACE_LIST
 // clang-format on
@@ -57,6 +57,18 @@
 #else // !defined(__ANDROID__)
 #include <ifaddrs.h>
 #endif // !defined(__ANDROID__)
+
+#if INET_CONFIG_CACHE_INTERFACE_LIST && !defined(__ANDROID__) && (defined(__linux__) || defined(__APPLE__))
+#define INET_INTERFACE_LIST_SHARED 1
+#include <mutex>
+#include <new>
+#ifdef __linux__
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#else // defined(__APPLE__)
+#include <net/route.h>
+#endif // __linux__
+#endif // INET_CONFIG_CACHE_INTERFACE_LIST && !defined(__ANDROID__) && (defined(__linux__) || defined(__APPLE__))
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -241,6 +253,149 @@ void CloseIOCTLSocket()
     }
 }
 
+#if INET_INTERFACE_LIST_SHARED
+
+/**
+ * @brief   A snapshot of the system's network interfaces and interface addresses, shared by the iterators.
+ */
+struct InterfaceListSnapshot
+{
+    struct if_nameindex * mIntfArray;
+    struct ifaddrs * mAddrsList;
+    unsigned mRefCount;
+};
+
+namespace {
+
+std::mutex sSnapshotMutex;
+InterfaceListSnapshot * sSnapshot = nullptr; // The latest snapshot, which holds a reference to itself.
+int sChangeSocket                 = -1;      // Reports the changes of the interfaces and their addresses.
+
+bool OpenChangeSocket()
+{
+#ifdef __linux__
+    int s = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_ROUTE);
+    if (s < 0)
+        return false;
+
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+    if (bind(s, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(s);
+        return false;
+    }
+#else  // defined(__APPLE__)
+    int s = socket(PF_ROUTE, SOCK_RAW, AF_UNSPEC);
+    if (s < 0)
+        return false;
+    fcntl(s, F_SETFL, fcntl(s, F_GETFL) | O_NONBLOCK);
+    fcntl(s, F_SETFD, FD_CLOEXEC);
+#endif // __linux__
+
+    sChangeSocket = s;
+    return true;
+}
+
+/**
+ * Reads the pending change reports, and returns whether any changed the interfaces or their addresses. Without a change
+ * socket, or when the socket lost reports, the snapshot is assumed outdated.
+ */
+bool ReadChangeReports()
+{
+    if (sChangeSocket < 0 && !OpenChangeSocket())
+        return true;
+
+    bool changed = false;
+    alignas(uint32_t) uint8_t buf[4096];
+
+    while (true)
+    {
+        ssize_t len = recv(sChangeSocket, buf, sizeof(buf), 0);
+        if (len < 0)
+        {
+            // ENOBUFS reports lost notifications.
+            return changed || (errno != EAGAIN && errno != EWOULDBLOCK);
+        }
+        if (len == 0)
+            return changed;
+
+#ifdef __linux__
+        // The socket only subscribes to the link and address groups.
+        changed = true;
+#else  // defined(__APPLE__)
+        // The routing socket also reports route changes, which leave the interfaces as they are.
+        if (static_cast<size_t>(len) >= sizeof(struct rt_msghdr))
+        {
+            const uint8_t type = reinterpret_cast<const struct rt_msghdr *>(buf)->rtm_type;
+            changed |= (type == RTM_NEWADDR || type == RTM_DELADDR || type == RTM_IFINFO || type == RTM_IFINFO2);
+        }
+#endif // __linux__
+    }
+}
+
+void ReleaseSnapshotLocked(InterfaceListSnapshot * snapshot)
+{
+    if (--snapshot->mRefCount > 0)
+        return;
+
+    if (snapshot->mIntfArray != nullptr)
+        if_freenameindex(snapshot->mIntfArray);
+    if (snapshot->mAddrsList != nullptr)
+        freeifaddrs(snapshot->mAddrsList);
+    delete snapshot;
+}
+
+} // namespace
+
+/**
+ * @brief   Returns a reference to the latest snapshot of the interfaces, retaken first if they changed since.
+ *
+ * @return  the snapshot, to release with \c ReleaseInterfaceListSnapshot, or \c nullptr if the system could not list
+ *          the interfaces.
+ */
+static InterfaceListSnapshot * AcquireInterfaceListSnapshot()
+{
+    std::lock_guard<std::mutex> lock(sSnapshotMutex);
+
+    // Read the reports first, so that no change made while the snapshot is taken goes unnoticed.
+    if (ReadChangeReports() || sSnapshot == nullptr)
+    {
+        InterfaceListSnapshot * snapshot = new (std::nothrow) InterfaceListSnapshot{ if_nameindex(), nullptr, 1 };
+        if (snapshot == nullptr)
+            return nullptr;
+
+        if (sSnapshot != nullptr)
+        {
+            ReleaseSnapshotLocked(sSnapshot);
+            sSnapshot = nullptr;
+        }
+
+        if (snapshot->mIntfArray == nullptr || getifaddrs(&snapshot->mAddrsList) != 0)
+        {
+            // Retried by the next iterator, since the change reports have been read.
+            snapshot->mAddrsList = nullptr;
+            ReleaseSnapshotLocked(snapshot);
+            return nullptr;
+        }
+
+        sSnapshot = snapshot;
+    }
+
+    sSnapshot->mRefCount++;
+    return sSnapshot;
+}
+
+static void ReleaseInterfaceListSnapshot(InterfaceListSnapshot * snapshot)
+{
+    std::lock_guard<std::mutex> lock(sSnapshotMutex);
+    ReleaseSnapshotLocked(snapshot);
+}
+
+#endif // INET_INTERFACE_LIST_SHARED
+
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 /**
@@ -395,6 +550,7 @@ exit:
 InterfaceIterator::InterfaceIterator()
 {
     mIntfArray       = nullptr;
+    mSnapshot        = nullptr;
     mCurIntf         = 0;
     mIntfFlags       = 0;
     mIntfFlagsCached = false;
@@ -419,6 +575,15 @@ InterfaceIterator::InterfaceIterator() : mCurrentInterface(net_if_get_by_index(m
 
 InterfaceIterator::~InterfaceIterator()
 {
+#if INET_INTERFACE_LIST_SHARED
+    if (mSnapshot != nullptr)
+    {
+        ReleaseInterfaceListSnapshot(mSnapshot);
+        mSnapshot  = nullptr;
+        mIntfArray = nullptr;
+    }
+#endif // INET_INTERFACE_LIST_SHARED
+
     if (mIntfArray != nullptr)
     {
 #if __ANDROID__ && __ANDROID_API__ < 24
@@ -481,7 +646,13 @@ bool InterfaceIterator::Next()
 
     if (mIntfArray == nullptr)
     {
-#if __ANDROID__ && __ANDROID_API__ < 24
+#if INET_INTERFACE_LIST_SHARED
+        if (mSnapshot == nullptr)
+        {
+            mSnapshot  = AcquireInterfaceListSnapshot();
+            mIntfArray = (mSnapshot != nullptr) ? mSnapshot->mIntfArray : nullptr;
+        }
+#elif __ANDROID__ && __ANDROID_API__ < 24
         mIntfArray = backport_if_nameindex();
 #else
         mIntfArray = if_nameindex();
@@ -704,6 +875,7 @@ InterfaceAddressIterator::InterfaceAddressIterator()
 {
     mAddrsList = nullptr;
     mCurAddr   = nullptr;
+    mSnapshot  = nullptr;
 }
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -723,6 +895,15 @@ InterfaceAddressIterator::InterfaceAddressIterator() = default;
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 InterfaceAddressIterator::~InterfaceAddressIterator()
 {
+#if INET_INTERFACE_LIST_SHARED
+    if (mSnapshot != nullptr)
+    {
+        ReleaseInterfaceListSnapshot(mSnapshot);
+        mSnapshot  = nullptr;
+        mAddrsList = mCurAddr = nullptr;
+    }
+#endif // INET_INTERFACE_LIST_SHARED
+
     if (mAddrsList != nullptr)
     {
         freeifaddrs(mAddrsList);
@@ -777,11 +958,24 @@ bool InterfaceAddressIterator::Next()
     {
         if (mAddrsList == nullptr)
         {
+#if INET_INTERFACE_LIST_SHARED
+            if (mSnapshot != nullptr)
+            {
+                return false;
+            }
+            mSnapshot = AcquireInterfaceListSnapshot();
+            if (mSnapshot == nullptr)
+            {
+                return false;
+            }
+            mAddrsList = mSnapshot->mAddrsList;
+#else
             int res = getifaddrs(&mAddrsList);
             if (res < 0)
             {
                 return false;
             }
+#endif // INET_INTERFACE_LIST_SHARED
             mCurAddr = mAddrsList;
         }
         else if (mCurAddr != nullptr)
@@ -969,6 +1163,16 @@ InterfaceId InterfaceAddressIterator::GetInterfaceId()
 {
     if (HasCurrent())
     {
+#if INET_INTERFACE_LIST_SHARED
+        // Look the name up in the snapshot rather than with a system call.
+        for (struct if_nameindex * intf = mSnapshot->mIntfArray; intf->if_index != 0; intf++)
+        {
+            if (strcmp(intf->if_name, mCurAddr->ifa_name) == 0)
+            {
+                return intf->if_index;
+            }
+        }
+#endif // INET_INTERFACE_LIST_SHARED
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
         return if_nametoindex(mCurAddr->ifa_name);
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
@@ -58,6 +58,10 @@ namespace Inet {
 class IPAddress;
 class IPPrefix;
 
+#if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+struct InterfaceListSnapshot;
+#endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+
 /**
  * @typedef     InterfaceId
  *
@@ -174,6 +178,7 @@ protected:
 
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
     struct if_nameindex * mIntfArray;
+    InterfaceListSnapshot * mSnapshot; // Holds mIntfArray when it is shared, see INET_CONFIG_CACHE_INTERFACE_LIST.
     size_t mCurIntf;
     short mIntfFlags;
     bool mIntfFlagsCached;
@@ -242,6 +247,7 @@ private:
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
     struct ifaddrs * mAddrsList;
     struct ifaddrs * mCurAddr;
+    InterfaceListSnapshot * mSnapshot; // Holds mAddrsList when it is shared, see INET_CONFIG_CACHE_INTERFACE_LIST.
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -1202,40 +1202,146 @@ void InetLayer::HandleSelectResult(int selectRes, fd_set * readfds, fd_set * wri
         }
 #endif // INET_CONFIG_ENABLE_UDP_ENDPOINT
 
-        // Now call each active endpoint to handle its pending I/O.
+        HandlePendingIO();
+    }
+}
+
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
+/**
+ *  Request the I/O events each active endpoint is waiting for from the event poller of the
+ *  system layer. This is the event poller counterpart of PrepareSelect().
+ *
+ */
+void InetLayer::PrepareEvents()
+{
+    if (State != kState_Initialized)
+        return;
+
+    chip::System::EventPoller & lPoller = mSystemLayer->GetEventPoller();
+
 #if INET_CONFIG_ENABLE_RAW_ENDPOINT
-        for (size_t i = 0; i < RawEndPoint::sPool.Size(); i++)
+    for (size_t i = 0; i < RawEndPoint::sPool.Size(); i++)
+    {
+        RawEndPoint * lEndPoint = RawEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
+            lEndPoint->mRequestIO.SetPoller(lEndPoint->mSocket, lPoller);
+    }
+#endif // INET_CONFIG_ENABLE_RAW_ENDPOINT
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    for (size_t i = 0; i < TCPEndPoint::sPool.Size(); i++)
+    {
+        TCPEndPoint * lEndPoint = TCPEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
+            lEndPoint->mRequestIO.SetPoller(lEndPoint->mSocket, lPoller);
+    }
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
+#if INET_CONFIG_ENABLE_UDP_ENDPOINT
+    for (size_t i = 0; i < UDPEndPoint::sPool.Size(); i++)
+    {
+        UDPEndPoint * lEndPoint = UDPEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
+            lEndPoint->mRequestIO.SetPoller(lEndPoint->mSocket, lPoller);
+    }
+#endif // INET_CONFIG_ENABLE_UDP_ENDPOINT
+}
+
+/**
+ *  Handle I/O reported by the event poller of the system layer. This is the event poller
+ *  counterpart of HandleSelectResult(), and follows the same two-pass scheme: the pending
+ *  I/O of every endpoint is recorded before any of them is called.
+ *
+ *  @param[in]    numReady     The number of ready descriptors reported by EventPoller::Wait().
+ *
+ */
+void InetLayer::HandleEvents(int numReady)
+{
+    if (State != kState_Initialized)
+        return;
+
+    if (numReady <= 0)
+        return;
+
+    const chip::System::EventPoller & lPoller = mSystemLayer->GetEventPoller();
+
+#if INET_CONFIG_ENABLE_RAW_ENDPOINT
+    for (size_t i = 0; i < RawEndPoint::sPool.Size(); i++)
+    {
+        RawEndPoint * lEndPoint = RawEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
         {
-            RawEndPoint * lEndPoint = RawEndPoint::sPool.Get(*mSystemLayer, i);
-            if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
-            {
-                lEndPoint->HandlePendingIO();
-            }
+            lEndPoint->mPendingIO = SocketEvents::FromPoller(lEndPoint->mSocket, lPoller);
         }
+    }
 #endif // INET_CONFIG_ENABLE_RAW_ENDPOINT
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-        for (size_t i = 0; i < TCPEndPoint::sPool.Size(); i++)
+    for (size_t i = 0; i < TCPEndPoint::sPool.Size(); i++)
+    {
+        TCPEndPoint * lEndPoint = TCPEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
         {
-            TCPEndPoint * lEndPoint = TCPEndPoint::sPool.Get(*mSystemLayer, i);
-            if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
-            {
-                lEndPoint->HandlePendingIO();
-            }
+            lEndPoint->mPendingIO = SocketEvents::FromPoller(lEndPoint->mSocket, lPoller);
         }
+    }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
 #if INET_CONFIG_ENABLE_UDP_ENDPOINT
-        for (size_t i = 0; i < UDPEndPoint::sPool.Size(); i++)
+    for (size_t i = 0; i < UDPEndPoint::sPool.Size(); i++)
+    {
+        UDPEndPoint * lEndPoint = UDPEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
         {
-            UDPEndPoint * lEndPoint = UDPEndPoint::sPool.Get(*mSystemLayer, i);
-            if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
-            {
-                lEndPoint->HandlePendingIO();
-            }
+            lEndPoint->mPendingIO = SocketEvents::FromPoller(lEndPoint->mSocket, lPoller);
         }
+    }
 #endif // INET_CONFIG_ENABLE_UDP_ENDPOINT
+
+    HandlePendingIO();
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
+/**
+ *  Call each active endpoint to handle the pending I/O recorded for it.
+ *
+ */
+void InetLayer::HandlePendingIO()
+{
+#if INET_CONFIG_ENABLE_RAW_ENDPOINT
+    for (size_t i = 0; i < RawEndPoint::sPool.Size(); i++)
+    {
+        RawEndPoint * lEndPoint = RawEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
+        {
+            lEndPoint->HandlePendingIO();
+        }
+    }
+#endif // INET_CONFIG_ENABLE_RAW_ENDPOINT
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    for (size_t i = 0; i < TCPEndPoint::sPool.Size(); i++)
+    {
+        TCPEndPoint * lEndPoint = TCPEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
+        {
+            lEndPoint->HandlePendingIO();
+        }
+    }
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
+#if INET_CONFIG_ENABLE_UDP_ENDPOINT
+    for (size_t i = 0; i < UDPEndPoint::sPool.Size(); i++)
+    {
+        UDPEndPoint * lEndPoint = UDPEndPoint::sPool.Get(*mSystemLayer, i);
+        if ((lEndPoint != nullptr) && lEndPoint->IsCreatedByInetLayer(*this))
+        {
+            lEndPoint->HandlePendingIO();
+        }
     }
+#endif // INET_CONFIG_ENABLE_UDP_ENDPOINT
 }
 
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
@@ -219,6 +219,11 @@ public:
     void HandleSelectResult(int selectRes, fd_set * readfds, fd_set * writefds, fd_set * exceptfds);
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+    void PrepareEvents();
+    void HandleEvents(int numReady);
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
     static void UpdateSnapshot(chip::System::Stats::Snapshot & aSnapshot);
 
     void * GetPlatformData();
@@ -305,6 +310,10 @@ private:
     friend void Platform::InetLayer::DidShutdown(Inet::InetLayer * aLayer, void * aContext, INET_ERROR anError);
 
     bool IsIdleTimerRunning();
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    void HandlePendingIO();
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 };
 
 inline chip::System::Layer * InetLayer::SystemLayer() const
@@ -87,6 +87,52 @@ SocketEvents SocketEvents::FromFDs(int socket, fd_set * readfds, fd_set * writef
 
     return res;
 }
+
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
+static_assert(static_cast<int>(SocketEvents::kRead) == System::EventPoller::kRead &&
+                  static_cast<int>(SocketEvents::kWrite) == System::EventPoller::kWrite &&
+                  static_cast<int>(SocketEvents::kError) == System::EventPoller::kError,
+              "SocketEvents and EventPoller flags must match");
+
+/**
+ *  Request the read, write or exception events set in the bit flags for the specified socket from an event poller.
+ *
+ *  @param[in]    socket    The file descriptor for which the events are requested.
+ *
+ *  @param[in]    poller    The event poller to request the events from.
+ *
+ */
+void SocketEvents::SetPoller(int socket, System::EventPoller & poller) const
+{
+    if (socket != INET_INVALID_SOCKET_FD && IsSet())
+    {
+        poller.Request(socket, static_cast<uint8_t>(Value));
+    }
+}
+
+/**
+ *  Set the read, write or exception bit flags for the specified socket based on the events
+ *  an event poller reported ready for it.
+ *
+ *  @param[in]    socket    The file descriptor for which the bit flags are being set.
+ *
+ *  @param[in]    poller    The event poller that was waited on.
+ *
+ */
+SocketEvents SocketEvents::FromPoller(int socket, const System::EventPoller & poller)
+{
+    SocketEvents res;
+
+    if (socket != INET_INVALID_SOCKET_FD)
+    {
+        res.Value = poller.Pending(socket);
+    }
+
+    return res;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 } // namespace Inet
@@ -28,6 +28,7 @@
 #include <inet/InetConfig.h>
 
 #include <support/DLLUtil.h>
+#include <system/SystemEventPoller.h>
 #include <system/SystemObject.h>
 
 #include <stdint.h>
@@ -207,6 +208,11 @@ public:
 
     void SetFDs(int socket, int & nfds, fd_set * readfds, fd_set * writefds, fd_set * exceptfds);
     static SocketEvents FromFDs(int socket, fd_set * readfds, fd_set * writefds, fd_set * exceptfds);
+
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+    void SetPoller(int socket, System::EventPoller & poller) const;
+    static SocketEvents FromPoller(int socket, const System::EventPoller & poller);
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
 };
 
 /**
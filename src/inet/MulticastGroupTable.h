@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the <tt>Inet::MulticastGroupTable</tt> class
+ *      template, which counts the joins of multicast groups, by interface,
+ *      for only the first join and the last leave of each group to reach
+ *      the network stack.
+ */
+
+#pragma once
+
+#include <inet/IPAddress.h>
+#include <inet/InetError.h>
+#include <inet/InetInterface.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Inet {
+
+/**
+ * @brief   The multicast groups joined on each interface, and how many times.
+ *
+ * @details
+ *  A group joined several times on an interface, by several users of an
+ *  endpoint or by several endpoints of a stack whose memberships are shared,
+ *  is only joined by the first and left by the last of them.
+ */
+template <size_t N>
+class MulticastGroupTable
+{
+public:
+    /**
+     * @brief   Count a join of a group on an interface.
+     *
+     * @param[out]  aIsFirst    Whether the group was not joined on the interface yet, and has to be.
+     *
+     * @retval  INET_ERROR_NO_MEMORY    if the group is not joined yet and the table is full.
+     */
+    INET_ERROR Join(InterfaceId aInterfaceId, const IPAddress & aAddress, bool & aIsFirst)
+    {
+        size_t lIndex = Find(aInterfaceId, aAddress);
+
+        aIsFirst = (lIndex == mCount);
+        if (aIsFirst)
+        {
+            if (mCount == N)
+            {
+                return INET_ERROR_NO_MEMORY;
+            }
+            mEntries[lIndex].mInterface = aInterfaceId;
+            mEntries[lIndex].mAddress   = aAddress;
+            mEntries[lIndex].mJoinCount = 0;
+            mCount++;
+        }
+        else if (mEntries[lIndex].mJoinCount == UINT16_MAX)
+        {
+            return INET_ERROR_NO_MEMORY;
+        }
+
+        mEntries[lIndex].mJoinCount++;
+        return INET_NO_ERROR;
+    }
+
+    /**
+     * @brief   Count a leave of a group on an interface.
+     *
+     * @param[out]  aIsLast     Whether the group was left as many times as it was joined, and has to be left.
+     *
+     * @retval  INET_ERROR_ADDRESS_NOT_FOUND    if the group is not joined on the interface.
+     */
+    INET_ERROR Leave(InterfaceId aInterfaceId, const IPAddress & aAddress, bool & aIsLast)
+    {
+        size_t lIndex = Find(aInterfaceId, aAddress);
+
+        aIsLast = false;
+        if (lIndex == mCount)
+        {
+            return INET_ERROR_ADDRESS_NOT_FOUND;
+        }
+
+        if (--mEntries[lIndex].mJoinCount == 0)
+        {
+            // The order of the groups does not matter: move the last one in its place
+            mEntries[lIndex] = mEntries[--mCount];
+            aIsLast          = true;
+        }
+        return INET_NO_ERROR;
+    }
+
+    bool IsJoined(InterfaceId aInterfaceId, const IPAddress & aAddress) const { return Find(aInterfaceId, aAddress) != mCount; }
+
+    /** The number of groups joined, on all interfaces. */
+    size_t GetCount() const { return mCount; }
+
+    /**
+     * @brief   Call aFunction with the interface and address of each group joined.
+     */
+    template <typename Function>
+    void ForEach(Function aFunction) const
+    {
+        for (size_t i = 0; i < mCount; i++)
+        {
+            aFunction(mEntries[i].mInterface, mEntries[i].mAddress);
+        }
+    }
+
+    /** Forget all the groups, without leaving them. */
+    void Clear() { mCount = 0; }
+
+private:
+    struct Entry
+    {
+        InterfaceId mInterface;
+        IPAddress mAddress;
+        uint16_t mJoinCount;
+    };
+
+    // The index of the group, or mCount if it is not joined on the interface
+    size_t Find(InterfaceId aInterfaceId, const IPAddress & aAddress) const
+    {
+        size_t i = 0;
+        while (i < mCount && !(mEntries[i].mInterface == aInterfaceId && mEntries[i].mAddress == aAddress))
+        {
+            i++;
+        }
+        return i;
+    }
+
+    Entry mEntries[N];
+    size_t mCount = 0;
+};
+
+} // namespace Inet
+} // namespace chip
@@ -460,10 +460,16 @@ void RawEndPoint::Close()
             // Wake the thread calling select so that it recognizes the socket is closed.
             lSystemLayer.WakeSelect();
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+            lSystemLayer.GetEventPoller().Forget(mSocket);
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
             close(mSocket);
             mSocket = INET_INVALID_SOCKET_FD;
         }
 
+        ReleaseMulticastGroups();
+
         // Clear any results from select() that indicate pending I/O for the socket.
         mPendingIO.Clear();
 
@@ -1036,11 +1036,40 @@ INET_ERROR TCPEndPoint::SetReceivedDataForTesting(System::PacketBufferHandle dat
     if (!IsConnected())
         return INET_ERROR_INCORRECT_STATE;
 
-    mRcvQueue = std::move(data);
+    mRcvQueue         = std::move(data);
+    mRcvPutBackLength = 0;
 
     return INET_NO_ERROR;
 }
 
+INET_ERROR TCPEndPoint::PutBackReceivedData(System::PacketBufferHandle data)
+{
+    if (!IsConnected() || !mRcvQueue.IsNull())
+        return INET_ERROR_INCORRECT_STATE;
+
+    if (!data.IsNull())
+    {
+        mRcvPutBackLength = data->TotalLength();
+        mRcvQueue         = std::move(data);
+    }
+
+    return INET_NO_ERROR;
+}
+
+void TCPEndPoint::SetReceiveCredit(uint32_t credit)
+{
+    mRcvCredit = credit;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    // Reading stops while there is no credit, see ReceiveData().
+    if (credit > 0 && (State == kState_Connected || State == kState_SendShutdown) && !mRequestIO.IsReadable())
+    {
+        mRequestIO.SetRead();
+        SystemLayer().WakeSelect();
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+}
+
 uint32_t TCPEndPoint::PendingSendLength()
 {
     if (!mSendQueue.IsNull())
@@ -1152,7 +1181,9 @@ bool TCPEndPoint::IsConnected(int state)
 void TCPEndPoint::Init(InetLayer * inetLayer)
 {
     InitEndPointBasis(*inetLayer);
-    ReceiveEnabled = true;
+    ReceiveEnabled    = true;
+    mRcvPutBackLength = 0;
+    mRcvCredit        = kUnlimitedReceiveCredit;
 
     // Initialize to zero for using system defaults.
     mConnectTimeoutMsecs = 0;
@@ -1410,11 +1441,13 @@ void TCPEndPoint::DriveReceiving()
 {
     // If there's data in the receive queue and the app is ready to receive it then call the app's callback
     // with the entire receive queue.
-    if (!mRcvQueue.IsNull() && ReceiveEnabled && OnDataReceived != nullptr)
+    // Data put back is only passed again with more data.
+    if (!mRcvQueue.IsNull() && mRcvQueue->TotalLength() > mRcvPutBackLength && ReceiveEnabled && OnDataReceived != nullptr)
     {
         // Acknowledgement is done after handling the buffers to allow the
         // application processing to throttle flow.
-        uint16_t ackLength = mRcvQueue->TotalLength();
+        uint16_t ackLength = static_cast<uint16_t>(mRcvQueue->TotalLength() - mRcvPutBackLength);
+        mRcvPutBackLength  = 0;
         INET_ERROR err     = OnDataReceived(this, std::move(mRcvQueue));
         if (err != INET_NO_ERROR)
         {
@@ -1425,8 +1458,8 @@ void TCPEndPoint::DriveReceiving()
     }
 
     // If the connection is closing, and the receive queue is now empty, call DoClose() to complete
-    // the process of closing the connection.
-    if (State == kState_Closing && mRcvQueue.IsNull())
+    // the process of closing the connection. Data put back will not be completed anymore.
+    if (State == kState_Closing && (mRcvQueue.IsNull() || mRcvQueue->TotalLength() <= mRcvPutBackLength))
         DoClose(INET_NO_ERROR, false);
 }
 
@@ -1575,6 +1608,10 @@ INET_ERROR TCPEndPoint::DoClose(INET_ERROR err, bool suppressCallback)
                     ChipLogError(Inet, "SO_LINGER: %d", errno);
             }
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+            lSystemLayer.GetEventPoller().Forget(mSocket);
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
             if (close(mSocket) != 0 && err == INET_NO_ERROR)
                 err = chip::System::MapErrorPOSIX(errno);
             mSocket = INET_INVALID_SOCKET_FD;
@@ -1599,8 +1636,9 @@ INET_ERROR TCPEndPoint::DoClose(INET_ERROR err, bool suppressCallback)
     if (State == kState_Closed)
     {
         // Clear clear the send and receive queues.
-        mSendQueue = nullptr;
-        mRcvQueue  = nullptr;
+        mSendQueue        = nullptr;
+        mRcvQueue         = nullptr;
+        mRcvPutBackLength = 0;
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
         mUnackedLength = 0;
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
@@ -2400,7 +2438,7 @@ void TCPEndPoint::HandlePendingIO()
         // If in a state were receiving is allowed, and the app is ready to receive data, and data is ready
         // on the socket, receive inbound data from the connection.
         if ((State == kState_Connected || State == kState_SendShutdown) && ReceiveEnabled && OnDataReceived != nullptr &&
-            mPendingIO.IsReadable())
+            mRcvCredit > 0 && mPendingIO.IsReadable())
             ReceiveData();
     }
 
@@ -2436,8 +2474,9 @@ void TCPEndPoint::ReceiveData()
         return;
     }
 
-    // Attempt to receive data from the socket.
-    ssize_t rcvLen = recv(mSocket, rcvBuf->Start() + rcvBuf->DataLength(), rcvBuf->AvailableDataLength(), 0);
+    // Attempt to receive data from the socket, within the credit.
+    const size_t rcvSize = ::chip::min(static_cast<size_t>(rcvBuf->AvailableDataLength()), static_cast<size_t>(mRcvCredit));
+    ssize_t rcvLen       = recv(mSocket, rcvBuf->Start() + rcvBuf->DataLength(), rcvSize, 0);
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
     INET_ERROR err;
@@ -2519,6 +2558,14 @@ void TCPEndPoint::ReceiveData()
         else
         {
             VerifyOrDie(rcvLen > 0);
+            if (mRcvCredit != kUnlimitedReceiveCredit)
+            {
+                // Without credit left, stop reading until more is given, see SetReceiveCredit().
+                mRcvCredit -= static_cast<uint32_t>(rcvLen);
+                if (mRcvCredit == 0)
+                    mRequestIO.ClearRead();
+            }
+
             size_t newDataLength = rcvBuf->DataLength() + static_cast<size_t>(rcvLen);
             VerifyOrDie(CanCastTo<uint16_t>(newDataLength));
             if (isNewBuf)
@@ -310,6 +310,36 @@ public:
      */
     INET_ERROR AckReceive(uint16_t len);
 
+    /**
+     * @brief   Put back received data that was not consumed.
+     *
+     * @param[in]   data    Data passed to \c OnDataReceived, typically the start of an incomplete message.
+     *
+     * @retval  INET_NO_ERROR           success: data put back.
+     * @retval  INET_ERROR_INCORRECT_STATE  TCP connection not established, or data received since.
+     *
+     * @details
+     *  Use this method from the \c OnDataReceived delegate instead of keeping a partial message. The data is not
+     *  passed to \c OnDataReceived again until more data is received, and it is passed then together with it.
+     *  With sockets, the data received next fills the free space of the last buffer of \c data before another
+     *  buffer is allocated, so that the bytes of a message put back in a buffer large enough for it are all
+     *  received in that buffer.
+     */
+    INET_ERROR PutBackReceivedData(chip::System::PacketBufferHandle data);
+
+    /**
+     * @brief   Limit the number of bytes to receive.
+     *
+     * @param[in]   credit  Number of bytes that may be received, or \c kUnlimitedReceiveCredit.
+     *
+     * @details
+     *  Reception stops once \c credit bytes have been received, until more credit is given, so that TCP flow
+     *  control holds the peer back meanwhile. Along with \c PutBackReceivedData(), this lets the consumer of
+     *  length-prefixed messages have the rest of a message received exactly, into the buffer holding its start.
+     *  The credit is only enforced with sockets: with LwIP, the receive window is governed by \c AckReceive().
+     */
+    void SetReceiveCredit(uint32_t credit);
+
     /**
      * @brief   Set the receive queue, for testing.
      *
@@ -567,11 +597,18 @@ public:
      */
     constexpr static size_t kMaxReceiveMessageSize = System::PacketBuffer::kMaxSizeWithoutReserve;
 
+    /**
+     * Receive credit that does not limit reception, the default.
+     */
+    constexpr static uint32_t kUnlimitedReceiveCredit = UINT32_MAX;
+
 private:
     static chip::System::ObjectPool<TCPEndPoint, INET_CONFIG_NUM_TCP_ENDPOINTS> sPool;
 
     chip::System::PacketBufferHandle mRcvQueue;
     chip::System::PacketBufferHandle mSendQueue;
+    uint32_t mRcvPutBackLength; // Length of the data at the head of mRcvQueue already passed to OnDataReceived.
+    uint32_t mRcvCredit;        // Number of bytes that may still be received, see SetReceiveCredit().
 #if INET_TCP_IDLE_CHECK_INTERVAL > 0
     uint16_t mIdleTimeout;       // in units of INET_TCP_IDLE_CHECK_INTERVAL; zero means no timeout
     uint16_t mRemainingIdleTime; // in units of INET_TCP_IDLE_CHECK_INTERVAL
@@ -392,10 +392,16 @@ void UDPEndPoint::Close()
             // Wake the thread calling select so that it recognizes the socket is closed.
             lSystemLayer.WakeSelect();
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+            lSystemLayer.GetEventPoller().Forget(mSocket);
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
             close(mSocket);
             mSocket = INET_INVALID_SOCKET_FD;
         }
 
+        ReleaseMulticastGroups();
+
         // Clear any results from select() that indicate pending I/O for the socket.
         mPendingIO.Clear();
 
@@ -519,6 +525,10 @@ INET_ERROR UDPEndPoint::SendTo(const IPAddress & addr, uint16_t port, InterfaceI
  *      \c pktInfo.  If \c pktInfo contains an interface id, the message will be sent
  *      over the specified interface.  If \c pktInfo contains a source address, the
  *      given address will be used as the source of the UDP message.
+ *
+ *      \c msg may be a chain of buffers, which is sent as a single datagram. On
+ *      sockets, the chain is passed to sendmsg() without being copied, as long as
+ *      it has no more than INET_CONFIG_MAX_SEND_IOV non-empty buffers.
  */
 INET_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBufferHandle msg, uint16_t sendFlags)
 {
@@ -656,6 +666,55 @@ exit:
     return res;
 }
 
+/**
+ * @brief   Send several UDP messages, batching them into fewer system calls
+ *          where the platform allows.
+ *
+ * @param[in]   pktInfos    source and destination information for each message
+ * @param[in]   msgs        the messages; they remain owned by the caller
+ * @param[in]   count       the number of messages
+ * @param[out]  sentCount   the number of messages, from the start, queued for transmit
+ *
+ * @retval  INET_NO_ERROR
+ *      success: all the messages are queued for transmit.
+ *
+ * @retval  other
+ *      the error that stopped the transmission of message \c sentCount, as
+ *      it would have been returned by SendMsg().
+ *
+ * @details
+ *      Messages are sent in order, as by successive calls to SendMsg(). All
+ *      destinations must have the same address type. On sockets, with
+ *      INET_CONFIG_UDP_BATCH_SIZE greater than 1, up to that many messages are
+ *      passed to each sendmmsg() call.
+ */
+INET_ERROR UDPEndPoint::SendMsgs(const IPPacketInfo * pktInfos, const System::PacketBufferHandle * msgs, size_t count,
+                                 size_t & sentCount)
+{
+    sentCount = 0;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    if (count == 0)
+    {
+        return INET_NO_ERROR;
+    }
+
+    INET_FAULT_INJECT(FaultInjection::kFault_Send, return INET_ERROR_UNKNOWN_INTERFACE;);
+    INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, return INET_ERROR_NO_MEMORY;);
+
+    ReturnErrorOnFailure(GetSocket(pktInfos[0].DestAddress.Type()));
+
+    return IPEndPointBasis::SendMsgs(pktInfos, msgs, count, sentCount);
+#else  // !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    for (; sentCount < count; sentCount++)
+    {
+        ReturnErrorOnFailure(SendMsg(&pktInfos[sentCount], msgs[sentCount].Retain()));
+    }
+
+    return INET_NO_ERROR;
+#endif // !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+}
+
 /**
  * @brief   Bind the endpoint to a network interface.
  *
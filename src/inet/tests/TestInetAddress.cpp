@@ -793,6 +793,47 @@ void CheckToString(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ *  Test rejection of malformed address strings.
+ */
+void CheckFromStringMalformed(nlTestSuite * inSuite, void * inContext)
+{
+    // clang-format off
+    static const char * const kMalformed[] =
+    {
+        "", ":", ":1", "1:", "1::2::3", "12345::", "g::", "1:2:3:4:5:6:7:8:9", "1:2:3:4:5:6:7::8", "::1.2.3",
+        "1.2.3", "1.2.3.4.", "01.2.3.4", "256.1.1.1", "1..2.3", "1.2.3.4 "
+    };
+    // clang-format on
+    IPAddress test_addr;
+
+    for (const char * text : kMalformed)
+    {
+        NL_TEST_ASSERT(inSuite, !IPAddress::FromString(text, test_addr));
+    }
+
+    // Text that is not NUL terminated is scanned for exactly its length.
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("fe80::1234", 7, test_addr));
+    NL_TEST_ASSERT(inSuite, test_addr == IPAddress::MakeLLA(1));
+}
+
+/**
+ *  Test IP address conversion to a string which does not fit the buffer.
+ */
+void CheckToStringTruncated(nlTestSuite * inSuite, void * inContext)
+{
+    const IPAddress lAddress = IPAddress::MakeLLA(0x8edcd4fffe3aebfb);
+    const char * lExpected   = "fe80::8edc:d4ff:fe3a:ebfb";
+    char lAddressBuffer[INET6_ADDRSTRLEN];
+
+    NL_TEST_ASSERT(inSuite, lAddress.ToString(lAddressBuffer, static_cast<uint32_t>(strlen(lExpected) + 1)) == lAddressBuffer);
+    NL_TEST_ASSERT(inSuite, strcmp(lAddressBuffer, lExpected) == 0);
+
+    NL_TEST_ASSERT(inSuite, lAddress.ToString(lAddressBuffer, static_cast<uint32_t>(strlen(lExpected))) == nullptr);
+    NL_TEST_ASSERT(inSuite, strncmp(lAddressBuffer, lExpected, strlen(lExpected) - 1) == 0);
+    NL_TEST_ASSERT(inSuite, lAddressBuffer[strlen(lExpected) - 1] == '\0');
+}
+
 /**
  *  Test correct identification of IPv6 ULA addresses.
  */
@@ -1724,6 +1765,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("Address Encode / Decode Symmetricity",        CheckEcodeDecodeSymmetricity),
     NL_TEST_DEF("From String Conversion",                      CheckFromString),
     NL_TEST_DEF("To String Conversion",                        CheckToString),
+    NL_TEST_DEF("From String Conversion of Malformed Text",    CheckFromStringMalformed),
+    NL_TEST_DEF("To String Conversion into a Short Buffer",    CheckToStringTruncated),
 #if INET_CONFIG_ENABLE_IPV4
     NL_TEST_DEF("IPv4 Detection",                              CheckIsIPv4),
     NL_TEST_DEF("IPv4 Multicast Detection",                    CheckIsIPv4Multicast),
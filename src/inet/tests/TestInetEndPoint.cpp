@@ -48,6 +48,13 @@
 
 #include <nlunit-test.h>
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #include "TestInetCommon.h"
 #include "TestSetupSignalling.h"
 
@@ -485,6 +492,122 @@ static void TestInetEndPointInternal(nlTestSuite * inSuite, void * inContext)
     testTCPEP1->Shutdown();
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+// Test that a chain of packet buffers is sent as a single datagram
+static void TestInetSendChained(nlTestSuite * inSuite, void * inContext)
+{
+    const char kHeader[]    = "header:";
+    const char kPayload[]   = "payload";
+    UDPEndPoint * testUDPEP = nullptr;
+    IPAddress loopback;
+    sockaddr_in6 sockAddr = {};
+    socklen_t sockAddrLen = sizeof(sockAddr);
+    char received[64];
+    INET_ERROR err;
+
+    // Receive with a plain socket, so the test does not depend on the event loop.
+    int receiver = socket(AF_INET6, SOCK_DGRAM, 0);
+    NL_TEST_ASSERT(inSuite, receiver >= 0);
+    sockAddr.sin6_family = AF_INET6;
+    sockAddr.sin6_addr   = in6addr_loopback;
+    NL_TEST_ASSERT(inSuite, bind(receiver, reinterpret_cast<sockaddr *>(&sockAddr), sizeof(sockAddr)) == 0);
+    NL_TEST_ASSERT(inSuite, getsockname(receiver, reinterpret_cast<sockaddr *>(&sockAddr), &sockAddrLen) == 0);
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("::1", loopback));
+
+    err = gInet.NewUDPEndPoint(&testUDPEP);
+    NL_TEST_ASSERT(inSuite, err == INET_NO_ERROR);
+
+    PacketBufferHandle buf = PacketBufferHandle::NewWithData(kHeader, strlen(kHeader));
+    buf.AddToEnd(PacketBufferHandle::New(0));
+    buf.AddToEnd(PacketBufferHandle::NewWithData(kPayload, strlen(kPayload)));
+    NL_TEST_ASSERT(inSuite, buf->HasChainedBuffer());
+
+    err = testUDPEP->SendTo(loopback, ntohs(sockAddr.sin6_port), std::move(buf));
+    NL_TEST_ASSERT(inSuite, err == INET_NO_ERROR);
+
+    pollfd pollFd = { receiver, POLLIN, 0 };
+    NL_TEST_ASSERT(inSuite, poll(&pollFd, 1, 1000) == 1);
+    const ssize_t receivedLen = recv(receiver, received, sizeof(received), MSG_DONTWAIT);
+    NL_TEST_ASSERT(inSuite, receivedLen == static_cast<ssize_t>(strlen(kHeader) + strlen(kPayload)));
+    NL_TEST_ASSERT(inSuite, memcmp(received, "header:payload", strlen(kHeader) + strlen(kPayload)) == 0);
+
+    // A chain with more non-empty buffers than INET_CONFIG_MAX_SEND_IOV is rejected.
+    buf = PacketBufferHandle::NewWithData(kHeader, strlen(kHeader));
+    for (int i = 0; i < INET_CONFIG_MAX_SEND_IOV; i++)
+    {
+        buf.AddToEnd(PacketBufferHandle::NewWithData(kPayload, strlen(kPayload)));
+    }
+    err = testUDPEP->SendTo(loopback, ntohs(sockAddr.sin6_port), std::move(buf));
+    NL_TEST_ASSERT(inSuite, err == INET_ERROR_MESSAGE_TOO_LONG);
+
+    testUDPEP->Free();
+    close(receiver);
+}
+
+static void TestInetSendBatch(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kNumMessages = 5;
+    UDPEndPoint * testUDPEP       = nullptr;
+    IPAddress loopback;
+    sockaddr_in6 sockAddr = {};
+    socklen_t sockAddrLen = sizeof(sockAddr);
+    IPPacketInfo pktInfos[kNumMessages];
+    PacketBufferHandle bufs[kNumMessages];
+    size_t sentCount = 0;
+    char received[8];
+    INET_ERROR err;
+
+    int receiver = socket(AF_INET6, SOCK_DGRAM, 0);
+    NL_TEST_ASSERT(inSuite, receiver >= 0);
+    sockAddr.sin6_family = AF_INET6;
+    sockAddr.sin6_addr   = in6addr_loopback;
+    NL_TEST_ASSERT(inSuite, bind(receiver, reinterpret_cast<sockaddr *>(&sockAddr), sizeof(sockAddr)) == 0);
+    NL_TEST_ASSERT(inSuite, getsockname(receiver, reinterpret_cast<sockaddr *>(&sockAddr), &sockAddrLen) == 0);
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("::1", loopback));
+
+    err = gInet.NewUDPEndPoint(&testUDPEP);
+    NL_TEST_ASSERT(inSuite, err == INET_NO_ERROR);
+
+    for (size_t i = 0; i < kNumMessages; i++)
+    {
+        const char message = static_cast<char>('a' + i);
+
+        pktInfos[i].Clear();
+        pktInfos[i].DestAddress = loopback;
+        pktInfos[i].DestPort    = ntohs(sockAddr.sin6_port);
+        bufs[i]                 = PacketBufferHandle::NewWithData(&message, 1);
+        NL_TEST_ASSERT(inSuite, !bufs[i].IsNull());
+    }
+
+    err = testUDPEP->SendMsgs(pktInfos, bufs, kNumMessages, sentCount);
+    NL_TEST_ASSERT(inSuite, err == INET_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sentCount == kNumMessages);
+
+    // The messages arrive in order, and the caller keeps the buffers.
+    for (size_t i = 0; i < kNumMessages; i++)
+    {
+        pollfd pollFd = { receiver, POLLIN, 0 };
+        NL_TEST_ASSERT(inSuite, poll(&pollFd, 1, 1000) == 1);
+        NL_TEST_ASSERT(inSuite, recv(receiver, received, sizeof(received), MSG_DONTWAIT) == 1);
+        NL_TEST_ASSERT(inSuite, received[0] == static_cast<char>('a' + i));
+        NL_TEST_ASSERT(inSuite, !bufs[i].IsNull() && bufs[i]->DataLength() == 1);
+    }
+
+    // A message that cannot be sent stops the batch, and the ones before it are still sent.
+    bufs[2] = PacketBufferHandle::NewWithData("x", 1);
+    for (int i = 0; i < INET_CONFIG_MAX_SEND_IOV; i++)
+    {
+        bufs[2].AddToEnd(PacketBufferHandle::NewWithData("x", 1));
+    }
+    err = testUDPEP->SendMsgs(pktInfos, bufs, kNumMessages, sentCount);
+    NL_TEST_ASSERT(inSuite, err == INET_ERROR_MESSAGE_TOO_LONG);
+    NL_TEST_ASSERT(inSuite, sentCount == 2);
+
+    testUDPEP->Free();
+    close(receiver);
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 // Test the InetLayer resource limitation
 static void TestInetEndPointLimit(nlTestSuite * inSuite, void * inContext)
 {
@@ -534,6 +657,10 @@ static const nlTest sTests[] = { NL_TEST_DEF("InetEndPoint::PreTest", TestInetPr
                                  NL_TEST_DEF("InetEndPoint::TestInetError", TestInetError),
                                  NL_TEST_DEF("InetEndPoint::TestInetInterface", TestInetInterface),
                                  NL_TEST_DEF("InetEndPoint::TestInetEndPoint", TestInetEndPointInternal),
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+                                 NL_TEST_DEF("InetEndPoint::TestInetSendChained", TestInetSendChained),
+                                 NL_TEST_DEF("InetEndPoint::TestInetSendBatch", TestInetSendBatch),
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
                                  NL_TEST_DEF("InetEndPoint::TestEndPointLimit", TestInetEndPointLimit),
                                  NL_TEST_SENTINEL() };
 
@@ -0,0 +1,159 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the counting of the
+ *      joins of multicast groups by <tt>Inet::MulticastGroupTable</tt>.
+ *
+ */
+
+#include <inet/MulticastGroupTable.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::Inet;
+
+namespace {
+
+IPAddress MakeGroup(uint32_t aGroupId)
+{
+    return IPAddress::MakeIPv6WellKnownMulticast(kIPv6MulticastScope_Site, aGroupId);
+}
+
+InterfaceId MakeInterface(int aIndex)
+{
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+    static struct netif sInterfaces[2];
+    return &sInterfaces[aIndex];
+#else
+    return static_cast<InterfaceId>(aIndex + 1);
+#endif
+}
+
+void CheckJoinLeave(nlTestSuite * inSuite, void * inContext)
+{
+    MulticastGroupTable<4> table;
+    const IPAddress group  = MakeGroup(1);
+    const InterfaceId intf = MakeInterface(0);
+    bool isFirst           = false;
+    bool isLast            = false;
+
+    // Only the first join and the last leave reach the stack
+    NL_TEST_ASSERT(inSuite, table.Join(intf, group, isFirst) == INET_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, isFirst);
+    NL_TEST_ASSERT(inSuite, table.Join(intf, group, isFirst) == INET_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !isFirst);
+    NL_TEST_ASSERT(inSuite, table.GetCount() == 1);
+    NL_TEST_ASSERT(inSuite, table.IsJoined(intf, group));
+
+    NL_TEST_ASSERT(inSuite, table.Leave(intf, group, isLast) == INET_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !isLast);
+    NL_TEST_ASSERT(inSuite, table.IsJoined(intf, group));
+    NL_TEST_ASSERT(inSuite, table.Leave(intf, group, isLast) == INET_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, isLast);
+    NL_TEST_ASSERT(inSuite, !table.IsJoined(intf, group));
+    NL_TEST_ASSERT(inSuite, table.GetCount() == 0);
+
+    NL_TEST_ASSERT(inSuite, table.Leave(intf, group, isLast) == INET_ERROR_ADDRESS_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, !isLast);
+}
+
+void CheckInterfaces(nlTestSuite * inSuite, void * inContext)
+{
+    MulticastGroupTable<4> table;
+    const IPAddress group = MakeGroup(1);
+    bool isFirst          = false;
+    bool isLast           = false;
+
+    // A group is joined on each interface separately
+    NL_TEST_ASSERT(inSuite, table.Join(MakeInterface(0), group, isFirst) == INET_NO_ERROR && isFirst);
+    NL_TEST_ASSERT(inSuite, table.Join(MakeInterface(1), group, isFirst) == INET_NO_ERROR && isFirst);
+    NL_TEST_ASSERT(inSuite, table.Join(MakeInterface(1), MakeGroup(2), isFirst) == INET_NO_ERROR && isFirst);
+    NL_TEST_ASSERT(inSuite, table.GetCount() == 3);
+
+    NL_TEST_ASSERT(inSuite, table.Leave(MakeInterface(0), group, isLast) == INET_NO_ERROR && isLast);
+    NL_TEST_ASSERT(inSuite, !table.IsJoined(MakeInterface(0), group));
+    NL_TEST_ASSERT(inSuite, table.IsJoined(MakeInterface(1), group));
+    NL_TEST_ASSERT(inSuite, table.IsJoined(MakeInterface(1), MakeGroup(2)));
+
+    size_t count = 0;
+    table.ForEach([&count](InterfaceId, const IPAddress &) { count++; });
+    NL_TEST_ASSERT(inSuite, count == 2);
+
+    table.Clear();
+    NL_TEST_ASSERT(inSuite, table.GetCount() == 0);
+    NL_TEST_ASSERT(inSuite, !table.IsJoined(MakeInterface(1), group));
+}
+
+void CheckFull(nlTestSuite * inSuite, void * inContext)
+{
+    MulticastGroupTable<2> table;
+    const InterfaceId intf = MakeInterface(0);
+    bool isFirst           = false;
+    bool isLast            = false;
+
+    NL_TEST_ASSERT(inSuite, table.Join(intf, MakeGroup(1), isFirst) == INET_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, table.Join(intf, MakeGroup(2), isFirst) == INET_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, table.Join(intf, MakeGroup(3), isFirst) == INET_ERROR_NO_MEMORY);
+
+    // The groups already joined can still be joined again
+    NL_TEST_ASSERT(inSuite, table.Join(intf, MakeGroup(1), isFirst) == INET_NO_ERROR && !isFirst);
+
+    NL_TEST_ASSERT(inSuite, table.Leave(intf, MakeGroup(2), isLast) == INET_NO_ERROR && isLast);
+    NL_TEST_ASSERT(inSuite, table.Join(intf, MakeGroup(3), isFirst) == INET_NO_ERROR && isFirst);
+    NL_TEST_ASSERT(inSuite, table.IsJoined(intf, MakeGroup(1)));
+    NL_TEST_ASSERT(inSuite, table.IsJoined(intf, MakeGroup(3)));
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("JoinLeave",  CheckJoinLeave),
+    NL_TEST_DEF("Interfaces", CheckInterfaces),
+    NL_TEST_DEF("Full",       CheckFull),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestMulticastGroupTable(void)
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Inet-MulticastGroupTable",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMulticastGroupTable)
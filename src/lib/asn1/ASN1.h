@@ -120,6 +120,17 @@ public:
     ASN1_ERROR GetInteger(int64_t & val);
     ASN1_ERROR GetBoolean(bool & val);
     ASN1_ERROR GetObjectId(OID & oid);
+
+    /**
+     * Decode the AlgorithmIdentifier SEQUENCE the reader is positioned on, made of an algorithm OID optionally followed
+     * by a parameter OID, straight from its value and without entering it. The reader stays on the SEQUENCE.
+     *
+     * @param algorithm  The algorithm OID, kOID_Unknown if it is not in the OID table.
+     * @param parameter  The parameter OID, kOID_Unknown if it is not in the OID table and kOID_NotSpecified if absent.
+     *
+     * @return ASN1_ERROR_UNSUPPORTED_ENCODING if the parameters are present but are not an OID.
+     */
+    ASN1_ERROR GetAlgorithmIdentifier(OID & algorithm, OID & parameter);
     ASN1_ERROR GetUTCTime(ASN1UniversalTime & outTime);
     ASN1_ERROR GetGeneralizedTime(ASN1UniversalTime & outTime);
     ASN1_ERROR GetBitString(uint32_t & outVal);
@@ -158,11 +169,65 @@ private:
     ASN1_ERROR ExitContainer(void);
 };
 
+/**
+ *  @class ASN1Writer
+ *
+ *  @brief
+ *    Writes ASN.1 DER encodings into a buffer.
+ *
+ *    The lengths of constructed and encapsulating elements are only known once they end, so a buffer writer
+ *    reserves room for them and compacts the encoding in Finalize(). To produce an encoding without a buffer
+ *    large enough to hold it, encode it twice with the same sequence of calls: first with a writer initialized
+ *    with InitLengthCounter(), which records these lengths, then with a writer initialized with
+ *    InitStreamWriter(), which passes the final encoding to an output function as it goes. The second pass may
+ *    also write into a buffer sized for the final encoding, where each length is written once and nothing is
+ *    moved in Finalize().
+ */
 class DLL_EXPORT ASN1Writer
 {
 public:
+    /**
+     * Receives the encoding of a stream writer in order, a few bytes at a time.
+     */
+    typedef ASN1_ERROR (*OutputFunct)(void * context, const uint8_t * data, uint32_t dataLen);
+
     void Init(uint8_t * buf, uint32_t maxLen);
     void InitNullWriter(void);
+
+    /**
+     * Only record the lengths of the constructed and encapsulating elements, in the order they start.
+     *
+     * @param lengths     The array receiving the lengths.
+     * @param maxLengths  The size of the array. Writing more of these elements fails with ASN1_ERROR_OVERFLOW.
+     */
+    void InitLengthCounter(uint16_t * lengths, uint16_t maxLengths);
+
+    /**
+     * Pass the encoding to an output function instead of writing it into a buffer.
+     *
+     * @param output      The output function.
+     * @param context     The context of the output function.
+     * @param lengths     The lengths recorded by a length counter writer given the same sequence of calls.
+     * @param numLengths  The number of recorded lengths, as returned by GetLengthCount().
+     */
+    void InitStreamWriter(OutputFunct output, void * context, const uint16_t * lengths, uint16_t numLengths);
+
+    /**
+     * Write the encoding into a buffer like a stream writer, with the lengths recorded by a length counter writer, so
+     * that the buffer needs no room beyond the encoding itself.
+     *
+     * @param buf         The buffer receiving the encoding.
+     * @param maxLen      The size of the buffer. Writing more fails with ASN1_ERROR_OVERFLOW.
+     * @param lengths     The lengths recorded by a length counter writer given the same sequence of calls.
+     * @param numLengths  The number of recorded lengths, as returned by GetLengthCount().
+     */
+    void InitBufferWriter(uint8_t * buf, uint32_t maxLen, const uint16_t * lengths, uint16_t numLengths);
+
+    /**
+     * The number of lengths recorded by a length counter writer.
+     */
+    uint16_t GetLengthCount(void) const { return mNumLengths; }
+
     ASN1_ERROR Finalize(void);
     uint16_t GetLengthWritten(void) const;
 
@@ -170,6 +235,13 @@ public:
     ASN1_ERROR PutBoolean(bool val);
     ASN1_ERROR PutObjectId(const uint8_t * val, uint16_t valLen);
     ASN1_ERROR PutObjectId(OID oid);
+
+    /**
+     * Encode an AlgorithmIdentifier SEQUENCE made of an algorithm OID, followed by a parameter OID unless it is
+     * kOID_NotSpecified. Unlike a SEQUENCE written with StartConstructedType(), its length is known from the start,
+     * so it takes no deferred length.
+     */
+    ASN1_ERROR PutAlgorithmIdentifier(OID algorithm, OID parameter = kOID_NotSpecified);
     ASN1_ERROR PutString(uint32_t tag, const char * val, uint16_t valLen);
     ASN1_ERROR PutOctetString(const uint8_t * val, uint16_t valLen);
     ASN1_ERROR PutOctetString(uint8_t cls, uint32_t tag, const uint8_t * val, uint16_t valLen);
@@ -188,13 +260,39 @@ public:
     ASN1_ERROR PutValue(uint8_t cls, uint32_t tag, bool isConstructed, chip::TLV::TLVReader & val);
 
 private:
+    static constexpr size_t kMaxConstructedDepth = 16;
+
+    enum class Mode : uint8_t
+    {
+        kNull,
+        kBuffer,
+        kLengthCounter,
+        kStream,
+    };
+
     uint8_t * mBuf;
     uint8_t * mBufEnd;
     uint8_t * mWritePoint;
     uint8_t ** mDeferredLengthList;
 
+    // Length counter and stream writers.
+    OutputFunct mOutput;
+    void * mOutputContext;
+    uint16_t * mLengths;
+    const uint16_t * mRecordedLengths;
+    uint16_t mMaxLengths;
+    uint16_t mNumLengths;                          /**< Lengths recorded, or consumed by a stream writer. */
+    uint16_t mOpenElements[kMaxConstructedDepth]; /**< Indexes in mLengths of the elements whose length is unknown. */
+    uint8_t mDepth;
+    uint32_t mLengthWritten;
+    Mode mMode;
+
     ASN1_ERROR EncodeHead(uint8_t cls, uint32_t tag, bool isConstructed, int32_t len);
+    ASN1_ERROR WriteData(const uint8_t * data, uint32_t len);
+    ASN1_ERROR WriteData(chip::TLV::TLVReader & val, uint32_t len);
+    ASN1_ERROR CountLength(uint32_t len);
     ASN1_ERROR WriteDeferredLength(void);
+    static ASN1_ERROR WriteToBuffer(void * context, const uint8_t * data, uint32_t dataLen);
     static uint8_t BytesForLength(int32_t len);
     static void EncodeLength(uint8_t * buf, uint8_t bytesForLen, int32_t lenToEncode);
 };
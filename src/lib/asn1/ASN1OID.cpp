@@ -29,6 +29,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <support/CodeUtils.h>
 #include <support/DLLUtil.h>
 
 #define ASN1_DEFINE_OID_TABLE
@@ -96,6 +97,51 @@ ASN1_ERROR ASN1Reader::GetObjectId(OID & oid)
     return ASN1_NO_ERROR;
 }
 
+namespace {
+
+/**
+ * Decode an OBJECT IDENTIFIER with a single byte length at p, and move p past it.
+ */
+ASN1_ERROR DecodeShortObjectId(const uint8_t *& p, const uint8_t * end, OID & oid)
+{
+    VerifyOrReturnError(end - p >= 2, ASN1_ERROR_UNDERRUN);
+    VerifyOrReturnError(p[0] == kASN1UniversalTag_ObjectId, ASN1_ERROR_UNSUPPORTED_ENCODING);
+    VerifyOrReturnError(p[1] > 0 && p[1] < 0x80, ASN1_ERROR_UNSUPPORTED_ENCODING);
+    VerifyOrReturnError(end - p - 2 >= p[1], ASN1_ERROR_UNDERRUN);
+
+    oid = ParseObjectID(p + 2, p[1]);
+    p += 2 + p[1];
+    return ASN1_NO_ERROR;
+}
+
+} // namespace
+
+ASN1_ERROR ASN1Reader::GetAlgorithmIdentifier(OID & algorithm, OID & parameter)
+{
+    const uint8_t * p;
+    const uint8_t * end;
+
+    if (Value == nullptr)
+        return ASN1_ERROR_INVALID_STATE;
+    if (Class != kASN1TagClass_Universal || Tag != kASN1UniversalTag_Sequence || !Constructed)
+        return ASN1_ERROR_INVALID_ENCODING;
+    if (mElemStart + mHeadLen + ValueLen > mContainerEnd)
+        return ASN1_ERROR_UNDERRUN;
+
+    p   = Value;
+    end = Value + ValueLen;
+
+    ReturnErrorOnFailure(DecodeShortObjectId(p, end, algorithm));
+
+    parameter = kOID_NotSpecified;
+    if (p < end)
+    {
+        ReturnErrorOnFailure(DecodeShortObjectId(p, end, parameter));
+    }
+
+    return (p == end) ? ASN1_NO_ERROR : ASN1_ERROR_INVALID_ENCODING;
+}
+
 ASN1_ERROR ASN1Writer::PutObjectId(OID oid)
 {
     const uint8_t * encodedOID;
@@ -107,5 +153,31 @@ ASN1_ERROR ASN1Writer::PutObjectId(OID oid)
     return PutObjectId(encodedOID, encodedOIDLen);
 }
 
+ASN1_ERROR ASN1Writer::PutAlgorithmIdentifier(OID algorithm, OID parameter)
+{
+    const uint8_t * encodedAlgorithm;
+    const uint8_t * encodedParameter = nullptr;
+    uint16_t encodedAlgorithmLen;
+    uint16_t encodedParameterLen = 0;
+    int32_t len;
+
+    VerifyOrReturnError(GetEncodedObjectID(algorithm, encodedAlgorithm, encodedAlgorithmLen), ASN1_ERROR_UNKNOWN_OBJECT_ID);
+    if (parameter != kOID_NotSpecified)
+    {
+        VerifyOrReturnError(GetEncodedObjectID(parameter, encodedParameter, encodedParameterLen), ASN1_ERROR_UNKNOWN_OBJECT_ID);
+    }
+
+    // The OIDs in the table are all short enough for a single byte length
+    len = 2 + encodedAlgorithmLen + ((encodedParameter != nullptr) ? 2 + encodedParameterLen : 0);
+
+    ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_Sequence, true, len));
+    ReturnErrorOnFailure(PutObjectId(encodedAlgorithm, encodedAlgorithmLen));
+    if (encodedParameter != nullptr)
+    {
+        ReturnErrorOnFailure(PutObjectId(encodedParameter, encodedParameterLen));
+    }
+    return ASN1_NO_ERROR;
+}
+
 } // namespace ASN1
 } // namespace chip
@@ -59,6 +59,7 @@ void ASN1Writer::Init(uint8_t * buf, uint32_t maxLen)
     mBufEnd             = buf + maxLen;
     mBufEnd             = reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(mBufEnd) & ~3); // align on 32bit boundary
     mDeferredLengthList = reinterpret_cast<uint8_t **>(mBufEnd);
+    mMode               = Mode::kBuffer;
 }
 
 void ASN1Writer::InitNullWriter(void)
@@ -67,11 +68,69 @@ void ASN1Writer::InitNullWriter(void)
     mWritePoint         = nullptr;
     mBufEnd             = nullptr;
     mDeferredLengthList = nullptr;
+    mMode               = Mode::kNull;
+}
+
+void ASN1Writer::InitLengthCounter(uint16_t * lengths, uint16_t maxLengths)
+{
+    InitNullWriter();
+
+    mLengths       = lengths;
+    mMaxLengths    = maxLengths;
+    mNumLengths    = 0;
+    mDepth         = 0;
+    mLengthWritten = 0;
+    mMode          = Mode::kLengthCounter;
+}
+
+void ASN1Writer::InitStreamWriter(OutputFunct output, void * context, const uint16_t * lengths, uint16_t numLengths)
+{
+    InitNullWriter();
+
+    mOutput          = output;
+    mOutputContext   = context;
+    mRecordedLengths = lengths;
+    mMaxLengths      = numLengths;
+    mNumLengths      = 0;
+    mLengthWritten   = 0;
+    mMode            = Mode::kStream;
+}
+
+void ASN1Writer::InitBufferWriter(uint8_t * buf, uint32_t maxLen, const uint16_t * lengths, uint16_t numLengths)
+{
+    InitStreamWriter(WriteToBuffer, this, lengths, numLengths);
+
+    mBuf        = buf;
+    mWritePoint = buf;
+    mBufEnd     = buf + maxLen;
+}
+
+/**
+ * The output function of a buffer writer, appending to its buffer.
+ */
+ASN1_ERROR ASN1Writer::WriteToBuffer(void * context, const uint8_t * data, uint32_t dataLen)
+{
+    ASN1Writer * writer = static_cast<ASN1Writer *>(context);
+
+    VerifyOrReturnError(dataLen <= static_cast<uint32_t>(writer->mBufEnd - writer->mWritePoint), ASN1_ERROR_OVERFLOW);
+    memcpy(writer->mWritePoint, data, dataLen);
+    writer->mWritePoint += dataLen;
+
+    return ASN1_NO_ERROR;
 }
 
 ASN1_ERROR ASN1Writer::Finalize()
 {
-    if (mBuf != nullptr)
+    // Every element must have ended, and a stream writer must have used every recorded length.
+    if (mMode == Mode::kLengthCounter)
+    {
+        VerifyOrReturnError(mDepth == 0, ASN1_ERROR_INVALID_STATE);
+    }
+    else if (mMode == Mode::kStream)
+    {
+        VerifyOrReturnError(mNumLengths == mMaxLengths, ASN1_ERROR_INVALID_STATE);
+    }
+    else if (mMode == Mode::kBuffer)
     {
         uint8_t * compactPoint = mBuf;
         uint8_t * spanStart    = mBuf;
@@ -115,7 +174,16 @@ ASN1_ERROR ASN1Writer::Finalize()
 
 uint16_t ASN1Writer::GetLengthWritten() const
 {
-    return (mBuf != nullptr) ? mWritePoint - mBuf : 0;
+    switch (mMode)
+    {
+    case Mode::kBuffer:
+        return static_cast<uint16_t>(mWritePoint - mBuf);
+    case Mode::kLengthCounter:
+    case Mode::kStream:
+        return static_cast<uint16_t>(mLengthWritten);
+    default:
+        return 0;
+    }
 }
 
 ASN1_ERROR ASN1Writer::PutInteger(int64_t val)
@@ -140,14 +208,11 @@ ASN1_ERROR ASN1Writer::PutInteger(int64_t val)
 
 ASN1_ERROR ASN1Writer::PutBoolean(bool val)
 {
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
+    const uint8_t encodedVal = (val) ? 0xFF : 0;
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_Boolean, false, 1));
 
-    *mWritePoint++ = (val) ? 0xFF : 0;
-
-    return ASN1_NO_ERROR;
+    return WriteData(&encodedVal, 1);
 }
 
 ASN1_ERROR ASN1Writer::PutObjectId(const uint8_t * val, uint16_t valLen)
@@ -217,11 +282,9 @@ static uint8_t HighestBit(uint32_t v)
 
 ASN1_ERROR ASN1Writer::PutBitString(uint32_t val)
 {
+    uint8_t encodedVal[5];
     uint8_t len;
 
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
-
     if (val == 0)
         len = 1;
     else if (val < 256)
@@ -233,68 +296,52 @@ ASN1_ERROR ASN1Writer::PutBitString(uint32_t val)
     else
         len = 5;
 
-    ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, len));
-
     if (val == 0)
-        mWritePoint[0] = 0;
+        encodedVal[0] = 0;
     else
     {
-        mWritePoint[1] = ReverseBits(static_cast<uint8_t>(val));
+        encodedVal[1] = ReverseBits(static_cast<uint8_t>(val));
         if (len >= 3)
         {
             val >>= 8;
-            mWritePoint[2] = ReverseBits(static_cast<uint8_t>(val));
+            encodedVal[2] = ReverseBits(static_cast<uint8_t>(val));
             if (len >= 4)
             {
                 val >>= 8;
-                mWritePoint[3] = ReverseBits(static_cast<uint8_t>(val));
+                encodedVal[3] = ReverseBits(static_cast<uint8_t>(val));
                 if (len == 5)
                 {
                     val >>= 8;
-                    mWritePoint[4] = ReverseBits(static_cast<uint8_t>(val));
+                    encodedVal[4] = ReverseBits(static_cast<uint8_t>(val));
                 }
             }
         }
-        mWritePoint[0] = 7 - HighestBit(val);
+        encodedVal[0] = 7 - HighestBit(val);
     }
 
-    mWritePoint += len;
+    ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, len));
 
-    return ASN1_NO_ERROR;
+    return WriteData(encodedVal, len);
 }
 
 ASN1_ERROR ASN1Writer::PutBitString(uint8_t unusedBitCount, const uint8_t * encodedBits, uint16_t encodedBitsLen)
 {
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
-
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, encodedBitsLen + 1));
 
-    *mWritePoint++ = unusedBitCount;
+    ReturnErrorOnFailure(WriteData(&unusedBitCount, 1));
 
-    memcpy(mWritePoint, encodedBits, encodedBitsLen);
-    mWritePoint += encodedBitsLen;
-
-    return ASN1_NO_ERROR;
+    return WriteData(encodedBits, encodedBitsLen);
 }
 
 ASN1_ERROR ASN1Writer::PutBitString(uint8_t unusedBitCount, chip::TLV::TLVReader & encodedBits)
 {
-    uint32_t encodedBitsLen;
-
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
-
-    encodedBitsLen = encodedBits.GetLength();
+    uint32_t encodedBitsLen = encodedBits.GetLength();
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, encodedBitsLen + 1));
 
-    *mWritePoint++ = unusedBitCount;
-
-    encodedBits.GetBytes(mWritePoint, encodedBitsLen);
-    mWritePoint += encodedBitsLen;
+    ReturnErrorOnFailure(WriteData(&unusedBitCount, 1));
 
-    return ASN1_NO_ERROR;
+    return WriteData(encodedBits, encodedBitsLen);
 }
 
 static void itoa2(uint32_t val, uint8_t * buf)
@@ -335,16 +382,7 @@ ASN1_ERROR ASN1Writer::PutNull()
 
 ASN1_ERROR ASN1Writer::PutConstructedType(const uint8_t * val, uint16_t valLen)
 {
-    ASN1_ERROR err = ASN1_NO_ERROR;
-
-    // Do nothing for a null writer.
-    VerifyOrExit(mBuf != nullptr, err = ASN1_NO_ERROR);
-
-    memcpy(mWritePoint, val, valLen);
-    mWritePoint += valLen;
-
-exit:
-    return err;
+    return WriteData(val, valLen);
 }
 
 ASN1_ERROR ASN1Writer::StartConstructedType(uint8_t cls, uint32_t tag)
@@ -359,9 +397,6 @@ ASN1_ERROR ASN1Writer::EndConstructedType()
 
 ASN1_ERROR ASN1Writer::StartEncapsulatedType(uint8_t cls, uint32_t tag, bool bitStringEncoding)
 {
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
-
     ReturnErrorOnFailure(EncodeHead(cls, tag, false, kUnkownLength));
 
     // If the encapsulating type is BIT STRING, encode the unused bit count field.  Since the BIT
@@ -369,9 +404,9 @@ ASN1_ERROR ASN1Writer::StartEncapsulatedType(uint8_t cls, uint32_t tag, bool bit
     // the unused bit count is always 0.
     if (bitStringEncoding)
     {
-        if (mWritePoint == reinterpret_cast<uint8_t *>(mDeferredLengthList))
-            return ASN1_ERROR_OVERFLOW;
-        *mWritePoint++ = 0;
+        const uint8_t unusedBitCount = 0;
+
+        return WriteData(&unusedBitCount, 1);
     }
 
     return ASN1_NO_ERROR;
@@ -384,30 +419,82 @@ ASN1_ERROR ASN1Writer::EndEncapsulatedType()
 
 ASN1_ERROR ASN1Writer::PutValue(uint8_t cls, uint32_t tag, bool isConstructed, const uint8_t * val, uint16_t valLen)
 {
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
+    ReturnErrorOnFailure(EncodeHead(cls, tag, isConstructed, valLen));
+
+    return WriteData(val, valLen);
+}
+
+ASN1_ERROR ASN1Writer::PutValue(uint8_t cls, uint32_t tag, bool isConstructed, chip::TLV::TLVReader & val)
+{
+    uint32_t valLen = val.GetLength();
 
     ReturnErrorOnFailure(EncodeHead(cls, tag, isConstructed, valLen));
 
-    memcpy(mWritePoint, val, valLen);
-    mWritePoint += valLen;
+    return WriteData(val, valLen);
+}
 
-    return ASN1_NO_ERROR;
+ASN1_ERROR ASN1Writer::WriteData(const uint8_t * data, uint32_t len)
+{
+    switch (mMode)
+    {
+    case Mode::kBuffer:
+        VerifyOrReturnError(len <= static_cast<uint32_t>(reinterpret_cast<uint8_t *>(mDeferredLengthList) - mWritePoint),
+                            ASN1_ERROR_OVERFLOW);
+        memcpy(mWritePoint, data, len);
+        mWritePoint += len;
+        return ASN1_NO_ERROR;
+
+    case Mode::kLengthCounter:
+        return CountLength(len);
+
+    case Mode::kStream:
+        mLengthWritten += len;
+        return mOutput(mOutputContext, data, len);
+
+    default:
+        // Do nothing for a null writer.
+        return ASN1_NO_ERROR;
+    }
 }
 
-ASN1_ERROR ASN1Writer::PutValue(uint8_t cls, uint32_t tag, bool isConstructed, chip::TLV::TLVReader & val)
+ASN1_ERROR ASN1Writer::WriteData(chip::TLV::TLVReader & val, uint32_t len)
 {
-    uint32_t valLen;
+    const uint8_t * data;
 
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
+    switch (mMode)
+    {
+    case Mode::kBuffer:
+        VerifyOrReturnError(len <= static_cast<uint32_t>(reinterpret_cast<uint8_t *>(mDeferredLengthList) - mWritePoint),
+                            ASN1_ERROR_OVERFLOW);
+        val.GetBytes(mWritePoint, len);
+        mWritePoint += len;
+        return ASN1_NO_ERROR;
+
+    case Mode::kStream:
+        ReturnErrorOnFailure(val.GetDataPtr(data));
+        return WriteData(data, len);
+
+    default:
+        return WriteData(nullptr, len);
+    }
+}
 
-    valLen = val.GetLength();
+/**
+ * Add to the length of the innermost element whose length is not known yet, or to the total length written.
+ */
+ASN1_ERROR ASN1Writer::CountLength(uint32_t len)
+{
+    uint16_t * elemLen;
 
-    ReturnErrorOnFailure(EncodeHead(cls, tag, isConstructed, valLen));
+    if (mDepth == 0)
+    {
+        mLengthWritten += len;
+        return ASN1_NO_ERROR;
+    }
 
-    val.GetBytes(mWritePoint, valLen);
-    mWritePoint += valLen;
+    elemLen = &mLengths[mOpenElements[mDepth - 1]];
+    VerifyOrReturnError(len <= static_cast<uint32_t>(UINT16_MAX - *elemLen), ASN1_ERROR_LENGTH_OVERFLOW);
+    *elemLen = static_cast<uint16_t>(*elemLen + len);
 
     return ASN1_NO_ERROR;
 }
@@ -418,7 +505,7 @@ ASN1_ERROR ASN1Writer::EncodeHead(uint8_t cls, uint32_t tag, bool isConstructed,
     uint32_t totalLen;
 
     // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
+    VerifyOrReturnError(mMode != Mode::kNull, ASN1_NO_ERROR);
 
     // Only tags <= 31 supported. The implication of this is that encoded tags are exactly 1 byte long.
     VerifyOrReturnError(tag <= 0x1F, ASN1_ERROR_UNSUPPORTED_ENCODING);
@@ -426,6 +513,38 @@ ASN1_ERROR ASN1Writer::EncodeHead(uint8_t cls, uint32_t tag, bool isConstructed,
     // Only positive and kUnkownLength values are supported for len input.
     VerifyOrReturnError(len >= 0 || len == kUnkownLength, ASN1_ERROR_UNSUPPORTED_ENCODING);
 
+    // A length counter writer records the element if its length is unknown, which its content then adds up to, and otherwise
+    // counts the head here and the value as it is written.
+    if (mMode == Mode::kLengthCounter)
+    {
+        if (len == kUnkownLength)
+        {
+            VerifyOrReturnError(mNumLengths < mMaxLengths && mDepth < kMaxConstructedDepth, ASN1_ERROR_OVERFLOW);
+            mLengths[mNumLengths]   = 0;
+            mOpenElements[mDepth++] = mNumLengths++;
+            return ASN1_NO_ERROR;
+        }
+        return CountLength(1u + BytesForLength(len));
+    }
+
+    // A stream writer takes unknown lengths from those recorded by the length counter, in the same order.
+    if (mMode == Mode::kStream)
+    {
+        uint8_t head[1 + kLengthFieldReserveSize];
+
+        if (len == kUnkownLength)
+        {
+            VerifyOrReturnError(mNumLengths < mMaxLengths, ASN1_ERROR_INVALID_STATE);
+            len = mRecordedLengths[mNumLengths++];
+        }
+
+        bytesForLen = BytesForLength(len);
+        head[0]     = cls | (isConstructed ? 0x20 : 0) | tag;
+        EncodeLength(head + 1, bytesForLen, len);
+
+        return WriteData(head, 1u + bytesForLen);
+    }
+
     // Compute the number of bytes required to encode the length.
     bytesForLen = BytesForLength(len);
 
@@ -471,8 +590,19 @@ ASN1_ERROR ASN1Writer::WriteDeferredLength()
     uint8_t ** listEntry;
     uint32_t lenAdj;
 
-    // Do nothing for a null writer.
-    VerifyOrReturnError(mBuf != nullptr, ASN1_NO_ERROR);
+    // Do nothing for a null writer, or for a stream writer, which wrote the length with the head.
+    VerifyOrReturnError(mMode == Mode::kBuffer || mMode == Mode::kLengthCounter, ASN1_NO_ERROR);
+
+    // A length counter writer now knows the length of the element, and adds the whole element to its container.
+    if (mMode == Mode::kLengthCounter)
+    {
+        uint16_t elemLen;
+
+        VerifyOrReturnError(mDepth > 0, ASN1_ERROR_INVALID_STATE);
+        elemLen = mLengths[mOpenElements[--mDepth]];
+
+        return CountLength(1u + BytesForLength(elemLen) + elemLen);
+    }
 
     lenAdj = kLengthFieldReserveSize;
 
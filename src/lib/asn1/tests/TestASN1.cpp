@@ -306,6 +306,174 @@ static void TestASN1_NullWriter(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, encodedLen == 0);
 }
 
+struct StreamOutput
+{
+    uint8_t mBuf[sizeof(TestASN1_EncodedData)];
+    uint32_t mLen;
+};
+
+static ASN1_ERROR AppendStreamOutput(void * context, const uint8_t * data, uint32_t dataLen)
+{
+    StreamOutput * output = static_cast<StreamOutput *>(context);
+
+    if (dataLen > sizeof(output->mBuf) - output->mLen)
+        return ASN1_ERROR_OVERFLOW;
+
+    memcpy(output->mBuf + output->mLen, data, dataLen);
+    output->mLen += dataLen;
+
+    return ASN1_NO_ERROR;
+}
+
+static void TestASN1_StreamWriter(nlTestSuite * inSuite, void * inContext)
+{
+    ASN1_ERROR err;
+    ASN1Writer writer;
+    uint16_t lengths[16];
+    uint16_t numLengths;
+    StreamOutput output;
+
+    // First pass, recording the lengths of the constructed and encapsulating elements.
+    writer.InitLengthCounter(lengths, sizeof(lengths) / sizeof(lengths[0]));
+
+    err = EncodeASN1TestData(writer);
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == sizeof(TestASN1_EncodedData));
+
+    numLengths = writer.GetLengthCount();
+
+    // Second pass, producing the encoding.
+    output.mLen = 0;
+    writer.InitStreamWriter(AppendStreamOutput, &output, lengths, numLengths);
+
+    err = EncodeASN1TestData(writer);
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == sizeof(TestASN1_EncodedData));
+    NL_TEST_ASSERT(inSuite, output.mLen == sizeof(TestASN1_EncodedData));
+    NL_TEST_ASSERT(inSuite, memcmp(output.mBuf, TestASN1_EncodedData, sizeof(TestASN1_EncodedData)) == 0);
+
+    // The length counter fails if there is no room for the lengths.
+    writer.InitLengthCounter(lengths, static_cast<uint16_t>(numLengths - 1));
+
+    err = EncodeASN1TestData(writer);
+    NL_TEST_ASSERT(inSuite, err == ASN1_ERROR_OVERFLOW);
+}
+
+static void TestASN1_BufferWriter(nlTestSuite * inSuite, void * inContext)
+{
+    ASN1_ERROR err;
+    ASN1Writer writer;
+    uint16_t lengths[16];
+    uint16_t numLengths;
+    uint8_t buf[sizeof(TestASN1_EncodedData)];
+
+    writer.InitLengthCounter(lengths, sizeof(lengths) / sizeof(lengths[0]));
+
+    err = EncodeASN1TestData(writer);
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+
+    numLengths = writer.GetLengthCount();
+
+    // The second pass fits in a buffer of exactly the size of the encoding.
+    writer.InitBufferWriter(buf, sizeof(buf), lengths, numLengths);
+
+    err = EncodeASN1TestData(writer);
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == sizeof(TestASN1_EncodedData));
+    NL_TEST_ASSERT(inSuite, memcmp(buf, TestASN1_EncodedData, sizeof(TestASN1_EncodedData)) == 0);
+
+    // And fails in a smaller one.
+    writer.InitBufferWriter(buf, sizeof(buf) - 1, lengths, numLengths);
+
+    err = EncodeASN1TestData(writer);
+    NL_TEST_ASSERT(inSuite, err == ASN1_ERROR_OVERFLOW);
+}
+
+static void TestASN1_AlgorithmIdentifier(nlTestSuite * inSuite, void * inContext)
+{
+    ASN1_ERROR err;
+    uint8_t buf[128];
+    ASN1Writer writer;
+    ASN1Reader reader;
+    OID algorithm, parameter;
+    uint16_t encodedLen;
+
+    writer.Init(buf, sizeof(buf));
+
+    ASN1_START_SEQUENCE
+    {
+        err = writer.PutAlgorithmIdentifier(kOID_PubKeyAlgo_ECPublicKey, kOID_EllipticCurve_prime256v1);
+        SuccessOrExit(err);
+
+        err = writer.PutAlgorithmIdentifier(kOID_SigAlgo_ECDSAWithSHA256);
+        SuccessOrExit(err);
+
+        // The same encoding as a SEQUENCE holding the OIDs.
+        ASN1_START_SEQUENCE { ASN1_ENCODE_OBJECT_ID(kOID_SigAlgo_ECDSAWithSHA256); }
+        ASN1_END_SEQUENCE;
+
+        // Parameters other than an OID.
+        ASN1_START_SEQUENCE
+        {
+            ASN1_ENCODE_OBJECT_ID(kOID_PubKeyAlgo_ECPublicKey);
+            err = writer.PutNull();
+            SuccessOrExit(err);
+        }
+        ASN1_END_SEQUENCE;
+    }
+    ASN1_END_SEQUENCE;
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+
+    encodedLen = writer.GetLengthWritten();
+
+    reader.Init(buf, encodedLen);
+
+    ASN1_PARSE_ENTER_SEQUENCE
+    {
+        const uint8_t * sigAlgoEncoding;
+
+        ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_Sequence);
+        err = reader.GetAlgorithmIdentifier(algorithm, parameter);
+        NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, algorithm == kOID_PubKeyAlgo_ECPublicKey);
+        NL_TEST_ASSERT(inSuite, parameter == kOID_EllipticCurve_prime256v1);
+
+        ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_Sequence);
+        err = reader.GetAlgorithmIdentifier(algorithm, parameter);
+        NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, algorithm == kOID_SigAlgo_ECDSAWithSHA256);
+        NL_TEST_ASSERT(inSuite, parameter == kOID_NotSpecified);
+        sigAlgoEncoding = reader.GetValue();
+
+        ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_Sequence);
+        NL_TEST_ASSERT(inSuite, reader.GetValueLen() == sizeof(sOID_SigAlgo_ECDSAWithSHA256) + 2);
+        NL_TEST_ASSERT(inSuite, memcmp(reader.GetValue(), sigAlgoEncoding, reader.GetValueLen()) == 0);
+
+        ASN1_PARSE_ELEMENT(kASN1TagClass_Universal, kASN1UniversalTag_Sequence);
+        err = reader.GetAlgorithmIdentifier(algorithm, parameter);
+        NL_TEST_ASSERT(inSuite, err == ASN1_ERROR_UNSUPPORTED_ENCODING);
+        err = ASN1_NO_ERROR;
+    }
+    ASN1_EXIT_SEQUENCE;
+
+exit:
+    NL_TEST_ASSERT(inSuite, err == ASN1_NO_ERROR);
+}
+
 static void TestASN1_ObjectID(nlTestSuite * inSuite, void * inContext)
 {
     ASN1_ERROR err;
@@ -383,6 +551,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Test ASN1 encoding macros", TestASN1_Encode),
     NL_TEST_DEF("Test ASN1 decoding macros", TestASN1_Decode),
     NL_TEST_DEF("Test ASN1 NULL writer", TestASN1_NullWriter),
+    NL_TEST_DEF("Test ASN1 stream writer", TestASN1_StreamWriter),
+    NL_TEST_DEF("Test ASN1 buffer writer", TestASN1_BufferWriter),
+    NL_TEST_DEF("Test ASN1 AlgorithmIdentifier", TestASN1_AlgorithmIdentifier),
     NL_TEST_DEF("Test ASN1 Object IDs", TestASN1_ObjectID),
     NL_TEST_SENTINEL()
 };
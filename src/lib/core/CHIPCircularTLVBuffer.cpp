@@ -38,6 +38,7 @@
 
 #include <support/CodeUtils.h>
 
+#include <algorithm>
 #include <stdint.h>
 
 namespace chip {
@@ -107,6 +108,102 @@ void CHIPCircularTLVBuffer::Init(uint8_t * inBuffer, uint32_t inBufferLength)
     // skips over the elements does not complain about implicit
     // profile tags.
     mImplicitProfileId = kCommonProfileId;
+
+    SetElementIndex(nullptr, 0);
+}
+
+void CHIPCircularTLVBuffer::SetElementIndex(uint32_t * inLengths, uint32_t inCapacity)
+{
+    mElementLengths   = inLengths;
+    mElementIndexSize = (inLengths != nullptr) ? inCapacity : 0;
+    ResetElementIndex();
+}
+
+void CHIPCircularTLVBuffer::ResetElementIndex()
+{
+    mElementIndexStart = 0;
+    mElementIndexCount = 0;
+    mIndexedLength     = 0;
+}
+
+void CHIPCircularTLVBuffer::IndexTailElement(uint32_t inLength)
+{
+    VerifyOrReturn(mElementIndexSize != 0 && mQueueSize != 0 && inLength != 0);
+
+    const uint32_t tailOffset  = static_cast<uint32_t>(QueueTail() - mQueue);
+    const uint32_t startOffset = (tailOffset + mQueueSize - (inLength % mQueueSize)) % mQueueSize;
+
+    // Start over when elements were written without being indexed since the last indexed one.
+    if (mElementIndexCount != 0 && startOffset != mIndexedTailOffset)
+    {
+        ResetElementIndex();
+    }
+    if (mIndexedLength + inLength > mQueueLength)
+    {
+        ResetElementIndex();
+        VerifyOrReturn(inLength <= mQueueLength);
+    }
+
+    if (mElementIndexCount == mElementIndexSize)
+    {
+        mIndexedLength -= mElementLengths[mElementIndexStart];
+        mElementIndexStart = (mElementIndexStart + 1) % mElementIndexSize;
+        mElementIndexCount--;
+    }
+
+    mElementLengths[(mElementIndexStart + mElementIndexCount) % mElementIndexSize] = inLength;
+    mElementIndexCount++;
+    mIndexedLength += inLength;
+    mIndexedTailOffset = tailOffset;
+}
+
+bool CHIPCircularTLVBuffer::GetHeadElementLength(uint32_t & outLength) const
+{
+    VerifyOrReturnError(mElementIndexCount != 0, false);
+
+    // The head element is indexed once the elements written before the indexed ones were all evicted.  Part of an element
+    // being written may follow the indexed ones.
+    const uint32_t headOffset         = static_cast<uint32_t>(mQueueHead - mQueue) % mQueueSize;
+    const uint32_t indexedStartOffset = (mIndexedTailOffset + mQueueSize - (mIndexedLength % mQueueSize)) % mQueueSize;
+    VerifyOrReturnError(headOffset == indexedStartOffset && mIndexedLength <= mQueueLength, false);
+
+    outLength = mElementLengths[mElementIndexStart];
+    return true;
+}
+
+CHIP_ERROR CHIPCircularTLVBuffer::AlignHead(uint32_t inHeadOffset)
+{
+    VerifyOrReturnError(mQueueSize != 0 && inHeadOffset <= mQueueSize - mQueueLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint32_t headOffset = static_cast<uint32_t>(mQueueHead - mQueue) % mQueueSize;
+    const uint32_t shift      = (headOffset + mQueueSize - (inHeadOffset % mQueueSize)) % mQueueSize;
+
+    if (mQueueLength != 0)
+    {
+        std::rotate(mQueue, mQueue + shift, mQueue + mQueueSize);
+    }
+    mQueueHead = mQueue + (inHeadOffset % mQueueSize);
+
+    // the indexed elements moved along with the data
+    mIndexedTailOffset = (mIndexedTailOffset + mQueueSize - shift) % mQueueSize;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CHIPCircularTLVBuffer::SetBounds(uint8_t * inBuffer, uint32_t inBufferLength, uint8_t * inHead, uint32_t inDataLength)
+{
+    VerifyOrReturnError(inBuffer != nullptr && inBufferLength != 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(inHead >= inBuffer && inDataLength <= inBufferLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(static_cast<uint32_t>(inHead - inBuffer) <= inBufferLength - inDataLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueue       = inBuffer;
+    mQueueSize   = inBufferLength;
+    mQueueHead   = (inHead == inBuffer + inBufferLength) ? inBuffer : inHead;
+    mQueueLength = inDataLength;
+
+    ResetElementIndex();
+
+    return CHIP_NO_ERROR;
 }
 
 /**
@@ -132,20 +229,32 @@ CHIP_ERROR CHIPCircularTLVBuffer::EvictHead()
     CircularTLVReader reader;
     uint8_t * newHead;
     uint32_t newLen;
+    uint32_t headLength;
+    const bool indexed = GetHeadElementLength(headLength);
 
-    // find the boundaries of an event to throw away
-    reader.Init(*this);
-    reader.ImplicitProfileId = mImplicitProfileId;
+    if (indexed)
+    {
+        // the element index gives the boundaries of the event to throw away
+        VerifyOrReturnError(headLength != 0 && headLength <= mQueueLength, CHIP_ERROR_INCORRECT_STATE);
+        newLen  = mQueueLength - headLength;
+        newHead = mQueue + (static_cast<uint32_t>(mQueueHead - mQueue) + headLength) % mQueueSize;
+    }
+    else
+    {
+        // find the boundaries of an event to throw away
+        reader.Init(*this);
+        reader.ImplicitProfileId = mImplicitProfileId;
 
-    // position the reader on the first element
-    ReturnErrorOnFailure(reader.Next());
+        // position the reader on the first element
+        ReturnErrorOnFailure(reader.Next());
 
-    // skip to the next element
-    ReturnErrorOnFailure(reader.Skip());
+        // skip to the next element
+        ReturnErrorOnFailure(reader.Skip());
 
-    // record the state of the queue post-call
-    newLen  = mQueueLength - (reader.GetLengthRead());
-    newHead = const_cast<uint8_t *>(reader.GetReadPoint());
+        // record the state of the queue post-call
+        newLen  = mQueueLength - (reader.GetLengthRead());
+        newHead = const_cast<uint8_t *>(reader.GetReadPoint());
+    }
 
     // if a custom handler is installed, give it a chance to
     // process the element before we evict it from the buffer.
@@ -162,6 +271,18 @@ CHIP_ERROR CHIPCircularTLVBuffer::EvictHead()
     mQueueLength = newLen;
     mQueueHead   = newHead;
 
+    if (indexed)
+    {
+        mIndexedLength -= headLength;
+        mElementIndexStart = (mElementIndexStart + 1) % mElementIndexSize;
+        mElementIndexCount--;
+    }
+    else if (mIndexedLength > mQueueLength)
+    {
+        // the parsed element overlapped the indexed ones, which can no longer be trusted
+        ResetElementIndex();
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -70,6 +70,66 @@ public:
 
     CHIP_ERROR EvictHead();
 
+    /**
+     * @brief
+     *   Provide storage for the lengths of the top-level elements, so that EvictHead() finds the end of an indexed head
+     *   element without parsing it.
+     *
+     * The index only knows of the elements given to IndexTailElement(), and forgets the oldest when it is full, in which case
+     * the elements before the indexed ones are parsed as before.  Passing nullptr disables the index.
+     *
+     * @param[in] inLengths   Storage for @a inCapacity element lengths, which must outlive the buffer or the next call.
+     *
+     * @param[in] inCapacity  The number of element lengths that fit in @a inLengths.
+     */
+    void SetElementIndex(uint32_t * inLengths, uint32_t inCapacity);
+
+    /**
+     * @brief
+     *   Index the length of the top-level element that was just written at the tail of the buffer.
+     *
+     * @param[in] inLength The length, in bytes, of the element, which ends at the tail.
+     */
+    void IndexTailElement(uint32_t inLength);
+
+    /**
+     * @brief
+     *   Get the length of the element at the head of the buffer, if it is indexed.
+     *
+     * @param[out] outLength The length, in bytes, of the head element.
+     *
+     * @retval true if the head element is indexed.
+     */
+    bool GetHeadElementLength(uint32_t & outLength) const;
+
+    /**
+     * @brief
+     *   Rotate the backing store in place, so that the data starts at the given offset and does not wrap around its end.
+     *
+     * @param[in] inHeadOffset The offset of the head in the backing store, no larger than its free space.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT If the data does not fit after the offset.
+     */
+    CHIP_ERROR AlignHead(uint32_t inHeadOffset);
+
+    /**
+     * @brief
+     *   Move the bounds of the backing store without moving the data, so that buffers sharing one memory area pass free
+     *   space or their oldest elements to each other.  This forgets the element index.
+     *
+     * @param[in] inBuffer       The new backing store.
+     *
+     * @param[in] inBufferLength Length, in bytes, of the new backing store.
+     *
+     * @param[in] inHead         The head, which the @a inDataLength bytes of data follow without wrapping around the end of
+     *                           the new backing store.
+     *
+     * @param[in] inDataLength   The length, in bytes, of the data.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT If the data is not within the new backing store.
+     */
+    CHIP_ERROR SetBounds(uint8_t * inBuffer, uint32_t inBufferLength, uint8_t * inHead, uint32_t inDataLength);
+
     // chip::TLV::TLVBackingStore overrides:
     CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
     CHIP_ERROR GetNextBuffer(TLVReader & ioReader, const uint8_t *& outBufStart, uint32_t & outBufLen) override;
@@ -129,10 +189,21 @@ public:
                                    implementing the mProcessEvictedElement function. */
 
 private:
+    void ResetElementIndex();
+
     uint8_t * mQueue;
     uint32_t mQueueSize;
     uint8_t * mQueueHead;
     uint32_t mQueueLength;
+
+    // Lengths of the last elements written, oldest first, in a ring starting at mElementIndexStart.  The indexed elements are
+    // mIndexedLength bytes in a row ending at mIndexedTailOffset, which the bytes of an element being written may follow.
+    uint32_t * mElementLengths  = nullptr;
+    uint32_t mElementIndexSize  = 0;
+    uint32_t mElementIndexStart = 0;
+    uint32_t mElementIndexCount = 0;
+    uint32_t mIndexedLength     = 0;
+    uint32_t mIndexedTailOffset = 0;
 };
 
 class DLL_EXPORT CircularTLVReader : public TLVReader
@@ -436,15 +436,44 @@
 #define CHIP_CONFIG_PASE_RATE_LIMITER_MAX_ATTEMPTS 3
 #endif // CHIP_CONFIG_PASE_RATE_LIMITER_MAX_ATTEMPTS
 
+/**
+ *  @def CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS
+ *
+ *  @brief
+ *    The number of PASE and CASE handshakes a node responds to at the
+ *    same time. An initiator opening one more is answered with a busy
+ *    status report, which asks it to retry after
+ *    #CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS, instead of having
+ *    the handshakes in progress aborted or slowed down.
+ *
+ */
+#ifndef CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS
+#define CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS 2
+#endif // CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS
+
+/**
+ *  @def CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS
+ *
+ *  @brief
+ *    The minimum time (in milliseconds) a responder asks an initiator
+ *    it turned away as busy to wait before it retries, for each
+ *    handshake the responder has in progress.
+ *
+ */
+#ifndef CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS
+#define CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS 1000
+#endif // CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS
+
 /**
  *  @name chip Security Manager Memory Management Configuration
  *
  *  @brief
- *    The following definitions enable one of three potential chip
+ *    The following definitions enable one of four potential chip
  *    Security Manager memory-management options:
  *
  *      * #CHIP_CONFIG_MEMORY_MGMT_PLATFORM
  *      * #CHIP_CONFIG_MEMORY_MGMT_SIMPLE
+ *      * #CHIP_CONFIG_MEMORY_MGMT_TLSF
  *      * #CHIP_CONFIG_MEMORY_MGMT_MALLOC
  *
  *    Note that these options are mutually exclusive and only one
@@ -502,6 +531,25 @@
  *        #CHIP_CONFIG_MEMORY_MGMT_SIMPLE.
  *
  */
+/**
+ *  @def CHIP_CONFIG_MEMORY_MGMT_TLSF
+ *
+ *  @brief
+ *    Enable (1) or disable (0) support for a chip-provided
+ *    implementation of chip memory-management functions based on a
+ *    two-level segregated fit heap in a dedicated buffer, with O(1)
+ *    allocation and release and heap statistics.
+ *
+ *  @note This configuration is mutual exclusive with
+ *        #CHIP_CONFIG_MEMORY_MGMT_PLATFORM,
+ *        #CHIP_CONFIG_MEMORY_MGMT_SIMPLE and
+ *        #CHIP_CONFIG_MEMORY_MGMT_MALLOC.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_MGMT_TLSF
+#define CHIP_CONFIG_MEMORY_MGMT_TLSF 0
+#endif // CHIP_CONFIG_MEMORY_MGMT_TLSF
+
 #ifndef CHIP_CONFIG_MEMORY_MGMT_MALLOC
 #define CHIP_CONFIG_MEMORY_MGMT_MALLOC 1
 #endif // CHIP_CONFIG_MEMORY_MGMT_MALLOC
@@ -510,15 +558,84 @@
  *  @}
  */
 
-#if ((CHIP_CONFIG_MEMORY_MGMT_PLATFORM + CHIP_CONFIG_MEMORY_MGMT_SIMPLE + CHIP_CONFIG_MEMORY_MGMT_MALLOC) != 1)
-#error                                                                                                                             \
-    "Please assert exactly one of CHIP_CONFIG_MEMORY_MGMT_PLATFORM, CHIP_CONFIG_MEMORY_MGMT_SIMPLE, or CHIP_CONFIG_MEMORY_MGMT_MALLOC."
-#endif // ((CHIP_CONFIG_MEMORY_MGMT_PLATFORM + CHIP_CONFIG_MEMORY_MGMT_SIMPLE + CHIP_CONFIG_MEMORY_MGMT_MALLOC) != 1)
+#if ((CHIP_CONFIG_MEMORY_MGMT_PLATFORM + CHIP_CONFIG_MEMORY_MGMT_SIMPLE + CHIP_CONFIG_MEMORY_MGMT_TLSF +                           \
+      CHIP_CONFIG_MEMORY_MGMT_MALLOC) != 1)
+#error "Please assert exactly one CHIP_CONFIG_MEMORY_MGMT_... option."
+#endif
+
+/**
+ *  @def CHIP_CONFIG_MEMORY_TAGS
+ *
+ *  @brief
+ *    Enable (1) or disable (0) attributing heap allocations to the
+ *    subsystem set by chip::Platform::ScopedMemoryTag, so that the heap
+ *    statistics of the tlsf memory management show the bytes in use by
+ *    each subsystem.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_TAGS
+#define CHIP_CONFIG_MEMORY_TAGS 0
+#endif // CHIP_CONFIG_MEMORY_TAGS
+
+/**
+ *  @def CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+ *
+ *  @brief
+ *    Enable (1) or disable (0) a cache of free blocks for each thread
+ *    allocating through the malloc memory management, so that the
+ *    small blocks a thread keeps allocating and freeing are reused
+ *    without going through the allocator.  This requires thread_local
+ *    support.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+#define CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE 0
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+
+/**
+ *  @def CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE_DEPTH
+ *
+ *  @brief
+ *    The number of free blocks of each size class that the cache of
+ *    a thread holds, see #CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE.
+ *    Blocks freed beyond that go back to the allocator.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE_DEPTH
+#define CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE_DEPTH 16
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE_DEPTH
+
+/**
+ *  @def CHIP_CONFIG_MEMORY_MALLOC_STATS
+ *
+ *  @brief
+ *    Enable (1) or disable (0) counting the allocations, frees and
+ *    thread cache hits of the malloc memory management, read with
+ *    chip::Platform::MemoryGetMallocStats.  The counters are shared
+ *    by all threads.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_MALLOC_STATS
+#define CHIP_CONFIG_MEMORY_MALLOC_STATS 0
+#endif // CHIP_CONFIG_MEMORY_MALLOC_STATS
 
 #if !CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 #error "!CHIP_CONFIG_MEMORY_MGMT_MALLOC but getifaddrs() uses malloc()"
 #endif
 
+/**
+ *  @def CHIP_CONFIG_INLINE_CALLABLE_STORAGE_SIZE
+ *
+ *  @brief
+ *    The size, in bytes, of the buffer in which a chip::InlineCallable
+ *    holds its callable, such as a lambda and its captures, unless a
+ *    size is given to the template.
+ *
+ */
+#ifndef CHIP_CONFIG_INLINE_CALLABLE_STORAGE_SIZE
+#define CHIP_CONFIG_INLINE_CALLABLE_STORAGE_SIZE (4 * sizeof(void *))
+#endif // CHIP_CONFIG_INLINE_CALLABLE_STORAGE_SIZE
+
 /**
  *  @def CHIP_CONFIG_SIMPLE_ALLOCATOR_USE_SMALL_BUFFERS
  *
@@ -730,6 +847,46 @@
 #define CHIP_CONFIG_DEV_RANDOM_DEVICE_NAME "/dev/urandom"
 #endif // CHIP_CONFIG_DEV_RANDOM_DEVICE_NAME
 
+/**
+ *  @def CHIP_CONFIG_DRBG_PER_THREAD
+ *
+ *  @brief
+ *    Enable (1) or disable (0) a DRBG state and pool of random bytes
+ *    for each thread calling DRBG_get_bytes, so that threads do not
+ *    share one DRBG context.  This requires thread_local and
+ *    pthread_atfork support.
+ *
+ */
+#ifndef CHIP_CONFIG_DRBG_PER_THREAD
+#define CHIP_CONFIG_DRBG_PER_THREAD 0
+#endif // CHIP_CONFIG_DRBG_PER_THREAD
+
+/**
+ *  @def CHIP_CONFIG_DRBG_POOL_SIZE
+ *
+ *  @brief
+ *    The number of random bytes DRBG_get_bytes draws from the DRBG
+ *    at a time and hands out to smaller requests, such as message
+ *    counters, exchange ids and nonces.  Requests of this size or
+ *    more go to the DRBG directly.
+ *
+ *    The pool is not locked, so it is only enabled by default with
+ *    #CHIP_CONFIG_DRBG_PER_THREAD, which gives each thread its own.
+ *    A single pool shared by the tasks of a platform could hand the
+ *    same bytes to two tasks calling DRBG_get_bytes at once; enable it
+ *    there only if a single task draws random bytes.
+ *
+ *    Set to 0 to draw every request from the DRBG.
+ *
+ */
+#ifndef CHIP_CONFIG_DRBG_POOL_SIZE
+#if CHIP_CONFIG_DRBG_PER_THREAD
+#define CHIP_CONFIG_DRBG_POOL_SIZE 128
+#else // CHIP_CONFIG_DRBG_PER_THREAD
+#define CHIP_CONFIG_DRBG_POOL_SIZE 0
+#endif // CHIP_CONFIG_DRBG_PER_THREAD
+#endif // CHIP_CONFIG_DRBG_POOL_SIZE
+
 /**
  *  @name chip AES Block Cipher Algorithm Implementation Configuration.
  *
@@ -1261,6 +1418,23 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_MGR_INDEX
+ *
+ *  @brief
+ *    Enable hash indexes in the exchange manager, so that matching a
+ *    received message to its exchange context (by exchange ID and peer
+ *    node) and to an unsolicited message handler (by protocol ID and
+ *    message type) does not scan every pool entry. Worth enabling when
+ *    CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS is raised well beyond its
+ *    default; costs roughly 40 bytes of RAM per exchange context and
+ *    unsolicited message handler.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_MGR_INDEX
+#define CHIP_CONFIG_EXCHANGE_MGR_INDEX 0
+#endif // CHIP_CONFIG_EXCHANGE_MGR_INDEX
+
 /**
  *  @def CHIP_CONFIG_MAX_ACTIVE_CHANNELS
  *
@@ -1292,6 +1466,53 @@
 #define CHIP_CONFIG_NODE_ADDRESS_RESOLVE_TIMEOUT_MSECS (5000)
 #endif // CHIP_CONFIG_NODE_ADDRESS_RESOLVE_TIMEOUT_MSECS
 
+/**
+ *  @def CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of node addresses remembered by the minimal mDNS resolver,
+ *    for as long as the TTLs of their records allow. Node IDs found in
+ *    the cache resolve without sending a query. Controllers talking to
+ *    many nodes should raise this to the number of nodes they reconnect
+ *    to. A value of 0 disables the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE
+#define CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE 16
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_MDNS_RESOLVER_QUERY_INTERVAL_MSECS
+ *
+ *  @brief
+ *    Interval between the packets of queries sent by the minimal mDNS
+ *    resolver when many nodes are resolved at once, or refreshed. Each
+ *    packet carries as many questions as fit, the interval spreads the
+ *    packets and their responses over time. Refreshes of nodes already
+ *    resolved are sent in separate packets for each interface, on the
+ *    interface the nodes were seen on only.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_RESOLVER_QUERY_INTERVAL_MSECS
+#define CHIP_CONFIG_MDNS_RESOLVER_QUERY_INTERVAL_MSECS 50
+#endif // CHIP_CONFIG_MDNS_RESOLVER_QUERY_INTERVAL_MSECS
+
+/**
+ *  @def CHIP_CONFIG_MDNS_ADVERTISER_QNAME_STORAGE_SIZE
+ *
+ *  @brief
+ *    Size, in bytes, of the fixed storage holding the names advertised
+ *    by the minimal mDNS advertiser. Two of them are kept, one for the
+ *    names advertised and one to build new names into, so that records
+ *    whose names did not change are kept as they are. The default fits
+ *    the records of a commissionable node with the longest pairing
+ *    instruction on 64-bit platforms.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_ADVERTISER_QNAME_STORAGE_SIZE
+#define CHIP_CONFIG_MDNS_ADVERTISER_QNAME_STORAGE_SIZE 640
+#endif // CHIP_CONFIG_MDNS_ADVERTISER_QNAME_STORAGE_SIZE
+
 /**
  *  @def CHIP_CONFIG_CONNECT_IP_ADDRS
  *
@@ -1314,6 +1535,12 @@
  *
  *    1280 is the guaranteed minimum IPv6 MTU.
  *
+ *    This is also the path MTU a session over UDP or BLE starts with, until
+ *    an ICMPv6 Packet Too Big message lowers it. Each byte above 1280 lets the
+ *    messages of the session carry a byte more than kMaxAppMessageLen. A
+ *    device whose peers are all reached over Wi-Fi or Ethernet links may set
+ *    it to 1500, so that large reads take fewer messages.
+ *
  */
 #ifndef CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE
 #define CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE 1280
@@ -1475,6 +1702,37 @@
 #define CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES 5
 #endif // CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES
 
+/**
+ *  @def CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE
+ *
+ *  @brief
+ *    The number of successful certificate signature verifications
+ *    remembered by each CHIP certificate set, so that validating the
+ *    same certificate chain again only verifies the signatures that
+ *    changed. Each entry takes 32 bytes. Set to 0 to verify every
+ *    signature on each validation.
+ *
+ */
+#ifndef CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE
+#define CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_CERT_VERIFIED_SIGNATURE_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE
+ *
+ *  @brief
+ *    The number of CA public keys for which each CHIP certificate set
+ *    keeps a decoded and validated key, along with what the crypto
+ *    library precomputes for it, so that verifying more signatures of
+ *    the same root or intermediate CA skips that work. The keys are
+ *    allocated with chip::Platform::New() on first use. Set to 0 to
+ *    decode the CA public key for every signature.
+ *
+ */
+#ifndef CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE
+#define CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE 2
+#endif // CHIP_CONFIG_CERT_SIGNATURE_VERIFIER_CACHE_SIZE
+
 /**
  *  @def CHIP_CONFIG_DEBUG_CERT_VALIDATION
  *
@@ -1870,6 +2128,29 @@
 #define CHIP_DETAIL_LOGGING 1
 #endif // CHIP_DETAIL_LOGGING
 
+/**
+ *  @def CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY(module)
+ *
+ *  @brief
+ *    The most detailed category of the messages of a chip::Logging::LogModule
+ *    that are compiled in, as a constant expression. The messages of the
+ *    categories past it compile to nothing, the evaluation of their arguments
+ *    included, the same as the messages of a category disabled with
+ *    #CHIP_ERROR_LOGGING, #CHIP_PROGRESS_LOGGING or #CHIP_DETAIL_LOGGING.
+ *
+ *    For instance, to keep the detail messages of the exchange manager only:
+ *
+ *  @code
+ *  #define CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY(module)                                                                            \
+ *      ((module) == chip::Logging::kLogModule_ExchangeManager ? chip::Logging::kLogCategory_Detail                                \
+ *                                                             : chip::Logging::kLogCategory_Progress)
+ *  @endcode
+ *
+ */
+#ifndef CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY
+#define CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY(module) ((void) (module), chip::Logging::kLogCategory_Max)
+#endif // CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY
+
 /**
  * CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE
  *
@@ -1879,6 +2160,43 @@
 #define CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE 256
 #endif
 
+/**
+ *  @def CHIP_CONFIG_BINARY_LOGGING
+ *
+ *  @brief
+ *    If asserted (1), platforms that support it record log messages as
+ *    their format string and arguments in a chip::Logging::BinaryLogBuffer,
+ *    and format and write them out in the background, off the thread that
+ *    logs them.
+ */
+#ifndef CHIP_CONFIG_BINARY_LOGGING
+#define CHIP_CONFIG_BINARY_LOGGING 0
+#endif // CHIP_CONFIG_BINARY_LOGGING
+
+/**
+ *  @def CHIP_CONFIG_BINARY_LOG_RECORD_SIZE
+ *
+ *  @brief
+ *    The size of the record of a log message in a BinaryLogBuffer, in
+ *    bytes.  The string arguments of a message are copied into its record,
+ *    and cut short if they do not fit.
+ */
+#ifndef CHIP_CONFIG_BINARY_LOG_RECORD_SIZE
+#define CHIP_CONFIG_BINARY_LOG_RECORD_SIZE 128
+#endif // CHIP_CONFIG_BINARY_LOG_RECORD_SIZE
+
+/**
+ *  @def CHIP_CONFIG_BINARY_LOG_RECORD_COUNT
+ *
+ *  @brief
+ *    The number of log messages a platform's BinaryLogBuffer holds until
+ *    they are written out, a power of two.  Messages logged while it is
+ *    full are dropped, and counted.
+ */
+#ifndef CHIP_CONFIG_BINARY_LOG_RECORD_COUNT
+#define CHIP_CONFIG_BINARY_LOG_RECORD_COUNT 256
+#endif // CHIP_CONFIG_BINARY_LOG_RECORD_COUNT
+
 /**
  *  @def CHIP_CONFIG_ENABLE_FUNCT_ERROR_LOGGING
  *
@@ -1945,6 +2263,34 @@
 #define CHIP_CONFIG_MSG_COUNTER_SYNC_RESP_TIMEOUT 2000
 #endif // CHIP_CONFIG_MSG_COUNTER_SYNC_RESP_TIMEOUT
 
+/**
+ *  @def CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER
+ *
+ *  @brief
+ *    The maximum number of outgoing, and of incoming, messages that
+ *    are queued for a peer while its message counter is being
+ *    synchronized. The messages queued for a peer share a single
+ *    synchronization request, and are flushed together once it
+ *    completes.
+ *
+ */
+#ifndef CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER
+#define CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER 4
+#endif // CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER
+
+/**
+ *  @def CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT
+ *
+ *  @brief
+ *    The amount of time (in milliseconds) after which a message
+ *    queued for message counter synchronization is discarded if
+ *    the counter of its peer is still unknown.
+ *
+ */
+#ifndef CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT
+#define CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT 2000
+#endif // CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT
+
 /**
  *  @def CHIP_CONFIG_TEST
  *
@@ -2309,6 +2655,266 @@
 #define CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE 16
 #endif // CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_PEER_CONNECTION_INDEX
+ *
+ * @brief Enable hash indexes over the peer connection pool so that
+ * lookups by local key ID and peer node ID do not scan every entry.
+ * Worth enabling on controllers and bridges that raise
+ * CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE well beyond its default; costs
+ * roughly 32 bytes of RAM per pool entry.
+ */
+#ifndef CHIP_CONFIG_PEER_CONNECTION_INDEX
+#define CHIP_CONFIG_PEER_CONNECTION_INDEX 0
+#endif // CHIP_CONFIG_PEER_CONNECTION_INDEX
+
+/**
+ * @def CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE
+ *
+ * @brief Define the number of message counters below the highest one
+ * received from a peer that are remembered, so that messages delivered
+ * out of order within that many counters are accepted while their
+ * replays are detected. Must be a multiple of 64; each peer connection
+ * holds one bit per counter.
+ */
+#ifndef CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE
+#define CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE 128
+#endif // CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE
+ *
+ * @brief Number of encrypted messages the secure session manager holds
+ * back until the end of the current event loop iteration, to send them
+ * back to back, and to drop the standalone acks made redundant by an ack
+ * piggybacked on a later message of the same exchange. Errors of the
+ * transport are then logged, rather than returned by SendMessage. Set to
+ * 0 to send every message as soon as it is encrypted.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE
+#define CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE 0
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_SEND_BURST
+ *
+ * @brief Number of queued messages the secure session manager sends at
+ * the end of an event loop iteration. The messages left wait for the
+ * next iteration, which lets the messages received in between, and their
+ * responses, get ahead of them. Defaults to the whole queue.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_SEND_BURST
+#define CHIP_CONFIG_SECURE_SESSION_SEND_BURST CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_BURST
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE
+ *
+ * @brief Share of the queued messages sent that are of the interactive
+ * traffic class, when messages of several classes are queued. The
+ * messages of each class are sent in order, and those of a class with
+ * the higher priority first, until it has had its share of a round.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE
+#define CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE 8
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_REPORTING
+ *
+ * @brief Share of the queued messages sent that are of the reporting
+ * traffic class. See CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_REPORTING
+#define CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_REPORTING 2
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_REPORTING
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_BULK
+ *
+ * @brief Share of the queued messages sent that are of the bulk traffic
+ * class. See CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_BULK
+#define CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_BULK 1
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_BULK
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES
+ *
+ * @brief Number of device objects a CHIP device controller keeps in
+ * memory at the same time, i.e. how many paired devices it can be
+ * talking to at once.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES
+#define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES 64
+#endif // CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES
+ *
+ * @brief Number of devices a CHIP device commissioner can keep paired.
+ * The paired node IDs are persisted in pages of
+ * CHIP_CONFIG_CONTROLLER_PAIRED_DEVICE_INDEX_PAGE_SIZE IDs, of which
+ * only one is held in memory.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES
+#define CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES 128
+#endif // CHIP_CONFIG_CONTROLLER_MAX_PAIRED_DEVICES
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_PAIRED_DEVICE_INDEX_PAGE_SIZE
+ *
+ * @brief Number of node IDs in a page of the persisted index of the
+ * devices paired by a CHIP device commissioner. Pairing or unpairing
+ * a device rewrites at most two pages of 8 bytes per ID.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_PAIRED_DEVICE_INDEX_PAGE_SIZE
+#define CHIP_CONFIG_CONTROLLER_PAIRED_DEVICE_INDEX_PAGE_SIZE 32
+#endif // CHIP_CONFIG_CONTROLLER_PAIRED_DEVICE_INDEX_PAGE_SIZE
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+ *
+ * @brief Treat the active device objects of a CHIP device controller
+ * as a cache over the paired devices. They are indexed by node ID,
+ * and when all of them are in use the least recently used one is
+ * persisted and reused, to be reloaded from storage the next time it
+ * is needed. Without it, getting one more device than
+ * CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES fails until one is
+ * released. Note that an evicted device object must not be used any
+ * more by the application.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+#define CHIP_CONFIG_CONTROLLER_DEVICE_CACHE 0
+#endif // CHIP_CONFIG_CONTROLLER_DEVICE_CACHE
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES
+ *
+ * @brief Number of paired devices a CHIP device controller can prewarm,
+ * i.e. get ready for use by resolving their addresses and loading their
+ * device objects and secure sessions ahead of the first command sent to
+ * them. Must not exceed CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES. Set to
+ * 0 to disable prewarming.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES
+#define CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES 0
+#endif // CHIP_CONFIG_CONTROLLER_PREWARM_MAX_DEVICES
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_PREWARM_CONCURRENCY
+ *
+ * @brief Number of address resolutions a CHIP device controller keeps
+ * outstanding while prewarming its paired devices.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_PREWARM_CONCURRENCY
+#define CHIP_CONFIG_CONTROLLER_PREWARM_CONCURRENCY 4
+#endif // CHIP_CONFIG_CONTROLLER_PREWARM_CONCURRENCY
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_PREWARM_TIMEOUT_MS
+ *
+ * @brief How long, in milliseconds, a CHIP device controller waits for
+ * the addresses of the devices it prewarms. The devices not resolved by
+ * then are reported with CHIP_ERROR_TIMEOUT.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_PREWARM_TIMEOUT_MS
+#define CHIP_CONFIG_CONTROLLER_PREWARM_TIMEOUT_MS 10000
+#endif // CHIP_CONFIG_CONTROLLER_PREWARM_TIMEOUT_MS
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_CONCURRENT_PAIRINGS
+ *
+ * @brief Number of devices a CHIP device commissioner can be pairing at
+ * the same time. Each pairing holds a PASE session. At most one of them
+ * can be over BLE.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_CONCURRENT_PAIRINGS
+#define CHIP_CONFIG_CONTROLLER_MAX_CONCURRENT_PAIRINGS 1
+#endif // CHIP_CONFIG_CONTROLLER_MAX_CONCURRENT_PAIRINGS
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_PAIRING_MAX_RETRIES
+ *
+ * @brief Number of times a CHIP device commissioner starts a PASE
+ * handshake again, over IP, when the device answers that it is busy,
+ * before it reports the pairing as failed with CHIP_ERROR_BUSY.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_PAIRING_MAX_RETRIES
+#define CHIP_CONFIG_CONTROLLER_PAIRING_MAX_RETRIES 5
+#endif // CHIP_CONFIG_CONTROLLER_PAIRING_MAX_RETRIES
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_BASE_MS
+ *
+ * @brief Backoff, in milliseconds, of the first retry of a PASE
+ * handshake a device was busy for. It doubles with each retry, up to
+ * CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_MAX_MS. Half of it is random, for
+ * the controllers turned away at the same time not to come back at the
+ * same time, and is added to the wait the device asked for when that is
+ * longer than the other half.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_BASE_MS
+#define CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_BASE_MS 500
+#endif // CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_BASE_MS
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_MAX_MS
+ *
+ * @brief Longest backoff, in milliseconds, before a retry of a PASE
+ * handshake a device was busy for.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_MAX_MS
+#define CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_MAX_MS 16000
+#endif // CHIP_CONFIG_CONTROLLER_PAIRING_RETRY_MAX_MS
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES
+ *
+ * @brief Number of attribute reads a device object of a CHIP device
+ * controller can gather into a single Read Request. Every device
+ * object holds that many attribute paths and callbacks.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES
+#define CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES 24
+#endif // CHIP_CONFIG_CONTROLLER_MAX_READ_ATTRIBUTES
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_PENDING_RESPONSES
+ *
+ * @brief Number of cluster commands sent with InlineCallable response
+ * handlers that a CHIP device controller can be waiting on the responses
+ * of, across all devices. The handlers are held in a static pool.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_PENDING_RESPONSES
+#define CHIP_CONFIG_CONTROLLER_MAX_PENDING_RESPONSES 16
+#endif // CHIP_CONFIG_CONTROLLER_MAX_PENDING_RESPONSES
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES
+ *
+ * @brief Number of attribute values a device object of a CHIP device
+ * controller caches from the responses to its Read Requests, so that
+ * reads of attributes it received recently are served without a
+ * request. Serving is enabled by a non-zero attribute cache freshness
+ * in the controller's init params. Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES
+#define CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES 0
+#endif // CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRIES
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRY_SIZE
+ *
+ * @brief Largest TLV encoding of an attribute value, in bytes, that the
+ * attribute cache of a device object keeps. Larger values are always
+ * read from the device.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRY_SIZE
+#define CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRY_SIZE 32
+#endif // CHIP_CONFIG_CONTROLLER_ATTRIBUTE_CACHE_ENTRY_SIZE
+
 /**
  * @def CHIP_PEER_CONNECTION_TIMEOUT_MS
  *
@@ -2320,13 +2926,16 @@
 #endif // CHIP_PEER_CONNECTION_TIMEOUT_MS
 
 /**
- * @def CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
+ * @def CHIP_PEER_CONNECTION_TIMEOUT_CHECK_SLACK_MS
  *
- * @brief How frequent are peer connections checked for timeouts.
+ * @brief How much later than the expiry of the least recently active peer
+ *        connection it may be expired, so that the check shares a wakeup
+ *        with another timer. The check runs only when a connection is due
+ *        to expire, not periodically.
  */
-#ifndef CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
-#define CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS 5000
-#endif // CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
+#ifndef CHIP_PEER_CONNECTION_TIMEOUT_CHECK_SLACK_MS
+#define CHIP_PEER_CONNECTION_TIMEOUT_CHECK_SLACK_MS 1000
+#endif // CHIP_PEER_CONNECTION_TIMEOUT_CHECK_SLACK_MS
 
 /**
  *  @def CHIP_CONFIG_MAX_BINDINGS
@@ -2355,6 +2964,203 @@
 #define CHIP_CONFIG_MAX_DEVICE_ADMINS 16
 #endif // CHIP_CONFIG_MAX_DEVICE_ADMINS
 
+/**
+ * @def CHIP_CONFIG_ADMIN_PAIRING_TABLE_INDEX
+ *
+ * @brief Enable hash indexes over the admin pairing table so that
+ * lookups by admin ID, done for every secure message received, and by
+ * fabric ID do not scan every entry. Worth enabling on devices that
+ * raise CHIP_CONFIG_MAX_DEVICE_ADMINS well beyond its default; costs
+ * roughly 40 bytes of RAM per admin.
+ */
+#ifndef CHIP_CONFIG_ADMIN_PAIRING_TABLE_INDEX
+#define CHIP_CONFIG_ADMIN_PAIRING_TABLE_INDEX 0
+#endif // CHIP_CONFIG_ADMIN_PAIRING_TABLE_INDEX
+
+/**
+ * @def CHIP_CONFIG_CASE_RESUMPTION_TABLE_SIZE
+ *
+ * @brief Number of CASE session resumption tickets a
+ * chip::CASEResumptionTable holds, i.e. number of peers that can
+ * re-establish a CASE session without a full Sigma handshake. When
+ * the table is full, the least recently used ticket is replaced.
+ */
+#ifndef CHIP_CONFIG_CASE_RESUMPTION_TABLE_SIZE
+#define CHIP_CONFIG_CASE_RESUMPTION_TABLE_SIZE 8
+#endif // CHIP_CONFIG_CASE_RESUMPTION_TABLE_SIZE
+
+/**
+ * @def CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES
+ *
+ * @brief Enable (1) or disable (0) tables of precomputed multiples of
+ * the SPAKE2+ points M and N, shared by all the Spake2p contexts of
+ * the process. They speed up the point multiplications of PASE, at the
+ * cost of about 300 kB of memory with OpenSSL, and a few kB with
+ * mbedTLS, where they only help if MBEDTLS_ECP_FIXED_POINT_OPTIM is
+ * enabled.
+ */
+#ifndef CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES
+#define CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES 0
+#endif // CHIP_CONFIG_SPAKE2P_FIXED_BASE_TABLES
+
+/**
+ *  @def CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES
+ *
+ *  @brief
+ *    Number of encoded attribute data elements the interaction model
+ *    reporting engine keeps, so that read handlers reporting the same
+ *    attribute path in the same round copy the encoding instead of
+ *    reading and encoding the attribute again. A cached element is
+ *    dropped when the attribute changes, and the whole cache is dropped
+ *    once no read handler has a report pending. Set to 0 to disable.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES
+#define CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES 0
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRIES
+
+/**
+ *  @def CHIP_CONFIG_IM_REPORT_CACHE_ENTRY_SIZE
+ *
+ *  @brief
+ *    Largest encoded attribute data element, in bytes, that the reporting
+ *    engine caches. Larger elements are encoded for each read handler.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_CACHE_ENTRY_SIZE
+#define CHIP_CONFIG_IM_REPORT_CACHE_ENTRY_SIZE 64
+#endif // CHIP_CONFIG_IM_REPORT_CACHE_ENTRY_SIZE
+
+/**
+ *  @def CHIP_CONFIG_IM_REPORT_WAKE_SLACK_MS
+ *
+ *  @brief
+ *    How much later, in milliseconds, than it is due the interaction model
+ *    reporting engine may send a report so that it goes out at the next
+ *    wake of the node, as set by the System::Layer wake alignment period,
+ *    rather than waking the node on its own. The alignment only applies
+ *    when the platform sets a wake alignment period, such as the data poll
+ *    period of a sleepy end device.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_WAKE_SLACK_MS
+#define CHIP_CONFIG_IM_REPORT_WAKE_SLACK_MS 1000
+#endif // CHIP_CONFIG_IM_REPORT_WAKE_SLACK_MS
+
+/**
+ *  @def CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+ *
+ *  @brief
+ *    When enabled, the interaction model command senders and handlers,
+ *    read clients and read handlers are created on the heap as they are
+ *    first needed, up to the CHIP_MAX_NUM_* bounds, instead of being
+ *    statically allocated. This suits controllers that need a large
+ *    number of concurrent interactions.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+#define CHIP_CONFIG_IM_OBJECT_POOL_HEAP 0
+#endif // CHIP_CONFIG_IM_OBJECT_POOL_HEAP
+
+/**
+ *  @def CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER
+ *
+ *  @brief
+ *    Number of event paths a read handler keeps from the event path list
+ *    of a read or subscribe request. The events of a subscription are
+ *    filtered by these paths. A request with more event paths is
+ *    rejected.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER
+#define CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER 4
+#endif // CHIP_CONFIG_IM_MAX_EVENT_PATHS_PER_READ_HANDLER
+
+/**
+ *  @def CHIP_CONFIG_IM_DATA_VERSIONS_PER_READ_CLIENT
+ *
+ *  @brief
+ *    Number of attribute paths a read client keeps the data version of,
+ *    from the reports it gets. The later requests of the client for
+ *    these paths carry the versions, for the clusters which have not
+ *    changed since to be left out of their reports. The paths past
+ *    this number are always reported in full.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_DATA_VERSIONS_PER_READ_CLIENT
+#define CHIP_CONFIG_IM_DATA_VERSIONS_PER_READ_CLIENT 4
+#endif // CHIP_CONFIG_IM_DATA_VERSIONS_PER_READ_CLIENT
+
+/**
+ *  @def CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE
+ *
+ *  @brief
+ *    Largest record, in bytes, of a subscription kept in persistent
+ *    storage for it to be resumed after a reboot: its peer, paths,
+ *    minimum interval and event numbers. A subscription whose record
+ *    does not fit is not kept, and its initiator has to
+ *    subscribe again once the device restarts.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE
+#define CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE 512
+#endif // CHIP_CONFIG_IM_PERSISTED_SUBSCRIPTION_SIZE
+
+/**
+ *  @def CHIP_CONFIG_DEVICE_CALLBACKS_MGR_BUCKETS
+ *
+ *  @brief
+ *    The number of hash buckets of each of the response and report
+ *    callback tables of the controller's device callbacks manager. Each
+ *    bucket costs a list head; controllers with thousands of outstanding
+ *    callbacks should raise it so that lookups stay short.
+ *
+ */
+#ifndef CHIP_CONFIG_DEVICE_CALLBACKS_MGR_BUCKETS
+#define CHIP_CONFIG_DEVICE_CALLBACKS_MGR_BUCKETS 16
+#endif // CHIP_CONFIG_DEVICE_CALLBACKS_MGR_BUCKETS
+
+/**
+ *  @def CHIP_CONFIG_DEVICE_CALLBACKS_MGR_MAX_RESPONSE_DEADLINES
+ *
+ *  @brief
+ *    The maximum number of response callbacks of the controller's device
+ *    callbacks manager that can have a deadline at once.
+ *
+ */
+#ifndef CHIP_CONFIG_DEVICE_CALLBACKS_MGR_MAX_RESPONSE_DEADLINES
+#define CHIP_CONFIG_DEVICE_CALLBACKS_MGR_MAX_RESPONSE_DEADLINES 32
+#endif // CHIP_CONFIG_DEVICE_CALLBACKS_MGR_MAX_RESPONSE_DEADLINES
+
+/**
+ *  @def CHIP_CONFIG_ATTRIBUTE_OBSERVER_BUCKETS
+ *
+ *  @brief
+ *    The number of hash buckets of the attribute observer registry,
+ *    which attribute changes are dispatched through to the in-process
+ *    observers of their endpoint, cluster and attribute. Each bucket
+ *    costs a list head.
+ *
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_OBSERVER_BUCKETS
+#define CHIP_CONFIG_ATTRIBUTE_OBSERVER_BUCKETS 16
+#endif // CHIP_CONFIG_ATTRIBUTE_OBSERVER_BUCKETS
+
+/**
+ *  @def CHIP_CONFIG_NOC_BATCH_MAX_IN_FLIGHT
+ *
+ *  @brief
+ *    The number of node operational certificates a
+ *    chip::Credentials::NOCBatchIssuer has posted to its worker pool
+ *    at once. Once a certificate is issued, the next request of the
+ *    batch takes its place, so this only needs to keep every worker
+ *    thread busy.
+ *
+ */
+#ifndef CHIP_CONFIG_NOC_BATCH_MAX_IN_FLIGHT
+#define CHIP_CONFIG_NOC_BATCH_MAX_IN_FLIGHT 8
+#endif // CHIP_CONFIG_NOC_BATCH_MAX_IN_FLIGHT
+
 /**
  * @def CHIP_NON_PRODUCTION_MARKER
  *
@@ -618,6 +618,15 @@ bool FormatCHIPError(char * buf, uint16_t bufSize, int32_t err)
     case CHIP_ERROR_PEER_NODE_NOT_FOUND:
         desc = "Unable to find the peer node";
         break;
+    case CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED:
+        desc = "Duplicate message received";
+        break;
+    case CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW:
+        desc = "Message counter out of window";
+        break;
+    case CHIP_ERROR_BUSY:
+        desc = "Peer busy";
+        break;
     }
 #endif // !CHIP_CONFIG_SHORT_ERROR_STR
 
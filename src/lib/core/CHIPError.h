@@ -1777,6 +1777,30 @@ typedef CHIP_CONFIG_ERROR_TYPE CHIP_ERROR;
  */
 #define CHIP_ERROR_HSM                      					_CHIP_ERROR(189)
 
+/**
+ * @def CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED
+ *
+ * @brief
+ *   A message with the same counter was received from the peer already
+ */
+#define CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED                    _CHIP_ERROR(190)
+
+/**
+ * @def CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW
+ *
+ * @brief
+ *   The counter of the message is too old to tell whether it was received already
+ */
+#define CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW                 _CHIP_ERROR(191)
+
+/**
+ * @def CHIP_ERROR_BUSY
+ *
+ * @brief
+ *   The peer is busy, and asked for the request to be retried later
+ */
+#define CHIP_ERROR_BUSY                                          _CHIP_ERROR(192)
+
 /**
  *  @}
  */
@@ -89,3 +89,91 @@
 #ifndef CHIP_CONFIG_EVENT_LOGGING_EXTERNAL_EVENT_SUPPORT
 #define CHIP_CONFIG_EVENT_LOGGING_EXTERNAL_EVENT_SUPPORT 0
 #endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES
+ *
+ * @brief
+ *   The number of (event number, buffer offset) entries kept by each
+ *   event buffer, so that FetchEventsSince() resumes reading at the
+ *   closest indexed event instead of scanning the buffers from their
+ *   oldest event.  0 disables the index.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES
+ *
+ * @brief
+ *   The number of event lengths kept by each event buffer, so that
+ *   evicting its oldest event does not parse it to find where it
+ *   ends.  It should cover the events a buffer holds, i.e. the size
+ *   of the buffer over that of its smallest events, as the events
+ *   logged before those indexed are parsed.  0 disables the index.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES
+#define CHIP_CONFIG_EVENT_LOGGING_LENGTH_INDEX_ENTRIES 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_INTERVAL
+ *
+ * @brief
+ *   One event out of this many, per priority level, is indexed when
+ *   CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES is not 0.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_INTERVAL
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_INTERVAL 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_POOL_SEGMENT_SIZE
+ *
+ * @brief
+ *   When the event buffers share one pool, the number of bytes a full
+ *   buffer takes at once from the free space of the buffers of more
+ *   important events, so that the buffers are not rearranged for each
+ *   event logged.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_POOL_SEGMENT_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_POOL_SEGMENT_SIZE 64
+#endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_SIZE
+ *
+ * @brief
+ *   The size of each value a persistent event log writes to the
+ *   key-value store, holding the events it saves in a single write.
+ *   Larger blocks mean fewer writes per event, and as much RAM to
+ *   stage a block and to read one back.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_SIZE 256
+#endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_COUNT
+ *
+ * @brief
+ *   The number of blocks a persistent event log keeps, the oldest
+ *   one being overwritten once they are all full.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_COUNT
+#define CHIP_CONFIG_EVENT_LOGGING_PERSIST_BLOCK_COUNT 4
+#endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_PERSIST_BATCH_EVENTS
+ *
+ * @brief
+ *   The number of events a persistent event log stages in RAM before
+ *   writing its block, unless the block fills up or an urgent event
+ *   is logged first.  Lower values lose fewer events on a reset, and
+ *   wear the flash faster.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_PERSIST_BATCH_EVENTS
+#define CHIP_CONFIG_EVENT_LOGGING_PERSIST_BATCH_EVENTS 8
+#endif
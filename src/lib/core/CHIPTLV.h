@@ -66,6 +66,10 @@ enum
 
 class TLVBackingStore;
 
+namespace Utilities {
+class Index;
+} // namespace Utilities
+
 /**
  * Provides a memory efficient parser for data encoded in CHIP TLV format.
  *
@@ -94,6 +98,7 @@ class DLL_EXPORT TLVReader
 {
     friend class TLVWriter;
     friend class TLVUpdater;
+    friend class Utilities::Index;
 
 public:
     /**
@@ -1350,9 +1355,9 @@ public:
      * container.  If the supplied element is a TLV container (structure, array or path), the entire contents
      * of the container will be copied.
      *
-     * @note This method requires the supplied TVLReader object to be reading from a single, contiguous
-     * input buffer that contains the entirety of the underlying TLV encoding. Supplying a reader in any
-     * other mode has undefined behavior.
+     * The encoded value is copied as is, straight from the input buffers of the reader, so that only the
+     * tag of the element itself is re-encoded. A reader that uses a TLVBackingStore, such as one reading a
+     * CHIPCircularTLVBuffer that wraps around, has its buffers copied in turn.
      *
      * @param[in]   reader          A reference to a TLVReader object identifying a pre-encoded TLV
      *                              element that should be copied.
@@ -1395,9 +1400,9 @@ public:
      * container, however the tag will be set to the specified argument.  If the supplied element is a
      * TLV container (structure, array or path), the entire contents of the container will be copied.
      *
-     * @note This method requires the supplied TVLReader object to be reading from a single, contiguous
-     * input buffer that contains the entirety of the underlying TLV encoding. Supplying a reader in any
-     * other mode has undefined behavior.
+     * The encoded value is copied as is, straight from the input buffers of the reader, so that only the
+     * tag of the element itself is re-encoded. A reader that uses a TLVBackingStore, such as one reading a
+     * CHIPCircularTLVBuffer that wraps around, has its buffers copied in turn.
      *
      * @param[in]   tag             The TLV tag to be encoded with the container, or @p AnonymousTag if
      *                              the container should be encoded without a tag.  Tag values should be
@@ -1651,15 +1656,13 @@ public:
      * encoding. When the method returns, the writer object can be used to write additional TLV elements
      * following the container element.
      *
-     * @note This method requires the supplied TVLReader object to be reading from a single, contiguous
-     * input buffer that contains the entirety of the underlying TLV encoding.
+     * The encoded members are copied as is. A reader that uses a TLVBackingStore has its buffers copied
+     * in turn, as by CopyElement().
      *
      * @param[in]   container       A reference to a TLVReader object identifying the pre-encoded TLV
      *                              container to be copied.
      *
      * @retval #CHIP_NO_ERROR      If the method succeeded.
-     * @retval #CHIP_ERROR_INVALID_ARGUMENT
-     *                              If the supplied reader uses a TLVBackingStore rather than a simple buffer.
      * @retval #CHIP_ERROR_INCORRECT_STATE
      *                              If the supplied reader is not positioned on a container element.
      * @retval #CHIP_ERROR_TLV_CONTAINER_OPEN
@@ -1699,8 +1702,8 @@ public:
      * When the method returns, the writer object can be used to write additional TLV elements following
      * the container element.
      *
-     * @note This method requires the supplied TVLReader object to be reading from a single, contiguous
-     * input buffer that contains the entirety of the underlying TLV encoding.
+     * The encoded members are copied as is. A reader that uses a TLVBackingStore has its buffers copied
+     * in turn, as by CopyElement().
      *
      * @param[in]   tag             The TLV tag to be encoded with the container, or @p AnonymousTag if
      *                              the container should be encoded without a tag.  Tag values should be
@@ -1710,8 +1713,6 @@ public:
      *                              container whose type and members should be copied.
      *
      * @retval #CHIP_NO_ERROR      If the method succeeded.
-     * @retval #CHIP_ERROR_INVALID_ARGUMENT
-     *                              If the supplied reader uses a TLVBackingStore rather than a simple buffer.
      * @retval #CHIP_ERROR_INCORRECT_STATE
      *                              If the supplied reader is not positioned on a container element.
      * @retval #CHIP_ERROR_TLV_CONTAINER_OPEN
@@ -1875,6 +1876,7 @@ protected:
     CHIP_ERROR WriteElementHead(TLVElementType elemType, uint64_t tag, uint64_t lenOrVal);
     CHIP_ERROR WriteElementWithData(TLVType type, uint64_t tag, const uint8_t * data, uint32_t dataLen);
     CHIP_ERROR WriteData(const uint8_t * p, uint32_t len);
+    CHIP_ERROR CopyData(TLVReader & reader, uint32_t len);
 };
 
 /**
@@ -2028,6 +2030,40 @@ public:
      */
     void MoveUntilEnd();
 
+    /**
+     * Replace the value of the current element in place.
+     *
+     * These methods overwrite the value of the element on which the TLVUpdater's
+     * reader is positioned with a value of the same encoded size, keeping its tag.
+     * Neither the element nor the rest of the input TLV is moved: the element
+     * is changed where it is read from, and is kept in the output TLV by a later
+     * call to Move() or MoveUntilEnd(). When the updater was initialized without
+     * free space, updating a value this way and then calling MoveUntilEnd()
+     * does not copy any data.
+     *
+     * Integers and floating point numbers must be representable in the size of
+     * the current element, and strings must have the length of the current one.
+     * A value that does not fit leaves the element unchanged; it can still be
+     * replaced through the writer methods, which move the rest of the TLV.
+     *
+     * @retval #CHIP_NO_ERROR              If the value was replaced.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE  If the current element is not of the
+     *                                      type of the new value.
+     * @retval #CHIP_ERROR_INVALID_INTEGER_VALUE
+     *                                      If the new number does not fit in the
+     *                                      size of the current element.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT
+     *                                      If the new string is not of the
+     *                                      length of the current one.
+     *
+     */
+    CHIP_ERROR ReplaceBoolean(bool v);
+    CHIP_ERROR ReplaceInteger(int64_t v);
+    CHIP_ERROR ReplaceUnsignedInteger(uint64_t v);
+    CHIP_ERROR ReplaceFloatingPoint(double v);
+    CHIP_ERROR ReplaceBytes(const uint8_t * buf, uint32_t len);
+    CHIP_ERROR ReplaceString(const char * buf, uint32_t len);
+
     /**
      * Prepares a TLVUpdater object for reading elements of a container. It also
      * encodes a start of container object in the output TLV.
@@ -2224,6 +2260,9 @@ public:
 
 private:
     void AdjustInternalWriterFreeSpace();
+    void MoveToWriter(uint32_t copyLen);
+    CHIP_ERROR ReplaceFixedSizeValue(uint64_t v);
+    CHIP_ERROR ReplaceStringValue(TLVType type, const uint8_t * buf, uint32_t len);
 
     TLVWriter mUpdaterWriter;
     TLVReader mUpdaterReader;
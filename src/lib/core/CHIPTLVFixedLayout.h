@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the chip::TLV::FixedLayoutContainer template, which
+ *      encodes small containers of unsigned integers whose tags are known at
+ *      compile time in a single pass.
+ */
+
+#pragma once
+
+#include <core/CHIPEncoding.h>
+#include <core/CHIPTLV.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace TLV {
+
+/**
+ * Field tag of a FixedLayoutContainer denoting an anonymous field. Other field tags are context tag numbers.
+ */
+constexpr uint16_t kFixedLayoutAnonymousTag = 0x100;
+
+/**
+ * @class FixedLayoutContainer
+ *
+ * @brief
+ *   A container of type @a kContainerType holding one unsigned integer per entry of @a kFieldTags, in that order.
+ *
+ *   The control and tag bytes of the fields are fixed at compile time, and only the width of each value is chosen when
+ *   encoding, so that the whole container is laid out in a local buffer and handed to the writer with a single
+ *   TLVWriter::PutPreEncodedContainer() call, which checks the bounds once. The encoding is identical to the one produced by
+ *   TLVWriter::StartContainer(), a TLVWriter::Put() per field and TLVWriter::EndContainer().
+ */
+template <TLVType kContainerType, uint16_t... kFieldTags>
+class FixedLayoutContainer
+{
+public:
+    static constexpr size_t kNumFields = sizeof...(kFieldTags);
+
+    // Control byte, tag byte and 8 value bytes per field, plus the end of container.
+    static constexpr size_t kMaxEncodedLength = kNumFields * 10 + 1;
+
+    static_assert(kContainerType == kTLVType_Structure || kContainerType == kTLVType_Array || kContainerType == kTLVType_List,
+                  "FixedLayoutContainer must be a structure, an array or a list");
+
+    /**
+     * Encode the container.
+     *
+     * @param[in] aWriter   The writer to encode into.
+     * @param[in] aTag      The tag of the container.
+     * @param[in] aValues   One unsigned integer per field.
+     *
+     * @return the errors of TLVWriter::PutPreEncodedContainer().
+     */
+    template <typename... Values>
+    static CHIP_ERROR Encode(TLVWriter & aWriter, uint64_t aTag, Values... aValues)
+    {
+        static_assert(sizeof...(Values) == kNumFields, "FixedLayoutContainer::Encode takes one value per field");
+        static_assert(AllFieldTagsValid(), "Structure fields must have context tags, array fields must be anonymous");
+
+        uint8_t buf[kMaxEncodedLength];
+        uint8_t * p = buf;
+
+        const bool fieldsEncoded[] = { EncodeField(p, kFieldTags, static_cast<uint64_t>(aValues))... };
+        (void) fieldsEncoded;
+
+        Encoding::Write8(p, static_cast<uint8_t>(TLVElementType::EndOfContainer));
+
+        return aWriter.PutPreEncodedContainer(aTag, kContainerType, buf, static_cast<uint32_t>(p - buf));
+    }
+
+private:
+    static constexpr bool IsValidFieldTag(uint16_t aFieldTag)
+    {
+        return (aFieldTag == kFixedLayoutAnonymousTag) ? (kContainerType != kTLVType_Structure)
+                                                       : (aFieldTag < kContextTagMaxNum && kContainerType != kTLVType_Array);
+    }
+
+    static constexpr bool AllFieldTagsValid()
+    {
+        const bool valid[] = { true, IsValidFieldTag(kFieldTags)... };
+
+        for (bool fieldValid : valid)
+        {
+            if (!fieldValid)
+                return false;
+        }
+        return true;
+    }
+
+    static bool EncodeField(uint8_t *& p, uint16_t aFieldTag, uint64_t aValue)
+    {
+        TLVElementType elemType;
+
+        if (aValue <= UINT8_MAX)
+            elemType = TLVElementType::UInt8;
+        else if (aValue <= UINT16_MAX)
+            elemType = TLVElementType::UInt16;
+        else if (aValue <= UINT32_MAX)
+            elemType = TLVElementType::UInt32;
+        else
+            elemType = TLVElementType::UInt64;
+
+        if (aFieldTag == kFixedLayoutAnonymousTag)
+        {
+            Encoding::Write8(p, TLVTagControl::Anonymous | elemType);
+        }
+        else
+        {
+            Encoding::Write8(p, TLVTagControl::ContextSpecific | elemType);
+            Encoding::Write8(p, static_cast<uint8_t>(aFieldTag));
+        }
+
+        switch (elemType)
+        {
+        case TLVElementType::UInt8:
+            Encoding::Write8(p, static_cast<uint8_t>(aValue));
+            break;
+        case TLVElementType::UInt16:
+            Encoding::LittleEndian::Write16(p, static_cast<uint16_t>(aValue));
+            break;
+        case TLVElementType::UInt32:
+            Encoding::LittleEndian::Write32(p, static_cast<uint32_t>(aValue));
+            break;
+        default:
+            Encoding::LittleEndian::Write64(p, aValue);
+            break;
+        }
+
+        return true;
+    }
+};
+
+} // namespace TLV
+} // namespace chip
@@ -43,7 +43,10 @@ CHIP_ERROR TLVUpdater::Init(uint8_t * buf, uint32_t dataLen, uint32_t maxLen)
 
     // memmove the buffer data to end of the buffer
     freeLen = maxLen - dataLen;
-    memmove(buf + freeLen, buf, dataLen);
+    if (freeLen > 0)
+    {
+        memmove(buf + freeLen, buf, dataLen);
+    }
 
     // Init reader
     mUpdaterReader.Init(buf + freeLen, dataLen);
@@ -81,7 +84,10 @@ CHIP_ERROR TLVUpdater::Init(TLVReader & aReader, uint32_t freeLen)
     }
 
     // memmove the buffer data to end of the buffer
-    memmove(buf + freeLen, buf, remainingDataLen);
+    if (freeLen > 0)
+    {
+        memmove(buf + freeLen, buf, remainingDataLen);
+    }
 
     // Initialize the internal reader object
     mUpdaterReader.mBackingStore  = 0;
@@ -158,13 +164,7 @@ CHIP_ERROR TLVUpdater::Move()
     copyLen = static_cast<uint32_t>(elementEnd - mElementStartAddr);
 
     // Move the element to output TLV
-    memmove(mUpdaterWriter.mWritePoint, mElementStartAddr, copyLen);
-
-    // Adjust the updater state
-    mElementStartAddr += copyLen;
-    mUpdaterWriter.mWritePoint += copyLen;
-    mUpdaterWriter.mLenWritten += copyLen;
-    mUpdaterWriter.mMaxLen += copyLen;
+    MoveToWriter(copyLen);
 
     return CHIP_NO_ERROR;
 }
@@ -176,13 +176,9 @@ void TLVUpdater::MoveUntilEnd()
     uint32_t copyLen = static_cast<uint32_t>(buffEnd - mElementStartAddr);
 
     // Move all elements till end to output TLV
-    memmove(mUpdaterWriter.mWritePoint, mElementStartAddr, copyLen);
+    MoveToWriter(copyLen);
 
     // Adjust the updater state
-    mElementStartAddr += copyLen;
-    mUpdaterWriter.mWritePoint += copyLen;
-    mUpdaterWriter.mLenWritten += copyLen;
-    mUpdaterWriter.mMaxLen += copyLen;
     mUpdaterWriter.mContainerType = kTLVType_NotSpecified;
     mUpdaterWriter.SetContainerOpen(false);
     mUpdaterWriter.SetCloseContainerReserved(false);
@@ -226,6 +222,155 @@ CHIP_ERROR TLVUpdater::ExitContainer(TLVType outerContainerType)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVUpdater::ReplaceBoolean(bool v)
+{
+    uint8_t elemHeadLen;
+
+    VerifyOrReturnError(mUpdaterReader.GetType() == kTLVType_Boolean, CHIP_ERROR_WRONG_TLV_TYPE);
+    ReturnErrorOnFailure(mUpdaterReader.GetElementHeadLength(elemHeadLen));
+
+    // The value of a boolean is its element type, in the control byte
+    uint8_t * controlByte   = const_cast<uint8_t *>(mUpdaterReader.mReadPoint) - elemHeadLen;
+    TLVElementType elemType = v ? TLVElementType::BooleanTrue : TLVElementType::BooleanFalse;
+
+    mUpdaterReader.mControlByte =
+        static_cast<uint16_t>((mUpdaterReader.mControlByte & ~kTLVTypeMask) | static_cast<uint8_t>(elemType));
+    *controlByte = static_cast<uint8_t>(mUpdaterReader.mControlByte);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVUpdater::ReplaceInteger(int64_t v)
+{
+    VerifyOrReturnError(mUpdaterReader.GetType() == kTLVType_SignedInteger, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    const uint8_t valueBits = static_cast<uint8_t>(TLVFieldSizeToBytes(GetTLVFieldSize(mUpdaterReader.ElementType())) * 8);
+    if (valueBits < 64)
+    {
+        const int64_t limit = static_cast<int64_t>(1) << (valueBits - 1);
+        VerifyOrReturnError(v >= -limit && v < limit, CHIP_ERROR_INVALID_INTEGER_VALUE);
+    }
+
+    return ReplaceFixedSizeValue(static_cast<uint64_t>(v));
+}
+
+CHIP_ERROR TLVUpdater::ReplaceUnsignedInteger(uint64_t v)
+{
+    VerifyOrReturnError(mUpdaterReader.GetType() == kTLVType_UnsignedInteger, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    const uint8_t valueBits = static_cast<uint8_t>(TLVFieldSizeToBytes(GetTLVFieldSize(mUpdaterReader.ElementType())) * 8);
+    VerifyOrReturnError(valueBits == 64 || v < (static_cast<uint64_t>(1) << valueBits), CHIP_ERROR_INVALID_INTEGER_VALUE);
+
+    return ReplaceFixedSizeValue(v);
+}
+
+CHIP_ERROR TLVUpdater::ReplaceFloatingPoint(double v)
+{
+    switch (mUpdaterReader.ElementType())
+    {
+    case TLVElementType::FloatingPointNumber32: {
+        union
+        {
+            uint32_t u32;
+            float f;
+        } cvt;
+        cvt.f = static_cast<float>(v);
+        // NaN is the only value that is not equal to itself
+        VerifyOrReturnError(static_cast<double>(cvt.f) == v || v != v, CHIP_ERROR_INVALID_INTEGER_VALUE);
+        return ReplaceFixedSizeValue(cvt.u32);
+    }
+    case TLVElementType::FloatingPointNumber64: {
+        union
+        {
+            uint64_t u64;
+            double d;
+        } cvt;
+        cvt.d = v;
+        return ReplaceFixedSizeValue(cvt.u64);
+    }
+    default:
+        return CHIP_ERROR_WRONG_TLV_TYPE;
+    }
+}
+
+CHIP_ERROR TLVUpdater::ReplaceBytes(const uint8_t * buf, uint32_t len)
+{
+    return ReplaceStringValue(kTLVType_ByteString, buf, len);
+}
+
+CHIP_ERROR TLVUpdater::ReplaceString(const char * buf, uint32_t len)
+{
+    return ReplaceStringValue(kTLVType_UTF8String, reinterpret_cast<const uint8_t *>(buf), len);
+}
+
+/**
+ * This is a private method that overwrites the value of the current integer or
+ * floating point element, which sits at the end of the element head, with the
+ * low bytes of @p v.
+ */
+CHIP_ERROR TLVUpdater::ReplaceFixedSizeValue(uint64_t v)
+{
+    const uint8_t valueLen = TLVFieldSizeToBytes(GetTLVFieldSize(mUpdaterReader.ElementType()));
+    uint8_t * p            = const_cast<uint8_t *>(mUpdaterReader.mReadPoint) - valueLen;
+
+    switch (valueLen)
+    {
+    case 1:
+        Write8(p, static_cast<uint8_t>(v));
+        break;
+    case 2:
+        LittleEndian::Write16(p, static_cast<uint16_t>(v));
+        break;
+    case 4:
+        LittleEndian::Write32(p, static_cast<uint32_t>(v));
+        break;
+    case 8:
+        LittleEndian::Write64(p, v);
+        break;
+    default:
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    mUpdaterReader.mElemLenOrVal = (valueLen < 8) ? (v & ((static_cast<uint64_t>(1) << (valueLen * 8)) - 1)) : v;
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * This is a private method that overwrites the data of the current string
+ * element, which follows the element head, with a string of the same length.
+ */
+CHIP_ERROR TLVUpdater::ReplaceStringValue(TLVType type, const uint8_t * buf, uint32_t len)
+{
+    VerifyOrReturnError(mUpdaterReader.GetType() == type, CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(mUpdaterReader.mElemLenOrVal == len, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(buf != nullptr || len == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The reader is still positioned before the string data
+    memcpy(const_cast<uint8_t *>(mUpdaterReader.mReadPoint), buf, len);
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * This is a private method that moves @p copyLen bytes from the start of the
+ * current element to the writer, which costs nothing when there is no free
+ * space between them.
+ */
+void TLVUpdater::MoveToWriter(uint32_t copyLen)
+{
+    if (mUpdaterWriter.mWritePoint != mElementStartAddr)
+    {
+        memmove(mUpdaterWriter.mWritePoint, mElementStartAddr, copyLen);
+    }
+
+    // Adjust the updater state
+    mElementStartAddr += copyLen;
+    mUpdaterWriter.mWritePoint += copyLen;
+    mUpdaterWriter.mLenWritten += copyLen;
+    mUpdaterWriter.mMaxLen += copyLen;
+}
+
 /**
  * This is a private method that adjusts the TLVUpdater's free space count by
  * accounting for the freespace from mElementStartAddr to current read point.
@@ -27,6 +27,8 @@
 #include <core/CHIPTLVUtilities.hpp>
 #include <support/CodeUtils.h>
 
+#include <algorithm>
+
 namespace chip {
 
 namespace TLV {
@@ -439,6 +441,199 @@ CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aPredicate, void * aCo
     return retval;
 }
 
+/**
+ *  Add the elements read by @a aReader, up to the end of the encoding or of
+ *  the container the reader is in, and recursively the elements they contain.
+ *
+ *  @param[in,out] aReader       A reference to the TLV reader positioned before
+ *                               the first element to add.
+ *  @param[in]     aParentOffset The offset of the container the elements are in,
+ *                               or #kNoParent at the top level.
+ *
+ *  @retval  #CHIP_NO_ERROR          On success.
+ *
+ *  @retval  #CHIP_ERROR_NO_MEMORY   If there are more elements than entries.
+ *
+ *  @retval  other                   Other CHIP error codes returned by the reader.
+ *
+ */
+CHIP_ERROR Index::AddElements(TLVReader & aReader, uint32_t aParentOffset)
+{
+    CHIP_ERROR err;
+    // Elements are skipped before reading the next one, which thus starts where the reader stands
+    uint32_t offset = aReader.GetLengthRead();
+
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(mEntryCount < mCapacity, CHIP_ERROR_NO_MEMORY);
+
+        Entry & entry      = mEntries[mEntryCount++];
+        entry.Tag          = aReader.GetTag();
+        entry.ParentOffset = aParentOffset;
+        entry.Offset       = offset;
+        entry.Type         = aReader.GetType();
+
+        if (TLVTypeIsContainer(entry.Type))
+        {
+            TLVType containerType;
+
+            ReturnErrorOnFailure(aReader.EnterContainer(containerType));
+            ReturnErrorOnFailure(AddElements(aReader, offset));
+            ReturnErrorOnFailure(aReader.ExitContainer(containerType));
+        }
+        else
+        {
+            ReturnErrorOnFailure(aReader.Skip());
+        }
+
+        entry.Length = aReader.GetLengthRead() - offset;
+        offset       = aReader.GetLengthRead();
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+/**
+ *  Index the elements of a contiguous TLV encoding, replacing any previous
+ *  content of the index.
+ *
+ *  The encoding is parsed once, and must stay unchanged while the index is used.
+ *
+ *  @param[in]   aData          A pointer to the TLV encoding.
+ *  @param[in]   aDataLen       The length of the TLV encoding.
+ *
+ *  @retval  #CHIP_NO_ERROR          On success.
+ *
+ *  @retval  #CHIP_ERROR_NO_MEMORY   If the encoding has more elements than the
+ *                                   index has entries.
+ *
+ *  @retval  other                   Other CHIP error codes returned while
+ *                                   parsing an invalid encoding.
+ *
+ */
+CHIP_ERROR Index::Build(const uint8_t * aData, uint32_t aDataLen)
+{
+    TLVReader reader;
+    CHIP_ERROR err;
+
+    reader.Init(aData, aDataLen);
+    reader.ImplicitProfileId = ImplicitProfileId;
+
+    mData       = aData;
+    mEntryCount = 0;
+
+    err = AddElements(reader, kNoParent);
+    if (err != CHIP_NO_ERROR)
+    {
+        mEntryCount = 0;
+        return err;
+    }
+
+    // Children of the same container end up next to each other, sorted by tag and then in encoding order
+    std::sort(mEntries, mEntries + mEntryCount, [](const Entry & a, const Entry & b) {
+        if (a.ParentOffset != b.ParentOffset)
+        {
+            return a.ParentOffset < b.ParentOffset;
+        }
+        if (a.Tag != b.Tag)
+        {
+            return a.Tag < b.Tag;
+        }
+        return a.Offset < b.Offset;
+    });
+
+    return CHIP_NO_ERROR;
+}
+
+const Index::Entry * Index::FindChild(uint32_t aParentOffset, const uint64_t & aTag) const
+{
+    const Entry * begin = mEntries;
+    const Entry * end   = mEntries + mEntryCount;
+    const Entry * entry = std::lower_bound(begin, end, aTag, [aParentOffset](const Entry & e, const uint64_t & tag) {
+        return (e.ParentOffset != aParentOffset) ? (e.ParentOffset < aParentOffset) : (e.Tag < tag);
+    });
+
+    if (entry == end || entry->ParentOffset != aParentOffset || entry->Tag != aTag)
+    {
+        return nullptr;
+    }
+    return entry;
+}
+
+const Index::Entry * Index::FindEntry(const uint64_t * aPath, size_t aPathLen, TLVType & aContainerType) const
+{
+    const Entry * entry = nullptr;
+
+    aContainerType = kTLVType_NotSpecified;
+
+    for (size_t i = 0; i < aPathLen; i++)
+    {
+        if (entry != nullptr)
+        {
+            aContainerType = entry->Type;
+        }
+
+        entry = FindChild((entry != nullptr) ? entry->Offset : kNoParent, aPath[i]);
+        if (entry == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    return entry;
+}
+
+/**
+ *  Look up the element at the given tag path.
+ *
+ *  When several elements of the same container have the same tag, such as
+ *  the anonymous elements of an array, the first one is returned.
+ *
+ *  @param[in]   aPath          The tags of the element and of the containers it
+ *                              is in, from the top level down.
+ *  @param[in]   aPathLen       The number of tags in @a aPath.
+ *
+ *  @return  The entry of the element, or nullptr if there is no such element.
+ *
+ */
+const Index::Entry * Index::FindEntry(const uint64_t * aPath, size_t aPathLen) const
+{
+    TLVType containerType;
+    return FindEntry(aPath, aPathLen, containerType);
+}
+
+/**
+ *  Position a reader on the element at the given tag path.
+ *
+ *  The reader only covers the element: once positioned, its value and
+ *  content can be read, but not the elements following it.
+ *
+ *  @param[in]   aPath          The tags of the element and of the containers it
+ *                              is in, from the top level down.
+ *  @param[in]   aPathLen       The number of tags in @a aPath.
+ *  @param[out]  aResult        A reference to storage to a TLV reader which
+ *                              will be positioned at the element on success.
+ *
+ *  @retval  #CHIP_NO_ERROR                    On success.
+ *
+ *  @retval  #CHIP_ERROR_TLV_TAG_NOT_FOUND     If there is no element at @a aPath.
+ *
+ */
+CHIP_ERROR Index::Find(const uint64_t * aPath, size_t aPathLen, TLVReader & aResult) const
+{
+    TLVType containerType;
+    const Entry * entry = FindEntry(aPath, aPathLen, containerType);
+
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_TLV_TAG_NOT_FOUND);
+
+    aResult.Init(mData + entry->Offset, entry->Length);
+    aResult.ImplicitProfileId = ImplicitProfileId;
+    // The tag of the element is checked against the container it is in, as if the reader had gone through it
+    aResult.mContainerType = containerType;
+
+    return aResult.Next();
+}
+
 } // namespace Utilities
 
 } // namespace TLV
@@ -59,6 +59,58 @@ extern CHIP_ERROR Find(const TLVReader & aReader, const uint64_t & aTag, TLVRead
 
 extern CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aHandler, void * aContext, TLVReader & aResult);
 extern CHIP_ERROR Find(const TLVReader & aReader, IterateHandler aHandler, void * aContext, TLVReader & aResult, bool aRecurse);
+
+/**
+ *   @class Index
+ *   @brief
+ *     A sorted table of the elements of a contiguous TLV encoding, built in
+ *     one pass, for repeated lookups by tag path without parsing the
+ *     encoding again.
+ *
+ *   The table is stored in caller-provided entries, one per element at any
+ *   depth. Each lookup is a binary search per tag of the path.
+ */
+class Index
+{
+public:
+    struct Entry
+    {
+        uint64_t Tag;          ///< The tag of the element.
+        uint32_t ParentOffset; ///< The offset of the container of the element, or kNoParent.
+        uint32_t Offset;       ///< The offset of the first byte of the element.
+        uint32_t Length;       ///< The length of the whole element encoding, including its head.
+        TLVType Type;          ///< The type of the element.
+    };
+
+    static constexpr uint32_t kNoParent = UINT32_MAX;
+
+    Index(Entry * aEntries, size_t aCapacity) : mEntries(aEntries), mCapacity(aCapacity) {}
+
+    CHIP_ERROR Build(const uint8_t * aData, uint32_t aDataLen);
+
+    CHIP_ERROR Find(const uint64_t * aPath, size_t aPathLen, TLVReader & aResult) const;
+    CHIP_ERROR Find(const uint64_t & aTag, TLVReader & aResult) const { return Find(&aTag, 1, aResult); }
+
+    const Entry * FindEntry(const uint64_t * aPath, size_t aPathLen) const;
+
+    size_t GetEntryCount() const { return mEntryCount; }
+
+    /**
+     * The profile id used to decode implicit profile tags, see TLVReader::ImplicitProfileId.
+     */
+    uint32_t ImplicitProfileId = kProfileIdNotSpecified;
+
+private:
+    CHIP_ERROR AddElements(TLVReader & aReader, uint32_t aParentOffset);
+    const Entry * FindChild(uint32_t aParentOffset, const uint64_t & aTag) const;
+    const Entry * FindEntry(const uint64_t * aPath, size_t aPathLen, TLVType & aContainerType) const;
+
+    Entry * mEntries;
+    size_t mCapacity;
+    size_t mEntryCount    = 0;
+    const uint8_t * mData = nullptr;
+};
+
 } // namespace Utilities
 
 } // namespace TLV
@@ -407,15 +407,12 @@ CHIP_ERROR TLVWriter::CopyElement(TLVReader & reader)
     return CopyElement(reader.GetTag(), reader);
 }
 
-const size_t kCHIPTLVCopyChunkSize = 16;
-
 CHIP_ERROR TLVWriter::CopyElement(uint64_t tag, TLVReader & reader)
 {
     TLVElementType elemType = reader.ElementType();
     uint64_t elemLenOrVal   = reader.mElemLenOrVal;
     TLVReader readerHelper; // used to figure out the length of the element and read data of the element
     uint32_t copyDataLen;
-    uint8_t chunk[kCHIPTLVCopyChunkSize];
 
     VerifyOrReturnError(elemType != TLVElementType::NotSpecified && elemType != TLVElementType::EndOfContainer,
                         CHIP_ERROR_INCORRECT_STATE);
@@ -433,14 +430,26 @@ CHIP_ERROR TLVWriter::CopyElement(uint64_t tag, TLVReader & reader)
     // specified tag.
     ReturnErrorOnFailure(WriteElementHead(elemType, tag, elemLenOrVal));
 
-    while (copyDataLen > 0)
+    return CopyData(readerHelper, copyDataLen);
+}
+
+CHIP_ERROR TLVWriter::CopyData(TLVReader & reader, uint32_t len)
+{
+    // The encoded data is written straight from the buffers of the reader, so that an element read
+    // from a circular buffer that wraps around takes two writes.
+    while (len > 0)
     {
-        uint32_t chunkSize = copyDataLen > kCHIPTLVCopyChunkSize ? kCHIPTLVCopyChunkSize : copyDataLen;
-        ReturnErrorOnFailure(readerHelper.ReadData(chunk, chunkSize));
+        ReturnErrorOnFailure(reader.EnsureData(CHIP_ERROR_TLV_UNDERRUN));
 
-        ReturnErrorOnFailure(WriteData(chunk, chunkSize));
+        uint32_t spanLen = static_cast<uint32_t>(reader.mBufEnd - reader.mReadPoint);
+        if (spanLen > len)
+            spanLen = len;
 
-        copyDataLen -= chunkSize;
+        ReturnErrorOnFailure(WriteData(reader.mReadPoint, spanLen));
+
+        reader.mReadPoint += spanLen;
+        reader.mLenRead += spanLen;
+        len -= spanLen;
     }
 
     return CHIP_NO_ERROR;
@@ -570,9 +579,12 @@ CHIP_ERROR TLVWriter::CopyContainer(TLVReader & container)
 
 CHIP_ERROR TLVWriter::CopyContainer(uint64_t tag, TLVReader & container)
 {
-    // NOTE: This function MUST be used with a TVLReader that is reading from a contiguous buffer.
+    // A container read through a TLVBackingStore may span several buffers, which CopyElement() copies in turn.
     if (container.mBackingStore != nullptr)
-        return CHIP_ERROR_INVALID_ARGUMENT;
+    {
+        VerifyOrReturnError(TLVTypeIsContainer(container.ElementType()), CHIP_ERROR_INCORRECT_STATE);
+        return CopyElement(tag, container);
+    }
 
     CHIP_ERROR err;
     TLVType containerType, outerContainerType;
@@ -226,6 +226,9 @@ static int32_t sContext[] =
     CHIP_ERROR_IM_MALFORMED_EVENT_DATA_ELEMENT,
     CHIP_ERROR_IM_MALFORMED_STATUS_CODE,
     CHIP_ERROR_PEER_NODE_NOT_FOUND,
+    CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED,
+    CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW,
+    CHIP_ERROR_BUSY,
 };
 // clang-format on
 
@@ -31,6 +31,7 @@
 #include <core/CHIPTLV.h>
 #include <core/CHIPTLVData.hpp>
 #include <core/CHIPTLVDebug.hpp>
+#include <core/CHIPTLVFixedLayout.h>
 #include <core/CHIPTLVUtilities.hpp>
 
 #include <support/CHIPMem.h>
@@ -1572,6 +1573,86 @@ void CheckCHIPTLVUtilities(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_END_OF_TLV);
 }
 
+/**
+ *  Test CHIP TLV Utilities Index
+ */
+void CheckCHIPTLVIndex(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[2048];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType outerContainerType;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    writer.Init(buf, sizeof(buf));
+    writer.ImplicitProfileId = TestProfile_2;
+
+    WriteEncoding1(inSuite, writer);
+
+    uint32_t encodedLen = writer.GetLengthWritten();
+
+    chip::TLV::Utilities::Index::Entry entries[18];
+    chip::TLV::Utilities::Index index(entries, ArraySize(entries));
+    index.ImplicitProfileId = TestProfile_2;
+
+    err = index.Build(buf, encodedLen);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.GetEntryCount() == 18);
+
+    // The outer structure covers the whole encoding
+    const uint64_t structPath[] = { ProfileTag(TestProfile_1, 1) };
+    const chip::TLV::Utilities::Index::Entry * entry = index.FindEntry(structPath, ArraySize(structPath));
+    NL_TEST_ASSERT(inSuite, entry != nullptr);
+    NL_TEST_ASSERT(inSuite, entry != nullptr && entry->Offset == 0 && entry->Length == encodedLen);
+    NL_TEST_ASSERT(inSuite, entry != nullptr && entry->Type == kTLVType_Structure);
+
+    // Elements at the end of the structure are reached without reading the ones before them
+    const uint64_t stringPath[] = { ProfileTag(TestProfile_1, 1), ProfileTag(TestProfile_1, 5) };
+    err                         = index.Find(stringPath, ArraySize(stringPath), reader);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    TestString(inSuite, reader, ProfileTag(TestProfile_1, 5), "This is a test");
+
+    const uint64_t doublePath[] = { ProfileTag(TestProfile_1, 1), ProfileTag(TestProfile_2, 65536) };
+    err                         = index.Find(doublePath, ArraySize(doublePath), reader);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    TestGet<TLVReader, double>(inSuite, reader, kTLVType_FloatingPointNumber, ProfileTag(TestProfile_2, 65536), 17.9);
+
+    // The first of the anonymous elements of an array is found
+    const uint64_t arrayElementPath[] = { ProfileTag(TestProfile_1, 1), ContextTag(0), AnonymousTag };
+    err                               = index.Find(arrayElementPath, ArraySize(arrayElementPath), reader);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    TestGet<TLVReader, int8_t>(inSuite, reader, kTLVType_SignedInteger, AnonymousTag, 42);
+
+    // A container found can be entered and read to its end
+    const uint64_t arrayPath[] = { ProfileTag(TestProfile_1, 1), ContextTag(0) };
+    err                        = index.Find(arrayPath, ArraySize(arrayPath), reader);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetType() == kTLVType_Array);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    TestNext<TLVReader>(inSuite, reader);
+    TestGet<TLVReader, int8_t>(inSuite, reader, kTLVType_SignedInteger, AnonymousTag, 42);
+    err = reader.ExitContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Absent elements
+    const uint64_t absentPath[] = { ProfileTag(TestProfile_1, 1), ProfileTag(TestProfile_2, 1024) };
+    err                         = index.Find(absentPath, ArraySize(absentPath), reader);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_TLV_TAG_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, index.FindEntry(absentPath, ArraySize(absentPath)) == nullptr);
+
+    err = index.Find(ProfileTag(TestProfile_1, 5), reader);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_TLV_TAG_NOT_FOUND);
+
+    // Not enough entries for all the elements
+    chip::TLV::Utilities::Index smallIndex(entries, ArraySize(entries) - 1);
+    smallIndex.ImplicitProfileId = TestProfile_2;
+
+    err = smallIndex.Build(buf, encodedLen);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, smallIndex.GetEntryCount() == 0);
+}
+
 /**
  *  Test CHIP TLV Empty Find
  */
@@ -1598,6 +1679,76 @@ void CheckCHIPTLVEmptyFind(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+/**
+ *  Test that FixedLayoutContainer encodes like the generic writer calls
+ */
+void CheckFixedLayoutContainer(nlTestSuite * inSuite, void * inContext)
+{
+    using ListLayout  = FixedLayoutContainer<kTLVType_List, 0, 1, 2, 3>;
+    using ArrayLayout = FixedLayoutContainer<kTLVType_Array, kFixedLayoutAnonymousTag, kFixedLayoutAnonymousTag>;
+
+    uint8_t expected[64];
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVType outerContainerType;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    writer.Init(expected, sizeof(expected));
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    {
+        TLVType containerType;
+        err = writer.StartContainer(ContextTag(1), kTLVType_List, containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(0), static_cast<uint8_t>(0x12));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(1), static_cast<uint32_t>(0x1234));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(2), static_cast<uint64_t>(0x12345678));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(3), static_cast<uint64_t>(0x123456789A));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.EndContainer(containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        err = writer.StartContainer(ContextTag(2), kTLVType_Array, containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(AnonymousTag, static_cast<uint16_t>(0));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(AnonymousTag, static_cast<uint32_t>(0x10000));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.EndContainer(containerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    err = writer.EndContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    uint32_t expectedLen = writer.GetLengthWritten();
+
+    writer.Init(buf, sizeof(buf));
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ListLayout::Encode(writer, ContextTag(1), static_cast<uint8_t>(0x12), static_cast<uint32_t>(0x1234),
+                             static_cast<uint64_t>(0x12345678), static_cast<uint64_t>(0x123456789A));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ArrayLayout::Encode(writer, ContextTag(2), static_cast<uint16_t>(0), static_cast<uint32_t>(0x10000));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == expectedLen);
+    NL_TEST_ASSERT(inSuite, memcmp(buf, expected, expectedLen) == 0);
+
+    // The container does not fit in the writer.
+    writer.Init(buf, 8);
+    err = ListLayout::Encode(writer, AnonymousTag, 1, 2, 3, 4);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
 // clang-format off
 uint8_t Encoding2[] =
 {
@@ -1945,6 +2096,106 @@ void WriteDeleteReadTest(nlTestSuite * inSuite)
     ReadDeletedEncoding5(inSuite, reader);
 }
 
+void WriteReplaceEncoding(nlTestSuite * inSuite, TLVWriter & writer, bool b, int8_t i, uint16_t u, float f, const char * str)
+{
+    CHIP_ERROR err;
+    TLVType outerContainerType;
+
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutBoolean(ContextTag(1), b);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Put(ContextTag(2), i);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Put(ContextTag(3), u, true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Put(ContextTag(4), f);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutString(ContextTag(5), str);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.EndContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+void WriteReplaceReadTest(nlTestSuite * inSuite)
+{
+    uint8_t buf[64];
+    uint8_t expected[64];
+    uint32_t encodedLen;
+    CHIP_ERROR err;
+
+    TLVWriter writer;
+    TLVUpdater updater;
+    TLVType outerContainerType;
+
+    writer.Init(buf, sizeof(buf));
+    WriteReplaceEncoding(inSuite, writer, false, 1, 2, 1.5f, "abc");
+    encodedLen = writer.GetLengthWritten();
+
+    writer.Init(expected, sizeof(expected));
+    WriteReplaceEncoding(inSuite, writer, true, -100, 60000, 0.25f, "xyz");
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == encodedLen);
+
+    // Without any free space, values of the same size are replaced in place
+    err = updater.Init(buf, encodedLen, encodedLen);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    TestNext<TLVUpdater>(inSuite, updater);
+
+    err = updater.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    TestNext<TLVUpdater>(inSuite, updater);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceInteger(1) == CHIP_ERROR_WRONG_TLV_TYPE);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceBoolean(true) == CHIP_NO_ERROR);
+    TestGet<TLVUpdater, bool>(inSuite, updater, kTLVType_Boolean, ContextTag(1), true);
+    TestMove(inSuite, updater);
+
+    TestNext<TLVUpdater>(inSuite, updater);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceInteger(1000) == CHIP_ERROR_INVALID_INTEGER_VALUE);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceInteger(-100) == CHIP_NO_ERROR);
+    TestGet<TLVUpdater, int8_t>(inSuite, updater, kTLVType_SignedInteger, ContextTag(2), -100);
+    TestMove(inSuite, updater);
+
+    TestNext<TLVUpdater>(inSuite, updater);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceUnsignedInteger(70000) == CHIP_ERROR_INVALID_INTEGER_VALUE);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceUnsignedInteger(60000) == CHIP_NO_ERROR);
+    TestGet<TLVUpdater, uint16_t>(inSuite, updater, kTLVType_UnsignedInteger, ContextTag(3), 60000);
+    TestMove(inSuite, updater);
+
+    TestNext<TLVUpdater>(inSuite, updater);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceFloatingPoint(0.1) == CHIP_ERROR_INVALID_INTEGER_VALUE);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceFloatingPoint(0.25) == CHIP_NO_ERROR);
+    TestGet<TLVUpdater, double>(inSuite, updater, kTLVType_FloatingPointNumber, ContextTag(4), 0.25);
+    TestMove(inSuite, updater);
+
+    TestNext<TLVUpdater>(inSuite, updater);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceBytes(reinterpret_cast<const uint8_t *>("xyz"), 3) == CHIP_ERROR_WRONG_TLV_TYPE);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceString("wxyz", 4) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, updater.ReplaceString("xyz", 3) == CHIP_NO_ERROR);
+    TestMove(inSuite, updater);
+
+    err = updater.ExitContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    updater.MoveUntilEnd();
+
+    err = updater.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, updater.GetLengthWritten() == encodedLen);
+    NL_TEST_ASSERT(inSuite, memcmp(buf, expected, encodedLen) == 0);
+}
+
 /**
  *  Test Packet Buffer
  */
@@ -1972,6 +2223,59 @@ void CheckPacketBuffer(nlTestSuite * inSuite, void * inContext)
     ReadEncoding1(inSuite, reader);
 }
 
+/**
+ *  Test Packet Buffer writer growing a chain of buffers on demand
+ */
+void CheckPacketBufferGrowing(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t data[1000];
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferTLVReader reader;
+    System::PacketBufferHandle buf;
+    CHIP_ERROR err;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    // Nothing is allocated until there is data to write
+    writer.Init(System::PacketBufferHandle(), true);
+
+    err = writer.PutBytes(ProfileTag(TestProfile_1, 1), data, sizeof(data));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize(&buf);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !buf.IsNull());
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == writer.GetLengthWritten());
+
+    // The buffers of the chain never shrink
+    uint16_t lastAllocSize = 0;
+    for (System::PacketBufferHandle current = buf.Retain(); !current.IsNull(); current.Advance())
+    {
+        NL_TEST_ASSERT(inSuite, current->AllocSize() >= lastAllocSize);
+        lastAllocSize = current->AllocSize();
+    }
+
+    reader.Init(buf.Retain(), true);
+
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetLength() == sizeof(data));
+
+    uint8_t readData[sizeof(data)];
+    err = reader.GetBytes(readData, sizeof(readData));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(readData, data, sizeof(data)) == 0);
+
+    // Writing nothing allocates nothing
+    writer.Init(System::PacketBufferHandle(), true);
+    err = writer.Finalize(&buf);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf.IsNull());
+}
+
 CHIP_ERROR CountEvictedMembers(CHIPCircularTLVBuffer & inBuffer, void * inAppData, TLVReader & inReader)
 {
     TestTLVContext * context = static_cast<TestTLVContext *>(inAppData);
@@ -2310,6 +2614,130 @@ void CheckCircularTLVBufferEdge(nlTestSuite * inSuite, void * inContext)
 
     TestEnd<TLVReader>(inSuite, reader);
 }
+
+// Writes a top-level byte string of 2 + aLength bytes with a CircularTLVWriter of its own, and indexes it if aIndex.
+void WriteIndexedElement(nlTestSuite * inSuite, CHIPCircularTLVBuffer & aBuffer, uint8_t aLength, bool aIndex)
+{
+    const uint8_t data[16] = { 0 };
+    CircularTLVWriter writer;
+
+    writer.Init(aBuffer);
+    NL_TEST_ASSERT(inSuite, writer.PutBytes(AnonymousTag, data, aLength) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    if (aIndex)
+    {
+        aBuffer.IndexTailElement(writer.GetLengthWritten());
+    }
+}
+
+void CheckCircularTLVBufferElementIndex(nlTestSuite * inSuite, void * inContext)
+{
+    TestTLVContext * context = static_cast<TestTLVContext *>(inContext);
+    uint8_t backingStore[30];
+    uint8_t referenceStore[30];
+    uint32_t lengths[3];
+    uint32_t headLength;
+    int referenceEvictionCount     = 0;
+    uint32_t referenceEvictedBytes = 0;
+
+    CHIPCircularTLVBuffer buffer(backingStore, sizeof(backingStore));
+    CHIPCircularTLVBuffer reference(referenceStore, sizeof(referenceStore));
+    buffer.SetElementIndex(lengths, ArraySize(lengths));
+    buffer.mProcessEvictedElement    = CountEvictedMembers;
+    buffer.mAppData                  = inContext;
+    reference.mProcessEvictedElement = CountEvictedMembers;
+    reference.mAppData               = inContext;
+
+    // Indexed elements are evicted without being parsed, whole.
+    context->mEvictionCount = 0;
+    context->mEvictedBytes  = 0;
+    WriteIndexedElement(inSuite, buffer, 8, true);
+    WriteIndexedElement(inSuite, buffer, 8, true);
+    WriteIndexedElement(inSuite, buffer, 8, true);
+    NL_TEST_ASSERT(inSuite, buffer.GetHeadElementLength(headLength) && headLength == 10);
+    WriteIndexedElement(inSuite, buffer, 3, true);
+    NL_TEST_ASSERT(inSuite, context->mEvictionCount == 1 && context->mEvictedBytes == 10);
+    NL_TEST_ASSERT(inSuite, buffer.DataLength() == 25);
+    NL_TEST_ASSERT(inSuite, buffer.EvictHead() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buffer.DataLength() == 15);
+    NL_TEST_ASSERT(inSuite, buffer.GetHeadElementLength(headLength) && headLength == 10);
+
+    // The buffer evicts the same elements as one without an index, whether the elements written are indexed or not, fit
+    // in the index or straddle the end of the storage.
+    buffer.Init(backingStore, sizeof(backingStore));
+    buffer.SetElementIndex(lengths, ArraySize(lengths));
+    buffer.mProcessEvictedElement = CountEvictedMembers;
+    buffer.mAppData               = inContext;
+
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        const uint8_t length = static_cast<uint8_t>((i * 7) % 16);
+        const bool index     = (i % 11) != 5 && (i % 13) != 7;
+
+        context->mEvictionCount = 0;
+        context->mEvictedBytes  = 0;
+        WriteIndexedElement(inSuite, reference, length, false);
+        referenceEvictionCount = context->mEvictionCount;
+        referenceEvictedBytes  = context->mEvictedBytes;
+
+        context->mEvictionCount = 0;
+        context->mEvictedBytes  = 0;
+        WriteIndexedElement(inSuite, buffer, length, index);
+        NL_TEST_ASSERT(inSuite, context->mEvictionCount == referenceEvictionCount);
+        NL_TEST_ASSERT(inSuite, context->mEvictedBytes == referenceEvictedBytes);
+        NL_TEST_ASSERT(inSuite, buffer.DataLength() == reference.DataLength());
+        NL_TEST_ASSERT(inSuite, buffer.QueueHead() - backingStore == reference.QueueHead() - referenceStore);
+
+        if (i % 17 == 3 && buffer.DataLength() != 0)
+        {
+            NL_TEST_ASSERT(inSuite, buffer.EvictHead() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, reference.EvictHead() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, buffer.DataLength() == reference.DataLength());
+        }
+    }
+
+    // The last elements were indexed, and the index drains back to the head once the unindexed ones are gone.
+    while (buffer.DataLength() != 0)
+    {
+        NL_TEST_ASSERT(inSuite, buffer.EvictHead() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, !buffer.GetHeadElementLength(headLength));
+}
+
+void CheckCircularTLVBufferAlignHead(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t backingStore[30];
+    uint32_t lengths[3];
+    uint32_t headLength;
+    CHIPCircularTLVBuffer buffer(backingStore, sizeof(backingStore), &backingStore[20]);
+    buffer.SetElementIndex(lengths, ArraySize(lengths));
+
+    // Two 10-byte elements, the first at the end of the storage and the second wrapping around to its start.
+    WriteIndexedElement(inSuite, buffer, 8, true);
+    WriteIndexedElement(inSuite, buffer, 8, true);
+    NL_TEST_ASSERT(inSuite, buffer.DataLength() == 20);
+
+    // The data no longer wraps once aligned, and keeps its index.
+    NL_TEST_ASSERT(inSuite, buffer.AlignHead(11) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, buffer.AlignHead(5) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buffer.QueueHead() == &backingStore[5]);
+    NL_TEST_ASSERT(inSuite, buffer.DataLength() == 20);
+    NL_TEST_ASSERT(inSuite, buffer.GetHeadElementLength(headLength) && headLength == 10);
+
+    // Give the first element and the free space before it to another buffer, keeping the second one in place.
+    NL_TEST_ASSERT(inSuite, buffer.SetBounds(&backingStore[15], 15, &backingStore[25], 10) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, buffer.SetBounds(&backingStore[15], 15, &backingStore[15], 10) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buffer.DataLength() == 10);
+    NL_TEST_ASSERT(inSuite, !buffer.GetHeadElementLength(headLength));
+
+    CircularTLVReader reader;
+    reader.Init(buffer);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetLength() == 8);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(inSuite, buffer.EvictHead() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buffer.DataLength() == 0);
+}
 void CheckCHIPTLVPutStringF(nlTestSuite * inSuite, void * inContext)
 {
     const size_t bufsize = 24;
@@ -2442,6 +2870,63 @@ void CheckCHIPTLVSkipCircular(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+void WriteCopyCircularElement(nlTestSuite * inSuite, TLVWriter & aWriter, uint64_t aTag)
+{
+    TLVType outerContainerType;
+
+    NL_TEST_ASSERT(inSuite, aWriter.StartContainer(aTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, aWriter.PutString(ContextTag(1), "Sample string") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, aWriter.Put(ContextTag(2), static_cast<uint32_t>(0x12345678)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, aWriter.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+}
+
+/**
+ *  Test copying elements that wrap around the end of a circular buffer
+ */
+void CheckCHIPTLVCopyCircular(nlTestSuite * inSuite, void * inContext)
+{
+    const size_t bufsize = 40; // large enough for one element, whichever offset it starts at
+    uint8_t backingStore[bufsize];
+    uint8_t expected[64];
+    uint8_t copied[64];
+    TLVWriter flatWriter;
+    uint32_t expectedLen;
+
+    flatWriter.Init(expected, sizeof(expected));
+    WriteCopyCircularElement(inSuite, flatWriter, ProfileTag(TestProfile_1, 5));
+    NL_TEST_ASSERT(inSuite, flatWriter.Finalize() == CHIP_NO_ERROR);
+    expectedLen = flatWriter.GetLengthWritten();
+
+    for (size_t start = 0; start < bufsize; start++)
+    {
+        CircularTLVWriter writer;
+        CircularTLVReader reader;
+        CHIPCircularTLVBuffer buffer(backingStore, bufsize, &backingStore[start]);
+
+        writer.Init(buffer);
+        WriteCopyCircularElement(inSuite, writer, AnonymousTag);
+        NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+        // Only the tag of the element itself is rewritten.
+        reader.Init(buffer);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+        flatWriter.Init(copied, sizeof(copied));
+        NL_TEST_ASSERT(inSuite, flatWriter.CopyElement(ProfileTag(TestProfile_1, 5), reader) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, flatWriter.Finalize() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, flatWriter.GetLengthWritten() == expectedLen);
+        NL_TEST_ASSERT(inSuite, memcmp(copied, expected, expectedLen) == 0);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+
+        reader.Init(buffer);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+        flatWriter.Init(copied, sizeof(copied));
+        NL_TEST_ASSERT(inSuite, flatWriter.CopyContainer(ProfileTag(TestProfile_1, 5), reader) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, flatWriter.Finalize() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, flatWriter.GetLengthWritten() == expectedLen);
+        NL_TEST_ASSERT(inSuite, memcmp(copied, expected, expectedLen) == 0);
+    }
+}
+
 /**
  *  Test Buffer Overflow
  */
@@ -3320,6 +3805,8 @@ static void CheckCHIPUpdater(nlTestSuite * inSuite, void * inContext)
     AppendReadTest(inSuite);
 
     WriteDeleteReadTest(inSuite);
+
+    WriteReplaceReadTest(inSuite);
 }
 
 /**
@@ -3753,6 +4240,7 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("Simple Write Read Test",              CheckSimpleWriteRead),
     NL_TEST_DEF("Inet Buffer Test",                    CheckPacketBuffer),
+    NL_TEST_DEF("Inet Buffer Growing Test",            CheckPacketBufferGrowing),
     NL_TEST_DEF("Buffer Overflow Test",                CheckBufferOverflow),
     NL_TEST_DEF("Pretty Print Test",                   CheckPrettyPrinter),
     NL_TEST_DEF("Data Macro Test",                     CheckDataMacro),
@@ -3762,14 +4250,19 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Reader",                     CheckCHIPTLVReader),
     NL_TEST_DEF("CHIP TLV Utilities",                  CheckCHIPTLVUtilities),
     NL_TEST_DEF("CHIP TLV Updater",                    CheckCHIPUpdater),
+    NL_TEST_DEF("CHIP TLV Index",                      CheckCHIPTLVIndex),
     NL_TEST_DEF("CHIP TLV Empty Find",                 CheckCHIPTLVEmptyFind),
+    NL_TEST_DEF("CHIP TLV Fixed Layout Container",     CheckFixedLayoutContainer),
     NL_TEST_DEF("CHIP Circular TLV buffer, simple",    CheckCircularTLVBufferSimple),
     NL_TEST_DEF("CHIP Circular TLV buffer, mid-buffer start", CheckCircularTLVBufferStartMidway),
     NL_TEST_DEF("CHIP Circular TLV buffer, straddle",  CheckCircularTLVBufferEvictStraddlingEvent),
     NL_TEST_DEF("CHIP Circular TLV buffer, edge",      CheckCircularTLVBufferEdge),
+    NL_TEST_DEF("CHIP Circular TLV buffer, element index", CheckCircularTLVBufferElementIndex),
+    NL_TEST_DEF("CHIP Circular TLV buffer, align head", CheckCircularTLVBufferAlignHead),
     NL_TEST_DEF("CHIP TLV Printf",                     CheckCHIPTLVPutStringF),
     NL_TEST_DEF("CHIP TLV Printf, Circular TLV buf",   CheckCHIPTLVPutStringFCircular),
     NL_TEST_DEF("CHIP TLV Skip non-contiguous",        CheckCHIPTLVSkipCircular),
+    NL_TEST_DEF("CHIP TLV Copy non-contiguous",        CheckCHIPTLVCopyCircular),
     NL_TEST_DEF("CHIP TLV Check reserve",              CheckCloseContainerReserve),
     NL_TEST_DEF("CHIP TLV Reader Fuzz Test",           TLVReaderFuzzTest),
 
@@ -189,6 +189,10 @@ public:
     /// Advertises the CHIP node as a commisioning/commissionable node
     virtual CHIP_ERROR Advertise(const CommissionAdvertisingParameters & params) = 0;
 
+    /// Applies the items 'Advertised' since Start() as one update, removing
+    /// the items advertised before Start() that were not advertised again.
+    virtual CHIP_ERROR FinalizeServiceUpdate() { return CHIP_NO_ERROR; }
+
     /// Provides the system-wide implementation of the service advertiser
     static ServiceAdvertiser & Instance();
 };
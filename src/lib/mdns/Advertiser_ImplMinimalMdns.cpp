@@ -18,20 +18,21 @@
 #include "Advertiser.h"
 
 #include <inttypes.h>
+#include <new>
 #include <stdio.h>
+#include <type_traits>
 
 #include "MinimalMdnsServer.h"
 #include "ServiceNaming.h"
 
 #include <mdns/minimal/ResponseSender.h>
 #include <mdns/minimal/Server.h>
-#include <mdns/minimal/core/FlatAllocatedQName.h>
+#include <mdns/minimal/core/QNameArena.h>
 #include <mdns/minimal/responders/IP.h>
 #include <mdns/minimal/responders/Ptr.h>
 #include <mdns/minimal/responders/QueryResponder.h>
 #include <mdns/minimal/responders/Srv.h>
 #include <mdns/minimal/responders/Txt.h>
-#include <support/CHIPMem.h>
 #include <support/RandUtils.h>
 #include <support/StringBuilder.h>
 
@@ -108,10 +109,6 @@ public:
         {
             mAllocatedResponders[i] = nullptr;
         }
-        for (size_t i = 0; i < kMaxAllocatedQNameData; i++)
-        {
-            mAllocatedQNameParts[i] = nullptr;
-        }
     }
     ~AdvertiserMinMdns() { Clear(); }
 
@@ -129,8 +126,16 @@ public:
     void OnQuery(const QueryData & data) override;
 
 private:
-    /// Sets the query responder to a blank state and frees up any
-    /// allocated memory.
+    /// What the responders currently answer for
+    enum class AdvertisedKind
+    {
+        kNone,
+        kOperational,
+        kCommission,
+    };
+
+    /// Sets the query responder to a blank state, destroying the responders
+    /// and releasing the names they use.
     void Clear();
 
     /// Advertise available records configured within the server
@@ -142,13 +147,34 @@ private:
     /// interfaces on which the mDNS server is listening
     bool ShouldAdvertiseOn(const chip::Inet::InterfaceId id, const chip::Inet::IPAddress & addr);
 
-    QueryResponderSettings AddAllocatedResponder(Responder * responder)
+    /// Starts building the names of a new advertisement, which AllocateQName
+    /// places next to the names currently advertised.
+    void StageQNames() { mQNames[1 - mActiveQNames].Clear(); }
+
+    /// Returns true if the names staged since StageQNames and the given
+    /// settings are those already advertised, so that the records can be kept
+    /// as they are, along with their serialized form.
+    bool IsAdvertised(AdvertisedKind kind, uint64_t port, bool ipv4Enabled) const
     {
-        if (responder == nullptr)
-        {
-            ChipLogError(Discovery, "Responder memory allocation failed");
-            return QueryResponderSettings(); // failed
-        }
+        return (mAdvertisedKind == kind) && (mAdvertisedPort == port) && (mAdvertisedIPv4Enabled == ipv4Enabled) &&
+            mQNames[1 - mActiveQNames].HasSameNamesAs(mQNames[mActiveQNames]);
+    }
+
+    /// Replaces the advertised records: the responders are destroyed and the
+    /// staged names become the advertised ones, for new responders to use.
+    void ActivateStagedQNames()
+    {
+        Clear();
+        mActiveQNames = 1 - mActiveQNames;
+    }
+
+    /// Appends another responder to the internal replies, built in place in
+    /// the first free responder slot.
+    template <typename ResponderType, typename... Args>
+    QueryResponderSettings AddResponder(Args &&... args)
+    {
+        static_assert(sizeof(ResponderType) <= sizeof(ResponderStorage), "Responder does not fit in its slot");
+        static_assert(alignof(ResponderStorage) % alignof(ResponderType) == 0, "Responder slot is not aligned for responder");
 
         for (size_t i = 0; i < kMaxAllocatedResponders; i++)
         {
@@ -157,45 +183,23 @@ private:
                 continue;
             }
 
-            mAllocatedResponders[i] = responder;
+            mAllocatedResponders[i] = new (&mResponderStorage[i]) ResponderType(std::forward<Args>(args)...);
             return mQueryResponder.AddResponder(mAllocatedResponders[i]);
         }
 
-        Platform::Delete(responder);
         ChipLogError(Discovery, "Failed to find free slot for adding a responder");
         return QueryResponderSettings();
     }
 
-    /// Appends another responder to the internal replies.
-    template <typename ResponderType, typename... Args>
-    QueryResponderSettings AddResponder(Args &&... args)
-    {
-        return AddAllocatedResponder(chip::Platform::New<ResponderType>(std::forward<Args>(args)...));
-    }
-
     template <typename... Args>
     FullQName AllocateQName(Args &&... names)
     {
-        for (size_t i = 0; i < kMaxAllocatedQNameData; i++)
+        FullQName name = mQNames[1 - mActiveQNames].Allocate(std::forward<Args>(names)...);
+        if (name.nameCount == 0)
         {
-            if (mAllocatedQNameParts[i] != nullptr)
-            {
-                continue;
-            }
-
-            mAllocatedQNameParts[i] =
-                chip::Platform::MemoryAlloc(FlatAllocatedQName::RequiredStorageSize(std::forward<Args>(names)...));
-
-            if (mAllocatedQNameParts[i] == nullptr)
-            {
-                ChipLogError(Discovery, "QName memory allocation failed");
-                return FullQName();
-            }
-            return FlatAllocatedQName::Build(mAllocatedQNameParts[i], std::forward<Args>(names)...);
+            ChipLogError(Discovery, "Failed to find storage for adding a qname");
         }
-
-        ChipLogError(Discovery, "Failed to find free slot for adding a qname");
-        return FullQName();
+        return name;
     }
 
     FullQName GetCommisioningTextEntries(const CommissionAdvertisingParameters & params);
@@ -203,6 +207,10 @@ private:
     static constexpr size_t kMaxRecords             = 16;
     static constexpr size_t kMaxAllocatedResponders = 16;
     static constexpr size_t kMaxAllocatedQNameData  = 8;
+    static constexpr size_t kQNameStorageSize       = CHIP_CONFIG_MDNS_ADVERTISER_QNAME_STORAGE_SIZE;
+
+    using ResponderStorage = std::aligned_union<0, PtrResponder, SrvResponder, TxtResponder, IPv4Responder, IPv6Responder>::type;
+    using QNameStorage     = QNameArena<kQNameStorageSize, kMaxAllocatedQNameData>;
 
     QueryResponder<kMaxRecords> mQueryResponder;
     ResponseSender mResponseSender;
@@ -211,9 +219,21 @@ private:
     const chip::Inet::IPPacketInfo * mCurrentSource = nullptr;
     uint32_t mMessageId                             = 0;
 
-    // dynamically allocated items
+    // Responders and names are kept in fixed storage that is reused by every
+    // advertisement, rather than allocated for each of them
+    ResponderStorage mResponderStorage[kMaxAllocatedResponders];
     Responder * mAllocatedResponders[kMaxAllocatedResponders];
-    void * mAllocatedQNameParts[kMaxAllocatedQNameData];
+    QNameStorage mQNames[2];
+    size_t mActiveQNames = 0;
+
+    // what the responders were built for, see IsAdvertised
+    AdvertisedKind mAdvertisedKind = AdvertisedKind::kNone;
+    uint64_t mAdvertisedPort       = 0;
+    bool mAdvertisedIPv4Enabled    = false;
+
+    // kept while advertising as commissionable, so that the names do not
+    // change when the advertisement is refreshed
+    char mCommissionInstanceName[17] = "";
 
     const char * mEmptyTextEntries[1] = {
         "=",
@@ -269,29 +289,23 @@ void AdvertiserMinMdns::Clear()
     // Init clears all responders, so that data can be freed
     mQueryResponder.Init();
 
-    // Free all allocated data
+    // Destroy all responders, their storage is reused
     for (size_t i = 0; i < kMaxAllocatedResponders; i++)
     {
         if (mAllocatedResponders[i] != nullptr)
         {
-            chip::Platform::Delete(mAllocatedResponders[i]);
+            mAllocatedResponders[i]->~Responder();
             mAllocatedResponders[i] = nullptr;
         }
     }
 
-    for (size_t i = 0; i < kMaxAllocatedQNameData; i++)
-    {
-        if (mAllocatedQNameParts[i] != nullptr)
-        {
-            chip::Platform::MemoryFree(mAllocatedQNameParts[i]);
-            mAllocatedQNameParts[i] = nullptr;
-        }
-    }
+    mQNames[mActiveQNames].Clear();
+    mAdvertisedKind = AdvertisedKind::kNone;
 }
 
 CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters & params)
 {
-    Clear();
+    StageQNames();
 
     char nameBuffer[64] = "";
 
@@ -310,6 +324,14 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
         return CHIP_ERROR_NO_MEMORY;
     }
 
+    if (IsAdvertised(AdvertisedKind::kOperational, params.GetPort(), params.IsIPv4Enabled()))
+    {
+        ChipLogProgress(Discovery, "CHIP minimal mDNS 'Operational device' records unchanged.");
+        return CHIP_NO_ERROR;
+    }
+
+    ActivateStagedQNames();
+
     if (!AddResponder<PtrResponder>(operationalServiceName, operationalServerName)
              .SetReportAdditional(operationalServerName)
              .SetReportInServiceListing(true)
@@ -349,6 +371,10 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
         }
     }
 
+    mAdvertisedKind        = AdvertisedKind::kOperational;
+    mAdvertisedPort        = params.GetPort();
+    mAdvertisedIPv4Enabled = params.IsIPv4Enabled();
+
     ChipLogProgress(Discovery, "CHIP minimal mDNS configured as 'Operational device'.");
 
     return CHIP_NO_ERROR;
@@ -356,29 +382,57 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
 
 CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters & params)
 {
-    Clear();
+    StageQNames();
 
     // TODO: need to detect colisions here
-    char nameBuffer[64] = "";
-    size_t len          = snprintf(nameBuffer, sizeof(nameBuffer), "%016" PRIX64, GetRandU64());
-    if (len >= sizeof(nameBuffer))
+    if (mAdvertisedKind != AdvertisedKind::kCommission)
     {
-        return CHIP_ERROR_NO_MEMORY;
+        size_t len = snprintf(mCommissionInstanceName, sizeof(mCommissionInstanceName), "%016" PRIX64, GetRandU64());
+        if (len >= sizeof(mCommissionInstanceName))
+        {
+            return CHIP_ERROR_NO_MEMORY;
+        }
     }
     const char * serviceType = params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissioning ? "_chipc" : "_chipd";
+    char nameBuffer[64]      = "";
 
     FullQName operationalServiceName = AllocateQName(serviceType, "_udp", "local");
-    FullQName operationalServerName  = AllocateQName(nameBuffer, serviceType, "_udp", "local");
+    FullQName operationalServerName  = AllocateQName(mCommissionInstanceName, serviceType, "_udp", "local");
 
     ReturnErrorOnFailure(MakeHostName(nameBuffer, sizeof(nameBuffer), params.GetMac()));
     FullQName serverName = AllocateQName(nameBuffer, "local");
 
-    if ((operationalServiceName.nameCount == 0) || (operationalServerName.nameCount == 0) || (serverName.nameCount == 0))
+    sprintf(nameBuffer, "_S%03d", params.GetShortDiscriminator());
+    FullQName shortServiceName = AllocateQName(nameBuffer, "_sub", serviceType, "_udp", "local");
+
+    sprintf(nameBuffer, "_L%04d", params.GetLongDiscriminator());
+    FullQName longServiceName = AllocateQName(nameBuffer, "_sub", serviceType, "_udp", "local");
+
+    FullQName vendorServiceName;
+    if (params.GetVendorId().HasValue())
+    {
+        sprintf(nameBuffer, "_V%d", params.GetVendorId().Value());
+        vendorServiceName = AllocateQName(nameBuffer, "_sub", serviceType, "_udp", "local");
+        ReturnErrorCodeIf(vendorServiceName.nameCount == 0, CHIP_ERROR_NO_MEMORY);
+    }
+
+    FullQName textEntries = GetCommisioningTextEntries(params);
+
+    if ((operationalServiceName.nameCount == 0) || (operationalServerName.nameCount == 0) || (serverName.nameCount == 0) ||
+        (shortServiceName.nameCount == 0) || (longServiceName.nameCount == 0) || (textEntries.nameCount == 0))
     {
         ChipLogError(Discovery, "Failed to allocate QNames.");
         return CHIP_ERROR_NO_MEMORY;
     }
 
+    if (IsAdvertised(AdvertisedKind::kCommission, params.GetPort(), params.IsIPv4Enabled()))
+    {
+        ChipLogProgress(Discovery, "CHIP minimal mDNS 'Commisioning device' records unchanged.");
+        return CHIP_NO_ERROR;
+    }
+
+    ActivateStagedQNames();
+
     if (!AddResponder<PtrResponder>(operationalServiceName, operationalServerName)
              .SetReportAdditional(operationalServerName)
              .SetReportInServiceListing(true)
@@ -410,41 +464,26 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
         }
     }
 
+    if (!AddResponder<PtrResponder>(shortServiceName, operationalServerName)
+             .SetReportAdditional(operationalServerName)
+             .SetReportInServiceListing(true)
+             .IsValid())
     {
-        sprintf(nameBuffer, "_S%03d", params.GetShortDiscriminator());
-        FullQName shortServiceName = AllocateQName(nameBuffer, "_sub", serviceType, "_udp", "local");
-        ReturnErrorCodeIf(shortServiceName.nameCount == 0, CHIP_ERROR_NO_MEMORY);
-
-        if (!AddResponder<PtrResponder>(shortServiceName, operationalServerName)
-                 .SetReportAdditional(operationalServerName)
-                 .SetReportInServiceListing(true)
-                 .IsValid())
-        {
-            ChipLogError(Discovery, "Failed to add short discriminator PTR record mDNS responder");
-            return CHIP_ERROR_NO_MEMORY;
-        }
+        ChipLogError(Discovery, "Failed to add short discriminator PTR record mDNS responder");
+        return CHIP_ERROR_NO_MEMORY;
     }
 
+    if (!AddResponder<PtrResponder>(longServiceName, operationalServerName)
+             .SetReportAdditional(operationalServerName)
+             .SetReportInServiceListing(true)
+             .IsValid())
     {
-        sprintf(nameBuffer, "_L%04d", params.GetLongDiscriminator());
-        FullQName longServiceName = AllocateQName(nameBuffer, "_sub", serviceType, "_udp", "local");
-        ReturnErrorCodeIf(longServiceName.nameCount == 0, CHIP_ERROR_NO_MEMORY);
-        if (!AddResponder<PtrResponder>(longServiceName, operationalServerName)
-                 .SetReportAdditional(operationalServerName)
-                 .SetReportInServiceListing(true)
-                 .IsValid())
-        {
-            ChipLogError(Discovery, "Failed to add long discriminator PTR record mDNS responder");
-            return CHIP_ERROR_NO_MEMORY;
-        }
+        ChipLogError(Discovery, "Failed to add long discriminator PTR record mDNS responder");
+        return CHIP_ERROR_NO_MEMORY;
     }
 
     if (params.GetVendorId().HasValue())
     {
-        sprintf(nameBuffer, "_V%d", params.GetVendorId().Value());
-        FullQName vendorServiceName = AllocateQName(nameBuffer, "_sub", serviceType, "_udp", "local");
-        ReturnErrorCodeIf(vendorServiceName.nameCount == 0, CHIP_ERROR_NO_MEMORY);
-
         if (!AddResponder<PtrResponder>(vendorServiceName, operationalServerName)
                  .SetReportAdditional(operationalServerName)
                  .SetReportInServiceListing(true)
@@ -455,7 +494,7 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
         }
     }
 
-    if (!AddResponder<TxtResponder>(TxtResourceRecord(operationalServerName, GetCommisioningTextEntries(params)))
+    if (!AddResponder<TxtResponder>(TxtResourceRecord(operationalServerName, textEntries))
              .SetReportAdditional(serverName)
              .IsValid())
     {
@@ -463,6 +502,10 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
         return CHIP_ERROR_NO_MEMORY;
     }
 
+    mAdvertisedKind        = AdvertisedKind::kCommission;
+    mAdvertisedPort        = params.GetPort();
+    mAdvertisedIPv4Enabled = params.IsIPv4Enabled();
+
     ChipLogProgress(Discovery, "CHIP minimal mDNS configured as 'Commisioning device'.");
 
     return CHIP_NO_ERROR;
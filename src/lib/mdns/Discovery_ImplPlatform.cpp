@@ -53,7 +53,7 @@ CHIP_ERROR DiscoveryImplPlatform::Start(Inet::InetLayer * inetLayer, uint16_t po
 {
     ReturnErrorOnFailure(Init());
 
-    CHIP_ERROR error = ChipMdnsStopPublish();
+    CHIP_ERROR error = ChipMdnsRemoveServices();
 
     if (error != CHIP_NO_ERROR)
     {
@@ -313,6 +313,11 @@ CHIP_ERROR DiscoveryImplPlatform::Advertise(const OperationalAdvertisingParamete
     return error;
 }
 
+CHIP_ERROR DiscoveryImplPlatform::FinalizeServiceUpdate()
+{
+    return ChipMdnsFinalizeServiceUpdate();
+}
+
 CHIP_ERROR DiscoveryImplPlatform::StopPublishDevice()
 {
     mIsOperationalPublishing  = false;
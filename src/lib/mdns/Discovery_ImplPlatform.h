@@ -41,6 +41,9 @@ public:
     /// Advertises the CHIP node as a commisioning/commissionable node
     CHIP_ERROR Advertise(const CommissionAdvertisingParameters & params) override;
 
+    /// Removes the services not advertised again since Start(), and applies the changes to the others
+    CHIP_ERROR FinalizeServiceUpdate() override;
+
     /// This function stops publishing the device on mDNS.
     CHIP_ERROR StopPublishDevice();
 
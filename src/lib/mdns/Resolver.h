@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include <core/CHIPError.h>
@@ -65,8 +66,27 @@ public:
     virtual CHIP_ERROR SetResolverDelegate(ResolverDelegate * delegate) = 0;
 
     /// Requests resolution of a node ID to its address
+    ///
+    /// Implementations remembering addresses may call OnNodeIdResolved before returning.
     virtual CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) = 0;
 
+    /// Requests resolution of several node IDs to their addresses
+    ///
+    /// Implementations may pack the queries in few packets and spread these over time. Each node is
+    /// reported on its own, as for ResolveNodeId.
+    virtual CHIP_ERROR ResolveNodeIds(const PeerId * peerIds, size_t count, Inet::IPAddressType type)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            CHIP_ERROR err = ResolveNodeId(peerIds[i], type);
+            if (err != CHIP_NO_ERROR)
+            {
+                return err;
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
     /// Provides the system-wide implementation of the service resolver
     static Resolver & Instance();
 };
@@ -0,0 +1,312 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Resolver.h"
+
+namespace chip {
+namespace Mdns {
+
+/// Remembers resolved node addresses for as long as the TTLs of their records.
+///
+/// Entries are only created for nodes being resolved (see MarkPending): responses about
+/// other nodes, including unsolicited announcements, only update entries already present.
+/// When the cache is full, the least recently used entry makes room.
+///
+/// An entry looked up since it was last refreshed is due for a refresh query at 80% of its
+/// TTL, as RFC 6762 section 5.2 recommends. Entries nobody looks up are left to expire.
+///
+/// The cache also holds the queries waiting to be sent in batches (see QueueQuery). The queries
+/// about nodes already resolved only need to be sent on the interface the nodes were seen on.
+///
+/// Times are in milliseconds of any monotonic clock.
+template <size_t kCacheSize>
+class ResolverCache
+{
+public:
+    static constexpr uint64_t kNoRefreshMs = UINT64_MAX;
+
+    /// Finds the unexpired address of a node, of the given type unless type is kIPAddressType_Any.
+    /// The entry becomes due for a refresh query before it expires.
+    const ResolvedNodeData * Lookup(const PeerId & peerId, Inet::IPAddressType type, uint64_t nowMs)
+    {
+        Entry * entry = Find(peerId, nowMs);
+
+        if (entry == nullptr || entry->mState != State::kResolved)
+        {
+            return nullptr;
+        }
+        if (type != Inet::kIPAddressType_Any && entry->mData.mAddress.Type() != type)
+        {
+            return nullptr;
+        }
+
+        entry->mLastUsedMs = nowMs;
+        entry->mInUse      = true;
+        return &entry->mData;
+    }
+
+    /// Notes that a query for a node is being sent, so that a response received within timeoutMs is cached.
+    void MarkPending(const PeerId & peerId, uint64_t nowMs, uint32_t timeoutMs)
+    {
+        Entry * entry = Find(peerId, nowMs);
+
+        if (entry == nullptr)
+        {
+            entry                = Allocate(nowMs, /* evictPending = */ true);
+            entry->mData         = ResolvedNodeData();
+            entry->mData.mPeerId = peerId;
+            entry->mState        = State::kPending;
+            entry->mRefreshMs    = kNoRefreshMs;
+            entry->mInUse        = false;
+        }
+        if (entry->mState == State::kPending)
+        {
+            entry->mExpiryMs = nowMs + timeoutMs;
+        }
+        entry->mQueryQueued = false;
+        entry->mLastUsedMs  = nowMs;
+    }
+
+    /// Queues a query for a node, creating a pending entry for it unless it has one. The entry
+    /// of a node being resolved or queued is never evicted for it.
+    /// Returns false when there is no room.
+    bool QueueQuery(const PeerId & peerId, uint64_t nowMs)
+    {
+        Entry * entry = Find(peerId, nowMs);
+
+        if (entry == nullptr)
+        {
+            entry = Allocate(nowMs, /* evictPending = */ false);
+            if (entry == nullptr)
+            {
+                return false;
+            }
+            entry->mData         = ResolvedNodeData();
+            entry->mData.mPeerId = peerId;
+            entry->mState        = State::kPending;
+            entry->mExpiryMs     = UINT64_MAX; /* Set once the query is sent. */
+            entry->mRefreshMs    = kNoRefreshMs;
+            entry->mInUse        = false;
+            entry->mLastUsedMs   = nowMs;
+        }
+        entry->mQueryQueued = true;
+        return true;
+    }
+
+    bool HasQueuedQueries() const
+    {
+        for (const Entry & entry : mEntries)
+        {
+            if (entry.mState != State::kFree && entry.mQueryQueued)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Calls take(peerId) for the queued queries to send on the same interface as the first one, until it
+    /// returns false, which leaves that query queued. interfaceId is set to that interface: the one the node
+    /// was last seen on, or INET_NULL_INTERFACEID (all of them) for nodes not resolved yet.
+    /// The nodes not resolved yet of the queries taken wait timeoutMs for a response.
+    template <typename TakeFunct>
+    void TakeQueuedQueries(uint64_t nowMs, uint32_t timeoutMs, Inet::InterfaceId * interfaceId, TakeFunct take)
+    {
+        bool first = true;
+
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mState == State::kFree || !entry.mQueryQueued)
+            {
+                continue;
+            }
+
+            const Inet::InterfaceId queryInterfaceId =
+                (entry.mState == State::kResolved) ? entry.mData.mInterfaceId : INET_NULL_INTERFACEID;
+
+            if (first)
+            {
+                *interfaceId = queryInterfaceId;
+                first        = false;
+            }
+            else if (queryInterfaceId != *interfaceId)
+            {
+                continue;
+            }
+
+            if (!take(entry.mData.mPeerId))
+            {
+                return;
+            }
+            entry.mQueryQueued = false;
+            if (entry.mState == State::kPending)
+            {
+                entry.mExpiryMs = nowMs + timeoutMs;
+            }
+        }
+    }
+
+    /// Updates the entry of a node from a received response. A TTL of 0 (a goodbye) removes it.
+    /// Returns false when the node is neither cached nor being resolved.
+    bool Update(const ResolvedNodeData & data, uint32_t ttlSeconds, uint64_t nowMs)
+    {
+        Entry * entry = Find(data.mPeerId, nowMs);
+
+        if (entry == nullptr)
+        {
+            return false;
+        }
+        if (ttlSeconds == 0)
+        {
+            entry->mState = State::kFree;
+            return true;
+        }
+
+        if (entry->mState == State::kPending)
+        {
+            entry->mLastUsedMs = nowMs;
+        }
+        entry->mData        = data;
+        entry->mState       = State::kResolved;
+        entry->mQueryQueued = false;
+        entry->mExpiryMs    = nowMs + ttlSeconds * UINT64_C(1000);
+        entry->mRefreshMs   = nowMs + ttlSeconds * UINT64_C(800);
+        return true;
+    }
+
+    void Remove(const PeerId & peerId)
+    {
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mState != State::kFree && entry.mData.mPeerId == peerId)
+            {
+                entry.mState = State::kFree;
+            }
+        }
+    }
+
+    void Clear()
+    {
+        for (Entry & entry : mEntries)
+        {
+            entry.mState = State::kFree;
+        }
+    }
+
+    /// The time at which the next refresh query is due, kNoRefreshMs if none is.
+    uint64_t GetNextRefreshMs() const
+    {
+        uint64_t next = kNoRefreshMs;
+
+        for (const Entry & entry : mEntries)
+        {
+            if (entry.mState == State::kResolved && entry.mInUse && entry.mRefreshMs < next)
+            {
+                next = entry.mRefreshMs;
+            }
+        }
+        return next;
+    }
+
+    /// Calls refresh(peerId) for every node due for a refresh query. A node is refreshed once per
+    /// TTL: after that, it needs a response and another lookup to be refreshed again.
+    template <typename RefreshFunct>
+    void RefreshDue(uint64_t nowMs, RefreshFunct refresh)
+    {
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mState == State::kResolved && entry.mInUse && entry.mRefreshMs <= nowMs && nowMs < entry.mExpiryMs)
+            {
+                entry.mInUse     = false;
+                entry.mRefreshMs = entry.mExpiryMs;
+                refresh(entry.mData.mPeerId);
+            }
+        }
+    }
+
+private:
+    enum class State : uint8_t
+    {
+        kFree,
+        kPending,  /* Being resolved, mData only holds the peer id. */
+        kResolved, /* mData holds the address of the node. */
+    };
+
+    struct Entry
+    {
+        ResolvedNodeData mData;
+        uint64_t mExpiryMs   = 0;
+        uint64_t mRefreshMs  = 0;
+        uint64_t mLastUsedMs = 0;
+        State mState         = State::kFree;
+        bool mInUse          = false; /* Looked up since it was last refreshed. */
+        bool mQueryQueued    = false; /* A query for the node waits to be sent. */
+    };
+
+    /// Finds the entry of a node, dropping it if it expired.
+    Entry * Find(const PeerId & peerId, uint64_t nowMs)
+    {
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mState == State::kFree || entry.mData.mPeerId != peerId)
+            {
+                continue;
+            }
+            if (nowMs >= entry.mExpiryMs)
+            {
+                entry.mState = State::kFree;
+                return nullptr;
+            }
+            return &entry;
+        }
+        return nullptr;
+    }
+
+    /// Returns a free or expired entry, or else the least recently used one. Unless evictPending is set,
+    /// the entries of nodes being resolved or queued are left alone, and nullptr is returned if there are only those.
+    Entry * Allocate(uint64_t nowMs, bool evictPending)
+    {
+        Entry * oldest = nullptr;
+
+        for (Entry & entry : mEntries)
+        {
+            if (entry.mState == State::kFree || nowMs >= entry.mExpiryMs)
+            {
+                return &entry;
+            }
+            if (!evictPending && (entry.mState == State::kPending || entry.mQueryQueued))
+            {
+                continue;
+            }
+            if (oldest == nullptr || entry.mLastUsedMs < oldest->mLastUsedMs)
+            {
+                oldest = &entry;
+            }
+        }
+        return oldest;
+    }
+
+    Entry mEntries[kCacheSize];
+};
+
+} // namespace Mdns
+} // namespace chip
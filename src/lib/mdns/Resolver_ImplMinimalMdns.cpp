@@ -18,13 +18,17 @@
 #include "Resolver.h"
 
 #include "MinimalMdnsServer.h"
+#include "ResolverCache.h"
 #include "ServiceNaming.h"
 
 #include <mdns/minimal/Parser.h>
 #include <mdns/minimal/QueryBuilder.h>
 #include <mdns/minimal/RecordData.h>
 
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
 #include <support/logging/CHIPLogging.h>
+#include <system/SystemLayer.h>
 
 // MDNS servers will receive all broadcast packets over the network.
 // Disable 'invalid packet' messages because the are expected and common
@@ -40,6 +44,10 @@ constexpr uint16_t kMdnsPort        = 5353;
 
 using namespace mdns::Minimal;
 
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+using NodeCache = ResolverCache<CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE>;
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+
 class PacketDataReporter : public ParserDelegate
 {
 public:
@@ -49,6 +57,11 @@ public:
         mNodeData.mInterfaceId = interfaceId;
     }
 
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    /// Also keep the entries of the cache current with the received records.
+    void SetCache(NodeCache * cache) { mCache = cache; }
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+
     // ParserDelegate implementation
 
     void OnHeader(ConstHeaderRef & header) override;
@@ -59,13 +72,19 @@ private:
     ResolverDelegate * mDelegate = nullptr;
     ResolvedNodeData mNodeData;
     BytesRange mPacketRange;
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    NodeCache * mCache = nullptr;
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
 
     bool mValid       = false;
     bool mHasNodePort = false;
     bool mHasIP       = false;
+    uint64_t mSrvTtl  = 0;
+    uint64_t mIPTtl   = 0;
 
-    void OnSrvRecord(SerializedQNameIterator name, const SrvRecord & srv);
-    void OnIPAddress(const chip::Inet::IPAddress & addr);
+    void OnSrvRecord(SerializedQNameIterator name, const SrvRecord & srv, uint64_t ttl);
+    void OnIPAddress(const chip::Inet::IPAddress & addr, uint64_t ttl);
+    void OnNodeDataComplete();
 };
 
 void PacketDataReporter::OnQuery(const QueryData & data)
@@ -87,7 +106,7 @@ void PacketDataReporter::OnHeader(ConstHeaderRef & header)
     }
 }
 
-void PacketDataReporter::OnSrvRecord(SerializedQNameIterator name, const SrvRecord & srv)
+void PacketDataReporter::OnSrvRecord(SerializedQNameIterator name, const SrvRecord & srv, uint64_t ttl)
 {
 
     if (!name.Next())
@@ -124,15 +143,16 @@ void PacketDataReporter::OnSrvRecord(SerializedQNameIterator name, const SrvReco
     }
 
     mNodeData.mPort = srv.GetPort();
+    mSrvTtl         = ttl;
     mHasNodePort    = true;
 
     if (mHasIP)
     {
-        mDelegate->OnNodeIdResolved(mNodeData);
+        OnNodeDataComplete();
     }
 }
 
-void PacketDataReporter::OnIPAddress(const chip::Inet::IPAddress & addr)
+void PacketDataReporter::OnIPAddress(const chip::Inet::IPAddress & addr, uint64_t ttl)
 {
     // TODO: should validate that the IP address we receive belongs to the
     // server associated with the SRV record.
@@ -141,9 +161,30 @@ void PacketDataReporter::OnIPAddress(const chip::Inet::IPAddress & addr)
     // same entity. This may not be correct if multiple servers are reported
     // (if multi-admin decides to use unique ports for every ecosystem).
     mNodeData.mAddress = addr;
+    mIPTtl             = ttl;
     mHasIP             = true;
 
     if (mHasNodePort)
+    {
+        OnNodeDataComplete();
+    }
+}
+
+void PacketDataReporter::OnNodeDataComplete()
+{
+    // The address is only good for as long as both the SRV and the A/AAAA records are.
+    const uint64_t ttl = (mSrvTtl < mIPTtl) ? mSrvTtl : mIPTtl;
+
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    if (mCache != nullptr)
+    {
+        mCache->Update(mNodeData, static_cast<uint32_t>(ttl < UINT32_MAX ? ttl : UINT32_MAX),
+                       System::Layer::GetClock_MonotonicMS());
+    }
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+
+    // A TTL of 0 announces that the records are going away, which resolves nothing.
+    if (mDelegate != nullptr && ttl > 0)
     {
         mDelegate->OnNodeIdResolved(mNodeData);
     }
@@ -173,7 +214,7 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         }
         else
         {
-            OnSrvRecord(data.GetName(), srv);
+            OnSrvRecord(data.GetName(), srv, data.GetTtlSeconds());
         }
     }
     else if (data.GetType() == QType::A)
@@ -187,7 +228,7 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         }
         else
         {
-            OnIPAddress(addr);
+            OnIPAddress(addr, data.GetTtlSeconds());
         }
     }
     else if (data.GetType() == QType::AAAA)
@@ -201,11 +242,48 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         }
         else
         {
-            OnIPAddress(addr);
+            OnIPAddress(addr, data.GetTtlSeconds());
         }
     }
 }
 
+/// Adds the question resolving a node to a query packet.
+/// Returns CHIP_ERROR_BUFFER_TOO_SMALL, leaving the packet as it was, when the question does not fit.
+CHIP_ERROR AddNodeQuery(QueryBuilder & builder, const PeerId & peerId)
+{
+    char nameBuffer[64] = "";
+
+    // Node and fabricid are encoded in server names.
+    ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId));
+
+    const char * instanceQName[] = { nameBuffer, "_chip", "_tcp", "local" };
+    Query query(instanceQName);
+
+    query
+        .SetClass(QClass::IN)      //
+        .SetType(QType::ANY)       //
+        .SetAnswerViaUnicast(true) //
+        ;
+
+    // NOTE: type above is NOT A or AAAA because the name searched for is
+    // a SRV record. The layout is:
+    //    SRV -> hostname
+    //    Hostname -> A
+    //    Hostname -> AAAA
+    //
+    // Query is sent for ANY and expectation is to receive A/AAAA records
+    // in the additional section of the reply.
+    //
+    // Sending a A/AAAA query will return no results
+    // Sending a SRV query will return the srv only and an additional query
+    // would be needed to resolve the host name to an IP address
+
+    ReturnErrorCodeIf(!builder.HasRoomFor(query), CHIP_ERROR_BUFFER_TOO_SMALL);
+    builder.AddQuery(query);
+
+    return builder.Ok() ? CHIP_NO_ERROR : CHIP_ERROR_INTERNAL;
+}
+
 class MinMdnsResolver : public Resolver, public MdnsPacketDelegate
 {
 public:
@@ -218,30 +296,63 @@ public:
     CHIP_ERROR StartResolver(chip::Inet::InetLayer * inetLayer, uint16_t port) override;
     CHIP_ERROR SetResolverDelegate(ResolverDelegate * delegate) override;
     CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) override;
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    CHIP_ERROR ResolveNodeIds(const PeerId * peerIds, size_t count, Inet::IPAddressType type) override;
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
 
 private:
     ResolverDelegate * mDelegate = nullptr;
+
+    CHIP_ERROR SendQuery(const PeerId & peerId);
+
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    NodeCache mCache;
+    System::Layer * mSystemLayer = nullptr;
+    bool mSendingQueuedQueries   = false; /* Whether HandleQueryTimer sends the next packet of queued queries. */
+
+    void ScheduleRefresh();
+    static void HandleRefreshTimer(System::Layer * layer, void * appState, System::Error error);
+
+    CHIP_ERROR SendQueuedQueries();
+    void SendNextQueuedQueries();
+    static void HandleQueryTimer(System::Layer * layer, void * appState, System::Error error);
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
 };
 
 void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet::IPPacketInfo * info)
 {
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    PacketDataReporter reporter(mDelegate, info->Interface, data);
+
+    // Responses are parsed even without a delegate, announcements keep the cached addresses current.
+    reporter.SetCache(&mCache);
+#else
     if (mDelegate == nullptr)
     {
         return;
     }
 
     PacketDataReporter reporter(mDelegate, info->Interface, data);
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
 
     if (!ParsePacket(data, &reporter))
     {
         ChipLogError(Discovery, "Failed to parse received mDNS packet");
     }
+
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    ScheduleRefresh();
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
 }
 
 CHIP_ERROR MinMdnsResolver::StartResolver(chip::Inet::InetLayer * inetLayer, uint16_t port)
 {
     /// Note: we do not double-check the port as we assume the APP will always use
     /// the same inetLayer and port for mDNS.
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    mSystemLayer = inetLayer->SystemLayer();
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+
     if (GlobalMinimalMdnsServer::Server().IsListening())
     {
         return CHIP_NO_ERROR;
@@ -257,6 +368,33 @@ CHIP_ERROR MinMdnsResolver::SetResolverDelegate(ResolverDelegate * delegate)
 }
 
 CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type)
+{
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+    const uint64_t now              = System::Layer::GetClock_MonotonicMS();
+    const ResolvedNodeData * cached = mCache.Lookup(peerId, type, now);
+
+    if (cached != nullptr)
+    {
+        // Copied, the delegate may resolve again and change the cache.
+        const ResolvedNodeData nodeData = *cached;
+
+        // Being looked up makes the entry due for a refresh before it expires.
+        ScheduleRefresh();
+
+        if (mDelegate != nullptr)
+        {
+            mDelegate->OnNodeIdResolved(nodeData);
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    mCache.MarkPending(peerId, now, CHIP_CONFIG_NODE_ADDRESS_RESOLVE_TIMEOUT_MSECS);
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+
+    return SendQuery(peerId);
+}
+
+CHIP_ERROR MinMdnsResolver::SendQuery(const PeerId & peerId)
 {
     System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
     ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
@@ -264,42 +402,153 @@ CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId, Inet::IPAddress
     QueryBuilder builder(std::move(buffer));
     builder.Header().SetMessageId(0);
 
+    ReturnErrorOnFailure(AddNodeQuery(builder, peerId));
+
+    return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
+}
+
+#if CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+
+CHIP_ERROR MinMdnsResolver::ResolveNodeIds(const PeerId * peerIds, size_t count, Inet::IPAddressType type)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    for (size_t i = 0; i < count; i++)
     {
-        char nameBuffer[64] = "";
-
-        // Node and fabricid are encoded in server names.
-        ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId));
-
-        const char * instanceQName[] = { nameBuffer, "_chip", "_tcp", "local" };
-        Query query(instanceQName);
-
-        query
-            .SetClass(QClass::IN)      //
-            .SetType(QType::ANY)       //
-            .SetAnswerViaUnicast(true) //
-            ;
-
-        // NOTE: type above is NOT A or AAAA because the name searched for is
-        // a SRV record. The layout is:
-        //    SRV -> hostname
-        //    Hostname -> A
-        //    Hostname -> AAAA
-        //
-        // Query is sent for ANY and expectation is to receive A/AAAA records
-        // in the additional section of the reply.
-        //
-        // Sending a A/AAAA query will return no results
-        // Sending a SRV query will return the srv only and an additional query
-        // would be needed to resolve the host name to an IP address
-
-        builder.AddQuery(query);
+        const uint64_t now              = System::Layer::GetClock_MonotonicMS();
+        const ResolvedNodeData * cached = mCache.Lookup(peerIds[i], type, now);
+
+        if (cached != nullptr)
+        {
+            // Copied, the delegate may resolve again and change the cache.
+            const ResolvedNodeData nodeData = *cached;
+
+            if (mDelegate != nullptr)
+            {
+                mDelegate->OnNodeIdResolved(nodeData);
+            }
+        }
+        else if (!mCache.QueueQuery(peerIds[i], now))
+        {
+            // The cache is full of nodes being resolved, the remaining ones can be resolved once these are.
+            err = CHIP_ERROR_NO_MEMORY;
+            break;
+        }
     }
 
-    ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
+    ScheduleRefresh();
+
+    if (!mSendingQueuedQueries)
+    {
+        SendNextQueuedQueries();
+    }
+
+    return err;
+}
+
+CHIP_ERROR MinMdnsResolver::SendQueuedQueries()
+{
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+    ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    QueryBuilder builder(std::move(buffer));
+    builder.Header().SetMessageId(0);
+
+    Inet::InterfaceId interfaceId = INET_NULL_INTERFACEID;
+
+    // Pack as many questions for the same interface as fit, the others stay queued for the next packets.
+    mCache.TakeQueuedQueries(System::Layer::GetClock_MonotonicMS(), CHIP_CONFIG_NODE_ADDRESS_RESOLVE_TIMEOUT_MSECS, &interfaceId,
+                             [&builder](const PeerId & peerId) {
+                                 CHIP_ERROR err = AddNodeQuery(builder, peerId);
+
+                                 if (err != CHIP_NO_ERROR && err != CHIP_ERROR_BUFFER_TOO_SMALL)
+                                 {
+                                     ChipLogError(Discovery, "Failed to add an mDNS query: %s", chip::ErrorStr(err));
+                                 }
+                                 return err != CHIP_ERROR_BUFFER_TOO_SMALL;
+                             });
+
+    ReturnErrorCodeIf(builder.Header().GetQueryCount() == 0, CHIP_NO_ERROR);
+
+    // Nodes already resolved are refreshed on the interface they were seen on only. The questions ask
+    // for unicast answers, so that the other interfaces see no multicast traffic because of them.
+    if (interfaceId != INET_NULL_INTERFACEID)
+    {
+        return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort, interfaceId);
+    }
 
     return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
 }
 
+void MinMdnsResolver::SendNextQueuedQueries()
+{
+    mSendingQueuedQueries = false;
+
+    while (mCache.HasQueuedQueries())
+    {
+        if (SendQueuedQueries() != CHIP_NO_ERROR)
+        {
+            ChipLogError(Discovery, "Failed to send queued mDNS queries");
+        }
+
+        VerifyOrReturn(mCache.HasQueuedQueries());
+
+        // Spread the remaining packets, and the responses they cause, over time.
+        if (mSystemLayer != nullptr &&
+            mSystemLayer->StartTimer(CHIP_CONFIG_MDNS_RESOLVER_QUERY_INTERVAL_MSECS, HandleQueryTimer, this) == CHIP_SYSTEM_NO_ERROR)
+        {
+            mSendingQueuedQueries = true;
+            return;
+        }
+
+        // The queries cannot wait without a timer: their nodes would stay pending forever.
+        ChipLogError(Discovery, "Failed to schedule queued mDNS queries, sending them now");
+    }
+}
+
+void MinMdnsResolver::HandleQueryTimer(System::Layer * layer, void * appState, System::Error error)
+{
+    static_cast<MinMdnsResolver *>(appState)->SendNextQueuedQueries();
+}
+
+void MinMdnsResolver::ScheduleRefresh()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    const uint64_t next = mCache.GetNextRefreshMs();
+    const uint64_t now  = System::Layer::GetClock_MonotonicMS();
+
+    mSystemLayer->CancelTimer(HandleRefreshTimer, this);
+    VerifyOrReturn(next != NodeCache::kNoRefreshMs);
+
+    const uint64_t delay = (next > now) ? (next - now) : 0;
+    if (mSystemLayer->StartTimer(static_cast<uint32_t>(delay < UINT32_MAX ? delay : UINT32_MAX), HandleRefreshTimer, this) !=
+        CHIP_SYSTEM_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to schedule the mDNS resolver cache refresh");
+    }
+}
+
+void MinMdnsResolver::HandleRefreshTimer(System::Layer * layer, void * appState, System::Error error)
+{
+    MinMdnsResolver * resolver = static_cast<MinMdnsResolver *>(appState);
+
+    const uint64_t now = System::Layer::GetClock_MonotonicMS();
+
+    // The refresh queries are sent in batches. The answers update the entries as they arrive, the entries not answered for
+    // expire.
+    resolver->mCache.RefreshDue(now, [resolver, now](const PeerId & peerId) { resolver->mCache.QueueQuery(peerId, now); });
+
+    resolver->ScheduleRefresh();
+
+    if (!resolver->mSendingQueuedQueries)
+    {
+        resolver->SendNextQueuedQueries();
+    }
+}
+
+#endif // CHIP_CONFIG_MDNS_RESOLVER_CACHE_SIZE > 0
+
 MinMdnsResolver gResolver;
 
 } // namespace
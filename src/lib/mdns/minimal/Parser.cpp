@@ -60,6 +60,7 @@ bool QueryData::Parse(const BytesRange & validData, const uint8_t ** start)
     mAnswerViaUnicast = (klass & kQClassUnicastAnswerFlag) != 0;
     mClass            = static_cast<QClass>(klass & ~kQClassUnicastAnswerFlag);
     mNameIterator     = SerializedQNameIterator(validData, *start);
+    mNameHash         = mNameIterator.Hash();
 
     *start = nameEnd;
 
@@ -74,8 +75,8 @@ bool QueryData::Append(HeaderRef & hdr, chip::Encoding::BigEndian::BufferWriter
     }
 
     GetName().Put(out);
-    out.Put16(static_cast<uint16_t>(mType));
-    out.Put16(static_cast<uint16_t>(mClass) | (mAnswerViaUnicast ? kQClassUnicastAnswerFlag : 0));
+    out.PutFixed(static_cast<uint16_t>(mType),
+                 static_cast<uint16_t>(static_cast<uint16_t>(mClass) | (mAnswerViaUnicast ? kQClassUnicastAnswerFlag : 0)));
 
     if (out.Fit())
     {
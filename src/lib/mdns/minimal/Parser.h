@@ -34,7 +34,8 @@ public:
     QueryData(QType type, QClass klass, bool unicast) : mType(type), mClass(klass), mAnswerViaUnicast(unicast) {}
 
     QueryData(QType type, QClass klass, bool unicast, const uint8_t * nameStart, const BytesRange & validData) :
-        mType(type), mClass(klass), mAnswerViaUnicast(unicast), mNameIterator(validData, nameStart)
+        mType(type), mClass(klass), mAnswerViaUnicast(unicast), mNameIterator(validData, nameStart),
+        mNameHash(mNameIterator.Hash())
     {}
 
     QType GetType() const { return mType; }
@@ -48,6 +49,9 @@ public:
 
     SerializedQNameIterator GetName() const { return mNameIterator; }
 
+    /// QNameHash of the name, computed once for the responders to compare theirs against.
+    uint32_t GetNameHash() const { return mNameHash; }
+
     /// Parses a query structure
     ///
     /// Parses the query at [start] and updates start to the end of the structure.
@@ -63,6 +67,7 @@ private:
     QClass mClass          = QClass::ANY;
     bool mAnswerViaUnicast = false;
     SerializedQNameIterator mNameIterator;
+    uint32_t mNameHash = QNameHash::kUnknown;
 
     /// Flag as a boot-time internal query. This allows query replies
     /// to be built accordingly.
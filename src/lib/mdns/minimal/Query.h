@@ -66,8 +66,8 @@ public:
 
         mQName.Output(out);
 
-        out.Put16(static_cast<uint16_t>(mType));
-        out.Put16(static_cast<uint16_t>(static_cast<uint16_t>(mClass) | (mAnswerViaUnicast ? kQClassUnicastAnswerFlag : 0)));
+        out.PutFixed(static_cast<uint16_t>(mType),
+                     static_cast<uint16_t>(static_cast<uint16_t>(mClass) | (mAnswerViaUnicast ? kQClassUnicastAnswerFlag : 0)));
 
         if (out.Fit())
         {
@@ -80,6 +80,20 @@ public:
         return *this;
     }
 
+    /// Whether the packet has room left for the given query.
+    bool HasRoomFor(const Query & query)
+    {
+        if (!mQueryBuildOk)
+        {
+            return false;
+        }
+
+        // A writer without a buffer only counts the bytes.
+        chip::Encoding::BigEndian::BufferWriter out(nullptr, 0);
+        query.Append(mHeader, out);
+        return out.Needed() <= mPacket->AvailableDataLength();
+    }
+
     bool Ok() const { return mQueryBuildOk; }
 
 private:
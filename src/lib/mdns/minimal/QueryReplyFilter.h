@@ -86,6 +86,13 @@ private:
             return true;
         }
 
+        // Most questions are about other names, and are rejected by their hash
+        if ((qname.hash != QNameHash::kUnknown) && (mQueryData.GetNameHash() != QNameHash::kUnknown) &&
+            (qname.hash != mQueryData.GetNameHash()))
+        {
+            return false;
+        }
+
         return (mQueryData.GetName() == qname);
     }
 
@@ -84,6 +84,7 @@ inline FullQName Build(void * storage, Args &&... args)
     FullQName result;
     result.names     = names;
     result.nameCount = sizeof...(args);
+    result.hash      = QNameHash::Of(names, sizeof...(args));
     return result;
 }
 
@@ -28,6 +28,21 @@ bool SerializedQNameIterator::Next()
 }
 
 bool SerializedQNameIterator::Next(bool followIndirectPointers)
+{
+    const uint8_t * label;
+    uint8_t length;
+
+    if (!Skip(followIndirectPointers, &label, &length))
+    {
+        return false;
+    }
+
+    memcpy(mValue, label, length);
+    mValue[length] = '\0';
+    return true;
+}
+
+bool SerializedQNameIterator::Skip(bool followIndirectPointers, const uint8_t ** label, uint8_t * length)
 {
     if (!mIsValid)
     {
@@ -38,14 +53,14 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
     {
         assert(mValidData.Contains(mCurrentPosition));
 
-        const uint8_t length = *mCurrentPosition;
+        const uint8_t partLength = *mCurrentPosition;
         if (*mCurrentPosition == 0)
         {
             // Done with all items
             return false;
         }
 
-        if ((length & kPtrMask) == kPtrMask)
+        if ((partLength & kPtrMask) == kPtrMask)
         {
             if (!followIndirectPointers)
             {
@@ -61,9 +76,9 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
             }
 
             size_t offset = ((*mCurrentPosition & 0x3F) << 8) | *(mCurrentPosition + 1);
-            if (offset > mLookBehindMax)
+            if (offset >= mLookBehindMax)
             {
-                // Potential infinite recursion.
+                // Potential infinite recursion: pointers have to go strictly backwards.
                 mIsValid = false;
                 return false;
             }
@@ -80,23 +95,23 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
         else
         {
             // This branch handles non-pointer data. This will be string of size [length].
-            if (length > kMaxValueSize)
+            if (partLength > kMaxValueSize)
             {
                 // value is too large (larger than RFC limit)
                 mIsValid = false;
                 return false;
             }
 
-            if (!mValidData.Contains(mCurrentPosition + 1 + length))
+            if (!mValidData.Contains(mCurrentPosition + 1 + partLength))
             {
                 // string outside valid data
                 mIsValid = false;
                 return false;
             }
 
-            memcpy(mValue, mCurrentPosition + 1, length);
-            mValue[length]   = '\0';
-            mCurrentPosition = mCurrentPosition + length + 1;
+            *label           = mCurrentPosition + 1;
+            *length          = partLength;
+            mCurrentPosition = mCurrentPosition + partLength + 1;
             return true;
         }
     }
@@ -104,9 +119,12 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
 
 const uint8_t * SerializedQNameIterator::FindDataEnd()
 {
-    while (Next(false))
+    const uint8_t * label;
+    uint8_t length;
+
+    while (Skip(false, &label, &length))
     {
-        // nothing to do, just advance
+        // nothing to do, just advance: parts are not copied out
     }
 
     if (!IsValid())
@@ -139,17 +157,37 @@ bool SerializedQNameIterator::operator==(const FullQName & other) const
 {
     SerializedQNameIterator self = *this; // allow iteration
     size_t idx                   = 0;
+    const uint8_t * label;
+    uint8_t length;
 
-    while ((idx < other.nameCount) && self.Next())
+    // Parts are compared where they are in the packet, and most names differing from the expected
+    // one already differ by the length of some part.
+    while ((idx < other.nameCount) && self.Skip(true, &label, &length))
     {
-        if (strcasecmp(self.Value(), other.names[idx]) != 0)
+        if ((strlen(other.names[idx]) != length) || (strncasecmp(reinterpret_cast<const char *>(label), other.names[idx], length) != 0))
         {
             return false;
         }
         idx++;
     }
 
-    return ((idx == other.nameCount) && !self.Next());
+    // The end of the name has to be reached without an invalid part
+    return ((idx == other.nameCount) && !self.Skip(true, &label, &length) && self.IsValid());
+}
+
+uint32_t SerializedQNameIterator::Hash() const
+{
+    SerializedQNameIterator self = *this; // allow iteration
+    uint32_t hash                = QNameHash::Start();
+    const uint8_t * label;
+    uint8_t length;
+
+    while (self.Skip(true, &label, &length))
+    {
+        hash = QNameHash::AddPart(hash, reinterpret_cast<const char *>(label), length);
+    }
+
+    return self.IsValid() ? hash : QNameHash::kUnknown;
 }
 
 bool FullQName::operator==(const FullQName & other) const
@@ -158,6 +196,10 @@ bool FullQName::operator==(const FullQName & other) const
     {
         return false;
     }
+    if ((hash != QNameHash::kUnknown) && (other.hash != QNameHash::kUnknown) && (hash != other.hash))
+    {
+        return false;
+    }
     for (size_t i = 0; i < nameCount; i++)
     {
         if (strcasecmp(names[i], other.names[i]) != 0)
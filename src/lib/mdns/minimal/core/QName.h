@@ -36,6 +36,65 @@ namespace Minimal {
 /// A QName part is a null-terminated string
 using QNamePart = const char *;
 
+/// A case-insensitive hash of a QName, the same for a FullQName and a
+/// serialized QName of the same name.
+///
+/// Names with different hashes cannot be equal, so comparing hashes rejects
+/// most of the names that do not match without comparing their parts. Fixed
+/// names can be hashed at compile time.
+class QNameHash
+{
+public:
+    /// Stands for a hash that was not computed, so it is never compared
+    static constexpr uint32_t kUnknown = 0;
+
+    static constexpr uint32_t Of(const QNamePart * names, size_t nameCount)
+    {
+        uint32_t hash = kOffsetBasis;
+        for (size_t i = 0; i < nameCount; i++)
+        {
+            hash = AddPart(hash, names[i], PartLength(names[i]));
+        }
+        return hash;
+    }
+
+    template <size_t N>
+    static constexpr uint32_t Of(const QNamePart (&names)[N])
+    {
+        return Of(names, N);
+    }
+
+    /// Hash of the parts so far, to be passed to AddPart
+    static constexpr uint32_t Start() { return kOffsetBasis; }
+
+    static constexpr uint32_t AddPart(uint32_t hash, const char * part, size_t length)
+    {
+        // FNV-1a over the length of the part followed by its case folded bytes
+        hash = (hash ^ static_cast<uint8_t>(length)) * kPrime;
+        for (size_t i = 0; i < length; i++)
+        {
+            hash = (hash ^ Fold(static_cast<uint8_t>(part[i]))) * kPrime;
+        }
+        return hash;
+    }
+
+private:
+    static constexpr uint32_t kOffsetBasis = 2166136261u;
+    static constexpr uint32_t kPrime       = 16777619u;
+
+    static constexpr uint8_t Fold(uint8_t c) { return ((c >= 'A') && (c <= 'Z')) ? static_cast<uint8_t>(c + ('a' - 'A')) : c; }
+
+    static constexpr size_t PartLength(const char * part)
+    {
+        size_t length = 0;
+        while (part[length] != '\0')
+        {
+            length++;
+        }
+        return length;
+    }
+};
+
 /// A list of QNames that is simple to pass around
 ///
 /// As the struct may be copied, the lifetime of 'names' has to extend beyond
@@ -44,15 +103,26 @@ struct FullQName
 {
     const QNamePart * names;
     size_t nameCount;
+    uint32_t hash; // QNameHash of the name, or QNameHash::kUnknown
 
-    FullQName() : names(nullptr), nameCount(0) {}
+    constexpr FullQName() : names(nullptr), nameCount(0), hash(QNameHash::kUnknown) {}
     FullQName(const FullQName &) = default;
     FullQName & operator=(const FullQName &) = default;
 
     template <size_t N>
-    FullQName(const QNamePart (&data)[N]) : names(data), nameCount(N)
+    constexpr FullQName(const QNamePart (&data)[N], uint32_t nameHash = QNameHash::kUnknown) :
+        names(data), nameCount(N), hash(nameHash)
     {}
 
+    constexpr FullQName(const QNamePart * data, size_t count, uint32_t nameHash) : names(data), nameCount(count), hash(nameHash) {}
+
+    /// Returns a copy of this name with its hash computed, for names that are
+    /// compared against many others.
+    FullQName WithHash() const
+    {
+        return (hash != QNameHash::kUnknown) ? *this : FullQName(names, nameCount, QNameHash::Of(names, nameCount));
+    }
+
     void Output(chip::Encoding::BigEndian::BufferWriter & out) const
     {
         for (uint16_t i = 0; i < nameCount; i++)
@@ -108,6 +178,10 @@ public:
     bool operator==(const FullQName & other) const;
     bool operator!=(const FullQName & other) const { return !(*this == other); }
 
+    /// Returns the QNameHash of the name, or QNameHash::kUnknown if the name
+    /// is not valid. Does not change the iterator state.
+    uint32_t Hash() const;
+
     void Put(chip::Encoding::BigEndian::BufferWriter & out) const
     {
         SerializedQNameIterator copy = *this;
@@ -133,6 +207,10 @@ private:
 
     // Advances to the next element in the sequence
     bool Next(bool followIndirectPointers);
+
+    // Advances to the next element in the sequence without copying it:
+    // [label] is set to its [length] bytes within the valid data.
+    bool Skip(bool followIndirectPointers, const uint8_t ** label, uint8_t * length);
 };
 
 } // namespace Minimal
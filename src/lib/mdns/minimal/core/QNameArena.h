@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "FlatAllocatedQName.h"
+
+namespace mdns {
+namespace Minimal {
+
+/// Fixed storage for QNames built by FlatAllocatedQName. Names are not freed
+/// one by one: Clear() releases all of them and the storage is reused.
+///
+/// Names are remembered in the order they were allocated, so that two arenas
+/// filled the same way can be compared to find out whether any name changed.
+///
+/// Usage:
+///   QNameArena<256, 4> arena;
+///   FullQName name = arena.Allocate("myhostname", "local"); // nameCount == 0 if out of space
+template <size_t kStorageSize, size_t kMaxNames>
+class QNameArena
+{
+public:
+    static_assert(kStorageSize % alignof(QNamePart) == 0, "Storage size must keep names aligned to hold pointers");
+
+    QNameArena() = default;
+    QNameArena(const QNameArena &) = delete;
+    QNameArena & operator=(const QNameArena &) = delete;
+
+    /// Builds the given qname parts into the arena.
+    ///
+    /// Returns an empty FullQName if the arena is out of storage or names.
+    template <typename... Args>
+    FullQName Allocate(Args &&... names)
+    {
+        const size_t required = FlatAllocatedQName::RequiredStorageSize(std::forward<Args>(names)...);
+
+        if ((mNameCount >= kMaxNames) || (required > kStorageSize - mUsed))
+        {
+            return FullQName();
+        }
+
+        FullQName name = FlatAllocatedQName::Build(mStorage + mUsed, std::forward<Args>(names)...);
+
+        // the next name starts pointer-aligned, which never goes past the end as
+        // the storage size is itself aligned
+        mUsed += (required + alignof(QNamePart) - 1) / alignof(QNamePart) * alignof(QNamePart);
+        mNames[mNameCount++] = name;
+        return name;
+    }
+
+    /// Releases all names. Any FullQName previously returned becomes invalid.
+    void Clear()
+    {
+        mUsed      = 0;
+        mNameCount = 0;
+    }
+
+    size_t GetNameCount() const { return mNameCount; }
+    size_t GetUsedSize() const { return mUsed; }
+
+    /// Returns true if both arenas hold the same names in the same order.
+    ///
+    /// Names are compared byte for byte rather than case insensitively, as a
+    /// change in case is still a change of what is advertised.
+    bool HasSameNamesAs(const QNameArena & other) const
+    {
+        if (mNameCount != other.mNameCount)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < mNameCount; i++)
+        {
+            if (!IsSameName(mNames[i], other.mNames[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static bool IsSameName(const FullQName & a, const FullQName & b)
+    {
+        if ((a.nameCount != b.nameCount) || (a.hash != b.hash))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < a.nameCount; i++)
+        {
+            if (strcmp(a.names[i], b.names[i]) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    alignas(QNamePart) uint8_t mStorage[kStorageSize];
+    size_t mUsed      = 0;
+    size_t mNameCount = 0;
+    FullQName mNames[kMaxNames];
+};
+
+} // namespace Minimal
+} // namespace mdns
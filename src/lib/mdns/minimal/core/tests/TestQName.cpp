@@ -198,6 +198,56 @@ void CaseInsensitiveSerializedCompare(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void CompressedComparison(nlTestSuite * inSuite, void * inContext)
+{
+    // "test.local" followed by "this.is.a" pointing at it
+    static const uint8_t kData[]      = "\04tEst\05local\00\04this\02is\01a\xc0\x00";
+    static const uint8_t * kNameStart = kData + 12;
+    const BytesRange kRange(kData, kData + sizeof(kData));
+
+    {
+        const QNamePart kTestName[] = { "this", "is", "a", "test", "local" };
+        NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kNameStart) == FullQName(kTestName));
+    }
+
+    {
+        const QNamePart kTestName[] = { "this", "is", "a", "tests", "local" };
+        NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kNameStart) != FullQName(kTestName));
+    }
+
+    {
+        const QNamePart kTestName[] = { "this", "is", "a", "tes", "local" };
+        NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kNameStart) != FullQName(kTestName));
+    }
+
+    {
+        const QNamePart kTestName[] = { "this", "is", "a", "nest", "local" };
+        NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kNameStart) != FullQName(kTestName));
+    }
+
+    {
+        SerializedQNameIterator it(kRange, kNameStart);
+        NL_TEST_ASSERT(inSuite, it.FindDataEnd() == kData + sizeof(kData) - 1);
+    }
+}
+
+void CompressionLoopComparison(nlTestSuite * inSuite, void * inContext)
+{
+    // "a" followed by a pointer to itself
+    static const uint8_t kData[] = "\01a\xc0\x00";
+    const BytesRange kRange(kData, kData + sizeof(kData));
+
+    {
+        const QNamePart kTestName[] = { "a" };
+        NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kData) != FullQName(kTestName));
+    }
+
+    {
+        const QNamePart kTestName[] = { "a", "a", "a" };
+        NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kData) != FullQName(kTestName));
+    }
+}
+
 void CaseInsensitiveFullQNameCompare(nlTestSuite * inSuite, void * inContext)
 {
     {
@@ -237,6 +287,41 @@ void CaseInsensitiveFullQNameCompare(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void HashComparison(nlTestSuite * inSuite, void * inContext)
+{
+    // "test.local" followed by "this.is.a" pointing at it
+    static const uint8_t kData[]      = "\04tEst\05local\00\04this\02is\01a\xc0\x00";
+    static const uint8_t * kNameStart = kData + 12;
+    const BytesRange kRange(kData, kData + sizeof(kData));
+
+    static constexpr QNamePart kTestName[]  = { "THIS", "is", "A", "test", "local" };
+    static constexpr uint32_t kTestNameHash = QNameHash::Of(kTestName);
+    static_assert(kTestNameHash != QNameHash::kUnknown, "The hash of a fixed name is computed at compile time");
+
+    NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kNameStart).Hash() == kTestNameHash);
+    NL_TEST_ASSERT(inSuite, FullQName(kTestName).WithHash().hash == kTestNameHash);
+    NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kRange, kNameStart) == FullQName(kTestName, kTestNameHash));
+
+    {
+        // Same parts split differently
+        const QNamePart kOtherName[] = { "thisis", "a", "test", "local" };
+        NL_TEST_ASSERT(inSuite, FullQName(kOtherName).WithHash().hash != kTestNameHash);
+    }
+
+    {
+        const QNamePart kOtherName[] = { "this", "is", "a", "nest", "local" };
+        NL_TEST_ASSERT(inSuite, FullQName(kOtherName).WithHash().hash != kTestNameHash);
+        NL_TEST_ASSERT(inSuite, FullQName(kOtherName).WithHash() != FullQName(kTestName).WithHash());
+    }
+
+    {
+        // Invalid names have no hash
+        static const uint8_t kLoop[] = "\01a\xc0\x00";
+        const BytesRange kLoopRange(kLoop, kLoop + sizeof(kLoop));
+        NL_TEST_ASSERT(inSuite, SerializedQNameIterator(kLoopRange, kLoop).Hash() == QNameHash::kUnknown);
+    }
+}
+
 } // namespace
 
 // clang-format off
@@ -247,6 +332,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Comparison", Comparison),
     NL_TEST_DEF("CaseInsensitiveSerializedCompare", CaseInsensitiveSerializedCompare),
     NL_TEST_DEF("CaseInsensitiveFullQNameCompare", CaseInsensitiveFullQNameCompare),
+    NL_TEST_DEF("CompressedComparison", CompressedComparison),
+    NL_TEST_DEF("CompressionLoopComparison", CompressionLoopComparison),
+    NL_TEST_DEF("HashComparison", HashComparison),
 
     NL_TEST_SENTINEL()
 };
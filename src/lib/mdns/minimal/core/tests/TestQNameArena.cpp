@@ -0,0 +1,103 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <mdns/minimal/core/FlatAllocatedQName.h>
+#include <mdns/minimal/core/QNameArena.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace mdns::Minimal;
+
+void TestAllocate(nlTestSuite * inSuite, void * inContext)
+{
+    QNameArena<64, 2> arena;
+
+    FullQName first                 = arena.Allocate("some", "test");
+    const QNamePart expectedFirst[] = { "some", "test" };
+
+    NL_TEST_ASSERT(inSuite, FullQName(expectedFirst) == first);
+    NL_TEST_ASSERT(inSuite, arena.GetNameCount() == 1);
+    NL_TEST_ASSERT(inSuite, arena.GetUsedSize() % alignof(QNamePart) == 0);
+
+    FullQName second                 = arena.Allocate("a");
+    const QNamePart expectedSecond[] = { "a" };
+
+    // names do not overwrite each other
+    NL_TEST_ASSERT(inSuite, FullQName(expectedSecond) == second);
+    NL_TEST_ASSERT(inSuite, FullQName(expectedFirst) == first);
+
+    // out of names
+    NL_TEST_ASSERT(inSuite, arena.GetNameCount() == 2);
+    NL_TEST_ASSERT(inSuite, arena.Allocate("x").nameCount == 0);
+
+    // storage is reused after clearing
+    arena.Clear();
+    NL_TEST_ASSERT(inSuite, arena.GetNameCount() == 0);
+    NL_TEST_ASSERT(inSuite, arena.GetUsedSize() == 0);
+    NL_TEST_ASSERT(inSuite, arena.Allocate("x").nameCount == 1);
+
+    // out of storage
+    arena.Clear();
+    NL_TEST_ASSERT(inSuite, arena.Allocate("a-name-that-does-not-fit-in-the-storage-of-the-arena", "local").nameCount == 0);
+    NL_TEST_ASSERT(inSuite, arena.GetUsedSize() == 0);
+}
+
+void TestSameNames(nlTestSuite * inSuite, void * inContext)
+{
+    QNameArena<128, 4> current;
+    QNameArena<128, 4> staged;
+
+    current.Allocate("_chip", "_tcp", "local");
+    current.Allocate("host", "local");
+
+    staged.Allocate("_chip", "_tcp", "local");
+    NL_TEST_ASSERT(inSuite, !staged.HasSameNamesAs(current));
+    staged.Allocate("host", "local");
+    NL_TEST_ASSERT(inSuite, staged.HasSameNamesAs(current));
+    NL_TEST_ASSERT(inSuite, current.HasSameNamesAs(staged));
+
+    // a change in case is a change
+    staged.Clear();
+    staged.Allocate("_chip", "_tcp", "local");
+    staged.Allocate("HOST", "local");
+    NL_TEST_ASSERT(inSuite, !staged.HasSameNamesAs(current));
+
+    // as is a change in order
+    staged.Clear();
+    staged.Allocate("host", "local");
+    staged.Allocate("_chip", "_tcp", "local");
+    NL_TEST_ASSERT(inSuite, !staged.HasSameNamesAs(current));
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestAllocate", TestAllocate),   //
+    NL_TEST_DEF("TestSameNames", TestSameNames), //
+    NL_TEST_SENTINEL()                           //
+};
+
+} // namespace
+
+int TestQNameArena(void)
+{
+    nlTestSuite theSuite = { "QNameArena", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestQNameArena)
@@ -20,7 +20,7 @@
 namespace mdns {
 namespace Minimal {
 
-bool ResourceRecord::Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const
+bool ResourceRecord::CanAppend(const HeaderRef & hdr, ResourceType asType)
 {
     // order is important based on resource type. First come answers, then authorityAnswers
     // and then additional:
@@ -32,39 +32,51 @@ bool ResourceRecord::Append(HeaderRef & hdr, ResourceType asType, chip::Encoding
     {
         return false;
     }
+    return true;
+}
 
-    mQName.Output(out);
+void ResourceRecord::CountAppended(HeaderRef & hdr, ResourceType asType)
+{
+    switch (asType)
+    {
+    case ResourceType::kAdditional:
+        hdr.SetAdditionalCount(hdr.GetAdditionalCount() + 1);
+        break;
+    case ResourceType::kAuthority:
+        hdr.SetAuthorityCount(hdr.GetAuthorityCount() + 1);
+        break;
+    case ResourceType::kAnswer:
+        hdr.SetAnswerCount(hdr.GetAnswerCount() + 1);
+        break;
+    }
+}
 
-    out                                           //
-        .Put16(static_cast<uint16_t>(GetType()))  //
-        .Put16(static_cast<uint16_t>(GetClass())) //
-        .Put32(static_cast<uint32_t>(GetTtl()))   //
-        ;
+bool ResourceRecord::Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const
+{
+    if (!CanAppend(hdr, asType))
+    {
+        return false;
+    }
+
+    mQName.Output(out);
 
     chip::Encoding::BigEndian::BufferWriter sizeOutput(out); // copy to re-output size
-    out.Put16(0);                                            // dummy, will be replaced later
+
+    // The data size is a dummy, replaced once the data is written
+    out.PutFixed(static_cast<uint16_t>(GetType()), static_cast<uint16_t>(GetClass()), static_cast<uint32_t>(GetTtl()),
+                 static_cast<uint16_t>(0));
 
     if (!WriteData(out))
     {
         return false;
     }
+    sizeOutput.Skip(sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t));
     sizeOutput.Put16(static_cast<uint16_t>(out.Needed() - sizeOutput.Needed() - 2));
 
     // This MUST be final and separated out: record count is only updated on success.
     if (out.Fit())
     {
-        switch (asType)
-        {
-        case ResourceType::kAdditional:
-            hdr.SetAdditionalCount(hdr.GetAdditionalCount() + 1);
-            break;
-        case ResourceType::kAuthority:
-            hdr.SetAuthorityCount(hdr.GetAuthorityCount() + 1);
-            break;
-        case ResourceType::kAnswer:
-            hdr.SetAnswerCount(hdr.GetAnswerCount() + 1);
-            break;
-        }
+        CountAppended(hdr, asType);
     }
 
     return out.Fit();
@@ -50,12 +50,18 @@ public:
 
     /// Append the given record to the underlying output.
     /// Updates header item count on success, does NOT update header on failure.
-    bool Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const;
+    virtual bool Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const;
 
 protected:
     /// Output the data portion of the resource record.
     virtual bool WriteData(chip::Encoding::BigEndian::BufferWriter & out) const = 0;
 
+    /// Whether a record of the given type can follow the records already counted in the header.
+    static bool CanAppend(const HeaderRef & hdr, ResourceType asType);
+
+    /// Counts an appended record in the header.
+    static void CountAppended(HeaderRef & hdr, ResourceType asType);
+
     ResourceRecord(QType type, FullQName name) : mType(type), mQName(name) {}
 
 private:
@@ -0,0 +1,111 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "SerializedRecordCache.h"
+
+#include <support/CHIPMem.h>
+
+namespace mdns {
+namespace Minimal {
+
+const ResourceRecord & SerializedRecordCache::Get(const ResourceRecord & record)
+{
+    if (IsCached())
+    {
+        return *this;
+    }
+
+    uint8_t headerBuffer[HeaderRef::kSizeBytes];
+    HeaderRef hdr(headerBuffer);
+    hdr.Clear();
+
+    // Writers without a buffer only count the bytes.
+    chip::Encoding::BigEndian::BufferWriter recordSize(nullptr, 0);
+    chip::Encoding::BigEndian::BufferWriter nameSize(nullptr, 0);
+
+    record.Append(hdr, ResourceType::kAnswer, recordSize);
+    record.GetName().Output(nameSize);
+
+    // Name, then type, class, TTL and data length ahead of the data.
+    const size_t dataOffset = nameSize.Needed() + 10;
+    if (recordSize.Needed() > UINT16_MAX || recordSize.Needed() < dataOffset)
+    {
+        return record;
+    }
+
+    uint8_t * bytes = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(recordSize.Needed()));
+    if (bytes == nullptr)
+    {
+        return record;
+    }
+
+    chip::Encoding::BigEndian::BufferWriter out(bytes, recordSize.Needed());
+    if (!record.Append(hdr, ResourceType::kAnswer, out))
+    {
+        chip::Platform::MemoryFree(bytes);
+        return record;
+    }
+
+    ResourceRecord::operator=(record);
+    mBytes      = bytes;
+    mLength     = static_cast<uint16_t>(recordSize.Needed());
+    mDataOffset = static_cast<uint16_t>(dataOffset);
+
+    return *this;
+}
+
+void SerializedRecordCache::Clear()
+{
+    if (mBytes != nullptr)
+    {
+        chip::Platform::MemoryFree(mBytes);
+        mBytes = nullptr;
+    }
+    mLength     = 0;
+    mDataOffset = 0;
+}
+
+bool SerializedRecordCache::Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const
+{
+    if (!IsCached())
+    {
+        return false;
+    }
+    if (!CanAppend(hdr, asType))
+    {
+        return false;
+    }
+
+    out.Put(mBytes, mLength);
+
+    // This MUST be final and separated out: record count is only updated on success.
+    if (out.Fit())
+    {
+        CountAppended(hdr, asType);
+    }
+
+    return out.Fit();
+}
+
+bool SerializedRecordCache::WriteData(chip::Encoding::BigEndian::BufferWriter & out) const
+{
+    out.Put(mBytes + mDataOffset, static_cast<size_t>(mLength - mDataOffset));
+    return out.Fit();
+}
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,61 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <mdns/minimal/records/ResourceRecord.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Keeps a resource record in its serialized form, which is then appended to packets as a copy.
+///
+/// Meant for responders whose records stay the same for as long as they exist: these are
+/// serialized once, instead of for every query answered.
+class SerializedRecordCache : public ResourceRecord
+{
+public:
+    SerializedRecordCache() : ResourceRecord(QType::ANY, FullQName()) {}
+    ~SerializedRecordCache() override { Clear(); }
+
+    SerializedRecordCache(const SerializedRecordCache &) = delete;
+    SerializedRecordCache & operator=(const SerializedRecordCache &) = delete;
+
+    /// Returns the cached copy of a record, serializing it on first use. Returns the record itself
+    /// if there is no memory for the copy.
+    ///
+    /// The cached copy is returned until Clear() is called, whatever record is given.
+    const ResourceRecord & Get(const ResourceRecord & record);
+
+    /// Drops the cached copy.
+    void Clear();
+
+    bool IsCached() const { return mBytes != nullptr; }
+
+    bool Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const override;
+
+protected:
+    bool WriteData(chip::Encoding::BigEndian::BufferWriter & out) const override;
+
+private:
+    uint8_t * mBytes     = nullptr; /* The whole record, from its name to the end of its data. */
+    uint16_t mLength     = 0;
+    uint16_t mDataOffset = 0;
+};
+
+} // namespace Minimal
+} // namespace mdns
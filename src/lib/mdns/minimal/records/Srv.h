@@ -41,9 +41,7 @@ public:
 protected:
     bool WriteData(chip::Encoding::BigEndian::BufferWriter & out) const override
     {
-        out.Put16(mPriority);
-        out.Put16(mWeight);
-        out.Put16(mPort);
+        out.PutFixed(mPriority, mWeight, mPort);
         mServerName.Output(out);
 
         return out.Fit();
@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <string.h>
+
+#include <mdns/minimal/records/SerializedRecordCache.h>
+#include <mdns/minimal/records/Srv.h>
+
+#include <support/CHIPMem.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Encoding;
+using namespace mdns::Minimal;
+
+const QNamePart kName[]       = { "some", "test", "local" };
+const QNamePart kServerName[] = { "my", "server", "name" };
+
+void TestSameOutput(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t headerBuffer[HeaderRef::kSizeBytes];
+    uint8_t expected[128];
+    uint8_t actual[128];
+
+    SrvResourceRecord record(kName, kServerName, 0x1234);
+    record.SetTtl(128);
+
+    HeaderRef header(headerBuffer);
+    header.Clear();
+
+    BigEndian::BufferWriter expectedOutput(expected, sizeof(expected));
+    NL_TEST_ASSERT(inSuite, record.Append(header, ResourceType::kAnswer, expectedOutput));
+
+    SerializedRecordCache cache;
+    const ResourceRecord & cached = cache.Get(record);
+
+    NL_TEST_ASSERT(inSuite, cache.IsCached());
+    NL_TEST_ASSERT(inSuite, &cached == &cache);
+    NL_TEST_ASSERT(inSuite, cached.GetType() == QType::SRV);
+    NL_TEST_ASSERT(inSuite, cached.GetName() == kName);
+    NL_TEST_ASSERT(inSuite, cached.GetTtl() == 128);
+
+    header.Clear();
+
+    BigEndian::BufferWriter actualOutput(actual, sizeof(actual));
+    NL_TEST_ASSERT(inSuite, cached.Append(header, ResourceType::kAdditional, actualOutput));
+    NL_TEST_ASSERT(inSuite, header.GetAnswerCount() == 0);
+    NL_TEST_ASSERT(inSuite, header.GetAdditionalCount() == 1);
+    NL_TEST_ASSERT(inSuite, actualOutput.Needed() == expectedOutput.Needed());
+    NL_TEST_ASSERT(inSuite, memcmp(actual, expected, expectedOutput.Needed()) == 0);
+
+    // Answers cannot follow additional records.
+    NL_TEST_ASSERT(inSuite, !cached.Append(header, ResourceType::kAnswer, actualOutput));
+    NL_TEST_ASSERT(inSuite, header.GetAnswerCount() == 0);
+
+    // Until cleared, the cached copy is kept.
+    SrvResourceRecord other(kServerName, kName, 0x4321);
+    NL_TEST_ASSERT(inSuite, &cache.Get(other) == &cache);
+    NL_TEST_ASSERT(inSuite, cache.GetName() == kName);
+
+    cache.Clear();
+    NL_TEST_ASSERT(inSuite, !cache.IsCached());
+    NL_TEST_ASSERT(inSuite, cache.Get(other).GetName() == kServerName);
+}
+
+void TestDoesNotFit(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t headerBuffer[HeaderRef::kSizeBytes];
+    uint8_t buffer[16];
+
+    SrvResourceRecord record(kName, kServerName, 0x1234);
+    SerializedRecordCache cache;
+
+    HeaderRef header(headerBuffer);
+    header.Clear();
+
+    // Header counts only change on success.
+    BigEndian::BufferWriter output(buffer, sizeof(buffer));
+    NL_TEST_ASSERT(inSuite, !cache.Get(record).Append(header, ResourceType::kAnswer, output));
+    NL_TEST_ASSERT(inSuite, header.GetAnswerCount() == 0);
+}
+
+int Setup(void * inContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestSameOutput", TestSameOutput), //
+    NL_TEST_DEF("TestDoesNotFit", TestDoesNotFit), //
+    NL_TEST_SENTINEL()                             //
+};
+
+} // namespace
+
+int TestSerializedRecordCache(void)
+{
+    nlTestSuite theSuite = { "SerializedRecordCache", sTests, Setup, Teardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSerializedRecordCache)
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <mdns/minimal/records/Ptr.h>
+#include <mdns/minimal/records/SerializedRecordCache.h>
 #include <mdns/minimal/responders/Responder.h>
 
 namespace mdns {
@@ -30,11 +31,12 @@ public:
 
     void AddAllResponses(const chip::Inet::IPPacketInfo * source, ResponderDelegate * delegate) override
     {
-        delegate->AddResponse(PtrResourceRecord(GetQName(), mTarget));
+        delegate->AddResponse(mSerializedRecord.Get(PtrResourceRecord(GetQName(), mTarget)));
     }
 
 private:
     const FullQName mTarget;
+    SerializedRecordCache mSerializedRecord;
 };
 
 } // namespace Minimal
@@ -24,10 +24,11 @@
 namespace mdns {
 namespace Minimal {
 
-const QNamePart kDnsSdQueryPath[] = { "_services", "_dns-sd", "_udp", "local" };
+constexpr QNamePart kDnsSdQueryPath[]  = { "_services", "_dns-sd", "_udp", "local" };
+constexpr uint32_t kDnsSdQueryPathHash = QNameHash::Of(kDnsSdQueryPath);
 
 QueryResponderBase::QueryResponderBase(Internal::QueryResponderInfo * infos, size_t infoSizes) :
-    Responder(QType::PTR, FullQName(kDnsSdQueryPath)), mResponderInfos(infos), mResponderInfoSize(infoSizes)
+    Responder(QType::PTR, FullQName(kDnsSdQueryPath, kDnsSdQueryPathHash)), mResponderInfos(infos), mResponderInfoSize(infoSizes)
 {}
 
 void QueryResponderBase::Init()
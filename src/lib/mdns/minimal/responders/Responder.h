@@ -38,7 +38,7 @@ public:
 class Responder
 {
 public:
-    Responder(QType qType, const FullQName & qName) : mQType(qType), mQName(qName) {}
+    Responder(QType qType, const FullQName & qName) : mQType(qType), mQName(qName.WithHash()) {}
     virtual ~Responder() {}
 
     QClass GetQClass() const { return QClass::IN; }
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <mdns/minimal/records/SerializedRecordCache.h>
 #include <mdns/minimal/records/Txt.h>
 #include <mdns/minimal/responders/Responder.h>
 
@@ -30,11 +31,12 @@ public:
 
     void AddAllResponses(const chip::Inet::IPPacketInfo * source, ResponderDelegate * delegate) override
     {
-        delegate->AddResponse(mRecord);
+        delegate->AddResponse(mSerializedRecord.Get(mRecord));
     }
 
 private:
     const TxtResourceRecord mRecord;
+    SerializedRecordCache mSerializedRecord;
 };
 
 } // namespace Minimal
@@ -20,6 +20,7 @@
 
 #include <mdns/minimal/Parser.h>
 #include <mdns/minimal/RecordData.h>
+#include <support/CHIPMem.h>
 #include <support/UnitTestRegistration.h>
 
 #include <nlunit-test.h>
@@ -102,6 +103,21 @@ void TestPtrResponse(nlTestSuite * inSuite, void * inContext)
     packetInfo.Interface   = INET_NULL_INTERFACEID;
 
     responder.AddAllResponses(&packetInfo, &acc);
+
+    // Later responses are appended from the serialized copy of the record.
+    responder.AddAllResponses(&packetInfo, &acc);
+}
+
+// The responder keeps its record serialized in allocated memory.
+int Setup(void * inContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
 }
 
 const nlTest sTests[] = {
@@ -113,7 +129,7 @@ const nlTest sTests[] = {
 
 int TestPtr(void)
 {
-    nlTestSuite theSuite = { "IP", sTests, nullptr, nullptr };
+    nlTestSuite theSuite = { "IP", sTests, Setup, Teardown };
     nlTestRunner(&theSuite, nullptr);
     return nlTestRunnerStats(&theSuite);
 }
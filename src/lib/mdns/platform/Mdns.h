@@ -156,6 +156,29 @@ CHIP_ERROR ChipMdnsStopPublish();
  */
 CHIP_ERROR ChipMdnsStopPublishService(const MdnsService * service);
 
+/**
+ * This function marks all services published via mDNS to be removed, but
+ * keeps them published until @ref ChipMdnsFinalizeServiceUpdate is called.
+ * The services published again in between are kept, or updated if they
+ * changed, rather than removed and added back.
+ *
+ * @retval CHIP_NO_ERROR                The services are marked to be removed.
+ * @retval Error code                   Marking the services fails.
+ *
+ */
+CHIP_ERROR ChipMdnsRemoveServices();
+
+/**
+ * This function removes the services marked by @ref ChipMdnsRemoveServices
+ * that were not published again since, and applies the changes to the
+ * services published again, as one update where the platform allows.
+ *
+ * @retval CHIP_NO_ERROR                The update succeeds.
+ * @retval Error code                   The update fails.
+ *
+ */
+CHIP_ERROR ChipMdnsFinalizeServiceUpdate();
+
 /**
  * This function browses the services published by mdns
  *
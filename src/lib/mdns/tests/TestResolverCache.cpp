@@ -0,0 +1,257 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <mdns/ResolverCache.h>
+
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::Mdns;
+
+namespace {
+
+constexpr uint32_t kTimeoutMs = 5000;
+
+ResolvedNodeData MakeNodeData(NodeId nodeId, uint16_t port)
+{
+    ResolvedNodeData data;
+
+    data.mPeerId      = PeerId().SetFabricId(1).SetNodeId(nodeId);
+    data.mInterfaceId = INET_NULL_INTERFACEID;
+    data.mPort        = port;
+    Inet::IPAddress::FromString("fe80::1", data.mAddress);
+    return data;
+}
+
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+struct netif gInterfaces[2];
+
+Inet::InterfaceId TestInterface(size_t index)
+{
+    return &gInterfaces[index];
+}
+#else
+Inet::InterfaceId TestInterface(size_t index)
+{
+    return static_cast<Inet::InterfaceId>(index + 1);
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+
+void TestCachesRequestedNodes(nlTestSuite * inSuite, void * inContext)
+{
+    ResolverCache<2> cache;
+    const ResolvedNodeData node = MakeNodeData(1, 5540);
+
+    // Responses about nodes nobody asked for are not cached.
+    NL_TEST_ASSERT(inSuite, !cache.Update(node, 120, 0));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(node.mPeerId, Inet::kIPAddressType_Any, 0) == nullptr);
+
+    cache.MarkPending(node.mPeerId, 0, kTimeoutMs);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(node.mPeerId, Inet::kIPAddressType_Any, 0) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Update(node, 120, 100));
+
+    const ResolvedNodeData * cached = cache.Lookup(node.mPeerId, Inet::kIPAddressType_Any, 200);
+    NL_TEST_ASSERT(inSuite, cached != nullptr);
+    NL_TEST_ASSERT(inSuite, cached != nullptr && cached->mPort == 5540);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(node.mPeerId, Inet::kIPAddressType_IPv6, 200) != nullptr);
+#if INET_CONFIG_ENABLE_IPV4
+    NL_TEST_ASSERT(inSuite, cache.Lookup(node.mPeerId, Inet::kIPAddressType_IPv4, 200) == nullptr);
+#endif
+
+    // Gone once the TTL elapsed.
+    NL_TEST_ASSERT(inSuite, cache.Lookup(node.mPeerId, Inet::kIPAddressType_Any, 100 + 120 * 1000) == nullptr);
+
+    // A pending resolution is forgotten after its timeout.
+    cache.MarkPending(node.mPeerId, 200000, kTimeoutMs);
+    NL_TEST_ASSERT(inSuite, !cache.Update(node, 120, 200000 + kTimeoutMs));
+}
+
+void TestPassiveUpdates(nlTestSuite * inSuite, void * inContext)
+{
+    ResolverCache<2> cache;
+    ResolvedNodeData node = MakeNodeData(1, 5540);
+
+    cache.MarkPending(node.mPeerId, 0, kTimeoutMs);
+    NL_TEST_ASSERT(inSuite, cache.Update(node, 120, 0));
+
+    // An announcement moves the node and extends its TTL.
+    node.mPort = 5541;
+    NL_TEST_ASSERT(inSuite, cache.Update(node, 120, 100000));
+
+    const ResolvedNodeData * cached = cache.Lookup(node.mPeerId, Inet::kIPAddressType_Any, 200000);
+    NL_TEST_ASSERT(inSuite, cached != nullptr && cached->mPort == 5541);
+
+    // A goodbye removes it.
+    NL_TEST_ASSERT(inSuite, cache.Update(node, 0, 200000));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(node.mPeerId, Inet::kIPAddressType_Any, 200000) == nullptr);
+}
+
+void TestEvictsLeastRecentlyUsed(nlTestSuite * inSuite, void * inContext)
+{
+    ResolverCache<2> cache;
+    const ResolvedNodeData nodes[] = { MakeNodeData(1, 1), MakeNodeData(2, 2), MakeNodeData(3, 3) };
+
+    for (uint64_t i = 0; i < 2; i++)
+    {
+        cache.MarkPending(nodes[i].mPeerId, i, kTimeoutMs);
+        NL_TEST_ASSERT(inSuite, cache.Update(nodes[i], 120, i));
+    }
+
+    // Node 1 is used more recently than node 2, which makes room for node 3.
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[0].mPeerId, Inet::kIPAddressType_Any, 10) != nullptr);
+    cache.MarkPending(nodes[2].mPeerId, 20, kTimeoutMs);
+    NL_TEST_ASSERT(inSuite, cache.Update(nodes[2], 120, 20));
+
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[0].mPeerId, Inet::kIPAddressType_Any, 30) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[1].mPeerId, Inet::kIPAddressType_Any, 30) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[2].mPeerId, Inet::kIPAddressType_Any, 30) != nullptr);
+}
+
+void TestRefreshesNodesInUse(nlTestSuite * inSuite, void * inContext)
+{
+    ResolverCache<2> cache;
+    const ResolvedNodeData nodes[] = { MakeNodeData(1, 1), MakeNodeData(2, 2) };
+    size_t refreshed               = 0;
+    auto countRefresh              = [&refreshed](const PeerId & peerId) { refreshed++; };
+
+    for (const ResolvedNodeData & node : nodes)
+    {
+        cache.MarkPending(node.mPeerId, 0, kTimeoutMs);
+        NL_TEST_ASSERT(inSuite, cache.Update(node, 100, 0));
+    }
+
+    // Nothing was looked up, so nothing is refreshed.
+    NL_TEST_ASSERT(inSuite, cache.GetNextRefreshMs() == decltype(cache)::kNoRefreshMs);
+
+    // Only node 1 is in use: it is refreshed at 80% of its TTL, once.
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[0].mPeerId, Inet::kIPAddressType_Any, 1000) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.GetNextRefreshMs() == 80000);
+
+    cache.RefreshDue(79999, countRefresh);
+    NL_TEST_ASSERT(inSuite, refreshed == 0);
+    cache.RefreshDue(80000, countRefresh);
+    NL_TEST_ASSERT(inSuite, refreshed == 1);
+    cache.RefreshDue(90000, countRefresh);
+    NL_TEST_ASSERT(inSuite, refreshed == 1);
+    NL_TEST_ASSERT(inSuite, cache.GetNextRefreshMs() == decltype(cache)::kNoRefreshMs);
+
+    // The answer to the refresh query renews the entry past its first expiry.
+    NL_TEST_ASSERT(inSuite, cache.Update(nodes[0], 100, 80100));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[0].mPeerId, Inet::kIPAddressType_Any, 150000) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[1].mPeerId, Inet::kIPAddressType_Any, 150000) == nullptr);
+}
+
+void TestQueuedQueries(nlTestSuite * inSuite, void * inContext)
+{
+    ResolverCache<3> cache;
+    const ResolvedNodeData nodes[] = { MakeNodeData(1, 1), MakeNodeData(2, 2), MakeNodeData(3, 3), MakeNodeData(4, 4) };
+    size_t taken                   = 0;
+
+    cache.MarkPending(nodes[0].mPeerId, 0, kTimeoutMs);
+    NL_TEST_ASSERT(inSuite, cache.Update(nodes[0], 120, 0));
+    NL_TEST_ASSERT(inSuite, !cache.HasQueuedQueries());
+
+    // Queued queries may evict resolved nodes, but not the nodes being resolved.
+    NL_TEST_ASSERT(inSuite, cache.QueueQuery(nodes[1].mPeerId, 10));
+    NL_TEST_ASSERT(inSuite, cache.QueueQuery(nodes[2].mPeerId, 10));
+    NL_TEST_ASSERT(inSuite, cache.QueueQuery(nodes[3].mPeerId, 10));
+    NL_TEST_ASSERT(inSuite, cache.Lookup(nodes[0].mPeerId, Inet::kIPAddressType_Any, 10) == nullptr);
+    NL_TEST_ASSERT(inSuite, !cache.QueueQuery(nodes[0].mPeerId, 10));
+    NL_TEST_ASSERT(inSuite, cache.HasQueuedQueries());
+
+    // Queries left in the queue wait for the next packet.
+    PeerId takenPeers[3];
+    Inet::InterfaceId interfaceId;
+    cache.TakeQueuedQueries(20, kTimeoutMs, &interfaceId, [&taken, &takenPeers](const PeerId & peerId) {
+        takenPeers[taken] = peerId;
+        return ++taken <= 2;
+    });
+    NL_TEST_ASSERT(inSuite, taken == 3);
+    NL_TEST_ASSERT(inSuite, interfaceId == INET_NULL_INTERFACEID);
+    NL_TEST_ASSERT(inSuite, cache.HasQueuedQueries());
+
+    taken = 0;
+    cache.TakeQueuedQueries(30, kTimeoutMs, &interfaceId, [&taken, &takenPeers](const PeerId & peerId) {
+        takenPeers[2] = peerId;
+        return ++taken > 0;
+    });
+    NL_TEST_ASSERT(inSuite, taken == 1);
+    NL_TEST_ASSERT(inSuite, !cache.HasQueuedQueries());
+
+    // The nodes wait for their responses from the time their query was taken.
+    for (size_t i = 0; i < 3; i++)
+    {
+        ResolvedNodeData node = MakeNodeData(takenPeers[i].GetNodeId(), 1);
+        NL_TEST_ASSERT(inSuite, cache.Update(node, 120, 20 + kTimeoutMs) == (i == 2));
+    }
+}
+
+void TestQueuedQueriesByInterface(nlTestSuite * inSuite, void * inContext)
+{
+    ResolverCache<3> cache;
+    ResolvedNodeData nodes[] = { MakeNodeData(1, 1), MakeNodeData(2, 2), MakeNodeData(3, 3) };
+    Inet::InterfaceId interfaceId;
+    size_t taken  = 0;
+    auto countAll = [&taken](const PeerId & peerId) { return ++taken > 0; };
+
+    nodes[0].mInterfaceId = TestInterface(0);
+    nodes[1].mInterfaceId = TestInterface(1);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        cache.MarkPending(nodes[i].mPeerId, 0, kTimeoutMs);
+        NL_TEST_ASSERT(inSuite, cache.Update(nodes[i], 120, 0));
+        NL_TEST_ASSERT(inSuite, cache.QueueQuery(nodes[i].mPeerId, 10));
+    }
+    NL_TEST_ASSERT(inSuite, cache.QueueQuery(nodes[2].mPeerId, 10));
+
+    // Refreshes are sent on the interface the node was seen on, new queries on all of them.
+    cache.TakeQueuedQueries(20, kTimeoutMs, &interfaceId, countAll);
+    NL_TEST_ASSERT(inSuite, taken == 1 && interfaceId == TestInterface(0));
+
+    taken = 0;
+    cache.TakeQueuedQueries(20, kTimeoutMs, &interfaceId, countAll);
+    NL_TEST_ASSERT(inSuite, taken == 1 && interfaceId == TestInterface(1));
+
+    taken = 0;
+    cache.TakeQueuedQueries(20, kTimeoutMs, &interfaceId, countAll);
+    NL_TEST_ASSERT(inSuite, taken == 1 && interfaceId == INET_NULL_INTERFACEID);
+    NL_TEST_ASSERT(inSuite, !cache.HasQueuedQueries());
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("CachesRequestedNodes", TestCachesRequestedNodes),         //
+    NL_TEST_DEF("PassiveUpdates", TestPassiveUpdates),                     //
+    NL_TEST_DEF("EvictsLeastRecentlyUsed", TestEvictsLeastRecentlyUsed),   //
+    NL_TEST_DEF("RefreshesNodesInUse", TestRefreshesNodesInUse),           //
+    NL_TEST_DEF("QueuedQueries", TestQueuedQueries),                       //
+    NL_TEST_DEF("QueuedQueriesByInterface", TestQueuedQueriesByInterface), //
+    NL_TEST_SENTINEL()                                                     //
+};
+
+} // namespace
+
+int TestResolverCache(void)
+{
+    nlTestSuite theSuite = { "ResolverCache", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestResolverCache)
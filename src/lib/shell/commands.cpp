@@ -24,6 +24,14 @@
 
 #include "shell_core.h"
 #include <support/CodeUtils.h>
+#include <system/SystemStats.h>
+
+#if CHIP_CONFIG_MEMORY_MGMT_TLSF
+#include <support/TlsfHeap.h>
+#endif // CHIP_CONFIG_MEMORY_MGMT_TLSF
+#if CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_CONFIG_MEMORY_MALLOC_STATS
+#include <support/MallocCache.h>
+#endif // CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_CONFIG_MEMORY_MALLOC_STATS
 
 #include <assert.h>
 #include <ctype.h>
@@ -60,10 +68,94 @@ int cmd_version(int argc, char ** argv)
     return 0;
 }
 
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+void cmd_stats_write(void * context, const char * text)
+{
+    streamer_printf(streamer_get(), "%s", text);
+}
+
+int cmd_stats(int argc, char ** argv)
+{
+    System::Stats::WritePrometheusText(cmd_stats_write, nullptr);
+    return 0;
+}
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+#if CHIP_CONFIG_MEMORY_MGMT_TLSF
+int cmd_heap(int argc, char ** argv)
+{
+    static const char * const kTagNames[] = { "untagged",          "system",     "inet",   "transport",
+                                              "secure-channel",    "messaging",  "crypto", "interaction-model",
+                                              "data-model",        "controller", "application" };
+    static_assert(ArraySize(kTagNames) == TlsfHeap::kNumTags, "Every memory tag needs a name");
+
+    TlsfHeap::Stats stats;
+    streamer_t * sout = streamer_get();
+
+    VerifyOrReturnError(Platform::MemoryGetHeapStats(stats) == CHIP_NO_ERROR, -1);
+
+    streamer_printf(sout, "size:           %u\n\r", static_cast<unsigned>(stats.mHeapSize));
+    streamer_printf(sout, "in use:         %u (high watermark %u)\n\r", static_cast<unsigned>(stats.mBytesInUse),
+                    static_cast<unsigned>(stats.mBytesInUseHighWatermark));
+    streamer_printf(sout, "free:           %u in %u blocks\n\r", static_cast<unsigned>(stats.GetFreeBytes()),
+                    static_cast<unsigned>(stats.mNumFreeBlocks));
+    streamer_printf(sout, "largest free:   %u\n\r", static_cast<unsigned>(stats.mLargestFreeBlock));
+    streamer_printf(sout, "fragmentation:  %u%%\n\r", stats.GetFragmentationPercent());
+    streamer_printf(sout, "allocations:    %u (%u failed)\n\r", static_cast<unsigned>(stats.mNumAllocations),
+                    static_cast<unsigned>(stats.mNumFailedAllocations));
+
+#if CHIP_CONFIG_MEMORY_TAGS
+    for (size_t i = 0; i < TlsfHeap::kNumTags; i++)
+    {
+        streamer_printf(sout, "  %-17s %u\n\r", kTagNames[i], static_cast<unsigned>(stats.mBytesInUseByTag[i]));
+    }
+#endif // CHIP_CONFIG_MEMORY_TAGS
+
+    return 0;
+}
+#endif // CHIP_CONFIG_MEMORY_MGMT_TLSF
+
+#if CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_CONFIG_MEMORY_MALLOC_STATS
+int cmd_malloc(int argc, char ** argv)
+{
+    Platform::MallocStats stats;
+    streamer_t * sout = streamer_get();
+
+    VerifyOrReturnError(Platform::MemoryGetMallocStats(stats) == CHIP_NO_ERROR, -1);
+
+    streamer_printf(sout, "live:           %u\n\r", static_cast<unsigned>(stats.GetLiveAllocations()));
+    streamer_printf(sout, "allocations:    %u (%u failed)\n\r", static_cast<unsigned>(stats.mNumAllocations),
+                    static_cast<unsigned>(stats.mNumFailedAllocations));
+    streamer_printf(sout, "reallocations:  %u\n\r", static_cast<unsigned>(stats.mNumReallocations));
+    streamer_printf(sout, "frees:          %u\n\r", static_cast<unsigned>(stats.mNumFrees));
+    streamer_printf(sout, "cache:          %u hits, %u misses\n\r", static_cast<unsigned>(stats.mNumCacheHits),
+                    static_cast<unsigned>(stats.mNumCacheMisses));
+
+    for (size_t i = 0; i < Platform::kMallocSizeClassCount; i++)
+    {
+        streamer_printf(sout, "  <= %-12u %u\n\r", static_cast<unsigned>(Platform::kMallocSmallestSizeClass << i),
+                        static_cast<unsigned>(stats.mNumAllocationsBySize[i]));
+    }
+    streamer_printf(sout, "  >  %-12u %u\n\r", static_cast<unsigned>(Platform::kMallocLargestSizeClass),
+                    static_cast<unsigned>(stats.mNumAllocationsBySize[Platform::kMallocSizeClassCount]));
+
+    return 0;
+}
+#endif // CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_CONFIG_MEMORY_MALLOC_STATS
+
 static shell_command_t cmds[] = {
     { &cmd_exit, "exit", "Exit the shell application" },
     { &cmd_help, "help", "List out all top level commands" },
     { &cmd_version, "version", "Output the software version" },
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    { &cmd_stats, "stats", "Output the resources in use and event counters, as Prometheus text" },
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+#if CHIP_CONFIG_MEMORY_MGMT_TLSF
+    { &cmd_heap, "heap", "Output the heap usage, fragmentation and high watermark" },
+#endif // CHIP_CONFIG_MEMORY_MGMT_TLSF
+#if CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_CONFIG_MEMORY_MALLOC_STATS
+    { &cmd_malloc, "malloc", "Output the allocation counters, by size" },
+#endif // CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_CONFIG_MEMORY_MALLOC_STATS
 };
 
 void Shell::RegisterDefaultCommands()
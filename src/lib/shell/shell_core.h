@@ -44,6 +44,11 @@
 #define CHIP_SHELL_MAX_TOKENS 10
 #endif // CHIP_SHELL_MAX_TOKENS
 
+// Size of the buffer the stdio streamer queues its output in for a writer thread, 0 to write it synchronously
+#ifndef CHIP_SHELL_STDIO_BUFFER_SIZE
+#define CHIP_SHELL_STDIO_BUFFER_SIZE 0
+#endif // CHIP_SHELL_STDIO_BUFFER_SIZE
+
 namespace chip {
 namespace Shell {
 
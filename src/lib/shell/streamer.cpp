@@ -53,6 +53,11 @@ ssize_t streamer_vprintf(streamer_t * self, const char * fmt, va_list ap)
     char buf[CONSOLE_DEFAULT_MAX_LINE];
     unsigned len;
 
+    if (self->vprintf_cb != nullptr)
+    {
+        return self->vprintf_cb(self, fmt, ap);
+    }
+
     // vsnprintf doesn't return negative numbers as long as the length it's
     // passed fits in INT_MAX.
     static_assert(sizeof(buf) <= INT_MAX, "Return value cast not valid");
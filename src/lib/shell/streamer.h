@@ -37,12 +37,14 @@ typedef const struct streamer streamer_t;
 typedef int streamer_init_fn(streamer_t * self);
 typedef ssize_t streamer_read_fn(streamer_t * self, char * buf, size_t len);
 typedef ssize_t streamer_write_fn(streamer_t * self, const char * buf, size_t len);
+typedef ssize_t streamer_vprintf_fn(streamer_t * self, const char * fmt, va_list ap);
 
 struct streamer
 {
     streamer_init_fn * init_cb;
     streamer_read_fn * read_cb;
     streamer_write_fn * write_cb;
+    streamer_vprintf_fn * vprintf_cb; // Optional, formats the output in place of the line buffer of streamer_vprintf()
 };
 
 int streamer_init(streamer_t * self);
@@ -0,0 +1,188 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Source implementation of a streamer queueing its output in a ring buffer.
+ */
+
+#include "streamer_buffered.h"
+
+#include "shell_core.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace Shell {
+
+namespace {
+
+struct streamer_buffered * streamer_buffered_from(streamer_t * self)
+{
+    // The streamer is the first member of the buffered streamer
+    return reinterpret_cast<struct streamer_buffered *>(const_cast<struct streamer *>(self));
+}
+
+void streamer_buffered_commit(struct streamer_buffered * self, size_t len)
+{
+    self->write_index = (self->write_index + len) % self->size;
+    self->used.fetch_add(len, std::memory_order_release);
+}
+
+size_t streamer_buffered_queue(struct streamer_buffered * self, const char * buf, size_t len)
+{
+    const size_t available = self->size - self->used.load(std::memory_order_acquire);
+    const size_t queued    = std::min(len, available);
+    const size_t first     = std::min(queued, self->size - self->write_index);
+
+    memcpy(self->buffer + self->write_index, buf, first);
+    memcpy(self->buffer, buf + first, queued - first);
+    streamer_buffered_commit(self, queued);
+
+    if (queued < len)
+    {
+        self->dropped.fetch_add(len - queued, std::memory_order_relaxed);
+    }
+    if (queued > 0 && self->notify_cb != nullptr)
+    {
+        self->notify_cb(self, self->notify_context);
+    }
+    return queued;
+}
+
+int streamer_buffered_init_cb(streamer_t * streamer)
+{
+    struct streamer_buffered * self = streamer_buffered_from(streamer);
+    return self->sink != nullptr ? streamer_init(self->sink) : 0;
+}
+
+ssize_t streamer_buffered_read_cb(streamer_t * streamer, char * buf, size_t len)
+{
+    struct streamer_buffered * self = streamer_buffered_from(streamer);
+    return self->sink != nullptr ? streamer_read(self->sink, buf, len) : 0;
+}
+
+ssize_t streamer_buffered_write_cb(streamer_t * streamer, const char * buf, size_t len)
+{
+    return static_cast<ssize_t>(streamer_buffered_queue(streamer_buffered_from(streamer), buf, len));
+}
+
+ssize_t streamer_buffered_vprintf_cb(streamer_t * streamer, const char * fmt, va_list ap)
+{
+    struct streamer_buffered * self = streamer_buffered_from(streamer);
+    const size_t available          = self->size - self->used.load(std::memory_order_acquire);
+    const size_t contiguous         = std::min(available, self->size - self->write_index);
+    char line[CHIP_SHELL_MAX_LINE_SIZE];
+    va_list args;
+    int rc;
+
+    // Format straight into the free space at the end of the ring, where the terminating null is written as well
+    va_copy(args, ap);
+    rc = vsnprintf(self->buffer + self->write_index, contiguous, fmt, args);
+    va_end(args);
+    if (rc < 0)
+    {
+        return rc;
+    }
+
+    if (static_cast<size_t>(rc) < contiguous)
+    {
+        streamer_buffered_commit(self, static_cast<size_t>(rc));
+        if (rc > 0 && self->notify_cb != nullptr)
+        {
+            self->notify_cb(self, self->notify_context);
+        }
+        return rc;
+    }
+
+    // The output wraps around the end of the ring or does not fit, so it goes through a line as for other streamers
+    rc = vsnprintf(line, sizeof(line), fmt, ap);
+    if (rc < 0)
+    {
+        return rc;
+    }
+    return static_cast<ssize_t>(streamer_buffered_queue(self, line, std::min(static_cast<size_t>(rc), sizeof(line) - 1)));
+}
+
+} // namespace
+
+void streamer_buffered_init(struct streamer_buffered * self, streamer_t * sink, char * buffer, size_t size,
+                            streamer_buffered_notify_fn * notify_cb, void * notify_context)
+{
+    self->streamer.init_cb    = streamer_buffered_init_cb;
+    self->streamer.read_cb    = streamer_buffered_read_cb;
+    self->streamer.write_cb   = streamer_buffered_write_cb;
+    self->streamer.vprintf_cb = streamer_buffered_vprintf_cb;
+    self->sink                = sink;
+    self->buffer              = buffer;
+    self->size                = size;
+    self->notify_cb           = notify_cb;
+    self->notify_context      = notify_context;
+    self->write_index         = 0;
+    self->read_index          = 0;
+    self->used.store(0);
+    self->dropped.store(0);
+}
+
+size_t streamer_buffered_peek(struct streamer_buffered * self, const char ** data)
+{
+    const size_t used = self->used.load(std::memory_order_acquire);
+
+    *data = self->buffer + self->read_index;
+    return std::min(used, self->size - self->read_index);
+}
+
+void streamer_buffered_consume(struct streamer_buffered * self, size_t len)
+{
+    self->read_index = (self->read_index + len) % self->size;
+    self->used.fetch_sub(len, std::memory_order_release);
+}
+
+size_t streamer_buffered_drain(struct streamer_buffered * self)
+{
+    size_t drained = 0;
+    const char * data;
+    size_t len;
+
+    while (self->sink != nullptr && (len = streamer_buffered_peek(self, &data)) > 0)
+    {
+        const ssize_t written = streamer_write(self->sink, data, len);
+        if (written <= 0)
+        {
+            break;
+        }
+        streamer_buffered_consume(self, static_cast<size_t>(written));
+        drained += static_cast<size_t>(written);
+    }
+
+    return drained;
+}
+
+size_t streamer_buffered_pending(struct streamer_buffered * self)
+{
+    return self->used.load(std::memory_order_acquire);
+}
+
+size_t streamer_buffered_dropped(struct streamer_buffered * self)
+{
+    return self->dropped.load(std::memory_order_relaxed);
+}
+
+} // namespace Shell
+} // namespace chip
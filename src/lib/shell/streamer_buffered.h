@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Header that defines a streamer queueing its output in a ring buffer,
+ *      which is drained to another streamer or to a UART by DMA outside of
+ *      the thread writing it.
+ */
+
+#pragma once
+
+#include "streamer.h"
+
+#include <atomic>
+#include <stdarg.h>
+#include <stddef.h>
+
+namespace chip {
+namespace Shell {
+
+struct streamer_buffered;
+
+/**
+ * Called after output is queued, to wake up whatever drains the buffer. It runs on the writing thread and must not block.
+ */
+typedef void streamer_buffered_notify_fn(struct streamer_buffered * self, void * context);
+
+/**
+ * A streamer whose writes copy the output into a ring buffer and return without waiting for it to be sent. Output that
+ * does not fit in the buffer is dropped and counted rather than blocking the writer.
+ *
+ * There is one writer, the thread running the shell, and one reader draining the buffer, such as a writer thread or the
+ * completion of UART DMA transfers. Reads are passed through to the sink.
+ */
+struct streamer_buffered
+{
+    struct streamer streamer; // The streamer to write to, see streamer_buffered_get()
+    streamer_t * sink;        // The streamer the output is drained to by streamer_buffered_drain()
+    char * buffer;
+    size_t size;
+    streamer_buffered_notify_fn * notify_cb;
+    void * notify_context;
+
+    size_t write_index;          // Owned by the writer
+    size_t read_index;           // Owned by the reader
+    std::atomic<size_t> used;    // Bytes queued, published by the writer and released by the reader
+    std::atomic<size_t> dropped; // Bytes dropped for lack of space
+};
+
+/**
+ * Initialize a buffered streamer.
+ *
+ * @param self                  The streamer to initialize.
+ * @param sink                  The streamer to drain the output to, which also serves the reads. May be null when the
+ *                              buffer is only drained through streamer_buffered_peek() and streamer_buffered_consume().
+ * @param buffer                The storage of the ring buffer.
+ * @param size                  The size of the buffer, in bytes.
+ * @param notify_cb             Called after output is queued, may be null.
+ * @param notify_context        Passed to notify_cb.
+ */
+void streamer_buffered_init(struct streamer_buffered * self, streamer_t * sink, char * buffer, size_t size,
+                            streamer_buffered_notify_fn * notify_cb, void * notify_context);
+
+/** Return the streamer to pass to the streamer_ functions. */
+static inline streamer_t * streamer_buffered_get(struct streamer_buffered * self)
+{
+    return &self->streamer;
+}
+
+/**
+ * Return, through data, the queued output that is contiguous in the buffer, for a DMA transfer to send.
+ *
+ * @return                      The number of bytes at data, zero when the buffer is empty.
+ */
+size_t streamer_buffered_peek(struct streamer_buffered * self, const char ** data);
+
+/** Release the space of len bytes that were sent, from the start of what streamer_buffered_peek() returned. */
+void streamer_buffered_consume(struct streamer_buffered * self, size_t len);
+
+/**
+ * Write all the queued output to the sink, from the reader.
+ *
+ * @return                      The number of bytes written.
+ */
+size_t streamer_buffered_drain(struct streamer_buffered * self);
+
+/** Return the number of bytes queued. */
+size_t streamer_buffered_pending(struct streamer_buffered * self);
+
+/** Return the number of bytes dropped since initialization because the buffer was full. */
+size_t streamer_buffered_dropped(struct streamer_buffered * self);
+
+} // namespace Shell
+} // namespace chip
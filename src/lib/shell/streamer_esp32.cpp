@@ -83,7 +83,7 @@ ssize_t streamer_esp32_read(streamer_t * streamer, char * buf, size_t len)
 
 ssize_t streamer_esp32_write(streamer_t * streamer, const char * buf, size_t len)
 {
-    return fprintf(stdout, buf, len);
+    return static_cast<ssize_t>(fwrite(buf, 1, len, stdout));
 }
 
 static streamer_t streamer_stdio = {
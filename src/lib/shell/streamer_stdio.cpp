@@ -21,6 +21,7 @@
  */
 
 #include "shell_core.h"
+#include "streamer_buffered.h"
 
 #include <signal.h>
 #include <stdio.h>
@@ -28,6 +29,12 @@
 #include <termios.h>
 #include <unistd.h>
 
+#if CHIP_SHELL_STDIO_BUFFER_SIZE > 0
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 namespace chip {
 namespace Shell {
 
@@ -41,6 +48,10 @@ static void streamer_restore_termios()
     tcsetattr(in_fd, TCSAFLUSH, &the_original_stdin_termios);
 }
 
+#if CHIP_SHELL_STDIO_BUFFER_SIZE > 0
+static void streamer_stdio_start_writer();
+#endif
+
 int streamer_stdio_init(streamer_t * streamer)
 {
     int ret   = 0;
@@ -58,6 +69,10 @@ int streamer_stdio_init(streamer_t * streamer)
         ret = tcsetattr(in_fd, TCSANOW, &termios);
     }
 
+#if CHIP_SHELL_STDIO_BUFFER_SIZE > 0
+    streamer_stdio_start_writer();
+#endif
+
     return ret;
 }
 
@@ -77,11 +92,84 @@ static streamer_t streamer_stdio = {
     .write_cb = streamer_stdio_write,
 };
 
+#if CHIP_SHELL_STDIO_BUFFER_SIZE > 0
+
+// The output of the commands is queued and written to stdout by a thread of its own, so that commands printing a lot
+// return without waiting on the terminal.
+static char the_stdio_buffer[CHIP_SHELL_STDIO_BUFFER_SIZE];
+static struct streamer_buffered the_stdio_buffered;
+static std::mutex the_writer_mutex;
+static std::condition_variable the_writer_condition;
+static std::thread the_writer;
+static bool the_writer_stopping = false;
+
+static void streamer_stdio_notify(struct streamer_buffered * self, void * context)
+{
+    std::lock_guard<std::mutex> lock(the_writer_mutex);
+    the_writer_condition.notify_one();
+}
+
+static void streamer_stdio_writer()
+{
+    std::unique_lock<std::mutex> lock(the_writer_mutex);
+
+    while (true)
+    {
+        the_writer_condition.wait(lock, [] { return the_writer_stopping || streamer_buffered_pending(&the_stdio_buffered) > 0; });
+
+        lock.unlock();
+        size_t drained = streamer_buffered_drain(&the_stdio_buffered);
+        lock.lock();
+
+        if (the_writer_stopping && (drained == 0 || streamer_buffered_pending(&the_stdio_buffered) == 0))
+        {
+            break;
+        }
+    }
+}
+
+// Write what is still queued before exiting
+static void streamer_stdio_stop_writer()
+{
+    {
+        std::lock_guard<std::mutex> lock(the_writer_mutex);
+        the_writer_stopping = true;
+        the_writer_condition.notify_one();
+    }
+    the_writer.join();
+}
+
+static void streamer_stdio_start_writer()
+{
+    if (!the_writer.joinable())
+    {
+        the_writer = std::thread(streamer_stdio_writer);
+        atexit(&streamer_stdio_stop_writer);
+    }
+}
+
+static streamer_t * streamer_stdio_buffered()
+{
+    streamer_buffered_init(&the_stdio_buffered, &streamer_stdio, the_stdio_buffer, sizeof(the_stdio_buffer),
+                           streamer_stdio_notify, nullptr);
+    return streamer_buffered_get(&the_stdio_buffered);
+}
+
+streamer_t * streamer_get()
+{
+    static streamer_t * streamer = streamer_stdio_buffered();
+    return streamer;
+}
+
+#else // CHIP_SHELL_STDIO_BUFFER_SIZE > 0
+
 streamer_t * streamer_get()
 {
     return &streamer_stdio;
 }
 
+#endif // CHIP_SHELL_STDIO_BUFFER_SIZE > 0
+
 #endif //#ifndef SHELL_STREAMER_APP_SPECIFIC
 
 } // namespace Shell
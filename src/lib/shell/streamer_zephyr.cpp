@@ -57,9 +57,8 @@ ssize_t streamer_zephyr_read(streamer_t * streamer, char * buffer, size_t length
 ssize_t streamer_zephyr_write(streamer_t * streamer, const char * buffer, size_t length)
 {
     ARG_UNUSED(streamer);
-    for (size_t i = 0; i < length; ++i)
-        // TODO: Don't assume that UART backend is used.
-        shell_fprintf(shell_backend_uart_get_ptr(), SHELL_NORMAL, "%c", buffer[i]);
+    // TODO: Don't assume that UART backend is used.
+    shell_fprintf(shell_backend_uart_get_ptr(), SHELL_NORMAL, "%.*s", static_cast<int>(length), buffer);
     return length;
 }
 
@@ -32,6 +32,7 @@ extern "C" {
 
 int TestShell(void);
 int TestStreamerStdio(void);
+int TestStreamerBuffered(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "TestShell.h"
+
+#include <shell/streamer_buffered.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Shell;
+
+namespace {
+
+// A sink collecting what is drained to it, accepting at most gSinkChunk bytes per write
+char gSinkOutput[256];
+size_t gSinkLength = 0;
+size_t gSinkChunk  = SIZE_MAX;
+
+ssize_t streamer_sink_write(streamer_t * self, const char * buf, size_t len)
+{
+    len = std::min(std::min(len, gSinkChunk), sizeof(gSinkOutput) - gSinkLength);
+    memcpy(gSinkOutput + gSinkLength, buf, len);
+    gSinkLength += len;
+    return static_cast<ssize_t>(len);
+}
+
+streamer_t streamer_sink = {
+    .init_cb  = nullptr,
+    .read_cb  = nullptr,
+    .write_cb = streamer_sink_write,
+};
+
+size_t gNotifications = 0;
+
+void streamer_count_notify(struct streamer_buffered * self, void * context)
+{
+    gNotifications++;
+}
+
+bool SinkOutputIs(const char * expected)
+{
+    bool equal  = gSinkLength == strlen(expected) && memcmp(gSinkOutput, expected, gSinkLength) == 0;
+    gSinkLength = 0;
+    return equal;
+}
+
+void TestStreamerBuffered_Write(nlTestSuite * inSuite, void * inContext)
+{
+    char buffer[8];
+    struct streamer_buffered buffered;
+    streamer_buffered_init(&buffered, &streamer_sink, buffer, sizeof(buffer), streamer_count_notify, nullptr);
+    streamer_t * streamer = streamer_buffered_get(&buffered);
+    gSinkLength           = gNotifications = 0;
+    gSinkChunk            = SIZE_MAX;
+
+    NL_TEST_ASSERT(inSuite, streamer_write(streamer, "abcde", 5) == 5);
+    NL_TEST_ASSERT(inSuite, gSinkLength == 0);
+    NL_TEST_ASSERT(inSuite, gNotifications == 1);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_pending(&buffered) == 5);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_drain(&buffered) == 5);
+    NL_TEST_ASSERT(inSuite, SinkOutputIs("abcde"));
+
+    // Wraps around the end of the buffer, and is drained in two parts
+    NL_TEST_ASSERT(inSuite, streamer_write(streamer, "fghijk", 6) == 6);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_drain(&buffered) == 6);
+    NL_TEST_ASSERT(inSuite, SinkOutputIs("fghijk"));
+
+    // What does not fit is dropped
+    NL_TEST_ASSERT(inSuite, streamer_write(streamer, "0123456789", 10) == 8);
+    NL_TEST_ASSERT(inSuite, streamer_write(streamer, "x", 1) == 0);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_dropped(&buffered) == 3);
+    NL_TEST_ASSERT(inSuite, gNotifications == 3);
+
+    // A sink taking part of the output leaves the rest queued
+    gSinkChunk = 3;
+    NL_TEST_ASSERT(inSuite, streamer_buffered_drain(&buffered) == 8);
+    NL_TEST_ASSERT(inSuite, SinkOutputIs("01234567"));
+    NL_TEST_ASSERT(inSuite, streamer_buffered_pending(&buffered) == 0);
+}
+
+void TestStreamerBuffered_Printf(nlTestSuite * inSuite, void * inContext)
+{
+    char buffer[16];
+    struct streamer_buffered buffered;
+    streamer_buffered_init(&buffered, &streamer_sink, buffer, sizeof(buffer), nullptr, nullptr);
+    streamer_t * streamer = streamer_buffered_get(&buffered);
+    gSinkLength           = 0;
+    gSinkChunk            = SIZE_MAX;
+
+    // Formatted in place, the terminating null is not queued
+    NL_TEST_ASSERT(inSuite, streamer_printf(streamer, "%s=%d;", "x", 42) == 5);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_pending(&buffered) == 5);
+
+    // Wraps around the end of the buffer
+    NL_TEST_ASSERT(inSuite, streamer_buffered_drain(&buffered) == 5);
+    NL_TEST_ASSERT(inSuite, streamer_printf(streamer, "%08x", 0xcafe) == 8);
+    NL_TEST_ASSERT(inSuite, streamer_printf(streamer, "%s", "0123456") == 7);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_drain(&buffered) == 15);
+    NL_TEST_ASSERT(inSuite, SinkOutputIs("x=42;0000cafe0123456"));
+
+    // Truncated to the space left
+    NL_TEST_ASSERT(inSuite, streamer_printf(streamer, "%s", "0123456789abcdefgh") == 16);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_dropped(&buffered) == 2);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_drain(&buffered) == 16);
+    NL_TEST_ASSERT(inSuite, SinkOutputIs("0123456789abcdef"));
+}
+
+void TestStreamerBuffered_PeekConsume(nlTestSuite * inSuite, void * inContext)
+{
+    char buffer[8];
+    struct streamer_buffered buffered;
+    streamer_buffered_init(&buffered, nullptr, buffer, sizeof(buffer), nullptr, nullptr);
+    streamer_t * streamer = streamer_buffered_get(&buffered);
+    const char * data;
+
+    NL_TEST_ASSERT(inSuite, streamer_buffered_peek(&buffered, &data) == 0);
+
+    NL_TEST_ASSERT(inSuite, streamer_write(streamer, "abcdef", 6) == 6);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_peek(&buffered, &data) == 6);
+    NL_TEST_ASSERT(inSuite, memcmp(data, "abcdef", 6) == 0);
+    streamer_buffered_consume(&buffered, 6);
+
+    // The part at the start of the buffer is returned once the end is consumed
+    NL_TEST_ASSERT(inSuite, streamer_write(streamer, "ghij", 4) == 4);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_peek(&buffered, &data) == 2);
+    NL_TEST_ASSERT(inSuite, memcmp(data, "gh", 2) == 0);
+    streamer_buffered_consume(&buffered, 2);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_peek(&buffered, &data) == 2);
+    NL_TEST_ASSERT(inSuite, memcmp(data, "ij", 2) == 0);
+    streamer_buffered_consume(&buffered, 2);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_pending(&buffered) == 0);
+
+    // Without a sink there is nothing to drain to
+    NL_TEST_ASSERT(inSuite, streamer_write(streamer, "k", 1) == 1);
+    NL_TEST_ASSERT(inSuite, streamer_buffered_drain(&buffered) == 0);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test Streamer: TestStreamerBuffered_Write", TestStreamerBuffered_Write),
+    NL_TEST_DEF("Test Streamer: TestStreamerBuffered_Printf", TestStreamerBuffered_Printf),
+    NL_TEST_DEF("Test Streamer: TestStreamerBuffered_PeekConsume", TestStreamerBuffered_PeekConsume),
+
+    NL_TEST_SENTINEL()
+};
+
+} // namespace
+
+int TestStreamerBuffered(void)
+{
+    nlTestSuite theSuite = { "CHIP Buffered Streamer tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestStreamerBuffered)
@@ -0,0 +1,42 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <support/Arena.h>
+
+#include <nlassert.h>
+
+namespace chip {
+
+void * ArenaAllocatorBase::Allocate(size_t aSize, size_t aAlignment)
+{
+    nlASSERT(aAlignment != 0 && (aAlignment & (aAlignment - 1)) == 0);
+
+    // The padding aligns the address, whatever the alignment of the buffer.
+    const uintptr_t next = reinterpret_cast<uintptr_t>(mStorage + mUsed);
+    const size_t padding = static_cast<size_t>(((next + aAlignment - 1) & ~(static_cast<uintptr_t>(aAlignment) - 1)) - next);
+    const size_t offset  = mUsed + padding;
+    if (padding > mCapacity - mUsed || aSize > mCapacity - offset)
+    {
+        return nullptr;
+    }
+
+    mUsed = offset + aSize;
+    return mStorage + offset;
+}
+
+} // namespace chip
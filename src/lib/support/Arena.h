@@ -0,0 +1,102 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   Defines an arena allocator class ArenaAllocator.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+
+/**
+ * Hands out the memory of a fixed buffer front to back. Nothing is freed on its own: Reset() frees everything at once, which
+ * suits the scratch memory of a unit of work, such as the processing of a message, released together when the work is done.
+ *
+ * Not thread safe.
+ */
+class ArenaAllocatorBase
+{
+public:
+    ArenaAllocatorBase(void * storage, size_t capacity) : mStorage(static_cast<uint8_t *>(storage)), mCapacity(capacity) {}
+
+    /**
+     * Allocate aSize bytes aligned on aAlignment, a power of two.
+     *
+     * @return the memory, or nullptr if the arena has not enough left.
+     */
+    void * Allocate(size_t aSize, size_t aAlignment = alignof(std::max_align_t));
+
+    /**
+     * Allocate and construct an object. The object is never destroyed, so it must be trivially destructible.
+     *
+     * @return the object, or nullptr if the arena has not enough left.
+     */
+    template <typename T, typename... Args>
+    T * New(Args &&... args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Objects of an arena are not destroyed");
+        void * memory = Allocate(sizeof(T), alignof(T));
+        return (memory == nullptr) ? nullptr : new (memory) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * The memory not allocated yet, which can be filled first and then allocated by Allocate(size, 1): an allocation not
+     * aligned further starts there.
+     */
+    uint8_t * Unused() { return mStorage + mUsed; }
+    size_t UnusedSize() const { return mCapacity - mUsed; }
+
+    /**
+     * Free everything allocated from the arena.
+     */
+    void Reset() { mUsed = 0; }
+
+    size_t Capacity() const { return mCapacity; }
+    size_t Used() const { return mUsed; }
+
+private:
+    uint8_t * const mStorage;
+    const size_t mCapacity;
+    size_t mUsed = 0;
+};
+
+/**
+ *  @brief
+ *   An arena allocator holding its buffer.
+ *
+ *  @tparam     N   the size of the buffer, in bytes.
+ */
+template <size_t N>
+class ArenaAllocator : public ArenaAllocatorBase
+{
+public:
+    ArenaAllocator() : ArenaAllocatorBase(mMemory, N) {}
+
+private:
+    alignas(std::max_align_t) uint8_t mMemory[N];
+};
+
+} // namespace chip
@@ -27,8 +27,11 @@
 #endif
 #include "Base64.h"
 
+#include <support/SimdSupport.h>
+
 #include <ctype.h>
 #include <stdint.h>
+#include <string.h>
 
 namespace chip {
 
@@ -114,7 +117,10 @@ static uint8_t Base64URLCharToVal(uint8_t c)
     return UINT8_MAX;
 }
 
-uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
+namespace {
+
+template <typename ValToChar>
+uint16_t EncodeScalar(const uint8_t * in, uint16_t inLen, char * out, ValToChar valToChar)
 {
     char * outStart = out;
 
@@ -145,62 +151,17 @@ uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out, Base64ValT
         else
             val3 = val4 = UINT8_MAX;
 
-        *out++ = valToCharFunct(val1);
-        *out++ = valToCharFunct(val2);
-        *out++ = valToCharFunct(val3);
-        *out++ = valToCharFunct(val4);
+        *out++ = valToChar(val1);
+        *out++ = valToChar(val2);
+        *out++ = valToChar(val3);
+        *out++ = valToChar(val4);
     }
 
     return static_cast<uint16_t>(out - outStart);
 }
 
-uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out)
-{
-    return Base64Encode(in, inLen, out, Base64ValToChar);
-}
-
-uint16_t Base64URLEncode(const uint8_t * in, uint16_t inLen, char * out)
-{
-    return Base64Encode(in, inLen, out, Base64URLValToChar);
-}
-
-uint32_t Base64Encode32(const uint8_t * in, uint32_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
-{
-    uint32_t outLen = 0;
-
-    // Maximum number of input bytes to convert to base-64 in a single call to Base64Encode.
-    // Number is the largest multiple of 3 bytes where the resulting number of base-64 characters
-    // fits within a uint16_t.
-    enum
-    {
-        kMaxConvert = (UINT16_MAX / 4) * 3
-    };
-
-    while (true)
-    {
-        uint16_t inChunkLen = (inLen > kMaxConvert) ? static_cast<uint16_t>(kMaxConvert) : static_cast<uint16_t>(inLen);
-
-        uint16_t outChunkLen = Base64Encode(in, inChunkLen, out, valToCharFunct);
-
-        inLen -= inChunkLen;
-        outLen += outChunkLen;
-
-        if (inLen == 0)
-            break;
-
-        in += inChunkLen;
-        out += outChunkLen;
-    }
-
-    return outLen;
-}
-
-uint32_t Base64Encode32(const uint8_t * in, uint32_t inLen, char * out)
-{
-    return Base64Encode32(in, inLen, out, Base64ValToChar);
-}
-
-uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out, Base64CharToValFunct charToValFunct)
+template <typename CharToVal>
+uint16_t DecodeScalar(const char * in, uint16_t inLen, uint8_t * out, CharToVal charToVal)
 {
     uint8_t * outStart = out;
 
@@ -210,8 +171,8 @@ uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out, Base64Char
         if (inLen == 1)
             goto fail;
 
-        uint8_t a = charToValFunct(static_cast<uint8_t>(*in++));
-        uint8_t b = charToValFunct(static_cast<uint8_t>(*in++));
+        uint8_t a = charToVal(static_cast<uint8_t>(*in++));
+        uint8_t b = charToVal(static_cast<uint8_t>(*in++));
         inLen     = static_cast<uint16_t>(inLen - 2);
 
         if (a == UINT8_MAX || b == UINT8_MAX)
@@ -222,7 +183,7 @@ uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out, Base64Char
         if (inLen == 0 || *in == '=')
             break;
 
-        uint8_t c = charToValFunct(static_cast<uint8_t>(*in++));
+        uint8_t c = charToVal(static_cast<uint8_t>(*in++));
         inLen--;
 
         if (c == UINT8_MAX)
@@ -233,7 +194,7 @@ uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out, Base64Char
         if (inLen == 0 || *in == '=')
             break;
 
-        uint8_t d = charToValFunct(static_cast<uint8_t>(*in++));
+        uint8_t d = charToVal(static_cast<uint8_t>(*in++));
         inLen--;
 
         if (d == UINT8_MAX)
@@ -248,17 +209,263 @@ fail:
     return UINT16_MAX;
 }
 
-uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out)
+// The vector code below handles whole blocks of input, leaving the rest, padding and errors to the scalar code. The two
+// alphabets only differ by the characters of the values 62 and 63.
+
+#if CHIP_SIMD_SSSE3
+
+// Encodes 12 bytes to 16 characters at a time, reading 16 bytes. Returns the number of bytes encoded.
+CHIP_SIMD_TARGET_SSSE3 size_t EncodeBlocksSSSE3(const uint8_t * in, size_t inLen, char * out, char char62, char char63)
 {
-    return Base64Decode(in, inLen, out, Base64CharToVal);
+    // Spread each 3 bytes over the 4 bytes of a 32-bit lane, then move each 6-bit value to a byte of its own
+    const __m128i shuffle  = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i maskAC   = _mm_set1_epi32(0x0fc0fc00);
+    const __m128i shiftAC  = _mm_set1_epi32(0x04000040);
+    const __m128i maskBD   = _mm_set1_epi32(0x003f03f0);
+    const __m128i shiftBD  = _mm_set1_epi32(0x01000010);
+    const __m128i shiftLut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                           '0' - 52, '0' - 52, static_cast<char>(char62 - 62), static_cast<char>(char63 - 63), 'A',
+                                           0, 0);
+    size_t done = 0;
+
+    for (; done + 16 <= inLen; done += 12, out += 16)
+    {
+        __m128i input  = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + done)), shuffle);
+        __m128i values = _mm_or_si128(_mm_mulhi_epu16(_mm_and_si128(input, maskAC), shiftAC),
+                                      _mm_mullo_epi16(_mm_and_si128(input, maskBD), shiftBD));
+
+        // Index shiftLut with 13 for 0..25, 0 for 26..51, 1..10 for 52..61, 11 for 62 and 12 for 63
+        __m128i lutIndex = _mm_subs_epu8(values, _mm_set1_epi8(51));
+        lutIndex         = _mm_or_si128(lutIndex, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), values), _mm_set1_epi8(13)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_add_epi8(values, _mm_shuffle_epi8(shiftLut, lutIndex)));
+    }
+
+    return done;
 }
 
-uint16_t Base64URLDecode(const char * in, uint16_t inLen, uint8_t * out)
+CHIP_SIMD_TARGET_SSSE3 inline __m128i InRangeSSSE3(__m128i c, char low, char high)
 {
-    return Base64Decode(in, inLen, out, Base64URLCharToVal);
+    return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8(static_cast<char>(low - 1))),
+                         _mm_cmplt_epi8(c, _mm_set1_epi8(static_cast<char>(high + 1))));
 }
 
-uint32_t Base64Decode32(const char * in, uint32_t inLen, uint8_t * out, Base64CharToValFunct charToValFunct)
+// Decodes 16 characters to 12 bytes at a time, until a character other than those of the alphabet, such as padding. Returns
+// the number of characters decoded.
+CHIP_SIMD_TARGET_SSSE3 size_t DecodeBlocksSSSE3(const char * in, size_t inLen, uint8_t * out, char char62, char char63)
+{
+    const __m128i packPairs = _mm_set1_epi32(0x01400140);
+    const __m128i packQuads = _mm_set1_epi32(0x00011000);
+    const __m128i shuffle   = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    size_t done             = 0;
+
+    for (; done + 16 <= inLen; done += 16, out += 12)
+    {
+        // Characters above 127 are negative, and so in none of the ranges
+        __m128i c      = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + done));
+        __m128i upper  = InRangeSSSE3(c, 'A', 'Z');
+        __m128i lower  = InRangeSSSE3(c, 'a', 'z');
+        __m128i digit  = InRangeSSSE3(c, '0', '9');
+        __m128i is62   = _mm_cmpeq_epi8(c, _mm_set1_epi8(char62));
+        __m128i is63   = _mm_cmpeq_epi8(c, _mm_set1_epi8(char63));
+        __m128i valid  = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, is62)), is63);
+        __m128i offset = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+        offset         = _mm_or_si128(offset, _mm_and_si128(lower, _mm_set1_epi8(static_cast<char>(26 - 'a'))));
+        offset         = _mm_or_si128(offset, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+        offset         = _mm_or_si128(offset, _mm_and_si128(is62, _mm_set1_epi8(static_cast<char>(62 - char62))));
+        offset         = _mm_or_si128(offset, _mm_and_si128(is63, _mm_set1_epi8(static_cast<char>(63 - char63))));
+        if (_mm_movemask_epi8(valid) != 0xFFFF)
+            break;
+
+        // Merge the 6-bit values in pairs, then in quads of 24 bits, and pack the 3 bytes of each quad, most significant first
+        __m128i values = _mm_add_epi8(c, offset);
+        __m128i packed = _mm_shuffle_epi8(_mm_madd_epi16(_mm_maddubs_epi16(values, packPairs), packQuads), shuffle);
+
+        // Only 12 of the 16 bytes are output, so as not to write past the end of the output buffer
+        uint8_t bytes[16];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(bytes), packed);
+        memcpy(out, bytes, 12);
+    }
+
+    return done;
+}
+
+#endif // CHIP_SIMD_SSSE3
+
+#if CHIP_SIMD_NEON
+
+inline uint8x16_t EncodeValuesNEON(uint8x16_t values, char char62, char char63)
+{
+    uint8x16_t offset = vdupq_n_u8('A');
+    offset            = vbslq_u8(vcgeq_u8(values, vdupq_n_u8(26)), vdupq_n_u8(static_cast<uint8_t>('a' - 26)), offset);
+    offset            = vbslq_u8(vcgeq_u8(values, vdupq_n_u8(52)), vdupq_n_u8(static_cast<uint8_t>('0' - 52)), offset);
+    offset            = vbslq_u8(vceqq_u8(values, vdupq_n_u8(62)), vdupq_n_u8(static_cast<uint8_t>(char62 - 62)), offset);
+    offset            = vbslq_u8(vceqq_u8(values, vdupq_n_u8(63)), vdupq_n_u8(static_cast<uint8_t>(char63 - 63)), offset);
+    return vaddq_u8(values, offset);
+}
+
+// Encodes 48 bytes to 64 characters at a time. Returns the number of bytes encoded.
+size_t EncodeBlocksNEON(const uint8_t * in, size_t inLen, char * out, char char62, char char63)
+{
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+    size_t done           = 0;
+
+    for (; done + 48 <= inLen; done += 48, out += 64)
+    {
+        uint8x16x3_t bytes = vld3q_u8(in + done);
+        uint8x16x4_t chars;
+
+        chars.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        chars.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask);
+        chars.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask);
+        chars.val[3] = vandq_u8(bytes.val[2], mask);
+        for (uint8x16_t & value : chars.val)
+        {
+            value = EncodeValuesNEON(value, char62, char63);
+        }
+        vst4q_u8(reinterpret_cast<uint8_t *>(out), chars);
+    }
+
+    return done;
+}
+
+inline uint8x16_t InRangeNEON(uint8x16_t c, char low, char high)
+{
+    return vandq_u8(vcgeq_u8(c, vdupq_n_u8(static_cast<uint8_t>(low))), vcleq_u8(c, vdupq_n_u8(static_cast<uint8_t>(high))));
+}
+
+// Converts characters to their 6-bit values, clearing the lanes of valid for the characters not in the alphabet.
+inline uint8x16_t DecodeCharsNEON(uint8x16_t c, char char62, char char63, uint8x16_t & valid)
+{
+    uint8x16_t upper = InRangeNEON(c, 'A', 'Z');
+    uint8x16_t lower = InRangeNEON(c, 'a', 'z');
+    uint8x16_t digit = InRangeNEON(c, '0', '9');
+    uint8x16_t is62  = vceqq_u8(c, vdupq_n_u8(static_cast<uint8_t>(char62)));
+    uint8x16_t is63  = vceqq_u8(c, vdupq_n_u8(static_cast<uint8_t>(char63)));
+
+    uint8x16_t offset = vandq_u8(upper, vdupq_n_u8(static_cast<uint8_t>(-'A')));
+    offset            = vorrq_u8(offset, vandq_u8(lower, vdupq_n_u8(static_cast<uint8_t>(26 - 'a'))));
+    offset            = vorrq_u8(offset, vandq_u8(digit, vdupq_n_u8(static_cast<uint8_t>(52 - '0'))));
+    offset            = vorrq_u8(offset, vandq_u8(is62, vdupq_n_u8(static_cast<uint8_t>(62 - char62))));
+    offset            = vorrq_u8(offset, vandq_u8(is63, vdupq_n_u8(static_cast<uint8_t>(63 - char63))));
+
+    valid = vandq_u8(valid, vorrq_u8(vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, is62)), is63));
+    return vaddq_u8(c, offset);
+}
+
+// Decodes 64 characters to 48 bytes at a time, until a character other than those of the alphabet. Returns the number of
+// characters decoded.
+size_t DecodeBlocksNEON(const char * in, size_t inLen, uint8_t * out, char char62, char char63)
+{
+    size_t done = 0;
+
+    for (; done + 64 <= inLen; done += 64, out += 48)
+    {
+        uint8x16x4_t values = vld4q_u8(reinterpret_cast<const uint8_t *>(in + done));
+        uint8x16_t valid    = vdupq_n_u8(0xFF);
+        uint8x16x3_t bytes;
+
+        for (uint8x16_t & value : values.val)
+        {
+            value = DecodeCharsNEON(value, char62, char63, valid);
+        }
+        if (vminvq_u8(valid) == 0)
+            break;
+
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+        vst3q_u8(out, bytes);
+    }
+
+    return done;
+}
+
+#endif // CHIP_SIMD_NEON
+
+// Encodes the leading whole blocks of in with the vector code, if any. Returns the number of bytes encoded, a multiple of 3.
+size_t EncodeBlocks(const uint8_t * in, size_t inLen, char * out, char char62, char char63)
+{
+#if CHIP_SIMD_NEON
+    return EncodeBlocksNEON(in, inLen, out, char62, char63);
+#else
+#if CHIP_SIMD_SSSE3
+    if (Simd::HasSSSE3())
+        return EncodeBlocksSSSE3(in, inLen, out, char62, char63);
+#endif
+    return 0;
+#endif
+}
+
+// Decodes the leading whole blocks of in with the vector code, if any. Returns the number of characters decoded, a multiple of 4.
+size_t DecodeBlocks(const char * in, size_t inLen, uint8_t * out, char char62, char char63)
+{
+#if CHIP_SIMD_NEON
+    return DecodeBlocksNEON(in, inLen, out, char62, char63);
+#else
+#if CHIP_SIMD_SSSE3
+    if (Simd::HasSSSE3())
+        return DecodeBlocksSSSE3(in, inLen, out, char62, char63);
+#endif
+    return 0;
+#endif
+}
+
+template <typename ValToChar>
+uint16_t EncodeWithAlphabet(const uint8_t * in, uint16_t inLen, char * out, char char62, char char63, ValToChar valToChar)
+{
+    size_t inDone  = EncodeBlocks(in, inLen, out, char62, char63);
+    size_t outDone = inDone / 3 * 4;
+
+    return static_cast<uint16_t>(
+        outDone + EncodeScalar(in + inDone, static_cast<uint16_t>(inLen - inDone), out + outDone, valToChar));
+}
+
+template <typename CharToVal>
+uint16_t DecodeWithAlphabet(const char * in, uint16_t inLen, uint8_t * out, char char62, char char63, CharToVal charToVal)
+{
+    size_t inDone  = DecodeBlocks(in, inLen, out, char62, char63);
+    size_t outDone = inDone / 4 * 3;
+
+    uint16_t outLen = DecodeScalar(in + inDone, static_cast<uint16_t>(inLen - inDone), out + outDone, charToVal);
+    return (outLen == UINT16_MAX) ? UINT16_MAX : static_cast<uint16_t>(outDone + outLen);
+}
+
+// Calls encode on chunks of the input small enough for the 16-bit lengths of Base64Encode.
+template <typename Encode>
+uint32_t Encode32(const uint8_t * in, uint32_t inLen, char * out, Encode encode)
+{
+    uint32_t outLen = 0;
+
+    // Maximum number of input bytes to convert to base-64 in a single call to Base64Encode.
+    // Number is the largest multiple of 3 bytes where the resulting number of base-64 characters
+    // fits within a uint16_t.
+    enum
+    {
+        kMaxConvert = (UINT16_MAX / 4) * 3
+    };
+
+    while (true)
+    {
+        uint16_t inChunkLen = (inLen > kMaxConvert) ? static_cast<uint16_t>(kMaxConvert) : static_cast<uint16_t>(inLen);
+
+        uint16_t outChunkLen = encode(in, inChunkLen, out);
+
+        inLen -= inChunkLen;
+        outLen += outChunkLen;
+
+        if (inLen == 0)
+            break;
+
+        in += inChunkLen;
+        out += outChunkLen;
+    }
+
+    return outLen;
+}
+
+// Calls decode on chunks of the input small enough for the 16-bit lengths of Base64Decode.
+template <typename Decode>
+uint32_t Decode32(const char * in, uint32_t inLen, uint8_t * out, Decode decode)
 {
     uint32_t outLen = 0;
 
@@ -273,7 +480,7 @@ uint32_t Base64Decode32(const char * in, uint32_t inLen, uint8_t * out, Base64Ch
     {
         uint16_t inChunkLen = (inLen > kMaxConvert) ? static_cast<uint16_t>(kMaxConvert) : static_cast<uint16_t>(inLen);
 
-        uint16_t outChunkLen = Base64Decode(in, inChunkLen, out, charToValFunct);
+        uint16_t outChunkLen = decode(in, inChunkLen, out);
         if (outChunkLen == UINT16_MAX)
             return UINT32_MAX;
 
@@ -290,9 +497,64 @@ uint32_t Base64Decode32(const char * in, uint32_t inLen, uint8_t * out, Base64Ch
     return outLen;
 }
 
+} // namespace
+
+uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
+{
+    return EncodeScalar(in, inLen, out, valToCharFunct);
+}
+
+uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out)
+{
+    return EncodeWithAlphabet(in, inLen, out, '+', '/', [](uint8_t val) { return Base64ValToChar(val); });
+}
+
+uint16_t Base64URLEncode(const uint8_t * in, uint16_t inLen, char * out)
+{
+    return EncodeWithAlphabet(in, inLen, out, '-', '_', [](uint8_t val) { return Base64URLValToChar(val); });
+}
+
+uint32_t Base64Encode32(const uint8_t * in, uint32_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
+{
+    return Encode32(in, inLen, out, [valToCharFunct](const uint8_t * chunk, uint16_t chunkLen, char * chunkOut) {
+        return Base64Encode(chunk, chunkLen, chunkOut, valToCharFunct);
+    });
+}
+
+uint32_t Base64Encode32(const uint8_t * in, uint32_t inLen, char * out)
+{
+    return Encode32(in, inLen, out, [](const uint8_t * chunk, uint16_t chunkLen, char * chunkOut) {
+        return Base64Encode(chunk, chunkLen, chunkOut);
+    });
+}
+
+uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out, Base64CharToValFunct charToValFunct)
+{
+    return DecodeScalar(in, inLen, out, charToValFunct);
+}
+
+uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out)
+{
+    return DecodeWithAlphabet(in, inLen, out, '+', '/', [](uint8_t c) { return Base64CharToVal(c); });
+}
+
+uint16_t Base64URLDecode(const char * in, uint16_t inLen, uint8_t * out)
+{
+    return DecodeWithAlphabet(in, inLen, out, '-', '_', [](uint8_t c) { return Base64URLCharToVal(c); });
+}
+
+uint32_t Base64Decode32(const char * in, uint32_t inLen, uint8_t * out, Base64CharToValFunct charToValFunct)
+{
+    return Decode32(in, inLen, out, [charToValFunct](const char * chunk, uint16_t chunkLen, uint8_t * chunkOut) {
+        return Base64Decode(chunk, chunkLen, chunkOut, charToValFunct);
+    });
+}
+
 uint32_t Base64Decode32(const char * in, uint32_t inLen, uint8_t * out)
 {
-    return Base64Decode32(in, inLen, out, Base64CharToVal);
+    return Decode32(in, inLen, out, [](const char * chunk, uint16_t chunkLen, uint8_t * chunkOut) {
+        return Base64Decode(chunk, chunkLen, chunkOut);
+    });
 }
 
 } // namespace chip
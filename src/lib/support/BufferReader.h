@@ -26,6 +26,7 @@
 #include <lib/core/CHIPEncoding.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/FixedLayout.h>
 #include <stdint.h>
 
 namespace chip {
@@ -146,6 +147,34 @@ public:
         return *this;
     }
 
+    /**
+     * Read a fixed sequence of unsigned integers, e.g. the fields of a header,
+     * with a single check that all of them are available.
+     *
+     * @param [out] dests Where the integers go, in the order they are read.
+     *
+     * @note If the integers are not all available, none is read and the reader
+     *       is put in a failed-status state, as for the single reads.
+     */
+    template <typename... Fields>
+    CHECK_RETURN_VALUE
+    Reader & ReadFixed(Fields *... dests)
+    {
+        constexpr size_t kSize = FixedLayout<Fields...>::kSize;
+
+        if (mAvailable < kSize)
+        {
+            mStatus = CHIP_ERROR_BUFFER_TOO_SMALL;
+            // Ensure that future reads all fail.
+            mAvailable = 0;
+            return *this;
+        }
+
+        LittleEndian::ReadFixed(mReadPtr, dests...);
+        mAvailable = static_cast<uint16_t>(mAvailable - kSize);
+        return *this;
+    }
+
     /**
      * Helper for our various APIs so we don't have to write out various logic
      * multiple times.  This is public so that consumers that want to read into
@@ -43,6 +43,14 @@ BufferWriter & BufferWriter::Put(const void * buf, size_t len)
     return *this;
 }
 
+uint8_t * BufferWriter::Reserve(size_t len)
+{
+    uint8_t * reserved = (mBuf != nullptr && Available() >= len) ? mBuf + mNeeded : nullptr;
+
+    mNeeded += len;
+    return reserved;
+}
+
 BufferWriter & BufferWriter::Put(uint8_t c)
 {
     if (mNeeded < mSize)
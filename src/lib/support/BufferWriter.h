@@ -21,6 +21,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <support/FixedLayout.h>
+
 namespace chip {
 namespace Encoding {
 
@@ -46,6 +48,10 @@ public:
         return *this;
     }
 
+    /// Reserve len bytes for the caller to write directly, with a single bounds check for all of them. Returns nullptr,
+    /// and leaves the input as not fitting, if they do not fit in the buffer.
+    uint8_t * Reserve(size_t len);
+
     /// Number of bytes required to satisfy all calls to Put() so far
     size_t Needed() const { return mNeeded; }
 
@@ -96,6 +102,19 @@ public:
     Derived & Put32(uint32_t x) { return static_cast<Derived *>(this)->EndianPut(x, sizeof(x)); }
     Derived & Put64(uint64_t x) { return static_cast<Derived *>(this)->EndianPut(x, sizeof(x)); }
 
+    /// Write a fixed sequence of unsigned integers, with a single bounds check for all of them. If they do not all fit,
+    /// none is written and the input is left as not fitting.
+    template <typename... Fields>
+    Derived & PutFixed(Fields... values)
+    {
+        uint8_t * p = Reserve(FixedLayout<Fields...>::kSize);
+        if (p != nullptr)
+        {
+            detail::WriteFields<typename Derived::FieldCodec>(p, values...);
+        }
+        return static_cast<Derived &>(*this);
+    }
+
 protected:
     EndianBufferWriterBase(uint8_t * buf, size_t len) : BufferWriter(buf, len) {}
     EndianBufferWriterBase(const EndianBufferWriterBase & other) = default;
@@ -111,6 +130,8 @@ public:
     BufferWriter(const BufferWriter & other) = default;
     BufferWriter & operator=(const BufferWriter & other) = default;
     BufferWriter & EndianPut(uint64_t x, size_t size);
+
+    using FieldCodec = LittleEndian::FieldCodec;
 };
 
 } // namespace LittleEndian
@@ -124,6 +145,8 @@ public:
     BufferWriter(const BufferWriter & other) = default;
     BufferWriter & operator=(const BufferWriter & other) = default;
     BufferWriter & EndianPut(uint64_t x, size_t size);
+
+    using FieldCodec = BigEndian::FieldCodec;
 };
 
 } // namespace BigEndian
@@ -17,23 +17,74 @@
 
 #include "BytesToHex.h"
 
+#include <support/SimdSupport.h>
+
 namespace chip {
 namespace Encoding {
 
 namespace {
 
-char NibbleToHex(uint8_t nibble, bool uppercase)
+constexpr char kUppercaseDigits[] = "0123456789ABCDEF";
+constexpr char kLowercaseDigits[] = "0123456789abcdef";
+
+#if CHIP_SIMD_SSSE3
+
+// Converts 16 bytes to 32 hex digits at a time. Returns the number of bytes converted.
+CHIP_SIMD_TARGET_SSSE3 size_t BytesToHexSSSE3(const uint8_t * src, size_t size, char * dest, const char * digits)
 {
-    char x = static_cast<char>(nibble & 0xFu);
+    const __m128i lut  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(digits));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t done        = 0;
 
-    if (x >= 10)
+    for (; done + 16 <= size; done += 16, dest += 32)
     {
-        return static_cast<char>((x - 10) + (uppercase ? 'A' : 'a'));
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + done));
+        __m128i high  = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        __m128i low   = _mm_shuffle_epi8(lut, _mm_and_si128(bytes, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 16), _mm_unpackhi_epi8(high, low));
     }
-    else
+
+    return done;
+}
+
+#endif // CHIP_SIMD_SSSE3
+
+#if CHIP_SIMD_NEON
+
+// Converts 16 bytes to 32 hex digits at a time. Returns the number of bytes converted.
+size_t BytesToHexNEON(const uint8_t * src, size_t size, char * dest, const char * digits)
+{
+    const uint8x16_t lut = vld1q_u8(reinterpret_cast<const uint8_t *>(digits));
+    size_t done          = 0;
+
+    for (; done + 16 <= size; done += 16, dest += 32)
     {
-        return static_cast<char>(x + '0');
+        uint8x16_t bytes = vld1q_u8(src + done);
+        uint8x16x2_t hex;
+
+        hex.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(bytes, 4));
+        hex.val[1] = vqtbl1q_u8(lut, vandq_u8(bytes, vdupq_n_u8(0x0F)));
+        vst2q_u8(reinterpret_cast<uint8_t *>(dest), hex);
     }
+
+    return done;
+}
+
+#endif // CHIP_SIMD_NEON
+
+// Converts the leading whole blocks of src with the vector code, if any. Returns the number of bytes converted.
+size_t BytesToHexBlocks(const uint8_t * src, size_t size, char * dest, const char * digits)
+{
+#if CHIP_SIMD_NEON
+    return BytesToHexNEON(src, size, dest, digits);
+#else
+#if CHIP_SIMD_SSSE3
+    if (Simd::HasSSSE3())
+        return BytesToHexSSSE3(src, size, dest, digits);
+#endif
+    return 0;
+#endif
 }
 
 } // namespace
@@ -59,12 +110,13 @@ CHIP_ERROR BytesToHex(const uint8_t * src_bytes, size_t src_size, char * dest_he
         return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
 
-    bool uppercase = flags.Has(HexFlags::kUppercase);
-    char * cursor  = dest_hex;
-    for (size_t byte_idx = 0; byte_idx < src_size; ++byte_idx)
+    const char * digits = flags.Has(HexFlags::kUppercase) ? kUppercaseDigits : kLowercaseDigits;
+    size_t byte_idx     = BytesToHexBlocks(src_bytes, src_size, dest_hex, digits);
+    char * cursor       = dest_hex + (byte_idx * 2u);
+    for (; byte_idx < src_size; ++byte_idx)
     {
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 4) & 0xFu, uppercase);
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 0) & 0xFu, uppercase);
+        *cursor++ = digits[(src_bytes[byte_idx] >> 4) & 0xFu];
+        *cursor++ = digits[(src_bytes[byte_idx] >> 0) & 0xFu];
     }
 
     if (nul_terminate)
@@ -25,6 +25,8 @@
 
 #include <core/CHIPConfig.h>
 #include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/MallocCache.h>
 
 #include <stdlib.h>
 
@@ -74,6 +76,55 @@ static void VerifyInitialized(const char * func)
 
 #endif
 
+namespace {
+
+MallocHooks gHooks = { malloc, calloc, realloc, free };
+bool gHooksLocked  = false;
+
+#if CHIP_CONFIG_MEMORY_MALLOC_STATS
+MallocCounters gCounters;
+#define COUNT(counter) MallocCounters::Increment(gCounters.counter)
+#define COUNT_ALLOCATION(p, size) gCounters.CountAllocation((p), (size))
+#else
+#define COUNT(counter)
+#define COUNT_ALLOCATION(p, size)
+#endif // CHIP_CONFIG_MEMORY_MALLOC_STATS
+
+#if CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+using ThreadCache = MallocCache<CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE_DEPTH>;
+
+ThreadCache & GetThreadCache()
+{
+#if CHIP_CONFIG_MEMORY_MALLOC_STATS
+    thread_local ThreadCache tCache(gHooks, &gCounters);
+#else
+    thread_local ThreadCache tCache(gHooks, nullptr);
+#endif // CHIP_CONFIG_MEMORY_MALLOC_STATS
+    return tCache;
+}
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+
+} // namespace
+
+CHIP_ERROR MemorySetMallocHooks(const MallocHooks & hooks)
+{
+    VerifyOrReturnError(hooks.mAlloc != nullptr && hooks.mCalloc != nullptr && hooks.mRealloc != nullptr && hooks.mFree != nullptr,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!gHooksLocked, CHIP_ERROR_INCORRECT_STATE);
+    gHooks = hooks;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MemoryGetMallocStats(MallocStats & stats)
+{
+#if CHIP_CONFIG_MEMORY_MALLOC_STATS
+    gCounters.GetStats(stats);
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_CONFIG_MEMORY_MALLOC_STATS
+}
+
 CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
 {
 #ifndef NDEBUG
@@ -83,6 +134,7 @@ CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
         abort();
     }
 #endif
+    gHooksLocked = true;
     return CHIP_NO_ERROR;
 }
 
@@ -95,6 +147,11 @@ void MemoryAllocatorShutdown()
         abort();
     }
 #endif
+#if CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    // The caches of the other threads are cleared when they exit
+    GetThreadCache().Clear();
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    gHooksLocked = false;
 #if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
     dmalloc_shutdown();
 #endif // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
@@ -103,32 +160,73 @@ void MemoryAllocatorShutdown()
 void * MemoryAlloc(size_t size)
 {
     VERIFY_INITIALIZED();
-    return malloc(size);
+#if CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    void * p = GetThreadCache().Alloc(size);
+#else
+    void * p = gHooks.mAlloc(size);
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    COUNT_ALLOCATION(p, size);
+    return p;
 }
 
 void * MemoryCalloc(size_t num, size_t size)
 {
     VERIFY_INITIALIZED();
-    return calloc(num, size);
+#if CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    void * p = GetThreadCache().Calloc(num, size);
+#else
+    void * p = gHooks.mCalloc(num, size);
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    COUNT_ALLOCATION(p, num * size);
+    return p;
 }
 
 void * MemoryRealloc(void * p, size_t size)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
-    return realloc(p, size);
+#if CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    void * result = GetThreadCache().Realloc(p, size);
+#else
+    void * result = gHooks.mRealloc(p, size);
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+#if CHIP_CONFIG_MEMORY_MALLOC_STATS
+    if (p == nullptr || result == nullptr)
+    {
+        COUNT_ALLOCATION(result, size);
+    }
+    else
+    {
+        COUNT(mNumReallocations);
+    }
+#endif // CHIP_CONFIG_MEMORY_MALLOC_STATS
+    return result;
 }
 
 void MemoryFree(void * p)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
-    free(p);
+#if CHIP_CONFIG_MEMORY_MALLOC_STATS
+    if (p != nullptr)
+    {
+        COUNT(mNumFrees);
+    }
+#endif // CHIP_CONFIG_MEMORY_MALLOC_STATS
+#if CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    GetThreadCache().Free(p);
+#else
+    gHooks.mFree(p);
+#endif // CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
 }
 
 bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 {
-#if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
+#if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC && CHIP_CONFIG_MEMORY_MALLOC_THREAD_CACHE
+    return CanCastTo<int>(ThreadCache::BlockSize(min_size)) && (p != nullptr) &&
+        (dmalloc_verify_pnt(__FILE__, __LINE__, __func__, ThreadCache::GetAllocation(p), 1,
+                            static_cast<int>(ThreadCache::BlockSize(min_size))) == MALLOC_VERIFY_NOERROR);
+#elif CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
     return CanCastTo<int>(min_size) && (p != nullptr) &&
         (dmalloc_verify_pnt(__FILE__, __LINE__, __func__, p, 1, static_cast<int>(min_size)) == MALLOC_VERIFY_NOERROR);
 #else  // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
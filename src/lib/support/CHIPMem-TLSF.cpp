@@ -0,0 +1,163 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the CHIP allocation API over a TLSF heap
+ *      in a dedicated buffer, with O(1) allocation and release.
+ */
+
+#include "CHIPMem.h"
+#include "TlsfHeap.h"
+
+#include <string.h>
+
+#include <support/CodeUtils.h>
+#include <system/SystemMutex.h>
+
+namespace chip {
+namespace Platform {
+
+namespace {
+
+TlsfHeap gHeap;
+bool gHeapInitialized = false;
+
+#if CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+class HeapLocked
+{
+public:
+    HeapLocked() {}
+    ~HeapLocked() {}
+};
+
+#else
+
+chip::System::Mutex gHeapLock;
+
+class HeapLocked
+{
+public:
+    HeapLocked() { gHeapLock.Lock(); }
+    ~HeapLocked() { gHeapLock.Unlock(); }
+};
+#endif
+
+} // namespace
+
+CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
+{
+    ReturnErrorCodeIf(buf == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorCodeIf(gHeapInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    gHeap.Init(buf, bufSize);
+
+    TlsfHeap::Stats stats;
+    gHeap.GetStats(stats);
+    ReturnErrorCodeIf(stats.mHeapSize == 0, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    gHeapInitialized = true;
+
+#if CHIP_SYSTEM_CONFIG_NO_LOCKING
+    return CHIP_NO_ERROR;
+#else
+    return chip::System::Mutex::Init(gHeapLock);
+#endif
+}
+
+void MemoryAllocatorShutdown()
+{
+    gHeapInitialized = false;
+}
+
+void * MemoryAlloc(size_t size)
+{
+    HeapLocked lock;
+
+    if (!gHeapInitialized)
+    {
+        return nullptr;
+    }
+
+    return gHeap.Alloc(size, static_cast<uint8_t>(GetCurrentMemoryTag()));
+}
+
+void * MemoryCalloc(size_t num, size_t size)
+{
+    size_t total = num * size;
+
+    // check for multiplication overflow
+    if (num != 0 && size != total / num)
+    {
+        return nullptr;
+    }
+
+    void * result = MemoryAlloc(total);
+    if (result != nullptr)
+    {
+        memset(result, 0, total);
+    }
+    return result;
+}
+
+void * MemoryRealloc(void * p, size_t size)
+{
+    HeapLocked lock;
+
+    if (!gHeapInitialized)
+    {
+        return nullptr;
+    }
+
+    if (p == nullptr)
+    {
+        return gHeap.Alloc(size, static_cast<uint8_t>(GetCurrentMemoryTag()));
+    }
+
+    return gHeap.Realloc(p, size);
+}
+
+void MemoryFree(void * p)
+{
+    HeapLocked lock;
+
+    if (!gHeapInitialized)
+    {
+        return;
+    }
+    gHeap.Free(p);
+}
+
+bool MemoryInternalCheckPointer(const void * p, size_t min_size)
+{
+    HeapLocked lock;
+
+    return gHeapInitialized && gHeap.IsAllocated(p, min_size);
+}
+
+CHIP_ERROR MemoryGetHeapStats(TlsfHeap::Stats & stats)
+{
+    HeapLocked lock;
+
+    ReturnErrorCodeIf(!gHeapInitialized, CHIP_ERROR_INCORRECT_STATE);
+    gHeap.GetStats(stats);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Platform
+} // namespace chip
@@ -38,6 +38,10 @@ extern void MemoryAllocatorShutdown();
 
 static std::atomic_int memoryInitializationCount{ 0 };
 
+#if CHIP_CONFIG_MEMORY_TAGS
+MemoryTag ScopedMemoryTag::sCurrentTag = MemoryTag::kUntagged;
+#endif // CHIP_CONFIG_MEMORY_TAGS
+
 CHIP_ERROR MemoryInit(void * buf, size_t bufSize)
 {
     if (memoryInitializationCount++ > 0)
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <core/CHIPError.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include <new>
@@ -129,6 +130,68 @@ extern void * MemoryRealloc(void * p, size_t size);
  */
 extern void MemoryFree(void * p);
 
+/**
+ * The subsystems that heap allocations can be attributed to, see ScopedMemoryTag.
+ */
+enum class MemoryTag : uint8_t
+{
+    kUntagged = 0,
+    kSystem,
+    kInet,
+    kTransport,
+    kSecureChannel,
+    kMessaging,
+    kCrypto,
+    kInteractionModel,
+    kDataModel,
+    kController,
+    kApplication,
+
+    kNumTags
+};
+
+/**
+ * @return The tag of the allocations made at this point, kUntagged unless configured with #CHIP_CONFIG_MEMORY_TAGS.
+ */
+inline MemoryTag GetCurrentMemoryTag();
+
+/**
+ * Attributes the allocations made during its lifetime to a subsystem, in the heap statistics of the memory management
+ * backends that keep them (tlsf). Scopes nest, and do nothing unless configured with #CHIP_CONFIG_MEMORY_TAGS.
+ *
+ * The current tag is global rather than per thread, so it is meant to be set on the thread running the CHIP stack.
+ */
+class ScopedMemoryTag
+{
+public:
+#if CHIP_CONFIG_MEMORY_TAGS
+    explicit ScopedMemoryTag(MemoryTag tag) : mPrevious(sCurrentTag) { sCurrentTag = tag; }
+    ~ScopedMemoryTag() { sCurrentTag = mPrevious; }
+#else
+    explicit ScopedMemoryTag(MemoryTag) {}
+#endif // CHIP_CONFIG_MEMORY_TAGS
+
+    ScopedMemoryTag(const ScopedMemoryTag &) = delete;
+    ScopedMemoryTag & operator=(const ScopedMemoryTag &) = delete;
+
+private:
+    friend MemoryTag GetCurrentMemoryTag();
+
+#if CHIP_CONFIG_MEMORY_TAGS
+    static MemoryTag sCurrentTag;
+    MemoryTag mPrevious;
+#endif // CHIP_CONFIG_MEMORY_TAGS
+};
+
+inline MemoryTag GetCurrentMemoryTag()
+{
+#if CHIP_CONFIG_MEMORY_TAGS
+    return ScopedMemoryTag::sCurrentTag;
+#else
+    return MemoryTag::kUntagged;
+#endif // CHIP_CONFIG_MEMORY_TAGS
+}
+
 /**
  * This function wraps the operator `new` with placement-new using MemoryAlloc().
  * Instead of
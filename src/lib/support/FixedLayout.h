@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Serialisation of fixed sequences of integer fields, such as protocol headers, with one bounds check for the whole
+ *    sequence rather than one per field.
+ */
+
+#pragma once
+
+#include <core/CHIPEncoding.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+namespace Encoding {
+
+/**
+ * The layout of a fixed sequence of unsigned integer fields, e.g. FixedLayout<uint8_t, uint8_t, uint16_t>. kSize is the
+ * number of bytes they take, as a constant expression, so a whole sequence can be bounds checked at once and then read or
+ * written with straight-line unaligned loads and stores.
+ */
+template <typename... Fields>
+struct FixedLayout;
+
+template <>
+struct FixedLayout<>
+{
+    static constexpr size_t kSize = 0;
+};
+
+template <typename Field, typename... Rest>
+struct FixedLayout<Field, Rest...>
+{
+    static_assert(std::is_unsigned<Field>::value && (sizeof(Field) == 1 || sizeof(Field) == 2 || sizeof(Field) == 4 ||
+                                                     sizeof(Field) == 8),
+                  "fields of a fixed layout are unsigned integers of 8, 16, 32 or 64 bits");
+
+    static constexpr size_t kSize = sizeof(Field) + FixedLayout<Rest...>::kSize;
+};
+
+namespace detail {
+
+// Codec is one of LittleEndian::FieldCodec or BigEndian::FieldCodec below.
+
+template <class Codec>
+inline void WriteFields(uint8_t *& p)
+{}
+
+template <class Codec, typename Field, typename... Rest>
+inline void WriteFields(uint8_t *& p, Field value, Rest... rest)
+{
+    Codec::Write(p, value);
+    WriteFields<Codec>(p, rest...);
+}
+
+template <class Codec>
+inline void ReadFields(const uint8_t *& p)
+{}
+
+template <class Codec, typename Field, typename... Rest>
+inline void ReadFields(const uint8_t *& p, Field * dest, Rest *... rest)
+{
+    Codec::Read(p, *dest);
+    ReadFields<Codec>(p, rest...);
+}
+
+} // namespace detail
+
+namespace LittleEndian {
+
+struct FieldCodec
+{
+    static void Write(uint8_t *& p, uint8_t v) { Write8(p, v); }
+    static void Write(uint8_t *& p, uint16_t v) { Write16(p, v); }
+    static void Write(uint8_t *& p, uint32_t v) { Write32(p, v); }
+    static void Write(uint8_t *& p, uint64_t v) { Write64(p, v); }
+
+    static void Read(const uint8_t *& p, uint8_t & v) { v = Read8(p); }
+    static void Read(const uint8_t *& p, uint16_t & v) { v = Read16(p); }
+    static void Read(const uint8_t *& p, uint32_t & v) { v = Read32(p); }
+    static void Read(const uint8_t *& p, uint64_t & v) { v = Read64(p); }
+};
+
+/**
+ * Write the fields in little-endian byte order at p, and advance p past them. The caller has checked that
+ * FixedLayout<Fields...>::kSize bytes are available.
+ */
+template <typename... Fields>
+inline void WriteFixed(uint8_t *& p, Fields... values)
+{
+    static_assert(FixedLayout<Fields...>::kSize > 0, "a fixed layout has fields");
+    detail::WriteFields<FieldCodec>(p, values...);
+}
+
+/**
+ * Read the fields in little-endian byte order from p, and advance p past them. The caller has checked that
+ * FixedLayout<Fields...>::kSize bytes are available.
+ */
+template <typename... Fields>
+inline void ReadFixed(const uint8_t *& p, Fields *... dests)
+{
+    static_assert(FixedLayout<Fields...>::kSize > 0, "a fixed layout has fields");
+    detail::ReadFields<FieldCodec>(p, dests...);
+}
+
+} // namespace LittleEndian
+
+namespace BigEndian {
+
+struct FieldCodec
+{
+    static void Write(uint8_t *& p, uint8_t v) { Write8(p, v); }
+    static void Write(uint8_t *& p, uint16_t v) { Write16(p, v); }
+    static void Write(uint8_t *& p, uint32_t v) { Write32(p, v); }
+    static void Write(uint8_t *& p, uint64_t v) { Write64(p, v); }
+
+    static void Read(const uint8_t *& p, uint8_t & v) { v = Read8(p); }
+    static void Read(const uint8_t *& p, uint16_t & v) { v = Read16(p); }
+    static void Read(const uint8_t *& p, uint32_t & v) { v = Read32(p); }
+    static void Read(const uint8_t *& p, uint64_t & v) { v = Read64(p); }
+};
+
+/**
+ * Write the fields in big-endian byte order at p, and advance p past them. The caller has checked that
+ * FixedLayout<Fields...>::kSize bytes are available.
+ */
+template <typename... Fields>
+inline void WriteFixed(uint8_t *& p, Fields... values)
+{
+    static_assert(FixedLayout<Fields...>::kSize > 0, "a fixed layout has fields");
+    detail::WriteFields<FieldCodec>(p, values...);
+}
+
+/**
+ * Read the fields in big-endian byte order from p, and advance p past them. The caller has checked that
+ * FixedLayout<Fields...>::kSize bytes are available.
+ */
+template <typename... Fields>
+inline void ReadFixed(const uint8_t *& p, Fields *... dests)
+{
+    static_assert(FixedLayout<Fields...>::kSize > 0, "a fixed layout has fields");
+    detail::ReadFields<FieldCodec>(p, dests...);
+}
+
+} // namespace BigEndian
+
+} // namespace Encoding
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines InlineCallable, a move-only callable wrapper that never
+ *      allocates.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+
+template <typename Signature, size_t kStorageSize = CHIP_CONFIG_INLINE_CALLABLE_STORAGE_SIZE>
+class InlineCallable;
+
+/**
+ * Holds a callable, such as a lambda with its captures, in a buffer of kStorageSize bytes inside the object, where
+ * std::function would allocate the ones that do not fit in its own small buffer. A callable too large for the buffer fails
+ * to compile rather than going to the heap.
+ *
+ * An InlineCallable can be moved but not copied, so it holds callables that are themselves move-only, and it is meant for
+ * handlers that have a single owner, such as the callbacks of a response.
+ */
+template <typename R, typename... Args, size_t kStorageSize>
+class InlineCallable<R(Args...), kStorageSize>
+{
+public:
+    InlineCallable() = default;
+    InlineCallable(std::nullptr_t) {}
+
+    template <typename F, typename Callable = typename std::decay<F>::type,
+              typename = typename std::enable_if<!std::is_same<Callable, InlineCallable>::value>::type>
+    InlineCallable(F && f)
+    {
+        static_assert(sizeof(Callable) <= kStorageSize, "The callable does not fit in the storage of the InlineCallable");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "The callable is overaligned for the InlineCallable");
+
+        new (mStorage) Callable(std::forward<F>(f));
+        mOps = &Ops<Callable>::kOps;
+    }
+
+    InlineCallable(InlineCallable && other) { MoveFrom(other); }
+
+    InlineCallable & operator=(InlineCallable && other)
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineCallable(const InlineCallable &) = delete;
+    InlineCallable & operator=(const InlineCallable &) = delete;
+
+    ~InlineCallable() { Reset(); }
+
+    explicit operator bool() const { return mOps != nullptr; }
+
+    /**
+     * Call the callable, which must be set.
+     */
+    R operator()(Args... args)
+    {
+        VerifyOrDie(mOps != nullptr);
+        return mOps->mInvoke(mStorage, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Destroy the callable, leaving the InlineCallable empty.
+     */
+    void Reset()
+    {
+        if (mOps != nullptr)
+        {
+            mOps->mDestroy(mStorage);
+            mOps = nullptr;
+        }
+    }
+
+private:
+    struct Operations
+    {
+        R (*mInvoke)(void * storage, Args &&... args);
+        void (*mMove)(void * to, void * from); // Leaves from destroyed
+        void (*mDestroy)(void * storage);
+    };
+
+    template <typename Callable>
+    struct Ops
+    {
+        static R Invoke(void * storage, Args &&... args)
+        {
+            return (*static_cast<Callable *>(storage))(std::forward<Args>(args)...);
+        }
+
+        static void Move(void * to, void * from)
+        {
+            new (to) Callable(std::move(*static_cast<Callable *>(from)));
+            Destroy(from);
+        }
+
+        static void Destroy(void * storage) { static_cast<Callable *>(storage)->~Callable(); }
+
+        static const Operations kOps;
+    };
+
+    void MoveFrom(InlineCallable & other)
+    {
+        if (other.mOps != nullptr)
+        {
+            other.mOps->mMove(mStorage, other.mStorage);
+            mOps       = other.mOps;
+            other.mOps = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) uint8_t mStorage[kStorageSize];
+    const Operations * mOps = nullptr;
+};
+
+template <typename R, typename... Args, size_t kStorageSize>
+template <typename Callable>
+const typename InlineCallable<R(Args...), kStorageSize>::Operations
+    InlineCallable<R(Args...), kStorageSize>::Ops<Callable>::kOps = { Invoke, Move, Destroy };
+
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a bounded queue that any number of threads can push into
+ *      and pop from without a lock.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * A bounded FIFO queue of N values of type T, that is lock-free for any number of producers and consumers. Every slot has a
+ * sequence number telling whether it is ready to be written or read at a position, so that producers and consumers only
+ * contend on the positions they claim.
+ *
+ * The values are copied in and out, so T is best kept small and trivially copyable.
+ */
+template <typename T, size_t N>
+class LockFreeQueue
+{
+public:
+    static_assert(N > 0 && (N & (N - 1)) == 0, "The capacity must be a power of two");
+
+    LockFreeQueue()
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeQueue(const LockFreeQueue &) = delete;
+    LockFreeQueue & operator=(const LockFreeQueue &) = delete;
+
+    /**
+     * Add a value at the back of the queue.
+     *
+     * @return false if the queue is full.
+     */
+    bool Push(const T & value)
+    {
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+        Slot * slot;
+
+        for (;;)
+        {
+            slot         = &mSlots[pos & (N - 1)];
+            size_t seq   = slot->mSequence.load(std::memory_order_acquire);
+            intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (dif == 0)
+            {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (dif < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->mValue = value;
+        slot->mSequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Take the value at the front of the queue.
+     *
+     * @return false if the queue is empty, or the value at the front is still being pushed.
+     */
+    bool Pop(T & value)
+    {
+        size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+        Slot * slot;
+
+        for (;;)
+        {
+            slot         = &mSlots[pos & (N - 1)];
+            size_t seq   = slot->mSequence.load(std::memory_order_acquire);
+            intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (dif == 0)
+            {
+                if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (dif < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = mDequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        value = slot->mValue;
+        slot->mSequence.store(pos + N, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * The number of values in the queue, which may be changing.
+     */
+    size_t GetCount() const
+    {
+        // The dequeue position never passes the enqueue position loaded after it
+        size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+        return mEnqueuePos.load(std::memory_order_relaxed) - dequeuePos;
+    }
+
+    static constexpr size_t Capacity() { return N; }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        T mValue;
+    };
+
+    Slot mSlots[N];
+    std::atomic<size_t> mEnqueuePos{ 0 };
+    std::atomic<size_t> mDequeuePos{ 0 };
+};
+
+} // namespace chip
@@ -0,0 +1,349 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines the allocator hooks, allocation counters and per-thread
+ *      block cache of the malloc memory management backend.
+ */
+
+#pragma once
+
+#include <core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace chip {
+namespace Platform {
+
+/**
+ * The allocator the malloc memory management backend forwards to, malloc(), calloc(), realloc() and free() by default.
+ * Set it to the functions of another allocator, such as jemalloc or mimalloc, or to wrappers allocating from one of its
+ * arenas.
+ */
+struct MallocHooks
+{
+    void * (*mAlloc)(size_t size);
+    void * (*mCalloc)(size_t num, size_t size);
+    void * (*mRealloc)(void * p, size_t size);
+    void (*mFree)(void * p);
+};
+
+/**
+ * Sizes of the allocations counted by MallocStats::mNumAllocationsBySize, and cached by MallocCache: powers of two from
+ * kMallocSmallestSizeClass to kMallocLargestSizeClass.
+ */
+constexpr size_t kMallocSizeClassCount    = 6;
+constexpr size_t kMallocSmallestSizeClass = 64;
+constexpr size_t kMallocLargestSizeClass  = kMallocSmallestSizeClass << (kMallocSizeClassCount - 1);
+
+/**
+ * @return The index of the smallest size class holding size bytes, or kMallocSizeClassCount if size is larger than all of
+ *         them.
+ */
+inline size_t MallocSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    for (size_t classSize = kMallocSmallestSizeClass; sizeClass < kMallocSizeClassCount && size > classSize; classSize <<= 1)
+    {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+struct MallocStats
+{
+    size_t mNumAllocations;        ///< Successful allocations, reallocations of a null pointer included
+    size_t mNumReallocations;      ///< Successful reallocations of an allocated block
+    size_t mNumFrees;              ///< Blocks freed, null pointers excluded
+    size_t mNumFailedAllocations;  ///< Allocations and reallocations that failed
+    size_t mNumCacheHits;          ///< Allocations served from a thread cache
+    size_t mNumCacheMisses;        ///< Allocations of a cached size that the thread cache was out of
+    size_t mNumAllocationsBySize[kMallocSizeClassCount + 1]; ///< mNumAllocations by size class, the last one for larger sizes
+
+    size_t GetLiveAllocations() const { return mNumAllocations - mNumFrees; }
+};
+
+/**
+ * The counters behind MallocStats. They are atomic, so that every thread updates the same ones.
+ */
+struct MallocCounters
+{
+    std::atomic<size_t> mNumAllocations{ 0 };
+    std::atomic<size_t> mNumReallocations{ 0 };
+    std::atomic<size_t> mNumFrees{ 0 };
+    std::atomic<size_t> mNumFailedAllocations{ 0 };
+    std::atomic<size_t> mNumCacheHits{ 0 };
+    std::atomic<size_t> mNumCacheMisses{ 0 };
+    std::atomic<size_t> mNumAllocationsBySize[kMallocSizeClassCount + 1] = {};
+
+    static void Increment(std::atomic<size_t> & counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+
+    void CountAllocation(const void * p, size_t size)
+    {
+        if (p == nullptr)
+        {
+            Increment(mNumFailedAllocations);
+            return;
+        }
+        Increment(mNumAllocations);
+        Increment(mNumAllocationsBySize[MallocSizeClass(size)]);
+    }
+
+    void GetStats(MallocStats & stats) const
+    {
+        stats.mNumAllocations       = mNumAllocations.load(std::memory_order_relaxed);
+        stats.mNumReallocations     = mNumReallocations.load(std::memory_order_relaxed);
+        stats.mNumFrees             = mNumFrees.load(std::memory_order_relaxed);
+        stats.mNumFailedAllocations = mNumFailedAllocations.load(std::memory_order_relaxed);
+        stats.mNumCacheHits         = mNumCacheHits.load(std::memory_order_relaxed);
+        stats.mNumCacheMisses       = mNumCacheMisses.load(std::memory_order_relaxed);
+        for (size_t i = 0; i <= kMallocSizeClassCount; i++)
+        {
+            stats.mNumAllocationsBySize[i] = mNumAllocationsBySize[i].load(std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * A cache of free blocks, holding up to kDepth blocks of each size class, so that the small blocks a thread keeps
+ * allocating and freeing are reused without going through the allocator. Every block starts with a header recording its
+ * size class, so blocks can be freed to the cache of any thread. Larger blocks go to the allocator unchanged, behind the
+ * same header.
+ *
+ * A cache is used by a single thread, the blocks it holds are returned to the allocator when it is destroyed.
+ */
+template <size_t kDepth>
+class MallocCache
+{
+public:
+    static_assert(kDepth > 0, "The cache cannot be empty");
+
+    /**
+     * @param hooks     The allocator of the blocks, which must outlive the cache.
+     * @param counters  The counters to count cache hits and misses in, or nullptr.
+     */
+    MallocCache(const MallocHooks & hooks, MallocCounters * counters) : mHooks(hooks), mCounters(counters) {}
+    ~MallocCache() { Clear(); }
+
+    MallocCache(const MallocCache &) = delete;
+    MallocCache & operator=(const MallocCache &) = delete;
+
+    void * Alloc(size_t size)
+    {
+        const size_t sizeClass = MallocSizeClass(size);
+        if (sizeClass == kMallocSizeClassCount)
+        {
+            return AllocUncached(mHooks.mAlloc(BlockSize(size)), size);
+        }
+
+        Magazine & magazine = mMagazines[sizeClass];
+        if (magazine.mCount > 0)
+        {
+            Count(&MallocCounters::mNumCacheHits);
+            return Payload(magazine.mBlocks[--magazine.mCount]);
+        }
+
+        Count(&MallocCounters::mNumCacheMisses);
+        Header * header = static_cast<Header *>(mHooks.mAlloc(BlockSize(kMallocSmallestSizeClass << sizeClass)));
+        if (header == nullptr)
+        {
+            return nullptr;
+        }
+        header->mSizeClass = sizeClass;
+        return Payload(header);
+    }
+
+    void * Calloc(size_t num, size_t size)
+    {
+        const size_t total = num * size;
+
+        // check for multiplication overflow
+        if (num != 0 && size != total / num)
+        {
+            return nullptr;
+        }
+
+        // Large blocks are left to the allocator to clear, since it can often get them cleared already
+        if (MallocSizeClass(total) == kMallocSizeClassCount)
+        {
+            return AllocUncached(total > SIZE_MAX - sizeof(Header) ? nullptr : mHooks.mCalloc(1, BlockSize(total)), total);
+        }
+
+        void * p = Alloc(total);
+        if (p != nullptr)
+        {
+            memset(p, 0, total);
+        }
+        return p;
+    }
+
+    void * Realloc(void * p, size_t size)
+    {
+        if (p == nullptr)
+        {
+            return Alloc(size);
+        }
+
+        Header * header = FromPayload(p);
+        size_t usable;
+        if (header->mSizeClass == kMallocSizeClassCount)
+        {
+            if (MallocSizeClass(size) == kMallocSizeClassCount)
+            {
+                return AllocUncached(size > SIZE_MAX - sizeof(Header) ? nullptr : mHooks.mRealloc(header, BlockSize(size)),
+                                     size);
+            }
+            usable = header->mSize;
+        }
+        else
+        {
+            usable = kMallocSmallestSizeClass << header->mSizeClass;
+            if (size <= usable)
+            {
+                return p;
+            }
+        }
+
+        void * moved = Alloc(size);
+        if (moved != nullptr)
+        {
+            memcpy(moved, p, usable < size ? usable : size);
+            Free(p);
+        }
+        return moved;
+    }
+
+    void Free(void * p)
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+
+        Header * header = FromPayload(p);
+        if (header->mSizeClass < kMallocSizeClassCount)
+        {
+            Magazine & magazine = mMagazines[header->mSizeClass];
+            if (magazine.mCount < kDepth)
+            {
+                magazine.mBlocks[magazine.mCount++] = header;
+                return;
+            }
+        }
+        mHooks.mFree(header);
+    }
+
+    /**
+     * Return every cached block to the allocator.
+     */
+    void Clear()
+    {
+        for (Magazine & magazine : mMagazines)
+        {
+            while (magazine.mCount > 0)
+            {
+                mHooks.mFree(magazine.mBlocks[--magazine.mCount]);
+            }
+        }
+    }
+
+    /**
+     * @return The number of free blocks cached for sizeClass.
+     */
+    size_t GetCachedCount(size_t sizeClass) const { return mMagazines[sizeClass].mCount; }
+
+    /**
+     * @return The start of the underlying allocation of p, a block of this cache.
+     */
+    static const void * GetAllocation(const void * p) { return static_cast<const uint8_t *>(p) - sizeof(Header); }
+
+    /**
+     * The bytes an allocation of size bytes takes from the allocator.
+     */
+    static size_t BlockSize(size_t size) { return sizeof(Header) + size; }
+
+private:
+    struct alignas(std::max_align_t) Header
+    {
+        size_t mSizeClass;
+        size_t mSize; // Only set for the blocks larger than the size classes
+    };
+
+    struct Magazine
+    {
+        Header * mBlocks[kDepth];
+        size_t mCount = 0;
+    };
+
+    static void * Payload(Header * header) { return header + 1; }
+    static Header * FromPayload(void * p) { return static_cast<Header *>(p) - 1; }
+
+    void * AllocUncached(void * block, size_t size)
+    {
+        Header * header = static_cast<Header *>(block);
+        if (header == nullptr)
+        {
+            return nullptr;
+        }
+        header->mSizeClass = kMallocSizeClassCount;
+        header->mSize      = size;
+        return Payload(header);
+    }
+
+    void Count(std::atomic<size_t> MallocCounters::*counter)
+    {
+        if (mCounters != nullptr)
+        {
+            MallocCounters::Increment(mCounters->*counter);
+        }
+    }
+
+    const MallocHooks & mHooks;
+    MallocCounters * mCounters;
+    Magazine mMagazines[kMallocSizeClassCount];
+};
+
+/**
+ * Forward the allocations of the malloc memory management backend to hooks instead of the C library. This must be done
+ * before MemoryInit(), with no block allocated by the previous hooks left.
+ *
+ * @retval #CHIP_ERROR_INVALID_ARGUMENT  If one of the hooks is null.
+ * @retval #CHIP_ERROR_INCORRECT_STATE   If the memory is initialized.
+ * @retval #CHIP_NO_ERROR                On success.
+ *
+ * @note Provided by the malloc memory management backend only.
+ */
+CHIP_ERROR MemorySetMallocHooks(const MallocHooks & hooks);
+
+/**
+ * Read the allocation counters of the malloc memory management backend.
+ *
+ * @retval #CHIP_ERROR_NOT_IMPLEMENTED  Unless configured with #CHIP_CONFIG_MEMORY_MALLOC_STATS.
+ * @retval #CHIP_NO_ERROR               On success.
+ *
+ * @note Provided by the malloc memory management backend only.
+ */
+CHIP_ERROR MemoryGetMallocStats(MallocStats & stats);
+
+} // namespace Platform
+} // namespace chip
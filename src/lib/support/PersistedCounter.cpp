@@ -27,19 +27,23 @@
 
 namespace chip {
 
-PersistedCounter::PersistedCounter() : mId(chip::Platform::PersistedStorage::kEmptyKey), mEpoch(0), mNextEpoch(0) {}
+PersistedCounter::PersistedCounter() :
+    mId(chip::Platform::PersistedStorage::kEmptyKey), mEpoch(0), mMaxEpoch(0), mNextEpoch(0), mWriteCount(0)
+{}
 
 PersistedCounter::~PersistedCounter() {}
 
 CHIP_ERROR
-PersistedCounter::Init(const chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch)
+PersistedCounter::Init(const chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch, uint32_t aMaxEpoch)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    VerifyOrExit(aEpoch > 0, err = CHIP_ERROR_INVALID_INTEGER_VALUE);
+    VerifyOrExit(aEpoch > 0 && aMaxEpoch >= aEpoch, err = CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     // Store the ID.
-    mId    = aId;
-    mEpoch = aEpoch;
+    mId         = aId;
+    mEpoch      = aEpoch;
+    mMaxEpoch   = aMaxEpoch;
+    mWriteCount = 0;
 
     uint32_t startValue;
 
@@ -74,6 +78,9 @@ PersistedCounter::Advance()
 
     if (GetValue() >= mNextEpoch)
     {
+        // The counter went through a whole epoch since the last write, make the next one last longer.
+        mEpoch = (mEpoch <= mMaxEpoch / 2) ? mEpoch * 2 : mMaxEpoch;
+
         // Value advanced past the previously persisted "start point".
         // Ensure that a new starting point is persisted.
         err = PersistNextEpochStart(mNextEpoch + mEpoch);
@@ -87,10 +94,42 @@ exit:
     return err;
 }
 
+CHIP_ERROR
+PersistedCounter::Reserve(uint32_t aCount, uint32_t & aFirstValue)
+{
+    VerifyOrReturnError(mId != chip::Platform::PersistedStorage::kEmptyKey, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mCounterValue <= UINT32_MAX - mMaxEpoch && aCount <= UINT32_MAX - mMaxEpoch - mCounterValue,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint32_t nextValue = mCounterValue + aCount;
+
+    // Persist the start point past the values taken before handing them out, so that a reboot never vends them again.
+    if (nextValue >= mNextEpoch)
+    {
+        const uint32_t previousEpoch     = mEpoch;
+        const uint32_t previousNextEpoch = mNextEpoch;
+
+        mEpoch         = (mEpoch <= mMaxEpoch / 2) ? mEpoch * 2 : mMaxEpoch;
+        CHIP_ERROR err = PersistNextEpochStart(nextValue + mEpoch);
+        if (err != CHIP_NO_ERROR)
+        {
+            mEpoch     = previousEpoch;
+            mNextEpoch = previousNextEpoch;
+            return err;
+        }
+    }
+
+    aFirstValue   = mCounterValue;
+    mCounterValue = nextValue;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR
 PersistedCounter::PersistNextEpochStart(uint32_t aStartValue)
 {
     mNextEpoch = aStartValue;
+    mWriteCount++;
 #if CHIP_CONFIG_PERSISTED_COUNTER_DEBUG_LOGGING
     ChipLogDetail(EventLogging, "PersistedCounter::WriteStartValue() aStartValue 0x%x", aStartValue);
 #endif
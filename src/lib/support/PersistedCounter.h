@@ -52,6 +52,11 @@ namespace chip {
  *   - Output: 200, 201, 202, ...., 299, 300, 301, 302 <reboot/reinit>
  *   - Output: 400, 401 ...
  *
+ * With a maximum epoch larger than the epoch, the epoch doubles every time
+ * the counter runs through it, up to the maximum epoch, so that busy
+ * counters are written less often. The epoch is back to its initial value
+ * on every Init(): the larger the epoch, the more values a reboot skips.
+ *
  */
 class PersistedCounter : public MonotonicallyIncreasingCounter
 {
@@ -73,7 +78,24 @@ public:
      *          CHIP_ERROR_INVALID_INTEGER_VALUE if aEpoch is 0.
      *          CHIP_NO_ERROR otherwise
      */
-    CHIP_ERROR Init(chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch);
+    CHIP_ERROR Init(chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch) { return Init(aId, aEpoch, aEpoch); }
+
+    /**
+     *  @brief
+     *    Initialize a PersistedCounter object with an epoch that grows.
+     *
+     *  @param[in] aId        The identifier of this PersistedCounter instance.
+     *  @param[in] aEpoch     On bootup, values we vend will start at a
+     *                        multiple of this parameter.
+     *  @param[in] aMaxEpoch  The epoch doubles, up to this value, every time
+     *                        the counter reaches the end of the current one.
+     *
+     *  @return CHIP_ERROR_INVALID_INTEGER_VALUE if aEpoch is 0 or aMaxEpoch is
+     *          less than aEpoch.
+     *          Any error returned by a read or write of persisted storage.
+     *          CHIP_NO_ERROR otherwise
+     */
+    CHIP_ERROR Init(chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch, uint32_t aMaxEpoch);
 
     /**
      *  @brief
@@ -84,6 +106,32 @@ public:
      */
     CHIP_ERROR Advance() override;
 
+    /**
+     *  @brief
+     *    Take aCount consecutive values at once, writing to persisted storage
+     *    at most once. The counter then goes on from the value after them.
+     *
+     *  @param[in]  aCount       The number of values to take.
+     *  @param[out] aFirstValue  The first of the values taken.
+     *
+     *  @return CHIP_ERROR_INVALID_ARGUMENT if the values would wrap around.
+     *          Any error returned by a write to persisted storage, in which
+     *          case the counter is left as it was.
+     */
+    CHIP_ERROR Reserve(uint32_t aCount, uint32_t & aFirstValue);
+
+    /**
+     *  @brief
+     *    The number of values the counter currently vends per write to persisted storage.
+     */
+    uint32_t GetEpoch() const { return mEpoch; }
+
+    /**
+     *  @brief
+     *    The number of writes to persisted storage since Init(), Init() included, to keep track of the wear of the storage.
+     */
+    uint32_t GetWriteCount() const { return mWriteCount; }
+
 private:
     /**
      *  @brief
@@ -107,7 +155,9 @@ private:
 
     chip::Platform::PersistedStorage::Key mId; // start value is stored here
     uint32_t mEpoch;                           // epoch modulus value
+    uint32_t mMaxEpoch;                        // largest value mEpoch grows to
     uint32_t mNextEpoch;                       // next epoch start
+    uint32_t mWriteCount;                      // writes to persisted storage
 };
 
 } // namespace chip
@@ -26,7 +26,7 @@ namespace chip {
 StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChunkType> * usage, size_t capacity,
                                              size_t elementSize) :
     StaticAllocatorBase(capacity),
-    mElements(storage), mElementSize(elementSize), mUsage(usage)
+    mElements(storage), mElementSize(elementSize), mUsage(usage), mNextWord(0)
 {
     for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
     {
@@ -36,27 +36,39 @@ StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChu
 
 void * StaticAllocatorBitmap::Allocate()
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    // Reserve an element before looking for it, so that an exhausted pool fails without scanning the bitmap.
+    size_t allocated = mAllocated.load(std::memory_order_relaxed);
+    do
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        if (allocated >= Capacity())
         {
-            if ((value & (kBit1 << offset)) == 0)
+            return nullptr;
+        }
+    } while (!mAllocated.compare_exchange_weak(allocated, allocated + 1, std::memory_order_relaxed));
+
+    // Deallocate() clears a bit before releasing its reservation, so there are at least as many clear bits as reservations
+    // of threads still looking, and this thread finds one even if others take the bits it sees first.
+    const size_t numWords = NumWords();
+    size_t word           = mNextWord.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        auto & usage             = mUsage[word];
+        const tBitChunkType mask = WordMask(word);
+        auto value               = usage.load(std::memory_order_relaxed);
+
+        while ((~value & mask) != 0)
+        {
+            const tBitChunkType bit = kBit1 << FirstSetBit(~value & mask);
+            // On failure, value is reloaded with the current usage.
+            if (usage.compare_exchange_weak(value, value | bit, std::memory_order_acquire, std::memory_order_relaxed))
             {
-                if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
-                {
-                    mAllocated++;
-                    return At(word * kBitChunkSize + offset);
-                }
-                else
-                {
-                    value = usage.load(std::memory_order_relaxed); // if there is a race, update new usage
-                }
+                mNextWord.store(word, std::memory_order_relaxed);
+                return At(word * kBitChunkSize + FirstSetBit(bit));
             }
         }
+
+        word = (word + 1 < numWords) ? word + 1 : 0;
     }
-    return nullptr;
 }
 
 void StaticAllocatorBitmap::Deallocate(void * element)
@@ -68,9 +80,9 @@ void StaticAllocatorBitmap::Deallocate(void * element)
     // ensure the element is in the pool
     assert(index < Capacity());
 
-    auto value = mUsage[word].fetch_and(~(kBit1 << offset));
+    auto value = mUsage[word].fetch_and(~(kBit1 << offset), std::memory_order_release);
     nlASSERT((value & (kBit1 << offset)) != 0); // assert fail when free an unused slot
-    mAllocated--;
+    mAllocated.fetch_sub(1, std::memory_order_relaxed);
 }
 
 } // namespace chip
@@ -38,11 +38,11 @@ public:
     StaticAllocatorBase(size_t capacity) : mAllocated(0), mCapacity(capacity) {}
 
     size_t Capacity() const { return mCapacity; }
-    size_t Allocated() const { return mAllocated; }
-    bool Exhausted() const { return mAllocated == mCapacity; }
+    size_t Allocated() const { return mAllocated.load(std::memory_order_relaxed); }
+    bool Exhausted() const { return Allocated() == mCapacity; }
 
 protected:
-    size_t mAllocated;
+    std::atomic<size_t> mAllocated;
     const size_t mCapacity;
 };
 
@@ -58,12 +58,31 @@ protected:
     static constexpr const size_t kBitChunkSize = std::numeric_limits<tBitChunkType>::digits;
     static_assert(ATOMIC_LONG_LOCK_FREE, "StaticAllocatorBitmap is not lock free");
 
+    static size_t FirstSetBit(tBitChunkType value) { return static_cast<size_t>(__builtin_ctzl(value)); }
+
 public:
     StaticAllocatorBitmap(void * storage, std::atomic<tBitChunkType> * usage, size_t capacity, size_t elementSize);
+
+    /**
+     * Allocate an element. Safe to call concurrently with Allocate() and Deallocate() from other threads, without locking.
+     *
+     * @return the element, or nullptr if all elements are allocated.
+     */
     void * Allocate();
     void Deallocate(void * element);
 
 protected:
+    size_t NumWords() const { return (Capacity() + kBitChunkSize - 1) / kBitChunkSize; }
+
+    /**
+     * Bits of a usage word that stand for elements of the pool: all of them, except past the capacity in the last word.
+     */
+    tBitChunkType WordMask(size_t word) const
+    {
+        const size_t remaining = Capacity() - word * kBitChunkSize;
+        return (remaining >= kBitChunkSize) ? ~static_cast<tBitChunkType>(0) : ((kBit1 << remaining) - 1);
+    }
+
     void * At(size_t index) { return static_cast<uint8_t *>(mElements) + mElementSize * index; }
     size_t IndexOf(void * element)
     {
@@ -79,6 +98,12 @@ private:
     void * mElements;
     const size_t mElementSize;
     std::atomic<tBitChunkType> * mUsage;
+
+    /**
+     * Word the last allocation was made from, where the next one starts looking, so that allocations do not rescan the
+     * full words at the front of the bitmap.
+     */
+    std::atomic<size_t> mNextWord;
 };
 
 /**
@@ -129,17 +154,16 @@ public:
     template <typename F>
     bool ForEachActiveObject(F f)
     {
-        for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+        for (size_t word = 0; word < NumWords(); ++word)
         {
-            auto & usage = mUsage[word];
-            auto value   = usage.load(std::memory_order_relaxed);
-            for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+            // Visit the set bits only, so that empty words are skipped at once.
+            auto value = mUsage[word].load(std::memory_order_acquire);
+            while (value != 0)
             {
-                if ((value & (kBit1 << offset)) != 0)
-                {
-                    if (!f(static_cast<T *>(At(word * kBitChunkSize + offset))))
-                        return false;
-                }
+                size_t offset = FirstSetBit(value);
+                value &= value - 1;
+                if (!f(static_cast<T *>(At(word * kBitChunkSize + offset))))
+                    return false;
             }
         }
         return true;
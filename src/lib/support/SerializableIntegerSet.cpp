@@ -20,8 +20,25 @@
 
 #include <core/CHIPEncoding.h>
 
+#include <string.h>
+
 namespace chip {
 
+namespace {
+
+size_t VarintSize(uint64_t value)
+{
+    size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+} // namespace
+
 const char * SerializableU64SetBase::SerializeBase64(char * buf, uint16_t & buflen)
 {
     char * out = nullptr;
@@ -151,4 +168,134 @@ uint16_t SerializableU64SetBase::FirstAvailableForUniqueId(uint64_t value)
     return available;
 }
 
+size_t SortedU64SetBase::SerializedSize() const
+{
+    size_t size   = 0;
+    uint64_t prev = 0;
+    for (uint16_t i = 0; i < mCount; i++)
+    {
+        size += VarintSize(mData[i] - prev);
+        prev = mData[i];
+    }
+    return size;
+}
+
+CHIP_ERROR SortedU64SetBase::Serialize(uint8_t * buf, size_t & buflen) const
+{
+    size_t size   = SerializedSize();
+    uint64_t prev = 0;
+    uint8_t * out = buf;
+
+    if (buf == nullptr || buflen < size)
+    {
+        buflen = size;
+        return CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    for (uint16_t i = 0; i < mCount; i++)
+    {
+        uint64_t delta = mData[i] - prev;
+        while (delta >= 0x80)
+        {
+            *out++ = static_cast<uint8_t>(delta | 0x80);
+            delta >>= 7;
+        }
+        *out++ = static_cast<uint8_t>(delta);
+        prev   = mData[i];
+    }
+
+    buflen = size;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SortedU64SetBase::Deserialize(const uint8_t * serialized, size_t buflen)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint64_t prev  = 0;
+    size_t offset  = 0;
+
+    mCount = 0;
+    VerifyOrExit(serialized != nullptr || buflen == 0, err = CHIP_ERROR_INVALID_ARGUMENT);
+
+    while (offset < buflen)
+    {
+        uint64_t delta = 0;
+        uint8_t shift  = 0;
+        uint8_t byte;
+
+        do
+        {
+            VerifyOrExit(offset < buflen && shift < 64, err = CHIP_ERROR_INVALID_ARGUMENT);
+            byte = serialized[offset++];
+            // The tenth byte only holds the top bit of a value.
+            VerifyOrExit(shift < 63 || (byte & 0x7F) <= 1, err = CHIP_ERROR_INVALID_ARGUMENT);
+            delta |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            shift = static_cast<uint8_t>(shift + 7);
+        } while (byte & 0x80);
+
+        // The values are strictly ascending, so only the first one may be written as a zero delta.
+        VerifyOrExit(delta != 0 || mCount == 0, err = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(delta <= UINT64_MAX - prev, err = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(mCount < mCapacity, err = CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        prev            = prev + delta;
+        mData[mCount++] = prev;
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        mCount = 0;
+    }
+    return err;
+}
+
+uint16_t SortedU64SetBase::LowerBound(uint64_t value) const
+{
+    uint16_t low  = 0;
+    uint16_t high = mCount;
+
+    while (low < high)
+    {
+        uint16_t mid = static_cast<uint16_t>(low + (high - low) / 2);
+        if (mData[mid] < value)
+        {
+            low = static_cast<uint16_t>(mid + 1);
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+CHIP_ERROR SortedU64SetBase::Insert(uint64_t value)
+{
+    uint16_t index = LowerBound(value);
+
+    if (index < mCount && mData[index] == value)
+    {
+        return CHIP_NO_ERROR;
+    }
+    VerifyOrReturnError(mCount < mCapacity, CHIP_ERROR_NO_MEMORY);
+
+    memmove(&mData[index + 1], &mData[index], sizeof(uint64_t) * (mCount - index));
+    mData[index] = value;
+    mCount++;
+    return CHIP_NO_ERROR;
+}
+
+void SortedU64SetBase::Remove(uint64_t value)
+{
+    uint16_t index = LowerBound(value);
+
+    if (index < mCount && mData[index] == value)
+    {
+        memmove(&mData[index], &mData[index + 1], sizeof(uint64_t) * (mCount - index - 1u));
+        mCount--;
+    }
+}
+
 } // namespace chip
@@ -27,6 +27,10 @@
  *      The data is stored such that serialized data can be deserialized correctly
  *      on different machine architectures.
  *
+ *      Also defines a sorted set of uint64_t values, with binary search lookups
+ *      and a compact delta encoded serialization, for sets too large to be
+ *      scanned linearly.
+ *
  */
 
 #pragma once
@@ -34,10 +38,15 @@
 #include <support/Base64.h>
 #include <support/CodeUtils.h>
 
+#include <stddef.h>
+
 // BASE64_ENCODED_LEN doesn't account for null termination of the string.
 // So, we are adding 1 extra byte to the size requirement.
 #define CHIP_MAX_SERIALIZED_SIZE_U64(count) static_cast<uint16_t>(BASE64_ENCODED_LEN(sizeof(uint64_t) * (count)) + 1)
 
+// A delta encoded uint64_t takes at most 10 bytes, 7 bits per byte.
+#define CHIP_MAX_DELTA_ENCODED_SIZE_U64(count) (static_cast<size_t>(count) * 10)
+
 namespace chip {
 
 class SerializableU64SetBase
@@ -153,4 +162,100 @@ private:
     uint64_t mBuffer[kCapacity];
 };
 
+class SortedU64SetBase
+{
+public:
+    SortedU64SetBase(uint64_t * data, uint16_t capacity) : mData(data), mCapacity(capacity), mCount(0) {}
+
+    /**
+     * @brief
+     *   Serialize the set into a buffer. The values are written in ascending order, the first one as
+     *   is and every other one as its difference to the previous one, each as an unsigned LEB128
+     *   varint, so that close values, such as sequentially allocated ones, take a byte or two.
+     *
+     * @param[in] buf Buffer where the serialized set is written
+     * @param[in,out] buflen Length of buf, set to the length of the serialized set, or to the
+     *                       length required if buf is too small
+     * @return CHIP_NO_ERROR in case of success, or CHIP_ERROR_BUFFER_TOO_SMALL
+     */
+    CHIP_ERROR Serialize(uint8_t * buf, size_t & buflen) const;
+
+    /**
+     * @brief
+     *   Deserialize a buffer written by Serialize into the set, replacing its values.
+     *   On error, the set is left empty.
+     *
+     * @param[in] serialized Serialized buffer
+     * @param[in] buflen Length of buffer
+     * @return CHIP_NO_ERROR in case of success, or the error code
+     */
+    CHIP_ERROR Deserialize(const uint8_t * serialized, size_t buflen);
+
+    /**
+     * @brief
+     *   Get the length of the set if it is serialized.
+     */
+    size_t SerializedSize() const;
+
+    /**
+     * @brief
+     *   Get the maximum length of the set if it were full and serialized.
+     */
+    size_t MaxSerializedSize() const { return CHIP_MAX_DELTA_ENCODED_SIZE_U64(mCapacity); }
+
+    /**
+     * @brief
+     *   Check if the value is in the set, with a binary search.
+     */
+    bool Contains(uint64_t value) const
+    {
+        uint16_t index = LowerBound(value);
+        return index < mCount && mData[index] == value;
+    }
+
+    /**
+     * @brief
+     *   Insert the value in the set. If the value is duplicate, it won't be inserted.
+     *
+     * @return CHIP_NO_ERROR in case of success, or CHIP_ERROR_NO_MEMORY if the set is full
+     */
+    CHIP_ERROR Insert(uint64_t value);
+
+    /**
+     * @brief
+     *   Delete the value from the set.
+     */
+    void Remove(uint64_t value);
+
+    /**
+     * @brief
+     *   Get the number of values in the set, and the value at an index, in ascending order.
+     */
+    uint16_t Count() const { return mCount; }
+    uint64_t At(uint16_t index) const { return mData[index]; }
+
+    void Clear() { mCount = 0; }
+
+private:
+    uint64_t * const mData;
+    const uint16_t mCapacity;
+    uint16_t mCount;
+
+    /**
+     * @brief
+     *   Find the index of the first value not less than value, or mCount if there is none.
+     */
+    uint16_t LowerBound(uint64_t value) const;
+};
+
+template <uint16_t kCapacity>
+class SortedU64Set : public SortedU64SetBase
+{
+public:
+    SortedU64Set() : SortedU64SetBase(mBuffer, kCapacity) {}
+
+private:
+    uint64_t mBuffer[kCapacity];
+};
+
 } // namespace chip
@@ -0,0 +1,57 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Selects the vector instruction sets the encoding utilities may use.
+ *
+ *      On x86, the SSSE3 code is compiled with a function target attribute
+ *      whatever the compiler flags, and is only called once HasSSSE3() found
+ *      the CPU supports it. On AArch64, NEON is always available. Elsewhere,
+ *      only the scalar code is built.
+ */
+
+#pragma once
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CHIP_SIMD_SSSE3 1
+#define CHIP_SIMD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#include <tmmintrin.h>
+#else
+#define CHIP_SIMD_SSSE3 0
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define CHIP_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define CHIP_SIMD_NEON 0
+#endif
+
+namespace chip {
+namespace Simd {
+
+#if CHIP_SIMD_SSSE3
+inline bool HasSSSE3()
+{
+    static const bool sHasSSSE3 = __builtin_cpu_supports("ssse3");
+    return sHasSSSE3;
+}
+#endif
+
+} // namespace Simd
+} // namespace chip
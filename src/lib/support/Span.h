@@ -44,6 +44,42 @@ private:
     size_t mDataLen;
 };
 
-using ByteSpan = Span<uint8_t>;
+/**
+ * @brief A wrapper class for a buffer that may be written to and its length, without the ownership of it.
+ * The length may be reduced, for instance to the part of the buffer filled by a function given the whole buffer.
+ */
+template <class T>
+class MutableSpan
+{
+public:
+    constexpr MutableSpan() : mDataBuf(nullptr), mDataLen(0) {}
+    constexpr MutableSpan(T * databuf, size_t datalen) : mDataBuf(databuf), mDataLen(datalen) {}
+    template <size_t N>
+    constexpr explicit MutableSpan(T (&databuf)[N]) : MutableSpan(databuf, N)
+    {}
+
+    T * data() const { return mDataBuf; }
+    size_t size() const { return mDataLen; }
+
+    // Shrink the span to its first new_size elements. A new_size past size() leaves the span as it is.
+    void reduce_size(size_t new_size)
+    {
+        if (new_size < mDataLen)
+        {
+            mDataLen = new_size;
+        }
+    }
+
+    operator Span<T>() const { return Span<T>(mDataBuf, mDataLen); }
+
+private:
+    T * mDataBuf;
+    size_t mDataLen;
+};
+
+using ByteSpan        = Span<uint8_t>;
+using CharSpan        = Span<char>;
+using MutableByteSpan = MutableSpan<uint8_t>;
+using MutableCharSpan = MutableSpan<char>;
 
 } // namespace chip
@@ -0,0 +1,410 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "TlsfHeap.h"
+
+#include <support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+unsigned FloorLog2(size_t value)
+{
+    unsigned log2 = 0;
+    while (value >>= 1)
+    {
+        log2++;
+    }
+    return log2;
+}
+
+unsigned LowestBit(uint32_t value)
+{
+    return static_cast<unsigned>(__builtin_ctz(value));
+}
+
+unsigned HighestBit(uint32_t value)
+{
+    return 31u - static_cast<unsigned>(__builtin_clz(value));
+}
+
+} // namespace
+
+static_assert((TlsfHeap::kAlignment & (TlsfHeap::kAlignment - 1)) == 0, "The alignment must be a power of two");
+static_assert(TlsfHeap::kSecondLevelCount <= 32, "The second level bitmaps are 32 bits wide");
+
+unsigned TlsfHeap::Stats::GetFragmentationPercent() const
+{
+    const size_t freeBytes = GetFreeBytes();
+
+    if (freeBytes == 0)
+    {
+        return 0;
+    }
+
+    const size_t largest = (mNumFreeBlocks == 0) ? 0 : mLargestFreeBlock + kHeaderSize;
+    return static_cast<unsigned>(100 - (largest * 100) / freeBytes);
+}
+
+// Size classes are counted in units of kAlignment. Below kSecondLevelCount units the first class is linear, above that class
+// n covers [2^(n + kSecondLevelLog2 - 1), 2^(n + kSecondLevelLog2)) units, in kSecondLevelCount subclasses.
+void TlsfHeap::MapInsert(size_t size, unsigned & firstLevel, unsigned & secondLevel)
+{
+    const size_t units = size / kAlignment;
+
+    if (units < kSecondLevelCount)
+    {
+        firstLevel  = 0;
+        secondLevel = static_cast<unsigned>(units);
+        return;
+    }
+
+    const unsigned log2 = FloorLog2(units);
+    firstLevel          = log2 - kSecondLevelLog2 + 1;
+    secondLevel         = static_cast<unsigned>(units >> (log2 - kSecondLevelLog2)) - kSecondLevelCount;
+}
+
+// Rounds the size up to the next subclass, so that any block of the list found is large enough.
+void TlsfHeap::MapSearch(size_t size, unsigned & firstLevel, unsigned & secondLevel)
+{
+    size_t units = size / kAlignment;
+
+    if (units >= kSecondLevelCount)
+    {
+        units += (static_cast<size_t>(1) << (FloorLog2(units) - kSecondLevelLog2)) - 1;
+    }
+
+    MapInsert(units * kAlignment, firstLevel, secondLevel);
+}
+
+void TlsfHeap::Init(void * heap, size_t size)
+{
+    mStart            = nullptr;
+    mEnd              = nullptr;
+    mFirstLevelBitmap = 0;
+    memset(mSecondLevelBitmaps, 0, sizeof(mSecondLevelBitmaps));
+    memset(mFreeLists, 0, sizeof(mFreeLists));
+    memset(&mStats, 0, sizeof(mStats));
+
+    VerifyOrReturn(heap != nullptr);
+
+    uint8_t * start       = static_cast<uint8_t *>(heap);
+    const size_t misalign = reinterpret_cast<uintptr_t>(start) & (kAlignment - 1);
+    const size_t skip     = (misalign == 0) ? 0 : kAlignment - misalign;
+
+    VerifyOrReturn(size >= skip + kMinBlockSize);
+    start += skip;
+    size = (size - skip) & ~(kAlignment - 1);
+    if (size > kMaxHeapSize)
+    {
+        size = kMaxHeapSize;
+    }
+
+    mStart           = start;
+    mEnd             = start + size;
+    mStats.mHeapSize = size;
+
+    Block * block    = reinterpret_cast<Block *>(start);
+    block->mPrevSize = 0;
+    block->mSize     = static_cast<uint32_t>(size);
+    block->mTag      = 0;
+    Insert(block);
+}
+
+TlsfHeap::Block * TlsfHeap::Next(Block * block) const
+{
+    uint8_t * next = reinterpret_cast<uint8_t *>(block) + block->mSize;
+    return (next < mEnd) ? reinterpret_cast<Block *>(next) : nullptr;
+}
+
+TlsfHeap::Block * TlsfHeap::Prev(Block * block)
+{
+    return (block->mPrevSize == 0) ? nullptr : reinterpret_cast<Block *>(reinterpret_cast<uint8_t *>(block) - block->mPrevSize);
+}
+
+TlsfHeap::Block * TlsfHeap::FromPayload(const void * ptr)
+{
+    return reinterpret_cast<Block *>(const_cast<uint8_t *>(static_cast<const uint8_t *>(ptr)) - kHeaderSize);
+}
+
+TlsfHeap::Block * TlsfHeap::FindFree(size_t size)
+{
+    unsigned firstLevel;
+    unsigned secondLevel;
+
+    MapSearch(size, firstLevel, secondLevel);
+    VerifyOrReturnError(firstLevel < kFirstLevelCount, nullptr);
+
+    uint32_t secondLevelMap = mSecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+    if (secondLevelMap == 0)
+    {
+        const uint32_t firstLevelMap = (firstLevel + 1 < kFirstLevelCount) ? mFirstLevelBitmap & (~0u << (firstLevel + 1)) : 0;
+        VerifyOrReturnError(firstLevelMap != 0, nullptr);
+
+        firstLevel     = LowestBit(firstLevelMap);
+        secondLevelMap = mSecondLevelBitmaps[firstLevel];
+    }
+
+    return mFreeLists[firstLevel][LowestBit(secondLevelMap)];
+}
+
+void TlsfHeap::Insert(Block * block)
+{
+    unsigned firstLevel;
+    unsigned secondLevel;
+
+    MapInsert(block->mSize, firstLevel, secondLevel);
+
+    Block *& head    = mFreeLists[firstLevel][secondLevel];
+    block->mFree     = 1;
+    block->mPrevFree = nullptr;
+    block->mNextFree = head;
+    if (head != nullptr)
+    {
+        head->mPrevFree = block;
+    }
+    head = block;
+
+    mFirstLevelBitmap |= 1u << firstLevel;
+    mSecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+    mStats.mNumFreeBlocks++;
+}
+
+void TlsfHeap::Remove(Block * block)
+{
+    unsigned firstLevel;
+    unsigned secondLevel;
+
+    MapInsert(block->mSize, firstLevel, secondLevel);
+
+    if (block->mPrevFree != nullptr)
+    {
+        block->mPrevFree->mNextFree = block->mNextFree;
+    }
+    else
+    {
+        mFreeLists[firstLevel][secondLevel] = block->mNextFree;
+    }
+    if (block->mNextFree != nullptr)
+    {
+        block->mNextFree->mPrevFree = block->mPrevFree;
+    }
+    block->mFree = 0;
+
+    if (mFreeLists[firstLevel][secondLevel] == nullptr)
+    {
+        mSecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+        if (mSecondLevelBitmaps[firstLevel] == 0)
+        {
+            mFirstLevelBitmap &= ~(1u << firstLevel);
+        }
+    }
+    mStats.mNumFreeBlocks--;
+}
+
+// Trims a block that is not free to size bytes, releasing the rest if it can hold a block of its own.
+void TlsfHeap::Split(Block * block, size_t size)
+{
+    VerifyOrReturn(block->mSize - size >= kMinBlockSize);
+
+    Block * rest    = reinterpret_cast<Block *>(reinterpret_cast<uint8_t *>(block) + size);
+    rest->mPrevSize = static_cast<uint32_t>(size);
+    rest->mSize     = static_cast<uint32_t>(block->mSize - size);
+    rest->mFree     = 0;
+    rest->mTag      = 0;
+    block->mSize    = static_cast<uint32_t>(size);
+    Release(rest);
+}
+
+// Merges a block that is not free with its free neighbours, and adds the result to the free lists.
+void TlsfHeap::Release(Block * block)
+{
+    Block * other = Next(block);
+    if (other != nullptr && other->mFree)
+    {
+        Remove(other);
+        block->mSize += other->mSize;
+    }
+
+    other = Prev(block);
+    if (other != nullptr && other->mFree)
+    {
+        Remove(other);
+        other->mSize += block->mSize;
+        block = other;
+    }
+
+    other = Next(block);
+    if (other != nullptr)
+    {
+        other->mPrevSize = block->mSize;
+    }
+
+    Insert(block);
+}
+
+void TlsfHeap::Account(const Block * block, bool allocated)
+{
+    const uint8_t tag = (block->mTag < kNumTags) ? block->mTag : 0;
+
+    if (allocated)
+    {
+        mStats.mBytesInUse += block->mSize;
+        mStats.mBytesInUseByTag[tag] += block->mSize;
+        if (mStats.mBytesInUse > mStats.mBytesInUseHighWatermark)
+        {
+            mStats.mBytesInUseHighWatermark = mStats.mBytesInUse;
+        }
+    }
+    else
+    {
+        mStats.mBytesInUse -= block->mSize;
+        mStats.mBytesInUseByTag[tag] -= block->mSize;
+    }
+}
+
+void * TlsfHeap::Alloc(size_t size, uint8_t tag)
+{
+    Block * block = nullptr;
+
+    if (size <= kMaxAllocation && mStart != nullptr)
+    {
+        size  = RoundUp(size + kHeaderSize);
+        size  = (size < kMinBlockSize) ? kMinBlockSize : size;
+        block = FindFree(size);
+    }
+
+    if (block == nullptr)
+    {
+        mStats.mNumFailedAllocations++;
+        return nullptr;
+    }
+
+    Remove(block);
+    Split(block, size);
+    block->mTag = tag;
+    Account(block, true);
+    mStats.mNumAllocations++;
+
+    return ToPayload(block);
+}
+
+void TlsfHeap::Free(void * ptr)
+{
+    VerifyOrReturn(ptr != nullptr);
+
+    Block * block = FromPayload(ptr);
+    VerifyOrDie(reinterpret_cast<uint8_t *>(block) >= mStart && reinterpret_cast<uint8_t *>(block) < mEnd);
+    VerifyOrDie(!block->mFree);
+
+    Account(block, false);
+    mStats.mNumAllocations--;
+    Release(block);
+}
+
+void * TlsfHeap::Realloc(void * ptr, size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return Alloc(size);
+    }
+
+    if (size == 0)
+    {
+        Free(ptr);
+        return nullptr;
+    }
+
+    if (size > kMaxAllocation)
+    {
+        mStats.mNumFailedAllocations++;
+        return nullptr;
+    }
+
+    Block * block = FromPayload(ptr);
+    VerifyOrDie(!block->mFree);
+
+    size_t blockSize = RoundUp(size + kHeaderSize);
+    blockSize        = (blockSize < kMinBlockSize) ? kMinBlockSize : blockSize;
+
+    Block * next = Next(block);
+    if (blockSize > block->mSize && next != nullptr && next->mFree && block->mSize + next->mSize >= blockSize)
+    {
+        Account(block, false);
+        Remove(next);
+        block->mSize += next->mSize;
+        next = Next(block);
+        if (next != nullptr)
+        {
+            next->mPrevSize = block->mSize;
+        }
+        Split(block, blockSize);
+        Account(block, true);
+        return ptr;
+    }
+
+    if (blockSize <= block->mSize)
+    {
+        Account(block, false);
+        Split(block, blockSize);
+        Account(block, true);
+        return ptr;
+    }
+
+    void * newPtr = Alloc(size, block->mTag);
+    VerifyOrReturnError(newPtr != nullptr, nullptr);
+
+    memcpy(newPtr, ptr, block->mSize - kHeaderSize);
+    Free(ptr);
+
+    return newPtr;
+}
+
+bool TlsfHeap::IsAllocated(const void * ptr, size_t minSize) const
+{
+    VerifyOrReturnError(ptr != nullptr && mStart != nullptr, false);
+
+    const uint8_t * bytes = static_cast<const uint8_t *>(ptr);
+    VerifyOrReturnError(bytes >= mStart + kHeaderSize && bytes < mEnd, false);
+
+    const Block * block = FromPayload(ptr);
+    return !block->mFree && block->mSize - kHeaderSize >= minSize;
+}
+
+void TlsfHeap::GetStats(Stats & stats) const
+{
+    stats                   = mStats;
+    stats.mLargestFreeBlock = 0;
+
+    VerifyOrReturn(mFirstLevelBitmap != 0);
+
+    // The largest block is in the highest non-empty list, where blocks are not sorted.
+    const unsigned firstLevel  = HighestBit(mFirstLevelBitmap);
+    const unsigned secondLevel = HighestBit(mSecondLevelBitmaps[firstLevel]);
+    for (const Block * block = mFreeLists[firstLevel][secondLevel]; block != nullptr; block = block->mNextFree)
+    {
+        if (block->mSize - kHeaderSize > stats.mLargestFreeBlock)
+        {
+            stats.mLargestFreeBlock = block->mSize - kHeaderSize;
+        }
+    }
+}
+
+} // namespace chip
@@ -0,0 +1,164 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a two-level segregated fit (TLSF) heap over a caller
+ *      provided buffer, used by the tlsf memory management backend.
+ */
+
+#pragma once
+
+#include <core/CHIPError.h>
+#include <support/CHIPMem.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace chip {
+
+/**
+ * A heap whose free blocks are kept in segregated lists, one per size class, with bitmaps of the non-empty lists. Size classes
+ * are powers of two, each split in kSecondLevelCount linear subclasses, so that allocating and freeing a block is O(1): a
+ * couple of bit scans find a list whose blocks are all large enough, and freed blocks are merged with their free neighbours
+ * in the heap right away.
+ *
+ * Every block carries the tag it was allocated with, so that the bytes in use can be attributed to the subsystems owning them.
+ *
+ * The heap is not thread safe.
+ */
+class TlsfHeap
+{
+public:
+    static constexpr size_t kAlignment = std::alignment_of<max_align_t>::value;
+    static constexpr size_t kNumTags   = static_cast<size_t>(Platform::MemoryTag::kNumTags);
+
+    struct Stats
+    {
+        size_t mHeapSize;                  ///< Bytes managed by the heap, block headers included
+        size_t mBytesInUse;                ///< Bytes of the allocated blocks, block headers included
+        size_t mBytesInUseHighWatermark;   ///< Highest value of mBytesInUse since the heap was initialized
+        size_t mLargestFreeBlock;          ///< Largest allocation that can currently succeed
+        size_t mNumAllocations;            ///< Blocks currently allocated
+        size_t mNumFreeBlocks;             ///< Free blocks the free bytes are split in
+        size_t mNumFailedAllocations;      ///< Allocations that failed since the heap was initialized
+        size_t mBytesInUseByTag[kNumTags]; ///< mBytesInUse, split by the tag of the blocks
+
+        size_t GetFreeBytes() const { return mHeapSize - mBytesInUse; }
+
+        /**
+         * Percentage of the free bytes that cannot be allocated at once, because they are not in the largest free block.
+         */
+        unsigned GetFragmentationPercent() const;
+    };
+
+    TlsfHeap() { Init(nullptr, 0); }
+
+    TlsfHeap(const TlsfHeap &) = delete;
+    TlsfHeap & operator=(const TlsfHeap &) = delete;
+
+    /**
+     * Start managing the size bytes at heap, dropping any previous allocation. A buffer too small for a single block leaves
+     * the heap empty.
+     */
+    void Init(void * heap, size_t size);
+
+    /**
+     * @return size bytes aligned to kAlignment, or nullptr if no free block is large enough.
+     */
+    void * Alloc(size_t size, uint8_t tag = 0);
+
+    /**
+     * Resize the allocation at ptr, in place if the block or its free neighbour in the heap is large enough. A null ptr
+     * allocates, and a zero size frees. The block keeps its tag.
+     */
+    void * Realloc(void * ptr, size_t size);
+
+    /**
+     * Free the allocation at ptr, which may be null.
+     */
+    void Free(void * ptr);
+
+    /**
+     * @return Whether ptr is an allocation of this heap whose usable size is at least minSize.
+     */
+    bool IsAllocated(const void * ptr, size_t minSize = 0) const;
+
+    void GetStats(Stats & stats) const;
+
+    static constexpr unsigned kSecondLevelLog2  = 3;
+    static constexpr unsigned kSecondLevelCount = 1u << kSecondLevelLog2;
+    static constexpr unsigned kFirstLevelCount  = 32;
+
+private:
+    struct Block
+    {
+        uint32_t mPrevSize; // Size of the previous block in the heap, 0 for the first one
+        uint32_t mSize;     // Size of this block, header included
+        uint8_t mFree;
+        uint8_t mTag;
+        // Only valid while the block is free, they overlap the allocation otherwise
+        Block * mNextFree;
+        Block * mPrevFree;
+    };
+
+    static constexpr size_t kHeaderSize    = (offsetof(Block, mNextFree) + kAlignment - 1) & ~(kAlignment - 1);
+    static constexpr size_t kMinBlockSize  = (sizeof(Block) + kAlignment - 1) & ~(kAlignment - 1);
+    static constexpr size_t kMaxHeapSize   = UINT32_MAX & ~(kAlignment - 1);
+    static constexpr size_t kMaxAllocation = kMaxHeapSize - kHeaderSize;
+
+    static void MapInsert(size_t size, unsigned & firstLevel, unsigned & secondLevel);
+    static void MapSearch(size_t size, unsigned & firstLevel, unsigned & secondLevel);
+
+    Block * Next(Block * block) const;
+    static Block * Prev(Block * block);
+    static size_t RoundUp(size_t size) { return (size + kAlignment - 1) & ~(kAlignment - 1); }
+    static Block * FromPayload(const void * ptr);
+    static void * ToPayload(Block * block) { return reinterpret_cast<uint8_t *>(block) + kHeaderSize; }
+
+    Block * FindFree(size_t size);
+    void Insert(Block * block);
+    void Remove(Block * block);
+    void Split(Block * block, size_t size);
+    void Release(Block * block);
+    void Account(const Block * block, bool allocated);
+
+    uint8_t * mStart;
+    uint8_t * mEnd;
+    uint32_t mFirstLevelBitmap;
+    uint32_t mSecondLevelBitmaps[kFirstLevelCount];
+    Block * mFreeLists[kFirstLevelCount][kSecondLevelCount];
+    Stats mStats;
+};
+
+namespace Platform {
+
+/**
+ * Read the statistics of the heap that serves chip::Platform::MemoryAlloc.
+ *
+ * @retval #CHIP_ERROR_INCORRECT_STATE If the tlsf memory management backend is not initialized.
+ * @retval #CHIP_NO_ERROR              On success.
+ *
+ * @note Provided by the tlsf memory management backend only.
+ */
+CHIP_ERROR MemoryGetHeapStats(TlsfHeap::Stats & stats);
+
+} // namespace Platform
+} // namespace chip
@@ -0,0 +1,592 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the recording of log messages as their format
+ *      string and arguments, and their formatting from the record. Both
+ *      walk the format string the same way: the record holds the values of
+ *      the arguments one after the other, in the order of the conversions
+ *      that take them.
+ */
+
+#include "BinaryLogBuffer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace Logging {
+
+namespace {
+
+enum class ArgType : uint8_t
+{
+    kNone,
+    kSigned,
+    kUnsigned,
+    kDouble,
+    kPointer,
+    kString,
+    kUnsupported,
+};
+
+/**
+ * A conversion of a format string, from its '%' to its conversion character included.
+ */
+struct Conversion
+{
+    const char * mStart;
+    const char * mEnd;
+    // The flags of the conversion, from mStart + 1.
+    size_t mFlagsLength;
+    bool mWidthArg;
+    bool mPrecisionArg;
+    // The width and precision written in the format, -1 if none.
+    int mWidth;
+    int mPrecision;
+    // 'l' for long, 'L' for long long (and long double), 'h', 'H' for char, 'z', 'j', 't', or 0.
+    char mLength;
+    char mConversion;
+    ArgType mType;
+};
+
+int ParseNumber(const char *& p)
+{
+    int value = 0;
+    while (*p >= '0' && *p <= '9')
+    {
+        value = value * 10 + (*p++ - '0');
+    }
+    return value;
+}
+
+// Parses the conversion at p, which is a '%' not followed by another.
+void ParseConversion(const char * p, Conversion & conversion)
+{
+    conversion.mStart = p++;
+
+    const char * flags = p;
+    while (*p != '\0' && strchr("-+ #0'", *p) != nullptr)
+    {
+        p++;
+    }
+    conversion.mFlagsLength = static_cast<size_t>(p - flags);
+
+    conversion.mWidthArg = (*p == '*');
+    conversion.mWidth    = -1;
+    if (conversion.mWidthArg)
+    {
+        p++;
+    }
+    else if (*p >= '0' && *p <= '9')
+    {
+        conversion.mWidth = ParseNumber(p);
+    }
+
+    conversion.mPrecisionArg = false;
+    conversion.mPrecision    = -1;
+    if (*p == '.')
+    {
+        p++;
+        conversion.mPrecisionArg = (*p == '*');
+        if (conversion.mPrecisionArg)
+        {
+            p++;
+        }
+        else
+        {
+            conversion.mPrecision = ParseNumber(p);
+        }
+    }
+
+    conversion.mLength = 0;
+    switch (*p)
+    {
+    case 'h':
+        p++;
+        conversion.mLength = (*p == 'h') ? (p++, 'H') : 'h';
+        break;
+    case 'l':
+        p++;
+        conversion.mLength = (*p == 'l') ? (p++, 'L') : 'l';
+        break;
+    case 'L':
+    case 'q':
+        p++;
+        conversion.mLength = 'L';
+        break;
+    case 'z':
+    case 'j':
+    case 't':
+        conversion.mLength = *p++;
+        break;
+    default:
+        break;
+    }
+
+    conversion.mConversion = *p;
+    conversion.mEnd        = (*p == '\0') ? p : p + 1;
+
+    switch (conversion.mConversion)
+    {
+    case 'd':
+    case 'i':
+        conversion.mType = ArgType::kSigned;
+        break;
+    case 'c':
+        conversion.mType = (conversion.mLength == 0) ? ArgType::kSigned : ArgType::kUnsupported;
+        break;
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        conversion.mType = ArgType::kUnsigned;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        conversion.mType = ArgType::kDouble;
+        break;
+    case 'p':
+        conversion.mType = ArgType::kPointer;
+        break;
+    case 's':
+        conversion.mType = (conversion.mLength == 0) ? ArgType::kString : ArgType::kUnsupported;
+        break;
+    default:
+        // %n, wide characters, or a conversion this does not know
+        conversion.mType = ArgType::kUnsupported;
+        break;
+    }
+}
+
+int64_t ReadSigned(const Conversion & conversion, va_list & args)
+{
+    switch (conversion.mLength)
+    {
+    case 'l':
+        return va_arg(args, long);
+    case 'L':
+        return va_arg(args, long long);
+    case 'z':
+        return static_cast<int64_t>(va_arg(args, size_t));
+    case 'j':
+        return va_arg(args, intmax_t);
+    case 't':
+        return va_arg(args, ptrdiff_t);
+    default:
+        // char and short are promoted to int
+        return va_arg(args, int);
+    }
+}
+
+uint64_t ReadUnsigned(const Conversion & conversion, va_list & args)
+{
+    switch (conversion.mLength)
+    {
+    case 'l':
+        return va_arg(args, unsigned long);
+    case 'L':
+        return va_arg(args, unsigned long long);
+    case 'z':
+        return va_arg(args, size_t);
+    case 'j':
+        return va_arg(args, uintmax_t);
+    case 't':
+        return static_cast<uint64_t>(va_arg(args, ptrdiff_t));
+    case 'h':
+        return static_cast<unsigned short>(va_arg(args, unsigned int));
+    case 'H':
+        return static_cast<unsigned char>(va_arg(args, unsigned int));
+    default:
+        return va_arg(args, unsigned int);
+    }
+}
+
+class RecordWriter
+{
+public:
+    RecordWriter(BinaryLogRecord & record) : mRecord(record) {}
+
+    bool Put(const void * data, size_t length)
+    {
+        if (length > sizeof(mRecord.mArgs) - mRecord.mArgsLength)
+        {
+            mRecord.mTruncated = true;
+            return false;
+        }
+        memcpy(mRecord.mArgs + mRecord.mArgsLength, data, length);
+        mRecord.mArgsLength = static_cast<uint16_t>(mRecord.mArgsLength + length);
+        return true;
+    }
+
+    // Puts as much of a string as fits, after its length.
+    void PutString(const char * string, int precision)
+    {
+        size_t room = sizeof(mRecord.mArgs) - mRecord.mArgsLength;
+        if (room < 2)
+        {
+            mRecord.mTruncated = true;
+            return;
+        }
+        size_t maxLength = room - 1 < UINT8_MAX ? room - 1 : UINT8_MAX;
+        if (precision >= 0 && static_cast<size_t>(precision) < maxLength)
+        {
+            maxLength = static_cast<size_t>(precision);
+        }
+
+        size_t length = 0;
+        while (length < maxLength && string[length] != '\0')
+        {
+            length++;
+        }
+        if (length == maxLength && string[length] != '\0' && (precision < 0 || static_cast<size_t>(precision) > maxLength))
+        {
+            mRecord.mTruncated = true;
+        }
+
+        uint8_t length8 = static_cast<uint8_t>(length);
+        Put(&length8, 1);
+        Put(string, length);
+    }
+
+private:
+    BinaryLogRecord & mRecord;
+};
+
+class RecordReader
+{
+public:
+    RecordReader(const BinaryLogRecord & record) : mRecord(record) {}
+
+    bool Get(void * data, size_t length)
+    {
+        if (length > mRecord.mArgsLength - mOffset)
+        {
+            return false;
+        }
+        memcpy(data, mRecord.mArgs + mOffset, length);
+        mOffset += length;
+        return true;
+    }
+
+    bool GetString(const char *& string, size_t & length)
+    {
+        uint8_t length8;
+        if (!Get(&length8, 1) || length8 > mRecord.mArgsLength - mOffset)
+        {
+            return false;
+        }
+        string = reinterpret_cast<const char *>(mRecord.mArgs + mOffset);
+        length = length8;
+        mOffset += length8;
+        return true;
+    }
+
+private:
+    const BinaryLogRecord & mRecord;
+    size_t mOffset = 0;
+};
+
+class MessageWriter
+{
+public:
+    MessageWriter(char * buffer, size_t size) : mBuffer(buffer), mSize(size)
+    {
+        if (mSize > 0)
+        {
+            mBuffer[0] = '\0';
+        }
+    }
+
+    void Append(const char * text, size_t length)
+    {
+        size_t room  = Room();
+        size_t count = length < room ? length : room;
+        memcpy(mBuffer + mLength, text, count);
+        mLength += count;
+        Terminate();
+    }
+
+    template <typename T>
+    void AppendFormatted(const char * spec, T value)
+    {
+        size_t room = Room();
+        if (room > 0)
+        {
+            int count = snprintf(mBuffer + mLength, room + 1, spec, value);
+            if (count > 0)
+            {
+                mLength += (static_cast<size_t>(count) < room) ? static_cast<size_t>(count) : room;
+            }
+        }
+    }
+
+    size_t GetLength() const { return mLength; }
+
+private:
+    size_t Room() const { return (mSize > 0) ? mSize - 1 - mLength : 0; }
+    void Terminate()
+    {
+        if (mSize > 0)
+        {
+            mBuffer[mLength] = '\0';
+        }
+    }
+
+    char * mBuffer;
+    size_t mSize;
+    size_t mLength = 0;
+};
+
+// Writes the spec of a conversion for a recorded argument to spec: its flags, its width and precision, with those given as
+// arguments filled in, then the length modifier of the recorded value.
+void BuildSpec(const Conversion & conversion, bool hasWidth, int width, int precision, const char * length, char * spec,
+               size_t specSize)
+{
+    snprintf(spec, specSize, "%%%.*s", static_cast<int>(conversion.mFlagsLength), conversion.mStart + 1);
+    size_t used = strlen(spec);
+    if (hasWidth)
+    {
+        used += static_cast<size_t>(snprintf(spec + used, specSize - used, "%d", width));
+    }
+    if (precision >= 0 && used < specSize)
+    {
+        used += static_cast<size_t>(snprintf(spec + used, specSize - used, ".%d", precision));
+    }
+    if (used < specSize)
+    {
+        snprintf(spec + used, specSize - used, "%s%c", length, conversion.mConversion);
+    }
+}
+
+} // namespace
+
+bool EncodeBinaryLogRecord(BinaryLogRecord & record, uint64_t timestampUs, const char * module, uint8_t category,
+                           const char * format, va_list args)
+{
+    va_list argsCopy;
+    RecordWriter writer(record);
+    bool encoded = true;
+
+    record.mFormat      = format;
+    record.mTimestampUs = timestampUs;
+    record.mCategory    = category;
+    record.mTruncated   = false;
+    record.mArgsLength  = 0;
+    strncpy(record.mModule, module, sizeof(record.mModule) - 1);
+    record.mModule[sizeof(record.mModule) - 1] = '\0';
+
+    // The arguments are read through a copy, as va_arg is used on it from other functions
+    va_copy(argsCopy, args);
+    for (const char * p = format; *p != '\0' && encoded;)
+    {
+        if (*p != '%')
+        {
+            p++;
+            continue;
+        }
+        if (p[1] == '%')
+        {
+            p += 2;
+            continue;
+        }
+
+        Conversion conversion;
+        ParseConversion(p, conversion);
+        p = conversion.mEnd;
+
+        int width     = conversion.mWidthArg ? va_arg(argsCopy, int) : conversion.mWidth;
+        int precision = conversion.mPrecisionArg ? va_arg(argsCopy, int) : conversion.mPrecision;
+        if (conversion.mWidthArg)
+        {
+            writer.Put(&width, sizeof(width));
+        }
+        if (conversion.mPrecisionArg)
+        {
+            writer.Put(&precision, sizeof(precision));
+        }
+
+        switch (conversion.mType)
+        {
+        case ArgType::kSigned: {
+            int64_t value = ReadSigned(conversion, argsCopy);
+            writer.Put(&value, sizeof(value));
+            break;
+        }
+        case ArgType::kUnsigned: {
+            uint64_t value = ReadUnsigned(conversion, argsCopy);
+            writer.Put(&value, sizeof(value));
+            break;
+        }
+        case ArgType::kDouble: {
+            double value = (conversion.mLength == 'L') ? static_cast<double>(va_arg(argsCopy, long double))
+                                                       : va_arg(argsCopy, double);
+            writer.Put(&value, sizeof(value));
+            break;
+        }
+        case ArgType::kPointer: {
+            uint64_t value = reinterpret_cast<uintptr_t>(va_arg(argsCopy, void *));
+            writer.Put(&value, sizeof(value));
+            break;
+        }
+        case ArgType::kString: {
+            const char * value = va_arg(argsCopy, const char *);
+            writer.PutString(value != nullptr ? value : "(null)", precision);
+            break;
+        }
+        default:
+            encoded = false;
+            break;
+        }
+    }
+    va_end(argsCopy);
+
+    return encoded;
+}
+
+size_t FormatBinaryLogRecord(const BinaryLogRecord & record, char * buffer, size_t bufferSize)
+{
+    RecordReader reader(record);
+    MessageWriter writer(buffer, bufferSize);
+    const char * p = record.mFormat;
+
+    while (*p != '\0')
+    {
+        const char * text = p;
+        while (*p != '\0' && *p != '%')
+        {
+            p++;
+        }
+        writer.Append(text, static_cast<size_t>(p - text));
+        if (*p == '\0')
+        {
+            break;
+        }
+        if (p[1] == '%')
+        {
+            writer.Append("%", 1);
+            p += 2;
+            continue;
+        }
+
+        Conversion conversion;
+        char spec[32];
+
+        ParseConversion(p, conversion);
+        p = conversion.mEnd;
+
+        int width     = conversion.mWidth;
+        int precision = conversion.mPrecision;
+        bool hasWidth = conversion.mWidthArg || conversion.mWidth >= 0;
+        bool ok       = true;
+        if (conversion.mWidthArg)
+        {
+            // A negative width given as an argument is written as a '-' flag
+            ok = reader.Get(&width, sizeof(width));
+        }
+        if (conversion.mPrecisionArg && ok)
+        {
+            ok = reader.Get(&precision, sizeof(precision));
+        }
+
+        switch (conversion.mType)
+        {
+        case ArgType::kSigned: {
+            int64_t value;
+            ok = ok && reader.Get(&value, sizeof(value));
+            if (ok && conversion.mConversion == 'c')
+            {
+                BuildSpec(conversion, hasWidth, width, -1, "", spec, sizeof(spec));
+                writer.AppendFormatted(spec, static_cast<int>(value));
+            }
+            else if (ok)
+            {
+                BuildSpec(conversion, hasWidth, width, precision, "ll", spec, sizeof(spec));
+                writer.AppendFormatted(spec, static_cast<long long>(value));
+            }
+            break;
+        }
+        case ArgType::kUnsigned: {
+            uint64_t value;
+            ok = ok && reader.Get(&value, sizeof(value));
+            if (ok)
+            {
+                BuildSpec(conversion, hasWidth, width, precision, "ll", spec, sizeof(spec));
+                writer.AppendFormatted(spec, static_cast<unsigned long long>(value));
+            }
+            break;
+        }
+        case ArgType::kDouble: {
+            double value;
+            ok = ok && reader.Get(&value, sizeof(value));
+            if (ok)
+            {
+                BuildSpec(conversion, hasWidth, width, precision, "", spec, sizeof(spec));
+                writer.AppendFormatted(spec, value);
+            }
+            break;
+        }
+        case ArgType::kPointer: {
+            uint64_t value;
+            ok = ok && reader.Get(&value, sizeof(value));
+            if (ok)
+            {
+                BuildSpec(conversion, hasWidth, width, precision, "", spec, sizeof(spec));
+                writer.AppendFormatted(spec, reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+            }
+            break;
+        }
+        case ArgType::kString: {
+            const char * value;
+            size_t length;
+            ok = ok && reader.GetString(value, length);
+            if (ok)
+            {
+                // The string was recorded up to its precision
+                BuildSpec(conversion, hasWidth, width, static_cast<int>(length), "", spec, sizeof(spec));
+                writer.AppendFormatted(spec, value);
+            }
+            break;
+        }
+        default:
+            ok = false;
+            break;
+        }
+
+        if (!ok)
+        {
+            // The rest of the arguments did not fit in the record
+            break;
+        }
+    }
+
+    if (record.mTruncated)
+    {
+        writer.Append("...", 3);
+    }
+    return writer.GetLength();
+}
+
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a buffer of log messages recorded as their format
+ *      string and the raw values of their arguments, to be formatted later,
+ *      on another thread than the one that logged them.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+namespace chip {
+namespace Logging {
+
+/**
+ * A log message, as recorded by EncodeBinaryLogRecord().
+ */
+struct BinaryLogRecord
+{
+    // Must stay valid until the record is formatted, which a string literal does.
+    const char * mFormat;
+    uint64_t mTimestampUs;
+    char mModule[kMaxModuleNameLen + 1];
+    uint8_t mCategory;
+    // Whether arguments were cut short to fit in mArgs.
+    bool mTruncated;
+    uint16_t mArgsLength;
+    uint8_t mArgs[CHIP_CONFIG_BINARY_LOG_RECORD_SIZE - sizeof(const char *) - sizeof(uint64_t) - (kMaxModuleNameLen + 1) - 4];
+};
+
+/**
+ * Record a log message: its format string, and the values of its arguments, which the format string tells the types of.
+ * The strings it is given are copied, the rest of the format is left for FormatBinaryLogRecord().
+ *
+ * @return false if the format string has a conversion that cannot be recorded, such as %n or a wide string: the message is
+ *         then to be formatted right away.
+ */
+bool EncodeBinaryLogRecord(BinaryLogRecord & record, uint64_t timestampUs, const char * module, uint8_t category,
+                           const char * format, va_list args);
+
+/**
+ * Format a recorded log message, as vsnprintf() would have.
+ *
+ * @return The length of the message written to buffer, which is null-terminated.
+ */
+size_t FormatBinaryLogRecord(const BinaryLogRecord & record, char * buffer, size_t bufferSize);
+
+/**
+ * A lock-free queue of log messages, which any number of threads can log into, and one or more threads take them from to
+ * write them out. A message logged while the queue is full is dropped, and counted.
+ */
+template <size_t N>
+class BinaryLogBuffer
+{
+public:
+    static_assert(N > 0 && (N & (N - 1)) == 0, "The number of records must be a power of two");
+
+    BinaryLogBuffer()
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Record a log message into the queue.
+     *
+     * @return false if the message cannot be recorded, and is to be formatted right away. A message dropped by a full queue
+     *         returns true.
+     */
+    bool Log(uint64_t timestampUs, const char * module, uint8_t category, const char * format, va_list args)
+    {
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+        Slot * slot;
+
+        for (;;)
+        {
+            slot         = &mSlots[pos & (N - 1)];
+            size_t seq   = slot->mSequence.load(std::memory_order_acquire);
+            intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (dif == 0)
+            {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (dif < 0)
+            {
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            else
+            {
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        bool encoded = EncodeBinaryLogRecord(slot->mRecord, timestampUs, module, category, format, args);
+        if (!encoded)
+        {
+            // Leave an empty record in the slot, which is skipped
+            slot->mRecord.mFormat = nullptr;
+        }
+        slot->mSequence.store(pos + 1, std::memory_order_release);
+        return encoded;
+    }
+
+    /**
+     * Take the oldest log message out of the queue.
+     *
+     * @return false if the queue is empty, or the oldest message is still being recorded.
+     */
+    bool Pop(BinaryLogRecord & record)
+    {
+        size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+        Slot * slot;
+
+        do
+        {
+            for (;;)
+            {
+                slot         = &mSlots[pos & (N - 1)];
+                size_t seq   = slot->mSequence.load(std::memory_order_acquire);
+                intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                if (dif == 0)
+                {
+                    if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (dif < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = mDequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            record = slot->mRecord;
+            slot->mSequence.store(pos + N, std::memory_order_release);
+        } while (record.mFormat == nullptr);
+
+        return true;
+    }
+
+    /**
+     * The number of messages in the queue, which may be changing.
+     */
+    size_t GetCount() const
+    {
+        // The dequeue position never passes the enqueue position loaded after it
+        size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+        return mEnqueuePos.load(std::memory_order_relaxed) - dequeuePos;
+    }
+
+    /**
+     * Take the number of messages dropped since it was last taken.
+     */
+    uint32_t TakeDroppedCount() { return mDropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        BinaryLogRecord mRecord;
+    };
+
+    Slot mSlots[N];
+    std::atomic<size_t> mEnqueuePos{ 0 };
+    std::atomic<size_t> mDequeuePos{ 0 };
+    std::atomic<uint32_t> mDropped{ 0 };
+};
+
+} // namespace Logging
+} // namespace chip
@@ -51,55 +51,57 @@ std::atomic<LogRedirectCallback_t> sLogRedirectCallback{ nullptr };
  * modules.
  *
  * NOTE: The names must be in the order defined in the LogModule
- *       enumeration. Each name must be a fixed number of characters
- *       long (chip::Logging::kMaxModuleNameLen) padded with nulls as
- *       necessary.
+ *       enumeration, and at most chip::Logging::kMaxModuleNameLen
+ *       characters long.
  *
  */
-static const char ModuleNames[] = "-\0\0" // None
-                                  "IN\0"  // Inet
-                                  "BLE"   // BLE
-                                  "ML\0"  // MessageLayer
-                                  "SM\0"  // SecurityManager
-                                  "EM\0"  // ExchangeManager
-                                  "TLV"   // TLV
-                                  "ASN"   // ASN1
-                                  "CR\0"  // Crypto
-                                  "CTL"   // Controller
-                                  "AL\0"  // Alarm
-                                  "BDX"   // BulkDataTransfer
-                                  "DMG"   // DataManagement
-                                  "DC\0"  // DeviceControl
-                                  "DD\0"  // DeviceDescription
-                                  "ECH"   // Echo
-                                  "FP\0"  // FabricProvisioning
-                                  "NP\0"  // NetworkProvisioning
-                                  "SD\0"  // ServiceDirectory
-                                  "SP\0"  // ServiceProvisioning
-                                  "SWU"   // SoftwareUpdate
-                                  "TP\0"  // TokenPairing
-                                  "TS\0"  // TimeServices
-                                  "HB\0"  // Heartbeat
-                                  "CSL"   // chipSystemLayer
-                                  "EVL"   // Event Logging
-                                  "SPT"   // Support
-                                  "TOO"   // chipTool
-                                  "ZCL"   // Zcl
-                                  "SH\0"  // Shell
-                                  "DL\0"  // DeviceLayer
-                                  "SPL"   // SetupPayload
-                                  "SVR"   // AppServer
-                                  "DIS"   // Discovery
-    ;
-
-#define ModuleNamesCount ((sizeof(ModuleNames) - 1) / chip::Logging::kMaxModuleNameLen)
+static const char ModuleNames[][chip::Logging::kMaxModuleNameLen + 1] = {
+    "-",    // None
+    "IN",   // Inet
+    "BLE",  // BLE
+    "ML",   // MessageLayer
+    "SM",   // SecurityManager
+    "EM",   // ExchangeManager
+    "TLV",  // TLV
+    "ASN",  // ASN1
+    "CR",   // Crypto
+    "CTL",  // Controller
+    "AL",   // Alarm
+    "BDX",  // BulkDataTransfer
+    "DMG",  // DataManagement
+    "DC",   // DeviceControl
+    "DD",   // DeviceDescription
+    "ECH",  // Echo
+    "FP",   // FabricProvisioning
+    "NP",   // NetworkProvisioning
+    "SD",   // ServiceDirectory
+    "SP",   // ServiceProvisioning
+    "SWU",  // SoftwareUpdate
+    "TP",   // TokenPairing
+    "TS",   // TimeServices
+    "HB",   // Heartbeat
+    "CSL",  // chipSystemLayer
+    "EVL",  // Event Logging
+    "SPT",  // Support
+    "TOO",  // chipTool
+    "ZCL",  // Zcl
+    "SH",   // Shell
+    "DL",   // DeviceLayer
+    "SPL",  // SetupPayload
+    "SVR",  // AppServer
+    "DIS",  // Discovery
+};
+
+static_assert(sizeof(ModuleNames) / sizeof(ModuleNames[0]) == kLogModule_Max, "A module has no name");
+
+static const char * GetModuleNamePtr(uint8_t module)
+{
+    return ModuleNames[(module < kLogModule_Max) ? module : static_cast<uint8_t>(kLogModule_NotSpecified)];
+}
 
 void GetModuleName(char * buf, uint8_t bufSize, uint8_t module)
 {
-    const char * moduleNamePtr = ModuleNames + ((module < ModuleNamesCount) ? module * chip::Logging::kMaxModuleNameLen : 0);
-
-    snprintf(buf, bufSize, "%s", moduleNamePtr);
-    buf[chip::Logging::kMaxModuleNameLen] = 0;
+    snprintf(buf, bufSize, "%s", GetModuleNamePtr(module));
 }
 
 void SetLogRedirectCallback(LogRedirectCallback_t callback)
@@ -140,14 +142,12 @@ DLL_EXPORT void Log(uint8_t module, uint8_t category, const char * msg, ...)
 
 void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
 {
-    if (!IsCategoryEnabled(category))
+    if (!IsModuleCategoryEnabled(module, category))
     {
         return;
     }
 
-    char moduleName[chip::Logging::kMaxModuleNameLen + 1];
-    GetModuleName(moduleName, sizeof(moduleName), module);
-
+    const char * moduleName = GetModuleNamePtr(module);
     LogRedirectCallback_t redirect = sLogRedirectCallback.load();
 
     if (redirect != nullptr)
@@ -162,6 +162,8 @@ void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
 
 #if CHIP_LOG_FILTERING
 uint8_t gLogFilter = kLogCategory_Max;
+uint64_t gModuleLogFilter[kLogCategory_Max + 1] = { 0, UINT64_MAX, UINT64_MAX, UINT64_MAX };
+
 DLL_EXPORT bool IsCategoryEnabled(uint8_t category)
 {
     return (category <= gLogFilter);
@@ -175,6 +177,27 @@ DLL_EXPORT uint8_t GetLogFilter()
 DLL_EXPORT void SetLogFilter(uint8_t category)
 {
     gLogFilter = category;
+    for (uint8_t filterCategory = kLogCategory_Error; filterCategory <= kLogCategory_Max; filterCategory++)
+    {
+        gModuleLogFilter[filterCategory] = (filterCategory <= category) ? UINT64_MAX : 0;
+    }
+}
+
+DLL_EXPORT void SetModuleLogFilter(uint8_t module, uint8_t category)
+{
+    VerifyOrReturn(module < kLogModule_Max);
+
+    for (uint8_t filterCategory = kLogCategory_Error; filterCategory <= kLogCategory_Max; filterCategory++)
+    {
+        if (filterCategory <= category)
+        {
+            gModuleLogFilter[filterCategory] |= (1ULL << module);
+        }
+        else
+        {
+            gModuleLogFilter[filterCategory] &= ~(1ULL << module);
+        }
+    }
 }
 
 #else  // CHIP_LOG_FILTERING
@@ -194,6 +217,12 @@ DLL_EXPORT void SetLogFilter(uint8_t category)
 {
     (void) category;
 }
+
+DLL_EXPORT void SetModuleLogFilter(uint8_t module, uint8_t category)
+{
+    (void) module;
+    (void) category;
+}
 #endif // CHIP_LOG_FILTERING
 
 #endif /* _CHIP_USE_LOGGING */
@@ -77,6 +77,12 @@ void Log(uint8_t module, uint8_t category, const char * msg, ...);
 uint8_t GetLogFilter();
 void SetLogFilter(uint8_t category);
 
+/**
+ * Set the most detailed category of the messages of a module that are logged, overriding for that module the filter set by
+ * SetLogFilter() until it is called again.
+ */
+void SetModuleLogFilter(uint8_t module, uint8_t category);
+
 #ifndef CHIP_ERROR_LOGGING
 #define CHIP_ERROR_LOGGING 1
 #endif
@@ -85,6 +91,35 @@ void SetLogFilter(uint8_t category);
 #define CHIP_LOG_FILTERING 1
 #endif
 
+#if CHIP_LOG_FILTERING
+static_assert(kLogModule_Max <= 64, "The modules of a category filter must fit in a uint64_t");
+
+/**
+ * For each category, the bitmap of the modules whose messages in it are logged.
+ */
+extern uint64_t gModuleLogFilter[kLogCategory_Max + 1];
+
+inline bool IsModuleCategoryEnabled(uint8_t module, uint8_t category)
+{
+    return category <= kLogCategory_Max && module < kLogModule_Max && (gModuleLogFilter[category] & (1ULL << module)) != 0;
+}
+#else
+constexpr bool IsModuleCategoryEnabled(uint8_t, uint8_t)
+{
+    return true;
+}
+#endif // CHIP_LOG_FILTERING
+
+/*
+ * Logs a message whose category is compiled in for its module, per #CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY, and enabled, without
+ * evaluating its arguments otherwise. It is an expression, which the macros logging in a category may be used as.
+ */
+#define ChipInternalLog(MOD, CAT, MSG, ...)                                                                                        \
+    ((chip::Logging::kLogCategory_##CAT <= CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY(chip::Logging::kLogModule_##MOD) &&                 \
+      chip::Logging::IsModuleCategoryEnabled(chip::Logging::kLogModule_##MOD, chip::Logging::kLogCategory_##CAT))                  \
+         ? chip::Logging::Log(chip::Logging::kLogModule_##MOD, chip::Logging::kLogCategory_##CAT, MSG, ##__VA_ARGS__)              \
+         : (void) 0)
+
 #if CHIP_ERROR_LOGGING
 /**
  * @def ChipLogError(MOD, MSG, ...)
@@ -95,8 +130,7 @@ void SetLogFilter(uint8_t category);
  *
  */
 #ifndef ChipLogError
-#define ChipLogError(MOD, MSG, ...)                                                                                                \
-    chip::Logging::Log(chip::Logging::kLogModule_##MOD, chip::Logging::kLogCategory_Error, MSG, ##__VA_ARGS__)
+#define ChipLogError(MOD, MSG, ...) ChipInternalLog(MOD, Error, MSG, ##__VA_ARGS__)
 #endif
 #else
 #define ChipLogError(MOD, MSG, ...)
@@ -116,8 +150,7 @@ void SetLogFilter(uint8_t category);
  *
  */
 #ifndef ChipLogProgress
-#define ChipLogProgress(MOD, MSG, ...)                                                                                             \
-    chip::Logging::Log(chip::Logging::kLogModule_##MOD, chip::Logging::kLogCategory_Progress, MSG, ##__VA_ARGS__)
+#define ChipLogProgress(MOD, MSG, ...) ChipInternalLog(MOD, Progress, MSG, ##__VA_ARGS__)
 #endif
 #else
 #define ChipLogProgress(MOD, MSG, ...)
@@ -137,8 +170,7 @@ void SetLogFilter(uint8_t category);
  *
  */
 #ifndef ChipLogDetail
-#define ChipLogDetail(MOD, MSG, ...)                                                                                               \
-    chip::Logging::Log(chip::Logging::kLogModule_##MOD, chip::Logging::kLogCategory_Detail, MSG, ##__VA_ARGS__)
+#define ChipLogDetail(MOD, MSG, ...) ChipInternalLog(MOD, Detail, MSG, ##__VA_ARGS__)
 #endif
 #else
 #define ChipLogDetail(MOD, MSG, ...)
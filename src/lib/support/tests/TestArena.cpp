@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the Chip Arena API.
+ *
+ */
+
+#include <support/Arena.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+
+struct TestObject
+{
+    TestObject(uint32_t aValue) : mValue(aValue) {}
+    uint32_t mValue;
+    uint64_t mPadding;
+};
+
+void TestAllocateAligned(nlTestSuite * inSuite, void * inContext)
+{
+    ArenaAllocator<64> arena;
+
+    void * byte = arena.Allocate(1, 1);
+    NL_TEST_ASSERT(inSuite, byte != nullptr);
+    NL_TEST_ASSERT(inSuite, arena.Used() == 1);
+
+    // The next allocation is aligned past the byte.
+    void * word = arena.Allocate(sizeof(uint64_t), alignof(uint64_t));
+    NL_TEST_ASSERT(inSuite, word != nullptr);
+    NL_TEST_ASSERT(inSuite, reinterpret_cast<uintptr_t>(word) % alignof(uint64_t) == 0);
+    NL_TEST_ASSERT(inSuite, static_cast<uint8_t *>(word) > static_cast<uint8_t *>(byte));
+
+    TestObject * object = arena.New<TestObject>(42u);
+    NL_TEST_ASSERT(inSuite, object != nullptr);
+    NL_TEST_ASSERT(inSuite, object->mValue == 42);
+    NL_TEST_ASSERT(inSuite, reinterpret_cast<uintptr_t>(object) % alignof(TestObject) == 0);
+}
+
+void TestExhaustAndReset(nlTestSuite * inSuite, void * inContext)
+{
+    ArenaAllocator<32> arena;
+
+    NL_TEST_ASSERT(inSuite, arena.Allocate(24, 1) != nullptr);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(16, 1) == nullptr);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(8, 1) != nullptr);
+    NL_TEST_ASSERT(inSuite, arena.UnusedSize() == 0);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(1, 1) == nullptr);
+
+    // A reset frees everything at once.
+    arena.Reset();
+    NL_TEST_ASSERT(inSuite, arena.Used() == 0);
+    NL_TEST_ASSERT(inSuite, arena.Allocate(32, 1) != nullptr);
+}
+
+void TestFillUnused(nlTestSuite * inSuite, void * inContext)
+{
+    ArenaAllocator<16> arena;
+
+    NL_TEST_ASSERT(inSuite, arena.Allocate(3, 1) != nullptr);
+
+    // Memory filled before it is allocated is the one an unaligned allocation then returns.
+    uint8_t * unused = arena.Unused();
+    NL_TEST_ASSERT(inSuite, arena.UnusedSize() == 13);
+    unused[0] = 0xAB;
+    NL_TEST_ASSERT(inSuite, arena.Allocate(1, 1) == unused);
+    NL_TEST_ASSERT(inSuite, *unused == 0xAB);
+}
+
+int Setup(void * inContext)
+{
+    return SUCCESS;
+}
+
+int Teardown(void * inContext)
+{
+    return SUCCESS;
+}
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestAllocateAligned), NL_TEST_DEF_FN(TestExhaustAndReset),
+                                 NL_TEST_DEF_FN(TestFillUnused), NL_TEST_SENTINEL() };
+
+int TestArena()
+{
+    nlTestSuite theSuite = { "CHIP Arena tests", &sTests[0], Setup, Teardown };
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestArena);
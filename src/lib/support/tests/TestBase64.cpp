@@ -0,0 +1,256 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the base-64 encoding and decoding
+ *      functions, comparing the default alphabets, which may use vector code,
+ *      to the character conversion functions of the scalar code.
+ */
+
+#include <support/Base64.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+
+const char kBase64Chars[]    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char kBase64URLChars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+char ValToChar(uint8_t val)
+{
+    return (val < 64) ? kBase64Chars[val] : '=';
+}
+
+uint8_t CharToVal(uint8_t c)
+{
+    const char * found = (c != 0) ? strchr(kBase64Chars, c) : nullptr;
+    return (found != nullptr) ? static_cast<uint8_t>(found - kBase64Chars) : UINT8_MAX;
+}
+
+uint8_t URLCharToVal(uint8_t c)
+{
+    const char * found = (c != 0) ? strchr(kBase64URLChars, c) : nullptr;
+    return (found != nullptr) ? static_cast<uint8_t>(found - kBase64URLChars) : UINT8_MAX;
+}
+
+constexpr uint16_t kMaxLength = 300;
+
+void FillBytes(uint8_t * buf, uint16_t len)
+{
+    uint32_t state = 0x12345678;
+    for (uint16_t i = 0; i < len; i++)
+    {
+        state  = state * 1103515245 + 12345;
+        buf[i] = static_cast<uint8_t>(state >> 16);
+    }
+}
+
+void TestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    struct
+    {
+        const char * encoded;
+        const char * decoded;
+    } vectors[] = {
+        { "", "" },
+        { "Zg==", "f" },
+        { "Zm8=", "fo" },
+        { "Zm9v", "foo" },
+        { "Zm9vYg==", "foob" },
+        { "Zm9vYmE=", "fooba" },
+        { "Zm9vYmFy", "foobar" },
+        { "Zg", "f" },
+        { "Zm8", "fo" },
+        { "Zm9vYg", "foob" },
+        { "Zm9vYmE", "fooba" },
+    };
+    uint8_t buf[32];
+    char encoded[32];
+
+    for (const auto & vector : vectors)
+    {
+        uint16_t len = Base64Decode(vector.encoded, static_cast<uint16_t>(strlen(vector.encoded)), buf);
+        NL_TEST_ASSERT(inSuite, len == strlen(vector.decoded));
+        NL_TEST_ASSERT(inSuite, memcmp(buf, vector.decoded, len) == 0);
+    }
+
+    NL_TEST_ASSERT(inSuite, Base64Encode(reinterpret_cast<const uint8_t *>("foobar"), 6, encoded) == 8);
+    NL_TEST_ASSERT(inSuite, memcmp(encoded, "Zm9vYmFy", 8) == 0);
+
+    NL_TEST_ASSERT(inSuite, Base64URLDecode("QmFzZTY0D-8xMjM0D_8=", 20, buf) == 14);
+    NL_TEST_ASSERT(inSuite, Base64URLEncode(buf, 14, encoded) == 20);
+    NL_TEST_ASSERT(inSuite, memcmp(encoded, "QmFzZTY0D-8xMjM0D_8=", 20) == 0);
+    NL_TEST_ASSERT(inSuite, Base64Decode("QmFzZTY0D+8xMjM0D/8=", 20, buf) == 14);
+    NL_TEST_ASSERT(inSuite, Base64Encode(buf, 14, encoded) == 20);
+    NL_TEST_ASSERT(inSuite, memcmp(encoded, "QmFzZTY0D+8xMjM0D/8=", 20) == 0);
+
+    const char * errors[] = { "Z", "Z\x01" "9vYmFy", "Zm9vY", "Zm9vY;", "Zm9 vYg" };
+    for (const char * error : errors)
+    {
+        NL_TEST_ASSERT(inSuite, Base64Decode(error, static_cast<uint16_t>(strlen(error)), buf) == UINT16_MAX);
+    }
+}
+
+void TestEncodeLong(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t src[kMaxLength];
+    char encoded[BASE64_ENCODED_LEN(kMaxLength)];
+    char expected[BASE64_ENCODED_LEN(kMaxLength)];
+
+    FillBytes(src, kMaxLength);
+    for (uint16_t len = 0; len <= kMaxLength; len++)
+    {
+        uint16_t expectedLen = Base64Encode(src, len, expected, ValToChar);
+        NL_TEST_ASSERT(inSuite, expectedLen == BASE64_ENCODED_LEN(len));
+        NL_TEST_ASSERT(inSuite, Base64Encode(src, len, encoded) == expectedLen);
+        NL_TEST_ASSERT(inSuite, memcmp(encoded, expected, expectedLen) == 0);
+
+        for (uint16_t i = 0; i < expectedLen; i++)
+        {
+            expected[i] = (expected[i] == '+') ? '-' : (expected[i] == '/') ? '_' : expected[i];
+        }
+        NL_TEST_ASSERT(inSuite, Base64URLEncode(src, len, encoded) == expectedLen);
+        NL_TEST_ASSERT(inSuite, memcmp(encoded, expected, expectedLen) == 0);
+    }
+}
+
+void TestDecodeLong(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t src[kMaxLength];
+    char encoded[BASE64_ENCODED_LEN(kMaxLength)];
+    uint8_t decoded[kMaxLength];
+
+    FillBytes(src, kMaxLength);
+    for (uint16_t len = 0; len <= kMaxLength; len++)
+    {
+        uint16_t encodedLen = Base64Encode(src, len, encoded);
+
+        NL_TEST_ASSERT(inSuite, Base64Decode(encoded, encodedLen, decoded) == len);
+        NL_TEST_ASSERT(inSuite, memcmp(decoded, src, len) == 0);
+
+        // Without the padding
+        uint16_t unpaddedLen = encodedLen;
+        while (unpaddedLen > 0 && encoded[unpaddedLen - 1] == '=')
+        {
+            unpaddedLen--;
+        }
+        NL_TEST_ASSERT(inSuite, Base64Decode(encoded, unpaddedLen, decoded) == len);
+        NL_TEST_ASSERT(inSuite, memcmp(decoded, src, len) == 0);
+
+        // In place
+        uint8_t * inPlace = reinterpret_cast<uint8_t *>(encoded);
+        NL_TEST_ASSERT(inSuite, Base64Decode(encoded, encodedLen, inPlace) == len);
+        NL_TEST_ASSERT(inSuite, memcmp(inPlace, src, len) == 0);
+
+        encodedLen = Base64URLEncode(src, len, encoded);
+        NL_TEST_ASSERT(inSuite, Base64URLDecode(encoded, encodedLen, decoded) == len);
+        NL_TEST_ASSERT(inSuite, memcmp(decoded, src, len) == 0);
+    }
+}
+
+// Characters outside the alphabet anywhere in a long input are handled as by the scalar code.
+void TestDecodeLongInvalid(nlTestSuite * inSuite, void * inContext)
+{
+    const char replacements[] = { ';', '\x01', ' ', '\n', '=', '-', '_', '+', '/', '\x80', '\xff' };
+    uint8_t src[kMaxLength];
+    char encoded[BASE64_ENCODED_LEN(kMaxLength)];
+    uint8_t decoded[kMaxLength];
+    uint8_t expected[kMaxLength];
+
+    FillBytes(src, kMaxLength);
+    uint16_t encodedLen = Base64Encode(src, 96, encoded);
+
+    for (uint16_t pos = 0; pos < encodedLen; pos++)
+    {
+        for (char replacement : replacements)
+        {
+            char original = encoded[pos];
+            encoded[pos]  = replacement;
+
+            uint16_t expectedLen = Base64Decode(encoded, encodedLen, expected, CharToVal);
+            uint16_t decodedLen  = Base64Decode(encoded, encodedLen, decoded);
+            NL_TEST_ASSERT(inSuite, decodedLen == expectedLen);
+            NL_TEST_ASSERT(inSuite, expectedLen == UINT16_MAX || memcmp(decoded, expected, expectedLen) == 0);
+
+            expectedLen = Base64Decode(encoded, encodedLen, expected, URLCharToVal);
+            decodedLen  = Base64URLDecode(encoded, encodedLen, decoded);
+            NL_TEST_ASSERT(inSuite, decodedLen == expectedLen);
+            NL_TEST_ASSERT(inSuite, expectedLen == UINT16_MAX || memcmp(decoded, expected, expectedLen) == 0);
+
+            encoded[pos] = original;
+        }
+    }
+}
+
+void TestBase64Chunked32(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kLen = 3 * UINT16_MAX;
+    uint8_t * src           = new uint8_t[kLen];
+    char * encoded          = new char[BASE64_ENCODED_LEN(kLen)];
+    char * expected         = new char[BASE64_ENCODED_LEN(kLen)];
+    uint8_t * decoded       = new uint8_t[kLen];
+
+    for (uint32_t i = 0; i < kLen; i++)
+    {
+        src[i] = static_cast<uint8_t>(i ^ (i >> 8));
+    }
+
+    uint32_t encodedLen = Base64Encode32(src, kLen, encoded);
+    NL_TEST_ASSERT(inSuite, encodedLen == BASE64_ENCODED_LEN(kLen));
+    NL_TEST_ASSERT(inSuite, Base64Encode32(src, kLen, expected, ValToChar) == encodedLen);
+    NL_TEST_ASSERT(inSuite, memcmp(encoded, expected, encodedLen) == 0);
+
+    NL_TEST_ASSERT(inSuite, Base64Decode32(encoded, encodedLen, decoded) == kLen);
+    NL_TEST_ASSERT(inSuite, memcmp(decoded, src, kLen) == 0);
+
+    encoded[encodedLen - 100] = ';';
+    NL_TEST_ASSERT(inSuite, Base64Decode32(encoded, encodedLen, decoded) == UINT32_MAX);
+
+    delete[] src;
+    delete[] encoded;
+    delete[] expected;
+    delete[] decoded;
+}
+
+} // namespace
+
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("Vectors", TestVectors),
+    NL_TEST_DEF("EncodeLong", TestEncodeLong),
+    NL_TEST_DEF("DecodeLong", TestDecodeLong),
+    NL_TEST_DEF("DecodeLongInvalid", TestDecodeLongInvalid),
+    NL_TEST_DEF("Chunked32", TestBase64Chunked32),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestBase64(void)
+{
+    nlTestSuite theSuite = { "Base64", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBase64)
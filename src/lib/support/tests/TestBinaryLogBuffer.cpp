@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the Chip BinaryLogBuffer API.
+ *
+ */
+
+#include <support/UnitTestRegistration.h>
+#include <support/logging/BinaryLogBuffer.h>
+
+#include <nlunit-test.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+
+using namespace chip::Logging;
+
+BinaryLogBuffer<4> sBuffer;
+
+bool LogToBuffer(const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    bool recorded = sBuffer.Log(1234, "DMG", kLogCategory_Progress, format, args);
+    va_end(args);
+    return recorded;
+}
+
+// Checks that a message formatted from its record reads as vsnprintf() formats it.
+bool FormatsAsPrintf(const char * format, ...)
+{
+    char expected[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    char formatted[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    BinaryLogRecord record;
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(expected, sizeof(expected), format, args);
+    va_end(args);
+
+    va_start(args, format);
+    bool recorded = EncodeBinaryLogRecord(record, 0, "DMG", kLogCategory_Progress, format, args);
+    va_end(args);
+
+    return recorded && FormatBinaryLogRecord(record, formatted, sizeof(formatted)) == strlen(expected) &&
+        strcmp(formatted, expected) == 0;
+}
+
+void TestFormat(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, FormatsAsPrintf("no arguments, 100%%"));
+    NL_TEST_ASSERT(inSuite, FormatsAsPrintf("%d %i %u %x %X %o", -5, 7, 4000000000u, 255, 255, 8));
+    NL_TEST_ASSERT(inSuite,
+                   FormatsAsPrintf("%ld %lu %lld %llu %zu 0x%" PRIx64, -1L, 2UL, -3LL, 4ULL, static_cast<size_t>(5),
+                                   static_cast<uint64_t>(0xabc)));
+    NL_TEST_ASSERT(inSuite, FormatsAsPrintf("%hhu %hu %hd", 300, 70000, -2));
+    NL_TEST_ASSERT(inSuite, FormatsAsPrintf("[%5d] [%-5d] [%05d] [%+d] [%*d] [%*d] [%.*d]", 1, 2, 3, 4, 6, 5, -6, 7, 3, 8));
+    NL_TEST_ASSERT(inSuite, FormatsAsPrintf("%s %.3s [%10s] [%-10s] %.*s", "hello", "abcdef", "r", "l", 2, "xyz"));
+    NL_TEST_ASSERT(inSuite, FormatsAsPrintf("%c%c %p %f %.2f %e %g", 'a', 'b', &sBuffer, 1.5, 2.345, 1e10, 0.1));
+}
+
+void TestTruncated(nlTestSuite * inSuite, void * inContext)
+{
+    char longString[2 * CHIP_CONFIG_BINARY_LOG_RECORD_SIZE];
+    char formatted[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    BinaryLogRecord record;
+
+    memset(longString, 'a', sizeof(longString) - 1);
+    longString[sizeof(longString) - 1] = '\0';
+
+    // The string is cut short to fit in the record, and the arguments past it are left out.
+    NL_TEST_ASSERT(inSuite, LogToBuffer("%s %d", longString, 5));
+    NL_TEST_ASSERT(inSuite, sBuffer.Pop(record));
+    NL_TEST_ASSERT(inSuite, record.mTruncated);
+    size_t length = FormatBinaryLogRecord(record, formatted, sizeof(formatted));
+    NL_TEST_ASSERT(inSuite, length > 3 && length < strlen(longString));
+    NL_TEST_ASSERT(inSuite, strcmp(formatted + length - 3, "...") == 0);
+
+    // A message formatted into a buffer too small for it is cut short.
+    NL_TEST_ASSERT(inSuite, LogToBuffer("%s", "abcdef"));
+    NL_TEST_ASSERT(inSuite, sBuffer.Pop(record));
+    NL_TEST_ASSERT(inSuite, FormatBinaryLogRecord(record, formatted, 4) == 3);
+    NL_TEST_ASSERT(inSuite, strcmp(formatted, "abc") == 0);
+}
+
+void TestQueue(nlTestSuite * inSuite, void * inContext)
+{
+    char formatted[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    BinaryLogRecord record;
+
+    NL_TEST_ASSERT(inSuite, !sBuffer.Pop(record));
+
+    // A full buffer drops the messages, and counts them.
+    for (int i = 0; i < 6; i++)
+    {
+        NL_TEST_ASSERT(inSuite, LogToBuffer("message %d", i));
+    }
+    NL_TEST_ASSERT(inSuite, sBuffer.GetCount() == 4);
+    NL_TEST_ASSERT(inSuite, sBuffer.TakeDroppedCount() == 2);
+    NL_TEST_ASSERT(inSuite, sBuffer.TakeDroppedCount() == 0);
+
+    // A message that cannot be recorded is left to the caller, and skipped by the reader.
+    NL_TEST_ASSERT(inSuite, sBuffer.Pop(record));
+    NL_TEST_ASSERT(inSuite, !LogToBuffer("wide %ls", L"string"));
+
+    for (int i = 1; i < 4; i++)
+    {
+        char expected[16];
+        snprintf(expected, sizeof(expected), "message %d", i);
+        NL_TEST_ASSERT(inSuite, sBuffer.Pop(record));
+        FormatBinaryLogRecord(record, formatted, sizeof(formatted));
+        NL_TEST_ASSERT(inSuite, strcmp(formatted, expected) == 0);
+        NL_TEST_ASSERT(inSuite, record.mTimestampUs == 1234 && strcmp(record.mModule, "DMG") == 0);
+    }
+    NL_TEST_ASSERT(inSuite, !sBuffer.Pop(record));
+    NL_TEST_ASSERT(inSuite, sBuffer.GetCount() == 0);
+}
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestFormat), NL_TEST_DEF_FN(TestTruncated), NL_TEST_DEF_FN(TestQueue),
+                                 NL_TEST_SENTINEL() };
+
+int TestBinaryLogBuffer()
+{
+    nlTestSuite theSuite = { "CHIP BinaryLogBuffer tests", &sTests[0], nullptr, nullptr };
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBinaryLogBuffer);
@@ -109,12 +109,37 @@ static void TestBufferReader_Skip(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
 }
 
+static void TestBufferReader_ReadFixed(nlTestSuite * inSuite, void * inContext)
+{
+    TestReader reader;
+    uint8_t first;
+    uint16_t second;
+    uint32_t third;
+    uint64_t fourth;
+    CHIP_ERROR err = reader.ReadFixed(&first, &second, &third, &fourth).StatusCode();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, first == 0x01);
+    NL_TEST_ASSERT(inSuite, second == 0x0302);
+    NL_TEST_ASSERT(inSuite, third == 0x07060504);
+    NL_TEST_ASSERT(inSuite, fourth == 0x0f0e0d0c0b0a0908);
+    NL_TEST_ASSERT(inSuite, reader.OctetsRead() == 15);
+
+    // Nothing is read when the fields do not all fit, and the reader stays failed.
+    uint16_t fifth = 0;
+    uint16_t sixth = 0;
+    err            = reader.ReadFixed(&fifth, &sixth).StatusCode();
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, fifth == 0);
+    NL_TEST_ASSERT(inSuite, !reader.HasAtLeast(1));
+}
+
 #define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
 /**
  *   Test Suite. It lists all the test functions.
  */
 static const nlTest sTests[] = { NL_TEST_DEF_FN(TestBufferReader_Basic), NL_TEST_DEF_FN(TestBufferReader_Saturation),
-                                 NL_TEST_DEF_FN(TestBufferReader_Skip), NL_TEST_SENTINEL() };
+                                 NL_TEST_DEF_FN(TestBufferReader_Skip), NL_TEST_DEF_FN(TestBufferReader_ReadFixed),
+                                 NL_TEST_SENTINEL() };
 
 int TestBufferReader(void)
 {
@@ -202,11 +202,57 @@ void TestPutBigEndian(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void TestReserve(nlTestSuite * inSuite, void * inContext)
+{
+    {
+        BWTest<LittleEndian::BufferWriter> bb(4);
+        bb.Put8('h');
+        uint8_t * reserved = bb.Reserve(2);
+        NL_TEST_ASSERT(inSuite, reserved != nullptr);
+        reserved[0] = 'i';
+        reserved[1] = '!';
+        bb.Put8('?');
+        NL_TEST_ASSERT(inSuite, bb.expect("hi!?", 4, 0));
+    }
+
+    {
+        BWTest<LittleEndian::BufferWriter> bb(2);
+        bb.Put8('h');
+        NL_TEST_ASSERT(inSuite, bb.Reserve(2) == nullptr);
+        NL_TEST_ASSERT(inSuite, bb.expect("h\xfe", 3, 0));
+    }
+}
+
+void TestPutFixed(nlTestSuite * inSuite, void * inContext)
+{
+    {
+        BWTest<LittleEndian::BufferWriter> bb(7);
+        bb.PutFixed(static_cast<uint8_t>(0x01), static_cast<uint16_t>(0x0302), static_cast<uint32_t>(0x07060504));
+        NL_TEST_ASSERT(inSuite, bb.expect("\x01\x02\x03\x04\x05\x06\x07", 7, 0));
+    }
+
+    {
+        BWTest<BigEndian::BufferWriter> bb(7);
+        bb.PutFixed(static_cast<uint8_t>(0x01), static_cast<uint16_t>(0x0203), static_cast<uint32_t>(0x04050607));
+        NL_TEST_ASSERT(inSuite, bb.expect("\x01\x02\x03\x04\x05\x06\x07", 7, 0));
+    }
+
+    {
+        // None of the fields is written when they do not all fit, but all of them are counted.
+        BWTest<LittleEndian::BufferWriter> bb(4);
+        bb.Put8('h');
+        bb.PutFixed(static_cast<uint16_t>(0x6968), static_cast<uint16_t>(0x2121));
+        NL_TEST_ASSERT(inSuite, bb.expect("h\xfe\xfe\xfe", 5, 0));
+    }
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("TestStringWrite", TestStringWrite),         //
     NL_TEST_DEF("TestBufferWrite", TestBufferWrite),         //
     NL_TEST_DEF("TestPutLittleEndian", TestPutLittleEndian), //
     NL_TEST_DEF("TestPutBigEndian", TestPutBigEndian),       //
+    NL_TEST_DEF("TestReserve", TestReserve),                 //
+    NL_TEST_DEF("TestPutFixed", TestPutFixed),               //
     NL_TEST_SENTINEL()                                       //
 };
 
@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -190,10 +191,48 @@ void TestBytesToHexErrors(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Inputs long enough for the vector code, of every length around its blocks, compared to a byte at a time conversion.
+void TestBytesToHexLong(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t src[100];
+    char dest[2 * sizeof(src) + 2];
+    char expected[2 * sizeof(src) + 2];
+
+    for (size_t i = 0; i < sizeof(src); i++)
+    {
+        src[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+
+    for (size_t len = 0; len <= sizeof(src); len++)
+    {
+        for (size_t i = 0; i < len; i++)
+        {
+            snprintf(&expected[2 * i], 3, "%02X", src[i]);
+        }
+        expected[2 * len]     = '\0';
+        expected[2 * len + 1] = '@';
+
+        memset(dest, '@', sizeof(dest));
+        NL_TEST_ASSERT(inSuite,
+                       BytesToHex(&src[0], len, &dest[0], sizeof(dest), HexFlags::kUppercaseAndNullTerminate) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(&dest[0], &expected[0], 2 * len + 2) == 0);
+
+        for (size_t i = 0; i < 2 * len; i++)
+        {
+            expected[i] = static_cast<char>(tolower(expected[i]));
+        }
+        memset(dest, '@', sizeof(dest));
+        NL_TEST_ASSERT(inSuite, BytesToHex(&src[0], len, &dest[0], 2 * len, HexFlags::kNone) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(&dest[0], &expected[0], 2 * len) == 0);
+        NL_TEST_ASSERT(inSuite, dest[2 * len] == '@');
+    }
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("TestBytesToHexNotNullTerminated", TestBytesToHexNotNullTerminated), //
     NL_TEST_DEF("TestBytesToHexNullTerminated", TestBytesToHexNullTerminated),       //
     NL_TEST_DEF("TestBytesToHexErrors", TestBytesToHexErrors),                       //
+    NL_TEST_DEF("TestBytesToHexLong", TestBytesToHexLong),                           //
     NL_TEST_SENTINEL()                                                               //
 };
 
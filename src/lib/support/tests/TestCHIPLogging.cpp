@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the compile-time and runtime filtering of the Chip logging macros.
+ *
+ */
+
+// Compile in no more than the progress messages of the Inet module, and all the messages of the others.
+#define CHIP_CONFIG_LOG_MODULE_MAX_CATEGORY(module)                                                                                \
+    ((module) == chip::Logging::kLogModule_Inet ? chip::Logging::kLogCategory_Progress : chip::Logging::kLogCategory_Detail)
+
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip::Logging;
+
+int sLoggedCount;
+char sLoggedModule[kMaxModuleNameLen + 1];
+
+void CountLoggedMessage(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    sLoggedCount++;
+    strncpy(sLoggedModule, module, sizeof(sLoggedModule) - 1);
+}
+
+int CountEvaluation(int & count)
+{
+    return ++count;
+}
+
+void TestCompiledOut(nlTestSuite * inSuite, void * inContext)
+{
+    int evaluations = 0;
+
+    SetLogRedirectCallback(CountLoggedMessage);
+    sLoggedCount = 0;
+
+    ChipLogProgress(Inet, "%d", CountEvaluation(evaluations));
+    NL_TEST_ASSERT(inSuite, sLoggedCount == 1 && evaluations == 1);
+    NL_TEST_ASSERT(inSuite, strcmp(sLoggedModule, "IN") == 0);
+
+    // The arguments of a message that is compiled out are not evaluated
+    ChipLogDetail(Inet, "%d", CountEvaluation(evaluations));
+    NL_TEST_ASSERT(inSuite, sLoggedCount == 1 && evaluations == 1);
+
+    ChipLogDetail(BDX, "%d", CountEvaluation(evaluations));
+    NL_TEST_ASSERT(inSuite, sLoggedCount == 2 && evaluations == 2);
+    NL_TEST_ASSERT(inSuite, strcmp(sLoggedModule, "BDX") == 0);
+
+    SetLogRedirectCallback(nullptr);
+}
+
+int CheckLoggedInAction(int value)
+{
+    VerifyOrExit(value > 0, ChipLogError(BDX, "Invalid value %d", value));
+    return 0;
+exit:
+    return -1;
+}
+
+void TestLogInAction(nlTestSuite * inSuite, void * inContext)
+{
+    SetLogRedirectCallback(CountLoggedMessage);
+    sLoggedCount = 0;
+
+    NL_TEST_ASSERT(inSuite, CheckLoggedInAction(1) == 0 && sLoggedCount == 0);
+    NL_TEST_ASSERT(inSuite, CheckLoggedInAction(0) == -1 && sLoggedCount == 1);
+
+    SetLogRedirectCallback(nullptr);
+}
+
+#if CHIP_LOG_FILTERING
+void TestModuleFilter(nlTestSuite * inSuite, void * inContext)
+{
+    int evaluations = 0;
+
+    SetLogRedirectCallback(CountLoggedMessage);
+    sLoggedCount = 0;
+
+    SetLogFilter(kLogCategory_Progress);
+    SetModuleLogFilter(kLogModule_BDX, kLogCategory_Detail);
+    SetModuleLogFilter(kLogModule_Zcl, kLogCategory_Error);
+    NL_TEST_ASSERT(inSuite, IsModuleCategoryEnabled(kLogModule_BDX, kLogCategory_Detail));
+    NL_TEST_ASSERT(inSuite, IsModuleCategoryEnabled(kLogModule_Echo, kLogCategory_Progress));
+    NL_TEST_ASSERT(inSuite, !IsModuleCategoryEnabled(kLogModule_Echo, kLogCategory_Detail));
+    NL_TEST_ASSERT(inSuite, !IsModuleCategoryEnabled(kLogModule_Zcl, kLogCategory_Progress));
+
+    // The arguments of a message that is filtered out are not evaluated either
+    ChipLogDetail(Echo, "%d", CountEvaluation(evaluations));
+    ChipLogProgress(Zcl, "%d", CountEvaluation(evaluations));
+    NL_TEST_ASSERT(inSuite, sLoggedCount == 0 && evaluations == 0);
+
+    ChipLogDetail(BDX, "%d", CountEvaluation(evaluations));
+    ChipLogError(Zcl, "%d", CountEvaluation(evaluations));
+    NL_TEST_ASSERT(inSuite, sLoggedCount == 2 && evaluations == 2);
+
+    // Setting the filter of all the modules again undoes the filters of each
+    SetLogFilter(kLogCategory_Max);
+    NL_TEST_ASSERT(inSuite, IsModuleCategoryEnabled(kLogModule_Zcl, kLogCategory_Detail));
+
+    SetLogRedirectCallback(nullptr);
+}
+#endif // CHIP_LOG_FILTERING
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestCompiledOut), NL_TEST_DEF_FN(TestLogInAction),
+#if CHIP_LOG_FILTERING
+                                 NL_TEST_DEF_FN(TestModuleFilter),
+#endif // CHIP_LOG_FILTERING
+                                 NL_TEST_SENTINEL() };
+
+int TestCHIPLogging()
+{
+    nlTestSuite theSuite = { "CHIP logging tests", &sTests[0], nullptr, nullptr };
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCHIPLogging);
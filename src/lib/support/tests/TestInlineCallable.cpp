@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <support/InlineCallable.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+// Counts its live instances, and can only be moved
+class Tracked
+{
+public:
+    static int sLive;
+
+    explicit Tracked(int value) : mValue(value) { sLive++; }
+    Tracked(Tracked && other) : mValue(other.mValue) { sLive++; }
+    ~Tracked() { sLive--; }
+
+    Tracked(const Tracked &) = delete;
+
+    int mValue;
+};
+
+int Tracked::sLive = 0;
+
+int Add(int a, int b)
+{
+    return a + b;
+}
+
+void TestCall(nlTestSuite * inSuite, void * inContext)
+{
+    InlineCallable<int(int, int)> add(Add);
+    NL_TEST_ASSERT(inSuite, add);
+    NL_TEST_ASSERT(inSuite, add(2, 3) == 5);
+
+    int calls = 0;
+    InlineCallable<void()> count([&calls]() { calls++; });
+    count();
+    count();
+    NL_TEST_ASSERT(inSuite, calls == 2);
+
+    InlineCallable<void()> empty;
+    NL_TEST_ASSERT(inSuite, !empty);
+    InlineCallable<void()> null(nullptr);
+    NL_TEST_ASSERT(inSuite, !null);
+}
+
+void TestMove(nlTestSuite * inSuite, void * inContext)
+{
+    {
+        InlineCallable<int()> first([tracked = Tracked(7)]() { return tracked.mValue; });
+        NL_TEST_ASSERT(inSuite, Tracked::sLive == 1);
+
+        InlineCallable<int()> second(std::move(first));
+        NL_TEST_ASSERT(inSuite, !first);
+        NL_TEST_ASSERT(inSuite, second() == 7);
+        NL_TEST_ASSERT(inSuite, Tracked::sLive == 1);
+
+        // Assigning destroys the callable held before
+        InlineCallable<int()> third([tracked = Tracked(8)]() { return tracked.mValue; });
+        NL_TEST_ASSERT(inSuite, Tracked::sLive == 2);
+        third = std::move(second);
+        NL_TEST_ASSERT(inSuite, Tracked::sLive == 1);
+        NL_TEST_ASSERT(inSuite, third() == 7);
+
+        third.Reset();
+        NL_TEST_ASSERT(inSuite, !third);
+        NL_TEST_ASSERT(inSuite, Tracked::sLive == 0);
+
+        third = [tracked = Tracked(9)]() { return tracked.mValue; };
+        NL_TEST_ASSERT(inSuite, third() == 9);
+    }
+    NL_TEST_ASSERT(inSuite, Tracked::sLive == 0);
+}
+
+void TestArguments(nlTestSuite * inSuite, void * inContext)
+{
+    // Move-only arguments are forwarded
+    InlineCallable<int(Tracked)> take([](Tracked tracked) { return tracked.mValue; });
+    NL_TEST_ASSERT(inSuite, take(Tracked(3)) == 3);
+
+    int value = 0;
+    InlineCallable<void(int &)> set([](int & target) { target = 4; });
+    set(value);
+    NL_TEST_ASSERT(inSuite, value == 4);
+
+    NL_TEST_ASSERT(inSuite, Tracked::sLive == 0);
+}
+
+void TestStorageSize(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t bytes[32] = { 1 };
+    InlineCallable<uint8_t(), sizeof(bytes)> large([bytes]() { return bytes[0]; });
+    NL_TEST_ASSERT(inSuite, large() == 1);
+    NL_TEST_ASSERT(inSuite, sizeof(large) < sizeof(bytes) + 2 * sizeof(std::max_align_t));
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("Call", TestCall),               //
+    NL_TEST_DEF("Move", TestMove),               //
+    NL_TEST_DEF("Arguments", TestArguments),     //
+    NL_TEST_DEF("StorageSize", TestStorageSize), //
+    NL_TEST_SENTINEL()                           //
+};
+
+} // namespace
+
+int TestInlineCallable(void)
+{
+    nlTestSuite theSuite = { "InlineCallable", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestInlineCallable)
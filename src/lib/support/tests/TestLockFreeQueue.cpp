@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the Chip LockFreeQueue API.
+ *
+ */
+
+#include <support/LockFreeQueue.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+struct Value
+{
+    uint32_t mId;
+    uint8_t mPayload[12];
+};
+
+void TestPushPop(nlTestSuite * inSuite, void * inContext)
+{
+    chip::LockFreeQueue<Value, 4> queue;
+    Value value;
+
+    NL_TEST_ASSERT(inSuite, queue.GetCount() == 0);
+    NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        value = { i, { static_cast<uint8_t>(i + 1) } };
+        NL_TEST_ASSERT(inSuite, queue.Push(value));
+    }
+
+    // A full queue refuses values, rather than overwriting the oldest one.
+    value.mId = 4;
+    NL_TEST_ASSERT(inSuite, !queue.Push(value));
+    NL_TEST_ASSERT(inSuite, queue.GetCount() == 4);
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Pop(value));
+        NL_TEST_ASSERT(inSuite, value.mId == i);
+        NL_TEST_ASSERT(inSuite, value.mPayload[0] == i + 1);
+    }
+    NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+    NL_TEST_ASSERT(inSuite, queue.GetCount() == 0);
+}
+
+void TestWrapAround(nlTestSuite * inSuite, void * inContext)
+{
+    chip::LockFreeQueue<uint32_t, 4> queue;
+    uint32_t next     = 0;
+    uint32_t expected = 0;
+    uint32_t value;
+
+    // Interleave pushes and pops, so that the positions go round the slots many times.
+    for (uint32_t round = 0; round < 100; round++)
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Push(next++));
+        }
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == expected++);
+        }
+        while (queue.GetCount() > 1)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == expected++);
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, queue.GetCount() == 1);
+    NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == expected++);
+    NL_TEST_ASSERT(inSuite, expected == next);
+}
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestPushPop), NL_TEST_DEF_FN(TestWrapAround), NL_TEST_SENTINEL() };
+
+int TestLockFreeQueue()
+{
+    nlTestSuite theSuite = { "CHIP LockFreeQueue tests", &sTests[0], nullptr, nullptr };
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestLockFreeQueue);
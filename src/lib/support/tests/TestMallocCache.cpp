@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <support/MallocCache.h>
+#include <support/UnitTestRegistration.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <nlunit-test.h>
+
+using namespace chip::Platform;
+
+namespace {
+
+constexpr size_t kDepth = 4;
+using TestCache         = MallocCache<kDepth>;
+
+// Allocator hooks counting the blocks they hand out
+size_t gLiveBlocks = 0;
+size_t gAllocCalls = 0;
+
+void * CountingAlloc(size_t size)
+{
+    gAllocCalls++;
+    gLiveBlocks++;
+    return malloc(size);
+}
+
+void * CountingCalloc(size_t num, size_t size)
+{
+    gAllocCalls++;
+    gLiveBlocks++;
+    return calloc(num, size);
+}
+
+void * CountingRealloc(void * p, size_t size)
+{
+    return realloc(p, size);
+}
+
+void CountingFree(void * p)
+{
+    gLiveBlocks--;
+    free(p);
+}
+
+const MallocHooks kCountingHooks = { CountingAlloc, CountingCalloc, CountingRealloc, CountingFree };
+
+void CheckSizeClasses(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, MallocSizeClass(0) == 0);
+    NL_TEST_ASSERT(inSuite, MallocSizeClass(kMallocSmallestSizeClass) == 0);
+    NL_TEST_ASSERT(inSuite, MallocSizeClass(kMallocSmallestSizeClass + 1) == 1);
+    NL_TEST_ASSERT(inSuite, MallocSizeClass(kMallocLargestSizeClass) == kMallocSizeClassCount - 1);
+    NL_TEST_ASSERT(inSuite, MallocSizeClass(kMallocLargestSizeClass + 1) == kMallocSizeClassCount);
+}
+
+void CheckReuse(nlTestSuite * inSuite, void * inContext)
+{
+    MallocCounters counters;
+    MallocStats stats;
+    gLiveBlocks = gAllocCalls = 0;
+    {
+        TestCache cache(kCountingHooks, &counters);
+
+        void * p1 = cache.Alloc(100);
+        NL_TEST_ASSERT(inSuite, p1 != nullptr);
+        NL_TEST_ASSERT(inSuite, reinterpret_cast<uintptr_t>(p1) % alignof(std::max_align_t) == 0);
+        memset(p1, 0xa5, 100);
+        cache.Free(p1);
+        NL_TEST_ASSERT(inSuite, cache.GetCachedCount(MallocSizeClass(100)) == 1);
+
+        // Any size of the same class gets the cached block back
+        void * p2 = cache.Alloc(128);
+        NL_TEST_ASSERT(inSuite, p2 == p1);
+        NL_TEST_ASSERT(inSuite, gAllocCalls == 1);
+
+        // Blocks freed beyond the depth go back to the allocator
+        void * blocks[kDepth + 2];
+        for (void *& block : blocks)
+        {
+            block = cache.Alloc(20);
+        }
+        for (void * block : blocks)
+        {
+            cache.Free(block);
+        }
+        NL_TEST_ASSERT(inSuite, cache.GetCachedCount(0) == kDepth);
+        NL_TEST_ASSERT(inSuite, gLiveBlocks == kDepth + 1);
+
+        cache.Free(p2);
+        counters.GetStats(stats);
+        NL_TEST_ASSERT(inSuite, stats.mNumCacheHits == 1);
+        NL_TEST_ASSERT(inSuite, stats.mNumCacheMisses == kDepth + 3);
+    }
+
+    // Destroying the cache returns its blocks
+    NL_TEST_ASSERT(inSuite, gLiveBlocks == 0);
+}
+
+void CheckLargeBlocks(nlTestSuite * inSuite, void * inContext)
+{
+    gLiveBlocks = gAllocCalls = 0;
+    TestCache cache(kCountingHooks, nullptr);
+
+    uint8_t * p = static_cast<uint8_t *>(cache.Calloc(1, kMallocLargestSizeClass + 1));
+    NL_TEST_ASSERT(inSuite, p != nullptr);
+    NL_TEST_ASSERT(inSuite, p[0] == 0 && p[kMallocLargestSizeClass] == 0);
+    cache.Free(p);
+    NL_TEST_ASSERT(inSuite, gLiveBlocks == 0);
+
+    NL_TEST_ASSERT(inSuite, cache.Calloc(SIZE_MAX / 2, 4) == nullptr);
+}
+
+void CheckRealloc(nlTestSuite * inSuite, void * inContext)
+{
+    gLiveBlocks = gAllocCalls = 0;
+    TestCache cache(kCountingHooks, nullptr);
+
+    uint8_t * p = static_cast<uint8_t *>(cache.Realloc(nullptr, 10));
+    NL_TEST_ASSERT(inSuite, p != nullptr);
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        p[i] = i;
+    }
+
+    // Stays in place within its size class
+    NL_TEST_ASSERT(inSuite, cache.Realloc(p, kMallocSmallestSizeClass) == p);
+
+    // Moves to a larger class, then out of the classes, keeping the contents
+    uint8_t * moved = static_cast<uint8_t *>(cache.Realloc(p, kMallocSmallestSizeClass + 1));
+    NL_TEST_ASSERT(inSuite, moved != nullptr && moved != p);
+    moved = static_cast<uint8_t *>(cache.Realloc(moved, kMallocLargestSizeClass * 2));
+    NL_TEST_ASSERT(inSuite, moved != nullptr);
+    moved = static_cast<uint8_t *>(cache.Realloc(moved, kMallocLargestSizeClass * 4));
+    NL_TEST_ASSERT(inSuite, moved != nullptr);
+
+    // And back into a class
+    moved = static_cast<uint8_t *>(cache.Realloc(moved, 32));
+    NL_TEST_ASSERT(inSuite, moved != nullptr);
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        NL_TEST_ASSERT(inSuite, moved[i] == i);
+    }
+
+    cache.Free(moved);
+    cache.Clear();
+    NL_TEST_ASSERT(inSuite, gLiveBlocks == 0);
+}
+
+void CheckCounters(nlTestSuite * inSuite, void * inContext)
+{
+    MallocCounters counters;
+    MallocStats stats;
+    int block;
+
+    counters.CountAllocation(&block, 1);
+    counters.CountAllocation(&block, kMallocLargestSizeClass + 1);
+    counters.CountAllocation(nullptr, 1);
+    MallocCounters::Increment(counters.mNumFrees);
+
+    counters.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumAllocations == 2);
+    NL_TEST_ASSERT(inSuite, stats.mNumFailedAllocations == 1);
+    NL_TEST_ASSERT(inSuite, stats.GetLiveAllocations() == 1);
+    NL_TEST_ASSERT(inSuite, stats.mNumAllocationsBySize[0] == 1);
+    NL_TEST_ASSERT(inSuite, stats.mNumAllocationsBySize[kMallocSizeClassCount] == 1);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("SizeClasses", CheckSizeClasses), //
+    NL_TEST_DEF("Reuse", CheckReuse),             //
+    NL_TEST_DEF("LargeBlocks", CheckLargeBlocks), //
+    NL_TEST_DEF("Realloc", CheckRealloc),         //
+    NL_TEST_DEF("Counters", CheckCounters),       //
+    NL_TEST_SENTINEL()                            //
+};
+
+} // namespace
+
+int TestMallocCache(void)
+{
+    nlTestSuite theSuite = { "MallocCache", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMallocCache)
@@ -165,6 +165,85 @@ static void CheckWriteNextCounterStart(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, value == 0x20000);
 }
 
+static void CheckAdaptiveEpoch(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistedCounterContext * context = static_cast<TestPersistedCounterContext *>(inContext);
+    CHIP_ERROR err                        = CHIP_NO_ERROR;
+    chip::PersistedCounter counter, counter2;
+    const char * testKey = "testcounter";
+    uint64_t value       = 0;
+
+    InitializePersistedStorage(context);
+
+    err = counter.Init(testKey, 0x100, 0x400);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.GetEpoch() == 0x100);
+    NL_TEST_ASSERT(inSuite, counter.GetWriteCount() == 1);
+
+    // The epoch doubles every time it runs out, up to the maximum: 0x100, 0x200, 0x400, 0x400.
+    for (int32_t i = 0; i < 0x1000; i++)
+    {
+        err = counter.Advance();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    NL_TEST_ASSERT(inSuite, counter.GetValue() == 0x1000);
+    NL_TEST_ASSERT(inSuite, counter.GetEpoch() == 0x400);
+    NL_TEST_ASSERT(inSuite, counter.GetWriteCount() == 6);
+
+    // The next start point covers the values vended, and the epoch starts over.
+    err = counter2.Init(testKey, 0x100, 0x400);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    value = counter2.GetValue();
+    NL_TEST_ASSERT(inSuite, value == 0x1300);
+    NL_TEST_ASSERT(inSuite, counter2.GetEpoch() == 0x100);
+
+    err = counter2.Init(testKey, 0x100, 0x80);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_INTEGER_VALUE);
+}
+
+static void CheckReserve(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistedCounterContext * context = static_cast<TestPersistedCounterContext *>(inContext);
+    CHIP_ERROR err                        = CHIP_NO_ERROR;
+    chip::PersistedCounter counter, counter2;
+    const char * testKey = "testcounter";
+    uint32_t first       = 0;
+
+    InitializePersistedStorage(context);
+
+    err = counter.Init(testKey, 0x100);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Within the epoch, reserving takes no write.
+    err = counter.Reserve(0x10, first);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, first == 0);
+    NL_TEST_ASSERT(inSuite, counter.GetValue() == 0x10);
+    NL_TEST_ASSERT(inSuite, counter.GetWriteCount() == 1);
+
+    // A block larger than the epoch takes a single write.
+    err = counter.Reserve(0x1000, first);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, first == 0x10);
+    NL_TEST_ASSERT(inSuite, counter.GetValue() == 0x1010);
+    NL_TEST_ASSERT(inSuite, counter.GetWriteCount() == 2);
+
+    err = counter.Advance();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.GetWriteCount() == 2);
+
+    // After a reboot, the values reserved are never vended again.
+    err = counter2.Init(testKey, 0x100);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter2.GetValue() == 0x1110);
+
+    err = counter2.Reserve(UINT32_MAX, first);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, counter2.GetValue() == 0x1110);
+}
+
 // Test Suite
 
 /**
@@ -174,6 +253,8 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Out of box Test", CheckOOB),                                 //
     NL_TEST_DEF("Reboot Test", CheckReboot),                                  //
     NL_TEST_DEF("Write Next Counter Start Test", CheckWriteNextCounterStart), //
+    NL_TEST_DEF("Adaptive Epoch Test", CheckAdaptiveEpoch),                   //
+    NL_TEST_DEF("Reserve Test", CheckReserve),                                //
     NL_TEST_SENTINEL()                                                        //
 };
 
@@ -129,6 +129,44 @@ void TestCreateReleaseStruct(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void TestReuseReleasedObjects(nlTestSuite * inSuite, void * inContext)
+{
+    // Spans several usage words, the last one partially.
+    constexpr const size_t size = 150;
+    BitMapObjectPool<uint32_t, size> pool;
+    std::set<uint32_t *> released;
+    uint32_t * obj[size];
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        obj[i] = pool.CreateObject();
+        NL_TEST_ASSERT(inSuite, obj[i] != nullptr);
+    }
+    NL_TEST_ASSERT(inSuite, pool.CreateObject() == nullptr);
+
+    // Objects released from any word, before or after the last allocation, are handed out again, and only them.
+    for (size_t i : { 0, 63, 64, 100, 149 })
+    {
+        pool.ReleaseObject(obj[i]);
+        released.insert(obj[i]);
+    }
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == size - released.size());
+    for (size_t i = 0; i < 5; ++i)
+    {
+        uint32_t * reused = pool.CreateObject();
+        NL_TEST_ASSERT(inSuite, released.erase(reused) == 1);
+    }
+    NL_TEST_ASSERT(inSuite, pool.CreateObject() == nullptr);
+    NL_TEST_ASSERT(inSuite, pool.Exhausted());
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        pool.ReleaseObject(obj[i]);
+    }
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == 0);
+}
+
 int Setup(void * inContext)
 {
     return SUCCESS;
@@ -146,7 +184,8 @@ int Teardown(void * inContext)
  *   Test Suite. It lists all the test functions.
  */
 static const nlTest sTests[] = { NL_TEST_DEF_FN(TestReleaseNull), NL_TEST_DEF_FN(TestCreateReleaseObject),
-                                 NL_TEST_DEF_FN(TestCreateReleaseStruct), NL_TEST_SENTINEL() };
+                                 NL_TEST_DEF_FN(TestCreateReleaseStruct), NL_TEST_DEF_FN(TestReuseReleasedObjects),
+                                 NL_TEST_SENTINEL() };
 
 int TestPool()
 {
@@ -144,6 +144,99 @@ void TestSerializableIntegerSetSerialize(nlTestSuite * inSuite, void * inContext
     NL_TEST_ASSERT(inSuite, !set.Contains(7));
 }
 
+void TestSortedIntegerSet(nlTestSuite * inSuite, void * inContext)
+{
+    chip::SortedU64Set<8> set;
+    NL_TEST_ASSERT(inSuite, !set.Contains(123));
+
+    NL_TEST_ASSERT(inSuite, set.Insert(123) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Insert(123) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Contains(123));
+    NL_TEST_ASSERT(inSuite, set.Count() == 1);
+
+    set.Remove(123);
+    NL_TEST_ASSERT(inSuite, !set.Contains(123));
+    NL_TEST_ASSERT(inSuite, set.Count() == 0);
+
+    // Zero and UINT64_MAX are values like any other.
+    const uint64_t values[] = { 40, 0, UINT64_MAX, 7, 1000, 8, 39, 41 };
+    for (uint64_t value : values)
+    {
+        NL_TEST_ASSERT(inSuite, set.Insert(value) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, set.Insert(9) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, set.Insert(40) == CHIP_NO_ERROR);
+
+    for (uint64_t value : values)
+    {
+        NL_TEST_ASSERT(inSuite, set.Contains(value));
+    }
+    NL_TEST_ASSERT(inSuite, !set.Contains(9));
+    for (uint16_t i = 1; i < set.Count(); i++)
+    {
+        NL_TEST_ASSERT(inSuite, set.At(static_cast<uint16_t>(i - 1)) < set.At(i));
+    }
+
+    set.Remove(0);
+    set.Remove(40);
+    set.Remove(UINT64_MAX);
+    set.Remove(9);
+    NL_TEST_ASSERT(inSuite, set.Count() == 5);
+    NL_TEST_ASSERT(inSuite, set.At(0) == 7);
+    NL_TEST_ASSERT(inSuite, set.At(4) == 1000);
+    NL_TEST_ASSERT(inSuite, !set.Contains(40));
+    NL_TEST_ASSERT(inSuite, set.Contains(41));
+}
+
+void TestSortedIntegerSetSerialize(nlTestSuite * inSuite, void * inContext)
+{
+    chip::SortedU64Set<8> set;
+    uint8_t buf[CHIP_MAX_DELTA_ENCODED_SIZE_U64(8)];
+    size_t len = sizeof(buf);
+
+    NL_TEST_ASSERT(inSuite, set.Serialize(buf, len) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, len == 0);
+
+    // Close values take a byte each after the first one.
+    for (uint64_t i = 0x1122334455667700; i < 0x1122334455667706; i++)
+    {
+        NL_TEST_ASSERT(inSuite, set.Insert(i) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, set.Insert(UINT64_MAX) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.SerializedSize() == 9 + 5 + 10);
+
+    len = 4;
+    NL_TEST_ASSERT(inSuite, set.Serialize(buf, len) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, len == set.SerializedSize());
+
+    len = sizeof(buf);
+    NL_TEST_ASSERT(inSuite, set.Serialize(buf, len) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, len == set.SerializedSize());
+
+    chip::SortedU64Set<8> set2;
+    NL_TEST_ASSERT(inSuite, set2.Deserialize(buf, len) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set2.Count() == set.Count());
+    for (uint16_t i = 0; i < set.Count(); i++)
+    {
+        NL_TEST_ASSERT(inSuite, set2.At(i) == set.At(i));
+    }
+
+    // A set too small for the values, a truncated varint, a repeated value and an overflow are all rejected.
+    chip::SortedU64Set<4> small;
+    NL_TEST_ASSERT(inSuite, small.Deserialize(buf, len) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, small.Count() == 0);
+    NL_TEST_ASSERT(inSuite, set2.Deserialize(buf, len - 1) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, set2.Count() == 0);
+
+    const uint8_t repeated[] = { 0x05, 0x00 };
+    NL_TEST_ASSERT(inSuite, set2.Deserialize(repeated, sizeof(repeated)) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint8_t overflow[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01 };
+    NL_TEST_ASSERT(inSuite, set2.Deserialize(overflow, sizeof(overflow)) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, set2.Deserialize(overflow, sizeof(overflow) - 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set2.Count() == 1 && set2.At(0) == UINT64_MAX);
+}
+
 int Setup(void * inContext)
 {
     CHIP_ERROR error = chip::Platform::MemoryInit();
@@ -168,6 +261,8 @@ static const nlTest sTests[] = {
     NL_TEST_DEF_FN(TestSerializableIntegerSet),          //
     NL_TEST_DEF_FN(TestSerializableIntegerSetNonZero),   //
     NL_TEST_DEF_FN(TestSerializableIntegerSetSerialize), //
+    NL_TEST_DEF_FN(TestSortedIntegerSet),                //
+    NL_TEST_DEF_FN(TestSortedIntegerSetSerialize),       //
     NL_TEST_SENTINEL()                                   //
 };
 
@@ -42,11 +42,34 @@ static void SpanConstructors(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, s2.size() == 3);
 }
 
+static void MutableSpanReduceSize(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t arr[] = { 1, 2, 3 };
+    MutableByteSpan s1(arr);
+
+    NL_TEST_ASSERT(inSuite, s1.data() == arr);
+    NL_TEST_ASSERT(inSuite, s1.size() == 3);
+
+    s1.data()[0] = 4;
+    NL_TEST_ASSERT(inSuite, arr[0] == 4);
+
+    s1.reduce_size(2);
+    NL_TEST_ASSERT(inSuite, s1.size() == 2);
+
+    // The span never grows past the buffer it was given.
+    s1.reduce_size(3);
+    NL_TEST_ASSERT(inSuite, s1.size() == 2);
+
+    ByteSpan s2 = s1;
+    NL_TEST_ASSERT(inSuite, s2.data() == arr);
+    NL_TEST_ASSERT(inSuite, s2.size() == 2);
+}
+
 #define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
 /**
  *   Test Suite. It lists all the test functions.
  */
-static const nlTest sTests[] = { NL_TEST_DEF_FN(SpanConstructors), NL_TEST_SENTINEL() };
+static const nlTest sTests[] = { NL_TEST_DEF_FN(SpanConstructors), NL_TEST_DEF_FN(MutableSpanReduceSize), NL_TEST_SENTINEL() };
 
 int TestSpan(void)
 {
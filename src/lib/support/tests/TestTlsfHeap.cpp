@@ -0,0 +1,263 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <support/TlsfHeap.h>
+#include <support/UnitTestRegistration.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+template <size_t kSize>
+struct HeapBuffer
+{
+    alignas(TlsfHeap::kAlignment) uint8_t mBytes[kSize];
+};
+
+void AllocAndFree(nlTestSuite * inSuite, void * inContext)
+{
+    static HeapBuffer<1024> buffer;
+    TlsfHeap heap;
+    TlsfHeap::Stats stats;
+
+    heap.Init(buffer.mBytes, sizeof(buffer.mBytes));
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mHeapSize == sizeof(buffer.mBytes));
+    NL_TEST_ASSERT(inSuite, stats.mNumFreeBlocks == 1);
+    const size_t kLargest = stats.mLargestFreeBlock;
+
+    void * p1 = heap.Alloc(10);
+    void * p2 = heap.Alloc(100);
+    void * p3 = heap.Alloc(1);
+    NL_TEST_ASSERT(inSuite, p1 != nullptr && p2 != nullptr && p3 != nullptr);
+    NL_TEST_ASSERT(inSuite, reinterpret_cast<uintptr_t>(p1) % TlsfHeap::kAlignment == 0);
+    NL_TEST_ASSERT(inSuite, reinterpret_cast<uintptr_t>(p2) % TlsfHeap::kAlignment == 0);
+    NL_TEST_ASSERT(inSuite, heap.IsAllocated(p2, 100));
+    NL_TEST_ASSERT(inSuite, !heap.IsAllocated(p2, 1000));
+    memset(p1, 0x11, 10);
+    memset(p2, 0x22, 100);
+    memset(p3, 0x33, 1);
+
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumAllocations == 3);
+    NL_TEST_ASSERT(inSuite, stats.mBytesInUse >= 111);
+
+    // Freeing in any order merges everything back into a single block
+    heap.Free(p2);
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumFreeBlocks == 2);
+    heap.Free(p1);
+    heap.Free(p3);
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumAllocations == 0);
+    NL_TEST_ASSERT(inSuite, stats.mBytesInUse == 0);
+    NL_TEST_ASSERT(inSuite, stats.mNumFreeBlocks == 1);
+    NL_TEST_ASSERT(inSuite, stats.mLargestFreeBlock == kLargest);
+    NL_TEST_ASSERT(inSuite, stats.GetFragmentationPercent() == 0);
+
+    // The whole heap can be allocated at once, and no more
+    p1 = heap.Alloc(kLargest);
+    NL_TEST_ASSERT(inSuite, p1 != nullptr);
+    NL_TEST_ASSERT(inSuite, heap.Alloc(1) == nullptr);
+    heap.Free(p1);
+    NL_TEST_ASSERT(inSuite, heap.Alloc(kLargest + 1) == nullptr);
+
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumFailedAllocations == 2);
+    NL_TEST_ASSERT(inSuite, stats.mBytesInUseHighWatermark == sizeof(buffer.mBytes));
+}
+
+void Realloc(nlTestSuite * inSuite, void * inContext)
+{
+    static HeapBuffer<1024> buffer;
+    TlsfHeap heap;
+    TlsfHeap::Stats stats;
+
+    heap.Init(buffer.mBytes, sizeof(buffer.mBytes));
+
+    uint8_t * p1 = static_cast<uint8_t *>(heap.Realloc(nullptr, 32));
+    NL_TEST_ASSERT(inSuite, p1 != nullptr);
+    for (uint8_t i = 0; i < 32; i++)
+    {
+        p1[i] = i;
+    }
+
+    // Grows in place into the free space that follows
+    uint8_t * p2 = static_cast<uint8_t *>(heap.Realloc(p1, 200));
+    NL_TEST_ASSERT(inSuite, p2 == p1);
+
+    // Moves when the next block is in use, keeping the contents
+    void * blocker = heap.Alloc(16);
+    NL_TEST_ASSERT(inSuite, blocker != nullptr);
+    p2 = static_cast<uint8_t *>(heap.Realloc(p1, 400));
+    NL_TEST_ASSERT(inSuite, p2 != nullptr && p2 != p1);
+    for (uint8_t i = 0; i < 32; i++)
+    {
+        NL_TEST_ASSERT(inSuite, p2[i] == i);
+    }
+
+    // Shrinks in place, and fails without freeing
+    NL_TEST_ASSERT(inSuite, heap.Realloc(p2, 8) == p2);
+    NL_TEST_ASSERT(inSuite, heap.Realloc(p2, 4096) == nullptr);
+    NL_TEST_ASSERT(inSuite, heap.IsAllocated(p2, 8));
+
+    NL_TEST_ASSERT(inSuite, heap.Realloc(p2, 0) == nullptr);
+    heap.Free(blocker);
+
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumAllocations == 0);
+    NL_TEST_ASSERT(inSuite, stats.mNumFreeBlocks == 1);
+}
+
+void Fragmentation(nlTestSuite * inSuite, void * inContext)
+{
+    // Exactly as large as the blocks allocated below
+    static HeapBuffer<32 * (64 + 16)> buffer;
+    TlsfHeap heap;
+    TlsfHeap::Stats stats;
+    void * blocks[32];
+
+    heap.Init(buffer.mBytes, sizeof(buffer.mBytes));
+    for (void *& block : blocks)
+    {
+        block = heap.Alloc(64);
+        NL_TEST_ASSERT(inSuite, block != nullptr);
+    }
+
+    // Every other block freed leaves holes that cannot be merged
+    for (size_t i = 0; i < 32; i += 2)
+    {
+        heap.Free(blocks[i]);
+    }
+
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumFreeBlocks == 16);
+    NL_TEST_ASSERT(inSuite, stats.mLargestFreeBlock == 64);
+    NL_TEST_ASSERT(inSuite, stats.GetFragmentationPercent() > 90);
+    NL_TEST_ASSERT(inSuite, heap.Alloc(65) == nullptr);
+
+    // The holes are reused for allocations that fit them
+    void * reused = heap.Alloc(64);
+    NL_TEST_ASSERT(inSuite, reused != nullptr);
+    heap.Free(reused);
+
+    for (size_t i = 1; i < 32; i += 2)
+    {
+        heap.Free(blocks[i]);
+    }
+
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumFreeBlocks == 1);
+    NL_TEST_ASSERT(inSuite, stats.GetFragmentationPercent() == 0);
+}
+
+void Tags(nlTestSuite * inSuite, void * inContext)
+{
+    static HeapBuffer<1024> buffer;
+    TlsfHeap heap;
+    TlsfHeap::Stats stats;
+
+    heap.Init(buffer.mBytes, sizeof(buffer.mBytes));
+
+    void * p1 = heap.Alloc(32, static_cast<uint8_t>(Platform::MemoryTag::kCrypto));
+    void * p2 = heap.Alloc(32, static_cast<uint8_t>(Platform::MemoryTag::kTransport));
+    void * p3 = heap.Realloc(p1, 300);
+    NL_TEST_ASSERT(inSuite, p2 != nullptr && p3 != nullptr);
+
+    heap.GetStats(stats);
+    const size_t kCrypto    = stats.mBytesInUseByTag[static_cast<size_t>(Platform::MemoryTag::kCrypto)];
+    const size_t kTransport = stats.mBytesInUseByTag[static_cast<size_t>(Platform::MemoryTag::kTransport)];
+    NL_TEST_ASSERT(inSuite, kCrypto >= 300);
+    NL_TEST_ASSERT(inSuite, kTransport >= 32 && kTransport < 300);
+    NL_TEST_ASSERT(inSuite, kCrypto + kTransport == stats.mBytesInUse);
+
+    heap.Free(p3);
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mBytesInUseByTag[static_cast<size_t>(Platform::MemoryTag::kCrypto)] == 0);
+    heap.Free(p2);
+}
+
+void RandomAllocAndFree(nlTestSuite * inSuite, void * inContext)
+{
+    static HeapBuffer<8192> buffer;
+    TlsfHeap heap;
+    TlsfHeap::Stats stats;
+    uint8_t * blocks[64] = {};
+    size_t sizes[64]     = {};
+
+    heap.Init(buffer.mBytes, sizeof(buffer.mBytes));
+    srand(1234);
+
+    for (int round = 0; round < 5000; round++)
+    {
+        size_t i = static_cast<size_t>(rand()) % 64;
+        if (blocks[i] != nullptr)
+        {
+            // The contents survive the allocations around them
+            for (size_t j = 0; j < sizes[i]; j++)
+            {
+                NL_TEST_ASSERT(inSuite, blocks[i][j] == static_cast<uint8_t>(i));
+            }
+            heap.Free(blocks[i]);
+            blocks[i] = nullptr;
+        }
+        else
+        {
+            sizes[i]  = static_cast<size_t>(rand()) % 300;
+            blocks[i] = static_cast<uint8_t *>(heap.Alloc(sizes[i]));
+            if (blocks[i] != nullptr)
+            {
+                memset(blocks[i], static_cast<int>(i), sizes[i]);
+            }
+        }
+    }
+
+    for (uint8_t * block : blocks)
+    {
+        heap.Free(block);
+    }
+
+    heap.GetStats(stats);
+    NL_TEST_ASSERT(inSuite, stats.mNumAllocations == 0);
+    NL_TEST_ASSERT(inSuite, stats.mNumFreeBlocks == 1);
+    NL_TEST_ASSERT(inSuite, stats.mBytesInUse == 0);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("AllocAndFree", AllocAndFree),             //
+    NL_TEST_DEF("Realloc", Realloc),                       //
+    NL_TEST_DEF("Fragmentation", Fragmentation),           //
+    NL_TEST_DEF("Tags", Tags),                             //
+    NL_TEST_DEF("RandomAllocAndFree", RandomAllocAndFree), //
+    NL_TEST_SENTINEL()                                     //
+};
+
+} // namespace
+
+int TestTlsfHeap(void)
+{
+    nlTestSuite theSuite = { "TlsfHeap", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestTlsfHeap)
@@ -28,15 +28,17 @@ namespace Messaging {
 
 CHIP_ERROR ApplicationExchangeDispatch::SendMessageImpl(SecureSessionHandle session, PayloadHeader & payloadHeader,
                                                         System::PacketBufferHandle && message,
-                                                        EncryptedPacketBufferHandle * retainedMessage)
+                                                        EncryptedPacketBufferHandle * retainedMessage,
+                                                        Transport::TrafficClass trafficClass)
 {
-    return mSessionMgr->SendMessage(session, payloadHeader, std::move(message), retainedMessage);
+    return mSessionMgr->SendMessage(session, payloadHeader, std::move(message), retainedMessage, trafficClass);
 }
 
 CHIP_ERROR ApplicationExchangeDispatch::ResendMessage(SecureSessionHandle session, EncryptedPacketBufferHandle message,
-                                                      EncryptedPacketBufferHandle * retainedMessage) const
+                                                      EncryptedPacketBufferHandle * retainedMessage,
+                                                      Transport::TrafficClass trafficClass) const
 {
-    return mSessionMgr->SendEncryptedMessage(session, std::move(message), retainedMessage);
+    return mSessionMgr->SendEncryptedMessage(session, std::move(message), retainedMessage, trafficClass);
 }
 
 bool ApplicationExchangeDispatch::MessagePermitted(uint16_t protocol, uint8_t type)
@@ -56,6 +58,8 @@ bool ApplicationExchangeDispatch::MessagePermitted(uint16_t protocol, uint8_t ty
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR1):
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR2):
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR3):
+        case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume):
+        case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR2Resume):
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaErr):
             return false;
 
@@ -46,13 +46,13 @@ public:
     }
 
     CHIP_ERROR ResendMessage(SecureSessionHandle session, EncryptedPacketBufferHandle message,
-                             EncryptedPacketBufferHandle * retainedMessage) const override;
+                             EncryptedPacketBufferHandle * retainedMessage, Transport::TrafficClass trafficClass) const override;
 
     SecureSessionMgr * GetSessionMgr() const { return mSessionMgr; }
 
 protected:
     CHIP_ERROR SendMessageImpl(SecureSessionHandle session, PayloadHeader & payloadHeader, System::PacketBufferHandle && message,
-                               EncryptedPacketBufferHandle * retainedMessage) override;
+                               EncryptedPacketBufferHandle * retainedMessage, Transport::TrafficClass trafficClass) override;
 
     bool MessagePermitted(uint16_t protocol, uint8_t type) override;
 
@@ -76,6 +76,13 @@ void ExchangeContext::SetResponseTimeout(Timeout timeout)
     mResponseTimeout = timeout;
 }
 
+uint16_t ExchangeContext::GetMaxPayloadLength() const
+{
+    VerifyOrReturnError(mExchangeMgr != nullptr && mExchangeMgr->GetSessionMgr() != nullptr,
+                        static_cast<uint16_t>(kMaxAppMessageLen));
+    return mExchangeMgr->GetSessionMgr()->GetMaxAppMessageLength(mSecureSession);
+}
+
 CHIP_ERROR ExchangeContext::SendMessage(Protocols::Id protocolId, uint8_t msgType, PacketBufferHandle msgBuf,
                                         const SendFlags & sendFlags)
 {
@@ -96,11 +103,8 @@ CHIP_ERROR ExchangeContext::SendMessage(Protocols::Id protocolId, uint8_t msgTyp
         err = messageCounterSyncMgr->AddToRetransmissionTable(protocolId, msgType, sendFlags, std::move(msgBuf), this);
         ReturnErrorOnFailure(err);
 
-        // Initiate message counter synchronization if no message counter synchronization is in progress.
-        if (!state->IsMsgCounterSyncInProgress())
-        {
-            err = mExchangeMgr->GetMessageCounterSyncMgr()->SendMsgCounterSyncReq(mSecureSession);
-        }
+        // Initiate message counter synchronization, unless a request to the peer is in flight already.
+        err = messageCounterSyncMgr->SendMsgCounterSyncReq(mSecureSession);
     }
     else
     {
@@ -296,6 +300,7 @@ void ExchangeContext::Free()
     ExchangeManager * em = mExchangeMgr;
 
     DoClose(false);
+    em->RemoveFromIndex(*this);
     mExchangeMgr = nullptr;
     mAppState    = nullptr;
 
@@ -335,47 +340,29 @@ bool ExchangeContext::MatchExchange(SecureSessionHandle session, const PacketHea
 
 CHIP_ERROR ExchangeContext::StartResponseTimer()
 {
-    System::Layer * lSystemLayer = mExchangeMgr->GetSessionMgr()->SystemLayer();
-    if (lSystemLayer == nullptr)
-    {
-        // this is an assertion error, which shall never happen
-        return CHIP_ERROR_INTERNAL;
-    }
-
-    return lSystemLayer->StartTimer(mResponseTimeout, HandleResponseTimeout, this);
+    return mExchangeMgr->ScheduleResponseTimeout(*this, mResponseTimeout);
 }
 
 void ExchangeContext::CancelResponseTimer()
 {
-    System::Layer * lSystemLayer = mExchangeMgr->GetSessionMgr()->SystemLayer();
-    if (lSystemLayer == nullptr)
-    {
-        // this is an assertion error, which shall never happen
-        return;
-    }
-
-    lSystemLayer->CancelTimer(HandleResponseTimeout, this);
+    mExchangeMgr->CancelResponseTimeout(*this);
 }
 
-void ExchangeContext::HandleResponseTimeout(System::Layer * aSystemLayer, void * aAppState, System::Error aError)
+void ExchangeContext::HandleResponseTimeout()
 {
-    ExchangeContext * ec = reinterpret_cast<ExchangeContext *>(aAppState);
-
-    if (ec == nullptr)
-        return;
-
     // NOTE: we don't set mResponseExpected to false here because the response could still arrive. If the user
     // wants to never receive the response, they must close the exchange context.
 
-    ExchangeDelegateBase * delegate = ec->GetDelegate();
+    ExchangeDelegateBase * delegate = GetDelegate();
 
     // Call the user's timeout handler.
     if (delegate != nullptr)
-        delegate->OnResponseTimeout(ec);
+        delegate->OnResponseTimeout(this);
 }
 
 CHIP_ERROR ExchangeContext::HandleMessage(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
-                                          const Transport::PeerAddress & peerAddress, PacketBufferHandle msgBuf)
+                                          const Transport::PeerAddress & peerAddress, MessageFlags msgFlags,
+                                          PacketBufferHandle msgBuf)
 {
     // We hold a reference to the ExchangeContext here to
     // guard against Close() calls(decrementing the reference
@@ -393,11 +380,13 @@ CHIP_ERROR ExchangeContext::HandleMessage(const PacketHeader & packetHeader, con
     }
 
     CHIP_ERROR err =
-        dispatch->OnMessageReceived(payloadHeader, packetHeader.GetMessageId(), peerAddress, GetReliableMessageContext());
+        dispatch->OnMessageReceived(payloadHeader, packetHeader.GetMessageId(), peerAddress, msgFlags, GetReliableMessageContext());
     SuccessOrExit(err);
 
     // The SecureChannel::StandaloneAck message type is only used for CRMP; do not pass such messages to the application layer.
-    if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck))
+    // Neither are duplicates, which were only to be acknowledged again.
+    if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck) ||
+        msgFlags.Has(MessageFlagValues::kDuplicateMessage))
     {
         ExitNow(err = CHIP_NO_ERROR);
     }
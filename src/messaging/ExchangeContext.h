@@ -33,6 +33,7 @@
 #include <support/DLLUtil.h>
 #include <system/SystemTimer.h>
 #include <transport/SecureSessionMgr.h>
+#include <transport/TrafficClass.h>
 
 namespace chip {
 
@@ -114,6 +115,8 @@ public:
      *
      *  @param[in]    peerAddress   The address of the sender
      *
+     *  @param[in]    msgFlags      The flags of the message, kDuplicateMessage for a duplicate only to be acknowledged.
+     *
      *  @param[in]    msgBuf        A handle to the packet buffer holding the CHIP message.
      *
      *  @retval  #CHIP_ERROR_INVALID_ARGUMENT               if an invalid argument was passed to this HandleMessage API.
@@ -122,7 +125,7 @@ public:
      *                                                       protocol layer.
      */
     CHIP_ERROR HandleMessage(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
-                             const Transport::PeerAddress & peerAddress, System::PacketBufferHandle msgBuf);
+                             const Transport::PeerAddress & peerAddress, MessageFlags msgFlags, System::PacketBufferHandle msgBuf);
 
     ExchangeDelegateBase * GetDelegate() const { return mDelegate; }
     void SetDelegate(ExchangeDelegateBase * delegate) { mDelegate = delegate; }
@@ -157,6 +160,20 @@ public:
 
     SecureSessionHandle GetSecureSessionHandle() const { return mSecureSession; }
 
+    /**
+     *  The largest payload of a message sent on the exchange, which is larger than kMaxAppMessageLen when the path to the
+     *  peer carries more than the minimum IPv6 MTU.
+     */
+    uint16_t GetMaxPayloadLength() const;
+
+    /**
+     *  The traffic class the messages of the exchange, and their retransmissions, are scheduled by while they wait to be sent.
+     *  Exchanges are interactive unless they carry reports or bulk transfers, which yield the link to the interactive ones.
+     */
+    void SetTrafficClass(Transport::TrafficClass trafficClass) { mTrafficClass = trafficClass; }
+
+    Transport::TrafficClass GetTrafficClass() const { return mTrafficClass; }
+
     /*
      * In order to use reference counting (see refCount below) we use a hold/free paradigm where users of the exchange
      * can hold onto it while it's out of their direct control to make sure it isn't closed before everyone's ready.
@@ -176,6 +193,12 @@ private:
 
     SecureSessionHandle mSecureSession; // The connection state
     uint16_t mExchangeId;               // Assigned exchange ID.
+    Transport::TrafficClass mTrafficClass = Transport::TrafficClass::kInteractive;
+
+    // The links and deadline of the exchange in the response timeout queue of its ExchangeManager, while it awaits a response.
+    ExchangeContext * mResponseTimeoutPrev = nullptr;
+    ExchangeContext * mResponseTimeoutNext = nullptr;
+    uint64_t mResponseDeadlineMs           = 0;
 
     ExchangeContext * Alloc(ExchangeManager * em, uint16_t ExchangeId, SecureSessionHandle session, bool Initiator,
                             ExchangeDelegateBase * delegate);
@@ -224,7 +247,7 @@ private:
     CHIP_ERROR SendMessageImpl(Protocols::Id protocolId, uint8_t msgType, System::PacketBufferHandle msgBuf,
                                const SendFlags & sendFlags, Transport::PeerConnectionState * state = nullptr);
     void CancelResponseTimer();
-    static void HandleResponseTimeout(System::Layer * aSystemLayer, void * aAppState, System::Error aError);
+    void HandleResponseTimeout();
 
     void DoClose(bool clearRetransTable);
 };
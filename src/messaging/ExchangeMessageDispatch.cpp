@@ -30,6 +30,7 @@
 
 #include <inttypes.h>
 
+#include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMessageDispatch.h>
 #include <messaging/ReliableMessageContext.h>
 #include <messaging/ReliableMessageMgr.h>
@@ -45,6 +46,8 @@ CHIP_ERROR ExchangeMessageDispatch::SendMessage(SecureSessionHandle session, uin
 {
     ReturnErrorCodeIf(!MessagePermitted(protocol.GetProtocolId(), type), CHIP_ERROR_INVALID_ARGUMENT);
 
+    const Transport::TrafficClass trafficClass = reliableMessageContext->GetExchangeContext()->GetTrafficClass();
+
     PayloadHeader payloadHeader;
     payloadHeader.SetExchangeID(exchangeId).SetMessageType(protocol, type).SetInitiator(isInitiator);
 
@@ -75,7 +78,7 @@ CHIP_ERROR ExchangeMessageDispatch::SendMessage(SecureSessionHandle session, uin
         // Add to Table for subsequent sending
         ReturnErrorOnFailure(mReliableMessageMgr->AddToRetransTable(reliableMessageContext, &entry));
 
-        CHIP_ERROR err = SendMessageImpl(session, payloadHeader, std::move(message), &entry->retainedBuf);
+        CHIP_ERROR err = SendMessageImpl(session, payloadHeader, std::move(message), &entry->retainedBuf, trafficClass);
         if (err != CHIP_NO_ERROR)
         {
             // Remove from table
@@ -92,14 +95,14 @@ CHIP_ERROR ExchangeMessageDispatch::SendMessage(SecureSessionHandle session, uin
     {
         // If the channel itself is providing reliability, let's not request CRMP acks
         payloadHeader.SetNeedsAck(false);
-        ReturnErrorOnFailure(SendMessageImpl(session, payloadHeader, std::move(message), nullptr));
+        ReturnErrorOnFailure(SendMessageImpl(session, payloadHeader, std::move(message), nullptr, trafficClass));
     }
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ExchangeMessageDispatch::OnMessageReceived(const PayloadHeader & payloadHeader, uint32_t messageId,
-                                                      const Transport::PeerAddress & peerAddress,
+                                                      const Transport::PeerAddress & peerAddress, MessageFlags msgFlags,
                                                       ReliableMessageContext * reliableMessageContext)
 {
     ReturnErrorCodeIf(!MessagePermitted(payloadHeader.GetProtocolID().GetProtocolId(), payloadHeader.GetMessageType()),
@@ -107,15 +110,15 @@ CHIP_ERROR ExchangeMessageDispatch::OnMessageReceived(const PayloadHeader & payl
 
     if (IsReliableTransmissionAllowed())
     {
-        if (payloadHeader.IsAckMsg() && payloadHeader.GetAckId().HasValue())
+        // The acknowledgement piggybacked on a duplicate was handled along with the original message.
+        if (payloadHeader.IsAckMsg() && payloadHeader.GetAckId().HasValue() &&
+            !msgFlags.Has(MessageFlagValues::kDuplicateMessage))
         {
             ReturnErrorOnFailure(reliableMessageContext->HandleRcvdAck(payloadHeader.GetAckId().Value()));
         }
 
         if (payloadHeader.NeedsAck())
         {
-            MessageFlags msgFlags;
-
             // An acknowledgment needs to be sent back to the peer for this message on this exchange,
             // Set the flag in message header indicating an ack requested by peer;
             msgFlags.Set(MessageFlagValues::kPeerRequestedAck);
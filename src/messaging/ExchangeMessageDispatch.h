@@ -23,7 +23,9 @@
 
 #pragma once
 
+#include <messaging/Flags.h>
 #include <transport/SecureSessionMgr.h>
+#include <transport/TrafficClass.h>
 
 namespace chip {
 namespace Messaging {
@@ -48,20 +50,21 @@ public:
                            uint8_t type, System::PacketBufferHandle message);
 
     virtual CHIP_ERROR ResendMessage(SecureSessionHandle session, EncryptedPacketBufferHandle message,
-                                     EncryptedPacketBufferHandle * retainedMessage) const
+                                     EncryptedPacketBufferHandle * retainedMessage, Transport::TrafficClass trafficClass) const
     {
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
 
     virtual CHIP_ERROR OnMessageReceived(const PayloadHeader & payloadHeader, uint32_t messageId,
-                                         const Transport::PeerAddress & peerAddress,
+                                         const Transport::PeerAddress & peerAddress, MessageFlags msgFlags,
                                          ReliableMessageContext * reliableMessageContext);
 
 protected:
     virtual bool MessagePermitted(uint16_t protocol, uint8_t type) = 0;
 
     virtual CHIP_ERROR SendMessageImpl(SecureSessionHandle session, PayloadHeader & payloadHeader,
-                                       System::PacketBufferHandle && message, EncryptedPacketBufferHandle * retainedMessage) = 0;
+                                       System::PacketBufferHandle && message, EncryptedPacketBufferHandle * retainedMessage,
+                                       Transport::TrafficClass trafficClass) = 0;
 
     virtual bool IsReliableTransmissionAllowed() { return true; }
 
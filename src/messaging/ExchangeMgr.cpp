@@ -42,6 +42,8 @@
 #include <support/CodeUtils.h>
 #include <support/RandUtils.h>
 #include <support/logging/CHIPLogging.h>
+#include <system/SystemStats.h>
+#include <system/SystemTrace.h>
 
 using namespace chip::Encoding;
 using namespace chip::Inet;
@@ -84,6 +86,7 @@ CHIP_ERROR ExchangeManager::Init(SecureSessionMgr * sessionMgr)
         // then re-initializes without removing registered handlers.
         handler.Reset();
     }
+    mHandlerIndex.Clear();
 
     sessionMgr->SetDelegate(this);
 
@@ -108,8 +111,19 @@ CHIP_ERROR ExchangeManager::Shutdown()
         assert(ec.GetReferenceCount() == 0);
     }
 
+    while (mResponseTimeoutHead != nullptr)
+    {
+        CancelResponseTimeout(*mResponseTimeoutHead);
+    }
+
     if (mSessionMgr != nullptr)
     {
+        if (mResponseTimerArmed && mSessionMgr->SystemLayer() != nullptr)
+        {
+            mSessionMgr->SystemLayer()->CancelTimer(HandleResponseTimer, this);
+        }
+        mResponseTimerArmed = false;
+
         mSessionMgr->SetDelegate(nullptr);
         mSessionMgr = nullptr;
     }
@@ -159,30 +173,157 @@ ExchangeContext * ExchangeManager::AllocContext(uint16_t ExchangeId, SecureSessi
     {
         if (ec.GetReferenceCount() == 0)
         {
-            return ec.Alloc(this, ExchangeId, session, Initiator, delegate);
+            ec.Alloc(this, ExchangeId, session, Initiator, delegate);
+            mExchangeIndex.Insert(static_cast<size_t>(&ec - mContextPool.data()),
+                                  ExchangeKey(ExchangeId, session.GetPeerNodeId()));
+            return &ec;
         }
     }
 
     ChipLogError(ExchangeManager, "Alloc ctxt FAILED");
+    SYSTEM_STATS_COUNT(chip::System::Stats::kExchangeMgr_NumContextAllocFailures);
     return nullptr;
 }
 
+void ExchangeManager::RemoveFromIndex(const ExchangeContext & ec)
+{
+    mExchangeIndex.Remove(static_cast<size_t>(&ec - mContextPool.data()),
+                          ExchangeKey(ec.GetExchangeId(), ec.GetSecureSessionHandle().GetPeerNodeId()));
+}
+
+CHIP_ERROR ExchangeManager::ScheduleResponseTimeout(ExchangeContext & ec, uint32_t timeoutMs)
+{
+    VerifyOrReturnError(mSessionMgr != nullptr && mSessionMgr->SystemLayer() != nullptr, CHIP_ERROR_INTERNAL);
+
+    CancelResponseTimeout(ec);
+    ec.mResponseDeadlineMs = System::Layer::GetClock_MonotonicMS() + timeoutMs;
+
+    // Most exchanges share their timeout, which makes the end of the queue the likeliest place for the new deadline
+    ExchangeContext * prev = mResponseTimeoutTail;
+    while (prev != nullptr && prev->mResponseDeadlineMs > ec.mResponseDeadlineMs)
+    {
+        prev = prev->mResponseTimeoutPrev;
+    }
+
+    ec.mResponseTimeoutPrev = prev;
+    ec.mResponseTimeoutNext = (prev != nullptr) ? prev->mResponseTimeoutNext : mResponseTimeoutHead;
+    if (prev != nullptr)
+    {
+        prev->mResponseTimeoutNext = &ec;
+    }
+    else
+    {
+        mResponseTimeoutHead = &ec;
+    }
+    if (ec.mResponseTimeoutNext != nullptr)
+    {
+        ec.mResponseTimeoutNext->mResponseTimeoutPrev = &ec;
+    }
+    else
+    {
+        mResponseTimeoutTail = &ec;
+    }
+
+    CHIP_ERROR err = ArmResponseTimer();
+    if (err != CHIP_NO_ERROR)
+    {
+        CancelResponseTimeout(ec);
+    }
+    return err;
+}
+
+void ExchangeManager::CancelResponseTimeout(ExchangeContext & ec)
+{
+    VerifyOrReturn(IsResponseTimeoutQueued(ec));
+
+    if (ec.mResponseTimeoutPrev != nullptr)
+    {
+        ec.mResponseTimeoutPrev->mResponseTimeoutNext = ec.mResponseTimeoutNext;
+    }
+    else
+    {
+        mResponseTimeoutHead = ec.mResponseTimeoutNext;
+    }
+    if (ec.mResponseTimeoutNext != nullptr)
+    {
+        ec.mResponseTimeoutNext->mResponseTimeoutPrev = ec.mResponseTimeoutPrev;
+    }
+    else
+    {
+        mResponseTimeoutTail = ec.mResponseTimeoutPrev;
+    }
+
+    ec.mResponseTimeoutPrev = nullptr;
+    ec.mResponseTimeoutNext = nullptr;
+}
+
+CHIP_ERROR ExchangeManager::ArmResponseTimer()
+{
+    VerifyOrReturnError(mResponseTimeoutHead != nullptr, CHIP_NO_ERROR);
+
+    const uint64_t deadlineMs = mResponseTimeoutHead->mResponseDeadlineMs;
+    const uint64_t nowMs      = System::Layer::GetClock_MonotonicMS();
+
+    // A timer armed for an earlier deadline re-arms itself for this one when it expires
+    VerifyOrReturnError(!mResponseTimerArmed || mResponseTimerDeadlineMs > deadlineMs, CHIP_NO_ERROR);
+
+    const uint32_t delayMs = (deadlineMs > nowMs) ? static_cast<uint32_t>(deadlineMs - nowMs) : 0;
+    ReturnErrorOnFailure(mSessionMgr->SystemLayer()->StartTimer(delayMs, HandleResponseTimer, this));
+    mResponseTimerArmed      = true;
+    mResponseTimerDeadlineMs = deadlineMs;
+    return CHIP_NO_ERROR;
+}
+
+void ExchangeManager::HandleResponseTimer(System::Layer * aSystemLayer, void * aAppState, System::Error aError)
+{
+    ExchangeManager * mgr = static_cast<ExchangeManager *>(aAppState);
+    const uint64_t nowMs  = System::Layer::GetClock_MonotonicMS();
+
+    mgr->mResponseTimerArmed = false;
+
+    // The delegates may close, reschedule or cancel any exchange: take the earliest one again after each of them
+    while (mgr->mResponseTimeoutHead != nullptr && mgr->mResponseTimeoutHead->mResponseDeadlineMs <= nowMs)
+    {
+        ExchangeContext * ec = mgr->mResponseTimeoutHead;
+
+        mgr->CancelResponseTimeout(*ec);
+        ec->HandleResponseTimeout();
+    }
+
+    CHIP_ERROR err = mgr->ArmResponseTimer();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(ExchangeManager, "Failed to arm the response timer: %s", ErrorStr(err));
+    }
+}
+
+ExchangeManager::UnsolicitedMessageHandler * ExchangeManager::FindUMH(Protocols::Id protocolId, int16_t msgType)
+{
+    size_t slot = mHandlerIndex.FindFirst(HandlerKey(protocolId, msgType), 0, [this, protocolId, msgType](size_t i) {
+        return UMHandlerPool[i].IsInUse() && UMHandlerPool[i].Matches(protocolId, msgType);
+    });
+
+    return (slot == HandlerIndex::kNotFound) ? nullptr : &UMHandlerPool[slot];
+}
+
 CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgType, ExchangeDelegateBase * delegate)
 {
-    UnsolicitedMessageHandler * umh      = UMHandlerPool;
+    UnsolicitedMessageHandler * umh      = FindUMH(protocolId, msgType);
     UnsolicitedMessageHandler * selected = nullptr;
 
+    if (umh != nullptr)
+    {
+        umh->Delegate = delegate;
+        return CHIP_NO_ERROR;
+    }
+
+    umh = UMHandlerPool;
     for (int i = 0; i < CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS; i++, umh++)
     {
         if (!umh->IsInUse())
         {
-            if (selected == nullptr)
-                selected = umh;
-        }
-        else if (umh->Matches(protocolId, msgType))
-        {
-            umh->Delegate = delegate;
-            return CHIP_NO_ERROR;
+            selected = umh;
+            break;
         }
     }
 
@@ -192,6 +333,7 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
     selected->Delegate    = delegate;
     selected->ProtocolId  = protocolId;
     selected->MessageType = msgType;
+    mHandlerIndex.Insert(static_cast<size_t>(selected - UMHandlerPool), HandlerKey(protocolId, msgType));
 
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
 
@@ -200,77 +342,84 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
 
 CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgType)
 {
-    UnsolicitedMessageHandler * umh = UMHandlerPool;
+    UnsolicitedMessageHandler * umh = FindUMH(protocolId, msgType);
 
-    for (int i = 0; i < CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS; i++, umh++)
-    {
-        if (umh->IsInUse() && umh->Matches(protocolId, msgType))
-        {
-            umh->Reset();
-            SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
-            return CHIP_NO_ERROR;
-        }
-    }
+    if (umh == nullptr)
+        return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
 
-    return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
+    umh->Reset();
+    mHandlerIndex.Remove(static_cast<size_t>(umh - UMHandlerPool), HandlerKey(protocolId, msgType));
+    SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
+
+    return CHIP_NO_ERROR;
 }
 
 void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                         SecureSessionHandle session, const Transport::PeerAddress & source,
                                         System::PacketBufferHandle msgBuf, SecureSessionMgr * msgLayer)
+{
+    SYSTEM_TRACE_SCOPE(ExchangeReceive);
+
+    DispatchMessage(packetHeader, payloadHeader, session, source, MessageFlags(), std::move(msgBuf));
+}
+
+void ExchangeManager::OnDuplicateMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                                 SecureSessionHandle session, const Transport::PeerAddress & source,
+                                                 SecureSessionMgr * msgLayer)
+{
+    // A duplicate is only acknowledged again, through the exchange it belongs to, or a temporary one
+    if (payloadHeader.NeedsAck())
+    {
+        DispatchMessage(packetHeader, payloadHeader, session, source, MessageFlags(MessageFlagValues::kDuplicateMessage),
+                        System::PacketBufferHandle());
+    }
+}
+
+void ExchangeManager::DispatchMessage(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                      SecureSessionHandle session, const Transport::PeerAddress & source, MessageFlags msgFlags,
+                                      System::PacketBufferHandle msgBuf)
 {
     CHIP_ERROR err                          = CHIP_NO_ERROR;
-    UnsolicitedMessageHandler * umh         = nullptr;
     UnsolicitedMessageHandler * matchingUMH = nullptr;
     bool sendAckAndCloseExchange            = false;
+    size_t slot;
 
     ChipLogProgress(ExchangeManager, "Received message of type %d and protocolId %d", payloadHeader.GetMessageType(),
                     payloadHeader.GetProtocolID());
 
     // Search for an existing exchange that the message applies to. If a match is found...
-    for (auto & ec : mContextPool)
+    slot = mExchangeIndex.FindFirst(ExchangeKey(payloadHeader.GetExchangeID(), session.GetPeerNodeId()), 0, [&](size_t i) {
+        ExchangeContext & ec = mContextPool[i];
+        return ec.GetReferenceCount() > 0 && ec.MatchExchange(session, packetHeader, payloadHeader);
+    });
+    if (slot != ExchangeIndex::kNotFound)
     {
-        if (ec.GetReferenceCount() > 0 && ec.MatchExchange(session, packetHeader, payloadHeader))
+        ExchangeContext & ec = mContextPool[slot];
+
+        // Found a matching exchange. Set flag for correct subsequent CRMP
+        // retransmission timeout selection.
+        if (!ec.HasRcvdMsgFromPeer())
         {
-            // Found a matching exchange. Set flag for correct subsequent CRMP
-            // retransmission timeout selection.
-            if (!ec.HasRcvdMsgFromPeer())
-            {
-                ec.SetMsgRcvdFromPeer(true);
-            }
+            ec.SetMsgRcvdFromPeer(true);
+        }
 
-            // Matched ExchangeContext; send to message handler.
-            ec.HandleMessage(packetHeader, payloadHeader, source, std::move(msgBuf));
+        // Matched ExchangeContext; send to message handler.
+        ec.HandleMessage(packetHeader, payloadHeader, source, msgFlags, std::move(msgBuf));
 
-            ExitNow(err = CHIP_NO_ERROR);
-        }
+        ExitNow(err = CHIP_NO_ERROR);
     }
 
     // Search for an unsolicited message handler if it marked as being sent by an initiator. Since we didn't
     // find an existing exchange that matches the message, it must be an unsolicited message. However all
-    // unsolicited messages must be marked as being from an initiator.
-    if (payloadHeader.IsInitiator())
+    // unsolicited messages must be marked as being from an initiator. Duplicates are not handled again.
+    if (payloadHeader.IsInitiator() && !msgFlags.Has(MessageFlagValues::kDuplicateMessage))
     {
         // Search for an unsolicited message handler that can handle the message. Prefer handlers that can explicitly
         // handle the message type over handlers that handle all messages for a profile.
-        umh = (UnsolicitedMessageHandler *) UMHandlerPool;
+        matchingUMH = FindUMH(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType());
 
-        matchingUMH = nullptr;
-
-        for (int i = 0; i < CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS; i++, umh++)
-        {
-            if (umh->IsInUse() && payloadHeader.HasProtocol(umh->ProtocolId))
-            {
-                if (umh->MessageType == payloadHeader.GetMessageType())
-                {
-                    matchingUMH = umh;
-                    break;
-                }
-
-                if (umh->MessageType == kAnyMessageType)
-                    matchingUMH = umh;
-            }
-        }
+        if (matchingUMH == nullptr)
+            matchingUMH = FindUMH(payloadHeader.GetProtocolID(), kAnyMessageType);
     }
     // Discard the message if it isn't marked as being sent by an initiator and the message does not need to send
     // an ack to the peer.
@@ -305,7 +454,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
         ChipLogDetail(ExchangeManager, "ec pos: %d, id: %d, Delegate: 0x%x", ec - mContextPool.begin(), ec->GetExchangeId(),
                       ec->GetDelegate());
 
-        ec->HandleMessage(packetHeader, payloadHeader, source, std::move(msgBuf));
+        ec->HandleMessage(packetHeader, payloadHeader, source, msgFlags, std::move(msgBuf));
 
         // Close exchange if it was created only to send ack for a duplicate message.
         if (sendAckAndCloseExchange)
@@ -326,15 +475,11 @@ CHIP_ERROR ExchangeManager::QueueReceivedMessageAndSync(Transport::PeerConnectio
     VerifyOrExit(state != nullptr, err = CHIP_ERROR_NOT_CONNECTED);
 
     // Queue the message as needed for sync with destination node.
-    err = mMessageCounterSyncMgr.AddToReceiveTable(std::move(msgBuf));
+    err = mMessageCounterSyncMgr.AddToReceiveTable(state->GetPeerNodeId(), std::move(msgBuf));
     SuccessOrExit(err);
 
-    // Initiate message counter synchronization if no message counter synchronization is in progress.
-    if (!state->IsMsgCounterSyncInProgress())
-    {
-        SecureSessionHandle session(state->GetPeerNodeId(), state->GetPeerKeyID(), state->GetAdminId());
-        err = mMessageCounterSyncMgr.SendMsgCounterSyncReq(session);
-    }
+    // Initiate message counter synchronization, unless a request to the peer is in flight already.
+    err = mMessageCounterSyncMgr.SendMsgCounterSyncReq({ state->GetPeerNodeId(), state->GetPeerKeyID(), state->GetAdminId() });
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -366,7 +511,13 @@ void ExchangeManager::OnConnectionExpired(SecureSessionHandle session, SecureSes
     {
         if (ec.GetReferenceCount() > 0 && ec.mSecureSession == session)
         {
-            ec.Close();
+            // The messages awaiting an acknowledgement can no longer be retransmitted. Dropping them releases the references
+            // they hold on their exchange, which may be all that is left of an exchange its delegate closed already.
+            mReliableMessageMgr.ClearRetransTable(static_cast<ReliableMessageContext *>(&ec));
+            if (ec.GetReferenceCount() > 0 && ec.GetDelegate() != nullptr)
+            {
+                ec.Close();
+            }
             // Continue iterate because there can be multiple contexts associated with the connection.
         }
     }
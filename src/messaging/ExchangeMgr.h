@@ -32,6 +32,7 @@
 #include <messaging/ReliableMessageMgr.h>
 #include <protocols/Protocols.h>
 #include <support/DLLUtil.h>
+#include <transport/PeerConnectionIndex.h>
 #include <transport/SecureSessionMgr.h>
 #include <transport/TransportMgr.h>
 
@@ -226,6 +227,23 @@ private:
         int16_t MessageType;
     };
 
+    static constexpr bool kIndexed = (CHIP_CONFIG_EXCHANGE_MGR_INDEX != 0);
+
+    // Both indexes are keyed on a 64-bit digest of the lookup fields; the matchers passed to
+    // FindFirst() still compare the full entry, so digest collisions only cost a probe.
+    using ExchangeIndex = Transport::PeerConnectionIndex<CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, uint64_t, kIndexed>;
+    using HandlerIndex  = Transport::PeerConnectionIndex<CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS, uint64_t, kIndexed>;
+
+    static uint64_t ExchangeKey(uint16_t exchangeId, NodeId peerNodeId)
+    {
+        return peerNodeId ^ (static_cast<uint64_t>(exchangeId) << 48);
+    }
+
+    static uint64_t HandlerKey(Protocols::Id protocolId, int16_t msgType)
+    {
+        return (static_cast<uint64_t>(protocolId.ToFullyQualifiedSpecForm()) << 16) | static_cast<uint16_t>(msgType);
+    }
+
     uint16_t mNextExchangeId;
     uint16_t mNextKeyId;
     State mState;
@@ -240,10 +258,33 @@ private:
     std::array<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
     size_t mContextsInUse;
 
+    ExchangeIndex mExchangeIndex;
+
     UnsolicitedMessageHandler UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
+    HandlerIndex mHandlerIndex;
+
+    // The exchanges awaiting a response, by deadline, which share one system timer armed for the earliest of them. Expecting or
+    // getting a response does not touch the timer unless the exchange becomes the earliest: the timer is left to expire early
+    // when that exchange gets its response, and is then re-armed for the next one.
+    ExchangeContext * mResponseTimeoutHead = nullptr;
+    ExchangeContext * mResponseTimeoutTail = nullptr;
+    uint64_t mResponseTimerDeadlineMs      = 0;
+    bool mResponseTimerArmed               = false;
 
     ExchangeContext * AllocContext(uint16_t ExchangeId, SecureSessionHandle session, bool Initiator,
                                    ExchangeDelegateBase * delegate);
+    void RemoveFromIndex(const ExchangeContext & ec);
+
+    CHIP_ERROR ScheduleResponseTimeout(ExchangeContext & ec, uint32_t timeoutMs);
+    void CancelResponseTimeout(ExchangeContext & ec);
+    bool IsResponseTimeoutQueued(const ExchangeContext & ec) const
+    {
+        return ec.mResponseTimeoutPrev != nullptr || mResponseTimeoutHead == &ec;
+    }
+    CHIP_ERROR ArmResponseTimer();
+    static void HandleResponseTimer(System::Layer * aSystemLayer, void * aAppState, System::Error aError);
+
+    UnsolicitedMessageHandler * FindUMH(Protocols::Id protocolId, int16_t msgType);
 
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, ExchangeDelegateBase * delegate);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
@@ -254,6 +295,14 @@ private:
                            const Transport::PeerAddress & source, System::PacketBufferHandle msgBuf,
                            SecureSessionMgr * msgLayer) override;
 
+    void OnDuplicateMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                    SecureSessionHandle session, const Transport::PeerAddress & source,
+                                    SecureSessionMgr * msgLayer) override;
+
+    // Hands a received message to its exchange, or to the unsolicited message handler of its protocol on a new exchange.
+    void DispatchMessage(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, SecureSessionHandle session,
+                         const Transport::PeerAddress & source, MessageFlags msgFlags, System::PacketBufferHandle msgBuf);
+
     void OnNewConnection(SecureSessionHandle session, SecureSessionMgr * mgr) override;
     void OnConnectionExpired(SecureSessionHandle session, SecureSessionMgr * mgr) override;
 
@@ -53,6 +53,21 @@ void MessageCounterSyncMgr::Shutdown()
         mExchangeMgr->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::MsgCounterSyncReq);
         mExchangeMgr = nullptr;
     }
+
+    for (RetransTableEntry & entry : mRetransTable)
+    {
+        if (entry.exchangeContext != nullptr)
+        {
+            entry.exchangeContext->Release();
+            entry.exchangeContext = nullptr;
+        }
+        entry.msgBuf = nullptr;
+    }
+
+    for (ReceiveTableEntry & entry : mReceiveTable)
+    {
+        entry.msgBuf = nullptr;
+    }
 }
 
 void MessageCounterSyncMgr::OnMessageReceived(Messaging::ExchangeContext * exchangeContext, const PacketHeader & packetHeader,
@@ -82,6 +97,9 @@ void MessageCounterSyncMgr::OnResponseTimeout(Messaging::ExchangeContext * excha
         ChipLogError(ExchangeManager, "Timed out! Failed to clear message counter synchronization status.");
     }
 
+    // The messages queued for the peer were waiting on this request, which the next message to the peer starts anew.
+    DiscardPendingGroupMsgs(exchangeContext->GetSecureSession().GetPeerNodeId());
+
     // Close the exchange if MsgCounterSyncRsp is not received before kMsgCounterSyncTimeout.
     if (exchangeContext != nullptr)
     {
@@ -95,34 +113,43 @@ CHIP_ERROR MessageCounterSyncMgr::AddToRetransmissionTable(Protocols::Id protoco
                                                            System::PacketBufferHandle msgBuf,
                                                            Messaging::ExchangeContext * exchangeContext)
 {
-    bool added     = false;
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    RetransTableEntry * freeEntry = nullptr;
+    size_t queuedForPeer          = 0;
+
+    VerifyOrReturnError(exchangeContext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const NodeId peerNodeId = exchangeContext->GetSecureSession().GetPeerNodeId();
 
-    VerifyOrReturnError(exchangeContext != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
+    DiscardExpiredGroupMsgs();
 
     for (RetransTableEntry & entry : mRetransTable)
     {
         // Entries are in use if they have an exchangeContext.
         if (entry.exchangeContext == nullptr)
         {
-            entry.protocolId      = protocolId;
-            entry.msgType         = msgType;
-            entry.msgBuf          = std::move(msgBuf);
-            entry.exchangeContext = exchangeContext;
-            entry.exchangeContext->Retain();
-            added = true;
-
-            break;
+            freeEntry = (freeEntry == nullptr) ? &entry : freeEntry;
+        }
+        else if (entry.exchangeContext->GetSecureSession().GetPeerNodeId() == peerNodeId)
+        {
+            queuedForPeer++;
         }
     }
 
-    if (!added)
+    if (freeEntry == nullptr || queuedForPeer >= CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER)
     {
         ChipLogError(ExchangeManager, "MCSP RetransTable Already Full");
-        err = CHIP_ERROR_NO_MEMORY;
+        return CHIP_ERROR_NO_MEMORY;
     }
 
-    return err;
+    freeEntry->protocolId      = protocolId;
+    freeEntry->msgType         = msgType;
+    freeEntry->sendFlags       = sendFlags;
+    freeEntry->msgBuf          = std::move(msgBuf);
+    freeEntry->queuedTime      = System::Timer::GetCurrentEpoch();
+    freeEntry->exchangeContext = exchangeContext;
+    freeEntry->exchangeContext->Retain();
+
+    return CHIP_NO_ERROR;
 }
 
 /**
@@ -156,29 +183,37 @@ void MessageCounterSyncMgr::RetransPendingGroupMsgs(NodeId peerNodeId)
     }
 }
 
-CHIP_ERROR MessageCounterSyncMgr::AddToReceiveTable(System::PacketBufferHandle msgBuf)
+CHIP_ERROR MessageCounterSyncMgr::AddToReceiveTable(NodeId peerNodeId, System::PacketBufferHandle msgBuf)
 {
-    bool added     = false;
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    ReceiveTableEntry * freeEntry = nullptr;
+    size_t queuedForPeer          = 0;
+
+    DiscardExpiredGroupMsgs();
 
     for (ReceiveTableEntry & entry : mReceiveTable)
     {
         // Entries are in use if they have a message buffer.
         if (entry.msgBuf.IsNull())
         {
-            entry.msgBuf = std::move(msgBuf);
-            added        = true;
-            break;
+            freeEntry = (freeEntry == nullptr) ? &entry : freeEntry;
+        }
+        else if (entry.peerNodeId == peerNodeId)
+        {
+            queuedForPeer++;
         }
     }
 
-    if (!added)
+    if (freeEntry == nullptr || queuedForPeer >= CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER)
     {
         ChipLogError(ExchangeManager, "MCSP ReceiveTable Already Full");
-        err = CHIP_ERROR_NO_MEMORY;
+        return CHIP_ERROR_NO_MEMORY;
     }
 
-    return err;
+    freeEntry->msgBuf     = std::move(msgBuf);
+    freeEntry->peerNodeId = peerNodeId;
+    freeEntry->queuedTime = System::Timer::GetCurrentEpoch();
+
+    return CHIP_NO_ERROR;
 }
 
 /**
@@ -194,29 +229,84 @@ void MessageCounterSyncMgr::ProcessPendingGroupMsgs(NodeId peerNodeId)
     // this table was using an application group key; that's why it was added.
     for (ReceiveTableEntry & entry : mReceiveTable)
     {
-        if (!entry.msgBuf.IsNull())
+        if (!entry.msgBuf.IsNull() && entry.peerNodeId == peerNodeId)
         {
             PacketHeader packetHeader;
             uint16_t headerSize = 0;
 
-            if (packetHeader.Decode((entry.msgBuf)->Start(), (entry.msgBuf)->DataLength(), &headerSize) != CHIP_NO_ERROR)
-            {
-                ChipLogError(ExchangeManager, "ProcessPendingGroupMsgs::Failed to decode PacketHeader");
-                break;
-            }
-
-            if (packetHeader.GetSourceNodeId().HasValue() && packetHeader.GetSourceNodeId().Value() == peerNodeId)
+            if (packetHeader.Decode((entry.msgBuf)->Start(), (entry.msgBuf)->DataLength(), &headerSize) == CHIP_NO_ERROR)
             {
                 // Reprocess message.
                 mExchangeMgr->GetSessionMgr()->HandleGroupMessageReceived(packetHeader.GetEncryptionKeyID(),
                                                                           std::move(entry.msgBuf));
-
-                // Explicitly free any buffer owned by this handle.  The
-                // HandleGroupMessageReceived() call should really handle this, but
-                // just in case it messes up we don't want to get confused about
-                // wheter the entry is in use.
-                entry.msgBuf = nullptr;
             }
+            else
+            {
+                ChipLogError(ExchangeManager, "ProcessPendingGroupMsgs::Failed to decode PacketHeader");
+            }
+
+            // Explicitly free any buffer owned by this handle.  The
+            // HandleGroupMessageReceived() call should really handle this, but
+            // just in case it messes up we don't want to get confused about
+            // wheter the entry is in use.
+            entry.msgBuf = nullptr;
+        }
+    }
+}
+
+/**
+ *  Discard all pending messages queued for the specified node, whose
+ *  message counter synchronization failed.
+ *
+ *  @param[in] peerNodeId    Node ID of the peer node.
+ *
+ */
+void MessageCounterSyncMgr::DiscardPendingGroupMsgs(NodeId peerNodeId)
+{
+    for (RetransTableEntry & entry : mRetransTable)
+    {
+        if (entry.exchangeContext != nullptr && entry.exchangeContext->GetSecureSession().GetPeerNodeId() == peerNodeId)
+        {
+            entry.msgBuf = nullptr;
+            entry.exchangeContext->Release();
+            entry.exchangeContext = nullptr;
+        }
+    }
+
+    for (ReceiveTableEntry & entry : mReceiveTable)
+    {
+        if (!entry.msgBuf.IsNull() && entry.peerNodeId == peerNodeId)
+        {
+            entry.msgBuf = nullptr;
+        }
+    }
+}
+
+/**
+ *  Discard the pending messages queued for longer than
+ *  CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT, for instance because
+ *  no synchronization request could be sent for their peer.
+ *
+ */
+void MessageCounterSyncMgr::DiscardExpiredGroupMsgs()
+{
+    const System::Timer::Epoch now = System::Timer::GetCurrentEpoch();
+
+    for (RetransTableEntry & entry : mRetransTable)
+    {
+        if (entry.exchangeContext != nullptr && now - entry.queuedTime >= CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT)
+        {
+            entry.msgBuf = nullptr;
+            entry.exchangeContext->Release();
+            entry.exchangeContext = nullptr;
+        }
+    }
+
+    for (ReceiveTableEntry & entry : mReceiveTable)
+    {
+        if (!entry.msgBuf.IsNull() && now - entry.queuedTime >= CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT)
+        {
+            entry.msgBuf = nullptr;
         }
     }
 }
@@ -245,12 +335,17 @@ CHIP_ERROR MessageCounterSyncMgr::SendMsgCounterSyncReq(SecureSessionHandle sess
     Transport::PeerConnectionState * state       = nullptr;
     System::PacketBufferHandle msgBuf;
     Messaging::SendFlags sendFlags;
-    void * challenge = chip::Platform::MemoryAlloc(kMsgCounterChallengeSize);
-    VerifyOrExit(challenge != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    void * challenge = nullptr;
 
     state = mExchangeMgr->GetSessionMgr()->GetPeerConnectionState(session);
     VerifyOrExit(state != nullptr, err = CHIP_ERROR_NOT_CONNECTED);
 
+    // The request in flight covers every message queued for the peer until its response.
+    VerifyOrExit(!state->IsMsgCounterSyncInProgress(), err = CHIP_NO_ERROR);
+
+    challenge = chip::Platform::MemoryAlloc(kMsgCounterChallengeSize);
+    VerifyOrExit(challenge != nullptr, err = CHIP_ERROR_NO_MEMORY);
+
     // Create and initialize new exchange.
     err = NewMsgCounterSyncExchange(session, exchangeContext);
     SuccessOrExit(err);
@@ -24,6 +24,7 @@
 
 #include <protocols/Protocols.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemTimer.h>
 
 namespace chip {
 namespace Messaging {
@@ -48,6 +49,9 @@ public:
      * This function is called while processing a message encrypted with an application key from a peer whose message counter is not
      * synchronized. This message is sent on a newly created exchange, which is closed immediately after.
      *
+     * Only one request is in flight for a session: while one is, the call does nothing, and the messages queued meanwhile are
+     * flushed along with those queued before once the response is received.
+     *
      * @param[in]  session  The secure session handle of the received message.
      *
      * @retval  #CHIP_ERROR_NO_MEMORY         If memory could not be allocated for the new
@@ -59,7 +63,8 @@ public:
 
     /**
      *  Add a CHIP message into the cache table to queue the outgoing messages that trigger message counter synchronization protocol
-     *  for retransmission.
+     *  for retransmission. The message is discarded if the counter of its peer is still unknown after
+     *  CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT.
      *
      *  @param[in]    protocolId       The protocol identifier of the CHIP message to be sent.
      *
@@ -71,7 +76,8 @@ public:
      *
      *  @param[in]    exchangeContext  A pointer to the exchange context object associated with the message being sent.
      *
-     *  @retval  #CHIP_ERROR_NO_MEMORY If there is no empty slot left in the table for addition.
+     *  @retval  #CHIP_ERROR_NO_MEMORY If there is no empty slot left in the table for addition, or the peer has
+     *                                 CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER messages queued already.
      *  @retval  #CHIP_NO_ERROR On success.
      */
     CHIP_ERROR AddToRetransmissionTable(Protocols::Id protocolId, uint8_t msgType, const SendFlags & sendFlags,
@@ -79,14 +85,18 @@ public:
 
     /**
      *  Add a CHIP message into the cache table to queue the incoming messages that trigger message counter synchronization
-     * protocol for re-processing.
+     * protocol for re-processing. The message is discarded if the counter of its peer is still unknown after
+     * CHIP_CONFIG_MSG_COUNTER_SYNC_QUEUE_TIMEOUT.
+     *
+     *  @param[in]    peerNodeId       The node ID of the sender of the message.
      *
      *  @param[in]    msgBuf           A handle to the packet buffer holding the received message.
      *
-     *  @retval  #CHIP_ERROR_NO_MEMORY If there is no empty slot left in the table for addition.
+     *  @retval  #CHIP_ERROR_NO_MEMORY If there is no empty slot left in the table for addition, or the peer has
+     *                                 CHIP_CONFIG_MSG_COUNTER_SYNC_MAX_QUEUED_PER_PEER messages queued already.
      *  @retval  #CHIP_NO_ERROR On success.
      */
-    CHIP_ERROR AddToReceiveTable(System::PacketBufferHandle msgBuf);
+    CHIP_ERROR AddToReceiveTable(NodeId peerNodeId, System::PacketBufferHandle msgBuf);
 
 private:
     /**
@@ -108,6 +118,7 @@ private:
         SendFlags sendFlags;               /**< Flags set by the application for the CHIP message being sent. */
         Protocols::Id protocolId;          /**< The protocol identifier of the CHIP message to be sent. */
         uint8_t msgType;                   /**< The message type of the CHIP message to be sent. */
+        System::Timer::Epoch queuedTime;   /**< When the CHIP message was queued. */
     };
 
     /**
@@ -125,6 +136,8 @@ private:
         System::PacketBufferHandle msgBuf; /**< A handle to the PacketBuffer object holding
                                                 the message data. This is non-null if and only
                                                 if this entry is in use. */
+        NodeId peerNodeId;                 /**< The node ID of the sender of the message. */
+        System::Timer::Epoch queuedTime;   /**< When the message was queued. */
     };
 
     Messaging::ExchangeManager * mExchangeMgr; // [READ ONLY] Associated Exchange Manager object.
@@ -143,6 +156,10 @@ private:
 
     void ProcessPendingGroupMsgs(NodeId peerNodeId);
 
+    void DiscardPendingGroupMsgs(NodeId peerNodeId);
+
+    void DiscardExpiredGroupMsgs();
+
     CHIP_ERROR NewMsgCounterSyncExchange(SecureSessionHandle session, Messaging::ExchangeContext *& exchangeContext);
 
     CHIP_ERROR SendMsgCounterSyncResp(Messaging::ExchangeContext * exchangeContext, SecureSessionHandle session);
@@ -21,6 +21,7 @@
  *
  */
 
+#include <algorithm>
 #include <inttypes.h>
 
 #include <messaging/ReliableMessageMgr.h>
@@ -33,15 +34,23 @@
 #include <support/CHIPFaultInjection.h>
 #include <support/CodeUtils.h>
 #include <support/logging/CHIPLogging.h>
+#include <system/SystemStats.h>
 
 namespace chip {
 namespace Messaging {
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry() : rc(nullptr), nextRetransTimeTick(0), sendCount(0) {}
+ReliableMessageMgr::RetransTableEntry::RetransTableEntry() :
+    rc(nullptr), nextRetransTimeTick(0), sendCount(0), queue(nullptr), nextInQueue(nullptr)
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+    ,
+    firstSendTime(0)
+#endif
+{}
 
 ReliableMessageMgr::ReliableMessageMgr(std::array<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
     mContextPool(contextPool), mSystemLayer(nullptr), mSessionMgr(nullptr), mCurrentTimerExpiry(0),
-    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT)
+    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT), mRetransmitCount(0), mCoalescedRetransmitCount(0),
+    mRttSampleCount(0), mAdaptiveTimeoutCount(0)
 {}
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
@@ -124,44 +133,136 @@ void ReliableMessageMgr::ExecuteActions()
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries before processing");
 
     // Retransmit / cancel anything in the retrans table whose retrans timeout
-    // has expired
-    for (RetransTableEntry & entry : mRetransTable)
+    // has expired. Queues are in deadline order, so only their heads need checking.
+    for (RetransQueue & queue : mRetransQueues)
+    {
+        if (queue.head != nullptr && queue.head->nextRetransTimeTick == 0)
+            SendDueEntries(queue);
+    }
+
+    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
+}
+
+void ReliableMessageMgr::SendDueEntries(RetransQueue & queue)
+{
+    RetransTableEntry * batch[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    size_t batchSize = 0;
+    size_t sent      = 0;
+
+    // Snapshot the due entries first: sending may deliver acks (and so clear entries) synchronously.
+    for (RetransTableEntry * entry = queue.head; entry != nullptr && entry->nextRetransTimeTick == 0; entry = entry->nextInQueue)
+    {
+        batch[batchSize++] = entry;
+    }
+
+    for (size_t i = 0; i < batchSize; i++)
     {
+        RetransTableEntry & entry   = *batch[i];
         ReliableMessageContext * rc = entry.rc;
-        CHIP_ERROR err              = CHIP_NO_ERROR;
 
-        if (!rc || entry.nextRetransTimeTick != 0)
+        // Skip entries acknowledged or failed while sending the earlier ones.
+        if (rc == nullptr || entry.queue != &queue || entry.nextRetransTimeTick != 0)
             continue;
 
         uint8_t sendCount = entry.sendCount;
 
         if (sendCount == CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS)
         {
-            err = CHIP_ERROR_MESSAGE_NOT_ACKNOWLEDGED;
-
             ChipLogError(ExchangeManager, "Failed to Send CHIP MsgId:%08" PRIX32 " sendCount: %" PRIu8 " max retries: %" PRIu8,
                          entry.retainedBuf.GetMsgId(), sendCount, CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS);
 
             // Remove from Table
             ClearRetransTable(entry);
+            SYSTEM_STATS_COUNT(chip::System::Stats::kReliableMessageMgr_NumRetransmissionFailures);
+            continue;
         }
 
         // Resend from Table (if the operation fails, the entry is cleared)
-        if (err == CHIP_NO_ERROR)
-            err = SendFromRetransTable(&entry);
+        if (SendFromRetransTable(&entry) != CHIP_NO_ERROR)
+            continue;
 
-        if (err == CHIP_NO_ERROR)
+        mRetransmitCount++;
+        SYSTEM_STATS_COUNT(chip::System::Stats::kReliableMessageMgr_NumRetransmissions);
+        if (sent++ > 0)
         {
-            // If the retransmission was successful, update the passive timer
-            entry.nextRetransTimeTick = static_cast<uint16_t>(rc->GetActiveRetransmitTimeoutTick());
+            mCoalescedRetransmitCount++;
+        }
+
+        // If the retransmission was successful, update the passive timer
+        entry.nextRetransTimeTick = static_cast<uint16_t>(GetRetransmitTimeoutTick(rc, entry.sendCount));
+        Requeue(entry);
 #if !defined(NDEBUG)
-            ChipLogDetail(ExchangeManager, "Retransmit MsgId:%08" PRIX32 " Send Cnt %d", entry.retainedBuf.GetMsgId(),
-                          entry.sendCount);
+        ChipLogDetail(ExchangeManager, "Retransmit MsgId:%08" PRIX32 " Send Cnt %d", entry.retainedBuf.GetMsgId(), entry.sendCount);
 #endif
+    }
+}
+
+void ReliableMessageMgr::Enqueue(RetransTableEntry & entry, SecureSessionHandle session)
+{
+    RetransQueue * queue     = nullptr;
+    RetransQueue * freeQueue = nullptr;
+
+    for (RetransQueue & q : mRetransQueues)
+    {
+        if (q.head == nullptr)
+        {
+            if (freeQueue == nullptr)
+                freeQueue = &q;
+        }
+        else if (q.session == session)
+        {
+            queue = &q;
+            break;
         }
     }
 
-    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
+    if (queue == nullptr)
+    {
+        // There are as many queues as table entries, so one is always free.
+        VerifyOrDie(freeQueue != nullptr);
+        queue          = freeQueue;
+        queue->session = session;
+    }
+
+    entry.queue = queue;
+    Requeue(entry);
+}
+
+void ReliableMessageMgr::Dequeue(RetransTableEntry & entry)
+{
+    if (entry.queue == nullptr)
+        return;
+
+    for (RetransTableEntry ** link = &entry.queue->head; *link != nullptr; link = &(*link)->nextInQueue)
+    {
+        if (*link == &entry)
+        {
+            *link = entry.nextInQueue;
+            break;
+        }
+    }
+
+    entry.queue       = nullptr;
+    entry.nextInQueue = nullptr;
+}
+
+void ReliableMessageMgr::Requeue(RetransTableEntry & entry)
+{
+    RetransQueue * queue = entry.queue;
+
+    // Unlink and re-insert into the same queue, behind every entry due no later, so that
+    // entries falling due in the same tick keep the order in which they were scheduled.
+    Dequeue(entry);
+
+    RetransTableEntry ** link = &queue->head;
+    while (*link != nullptr && (*link)->nextRetransTimeTick <= entry.nextRetransTimeTick)
+    {
+        link = &(*link)->nextInQueue;
+    }
+
+    entry.queue       = queue;
+    entry.nextInQueue = *link;
+    *link             = &entry;
 }
 
 static void TickProceed(uint16_t & time, uint64_t ticks)
@@ -202,18 +303,18 @@ void ReliableMessageMgr::ExpireTicks()
         }
     });
 
-    for (RetransTableEntry & entry : mRetransTable)
+    // Subtracting the same (saturating) amount from every entry keeps each queue in deadline order.
+    for (RetransQueue & queue : mRetransQueues)
     {
-        ReliableMessageContext * rc = entry.rc;
-        if (rc)
+        for (RetransTableEntry * entry = queue.head; entry != nullptr; entry = entry->nextInQueue)
         {
             // Decrement Retransmit timeout by elapsed timeticks
-            TickProceed(entry.nextRetransTimeTick, deltaTicks);
+            TickProceed(entry->nextRetransTimeTick, deltaTicks);
 #if defined(RMP_TICKLESS_DEBUG)
             ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks set nextRetransTimeTick to %u",
-                          entry.nextRetransTimeTick);
+                          entry->nextRetransTimeTick);
 #endif
-        } // rc entry is allocated
+        }
     }
 
     // Re-Adjust the base time stamp to the most recent tick boundary
@@ -269,6 +370,7 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
             rc->RetainContext();
             rc->SetOccupied(true);
             added = true;
+            SYSTEM_STATS_INCREMENT(chip::System::Stats::kReliableMessageMgr_NumRetransEntries);
 
             break;
         }
@@ -277,6 +379,7 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
     if (!added)
     {
         ChipLogError(ExchangeManager, "mRetransTable Already Full");
+        SYSTEM_STATS_COUNT(chip::System::Stats::kReliableMessageMgr_NumRetransTableFull);
         err = CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
@@ -287,8 +390,16 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
     VerifyOrDie(entry != nullptr && entry->rc != nullptr);
 
-    entry->nextRetransTimeTick = static_cast<uint16_t>(entry->rc->GetInitialRetransmitTimeoutTick() +
-                                                       GetTickCounterFromTimeDelta(System::Timer::GetCurrentEpoch()));
+    const System::Timer::Epoch now = System::Timer::GetCurrentEpoch();
+
+    entry->nextRetransTimeTick =
+        static_cast<uint16_t>(GetRetransmitTimeoutTick(entry->rc, entry->sendCount) + GetTickCounterFromTimeDelta(now));
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+    entry->firstSendTime = now;
+#endif
+
+    Dequeue(*entry);
+    Enqueue(*entry, entry->rc->GetExchangeContext()->GetSecureSession());
 
     // Check if the timer needs to be started and start it.
     StartTimer();
@@ -301,6 +412,8 @@ void ReliableMessageMgr::PauseRetransmision(ReliableMessageContext * rc, uint32_
         if (entry.rc == rc)
         {
             entry.nextRetransTimeTick = static_cast<uint16_t>(entry.nextRetransTimeTick + (PauseTimeMillis >> mTimerIntervalShift));
+            if (entry.queue != nullptr)
+                Requeue(entry);
             break;
         }
     }
@@ -313,6 +426,8 @@ void ReliableMessageMgr::ResumeRetransmision(ReliableMessageContext * rc)
         if (entry.rc == rc)
         {
             entry.nextRetransTimeTick = 0;
+            if (entry.queue != nullptr)
+                Requeue(entry);
             break;
         }
     }
@@ -324,6 +439,12 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     {
         if ((entry.rc == rc) && entry.retainedBuf.GetMsgId() == ackMsgId)
         {
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+            // Karn's algorithm: the ack of a retransmitted message cannot be matched to one send.
+            if (entry.sendCount == 0)
+                SampleRoundTripTime(entry);
+#endif
+
             // Clear the entry from the retransmision table.
             ClearRetransTable(entry);
 
@@ -337,6 +458,63 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     return false;
 }
 
+uint64_t ReliableMessageMgr::GetRetransmitTimeoutTick(ReliableMessageContext * rc, uint8_t sendCount)
+{
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+    Transport::RoundTripTimeEstimator * estimator = GetRoundTripTimeEstimator(rc);
+
+    if (estimator != nullptr && estimator->HasSample())
+    {
+        uint64_t timeoutMs = estimator->GetRetransmitTimeoutMs(1u << mTimerIntervalShift);
+
+        // Back off exponentially for every retransmission already sent.
+        for (uint8_t i = 0; i < sendCount && timeoutMs < CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL; i++)
+        {
+            timeoutMs <<= 1;
+        }
+
+        if (timeoutMs < CHIP_CONFIG_RMP_ADAPTIVE_MIN_RETRY_INTERVAL)
+            timeoutMs = CHIP_CONFIG_RMP_ADAPTIVE_MIN_RETRY_INTERVAL;
+        if (timeoutMs > CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL)
+            timeoutMs = CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL;
+
+        mAdaptiveTimeoutCount++;
+        return GetTickCounterFromTimePeriod(timeoutMs);
+    }
+#endif // CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+
+    return (sendCount == 0) ? rc->GetInitialRetransmitTimeoutTick() : rc->GetActiveRetransmitTimeoutTick();
+}
+
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+Transport::RoundTripTimeEstimator * ReliableMessageMgr::GetRoundTripTimeEstimator(ReliableMessageContext * rc)
+{
+    VerifyOrReturnError(mSessionMgr != nullptr, nullptr);
+
+    Transport::PeerConnectionState * state = mSessionMgr->GetPeerConnectionState(rc->GetExchangeContext()->GetSecureSession());
+    VerifyOrReturnError(state != nullptr, nullptr);
+
+    return &state->GetRoundTripTimeEstimator();
+}
+
+void ReliableMessageMgr::SampleRoundTripTime(RetransTableEntry & entry)
+{
+    Transport::RoundTripTimeEstimator * estimator = GetRoundTripTimeEstimator(entry.rc);
+    VerifyOrReturn(estimator != nullptr);
+
+    const System::Timer::Epoch elapsed = System::Timer::GetCurrentEpoch() - entry.firstSendTime;
+    const uint32_t rttMs               = static_cast<uint32_t>((elapsed < UINT32_MAX) ? elapsed : UINT32_MAX);
+
+    estimator->AddSample(rttMs);
+    mRttSampleCount++;
+
+#if !defined(NDEBUG)
+    ChipLogDetail(ExchangeManager, "RTT sample %" PRIu32 " ms, SRTT %" PRIu32 " ms, RTTVAR %" PRIu32 " ms", rttMs,
+                  estimator->GetSmoothedRttMs(), estimator->GetRttVarianceMs());
+#endif
+}
+#endif // CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 {
     CHIP_ERROR err              = CHIP_NO_ERROR;
@@ -354,8 +532,8 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
     const ExchangeMessageDispatch * dispatcher = rc->GetExchangeContext()->GetMessageDispatch();
     VerifyOrExit(dispatcher != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    err =
-        dispatcher->ResendMessage(rc->GetExchangeContext()->GetSecureSession(), std::move(entry->retainedBuf), &entry->retainedBuf);
+    err = dispatcher->ResendMessage(rc->GetExchangeContext()->GetSecureSession(), std::move(entry->retainedBuf),
+                                    &entry->retainedBuf, rc->GetExchangeContext()->GetTrafficClass());
     SuccessOrExit(err);
 
     // Update the counters
@@ -394,9 +572,12 @@ void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & rEntry)
         // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
         ExpireTicks();
 
+        Dequeue(rEntry);
+
         rEntry.rc->ReleaseContext();
         rEntry.rc->SetOccupied(false);
         rEntry.rc = nullptr;
+        SYSTEM_STATS_DECREMENT(chip::System::Stats::kReliableMessageMgr_NumRetransEntries);
 
         // Clear all other fields
         rEntry = RetransTableEntry();
@@ -421,61 +602,74 @@ void ReliableMessageMgr::FailRetransTableEntries(ReliableMessageContext * rc, CH
 
 void ReliableMessageMgr::StartTimer()
 {
-    CHIP_ERROR res            = CHIP_NO_ERROR;
-    uint64_t nextWakeTimeTick = UINT64_MAX;
-    bool foundWake            = false;
+    CHIP_ERROR res               = CHIP_NO_ERROR;
+    uint64_t nextAckTimeTick     = UINT64_MAX;
+    uint64_t nextRetransTimeTick = UINT64_MAX;
+    bool foundWake               = false;
 
     // When do we need to next wake up to send an ACK?
 
-    ExecuteForAllContext([&nextWakeTimeTick, &foundWake](ReliableMessageContext * rc) {
-        if (rc->IsAckPending() && rc->mNextAckTimeTick < nextWakeTimeTick)
+    ExecuteForAllContext([&nextAckTimeTick, &foundWake](ReliableMessageContext * rc) {
+        if (rc->IsAckPending() && rc->mNextAckTimeTick < nextAckTimeTick)
         {
-            nextWakeTimeTick = rc->mNextAckTimeTick;
-            foundWake        = true;
+            nextAckTimeTick = rc->mNextAckTimeTick;
+            foundWake       = true;
 #if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer next ACK time %u", nextWakeTimeTick);
+            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer next ACK time %u", nextAckTimeTick);
 #endif
         }
     });
 
-    for (RetransTableEntry & entry : mRetransTable)
+    for (RetransQueue & queue : mRetransQueues)
     {
-        ReliableMessageContext * rc = entry.rc;
-        if (rc)
+        // When do we need to next wake up for ReliableMessageProtocol retransmit? The head of
+        // each queue is its earliest entry.
+        if (queue.head != nullptr && queue.head->nextRetransTimeTick < nextRetransTimeTick)
         {
-            // When do we need to next wake up for ReliableMessageProtocol retransmit?
-            if (entry.nextRetransTimeTick < nextWakeTimeTick)
-            {
-                nextWakeTimeTick = entry.nextRetransTimeTick;
-                foundWake        = true;
+            nextRetransTimeTick = queue.head->nextRetransTimeTick;
+            foundWake           = true;
 #if defined(RMP_TICKLESS_DEBUG)
-                ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer RetransTime %u", nextWakeTimeTick);
+            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer RetransTime %u", nextRetransTimeTick);
 #endif
-            }
         }
     }
 
     if (foundWake)
     {
-        // Set timer for next tick boundary - subtract the elapsed time from the current tick
-        System::Timer::Epoch timerExpiryEpoch = (nextWakeTimeTick << mTimerIntervalShift) + mTimeStampBase;
+        // Set timer for next tick boundary - subtract the elapsed time from the current tick. ACKs and retransmits that can
+        // wait a little share a wakeup with other timers, or with the next wake of the node, e.g. its next data poll.
+        System::Timer::Epoch timerExpiryEpoch = UINT64_MAX;
+        System::Timer::Epoch timerLatestEpoch = UINT64_MAX;
+        auto addWake = [&](uint64_t tick, uint32_t slack) {
+            if (tick != UINT64_MAX)
+            {
+                System::Timer::Epoch epoch = (tick << mTimerIntervalShift) + mTimeStampBase;
+                timerExpiryEpoch           = std::min(timerExpiryEpoch, epoch);
+                timerLatestEpoch           = std::min(timerLatestEpoch, epoch + slack);
+            }
+        };
+        addWake(nextAckTimeTick, CHIP_CONFIG_RMP_ACK_WAKE_SLACK);
+        addWake(nextRetransTimeTick, CHIP_CONFIG_RMP_RETRANS_WAKE_SLACK);
 
 #if defined(RMP_TICKLESS_DEBUG)
-        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms (%" PRIu64 " %" PRIu64 ")",
-                      timerExpiryEpoch, nextWakeTimeTick, mTimeStampBase);
+        ChipLogDetail(ExchangeManager,
+                      "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms (%" PRIu64 " %" PRIu64 " %" PRIu64 ")",
+                      timerExpiryEpoch, nextAckTimeTick, nextRetransTimeTick, mTimeStampBase);
 #endif
         if (timerExpiryEpoch != mCurrentTimerExpiry)
         {
             // If the tick boundary has expired in the past (delayed processing of event due to other system activity),
             // expire the timer immediately
-            uint64_t now           = System::Timer::GetCurrentEpoch();
-            uint64_t timerArmValue = (timerExpiryEpoch > now) ? timerExpiryEpoch - now : 0;
+            uint64_t now             = System::Timer::GetCurrentEpoch();
+            uint64_t timerArmValue   = (timerExpiryEpoch > now) ? timerExpiryEpoch - now : 0;
+            uint64_t timerSlackValue = (timerLatestEpoch > now + timerArmValue) ? timerLatestEpoch - now - timerArmValue : 0;
 
 #if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer set timer for %" PRIu64, timerArmValue);
+            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer set timer for %" PRIu64 " (slack %" PRIu64 ")",
+                          timerArmValue, timerSlackValue);
 #endif
             StopTimer();
-            res = mSystemLayer->StartTimer((uint32_t) timerArmValue, Timeout, this);
+            res = mSystemLayer->StartTimerWithSlack((uint32_t) timerArmValue, (uint32_t) timerSlackValue, Timeout, this);
 
             VerifyOrDieWithMsg(res == CHIP_NO_ERROR, ExchangeManager, "Cannot start ReliableMessageMgr::Timeout\n");
             mCurrentTimerExpiry = timerExpiryEpoch;
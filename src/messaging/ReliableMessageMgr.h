@@ -45,6 +45,8 @@ class ReliableMessageContext;
 class ReliableMessageMgr
 {
 public:
+    struct RetransQueue;
+
     /**
      *  @class RetransTableEntry
      *
@@ -54,6 +56,9 @@ public:
      *    acknowledgment back. If the acknowledgment is not received within a
      *    specific timeout, the message would be retransmitted from this table.
      *
+     *    Once its retransmission has been started, an entry is linked into the
+     *    queue of its peer session, which is kept in nextRetransTimeTick order.
+     *
      */
     struct RetransTableEntry
     {
@@ -63,6 +68,26 @@ public:
         EncryptedPacketBufferHandle retainedBuf; /**< The packet buffer holding the CHIP message. */
         uint16_t nextRetransTimeTick;            /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                       /**< A counter representing the number of times the message has been sent. */
+        RetransQueue * queue;                    /**< The peer queue the entry is linked into, if any. */
+        RetransTableEntry * nextInQueue;         /**< The next entry in the same peer queue. */
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+        System::Timer::Epoch firstSendTime; /**< When the message was first sent, for round-trip time sampling. */
+#endif
+    };
+
+    /**
+     *  @class RetransQueue
+     *
+     *  @brief
+     *    The retransmission table entries waiting on the same peer session,
+     *    ordered by their next retransmission time. Entries that fall due in
+     *    the same tick are sent back-to-back as a single batch.
+     *
+     */
+    struct RetransQueue
+    {
+        SecureSessionHandle session;
+        RetransTableEntry * head = nullptr; /**< The earliest entry, nullptr when the queue is unused. */
     };
 
 public:
@@ -218,6 +243,29 @@ public:
      */
     void ExpireTicks();
 
+    /**
+     * Return the number of retransmissions sent from the retransmission table.
+     */
+    uint32_t GetRetransmitCount() const { return mRetransmitCount; }
+
+    /**
+     * Return the number of retransmissions that were sent right behind another
+     * retransmission to the same peer, as part of the same batch.
+     */
+    uint32_t GetCoalescedRetransmitCount() const { return mCoalescedRetransmitCount; }
+
+    /**
+     * Return the number of round-trip time samples taken from acknowledged messages.
+     * Always zero unless CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL is enabled.
+     */
+    uint32_t GetRttSampleCount() const { return mRttSampleCount; }
+
+    /**
+     * Return the number of retransmission timeouts derived from a measured round-trip
+     * time rather than from the static retry intervals.
+     */
+    uint32_t GetAdaptiveTimeoutCount() const { return mAdaptiveTimeoutCount; }
+
     // Functions for testing
     int TestGetCountRetransTable();
     void TestSetIntervalShift(uint16_t value) { mTimerIntervalShift = value; }
@@ -229,6 +277,10 @@ private:
     uint64_t mTimeStampBase;                  // ReliableMessageProtocol timer base value to add offsets to evaluate timeouts
     System::Timer::Epoch mCurrentTimerExpiry; // Tracks when the ReliableMessageProtocol timer will next expire
     uint16_t mTimerIntervalShift;             // ReliableMessageProtocol Timer tick period shift
+    uint32_t mRetransmitCount;
+    uint32_t mCoalescedRetransmitCount;
+    uint32_t mRttSampleCount;
+    uint32_t mAdaptiveTimeoutCount;
 
     /* Placeholder function to run a function for all exchanges */
     template <typename Function>
@@ -242,8 +294,20 @@ private:
 
     void TicklessDebugDumpRetransTable(const char * log);
 
+    void Enqueue(RetransTableEntry & entry, SecureSessionHandle session);
+    void Dequeue(RetransTableEntry & entry);
+    void Requeue(RetransTableEntry & entry);
+    void SendDueEntries(RetransQueue & queue);
+
+    uint64_t GetRetransmitTimeoutTick(ReliableMessageContext * rc, uint8_t sendCount);
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+    Transport::RoundTripTimeEstimator * GetRoundTripTimeEstimator(ReliableMessageContext * rc);
+    void SampleRoundTripTime(RetransTableEntry & entry);
+#endif
+
     // ReliableMessageProtocol Global tables for timer context
     RetransTableEntry mRetransTable[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    RetransQueue mRetransQueues[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
 };
 
 } // namespace Messaging
@@ -110,6 +110,77 @@ namespace Messaging {
 #define CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS (3)
 #endif // CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS
 
+/**
+ *  @def CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+ *
+ *  @brief
+ *    Derive retransmission timeouts from the round-trip time measured to each
+ *    peer, rather than from the static initial and active retry intervals.
+ *
+ *  When enabled, the round-trip time of every message acknowledged without
+ *  having been retransmitted is fed into the smoothed estimate of its peer
+ *  connection. Once a peer has a sample, its retransmission timeout
+ *  is SRTT + 4 * RTTVAR (RFC 6298), doubled for every retransmission and
+ *  bounded by CHIP_CONFIG_RMP_ADAPTIVE_MIN_RETRY_INTERVAL and
+ *  CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL. Peers without a sample
+ *  keep using the static intervals.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+#define CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL 0
+#endif // CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+
+/**
+ *  @def CHIP_CONFIG_RMP_ADAPTIVE_MIN_RETRY_INTERVAL
+ *
+ *  @brief
+ *    Lower bound, in milliseconds, of an adaptive retransmission timeout.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_ADAPTIVE_MIN_RETRY_INTERVAL
+#define CHIP_CONFIG_RMP_ADAPTIVE_MIN_RETRY_INTERVAL (100)
+#endif // CHIP_CONFIG_RMP_ADAPTIVE_MIN_RETRY_INTERVAL
+
+/**
+ *  @def CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL
+ *
+ *  @brief
+ *    Upper bound, in milliseconds, of an adaptive retransmission timeout,
+ *    including its backoff.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL
+#define CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL CHIP_CONFIG_RMP_DEFAULT_INITIAL_RETRY_INTERVAL
+#endif // CHIP_CONFIG_RMP_ADAPTIVE_MAX_RETRY_INTERVAL
+
+/**
+ *  @def CHIP_CONFIG_RMP_ACK_WAKE_SLACK
+ *
+ *  @brief
+ *    How much later, in milliseconds, than its ack timeout a standalone
+ *    acknowledgment may be sent so that it shares a wakeup with another
+ *    timer, or with the System::Layer wake alignment period. It must stay
+ *    well below the retry interval of the peer, or the peer retransmits
+ *    before the acknowledgment reaches it.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_ACK_WAKE_SLACK
+#define CHIP_CONFIG_RMP_ACK_WAKE_SLACK (64)
+#endif // CHIP_CONFIG_RMP_ACK_WAKE_SLACK
+
+/**
+ *  @def CHIP_CONFIG_RMP_RETRANS_WAKE_SLACK
+ *
+ *  @brief
+ *    How much later, in milliseconds, than its retransmission timeout a
+ *    message may be retransmitted so that it shares a wakeup with another
+ *    timer, or with the System::Layer wake alignment period.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_RETRANS_WAKE_SLACK
+#define CHIP_CONFIG_RMP_RETRANS_WAKE_SLACK (100)
+#endif // CHIP_CONFIG_RMP_RETRANS_WAKE_SLACK
+
 /**
  *  @brief
  *    The ReliableMessageProtocol configuration.
@@ -0,0 +1,344 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the EchoBenchmark, run over a
+ *      loopback transport.
+ */
+
+#include "TestMessagingLayer.h"
+
+#include <core/CHIPCore.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/echo/EchoBenchmark.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <transport/SecureSessionMgr.h>
+#include <transport/TransportMgr.h>
+
+#include <nlbyteorder.h>
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+using namespace chip::Protocols::Echo;
+
+using TestContext = chip::Test::MessagingContext;
+
+TestContext sContext;
+
+/**
+ * Sends copies of the messages back to the sender from the event loop, as a network would: a response handled while its
+ * request is sent would otherwise be handled before the request is added to the retransmission table, and decoding the
+ * message in place would overwrite the copy retained for its retransmission.
+ */
+class LoopbackTransport : public Transport::Base
+{
+public:
+    /// Transports are required to have a constructor that takes exactly one argument
+    CHIP_ERROR Init(const char * unused) { return CHIP_NO_ERROR; }
+
+    CHIP_ERROR SendMessage(const PeerAddress & address, System::PacketBufferHandle msgBuf) override
+    {
+        VerifyOrReturnError(mPendingCount < kMaxPendingMessages, CHIP_ERROR_NO_MEMORY);
+        mPending[mPendingCount].mAddress = address;
+        mPending[mPendingCount].mBuffer  = System::PacketBufferHandle::NewWithData(msgBuf->Start(), msgBuf->DataLength());
+        VerifyOrReturnError(!mPending[mPendingCount].mBuffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+        mPendingCount++;
+        return sContext.GetSystemLayer().StartTimer(0, DeliverMessages, this);
+    }
+
+    bool CanSendToPeer(const PeerAddress & address) override { return true; }
+
+private:
+    static constexpr size_t kMaxPendingMessages = 16;
+
+    struct PendingMessage
+    {
+        PeerAddress mAddress;
+        System::PacketBufferHandle mBuffer;
+    };
+
+    static void DeliverMessages(System::Layer * systemLayer, void * appState, System::Error error)
+    {
+        LoopbackTransport * transport = static_cast<LoopbackTransport *>(appState);
+
+        while (transport->mPendingCount > 0)
+        {
+            PeerAddress address               = transport->mPending[0].mAddress;
+            System::PacketBufferHandle buffer = std::move(transport->mPending[0].mBuffer);
+
+            transport->mPendingCount--;
+            for (size_t i = 0; i < transport->mPendingCount; i++)
+            {
+                transport->mPending[i] = std::move(transport->mPending[i + 1]);
+            }
+            transport->HandleMessageReceived(address, std::move(buffer));
+        }
+    }
+
+    PendingMessage mPending[kMaxPendingMessages];
+    size_t mPendingCount = 0;
+};
+
+TransportMgr<LoopbackTransport> gTransportMgr;
+
+SecureSessionHandle GetSessionToPeer(TestContext & ctx)
+{
+    // TODO: temprary create a SecureSessionHandle from node id, will be fix in PR 3602
+    return { ctx.GetDestinationNodeId(), ctx.GetPeerKeyId(), ctx.GetAdminId() };
+}
+
+void CountDone(void * context, EchoBenchmark & benchmark)
+{
+    (*static_cast<int *>(context))++;
+}
+
+void CheckLatencyHistogram(nlTestSuite * inSuite, void * inContext)
+{
+    EchoLatencyHistogram histogram;
+
+    NL_TEST_ASSERT(inSuite, histogram.GetCount() == 0);
+    NL_TEST_ASSERT(inSuite, histogram.GetMinUs() == 0);
+    NL_TEST_ASSERT(inSuite, histogram.GetPercentileUs(50) == 0);
+
+    histogram.Add(1);
+    histogram.Add(3);
+    histogram.Add(1000);
+    histogram.Add(1500);
+    histogram.Add(UINT64_MAX);
+
+    NL_TEST_ASSERT(inSuite, histogram.GetCount() == 5);
+    NL_TEST_ASSERT(inSuite, histogram.GetBucketCount(0) == 1);
+    NL_TEST_ASSERT(inSuite, histogram.GetBucketCount(1) == 1);
+    NL_TEST_ASSERT(inSuite, histogram.GetBucketCount(9) == 1);
+    NL_TEST_ASSERT(inSuite, histogram.GetBucketCount(10) == 1);
+    NL_TEST_ASSERT(inSuite, histogram.GetBucketCount(EchoLatencyHistogram::kBucketCount - 1) == 1);
+    NL_TEST_ASSERT(inSuite, histogram.GetMinUs() == 1);
+    NL_TEST_ASSERT(inSuite, histogram.GetMaxUs() == UINT64_MAX);
+
+    // The median, 1000 us, is in the bucket from 512 up to 1024 us
+    NL_TEST_ASSERT(inSuite, histogram.GetPercentileUs(50) == 1024);
+    NL_TEST_ASSERT(inSuite, histogram.GetPercentileUs(20) == 2);
+    NL_TEST_ASSERT(inSuite, histogram.GetPercentileUs(100) == UINT64_MAX);
+
+    histogram.Clear();
+    NL_TEST_ASSERT(inSuite, histogram.GetCount() == 0);
+    NL_TEST_ASSERT(inSuite, histogram.GetBucketCount(0) == 0);
+}
+
+void CheckPipelinedRequests(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    EchoServer server;
+    EchoBenchmark benchmark;
+    EchoBenchmarkParams params;
+    int doneCount = 0;
+
+    NL_TEST_ASSERT(inSuite, server.Init(&ctx.GetExchangeManager()) == CHIP_NO_ERROR);
+
+    // The server shares the exchange manager, whose exchanges also hold the responses until they are acknowledged
+    params.mRequestCount    = 20;
+    params.mMaxOutstanding  = 2;
+    params.mMinPayloadSize  = 10;
+    params.mMaxPayloadSize  = 40;
+    params.mPayloadSizeStep = 10;
+
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, CountDone, &doneCount) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetContextsInUse() == 2);
+
+    ctx.DriveIOUntil(1000, [&doneCount] { return doneCount > 0; });
+    NL_TEST_ASSERT(inSuite, doneCount == 1);
+    NL_TEST_ASSERT(inSuite, !benchmark.IsRunning());
+
+    const EchoBenchmarkStats & stats = benchmark.GetStats(Type::kUdp);
+    NL_TEST_ASSERT(inSuite, stats.mSent == 20);
+    NL_TEST_ASSERT(inSuite, stats.mReceived == 20);
+    NL_TEST_ASSERT(inSuite, stats.mLost == 0);
+    NL_TEST_ASSERT(inSuite, stats.mSendFailures == 0);
+    NL_TEST_ASSERT(inSuite, stats.mBytesReceived == 5 * (10 + 20 + 30 + 40));
+    NL_TEST_ASSERT(inSuite, stats.mRtt.GetCount() == 20);
+    NL_TEST_ASSERT(inSuite, benchmark.GetStats(Type::kTcp).mSent == 0);
+    NL_TEST_ASSERT(inSuite, benchmark.GetStats(Type::kBle).mSent == 0);
+
+    server.Shutdown();
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetContextsInUse() == 0);
+}
+
+void CheckInvalidParams(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    EchoBenchmark benchmark;
+    EchoBenchmarkParams params;
+
+    params.mMaxOutstanding = 0;
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, nullptr, nullptr) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+
+    params.mMaxOutstanding = EchoBenchmark::kMaxOutstandingRequests + 1;
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, nullptr, nullptr) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+
+    params.mMaxOutstanding = 1;
+    params.mMaxPayloadSize = static_cast<uint16_t>(ctx.GetSecureSessionManager().GetMaxAppMessageLength(GetSessionToPeer(ctx)) + 1);
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, nullptr, nullptr) ==
+                       CHIP_ERROR_MESSAGE_TOO_LONG);
+    NL_TEST_ASSERT(inSuite, !benchmark.IsRunning());
+}
+
+void CheckLostRequests(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    EchoBenchmark benchmark;
+    EchoBenchmarkParams params;
+    int doneCount = 0;
+
+    // Without a server, the requests are dropped by the peer and time out
+    params.mRequestCount      = 4;
+    params.mMaxOutstanding    = 2;
+    params.mResponseTimeoutMs = 10;
+    params.mReliable          = false;
+
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, CountDone, &doneCount) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, benchmark.IsRunning());
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, CountDone, &doneCount) ==
+                       CHIP_ERROR_INCORRECT_STATE);
+
+    ctx.DriveIOUntil(1000, [&doneCount] { return doneCount > 0; });
+
+    const EchoBenchmarkStats & stats = benchmark.GetStats(Type::kUdp);
+    NL_TEST_ASSERT(inSuite, doneCount == 1);
+    NL_TEST_ASSERT(inSuite, stats.mSent == 4);
+    NL_TEST_ASSERT(inSuite, stats.mReceived == 0);
+    NL_TEST_ASSERT(inSuite, stats.mLost == 4);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetContextsInUse() == 0);
+}
+
+void CheckRequestInterval(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    EchoServer server;
+    EchoBenchmark benchmark;
+    EchoBenchmarkParams params;
+    int doneCount = 0;
+
+    NL_TEST_ASSERT(inSuite, server.Init(&ctx.GetExchangeManager()) == CHIP_NO_ERROR);
+
+    params.mRequestCount      = 3;
+    params.mMaxOutstanding    = 3;
+    params.mRequestIntervalMs = 20;
+    params.mReliable          = false;
+
+    // Only the first request is sent at once, the others wait for the interval
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, CountDone, &doneCount) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, benchmark.GetStats(Type::kUdp).mSent == 1);
+
+    ctx.DriveIOUntil(1000, [&doneCount] { return doneCount > 0; });
+
+    NL_TEST_ASSERT(inSuite, doneCount == 1);
+    NL_TEST_ASSERT(inSuite, benchmark.GetStats(Type::kUdp).mReceived == 3);
+    NL_TEST_ASSERT(inSuite, benchmark.GetElapsedUs() >= 2 * 20 * 1000);
+
+    // A stopped run does not call its callback
+    NL_TEST_ASSERT(inSuite, benchmark.Start(&ctx.GetExchangeManager(), GetSessionToPeer(ctx), params, CountDone, &doneCount) ==
+                       CHIP_NO_ERROR);
+    benchmark.Stop();
+    NL_TEST_ASSERT(inSuite, !benchmark.IsRunning());
+    ctx.DriveIOUntil(50, [] { return false; });
+    NL_TEST_ASSERT(inSuite, doneCount == 1);
+    NL_TEST_ASSERT(inSuite, benchmark.GetStats(Type::kUdp).mSent == 1);
+
+    server.Shutdown();
+}
+
+// Test Suite
+
+/**
+ *  Test Suite that lists all the test functions.
+ */
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test EchoBenchmark::LatencyHistogram",  CheckLatencyHistogram),
+    NL_TEST_DEF("Test EchoBenchmark::PipelinedRequests", CheckPipelinedRequests),
+    NL_TEST_DEF("Test EchoBenchmark::InvalidParams",     CheckInvalidParams),
+    NL_TEST_DEF("Test EchoBenchmark::LostRequests",      CheckLostRequests),
+    NL_TEST_DEF("Test EchoBenchmark::RequestInterval",   CheckRequestInterval),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int Initialize(void * aContext);
+int Finalize(void * aContext);
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "Test-CHIP-EchoBenchmark",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+/**
+ *  Initialize the test suite.
+ */
+int Initialize(void * aContext)
+{
+    CHIP_ERROR err = chip::Platform::MemoryInit();
+    if (err != CHIP_NO_ERROR)
+        return FAILURE;
+
+    err = gTransportMgr.Init("LOOPBACK");
+    if (err != CHIP_NO_ERROR)
+        return FAILURE;
+
+    err = reinterpret_cast<TestContext *>(aContext)->Init(&sSuite, &gTransportMgr);
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+/**
+ *  Finalize the test suite.
+ */
+int Finalize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Shutdown();
+    chip::Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+} // namespace
+
+/**
+ *  Main
+ */
+int TestEchoBenchmark()
+{
+    // Run test suit against one context
+    nlTestRunner(&sSuite, &sContext);
+
+    return (nlTestRunnerStats(&sSuite));
+}
@@ -83,6 +83,58 @@ public:
     bool IsOnMessageReceivedCalled = false;
 };
 
+class MockRecordingDelegate : public ExchangeDelegate
+{
+public:
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle buffer) override
+    {
+        ReceivedCount++;
+        LastExchange = ec;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    int ReceivedCount              = 0;
+    ExchangeContext * LastExchange = nullptr;
+};
+
+class MockResponderDelegate : public ExchangeDelegate
+{
+public:
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle buffer) override
+    {
+        ReceivedCount++;
+        ec->SendMessage(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType(),
+                        System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                        SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+        ec->Close();
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    int ReceivedCount = 0;
+};
+
+int sTimeoutCount = 0;
+
+class MockTimeoutDelegate : public ExchangeDelegate
+{
+public:
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle buffer) override
+    {}
+
+    void OnResponseTimeout(ExchangeContext * ec) override
+    {
+        TimeoutOrder = sTimeoutCount++;
+        ec->Close();
+    }
+
+    int TimeoutOrder = -1;
+};
+
 void CheckNewContextTest(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -167,6 +219,145 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
     ec1->Close();
 }
 
+void CheckUmhDispatchTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err;
+    const Protocols::Id protocol(VendorId::Common, 0x0001);
+    MockAppDelegate typeDelegate;
+    MockAppDelegate protocolDelegate;
+    MockAppDelegate otherProtocolDelegate;
+
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(protocol, &protocolDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(protocol, 0x0001, &typeDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::Id(VendorId::Common, 0x0002), 0x0002,
+                                                                            &otherProtocolDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // A handler for the exact message type is preferred over the protocol-wide one...
+    ExchangeContext * ec = ctx.NewExchangeToPeer(nullptr);
+    NL_TEST_ASSERT(inSuite, ec != nullptr);
+    ec->SendMessage(protocol, 0x0001, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                    SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    ec->Close();
+    NL_TEST_ASSERT(inSuite, typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, !protocolDelegate.IsOnMessageReceivedCalled);
+
+    // ...which catches every other message type of the protocol...
+    typeDelegate.IsOnMessageReceivedCalled = false;
+    ec                                     = ctx.NewExchangeToPeer(nullptr);
+    NL_TEST_ASSERT(inSuite, ec != nullptr);
+    ec->SendMessage(protocol, 0x0002, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                    SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    ec->Close();
+    NL_TEST_ASSERT(inSuite, !typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, protocolDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, !otherProtocolDelegate.IsOnMessageReceivedCalled);
+
+    // ...and the exact type once its own handler is gone.
+    protocolDelegate.IsOnMessageReceivedCalled = false;
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(protocol, 0x0001);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ec = ctx.NewExchangeToPeer(nullptr);
+    NL_TEST_ASSERT(inSuite, ec != nullptr);
+    ec->SendMessage(protocol, 0x0001, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                    SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    ec->Close();
+    NL_TEST_ASSERT(inSuite, !typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, protocolDelegate.IsOnMessageReceivedCalled);
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(protocol);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::Id(VendorId::Common, 0x0002), 0x0002);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+void CheckExchangeMatchingTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr size_t kExchangeCount = 4;
+    static_assert(kExchangeCount < CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, "Responder needs a free exchange context");
+
+    CHIP_ERROR err;
+    const Protocols::Id protocol(VendorId::Common, 0x0001);
+    MockResponderDelegate responder;
+    MockRecordingDelegate initiators[kExchangeCount];
+    ExchangeContext * exchanges[kExchangeCount];
+
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(protocol, &responder);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        exchanges[i] = ctx.NewExchangeToPeer(&initiators[i]);
+        NL_TEST_ASSERT(inSuite, exchanges[i] != nullptr);
+    }
+
+    // Each response must be routed back to the exchange that sent the request, not to a newer or older one.
+    for (size_t i = kExchangeCount; i-- > 0;)
+    {
+        exchanges[i]->SendMessage(protocol, 0x0001, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                  SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+        NL_TEST_ASSERT(inSuite, initiators[i].ReceivedCount == 1);
+        NL_TEST_ASSERT(inSuite, initiators[i].LastExchange == exchanges[i]);
+    }
+    NL_TEST_ASSERT(inSuite, responder.ReceivedCount == static_cast<int>(kExchangeCount));
+
+    for (auto ec : exchanges)
+    {
+        ec->Close();
+    }
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetContextsInUse() == 0);
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(protocol);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+void CheckResponseTimeoutTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr ExchangeContext::Timeout kTimeoutsMs[] = { 60, 20, 40, 30 };
+    constexpr size_t kExchangeCount                  = sizeof(kTimeoutsMs) / sizeof(kTimeoutsMs[0]);
+    static_assert(kExchangeCount <= CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, "Not enough exchange contexts");
+
+    // No handler is registered for the protocol, which leaves the requests unanswered
+    const Protocols::Id protocol(VendorId::Common, 0x0003);
+    MockTimeoutDelegate delegates[kExchangeCount];
+    ExchangeContext * exchanges[kExchangeCount];
+
+    SendFlags sendFlags(Messaging::SendMessageFlags::kExpectResponse);
+    sendFlags.Set(Messaging::SendMessageFlags::kNoAutoRequestAck);
+
+    sTimeoutCount = 0;
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        exchanges[i] = ctx.NewExchangeToPeer(&delegates[i]);
+        NL_TEST_ASSERT(inSuite, exchanges[i] != nullptr);
+        exchanges[i]->SetResponseTimeout(kTimeoutsMs[i]);
+
+        CHIP_ERROR err = exchanges[i]->SendMessage(protocol, 0x0001,
+                                                   System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize), sendFlags);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    // A closed exchange no longer times out, whatever its place among the deadlines
+    exchanges[3]->Close();
+
+    // The others time out by deadline, not in the order they were sent
+    ctx.DriveIOUntil(1000, [] { return sTimeoutCount == 3; });
+    NL_TEST_ASSERT(inSuite, sTimeoutCount == 3);
+    NL_TEST_ASSERT(inSuite, delegates[1].TimeoutOrder == 0);
+    NL_TEST_ASSERT(inSuite, delegates[2].TimeoutOrder == 1);
+    NL_TEST_ASSERT(inSuite, delegates[0].TimeoutOrder == 2);
+    NL_TEST_ASSERT(inSuite, delegates[3].TimeoutOrder == -1);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetContextsInUse() == 0);
+}
+
 // Test Suite
 
 /**
@@ -178,6 +369,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ExchangeMgr::NewContext",               CheckNewContextTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckUmhRegistrationTest", CheckUmhRegistrationTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
+    NL_TEST_DEF("Test ExchangeMgr::CheckUmhDispatchTest",     CheckUmhDispatchTest),
+    NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMatchingTest", CheckExchangeMatchingTest),
+    NL_TEST_DEF("Test ExchangeMgr::CheckResponseTimeoutTest",  CheckResponseTimeoutTest),
 
     NL_TEST_SENTINEL()
 };
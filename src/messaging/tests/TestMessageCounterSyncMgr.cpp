@@ -289,7 +289,7 @@ void CheckAddToReceiveTable(nlTestSuite * inSuite, void * inContext)
     System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
     NL_TEST_ASSERT(inSuite, !buffer.IsNull());
 
-    CHIP_ERROR err = sm->AddToReceiveTable(std::move(buffer));
+    CHIP_ERROR err = sm->AddToReceiveTable(kSourceNodeId, std::move(buffer));
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
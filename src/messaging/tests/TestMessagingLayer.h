@@ -28,6 +28,7 @@
 extern "C" {
 #endif
 
+int TestEchoBenchmark(void);
 int TestExchangeMgr(void);
 int TestMessageCounterSyncMgr(void);
 int TestReliableMessageProtocol(void);
@@ -199,6 +199,112 @@ void CheckResendMessage(nlTestSuite * inSuite, void * inContext)
     exchange->Close();
 }
 
+void CheckCoalescedResend(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    constexpr size_t kExchangeCount = 3;
+    static_assert(kExchangeCount <= CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE, "Retransmission table too small for the test");
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    MockAppDelegate mockSender;
+    ExchangeContext * exchanges[kExchangeCount];
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    const uint32_t retransmitCount = rm->GetRetransmitCount();
+    const uint32_t coalescedCount  = rm->GetCoalescedRetransmitCount();
+
+    gSendMessageCount = 0;
+
+    for (auto & exchange : exchanges)
+    {
+        exchange = ctx.NewExchangeToPeer(&mockSender);
+        NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+        exchange->GetReliableMessageContext()->SetConfig({
+            1, // CHIP_CONFIG_RMP_DEFAULT_INITIAL_RETRY_INTERVAL
+            1, // CHIP_CONFIG_RMP_DEFAULT_ACTIVE_RETRY_INTERVAL
+        });
+
+        err = exchange->SendMessage(Echo::MsgType::EchoRequest, chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                    Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, gSendMessageCount == kExchangeCount);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == kExchangeCount);
+
+    // All three messages go to the same peer and fall due in the same tick: they are resent as one batch.
+    test_os_sleep_ms(65);
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_SYSTEM_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gSendMessageCount == 2 * kExchangeCount);
+    NL_TEST_ASSERT(inSuite, rm->GetRetransmitCount() - retransmitCount == kExchangeCount);
+    NL_TEST_ASSERT(inSuite, rm->GetCoalescedRetransmitCount() - coalescedCount == kExchangeCount - 1);
+
+    // Dropping one entry leaves the others queued.
+    rm->ClearRetransTable(exchanges[1]->GetReliableMessageContext());
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == kExchangeCount - 1);
+
+    test_os_sleep_ms(65);
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm, CHIP_SYSTEM_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gSendMessageCount == 3 * kExchangeCount - 1);
+    NL_TEST_ASSERT(inSuite, rm->GetCoalescedRetransmitCount() - coalescedCount == 2 * kExchangeCount - 3);
+
+    for (auto exchange : exchanges)
+    {
+        rm->ClearRetransTable(exchange->GetReliableMessageContext());
+        exchange->Close();
+    }
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+}
+
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+void CheckAdaptiveRetransTimeout(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    MockAppDelegate mockSender;
+    ExchangeContext * exchange = ctx.NewExchangeToPeer(&mockSender);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+    ReliableMessageMgr * rm                = ctx.GetExchangeManager().GetReliableMessageMgr();
+    ReliableMessageContext * rc            = exchange->GetReliableMessageContext();
+    Transport::PeerConnectionState * state = ctx.GetSecureSessionManager().GetPeerConnectionState(exchange->GetSecureSession());
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+    NL_TEST_ASSERT(inSuite, state != nullptr);
+
+    const uint32_t sampleCount   = rm->GetRttSampleCount();
+    const uint32_t adaptiveCount = rm->GetAdaptiveTimeoutCount();
+    state->GetRoundTripTimeEstimator().Reset();
+
+    // Without a sample, the static interval applies.
+    err = exchange->SendMessage(Echo::MsgType::EchoRequest, chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, rm->GetAdaptiveTimeoutCount() == adaptiveCount);
+
+    // Acknowledging the message, which was never retransmitted, yields a sample.
+    NL_TEST_ASSERT(inSuite, rm->CheckAndRemRetransTable(rc, state->GetSendMessageIndex() - 1));
+    NL_TEST_ASSERT(inSuite, rm->GetRttSampleCount() == sampleCount + 1);
+    NL_TEST_ASSERT(inSuite, state->GetRoundTripTimeEstimator().HasSample());
+
+    // The next message then gets a timeout derived from it.
+    err = exchange->SendMessage(Echo::MsgType::EchoRequest, chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, rm->GetAdaptiveTimeoutCount() == adaptiveCount + 1);
+
+    rm->ClearRetransTable(rc);
+    exchange->Close();
+}
+#endif // CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+
 void CheckSendStandaloneAckMessage(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -219,6 +325,37 @@ void CheckSendStandaloneAckMessage(nlTestSuite * inSuite, void * inContext)
     exchange->Close();
 }
 
+void CheckExpiredSessionClearsRetrans(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    MockAppDelegate mockSender;
+    ExchangeContext * exchange = ctx.NewExchangeToPeer(&mockSender);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    CHIP_ERROR err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer),
+                                           Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The closed exchange is kept for the retransmission of its message, until the session expires
+    exchange->Close();
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetContextsInUse() == 1);
+
+    // TODO: temprary create a SecureSessionHandle from node id, will be fix in PR 3602
+    ctx.GetSecureSessionManager().ExpirePairing({ ctx.GetDestinationNodeId(), ctx.GetPeerKeyId(), ctx.GetAdminId() });
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetContextsInUse() == 0);
+}
+
 // Test Suite
 
 /**
@@ -230,7 +367,13 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", CheckAddClearRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailRetrans", CheckFailRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendMessage", CheckResendMessage),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckCoalescedResend", CheckCoalescedResend),
+#if CHIP_CONFIG_RMP_ADAPTIVE_RETRY_INTERVAL
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckAdaptiveRetransTimeout", CheckAdaptiveRetransTimeout),
+#endif
     NL_TEST_DEF("Test ReliableMessageMgr::CheckSendStandaloneAckMessage", CheckSendStandaloneAckMessage),
+    // Expires the session to the peer: keep last
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckExpiredSessionClearsRetrans", CheckExpiredSessionClearsRetrans),
 
     NL_TEST_SENTINEL()
 };
@@ -57,14 +57,24 @@ CHIP_ERROR DeviceControlServer::SetRegulatoryConfig(uint8_t location, const char
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    err = ConfigurationMgr().StoreRegulatoryLocation(location);
+    err = ConfigurationMgr().BeginConfigTransaction();
     SuccessOrExit(err);
 
-    err = ConfigurationMgr().StoreCountryCode(countryCode, strlen(countryCode));
-    SuccessOrExit(err);
+    err = ConfigurationMgr().StoreRegulatoryLocation(location);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = ConfigurationMgr().StoreCountryCode(countryCode, strlen(countryCode));
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = ConfigurationMgr().StoreBreadcrumb(breadcrumb);
+    }
 
-    err = ConfigurationMgr().StoreBreadcrumb(breadcrumb);
-    SuccessOrExit(err);
+    // Always end the transaction, even after a failed write.
+    {
+        CHIP_ERROR commitErr = ConfigurationMgr().CommitConfigTransaction();
+        err                  = (err == CHIP_NO_ERROR) ? commitErr : err;
+    }
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -57,6 +57,8 @@ private:
     void _InitiateFactoryReset(void);
     CHIP_ERROR _ReadPersistedStorageValue(::chip::Platform::PersistedStorage::Key key, uint32_t & value);
     CHIP_ERROR _WritePersistedStorageValue(::chip::Platform::PersistedStorage::Key key, uint32_t value);
+    CHIP_ERROR _BeginConfigTransaction(void);
+    CHIP_ERROR _CommitConfigTransaction(void);
 
     // NOTE: Other public interface methods are implemented by GenericConfigurationManagerImpl<>.
 
@@ -99,5 +101,15 @@ inline CHIP_ERROR ConfigurationManagerImpl::_GetPrimaryWiFiMACAddress(uint8_t *
     return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
 }
 
+inline CHIP_ERROR ConfigurationManagerImpl::_BeginConfigTransaction()
+{
+    return BeginTransaction();
+}
+
+inline CHIP_ERROR ConfigurationManagerImpl::_CommitConfigTransaction()
+{
+    return CommitTransaction();
+}
+
 } // namespace DeviceLayer
 } // namespace chip
@@ -68,6 +68,7 @@ namespace Internal {
 static nvm3_Handle_t handle;
 static SemaphoreHandle_t nvm3_Sem;
 static StaticSemaphore_t nvm3_SemStruct;
+static uint32_t nvm3_TransactionDepth; // NVM3 stays open while non-zero.
 
 // Declare NVM3 data area and cache.
 
@@ -654,10 +655,54 @@ void EFR32Config::RepackNvm3Flash(void)
     nvm3_repack(&handle);
 }
 
+CHIP_ERROR EFR32Config::BeginTransaction(void)
+{
+    CHIP_ERROR err;
+
+    if (pdFALSE == xSemaphoreTake(nvm3_Sem, pdMS_TO_TICKS(EFR32_SEM_TIMEOUT_ms)))
+    {
+        return CHIP_ERROR_TIMEOUT;
+    }
+
+    // The handle stays open, the operations of the transaction then find it open instead of opening NVM3 again.
+    err = MapNvm3Error(nvm3_open(&handle, &chipNvm3));
+    if (err == CHIP_NO_ERROR)
+    {
+        nvm3_TransactionDepth++;
+    }
+
+    OnExit();
+    return err;
+}
+
+CHIP_ERROR EFR32Config::CommitTransaction(void)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    if (pdFALSE == xSemaphoreTake(nvm3_Sem, pdMS_TO_TICKS(EFR32_SEM_TIMEOUT_ms)))
+    {
+        return CHIP_ERROR_TIMEOUT;
+    }
+
+    VerifyOrExit(nvm3_TransactionDepth > 0, err = CHIP_ERROR_INCORRECT_STATE);
+
+    if (--nvm3_TransactionDepth == 0 && nvm3_repackNeeded(&handle))
+    {
+        err = MapNvm3Error(nvm3_repack(&handle));
+    }
+
+exit:
+    OnExit();
+    return err;
+}
+
 void EFR32Config::OnExit()
 {
     xSemaphoreGive(nvm3_Sem);
-    nvm3_close(&handle);
+    if (nvm3_TransactionDepth == 0)
+    {
+        nvm3_close(&handle);
+    }
 }
 
 } // namespace Internal
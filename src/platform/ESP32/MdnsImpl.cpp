@@ -113,6 +113,16 @@ CHIP_ERROR ChipMdnsStopPublishService(const MdnsService * service)
     return CHIP_ERROR_NOT_IMPLEMENTED;
 }
 
+CHIP_ERROR ChipMdnsRemoveServices()
+{
+    return ChipMdnsStopPublish();
+}
+
+CHIP_ERROR ChipMdnsFinalizeServiceUpdate()
+{
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ChipMdnsBrowse(const char * /*type*/, MdnsServiceProtocol /*protocol*/, chip::Inet::IPAddressType addressType,
                           chip::Inet::InterfaceId /*interface*/, MdnsBrowseCallback /*callback*/, void * /*context*/)
 {
@@ -54,12 +54,12 @@ const ChipBleUUID ChipUUID_CHIPoBLEChar_RX = { { 0x18, 0xEE, 0x2E, 0xF5, 0x26, 0
 const ChipBleUUID ChipUUID_CHIPoBLEChar_TX = { { 0x18, 0xEE, 0x2E, 0xF5, 0x26, 0x3D, 0x45, 0x59, 0x95, 0x9F, 0x4F, 0x9C, 0x42, 0x9F,
                                                  0x9D, 0x12 } };
 
-void HandleConnectTimeout(chip::System::Layer *, void * apEndpoint, chip::System::Error)
+void HandleConnectTimeout(chip::System::Layer *, void * apScanConfig, chip::System::Error)
 {
-    assert(apEndpoint != nullptr);
+    assert(apScanConfig != nullptr);
 
-    CancelConnect(static_cast<BluezEndpoint *>(apEndpoint));
-    BLEManagerImpl::HandleConnectFailed(CHIP_ERROR_TIMEOUT);
+    g_cancellable_cancel(static_cast<BLEScanConfig *>(apScanConfig)->mpConnectCancellable);
+    BLEManagerImpl::HandleConnectFailed(apScanConfig, CHIP_ERROR_TIMEOUT);
 }
 
 } // namespace
@@ -275,21 +275,24 @@ void BLEManagerImpl::HandlePlatformSpecificBLEEvent(const ChipDeviceEvent * apEv
     ChipLogDetail(DeviceLayer, "HandlePlatformSpecificBLEEvent %d", apEvent->Type);
     switch (apEvent->Type)
     {
-    case DeviceEventType::kPlatformLinuxBLECentralConnected:
-        if (mBLEScanConfig.mBleScanState == BleScanState::kConnecting)
+    case DeviceEventType::kPlatformLinuxBLECentralConnected: {
+        BLEScanConfig * scanConfig = FindConnectingScanConfig(apEvent->Platform.BLECentralConnected.mConnection);
+        if (scanConfig != nullptr)
         {
-            BleConnectionDelegate::OnConnectionComplete(mBLEScanConfig.mAppState,
-                                                        apEvent->Platform.BLECentralConnected.mConnection);
-            CleanScanConfig();
+            BleConnectionDelegate::OnConnectionComplete(scanConfig->mAppState, apEvent->Platform.BLECentralConnected.mConnection);
+            CleanScanConfig(*scanConfig);
         }
         break;
-    case DeviceEventType::kPlatformLinuxBLECentralConnectFailed:
-        if (mBLEScanConfig.mBleScanState == BleScanState::kConnecting)
+    }
+    case DeviceEventType::kPlatformLinuxBLECentralConnectFailed: {
+        BLEScanConfig * scanConfig = static_cast<BLEScanConfig *>(apEvent->Platform.BLECentralConnectFailed.mpScanConfig);
+        if (scanConfig->mBleScanState == BleScanState::kConnecting)
         {
-            BleConnectionDelegate::OnConnectionError(mBLEScanConfig.mAppState, apEvent->Platform.BLECentralConnectFailed.mError);
-            CleanScanConfig();
+            BleConnectionDelegate::OnConnectionError(scanConfig->mAppState, apEvent->Platform.BLECentralConnectFailed.mError);
+            CleanScanConfig(*scanConfig);
         }
         break;
+    }
     case DeviceEventType::kPlatformLinuxBLEWriteComplete:
         HandleWriteConfirmation(apEvent->Platform.BLEWriteComplete.mConnection, &CHIP_BLE_SVC_ID, &ChipUUID_CHIPoBLEChar_RX);
         break;
@@ -443,13 +446,14 @@ void BLEManagerImpl::HandleNewConnection(BLE_CONNECTION_OBJECT conId)
     }
 }
 
-void BLEManagerImpl::HandleConnectFailed(CHIP_ERROR error)
+void BLEManagerImpl::HandleConnectFailed(void * apScanConfig, CHIP_ERROR error)
 {
     if (sInstance.mIsCentral)
     {
         ChipDeviceEvent event;
-        event.Type                                    = DeviceEventType::kPlatformLinuxBLECentralConnectFailed;
-        event.Platform.BLECentralConnectFailed.mError = error;
+        event.Type                                          = DeviceEventType::kPlatformLinuxBLECentralConnectFailed;
+        event.Platform.BLECentralConnectFailed.mpScanConfig = apScanConfig;
+        event.Platform.BLECentralConnectFailed.mError       = error;
         PlatformMgr().PostEvent(&event);
     }
 }
@@ -666,72 +670,130 @@ void BLEManagerImpl::NotifyChipConnectionClosed(BLE_CONNECTION_OBJECT conId)
     ChipLogProgress(Ble, "Got notification regarding chip connection closure");
 }
 
-void BLEManagerImpl::InitiateScan(BleScanState scanType)
+void BLEManagerImpl::InitiateScan(BLEScanConfig & aScanConfig)
 {
     DriveBLEState();
 
-    if (scanType == BleScanState::kNotScanning)
+    if (aScanConfig.mBleScanState == BleScanState::kConnecting)
     {
-        BleConnectionDelegate::OnConnectionError(mBLEScanConfig.mAppState, CHIP_ERROR_INCORRECT_STATE);
+        // The scan running for another request has already found the device.
+        return;
+    }
+
+    if (aScanConfig.mBleScanState != BleScanState::kScanForDiscriminator &&
+        aScanConfig.mBleScanState != BleScanState::kScanForAddress)
+    {
+        FailScan(aScanConfig, CHIP_ERROR_INCORRECT_STATE);
         ChipLogError(Ble, "Invalid scan type requested");
         return;
     }
 
     if (mpEndpoint == nullptr)
     {
-        BleConnectionDelegate::OnConnectionError(mBLEScanConfig.mAppState, CHIP_ERROR_INCORRECT_STATE);
+        FailScan(aScanConfig, CHIP_ERROR_INCORRECT_STATE);
         ChipLogError(Ble, "BLE Layer is not yet initialized");
         return;
     }
 
     if (mpEndpoint->mpAdapter == nullptr)
     {
-        BleConnectionDelegate::OnConnectionError(mBLEScanConfig.mAppState, CHIP_ERROR_INCORRECT_STATE);
+        FailScan(aScanConfig, CHIP_ERROR_INCORRECT_STATE);
         ChipLogError(Ble, "No adapter available for new connection establishment");
         return;
     }
 
-    mDeviceScanner               = Internal::ChipDeviceScanner::Create(mpEndpoint->mpAdapter, this);
-    mBLEScanConfig.mBleScanState = scanType;
+    // The connection requests made while a scan is running are served by that scan.
+    if (mFlags.Has(Flags::kScanning))
+    {
+        return;
+    }
+
+    mDeviceScanner = Internal::ChipDeviceScanner::Create(mpEndpoint->mpAdapter, this);
 
     if (!mDeviceScanner)
     {
-        mBLEScanConfig.mBleScanState = BleScanState::kNotScanning;
-        BleConnectionDelegate::OnConnectionError(mBLEScanConfig.mAppState, CHIP_ERROR_INTERNAL);
+        FailScan(aScanConfig, CHIP_ERROR_INTERNAL);
         ChipLogError(Ble, "Failed to create a BLE device scanner");
         return;
     }
 
+    mFlags.Set(Flags::kScanning);
     CHIP_ERROR err = mDeviceScanner->StartScan(kNewConnectionScanTimeoutMs);
     if (err != CHIP_NO_ERROR)
     {
-        mBLEScanConfig.mBleScanState = BleScanState::kNotScanning;
+        mFlags.Clear(Flags::kScanning);
         ChipLogError(Ble, "Failed to start a BLE can: %s", chip::ErrorStr(err));
-        BleConnectionDelegate::OnConnectionError(mBLEScanConfig.mAppState, err);
+        FailScan(aScanConfig, err);
         return;
     }
 }
 
-void BLEManagerImpl::CleanScanConfig()
+void BLEManagerImpl::FailScan(BLEScanConfig & aScanConfig, CHIP_ERROR aError)
+{
+    aScanConfig.mBleScanState = BleScanState::kNotScanning;
+    BleConnectionDelegate::OnConnectionError(aScanConfig.mAppState, aError);
+}
+
+void BLEManagerImpl::CleanScanConfig(BLEScanConfig & aScanConfig)
+{
+    if (aScanConfig.mBleScanState == BleScanState::kConnecting)
+        DeviceLayer::SystemLayer.CancelTimer(HandleConnectTimeout, &aScanConfig);
+
+    if (aScanConfig.mpConnectCancellable != nullptr)
+    {
+        g_object_unref(aScanConfig.mpConnectCancellable);
+        aScanConfig.mpConnectCancellable = nullptr;
+    }
+
+    aScanConfig.mBleScanState = BleScanState::kNotScanning;
+}
+
+BLEScanConfig * BLEManagerImpl::FindConnectingScanConfig(BLE_CONNECTION_OBJECT conId)
 {
-    if (mBLEScanConfig.mBleScanState == BleScanState::kConnecting)
-        DeviceLayer::SystemLayer.CancelTimer(HandleConnectTimeout, mpEndpoint);
+    const char * peerAddress = static_cast<BluezConnection *>(conId)->mpPeerAddress;
+
+    for (BLEScanConfig & scanConfig : mBLEScanConfigs)
+    {
+        if (scanConfig.mBleScanState == BleScanState::kConnecting && scanConfig.mAddress == peerAddress)
+        {
+            return &scanConfig;
+        }
+    }
 
-    mBLEScanConfig.mBleScanState = BleScanState::kNotScanning;
+    return nullptr;
 }
 
 void BLEManagerImpl::InitiateScan(intptr_t arg)
 {
-    sInstance.InitiateScan(static_cast<BleScanState>(arg));
+    sInstance.InitiateScan(sInstance.mBLEScanConfigs[arg]);
 }
 
 void BLEManagerImpl::NewConnection(BleLayer * bleLayer, void * appState, const uint16_t connDiscriminator)
 {
-    mBLEScanConfig.mDiscriminator = connDiscriminator;
-    mBLEScanConfig.mAppState      = appState;
+    BLEScanConfig * scanConfig = nullptr;
+
+    for (BLEScanConfig & candidate : mBLEScanConfigs)
+    {
+        if (candidate.mBleScanState == BleScanState::kNotScanning)
+        {
+            scanConfig = &candidate;
+            break;
+        }
+    }
+
+    if (scanConfig == nullptr)
+    {
+        ChipLogError(Ble, "Too many concurrent BLE connection requests");
+        BleConnectionDelegate::OnConnectionError(appState, CHIP_ERROR_NO_MEMORY);
+        return;
+    }
+
+    scanConfig->mBleScanState  = BleScanState::kScanForDiscriminator;
+    scanConfig->mDiscriminator = connDiscriminator;
+    scanConfig->mAppState      = appState;
 
     // Scan initiation performed async, to ensure that the BLE subsystem is initialized.
-    PlatformMgr().ScheduleWork(InitiateScan, static_cast<intptr_t>(BleScanState::kScanForDiscriminator));
+    PlatformMgr().ScheduleWork(InitiateScan, static_cast<intptr_t>(scanConfig - mBLEScanConfigs));
 }
 
 BLE_ERROR BLEManagerImpl::CancelConnection()
@@ -777,49 +839,81 @@ void BLEManagerImpl::NotifyBLEPeripheralAdvStopComplete(bool aIsSuccess, void *
 
 void BLEManagerImpl::OnDeviceScanned(BluezDevice1 * device, const chip::Ble::ChipBLEDeviceIdentificationInfo & info)
 {
-    ChipLogProgress(Ble, "New device scanned: %s", bluez_device1_get_address(device));
+    const char * address       = bluez_device1_get_address(device);
+    BLEScanConfig * scanConfig = nullptr;
+    bool stillScanning         = false;
 
-    if (mBLEScanConfig.mBleScanState == BleScanState::kScanForDiscriminator)
+    ChipLogProgress(Ble, "New device scanned: %s", address);
+
+    for (BLEScanConfig & candidate : mBLEScanConfigs)
     {
-        if (info.GetDeviceDiscriminator() != mBLEScanConfig.mDiscriminator)
+        if (candidate.mBleScanState == BleScanState::kConnecting && candidate.mAddress == address)
         {
+            // Already connecting to this device for another request.
             return;
         }
-        ChipLogProgress(Ble, "Device discriminator match. Attempting to connect.");
     }
-    else if (mBLEScanConfig.mBleScanState == BleScanState::kScanForAddress)
+
+    for (BLEScanConfig & candidate : mBLEScanConfigs)
     {
-        if (strcmp(bluez_device1_get_address(device), mBLEScanConfig.mAddress.c_str()) != 0)
+        if (candidate.mBleScanState == BleScanState::kScanForDiscriminator && scanConfig == nullptr &&
+            info.GetDeviceDiscriminator() == candidate.mDiscriminator)
         {
-            return;
+            ChipLogProgress(Ble, "Device discriminator match. Attempting to connect.");
+            scanConfig = &candidate;
+        }
+        else if (candidate.mBleScanState == BleScanState::kScanForAddress && scanConfig == nullptr &&
+                 candidate.mAddress == address)
+        {
+            ChipLogProgress(Ble, "Device address match. Attempting to connect.");
+            scanConfig = &candidate;
+        }
+        else if (candidate.mBleScanState == BleScanState::kScanForDiscriminator ||
+                 candidate.mBleScanState == BleScanState::kScanForAddress)
+        {
+            stillScanning = true;
         }
-        ChipLogProgress(Ble, "Device address match. Attempting to connect.");
     }
-    else
+
+    if (scanConfig == nullptr)
     {
-        // Internal consistency eerror
-        ChipLogError(Ble, "Unknown discovery type. Ignoring scanned device.");
         return;
     }
 
-    mBLEScanConfig.mBleScanState = BleScanState::kConnecting;
-    DeviceLayer::SystemLayer.StartTimer(kConnectTimeoutMs, HandleConnectTimeout, mpEndpoint);
-    mDeviceScanner->StopScan();
+    scanConfig->mBleScanState        = BleScanState::kConnecting;
+    scanConfig->mAddress             = address;
+    scanConfig->mpConnectCancellable = g_cancellable_new();
+    DeviceLayer::SystemLayer.StartTimer(kConnectTimeoutMs, HandleConnectTimeout, scanConfig);
 
-    ConnectDevice(device, mpEndpoint);
+    // Keep scanning for the devices of the other requests, if any.
+    if (!stillScanning)
+    {
+        mDeviceScanner->StopScan();
+    }
+
+    ConnectDevice(device, mpEndpoint, scanConfig->mpConnectCancellable, scanConfig);
 }
 
 void BLEManagerImpl::OnScanComplete()
 {
-    if (mBLEScanConfig.mBleScanState != BleScanState::kScanForDiscriminator &&
-        mBLEScanConfig.mBleScanState != BleScanState::kScanForAddress)
+    bool wasScanning = false;
+
+    mFlags.Clear(Flags::kScanning);
+
+    for (BLEScanConfig & scanConfig : mBLEScanConfigs)
     {
-        ChipLogProgress(Ble, "Scan complete notification without an active scan.");
-        return;
+        if (scanConfig.mBleScanState == BleScanState::kScanForDiscriminator ||
+            scanConfig.mBleScanState == BleScanState::kScanForAddress)
+        {
+            FailScan(scanConfig, CHIP_ERROR_TIMEOUT);
+            wasScanning = true;
+        }
     }
 
-    BleConnectionDelegate::OnConnectionError(mBLEScanConfig.mAppState, CHIP_ERROR_TIMEOUT);
-    mBLEScanConfig.mBleScanState = BleScanState::kNotScanning;
+    if (!wasScanning)
+    {
+        ChipLogProgress(Ble, "Scan complete notification without an active scan.");
+    }
 }
 
 } // namespace Internal
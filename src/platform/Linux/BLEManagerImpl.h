@@ -73,6 +73,9 @@ struct BLEScanConfig
 
     // Optional argument to be passed to callback functions provided by the BLE scan/connect requestor
     void * mAppState = nullptr;
+
+    // Cancels the connection to the device found, while connecting (mAddress then holds the address of the device)
+    GCancellable * mpConnectCancellable = nullptr;
 };
 
 /**
@@ -94,7 +97,7 @@ public:
 
     // Driven by BlueZ IO
     static void HandleNewConnection(BLE_CONNECTION_OBJECT conId);
-    static void HandleConnectFailed(CHIP_ERROR error);
+    static void HandleConnectFailed(void * apScanConfig, CHIP_ERROR error);
     static void HandleWriteComplete(BLE_CONNECTION_OBJECT conId);
     static void HandleSubscribeOpComplete(BLE_CONNECTION_OBJECT conId, bool subscribed);
     static void HandleTXCharChanged(BLE_CONNECTION_OBJECT conId, const uint8_t * value, size_t len);
@@ -176,6 +179,7 @@ private:
         kFastAdvertisingEnabled   = 0x0080, /**< The application has enabled fast advertising. */
         kUseCustomDeviceName      = 0x0100, /**< The application has configured a custom BLE device name. */
         kAdvertisingRefreshNeeded = 0x0200, /**< The advertising configuration/state in BLE layer needs to be updated. */
+        kScanning                 = 0x0400, /**< A scan for CHIPoBLE devices is running, shared by the connection requests. */
     };
 
     enum
@@ -191,13 +195,16 @@ private:
     void DriveBLEState();
     static void DriveBLEState(intptr_t arg);
 
-    void InitiateScan(BleScanState scanType);
+    void InitiateScan(BLEScanConfig & aScanConfig);
     static void InitiateScan(intptr_t arg);
-    void CleanScanConfig();
+    void FailScan(BLEScanConfig & aScanConfig, CHIP_ERROR aError);
+    void CleanScanConfig(BLEScanConfig & aScanConfig);
+    BLEScanConfig * FindConnectingScanConfig(BLE_CONNECTION_OBJECT conId);
 
     CHIPoBLEServiceMode mServiceMode;
     BLEAdvConfig mBLEAdvConfig;
-    BLEScanConfig mBLEScanConfig;
+    // One per concurrent connection request in central mode, each with its own scan and connect state.
+    BLEScanConfig mBLEScanConfigs[BLE_LAYER_NUM_BLE_ENDPOINTS];
     BitFlags<Flags> mFlags;
     char mDeviceName[kMaxDeviceNameLength + 1];
     bool mIsCentral            = false;
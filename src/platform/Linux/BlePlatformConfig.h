@@ -36,4 +36,5 @@ struct BluezConnection;
 #define BLE_CONNECTION_UNINITIALIZED nullptr
 // ========== Platform-specific Configuration Overrides =========
 
-/* none so far */
+// A central may connect to several devices, e.g. to commission them in parallel.
+#define BLE_LAYER_NUM_BLE_ENDPOINTS 8
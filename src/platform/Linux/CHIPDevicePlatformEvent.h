@@ -72,6 +72,7 @@ struct ChipDevicePlatformEvent
         } BLECentralConnected;
         struct
         {
+            void * mpScanConfig;
             CHIP_ERROR mError;
         } BLECentralConnectFailed;
         struct
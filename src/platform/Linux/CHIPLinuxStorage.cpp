@@ -45,9 +45,27 @@ namespace Internal {
 ChipLinuxStorage::ChipLinuxStorage()
 {
     mDirty = false;
+#if CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+    mPendingCommits = 0;
+    mStopping       = false;
+#endif // CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
 }
 
-ChipLinuxStorage::~ChipLinuxStorage() {}
+ChipLinuxStorage::~ChipLinuxStorage()
+{
+#if CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+    // The thread writes the pending commits before it exits.
+    mLock.lock();
+    mStopping = true;
+    mLock.unlock();
+
+    mWriteBehindCondition.notify_one();
+    if (mWriteBehindThread.joinable())
+    {
+        mWriteBehindThread.join();
+    }
+#endif // CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+}
 
 CHIP_ERROR ChipLinuxStorage::Init(const char * configFile)
 {
@@ -62,11 +80,15 @@ CHIP_ERROR ChipLinuxStorage::Init(const char * configFile)
 
         ifs.open(configFile, std::ifstream::in);
 
-        // Create default setting file if not exist.
+        // Create default setting file if not exist. It is read back below, so it is not written behind.
         if (!ifs.good())
         {
             mDirty = true;
             retval = Commit();
+            if (retval == CHIP_NO_ERROR)
+            {
+                retval = Flush();
+            }
             mDirty = false;
         }
     }
@@ -304,7 +326,31 @@ CHIP_ERROR ChipLinuxStorage::Commit()
     {
         mLock.lock();
 
-        retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
+#if CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+        if (++mPendingCommits < CHIP_LINUX_STORAGE_MAX_PENDING_COMMITS)
+        {
+            // Leave the write to the background thread, which waits for the commits of the next milliseconds.
+            const bool first = (mPendingCommits == 1);
+            if (first)
+            {
+                mWriteBehindDeadline =
+                    std::chrono::steady_clock::now() + std::chrono::milliseconds(CHIP_LINUX_STORAGE_WRITE_DELAY_MS);
+            }
+            if (!mWriteBehindThread.joinable())
+            {
+                mWriteBehindThread = std::thread(&ChipLinuxStorage::WriteBehindThreadMain, this);
+            }
+            mLock.unlock();
+
+            if (first)
+            {
+                mWriteBehindCondition.notify_one();
+            }
+            return retval;
+        }
+#endif // CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+
+        retval = CommitLocked();
 
         mLock.unlock();
     }
@@ -316,6 +362,71 @@ CHIP_ERROR ChipLinuxStorage::Commit()
     return retval;
 }
 
+/**
+ * Writes the commits still pending to the file, so that they are durable when it returns.
+ */
+CHIP_ERROR ChipLinuxStorage::Flush()
+{
+    CHIP_ERROR retval = CHIP_NO_ERROR;
+
+#if CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+    mLock.lock();
+
+    if (mPendingCommits > 0)
+    {
+        retval = CommitLocked();
+    }
+
+    mLock.unlock();
+#endif // CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+
+    return retval;
+}
+
+CHIP_ERROR ChipLinuxStorage::CommitLocked()
+{
+    CHIP_ERROR retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
+
+#if CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+    // A failed write is retried on the next commit or flush.
+    if (retval == CHIP_NO_ERROR)
+    {
+        mPendingCommits = 0;
+    }
+#endif // CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+
+    return retval;
+}
+
+#if CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+void ChipLinuxStorage::WriteBehindThreadMain()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+
+    while (!mStopping)
+    {
+        if (mPendingCommits == 0)
+        {
+            mWriteBehindCondition.wait(lock);
+        }
+        else if (mWriteBehindCondition.wait_until(lock, mWriteBehindDeadline) == std::cv_status::timeout && mPendingCommits > 0)
+        {
+            if (CommitLocked() != CHIP_NO_ERROR)
+            {
+                ChipLogError(DeviceLayer, "failed to write settings to file (%s)", mConfigPath.c_str());
+                mWriteBehindDeadline =
+                    std::chrono::steady_clock::now() + std::chrono::milliseconds(CHIP_LINUX_STORAGE_WRITE_DELAY_MS);
+            }
+        }
+    }
+
+    if (mPendingCommits > 0)
+    {
+        CommitLocked();
+    }
+}
+#endif // CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+
 } // namespace Internal
 } // namespace DeviceLayer
 } // namespace chip
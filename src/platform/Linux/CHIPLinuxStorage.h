@@ -29,12 +29,35 @@
  *
  *         ChipLinuxStorage wraps the storage class ChipLinuxStorageIni with mutex.
  *
+ *         With CHIP_LINUX_STORAGE_WRITE_DELAY_MS, the commits are written
+ *         behind, in a background thread, so that the changes made within
+ *         the delay are written to the file together.
+ *
  */
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <platform/Linux/CHIPLinuxStorageIni.h>
+#include <thread>
+
+/**
+ * The number of milliseconds a commit may wait before the file is written, so that the commits made meanwhile are
+ * written at once. Until then, the changes are lost if the process ends abnormally: callers that need them durable
+ * call Flush(). 0 writes the file on every commit.
+ */
+#ifndef CHIP_LINUX_STORAGE_WRITE_DELAY_MS
+#define CHIP_LINUX_STORAGE_WRITE_DELAY_MS 0
+#endif
+
+/**
+ * The number of commits after which a delayed write is made at once, without waiting for the rest of the delay.
+ */
+#ifndef CHIP_LINUX_STORAGE_MAX_PENDING_COMMITS
+#define CHIP_LINUX_STORAGE_MAX_PENDING_COMMITS 64
+#endif
 
 #ifndef FATCONFDIR
 #define FATCONFDIR "/tmp"
@@ -82,12 +105,25 @@ public:
     CHIP_ERROR ClearValue(const char * key);
     CHIP_ERROR ClearAll();
     CHIP_ERROR Commit();
+    CHIP_ERROR Flush();
     bool HasValue(const char * key);
 
 private:
+    CHIP_ERROR CommitLocked();
+
     std::mutex mLock;
     bool mDirty;
     std::string mConfigPath;
+
+#if CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
+    void WriteBehindThreadMain();
+
+    std::condition_variable mWriteBehindCondition; // Signaled when a write is scheduled and on destruction.
+    std::thread mWriteBehindThread;                // Started with the first delayed commit.
+    std::chrono::steady_clock::time_point mWriteBehindDeadline;
+    size_t mPendingCommits;
+    bool mStopping;
+#endif // CHIP_LINUX_STORAGE_WRITE_DELAY_MS > 0
 };
 
 } // namespace Internal
@@ -23,6 +23,7 @@
  *
  */
 
+#include <fcntl.h>
 #include <fstream>
 #include <string>
 #include <unistd.h>
@@ -103,6 +104,17 @@ CHIP_ERROR ChipLinuxStorageIni::CommitConfig(const std::string & configFile)
         mConfigStore.generate(ofs);
         ofs.close();
 
+        // An ofstream has no way to sync, sync the file through a descriptor of its own.
+        int fd = open(tmpPath.c_str(), O_RDONLY);
+        if (fd < 0 || fsync(fd) != 0)
+        {
+            ChipLogError(DeviceLayer, "failed to sync (%s), %s (%d)", tmpPath.c_str(), strerror(errno), errno);
+        }
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+
         if (rename(tmpPath.c_str(), configFile.c_str()) == 0)
         {
             ChipLogError(DeviceLayer, "renamed tmp file to file (%s)", configFile.c_str());
@@ -0,0 +1,416 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides an implementation of a key-value store kept in an
+ *          append-only log file on Linux platform.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include <core/CHIPEncoding.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kRecordType_Put    = 'P';
+constexpr uint8_t kRecordType_Delete = 'D';
+
+/**
+ * CRC-32 (IEEE 802.3) of data, continuing from the CRC of the preceding data, 0 to start.
+ */
+uint32_t Crc32(const uint8_t * data, size_t length, uint32_t crc)
+{
+    // Half-byte table, for the polynomial 0xEDB88320.
+    static const uint32_t kTable[16] = { 0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+                                         0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+                                         0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ kTable[crc & 0x0F];
+        crc = (crc >> 4) ^ kTable[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+bool ReadFully(int fd, uint8_t * buf, size_t length, off_t offset)
+{
+    while (length > 0)
+    {
+        ssize_t n = pread(fd, buf, length, offset);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        buf += n;
+        length -= static_cast<size_t>(n);
+        offset += n;
+    }
+    return true;
+}
+
+bool WriteFully(int fd, const uint8_t * buf, size_t length, off_t offset)
+{
+    while (length > 0)
+    {
+        ssize_t n = pwrite(fd, buf, length, offset);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        buf += n;
+        length -= static_cast<size_t>(n);
+        offset += n;
+    }
+    return true;
+}
+
+} // namespace
+
+ChipLinuxStorageLog::ChipLinuxStorageLog()
+{
+    mFd       = -1;
+    mLogSize  = 0;
+    mLiveSize = 0;
+}
+
+ChipLinuxStorageLog::~ChipLinuxStorageLog()
+{
+    CloseLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * logFile)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    CloseLocked();
+    mLogPath.assign(logFile);
+
+    mFd = open(logFile, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (mFd < 0)
+    {
+        ChipLogError(DeviceLayer, "failed to open log (%s), %s (%d)", logFile, strerror(errno), errno);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    return LoadLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen, size_t offset)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_WELL_UNINITIALIZED);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    const Record & record = it->second;
+    VerifyOrReturnError(offset <= record.mValueLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::vector<uint8_t> data(kHeaderSize + record.mKeyLength + record.mValueLength);
+    VerifyOrReturnError(ReadFully(mFd, data.data(), data.size(), record.mOffset), CHIP_ERROR_READ_FAILED);
+    VerifyOrReturnError(Crc32(&data[4], data.size() - 4, 0) == Encoding::LittleEndian::Get32(&data[0]),
+                        CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    const size_t remaining = record.mValueLength - offset;
+
+    outLen = (bufSize < remaining) ? bufSize : remaining;
+    if (outLen > 0)
+    {
+        memcpy(buf, &data[kHeaderSize + record.mKeyLength + offset], outLen);
+    }
+
+    return (outLen < remaining) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_WELL_UNINITIALIZED);
+
+    return AppendLocked(kRecordType_Put, key, data, dataLen);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_WELL_UNINITIALIZED);
+    VerifyOrReturnError(mIndex.find(key) != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    return AppendLocked(kRecordType_Delete, key, nullptr, 0);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearAll()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_WELL_UNINITIALIZED);
+
+    if (ftruncate(mFd, 0) != 0 || fsync(mFd) != 0)
+    {
+        ChipLogError(DeviceLayer, "failed to clear log (%s), %s (%d)", mLogPath.c_str(), strerror(errno), errno);
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    mIndex.clear();
+    mLogSize  = 0;
+    mLiveSize = 0;
+
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return mIndex.find(key) != mIndex.end();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_WELL_UNINITIALIZED);
+
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::LoadLocked()
+{
+    struct stat st;
+    std::vector<uint8_t> payload;
+    off_t offset = 0;
+
+    mIndex.clear();
+    mLogSize  = 0;
+    mLiveSize = 0;
+
+    if (fstat(mFd, &st) != 0)
+    {
+        ChipLogError(DeviceLayer, "failed to stat log (%s), %s (%d)", mLogPath.c_str(), strerror(errno), errno);
+        return CHIP_ERROR_READ_FAILED;
+    }
+
+    // Apply the records in order, up to the first one which is truncated or fails its CRC.
+    while (st.st_size - offset >= static_cast<off_t>(kHeaderSize))
+    {
+        uint8_t header[kHeaderSize];
+
+        if (!ReadFully(mFd, header, sizeof(header), offset))
+        {
+            break;
+        }
+
+        const uint8_t type         = header[4];
+        const uint32_t keyLength   = Encoding::LittleEndian::Get16(&header[5]);
+        const uint32_t valueLength = Encoding::LittleEndian::Get32(&header[7]);
+        const off_t recordLength   = static_cast<off_t>(kHeaderSize) + keyLength + valueLength;
+
+        if ((type != kRecordType_Put && type != kRecordType_Delete) || recordLength > st.st_size - offset)
+        {
+            break;
+        }
+
+        payload.resize(keyLength + valueLength);
+        if (!ReadFully(mFd, payload.data(), payload.size(), offset + static_cast<off_t>(kHeaderSize)) ||
+            Crc32(payload.data(), payload.size(), Crc32(&header[4], kHeaderSize - 4, 0)) != Encoding::LittleEndian::Get32(header))
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(payload.data()), keyLength);
+        auto it = mIndex.find(key);
+
+        if (it != mIndex.end())
+        {
+            mLiveSize -= static_cast<off_t>(kHeaderSize) + it->second.mKeyLength + it->second.mValueLength;
+            mIndex.erase(it);
+        }
+        if (type == kRecordType_Put)
+        {
+            mIndex.emplace(std::move(key), Record{ offset, keyLength, valueLength });
+            mLiveSize += recordLength;
+        }
+
+        offset += recordLength;
+    }
+
+    if (offset < st.st_size)
+    {
+        // Most likely the record that was being appended when the process or the system went down.
+        ChipLogError(DeviceLayer, "dropping %lld bytes at the end of log (%s)", static_cast<long long>(st.st_size - offset),
+                     mLogPath.c_str());
+        if (ftruncate(mFd, offset) != 0)
+        {
+            ChipLogError(DeviceLayer, "failed to truncate log (%s), %s (%d)", mLogPath.c_str(), strerror(errno), errno);
+            return CHIP_ERROR_WRITE_FAILED;
+        }
+    }
+
+    mLogSize = offset;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::AppendLocked(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(!key.empty() && key.size() <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(dataLen <= UINT32_MAX - kHeaderSize - key.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::vector<uint8_t> record(kHeaderSize + key.size() + dataLen);
+
+    record[4] = type;
+    Encoding::LittleEndian::Put16(&record[5], static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Put32(&record[7], static_cast<uint32_t>(dataLen));
+    memcpy(&record[kHeaderSize], key.data(), key.size());
+    if (dataLen > 0)
+    {
+        memcpy(&record[kHeaderSize + key.size()], data, dataLen);
+    }
+    Encoding::LittleEndian::Put32(&record[0], Crc32(&record[4], record.size() - 4, 0));
+
+    // A failed append is overwritten by the next one, or dropped with the torn end of the log when it is loaded.
+    if (!WriteFully(mFd, record.data(), record.size(), mLogSize))
+    {
+        ChipLogError(DeviceLayer, "failed to append to log (%s), %s (%d)", mLogPath.c_str(), strerror(errno), errno);
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+#if CHIP_LINUX_STORAGE_LOG_SYNC_WRITES
+    if (fdatasync(mFd) != 0)
+    {
+        ChipLogError(DeviceLayer, "failed to sync log (%s), %s (%d)", mLogPath.c_str(), strerror(errno), errno);
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+#endif // CHIP_LINUX_STORAGE_LOG_SYNC_WRITES
+
+    auto it = mIndex.find(key);
+
+    if (it != mIndex.end())
+    {
+        mLiveSize -= static_cast<off_t>(kHeaderSize) + it->second.mKeyLength + it->second.mValueLength;
+        mIndex.erase(it);
+    }
+    if (type == kRecordType_Put)
+    {
+        mIndex.emplace(key, Record{ mLogSize, static_cast<uint32_t>(key.size()), static_cast<uint32_t>(dataLen) });
+        mLiveSize += static_cast<off_t>(record.size());
+    }
+    mLogSize += static_cast<off_t>(record.size());
+
+    // The write is done: a failed compaction leaves the log as it was, to be compacted on a later write.
+    if (mLogSize >= CHIP_LINUX_STORAGE_LOG_COMPACT_MIN_SIZE && mLogSize - mLiveSize > mLiveSize)
+    {
+        CompactLocked();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactLocked()
+{
+    std::string tmpPath = mLogPath;
+    std::unordered_map<std::string, Record> index;
+    std::vector<uint8_t> record;
+    off_t offset = 0;
+    int fd;
+
+    tmpPath.append(".tmp");
+
+    fd = open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        ChipLogError(DeviceLayer, "failed to open file (%s) for writing, %s (%d)", tmpPath.c_str(), strerror(errno), errno);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    index.reserve(mIndex.size());
+    for (const auto & entry : mIndex)
+    {
+        const Record & live = entry.second;
+
+        record.resize(kHeaderSize + live.mKeyLength + live.mValueLength);
+        if (!ReadFully(mFd, record.data(), record.size(), live.mOffset) || !WriteFully(fd, record.data(), record.size(), offset))
+        {
+            break;
+        }
+        index.emplace(entry.first, Record{ offset, live.mKeyLength, live.mValueLength });
+        offset += static_cast<off_t>(record.size());
+    }
+
+    if (index.size() != mIndex.size() || fsync(fd) != 0 || rename(tmpPath.c_str(), mLogPath.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "failed to compact log (%s), %s (%d)", mLogPath.c_str(), strerror(errno), errno);
+        close(fd);
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    ChipLogProgress(DeviceLayer, "compacted log (%s) from %lld to %lld bytes", mLogPath.c_str(),
+                    static_cast<long long>(mLogSize), static_cast<long long>(offset));
+
+    close(mFd);
+    mFd = fd;
+    mIndex.swap(index);
+    mLogSize  = offset;
+    mLiveSize = offset;
+
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::CloseLocked()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+    mIndex.clear();
+    mLogSize  = 0;
+    mLiveSize = 0;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,112 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a key-value store kept in an append-only log
+ *         file on Linux platform.
+ *
+ *         Every write appends a record holding the key, the value and a
+ *         CRC-32 of both, and an in-memory hash index maps each key to its
+ *         latest record. A record torn by a crash fails its CRC and is
+ *         dropped, with whatever follows it, when the log is loaded.
+ *
+ *         Once the records overwritten or deleted make up most of the log,
+ *         the live records are written to a new log which replaces the old
+ *         one.
+ *
+ */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+
+#include <core/CHIPError.h>
+
+/**
+ * The size under which a log is never compacted, in bytes.
+ */
+#ifndef CHIP_LINUX_STORAGE_LOG_COMPACT_MIN_SIZE
+#define CHIP_LINUX_STORAGE_LOG_COMPACT_MIN_SIZE (64 * 1024)
+#endif
+
+/**
+ * Sync the log to the disk after every write. Without it, the writes are only as durable as the
+ * page cache: a crash of the system, not of the process, may lose the last ones.
+ */
+#ifndef CHIP_LINUX_STORAGE_LOG_SYNC_WRITES
+#define CHIP_LINUX_STORAGE_LOG_SYNC_WRITES 1
+#endif
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageLog
+{
+public:
+    ChipLinuxStorageLog();
+    ~ChipLinuxStorageLog();
+
+    CHIP_ERROR Init(const char * logFile);
+
+    /**
+     * Reads the value of a key, from offset on. Returns CHIP_ERROR_BUFFER_TOO_SMALL when the rest of the
+     * value does not fit, with as much of it as fits copied into buf, and CHIP_ERROR_KEY_NOT_FOUND
+     * for a key without a value.
+     */
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen, size_t offset = 0);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    /**
+     * Rewrites the log with only its live records.
+     */
+    CHIP_ERROR Compact();
+
+private:
+    struct Record
+    {
+        off_t mOffset;        // Of the record header, in the log.
+        uint32_t mKeyLength;  // The record is kHeaderSize + mKeyLength + mValueLength bytes.
+        uint32_t mValueLength;
+    };
+
+    static constexpr size_t kHeaderSize = 11; // CRC-32, type, key length (16 bits), value length (32 bits).
+
+    CHIP_ERROR LoadLocked();
+    CHIP_ERROR AppendLocked(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR CompactLocked();
+    void CloseLocked();
+
+    std::mutex mLock;
+    std::string mLogPath;
+    std::unordered_map<std::string, Record> mIndex;
+    int mFd;
+    off_t mLogSize;  // Where the next record is appended.
+    off_t mLiveSize; // Of the records in mIndex.
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
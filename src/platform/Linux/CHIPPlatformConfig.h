@@ -57,6 +57,8 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_RNG_IMPLEMENTATION_CHIPDRBG 1
 #define CHIP_CONFIG_RNG_IMPLEMENTATION_PLATFORM 0
 
+#define CHIP_CONFIG_DRBG_PER_THREAD 1
+
 #define CHIP_CONFIG_ENABLE_PASE_INITIATOR 0
 #define CHIP_CONFIG_ENABLE_PASE_RESPONDER 1
 #define CHIP_CONFIG_ENABLE_CASE_INITIATOR 1
@@ -19,9 +19,12 @@
 #include <platform/internal/CHIPDeviceLayerInternal.h>
 
 #include <platform/ConnectivityManager.h>
+#include <platform/Linux/PosixConfig.h>
 #include <platform/internal/BLEManager.h>
 
 #include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
 #include <new>
 
 #include <support/CodeUtils.h>
@@ -380,6 +383,8 @@ void ConnectivityManagerImpl::_ClearWiFiStationProvision()
                             err ? err->message : "unknown error");
             g_error_free(err);
         }
+
+        SaveStationHint(nullptr);
     }
 }
 
@@ -468,6 +473,16 @@ void ConnectivityManagerImpl::_OnWpaInterfaceProxyReady(GObject * source_object,
         mWpaSupplicant.iface = iface;
         mWpaSupplicant.state = GDBusWpaSupplicant::WPA_INTERFACE_CONNECTED;
         ChipLogProgress(DeviceLayer, "wpa_supplicant: connected to wpa_supplicant interface proxy");
+
+        g_signal_connect(mWpaSupplicant.iface, "bssadded", G_CALLBACK(_OnWpaBssAdded), NULL);
+
+        g_signal_connect(mWpaSupplicant.iface, "bssremoved", G_CALLBACK(_OnWpaBssRemoved), NULL);
+
+        g_signal_connect(mWpaSupplicant.iface, "scan-done", G_CALLBACK(_OnWpaScanDone), NULL);
+
+        g_signal_connect(mWpaSupplicant.iface, "notify::state", G_CALLBACK(_OnWpaStateChanged), NULL);
+
+        StartHintScan();
     }
     else
     {
@@ -481,6 +496,285 @@ void ConnectivityManagerImpl::_OnWpaInterfaceProxyReady(GObject * source_object,
         g_error_free(err);
 }
 
+void ConnectivityManagerImpl::_OnWpaBssAdded(WpaFiW1Wpa_supplicant1Interface * proxy, const gchar * path, GVariant * properties,
+                                             gpointer user_data)
+{
+    GDBusWpaScanResult * result = FindScanResult(path);
+    GVariant * bssid            = g_variant_lookup_value(properties, "BSSID", G_VARIANT_TYPE_BYTESTRING);
+    GVariant * ssid             = g_variant_lookup_value(properties, "SSID", G_VARIANT_TYPE_BYTESTRING);
+    const guint8 * bssidData    = nullptr;
+    const guint8 * ssidData     = nullptr;
+    gsize bssidLen              = 0;
+    gsize ssidLen               = 0;
+    guint16 frequency           = 0;
+    gint16 signal               = 0;
+
+    VerifyOrExit(bssid != nullptr && ssid != nullptr && g_variant_lookup(properties, "Frequency", "q", &frequency) &&
+                     g_variant_lookup(properties, "Signal", "n", &signal),
+                 ChipLogProgress(DeviceLayer, "wpa_supplicant: BSS added without its properties: %s", path));
+
+    bssidData = static_cast<const guint8 *>(g_variant_get_fixed_array(bssid, &bssidLen, sizeof(guint8)));
+    ssidData  = static_cast<const guint8 *>(g_variant_get_fixed_array(ssid, &ssidLen, sizeof(guint8)));
+    VerifyOrExit(bssidLen == sizeof(result->bssid) && ssidLen <= sizeof(result->ssid), );
+
+    if (result == nullptr)
+    {
+        // Take a free entry, or else the one seen the longest ago.
+        result = &mWpaSupplicant.scanResults[0];
+        for (GDBusWpaScanResult & entry : mWpaSupplicant.scanResults)
+        {
+            if (entry.path == nullptr)
+            {
+                result = &entry;
+                break;
+            }
+            if (entry.lastSeen < result->lastSeen)
+            {
+                result = &entry;
+            }
+        }
+
+        g_free(result->path);
+        result->path = g_strdup(path);
+    }
+
+    memcpy(result->bssid, bssidData, bssidLen);
+    memcpy(result->ssid, ssidData, ssidLen);
+    result->ssidLen   = static_cast<uint8_t>(ssidLen);
+    result->frequency = frequency;
+    result->signal    = signal;
+    result->lastSeen  = System::Layer::GetClock_MonotonicMS();
+
+exit:
+    if (bssid != nullptr)
+        g_variant_unref(bssid);
+    if (ssid != nullptr)
+        g_variant_unref(ssid);
+}
+
+void ConnectivityManagerImpl::_OnWpaBssRemoved(WpaFiW1Wpa_supplicant1Interface * proxy, const gchar * path, gpointer user_data)
+{
+    GDBusWpaScanResult * result = FindScanResult(path);
+
+    if (result != nullptr)
+    {
+        g_free(result->path);
+        result->path = nullptr;
+    }
+}
+
+void ConnectivityManagerImpl::_OnWpaScanDone(WpaFiW1Wpa_supplicant1Interface * proxy, gboolean success, gpointer user_data)
+{
+    bool hinted    = mWpaSupplicant.scanState == GDBusWpaSupplicant::WIFI_SCANNING_HINTED_CHANNEL;
+    bool foundHint = false;
+    uint8_t bssid[sizeof(GDBusWpaScanResult::bssid)];
+    size_t bssidLen = 0;
+
+    mWpaSupplicant.scanState = GDBusWpaSupplicant::WIFI_SCANNING_IDLE;
+
+    if (!success)
+    {
+        ChipLogProgress(DeviceLayer, "wpa_supplicant: scan failed");
+        return;
+    }
+
+    // wpa_supplicant only signals the BSSs new to a scan, and removes those missing from its last scans, so the ones
+    // still cached were all seen recently.
+    for (GDBusWpaScanResult & entry : mWpaSupplicant.scanResults)
+    {
+        if (entry.path != nullptr)
+        {
+            entry.lastSeen = System::Layer::GetClock_MonotonicMS();
+        }
+    }
+
+    VerifyOrReturn(hinted);
+
+    if (PosixConfig::ReadConfigValueBin(PosixConfig::kConfigKey_WiFiStationBssid, bssid, sizeof(bssid), bssidLen) ==
+            CHIP_NO_ERROR &&
+        bssidLen == sizeof(bssid))
+    {
+        for (const GDBusWpaScanResult & entry : mWpaSupplicant.scanResults)
+        {
+            foundHint = foundHint || (entry.path != nullptr && memcmp(entry.bssid, bssid, sizeof(bssid)) == 0);
+        }
+    }
+
+    if (!foundHint)
+    {
+        ChipLogProgress(DeviceLayer, "wpa_supplicant: provisioned network not found on its last channel, scanning all channels");
+        StartScan(0);
+    }
+}
+
+void ConnectivityManagerImpl::_OnWpaStateChanged(GObject * object, GParamSpec * pspec, gpointer user_data)
+{
+    const gchar * state = wpa_fi_w1_wpa_supplicant1_interface_get_state(mWpaSupplicant.iface);
+
+    if (g_strcmp0(state, "completed") == 0)
+    {
+        const gchar * bss                 = wpa_fi_w1_wpa_supplicant1_interface_get_current_bss(mWpaSupplicant.iface);
+        const GDBusWpaScanResult * result = FindScanResult(bss);
+
+        // Keep the BSS connected to, so that the next connection after a restart scans its channel first.
+        if (result != nullptr)
+        {
+            SaveStationHint(result);
+        }
+    }
+}
+
+void ConnectivityManagerImpl::_OnWpaScanStarted(GObject * source_object, GAsyncResult * res, gpointer user_data)
+{
+    GError * err = nullptr;
+
+    if (!wpa_fi_w1_wpa_supplicant1_interface_call_scan_finish(mWpaSupplicant.iface, res, &err))
+    {
+        ChipLogProgress(DeviceLayer, "wpa_supplicant: failed to start scan: %s", err ? err->message : "unknown error");
+        mWpaSupplicant.scanState = GDBusWpaSupplicant::WIFI_SCANNING_IDLE;
+    }
+
+    if (err != nullptr)
+        g_error_free(err);
+}
+
+void ConnectivityManagerImpl::_OnWpaConfigSaved(GObject * source_object, GAsyncResult * res, gpointer user_data)
+{
+    GError * err = nullptr;
+
+    if (wpa_fi_w1_wpa_supplicant1_interface_call_save_config_finish(mWpaSupplicant.iface, res, &err))
+    {
+        ChipLogProgress(DeviceLayer, "wpa_supplicant: save config succeeded!");
+    }
+    else
+    {
+        ChipLogProgress(DeviceLayer, "wpa_supplicant: failed to save config: %s", err ? err->message : "unknown error");
+    }
+
+    if (err != nullptr)
+        g_error_free(err);
+}
+
+GDBusWpaScanResult * ConnectivityManagerImpl::FindScanResult(const gchar * path)
+{
+    VerifyOrReturnError(path != nullptr, nullptr);
+
+    for (GDBusWpaScanResult & entry : mWpaSupplicant.scanResults)
+    {
+        if (g_strcmp0(entry.path, path) == 0)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+const GDBusWpaScanResult * ConnectivityManagerImpl::FindStrongestScanResult(const char * ssid)
+{
+    const GDBusWpaScanResult * result = nullptr;
+    size_t ssidLen                    = strlen(ssid);
+    uint64_t now                      = System::Layer::GetClock_MonotonicMS();
+
+    for (const GDBusWpaScanResult & entry : mWpaSupplicant.scanResults)
+    {
+        if (entry.path != nullptr && entry.ssidLen == ssidLen && memcmp(entry.ssid, ssid, ssidLen) == 0 &&
+            now - entry.lastSeen <= CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE &&
+            (result == nullptr || entry.signal > result->signal))
+        {
+            result = &entry;
+        }
+    }
+
+    return result;
+}
+
+void ConnectivityManagerImpl::ClearScanResults()
+{
+    for (GDBusWpaScanResult & entry : mWpaSupplicant.scanResults)
+    {
+        g_free(entry.path);
+        entry.path = nullptr;
+    }
+}
+
+void ConnectivityManagerImpl::SaveStationHint(const GDBusWpaScanResult * result)
+{
+    CHIP_ERROR err     = CHIP_NO_ERROR;
+    uint32_t frequency = 0;
+    uint8_t bssid[sizeof(GDBusWpaScanResult::bssid)];
+    size_t bssidLen = 0;
+
+    if (result == nullptr)
+    {
+        PosixConfig::ClearConfigValue(PosixConfig::kConfigKey_WiFiStationBssid);
+        PosixConfig::ClearConfigValue(PosixConfig::kConfigKey_WiFiStationFrequency);
+        return;
+    }
+
+    // Only write the hint when it changes, rather than on every reconnect to the same BSS.
+    if (PosixConfig::ReadConfigValue(PosixConfig::kConfigKey_WiFiStationFrequency, frequency) == CHIP_NO_ERROR &&
+        frequency == result->frequency &&
+        PosixConfig::ReadConfigValueBin(PosixConfig::kConfigKey_WiFiStationBssid, bssid, sizeof(bssid), bssidLen) ==
+            CHIP_NO_ERROR &&
+        bssidLen == sizeof(bssid) && memcmp(bssid, result->bssid, sizeof(bssid)) == 0)
+    {
+        return;
+    }
+
+    err = PosixConfig::WriteConfigValueBin(PosixConfig::kConfigKey_WiFiStationBssid, result->bssid, sizeof(result->bssid));
+    SuccessOrExit(err);
+
+    err = PosixConfig::WriteConfigValue(PosixConfig::kConfigKey_WiFiStationFrequency, static_cast<uint32_t>(result->frequency));
+    SuccessOrExit(err);
+
+    ChipLogProgress(DeviceLayer, "wpa_supplicant: saved BSS %02x:%02x:%02x:%02x:%02x:%02x on %u MHz as the station hint",
+                    result->bssid[0], result->bssid[1], result->bssid[2], result->bssid[3], result->bssid[4], result->bssid[5],
+                    result->frequency);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to save the WiFi station hint: %s", ErrorStr(err));
+    }
+}
+
+void ConnectivityManagerImpl::StartHintScan()
+{
+    uint32_t frequency = 0;
+
+    VerifyOrReturn(g_strcmp0(wpa_fi_w1_wpa_supplicant1_interface_get_state(mWpaSupplicant.iface), "completed") != 0);
+    VerifyOrReturn(PosixConfig::ReadConfigValue(PosixConfig::kConfigKey_WiFiStationFrequency, frequency) == CHIP_NO_ERROR);
+
+    ChipLogProgress(DeviceLayer, "wpa_supplicant: scanning %" PRIu32 " MHz, the last channel of the provisioned network",
+                    frequency);
+
+    StartScan(frequency);
+    mWpaSupplicant.scanState = GDBusWpaSupplicant::WIFI_SCANNING_HINTED_CHANNEL;
+}
+
+void ConnectivityManagerImpl::StartScan(uint32_t frequency)
+{
+    GVariantBuilder builder;
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
+    g_variant_builder_add(&builder, "{sv}", "Type", g_variant_new_string("active"));
+
+    // Only scan the given channel, at a width of 20 MHz, rather than all of them.
+    if (frequency != 0)
+    {
+        GVariantBuilder channels;
+
+        g_variant_builder_init(&channels, G_VARIANT_TYPE("a(uu)"));
+        g_variant_builder_add(&channels, "(uu)", frequency, 20u);
+        g_variant_builder_add(&builder, "{sv}", "Channels", g_variant_builder_end(&channels));
+    }
+
+    mWpaSupplicant.scanState = GDBusWpaSupplicant::WIFI_SCANNING;
+    wpa_fi_w1_wpa_supplicant1_interface_call_scan(mWpaSupplicant.iface, g_variant_builder_end(&builder), nullptr, _OnWpaScanStarted,
+                                                  nullptr);
+}
+
 void ConnectivityManagerImpl::_OnWpaInterfaceReady(GObject * source_object, GAsyncResult * res, gpointer user_data)
 {
     GError * err = nullptr;
@@ -588,6 +882,7 @@ void ConnectivityManagerImpl::_OnWpaInterfaceRemoved(WpaFiW1Wpa_supplicant1 * pr
         }
 
         mWpaSupplicant.scanState = GDBusWpaSupplicant::WIFI_SCANNING_IDLE;
+        ClearScanResults();
     }
 }
 
@@ -628,6 +923,7 @@ void ConnectivityManagerImpl::StartWiFiManagement()
     mWpaSupplicant.iface         = nullptr;
     mWpaSupplicant.interfacePath = nullptr;
     mWpaSupplicant.networkPath   = nullptr;
+    ClearScanResults();
 
     wpa_fi_w1_wpa_supplicant1_proxy_new_for_bus(G_BUS_TYPE_SYSTEM, G_DBUS_PROXY_FLAGS_NONE, kWpaSupplicantServiceName,
                                                 kWpaSupplicantObjectPath, nullptr, _OnWpaProxyReady, nullptr);
@@ -873,6 +1169,9 @@ CHIP_ERROR ConnectivityManagerImpl::ProvisionWiFiNetwork(const char * ssid, cons
         SuccessOrExit(ret);
     }
 
+    // Take the hint for reconnecting from a recent scan, if the network was found in one, until connected.
+    SaveStationHint(FindStrongestScanResult(ssid));
+
     g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
     g_variant_builder_add(&builder, "{sv}", "ssid", g_variant_new_string(ssid));
     g_variant_builder_add(&builder, "{sv}", "psk", g_variant_new_string(key));
@@ -892,24 +1191,10 @@ CHIP_ERROR ConnectivityManagerImpl::ProvisionWiFiNetwork(const char * ssid, cons
                                                                               nullptr, &error);
         if (result)
         {
-            GError * gerror = nullptr;
-
             ChipLogProgress(DeviceLayer, "wpa_supplicant: connected to network: SSID: %s", ssid);
 
-            result = wpa_fi_w1_wpa_supplicant1_interface_call_save_config_sync(mWpaSupplicant.iface, nullptr, &gerror);
-
-            if (result)
-            {
-                ChipLogProgress(DeviceLayer, "wpa_supplicant: save config succeeded!");
-            }
-            else
-            {
-                ChipLogProgress(DeviceLayer, "wpa_supplicant: failed to save config: %s",
-                                gerror ? gerror->message : "unknown error");
-            }
-
-            if (gerror != nullptr)
-                g_error_free(gerror);
+            // Writing the config out does not hold up the connection.
+            wpa_fi_w1_wpa_supplicant1_interface_call_save_config(mWpaSupplicant.iface, nullptr, _OnWpaConfigSaved, nullptr);
 
             // Iterate on the network interface to see if we already have beed assigned addresses.
             // The temporary hack for getting IP address change on linux for network provisioning in the rendezvous session.
@@ -40,6 +40,7 @@
 #include <platform/Linux/dbus/wpa/DBusWpa.h>
 #include <platform/Linux/dbus/wpa/DBusWpaInterface.h>
 #include <platform/Linux/dbus/wpa/DBusWpaNetwork.h>
+#include <platform/internal/DeviceNetworkInfo.h>
 #endif
 
 namespace chip {
@@ -52,6 +53,20 @@ namespace chip {
 namespace DeviceLayer {
 
 #if CHIP_DEVICE_CONFIG_ENABLE_WPA
+/**
+ * A BSS reported by wpa_supplicant in a recent scan.
+ */
+struct GDBusWpaScanResult
+{
+    gchar * path;
+    uint8_t bssid[6];
+    uint8_t ssid[Internal::kMaxWiFiSSIDLength];
+    uint8_t ssidLen;
+    uint16_t frequency;
+    int16_t signal;
+    uint64_t lastSeen;
+};
+
 struct GDBusWpaSupplicant
 {
     enum
@@ -69,12 +84,14 @@ struct GDBusWpaSupplicant
     {
         WIFI_SCANNING_IDLE,
         WIFI_SCANNING,
+        WIFI_SCANNING_HINTED_CHANNEL,
     } scanState;
 
     WpaFiW1Wpa_supplicant1 * proxy;
     WpaFiW1Wpa_supplicant1Interface * iface;
     gchar * interfacePath;
     gchar * networkPath;
+    GDBusWpaScanResult scanResults[CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_SIZE];
 };
 #endif
 
@@ -147,6 +164,20 @@ private:
     static void _OnWpaInterfaceAdded(WpaFiW1Wpa_supplicant1 * proxy, const gchar * path, GVariant * properties, gpointer user_data);
     static void _OnWpaInterfaceReady(GObject * source_object, GAsyncResult * res, gpointer user_data);
     static void _OnWpaInterfaceProxyReady(GObject * source_object, GAsyncResult * res, gpointer user_data);
+    static void _OnWpaBssAdded(WpaFiW1Wpa_supplicant1Interface * proxy, const gchar * path, GVariant * properties,
+                               gpointer user_data);
+    static void _OnWpaBssRemoved(WpaFiW1Wpa_supplicant1Interface * proxy, const gchar * path, gpointer user_data);
+    static void _OnWpaScanDone(WpaFiW1Wpa_supplicant1Interface * proxy, gboolean success, gpointer user_data);
+    static void _OnWpaStateChanged(GObject * object, GParamSpec * pspec, gpointer user_data);
+    static void _OnWpaScanStarted(GObject * source_object, GAsyncResult * res, gpointer user_data);
+    static void _OnWpaConfigSaved(GObject * source_object, GAsyncResult * res, gpointer user_data);
+
+    static GDBusWpaScanResult * FindScanResult(const gchar * path);
+    static const GDBusWpaScanResult * FindStrongestScanResult(const char * ssid);
+    static void ClearScanResults();
+    static void SaveStationHint(const GDBusWpaScanResult * result);
+    static void StartHintScan();
+    static void StartScan(uint32_t frequency);
 
     static BitFlags<ConnectivityFlags> mConnectivityFlag;
     static struct GDBusWpaSupplicant mWpaSupplicant;
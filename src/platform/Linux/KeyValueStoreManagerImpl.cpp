@@ -36,6 +36,44 @@ namespace PersistedStorage {
 
 KeyValueStoreManagerImpl KeyValueStoreManagerImpl::sInstance;
 
+#if CHIP_LINUX_KVS_LOG_STORAGE
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
+                                          size_t offset_bytes)
+{
+    size_t read_size = 0;
+
+    VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The log reads the value, or the part of it asked for, straight from its record.
+    CHIP_ERROR err = mStorage.ReadValueBin(key, static_cast<uint8_t *>(value), value_size, read_size, offset_bytes);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    }
+    if (read_bytes_size != nullptr)
+    {
+        *read_bytes_size = read_size;
+    }
+
+    return err;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
+{
+    // Every write is a record appended to the log, there is nothing to commit.
+    return mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
+{
+    CHIP_ERROR err = mStorage.ClearValue(key);
+
+    return (err == CHIP_ERROR_KEY_NOT_FOUND) ? CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND : err;
+}
+
+#else // CHIP_LINUX_KVS_LOG_STORAGE
+
 CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
                                           size_t offset_bytes)
 {
@@ -104,6 +142,8 @@ exit:
     return err;
 }
 
+#endif // CHIP_LINUX_KVS_LOG_STORAGE
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
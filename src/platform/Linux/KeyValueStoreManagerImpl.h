@@ -24,6 +24,16 @@
 #pragma once
 
 #include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+/**
+ * Keep the KVS in an append-only log (see ChipLinuxStorageLog) rather than in an INI file, which is
+ * parsed on every read and rewritten on every write. The two formats are not compatible: a KVS
+ * written in one is not found in the other.
+ */
+#ifndef CHIP_LINUX_KVS_LOG_STORAGE
+#define CHIP_LINUX_KVS_LOG_STORAGE 0
+#endif
 
 namespace chip {
 namespace DeviceLayer {
@@ -36,14 +46,18 @@ public:
      * @brief
      * Initalize the KVS, must be called before using.
      */
-    void Init(const char * file) { mStorage.Init(file); }
+    CHIP_ERROR Init(const char * file) { return mStorage.Init(file); }
 
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
 private:
+#if CHIP_LINUX_KVS_LOG_STORAGE
+    DeviceLayer::Internal::ChipLinuxStorageLog mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif // CHIP_LINUX_KVS_LOG_STORAGE
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
@@ -2,8 +2,21 @@
 
 #include <platform/logging/LogV.h>
 
+#include <core/CHIPConfig.h>
+
 #include <stdio.h>
 
+#if CHIP_CONFIG_BINARY_LOGGING
+#include <support/logging/BinaryLogBuffer.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <inttypes.h>
+#include <mutex>
+#include <stdlib.h>
+#include <thread>
+#endif // CHIP_CONFIG_BINARY_LOGGING
+
 namespace chip {
 namespace DeviceLayer {
 
@@ -20,11 +33,97 @@ void __attribute__((weak)) OnLogOutput() {}
 namespace Logging {
 namespace Platform {
 
+#if CHIP_CONFIG_BINARY_LOGGING
+namespace {
+
+/**
+ * With binary logging, LogV only records the messages, and a writer thread formats them and writes them out, at least every
+ * kWriteIntervalMs, and as soon as the buffer is half full.
+ */
+constexpr auto kWriteIntervalMs = std::chrono::milliseconds(20);
+
+BinaryLogBuffer<CHIP_CONFIG_BINARY_LOG_RECORD_COUNT> sLogBuffer;
+std::once_flag sWriterStarted;
+std::mutex sWriterLock;
+std::condition_variable sWriterCondition;
+
+// Writes out the messages recorded until now, from the writer thread or at exit.
+void WriteRecordedMessages()
+{
+    BinaryLogRecord record;
+    char message[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    bool written = false;
+
+    while (sLogBuffer.Pop(record))
+    {
+        FormatBinaryLogRecord(record, message, sizeof(message));
+        printf("[%" PRIu64 ".%06" PRIu64 "] CHIP:%s: %s\n", record.mTimestampUs / 1000000, record.mTimestampUs % 1000000,
+               record.mModule, message);
+        written = true;
+    }
+
+    uint32_t dropped = sLogBuffer.TakeDroppedCount();
+    if (dropped > 0)
+    {
+        printf("CHIP:-: %" PRIu32 " log messages dropped\n", dropped);
+        written = true;
+    }
+    if (written)
+    {
+        fflush(stdout);
+    }
+}
+
+void WriterThreadMain()
+{
+    std::unique_lock<std::mutex> lock(sWriterLock);
+
+    for (;;)
+    {
+        sWriterCondition.wait_for(lock, kWriteIntervalMs);
+        WriteRecordedMessages();
+    }
+}
+
+void StartWriter()
+{
+    std::thread(WriterThreadMain).detach();
+    // Write out what the process logged just before it exited
+    atexit([]() {
+        std::lock_guard<std::mutex> lock(sWriterLock);
+        WriteRecordedMessages();
+    });
+}
+
+uint64_t GetTimestampUs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+#endif // CHIP_CONFIG_BINARY_LOGGING
+
 /**
  * CHIP log output functions.
  */
 void LogV(const char * module, uint8_t category, const char * msg, va_list v)
 {
+#if CHIP_CONFIG_BINARY_LOGGING
+    std::call_once(sWriterStarted, StartWriter);
+    if (sLogBuffer.Log(GetTimestampUs(), module, category, msg, v))
+    {
+        if (sLogBuffer.GetCount() >= CHIP_CONFIG_BINARY_LOG_RECORD_COUNT / 2)
+        {
+            sWriterCondition.notify_one();
+        }
+        DeviceLayer::OnLogOutput();
+        return;
+    }
+    // A message that cannot be recorded is written out right away
+    std::lock_guard<std::mutex> lock(sWriterLock);
+#endif // CHIP_CONFIG_BINARY_LOGGING
+
     printf("CHIP:%s: ", module);
     vprintf(msg, v);
     printf("\n");
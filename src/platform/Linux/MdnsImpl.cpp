@@ -390,6 +390,8 @@ void MdnsAvahi::HandleClientState(AvahiClient * client, AvahiClientState state)
         break;
     case AVAHI_CLIENT_FAILURE:
         ChipLogError(DeviceLayer, "Avahi client failure");
+        // The resolvers and browsers of the client stopped, the services resolve again once it is back.
+        ClearResolvedServices();
         mErrorCallback(mAsyncReturnContext, CHIP_ERROR_INTERNAL);
         break;
     case AVAHI_CLIENT_S_COLLISION:
@@ -614,29 +616,57 @@ CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, MdnsServiceP
                               chip::Inet::IPAddressType addressType, chip::Inet::InterfaceId interface,
                               MdnsResolveCallback callback, void * context)
 {
-    AvahiServiceResolver * resolver;
-    AvahiIfIndex avahiInterface     = static_cast<AvahiIfIndex>(interface);
-    ResolveContext * resolveContext = chip::Platform::New<ResolveContext>();
-    CHIP_ERROR error                = CHIP_NO_ERROR;
+    AvahiIfIndex avahiInterface = static_cast<AvahiIfIndex>(interface);
+    AvahiProtocol avahiProtocol = ToAvahiProtocol(addressType);
+    std::string fullType        = GetFullType(type, protocol);
+    std::ostringstream keyBuilder;
+    std::string key;
 
-    resolveContext->mInstance = this;
-    resolveContext->mCallback = callback;
-    resolveContext->mContext  = context;
+    VerifyOrReturnError(mClient != nullptr, CHIP_ERROR_INCORRECT_STATE);
     if (interface == INET_NULL_INTERFACEID)
     {
         avahiInterface = AVAHI_IF_UNSPEC;
     }
-    resolver = avahi_service_resolver_new(mClient, avahiInterface, ToAvahiProtocol(addressType), name,
-                                          GetFullType(type, protocol).c_str(), nullptr, ToAvahiProtocol(addressType),
-                                          static_cast<AvahiLookupFlags>(0), HandleResolve, resolveContext);
-    // Otherwise the resolver will be freed in the callback
-    if (resolver == nullptr)
+
+    keyBuilder << name << "." << fullType << "." << avahiInterface << "." << avahiProtocol;
+    key = keyBuilder.str();
+
+    auto existing = mResolvedServices.find(key);
+    if (existing != mResolvedServices.end())
     {
-        error = CHIP_ERROR_INTERNAL;
-        chip::Platform::Delete(resolveContext);
+        ResolvedService & service = *existing->second;
+
+        if (service.mFound)
+        {
+            MdnsService result = service.mResult;
+
+            callback(context, &result, CHIP_NO_ERROR);
+        }
+        else
+        {
+            service.mWaiting.push_back(ResolveContext{ callback, context });
+        }
+        return CHIP_NO_ERROR;
     }
 
-    return error;
+    WatchServiceType(fullType, avahiInterface, avahiProtocol);
+
+    std::unique_ptr<ResolvedService> service(new ResolvedService());
+
+    service->mInstance = this;
+    service->mKey      = key;
+    service->mName     = name;
+    service->mType     = fullType;
+    service->mWaiting.push_back(ResolveContext{ callback, context });
+    // The resolver is only freed when the instance fails to resolve or is removed from the network.
+    service->mResolver =
+        avahi_service_resolver_new(mClient, avahiInterface, avahiProtocol, name, fullType.c_str(), nullptr, avahiProtocol,
+                                   static_cast<AvahiLookupFlags>(0), HandleResolve, service.get());
+    VerifyOrReturnError(service->mResolver != nullptr, CHIP_ERROR_INTERNAL);
+
+    mResolvedServices.emplace(key, std::move(service));
+
+    return CHIP_NO_ERROR;
 }
 
 void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex interface, AvahiProtocol protocol,
@@ -644,20 +674,30 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
                               const char * /*host_name*/, const AvahiAddress * address, uint16_t port, AvahiStringList * txt,
                               AvahiLookupResultFlags flags, void * userdata)
 {
-    ResolveContext * context = reinterpret_cast<ResolveContext *>(userdata);
-    std::vector<TextEntry> textEntries;
+    ResolvedService * service = static_cast<ResolvedService *>(userdata);
+    MdnsAvahi * instance      = service->mInstance;
+    std::vector<ResolveContext> waiting;
 
     switch (event)
     {
     case AVAHI_RESOLVER_FAILURE:
         ChipLogError(DeviceLayer, "Avahi resolve failed");
-        context->mCallback(context->mContext, nullptr, CHIP_ERROR_INTERNAL);
+        // Forgotten, so that the next resolution of the instance asks avahi-daemon again.
+        waiting.swap(service->mWaiting);
+        avahi_service_resolver_free(resolver);
+        instance->mResolvedServices.erase(std::string(service->mKey));
+
+        for (const ResolveContext & context : waiting)
+        {
+            context.mCallback(context.mContext, nullptr, CHIP_ERROR_INTERNAL);
+        }
         break;
     case AVAHI_RESOLVER_FOUND:
-        MdnsService result = {};
+        MdnsService & result = service->mResult;
 
+        result = {};
         result.mAddress.SetValue(chip::Inet::IPAddress());
-        ChipLogError(DeviceLayer, "Avahi resolve found");
+        ChipLogProgress(DeviceLayer, "Avahi resolve found");
         strncpy(result.mName, name, sizeof(result.mName));
         strncpy(result.mType, type, sizeof(result.mType));
         result.mName[kMdnsNameMaxSize] = 0;
@@ -687,32 +727,141 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
             }
         }
 
-        while (txt != nullptr)
+        // The entries are copied, they are given to the resolutions answered from the cache too.
+        service->mTextKeys.clear();
+        service->mTextData.clear();
+        service->mTextEntries.clear();
+        for (; txt != nullptr; txt = txt->next)
         {
             for (size_t i = 0; i < txt->size; i++)
             {
                 if (txt->text[i] == '=')
                 {
-                    txt->text[i] = '\0';
-                    textEntries.push_back(TextEntry{ reinterpret_cast<char *>(txt->text), &txt->text[i + 1], txt->size - i - 1 });
+                    service->mTextKeys.emplace_back(reinterpret_cast<char *>(txt->text), i);
+                    service->mTextData.emplace_back(&txt->text[i + 1], &txt->text[txt->size]);
                     break;
                 }
             }
-            txt = txt->next;
+        }
+        for (size_t i = 0; i < service->mTextKeys.size(); i++)
+        {
+            service->mTextEntries.push_back(
+                TextEntry{ service->mTextKeys[i].c_str(), service->mTextData[i].data(), service->mTextData[i].size() });
         }
 
-        if (!textEntries.empty())
+        if (!service->mTextEntries.empty())
         {
-            result.mTextEntries = textEntries.data();
+            result.mTextEntries = service->mTextEntries.data();
         }
-        result.mTextEntrySize = textEntries.size();
+        result.mTextEntrySize = service->mTextEntries.size();
+        service->mFound       = true;
 
-        context->mCallback(context->mContext, &result, CHIP_NO_ERROR);
+        waiting.swap(service->mWaiting);
+        for (const ResolveContext & context : waiting)
+        {
+            MdnsService copy = result;
+
+            context.mCallback(context.mContext, &copy, CHIP_NO_ERROR);
+        }
         break;
     }
+}
+
+void MdnsAvahi::WatchServiceType(const std::string & type, AvahiIfIndex interface, AvahiProtocol protocol)
+{
+    std::ostringstream keyBuilder;
+    std::string key;
+    AvahiServiceBrowser * browser;
 
-    avahi_service_resolver_free(resolver);
-    chip::Platform::Delete(context);
+    keyBuilder << type << "." << interface << "." << protocol;
+    key = keyBuilder.str();
+    VerifyOrReturn(mServiceBrowsers.find(key) == mServiceBrowsers.end());
+
+    browser = avahi_service_browser_new(mClient, interface, protocol, type.c_str(), nullptr, static_cast<AvahiLookupFlags>(0),
+                                        HandleWatchBrowse, this);
+    if (browser == nullptr)
+    {
+        // Resolutions are still answered from the cache, the removed instances fail to resolve again once their records expire.
+        ChipLogError(DeviceLayer, "Failed to browse %s: %s", type.c_str(), avahi_strerror(avahi_client_errno(mClient)));
+        return;
+    }
+
+    mServiceBrowsers.emplace(key, browser);
+}
+
+void MdnsAvahi::HandleWatchBrowse(AvahiServiceBrowser * browser, AvahiIfIndex /*interface*/, AvahiProtocol /*protocol*/,
+                                  AvahiBrowserEvent event, const char * name, const char * type, const char * domain,
+                                  AvahiLookupResultFlags /*flags*/, void * userdata)
+{
+    MdnsAvahi * instance = static_cast<MdnsAvahi *>(userdata);
+
+    switch (event)
+    {
+    case AVAHI_BROWSER_FAILURE:
+        ChipLogError(DeviceLayer, "Avahi browse failed, resolved services are not watched");
+        for (auto it = instance->mServiceBrowsers.begin(); it != instance->mServiceBrowsers.end(); ++it)
+        {
+            if (it->second == browser)
+            {
+                instance->mServiceBrowsers.erase(it);
+                break;
+            }
+        }
+        avahi_service_browser_free(browser);
+        break;
+    case AVAHI_BROWSER_REMOVE:
+        if (strcmp("local", domain) == 0)
+        {
+            instance->RemoveResolvedServices(name, type);
+        }
+        break;
+    case AVAHI_BROWSER_NEW:
+    case AVAHI_BROWSER_ALL_FOR_NOW:
+    case AVAHI_BROWSER_CACHE_EXHAUSTED:
+        break;
+    }
+}
+
+void MdnsAvahi::RemoveResolvedServices(const char * name, const char * type)
+{
+    for (auto it = mResolvedServices.begin(); it != mResolvedServices.end();)
+    {
+        ResolvedService & service = *it->second;
+
+        // Instances being resolved are left to their resolver, which fails if they are gone.
+        if (service.mFound && service.mName == name && service.mType == type)
+        {
+            avahi_service_resolver_free(service.mResolver);
+            it = mResolvedServices.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void MdnsAvahi::ClearResolvedServices()
+{
+    std::vector<ResolveContext> waiting;
+
+    for (auto & entry : mResolvedServices)
+    {
+        waiting.insert(waiting.end(), entry.second->mWaiting.begin(), entry.second->mWaiting.end());
+        avahi_service_resolver_free(entry.second->mResolver);
+    }
+    mResolvedServices.clear();
+
+    for (auto & entry : mServiceBrowsers)
+    {
+        avahi_service_browser_free(entry.second);
+    }
+    mServiceBrowsers.clear();
+
+    for (const ResolveContext & context : waiting)
+    {
+        context.mCallback(context.mContext, nullptr, CHIP_ERROR_INTERNAL);
+    }
 }
 
 MdnsAvahi::~MdnsAvahi()
@@ -762,6 +911,16 @@ CHIP_ERROR ChipMdnsStopPublishService(const MdnsService * service)
     return CHIP_ERROR_NOT_IMPLEMENTED;
 }
 
+CHIP_ERROR ChipMdnsRemoveServices()
+{
+    return ChipMdnsStopPublish();
+}
+
+CHIP_ERROR ChipMdnsFinalizeServiceUpdate()
+{
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ChipMdnsBrowse(const char * type, MdnsServiceProtocol protocol, chip::Inet::IPAddressType addressType,
                           chip::Inet::InterfaceId interface, MdnsBrowseCallback callback, void * context)
 {
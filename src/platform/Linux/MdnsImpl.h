@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 #include <avahi-client/client.h>
@@ -126,11 +127,27 @@ private:
 
     struct ResolveContext
     {
-        MdnsAvahi * mInstance;
         MdnsResolveCallback mCallback;
         void * mContext;
     };
 
+    /// A service instance resolved, or being resolved, by an Avahi resolver kept open: avahi-daemon reports
+    /// the changes of the instance to it, so later resolutions are answered without asking avahi-daemon.
+    struct ResolvedService
+    {
+        MdnsAvahi * mInstance;
+        std::string mKey;
+        std::string mName;
+        std::string mType;
+        AvahiServiceResolver * mResolver = nullptr;
+        bool mFound                      = false;
+        MdnsService mResult              = {}; ///< mTextEntries points to mTextEntries below.
+        std::vector<std::string> mTextKeys;
+        std::vector<std::vector<uint8_t>> mTextData;
+        std::vector<TextEntry> mTextEntries;
+        std::vector<ResolveContext> mWaiting; ///< Resolutions waiting for the instance to be found.
+    };
+
     MdnsAvahi() : mClient(nullptr), mGroup(nullptr) {}
     static MdnsAvahi sInstance;
 
@@ -148,11 +165,22 @@ private:
                               const char * host_name, const AvahiAddress * address, uint16_t port, AvahiStringList * txt,
                               AvahiLookupResultFlags flags, void * userdata);
 
+    /// Keeps browsing a service type, so that the instances removed from the network are removed from
+    /// mResolvedServices.
+    void WatchServiceType(const std::string & type, AvahiIfIndex interface, AvahiProtocol protocol);
+    static void HandleWatchBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interface, AvahiProtocol protocol,
+                                  AvahiBrowserEvent event, const char * name, const char * type, const char * domain,
+                                  AvahiLookupResultFlags flags, void * userdata);
+    void RemoveResolvedServices(const char * name, const char * type);
+    void ClearResolvedServices();
+
     MdnsAsyncReturnCallback mInitCallback;
     MdnsAsyncReturnCallback mErrorCallback;
     void * mAsyncReturnContext;
 
     std::set<std::string> mPublishedServices;
+    std::map<std::string, std::unique_ptr<ResolvedService>> mResolvedServices;
+    std::map<std::string, AvahiServiceBrowser *> mServiceBrowsers;
     AvahiClient * mClient;
     AvahiEntryGroup * mGroup;
     Poller mPoller;
@@ -57,6 +57,7 @@ const PosixConfig::Key PosixConfig::kConfigKey_ProductRevision     = { kConfigNa
 const PosixConfig::Key PosixConfig::kConfigKey_ManufacturingDate   = { kConfigNamespace_ChipFactory, "mfg-date" };
 const PosixConfig::Key PosixConfig::kConfigKey_SetupPinCode        = { kConfigNamespace_ChipFactory, "pin-code" };
 const PosixConfig::Key PosixConfig::kConfigKey_SetupDiscriminator  = { kConfigNamespace_ChipFactory, "discriminator" };
+const PosixConfig::Key PosixConfig::kConfigKey_SetupPASEVerifier   = { kConfigNamespace_ChipFactory, "pase-verifier" };
 
 // Keys stored in the Chip-config namespace
 const PosixConfig::Key PosixConfig::kConfigKey_FabricId                    = { kConfigNamespace_ChipConfig, "fabric-id" };
@@ -75,6 +76,8 @@ const PosixConfig::Key PosixConfig::kConfigKey_OperationalDevicePrivateKey = { k
 const PosixConfig::Key PosixConfig::kConfigKey_RegulatoryLocation          = { kConfigNamespace_ChipConfig, "regulatory-location" };
 const PosixConfig::Key PosixConfig::kConfigKey_CountryCode                 = { kConfigNamespace_ChipConfig, "country-code" };
 const PosixConfig::Key PosixConfig::kConfigKey_Breadcrumb                  = { kConfigNamespace_ChipConfig, "breadcrumb" };
+const PosixConfig::Key PosixConfig::kConfigKey_WiFiStationBssid            = { kConfigNamespace_ChipConfig, "sta-bssid" };
+const PosixConfig::Key PosixConfig::kConfigKey_WiFiStationFrequency        = { kConfigNamespace_ChipConfig, "sta-freq" };
 
 // Prefix used for NVS keys that contain Chip group encryption keys.
 const char PosixConfig::kGroupKeyNamePrefix[] = "gk-";
@@ -493,11 +496,34 @@ CHIP_ERROR PosixConfig::FactoryResetConfig()
     {
         ChipLogError(DeviceLayer, "Storage Commit failed: %s", ErrorStr(err));
     }
+    SuccessOrExit(err);
+
+    // A factory reset must not be left behind in memory.
+    err = storage->Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Storage Flush failed: %s", ErrorStr(err));
+    }
 
 exit:
     return err;
 }
 
+CHIP_ERROR PosixConfig::FlushConfig()
+{
+    CHIP_ERROR err = gChipLinuxConfigStorage.Flush();
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = gChipLinuxCountersStorage.Flush();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Storage Flush failed: %s", ErrorStr(err));
+    }
+    return err;
+}
+
 void PosixConfig::RunConfigUnitTest()
 {
     // Run common unit test.
@@ -76,9 +76,12 @@ public:
     static const Key kConfigKey_OperationalDeviceICACerts;
     static const Key kConfigKey_OperationalDevicePrivateKey;
     static const Key kConfigKey_SetupDiscriminator;
+    static const Key kConfigKey_SetupPASEVerifier;
     static const Key kConfigKey_RegulatoryLocation;
     static const Key kConfigKey_CountryCode;
     static const Key kConfigKey_Breadcrumb;
+    static const Key kConfigKey_WiFiStationBssid;
+    static const Key kConfigKey_WiFiStationFrequency;
 
     static const char kGroupKeyNamePrefix[];
 
@@ -99,6 +102,8 @@ public:
     static CHIP_ERROR ClearConfigValue(Key key);
     static bool ConfigValueExists(Key key);
     static CHIP_ERROR FactoryResetConfig();
+    // Writes the commits left behind (see CHIP_LINUX_STORAGE_WRITE_DELAY_MS) to the storage files.
+    static CHIP_ERROR FlushConfig();
 
     static void RunConfigUnitTest();
 
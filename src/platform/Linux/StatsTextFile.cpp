@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file implements the export of the System::Stats statistics of
+ *         a Linux node into a file in the Prometheus text format.
+ */
+
+#include <platform/Linux/StatsTextFile.h>
+
+#include <platform/CHIPDeviceLayer.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemStats.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+
+namespace chip {
+namespace DeviceLayer {
+
+namespace {
+
+const char * sExportPath;
+uint32_t sExportIntervalMs;
+
+void WriteToFile(void * context, const char * text)
+{
+    fputs(text, static_cast<FILE *>(context));
+}
+
+void HandleExportTimer(System::Layer * systemLayer, void * appState, System::Error error)
+{
+    VerifyOrReturn(sExportPath != nullptr);
+
+    CHIP_ERROR err = WriteStatsTextFile(sExportPath);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to write the statistics to %s: %s", sExportPath, ErrorStr(err));
+    }
+    SystemLayer.StartTimer(sExportIntervalMs, HandleExportTimer, nullptr);
+}
+
+} // namespace
+
+CHIP_ERROR WriteStatsTextFile(const char * path)
+{
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    char tmpPath[PATH_MAX];
+    FILE * file;
+    bool written;
+
+    VerifyOrReturnError(snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path) < static_cast<int>(sizeof(tmpPath)),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    file = fopen(tmpPath, "w");
+    VerifyOrReturnError(file != nullptr, System::MapErrorPOSIX(errno));
+
+    System::Stats::WritePrometheusText(WriteToFile, file);
+    written = (ferror(file) == 0);
+    written = (fclose(file) == 0) && written;
+    if (!written || rename(tmpPath, path) != 0)
+    {
+        CHIP_ERROR err = System::MapErrorPOSIX(errno);
+        remove(tmpPath);
+        return err;
+    }
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+}
+
+CHIP_ERROR StartStatsTextFileExport(const char * path, uint32_t intervalMs)
+{
+    VerifyOrReturnError(path != nullptr && intervalMs > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    StopStatsTextFileExport();
+    sExportPath       = path;
+    sExportIntervalMs = intervalMs;
+    return SystemLayer.StartTimer(0, HandleExportTimer, nullptr);
+}
+
+void StopStatsTextFileExport()
+{
+    SystemLayer.CancelTimer(HandleExportTimer, nullptr);
+    sExportPath = nullptr;
+}
+
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,49 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file declares the export of the System::Stats statistics of a
+ *         Linux node into a file in the Prometheus text format, such as those
+ *         the textfile collector of the Prometheus node exporter reads.
+ */
+
+#pragma once
+
+#include <core/CHIPError.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace DeviceLayer {
+
+/**
+ * Write the statistics to path. They are written to a temporary file next to it, then renamed over it, so that the file is
+ * never read half written.
+ */
+CHIP_ERROR WriteStatsTextFile(const char * path);
+
+/**
+ * Write the statistics to path every intervalMs milliseconds, on the CHIP stack thread, until StopStatsTextFileExport() is
+ * called. The path must outlive the export.
+ */
+CHIP_ERROR StartStatsTextFileExport(const char * path, uint32_t intervalMs);
+void StopStatsTextFileExport();
+
+} // namespace DeviceLayer
+} // namespace chip
@@ -53,12 +53,26 @@ using otbr::DBus::NeighborInfo;
 
 constexpr int kDBusConnectionPollingTimeoutMS = 10;
 
+constexpr char kOtbrDBusInterface[]         = "io.openthread.BorderRouter";
+constexpr char kOtbrDBusPropertiesChanged[] = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES
+                                              "',member='PropertiesChanged',arg0='io.openthread.BorderRouter'";
+constexpr char kOtbrPropertyLinkMode[]      = "LinkMode";
+constexpr char kOtbrPropertyActiveDataset[] = "ActiveDatasetTlvs";
+
+static bool IsAttachedRole(DeviceRole role)
+{
+    return role != DeviceRole::OTBR_DEVICE_ROLE_DETACHED && role != DeviceRole::OTBR_DEVICE_ROLE_DISABLED;
+}
+
 namespace chip {
 namespace DeviceLayer {
 
 ThreadStackManagerImpl ThreadStackManagerImpl::sInstance;
 
-ThreadStackManagerImpl::ThreadStackManagerImpl() : mThreadApi(nullptr), mConnection(nullptr), mAttached(false) {}
+ThreadStackManagerImpl::ThreadStackManagerImpl() :
+    mThreadApi(nullptr), mConnection(nullptr), mRole(DeviceRole::OTBR_DEVICE_ROLE_DISABLED), mAttached(false), mLinkMode{},
+    mLinkModeCached(false), mDatasetCached(false)
+{}
 
 CHIP_ERROR ThreadStackManagerImpl::_InitThreadStack()
 {
@@ -74,9 +88,14 @@ CHIP_ERROR ThreadStackManagerImpl::_InitThreadStack()
     mThreadApi = std::unique_ptr<otbr::DBus::ThreadApiDBus>(new otbr::DBus::ThreadApiDBus(mConnection.get()));
     mThreadApi->AddDeviceRoleHandler([this](DeviceRole newRole) { this->_ThreadDevcieRoleChangedHandler(newRole); });
 
+    // The role handler above only hears about the role, the other cached properties are dropped when they change.
+    dbus_bus_add_match(mConnection.get(), kOtbrDBusPropertiesChanged, &dbusError);
+    VerifyOrExit(!dbus_error_is_set(&dbusError), error = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_connection_add_filter(mConnection.get(), _PropertiesChangedFilter, this, nullptr),
+                 error = ClientError::ERROR_DBUS);
+
     SuccessOrExit(error = mThreadApi->GetDeviceRole(role));
     _ThreadDevcieRoleChangedHandler(role);
-    mAttached = (role != DeviceRole::OTBR_DEVICE_ROLE_DETACHED && role != DeviceRole::OTBR_DEVICE_ROLE_DISABLED);
 
     dispatchConnection = mConnection.get();
     mDBusEventLoop     = std::thread([dispatchConnection]() {
@@ -97,10 +116,21 @@ exit:
 
 void ThreadStackManagerImpl::_ThreadDevcieRoleChangedHandler(DeviceRole role)
 {
-    bool attached         = (role != DeviceRole::OTBR_DEVICE_ROLE_DETACHED && role != DeviceRole::OTBR_DEVICE_ROLE_DISABLED);
+    bool attached         = IsAttachedRole(role);
+    bool wasAttached      = false;
     ChipDeviceEvent event = ChipDeviceEvent{};
 
-    if (attached != mAttached)
+    {
+        std::lock_guard<std::mutex> lock(mCacheLock);
+        wasAttached = mAttached;
+        mRole       = role;
+        mAttached   = attached;
+        // otbr-agent signals neither of these on every change, but a new role is when they change.
+        mLinkModeCached = false;
+        mDatasetCached  = false;
+    }
+
+    if (attached != wasAttached)
     {
         event.Type = DeviceEventType::kThreadConnectivityChange;
         event.ThreadConnectivityChange.Result =
@@ -113,6 +143,102 @@ void ThreadStackManagerImpl::_ThreadDevcieRoleChangedHandler(DeviceRole role)
     PlatformMgr().PostEvent(&event);
 }
 
+DBusHandlerResult ThreadStackManagerImpl::_PropertiesChangedFilter(DBusConnection * aConnection, DBusMessage * aMessage,
+                                                                   void * aContext)
+{
+    auto * self = static_cast<ThreadStackManagerImpl *>(aContext);
+    DBusMessageIter iter;
+    DBusMessageIter array;
+    const char * interfaceName = nullptr;
+
+    (void) aConnection;
+
+    VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, "PropertiesChanged"), );
+    VerifyOrExit(dbus_message_iter_init(aMessage, &iter) && dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_STRING, );
+    dbus_message_iter_get_basic(&iter, &interfaceName);
+    VerifyOrExit(strcmp(interfaceName, kOtbrDBusInterface) == 0, );
+
+    // The changed properties, as a{sv}
+    VerifyOrExit(dbus_message_iter_next(&iter) && dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, );
+    for (dbus_message_iter_recurse(&iter, &array); dbus_message_iter_get_arg_type(&array) == DBUS_TYPE_DICT_ENTRY;
+         dbus_message_iter_next(&array))
+    {
+        DBusMessageIter entry;
+        const char * name = nullptr;
+
+        dbus_message_iter_recurse(&array, &entry);
+        VerifyOrExit(dbus_message_iter_get_arg_type(&entry) == DBUS_TYPE_STRING, );
+        dbus_message_iter_get_basic(&entry, &name);
+        self->_InvalidateProperty(name);
+    }
+
+    // The invalidated properties, as an array of their names
+    VerifyOrExit(dbus_message_iter_next(&iter) && dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, );
+    for (dbus_message_iter_recurse(&iter, &array); dbus_message_iter_get_arg_type(&array) == DBUS_TYPE_STRING;
+         dbus_message_iter_next(&array))
+    {
+        const char * name = nullptr;
+
+        dbus_message_iter_get_basic(&array, &name);
+        self->_InvalidateProperty(name);
+    }
+
+exit:
+    // The signal is left for the handlers of ThreadApiDBus as well.
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+void ThreadStackManagerImpl::_InvalidateProperty(const char * aName)
+{
+    std::lock_guard<std::mutex> lock(mCacheLock);
+
+    if (strcmp(aName, kOtbrPropertyLinkMode) == 0)
+    {
+        mLinkModeCached = false;
+    }
+    else if (strcmp(aName, kOtbrPropertyActiveDataset) == 0)
+    {
+        mDatasetCached = false;
+    }
+}
+
+DeviceRole ThreadStackManagerImpl::_GetDeviceRole()
+{
+    std::lock_guard<std::mutex> lock(mCacheLock);
+    return mRole;
+}
+
+ClientError ThreadStackManagerImpl::_GetLinkMode(LinkModeConfig & aLinkMode)
+{
+    ClientError error = ClientError::ERROR_NONE;
+    LinkModeConfig linkMode;
+
+    {
+        std::lock_guard<std::mutex> lock(mCacheLock);
+        if (mLinkModeCached)
+        {
+            aLinkMode = mLinkMode;
+            return error;
+        }
+        // Marked before the read, so that a change signalled while it is in flight drops what it returns.
+        mLinkModeCached = true;
+    }
+
+    error = mThreadApi->GetLinkMode(linkMode);
+
+    std::lock_guard<std::mutex> lock(mCacheLock);
+    if (error == ClientError::ERROR_NONE)
+    {
+        mLinkMode = linkMode;
+        aLinkMode = linkMode;
+    }
+    else
+    {
+        mLinkModeCached = false;
+    }
+    return error;
+}
+
 void ThreadStackManagerImpl::_ProcessThreadActivity() {}
 
 static bool RouteMatch(const otbr::DBus::Ip6Prefix & prefix, const Inet::IPAddress & addr)
@@ -146,9 +272,9 @@ bool ThreadStackManagerImpl::_HaveRouteToAddress(const Inet::IPAddress & destAdd
     std::vector<otbr::DBus::ExternalRoute> routes;
     bool match = false;
 
-    VerifyOrExit(mThreadApi->GetExternalRoutes(routes) == ClientError::ERROR_NONE, match = false);
     VerifyOrExit(_IsThreadAttached(), match = false);
     VerifyOrExit(destAddr.IsIPv6LinkLocal(), match = true);
+    VerifyOrExit(mThreadApi->GetExternalRoutes(routes) == ClientError::ERROR_NONE, match = false);
     for (const auto & route : routes)
     {
         VerifyOrExit(!(match = RouteMatch(route.mPrefix, destAddr)), );
@@ -175,6 +301,10 @@ CHIP_ERROR ThreadStackManagerImpl::_SetThreadProvision(ByteSpan netInfo)
         std::vector<uint8_t> data(netInfo.data(), netInfo.data() + netInfo.size());
 
         SuccessOrExit(err = OTBR_TO_CHIP_ERROR(mThreadApi->SetActiveDatasetTlvs(data)));
+        {
+            std::lock_guard<std::mutex> lock(mCacheLock);
+            mDatasetCached = false;
+        }
 
         // post an event alerting other subsystems about change in provisioning state
         ChipDeviceEvent event;
@@ -192,8 +322,25 @@ CHIP_ERROR ThreadStackManagerImpl::_GetThreadProvision(ByteSpan & netInfo)
     CHIP_ERROR err = CHIP_NO_ERROR;
     std::vector<uint8_t> data(Thread::kSizeOperationalDataset);
 
-    SuccessOrExit(err = OTBR_TO_CHIP_ERROR(mThreadApi->GetActiveDatasetTlvs(data)));
-    SuccessOrExit(err = mDataset.Init(ByteSpan(data.data(), data.size())));
+    {
+        std::lock_guard<std::mutex> lock(mCacheLock);
+        VerifyOrExit(!mDatasetCached, netInfo = mDataset.AsByteSpan());
+        // Marked before the read, so that a change signalled while it is in flight drops what it returns.
+        mDatasetCached = true;
+    }
+
+    err = OTBR_TO_CHIP_ERROR(mThreadApi->GetActiveDatasetTlvs(data));
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mDataset.Init(ByteSpan(data.data(), data.size()));
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        std::lock_guard<std::mutex> lock(mCacheLock);
+        mDatasetCached = false;
+        ExitNow();
+    }
 
     netInfo = mDataset.AsByteSpan();
 
@@ -209,23 +356,19 @@ bool ThreadStackManagerImpl::_IsThreadProvisioned()
 void ThreadStackManagerImpl::_ErasePersistentInfo()
 {
     static_cast<Thread::OperationalDataset &>(mDataset).Clear();
+
+    std::lock_guard<std::mutex> lock(mCacheLock);
+    mDatasetCached = false;
 }
 
 bool ThreadStackManagerImpl::_IsThreadEnabled()
 {
-    bool enabled = false;
-    DeviceRole role;
-    ClientError error;
-
-    SuccessOrExit(error = mThreadApi->GetDeviceRole(role));
-    enabled = (role != DeviceRole::OTBR_DEVICE_ROLE_DISABLED);
-exit:
-    LogClientError(error);
-    return enabled;
+    return _GetDeviceRole() != DeviceRole::OTBR_DEVICE_ROLE_DISABLED;
 }
 
 bool ThreadStackManagerImpl::_IsThreadAttached()
 {
+    std::lock_guard<std::mutex> lock(mCacheLock);
     return mAttached;
 }
 
@@ -251,12 +394,11 @@ exit:
 
 ConnectivityManager::ThreadDeviceType ThreadStackManagerImpl::_GetThreadDeviceType()
 {
-    ClientError error;
-    DeviceRole role;
+    ClientError error = ClientError::ERROR_NONE;
+    DeviceRole role   = _GetDeviceRole();
     LinkModeConfig linkMode;
     ConnectivityManager::ThreadDeviceType type = ConnectivityManager::ThreadDeviceType::kThreadDeviceType_NotSupported;
 
-    SuccessOrExit(error = mThreadApi->GetDeviceRole(role));
 
     switch (role)
     {
@@ -264,7 +406,7 @@ ConnectivityManager::ThreadDeviceType ThreadStackManagerImpl::_GetThreadDeviceTy
     case DeviceRole::OTBR_DEVICE_ROLE_DETACHED:
         break;
     case DeviceRole::OTBR_DEVICE_ROLE_CHILD:
-        SuccessOrExit(error = mThreadApi->GetLinkMode(linkMode));
+        SuccessOrExit(error = _GetLinkMode(linkMode));
         if (!linkMode.mRxOnWhenIdle)
         {
             type = ConnectivityManager::ThreadDeviceType::kThreadDeviceType_SleepyEndDevice;
@@ -307,6 +449,9 @@ CHIP_ERROR ThreadStackManagerImpl::_SetThreadDeviceType(ConnectivityManager::Thr
     if (!linkMode.mNetworkData)
     {
         error = mThreadApi->SetLinkMode(linkMode);
+
+        std::lock_guard<std::mutex> lock(mCacheLock);
+        mLinkModeCached = false;
     }
 
     LogClientError(error);
@@ -330,17 +475,15 @@ CHIP_ERROR ThreadStackManagerImpl::_SetThreadPollingConfig(const ConnectivityMan
 
 bool ThreadStackManagerImpl::_HaveMeshConnectivity()
 {
-    DeviceRole role;
-    ClientError error;
+    DeviceRole role      = _GetDeviceRole();
+    ClientError error    = ClientError::ERROR_NONE;
     bool hasConnectivity = false;
     std::vector<NeighborInfo> neighbors;
 
-    SuccessOrExit(error = mThreadApi->GetDeviceRole(role));
-    VerifyOrExit(role != DeviceRole::OTBR_DEVICE_ROLE_DETACHED && role != DeviceRole::OTBR_DEVICE_ROLE_DISABLED, );
-    if (role == DeviceRole::OTBR_DEVICE_ROLE_CHILD || role == DeviceRole::OTBR_DEVICE_ROLE_ROUTER)
-    {
-        hasConnectivity = true;
-    }
+    VerifyOrExit(IsAttachedRole(role), );
+    // The neighbor table is not signalled by otbr-agent, so it is only read when the role alone does not tell.
+    VerifyOrExit(role != DeviceRole::OTBR_DEVICE_ROLE_CHILD && role != DeviceRole::OTBR_DEVICE_ROLE_ROUTER,
+                 hasConnectivity = true);
 
     SuccessOrExit(error = mThreadApi->GetNeighborTable(neighbors));
     for (const auto & neighbor : neighbors)
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -108,12 +109,27 @@ private:
 
     void _ThreadDevcieRoleChangedHandler(otbr::DBus::DeviceRole role);
 
+    static DBusHandlerResult _PropertiesChangedFilter(DBusConnection * aConnection, DBusMessage * aMessage, void * aContext);
+    void _InvalidateProperty(const char * aName);
+
+    otbr::DBus::DeviceRole _GetDeviceRole();
+    otbr::DBus::ClientError _GetLinkMode(otbr::DBus::LinkModeConfig & aLinkMode);
+
     Thread::OperationalDataset mDataset = {};
 
     std::unique_ptr<otbr::DBus::ThreadApiDBus> mThreadApi;
     UniqueDBusConnection mConnection;
-    bool mAttached;
     std::thread mDBusEventLoop;
+
+    // The properties of otbr-agent which are queried on the CHIP thread are served from here rather than read over D-Bus each
+    // time. The D-Bus event loop thread keeps them current from the PropertiesChanged signals of otbr-agent, so mCacheLock
+    // guards everything below.
+    std::mutex mCacheLock;
+    otbr::DBus::DeviceRole mRole;
+    bool mAttached;
+    otbr::DBus::LinkModeConfig mLinkMode;
+    bool mLinkModeCached;
+    bool mDatasetCached;
 };
 
 } // namespace DeviceLayer
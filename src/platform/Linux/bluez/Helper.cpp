@@ -1164,7 +1164,6 @@ void EndpointCleanup(BluezEndpoint * apEndpoint)
             g_free(apEndpoint->mpPeerDevicePath);
             apEndpoint->mpPeerDevicePath = nullptr;
         }
-        g_free(apEndpoint->mpConnectCancellable);
         g_free(apEndpoint);
     }
 }
@@ -1555,8 +1554,7 @@ CHIP_ERROR InitBluezBleLayer(bool aIsCentral, char * apBleAddr, BLEAdvConfig & a
     }
     else
     {
-        endpoint->mAdapterId           = aBleAdvConfig.mAdapterId;
-        endpoint->mpConnectCancellable = g_cancellable_new();
+        endpoint->mAdapterId = aBleAdvConfig.mAdapterId;
     }
 
     err = MainLoop::Instance().EnsureStarted();
@@ -1722,12 +1720,16 @@ bool BluezUnsubscribeCharacteristic(BLE_CONNECTION_OBJECT apConn)
 
 struct ConnectParams
 {
-    ConnectParams(BluezDevice1 * device, BluezEndpoint * endpoint) : mDevice(device), mEndpoint(endpoint) {}
+    ConnectParams(BluezDevice1 * device, BluezEndpoint * endpoint, GCancellable * cancellable, void * context) :
+        mDevice(device), mEndpoint(endpoint), mCancellable(cancellable), mContext(context)
+    {}
     BluezDevice1 * mDevice;
     BluezEndpoint * mEndpoint;
+    GCancellable * mCancellable;
+    void * mContext;
 };
 
-static void ConnectDeviceDone(GObject * aObject, GAsyncResult * aResult, gpointer)
+static void ConnectDeviceDone(GObject * aObject, GAsyncResult * aResult, gpointer apContext)
 {
     BluezDevice1 * device = BLUEZ_DEVICE1(aObject);
     GError * error        = nullptr;
@@ -1736,7 +1738,9 @@ static void ConnectDeviceDone(GObject * aObject, GAsyncResult * aResult, gpointe
     if (!success)
     {
         ChipLogError(DeviceLayer, "FAIL: ConnectDevice : %s", error->message);
-        BLEManagerImpl::HandleConnectFailed(CHIP_ERROR_INTERNAL);
+        // A cancelled connection has already been reported as failed, and its context may serve another one by now.
+        VerifyOrExit(!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED), );
+        BLEManagerImpl::HandleConnectFailed(apContext, CHIP_ERROR_INTERNAL);
         ExitNow();
     }
 
@@ -1749,29 +1753,33 @@ exit:
 
 static gboolean ConnectDeviceImpl(ConnectParams * apParams)
 {
-    BluezDevice1 * device    = apParams->mDevice;
-    BluezEndpoint * endpoint = apParams->mEndpoint;
+    BluezDevice1 * device      = apParams->mDevice;
+    GCancellable * cancellable = apParams->mCancellable;
 
     assert(device != nullptr);
-    assert(endpoint != nullptr);
+    assert(apParams->mEndpoint != nullptr);
+    assert(cancellable != nullptr);
 
-    g_cancellable_reset(endpoint->mpConnectCancellable);
-    bluez_device1_call_connect(device, endpoint->mpConnectCancellable, ConnectDeviceDone, nullptr);
+    // The call is asynchronous, so that connections to several devices may be in progress at once.
+    bluez_device1_call_connect(device, cancellable, ConnectDeviceDone, apParams->mContext);
     g_object_unref(device);
+    g_object_unref(cancellable);
     chip::Platform::Delete(apParams);
 
     return G_SOURCE_REMOVE;
 }
 
-CHIP_ERROR ConnectDevice(BluezDevice1 * apDevice, BluezEndpoint * apEndpoint)
+CHIP_ERROR ConnectDevice(BluezDevice1 * apDevice, BluezEndpoint * apEndpoint, GCancellable * apCancellable, void * apContext)
 {
-    auto params = chip::Platform::New<ConnectParams>(apDevice, apEndpoint);
+    auto params = chip::Platform::New<ConnectParams>(apDevice, apEndpoint, apCancellable, apContext);
     g_object_ref(apDevice);
+    g_object_ref(apCancellable);
 
     if (!MainLoop::Instance().Schedule(ConnectDeviceImpl, params))
     {
         ChipLogError(Ble, "Failed to schedule ConnectDeviceImpl() on CHIPoBluez thread");
         g_object_unref(apDevice);
+        g_object_unref(apCancellable);
         chip::Platform::Delete(params);
         return CHIP_ERROR_INCORRECT_STATE;
     }
@@ -1779,12 +1787,6 @@ CHIP_ERROR ConnectDevice(BluezDevice1 * apDevice, BluezEndpoint * apEndpoint)
     return CHIP_NO_ERROR;
 }
 
-void CancelConnect(BluezEndpoint * apEndpoint)
-{
-    assert(apEndpoint->mpConnectCancellable != nullptr);
-    g_cancellable_cancel(apEndpoint->mpConnectCancellable);
-}
-
 } // namespace Internal
 } // namespace DeviceLayer
 } // namespace chip
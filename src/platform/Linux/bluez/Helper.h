@@ -74,8 +74,10 @@ bool BluezSubscribeCharacteristic(BLE_CONNECTION_OBJECT apConn);
 /// Unsubscribe from the CHIP TX characteristic on the remote peripheral device
 bool BluezUnsubscribeCharacteristic(BLE_CONNECTION_OBJECT apConn);
 
-CHIP_ERROR ConnectDevice(BluezDevice1 * apDevice, BluezEndpoint * apEndpoint);
-void CancelConnect(BluezEndpoint * apEndpoint);
+/// Connect to the remote peripheral device, unless apCancellable is cancelled first
+/// On failure, BLEManagerImpl::HandleConnectFailed is called with apContext
+
+CHIP_ERROR ConnectDevice(BluezDevice1 * apDevice, BluezEndpoint * apEndpoint, GCancellable * apCancellable, void * apContext);
 
 } // namespace Internal
 } // namespace DeviceLayer
@@ -40,9 +40,15 @@
 #endif
 
 #if CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT
+#include <openthread/random_noncrypto.h>
 #include <openthread/srp_client.h>
 #endif
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+#include <openthread/dns_client.h>
+#include <openthread/ip6.h>
+#endif
+
 #include <core/CHIPEncoding.h>
 #include <platform/OpenThread/GenericThreadStackManagerImpl_OpenThread.h>
 #include <platform/OpenThread/OpenThreadUtils.h>
@@ -844,8 +850,22 @@ CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::DoInit(otInstanc
     otSrpClientSetCallback(mOTInst, &OnSrpClientNotification, nullptr);
     otSrpClientEnableAutoStartMode(mOTInst, &OnSrpClientStateChange, nullptr);
     memset(&mSrpClient, 0, sizeof(mSrpClient));
+    mSrpClient.mLeaseJitterPermille =
+        static_cast<uint16_t>(otRandomNonCryptoGetUint32() % (CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_JITTER_PERCENT * 10 + 1));
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+    for (typename DnsClient::Query & query : mDnsClient.mQueries)
+    {
+        query.mBrowseCallback  = nullptr;
+        query.mResolveCallback = nullptr;
+    }
+    for (typename DnsClient::Service & service : mDnsClient.mCache)
+    {
+        service.mExpiryTimeMs = 0;
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
     // If the Thread stack has been provisioned, but is not currently enabled, enable it now.
     if (otThreadGetDeviceRole(mOTInst) == OT_DEVICE_ROLE_DISABLED && otDatasetIsCommissioned(otInst))
     {
@@ -902,6 +922,9 @@ CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::AdjustPollingInt
         {
             ChipLogProgress(DeviceLayer, "OpenThread polling interval set to %" PRId32 "ms", newPollingIntervalMS);
         }
+
+        // Timers that can wait a little expire at the data polls, when the radio is up anyway.
+        SystemLayer.SetWakeAlignmentPeriod(newPollingIntervalMS);
     }
 
     return err;
@@ -1095,16 +1118,31 @@ CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_AddSrpService(c
             // Assign first empty slot in array for a new service.
             srpService = srpService ? srpService : &service;
         }
-        else
+        else if ((strcmp(service.mInstanceName, aInstanceName) == 0) && (strcmp(service.mName, aName) == 0))
         {
-            VerifyOrExit((strcmp(service.mInstanceName, aInstanceName) != 0) || (strcmp(service.mName, aName) != 0),
-                         error = MapOpenThreadError(OT_ERROR_DUPLICATED));
+            // Keep a service added again as it was registered, unless it changed, in which case it is replaced once the
+            // services are all updated.
+            if (service.mIsInvalid && IsSameSrpService(service, aPort, aTxtEntries, aTxtEntiresSize))
+            {
+                service.mIsInvalid = false;
+                ExitNow();
+            }
+
+            VerifyOrExit(service.mIsInvalid, error = MapOpenThreadError(OT_ERROR_DUPLICATED));
         }
     }
 
     // Verify is there an empty place for new service.
     VerifyOrExit(srpService, error = MapOpenThreadError(OT_ERROR_NO_BUFS));
 
+    if (aLeaseInterval == 0)
+    {
+        aLeaseInterval = CHIP_DEVICE_CONFIG_THREAD_SRP_LEASE_INTERVAL;
+    }
+
+    // Shorten the lease by the jitter of the device, so that the refreshes of devices started together drift apart.
+    aLeaseInterval -= static_cast<uint32_t>(static_cast<uint64_t>(aLeaseInterval) * mSrpClient.mLeaseJitterPermille / 1000);
+
     otSrpClientSetLeaseInterval(mOTInst, aLeaseInterval);
     otSrpClientSetKeyLeaseInterval(mOTInst, aKeyLeaseInterval);
 
@@ -1139,6 +1177,13 @@ CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_AddSrpService(c
         srpService->mService.mTxtEntries = srpService->mTxtEntries;
     }
 
+    // Hold the service back while the services are updated, to register it along with the other changes.
+    if (mSrpClient.mIsUpdating)
+    {
+        srpService->mIsPending = true;
+        ExitNow();
+    }
+
     error = MapOpenThreadError(otSrpClientAddService(mOTInst, &(srpService->mService)));
 
 exit:
@@ -1172,6 +1217,13 @@ CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_RemoveSrpServic
 
     VerifyOrExit(srpService, error = MapOpenThreadError(OT_ERROR_NOT_FOUND));
 
+    // A service held back was never passed to the SRP client.
+    if (srpService->mIsPending)
+    {
+        memset(srpService, 0, sizeof(*srpService));
+        ExitNow();
+    }
+
     error = MapOpenThreadError(otSrpClientRemoveService(mOTInst, &(srpService->mService)));
 
 exit:
@@ -1188,6 +1240,16 @@ CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_RemoveAllSrpSer
     Impl()->LockThreadStack();
     const otSrpClientService * services = otSrpClientGetServices(mOTInst);
 
+    // Drop the services held back by an update, which the SRP client does not know of.
+    mSrpClient.mIsUpdating = false;
+    for (typename SrpClient::Service & service : mSrpClient.mServices)
+    {
+        if (service.mIsPending)
+        {
+            memset(&service, 0, sizeof(service));
+        }
+    }
+
     // In case of empty list just return with no error
     VerifyOrExit(services != nullptr, error = CHIP_NO_ERROR);
 
@@ -1199,6 +1261,110 @@ exit:
     return error;
 }
 
+template <class ImplClass>
+CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_InvalidateAllSrpServices()
+{
+    Impl()->LockThreadStack();
+
+    for (typename SrpClient::Service & service : mSrpClient.mServices)
+    {
+        // Services held back by an update not finished are dropped, as they were never registered.
+        if (service.mIsPending)
+        {
+            memset(&service, 0, sizeof(service));
+        }
+        else if (strcmp(service.mInstanceName, "") != 0)
+        {
+            service.mIsInvalid = true;
+        }
+    }
+
+    mSrpClient.mIsUpdating = true;
+
+    Impl()->UnlockThreadStack();
+
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_RemoveInvalidSrpServices()
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+
+    // Pass all the changes to the SRP client under a single lock, so that it sends them in a single update.
+    Impl()->LockThreadStack();
+
+    VerifyOrExit(mSrpClient.mIsUpdating, error = CHIP_NO_ERROR);
+    mSrpClient.mIsUpdating = false;
+
+    for (typename SrpClient::Service & service : mSrpClient.mServices)
+    {
+        bool isReplaced = false;
+
+        if (!service.mIsInvalid)
+        {
+            continue;
+        }
+
+        for (const typename SrpClient::Service & other : mSrpClient.mServices)
+        {
+            isReplaced = isReplaced ||
+                (other.mIsPending && strcmp(other.mInstanceName, service.mInstanceName) == 0 &&
+                 strcmp(other.mName, service.mName) == 0);
+        }
+
+        service.mIsInvalid = false;
+
+        if (isReplaced)
+        {
+            // Registering the changed service replaces this one on the server, so it need not be removed from there.
+            SuccessOrExit(error = MapOpenThreadError(otSrpClientClearService(mOTInst, &(service.mService))));
+            memset(&service, 0, sizeof(service));
+        }
+        else
+        {
+            SuccessOrExit(error = MapOpenThreadError(otSrpClientRemoveService(mOTInst, &(service.mService))));
+        }
+    }
+
+    for (typename SrpClient::Service & service : mSrpClient.mServices)
+    {
+        if (service.mIsPending)
+        {
+            service.mIsPending = false;
+            SuccessOrExit(error = MapOpenThreadError(otSrpClientAddService(mOTInst, &(service.mService))));
+        }
+    }
+
+exit:
+    Impl()->UnlockThreadStack();
+
+    return error;
+}
+
+template <class ImplClass>
+bool GenericThreadStackManagerImpl_OpenThread<ImplClass>::IsSameSrpService(const typename SrpClient::Service & aService,
+                                                                           uint16_t aPort,
+                                                                           const chip::Mdns::TextEntry * aTxtEntries,
+                                                                           size_t aTxtEntiresSize)
+{
+    VerifyOrReturnError(aService.mService.mPort == aPort &&
+                            aService.mService.mNumTxtEntries == (aTxtEntries ? aTxtEntiresSize : 0),
+                        false);
+
+    for (uint8_t entryId = 0; entryId < aService.mService.mNumTxtEntries; entryId++)
+    {
+        const otDnsTxtEntry & entry = aService.mTxtEntries[entryId];
+
+        VerifyOrReturnError(strcmp(entry.mKey, aTxtEntries[entryId].mKey) == 0 &&
+                                entry.mValueLength == aTxtEntries[entryId].mDataSize &&
+                                memcmp(entry.mValue, aTxtEntries[entryId].mData, entry.mValueLength) == 0,
+                            false);
+    }
+
+    return true;
+}
+
 template <class ImplClass>
 CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_SetupSrpHost(const char * aHostName)
 {
@@ -1234,6 +1400,367 @@ exit:
 
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
+template <class ImplClass>
+CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_DnsBrowse(const char * aType,
+                                                                           chip::Mdns::MdnsServiceProtocol aProtocol,
+                                                                           chip::Mdns::MdnsBrowseCallback aCallback,
+                                                                           void * aContext)
+{
+    CHIP_ERROR error                  = CHIP_NO_ERROR;
+    typename DnsClient::Query * query = nullptr;
+    char serviceName[DnsClient::kMaxServiceNameSize];
+
+    Impl()->LockThreadStack();
+
+    VerifyOrExit(aType && aCallback, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(strlen(aType) < sizeof(query->mResult.mService.mType), error = CHIP_ERROR_INVALID_STRING_LENGTH);
+    SuccessOrExit(error = MakeDnsServiceName(serviceName, aType, aProtocol));
+
+    query = AllocateDnsQuery(aContext);
+    VerifyOrExit(query, error = CHIP_ERROR_NO_MEMORY);
+
+    query->mBrowseCallback            = aCallback;
+    query->mResult.mService.mProtocol = aProtocol;
+    strcpy(query->mResult.mService.mType, aType);
+
+    error = MapOpenThreadError(otDnsClientBrowse(mOTInst, serviceName, OnDnsBrowseResponse, query, nullptr));
+
+exit:
+    if (error != CHIP_NO_ERROR && query)
+    {
+        query->mBrowseCallback = nullptr;
+    }
+
+    Impl()->UnlockThreadStack();
+
+    return error;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::_DnsResolve(chip::Mdns::MdnsService * aService,
+                                                                            chip::Mdns::MdnsResolveCallback aCallback,
+                                                                            void * aContext)
+{
+    CHIP_ERROR error                           = CHIP_NO_ERROR;
+    typename DnsClient::Query * query          = nullptr;
+    const typename DnsClient::Service * cached = nullptr;
+    char serviceName[DnsClient::kMaxServiceNameSize];
+
+    Impl()->LockThreadStack();
+
+    VerifyOrExit(aService && aCallback, error = CHIP_ERROR_INVALID_ARGUMENT);
+    SuccessOrExit(error = MakeDnsServiceName(serviceName, aService->mType, aService->mProtocol));
+
+    query = AllocateDnsQuery(aContext);
+    VerifyOrExit(query, error = CHIP_ERROR_NO_MEMORY);
+
+    query->mResolveCallback = aCallback;
+    cached                  = FindCachedDnsService(*aService);
+
+    // Answer from the cache while the records of the service are valid, rather than querying the server again.
+    if (cached)
+    {
+        CopyDnsService(query->mResult, *cached);
+        PlatformMgr().ScheduleWork(DispatchDnsQuery, reinterpret_cast<intptr_t>(query));
+        ExitNow();
+    }
+
+    query->mResult.mService                = *aService;
+    query->mResult.mService.mInterface     = INET_NULL_INTERFACEID;
+    query->mResult.mService.mTextEntries   = nullptr;
+    query->mResult.mService.mTextEntrySize = 0;
+    query->mResult.mService.mSubTypes      = nullptr;
+    query->mResult.mService.mSubTypeSize   = 0;
+    query->mResult.mService.mAddress.ClearValue();
+
+    error = MapOpenThreadError(
+        otDnsClientResolveService(mOTInst, aService->mName, serviceName, OnDnsResolveResponse, query, nullptr));
+
+exit:
+    if (error != CHIP_NO_ERROR && query)
+    {
+        query->mResolveCallback = nullptr;
+    }
+
+    Impl()->UnlockThreadStack();
+
+    return error;
+}
+
+template <class ImplClass>
+typename GenericThreadStackManagerImpl_OpenThread<ImplClass>::DnsClient::Query *
+GenericThreadStackManagerImpl_OpenThread<ImplClass>::AllocateDnsQuery(void * aContext)
+{
+    for (typename DnsClient::Query & query : mDnsClient.mQueries)
+    {
+        if (query.mBrowseCallback == nullptr && query.mResolveCallback == nullptr)
+        {
+            query.mOwner             = this;
+            query.mContext           = aContext;
+            query.mError             = CHIP_NO_ERROR;
+            query.mHostName[0]       = '\0';
+            query.mBrowseResultCount = 0;
+            return &query;
+        }
+    }
+
+    return nullptr;
+}
+
+template <class ImplClass>
+const typename GenericThreadStackManagerImpl_OpenThread<ImplClass>::DnsClient::Service *
+GenericThreadStackManagerImpl_OpenThread<ImplClass>::FindCachedDnsService(const chip::Mdns::MdnsService & aService) const
+{
+    uint64_t now = System::Layer::GetClock_MonotonicMS();
+
+    for (const typename DnsClient::Service & service : mDnsClient.mCache)
+    {
+        if (service.mExpiryTimeMs > now && service.mService.mProtocol == aService.mProtocol &&
+            strcmp(service.mService.mName, aService.mName) == 0 && strcmp(service.mService.mType, aService.mType) == 0)
+        {
+            return &service;
+        }
+    }
+
+    return nullptr;
+}
+
+template <class ImplClass>
+void GenericThreadStackManagerImpl_OpenThread<ImplClass>::CacheDnsService(const typename DnsClient::Service & aService)
+{
+    typename DnsClient::Service * slot = nullptr;
+
+    VerifyOrReturn(aService.mExpiryTimeMs > System::Layer::GetClock_MonotonicMS());
+
+    // Replace the entry of the same service, or else the one expiring first, which expired ones always are.
+    for (typename DnsClient::Service & service : mDnsClient.mCache)
+    {
+        if (service.mService.mProtocol == aService.mService.mProtocol &&
+            strcmp(service.mService.mName, aService.mService.mName) == 0 &&
+            strcmp(service.mService.mType, aService.mService.mType) == 0)
+        {
+            slot = &service;
+            break;
+        }
+
+        if (slot == nullptr || service.mExpiryTimeMs < slot->mExpiryTimeMs)
+        {
+            slot = &service;
+        }
+    }
+
+    CopyDnsService(*slot, aService);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericThreadStackManagerImpl_OpenThread<ImplClass>::MakeDnsServiceName(char (&aName)[DnsClient::kMaxServiceNameSize],
+                                                                                   const char * aType,
+                                                                                   chip::Mdns::MdnsServiceProtocol aProtocol)
+{
+    // Services registered through SRP are all in the default domain of the server.
+    int length = snprintf(aName, sizeof(aName), "%s.%s.default.service.arpa.", aType,
+                          aProtocol == chip::Mdns::MdnsServiceProtocol::kMdnsProtocolUdp ? "_udp" : "_tcp");
+
+    return (length > 0 && static_cast<size_t>(length) < sizeof(aName)) ? CHIP_NO_ERROR : CHIP_ERROR_INVALID_STRING_LENGTH;
+}
+
+template <class ImplClass>
+void GenericThreadStackManagerImpl_OpenThread<ImplClass>::CopyDnsService(typename DnsClient::Service & aTo,
+                                                                         const typename DnsClient::Service & aFrom)
+{
+    aTo = aFrom;
+
+    // Point the text entries at the buffers of the copy.
+    aTo.mService.mTextEntries = aTo.mTxtEntries;
+    for (size_t entryId = 0; entryId < aTo.mService.mTextEntrySize; entryId++)
+    {
+        aTo.mTxtEntries[entryId].mKey  = aTo.mTxtKeyBuffers[entryId];
+        aTo.mTxtEntries[entryId].mData = aTo.mTxtValueBuffers[entryId];
+    }
+}
+
+template <class ImplClass>
+bool GenericThreadStackManagerImpl_OpenThread<ImplClass>::ReadDnsServiceInfo(typename DnsClient::Service & aService,
+                                                                             const otDnsServiceInfo & aInfo)
+{
+    otDnsTxtEntryIterator iterator;
+    otDnsTxtEntry entry;
+    uint8_t entryId = 0;
+
+    aService.mService.mPort        = aInfo.mPort;
+    aService.mService.mAddressType = Inet::kIPAddressType_IPv6;
+    aService.mService.mTextEntries = aService.mTxtEntries;
+    aService.mExpiryTimeMs         = System::Layer::GetClock_MonotonicMS() + aInfo.mTtl * 1000ull;
+
+    otDnsInitTxtEntryIterator(&iterator, aInfo.mTxtData, aInfo.mTxtDataSize);
+    while (entryId < DnsClient::kMaxTxtEntriesNumber && otDnsGetNextTxtEntry(&iterator, &entry) == OT_ERROR_NONE)
+    {
+        // Skip the entries too long for the buffers, as well as those with no key.
+        if (entry.mKey == nullptr || strlen(entry.mKey) >= DnsClient::kMaxTxtKeySize ||
+            entry.mValueLength > DnsClient::kMaxTxtValueSize)
+        {
+            continue;
+        }
+
+        strcpy(aService.mTxtKeyBuffers[entryId], entry.mKey);
+        memcpy(aService.mTxtValueBuffers[entryId], entry.mValue, entry.mValueLength);
+        aService.mTxtEntries[entryId].mKey      = aService.mTxtKeyBuffers[entryId];
+        aService.mTxtEntries[entryId].mData     = aService.mTxtValueBuffers[entryId];
+        aService.mTxtEntries[entryId].mDataSize = entry.mValueLength;
+        entryId++;
+    }
+    aService.mService.mTextEntrySize = entryId;
+
+    // The server may leave the address of the host out of its response.
+    VerifyOrReturnError(!otIp6IsAddressUnspecified(&aInfo.mHostAddress), false);
+
+    SetDnsServiceAddress(aService, aInfo.mHostAddress, aInfo.mHostAddressTtl);
+    return true;
+}
+
+template <class ImplClass>
+void GenericThreadStackManagerImpl_OpenThread<ImplClass>::SetDnsServiceAddress(typename DnsClient::Service & aService,
+                                                                               const otIp6Address & aAddress, uint32_t aTtl)
+{
+    Inet::IPAddress address;
+    uint64_t expiryTimeMs = System::Layer::GetClock_MonotonicMS() + aTtl * 1000ull;
+
+    memcpy(address.Addr, &aAddress.mFields.m32, sizeof(address.Addr));
+    aService.mService.mAddress.SetValue(address);
+    aService.mExpiryTimeMs = expiryTimeMs < aService.mExpiryTimeMs ? expiryTimeMs : aService.mExpiryTimeMs;
+}
+
+template <class ImplClass>
+void GenericThreadStackManagerImpl_OpenThread<ImplClass>::OnDnsBrowseResponse(otError aError, const otDnsBrowseResponse * aResponse,
+                                                                              void * aContext)
+{
+    auto query = static_cast<typename DnsClient::Query *>(aContext);
+    typename DnsClient::Service service;
+    otDnsServiceInfo info;
+    uint8_t txtData[DnsClient::kMaxTxtDataSize];
+
+    query->mError = MapOpenThreadError(aError);
+    VerifyOrExit(aError == OT_ERROR_NONE, );
+
+    for (uint16_t index = 0; query->mBrowseResultCount < DnsClient::kMaxBrowseResults; index++)
+    {
+        chip::Mdns::MdnsService & result = query->mBrowseResults[query->mBrowseResultCount];
+
+        if (otDnsBrowseResponseGetServiceInstance(aResponse, index, result.mName, static_cast<uint8_t>(sizeof(result.mName))) !=
+            OT_ERROR_NONE)
+        {
+            break;
+        }
+
+        strcpy(result.mType, query->mResult.mService.mType);
+        result.mProtocol      = query->mResult.mService.mProtocol;
+        result.mAddressType   = Inet::kIPAddressType_IPv6;
+        result.mPort          = 0;
+        result.mInterface     = INET_NULL_INTERFACEID;
+        result.mTextEntries   = nullptr;
+        result.mTextEntrySize = 0;
+        result.mSubTypes      = nullptr;
+        result.mSubTypeSize   = 0;
+        result.mAddress.ClearValue();
+        query->mBrowseResultCount++;
+
+        // The server mostly sends the records of the instances along, so that they need not be resolved again.
+        info.mHostNameBuffer     = query->mHostName;
+        info.mHostNameBufferSize = static_cast<uint16_t>(sizeof(query->mHostName));
+        info.mTxtData            = txtData;
+        info.mTxtDataSize        = static_cast<uint16_t>(sizeof(txtData));
+        service.mService         = result;
+        if (otDnsBrowseResponseGetServiceInfo(aResponse, result.mName, &info) == OT_ERROR_NONE &&
+            ReadDnsServiceInfo(service, info))
+        {
+            result.mPort    = service.mService.mPort;
+            result.mAddress = service.mService.mAddress;
+            query->mOwner->CacheDnsService(service);
+        }
+    }
+
+exit:
+    PlatformMgr().ScheduleWork(DispatchDnsQuery, reinterpret_cast<intptr_t>(query));
+}
+
+template <class ImplClass>
+void GenericThreadStackManagerImpl_OpenThread<ImplClass>::OnDnsResolveResponse(otError aError,
+                                                                               const otDnsServiceResponse * aResponse,
+                                                                               void * aContext)
+{
+    auto query = static_cast<typename DnsClient::Query *>(aContext);
+    otDnsServiceInfo info;
+    uint8_t txtData[DnsClient::kMaxTxtDataSize];
+
+    info.mHostNameBuffer     = query->mHostName;
+    info.mHostNameBufferSize = static_cast<uint16_t>(sizeof(query->mHostName));
+    info.mTxtData            = txtData;
+    info.mTxtDataSize        = static_cast<uint16_t>(sizeof(txtData));
+
+    query->mError = MapOpenThreadError(aError);
+    SuccessOrExit(query->mError);
+    SuccessOrExit(query->mError = MapOpenThreadError(otDnsServiceResponseGetServiceInfo(aResponse, &info)));
+
+    if (!ReadDnsServiceInfo(query->mResult, info))
+    {
+        // Query the address of the host on its own, and answer once it is known.
+        SuccessOrExit(query->mError = MapOpenThreadError(otDnsClientResolveAddress(query->mOwner->mOTInst, query->mHostName,
+                                                                                   OnDnsAddressResponse, query, nullptr)));
+        return;
+    }
+
+    query->mOwner->CacheDnsService(query->mResult);
+
+exit:
+    PlatformMgr().ScheduleWork(DispatchDnsQuery, reinterpret_cast<intptr_t>(query));
+}
+
+template <class ImplClass>
+void GenericThreadStackManagerImpl_OpenThread<ImplClass>::OnDnsAddressResponse(otError aError,
+                                                                               const otDnsAddressResponse * aResponse,
+                                                                               void * aContext)
+{
+    auto query = static_cast<typename DnsClient::Query *>(aContext);
+    otIp6Address address;
+    uint32_t ttl = 0;
+
+    query->mError = MapOpenThreadError(aError);
+    SuccessOrExit(query->mError);
+    SuccessOrExit(query->mError = MapOpenThreadError(otDnsAddressResponseGetAddress(aResponse, 0, &address, &ttl)));
+
+    SetDnsServiceAddress(query->mResult, address, ttl);
+    query->mOwner->CacheDnsService(query->mResult);
+
+exit:
+    PlatformMgr().ScheduleWork(DispatchDnsQuery, reinterpret_cast<intptr_t>(query));
+}
+
+template <class ImplClass>
+void GenericThreadStackManagerImpl_OpenThread<ImplClass>::DispatchDnsQuery(intptr_t aContext)
+{
+    auto query = reinterpret_cast<typename DnsClient::Query *>(aContext);
+
+    if (query->mBrowseCallback)
+    {
+        query->mBrowseCallback(query->mContext, query->mBrowseResults, query->mBrowseResultCount, query->mError);
+    }
+    else
+    {
+        query->mResolveCallback(query->mContext, query->mError == CHIP_NO_ERROR ? &query->mResult.mService : nullptr,
+                                query->mError);
+    }
+
+    // Release the query once answered, taking the lock other queries are allocated under.
+    query->mOwner->Impl()->LockThreadStack();
+    query->mBrowseCallback  = nullptr;
+    query->mResolveCallback = nullptr;
+    query->mOwner->Impl()->UnlockThreadStack();
+}
+
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
 } // namespace Internal
 } // namespace DeviceLayer
 } // namespace chip
@@ -32,6 +32,10 @@
 #include <openthread/srp_client.h>
 #endif
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+#include <openthread/dns_client.h>
+#endif
+
 #include <lib/mdns/Advertiser.h>
 #include <lib/mdns/platform/Mdns.h>
 
@@ -98,9 +102,17 @@ protected:
                               size_t aTxtEntiresSize, uint32_t aLeaseInterval, uint32_t aKeyLeaseInterval);
     CHIP_ERROR _RemoveSrpService(const char * aInstanceName, const char * aName);
     CHIP_ERROR _RemoveAllSrpServices();
+    CHIP_ERROR _InvalidateAllSrpServices();
+    CHIP_ERROR _RemoveInvalidSrpServices();
     CHIP_ERROR _SetupSrpHost(const char * aHostName);
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+    CHIP_ERROR _DnsBrowse(const char * aType, chip::Mdns::MdnsServiceProtocol aProtocol, chip::Mdns::MdnsBrowseCallback aCallback,
+                          void * aContext);
+    CHIP_ERROR _DnsResolve(chip::Mdns::MdnsService * aService, chip::Mdns::MdnsResolveCallback aCallback, void * aContext);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
     // ===== Members available to the implementation subclass.
 
     CHIP_ERROR DoInit(otInstance * otInst);
@@ -137,21 +149,94 @@ private:
             otDnsTxtEntry mTxtEntries[kMaxTxtEntriesNumber];
             uint8_t mTxtValueBuffers[kMaxTxtEntriesNumber][kMaxTxtValueSize];
             char mTxtKeyBuffers[kMaxTxtEntriesNumber][kMaxTxtKeySize];
+            // Registered before the services were invalidated, and not added again since.
+            bool mIsInvalid;
+            // Added since the services were invalidated, and held back until they are all updated at once.
+            bool mIsPending;
         };
 
         char mHostName[kMaxHostNameSize];
         otIp6Address mHostAddress;
         Service mServices[kMaxServicesNumber];
+        bool mIsUpdating;
+        uint16_t mLeaseJitterPermille;
     };
 
     SrpClient mSrpClient;
 
+    static bool IsSameSrpService(const typename SrpClient::Service & aService, uint16_t aPort,
+                                 const chip::Mdns::TextEntry * aTxtEntries, size_t aTxtEntiresSize);
+
     static void OnSrpClientNotification(otError aError, const otSrpClientHostInfo * aHostInfo, const otSrpClientService * aServices,
                                         const otSrpClientService * aRemovedServices, void * aContext);
     static void OnSrpClientStateChange(const otSockAddr * aServerSockAddr, void * aContext);
 
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT
 
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
+    struct DnsClient
+    {
+        static constexpr uint8_t kMaxQueries          = CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_QUERIES;
+        static constexpr uint8_t kMaxBrowseResults    = CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_MAX_BROWSE_RESULTS;
+        static constexpr uint8_t kMaxCachedServices   = CHIP_DEVICE_CONFIG_THREAD_DNS_CLIENT_CACHE_SIZE;
+        // "<type>.<protocol>.default.service.arpa."
+        static constexpr uint8_t kMaxServiceNameSize  = chip::Mdns::kMdnsTypeMaxSize + chip::Mdns::kMdnsProtocolTextMaxSize + 23;
+        static constexpr uint8_t kMaxHostNameSize     = 64;
+        // Thread only supports operational discovery
+        static constexpr uint8_t kMaxTxtEntriesNumber = chip::Mdns::OperationalAdvertisingParameters::kNumAdvertisingTxtEntries;
+        static constexpr uint8_t kMaxTxtValueSize     = chip::Mdns::OperationalAdvertisingParameters::kTxtMaxValueSize;
+        static constexpr uint8_t kMaxTxtKeySize       = chip::Mdns::OperationalAdvertisingParameters::kTxtMaxKeySize;
+        // Each entry takes a length byte and "key=value".
+        static constexpr uint8_t kMaxTxtDataSize = kMaxTxtEntriesNumber * (1 + kMaxTxtKeySize + kMaxTxtValueSize);
+
+        struct Service
+        {
+            chip::Mdns::MdnsService mService;
+            chip::Mdns::TextEntry mTxtEntries[kMaxTxtEntriesNumber];
+            uint8_t mTxtValueBuffers[kMaxTxtEntriesNumber][kMaxTxtValueSize];
+            char mTxtKeyBuffers[kMaxTxtEntriesNumber][kMaxTxtKeySize];
+            // Monotonic time in milliseconds at which the first of the records the service was resolved from expires.
+            uint64_t mExpiryTimeMs;
+        };
+
+        struct Query
+        {
+            GenericThreadStackManagerImpl_OpenThread * mOwner;
+            chip::Mdns::MdnsBrowseCallback mBrowseCallback;
+            chip::Mdns::MdnsResolveCallback mResolveCallback;
+            void * mContext;
+            CHIP_ERROR mError;
+            char mHostName[kMaxHostNameSize];
+            // The service resolved, or for a browse query, the type and protocol browsed.
+            Service mResult;
+            chip::Mdns::MdnsService mBrowseResults[kMaxBrowseResults];
+            size_t mBrowseResultCount;
+        };
+
+        Query mQueries[kMaxQueries];
+        Service mCache[kMaxCachedServices];
+    };
+
+    DnsClient mDnsClient;
+
+    typename DnsClient::Query * AllocateDnsQuery(void * aContext);
+    const typename DnsClient::Service * FindCachedDnsService(const chip::Mdns::MdnsService & aService) const;
+    void CacheDnsService(const typename DnsClient::Service & aService);
+
+    static CHIP_ERROR MakeDnsServiceName(char (&aName)[DnsClient::kMaxServiceNameSize], const char * aType,
+                                         chip::Mdns::MdnsServiceProtocol aProtocol);
+    static void CopyDnsService(typename DnsClient::Service & aTo, const typename DnsClient::Service & aFrom);
+    static bool ReadDnsServiceInfo(typename DnsClient::Service & aService, const otDnsServiceInfo & aInfo);
+    static void SetDnsServiceAddress(typename DnsClient::Service & aService, const otIp6Address & aAddress, uint32_t aTtl);
+
+    static void OnDnsBrowseResponse(otError aError, const otDnsBrowseResponse * aResponse, void * aContext);
+    static void OnDnsResolveResponse(otError aError, const otDnsServiceResponse * aResponse, void * aContext);
+    static void OnDnsAddressResponse(otError aError, const otDnsAddressResponse * aResponse, void * aContext);
+    static void DispatchDnsQuery(intptr_t aContext);
+
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+
     static void OnJoinerComplete(otError aError, void * aContext);
     void OnJoinerComplete(otError aError);
 
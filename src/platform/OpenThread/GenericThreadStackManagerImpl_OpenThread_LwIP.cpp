@@ -371,17 +371,24 @@ void GenericThreadStackManagerImpl_OpenThread_LwIP<ImplClass>::ReceivePacket(otM
     struct pbuf * pbuf         = NULL;
     err_t lwipErr              = ERR_OK;
     uint16_t pktLen            = otMessageGetLength(pkt);
+    uint16_t offset            = 0;
     struct netif * threadNetIf = ThreadStackMgrImpl().ThreadNetIf();
 
     // Allocate an LwIP pbuf to hold the inbound packet.
     pbuf = pbuf_alloc(PBUF_LINK, pktLen, PBUF_POOL);
     VerifyOrExit(pbuf != NULL, lwipErr = ERR_MEM);
 
-    // Copy the packet data from the OpenThread message object to the pbuf.
-    if (otMessageRead(pkt, 0, pbuf->payload, pktLen) != pktLen)
+    // Copy the packet data from the OpenThread message object to the pbuf. A packet longer
+    // than a pool buffer is given a chain of pbufs, each of which is filled in turn.
+    for (struct pbuf * partialPkt = pbuf; partialPkt != NULL; partialPkt = partialPkt->next)
     {
-        ExitNow(lwipErr = ERR_IF);
+        if (otMessageRead(pkt, offset, partialPkt->payload, partialPkt->len) != partialPkt->len)
+        {
+            ExitNow(lwipErr = ERR_IF);
+        }
+        offset = static_cast<uint16_t>(offset + partialPkt->len);
     }
+    VerifyOrExit(offset == pktLen, lwipErr = ERR_IF);
 
 #if CHIP_DETAIL_LOGGING
     LogOpenThreadPacket("Thread packet RCVD", pkt);
@@ -68,15 +68,39 @@ CHIP_ERROR ChipMdnsStopPublishService(const MdnsService * service)
     return ThreadStackMgr().RemoveSrpService(service->mName, serviceType);
 }
 
+CHIP_ERROR ChipMdnsRemoveServices()
+{
+    return ThreadStackMgr().InvalidateAllSrpServices();
+}
+
+CHIP_ERROR ChipMdnsFinalizeServiceUpdate()
+{
+    return ThreadStackMgr().RemoveInvalidSrpServices();
+}
+
 CHIP_ERROR ChipMdnsBrowse(const char * type, MdnsServiceProtocol protocol, Inet::IPAddressType addressType,
                           Inet::InterfaceId interface, MdnsBrowseCallback callback, void * context)
 {
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+    if (type == nullptr || callback == nullptr)
+        return CHIP_ERROR_INVALID_ARGUMENT;
+
+    return ThreadStackMgr().DnsBrowse(type, protocol, callback, context);
+#else
     return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
 }
 
 CHIP_ERROR ChipMdnsResolve(MdnsService * browseResult, Inet::InterfaceId interface, MdnsResolveCallback callback, void * context)
 {
+#if CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
+    if (browseResult == nullptr || callback == nullptr)
+        return CHIP_ERROR_INVALID_ARGUMENT;
+
+    return ThreadStackMgr().DnsResolve(browseResult, callback, context);
+#else
     return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
 }
 
 } // namespace Mdns
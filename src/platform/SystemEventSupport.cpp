@@ -43,9 +43,7 @@ System::Error PostEvent(System::Layer & aLayer, void * aContext, System::Object
     event.ChipSystemLayerEvent.Target   = &aTarget;
     event.ChipSystemLayerEvent.Argument = aArgument;
 
-    PlatformMgr().PostEvent(&event);
-
-    return CHIP_SYSTEM_NO_ERROR;
+    return PlatformMgr().PostEvent(&event);
 }
 
 System::Error DispatchEvents(Layer & aLayer, void * aContext)
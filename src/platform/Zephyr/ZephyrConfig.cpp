@@ -58,6 +58,7 @@ const ZephyrConfig::Key ZephyrConfig::kConfigKey_ProductRevision     = CONFIG_KE
 const ZephyrConfig::Key ZephyrConfig::kConfigKey_ManufacturingDate   = CONFIG_KEY(NAMESPACE_FACTORY "mfg-date");
 const ZephyrConfig::Key ZephyrConfig::kConfigKey_SetupPinCode        = CONFIG_KEY(NAMESPACE_FACTORY "pin-code");
 const ZephyrConfig::Key ZephyrConfig::kConfigKey_SetupDiscriminator  = CONFIG_KEY(NAMESPACE_FACTORY "discriminator");
+const ZephyrConfig::Key ZephyrConfig::kConfigKey_SetupPASEVerifier   = CONFIG_KEY(NAMESPACE_FACTORY "pase-verifier");
 // Keys stored in the chip config namespace
 // NOTE: update sAllResettableConfigKeys definition when adding a new entry below
 const ZephyrConfig::Key ZephyrConfig::kConfigKey_FabricId                    = CONFIG_KEY(NAMESPACE_CONFIG "fabric-id");
@@ -93,6 +94,77 @@ constexpr const char * sAllResettableConfigKeys[] = { ZephyrConfig::kConfigKey_F
                                                       ZephyrConfig::kConfigKey_CountryCode,
                                                       ZephyrConfig::kConfigKey_Breadcrumb };
 
+// Writes held back by a transaction, as records made of the key, its null-character, the length of the value
+// (16 bits, little-endian) and the value.
+uint8_t sTransactionBuffer[CHIP_DEVICE_CONFIG_SETTINGS_TRANSACTION_BUFFER_SIZE];
+size_t sTransactionLength;
+uint32_t sTransactionDepth;
+
+struct StagedValue
+{
+    size_t offset;       // of the record in sTransactionBuffer
+    size_t recordLength; // including the key
+    const uint8_t * value;
+    size_t length;
+};
+
+bool NextStagedValue(size_t offset, StagedValue & staged, const char *& key)
+{
+    if (offset >= sTransactionLength)
+        return false;
+
+    key                     = reinterpret_cast<const char *>(&sTransactionBuffer[offset]);
+    const size_t keyLength  = strlen(key) + 1;
+    const uint8_t * pLength = &sTransactionBuffer[offset + keyLength];
+
+    staged.offset       = offset;
+    staged.length       = Encoding::LittleEndian::Get16(pLength);
+    staged.value        = pLength + 2;
+    staged.recordLength = keyLength + 2 + staged.length;
+    return true;
+}
+
+bool FindStagedValue(const char * key, StagedValue & staged)
+{
+    const char * stagedKey;
+
+    for (size_t offset = 0; NextStagedValue(offset, staged, stagedKey); offset += staged.recordLength)
+    {
+        if (strcmp(stagedKey, key) == 0)
+            return true;
+    }
+    return false;
+}
+
+void RemoveStagedValue(const char * key)
+{
+    StagedValue staged;
+
+    if (FindStagedValue(key, staged))
+    {
+        memmove(&sTransactionBuffer[staged.offset], &sTransactionBuffer[staged.offset + staged.recordLength],
+                sTransactionLength - staged.offset - staged.recordLength);
+        sTransactionLength -= staged.recordLength;
+    }
+}
+
+// Returns false when the value does not fit, it must then be written right away.
+bool StageValue(const char * key, const void * source, size_t length)
+{
+    const size_t keyLength = strlen(key) + 1;
+
+    RemoveStagedValue(key);
+    if (length == 0 || length > UINT16_MAX || keyLength + 2 + length > sizeof(sTransactionBuffer) - sTransactionLength)
+        return false;
+
+    uint8_t * p = &sTransactionBuffer[sTransactionLength];
+    memcpy(p, key, keyLength);
+    Encoding::LittleEndian::Put16(p + keyLength, static_cast<uint16_t>(length));
+    memcpy(p + keyLength + 2, source, length);
+    sTransactionLength += keyLength + 2 + length;
+    return true;
+}
+
 // Data structure to be passed as a parameter of Zephyr's settings_load_subtree_direct() function
 struct ReadRequest
 {
@@ -128,6 +200,19 @@ int ConfigValueCallback(const char * name, size_t configSize, settings_read_cb r
 // Read configuration value of maximum size `bufferSize` and store the actual size in `configSize`.
 CHIP_ERROR ReadConfigValueImpl(const ZephyrConfig::Key key, void * const destination, const size_t bufferSize, size_t & configSize)
 {
+    StagedValue staged;
+
+    // A value written during a transaction is more recent than the saved one.
+    if (sTransactionDepth > 0 && FindStagedValue(key, staged))
+    {
+        configSize = staged.length;
+        if (!destination || staged.length > bufferSize)
+            return CHIP_ERROR_BUFFER_TOO_SMALL;
+
+        memcpy(destination, staged.value, staged.length);
+        return CHIP_NO_ERROR;
+    }
+
     ReadRequest request{ destination, bufferSize, CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND, 0 };
     settings_load_subtree_direct(key, ConfigValueCallback, &request);
     configSize = request.configSize;
@@ -136,6 +221,9 @@ CHIP_ERROR ReadConfigValueImpl(const ZephyrConfig::Key key, void * const destina
 
 CHIP_ERROR WriteConfigValueImpl(const ZephyrConfig::Key key, const void * const source, const size_t length)
 {
+    if (sTransactionDepth > 0 && StageValue(key, source, length))
+        return CHIP_NO_ERROR;
+
     if (settings_save_one(key, source, length) != 0)
         return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
 
@@ -265,6 +353,8 @@ CHIP_ERROR ZephyrConfig::WriteConfigValueCounter(::chip::Platform::PersistedStor
 
 CHIP_ERROR ZephyrConfig::ClearConfigValue(Key key)
 {
+    RemoveStagedValue(key);
+
     if (settings_delete(key) != 0)
         return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
 
@@ -280,12 +370,44 @@ bool ZephyrConfig::ConfigValueExists(Key key)
 CHIP_ERROR ZephyrConfig::FactoryResetConfig(void)
 {
     for (const auto key : sAllResettableConfigKeys)
+    {
+        RemoveStagedValue(key);
         if (settings_delete(key) != 0)
             return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    return CHIP_NO_ERROR;
+}
 
+CHIP_ERROR ZephyrConfig::BeginTransaction(void)
+{
+    sTransactionDepth++;
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR ZephyrConfig::CommitTransaction(void)
+{
+    CHIP_ERROR result = CHIP_NO_ERROR;
+    StagedValue staged;
+    const char * key;
+
+    if (sTransactionDepth == 0)
+        return CHIP_ERROR_INCORRECT_STATE;
+
+    if (--sTransactionDepth > 0)
+        return CHIP_NO_ERROR;
+
+    // Save every value, even after a failure, so that one bad write does not lose the others.
+    for (size_t offset = 0; NextStagedValue(offset, staged, key); offset += staged.recordLength)
+    {
+        if (settings_save_one(key, staged.value, staged.length) != 0)
+            result = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+    sTransactionLength = 0;
+
+    return result;
+}
+
 void ZephyrConfig::RunConfigUnitTest()
 {
     // Run common unit test.
@@ -25,6 +25,14 @@
 
 #include <platform/internal/CHIPDeviceLayerInternal.h>
 
+/**
+ * The size of the buffer holding the configuration values written during a transaction, until it is committed.
+ * The values which do not fit are written right away.
+ */
+#ifndef CHIP_DEVICE_CONFIG_SETTINGS_TRANSACTION_BUFFER_SIZE
+#define CHIP_DEVICE_CONFIG_SETTINGS_TRANSACTION_BUFFER_SIZE 1024
+#endif
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
@@ -52,6 +60,7 @@ public:
     static const Key kConfigKey_ManufacturingDate;
     static const Key kConfigKey_SetupPinCode;
     static const Key kConfigKey_SetupDiscriminator;
+    static const Key kConfigKey_SetupPASEVerifier;
     static const Key kConfigKey_FabricId;
     static const Key kConfigKey_ServiceConfig;
     static const Key kConfigKey_PairedAccountId;
@@ -90,6 +99,10 @@ public:
 
     static void RunConfigUnitTest(void);
 
+    // Holds back the writes until the matching CommitTransaction(), which saves the last value written to each key once.
+    static CHIP_ERROR BeginTransaction(void);
+    static CHIP_ERROR CommitTransaction(void);
+
 private:
     static bool BuildCounterConfigKey(::chip::Platform::PersistedStorage::Key counterId, char key[]);
 };
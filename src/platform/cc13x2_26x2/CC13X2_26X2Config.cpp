@@ -50,6 +50,7 @@ const CC13X2_26X2Config::Key CC13X2_26X2Config::kConfigKey_ProductRevision     =
 const CC13X2_26X2Config::Key CC13X2_26X2Config::kConfigKey_ManufacturingDate   = { { kCC13X2_26X2ChipConfig_Sysid, 0x0007 } };
 const CC13X2_26X2Config::Key CC13X2_26X2Config::kConfigKey_SetupPinCode        = { { kCC13X2_26X2ChipConfig_Sysid, 0x0008 } };
 const CC13X2_26X2Config::Key CC13X2_26X2Config::kConfigKey_SetupDiscriminator  = { { kCC13X2_26X2ChipConfig_Sysid, 0x0009 } };
+const CC13X2_26X2Config::Key CC13X2_26X2Config::kConfigKey_SetupPASEVerifier   = { { kCC13X2_26X2ChipConfig_Sysid, 0x000a } };
 
 // Keys stored in the Chip-config namespace
 const CC13X2_26X2Config::Key CC13X2_26X2Config::kConfigKey_FabricId              = { { kCC13X2_26X2ChipFactory_Sysid, 0x0011 } };
@@ -75,4 +75,5 @@
 #ifdef CONFIG_CHIP_ENABLE_DNSSD_SRP
 #define CHIP_DEVICE_CONFIG_ENABLE_MDNS 1
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT 1
+#define CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT 1
 #endif // CONFIG_CHIP_ENABLE_DNSSD_SRP
@@ -72,6 +72,7 @@ public:
     static constexpr Key kConfigKey_SetupPinCode        = QorvoConfigKey(kFileId_ChipFactory, 0x05);
     static constexpr Key kConfigKey_MfrDeviceICACerts   = QorvoConfigKey(kFileId_ChipFactory, 0x06);
     static constexpr Key kConfigKey_SetupDiscriminator  = QorvoConfigKey(kFileId_ChipFactory, 0x07);
+    static constexpr Key kConfigKey_SetupPASEVerifier   = QorvoConfigKey(kFileId_ChipFactory, 0x08);
 
     static constexpr Key kConfigKey_FabricId                    = QorvoConfigKey(kFileId_ChipConfig, 0x00);
     static constexpr Key kConfigKey_ServiceConfig               = QorvoConfigKey(kFileId_ChipConfig, 0x01);
@@ -99,7 +100,7 @@ public:
 
     // Set key id limits for each group.
     static constexpr Key kMinConfigKey_ChipFactory = kConfigKey_SerialNum;
-    static constexpr Key kMaxConfigKey_ChipFactory = kConfigKey_SetupDiscriminator;
+    static constexpr Key kMaxConfigKey_ChipFactory = kConfigKey_SetupPASEVerifier;
     static constexpr Key kMinConfigKey_ChipConfig  = kConfigKey_FabricId;
     static constexpr Key kMaxConfigKey_ChipConfig  = kConfigKey_GroupKeyMax;
     static constexpr Key kMinConfigKey_ChipCounter = kConfigKey_CounterKeyBase;
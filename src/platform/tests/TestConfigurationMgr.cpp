@@ -305,6 +305,36 @@ static void TestConfigurationMgr_SetupDiscriminator(nlTestSuite * inSuite, void
     NL_TEST_ASSERT(inSuite, getSetupDiscriminator == setSetupDiscriminator);
 }
 
+static void TestConfigurationMgr_SetupPASEVerifier(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    uint8_t verifier[80];
+    uint8_t buf[128];
+    size_t verifierLen;
+
+    for (size_t i = 0; i < sizeof(verifier); i++)
+    {
+        verifier[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+
+    err = ConfigurationMgr().StoreSetupPASEVerifier(verifier, sizeof(verifier));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = ConfigurationMgr().GetSetupPASEVerifier(buf, sizeof(buf), verifierLen);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, verifierLen == sizeof(verifier));
+    NL_TEST_ASSERT(inSuite, memcmp(buf, verifier, verifierLen) == 0);
+
+    // A new setup PIN code invalidates the verifier.
+    err = ConfigurationMgr().StoreSetupPinCode(34567890);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = ConfigurationMgr().GetSetupPASEVerifier(buf, sizeof(buf), verifierLen);
+    NL_TEST_ASSERT(inSuite, err == CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
+}
+
 static void TestConfigurationMgr_PairedAccountId(nlTestSuite * inSuite, void * inContext)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -460,6 +490,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test ConfigurationMgr::ManufacturerDevicePrivateKey", TestConfigurationMgr_ManufacturerDevicePrivateKey),
     NL_TEST_DEF("Test ConfigurationMgr::SetupPinCode", TestConfigurationMgr_SetupPinCode),
     NL_TEST_DEF("Test ConfigurationMgr::SetupDiscriminator", TestConfigurationMgr_SetupDiscriminator),
+    NL_TEST_DEF("Test ConfigurationMgr::SetupPASEVerifier", TestConfigurationMgr_SetupPASEVerifier),
     NL_TEST_DEF("Test ConfigurationMgr::FabricId", TestConfigurationMgr_FabricId),
     NL_TEST_DEF("Test ConfigurationMgr::ServiceConfig", TestConfigurationMgr_ServiceConfig),
     NL_TEST_DEF("Test ConfigurationMgr::PairedAccountId", TestConfigurationMgr_PairedAccountId),
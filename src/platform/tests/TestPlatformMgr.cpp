@@ -28,6 +28,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
+
 #include <nlunit-test.h>
 #include <support/CHIPMem.h>
 #include <support/CodeUtils.h>
@@ -63,6 +65,16 @@ static void TestPlatformMgr_TryLockChipStack(nlTestSuite * inSuite, void * inCon
         PlatformMgr().UnlockChipStack();
 }
 
+static void TestPlatformMgr_LockChipStackShared(nlTestSuite * inSuite, void * inContext)
+{
+    PlatformMgr().LockChipStackShared();
+    NL_TEST_ASSERT(inSuite, !PlatformMgr().TryLockChipStack());
+    PlatformMgr().UnlockChipStackShared();
+
+    PlatformMgr().LockChipStack();
+    PlatformMgr().UnlockChipStack();
+}
+
 static int sEventRecieved = 0;
 
 void DeviceEventHandler(const ChipDeviceEvent * event, intptr_t arg)
@@ -87,6 +99,44 @@ static void TestPlatformMgr_AddEventHandler(nlTestSuite * inSuite, void * inCont
 #endif
 }
 
+static std::atomic<uint32_t> sWorkDone;
+
+static void CountWork(intptr_t arg)
+{
+    sWorkDone++;
+}
+
+static void TestPlatformMgr_ScheduleWorkOverflow(nlTestSuite * inSuite, void * inContext)
+{
+    // Enough work to overflow the event queue on any platform.
+    const uint32_t kMaxWork = 4 * CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE + 4;
+    uint32_t scheduled      = 0;
+    CHIP_ERROR err          = CHIP_NO_ERROR;
+
+    sWorkDone = 0;
+
+    // Holding the CHIP stack lock keeps the event loop from draining the queue, so posting eventually fails.
+    PlatformMgr().LockChipStack();
+    while (scheduled < kMaxWork && (err = PlatformMgr().ScheduleWork(CountWork)) == CHIP_NO_ERROR)
+    {
+        scheduled++;
+    }
+    PlatformMgr().UnlockChipStack();
+
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, scheduled > 0 && scheduled < kMaxWork);
+
+    // Every piece of work that was accepted still runs.
+    const uint64_t deadline = System::Layer::GetClock_MonotonicMS() + 1000;
+    while (sWorkDone < scheduled && System::Layer::GetClock_MonotonicMS() < deadline)
+    {
+    }
+    NL_TEST_ASSERT(inSuite, sWorkDone == scheduled);
+
+    // Once the queue has drained, work can be scheduled again.
+    NL_TEST_ASSERT(inSuite, PlatformMgr().ScheduleWork(CountWork) == CHIP_NO_ERROR);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -95,7 +145,9 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test PlatformMgr::Init", TestPlatformMgr_Init),
     NL_TEST_DEF("Test PlatformMgr::StartEventLoopTask", TestPlatformMgr_StartEventLoopTask),
     NL_TEST_DEF("Test PlatformMgr::TryLockChipStack", TestPlatformMgr_TryLockChipStack),
+    NL_TEST_DEF("Test PlatformMgr::LockChipStackShared", TestPlatformMgr_LockChipStackShared),
     NL_TEST_DEF("Test PlatformMgr::AddEventHandler", TestPlatformMgr_AddEventHandler),
+    NL_TEST_DEF("Test PlatformMgr::ScheduleWorkOverflow", TestPlatformMgr_ScheduleWorkOverflow),
 
     NL_TEST_SENTINEL()
 };
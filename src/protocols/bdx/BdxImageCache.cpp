@@ -0,0 +1,189 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/BdxImageCache.h>
+
+#include <support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace bdx {
+
+CHIP_ERROR ImageCache::Init(ImageStore * store)
+{
+    VerifyOrReturnError(mStore == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(store != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mStore = store;
+    return CHIP_NO_ERROR;
+}
+
+void ImageCache::Shutdown()
+{
+    VerifyOrReturn(mStore != nullptr);
+
+    for (Image & image : mImages)
+    {
+        if (image.mRefCount > 0)
+        {
+            mStore->Close(image.mHandle);
+            image.mRefCount = 0;
+        }
+    }
+    for (Chunk & chunk : mChunks)
+    {
+        chunk.mImage = nullptr;
+    }
+    mStore = nullptr;
+}
+
+CHIP_ERROR ImageCache::OpenImage(const uint8_t * designator, uint16_t designatorLength, Image *& image)
+{
+    Image * freeImage = nullptr;
+
+    VerifyOrReturnError(mStore != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(designatorLength <= CHIP_BDX_IMAGE_CACHE_MAX_DESIGNATOR_LENGTH, CHIP_ERROR_KEY_NOT_FOUND);
+
+    for (Image & entry : mImages)
+    {
+        if (entry.mRefCount == 0)
+        {
+            freeImage = (freeImage == nullptr ? &entry : freeImage);
+        }
+        else if (entry.mDesignatorLength == designatorLength && memcmp(entry.mDesignator, designator, designatorLength) == 0)
+        {
+            VerifyOrReturnError(entry.mRefCount < UINT8_MAX, CHIP_ERROR_NO_MEMORY);
+            entry.mRefCount++;
+            image = &entry;
+            return CHIP_NO_ERROR;
+        }
+    }
+    VerifyOrReturnError(freeImage != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(mStore->Open(designator, designatorLength, freeImage->mHandle, freeImage->mSize));
+    memcpy(freeImage->mDesignator, designator, designatorLength);
+    freeImage->mDesignatorLength = designatorLength;
+    freeImage->mRefCount         = 1;
+
+    image = freeImage;
+    return CHIP_NO_ERROR;
+}
+
+void ImageCache::CloseImage(Image * image)
+{
+    VerifyOrReturn(image != nullptr && image->mRefCount > 0);
+
+    if (--image->mRefCount > 0)
+    {
+        return;
+    }
+
+    // The chunks of the image are of no use to the next image opened in its entry
+    for (Chunk & chunk : mChunks)
+    {
+        if (chunk.mImage == image)
+        {
+            chunk.mImage = nullptr;
+        }
+    }
+    mStore->Close(image->mHandle);
+    image->mHandle = nullptr;
+}
+
+ImageCache::Chunk * ImageCache::GetChunk(Image * image, uint64_t chunkOffset, CHIP_ERROR & err)
+{
+    Chunk * victim = &mChunks[0];
+
+    for (Chunk & chunk : mChunks)
+    {
+        if (chunk.mImage == image && chunk.mOffset == chunkOffset)
+        {
+            chunk.mLastUse = ++mUseCount;
+            return &chunk;
+        }
+        if (chunk.mImage == nullptr)
+        {
+            victim = &chunk;
+        }
+        else if (victim->mImage != nullptr && chunk.mLastUse - victim->mLastUse > UINT32_MAX / 2)
+        {
+            // Older than the victim, allowing for the use count wrapping around
+            victim = &chunk;
+        }
+    }
+
+    victim->mImage  = nullptr;
+    victim->mOffset = chunkOffset;
+    victim->mLength = static_cast<size_t>(chip::min<uint64_t>(CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE, image->mSize - chunkOffset));
+    err             = mStore->Read(image->mHandle, chunkOffset, victim->mData, victim->mLength);
+    if (err != CHIP_NO_ERROR)
+    {
+        return nullptr;
+    }
+    victim->mImage   = image;
+    victim->mLastUse = ++mUseCount;
+    return victim;
+}
+
+CHIP_ERROR ImageCache::Read(Image * image, uint64_t offset, uint8_t * buffer, size_t length)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrReturnError(image != nullptr && image->mRefCount > 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(offset <= image->mSize && length <= image->mSize - offset, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // A Block may span two chunks
+    while (length > 0)
+    {
+        uint64_t chunkOffset = offset - offset % CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE;
+        Chunk * chunk        = GetChunk(image, chunkOffset, err);
+        ReturnErrorOnFailure(err);
+
+        size_t offsetInChunk = static_cast<size_t>(offset - chunkOffset);
+        size_t count         = chip::min(length, chunk->mLength - offsetInChunk);
+        memcpy(buffer, chunk->mData + offsetInChunk, count);
+        buffer += count;
+        offset += count;
+        length -= count;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ImageBlockSource::Init(ImageCache * cache, ImageCache::Image * image, uint64_t endOffset)
+{
+    mCache     = cache;
+    mImage     = image;
+    mEndOffset = endOffset;
+    mEofRead   = false;
+}
+
+CHIP_ERROR ImageBlockSource::ReadBlock(uint64_t offset, uint8_t * buffer, uint16_t maxLength, uint16_t & length, bool & isEof)
+{
+    VerifyOrReturnError(mCache != nullptr && offset <= mEndOffset, CHIP_ERROR_INCORRECT_STATE);
+
+    length = static_cast<uint16_t>(chip::min<uint64_t>(maxLength, mEndOffset - offset));
+    isEof  = (offset + length == mEndOffset);
+    ReturnErrorOnFailure(mCache->Read(mImage, offset, buffer, length));
+    mEofRead = isEof;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,174 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a cache of the images sent by BDX transfers, which read them from an ImageStore in chunks shared by all
+ *      the transfers of the same image.
+ */
+
+#pragma once
+
+#include <protocols/bdx/BdxTransferSession.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The number of different images that can be sent at once.
+ */
+#ifndef CHIP_BDX_IMAGE_CACHE_MAX_IMAGES
+#define CHIP_BDX_IMAGE_CACHE_MAX_IMAGES 2
+#endif
+
+/**
+ * The longest file designator of an image, in bytes.
+ */
+#ifndef CHIP_BDX_IMAGE_CACHE_MAX_DESIGNATOR_LENGTH
+#define CHIP_BDX_IMAGE_CACHE_MAX_DESIGNATOR_LENGTH 64
+#endif
+
+/**
+ * The size of the chunks an image is read from its store in, in bytes. A chunk holds several Blocks, so that a transfer reads
+ * ahead of the Block it sends, and the transfers of the same image close behind it get their Blocks without reading the store.
+ */
+#ifndef CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE
+#define CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE 4096
+#endif
+
+/**
+ * The number of chunks held by the cache, shared by all the images. The least recently used one is read over when another is
+ * needed.
+ */
+#ifndef CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS
+#define CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS 8
+#endif
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Where the images sent by BDX transfers are read from: files, an object store... Reads are only asked for within an image.
+ */
+class ImageStore
+{
+public:
+    virtual ~ImageStore() {}
+
+    /**
+     * Open the image named by a file designator.
+     *
+     * @param designator       File designator of the image, not null-terminated
+     * @param designatorLength Length of the designator
+     * @param handle           Set to what Read() and Close() are given for the image
+     * @param size             Set to the size of the image, in bytes
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND If there is no such image
+     */
+    virtual CHIP_ERROR Open(const uint8_t * designator, uint16_t designatorLength, void *& handle, uint64_t & size) = 0;
+
+    /**
+     * Read length bytes of an image from offset.
+     */
+    virtual CHIP_ERROR Read(void * handle, uint64_t offset, uint8_t * buffer, size_t length) = 0;
+
+    virtual void Close(void * handle) = 0;
+};
+
+/**
+ * Holds the images open while they are sent, and the chunks of them read from their store. A transfer opening an image already
+ * open shares it, and the chunks read for it.
+ */
+class DLL_EXPORT ImageCache
+{
+public:
+    class Image
+    {
+    public:
+        uint64_t GetSize() const { return mSize; }
+
+    private:
+        friend class ImageCache;
+
+        uint8_t mDesignator[CHIP_BDX_IMAGE_CACHE_MAX_DESIGNATOR_LENGTH];
+        uint16_t mDesignatorLength = 0;
+        void * mHandle             = nullptr;
+        uint64_t mSize             = 0;
+        // The number of transfers of the image, 0 if the entry is free.
+        uint8_t mRefCount = 0;
+    };
+
+    CHIP_ERROR Init(ImageStore * store);
+    void Shutdown();
+
+    /**
+     * Open an image for a transfer, or share it if it is already open. Each call must be matched by a CloseImage().
+     *
+     * @retval CHIP_ERROR_NO_MEMORY If CHIP_BDX_IMAGE_CACHE_MAX_IMAGES other images are already open
+     */
+    CHIP_ERROR OpenImage(const uint8_t * designator, uint16_t designatorLength, Image *& image);
+    void CloseImage(Image * image);
+
+    /**
+     * Read length bytes of an image from offset, through the chunks of the cache.
+     */
+    CHIP_ERROR Read(Image * image, uint64_t offset, uint8_t * buffer, size_t length);
+
+private:
+    struct Chunk
+    {
+        // nullptr if the chunk holds nothing.
+        Image * mImage    = nullptr;
+        uint64_t mOffset  = 0;
+        size_t mLength    = 0;
+        uint32_t mLastUse = 0;
+        uint8_t mData[CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE];
+    };
+
+    Chunk * GetChunk(Image * image, uint64_t chunkOffset, CHIP_ERROR & err);
+
+    ImageStore * mStore = nullptr;
+    Image mImages[CHIP_BDX_IMAGE_CACHE_MAX_IMAGES];
+    Chunk mChunks[CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS];
+    uint32_t mUseCount = 0;
+};
+
+/**
+ * Sends an image of an ImageCache, up to an end offset.
+ */
+class ImageBlockSource : public TransferSession::BlockSource
+{
+public:
+    void Init(ImageCache * cache, ImageCache::Image * image, uint64_t endOffset);
+
+    CHIP_ERROR ReadBlock(uint64_t offset, uint8_t * buffer, uint16_t maxLength, uint16_t & length, bool & isEof) override;
+
+    /**
+     * Whether the last Block was read.
+     */
+    bool IsEofRead() const { return mEofRead; }
+
+private:
+    ImageCache * mCache        = nullptr;
+    ImageCache::Image * mImage = nullptr;
+    uint64_t mEndOffset        = 0;
+    bool mEofRead              = false;
+};
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,333 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements an object for a BDX responder (server) sending the images of an ImageStore.
+ */
+
+#include <protocols/bdx/BdxImageServer.h>
+
+#include <messaging/Flags.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace bdx {
+
+namespace {
+
+uint64_t GetNowMs()
+{
+    return System::Layer::GetClock_MonotonicMS();
+}
+
+// The largest Block fitting in a message to the peer of the exchange, after the Block counter.
+uint16_t GetMaxBlockSize(const Messaging::ExchangeContext * ec)
+{
+    const uint16_t maxPayloadLength = ec->GetMaxPayloadLength();
+    return chip::min(TransferSession::kMaxBlockSize, static_cast<uint16_t>(maxPayloadLength - sizeof(uint32_t)));
+}
+
+} // namespace
+
+CHIP_ERROR ImageServer::Init(Messaging::ExchangeManager * exchangeMgr, System::Layer * systemLayer, ImageStore * store)
+{
+    VerifyOrReturnError(mExchangeMgr == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(exchangeMgr != nullptr && systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(mCache.Init(store));
+    mExchangeMgr = exchangeMgr;
+    mSystemLayer = systemLayer;
+
+    // Register to receive unsolicited ReceiveInit messages from the exchange manager.
+    return mExchangeMgr->RegisterUnsolicitedMessageHandlerForType(MessageType::ReceiveInit, this);
+}
+
+void ImageServer::Shutdown()
+{
+    VerifyOrReturn(mExchangeMgr != nullptr);
+
+    mExchangeMgr->UnregisterUnsolicitedMessageHandlerForType(MessageType::ReceiveInit);
+    for (Transfer & transfer : mTransfers)
+    {
+        transfer.End();
+    }
+    if (mPollTimerRunning)
+    {
+        mSystemLayer->CancelTimer(OnPollTimer, this);
+        mPollTimerRunning = false;
+    }
+    mCache.Shutdown();
+    mExchangeMgr = nullptr;
+    mSystemLayer = nullptr;
+}
+
+size_t ImageServer::GetActiveTransferCount() const
+{
+    size_t count = 0;
+    for (const Transfer & transfer : mTransfers)
+    {
+        count += transfer.IsActive() ? 1 : 0;
+    }
+    return count;
+}
+
+void ImageServer::OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader,
+                                    const PayloadHeader & payloadHeader, System::PacketBufferHandle payload)
+{
+    for (Transfer & transfer : mTransfers)
+    {
+        if (!transfer.IsActive())
+        {
+            if (transfer.Start(this, ec) == CHIP_NO_ERROR)
+            {
+                StartPollTimer();
+                transfer.OnMessageReceived(ec, packetHeader, payloadHeader, std::move(payload));
+                return;
+            }
+            break;
+        }
+    }
+
+    // The node asks again once a transfer is done
+    ChipLogProgress(BDX, "Dropping a ReceiveInit: %u transfers already running", CHIP_BDX_IMAGE_SERVER_MAX_TRANSFERS);
+    ec->Close();
+}
+
+void ImageServer::StartPollTimer()
+{
+    if (!mPollTimerRunning && mSystemLayer->StartTimer(CHIP_BDX_IMAGE_SERVER_POLL_INTERVAL_MS, OnPollTimer, this) == CHIP_NO_ERROR)
+    {
+        mPollTimerRunning = true;
+    }
+}
+
+void ImageServer::OnPollTimer(System::Layer * systemLayer, void * appState, System::Error error)
+{
+    ImageServer * server = static_cast<ImageServer *>(appState);
+
+    server->mPollTimerRunning = false;
+    for (Transfer & transfer : server->mTransfers)
+    {
+        if (transfer.IsActive())
+        {
+            transfer.Poll();
+        }
+    }
+    if (server->GetActiveTransferCount() > 0)
+    {
+        server->StartPollTimer();
+    }
+}
+
+CHIP_ERROR ImageServer::Transfer::Start(ImageServer * server, Messaging::ExchangeContext * ec)
+{
+    const BitFlags<TransferControlFlags> controlOpts(TransferControlFlags::kSenderDrive, TransferControlFlags::kReceiverDrive);
+
+    ReturnErrorOnFailure(
+        mSession.WaitForTransfer(TransferRole::kSender, controlOpts, GetMaxBlockSize(ec), CHIP_BDX_IMAGE_SERVER_TIMEOUT_MS));
+    mServer       = server;
+    mExchangeCtx  = ec;
+    mStartSending = false;
+    mEndWhenSent  = false;
+    ec->SetDelegate(this);
+    // The blocks of an image are sent as link capacity is left over by the other exchanges.
+    ec->SetTrafficClass(Transport::TrafficClass::kBulk);
+    return CHIP_NO_ERROR;
+}
+
+void ImageServer::Transfer::End()
+{
+    VerifyOrReturn(IsActive());
+
+    Messaging::ExchangeContext * ec = mExchangeCtx;
+
+    // Closing the exchange calls OnExchangeClosing, which has nothing left to end
+    mExchangeCtx = nullptr;
+    if (ec != nullptr)
+    {
+        ec->Close();
+    }
+    if (mImage != nullptr)
+    {
+        mServer->mCache.CloseImage(mImage);
+        mImage = nullptr;
+    }
+    mSession.Reset();
+    mServer = nullptr;
+}
+
+void ImageServer::Transfer::OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader,
+                                              const PayloadHeader & payloadHeader, System::PacketBufferHandle payload)
+{
+    VerifyOrReturn(IsActive() && ec == mExchangeCtx);
+
+    // The TransferSession reads the message type from the PayloadHeader in front of the payload
+    CHIP_ERROR err = payloadHeader.EncodeBeforeData(payload);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mSession.HandleMessageReceived(std::move(payload), GetNowMs());
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "Failed to handle a message of a transfer: %s", ErrorStr(err));
+    }
+    ProcessOutput();
+}
+
+void ImageServer::Transfer::OnExchangeClosing(Messaging::ExchangeContext * ec)
+{
+    if (ec == mExchangeCtx)
+    {
+        mExchangeCtx = nullptr;
+        End();
+    }
+}
+
+void ImageServer::Transfer::ProcessOutput()
+{
+    TransferSession::OutputEvent event;
+
+    while (IsActive())
+    {
+        mSession.PollOutput(event, GetNowMs());
+
+        switch (event.EventType)
+        {
+        case TransferSession::OutputEventType::kNone:
+            if (mEndWhenSent)
+            {
+                End();
+            }
+            else if (mStartSending)
+            {
+                mStartSending = false;
+                SendBlock();
+                break;
+            }
+            return;
+        case TransferSession::OutputEventType::kMsgToSend:
+            if (SendMessage(std::move(event.MsgData)) != CHIP_NO_ERROR)
+            {
+                End();
+            }
+            break;
+        case TransferSession::OutputEventType::kInitReceived:
+            HandleTransferInit(event.transferInitData);
+            break;
+        case TransferSession::OutputEventType::kQueryReceived:
+        case TransferSession::OutputEventType::kAckReceived:
+        case TransferSession::OutputEventType::kWindowAvailable:
+            // Receiver Drive asks for each Block, Sender Drive sends the next one as soon as the window has room for it
+            if (event.EventType == TransferSession::OutputEventType::kQueryReceived ||
+                mSession.GetControlMode() == TransferControlFlags::kSenderDrive)
+            {
+                SendBlock();
+            }
+            break;
+        case TransferSession::OutputEventType::kAckEOFReceived:
+            ChipLogProgress(BDX, "Transfer done");
+            End();
+            break;
+        case TransferSession::OutputEventType::kStatusReceived:
+            ChipLogError(BDX, "Transfer ended by its receiver: status 0x%04x", static_cast<uint16_t>(event.statusData.statusCode));
+            End();
+            break;
+        case TransferSession::OutputEventType::kInternalError:
+            ChipLogError(BDX, "Transfer failed: status 0x%04x", static_cast<uint16_t>(event.statusData.statusCode));
+            End();
+            break;
+        case TransferSession::OutputEventType::kTransferTimeout:
+            ChipLogError(BDX, "Transfer timed out");
+            End();
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void ImageServer::Transfer::HandleTransferInit(const TransferSession::TransferInitData & initData)
+{
+    CHIP_ERROR err = mServer->mCache.OpenImage(initData.FileDesignator, initData.FileDesLength, mImage);
+    TransferSession::TransferAcceptData acceptData;
+    uint64_t length;
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "Can't open the image of a transfer: %s", ErrorStr(err));
+        mImage = nullptr;
+        ExitNow(mSession.RejectTransfer(err == CHIP_ERROR_KEY_NOT_FOUND ? StatusCode::kFileDesignatorUnknown
+                                                                        : StatusCode::kTransferFailedUnknownError));
+    }
+
+    // A transfer cut short is resumed from the offset its receiver got to
+    VerifyOrExit(initData.StartOffset <= mImage->GetSize(), mSession.RejectTransfer(StatusCode::kStartOffsetNotSupported));
+    length = mImage->GetSize() - initData.StartOffset;
+    if (initData.Length > 0 && initData.Length < length)
+    {
+        length = initData.Length;
+    }
+    mBlockSource.Init(&mServer->mCache, mImage, initData.StartOffset + length);
+
+    acceptData.ControlMode  = mSession.GetControlMode();
+    acceptData.MaxBlockSize = chip::min(initData.MaxBlockSize, GetMaxBlockSize(mExchangeCtx));
+    acceptData.StartOffset  = initData.StartOffset;
+    acceptData.Length       = length;
+    if (acceptData.ControlMode == TransferControlFlags::kSenderDrive)
+    {
+        acceptData.WindowSize = chip::min<uint8_t>(initData.WindowSize, CHIP_BDX_IMAGE_SERVER_MAX_WINDOW_SIZE);
+    }
+
+    err = mSession.AcceptTransfer(acceptData);
+    VerifyOrExit(err == CHIP_NO_ERROR, ChipLogError(BDX, "Can't accept a transfer: %s", ErrorStr(err)));
+    mStartSending = (acceptData.ControlMode == TransferControlFlags::kSenderDrive);
+    return;
+
+exit:
+    mEndWhenSent = true;
+}
+
+void ImageServer::Transfer::SendBlock()
+{
+    // A windowed transfer may still get the BlockAck of a Block sent before its BlockEOF
+    VerifyOrReturn(!mBlockSource.IsEofRead());
+
+    CHIP_ERROR err = mSession.PrepareBlock(mBlockSource);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "Can't send a Block: %s", ErrorStr(err));
+        mSession.AbortTransfer(StatusCode::kTransferFailedUnknownError);
+        mEndWhenSent = true;
+    }
+}
+
+CHIP_ERROR ImageServer::Transfer::SendMessage(System::PacketBufferHandle msg)
+{
+    PayloadHeader payloadHeader;
+
+    // The TransferSession puts a PayloadHeader in front of the messages, which the exchange writes again
+    ReturnErrorOnFailure(payloadHeader.DecodeAndConsume(msg));
+    VerifyOrReturnError(mExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mExchangeCtx->SendMessage(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType(), std::move(msg),
+                                     Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+}
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an object for a BDX responder (server) sending the images of an ImageStore, such as the software
+ *      images of an OTA Provider, to the nodes asking for them with a ReceiveInit.
+ */
+
+#pragma once
+
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <protocols/bdx/BdxImageCache.h>
+#include <protocols/bdx/BdxTransferSession.h>
+#include <support/DLLUtil.h>
+#include <system/SystemLayer.h>
+
+/**
+ * The number of transfers an image server can run at once. A ReceiveInit coming while they are all running is dropped, and
+ * its node asks again later.
+ */
+#ifndef CHIP_BDX_IMAGE_SERVER_MAX_TRANSFERS
+#define CHIP_BDX_IMAGE_SERVER_MAX_TRANSFERS 4
+#endif
+
+/**
+ * The largest number of Blocks a Sender Drive transfer sends ahead of their BlockAcks, if its receiver proposes as many.
+ */
+#ifndef CHIP_BDX_IMAGE_SERVER_MAX_WINDOW_SIZE
+#define CHIP_BDX_IMAGE_SERVER_MAX_WINDOW_SIZE 4
+#endif
+
+/**
+ * How long a transfer waits for a message of its receiver before it is ended, in milliseconds.
+ */
+#ifndef CHIP_BDX_IMAGE_SERVER_TIMEOUT_MS
+#define CHIP_BDX_IMAGE_SERVER_TIMEOUT_MS 30000
+#endif
+
+/**
+ * The period of the timer checking the transfers for a timeout, in milliseconds.
+ */
+#ifndef CHIP_BDX_IMAGE_SERVER_POLL_INTERVAL_MS
+#define CHIP_BDX_IMAGE_SERVER_POLL_INTERVAL_MS 1000
+#endif
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Sends images to the nodes asking for them with a ReceiveInit, in either Sender Drive, windowed if the receiver proposes a
+ * window, or Receiver Drive. The transfers of the same image share the chunks of it read from its store. A node whose transfer
+ * was cut short resumes it by asking again with the offset it stopped at as StartOffset.
+ */
+class DLL_EXPORT ImageServer : public Messaging::ExchangeDelegate
+{
+public:
+    /**
+     *  Initialize the ImageServer object. Within the lifetime
+     *  of this instance, this method is invoked once after object
+     *  construction until a call to Shutdown is made to terminate the
+     *  instance.
+     *
+     *  @param[in]    exchangeMgr    A pointer to the ExchangeManager object.
+     *  @param[in]    systemLayer    The layer running the timeout timer of the transfers.
+     *  @param[in]    store          Where the images are read from, which must outlive the server.
+     *
+     *  @retval #CHIP_ERROR_INCORRECT_STATE If the server is already initialized.
+     *  @retval #CHIP_NO_ERROR On success.
+     */
+    CHIP_ERROR Init(Messaging::ExchangeManager * exchangeMgr, System::Layer * systemLayer, ImageStore * store);
+
+    /**
+     *  Shutdown the ImageServer, ending the transfers still running.
+     */
+    void Shutdown();
+
+    size_t GetActiveTransferCount() const;
+
+private:
+    class Transfer : public Messaging::ExchangeDelegate
+    {
+    public:
+        bool IsActive() const { return mServer != nullptr; }
+
+        CHIP_ERROR Start(ImageServer * server, Messaging::ExchangeContext * ec);
+        void End();
+        void Poll() { ProcessOutput(); }
+
+        void OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader,
+                               const PayloadHeader & payloadHeader, System::PacketBufferHandle payload) override;
+        void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
+        void OnExchangeClosing(Messaging::ExchangeContext * ec) override;
+
+    private:
+        void ProcessOutput();
+        void HandleTransferInit(const TransferSession::TransferInitData & initData);
+        void SendBlock();
+        CHIP_ERROR SendMessage(System::PacketBufferHandle msg);
+
+        ImageServer * mServer                     = nullptr;
+        Messaging::ExchangeContext * mExchangeCtx = nullptr;
+        TransferSession mSession;
+        ImageCache::Image * mImage = nullptr;
+        ImageBlockSource mBlockSource;
+        // Whether the first Block of a Sender Drive transfer is to be sent once its ReceiveAccept is.
+        bool mStartSending = false;
+        // Whether the transfer ends once the StatusReport rejecting it is sent.
+        bool mEndWhenSent = false;
+    };
+
+    void OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle payload) override;
+    void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
+
+    static void OnPollTimer(System::Layer * systemLayer, void * appState, System::Error error);
+    void StartPollTimer();
+
+    Messaging::ExchangeManager * mExchangeMgr = nullptr;
+    System::Layer * mSystemLayer              = nullptr;
+    bool mPollTimerRunning                    = false;
+    ImageCache mCache;
+    Transfer mTransfers[CHIP_BDX_IMAGE_SERVER_MAX_TRANSFERS];
+};
+
+} // namespace bdx
+} // namespace chip
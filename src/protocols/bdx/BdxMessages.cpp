@@ -50,10 +50,9 @@ BufferWriter & TransferInit::WriteToBuffer(BufferWriter & aBuffer) const
     rangeCtlFlags.Set(RangeControlFlags::kDefLen, MaxLength > 0);
     rangeCtlFlags.Set(RangeControlFlags::kStartOffset, StartOffset > 0);
     rangeCtlFlags.Set(RangeControlFlags::kWiderange, widerange);
+    rangeCtlFlags.Set(RangeControlFlags::kWindowSize, WindowSize > 0);
 
-    aBuffer.Put(proposedTransferCtl.Raw());
-    aBuffer.Put(rangeCtlFlags.Raw());
-    aBuffer.Put16(MaxBlockSize);
+    aBuffer.PutFixed(proposedTransferCtl.Raw(), rangeCtlFlags.Raw(), MaxBlockSize);
 
     if (StartOffset > 0)
     {
@@ -79,6 +78,11 @@ BufferWriter & TransferInit::WriteToBuffer(BufferWriter & aBuffer) const
         }
     }
 
+    if (WindowSize > 0)
+    {
+        aBuffer.Put(WindowSize);
+    }
+
     aBuffer.Put16(FileDesLength);
     if (FileDesignator != nullptr)
     {
@@ -101,7 +105,7 @@ CHIP_ERROR TransferInit::Parse(System::PacketBufferHandle aBuffer)
     Reader bufReader(bufStart, aBuffer->DataLength());
     BitFlags<RangeControlFlags> rangeCtlFlags;
 
-    SuccessOrExit(bufReader.Read8(&proposedTransferCtl).Read8(rangeCtlFlags.RawStorage()).Read16(&MaxBlockSize).StatusCode());
+    SuccessOrExit(bufReader.ReadFixed(&proposedTransferCtl, rangeCtlFlags.RawStorage(), &MaxBlockSize).StatusCode());
 
     Version = proposedTransferCtl & kVersionMask;
     TransferCtlOptions.SetRaw(static_cast<uint8_t>(proposedTransferCtl & ~kVersionMask));
@@ -134,6 +138,12 @@ CHIP_ERROR TransferInit::Parse(System::PacketBufferHandle aBuffer)
         }
     }
 
+    WindowSize = 0;
+    if (rangeCtlFlags.Has(RangeControlFlags::kWindowSize))
+    {
+        SuccessOrExit(bufReader.Read8(&WindowSize).StatusCode());
+    }
+
     SuccessOrExit(bufReader.Read16(&FileDesLength).StatusCode());
 
     VerifyOrExit(bufReader.HasAtLeast(FileDesLength), err = CHIP_ERROR_MESSAGE_INCOMPLETE);
@@ -187,7 +197,7 @@ bool TransferInit::operator==(const TransferInit & another) const
 
     return ((Version == another.Version) && (TransferCtlOptions == another.TransferCtlOptions) &&
             (StartOffset == another.StartOffset) && (MaxLength == another.MaxLength) && (MaxBlockSize == another.MaxBlockSize) &&
-            fileDesMatches && metadataMatches);
+            (WindowSize == another.WindowSize) && fileDesMatches && metadataMatches);
 }
 
 // WARNING: this function should never return early, since MessageSize() relies on it to calculate
@@ -196,8 +206,7 @@ Encoding::LittleEndian::BufferWriter & SendAccept::WriteToBuffer(Encoding::Littl
 {
     const BitFlags<TransferControlFlags> transferCtl(Version & kVersionMask, TransferCtlFlags);
 
-    aBuffer.Put(transferCtl.Raw());
-    aBuffer.Put16(MaxBlockSize);
+    aBuffer.PutFixed(transferCtl.Raw(), MaxBlockSize);
 
     if (Metadata != nullptr)
     {
@@ -213,7 +222,7 @@ CHIP_ERROR SendAccept::Parse(System::PacketBufferHandle aBuffer)
     uint8_t * bufStart  = aBuffer->Start();
     Reader bufReader(bufStart, aBuffer->DataLength());
 
-    SuccessOrExit(bufReader.Read8(&transferCtl).Read16(&MaxBlockSize).StatusCode());
+    SuccessOrExit(bufReader.ReadFixed(&transferCtl, &MaxBlockSize).StatusCode());
 
     Version = transferCtl & kVersionMask;
 
@@ -274,10 +283,9 @@ Encoding::LittleEndian::BufferWriter & ReceiveAccept::WriteToBuffer(Encoding::Li
     rangeCtlFlags.Set(RangeControlFlags::kDefLen, Length > 0);
     rangeCtlFlags.Set(RangeControlFlags::kStartOffset, StartOffset > 0);
     rangeCtlFlags.Set(RangeControlFlags::kWiderange, widerange);
+    rangeCtlFlags.Set(RangeControlFlags::kWindowSize, WindowSize > 0);
 
-    aBuffer.Put(transferCtlFlags.Raw());
-    aBuffer.Put(rangeCtlFlags.Raw());
-    aBuffer.Put16(MaxBlockSize);
+    aBuffer.PutFixed(transferCtlFlags.Raw(), rangeCtlFlags.Raw(), MaxBlockSize);
 
     if (StartOffset > 0)
     {
@@ -303,6 +311,11 @@ Encoding::LittleEndian::BufferWriter & ReceiveAccept::WriteToBuffer(Encoding::Li
         }
     }
 
+    if (WindowSize > 0)
+    {
+        aBuffer.Put(WindowSize);
+    }
+
     if (Metadata != nullptr)
     {
         aBuffer.Put(Metadata, static_cast<size_t>(MetadataLength));
@@ -319,7 +332,7 @@ CHIP_ERROR ReceiveAccept::Parse(System::PacketBufferHandle aBuffer)
     Reader bufReader(bufStart, aBuffer->DataLength());
     BitFlags<RangeControlFlags> rangeCtlFlags;
 
-    SuccessOrExit(bufReader.Read8(&transferCtl).Read8(rangeCtlFlags.RawStorage()).Read16(&MaxBlockSize).StatusCode());
+    SuccessOrExit(bufReader.ReadFixed(&transferCtl, rangeCtlFlags.RawStorage(), &MaxBlockSize).StatusCode());
 
     Version = transferCtl & kVersionMask;
 
@@ -354,6 +367,12 @@ CHIP_ERROR ReceiveAccept::Parse(System::PacketBufferHandle aBuffer)
         }
     }
 
+    WindowSize = 0;
+    if (rangeCtlFlags.Has(RangeControlFlags::kWindowSize))
+    {
+        SuccessOrExit(bufReader.Read8(&WindowSize).StatusCode());
+    }
+
     // Rest of message is metadata (could be empty)
     Metadata       = nullptr;
     MetadataLength = 0;
@@ -395,7 +414,7 @@ bool ReceiveAccept::operator==(const ReceiveAccept & another) const
 
     return ((Version == another.Version) && (TransferCtlFlags == another.TransferCtlFlags) &&
             (StartOffset == another.StartOffset) && (MaxBlockSize == another.MaxBlockSize) && (Length == another.Length) &&
-            metadataMatches);
+            (WindowSize == another.WindowSize) && metadataMatches);
 }
 
 // WARNING: this function should never return early, since MessageSize() relies on it to calculate
@@ -78,6 +78,9 @@ enum class RangeControlFlags : uint8_t
     kDefLen      = (1U),
     kStartOffset = (1U << 1),
     kWiderange   = (1U << 4),
+    // Extension, not part of the BDX specification: a window size field follows the length fields. Only present when a windowed
+    // Sender Drive transfer is proposed or accepted.
+    kWindowSize  = (1U << 5),
 };
 
 /**
@@ -143,6 +146,7 @@ struct TransferInit : public BdxMessage
     uint16_t MaxBlockSize = 0; ///< Proposed max block size to use in transfer
     uint64_t StartOffset  = 0; ///< Proposed start offset of data. 0 for no offset
     uint64_t MaxLength    = 0; ///< Proposed max length of data in transfer, 0 for indefinite
+    uint8_t WindowSize    = 0; ///< Proposed max number of unacknowledged Blocks in Sender Drive, 0 for none (optional)
 
     // File designator (required) and additional metadata (optional, TLV format)
     // WARNING: there is no guarantee at any point that these pointers will point to valid memory. The Buffer field should be used
@@ -213,6 +217,7 @@ struct ReceiveAccept : public BdxMessage
     uint16_t MaxBlockSize = 0; ///< Chosen max block size to use in transfer
     uint64_t StartOffset  = 0; ///< Chosen start offset of data. 0 for no offset.
     uint64_t Length       = 0; ///< Length of transfer. 0 if length is indefinite.
+    uint8_t WindowSize    = 0; ///< Chosen max number of unacknowledged Blocks in Sender Drive, 0 for none (optional)
 
     // Additional metadata (optional, TLV format)
     // WARNING: there is no guarantee at any point that this pointer will point to valid memory. The Buffer field should be used to
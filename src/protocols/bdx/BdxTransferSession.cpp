@@ -6,6 +6,7 @@
 
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <core/CHIPEncoding.h>
 #include <protocols/Protocols.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <protocols/secure_channel/Constants.h>
@@ -66,6 +67,8 @@ inline CHIP_ERROR AttachHeader(MessageType msgType, ::chip::System::PacketBuffer
 namespace chip {
 namespace bdx {
 
+constexpr uint16_t TransferSession::kMaxBlockSize;
+
 TransferSession::TransferSession()
 {
     mSuppportedXferOpts.ClearAll();
@@ -92,7 +95,8 @@ void TransferSession::PollOutput(OutputEvent & event, uint64_t curTimeMs)
     switch (mPendingOutput)
     {
     case OutputEventType::kNone:
-        event = OutputEvent(OutputEventType::kNone);
+        event            = OutputEvent(mWindowAvailable ? OutputEventType::kWindowAvailable : OutputEventType::kNone);
+        mWindowAvailable = false;
         break;
     case OutputEventType::kInternalError:
         event = OutputEvent::StatusReportEvent(OutputEventType::kInternalError, mStatusReportData);
@@ -152,9 +156,10 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
 
     // Set transfer parameters. They may be overridden later by an Accept message
     mSuppportedXferOpts    = initData.TransferCtlFlags;
-    mMaxSupportedBlockSize = initData.MaxBlockSize;
+    mMaxSupportedBlockSize = ::chip::min(initData.MaxBlockSize, kMaxBlockSize);
     mStartOffset           = initData.StartOffset;
     mTransferLength        = initData.Length;
+    mWindowSize            = (mRole == TransferRole::kReceiver) ? initData.WindowSize : 0; // SendAccept cannot accept one
 
     // Prepare TransferInit message
     initMsg.TransferCtlOptions = initData.TransferCtlFlags;
@@ -162,6 +167,7 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
     initMsg.MaxBlockSize       = mMaxSupportedBlockSize;
     initMsg.StartOffset        = mStartOffset;
     initMsg.MaxLength          = mTransferLength;
+    initMsg.WindowSize         = mWindowSize;
     initMsg.FileDesignator     = initData.FileDesignator;
     initMsg.FileDesLength      = initData.FileDesLength;
     initMsg.Metadata           = initData.Metadata;
@@ -194,7 +200,7 @@ CHIP_ERROR TransferSession::WaitForTransfer(TransferRole role, BitFlags<Transfer
     mRole                  = role;
     mTimeoutMs             = timeoutMs;
     mSuppportedXferOpts    = xferControlOpts;
-    mMaxSupportedBlockSize = maxBlockSize;
+    mMaxSupportedBlockSize = ::chip::min(maxBlockSize, kMaxBlockSize);
 
     mState = TransferState::kAwaitingInitMsg;
 
@@ -214,7 +220,15 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     // Don't allow a Control method that wasn't supported by the initiator
     // MaxBlockSize can't be larger than the proposed value
     VerifyOrExit(proposedControlOpts.Has(acceptData.ControlMode), err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, err = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(acceptData.MaxBlockSize <= ::chip::min(mTransferRequestData.MaxBlockSize, kMaxBlockSize),
+                 err = CHIP_ERROR_INVALID_ARGUMENT);
+
+    // A window can only be accepted in a ReceiveAccept, for a Sender Drive transfer
+    if (mRole == TransferRole::kSender && acceptData.WindowSize > 0)
+    {
+        VerifyOrExit(acceptData.ControlMode == TransferControlFlags::kSenderDrive, err = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrExit(acceptData.WindowSize <= mTransferRequestData.WindowSize, err = CHIP_ERROR_INVALID_ARGUMENT);
+    }
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
@@ -222,6 +236,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     {
         mStartOffset    = acceptData.StartOffset;
         mTransferLength = acceptData.Length;
+        mWindowSize     = acceptData.WindowSize;
 
         ReceiveAccept acceptMsg;
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
@@ -229,6 +244,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
         acceptMsg.Length         = acceptData.Length;
+        acceptMsg.WindowSize     = acceptData.WindowSize;
         acceptMsg.Metadata       = acceptData.Metadata;
         acceptMsg.MetadataLength = acceptData.MetadataLength;
 
@@ -299,12 +315,9 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     DataBlock blockMsg;
-    MessageType msgType;
 
-    VerifyOrExit(mState == TransferState::kTransferInProgress, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mRole == TransferRole::kSender, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mPendingOutput == OutputEventType::kNone, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(!mAwaitingResponse, err = CHIP_ERROR_INCORRECT_STATE);
+    err = VerifyCanPrepareBlock();
+    SuccessOrExit(err);
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrExit((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), err = CHIP_ERROR_INVALID_ARGUMENT);
@@ -316,19 +329,36 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     err = WriteToPacketBuffer(blockMsg, mPendingMsgHandle);
     SuccessOrExit(err);
 
-    msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
-    err     = AttachHeader(msgType, mPendingMsgHandle);
+    err = FinishPreparingBlock(inData.Length, inData.IsEof);
+
+exit:
+    return err;
+}
+
+CHIP_ERROR TransferSession::PrepareBlock(BlockSource & source)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferHandle msgBuf;
+    uint16_t length = 0;
+    bool isEof      = false;
+
+    err = VerifyCanPrepareBlock();
     SuccessOrExit(err);
 
-    mPendingOutput = OutputEventType::kMsgToSend;
+    // Let the source write the data right after the Block counter, instead of copying it from a caller buffer
+    msgBuf = MessagePacketBuffer::New(sizeof(uint32_t) + mTransferMaxBlockSize);
+    VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
-    if (msgType == MessageType::BlockEOF)
-    {
-        mState = TransferState::kAwaitingEOFAck;
-    }
+    err = source.ReadBlock(mStartOffset + mNumBytesProcessed, msgBuf->Start() + sizeof(uint32_t), mTransferMaxBlockSize, length,
+                           isEof);
+    SuccessOrExit(err);
+    VerifyOrExit(length <= mTransferMaxBlockSize, err = CHIP_ERROR_INVALID_ARGUMENT);
 
-    mAwaitingResponse = true;
-    mLastBlockNum     = mNextBlockNum++;
+    Encoding::LittleEndian::Put32(msgBuf->Start(), mNextBlockNum);
+    msgBuf->SetDataLength(static_cast<uint16_t>(sizeof(uint32_t) + length));
+    mPendingMsgHandle = std::move(msgBuf);
+
+    err = FinishPreparingBlock(length, isEof);
 
 exit:
     return err;
@@ -376,6 +406,19 @@ exit:
     return err;
 }
 
+CHIP_ERROR TransferSession::RejectTransfer(StatusCode reason)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(mState == TransferState::kNegotiateTransferParams, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mPendingOutput == OutputEventType::kNone, err = CHIP_ERROR_INCORRECT_STATE);
+
+    PrepareStatusReport(reason);
+
+exit:
+    return err;
+}
+
 CHIP_ERROR TransferSession::AbortTransfer(StatusCode reason)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -400,6 +443,7 @@ void TransferSession::Reset()
     mStartOffset           = 0;
     mTransferLength        = 0;
     mTransferMaxBlockSize  = 0;
+    mWindowSize            = 0;
 
     mPendingMsgHandle = nullptr;
 
@@ -408,6 +452,8 @@ void TransferSession::Reset()
     mNextBlockNum      = 0;
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
+    mNumUnackedBlocks  = 0;
+    mWindowAvailable   = false;
 
     mTimeoutMs              = 0;
     mTimeoutStartTimeMs     = 0;
@@ -548,6 +594,7 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     mTransferRequestData.MaxBlockSize     = transferInit.MaxBlockSize;
     mTransferRequestData.StartOffset      = transferInit.StartOffset;
     mTransferRequestData.Length           = transferInit.MaxLength;
+    mTransferRequestData.WindowSize       = transferInit.WindowSize;
     mTransferRequestData.FileDesignator   = transferInit.FileDesignator;
     mTransferRequestData.FileDesLength    = transferInit.FileDesLength;
     mTransferRequestData.Metadata         = transferInit.Metadata;
@@ -577,9 +624,17 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     err = VerifyProposedMode(rcvAcceptMsg.TransferCtlFlags);
     SuccessOrExit(err);
 
+    // A window can only be chosen for a Sender Drive transfer, and no larger than proposed
+    if (rcvAcceptMsg.WindowSize > 0)
+    {
+        VerifyOrExit(mControlMode == TransferControlFlags::kSenderDrive, PrepareStatusReport(StatusCode::kBadMessageContents));
+        VerifyOrExit(rcvAcceptMsg.WindowSize <= mWindowSize, PrepareStatusReport(StatusCode::kBadMessageContents));
+    }
+
     mTransferMaxBlockSize = rcvAcceptMsg.MaxBlockSize;
     mStartOffset          = rcvAcceptMsg.StartOffset;
     mTransferLength       = rcvAcceptMsg.Length;
+    mWindowSize           = rcvAcceptMsg.WindowSize;
 
     // Note: if VerifyProposedMode() returned with no error, then mControlMode must match the proposed mode in the ReceiveAccept
     // message
@@ -587,6 +642,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mTransferAcceptData.MaxBlockSize   = rcvAcceptMsg.MaxBlockSize;
     mTransferAcceptData.StartOffset    = rcvAcceptMsg.StartOffset;
     mTransferAcceptData.Length         = rcvAcceptMsg.Length;
+    mTransferAcceptData.WindowSize     = rcvAcceptMsg.WindowSize;
     mTransferAcceptData.Metadata       = rcvAcceptMsg.Metadata;
     mTransferAcceptData.MetadataLength = rcvAcceptMsg.MetadataLength;
 
@@ -690,7 +746,15 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
 
-    mAwaitingResponse = false;
+    // In a windowed transfer, the next Block may arrive before this one is acknowledged
+    if (IsWindowed())
+    {
+        mLastQueryNum = blockMsg.BlockCounter + 1;
+    }
+    else
+    {
+        mAwaitingResponse = false;
+    }
 
 exit:
     return;
@@ -734,18 +798,37 @@ void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
     BlockAck ackMsg;
 
     VerifyOrExit(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrExit(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrExit((mState == TransferState::kTransferInProgress) || (IsWindowed() && mState == TransferState::kAwaitingEOFAck),
+                 PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrExit(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     err = ackMsg.Parse(std::move(msgData));
     VerifyOrExit(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
-    VerifyOrExit(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
-    mPendingOutput = OutputEventType::kAckReceived;
+    if (IsWindowed())
+    {
+        // Acknowledges every Block up to BlockCounter, which must be one of the unacknowledged ones
+        VerifyOrExit(mLastBlockNum - ackMsg.BlockCounter < mNumUnackedBlocks, PrepareStatusReport(StatusCode::kBadBlockCounter));
+        mNumUnackedBlocks = mLastBlockNum - ackMsg.BlockCounter;
 
-    // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
-    // In this case, the Sender should wait to receive a BlockQuery next.
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+        // Blocks sent before the BlockEOF may still be acknowledged, only the BlockAckEOF is reported then
+        if (mState == TransferState::kTransferInProgress)
+        {
+            mPendingOutput    = OutputEventType::kAckReceived;
+            mWindowAvailable  = false;
+            mAwaitingResponse = (mNumUnackedBlocks > 0);
+        }
+    }
+    else
+    {
+        VerifyOrExit(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+        mPendingOutput = OutputEventType::kAckReceived;
+
+        // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
+        // In this case, the Sender should wait to receive a BlockQuery next.
+        mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    }
 
 exit:
     return;
@@ -767,6 +850,7 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
     mPendingOutput = OutputEventType::kAckEOFReceived;
 
     mAwaitingResponse = false;
+    mNumUnackedBlocks = 0;
 
     mState = TransferState::kTransferDone;
 
@@ -872,6 +956,48 @@ exit:
     mAwaitingResponse = false; // Prevent triggering timeout
 }
 
+CHIP_ERROR TransferSession::VerifyCanPrepareBlock()
+{
+    VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
+    if (IsWindowed())
+    {
+        VerifyOrReturnError(mNumUnackedBlocks < mWindowSize, CHIP_ERROR_INCORRECT_STATE);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TransferSession::FinishPreparingBlock(uint16_t length, bool isEof)
+{
+    MessageType msgType = isEof ? MessageType::BlockEOF : MessageType::Block;
+
+    ReturnErrorOnFailure(AttachHeader(msgType, mPendingMsgHandle));
+
+    mPendingOutput = OutputEventType::kMsgToSend;
+
+    if (msgType == MessageType::BlockEOF)
+    {
+        mState = TransferState::kAwaitingEOFAck;
+    }
+
+    mAwaitingResponse = true;
+    mLastBlockNum     = mNextBlockNum++;
+    mNumBytesProcessed += length;
+
+    if (IsWindowed())
+    {
+        mNumUnackedBlocks++;
+        mWindowAvailable = (mState == TransferState::kTransferInProgress) && (mNumUnackedBlocks < mWindowSize);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 bool TransferSession::IsTransferLengthDefinite()
 {
     return (mTransferLength > 0);
@@ -24,6 +24,14 @@ enum class TransferRole : uint8_t
 class DLL_EXPORT TransferSession
 {
 public:
+    /**
+     * Largest Block size fitting in a message buffer, which larger max Block sizes given to StartTransfer() and
+     * WaitForTransfer() are reduced to. Over TCP, larger Blocks only need larger packet buffers: see
+     * CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX.
+     */
+    static constexpr uint16_t kMaxBlockSize =
+        static_cast<uint16_t>(System::PacketBuffer::kMaxSize - kMaxTagLen - sizeof(uint32_t) /* Block counter */);
+
     enum class OutputEventType : uint16_t
     {
         kNone = 0,
@@ -36,7 +44,8 @@ public:
         kAckEOFReceived,
         kStatusReceived,
         kInternalError,
-        kTransferTimeout
+        kTransferTimeout,
+        kWindowAvailable, ///< Windowed Sender Drive: another Block may be prepared without waiting for a BlockAck
     };
 
     struct TransferInitData
@@ -47,6 +56,10 @@ public:
         uint64_t StartOffset  = 0;
         uint64_t Length       = 0;
 
+        /// Proposed max number of unacknowledged Blocks in Sender Drive. Only sent in ReceiveInit messages, 0 or 1 for a lock-step
+        /// transfer.
+        uint8_t WindowSize = 0;
+
         const uint8_t * FileDesignator = nullptr;
         uint16_t FileDesLength         = 0;
 
@@ -62,6 +75,7 @@ public:
         uint16_t MaxBlockSize = 0;
         uint64_t StartOffset  = 0; ///< Not used for SendAccept message
         uint64_t Length       = 0; ///< Not used for SendAccept message
+        uint8_t WindowSize    = 0; ///< Not used for SendAccept message, no larger than the proposed one in Sender Drive only
 
         // Additional metadata (optional, TLV format)
         const uint8_t * Metadata = nullptr;
@@ -80,12 +94,38 @@ public:
         bool IsEof           = false;
     };
 
+    /**
+     * @brief
+     *   Provides the data of the Blocks to send to PrepareBlock(BlockSource &), which has it written directly into the buffer of
+     *   the Block message instead of copying it from a caller buffer.
+     */
+    class BlockSource
+    {
+    public:
+        virtual ~BlockSource() {}
+
+        /**
+         * @brief
+         *   Write the data of the next Block to buffer.
+         *
+         * @param offset    Offset of the data in the file, GetStartOffset() for the first Block
+         * @param buffer    Where to write the data
+         * @param maxLength Number of bytes available at buffer, the max block size of the transfer
+         * @param length    Set to the number of bytes written
+         * @param isEof     Set to true if this is the last Block of the transfer
+         */
+        virtual CHIP_ERROR ReadBlock(uint64_t offset, uint8_t * buffer, uint16_t maxLength, uint16_t & length, bool & isEof) = 0;
+    };
+
     /**
      * @brief
      *   All output data processed by the TransferSession object will be passed to the caller using this struct via PollOutput().
      *
      *   NOTE: Some sub-structs may contain pointers to data in a PacketBuffer. In this case, the MsgData field MUST be populated
      *         with a PacketBufferHandle that encapsulates the respective PacketBuffer, in order to ensure valid memory access.
+     *
+     *         For kBlockReceived events, the received message is handed over in MsgData and blockdata points into it: a caller
+     *         that holds on to MsgData can write the data out later without copying it first.
      */
     struct OutputEvent
     {
@@ -154,7 +194,7 @@ public:
      *
      * @param role            Inidcates whether this object will be sending or receiving data
      * @param xferControlOpts Indicates all supported control modes. Used to respond to a TransferInit message
-     * @param maxBlockSize    The max Block size that this object supports.
+     * @param maxBlockSize    The max Block size that this object supports, no larger than kMaxBlockSize
      * @param timeoutMs       The amount of time to wait for a response before considering the transfer failed (milliseconds)
      *
      * @return CHIP_ERROR Result of initialization. May also indicate if the TransferSession object is unable to handle this
@@ -198,6 +238,10 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In a windowed Sender Drive transfer (see GetWindowSize()), up to the window size Blocks may be sent before a BlockAck is
+     *   received. A kWindowAvailable event is emitted after a Block is sent if another one may be prepared right away, and a
+     *   kAckReceived event once a BlockAck opened the window again.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -205,10 +249,25 @@ public:
      */
     CHIP_ERROR PrepareBlock(const BlockData & inData);
 
+    /**
+     * @brief
+     *   Prepare a Block message with data written by source directly into the message buffer, saving a copy of the Block
+     *   compared to PrepareBlock(const BlockData &). The Block counter and offset will be populated automatically.
+     *
+     * @param source Writes the data of the Block, see BlockSource
+     *
+     * @return CHIP_ERROR The result of the preparation of a Block message, or the error returned by source. May also indicate if
+     *                    the TransferSession object is unable to handle this request.
+     */
+    CHIP_ERROR PrepareBlock(BlockSource & source);
+
     /**
      * @brief
      *   Prepare a BlockAck message. The Block counter will be populated automatically.
      *
+     *   In a windowed Sender Drive transfer, the BlockAck acknowledges every Block received so far. The receiver does not need to
+     *   acknowledge every Block, but must do so at least once every window size Blocks for the sender to keep sending.
+     *
      * @return CHIP_ERROR The result of the preparation of a BlockAck message. May also indicate if the TransferSession object
      *                    is unable to handle this request.
      */
@@ -248,6 +307,7 @@ public:
     uint64_t GetStartOffset() const { return mStartOffset; }
     uint64_t GetTransferLength() const { return mTransferLength; }
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
+    uint8_t GetWindowSize() const { return mWindowSize; } ///< 0 or 1 for a lock-step transfer
 
     TransferSession();
 
@@ -291,7 +351,10 @@ private:
     CHIP_ERROR VerifyProposedMode(const BitFlags<TransferControlFlags> & proposed);
 
     void PrepareStatusReport(StatusCode code);
+    CHIP_ERROR VerifyCanPrepareBlock();
+    CHIP_ERROR FinishPreparingBlock(uint16_t length, bool isEof);
     bool IsTransferLengthDefinite();
+    bool IsWindowed() const { return mWindowSize > 1; }
 
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
@@ -307,6 +370,7 @@ private:
     uint64_t mStartOffset          = 0; ///< 0 represents no offset
     uint64_t mTransferLength       = 0; ///< 0 represents indefinite length
     uint16_t mTransferMaxBlockSize = 0;
+    uint8_t mWindowSize            = 0; ///< Proposed one until the ReceiveAccept message is handled
 
     System::PacketBufferHandle mPendingMsgHandle;
     StatusReportData mStatusReportData;
@@ -321,6 +385,9 @@ private:
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
 
+    uint32_t mNumUnackedBlocks = 0;     ///< Blocks sent and not acknowledged yet, in a windowed transfer
+    bool mWindowAvailable      = false; ///< Whether to emit a kWindowAvailable event
+
     uint32_t mTimeoutMs          = 0;
     uint64_t mTimeoutStartTimeMs = 0;
     bool mShouldInitTimeoutStart = true;
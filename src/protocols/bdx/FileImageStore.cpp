@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/FileImageStore.h>
+
+#include <support/CodeUtils.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace bdx {
+
+namespace {
+
+int HandleToFd(void * handle)
+{
+    return static_cast<int>(reinterpret_cast<intptr_t>(handle));
+}
+
+} // namespace
+
+CHIP_ERROR FileImageStore::Open(const uint8_t * designator, uint16_t designatorLength, void *& handle, uint64_t & size)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    char path[PATH_MAX];
+    struct stat fileStat;
+
+    // Only the plain files right in the directory are images
+    VerifyOrReturnError(designatorLength > 0 && memchr(designator, '/', designatorLength) == nullptr &&
+                            memchr(designator, '\0', designatorLength) == nullptr && designator[0] != '.',
+                        CHIP_ERROR_KEY_NOT_FOUND);
+
+    int length = snprintf(path, sizeof(path), "%s/%.*s", mDirectory, static_cast<int>(designatorLength),
+                          reinterpret_cast<const char *>(designator));
+    VerifyOrReturnError(length > 0 && static_cast<size_t>(length) < sizeof(path), CHIP_ERROR_KEY_NOT_FOUND);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, errno == ENOENT ? CHIP_ERROR_KEY_NOT_FOUND : System::MapErrorPOSIX(errno));
+
+    VerifyOrExit(fstat(fd, &fileStat) == 0, err = System::MapErrorPOSIX(errno));
+    VerifyOrExit(S_ISREG(fileStat.st_mode), err = CHIP_ERROR_KEY_NOT_FOUND);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    // The transfers send the file in order: let the kernel read ahead of them
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    handle = reinterpret_cast<void *>(static_cast<intptr_t>(fd));
+    size   = static_cast<uint64_t>(fileStat.st_size);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        close(fd);
+    }
+    return err;
+}
+
+CHIP_ERROR FileImageStore::Read(void * handle, uint64_t offset, uint8_t * buffer, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t count = pread(HandleToFd(handle), buffer, length, static_cast<off_t>(offset));
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(count >= 0, System::MapErrorPOSIX(errno));
+        // The file was cut short since it was opened
+        VerifyOrReturnError(count > 0, CHIP_ERROR_READ_FAILED);
+
+        buffer += count;
+        offset += static_cast<uint64_t>(count);
+        length -= static_cast<size_t>(count);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void FileImageStore::Close(void * handle)
+{
+    close(HandleToFd(handle));
+}
+
+} // namespace bdx
+} // namespace chip
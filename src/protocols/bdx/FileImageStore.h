@@ -0,0 +1,52 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an ImageStore reading the images from the files of a directory, for POSIX platforms.
+ */
+
+#pragma once
+
+#include <protocols/bdx/BdxImageCache.h>
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Reads the images from the files of a directory, the file designator of an image being the name of its file. A designator
+ * naming anything outside of the directory is not found.
+ */
+class FileImageStore : public ImageStore
+{
+public:
+    /**
+     * @param directory Path of the directory, which must outlive the store
+     */
+    FileImageStore(const char * directory) : mDirectory(directory) {}
+
+    CHIP_ERROR Open(const uint8_t * designator, uint16_t designatorLength, void *& handle, uint64_t & size) override;
+    CHIP_ERROR Read(void * handle, uint64_t offset, uint8_t * buffer, size_t length) override;
+    void Close(void * handle) override;
+
+private:
+    const char * mDirectory;
+};
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,94 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/MappedFileBlockSource.h>
+
+#include <support/CodeUtils.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace bdx {
+
+CHIP_ERROR MappedFileBlockSource::Open(const char * path)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct stat fileStat;
+    void * mapping;
+
+    VerifyOrReturnError(mData == nullptr && mSize == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, System::MapErrorPOSIX(errno));
+
+    VerifyOrExit(fstat(fd, &fileStat) == 0, err = System::MapErrorPOSIX(errno));
+    VerifyOrExit(static_cast<uint64_t>(fileStat.st_size) <= SIZE_MAX, err = CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    // An empty file cannot be mapped, and is sent as a single empty BlockEOF
+    VerifyOrExit(fileStat.st_size > 0, );
+
+    mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    VerifyOrExit(mapping != MAP_FAILED, err = System::MapErrorPOSIX(errno));
+
+    // The Blocks are read in order: let the kernel read ahead and reclaim the pages already sent
+    madvise(mapping, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+    mData = static_cast<const uint8_t *>(mapping);
+    mSize = static_cast<size_t>(fileStat.st_size);
+
+exit:
+    // The mapping stays valid once the file is closed
+    close(fd);
+    return err;
+}
+
+void MappedFileBlockSource::Close()
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+}
+
+CHIP_ERROR MappedFileBlockSource::ReadBlock(uint64_t offset, uint8_t * buffer, uint16_t maxLength, uint16_t & length,
+                                            bool & isEof)
+{
+    VerifyOrReturnError(offset <= mSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t remaining = mSize - static_cast<size_t>(offset);
+
+    length = static_cast<uint16_t>((remaining < maxLength) ? remaining : maxLength);
+    isEof  = (length == remaining);
+
+    if (length > 0)
+    {
+        memcpy(buffer, mData + offset, length);
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace bdx
+} // namespace chip
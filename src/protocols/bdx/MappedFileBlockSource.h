@@ -0,0 +1,55 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a BlockSource sending the content of a file mapped into memory, for POSIX platforms.
+ */
+
+#pragma once
+
+#include <protocols/bdx/BdxTransferSession.h>
+
+#include <stddef.h>
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Sends a file mapped into memory: the Blocks are copied from the mapping straight into the message buffers, without going
+ * through a read buffer.
+ */
+class MappedFileBlockSource : public TransferSession::BlockSource
+{
+public:
+    ~MappedFileBlockSource() override { Close(); }
+
+    CHIP_ERROR Open(const char * path);
+    void Close();
+
+    uint64_t GetFileSize() const { return mSize; }
+
+    CHIP_ERROR ReadBlock(uint64_t offset, uint8_t * buffer, uint16_t maxLength, uint16_t & length, bool & isEof) override;
+
+private:
+    const uint8_t * mData = nullptr;
+    size_t mSize          = 0;
+};
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,215 @@
+#include <protocols/bdx/BdxImageCache.h>
+
+#include <nlunit-test.h>
+
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::bdx;
+
+namespace {
+
+constexpr size_t kImageSize = (CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS + 1) * CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE + 100;
+
+uint8_t ImageByte(uint64_t offset)
+{
+    return static_cast<uint8_t>(offset * 7 + 3);
+}
+
+/**
+ * Serves a single image named "image", counting what is asked of it.
+ */
+class TestImageStore : public ImageStore
+{
+public:
+    CHIP_ERROR Open(const uint8_t * designator, uint16_t designatorLength, void *& handle, uint64_t & size) override
+    {
+        VerifyOrReturnError(designatorLength == strlen("image") && memcmp(designator, "image", designatorLength) == 0,
+                            CHIP_ERROR_KEY_NOT_FOUND);
+        mNumOpens++;
+        handle = this;
+        size   = kImageSize;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Read(void * handle, uint64_t offset, uint8_t * buffer, size_t length) override
+    {
+        VerifyOrReturnError(handle == this && offset + length <= kImageSize, CHIP_ERROR_INVALID_ARGUMENT);
+        mNumReads++;
+        for (size_t i = 0; i < length; i++)
+        {
+            buffer[i] = ImageByte(offset + i);
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void Close(void * handle) override { mNumCloses++; }
+
+    int mNumOpens  = 0;
+    int mNumReads  = 0;
+    int mNumCloses = 0;
+};
+
+bool CheckData(const uint8_t * buffer, uint64_t offset, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (buffer[i] != ImageByte(offset + i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// Test that the transfers of the same image share it, and the chunks read for it.
+void TestSharedImage(nlTestSuite * inSuite, void * inContext)
+{
+    TestImageStore store;
+    ImageCache cache;
+    ImageCache::Image * image1  = nullptr;
+    ImageCache::Image * image2  = nullptr;
+    ImageCache::Image * missing = nullptr;
+    uint8_t buffer[100];
+
+    NL_TEST_ASSERT(inSuite, cache.Init(&store) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.OpenImage(reinterpret_cast<const uint8_t *>("image"), 5, image1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.OpenImage(reinterpret_cast<const uint8_t *>("image"), 5, image2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.OpenImage(reinterpret_cast<const uint8_t *>("other"), 5, missing) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, image1 == image2);
+    NL_TEST_ASSERT(inSuite, store.mNumOpens == 1);
+    NL_TEST_ASSERT(inSuite, image1->GetSize() == kImageSize);
+
+    // The second transfer gets the Block read for the first from the cache
+    NL_TEST_ASSERT(inSuite, cache.Read(image1, 10, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CheckData(buffer, 10, sizeof(buffer)));
+    NL_TEST_ASSERT(inSuite, cache.Read(image2, 110, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CheckData(buffer, 110, sizeof(buffer)));
+    NL_TEST_ASSERT(inSuite, store.mNumReads == 1);
+
+    // A Block spanning two chunks reads the next one
+    NL_TEST_ASSERT(inSuite, cache.Read(image1, CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE - 50, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CheckData(buffer, CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE - 50, sizeof(buffer)));
+    NL_TEST_ASSERT(inSuite, store.mNumReads == 2);
+
+    // Nothing is read past the end of the image
+    NL_TEST_ASSERT(inSuite, cache.Read(image1, kImageSize - 50, buffer, sizeof(buffer)) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    cache.CloseImage(image1);
+    NL_TEST_ASSERT(inSuite, store.mNumCloses == 0);
+    cache.CloseImage(image2);
+    NL_TEST_ASSERT(inSuite, store.mNumCloses == 1);
+
+    cache.Shutdown();
+}
+
+// Test that the least recently used chunk is the one read over.
+void TestChunkEviction(nlTestSuite * inSuite, void * inContext)
+{
+    TestImageStore store;
+    ImageCache cache;
+    ImageCache::Image * image = nullptr;
+    uint8_t buffer[10];
+
+    NL_TEST_ASSERT(inSuite, cache.Init(&store) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.OpenImage(reinterpret_cast<const uint8_t *>("image"), 5, image) == CHIP_NO_ERROR);
+
+    // Fill the cache, then use the first chunk again
+    for (uint64_t i = 0; i < CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS; i++)
+    {
+        NL_TEST_ASSERT(inSuite, cache.Read(image, i * CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, cache.Read(image, 0, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.mNumReads == CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS);
+
+    // The second chunk is read over, the first is kept
+    NL_TEST_ASSERT(inSuite,
+                   cache.Read(image, CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS * CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE, buffer, sizeof(buffer)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CheckData(buffer, CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS * CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE, sizeof(buffer)));
+    NL_TEST_ASSERT(inSuite, cache.Read(image, 0, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.mNumReads == CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS + 1);
+    NL_TEST_ASSERT(inSuite, cache.Read(image, CHIP_BDX_IMAGE_CACHE_CHUNK_SIZE, buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.mNumReads == CHIP_BDX_IMAGE_CACHE_NUM_CHUNKS + 2);
+
+    cache.CloseImage(image);
+    cache.Shutdown();
+}
+
+// Test that a transfer resumed from an offset sends the rest of the image, up to its last Block.
+void TestResumedBlocks(nlTestSuite * inSuite, void * inContext)
+{
+    TestImageStore store;
+    ImageCache cache;
+    ImageCache::Image * image = nullptr;
+    ImageBlockSource source;
+    uint8_t buffer[1000];
+    uint64_t offset = kImageSize - 1500;
+    uint16_t length = 0;
+    bool isEof      = false;
+
+    NL_TEST_ASSERT(inSuite, cache.Init(&store) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.OpenImage(reinterpret_cast<const uint8_t *>("image"), 5, image) == CHIP_NO_ERROR);
+    source.Init(&cache, image, image->GetSize());
+
+    NL_TEST_ASSERT(inSuite, source.ReadBlock(offset, buffer, sizeof(buffer), length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == sizeof(buffer) && !isEof && !source.IsEofRead());
+    NL_TEST_ASSERT(inSuite, CheckData(buffer, offset, length));
+    offset += length;
+
+    NL_TEST_ASSERT(inSuite, source.ReadBlock(offset, buffer, sizeof(buffer), length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == 500 && isEof && source.IsEofRead());
+    NL_TEST_ASSERT(inSuite, CheckData(buffer, offset, length));
+
+    // A transfer resumed at the end of the image only sends an empty BlockEOF
+    source.Init(&cache, image, image->GetSize());
+    NL_TEST_ASSERT(inSuite, source.ReadBlock(kImageSize, buffer, sizeof(buffer), length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == 0 && isEof);
+
+    cache.CloseImage(image);
+    cache.Shutdown();
+}
+
+// Test Suite
+
+/**
+ *  Test Suite that lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestSharedImage", TestSharedImage),
+    NL_TEST_DEF("TestChunkEviction", TestChunkEviction),
+    NL_TEST_DEF("TestResumedBlocks", TestResumedBlocks),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+static nlTestSuite sSuite =
+{
+    "Test-CHIP-BdxImageCache",
+    &sTests[0],
+    nullptr,
+    nullptr,
+};
+// clang-format on
+
+/**
+ *  Main
+ */
+int TestBdxImageCache()
+{
+    // Run test suit against one context
+    nlTestRunner(&sSuite, nullptr);
+
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBdxImageCache)
@@ -98,6 +98,35 @@ void TestReceiveAcceptMessage(nlTestSuite * inSuite, void * inContext)
     TestHelperWrittenAndParsedMatch<ReceiveAccept>(inSuite, inContext, testMsg);
 }
 
+void TestWindowSizeMessages(nlTestSuite * inSuite, void * inContext)
+{
+    TransferInit initMsg;
+
+    initMsg.TransferCtlOptions.ClearAll().Set(TransferControlFlags::kSenderDrive, true);
+    initMsg.Version      = 1;
+    initMsg.MaxBlockSize = 256;
+    initMsg.WindowSize   = 4;
+
+    char testFileDes[9]    = { "test.txt" };
+    initMsg.FileDesLength  = 9;
+    initMsg.FileDesignator = reinterpret_cast<uint8_t *>(testFileDes);
+
+    TestHelperWrittenAndParsedMatch<TransferInit>(inSuite, inContext, initMsg);
+
+    ReceiveAccept acceptMsg;
+
+    acceptMsg.Version = 1;
+    acceptMsg.TransferCtlFlags.ClearAll().Set(TransferControlFlags::kSenderDrive, true);
+    acceptMsg.MaxBlockSize = 256;
+    acceptMsg.WindowSize   = 3;
+
+    uint8_t fakeData[5]      = { 7, 6, 5, 4, 3 };
+    acceptMsg.MetadataLength = 5;
+    acceptMsg.Metadata       = reinterpret_cast<uint8_t *>(fakeData);
+
+    TestHelperWrittenAndParsedMatch<ReceiveAccept>(inSuite, inContext, acceptMsg);
+}
+
 void TestCounterMessage(nlTestSuite * inSuite, void * inContext)
 {
     CounterMessage testMsg;
@@ -130,6 +159,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("TestTransferInitMessage", TestTransferInitMessage),
     NL_TEST_DEF("TestSendAcceptMessage", TestSendAcceptMessage),
     NL_TEST_DEF("TestReceiveAcceptMessage", TestReceiveAcceptMessage),
+    NL_TEST_DEF("TestWindowSizeMessages", TestWindowSizeMessages),
     NL_TEST_DEF("TestCounterMessage", TestCounterMessage),
     NL_TEST_DEF("TestDataBlockMessage", TestDataBlockMessage),
 
@@ -732,6 +732,249 @@ void TestDuplicateBlockError(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Helper method for sending a Block in a windowed transfer, where the sender may already be waiting for acknowledgements. Verifies
+// that the sender signals when another Block fits in the window.
+void SendAndVerifyWindowedBlock(nlTestSuite * inSuite, void * inContext, TransferSession & sender, TransferSession & receiver,
+                                TransferSession::OutputEvent & outEvent, bool isEof, bool expectWindowAvailable)
+{
+    uint8_t fakeData[16] = { 0 };
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = sizeof(fakeData);
+    blockData.IsEof  = isEof;
+
+    CHIP_ERROR err = sender.PrepareBlock(blockData);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    sender.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageType(inSuite, inContext, outEvent.MsgData, isEof ? MessageType::BlockEOF : MessageType::Block);
+    System::PacketBufferHandle blockMsg = std::move(outEvent.MsgData);
+
+    if (expectWindowAvailable)
+    {
+        sender.PollOutput(outEvent, kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kWindowAvailable);
+    }
+    VerifyNoMoreOutput(inSuite, inContext, sender);
+
+    err = receiver.HandleMessageReceived(std::move(blockMsg), kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    receiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kBlockReceived);
+    VerifyNoMoreOutput(inSuite, inContext, receiver);
+}
+
+// Test a Sender Drive transfer where the sender keeps a window of Blocks in flight, acknowledged cumulatively by the receiver.
+void TestWindowedSenderDrive(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    uint16_t blockSize = 64;
+    uint32_t timeoutMs = 1000 * 24;
+
+    TransferControlFlags driveMode = TransferControlFlags::kSenderDrive;
+
+    // ReceiveInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = blockSize;
+    initOptions.WindowSize       = 4;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeoutMs, initiatingReceiver, TransferRole::kReceiver, initOptions,
+                              respondingSender, senderOpts, blockSize);
+    NL_TEST_ASSERT(inSuite, outEvent.transferInitData.WindowSize == initOptions.WindowSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = driveMode;
+    acceptData.MaxBlockSize = blockSize;
+
+    // The window may not be larger than proposed
+    acceptData.WindowSize = 5;
+    err                   = respondingSender.AcceptTransfer(acceptData);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+
+    acceptData.WindowSize = 3;
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver,
+                           initOptions);
+    NL_TEST_ASSERT(inSuite, outEvent.transferAcceptData.WindowSize == acceptData.WindowSize);
+    NL_TEST_ASSERT(inSuite, respondingSender.GetWindowSize() == 3);
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.GetWindowSize() == 3);
+
+    // Fill the window: no Block may be sent once three are waiting for an acknowledgement
+    SendAndVerifyWindowedBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false, true);
+    SendAndVerifyWindowedBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false, true);
+    SendAndVerifyWindowedBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false, false);
+
+    uint8_t fakeData[16] = { 0 };
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = sizeof(fakeData);
+    err              = respondingSender.PrepareBlock(blockData);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+
+    // One BlockAck acknowledges all three Blocks and reopens the window
+    SendAndVerifyBlockAck(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false);
+
+    SendAndVerifyWindowedBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false, true);
+    SendAndVerifyWindowedBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, true, false);
+
+    SendAndVerifyBlockAck(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, true);
+}
+
+// BlockSource serving an arbitrary buffer, as a file would.
+class TestBlockSource : public TransferSession::BlockSource
+{
+public:
+    TestBlockSource(const uint8_t * data, size_t size) : mData(data), mSize(size) {}
+
+    CHIP_ERROR ReadBlock(uint64_t offset, uint8_t * buffer, uint16_t maxLength, uint16_t & length, bool & isEof) override
+    {
+        mLastOffset = offset;
+        length      = static_cast<uint16_t>((mSize - offset < maxLength) ? mSize - offset : maxLength);
+        isEof       = (offset + length == mSize);
+        memcpy(buffer, mData + offset, length);
+        return CHIP_NO_ERROR;
+    }
+
+    const uint8_t * mData;
+    size_t mSize;
+    uint64_t mLastOffset = 0;
+};
+
+// Test a Sender Drive transfer whose Blocks are written into the messages by a BlockSource.
+void TestBlockSourceSenderDrive(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    uint16_t blockSize = 16;
+    uint32_t timeoutMs = 1000 * 24;
+
+    uint8_t fileData[40];
+    for (size_t i = 0; i < sizeof(fileData); i++)
+    {
+        fileData[i] = static_cast<uint8_t>(i);
+    }
+    TestBlockSource source(fileData, sizeof(fileData));
+
+    TransferControlFlags driveMode = TransferControlFlags::kSenderDrive;
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = blockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeoutMs, initiatingReceiver, TransferRole::kReceiver, initOptions,
+                              respondingSender, senderOpts, blockSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = driveMode;
+    acceptData.MaxBlockSize = blockSize;
+    acceptData.Length       = sizeof(fileData);
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver,
+                           initOptions);
+
+    // Blocks of 16, 16 and 8 bytes, the last one being a BlockEOF
+    for (size_t offset = 0; offset < sizeof(fileData); offset += blockSize)
+    {
+        const bool isEof = (offset + blockSize >= sizeof(fileData));
+
+        err = respondingSender.PrepareBlock(source);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, source.mLastOffset == offset);
+        respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kMsgToSend);
+        VerifyBdxMessageType(inSuite, inContext, outEvent.MsgData, isEof ? MessageType::BlockEOF : MessageType::Block);
+        VerifyNoMoreOutput(inSuite, inContext, respondingSender);
+
+        // The received Block points into the message handed over with the event
+        err = initiatingReceiver.HandleMessageReceived(std::move(outEvent.MsgData), kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kBlockReceived);
+        NL_TEST_ASSERT(inSuite, !outEvent.MsgData.IsNull());
+        if (outEvent.EventType == TransferSession::OutputEventType::kBlockReceived && !outEvent.MsgData.IsNull())
+        {
+            NL_TEST_ASSERT(inSuite, outEvent.blockdata.IsEof == isEof);
+            NL_TEST_ASSERT(inSuite, outEvent.blockdata.Length == (isEof ? sizeof(fileData) - offset : blockSize));
+            NL_TEST_ASSERT(inSuite, outEvent.blockdata.Data >= outEvent.MsgData->Start());
+            NL_TEST_ASSERT(inSuite,
+                           outEvent.blockdata.Data + outEvent.blockdata.Length <=
+                               outEvent.MsgData->Start() + outEvent.MsgData->DataLength());
+            NL_TEST_ASSERT(inSuite, !memcmp(outEvent.blockdata.Data, fileData + offset, outEvent.blockdata.Length));
+        }
+        VerifyNoMoreOutput(inSuite, inContext, initiatingReceiver);
+
+        SendAndVerifyBlockAck(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, isEof);
+    }
+}
+
+// Test that max Block sizes are reduced to what fits in a message buffer, and that Blocks of that size can be sent.
+void TestMaxBlockSizeLimit(nlTestSuite * inSuite, void * inContext)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    uint32_t timeoutMs = 1000 * 24;
+
+    TransferControlFlags driveMode = TransferControlFlags::kSenderDrive;
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = UINT16_MAX;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    BitFlags<TransferControlFlags> receiverOpts;
+    receiverOpts.Set(driveMode);
+
+    CHIP_ERROR err = respondingReceiver.WaitForTransfer(TransferRole::kReceiver, receiverOpts, UINT16_MAX, timeoutMs);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = initiatingSender.StartTransfer(TransferRole::kSender, initOptions, timeoutMs);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kMsgToSend);
+
+    err = respondingReceiver.HandleMessageReceived(std::move(outEvent.MsgData), kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kInitReceived);
+    NL_TEST_ASSERT(inSuite, outEvent.transferInitData.MaxBlockSize == TransferSession::kMaxBlockSize);
+    NL_TEST_ASSERT(inSuite, respondingReceiver.GetTransferBlockSize() == TransferSession::kMaxBlockSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = driveMode;
+    acceptData.MaxBlockSize = TransferSession::kMaxBlockSize;
+
+    initOptions.MaxBlockSize = TransferSession::kMaxBlockSize;
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender,
+                           initOptions);
+    NL_TEST_ASSERT(inSuite, initiatingSender.GetTransferBlockSize() == TransferSession::kMaxBlockSize);
+
+    SendAndVerifyArbitraryBlock(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true);
+    NL_TEST_ASSERT(inSuite, outEvent.blockdata.Length == TransferSession::kMaxBlockSize);
+}
+
 // Test Suite
 
 /**
@@ -745,6 +988,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("TestBadAcceptMessageFields", TestBadAcceptMessageFields),
     NL_TEST_DEF("TestTimeout", TestTimeout),
     NL_TEST_DEF("TestDuplicateBlockError", TestDuplicateBlockError),
+    NL_TEST_DEF("TestWindowedSenderDrive", TestWindowedSenderDrive),
+    NL_TEST_DEF("TestBlockSourceSenderDrive", TestBlockSourceSenderDrive),
+    NL_TEST_DEF("TestMaxBlockSizeLimit", TestMaxBlockSizeLimit),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,348 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements an Echo initiator keeping several Echo Requests
+ *      outstanding at once, and recording their round trip times.
+ *
+ */
+
+#include "EchoBenchmark.h"
+
+#include <transport/SecureSessionMgr.h>
+
+#include <inttypes.h>
+
+namespace chip {
+namespace Protocols {
+namespace Echo {
+
+void EchoLatencyHistogram::Add(uint64_t rttUs)
+{
+    size_t bucket = 0;
+
+    while (bucket + 1 < kBucketCount && (rttUs >> (bucket + 1)) != 0)
+    {
+        bucket++;
+    }
+
+    mBuckets[bucket]++;
+    mCount++;
+    mSumUs += rttUs;
+    mMinUs = (rttUs < mMinUs) ? rttUs : mMinUs;
+    mMaxUs = (rttUs > mMaxUs) ? rttUs : mMaxUs;
+}
+
+uint64_t EchoLatencyHistogram::GetPercentileUs(uint8_t percent) const
+{
+    uint64_t rank       = (static_cast<uint64_t>(mCount) * percent + 99) / 100;
+    uint64_t cumulative = 0;
+
+    for (size_t bucket = 0; bucket + 1 < kBucketCount; bucket++)
+    {
+        cumulative += mBuckets[bucket];
+        if (cumulative >= rank && cumulative > 0)
+        {
+            uint64_t upperBound = GetBucketLowerBoundUs(bucket + 1);
+            return (upperBound < mMaxUs) ? upperBound : mMaxUs;
+        }
+    }
+    return mMaxUs;
+}
+
+CHIP_ERROR EchoBenchmark::Start(Messaging::ExchangeManager * exchangeMgr, SecureSessionHandle session,
+                                const EchoBenchmarkParams & params, EchoBenchmarkDoneFunct onDone, void * context)
+{
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(exchangeMgr != nullptr && exchangeMgr->GetSessionMgr() != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.mMaxOutstanding > 0 && params.mMaxOutstanding <= kMaxOutstandingRequests,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.mMinPayloadSize <= params.mMaxPayloadSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.mMaxPayloadSize <= exchangeMgr->GetSessionMgr()->GetMaxAppMessageLength(session),
+                        CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    for (EchoBenchmarkStats & stats : mStats)
+    {
+        stats = EchoBenchmarkStats();
+    }
+
+    mExchangeMgr     = exchangeMgr;
+    mSession         = session;
+    mParams          = params;
+    mOnDone          = onDone;
+    mContext         = context;
+    mRequestsStarted = 0;
+    mOutstanding     = 0;
+    mPayloadSize     = params.mMinPayloadSize;
+    mStartedAtUs     = System::Layer::GetClock_MonotonicHiRes();
+    mFinishedAtUs    = mStartedAtUs;
+    mNextSendAtUs    = mStartedAtUs;
+
+    SendRequests();
+    return CHIP_NO_ERROR;
+}
+
+void EchoBenchmark::Stop()
+{
+    VerifyOrReturn(IsRunning());
+
+    mExchangeMgr->GetSessionMgr()->SystemLayer()->CancelTimer(HandleIntervalTimer, this);
+    for (Request & request : mRequests)
+    {
+        if (request.mExchange != nullptr)
+        {
+            ReleaseRequest(request);
+        }
+    }
+
+    mFinishedAtUs = System::Layer::GetClock_MonotonicHiRes();
+    mExchangeMgr  = nullptr;
+}
+
+uint64_t EchoBenchmark::GetElapsedUs() const
+{
+    return (IsRunning() ? System::Layer::GetClock_MonotonicHiRes() : mFinishedAtUs) - mStartedAtUs;
+}
+
+void EchoBenchmark::SendRequests()
+{
+    // Over a loopback transport, a response is received while its request is sent, and its handler comes back here:
+    // the loop below sends the next requests instead.
+    VerifyOrReturn(!mSendingRequests);
+    mSendingRequests = true;
+
+    while (IsRunning() && mRequestsStarted < mParams.mRequestCount && mOutstanding < mParams.mMaxOutstanding)
+    {
+        uint64_t now = System::Layer::GetClock_MonotonicHiRes();
+
+        if (now < mNextSendAtUs)
+        {
+            uint32_t delayMs = static_cast<uint32_t>((mNextSendAtUs - now + 999) / 1000);
+            mExchangeMgr->GetSessionMgr()->SystemLayer()->StartTimer(delayMs, HandleIntervalTimer, this);
+            break;
+        }
+        mNextSendAtUs = now + static_cast<uint64_t>(mParams.mRequestIntervalMs) * 1000;
+
+        for (Request & request : mRequests)
+        {
+            if (request.mExchange == nullptr)
+            {
+                mRequestsStarted++;
+                CHIP_ERROR err = SendRequest(request);
+                if (err != CHIP_NO_ERROR)
+                {
+                    ChipLogError(Echo, "Failed to send echo request: %s", ErrorStr(err));
+                }
+                break;
+            }
+        }
+    }
+
+    mSendingRequests = false;
+
+    if (IsRunning() && mOutstanding == 0 && mRequestsStarted == mParams.mRequestCount)
+    {
+        Finish();
+    }
+}
+
+CHIP_ERROR EchoBenchmark::SendRequest(Request & request)
+{
+    Transport::PeerConnectionState * state = mExchangeMgr->GetSessionMgr()->GetPeerConnectionState(mSession);
+    Messaging::SendFlags sendFlags(Messaging::SendMessageFlags::kExpectResponse);
+    System::PacketBufferHandle payload;
+    uint16_t payloadSize = mPayloadSize;
+    CHIP_ERROR err       = CHIP_NO_ERROR;
+
+    request.mTransport = (state != nullptr) ? state->GetPeerAddress().GetTransportType() : Transport::Type::kUndefined;
+    EchoBenchmarkStats & stats = mStats[static_cast<size_t>(request.mTransport)];
+    stats.mSent++;
+
+    // The sizes sweep the range, so that each size gets its share of the requests whatever their count
+    mPayloadSize = static_cast<uint16_t>(mPayloadSize + mParams.mPayloadSizeStep);
+    if (mPayloadSize > mParams.mMaxPayloadSize || mPayloadSize < payloadSize || mParams.mPayloadSizeStep == 0)
+    {
+        mPayloadSize = mParams.mMinPayloadSize;
+    }
+
+    VerifyOrExit(state != nullptr, err = CHIP_ERROR_NOT_CONNECTED);
+
+    payload = MessagePacketBuffer::New(payloadSize);
+    VerifyOrExit(!payload.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    for (uint16_t i = 0; i < payloadSize; i++)
+    {
+        payload->Start()[i] = static_cast<uint8_t>(i);
+    }
+    payload->SetDataLength(payloadSize);
+
+    request.mExchange = mExchangeMgr->NewContext(mSession, this);
+    VerifyOrExit(request.mExchange != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    request.mExchange->SetResponseTimeout(mParams.mResponseTimeoutMs);
+    request.mSentAtUs = System::Layer::GetClock_MonotonicHiRes();
+    mOutstanding++;
+
+    if (!mParams.mReliable)
+    {
+        sendFlags.Set(Messaging::SendMessageFlags::kNoAutoRequestAck);
+    }
+
+    // The response may have been handled, and the request released, by the time this returns.
+    err = request.mExchange->SendMessage(MsgType::EchoRequest, std::move(payload), sendFlags);
+    if (err != CHIP_NO_ERROR && request.mExchange != nullptr)
+    {
+        ReleaseRequest(request);
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        stats.mSendFailures++;
+    }
+    return err;
+}
+
+EchoBenchmark::Request * EchoBenchmark::FindRequest(Messaging::ExchangeContext * ec)
+{
+    for (Request & request : mRequests)
+    {
+        if (request.mExchange == ec)
+        {
+            return &request;
+        }
+    }
+    return nullptr;
+}
+
+void EchoBenchmark::ReleaseRequest(Request & request)
+{
+    // The exchange is aborted rather than closed, as the acknowledgement of the request no longer matters.
+    request.mExchange->Abort();
+    request.mExchange = nullptr;
+    mOutstanding--;
+}
+
+void EchoBenchmark::Finish()
+{
+    EchoBenchmarkDoneFunct onDone = mOnDone;
+
+    mFinishedAtUs = System::Layer::GetClock_MonotonicHiRes();
+    mExchangeMgr  = nullptr;
+
+    if (onDone != nullptr)
+    {
+        onDone(mContext, *this);
+    }
+}
+
+void EchoBenchmark::HandleIntervalTimer(System::Layer * systemLayer, void * appState, System::Error error)
+{
+    static_cast<EchoBenchmark *>(appState)->SendRequests();
+}
+
+void EchoBenchmark::OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader,
+                                      const PayloadHeader & payloadHeader, System::PacketBufferHandle payload)
+{
+    uint64_t receivedAtUs = System::Layer::GetClock_MonotonicHiRes();
+    Request * request     = FindRequest(ec);
+
+    if (request == nullptr)
+    {
+        ec->Close();
+        return;
+    }
+
+    EchoBenchmarkStats & stats = mStats[static_cast<size_t>(request->mTransport)];
+    if (payloadHeader.HasMessageType(MsgType::EchoResponse))
+    {
+        stats.mReceived++;
+        stats.mBytesReceived += payload->DataLength();
+        stats.mRtt.Add(receivedAtUs - request->mSentAtUs);
+    }
+    else
+    {
+        stats.mLost++;
+    }
+
+    ReleaseRequest(*request);
+    SendRequests();
+}
+
+void EchoBenchmark::OnResponseTimeout(Messaging::ExchangeContext * ec)
+{
+    Request * request = FindRequest(ec);
+
+    VerifyOrReturn(request != nullptr);
+    mStats[static_cast<size_t>(request->mTransport)].mLost++;
+    ReleaseRequest(*request);
+    SendRequests();
+}
+
+const char * EchoBenchmark::GetTransportName(Transport::Type transport)
+{
+    switch (transport)
+    {
+    case Transport::Type::kUdp:
+        return "UDP";
+    case Transport::Type::kBle:
+        return "BLE";
+    case Transport::Type::kTcp:
+        return "TCP";
+    default:
+        return "Undefined";
+    }
+}
+
+void EchoBenchmark::LogResults() const
+{
+    double elapsedSeconds = static_cast<double>(GetElapsedUs()) / 1000000;
+
+    for (size_t i = 0; i < kTransportTypeCount; i++)
+    {
+        const EchoBenchmarkStats & stats = mStats[i];
+        const EchoLatencyHistogram & rtt = stats.mRtt;
+
+        if (stats.mSent == 0)
+        {
+            continue;
+        }
+
+        ChipLogProgress(Echo, "%s: %" PRIu32 " sent, %" PRIu32 " received, %" PRIu32 " lost (%.2f%%), %" PRIu32 " send failures",
+                        GetTransportName(static_cast<Transport::Type>(i)), stats.mSent, stats.mReceived, stats.mLost,
+                        static_cast<double>(stats.mLost) * 100 / stats.mSent, stats.mSendFailures);
+        ChipLogProgress(Echo, "%s: %.1f responses/s, %.1f bytes/s over %.3f s", GetTransportName(static_cast<Transport::Type>(i)),
+                        elapsedSeconds > 0 ? stats.mReceived / elapsedSeconds : 0,
+                        elapsedSeconds > 0 ? static_cast<double>(stats.mBytesReceived) / elapsedSeconds : 0, elapsedSeconds);
+        ChipLogProgress(Echo,
+                        "%s: rtt us min %" PRIu64 " mean %" PRIu64 " p50 %" PRIu64 " p90 %" PRIu64 " p99 %" PRIu64 " max %" PRIu64,
+                        GetTransportName(static_cast<Transport::Type>(i)), rtt.GetMinUs(), rtt.GetMeanUs(),
+                        rtt.GetPercentileUs(50), rtt.GetPercentileUs(90), rtt.GetPercentileUs(99), rtt.GetMaxUs());
+
+        for (size_t bucket = 0; bucket < EchoLatencyHistogram::kBucketCount; bucket++)
+        {
+            if (rtt.GetBucketCount(bucket) > 0)
+            {
+                ChipLogProgress(Echo, "  >= %8" PRIu64 " us: %" PRIu32, EchoLatencyHistogram::GetBucketLowerBoundUs(bucket),
+                                rtt.GetBucketCount(bucket));
+            }
+        }
+    }
+}
+
+} // namespace Echo
+} // namespace Protocols
+} // namespace chip
@@ -0,0 +1,200 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an Echo initiator measuring the round trip time,
+ *      loss and throughput of a session, by keeping several Echo Requests
+ *      outstanding at once.
+ *
+ */
+
+#pragma once
+
+#include <protocols/echo/Echo.h>
+#include <system/SystemLayer.h>
+#include <transport/raw/PeerAddress.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Protocols {
+namespace Echo {
+
+/**
+ * A histogram of round trip times, in buckets of exponentially growing width: bucket i counts the times from 2^i up to
+ * 2^(i+1) microseconds, except for the first bucket, which counts the times under 2 us, and the last bucket, which
+ * counts all the times from its lower bound on.
+ */
+class EchoLatencyHistogram
+{
+public:
+    static constexpr size_t kBucketCount = 24;
+
+    void Add(uint64_t rttUs);
+    void Clear() { *this = EchoLatencyHistogram(); }
+
+    uint32_t GetCount() const { return mCount; }
+    uint32_t GetBucketCount(size_t bucket) const { return mBuckets[bucket]; }
+    uint64_t GetMinUs() const { return mCount > 0 ? mMinUs : 0; }
+    uint64_t GetMaxUs() const { return mMaxUs; }
+    uint64_t GetMeanUs() const { return mCount > 0 ? mSumUs / mCount : 0; }
+
+    /**
+     * @return The upper bound of the bucket of the time that the given percent of the times are lower than or equal to,
+     *         capped by the longest time.
+     */
+    uint64_t GetPercentileUs(uint8_t percent) const;
+
+    static uint64_t GetBucketLowerBoundUs(size_t bucket) { return bucket == 0 ? 0 : (static_cast<uint64_t>(1) << bucket); }
+
+private:
+    uint32_t mBuckets[kBucketCount] = {};
+    uint32_t mCount                 = 0;
+    uint64_t mMinUs                 = UINT64_MAX;
+    uint64_t mMaxUs                 = 0;
+    uint64_t mSumUs                 = 0;
+};
+
+/**
+ * The requests sent over one type of transport.
+ */
+struct EchoBenchmarkStats
+{
+    uint32_t mSent          = 0; ///< Requests given to the exchange layer
+    uint32_t mReceived      = 0; ///< Requests whose response was received
+    uint32_t mLost          = 0; ///< Requests whose response timed out
+    uint32_t mSendFailures  = 0; ///< Requests the exchange layer failed to send
+    uint64_t mBytesReceived = 0; ///< Payload bytes of the responses
+    EchoLatencyHistogram mRtt;
+};
+
+struct EchoBenchmarkParams
+{
+    uint32_t mRequestCount = 100;
+
+    /**
+     * The requests awaiting their response at once, up to EchoBenchmark::kMaxOutstandingRequests.
+     */
+    uint16_t mMaxOutstanding = 1;
+
+    /**
+     * The payload size of a request is mMinPayloadSize for the first request, and grows by mPayloadSizeStep with each
+     * request, going back to mMinPayloadSize once mMaxPayloadSize is passed.
+     */
+    uint16_t mMinPayloadSize  = 32;
+    uint16_t mMaxPayloadSize  = 32;
+    uint16_t mPayloadSizeStep = 0;
+
+    /**
+     * The least time between the sends of two requests, limiting the request rate, or 0 to send each request as soon as
+     * fewer than mMaxOutstanding are outstanding.
+     */
+    uint32_t mRequestIntervalMs = 0;
+
+    uint32_t mResponseTimeoutMs = 2000;
+    bool mReliable              = true;
+};
+
+class EchoBenchmark;
+
+using EchoBenchmarkDoneFunct = void (*)(void * context, EchoBenchmark & benchmark);
+
+class DLL_EXPORT EchoBenchmark : public Messaging::ExchangeDelegate
+{
+public:
+    /**
+     * The requests are limited to half of the exchanges, so that other traffic of the node can go on.
+     */
+    static constexpr uint16_t kMaxOutstandingRequests = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2;
+
+    static constexpr size_t kTransportTypeCount = static_cast<size_t>(Transport::Type::kTcp) + 1;
+
+    ~EchoBenchmark() override { Stop(); }
+
+    /**
+     * Start sending requests on a session, clearing the stats of a previous run. The callback is called once the last
+     * request is answered or timed out.
+     *
+     * @retval #CHIP_ERROR_INCORRECT_STATE If a run is in progress.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT If the parameters are out of range.
+     */
+    CHIP_ERROR Start(Messaging::ExchangeManager * exchangeMgr, SecureSessionHandle session, const EchoBenchmarkParams & params,
+                     EchoBenchmarkDoneFunct onDone, void * context);
+
+    /**
+     * End the run, dropping the outstanding requests without counting them as lost. The callback is not called.
+     */
+    void Stop();
+
+    bool IsRunning() const { return mExchangeMgr != nullptr; }
+
+    const EchoBenchmarkStats & GetStats(Transport::Type transport) const { return mStats[static_cast<size_t>(transport)]; }
+
+    /**
+     * @return The time from the start of the run to its end, or to now while it runs.
+     */
+    uint64_t GetElapsedUs() const;
+
+    /**
+     * Log the stats and the histogram of each transport the requests were sent over.
+     */
+    void LogResults() const;
+
+    static const char * GetTransportName(Transport::Type transport);
+
+private:
+    struct Request
+    {
+        Messaging::ExchangeContext * mExchange = nullptr;
+        uint64_t mSentAtUs                     = 0;
+        Transport::Type mTransport             = Transport::Type::kUndefined;
+    };
+
+    void SendRequests();
+    CHIP_ERROR SendRequest(Request & request);
+    Request * FindRequest(Messaging::ExchangeContext * ec);
+    void ReleaseRequest(Request & request);
+    void Finish();
+
+    static void HandleIntervalTimer(System::Layer * systemLayer, void * appState, System::Error error);
+
+    void OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle payload) override;
+    void OnResponseTimeout(Messaging::ExchangeContext * ec) override;
+
+    Messaging::ExchangeManager * mExchangeMgr = nullptr;
+    SecureSessionHandle mSession;
+    EchoBenchmarkParams mParams;
+    EchoBenchmarkDoneFunct mOnDone = nullptr;
+    void * mContext                = nullptr;
+
+    Request mRequests[kMaxOutstandingRequests];
+    EchoBenchmarkStats mStats[kTransportTypeCount];
+    uint32_t mRequestsStarted = 0;
+    uint16_t mOutstanding     = 0;
+    uint16_t mPayloadSize     = 0;
+    uint64_t mStartedAtUs     = 0;
+    uint64_t mFinishedAtUs    = 0;
+    uint64_t mNextSendAtUs    = 0;
+    bool mSendingRequests     = false;
+};
+
+} // namespace Echo
+} // namespace Protocols
+} // namespace chip
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the table of CASE session resumption tickets.
+ */
+
+#include <protocols/secure_channel/CASEResumptionTable.h>
+
+#include <core/CHIPEncoding.h>
+#include <support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+
+static_assert(CHIP_CONFIG_CASE_RESUMPTION_TABLE_SIZE > 0, "CASEResumptionTable needs at least one entry");
+
+CHIP_ERROR CASEResumptionTable::Init(PersistentStorageDelegate * storage)
+{
+    Reset();
+    mStorage = storage;
+
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+    static_assert(sizeof(mEntries) <= UINT16_MAX, "CASEResumptionTable too large to be stored as a single value");
+
+    uint16_t size  = sizeof(mEntries);
+    CHIP_ERROR err = mStorage->SyncGetKeyValue(kCASEResumptionTableKey, mEntries, size);
+    if (err != CHIP_NO_ERROR || size != sizeof(mEntries))
+    {
+        // Nothing stored yet, or stored with a different table size: start over.
+        Reset();
+        return CHIP_NO_ERROR;
+    }
+
+    for (const Entry & entry : mEntries)
+    {
+        const uint32_t lastUsed = Encoding::LittleEndian::HostSwap32(entry.mLastUsed);
+        if (lastUsed > mUseCounter)
+        {
+            mUseCounter = lastUsed;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void CASEResumptionTable::Reset()
+{
+    memset(mEntries, 0, sizeof(mEntries));
+    mUseCounter = 0;
+}
+
+CASEResumptionTable::Entry * CASEResumptionTable::FindEntry(NodeId peerNodeId)
+{
+    const NodeId storedNodeId = Encoding::LittleEndian::HostSwap64(peerNodeId);
+
+    VerifyOrReturnError(peerNodeId != kUndefinedNodeId, nullptr);
+
+    for (Entry & entry : mEntries)
+    {
+        if (entry.mLastUsed != 0 && entry.mTicket.mPeerNodeId == storedNodeId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CASEResumptionTable::Entry * CASEResumptionTable::FindEntry(const uint8_t * resumptionId)
+{
+    VerifyOrReturnError(resumptionId != nullptr, nullptr);
+
+    for (Entry & entry : mEntries)
+    {
+        if (entry.mLastUsed != 0 && memcmp(entry.mTicket.mResumptionId, resumptionId, kCASEResumptionIdSize) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void CASEResumptionTable::Touch(Entry & entry)
+{
+    entry.mLastUsed = Encoding::LittleEndian::HostSwap32(++mUseCounter);
+}
+
+CHIP_ERROR CASEResumptionTable::FindByNodeId(NodeId peerNodeId, CASEResumptionTicket & ticket)
+{
+    Entry * entry = FindEntry(peerNodeId);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    ticket             = entry->mTicket;
+    ticket.mPeerNodeId = peerNodeId;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASEResumptionTable::FindByResumptionId(const uint8_t * resumptionId, CASEResumptionTicket & ticket)
+{
+    Entry * entry = FindEntry(resumptionId);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    ticket             = entry->mTicket;
+    ticket.mPeerNodeId = Encoding::LittleEndian::HostSwap64(entry->mTicket.mPeerNodeId);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASEResumptionTable::Save(const CASEResumptionTicket & ticket)
+{
+    Entry * entry = FindEntry(ticket.mPeerNodeId);
+
+    if (entry == nullptr)
+    {
+        // Take a free entry, or else the least recently used one.
+        entry = &mEntries[0];
+        for (Entry & candidate : mEntries)
+        {
+            if (Encoding::LittleEndian::HostSwap32(candidate.mLastUsed) < Encoding::LittleEndian::HostSwap32(entry->mLastUsed))
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    entry->mTicket             = ticket;
+    entry->mTicket.mPeerNodeId = Encoding::LittleEndian::HostSwap64(ticket.mPeerNodeId);
+    Touch(*entry);
+
+    return StoreIntoKVS();
+}
+
+CHIP_ERROR CASEResumptionTable::Delete(const uint8_t * resumptionId)
+{
+    Entry * entry = FindEntry(resumptionId);
+    VerifyOrReturnError(entry != nullptr, CHIP_NO_ERROR);
+
+    memset(entry, 0, sizeof(*entry));
+
+    return StoreIntoKVS();
+}
+
+CHIP_ERROR CASEResumptionTable::StoreIntoKVS()
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+
+    return mStorage->SyncSetKeyValue(kCASEResumptionTableKey, mEntries, sizeof(mEntries));
+}
+
+} // namespace chip
@@ -0,0 +1,133 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the resumption tickets that let a CASE session be
+ *      re-established without a full Sigma handshake, and a table storing
+ *      them.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <core/CHIPError.h>
+#include <core/CHIPPersistentStorageDelegate.h>
+#include <support/DLLUtil.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+// KVS store is sensitive to length of key strings, based on the underlying
+// platform. Keeping them short.
+constexpr char kCASEResumptionTableKey[] = "CHIPCaseRes";
+
+constexpr size_t kCASEResumptionIdSize     = 16;
+constexpr size_t kCASEResumptionSecretSize = 32;
+
+/**
+ * Secret shared with a peer by a completed CASE session, from which the next session with that peer can be derived. Both
+ * peers derive the same ticket, and a new one each time a session is established. The responder may not know the node ID of
+ * the initiator, in which case mPeerNodeId is kUndefinedNodeId.
+ */
+struct CASEResumptionTicket
+{
+    NodeId mPeerNodeId;
+    uint8_t mResumptionId[kCASEResumptionIdSize];
+    uint8_t mSharedSecret[kCASEResumptionSecretSize];
+};
+
+/**
+ * Storage of the resumption tickets used by a CASESession.
+ */
+class DLL_EXPORT CASEResumptionStorage
+{
+public:
+    virtual ~CASEResumptionStorage() {}
+
+    /**
+     * Find the ticket shared with a peer, used by the initiator of a session.
+     *
+     * @return CHIP_ERROR_KEY_NOT_FOUND if there is none.
+     */
+    virtual CHIP_ERROR FindByNodeId(NodeId peerNodeId, CASEResumptionTicket & ticket) = 0;
+
+    /**
+     * Find the ticket with the given resumption ID, used by the responder of a session.
+     *
+     * @return CHIP_ERROR_KEY_NOT_FOUND if there is none.
+     */
+    virtual CHIP_ERROR FindByResumptionId(const uint8_t * resumptionId, CASEResumptionTicket & ticket) = 0;
+
+    /**
+     * Save a ticket, replacing the one previously shared with the same peer if its node ID is known.
+     */
+    virtual CHIP_ERROR Save(const CASEResumptionTicket & ticket) = 0;
+
+    /**
+     * Forget the ticket with the given resumption ID, if any.
+     */
+    virtual CHIP_ERROR Delete(const uint8_t * resumptionId) = 0;
+};
+
+/**
+ * @class CASEResumptionTable
+ *
+ * @brief
+ *   Keeps the CHIP_CONFIG_CASE_RESUMPTION_TABLE_SIZE most recently used tickets in memory. If initialized with a persistent
+ *   storage delegate, the table is saved as a single value each time it changes, so that sessions can be resumed after a
+ *   restart.
+ */
+class DLL_EXPORT CASEResumptionTable : public CASEResumptionStorage
+{
+public:
+    CASEResumptionTable() { Reset(); }
+
+    /**
+     * Load the table from the given storage, which may be null to keep the table in memory only.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+
+    void Reset();
+
+    CHIP_ERROR FindByNodeId(NodeId peerNodeId, CASEResumptionTicket & ticket) override;
+    CHIP_ERROR FindByResumptionId(const uint8_t * resumptionId, CASEResumptionTicket & ticket) override;
+    CHIP_ERROR Save(const CASEResumptionTicket & ticket) override;
+    CHIP_ERROR Delete(const uint8_t * resumptionId) override;
+
+private:
+    struct Entry
+    {
+        CASEResumptionTicket mTicket; /* mPeerNodeId is stored in LittleEndian byte order */
+        uint32_t mLastUsed;           /* 0 if the entry is free, stored in LittleEndian byte order */
+    };
+
+    Entry * FindEntry(NodeId peerNodeId);
+    Entry * FindEntry(const uint8_t * resumptionId);
+    void Touch(Entry & entry);
+    CHIP_ERROR StoreIntoKVS();
+
+    Entry mEntries[CHIP_CONFIG_CASE_RESUMPTION_TABLE_SIZE];
+    uint32_t mUseCounter                 = 0;
+    PersistentStorageDelegate * mStorage = nullptr;
+};
+
+} // namespace chip
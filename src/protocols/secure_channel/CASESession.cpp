@@ -34,6 +34,7 @@
 #include <support/BufferWriter.h>
 #include <support/CHIPMem.h>
 #include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
 #include <support/SafeInt.h>
 #include <transport/SecureSessionMgr.h>
 
@@ -57,6 +58,29 @@ constexpr size_t kIVLength = sizeof(kIVSR2);
 
 constexpr size_t kTAGSize = 16;
 
+constexpr uint8_t kKDFS1RInfo[] = { 0x53, 0x69, 0x67, 0x6d, 0x61, 0x31, 0x5f, 0x52, 0x65, 0x73, 0x75, 0x6d, 0x65 };
+constexpr uint8_t kKDFS2RInfo[] = { 0x53, 0x69, 0x67, 0x6d, 0x61, 0x32, 0x5f, 0x52, 0x65, 0x73, 0x75, 0x6d, 0x65 };
+
+constexpr uint8_t kResumptionIdInfo[]     = { 0x52, 0x65, 0x73, 0x75, 0x6d, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44 };
+constexpr uint8_t kResumptionSecretInfo[] = { 0x52, 0x65, 0x73, 0x75, 0x6d, 0x70, 0x74, 0x69,
+                                              0x6f, 0x6e, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74 };
+
+constexpr size_t kSigmaR1ResumeLength = kSigmaParamRandomNumberSize + sizeof(uint16_t) + kCASEResumptionIdSize + kResumeMICSize;
+constexpr size_t kSigmaR2ResumeLength = sizeof(uint16_t) + kResumeMICSize;
+
+static_assert(kCASEResumptionSecretSize <= kMax_ECDH_Secret_Length, "Resumption secret must fit in the shared secret");
+
+// Compare MICs in constant time, so that a forged one does not reveal how many of its bytes are right.
+static bool ResumeMICsMatch(const uint8_t * a, const uint8_t * b)
+{
+    uint8_t diff = 0;
+    for (size_t i = 0; i < kResumeMICSize; i++)
+    {
+        diff = static_cast<uint8_t>(diff | (a[i] ^ b[i]));
+    }
+    return diff == 0;
+}
+
 using namespace Crypto;
 using namespace Credentials;
 using namespace Messaging;
@@ -91,6 +115,8 @@ void CASESession::Clear()
     mCommissioningHash.Clear();
     mPairingComplete = false;
     mConnectionState.Reset();
+    mAdmission.Release();
+    memset(&mResumptionTicket, 0, sizeof(mResumptionTicket));
     if (mTrustedRootId.mId != nullptr)
     {
         chip::Platform::MemoryFree(const_cast<uint8_t *>(mTrustedRootId.mId));
@@ -193,7 +219,8 @@ CHIP_ERROR CASESession::Init(OperationalCredentialSet * operationalCredentialSet
 
     ReturnErrorOnFailure(mCommissioningHash.Begin());
 
-    mDelegate = delegate;
+    mDelegate         = delegate;
+    mPeerRetryAfterMs = 0;
     mConnectionState.SetLocalKeyID(myKeyId);
     mOpCredSet = operationalCredentialSet;
 
@@ -237,7 +264,14 @@ CHIP_ERROR CASESession::EstablishSession(const Transport::PeerAddress peerAddres
     mConnectionState.SetPeerAddress(peerAddress);
     mConnectionState.SetPeerNodeId(peerNodeId);
 
-    err = SendSigmaR1();
+    if (mResumptionStorage != nullptr && mResumptionStorage->FindByNodeId(peerNodeId, mResumptionTicket) == CHIP_NO_ERROR)
+    {
+        err = SendSigmaR1Resume();
+    }
+    else
+    {
+        err = SendSigmaR1();
+    }
     SuccessOrExit(err);
 
 exit:
@@ -288,6 +322,17 @@ CHIP_ERROR CASESession::DeriveSecureSession(const uint8_t * info, size_t info_le
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::DeriveSecureSessions(const uint8_t * info1, size_t info1_len, SecureSession & session1,
+                                             const uint8_t * info2, size_t info2_len, SecureSession & session2)
+{
+    VerifyOrReturnError(mPairingComplete, CHIP_ERROR_INCORRECT_STATE);
+
+    // The salt is the message digest, as in DeriveSecureSession()
+    // TODO: Add IPK to Salt
+    return SecureSession::InitPairFromSecret(mSharedSecret, mSharedSecret.Length(), mMessageDigest, sizeof(mMessageDigest), info1,
+                                             info1_len, session1, info2, info2_len, session2);
+}
+
 CHIP_ERROR CASESession::SendSigmaR1()
 {
     uint16_t data_len = static_cast<uint16_t>(kSigmaParamRandomNumberSize + sizeof(uint16_t) + sizeof(uint16_t) +
@@ -799,6 +844,7 @@ CHIP_ERROR CASESession::SendSigmaR3()
     SuccessOrExit(err);
 
     mPairingComplete = true;
+    SaveResumptionTicket();
 
     // Call delegate to indicate pairing completion
     mDelegate->OnSessionEstablished();
@@ -889,6 +935,8 @@ CHIP_ERROR CASESession::HandleSigmaR3(const System::PacketBufferHandle & msg)
     SuccessOrExit(err);
 
     mPairingComplete = true;
+    mAdmission.Release();
+    SaveResumptionTicket();
 
     // Call delegate to indicate pairing completion
     mDelegate->OnSessionEstablished();
@@ -905,6 +953,267 @@ exit:
     return err;
 }
 
+CHIP_ERROR CASESession::SendSigmaR1Resume()
+{
+    System::PacketBufferHandle msg_R1_Resume;
+
+    msg_R1_Resume = System::PacketBufferHandle::New(kSigmaR1ResumeLength);
+    VerifyOrReturnError(!msg_R1_Resume.IsNull(), CHIP_SYSTEM_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(DRBG_get_bytes(mResumeRandom, sizeof(mResumeRandom)));
+
+    {
+        Encoding::LittleEndian::BufferWriter bbuf(msg_R1_Resume->Start(), kSigmaR1ResumeLength - kResumeMICSize);
+        bbuf.Put(mResumeRandom, sizeof(mResumeRandom));
+        // Initiator's session ID
+        bbuf.Put16(mConnectionState.GetLocalKeyID());
+        bbuf.Put(mResumptionTicket.mResumptionId, kCASEResumptionIdSize);
+        VerifyOrReturnError(bbuf.Fit(), CHIP_ERROR_NO_MEMORY);
+    }
+
+    // The MIC proves knowledge of the resumption secret, over all the fields before it
+    ReturnErrorOnFailure(ComputeResumeMIC(kKDFS1RInfo, sizeof(kKDFS1RInfo), msg_R1_Resume->Start(),
+                                          kSigmaR1ResumeLength - kResumeMICSize,
+                                          msg_R1_Resume->Start() + kSigmaR1ResumeLength - kResumeMICSize));
+
+    msg_R1_Resume->SetDataLength(kSigmaR1ResumeLength);
+
+    ReturnErrorOnFailure(mCommissioningHash.AddData(msg_R1_Resume->Start(), msg_R1_Resume->DataLength()));
+
+    mNextExpectedMsg = Protocols::SecureChannel::MsgType::CASE_SigmaR2Resume;
+
+    ReturnErrorOnFailure(mExchangeCtxt->SendMessage(Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume,
+                                                    std::move(msg_R1_Resume), SendFlags(SendMessageFlags::kExpectResponse)));
+
+    ChipLogDetail(Inet, "Sent SigmaR1Resume msg");
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigmaR1Resume_and_SendSigmaR2Resume(const System::PacketBufferHandle & msg)
+{
+    ReturnErrorOnFailure(HandleSigmaR1Resume(msg));
+    ReturnErrorOnFailure(SendSigmaR2Resume());
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigmaR1Resume(const System::PacketBufferHandle & msg)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    const uint8_t * buf = msg->Start();
+    uint16_t buflen     = msg->DataLength();
+    uint16_t encryptionKeyId;
+    uint8_t mic[kResumeMICSize];
+
+    VerifyOrExit(buf != nullptr, err = CHIP_ERROR_MESSAGE_INCOMPLETE);
+    VerifyOrExit(buflen == kSigmaR1ResumeLength, err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    ChipLogDetail(Inet, "Received SigmaR1Resume msg");
+
+    VerifyOrExit(mResumptionStorage != nullptr, err = CHIP_ERROR_KEY_NOT_FOUND);
+
+    memcpy(mResumeRandom, buf, sizeof(mResumeRandom));
+    buf += kSigmaParamRandomNumberSize;
+
+    encryptionKeyId = chip::Encoding::LittleEndian::Read16(buf);
+
+    err = mResumptionStorage->FindByResumptionId(buf, mResumptionTicket);
+    SuccessOrExit(err);
+
+    // The ticket was shared with the node that sent the message, if both are known
+    if (mConnectionState.GetPeerNodeId() != kUndefinedNodeId && mResumptionTicket.mPeerNodeId != kUndefinedNodeId)
+    {
+        VerifyOrExit(mConnectionState.GetPeerNodeId() == mResumptionTicket.mPeerNodeId, err = CHIP_ERROR_KEY_NOT_FOUND);
+    }
+
+    err = ComputeResumeMIC(kKDFS1RInfo, sizeof(kKDFS1RInfo), msg->Start(), kSigmaR1ResumeLength - kResumeMICSize, mic);
+    SuccessOrExit(err);
+    VerifyOrExit(ResumeMICsMatch(mic, msg->Start() + kSigmaR1ResumeLength - kResumeMICSize), err = CHIP_ERROR_KEY_NOT_FOUND);
+
+    err = mCommissioningHash.AddData(msg->Start(), msg->DataLength());
+    SuccessOrExit(err);
+
+    ChipLogDetail(Inet, "Peer assigned session key ID %d", encryptionKeyId);
+    mConnectionState.SetPeerKeyID(encryptionKeyId);
+    if (mConnectionState.GetPeerNodeId() == kUndefinedNodeId)
+    {
+        mConnectionState.SetPeerNodeId(mResumptionTicket.mPeerNodeId);
+    }
+    mNextExpectedMsg = Protocols::SecureChannel::MsgType::CASE_SigmaErr;
+
+exit:
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        SendErrorMsg(SigmaErrorType::kInvalidResumptionTag);
+    }
+    else if (err != CHIP_NO_ERROR)
+    {
+        SendErrorMsg(SigmaErrorType::kUnexpected);
+    }
+    return err;
+}
+
+CHIP_ERROR CASESession::SendSigmaR2Resume()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    System::PacketBufferHandle msg_R2_Resume;
+    uint8_t mic[kResumeMICSize];
+
+    msg_R2_Resume = System::PacketBufferHandle::New(kSigmaR2ResumeLength);
+    VerifyOrExit(!msg_R2_Resume.IsNull(), err = CHIP_SYSTEM_ERROR_NO_MEMORY);
+
+    err = ComputeSigmaR2ResumeMIC(mConnectionState.GetLocalKeyID(), mic);
+    SuccessOrExit(err);
+
+    {
+        Encoding::LittleEndian::BufferWriter bbuf(msg_R2_Resume->Start(), kSigmaR2ResumeLength);
+        // Responder's session ID
+        bbuf.Put16(mConnectionState.GetLocalKeyID());
+        bbuf.Put(mic, sizeof(mic));
+        VerifyOrExit(bbuf.Fit(), err = CHIP_ERROR_NO_MEMORY);
+    }
+
+    msg_R2_Resume->SetDataLength(kSigmaR2ResumeLength);
+
+    err = mCommissioningHash.AddData(msg_R2_Resume->Start(), msg_R2_Resume->DataLength());
+    SuccessOrExit(err);
+
+    err = mExchangeCtxt->SendMessage(Protocols::SecureChannel::MsgType::CASE_SigmaR2Resume, std::move(msg_R2_Resume),
+                                     SendFlags(SendMessageFlags::kNone));
+    SuccessOrExit(err);
+
+    ChipLogDetail(Inet, "Sent SigmaR2Resume msg");
+
+    err = CompleteSessionResumption();
+    SuccessOrExit(err);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendErrorMsg(SigmaErrorType::kUnexpected);
+    }
+    return err;
+}
+
+CHIP_ERROR CASESession::HandleSigmaR2Resume(const System::PacketBufferHandle & msg)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    const uint8_t * buf = msg->Start();
+    uint16_t buflen     = msg->DataLength();
+    uint16_t encryptionKeyId;
+    uint8_t mic[kResumeMICSize];
+
+    VerifyOrExit(buf != nullptr, err = CHIP_ERROR_MESSAGE_INCOMPLETE);
+    VerifyOrExit(buflen == kSigmaR2ResumeLength, err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    ChipLogDetail(Inet, "Received SigmaR2Resume msg");
+
+    mNextExpectedMsg = Protocols::SecureChannel::MsgType::CASE_SigmaErr;
+
+    encryptionKeyId = chip::Encoding::LittleEndian::Read16(buf);
+
+    err = ComputeSigmaR2ResumeMIC(encryptionKeyId, mic);
+    SuccessOrExit(err);
+    VerifyOrExit(ResumeMICsMatch(mic, buf), err = CHIP_ERROR_INVALID_SIGNATURE);
+
+    err = mCommissioningHash.AddData(msg->Start(), msg->DataLength());
+    SuccessOrExit(err);
+
+    ChipLogDetail(Inet, "Peer assigned session key ID %d", encryptionKeyId);
+    mConnectionState.SetPeerKeyID(encryptionKeyId);
+
+    err = CompleteSessionResumption();
+    SuccessOrExit(err);
+
+exit:
+    if (err == CHIP_ERROR_INVALID_SIGNATURE)
+    {
+        SendErrorMsg(SigmaErrorType::kInvalidSignature);
+    }
+    else if (err != CHIP_NO_ERROR)
+    {
+        SendErrorMsg(SigmaErrorType::kUnexpected);
+    }
+    return err;
+}
+
+CHIP_ERROR CASESession::ComputeResumeMIC(const uint8_t * info, size_t infoLen, const uint8_t * data, size_t dataLen,
+                                         uint8_t * mic)
+{
+    // The message is the HKDF info, so that the MIC is an HMAC keyed with the resumption secret.
+    // The label goes in the salt to separate the MICs of the two messages.
+    return HKDF_SHA256(mResumptionTicket.mSharedSecret, sizeof(mResumptionTicket.mSharedSecret), info, infoLen, data, dataLen,
+                       mic, kResumeMICSize);
+}
+
+CHIP_ERROR CASESession::ComputeSigmaR2ResumeMIC(uint16_t responderKeyId, uint8_t * mic)
+{
+    // Bind the responder's session ID to the initiator's random, so that the reply cannot be replayed
+    uint8_t data[kSigmaParamRandomNumberSize + sizeof(uint16_t)];
+
+    Encoding::LittleEndian::BufferWriter bbuf(data, sizeof(data));
+    bbuf.Put(mResumeRandom, sizeof(mResumeRandom));
+    bbuf.Put16(responderKeyId);
+    VerifyOrReturnError(bbuf.Fit(), CHIP_ERROR_NO_MEMORY);
+
+    return ComputeResumeMIC(kKDFS2RInfo, sizeof(kKDFS2RInfo), data, sizeof(data), mic);
+}
+
+CHIP_ERROR CASESession::CompleteSessionResumption()
+{
+    ReturnErrorOnFailure(mCommissioningHash.Finish(mMessageDigest));
+
+    // The session keys are derived from the resumption secret, in place of the ECDH shared secret of a full handshake
+    memcpy(mSharedSecret, mResumptionTicket.mSharedSecret, kCASEResumptionSecretSize);
+    mSharedSecret.SetLength(kCASEResumptionSecretSize);
+
+    mPairingComplete = true;
+    mAdmission.Release();
+
+    // A ticket is used once: replace it with the one derived from this session
+    mResumptionStorage->Delete(mResumptionTicket.mResumptionId);
+    SaveResumptionTicket();
+
+    // Call delegate to indicate pairing completion
+    mDelegate->OnSessionEstablished();
+
+    return CHIP_NO_ERROR;
+}
+
+void CASESession::SaveResumptionTicket()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    CASEResumptionTicket ticket;
+
+    VerifyOrReturn(mResumptionStorage != nullptr);
+
+    // Both peers derive the next ticket from this session's secret and transcript, so it changes with each session
+    ticket.mPeerNodeId = mConnectionState.GetPeerNodeId();
+
+    err = HKDF_SHA256(mSharedSecret, mSharedSecret.Length(), mMessageDigest, sizeof(mMessageDigest), kResumptionIdInfo,
+                      sizeof(kResumptionIdInfo), ticket.mResumptionId, sizeof(ticket.mResumptionId));
+    SuccessOrExit(err);
+
+    err = HKDF_SHA256(mSharedSecret, mSharedSecret.Length(), mMessageDigest, sizeof(mMessageDigest), kResumptionSecretInfo,
+                      sizeof(kResumptionSecretInfo), ticket.mSharedSecret, sizeof(ticket.mSharedSecret));
+    SuccessOrExit(err);
+
+    err = mResumptionStorage->Save(ticket);
+    SuccessOrExit(err);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        // The session is established regardless, the next one will just take a full handshake
+        ChipLogError(Inet, "Failed to save CASE resumption ticket: %s", ErrorStr(err));
+    }
+    memset(&ticket, 0, sizeof(ticket));
+}
+
 void CASESession::SendErrorMsg(SigmaErrorType errorCode)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1068,12 +1377,13 @@ CHIP_ERROR CASESession::SetEffectiveTime(void)
     return ASN1ToChipEpochTime(effectiveTime, mValidContext.mEffectiveTime);
 }
 
-void CASESession::HandleErrorMsg(const System::PacketBufferHandle & msg)
+CHIP_ERROR CASESession::HandleErrorMsg(const System::PacketBufferHandle & msg)
 {
     // Error message processing
     const uint8_t * buf  = msg->Start();
     size_t buflen        = msg->DataLength();
     SigmaErrorMsg * pMsg = nullptr;
+    CHIP_ERROR err       = CHIP_NO_ERROR;
 
     VerifyOrExit(buf != nullptr, ChipLogError(Inet, "Null error msg received during pairing"));
     static_assert(sizeof(SigmaErrorMsg) == sizeof(uint8_t),
@@ -1083,8 +1393,20 @@ void CASESession::HandleErrorMsg(const System::PacketBufferHandle & msg)
     pMsg = reinterpret_cast<SigmaErrorMsg *>(msg->Start());
     ChipLogError(Inet, "Received error (%d) during CASE pairing process", pMsg->error);
 
+    if (pMsg->error == SigmaErrorType::kInvalidResumptionTag &&
+        mNextExpectedMsg == Protocols::SecureChannel::MsgType::CASE_SigmaR2Resume)
+    {
+        // The responder does not know the ticket. Forget it, so that the next attempt runs a full handshake.
+        if (mResumptionStorage != nullptr)
+        {
+            mResumptionStorage->Delete(mResumptionTicket.mResumptionId);
+        }
+        err = CHIP_ERROR_INVALID_CASE_PARAMETER;
+    }
+
 exit:
     Clear();
+    return err;
 }
 
 CHIP_ERROR CASESession::ValidateReceivedMessage(ExchangeContext * ec, const PacketHeader & packetHeader,
@@ -1112,7 +1434,10 @@ CHIP_ERROR CASESession::ValidateReceivedMessage(ExchangeContext * ec, const Pack
 
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(payloadHeader.HasMessageType(mNextExpectedMsg) ||
-                            payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::CASE_SigmaErr),
+                            payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::CASE_SigmaErr) ||
+                            payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport) ||
+                            (mNextExpectedMsg == Protocols::SecureChannel::MsgType::CASE_SigmaR1 &&
+                             payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume)),
                         CHIP_ERROR_INVALID_MESSAGE_TYPE);
 
     if (packetHeader.GetSourceNodeId().HasValue())
@@ -1131,9 +1456,43 @@ CHIP_ERROR CASESession::ValidateReceivedMessage(ExchangeContext * ec, const Pack
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::HandleStatusReport(System::PacketBufferHandle msg)
+{
+    CHIP_ERROR err = SessionEstablishmentAdmission::ParseStatusReport(std::move(msg), mPeerRetryAfterMs);
+    if (err == CHIP_ERROR_BUSY)
+    {
+        ChipLogError(Inet, "Peer is busy, and asked for the session establishment to be retried in %u ms",
+                     static_cast<unsigned>(mPeerRetryAfterMs));
+    }
+    else
+    {
+        ChipLogError(Inet, "Received status report during session establishment");
+    }
+
+    Clear();
+    return err;
+}
+
 void CASESession::OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                     System::PacketBufferHandle msg)
 {
+    // A handshake started while this one is in progress, or past the budget of the node, is turned away without touching
+    // the state of the session. The reply is sent to the address of the message, which the handshake in progress gets back.
+    const bool isNewHandshake = ec != nullptr && ec != mExchangeCtxt &&
+        (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::CASE_SigmaR1) ||
+         payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume));
+    if (isNewHandshake &&
+        (mExchangeCtxt != nullptr ||
+         (mNextExpectedMsg == Protocols::SecureChannel::MsgType::CASE_SigmaR1 && !mAdmission.Admit())))
+    {
+        SessionEstablishmentAdmission::SendBusy(ec);
+        if (mExchangeCtxt != nullptr)
+        {
+            mMessageDispatch.SetPeerAddress(mConnectionState.GetPeerAddress());
+        }
+        return;
+    }
+
     CHIP_ERROR err = ValidateReceivedMessage(ec, packetHeader, payloadHeader, msg);
 
     if (err != CHIP_NO_ERROR)
@@ -1158,8 +1517,20 @@ void CASESession::OnMessageReceived(ExchangeContext * ec, const PacketHeader & p
         err = HandleSigmaR3(msg);
         break;
 
+    case Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume:
+        err = HandleSigmaR1Resume_and_SendSigmaR2Resume(msg);
+        break;
+
+    case Protocols::SecureChannel::MsgType::CASE_SigmaR2Resume:
+        err = HandleSigmaR2Resume(msg);
+        break;
+
     case Protocols::SecureChannel::MsgType::CASE_SigmaErr:
-        HandleErrorMsg(msg);
+        err = HandleErrorMsg(msg);
+        break;
+
+    case Protocols::SecureChannel::MsgType::StatusReport:
+        err = HandleStatusReport(std::move(msg));
         break;
 
     default:
@@ -1173,6 +1544,7 @@ exit:
     // Call delegate to indicate session establishment failure.
     if (err != CHIP_NO_ERROR)
     {
+        mAdmission.Release();
         mDelegate->OnSessionEstablishmentError(err);
     }
 }
@@ -30,7 +30,9 @@
 #include <crypto/CHIPCryptoPAL.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeDelegate.h>
+#include <protocols/secure_channel/CASEResumptionTable.h>
 #include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/SessionEstablishmentAdmission.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
 #include <support/Base64.h>
 #include <system/SystemPacketBuffer.h>
@@ -51,6 +53,8 @@ constexpr uint16_t kMaxTrustedRootIds          = 5;
 
 constexpr uint16_t kIPKSize = 32;
 
+constexpr uint16_t kResumeMICSize = 16;
+
 using namespace Crypto;
 using namespace Credentials;
 
@@ -124,6 +128,16 @@ public:
      */
     virtual CHIP_ERROR DeriveSecureSession(const uint8_t * info, size_t info_len, SecureSession & session) override;
 
+    /**
+     * @brief
+     *   Derive the two secure sessions of the established session, sharing the extract step
+     *   of their key derivations.
+     *
+     * @return CHIP_ERROR The result of session derivation
+     */
+    virtual CHIP_ERROR DeriveSecureSessions(const uint8_t * info1, size_t info1_len, SecureSession & session1,
+                                            const uint8_t * info2, size_t info2_len, SecureSession & session2) override;
+
     /**
      * @brief
      *  Return the associated secure session peer NodeId
@@ -154,6 +168,13 @@ public:
 
     Transport::PeerConnectionState & PeerConnection() { return mConnectionState; }
 
+    /**
+     * @brief
+     *  Return the wait, in milliseconds, the peer asked for before a retry, when it failed the last
+     *  session establishment with CHIP_ERROR_BUSY. It is 0 if the peer left the wait to the initiator.
+     */
+    uint16_t GetPeerRetryAfterMs() const { return mPeerRetryAfterMs; }
+
     /**
      * @brief Serialize the Pairing Session to a string.
      **/
@@ -174,6 +195,18 @@ public:
      **/
     CHIP_ERROR FromSerializable(const CASESessionSerializable & output);
 
+    /**
+     * @brief
+     *   Set the storage of the resumption tickets shared with peers. A ticket is saved each time a session is established, and
+     *   EstablishSession() then resumes the session with a SigmaR1Resume/SigmaR2Resume exchange, which takes a few HKDF and no
+     *   signature, ECDH or certificate validation. A responder also needs the storage to accept SigmaR1Resume. If the responder
+     *   does not know the ticket, session establishment fails with CHIP_ERROR_INVALID_CASE_PARAMETER and the ticket is forgotten,
+     *   so that the next attempt runs a full handshake.
+     *
+     * @param storage  The storage, or nullptr to always run the full handshake.
+     */
+    void SetResumptionStorage(CASEResumptionStorage * storage) { mResumptionStorage = storage; }
+
     SessionEstablishmentExchangeDispatch & MessageDispatch() { return mMessageDispatch; }
 
     //// ExchangeDelegate Implementation ////
@@ -208,7 +241,14 @@ private:
     CHIP_ERROR HandleSigmaR3(const System::PacketBufferHandle & msg);
 
     CHIP_ERROR SendSigmaR1Resume();
-    CHIP_ERROR HandleSigmaR1Resume_and_SendSigmaR2Resume(const PacketHeader & header, const System::PacketBufferHandle & msg);
+    CHIP_ERROR HandleSigmaR1Resume_and_SendSigmaR2Resume(const System::PacketBufferHandle & msg);
+    CHIP_ERROR HandleSigmaR1Resume(const System::PacketBufferHandle & msg);
+    CHIP_ERROR SendSigmaR2Resume();
+    CHIP_ERROR HandleSigmaR2Resume(const System::PacketBufferHandle & msg);
+    CHIP_ERROR ComputeResumeMIC(const uint8_t * info, size_t infoLen, const uint8_t * data, size_t dataLen, uint8_t * mic);
+    CHIP_ERROR ComputeSigmaR2ResumeMIC(uint16_t responderKeyId, uint8_t * mic);
+    CHIP_ERROR CompleteSessionResumption();
+    void SaveResumptionTicket();
 
     CHIP_ERROR FindValidTrustedRoot(const uint8_t ** msgIterator, uint32_t nTrustedRoots);
     CHIP_ERROR ConstructSaltSigmaR2(const System::PacketBufferHandle & rand, const P256PublicKey & pubkey, const uint8_t * ipk,
@@ -222,7 +262,8 @@ private:
     CHIP_ERROR ComputeIPK(const uint16_t sessionID, uint8_t * ipk, size_t ipkLen);
 
     void SendErrorMsg(SigmaErrorType errorCode);
-    void HandleErrorMsg(const System::PacketBufferHandle & msg);
+    CHIP_ERROR HandleErrorMsg(const System::PacketBufferHandle & msg);
+    CHIP_ERROR HandleStatusReport(System::PacketBufferHandle msg);
 
     // TODO: Remove this and replace with system method to retrieve current time
     CHIP_ERROR SetEffectiveTime(void);
@@ -250,9 +291,17 @@ private:
     uint8_t mIPK[kIPKSize];
     uint8_t mRemoteIPK[kIPKSize];
 
+    CASEResumptionStorage * mResumptionStorage = nullptr;
+    CASEResumptionTicket mResumptionTicket;
+    uint8_t mResumeRandom[kSigmaParamRandomNumberSize];
+
     Messaging::ExchangeContext * mExchangeCtxt = nullptr;
     SessionEstablishmentExchangeDispatch mMessageDispatch;
 
+    // Counts the handshake responded to against the budget of the node.
+    SessionEstablishmentAdmission mAdmission;
+    uint16_t mPeerRetryAfterMs = 0;
+
     struct SigmaErrorMsg
     {
         SigmaErrorType error;
@@ -63,10 +63,12 @@ enum class MsgType : uint8_t
     PASE_Spake2pError  = 0x2F,
 
     // Certificate-based session establishment Message Types
-    CASE_SigmaR1  = 0x30,
-    CASE_SigmaR2  = 0x31,
-    CASE_SigmaR3  = 0x32,
-    CASE_SigmaErr = 0x3F,
+    CASE_SigmaR1       = 0x30,
+    CASE_SigmaR2       = 0x31,
+    CASE_SigmaR3       = 0x32,
+    CASE_SigmaR1Resume = 0x33,
+    CASE_SigmaR2Resume = 0x34,
+    CASE_SigmaErr      = 0x3F,
 
     StatusReport = 0x40,
 };
@@ -77,6 +79,10 @@ constexpr uint16_t kProtocolCodeSuccess = 0x0000;
 // Placeholder value for the ProtocolCode field when there is no additional protocol-specific code to provide more information.
 constexpr uint16_t kProtocolCodeGeneralFailure = 0xFFFF;
 
+// ProtocolCode of a Busy status report turning a session establishment away. Its ProtocolData is the minimum time, in
+// milliseconds, the initiator is asked to wait before it retries, as a little-endian uint16.
+constexpr uint16_t kProtocolCodeBusy = 0x0004;
+
 /**
  * Status Report - General Status Codes used to convey protocol-agnostic status info.
  */
@@ -76,12 +76,21 @@ PASESession::~PASESession()
 
 void PASESession::Clear()
 {
+    // Make sure no worker thread still uses the state being cleared.
+    if (mCryptoWorkerPool != nullptr)
+    {
+        mCryptoWorkerPool->Cancel(mCryptoJob);
+    }
+
     // This function zeroes out and resets the memory used by the object.
     // It's done so that no security related information will be leaked.
     memset(&mPoint[0], 0, sizeof(mPoint));
+    memset(&mKeyConfirmation[0], 0, sizeof(mKeyConfirmation));
+    memset(&mPeerKeyConfirmation[0], 0, sizeof(mPeerKeyConfirmation));
     memset(&mPASEVerifier[0][0], 0, sizeof(mPASEVerifier));
     memset(&mKe[0], 0, sizeof(mKe));
-    mNextExpectedMsg = Protocols::SecureChannel::MsgType::PASE_Spake2pError;
+    mPBKDFParamResponse = nullptr;
+    mNextExpectedMsg    = Protocols::SecureChannel::MsgType::PASE_Spake2pError;
 
     // Note: we don't need to explicitly clear the state of mSpake2p object.
     //       Clearing the following state takes care of it.
@@ -98,6 +107,7 @@ void PASESession::Clear()
     mPairingComplete = false;
     mComputeVerifier = true;
     mConnectionState.Reset();
+    mAdmission.Release();
 
     if (mExchangeCtxt != nullptr)
     {
@@ -182,7 +192,8 @@ CHIP_ERROR PASESession::Init(uint16_t myKeyId, uint32_t setupCode, SessionEstabl
     ReturnErrorOnFailure(mCommissioningHash.Begin());
     ReturnErrorOnFailure(mCommissioningHash.AddData(Uint8::from_const_char(kSpake2pContext), strlen(kSpake2pContext)));
 
-    mDelegate = delegate;
+    mDelegate         = delegate;
+    mPeerRetryAfterMs = 0;
 
     ChipLogDetail(Ble, "Assigned local session key ID %d", myKeyId);
     mConnectionState.SetLocalKeyID(myKeyId);
@@ -329,6 +340,7 @@ void PASESession::OnResponseTimeout(ExchangeContext * ec)
                    ChipLogError(Ble, "PASESession::OnResponseTimeout exchange doesn't match"));
     ChipLogError(Ble, "PASESession timed out while waiting for a response from the peer. Expected message type was %d",
                  mNextExpectedMsg);
+    mAdmission.Release();
     mDelegate->OnSessionEstablishmentError(CHIP_ERROR_TIMEOUT);
 }
 
@@ -341,6 +353,14 @@ CHIP_ERROR PASESession::DeriveSecureSession(const uint8_t * info, size_t info_le
     return session.InitFromSecret(mKe, mKeLen, nullptr, 0, info, info_len);
 }
 
+CHIP_ERROR PASESession::DeriveSecureSessions(const uint8_t * info1, size_t info1_len, SecureSession & session1,
+                                             const uint8_t * info2, size_t info2_len, SecureSession & session2)
+{
+    VerifyOrReturnError(mPairingComplete, CHIP_ERROR_INCORRECT_STATE);
+
+    return SecureSession::InitPairFromSecret(mKe, mKeLen, nullptr, 0, info1, info1_len, session1, info2, info2_len, session2);
+}
+
 CHIP_ERROR PASESession::SendPBKDFParamRequest()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -409,8 +429,6 @@ CHIP_ERROR PASESession::SendPBKDFParamResponse()
     static_assert(CHAR_BIT == 8, "Assuming sizeof() returns octets here and for sizeof(mPoint)");
     size_t resplen = kPBKDFParamRandomNumberSize + sizeof(uint64_t) + sizeof(uint32_t) + mSaltLength;
 
-    size_t sizeof_point = sizeof(mPoint);
-
     uint8_t * msg = nullptr;
 
     resp = System::PacketBufferHandle::New(resplen);
@@ -434,12 +452,54 @@ CHIP_ERROR PASESession::SendPBKDFParamResponse()
 
     // Update commissioning hash with the pbkdf2 param response that's being sent.
     ReturnErrorOnFailure(mCommissioningHash.AddData(resp->Start(), resp->DataLength()));
+    mPBKDFParamResponse = std::move(resp);
+
+    if (UseCryptoWorkerPool())
+    {
+        return mCryptoWorkerPool->Post<PASESession, &PASESession::ComputePBKDFParamResponseWork,
+                                       &PASESession::SendPBKDFParamResponseComplete>(mCryptoJob, this);
+    }
+
+    ReturnErrorOnFailure(ComputePBKDFParamResponse());
+    return SendPBKDFParamResponseMessage();
+}
+
+void PASESession::ComputePBKDFParamResponseWork()
+{
+    mCryptoJobError = ComputePBKDFParamResponse();
+}
+
+void PASESession::SendPBKDFParamResponseComplete()
+{
+    CHIP_ERROR err = mCryptoJobError;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = SendPBKDFParamResponseMessage();
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendErrorMsg(Spake2pErrorType::kUnexpected);
+        mDelegate->OnSessionEstablishmentError(err);
+    }
+}
+
+CHIP_ERROR PASESession::ComputePBKDFParamResponse()
+{
+    size_t sizeof_point = sizeof(mPoint);
+
+    // L is kept in mPoint until msg1 is received.
     ReturnErrorOnFailure(SetupSpake2p(mIterationCount, mSalt, mSaltLength));
-    ReturnErrorOnFailure(mSpake2p.ComputeL(mPoint, &sizeof_point, &mPASEVerifier[1][0], kSpake2p_WS_Length));
+    return mSpake2p.ComputeL(mPoint, &sizeof_point, &mPASEVerifier[1][0], kSpake2p_WS_Length);
+}
 
+CHIP_ERROR PASESession::SendPBKDFParamResponseMessage()
+{
     mNextExpectedMsg = Protocols::SecureChannel::MsgType::PASE_Spake2p1;
 
-    ReturnErrorOnFailure(mExchangeCtxt->SendMessage(Protocols::SecureChannel::MsgType::PBKDFParamResponse, std::move(resp),
+    ReturnErrorOnFailure(mExchangeCtxt->SendMessage(Protocols::SecureChannel::MsgType::PBKDFParamResponse,
+                                                    std::move(mPBKDFParamResponse),
                                                     SendFlags(SendMessageFlags::kExpectResponse)));
     ChipLogDetail(Ble, "Sent PBKDF param response");
 
@@ -480,10 +540,28 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(const System::PacketBufferHandl
         err = mCommissioningHash.AddData(resp, resplen);
         SuccessOrExit(err);
 
+        if (UseCryptoWorkerPool())
+        {
+            // Keep the salt for the worker thread, the message is released before it runs.
+            VerifyOrExit(CanCastTo<uint16_t>(saltlen), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+            mSalt = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(saltlen));
+            VerifyOrExit(mSalt != nullptr, err = CHIP_ERROR_NO_MEMORY);
+            memcpy(mSalt, msgptr, saltlen);
+            mSaltLength     = static_cast<uint16_t>(saltlen);
+            mIterationCount = static_cast<uint32_t>(iterCount);
+
+            err = mCryptoWorkerPool->Post<PASESession, &PASESession::ComputeMsg1Work, &PASESession::SendMsg1Complete>(
+                mCryptoJob, this);
+            ExitNow();
+        }
+
         err = SetupSpake2p(static_cast<uint32_t>(iterCount), msgptr, saltlen);
         SuccessOrExit(err);
     }
 
+    err = ComputeMsg1();
+    SuccessOrExit(err);
+
     err = SendMsg1();
     SuccessOrExit(err);
 
@@ -495,20 +573,51 @@ exit:
     return err;
 }
 
-CHIP_ERROR PASESession::SendMsg1()
+void PASESession::ComputeMsg1Work()
+{
+    mCryptoJobError = SetupSpake2p(mIterationCount, mSalt, mSaltLength);
+    if (mCryptoJobError == CHIP_NO_ERROR)
+    {
+        mCryptoJobError = ComputeMsg1();
+    }
+}
+
+void PASESession::SendMsg1Complete()
+{
+    CHIP_ERROR err = mCryptoJobError;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = SendMsg1();
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendErrorMsg(Spake2pErrorType::kUnexpected);
+        mDelegate->OnSessionEstablishmentError(err);
+    }
+}
+
+CHIP_ERROR PASESession::ComputeMsg1()
 {
-    uint8_t X[kMAX_Point_Length];
-    size_t X_len = sizeof(X);
+    size_t X_len = sizeof(mPoint);
 
     ReturnErrorOnFailure(mSpake2p.BeginProver(nullptr, 0, nullptr, 0, &mPASEVerifier[0][0], kSpake2p_WS_Length,
                                               &mPASEVerifier[1][0], kSpake2p_WS_Length));
 
-    ReturnErrorOnFailure(mSpake2p.ComputeRoundOne(NULL, 0, X, &X_len));
+    // X is kept in mPoint until msg1 is sent.
+    ReturnErrorOnFailure(mSpake2p.ComputeRoundOne(NULL, 0, mPoint, &X_len));
+    VerifyOrReturnError(X_len == sizeof(mPoint), CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
 
-    Encoding::LittleEndian::PacketBufferWriter bbuf(System::PacketBufferHandle::New(sizeof(uint16_t) + X_len));
+CHIP_ERROR PASESession::SendMsg1()
+{
+    Encoding::LittleEndian::PacketBufferWriter bbuf(System::PacketBufferHandle::New(sizeof(uint16_t) + sizeof(mPoint)));
     VerifyOrReturnError(!bbuf.IsNull(), CHIP_SYSTEM_ERROR_NO_MEMORY);
     bbuf.Put16(mConnectionState.GetLocalKeyID());
-    bbuf.Put(&X[0], X_len);
+    bbuf.Put(&mPoint[0], sizeof(mPoint));
     VerifyOrReturnError(bbuf.Fit(), CHIP_ERROR_NO_MEMORY);
 
     mNextExpectedMsg = Protocols::SecureChannel::MsgType::PASE_Spake2p2;
@@ -595,16 +704,8 @@ CHIP_ERROR PASESession::HandleMsg2_and_SendMsg3(const System::PacketBufferHandle
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    uint8_t verifier[kMAX_Hash_Length];
-    size_t verifier_len_raw = kMAX_Hash_Length;
-    uint16_t verifier_len; // To be inited one we check length is small enough
-
-    uint8_t * buf  = msg->Start();
-    size_t buf_len = msg->DataLength();
-
-    System::PacketBufferHandle resp;
-
-    Spake2pErrorType spake2pErr = Spake2pErrorType::kUnexpected;
+    const uint8_t * buf = msg->Start();
+    size_t buf_len      = msg->DataLength();
 
     uint16_t encryptionKeyId = 0;
 
@@ -615,23 +716,84 @@ CHIP_ERROR PASESession::HandleMsg2_and_SendMsg3(const System::PacketBufferHandle
                  err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
     encryptionKeyId = chip::Encoding::LittleEndian::Read16(buf);
-    msg->ConsumeHead(sizeof(encryptionKeyId));
-    buf     = msg->Start();
-    buf_len = msg->DataLength();
 
     ChipLogDetail(Ble, "Peer assigned session key ID %d", encryptionKeyId);
     mConnectionState.SetPeerKeyID(encryptionKeyId);
 
-    err = mSpake2p.ComputeRoundTwo(buf, kMAX_Point_Length, verifier, &verifier_len_raw);
+    // Y is kept in mPoint and cB in mPeerKeyConfirmation until they are processed.
+    memcpy(mPoint, buf, kMAX_Point_Length);
+    memcpy(mPeerKeyConfirmation, &buf[kMAX_Point_Length], kMAX_Hash_Length);
+
+    if (UseCryptoWorkerPool())
+    {
+        err = mCryptoWorkerPool->Post<PASESession, &PASESession::ComputeMsg3Work, &PASESession::SendMsg3Complete>(mCryptoJob, this);
+        ExitNow();
+    }
+
+    err = ComputeMsg3();
     SuccessOrExit(err);
-    VerifyOrExit(CanCastTo<uint16_t>(verifier_len_raw), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
-    verifier_len = static_cast<uint16_t>(verifier_len_raw);
+
+    // SendMsg3() reports its own errors to the peer.
+    return SendMsg3();
+
+exit:
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendErrorMsg(Spake2pErrorType::kUnexpected);
+    }
+    return err;
+}
+
+void PASESession::ComputeMsg3Work()
+{
+    mCryptoJobError = ComputeMsg3();
+}
+
+void PASESession::SendMsg3Complete()
+{
+    CHIP_ERROR err = mCryptoJobError;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = SendMsg3();
+    }
+    else
+    {
+        SendErrorMsg(Spake2pErrorType::kUnexpected);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        mDelegate->OnSessionEstablishmentError(err);
+    }
+}
+
+CHIP_ERROR PASESession::ComputeMsg3()
+{
+    size_t verifier_len = sizeof(mKeyConfirmation);
+
+    ReturnErrorOnFailure(mSpake2p.ComputeRoundTwo(mPoint, kMAX_Point_Length, mKeyConfirmation, &verifier_len));
+    VerifyOrReturnError(CanCastTo<uint16_t>(verifier_len), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    mKeyConfirmationLength = static_cast<uint16_t>(verifier_len);
+
+    // The peer's confirmation is only checked once msg3 is sent.
+    mKeyConfirmError = mSpake2p.KeyConfirm(mPeerKeyConfirmation, kMAX_Hash_Length);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PASESession::SendMsg3()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Spake2pErrorType spake2pErr = Spake2pErrorType::kUnexpected;
 
     {
-        Encoding::PacketBufferWriter bbuf(System::PacketBufferHandle::New(verifier_len));
+        Encoding::PacketBufferWriter bbuf(System::PacketBufferHandle::New(mKeyConfirmationLength));
         VerifyOrExit(!bbuf.IsNull(), err = CHIP_SYSTEM_ERROR_NO_MEMORY);
 
-        bbuf.Put(verifier, verifier_len);
+        bbuf.Put(mKeyConfirmation, mKeyConfirmationLength);
         VerifyOrExit(bbuf.Fit(), err = CHIP_ERROR_NO_MEMORY);
 
         // Call delegate to send the Msg3 to peer
@@ -642,19 +804,15 @@ CHIP_ERROR PASESession::HandleMsg2_and_SendMsg3(const System::PacketBufferHandle
 
     ChipLogDetail(Ble, "Sent spake2p msg3");
 
+    if (mKeyConfirmError != CHIP_NO_ERROR)
     {
-        const uint8_t * hash = &buf[kMAX_Point_Length];
-        err                  = mSpake2p.KeyConfirm(hash, kMAX_Hash_Length);
-        if (err != CHIP_NO_ERROR)
-        {
-            spake2pErr = Spake2pErrorType::kInvalidKeyConfirmation;
-            SuccessOrExit(err);
-        }
-
-        err = mSpake2p.GetKeys(mKe, &mKeLen);
-        SuccessOrExit(err);
+        spake2pErr = Spake2pErrorType::kInvalidKeyConfirmation;
+        ExitNow(err = mKeyConfirmError);
     }
 
+    err = mSpake2p.GetKeys(mKe, &mKeLen);
+    SuccessOrExit(err);
+
     mPairingComplete = true;
 
     // Call delegate to indicate pairing completion
@@ -695,6 +853,7 @@ CHIP_ERROR PASESession::HandleMsg3(const System::PacketBufferHandle & msg)
     SuccessOrExit(err);
 
     mPairingComplete = true;
+    mAdmission.Release();
 
     // Call delegate to indicate pairing completion
     mDelegate->OnSessionEstablished();
@@ -751,16 +910,53 @@ exit:
     Clear();
 }
 
+CHIP_ERROR PASESession::HandleStatusReport(System::PacketBufferHandle msg)
+{
+    CHIP_ERROR err = SessionEstablishmentAdmission::ParseStatusReport(std::move(msg), mPeerRetryAfterMs);
+    if (err == CHIP_ERROR_BUSY)
+    {
+        ChipLogError(Ble, "Peer is busy, and asked for the pairing to be retried in %u ms",
+                     static_cast<unsigned>(mPeerRetryAfterMs));
+    }
+    else
+    {
+        ChipLogError(Ble, "Received status report during pairing process");
+    }
+
+    Clear();
+    return err;
+}
+
 void PASESession::OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                     System::PacketBufferHandle msg)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+    // A handshake started while this one is in progress, or past the budget of the node, is turned away without touching
+    // the state of the session. The reply is sent to the address of the message, which the handshake in progress gets back.
+    const bool isNewHandshake =
+        ec != nullptr && ec != mExchangeCtxt && payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::PBKDFParamRequest);
+    if (isNewHandshake &&
+        (mExchangeCtxt != nullptr ||
+         (mNextExpectedMsg == Protocols::SecureChannel::MsgType::PBKDFParamRequest && !mAdmission.Admit())))
+    {
+        SessionEstablishmentAdmission::SendBusy(ec);
+        if (mExchangeCtxt != nullptr)
+        {
+            mMessageDispatch.SetPeerAddress(mConnectionState.GetPeerAddress());
+        }
+        return;
+    }
+
+    // The session state belongs to a worker thread until its computation completes.
+    VerifyOrReturn(!mCryptoJob.IsPending(), ChipLogError(Ble, "Dropped message received during a PASE computation"));
+
     VerifyOrExit(ec != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(mExchangeCtxt == nullptr || mExchangeCtxt == ec, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(!msg.IsNull(), err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(payloadHeader.HasMessageType(mNextExpectedMsg) ||
-                     payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::PASE_Spake2pError),
+                     payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::PASE_Spake2pError) ||
+                     payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport),
                  err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
 
     if (mExchangeCtxt == nullptr)
@@ -797,6 +993,10 @@ void PASESession::OnMessageReceived(ExchangeContext * ec, const PacketHeader & p
         HandleErrorMsg(msg);
         break;
 
+    case Protocols::SecureChannel::MsgType::StatusReport:
+        err = HandleStatusReport(std::move(msg));
+        break;
+
     default:
         err = CHIP_ERROR_INVALID_MESSAGE_TYPE;
         break;
@@ -807,6 +1007,7 @@ exit:
     // Call delegate to indicate pairing failure
     if (err != CHIP_NO_ERROR)
     {
+        mAdmission.Release();
         mDelegate->OnSessionEstablishmentError(err);
     }
 }
@@ -34,9 +34,11 @@
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMessageDispatch.h>
 #include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/SessionEstablishmentAdmission.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
 #include <support/Base64.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemWorkerPool.h>
 #include <transport/PairingSession.h>
 #include <transport/PeerConnectionState.h>
 #include <transport/SecureSession.h>
@@ -137,6 +139,16 @@ public:
      */
     static CHIP_ERROR GeneratePASEVerifier(PASEVerifier & verifier, bool useRandomPIN, uint32_t & setupPIN);
 
+    /**
+     * @brief
+     *   Run the PBKDF2 and SPAKE2+ computations of the pairing on the threads of a worker pool, instead of the thread
+     *   receiving the messages, so that several sessions can be established in parallel. Messages received while a computation is
+     *   in progress are dropped. The pool must outlive the session.
+     *
+     * @param pool          The worker pool, or nullptr to compute inline
+     */
+    void SetCryptoWorkerPool(System::WorkerPool * pool) { mCryptoWorkerPool = pool; }
+
     /**
      * @brief
      *   Derive a secure session from the paired session. The API will return error
@@ -150,6 +162,16 @@ public:
      */
     CHIP_ERROR DeriveSecureSession(const uint8_t * info, size_t info_len, SecureSession & session) override;
 
+    /**
+     * @brief
+     *   Derive the two secure sessions of the paired session, sharing the extract step
+     *   of their key derivations.
+     *
+     * @return CHIP_ERROR The result of session derivation
+     */
+    CHIP_ERROR DeriveSecureSessions(const uint8_t * info1, size_t info1_len, SecureSession & session1, const uint8_t * info2,
+                                    size_t info2_len, SecureSession & session2) override;
+
     /**
      * @brief
      *  Return the associated peer key id
@@ -172,6 +194,13 @@ public:
 
     Transport::PeerConnectionState & PeerConnection() { return mConnectionState; }
 
+    /**
+     * @brief
+     *  Return the wait, in milliseconds, the peer asked for before a retry, when it failed the last
+     *  pairing with CHIP_ERROR_BUSY. It is 0 if the peer left the wait to the initiator.
+     */
+    uint16_t GetPeerRetryAfterMs() const { return mPeerRetryAfterMs; }
+
     /** @brief Serialize the Pairing Session to a string.
      *
      * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
@@ -255,14 +284,30 @@ private:
     CHIP_ERROR SendPBKDFParamResponse();
     CHIP_ERROR HandlePBKDFParamResponse(const System::PacketBufferHandle & msg);
 
+    CHIP_ERROR ComputeMsg1();
     CHIP_ERROR SendMsg1();
 
     CHIP_ERROR HandleMsg1_and_SendMsg2(const System::PacketBufferHandle & msg);
     CHIP_ERROR HandleMsg2_and_SendMsg3(const System::PacketBufferHandle & msg);
+    CHIP_ERROR ComputeMsg3();
+    CHIP_ERROR SendMsg3();
     CHIP_ERROR HandleMsg3(const System::PacketBufferHandle & msg);
 
     void SendErrorMsg(Spake2pErrorType errorCode);
     void HandleErrorMsg(const System::PacketBufferHandle & msg);
+    CHIP_ERROR HandleStatusReport(System::PacketBufferHandle msg);
+
+    bool UseCryptoWorkerPool() const { return mCryptoWorkerPool != nullptr && mCryptoWorkerPool->IsRunning(); }
+
+    CHIP_ERROR ComputePBKDFParamResponse();
+    CHIP_ERROR SendPBKDFParamResponseMessage();
+
+    void ComputePBKDFParamResponseWork();
+    void SendPBKDFParamResponseComplete();
+    void ComputeMsg1Work();
+    void SendMsg1Complete();
+    void ComputeMsg3Work();
+    void SendMsg3Complete();
 
     SessionEstablishmentDelegate * mDelegate = nullptr;
 
@@ -275,6 +320,12 @@ private:
 #endif
     uint8_t mPoint[kMAX_Point_Length];
 
+    /* cA sent in msg3, and cB received in msg2 */
+    uint8_t mKeyConfirmation[kMAX_Hash_Length];
+    uint16_t mKeyConfirmationLength = 0;
+    uint8_t mPeerKeyConfirmation[kMAX_Hash_Length];
+    CHIP_ERROR mKeyConfirmError = CHIP_NO_ERROR;
+
     /* w0s and w1s */
     PASEVerifier mPASEVerifier;
 
@@ -289,8 +340,17 @@ private:
 
     Messaging::ExchangeContext * mExchangeCtxt = nullptr;
 
+    System::WorkerPool * mCryptoWorkerPool = nullptr;
+    System::WorkerJob mCryptoJob;
+    CHIP_ERROR mCryptoJobError = CHIP_NO_ERROR;
+    System::PacketBufferHandle mPBKDFParamResponse; /* Held until the verifier is computed. */
+
     SessionEstablishmentExchangeDispatch mMessageDispatch;
 
+    /* Counts the handshake responded to against the budget of the node. */
+    SessionEstablishmentAdmission mAdmission;
+    uint16_t mPeerRetryAfterMs = 0;
+
     struct Spake2pErrorMsg
     {
         Spake2pErrorType error;
@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/SessionEstablishmentAdmission.h>
+
+#include <core/CHIPEncoding.h>
+#include <protocols/Protocols.h>
+#include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/StatusReport.h>
+#include <support/BufferWriter.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+namespace chip {
+
+using namespace Protocols::SecureChannel;
+
+size_t SessionEstablishmentAdmission::sInProgress = 0;
+
+bool SessionEstablishmentAdmission::Admit()
+{
+    VerifyOrReturnError(!mAdmitted, true);
+    VerifyOrReturnError(sInProgress < CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS, false);
+
+    sInProgress++;
+    mAdmitted = true;
+    return true;
+}
+
+void SessionEstablishmentAdmission::Release()
+{
+    VerifyOrReturn(mAdmitted);
+
+    sInProgress--;
+    mAdmitted = false;
+}
+
+uint16_t SessionEstablishmentAdmission::GetRetryAfterMs()
+{
+    const uint32_t handshakes   = static_cast<uint32_t>(sInProgress > 0 ? sInProgress : 1);
+    const uint32_t retryAfterMs = CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS * handshakes;
+    return static_cast<uint16_t>(retryAfterMs > UINT16_MAX ? UINT16_MAX : retryAfterMs);
+}
+
+CHIP_ERROR SessionEstablishmentAdmission::SendBusy(Messaging::ExchangeContext * ec)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    System::PacketBufferHandle msgBuf;
+    System::PacketBufferHandle retryAfter = System::PacketBufferHandle::New(sizeof(uint16_t));
+    VerifyOrExit(!retryAfter.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+
+    Encoding::LittleEndian::Put16(retryAfter->Start(), GetRetryAfterMs());
+    retryAfter->SetDataLength(sizeof(uint16_t));
+
+    {
+        StatusReport report(GeneralStatusCode::kBusy, Protocols::SecureChannel::Id.ToFullyQualifiedSpecForm(), kProtocolCodeBusy,
+                            std::move(retryAfter));
+        size_t msgSize = report.Size();
+        Encoding::LittleEndian::PacketBufferWriter bbuf(System::PacketBufferHandle::New(msgSize), msgSize);
+        VerifyOrExit(!bbuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+        report.WriteToBuffer(bbuf);
+        msgBuf = bbuf.Finalize();
+        VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    }
+
+    err = ec->SendMessage(MsgType::StatusReport, std::move(msgBuf), Messaging::SendFlags(Messaging::SendMessageFlags::kNone));
+    SuccessOrExit(err);
+
+    ChipLogProgress(Inet, "Turned a session establishment away as busy, for %u ms", static_cast<unsigned>(GetRetryAfterMs()));
+
+exit:
+    ec->Close();
+    return err;
+}
+
+CHIP_ERROR SessionEstablishmentAdmission::ParseStatusReport(System::PacketBufferHandle msg, uint16_t & retryAfterMs)
+{
+    StatusReport report;
+    ReturnErrorOnFailure(report.Parse(std::move(msg)));
+
+    VerifyOrReturnError(report.GetGeneralCode() == GeneralStatusCode::kBusy &&
+                            report.GetProtocolId() == Protocols::SecureChannel::Id.ToFullyQualifiedSpecForm() &&
+                            report.GetProtocolCode() == kProtocolCodeBusy,
+                        CHIP_ERROR_STATUS_REPORT_RECEIVED);
+
+    // A responder which gives no wait lets the initiator pick it
+    const System::PacketBufferHandle & retryAfter = report.GetProtocolData();
+    const bool hasRetryAfter                      = !retryAfter.IsNull() && retryAfter->DataLength() >= sizeof(uint16_t);
+    retryAfterMs                                  = hasRetryAfter ? Encoding::LittleEndian::Get16(retryAfter->Start()) : 0;
+    return CHIP_ERROR_BUSY;
+}
+
+} // namespace chip
@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the admission control of the session establishments a node responds to.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <core/CHIPError.h>
+#include <messaging/ExchangeContext.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * The PASE and CASE sessions of a node share a budget of CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS handshakes they
+ * respond to at once. The initiators of the handshakes past it are turned away with a Busy status report, which tells them
+ * how long to wait before they retry, rather than have the handshakes in progress aborted or starved of CPU.
+ *
+ * A responding session holds one of these, which counts its handshake against the budget from Admit() to Release().
+ */
+class SessionEstablishmentAdmission
+{
+public:
+    SessionEstablishmentAdmission() {}
+    ~SessionEstablishmentAdmission() { Release(); }
+
+    /**
+     * Count the handshake against the budget, if it is not already.
+     *
+     * @return false if the budget is spent on other handshakes.
+     */
+    bool Admit();
+
+    /**
+     * Give the slot of the handshake back to the budget, if it has one.
+     */
+    void Release();
+
+    bool IsAdmitted() const { return mAdmitted; }
+
+    /**
+     * The number of handshakes counted against the budget.
+     */
+    static size_t GetInProgress() { return sInProgress; }
+
+    /**
+     * The wait the initiators turned away are asked for, which is longer the more handshakes are in progress.
+     */
+    static uint16_t GetRetryAfterMs();
+
+    /**
+     * Turn the initiator of the exchange away as busy, then close the exchange.
+     */
+    static CHIP_ERROR SendBusy(Messaging::ExchangeContext * ec);
+
+    /**
+     * Parse a status report received from the responder of a session establishment.
+     *
+     * @param[in]  msg          The status report.
+     * @param[out] retryAfterMs The wait the responder asked for, if it was busy.
+     *
+     * @retval #CHIP_ERROR_BUSY                    if the responder was busy.
+     * @retval #CHIP_ERROR_STATUS_REPORT_RECEIVED  if it reported another failure.
+     */
+    static CHIP_ERROR ParseStatusReport(System::PacketBufferHandle msg, uint16_t & retryAfterMs);
+
+private:
+    static size_t sInProgress;
+
+    bool mAdmitted = false;
+};
+
+} // namespace chip
@@ -30,7 +30,8 @@ using namespace Messaging;
 
 CHIP_ERROR SessionEstablishmentExchangeDispatch::SendMessageImpl(SecureSessionHandle session, PayloadHeader & payloadHeader,
                                                                  System::PacketBufferHandle && message,
-                                                                 EncryptedPacketBufferHandle * retainedMessage)
+                                                                 EncryptedPacketBufferHandle * retainedMessage,
+                                                                 Transport::TrafficClass trafficClass)
 {
     PacketHeader packetHeader;
 
@@ -47,10 +48,11 @@ CHIP_ERROR SessionEstablishmentExchangeDispatch::SendMessageImpl(SecureSessionHa
 
 CHIP_ERROR SessionEstablishmentExchangeDispatch::OnMessageReceived(const PayloadHeader & payloadHeader, uint32_t messageId,
                                                                    const Transport::PeerAddress & peerAddress,
+                                                                   MessageFlags msgFlags,
                                                                    ReliableMessageContext * reliableMessageContext)
 {
     mPeerAddress = peerAddress;
-    return ExchangeMessageDispatch::OnMessageReceived(payloadHeader, messageId, peerAddress, reliableMessageContext);
+    return ExchangeMessageDispatch::OnMessageReceived(payloadHeader, messageId, peerAddress, msgFlags, reliableMessageContext);
 }
 
 bool SessionEstablishmentExchangeDispatch::MessagePermitted(uint16_t protocol, uint8_t type)
@@ -69,7 +71,10 @@ bool SessionEstablishmentExchangeDispatch::MessagePermitted(uint16_t protocol, u
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR1):
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR2):
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR3):
+        case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume):
+        case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaR2Resume):
         case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::CASE_SigmaErr):
+        case static_cast<uint8_t>(Protocols::SecureChannel::MsgType::StatusReport):
             return true;
 
         default:
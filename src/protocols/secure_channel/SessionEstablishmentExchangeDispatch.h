@@ -44,7 +44,7 @@ public:
     }
 
     CHIP_ERROR OnMessageReceived(const PayloadHeader & payloadHeader, uint32_t messageId,
-                                 const Transport::PeerAddress & peerAddress,
+                                 const Transport::PeerAddress & peerAddress, Messaging::MessageFlags msgFlags,
                                  Messaging::ReliableMessageContext * reliableMessageContext) override;
 
     const Transport::PeerAddress & GetPeerAddress() const { return mPeerAddress; }
@@ -53,7 +53,7 @@ public:
 
 protected:
     CHIP_ERROR SendMessageImpl(SecureSessionHandle session, PayloadHeader & payloadHeader, System::PacketBufferHandle && message,
-                               EncryptedPacketBufferHandle * retainedMessage) override;
+                               EncryptedPacketBufferHandle * retainedMessage, Transport::TrafficClass trafficClass) override;
 
     bool MessagePermitted(uint16_t protocol, uint8_t type) override;
 
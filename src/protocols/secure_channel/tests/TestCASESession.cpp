@@ -86,7 +86,7 @@ P256Keypair accessoryOpKeys;
 
 enum
 {
-    kStandardCertsCount = 4,
+    kStandardCertsCount = 8,    // Each full handshake also loads the peer certificate into the set
     kTestCertBufSize    = 1024, // Size of buffer needed to hold any of the test certificates
                                 // (in either CHIP or DER form), or to decode the certificates.
 };
@@ -247,6 +247,134 @@ void CASE_SecurePairingSerializeTest(nlTestSuite * inSuite, void * inContext)
     chip::Platform::Delete(testPairingSession2);
 }
 
+void CASE_SecurePairingResumeTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CASEResumptionTable commissionerTickets;
+    CASEResumptionTable accessoryTickets;
+    CASEResumptionTicket commissionerTicket;
+    CASEResumptionTicket accessoryTicket;
+
+    NL_TEST_ASSERT(inSuite, commissionerTickets.Init(nullptr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, accessoryTickets.Init(nullptr) == CHIP_NO_ERROR);
+
+    auto establish = [&](CASESession & pairingCommissioner, CASESession & pairingAccessory,
+                         TestCASESecurePairingDelegate & delegateCommissioner, TestCASESecurePairingDelegate & delegateAccessory) {
+        gLoopback.mSentMessageCount = 0;
+        NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, pairingAccessory.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+        pairingCommissioner.SetResumptionStorage(&commissionerTickets);
+        pairingAccessory.SetResumptionStorage(&accessoryTickets);
+
+        NL_TEST_ASSERT(inSuite,
+                       ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                           Protocols::SecureChannel::MsgType::CASE_SigmaR1, &pairingAccessory) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                           Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume, &pairingAccessory) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite,
+                       pairingAccessory.WaitForSessionEstablishment(&accessoryDevOpCred, 0, &delegateAccessory) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       pairingCommissioner.EstablishSession(Transport::PeerAddress(Transport::Type::kBle), &commissionerDevOpCred,
+                                                            1, 0, ctx.NewExchangeToLocal(&pairingCommissioner),
+                                                            &delegateCommissioner) == CHIP_NO_ERROR);
+
+        ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_SigmaR1);
+        ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_SigmaR1Resume);
+    };
+
+    // The first session takes the full handshake, and leaves both peers with the same ticket
+    {
+        TestCASESecurePairingDelegate delegateCommissioner;
+        TestCASESecurePairingDelegate delegateAccessory;
+        CASESession pairingCommissioner;
+        CASESession pairingAccessory;
+
+        establish(pairingCommissioner, pairingAccessory, delegateCommissioner, delegateAccessory);
+
+        NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 3);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+        NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    }
+
+    NL_TEST_ASSERT(inSuite, commissionerTickets.FindByNodeId(1, commissionerTicket) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   accessoryTickets.FindByResumptionId(commissionerTicket.mResumptionId, accessoryTicket) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   memcmp(commissionerTicket.mSharedSecret, accessoryTicket.mSharedSecret, sizeof(accessoryTicket.mSharedSecret)) ==
+                       0);
+
+    // The next one is resumed in two messages, and the resulting sessions talk to each other
+    {
+        TestCASESecurePairingDelegate delegateCommissioner;
+        TestCASESecurePairingDelegate delegateAccessory;
+        CASESession pairingCommissioner;
+        CASESession pairingAccessory;
+
+        establish(pairingCommissioner, pairingAccessory, delegateCommissioner, delegateAccessory);
+
+        NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 2);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+        NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+
+        const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90 };
+        uint8_t encrypted[64];
+        uint8_t decrypted[64];
+        PacketHeader header;
+        MessageAuthenticationCode mac;
+        SecureSession commissionerSession;
+        SecureSession accessorySession;
+
+        NL_TEST_ASSERT(inSuite,
+                       pairingCommissioner.DeriveSecureSession(Uint8::from_const_char("abc"), 3, commissionerSession) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       pairingAccessory.DeriveSecureSession(Uint8::from_const_char("abc"), 3, accessorySession) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       commissionerSession.Encrypt(plain_text, sizeof(plain_text), encrypted, header, mac) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, accessorySession.Decrypt(encrypted, sizeof(plain_text), decrypted, header, mac) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(plain_text, decrypted, sizeof(plain_text)) == 0);
+    }
+
+    // Resumption rotated the ticket
+    CASEResumptionTicket rotatedTicket;
+    NL_TEST_ASSERT(inSuite, commissionerTickets.FindByNodeId(1, rotatedTicket) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   memcmp(rotatedTicket.mResumptionId, commissionerTicket.mResumptionId, sizeof(rotatedTicket.mResumptionId)) != 0);
+    NL_TEST_ASSERT(inSuite, accessoryTickets.FindByResumptionId(rotatedTicket.mResumptionId, accessoryTicket) == CHIP_NO_ERROR);
+
+    // A responder that lost its tickets rejects the resumption, and the initiator forgets its ticket
+    accessoryTickets.Reset();
+    {
+        TestCASESecurePairingDelegate delegateCommissioner;
+        TestCASESecurePairingDelegate delegateAccessory;
+        CASESession pairingCommissioner;
+        CASESession pairingAccessory;
+
+        establish(pairingCommissioner, pairingAccessory, delegateCommissioner, delegateAccessory);
+
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 1);
+        NL_TEST_ASSERT(inSuite, commissionerTickets.FindByNodeId(1, rotatedTicket) == CHIP_ERROR_KEY_NOT_FOUND);
+    }
+
+    // So that the next attempt runs the full handshake again
+    {
+        TestCASESecurePairingDelegate delegateCommissioner;
+        TestCASESecurePairingDelegate delegateAccessory;
+        CASESession pairingCommissioner;
+        CASESession pairingAccessory;
+
+        establish(pairingCommissioner, pairingAccessory, delegateCommissioner, delegateAccessory);
+
+        NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 3);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+        NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    }
+}
+
 // Test Suite
 
 /**
@@ -259,6 +387,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Start",       CASE_SecurePairingStartTest),
     NL_TEST_DEF("Handshake",   CASE_SecurePairingHandshakeTest),
     NL_TEST_DEF("Serialize",   CASE_SecurePairingSerializeTest),
+    NL_TEST_DEF("Resume",      CASE_SecurePairingResumeTest),
 
     NL_TEST_SENTINEL()
 };
@@ -65,12 +65,17 @@ LoopbackTransport gLoopback;
 class TestSecurePairingDelegate : public SessionEstablishmentDelegate
 {
 public:
-    void OnSessionEstablishmentError(CHIP_ERROR error) override { mNumPairingErrors++; }
+    void OnSessionEstablishmentError(CHIP_ERROR error) override
+    {
+        mNumPairingErrors++;
+        mLastError = error;
+    }
 
     void OnSessionEstablished() override { mNumPairingComplete++; }
 
     uint32_t mNumPairingErrors   = 0;
     uint32_t mNumPairingComplete = 0;
+    CHIP_ERROR mLastError        = CHIP_NO_ERROR;
 };
 
 class MockAppDelegate : public ExchangeDelegate
@@ -166,6 +171,183 @@ void SecurePairingHandshakeTest(nlTestSuite * inSuite, void * inContext)
     SecurePairingHandshakeTestCommon(inSuite, inContext, pairingCommissioner, delegateCommissioner);
 }
 
+void SecurePairingHandshakeWithWorkerPoolTest(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // The pool is declared first, so that it outlives the sessions using it.
+    System::WorkerPool pool;
+    TestSecurePairingDelegate delegateCommissioner;
+    TestSecurePairingDelegate delegateAccessory;
+    PASESession pairingCommissioner;
+    PASESession pairingAccessory;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), 2) == CHIP_NO_ERROR);
+    pairingCommissioner.SetCryptoWorkerPool(&pool);
+    pairingAccessory.SetCryptoWorkerPool(&pool);
+
+    gLoopback.mSentMessageCount = 0;
+
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                       Protocols::SecureChannel::MsgType::PBKDFParamRequest, &pairingAccessory) == CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = ctx.NewExchangeToLocal(&pairingCommissioner);
+
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.WaitForPairing(1234, 500, (const uint8_t *) "saltSALT", 8, 0, &delegateAccessory) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.Pair(Transport::PeerAddress(Transport::Type::kBle), 1234, 0, contextCommissioner,
+                                            &delegateCommissioner) == CHIP_NO_ERROR);
+
+    // Only the PBKDF param request is sent inline, the response waits for the verifier computed on a worker thread.
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+
+    ctx.DriveIOUntil(5000, [&delegateCommissioner]() {
+        return delegateCommissioner.mNumPairingComplete + delegateCommissioner.mNumPairingErrors > 0;
+    });
+
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 5);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 0);
+
+    // Both ends derived the same keys.
+    const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90, 0xe1, 0x17, 0xa3, 0x2d, 0x4b, 0xd4, 0xe1, 0xe6 };
+    uint8_t encrypted[64];
+    uint8_t decrypted[64];
+    PacketHeader header;
+    MessageAuthenticationCode mac;
+    SecureSession session1;
+    SecureSession session2;
+
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.DeriveSecureSession(Uint8::from_const_char("abc"), 3, session1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.DeriveSecureSession(Uint8::from_const_char("abc"), 3, session2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, session1.Encrypt(plain_text, sizeof(plain_text), encrypted, header, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, session2.Decrypt(encrypted, sizeof(plain_text), decrypted, header, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(plain_text, decrypted, sizeof(plain_text)) == 0);
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void SecurePairingBusyTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    TestSecurePairingDelegate delegateCommissioner;
+    TestSecurePairingDelegate delegateAccessory;
+    PASESession pairingCommissioner;
+    PASESession pairingAccessory;
+
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                       Protocols::SecureChannel::MsgType::PBKDFParamRequest, &pairingAccessory) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.WaitForPairing(1234, 500, (const uint8_t *) "saltSALT", 8, 0, &delegateAccessory) ==
+                       CHIP_NO_ERROR);
+
+    // The other handshakes of the node spend the budget
+    {
+        SessionEstablishmentAdmission others[CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS];
+        for (SessionEstablishmentAdmission & other : others)
+        {
+            NL_TEST_ASSERT(inSuite, other.Admit());
+        }
+        NL_TEST_ASSERT(inSuite,
+                       SessionEstablishmentAdmission::GetInProgress() == CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS);
+
+        gLoopback.mSentMessageCount = 0;
+        ExchangeContext * context   = ctx.NewExchangeToLocal(&pairingCommissioner);
+        NL_TEST_ASSERT(inSuite,
+                       pairingCommissioner.Pair(Transport::PeerAddress(Transport::Type::kBle), 1234, 0, context,
+                                                &delegateCommissioner) == CHIP_NO_ERROR);
+
+        // The request is answered with a busy status report, and the accessory keeps waiting for a pairing
+        NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 2);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 1);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mLastError == CHIP_ERROR_BUSY);
+        NL_TEST_ASSERT(inSuite,
+                       pairingCommissioner.GetPeerRetryAfterMs() ==
+                           CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS * CHIP_CONFIG_MAX_CONCURRENT_SESSION_ESTABLISHMENTS);
+        NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 0);
+    }
+
+    // Once the budget is given back, the retry completes, and leaves none of it held
+    gLoopback.mSentMessageCount = 0;
+    ExchangeContext * context   = ctx.NewExchangeToLocal(&pairingCommissioner);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.Pair(Transport::PeerAddress(Transport::Type::kBle), 1234, 0, context,
+                                            &delegateCommissioner) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 5);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.GetPeerRetryAfterMs() == 0);
+    NL_TEST_ASSERT(inSuite, SessionEstablishmentAdmission::GetInProgress() == 0);
+}
+
+void SecurePairingBusyDuringHandshakeTest(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // The pool is declared first, so that it outlives the sessions using it.
+    System::WorkerPool pool;
+    TestSecurePairingDelegate delegateCommissioner;
+    TestSecurePairingDelegate delegateOther;
+    TestSecurePairingDelegate delegateAccessory;
+    PASESession pairingCommissioner;
+    PASESession pairingOther;
+    PASESession pairingAccessory;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&ctx.GetSystemLayer(), 2) == CHIP_NO_ERROR);
+    pairingAccessory.SetCryptoWorkerPool(&pool);
+
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingOther.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                       Protocols::SecureChannel::MsgType::PBKDFParamRequest, &pairingAccessory) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.WaitForPairing(1234, 500, (const uint8_t *) "saltSALT", 8, 0, &delegateAccessory) ==
+                       CHIP_NO_ERROR);
+
+    // The accessory computes its verifier on a worker thread, in the middle of the first handshake
+    ExchangeContext * contextCommissioner = ctx.NewExchangeToLocal(&pairingCommissioner);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.Pair(Transport::PeerAddress(Transport::Type::kBle), 1234, 0, contextCommissioner,
+                                            &delegateCommissioner) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, SessionEstablishmentAdmission::GetInProgress() == 1);
+
+    // A second commissioner is turned away, rather than have the first handshake aborted
+    ExchangeContext * contextOther = ctx.NewExchangeToLocal(&pairingOther);
+    NL_TEST_ASSERT(inSuite,
+                   pairingOther.Pair(Transport::PeerAddress(Transport::Type::kBle), 1234, 0, contextOther, &delegateOther) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, delegateOther.mLastError == CHIP_ERROR_BUSY);
+    NL_TEST_ASSERT(inSuite, pairingOther.GetPeerRetryAfterMs() == CHIP_CONFIG_SESSION_ESTABLISHMENT_BUSY_RETRY_MS);
+
+    ctx.DriveIOUntil(5000, [&delegateCommissioner]() {
+        return delegateCommissioner.mNumPairingComplete + delegateCommissioner.mNumPairingErrors > 0;
+    });
+
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 0);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 0);
+    NL_TEST_ASSERT(inSuite, SessionEstablishmentAdmission::GetInProgress() == 0);
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
 void SecurePairingDeserialize(nlTestSuite * inSuite, void * inContext, PASESession & pairingCommissioner,
                               PASESession & deserialized)
 {
@@ -234,6 +416,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("WaitInit",    SecurePairingWaitTest),
     NL_TEST_DEF("Start",       SecurePairingStartTest),
     NL_TEST_DEF("Handshake",   SecurePairingHandshakeTest),
+    NL_TEST_DEF("WorkerPool",  SecurePairingHandshakeWithWorkerPoolTest),
+    NL_TEST_DEF("Busy",        SecurePairingBusyTest),
+    NL_TEST_DEF("BusyDuringHandshake", SecurePairingBusyDuringHandshakeTest),
     NL_TEST_DEF("Serialize",   SecurePairingSerializeTest),
 
     NL_TEST_SENTINEL()
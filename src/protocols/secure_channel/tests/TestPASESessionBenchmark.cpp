@@ -0,0 +1,277 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a benchmark of PASE session establishment as done by a
+ *      commissioner. It runs batches of handshakes over a loopback
+ *      transport, first one at a time with the SPAKE2+ computations on
+ *      the CHIP thread, then in parallel with the computations of the
+ *      initiators on a System::WorkerPool, and prints the handshakes per
+ *      second of each. The assertions only check that every handshake
+ *      completed.
+ */
+
+#include <nlunit-test.h>
+
+#include <core/CHIPCore.h>
+#include <core/CHIPSafeCasts.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemWorkerPool.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+using namespace chip;
+using namespace chip::Transport;
+using namespace chip::Messaging;
+
+using TestContext = chip::Test::MessagingContext;
+
+namespace {
+
+// Each handshake holds an exchange on both ends until its sessions are cleared.
+constexpr size_t kNumSessions      = (CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2 < 8) ? CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2 : 8;
+constexpr size_t kNumBatches       = 4;
+constexpr size_t kMaxWorkers       = CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS;
+constexpr size_t kNumWorkers       = (kMaxWorkers < 4) ? kMaxWorkers : 4;
+constexpr uint32_t kSetupPINCode   = 20202021;
+constexpr uint32_t kIterationCount = 1000;
+constexpr unsigned kMaxWaitMs      = 30000;
+
+class LoopbackTransport : public Transport::Base
+{
+public:
+    CHIP_ERROR SendMessage(const PeerAddress & address, System::PacketBufferHandle msgBuf) override
+    {
+        HandleMessageReceived(address, std::move(msgBuf));
+        return CHIP_NO_ERROR;
+    }
+
+    bool CanSendToPeer(const PeerAddress & address) override { return true; }
+};
+
+TransportMgrBase gTransportMgr;
+LoopbackTransport gLoopback;
+
+class CountingDelegate : public SessionEstablishmentDelegate
+{
+public:
+    void OnSessionEstablishmentError(CHIP_ERROR error) override { mNumErrors++; }
+    void OnSessionEstablished() override { mNumComplete++; }
+
+    size_t mNumErrors   = 0;
+    size_t mNumComplete = 0;
+};
+
+/**
+ * Hands each pairing request to the next waiting accessory session, which then owns the exchange.
+ */
+class AccessoryDispatcher : public ExchangeDelegate
+{
+public:
+    void OnMessageReceived(ExchangeContext * ec, const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                           System::PacketBufferHandle buffer) override
+    {
+        VerifyOrReturn(mNextAccessory < kNumSessions, ec->Close());
+
+        PASESession & accessory = mAccessories[mNextAccessory++];
+        ec->SetDelegate(&accessory);
+        accessory.OnMessageReceived(ec, packetHeader, payloadHeader, std::move(buffer));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeMessageDispatch * GetMessageDispatch(ReliableMessageMgr * rmMgr, SecureSessionMgr * sessionMgr) override
+    {
+        return &mMessageDispatch;
+    }
+
+    SessionEstablishmentExchangeDispatch mMessageDispatch;
+    PASESession mAccessories[kNumSessions];
+    size_t mNextAccessory = 0;
+};
+
+struct BenchmarkContext
+{
+    TestContext mTestContext;
+    AccessoryDispatcher mDispatcher;
+    PASESession mCommissioners[kNumSessions];
+    CountingDelegate mAccessoryDelegate;
+    CountingDelegate mCommissionerDelegate;
+};
+
+// Heap allocated, the sessions are too large for the stack of some test targets.
+BenchmarkContext * gContext;
+
+void ResetSessions()
+{
+    for (size_t i = 0; i < kNumSessions; i++)
+    {
+        gContext->mCommissioners[i].Clear();
+        gContext->mDispatcher.mAccessories[i].Clear();
+    }
+    gContext->mDispatcher.mNextAccessory = 0;
+}
+
+/**
+ * Run kNumBatches batches of kNumSessions handshakes and return the elapsed time in microseconds.
+ */
+uint64_t RunHandshakes(nlTestSuite * inSuite, System::WorkerPool * pool)
+{
+    TestContext & ctx     = gContext->mTestContext;
+    uint64_t elapsed      = 0;
+    size_t expected       = 0;
+    bool started          = true;
+    CountingDelegate & cd = gContext->mCommissionerDelegate;
+
+    gContext->mAccessoryDelegate    = CountingDelegate();
+    gContext->mCommissionerDelegate = CountingDelegate();
+
+    for (size_t batch = 0; batch < kNumBatches; batch++)
+    {
+        for (PASESession & accessory : gContext->mDispatcher.mAccessories)
+        {
+            started &= (accessory.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+            started &= (accessory.WaitForPairing(kSetupPINCode, kIterationCount, Uint8::from_const_char("SPAKE2P Key Salt"), 16, 0,
+                                                 &gContext->mAccessoryDelegate) == CHIP_NO_ERROR);
+        }
+
+        const uint64_t begin = System::Layer::GetClock_MonotonicHiRes();
+
+        for (PASESession & commissioner : gContext->mCommissioners)
+        {
+            commissioner.SetCryptoWorkerPool(pool);
+            started &= (commissioner.MessageDispatch().Init(&gTransportMgr) == CHIP_NO_ERROR);
+            started &= (commissioner.Pair(PeerAddress(Transport::Type::kBle), kSetupPINCode, 0,
+                                          ctx.NewExchangeToLocal(&commissioner), &cd) == CHIP_NO_ERROR);
+        }
+
+        expected += kNumSessions;
+        ctx.DriveIOUntil(kMaxWaitMs, [&cd, expected]() { return cd.mNumComplete + cd.mNumErrors >= expected; });
+
+        elapsed += System::Layer::GetClock_MonotonicHiRes() - begin;
+
+        ResetSessions();
+    }
+
+    NL_TEST_ASSERT(inSuite, started);
+    NL_TEST_ASSERT(inSuite, cd.mNumComplete == expected);
+    NL_TEST_ASSERT(inSuite, gContext->mAccessoryDelegate.mNumComplete == expected);
+
+    return elapsed;
+}
+
+void PrintResult(const char * aName, uint64_t aElapsedUs)
+{
+    const size_t handshakes = kNumSessions * kNumBatches;
+
+    printf("    %-28s %8" PRIu64 " us total, %6" PRIu64 " handshakes/s (%u handshakes)\n", aName, aElapsedUs,
+           (aElapsedUs > 0) ? (handshakes * UINT64_C(1000000) / aElapsedUs) : 0, static_cast<unsigned>(handshakes));
+}
+
+void BenchmarkHandshakes(nlTestSuite * inSuite, void * inContext)
+{
+    PrintResult("Inline", RunHandshakes(inSuite, nullptr));
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    System::WorkerPool pool;
+    char name[32];
+
+    NL_TEST_ASSERT(inSuite, pool.Init(&gContext->mTestContext.GetSystemLayer(), kNumWorkers) == CHIP_NO_ERROR);
+    snprintf(name, sizeof(name), "%u worker threads", static_cast<unsigned>(kNumWorkers));
+    PrintResult(name, RunHandshakes(inSuite, &pool));
+
+    // The sessions must not refer to the pool once it is gone.
+    for (PASESession & commissioner : gContext->mCommissioners)
+    {
+        commissioner.SetCryptoWorkerPool(nullptr);
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("PASE::BenchmarkHandshakes", BenchmarkHandshakes),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSetup(void * inContext)
+{
+    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+
+    gContext = chip::Platform::New<BenchmarkContext>();
+    VerifyOrReturnError(gContext != nullptr, FAILURE);
+
+    TestContext & ctx = gContext->mTestContext;
+
+    gTransportMgr.Init(&gLoopback);
+    VerifyOrReturnError(ctx.Init(static_cast<nlTestSuite *>(inContext), &gTransportMgr) == CHIP_NO_ERROR, FAILURE);
+
+    ctx.SetSourceNodeId(kAnyNodeId);
+    ctx.SetDestinationNodeId(kAnyNodeId);
+    ctx.SetLocalKeyId(0);
+    ctx.SetPeerKeyId(0);
+    ctx.SetAdminId(kUndefinedAdminId);
+
+    gTransportMgr.SetSecureSessionMgr(&ctx.GetSecureSessionManager());
+
+    VerifyOrReturnError(gContext->mDispatcher.mMessageDispatch.Init(&gTransportMgr) == CHIP_NO_ERROR, FAILURE);
+    VerifyOrReturnError(ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                            Protocols::SecureChannel::MsgType::PBKDFParamRequest, &gContext->mDispatcher) == CHIP_NO_ERROR,
+                        FAILURE);
+
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    CHIP_ERROR err = gContext->mTestContext.Shutdown();
+
+    chip::Platform::Delete(gContext);
+    chip::Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+} // namespace
+
+int TestPASESessionBenchmark()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-pase-session-benchmark",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, &theSuite);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPASESessionBenchmark)
@@ -87,7 +87,8 @@ int main(int argc, char ** argv)
     /* Do getopt stuff for global options. */
     optind = 1;
 
-    while ((ch = getopt(argc, argv, "h")) != -1)
+    // Stop at the command name, so that the options following it are left to the command
+    while ((ch = getopt(argc, argv, "+h")) != -1)
     {
         switch (ch)
         {
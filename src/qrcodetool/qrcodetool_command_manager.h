@@ -37,6 +37,14 @@ qrcodetool_command_t commands[] = { { "generate-qr-code", setup_payload_operatio
                                       "[-f file-path]\n"
                                       "    -f File path of payload.\n",
                                       "Generate manual code from payload in text file." },
+
+                                    { "generate-batch", setup_payload_operation_generate_batch,
+                                      "-i file-path [-o file-path] [-v vendor-id] [-p product-id] [-r rendezvous-info]\n"
+                                      "    [-c pbkdf2-iterations] [-s salt] [-j threads]\n"
+                                      "    -i File path of the CSV of discriminator,setUpPINCode lines to read.\n"
+                                      "    -o File path of the CSV to write, standard output by default.\n"
+                                      "    -j Number of threads to compute with, one per core by default.\n",
+                                      "Generate the qr codes, manual codes and verifiers of the units in a CSV file." },
                                     // Last one
                                     {} };
 
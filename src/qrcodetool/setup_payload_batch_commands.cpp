@@ -0,0 +1,327 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the generate-batch command, which computes the
+ *      onboarding codes and Spake2+ verifiers of many units at once, for
+ *      manufacturing.
+ *
+ *      Each line of the input CSV gives the discriminator and setup PIN code
+ *      of a unit. The units are read in blocks, the codes and verifiers of a
+ *      block are computed across worker threads, and the block is written out
+ *      in the order it was read before the next one is read:
+ *
+ *        discriminator,setUpPINCode,qrCode,manualCode,verifier
+ *
+ *      where verifier is the hex encoded PBKDF2 output the device is
+ *      provisioned with.
+ */
+
+#include "setup_payload_commands.h"
+
+#include <core/CHIPEncoding.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <setup_payload/ManualSetupPayloadGenerator.h>
+#include <setup_payload/QRCodeSetupPayloadGenerator.h>
+#include <setup_payload/SetupPayload.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <atomic>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+// The PBKDF2 parameters PASESession derives the verifier with by default
+constexpr uint32_t kSpake2p_Iteration_Count = 100;
+const char * kSpake2pKeyExchangeSalt        = "SPAKE2P Key Salt";
+
+// The size of a PASEVerifier
+constexpr size_t kVerifierLength = 2 * (Crypto::kP256_FE_Length + 8);
+
+// The number of units read, computed and written at a time
+constexpr size_t kBlockSize = 4096;
+
+struct BatchOptions
+{
+    const char * inputPath  = nullptr;
+    const char * outputPath = nullptr;
+    uint16_t vendorID       = 0;
+    uint16_t productID      = 0;
+    RendezvousInformationFlags rendezvousInformation{ RendezvousInformationFlag::kBLE };
+    uint32_t iterationCount = kSpake2p_Iteration_Count;
+    const char * salt       = kSpake2pKeyExchangeSalt;
+    unsigned threadCount    = 0;
+};
+
+struct Unit
+{
+    size_t lineNumber;
+    uint16_t discriminator;
+    uint32_t setUpPINCode;
+    CHIP_ERROR error;
+    char qrCode[kQRCodeBase38RepresentationBufferSize];
+    std::string manualCode;
+    uint8_t verifier[kVerifierLength];
+};
+
+bool ParseUnsigned(const char * value, unsigned long maxValue, unsigned long & result)
+{
+    char * end;
+    if (value == nullptr || *value == '\0')
+    {
+        return false;
+    }
+    result = strtoul(value, &end, 0);
+    return *end == '\0' && result <= maxValue;
+}
+
+bool ParseOptions(int argc, char * const * argv, BatchOptions & options)
+{
+    unsigned long value;
+    int ch;
+
+    while ((ch = getopt(argc, argv, "i:o:v:p:r:c:s:j:")) != -1)
+    {
+        switch (ch)
+        {
+        case 'i':
+            options.inputPath = optarg;
+            break;
+        case 'o':
+            options.outputPath = optarg;
+            break;
+        case 'v':
+            VerifyOrReturnError(ParseUnsigned(optarg, UINT16_MAX, value), false);
+            options.vendorID = static_cast<uint16_t>(value);
+            break;
+        case 'p':
+            VerifyOrReturnError(ParseUnsigned(optarg, UINT16_MAX, value), false);
+            options.productID = static_cast<uint16_t>(value);
+            break;
+        case 'r':
+            VerifyOrReturnError(ParseUnsigned(optarg, UINT8_MAX, value), false);
+            options.rendezvousInformation = RendezvousInformationFlags(static_cast<RendezvousInformationFlag>(value));
+            break;
+        case 'c':
+            VerifyOrReturnError(ParseUnsigned(optarg, UINT32_MAX, value) && value > 0, false);
+            options.iterationCount = static_cast<uint32_t>(value);
+            break;
+        case 's':
+            options.salt = optarg;
+            break;
+        case 'j':
+            VerifyOrReturnError(ParseUnsigned(optarg, 1024, value) && value > 0, false);
+            options.threadCount = static_cast<unsigned>(value);
+            break;
+        case '?':
+        default:
+            return false;
+        }
+    }
+
+    return options.inputPath != nullptr;
+}
+
+// Parses a "discriminator,setUpPINCode" line into unit. Returns false for an empty line or a comment.
+bool ParseLine(char * line, Unit & unit, bool & valid)
+{
+    unsigned long discriminator;
+    unsigned long setUpPINCode;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] == '\0' || line[0] == '#')
+    {
+        return false;
+    }
+
+    char * comma = strchr(line, ',');
+    valid        = comma != nullptr;
+    if (valid)
+    {
+        *comma = '\0';
+        valid  = ParseUnsigned(line, kMaxDiscriminatorValue, discriminator) && ParseUnsigned(comma + 1, UINT32_MAX, setUpPINCode);
+    }
+    if (valid)
+    {
+        unit.discriminator = static_cast<uint16_t>(discriminator);
+        unit.setUpPINCode  = static_cast<uint32_t>(setUpPINCode);
+    }
+    return true;
+}
+
+CHIP_ERROR ComputeUnit(const BatchOptions & options, Unit & unit)
+{
+    SetupPayload payload;
+    payload.version               = 0;
+    payload.vendorID              = options.vendorID;
+    payload.productID             = options.productID;
+    payload.rendezvousInformation = options.rendezvousInformation;
+    payload.discriminator         = unit.discriminator;
+    payload.setUpPINCode          = unit.setUpPINCode;
+
+    MutableCharSpan qrCode(unit.qrCode);
+    ReturnErrorOnFailure(QRCodeSetupPayloadGenerator(payload).payloadBase38Representation(qrCode));
+    ReturnErrorOnFailure(ManualSetupPayloadGenerator(payload).payloadDecimalStringRepresentation(unit.manualCode));
+
+    // As PASESession::ComputePASEVerifier
+    Crypto::PBKDF2_sha256 pbkdf;
+    uint8_t littleEndianSetupPINCode[sizeof(uint32_t)];
+    Encoding::LittleEndian::Put32(littleEndianSetupPINCode, unit.setUpPINCode);
+    return pbkdf.pbkdf2_sha256(littleEndianSetupPINCode, sizeof(littleEndianSetupPINCode),
+                               reinterpret_cast<const uint8_t *>(options.salt), strlen(options.salt), options.iterationCount,
+                               sizeof(unit.verifier), unit.verifier);
+}
+
+// Computes the units across threadCount threads, each taking the next unit not computed yet.
+void ComputeUnits(const BatchOptions & options, std::vector<Unit> & units, unsigned threadCount)
+{
+    std::atomic<size_t> next{ 0 };
+    auto work = [&]() {
+        for (size_t i = next++; i < units.size(); i = next++)
+        {
+            units[i].error = ComputeUnit(options, units[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+}
+
+bool WriteUnits(FILE * output, const std::vector<Unit> & units)
+{
+    for (const Unit & unit : units)
+    {
+        if (unit.error != CHIP_NO_ERROR)
+        {
+            ChipLogError(chipTool, "Line %zu: failed to generate the codes: %s", unit.lineNumber, ErrorStr(unit.error));
+            return false;
+        }
+
+        fprintf(output, "%u,%" PRIu32 ",%s,%s,", unit.discriminator, unit.setUpPINCode, unit.qrCode, unit.manualCode.c_str());
+        for (uint8_t byte : unit.verifier)
+        {
+            fprintf(output, "%02x", byte);
+        }
+        fputc('\n', output);
+    }
+    return ferror(output) == 0;
+}
+
+int GenerateBatch(const BatchOptions & options)
+{
+    FILE * input   = nullptr;
+    FILE * output  = stdout;
+    int result     = 0;
+    size_t line    = 0;
+    size_t written = 0;
+    unsigned threadCount;
+    char buffer[128];
+    std::vector<Unit> units;
+
+    threadCount = (options.threadCount != 0) ? options.threadCount : std::thread::hardware_concurrency();
+    threadCount = (threadCount != 0) ? threadCount : 1;
+
+    input = fopen(options.inputPath, "r");
+    VerifyOrExit(input != nullptr, ChipLogError(chipTool, "Can't open %s", options.inputPath); result = 2);
+    if (options.outputPath != nullptr)
+    {
+        output = fopen(options.outputPath, "w");
+        VerifyOrExit(output != nullptr, ChipLogError(chipTool, "Can't create %s", options.outputPath); result = 2);
+    }
+
+    units.reserve(kBlockSize);
+    for (bool endOfInput = false; !endOfInput;)
+    {
+        units.clear();
+        while (units.size() < kBlockSize)
+        {
+            Unit unit;
+            bool valid;
+
+            if (fgets(buffer, sizeof(buffer), input) == nullptr)
+            {
+                endOfInput = true;
+                break;
+            }
+            line++;
+            if (!ParseLine(buffer, unit, valid))
+            {
+                continue;
+            }
+            // A header line is skipped, as is any first line that is not a unit
+            if (!valid && line == 1)
+            {
+                continue;
+            }
+            VerifyOrExit(valid, ChipLogError(chipTool, "Line %zu: expected discriminator,setUpPINCode", line); result = 2);
+
+            unit.lineNumber = line;
+            units.push_back(std::move(unit));
+        }
+
+        ComputeUnits(options, units, threadCount);
+        VerifyOrExit(WriteUnits(output, units), result = 2);
+        written += units.size();
+    }
+
+    ChipLogDetail(chipTool, "Generated the codes of %zu units", written);
+
+exit:
+    if (input != nullptr)
+    {
+        fclose(input);
+    }
+    if (output != nullptr && output != stdout && fclose(output) != 0)
+    {
+        result = 2;
+    }
+    return result;
+}
+
+} // namespace
+
+extern int setup_payload_operation_generate_batch(int argc, char * const * argv)
+{
+    ChipLogDetail(chipTool, "setup_payload_operation_generate_batch\n");
+
+    BatchOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        return 2;
+    }
+
+    return GenerateBatch(options);
+}
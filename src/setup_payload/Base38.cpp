@@ -33,6 +33,8 @@
 
 #include <climits>
 
+#include <support/CodeUtils.h>
+
 namespace {
 
 static const char kCodes[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I',
@@ -111,9 +113,13 @@ static inline CHIP_ERROR decodeChar(char c, uint8_t & value)
 
 namespace chip {
 
-std::string base38Encode(const uint8_t * buf, size_t buf_len)
+CHIP_ERROR base38Encode(ByteSpan in_buf, MutableCharSpan & out_buf)
 {
-    std::string result;
+    const uint8_t * buf = in_buf.data();
+    size_t buf_len      = in_buf.size();
+    size_t out_idx      = 0;
+
+    VerifyOrReturnError(out_buf.size() > base38EncodedLength(buf_len), CHIP_ERROR_BUFFER_TOO_SMALL);
 
     while (buf_len > 0)
     {
@@ -134,19 +140,22 @@ std::string base38Encode(const uint8_t * buf, size_t buf_len)
 
         for (uint8_t character = 0; character < base38CharactersNeeded; character++)
         {
-            result += kCodes[value % kRadix];
+            out_buf.data()[out_idx++] = kCodes[value % kRadix];
             value /= kRadix;
         }
     }
-    return result;
+
+    out_buf.data()[out_idx] = '\0';
+    out_buf.reduce_size(out_idx);
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+CHIP_ERROR base38Decode(CharSpan base38, MutableByteSpan & out_buf)
 {
-    result.clear();
+    const char * in_buf           = base38.data();
+    size_t base38CharactersNumber = base38.size();
+    size_t out_idx                = 0;
 
-    int base38CharactersNumber  = static_cast<int>(base38.length());
-    int decodedBase38Characters = 0;
     while (base38CharactersNumber > 0)
     {
         uint8_t base38CharactersInChunk;
@@ -177,24 +186,44 @@ CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
         for (int i = (base38CharactersInChunk - 1); i >= 0; i--)
         {
             uint8_t v;
-            CHIP_ERROR err = decodeChar(base38[static_cast<uint8_t>(decodedBase38Characters + i)], v);
-
-            if (err != CHIP_NO_ERROR)
-            {
-                return err;
-            }
+            ReturnErrorOnFailure(decodeChar(in_buf[i], v));
 
             value = value * kRadix + v;
         }
-        decodedBase38Characters += base38CharactersInChunk;
+        in_buf += base38CharactersInChunk;
         base38CharactersNumber -= base38CharactersInChunk;
 
+        VerifyOrReturnError(out_buf.size() - out_idx >= bytesInDecodedChunk, CHIP_ERROR_BUFFER_TOO_SMALL);
         for (int i = 0; i < bytesInDecodedChunk; i++)
         {
-            result.push_back(static_cast<uint8_t>(value >> (8 * i)));
+            out_buf.data()[out_idx++] = static_cast<uint8_t>(value >> (8 * i));
         }
     }
+
+    out_buf.reduce_size(out_idx);
     return CHIP_NO_ERROR;
 }
 
+std::string base38Encode(const uint8_t * buf, size_t buf_len)
+{
+    std::string result(base38EncodedLength(buf_len) + 1, '\0');
+    MutableCharSpan out(&result[0], result.size());
+
+    // The buffer is sized for the encoding, which can't fail
+    base38Encode(ByteSpan(buf, buf_len), out);
+    result.resize(out.size());
+    return result;
+}
+
+CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+{
+    result.clear();
+    result.resize(base38DecodedLength(base38.length()));
+
+    MutableByteSpan out(result.data(), result.size());
+    CHIP_ERROR err = base38Decode(CharSpan(base38.data(), base38.length()), out);
+    result.resize(err == CHIP_NO_ERROR ? out.size() : 0);
+    return err;
+}
+
 } // namespace chip
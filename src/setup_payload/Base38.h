@@ -23,14 +23,56 @@
 #pragma once
 
 #include <core/CHIPError.h>
+#include <support/Span.h>
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string>
 #include <vector>
 
 namespace chip {
+
+// The number of base38 characters num_bytes bytes are encoded to: 5 for every 3 bytes, and 2 or 4 for the last 1 or 2.
+constexpr size_t base38EncodedLength(size_t num_bytes)
+{
+    return (num_bytes / 3) * 5 + (num_bytes % 3) * 2;
+}
+
+// The most bytes num_chars base38 characters may decode to.
+constexpr size_t base38DecodedLength(size_t num_chars)
+{
+    return (num_chars / 5) * 3 + (num_chars % 5) / 2;
+}
+
 // returns CHIP_NO_ERROR on successful decode
 CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & out);
 std::string base38Encode(const uint8_t * buf, size_t buf_len);
 
+/**
+ * Encode a buffer to base38, without allocating.
+ *
+ * @param[in]     in_buf   The bytes to encode.
+ * @param[in,out] out_buf  The buffer to write the characters to, followed by a null terminator, so it needs room for at least
+ *                         base38EncodedLength(in_buf.size()) + 1 characters. On success, its size is reduced to the number
+ *                         of characters written, not counting the terminator.
+ *
+ * @retval #CHIP_NO_ERROR                 on success.
+ * @retval #CHIP_ERROR_BUFFER_TOO_SMALL   if out_buf can't hold the encoded characters and the terminator.
+ */
+CHIP_ERROR base38Encode(ByteSpan in_buf, MutableCharSpan & out_buf);
+
+/**
+ * Decode a base38 string, without allocating.
+ *
+ * @param[in]     base38   The characters to decode, which need not be null terminated.
+ * @param[in,out] out_buf  The buffer to write the decoded bytes to, base38DecodedLength(base38.size()) bytes at most. On
+ *                         success, its size is reduced to the number of bytes written.
+ *
+ * @retval #CHIP_NO_ERROR                      on success.
+ * @retval #CHIP_ERROR_INVALID_STRING_LENGTH   if the number of characters can't be the result of an encoding.
+ * @retval #CHIP_ERROR_INVALID_INTEGER_VALUE   if a character is not in the base38 alphabet.
+ * @retval #CHIP_ERROR_BUFFER_TOO_SMALL        if out_buf can't hold the decoded bytes.
+ */
+CHIP_ERROR base38Decode(CharSpan base38, MutableByteSpan & out_buf);
+
 } // namespace chip
@@ -36,6 +36,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <utility>
 
 namespace chip {
 
@@ -192,20 +193,23 @@ static CHIP_ERROR generateBitSet(SetupPayload & payload, uint8_t * bits, uint8_t
 #pragma GCC diagnostic ignored "-Wstack-usage="
 #endif
 
-static CHIP_ERROR payloadBase38RepresentationWithTLV(SetupPayload & setupPayload, std::string & base38Representation,
-                                                     size_t bitsetSize, uint8_t * tlvDataStart, size_t tlvDataLengthInBytes)
+static CHIP_ERROR payloadBase38RepresentationWithTLV(SetupPayload & setupPayload, MutableCharSpan & outBuffer, size_t bitsetSize,
+                                                     uint8_t * tlvDataStart, size_t tlvDataLengthInBytes)
 {
     uint8_t bits[bitsetSize];
     memset(bits, 0, bitsetSize);
-    std::string encodedPayload;
-    CHIP_ERROR err = generateBitSet(setupPayload, bits, tlvDataStart, tlvDataLengthInBytes);
-    SuccessOrExit(err);
+    const size_t prefixLength = strlen(kQRCodePrefix);
+    MutableCharSpan encoded;
 
-    encodedPayload = base38Encode(bits, ArraySize(bits));
-    encodedPayload.insert(0, kQRCodePrefix);
-    base38Representation = encodedPayload;
-exit:
-    return err;
+    ReturnErrorOnFailure(generateBitSet(setupPayload, bits, tlvDataStart, tlvDataLengthInBytes));
+
+    VerifyOrReturnError(outBuffer.size() > prefixLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(outBuffer.data(), kQRCodePrefix, prefixLength);
+
+    encoded = MutableCharSpan(outBuffer.data() + prefixLength, outBuffer.size() - prefixLength);
+    ReturnErrorOnFailure(base38Encode(ByteSpan(bits, bitsetSize), encoded));
+    outBuffer.reduce_size(prefixLength + encoded.size());
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR QRCodeSetupPayloadGenerator::payloadBase38Representation(std::string & base38Representation)
@@ -220,19 +224,46 @@ CHIP_ERROR QRCodeSetupPayloadGenerator::payloadBase38Representation(std::string
 {
     CHIP_ERROR err              = CHIP_NO_ERROR;
     size_t tlvDataLengthInBytes = 0;
+    size_t bitsetSize;
+    std::string encodedPayload;
+    MutableCharSpan outBuffer;
 
     VerifyOrExit(mPayload.isValidQRCodePayload(), err = CHIP_ERROR_INVALID_ARGUMENT);
     err = generateTLVFromOptionalData(mPayload, tlvDataStart, tlvDataStartSize, tlvDataLengthInBytes);
     SuccessOrExit(err);
 
-    err = payloadBase38RepresentationWithTLV(mPayload, base38Representation, kTotalPayloadDataSizeInBytes + tlvDataLengthInBytes,
-                                             tlvDataStart, tlvDataLengthInBytes);
+    bitsetSize = kTotalPayloadDataSizeInBytes + tlvDataLengthInBytes;
+    encodedPayload.resize(strlen(kQRCodePrefix) + base38EncodedLength(bitsetSize) + 1);
+    outBuffer = MutableCharSpan(&encodedPayload[0], encodedPayload.size());
+
+    err = payloadBase38RepresentationWithTLV(mPayload, outBuffer, bitsetSize, tlvDataStart, tlvDataLengthInBytes);
     SuccessOrExit(err);
+    encodedPayload.resize(outBuffer.size());
+    base38Representation = std::move(encodedPayload);
 
 exit:
     return err;
 }
 
+CHIP_ERROR QRCodeSetupPayloadGenerator::payloadBase38Representation(MutableCharSpan & outBuffer)
+{
+    // 6.1.2.2. Table: Packed Binary Data Structure
+    // The TLV Data should be 0 length if TLV is not included.
+    return payloadBase38Representation(outBuffer, nullptr, 0);
+}
+
+CHIP_ERROR QRCodeSetupPayloadGenerator::payloadBase38Representation(MutableCharSpan & outBuffer, uint8_t * tlvDataStart,
+                                                                    uint32_t tlvDataStartSize)
+{
+    size_t tlvDataLengthInBytes = 0;
+
+    VerifyOrReturnError(mPayload.isValidQRCodePayload(), CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(generateTLVFromOptionalData(mPayload, tlvDataStart, tlvDataStartSize, tlvDataLengthInBytes));
+
+    return payloadBase38RepresentationWithTLV(mPayload, outBuffer, kTotalPayloadDataSizeInBytes + tlvDataLengthInBytes,
+                                              tlvDataStart, tlvDataLengthInBytes);
+}
+
 #if !defined(__clang__)
 #pragma GCC diagnostic pop // -Wstack-usage
 #endif
@@ -27,14 +27,21 @@
  *        single byte is encoded to 2 characters of the Base-38 alphabet.
  */
 
+#include "Base38.h"
 #include "SetupPayload.h"
 
+#include <support/Span.h>
+
 #include <string>
 
 #pragma once
 
 namespace chip {
 
+// The size of a buffer for the base38 representation of a payload with no optional data, prefix and null terminator included
+constexpr size_t kQRCodeBase38RepresentationBufferSize =
+    sizeof(kQRCodePrefix) - 1 + base38EncodedLength(kTotalPayloadDataSizeInBytes) + 1;
+
 class QRCodeSetupPayloadGenerator
 {
 private:
@@ -82,6 +89,32 @@ public:
      */
     CHIP_ERROR payloadBase38Representation(std::string & base38Representation, uint8_t * tlvDataStart, uint32_t tlvDataStartSize);
 
+    /**
+     * This function is called to encode the binary data of a payload to a
+     * null terminated base38 string, without allocating. A payload with no
+     * optional data fits in kQRCodeBase38RepresentationBufferSize characters.
+     *
+     * @param[in,out] outBuffer
+     *                  The buffer to copy the base38 to. On success, its size
+     *                  is reduced to the length of the string, not counting
+     *                  the null terminator.
+     *
+     * @retval #CHIP_NO_ERROR if the method succeeded.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if the payload is invalid.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if the string doesn't fit in outBuffer.
+     * @retval other Other CHIP or platform-specific error codes indicating
+     *               that an error occurred preventing the function from
+     *               producing the requested string.
+     */
+    CHIP_ERROR payloadBase38Representation(MutableCharSpan & outBuffer);
+
+    /**
+     * As payloadBase38Representation(MutableCharSpan &), for a payload with
+     * optional data, whose TLV is written to the tlvDataStartSize bytes at
+     * tlvDataStart.
+     */
+    CHIP_ERROR payloadBase38Representation(MutableCharSpan & outBuffer, uint8_t * tlvDataStart, uint32_t tlvDataStartSize);
+
 private:
     CHIP_ERROR generateTLVFromOptionalData(SetupPayload & outPayload, uint8_t * tlvDataStart, uint32_t maxLen,
                                            size_t & tlvDataLengthInBytes);
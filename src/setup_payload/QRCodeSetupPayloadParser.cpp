@@ -41,13 +41,16 @@
 
 namespace chip {
 
+// Decoded payloads up to this size are parsed from the stack, larger ones from the heap
+constexpr size_t kMaxStackPayloadSizeInBytes = 128;
+
 // Populate numberOfBits into dest from buf starting at startIndex
-static CHIP_ERROR readBits(std::vector<uint8_t> buf, size_t & index, uint64_t & dest, size_t numberOfBitsToRead)
+static CHIP_ERROR readBits(ByteSpan buf, size_t & index, uint64_t & dest, size_t numberOfBitsToRead)
 {
     dest = 0;
     if (index + numberOfBitsToRead > buf.size() * 8 || numberOfBitsToRead > sizeof(uint64_t) * 8)
     {
-        ChipLogError(SetupPayload, "Error parsing QR code. startIndex %d numberOfBitsToLoad %zu buf_len %zu ", index,
+        ChipLogError(SetupPayload, "Error parsing QR code. startIndex %zu numberOfBitsToLoad %zu buf_len %zu ", index,
                      numberOfBitsToRead, buf.size());
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
@@ -55,9 +58,9 @@ static CHIP_ERROR readBits(std::vector<uint8_t> buf, size_t & index, uint64_t &
     size_t currentIndex = index;
     for (size_t bitsRead = 0; bitsRead < numberOfBitsToRead; bitsRead++)
     {
-        if (buf[currentIndex / 8] & (1 << (currentIndex % 8)))
+        if (buf.data()[currentIndex / 8] & (1 << (currentIndex % 8)))
         {
-            dest |= (1 << bitsRead);
+            dest |= (UINT64_C(1) << bitsRead);
         }
         currentIndex++;
     }
@@ -256,7 +259,8 @@ exit:
     return err;
 }
 
-CHIP_ERROR QRCodeSetupPayloadParser::parseTLVFields(SetupPayload & outPayload, uint8_t * tlvDataStart, size_t tlvDataLengthInBytes)
+CHIP_ERROR QRCodeSetupPayloadParser::parseTLVFields(SetupPayload & outPayload, const uint8_t * tlvDataStart,
+                                                    size_t tlvDataLengthInBytes)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     if (!CanCastTo<uint32_t>(tlvDataLengthInBytes))
@@ -288,75 +292,70 @@ exit:
     return err;
 }
 
-CHIP_ERROR QRCodeSetupPayloadParser::populateTLV(SetupPayload & outPayload, const std::vector<uint8_t> & buf, size_t & index)
+CHIP_ERROR QRCodeSetupPayloadParser::populateTLV(SetupPayload & outPayload, ByteSpan buf, size_t & index)
 {
-    size_t bitsLeftToRead = (buf.size() * 8) - index;
-    size_t tlvBytesLength = (bitsLeftToRead + 7) / 8; // ceil(bitsLeftToRead/8)
-    chip::Platform::ScopedMemoryBuffer<uint8_t> tlvArray;
+    // The TLV data follows the fixed fields, which fill whole bytes, so it is parsed in place
+    static_assert(kTotalPayloadDataSizeInBits % 8 == 0, "The TLV data must start on a byte boundary");
+    VerifyOrReturnError(index % 8 == 0 && index <= buf.size() * 8, CHIP_ERROR_INVALID_ARGUMENT);
 
+    size_t tlvBytesLength = buf.size() - index / 8;
     ReturnErrorCodeIf(tlvBytesLength == 0, CHIP_NO_ERROR);
 
-    tlvArray.Alloc(tlvBytesLength);
-    ReturnErrorCodeIf(!tlvArray, CHIP_ERROR_NO_MEMORY);
-
-    for (size_t i = 0; i < tlvBytesLength; i++)
-    {
-        uint64_t dest;
-        readBits(buf, index, dest, 8);
-        tlvArray[i] = static_cast<uint8_t>(dest);
-    }
-
-    return parseTLVFields(outPayload, tlvArray.Get(), tlvBytesLength);
+    const uint8_t * tlvDataStart = buf.data() + index / 8;
+    index += tlvBytesLength * 8;
+    return parseTLVFields(outPayload, tlvDataStart, tlvBytesLength);
 }
 
-static std::string extractPayload(std::string inString)
+// Find the first segment between '%' delimiters that starts with kQRCodePrefix, and return it without the prefix
+static CharSpan extractPayload(CharSpan inString)
 {
-    std::string chipSegment;
-    char delimiter = '%';
-    std::vector<size_t> startIndices;
-    startIndices.push_back(0);
+    const size_t prefixLength = strlen(kQRCodePrefix);
+    size_t startIndex         = 0;
 
-    for (size_t i = 0; i < inString.length(); i++)
+    while (startIndex <= inString.size())
     {
-        if (inString[i] == delimiter)
+        size_t endIndex = startIndex;
+        while (endIndex < inString.size() && inString.data()[endIndex] != '%')
         {
-            startIndices.push_back(i + 1);
+            endIndex++;
         }
-    }
-
-    // Find the first string between delimiters that starts with kQRCodePrefix
-    for (size_t i = 0; i < startIndices.size(); i++)
-    {
-        size_t startIndex   = startIndices[i];
-        size_t endIndex     = (i == startIndices.size() - 1 ? std::string::npos : startIndices[i + 1] - 1);
-        size_t length       = (endIndex != std::string::npos ? endIndex - startIndex : std::string::npos);
-        std::string segment = inString.substr(startIndex, length);
 
-        // Find a segment that starts with kQRCodePrefix
-        if (segment.find(kQRCodePrefix, 0) == 0 && segment.length() > strlen(kQRCodePrefix))
+        const char * segment = inString.data() + startIndex;
+        size_t segmentLength = endIndex - startIndex;
+        if (segmentLength > prefixLength && memcmp(segment, kQRCodePrefix, prefixLength) == 0)
         {
-            chipSegment = segment;
-            break;
+            return CharSpan(segment + prefixLength, segmentLength - prefixLength);
         }
+        startIndex = endIndex + 1;
     }
 
-    if (chipSegment.length() > 0)
-    {
-        return chipSegment.substr(strlen(kQRCodePrefix)); // strip out prefix before returning
-    }
-
-    return chipSegment;
+    return CharSpan();
 }
 
 CHIP_ERROR QRCodeSetupPayloadParser::populatePayload(SetupPayload & outPayload)
 {
-    std::vector<uint8_t> buf;
+    uint8_t stackBuffer[kMaxStackPayloadSizeInBytes];
+    chip::Platform::ScopedMemoryBuffer<uint8_t> heapBuffer;
+    MutableByteSpan buf;
     CHIP_ERROR err         = CHIP_NO_ERROR;
     size_t indexToReadFrom = 0;
     uint64_t dest;
 
-    std::string payload = extractPayload(mBase38Representation);
-    VerifyOrExit(payload.length() != 0, err = CHIP_ERROR_INVALID_ARGUMENT);
+    CharSpan base38 = (mBase38Buffer.data() != nullptr) ? mBase38Buffer
+                                                        : CharSpan(mBase38Representation.data(), mBase38Representation.length());
+    CharSpan payload = extractPayload(base38);
+    VerifyOrExit(payload.size() != 0, err = CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (base38DecodedLength(payload.size()) <= sizeof(stackBuffer))
+    {
+        buf = MutableByteSpan(stackBuffer);
+    }
+    else
+    {
+        heapBuffer.Alloc(base38DecodedLength(payload.size()));
+        VerifyOrExit(heapBuffer, err = CHIP_ERROR_NO_MEMORY);
+        buf = MutableByteSpan(heapBuffer.Get(), base38DecodedLength(payload.size()));
+    }
 
     err = base38Decode(payload, buf);
     SuccessOrExit(err);
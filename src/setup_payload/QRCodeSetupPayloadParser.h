@@ -25,6 +25,7 @@
 
 #include <core/CHIPError.h>
 #include <core/CHIPTLV.h>
+#include <support/Span.h>
 
 #include <string>
 #include <utility>
@@ -39,15 +40,25 @@ class QRCodeSetupPayloadParser
 {
 private:
     std::string mBase38Representation;
+    CharSpan mBase38Buffer;
 
 public:
     QRCodeSetupPayloadParser(std::string base38Representation) : mBase38Representation(std::move(base38Representation)) {}
+
+    /**
+     * Parse the base38Length characters at base38Representation, which need not be null terminated, without copying them.
+     * The buffer must outlive the parser. Unless the payload holds optional data, populatePayload() then uses no heap.
+     */
+    QRCodeSetupPayloadParser(const char * base38Representation, size_t base38Length) :
+        mBase38Buffer(base38Representation, base38Length)
+    {}
+
     CHIP_ERROR populatePayload(SetupPayload & outPayload);
 
 private:
     CHIP_ERROR retrieveOptionalInfos(SetupPayload & outPayload, TLV::TLVReader & reader);
-    CHIP_ERROR populateTLV(SetupPayload & outPayload, const std::vector<uint8_t> & buf, size_t & index);
-    CHIP_ERROR parseTLVFields(chip::SetupPayload & outPayload, uint8_t * tlvDataStart, size_t tlvDataLengthInBytes);
+    CHIP_ERROR populateTLV(SetupPayload & outPayload, ByteSpan buf, size_t & index);
+    CHIP_ERROR parseTLVFields(chip::SetupPayload & outPayload, const uint8_t * tlvDataStart, size_t tlvDataLengthInBytes);
 };
 
 } // namespace chip
@@ -83,7 +83,7 @@ const int kTotalPayloadDataSizeInBits =
 
 const int kTotalPayloadDataSizeInBytes = kTotalPayloadDataSizeInBits / 8;
 
-const char * const kQRCodePrefix = "CH:";
+constexpr char kQRCodePrefix[] = "CH:";
 
 /// The rendezvous type this device supports.
 enum class RendezvousInformationFlag : uint16_t
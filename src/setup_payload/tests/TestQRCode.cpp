@@ -191,6 +191,35 @@ void TestBase38(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, decoded.size() == 2 && decoded[0] + decoded[1] * 256 == (kRadix * kRadix) - 1);
 }
 
+void TestBase38Span(nlTestSuite * inSuite, void * inContext)
+{
+    const uint8_t input[] = { 'H', 'e', 'l', 'l', 'o', ' ', 'W', 'o', 'r', 'l', 'd', '!' };
+    char encodedBuffer[base38EncodedLength(sizeof(input)) + 1];
+    uint8_t decodedBuffer[base38DecodedLength(sizeof(encodedBuffer) - 1)];
+
+    MutableCharSpan encoded(encodedBuffer);
+    NL_TEST_ASSERT(inSuite, base38Encode(ByteSpan(input), encoded) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, encoded.size() == strlen("KKHF3W2S013OPM3EJX11"));
+    NL_TEST_ASSERT(inSuite, strcmp(encodedBuffer, "KKHF3W2S013OPM3EJX11") == 0);
+
+    MutableByteSpan decoded(decodedBuffer);
+    NL_TEST_ASSERT(inSuite, base38Decode(CharSpan(encoded.data(), encoded.size()), decoded) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, decoded.size() == sizeof(input));
+    NL_TEST_ASSERT(inSuite, memcmp(decodedBuffer, input, sizeof(input)) == 0);
+
+    // The buffers must hold the whole result, and the terminator of the encoding
+    MutableCharSpan shortEncoded(encodedBuffer, sizeof(encodedBuffer) - 1);
+    NL_TEST_ASSERT(inSuite, base38Encode(ByteSpan(input), shortEncoded) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    MutableByteSpan shortDecoded(decodedBuffer, sizeof(input) - 1);
+    NL_TEST_ASSERT(inSuite, base38Decode(CharSpan("KKHF3W2S013OPM3EJX11", 20), shortDecoded) == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // The characters to decode need not be null terminated
+    MutableByteSpan partial(decodedBuffer);
+    NL_TEST_ASSERT(inSuite, base38Decode(CharSpan("KKHF3W2S01", 5), partial) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, partial.size() == 3);
+    NL_TEST_ASSERT(inSuite, memcmp(decodedBuffer, "Hel", 3) == 0);
+}
+
 void TestBitsetLen(nlTestSuite * inSuite, void * inContext)
 {
     NL_TEST_ASSERT(inSuite, kTotalPayloadDataSizeInBits % 8 == 0);
@@ -296,6 +325,39 @@ void TestQRCodeToPayloadGeneration(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, result == true);
 }
 
+void TestQRCodeToPayloadGenerationWithoutHeap(nlTestSuite * inSuite, void * inContext)
+{
+    SetupPayload payload = GetDefaultPayload();
+
+    char base38Buffer[kQRCodeBase38RepresentationBufferSize];
+    MutableCharSpan base38Rep(base38Buffer);
+    QRCodeSetupPayloadGenerator generator(payload);
+    NL_TEST_ASSERT(inSuite, generator.payloadBase38Representation(base38Rep) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, base38Rep.size() == kQRCodeBase38RepresentationBufferSize - 1);
+
+    string base38String;
+    NL_TEST_ASSERT(inSuite, generator.payloadBase38Representation(base38String) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, base38String == string(base38Buffer));
+
+    MutableCharSpan shortBase38Rep(base38Buffer, kQRCodeBase38RepresentationBufferSize - 1);
+    NL_TEST_ASSERT(inSuite, generator.payloadBase38Representation(shortBase38Rep) == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Parse the code without its terminator, from within a larger buffer
+    char delimited[sizeof(base38Buffer) + 2];
+    snprintf(delimited, sizeof(delimited), "%s%%Z", base38String.c_str());
+
+    SetupPayload resultingPayload;
+    QRCodeSetupPayloadParser parser(delimited, strlen(delimited));
+    NL_TEST_ASSERT(inSuite, parser.populatePayload(resultingPayload) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, payload == resultingPayload);
+}
+
+string extractPayload(const string & inString)
+{
+    CharSpan payload = chip::extractPayload(CharSpan(inString.data(), inString.length()));
+    return string(payload.data(), payload.size());
+}
+
 void TestExtractPayload(nlTestSuite * inSuite, void * inContext)
 {
     NL_TEST_ASSERT(inSuite, extractPayload(string("CH:ABC")) == string("ABC"));
@@ -327,6 +389,7 @@ const nlTest sTests[] =
 {
     NL_TEST_DEF("Test Rendezvous Flags",                                            TestRendezvousFlags),
     NL_TEST_DEF("Test Base 38",                                                     TestBase38),
+    NL_TEST_DEF("Test Base 38 Span",                                                TestBase38Span),
     NL_TEST_DEF("Test Bitset Length",                                               TestBitsetLen),
     NL_TEST_DEF("Test Payload Byte Array Representation",                           TestPayloadByteArrayRep),
     NL_TEST_DEF("Test Payload Base 38 Representation",                              TestPayloadBase38Rep),
@@ -334,6 +397,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test Payload Equality",                                            TestPayloadEquality),
     NL_TEST_DEF("Test Payload Inequality",                                          TestPayloadInEquality),
     NL_TEST_DEF("Test QRCode to Payload Generation",                                TestQRCodeToPayloadGeneration),
+    NL_TEST_DEF("Test QRCode to Payload Generation Without Heap",                   TestQRCodeToPayloadGenerationWithoutHeap),
     NL_TEST_DEF("Test Invalid QR Code Payload - Wrong Character Set",               TestInvalidQRCodePayload_WrongCharacterSet),
     NL_TEST_DEF("Test Invalid QR Code Payload - Wrong  Length",                     TestInvalidQRCodePayload_WrongLength),
     NL_TEST_DEF("Test Extract Payload",                                             TestExtractPayload),
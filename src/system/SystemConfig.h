@@ -366,6 +366,9 @@
  *          20 -- Crypto Trailer
  *
  *      The size of PacketBuffer structure does not need to be included in this value.
+ *
+ *      Messages over TCP are not bound by the path MTU, only by this value (and by their 16-bit length): a larger value allows,
+ *      for example, larger BDX Blocks over TCP, at the price of a larger allocation for every packet buffer.
  */
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && !defined(DOXYGEN)
 #ifdef CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX
@@ -377,6 +380,39 @@
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX */
 #endif /* !CHIP_SYSTEM_CONFIG_USE_LWIP */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+ *
+ *  @brief
+ *      Serve heap-allocated packet buffers from size classes instead of allocating every buffer at its exact size.
+ *
+ *      Allocations are rounded up to a 128, 512, 1280 or maximum-size block, and released blocks are kept on a free list per
+ *      class for reuse, bounded by CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_FREE_MAX. Per-class usage, high watermark and
+ *      fragmentation are reported by \c chip::System::PacketBufferSlab and the system statistics.
+ *
+ *  @note
+ *      Only applies when packet buffers come from the heap, i.e. on socket platforms with
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE set to zero.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB */
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB && (CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE != 0)
+#error "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB requires heap allocated packet buffers (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 0)."
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB && (CHIP_SYSTEM_CONFIG_USE_LWIP || ...) */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_FREE_MAX
+ *
+ *  @brief
+ *      The maximum number of released blocks each packet buffer size class keeps for reuse. Blocks released beyond this are
+ *      returned to the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_FREE_MAX
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_FREE_MAX 16
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_FREE_MAX */
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 
 /**
@@ -498,6 +534,19 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_HEAP
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) armed timers are kept in a binary min-heap with a lookup table keyed on the
+ *      completion function and application state. This makes starting, cancelling and expiring a timer O(log n) in the
+ *      number of armed timers, instead of scanning the timer pool (sockets) or a sorted list (LwIP). It costs roughly two
+ *      pointers of RAM per timer in CHIP_SYSTEM_CONFIG_NUM_TIMERS and is intended for nodes running many timers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_TIMER_HEAP 0
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_HEAP */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
@@ -509,6 +558,28 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS 0
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) the stages of the handling of a message are instrumented with the spans of
+ *      SystemTrace.h, which time them into latency histograms and a buffer of their most recent spans. Disabled, the spans
+ *      compile to nothing.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+#define CHIP_SYSTEM_CONFIG_PROVIDE_TRACING 0
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT
+ *
+ *  @brief
+ *      The number of the most recent spans kept for export as a trace, when #CHIP_SYSTEM_CONFIG_PROVIDE_TRACING is enabled.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT
+#define CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT 128
+#endif // CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_TEST
  *
@@ -626,6 +697,48 @@ struct LwIPEvent;
 #endif
 #endif // CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_EPOLL
+ *
+ *  @brief
+ *      Use epoll(7) instead of select() to wait for socket readiness in the platform event loop.
+ *
+ *  This lifts the FD_SETSIZE limit on descriptor numbers and avoids the O(nfds) cost of select() on every loop
+ *  iteration. Requires Linux and CHIP_SYSTEM_CONFIG_USE_SOCKETS; the select() interfaces of the system and Inet
+ *  layers remain available either way.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_EPOLL
+#define CHIP_SYSTEM_CONFIG_USE_EPOLL 0
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_KQUEUE
+ *
+ *  @brief
+ *      Use kqueue(2) instead of select() to wait for socket readiness in the platform event loop.
+ *
+ *  The Darwin/BSD counterpart of CHIP_SYSTEM_CONFIG_USE_EPOLL.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_KQUEUE
+#define CHIP_SYSTEM_CONFIG_USE_KQUEUE 0
+#endif // CHIP_SYSTEM_CONFIG_USE_KQUEUE
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL && CHIP_SYSTEM_CONFIG_USE_KQUEUE
+#error "Please enable at most one of CHIP_SYSTEM_CONFIG_USE_EPOLL and CHIP_SYSTEM_CONFIG_USE_KQUEUE"
+#endif
+
+#if (CHIP_SYSTEM_CONFIG_USE_EPOLL || CHIP_SYSTEM_CONFIG_USE_KQUEUE) && !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#error "CHIP_SYSTEM_CONFIG_USE_EPOLL and CHIP_SYSTEM_CONFIG_USE_KQUEUE require CHIP_SYSTEM_CONFIG_USE_SOCKETS"
+#endif
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+ *
+ *  @brief
+ *      Set when one of the chip::System::EventPoller backends (epoll or kqueue) is enabled. Not meant to be set directly.
+ */
+#define CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER (CHIP_SYSTEM_CONFIG_USE_EPOLL || CHIP_SYSTEM_CONFIG_USE_KQUEUE)
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKET_EXTENSIONS
  *
@@ -697,3 +810,16 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS 0
 #endif
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS
+ *
+ *  @brief
+ *      Maximum number of threads of a chip::System::WorkerPool, which runs blocking or expensive operations, such as the
+ *      elliptic curve computations of session establishment, off the CHIP thread.
+ *
+ *  The pool is only available with CHIP_SYSTEM_CONFIG_POSIX_LOCKING.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS
+#define CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS 4
+#endif // CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS
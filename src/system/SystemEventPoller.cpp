@@ -0,0 +1,391 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the chip::System::EventPoller class.
+ */
+
+// Include module header
+#include <system/SystemEventPoller.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
+// Include additional CHIP headers
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/logging/CHIPLogging.h>
+
+// Include system and language headers
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+#include <sys/epoll.h>
+#else // CHIP_SYSTEM_CONFIG_USE_KQUEUE
+#include <sys/event.h>
+#include <sys/types.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+namespace chip {
+namespace System {
+
+namespace {
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+typedef struct epoll_event PollEvent;
+#else  // CHIP_SYSTEM_CONFIG_USE_KQUEUE
+typedef struct kevent PollEvent;
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+constexpr size_t kInitialCapacity = 16;
+
+} // anonymous namespace
+
+EventPoller::EventPoller() :
+    mPollFd(-1), mEntries(nullptr), mEntryCount(0), mActiveFds(nullptr), mActiveCount(0), mActiveCapacity(0),
+    mEvents(nullptr), mEventCapacity(0)
+{}
+
+Error EventPoller::Init()
+{
+    VerifyOrReturnError(mPollFd < 0, CHIP_SYSTEM_ERROR_UNEXPECTED_STATE);
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+    mPollFd = ::epoll_create1(EPOLL_CLOEXEC);
+#else  // CHIP_SYSTEM_CONFIG_USE_KQUEUE
+    mPollFd = ::kqueue();
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+    if (mPollFd < 0)
+    {
+        return MapErrorPOSIX(errno);
+    }
+
+    return CHIP_SYSTEM_NO_ERROR;
+}
+
+Error EventPoller::Shutdown()
+{
+    Error lReturn = CHIP_SYSTEM_NO_ERROR;
+
+    if (mPollFd >= 0 && ::close(mPollFd) != 0)
+    {
+        lReturn = MapErrorPOSIX(errno);
+    }
+    mPollFd = -1;
+
+    // Nothing was allocated if no descriptor was ever requested.
+    if (mEntries != nullptr)
+        chip::Platform::MemoryFree(mEntries);
+    if (mActiveFds != nullptr)
+        chip::Platform::MemoryFree(mActiveFds);
+    if (mEvents != nullptr)
+        chip::Platform::MemoryFree(mEvents);
+
+    mEntries        = nullptr;
+    mEntryCount     = 0;
+    mActiveFds      = nullptr;
+    mActiveCount    = 0;
+    mActiveCapacity = 0;
+    mEvents         = nullptr;
+    mEventCapacity  = 0;
+
+    return lReturn;
+}
+
+Error EventPoller::Grow(void *& aArray, size_t & aCount, size_t aMinimum, size_t aElementSize)
+{
+    size_t lCount = (aCount > 0) ? aCount : kInitialCapacity;
+
+    while (lCount < aMinimum)
+    {
+        lCount *= 2;
+    }
+
+    void * lArray = chip::Platform::MemoryRealloc(aArray, lCount * aElementSize);
+    VerifyOrReturnError(lArray != nullptr, CHIP_SYSTEM_ERROR_NO_MEMORY);
+
+    memset(static_cast<uint8_t *>(lArray) + aCount * aElementSize, 0, (lCount - aCount) * aElementSize);
+    aArray = lArray;
+    aCount = lCount;
+
+    return CHIP_SYSTEM_NO_ERROR;
+}
+
+EventPoller::Entry * EventPoller::EntryFor(int aFd)
+{
+    return (aFd >= 0 && static_cast<size_t>(aFd) < mEntryCount) ? &mEntries[aFd] : nullptr;
+}
+
+const EventPoller::Entry * EventPoller::EntryFor(int aFd) const
+{
+    return (aFd >= 0 && static_cast<size_t>(aFd) < mEntryCount) ? &mEntries[aFd] : nullptr;
+}
+
+void EventPoller::Request(int aFd, uint8_t aEvents)
+{
+    Entry * lEntry = EntryFor(aFd);
+
+    if (aFd < 0 || aEvents == 0)
+    {
+        return;
+    }
+
+    if (lEntry == nullptr)
+    {
+        void * lEntries = mEntries;
+        if (Grow(lEntries, mEntryCount, static_cast<size_t>(aFd) + 1, sizeof(Entry)) != CHIP_SYSTEM_NO_ERROR)
+        {
+            ChipLogError(chipSystemLayer, "Event poller cannot track fd %d", aFd);
+            return;
+        }
+        mEntries = static_cast<Entry *>(lEntries);
+        lEntry   = &mEntries[aFd];
+    }
+
+    if (!lEntry->mActive)
+    {
+        if (mActiveCount == mActiveCapacity)
+        {
+            void * lActiveFds = mActiveFds;
+            if (Grow(lActiveFds, mActiveCapacity, mActiveCount + 1, sizeof(int)) != CHIP_SYSTEM_NO_ERROR)
+            {
+                ChipLogError(chipSystemLayer, "Event poller cannot track fd %d", aFd);
+                return;
+            }
+            mActiveFds = static_cast<int *>(lActiveFds);
+        }
+
+        lEntry->mActive            = true;
+        lEntry->mActiveIndex       = mActiveCount;
+        mActiveFds[mActiveCount++] = aFd;
+    }
+
+    lEntry->mRequested = static_cast<uint8_t>(lEntry->mRequested | aEvents);
+}
+
+void EventPoller::Forget(int aFd)
+{
+    Entry * lEntry = EntryFor(aFd);
+
+    if (lEntry == nullptr || !lEntry->mActive)
+    {
+        return;
+    }
+
+    lEntry->mRequested = 0;
+    ApplyInterest(aFd, *lEntry);
+    Deactivate(aFd, *lEntry);
+}
+
+void EventPoller::Deactivate(int aFd, Entry & aEntry)
+{
+    const int lMovedFd = mActiveFds[--mActiveCount];
+
+    mActiveFds[aEntry.mActiveIndex] = lMovedFd;
+    mEntries[lMovedFd].mActiveIndex = aEntry.mActiveIndex;
+
+    aEntry = Entry();
+}
+
+Error EventPoller::ApplyInterest(int aFd, Entry & aEntry)
+{
+    const uint8_t lWanted  = aEntry.mRequested;
+    const uint8_t lCurrent = aEntry.mRegistered;
+    int lResult            = 0;
+
+    if (lWanted == lCurrent)
+    {
+        return CHIP_SYSTEM_NO_ERROR;
+    }
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+    PollEvent lEvent;
+
+    memset(&lEvent, 0, sizeof(lEvent));
+    lEvent.data.fd = aFd;
+    lEvent.events  = ((lWanted & kRead) ? EPOLLIN : 0u) | ((lWanted & kWrite) ? EPOLLOUT : 0u);
+    lEvent.events |= (lWanted & kError) ? EPOLLPRI : 0u;
+
+    if (lWanted == 0)
+    {
+        lResult = ::epoll_ctl(mPollFd, EPOLL_CTL_DEL, aFd, &lEvent);
+        // The descriptor may already be closed, which removed it from the interest list.
+        if (lResult != 0 && (errno == EBADF || errno == ENOENT))
+        {
+            lResult = 0;
+        }
+    }
+    else
+    {
+        lResult = ::epoll_ctl(mPollFd, (lCurrent == 0) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, aFd, &lEvent);
+        if (lResult != 0 && errno == ENOENT)
+        {
+            lResult = ::epoll_ctl(mPollFd, EPOLL_CTL_ADD, aFd, &lEvent);
+        }
+        else if (lResult != 0 && errno == EEXIST)
+        {
+            lResult = ::epoll_ctl(mPollFd, EPOLL_CTL_MOD, aFd, &lEvent);
+        }
+    }
+#else  // CHIP_SYSTEM_CONFIG_USE_KQUEUE
+    PollEvent lChanges[2];
+    int lNumChanges = 0;
+
+    // kqueue has no exceptional-condition filter; errors are reported through EV_EOF on the read filter.
+    const bool lWantRead   = (lWanted & (kRead | kError)) != 0;
+    const bool lHaveRead   = (lCurrent & (kRead | kError)) != 0;
+    const bool lWantWrite  = (lWanted & kWrite) != 0;
+    const bool lHaveWrite  = (lCurrent & kWrite) != 0;
+    const uintptr_t lIdent = static_cast<uintptr_t>(aFd);
+
+    if (lWantRead != lHaveRead)
+    {
+        EV_SET(&lChanges[lNumChanges++], lIdent, EVFILT_READ, lWantRead ? EV_ADD : EV_DELETE, 0, 0, nullptr);
+    }
+    if (lWantWrite != lHaveWrite)
+    {
+        EV_SET(&lChanges[lNumChanges++], lIdent, EVFILT_WRITE, lWantWrite ? EV_ADD : EV_DELETE, 0, 0, nullptr);
+    }
+
+    if (lNumChanges > 0)
+    {
+        lResult = ::kevent(mPollFd, lChanges, lNumChanges, nullptr, 0, nullptr);
+        // Deleting filters of a descriptor that was already closed fails harmlessly.
+        if (lResult != 0 && (errno == EBADF || errno == ENOENT) && !lWantRead && !lWantWrite)
+        {
+            lResult = 0;
+        }
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+    if (lResult != 0)
+    {
+        const Error lError = MapErrorPOSIX(errno);
+        ChipLogError(chipSystemLayer, "Event poller update for fd %d failed: %s", aFd, ErrorStr(lError));
+        aEntry.mRegistered = 0;
+        return lError;
+    }
+
+    aEntry.mRegistered = lWanted;
+    return CHIP_SYSTEM_NO_ERROR;
+}
+
+Error EventPoller::Wait(const struct timeval & aTimeout, int & aNumReady)
+{
+    aNumReady = 0;
+
+    VerifyOrReturnError(mPollFd >= 0, CHIP_SYSTEM_ERROR_UNEXPECTED_STATE);
+
+    // Sync the kernel's interest list with this iteration's requests, and retire descriptors nobody asked for.
+    for (size_t i = 0; i < mActiveCount;)
+    {
+        const int lFd  = mActiveFds[i];
+        Entry & lEntry = mEntries[lFd];
+
+        ApplyInterest(lFd, lEntry);
+
+        lEntry.mPending   = 0;
+        lEntry.mRequested = 0;
+
+        if (lEntry.mRegistered == 0)
+        {
+            Deactivate(lFd, lEntry);
+            continue;
+        }
+        i++;
+    }
+
+    // Each descriptor may report one event per filter; the wait needs room for at least one event.
+    if (mEventCapacity == 0 || mEventCapacity < 2 * mActiveCount)
+    {
+        ReturnErrorOnFailure(Grow(mEvents, mEventCapacity, 2 * mActiveCount, sizeof(PollEvent)));
+    }
+
+    PollEvent * lEvents = static_cast<PollEvent *>(mEvents);
+    const int lMaxEvents = (mEventCapacity > static_cast<size_t>(INT32_MAX)) ? INT32_MAX : static_cast<int>(mEventCapacity);
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+    const int lTimeoutMs = static_cast<int>(aTimeout.tv_sec * 1000 + (aTimeout.tv_usec + 999) / 1000);
+    const int lResult    = ::epoll_wait(mPollFd, lEvents, lMaxEvents, lTimeoutMs);
+#else  // CHIP_SYSTEM_CONFIG_USE_KQUEUE
+    struct timespec lTimeout;
+    lTimeout.tv_sec   = aTimeout.tv_sec;
+    lTimeout.tv_nsec  = static_cast<long>(aTimeout.tv_usec) * 1000;
+    const int lResult = ::kevent(mPollFd, nullptr, 0, lEvents, lMaxEvents, &lTimeout);
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+    if (lResult < 0)
+    {
+        return MapErrorPOSIX(errno);
+    }
+
+    for (int i = 0; i < lResult; i++)
+    {
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+        const int lFd         = lEvents[i].data.fd;
+        const uint32_t lFlags = lEvents[i].events;
+        uint8_t lReady        = 0;
+
+        if (lFlags & (EPOLLIN | EPOLLHUP | EPOLLRDHUP))
+            lReady |= kRead;
+        if (lFlags & EPOLLOUT)
+            lReady |= kWrite;
+        if (lFlags & EPOLLPRI)
+            lReady |= kError;
+        if (lFlags & EPOLLERR)
+            lReady |= kRead | kWrite | kError;
+#else  // CHIP_SYSTEM_CONFIG_USE_KQUEUE
+        const int lFd  = static_cast<int>(lEvents[i].ident);
+        uint8_t lReady = 0;
+
+        if (lEvents[i].flags & EV_ERROR)
+            lReady |= kRead | kWrite | kError;
+        else if (lEvents[i].filter == EVFILT_READ)
+            lReady |= ((lEvents[i].flags & EV_EOF) && lEvents[i].fflags != 0) ? (kRead | kError) : kRead;
+        else if (lEvents[i].filter == EVFILT_WRITE)
+            lReady |= kWrite;
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+        Entry * lEntry = EntryFor(lFd);
+
+        if (lEntry != nullptr && lEntry->mActive)
+        {
+            // Like select(), only report the events that were asked for.
+            if (lEntry->mPending == 0)
+                aNumReady++;
+            lEntry->mPending = static_cast<uint8_t>(lEntry->mPending | (lReady & lEntry->mRegistered));
+        }
+    }
+
+    return CHIP_SYSTEM_NO_ERROR;
+}
+
+uint8_t EventPoller::Pending(int aFd) const
+{
+    const Entry * lEntry = EntryFor(aFd);
+
+    return (lEntry != nullptr) ? lEntry->mPending : 0;
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
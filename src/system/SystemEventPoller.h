@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the chip::System::EventPoller class, an
+ *      epoll (Linux) or kqueue (Darwin/BSD) based replacement for the
+ *      select() readiness loop, enabled with CHIP_SYSTEM_CONFIG_USE_EPOLL
+ *      or CHIP_SYSTEM_CONFIG_USE_KQUEUE.
+ */
+
+#pragma once
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
+#include <system/SystemError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * @class EventPoller
+ *
+ * @brief
+ *  Waits for I/O readiness on a set of file descriptors without the FD_SETSIZE limit of select().
+ *
+ *  The interface follows the select() loop it replaces: on every iteration each owner of a descriptor calls Request()
+ *  with the events it is interested in (as it would call FD_SET), then one call to Wait() blocks, and each owner reads
+ *  its result back with Pending() (as it would call FD_ISSET).
+ *
+ *  Interest is kept registered with the kernel across iterations; Wait() only issues epoll_ctl()/kevent() changes
+ *  for descriptors whose requested events differ from the previous iteration, and the wait itself costs O(ready)
+ *  rather than O(nfds).
+ *
+ *  Because registrations persist, a descriptor that is closed while registered must be passed to Forget() first,
+ *  otherwise a new descriptor reusing its number could inherit the stale registration.
+ */
+class EventPoller
+{
+public:
+    enum : uint8_t
+    {
+        kRead  = 0x01, /**< The descriptor is readable, or has reached end of file. */
+        kWrite = 0x02, /**< The descriptor is writable. */
+        kError = 0x04, /**< The descriptor has an exceptional condition. */
+    };
+
+    EventPoller();
+
+    Error Init();
+    Error Shutdown();
+
+    /// Adds @a aEvents to the events waited for on @a aFd by the next Wait(). Interest lasts for one iteration.
+    void Request(int aFd, uint8_t aEvents);
+
+    /// Drops any registration for @a aFd. Must be called before closing a descriptor that may have been requested.
+    void Forget(int aFd);
+
+    /**
+     * Applies the interest gathered since the previous call and waits up to @a aTimeout for any of it to become ready.
+     *
+     * @param[in]   aTimeout    The maximum time to wait.
+     * @param[out]  aNumReady   The number of descriptors with pending events, zero on timeout.
+     */
+    Error Wait(const struct timeval & aTimeout, int & aNumReady);
+
+    /// Returns the events that were reported ready on @a aFd by the last Wait().
+    uint8_t Pending(int aFd) const;
+
+private:
+    struct Entry
+    {
+        uint8_t mRequested;  // Interest gathered for the coming Wait().
+        uint8_t mRegistered; // Interest currently registered with the kernel.
+        uint8_t mPending;    // Events reported by the last Wait().
+        bool mActive;        // Listed in mActiveFds.
+        size_t mActiveIndex;
+    };
+
+    Error Grow(void *& aArray, size_t & aCount, size_t aMinimum, size_t aElementSize);
+    Entry * EntryFor(int aFd);
+    const Entry * EntryFor(int aFd) const;
+    Error ApplyInterest(int aFd, Entry & aEntry);
+    void Deactivate(int aFd, Entry & aEntry);
+
+    int mPollFd;
+
+    Entry * mEntries; // Indexed by descriptor.
+    size_t mEntryCount;
+
+    int * mActiveFds; // Descriptors requested during the current or the previous iteration.
+    size_t mActiveCount;
+    size_t mActiveCapacity;
+
+    void * mEvents; // Result buffer for epoll_wait()/kevent().
+    size_t mEventCapacity;
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
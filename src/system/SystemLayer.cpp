@@ -87,17 +87,27 @@ void LwIPEventHandlerDelegate::Prepend(const LwIPEventHandlerDelegate *& aDelega
 }
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
-Layer::Layer() : mLayerState(kLayerState_NotInitialized), mContext(nullptr), mPlatformData(nullptr)
+uint64_t Layer::sLoopTimeMS = 0;
+bool Layer::sLoopTimeValid  = false;
+
+Layer::Layer() : mLayerState(kLayerState_NotInitialized), mContext(nullptr), mPlatformData(nullptr), mWakeAlignmentPeriod(0)
 {
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
     if (!sSystemEventHandlerDelegate.IsInitialized())
         sSystemEventHandlerDelegate.Init(HandleSystemLayerEvent);
 
     this->mEventDelegateList = NULL;
-    this->mTimerList         = NULL;
-    this->mTimerComplete     = false;
+#if !CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    this->mTimerList = NULL;
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    this->mTimerComplete = false;
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    this->mTimerQueue.Init();
+    this->mScheduledWork = 0;
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
     this->mHandleSelectThread = PTHREAD_NULL;
@@ -133,6 +143,11 @@ Error Layer::Init(void * aContext)
     SuccessOrExit(lReturn);
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+    lReturn = this->mEventPoller.Init();
+    SuccessOrExit(lReturn);
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
     this->mLayerState = kLayerState_Initialized;
     this->mContext    = aContext;
 
@@ -158,6 +173,11 @@ Error Layer::Shutdown()
     SuccessOrExit(lReturn);
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+    lReturn = mEventPoller.Shutdown();
+    SuccessOrExit(lReturn);
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
     for (size_t i = 0; i < Timer::sPool.Size(); ++i)
     {
         Timer * lTimer = Timer::sPool.Get(*this, i);
@@ -303,6 +323,90 @@ exit:
     return lReturn;
 }
 
+/**
+ * @brief
+ *   This method starts a one-shot timer that may expire up to @a aSlackMilliseconds after @a aMilliseconds, so that it can
+ *   share a wakeup with other timers.
+ *
+ *   The timer expires with the earliest armed timer that expires within its slack window, as the loop wakes up for that
+ *   one anyway. Failing that, it expires on the wake alignment period if that is within the window (see
+ *   @p AlignWakeTime()), or after exactly @a aMilliseconds. A timer started later with a window covering this timer's
+ *   expiry merges into it the same way.
+ *
+ *   @note
+ *       As with @p StartTimer(), a timer with the same @a aComplete and @a aAppState arguments is cancelled first.
+ *
+ *   @param[in]  aMilliseconds       Earliest expiration time in milliseconds.
+ *   @param[in]  aSlackMilliseconds  How much later than @a aMilliseconds the timer may expire.
+ *   @param[in]  aComplete           A pointer to the function called when timer expires.
+ *   @param[in]  aAppState           A pointer to the application state object used when timer expires.
+ *
+ *   @return CHIP_SYSTEM_NO_ERROR On success.
+ *   @return CHIP_SYSTEM_ERROR_NO_MEMORY If a timer cannot be allocated.
+ *   @return Other Value indicating timer failed to start.
+ *
+ */
+Error Layer::StartTimerWithSlack(uint32_t aMilliseconds, uint32_t aSlackMilliseconds, TimerCompleteFunct aComplete,
+                                 void * aAppState)
+{
+    const Timer::Epoch kCurrentEpoch = Timer::GetCurrentEpoch();
+    const Timer::Epoch kEarliest     = kCurrentEpoch + aMilliseconds;
+    const Timer::Epoch kLatest       = kEarliest + aSlackMilliseconds;
+    Timer::Epoch lAwakenEpoch        = this->AlignWakeTime(kEarliest, aSlackMilliseconds);
+    bool lMerged                     = false;
+
+    this->CancelTimer(aComplete, aAppState);
+
+    for (size_t i = 0; aSlackMilliseconds != 0 && i < Timer::sPool.Size(); i++)
+    {
+        Timer * lTimer = Timer::sPool.Get(*this, i);
+
+        if (lTimer == nullptr || lTimer->OnComplete == nullptr)
+            continue;
+
+        if (Timer::IsEarlierEpoch(lTimer->mAwakenEpoch, kEarliest) || Timer::IsEarlierEpoch(kLatest, lTimer->mAwakenEpoch))
+            continue;
+
+        if (!lMerged || Timer::IsEarlierEpoch(lTimer->mAwakenEpoch, lAwakenEpoch))
+        {
+            lAwakenEpoch = lTimer->mAwakenEpoch;
+            lMerged      = true;
+        }
+    }
+
+    return this->StartTimer(static_cast<uint32_t>(lAwakenEpoch - kCurrentEpoch), aComplete, aAppState);
+}
+
+/**
+ * @brief
+ *   This method moves a wake time onto the wake alignment period, so that the timers of different modules which can wait a
+ *   little expire together and the node wakes once for all of them.
+ *
+ *   The wake alignment period is set by the platform, typically to the data poll period of a sleepy end device, whose radio
+ *   is up at those times anyway. A period of 0, the default, disables the alignment.
+ *
+ *   @param[in]  aWakeTimeMilliseconds  The earliest time, on the monotonic millisecond clock, the caller needs to wake at.
+ *   @param[in]  aSlackMilliseconds     How much later than @a aWakeTimeMilliseconds the caller can wake at.
+ *
+ *   @return The first multiple of the wake alignment period at or after @a aWakeTimeMilliseconds, if it is no more than
+ *           @a aSlackMilliseconds later, and @a aWakeTimeMilliseconds otherwise.
+ *
+ */
+uint64_t Layer::AlignWakeTime(uint64_t aWakeTimeMilliseconds, uint32_t aSlackMilliseconds) const
+{
+    const uint32_t lPeriod = this->mWakeAlignmentPeriod;
+
+    if (lPeriod == 0 || aSlackMilliseconds == 0)
+        return aWakeTimeMilliseconds;
+
+    const uint64_t lRemainder = aWakeTimeMilliseconds % lPeriod;
+
+    if (lRemainder == 0 || lPeriod - lRemainder > aSlackMilliseconds)
+        return aWakeTimeMilliseconds;
+
+    return aWakeTimeMilliseconds + (lPeriod - lRemainder);
+}
+
 /**
  * @brief
  *   This method cancels a one-shot timer, started earlier through @p StartTimer().
@@ -321,6 +425,25 @@ void Layer::CancelTimer(Layer::TimerCompleteFunct aOnComplete, void * aAppState)
     if (this->State() != kLayerState_Initialized)
         return;
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    Timer * lTimer = this->mTimerQueue.Find(aOnComplete, aAppState);
+
+    // Scheduled work is not in the queue; look for it in the pool, but only while some is pending.
+    for (size_t i = 0; lTimer == nullptr && this->mScheduledWork > 0 && i < Timer::sPool.Size(); ++i)
+    {
+        Timer * lWork = Timer::sPool.Get(*this, i);
+
+        if (lWork != nullptr && lWork->IsScheduledWork() && lWork->OnComplete == aOnComplete && lWork->AppState == aAppState)
+        {
+            lTimer = lWork;
+        }
+    }
+
+    if (lTimer != nullptr)
+    {
+        lTimer->Cancel();
+    }
+#else  // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     for (size_t i = 0; i < Timer::sPool.Size(); ++i)
     {
         Timer * lTimer = Timer::sPool.Get(*this, i);
@@ -331,6 +454,7 @@ void Layer::CancelTimer(Layer::TimerCompleteFunct aOnComplete, void * aAppState)
             break;
         }
     }
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
 }
 
 /**
@@ -423,6 +547,9 @@ uint64_t Layer::GetClock_Monotonic()
  *
  * This function is guaranteed to be thread-safe on any platform that employs threading.
  *
+ * This is the precise clock: it reads the platform clock on every call.  Code that only needs the
+ * time at which the current event was received should call GetClock_MonotonicLoopMS() instead.
+ *
  * @returns             Elapsed time in milliseconds since an arbitrary, platform-defined epoch.
  */
 uint64_t Layer::GetClock_MonotonicMS()
@@ -431,6 +558,41 @@ uint64_t Layer::GetClock_MonotonicMS()
     return Platform::Layer::GetClock_MonotonicMS();
 }
 
+/**
+ * @brief
+ *   Returns the monotonic system time in units of milliseconds at which the event loop last woke.
+ *
+ * While the event loop handles the events and timers of an iteration, this function returns the
+ * GetClock_MonotonicMS() time read when the loop woke up, without reading the platform clock
+ * again, so that the many timestamps taken while handling a message cost nothing.  Outside of
+ * event handling, e.g. before the loop starts or when called between iterations, it returns
+ * GetClock_MonotonicMS().
+ *
+ * The value lags the precise clock by the time spent handling the current events.  Code that
+ * measures durations within a handler, or arms timers, should call GetClock_MonotonicMS().
+ *
+ * This function must only be called on the thread running the event loop, or with the CHIP stack
+ * lock held.
+ *
+ * @returns             Elapsed time in milliseconds since the same epoch as GetClock_MonotonicMS().
+ */
+uint64_t Layer::GetClock_MonotonicLoopMS()
+{
+    return sLoopTimeValid ? sLoopTimeMS : GetClock_MonotonicMS();
+}
+
+/**
+ *  Read the precise clock into the loop time, for the events and timers of an event loop iteration.
+ *
+ *  @return The loop time.
+ */
+uint64_t Layer::StartLoopTime()
+{
+    sLoopTimeMS    = GetClock_MonotonicMS();
+    sLoopTimeValid = true;
+    return sLoopTimeMS;
+}
+
 /**
  * @brief
  *   Returns a (potentially) high-resolution monotonic system time in units of microseconds.
@@ -595,16 +757,44 @@ void Layer::PrepareSelect(int & aSetSize, fd_set * aReadSet, fd_set * aWriteSet,
     if (this->State() != kLayerState_Initialized)
         return;
 
+    // The loop is about to sleep, so the time it woke at is no longer the current time.
+    StopLoopTime();
+
     const int wakeEventFd = this->mWakeEvent.GetNotifFD();
     FD_SET(wakeEventFd, aReadSet);
 
     if (wakeEventFd + 1 > aSetSize)
         aSetSize = wakeEventFd + 1;
 
+    this->UpdateSleepTime(aSleepTime);
+}
+
+/**
+ *  Shorten the given sleep time so that the event loop wakes up for the earliest armed timer.
+ *
+ *  @param[in,out] aSleepTime   A reference to the maximum sleep time.
+ */
+void Layer::UpdateSleepTime(struct timeval & aSleepTime)
+{
     const Timer::Epoch kCurrentEpoch = Timer::GetCurrentEpoch();
     Timer::Epoch lAwakenEpoch =
         kCurrentEpoch + static_cast<Timer::Epoch>(aSleepTime.tv_sec) * 1000 + static_cast<uint32_t>(aSleepTime.tv_usec) / 1000;
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    const Timer * lEarliestTimer = this->mTimerQueue.Earliest();
+
+    if (this->mScheduledWork > 0)
+    {
+        lAwakenEpoch = kCurrentEpoch;
+    }
+    else if (lEarliestTimer != nullptr)
+    {
+        if (!Timer::IsEarlierEpoch(kCurrentEpoch, lEarliestTimer->mAwakenEpoch))
+            lAwakenEpoch = kCurrentEpoch;
+        else if (Timer::IsEarlierEpoch(lEarliestTimer->mAwakenEpoch, lAwakenEpoch))
+            lAwakenEpoch = lEarliestTimer->mAwakenEpoch;
+    }
+#else  // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     for (size_t i = 0; i < Timer::sPool.Size(); i++)
     {
         Timer * lTimer = Timer::sPool.Get(*this, i);
@@ -621,6 +811,7 @@ void Layer::PrepareSelect(int & aSetSize, fd_set * aReadSet, fd_set * aWriteSet,
                 lAwakenEpoch = lTimer->mAwakenEpoch;
         }
     }
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
 
     // check for an earlier callback timer, too
     if (lAwakenEpoch != kCurrentEpoch)
@@ -657,7 +848,6 @@ void Layer::PrepareSelect(int & aSetSize, fd_set * aReadSet, fd_set * aWriteSet,
  */
 void Layer::HandleSelectResult(int aSetSize, fd_set * aReadSet, fd_set * aWriteSet, fd_set * aExceptionSet)
 {
-    pthread_t lThreadSelf;
     Error lReturn;
 
     if (this->State() != kLayerState_Initialized)
@@ -666,10 +856,6 @@ void Layer::HandleSelectResult(int aSetSize, fd_set * aReadSet, fd_set * aWriteS
     if (aSetSize < 0)
         return;
 
-#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
-    lThreadSelf = pthread_self();
-#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
-
     if (aSetSize > 0)
     {
         // If we woke because of someone writing to the wake event, clear the event before returning.
@@ -683,12 +869,49 @@ void Layer::HandleSelectResult(int aSetSize, fd_set * aReadSet, fd_set * aWriteS
         }
     }
 
-    const Timer::Epoch kCurrentEpoch = Timer::GetCurrentEpoch();
+    this->DispatchExpiredTimers();
+}
+
+/**
+ *  Fire the timers and timer callbacks that have expired, on behalf of the thread running the event loop.
+ */
+void Layer::DispatchExpiredTimers()
+{
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    const pthread_t lThreadSelf = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // The I/O handlers run after the timers, with the loop time read here until the next PrepareSelect() or PrepareEvents().
+    const Timer::Epoch kCurrentEpoch = StartLoopTime();
 
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
     this->mHandleSelectThread = lThreadSelf;
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    // Scheduled work is not in the queue, so run what is pending through a pool scan, as the list backend does.
+    if (this->mScheduledWork > 0)
+    {
+        for (size_t i = 0; i < Timer::sPool.Size(); i++)
+        {
+            Timer * lTimer = Timer::sPool.Get(*this, i);
+
+            if (lTimer != nullptr && lTimer->IsScheduledWork())
+            {
+                lTimer->HandleComplete();
+            }
+        }
+    }
+
+    // Only expire timers armed before this pass, so that a handler re-arming itself with no delay cannot starve I/O.
+    const uint32_t lTimerMark = this->mTimerQueue.Mark();
+    Timer * lExpiredTimer;
+
+    while ((lExpiredTimer = this->mTimerQueue.EarliestExpired(kCurrentEpoch, lTimerMark)) != nullptr)
+    {
+        lExpiredTimer->HandleComplete();
+    }
+#else  // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     for (size_t i = 0; i < Timer::sPool.Size(); i++)
     {
         Timer * lTimer = Timer::sPool.Get(*this, i);
@@ -698,6 +921,7 @@ void Layer::HandleSelectResult(int aSetSize, fd_set * aReadSet, fd_set * aWriteS
             lTimer->HandleComplete();
         }
     }
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
 
     DispatchTimerCallbacks(kCurrentEpoch);
 
@@ -706,6 +930,55 @@ void Layer::HandleSelectResult(int aSetSize, fd_set * aReadSet, fd_set * aWriteS
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
+/**
+ *  Request the descriptors of the system layer from its event poller, and bound the time to wait for them.
+ *
+ *  This is the event poller counterpart of PrepareSelect(); call it on every event loop iteration before
+ *  EventPoller::Wait().
+ *
+ *  @param[in,out] aSleepTime   A reference to the maximum sleep time.
+ */
+void Layer::PrepareEvents(struct timeval & aSleepTime)
+{
+    if (this->State() != kLayerState_Initialized)
+        return;
+
+    // The loop is about to sleep, so the time it woke at is no longer the current time.
+    StopLoopTime();
+
+    this->mEventPoller.Request(this->mWakeEvent.GetNotifFD(), EventPoller::kRead);
+
+    this->UpdateSleepTime(aSleepTime);
+}
+
+/**
+ *  Handle the result of EventPoller::Wait() for the system layer: clear the wake event and fire expired timers.
+ *
+ *  This is the event poller counterpart of HandleSelectResult().
+ */
+void Layer::HandleEvents()
+{
+    Error lReturn;
+
+    if (this->State() != kLayerState_Initialized)
+        return;
+
+    if (this->mEventPoller.Pending(this->mWakeEvent.GetNotifFD()) & EventPoller::kRead)
+    {
+        lReturn = this->mWakeEvent.Confirm();
+        if (lReturn != CHIP_SYSTEM_NO_ERROR)
+        {
+            ChipLogError(chipSystemLayer, "System wake event confirm failed: %s", ErrorStr(lReturn));
+        }
+    }
+
+    this->DispatchExpiredTimers();
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
 /**
  * Wake up the I/O thread that monitors the file descriptors using select() by writing a single byte to the wake pipe.
  *
@@ -954,10 +1227,15 @@ Error Layer::HandlePlatformTimer()
     Error lReturn = CHIP_SYSTEM_NO_ERROR;
     VerifyOrExit(this->State() == kLayerState_Initialized, lReturn = CHIP_SYSTEM_ERROR_UNEXPECTED_STATE);
 
+    StartLoopTime();
+
     lReturn = Timer::HandleExpiredTimers(*this);
 
     DispatchTimerCallbacks(Timer::GetCurrentEpoch());
 
+    // The LwIP events are dispatched outside of this call, so the loop time only covers the timers.
+    StopLoopTime();
+
     SuccessOrExit(lReturn);
 
 exit:
@@ -33,9 +33,15 @@
 #include <support/DLLUtil.h>
 #include <system/SystemError.h>
 #include <system/SystemEvent.h>
+#include <system/SystemEventPoller.h>
 #include <system/SystemObject.h>
+#include <system/SystemTimerQueue.h>
 
 // Include dependent headers
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+#include <atomic>
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
 #include <system/SystemWakeEvent.h>
 
@@ -143,16 +149,27 @@ public:
 
     typedef void (*TimerCompleteFunct)(Layer * aLayer, void * aAppState, Error aError);
     Error StartTimer(uint32_t aMilliseconds, TimerCompleteFunct aComplete, void * aAppState);
+    Error StartTimerWithSlack(uint32_t aMilliseconds, uint32_t aSlackMilliseconds, TimerCompleteFunct aComplete, void * aAppState);
     void CancelTimer(TimerCompleteFunct aOnComplete, void * aAppState);
 
     Error ScheduleWork(TimerCompleteFunct aComplete, void * aAppState);
 
+    void SetWakeAlignmentPeriod(uint32_t aPeriodMilliseconds) { mWakeAlignmentPeriod = aPeriodMilliseconds; }
+    uint32_t GetWakeAlignmentPeriod() const { return mWakeAlignmentPeriod; }
+    uint64_t AlignWakeTime(uint64_t aWakeTimeMilliseconds, uint32_t aSlackMilliseconds) const;
+
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
     void PrepareSelect(int & aSetSize, fd_set * aReadSet, fd_set * aWriteSet, fd_set * aExceptionSet, struct timeval & aSleepTime);
     void HandleSelectResult(int aSetSize, fd_set * aReadSet, fd_set * aWriteSet, fd_set * aExceptionSet);
     void WakeSelect();
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+    EventPoller & GetEventPoller() { return mEventPoller; }
+    void PrepareEvents(struct timeval & aSleepTime);
+    void HandleEvents();
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
     typedef Error (*EventHandler)(Object & aTarget, EventType aEventType, uintptr_t aArgument);
     Error AddEventHandlerDelegate(LwIPEventHandlerDelegate & aDelegate);
@@ -170,6 +187,7 @@ public:
     static uint64_t GetClock_Monotonic();
     static uint64_t GetClock_MonotonicMS();
     static uint64_t GetClock_MonotonicHiRes();
+    static uint64_t GetClock_MonotonicLoopMS();
     static Error GetClock_RealTime(uint64_t & curTime);
     static Error GetClock_RealTimeMS(uint64_t & curTimeMS);
     static Error SetClock_RealTime(uint64_t newCurTime);
@@ -179,12 +197,27 @@ private:
     void * mContext;
     void * mPlatformData;
     chip::Callback::CallbackDeque mTimerCallbacks;
+    uint32_t mWakeAlignmentPeriod;
+
+    static uint64_t sLoopTimeMS;
+    static bool sLoopTimeValid;
+
+    static uint64_t StartLoopTime();
+    static void StopLoopTime() { sLoopTimeValid = false; }
+
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    TimerQueue mTimerQueue;
+    // Armed timers from ScheduleWork(), which may be called from any thread and so are kept out of mTimerQueue.
+    std::atomic<size_t> mScheduledWork;
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
     static LwIPEventHandlerDelegate sSystemEventHandlerDelegate;
 
     const LwIPEventHandlerDelegate * mEventDelegateList;
+#if !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     Timer * mTimerList;
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     bool mTimerComplete;
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
@@ -193,8 +226,15 @@ private:
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
     pthread_t mHandleSelectThread;
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    void UpdateSleepTime(struct timeval & aSleepTime);
+    void DispatchExpiredTimers();
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
 
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+    EventPoller mEventPoller;
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
     static Error HandleSystemLayerEvent(Object & aTarget, EventType aEventType, uintptr_t aArgument);
 
@@ -57,6 +57,7 @@
 
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
 #include <support/CHIPMem.h>
+#include <system/SystemPacketBufferSlab.h>
 #endif
 
 namespace chip {
@@ -141,8 +142,17 @@ void PacketBufferHandle::InternalRightSize()
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
+    const size_t blockSize = usedSize + PacketBuffer::kStructureSize;
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    // Nothing is saved unless the buffer moves to a smaller size class.
+    if (PacketBufferSlab::BlockSize(blockSize) == PacketBufferSlab::BlockSize(mBuffer->alloc_size + PacketBuffer::kStructureSize))
+    {
+        return;
+    }
+    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(PacketBufferSlab::Allocate(blockSize));
+#else  // !CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
     PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+#endif // !CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -485,7 +495,11 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    lPacket = reinterpret_cast<PacketBuffer *>(PacketBufferSlab::Allocate(lBlockSize));
+#else  // !CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
     lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+#endif // !CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 
 #else
@@ -565,12 +579,15 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
         {
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
-            ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            const size_t lBlockSize = aPacket->alloc_size + kStructureSize;
+            ::chip::Platform::MemoryDebugCheckPointer(aPacket, lBlockSize);
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
+#elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+            PacketBufferSlab::Release(aPacket, lBlockSize);
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE
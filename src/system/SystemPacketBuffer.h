@@ -407,6 +407,7 @@ private:
     void SetDataLength(uint16_t aNewLen, PacketBuffer * aChainHead);
 
     friend class PacketBufferHandle;
+    friend class PacketBufferSlab;
     friend class ::PacketBufferTest;
 };
 
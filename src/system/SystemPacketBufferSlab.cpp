@@ -0,0 +1,243 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the size-class allocator backing heap-allocated
+ *      packet buffers.
+ */
+
+#include <system/SystemPacketBufferSlab.h>
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
+#include <support/CHIPMem.h>
+#include <system/SystemMutex.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
+
+namespace chip {
+namespace System {
+
+namespace {
+
+constexpr size_t ClassBlockSize(size_t aSize, size_t aMaxBlockSize)
+{
+    return (aSize < aMaxBlockSize) ? aSize : aMaxBlockSize;
+}
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+constexpr int kStatsEntries[PacketBufferSlab::kNumClasses] = {
+    Stats::kSystemLayer_NumPacketBufs128, Stats::kSystemLayer_NumPacketBufs512, Stats::kSystemLayer_NumPacketBufs1280,
+    Stats::kSystemLayer_NumPacketBufsMax
+};
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+struct FreeBlock
+{
+    FreeBlock * mNext;
+};
+
+struct SizeClass
+{
+    FreeBlock * mFreeList;
+    uint32_t mNumFree;
+    uint32_t mInUse;
+    uint32_t mHighWatermark;
+    size_t mRequestedBytes;
+};
+
+SizeClass sClasses[PacketBufferSlab::kNumClasses];
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+Mutex sSlabMutex;
+
+bool InitSlabMutex()
+{
+    Mutex::Init(sSlabMutex);
+    return true;
+}
+
+// Initialized at static initialization time, like the packet buffer pool mutex.
+const bool sSlabMutexInitialized = InitSlabMutex();
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+void LockSlab()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    sSlabMutex.Lock();
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+}
+
+void UnlockSlab()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    sSlabMutex.Unlock();
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+}
+
+} // namespace
+
+// Block sizes include the PacketBuffer header, so the smallest class still holds a header reserve and a short message.
+const size_t PacketBufferSlab::kBlockSizes[kNumClasses] = {
+    ClassBlockSize(128, PacketBuffer::kBlockSize),
+    ClassBlockSize(512, PacketBuffer::kBlockSize),
+    ClassBlockSize(1280, PacketBuffer::kBlockSize),
+    PacketBuffer::kBlockSize,
+};
+
+size_t PacketBufferSlab::ClassFor(size_t aSize)
+{
+    size_t lClass = 0;
+
+    while (lClass < kNumClasses && kBlockSizes[lClass] < aSize)
+    {
+        lClass++;
+    }
+
+    return lClass;
+}
+
+void * PacketBufferSlab::Allocate(size_t aSize)
+{
+    const size_t lClass = ClassFor(aSize);
+    void * lBlock;
+
+    if (lClass == kNumClasses)
+    {
+        return nullptr;
+    }
+
+    SizeClass & lSizeClass = sClasses[lClass];
+
+    LockSlab();
+    lBlock = lSizeClass.mFreeList;
+    if (lBlock != nullptr)
+    {
+        lSizeClass.mFreeList = lSizeClass.mFreeList->mNext;
+        lSizeClass.mNumFree--;
+    }
+    UnlockSlab();
+
+    if (lBlock == nullptr)
+    {
+        lBlock = chip::Platform::MemoryAlloc(kBlockSizes[lClass]);
+        if (lBlock == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    LockSlab();
+    lSizeClass.mInUse++;
+    if (lSizeClass.mHighWatermark < lSizeClass.mInUse)
+    {
+        lSizeClass.mHighWatermark = lSizeClass.mInUse;
+    }
+    lSizeClass.mRequestedBytes += aSize;
+    SYSTEM_STATS_INCREMENT(kStatsEntries[lClass]);
+    UnlockSlab();
+
+    return lBlock;
+}
+
+void PacketBufferSlab::Release(void * aBlock, size_t aSize)
+{
+    const size_t lClass = ClassFor(aSize);
+    bool lKeep          = false;
+
+    if (aBlock == nullptr || lClass == kNumClasses)
+    {
+        return;
+    }
+
+    SizeClass & lSizeClass = sClasses[lClass];
+
+    LockSlab();
+    lSizeClass.mInUse--;
+    lSizeClass.mRequestedBytes -= aSize;
+    SYSTEM_STATS_DECREMENT(kStatsEntries[lClass]);
+    if (lSizeClass.mNumFree < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_FREE_MAX)
+    {
+        FreeBlock * lFreeBlock = static_cast<FreeBlock *>(aBlock);
+
+        lFreeBlock->mNext    = lSizeClass.mFreeList;
+        lSizeClass.mFreeList = lFreeBlock;
+        lSizeClass.mNumFree++;
+        lKeep = true;
+    }
+    UnlockSlab();
+
+    if (!lKeep)
+    {
+        chip::Platform::MemoryFree(aBlock);
+    }
+}
+
+size_t PacketBufferSlab::BlockSize(size_t aSize)
+{
+    const size_t lClass = ClassFor(aSize);
+
+    return (lClass < kNumClasses) ? kBlockSizes[lClass] : 0;
+}
+
+bool PacketBufferSlab::GetStatistics(size_t aClass, ClassStatistics & aStatistics)
+{
+    if (aClass >= kNumClasses)
+    {
+        return false;
+    }
+
+    LockSlab();
+    aStatistics.mBlockSize      = kBlockSizes[aClass];
+    aStatistics.mInUse          = sClasses[aClass].mInUse;
+    aStatistics.mHighWatermark  = sClasses[aClass].mHighWatermark;
+    aStatistics.mFree           = sClasses[aClass].mNumFree;
+    aStatistics.mRequestedBytes = sClasses[aClass].mRequestedBytes;
+    UnlockSlab();
+
+    return true;
+}
+
+void PacketBufferSlab::Purge()
+{
+    FreeBlock * lFreeLists[kNumClasses];
+
+    LockSlab();
+    for (size_t lClass = 0; lClass < kNumClasses; lClass++)
+    {
+        lFreeLists[lClass]         = sClasses[lClass].mFreeList;
+        sClasses[lClass].mFreeList = nullptr;
+        sClasses[lClass].mNumFree  = 0;
+    }
+    UnlockSlab();
+
+    for (FreeBlock * lFreeBlock : lFreeLists)
+    {
+        while (lFreeBlock != nullptr)
+        {
+            FreeBlock * lNext = lFreeBlock->mNext;
+            chip::Platform::MemoryFree(lFreeBlock);
+            lFreeBlock = lNext;
+        }
+    }
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
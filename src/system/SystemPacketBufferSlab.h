@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the chip::System::PacketBufferSlab class, the
+ *      size-class allocator backing heap-allocated packet buffers when
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled.
+ */
+
+#pragma once
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
+#include <support/DLLUtil.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * @class PacketBufferSlab
+ *
+ * @brief
+ *  Allocates packet buffer blocks from a small set of size classes. A request is rounded up to the smallest class that can
+ *  hold it, so that short messages such as acknowledgements do not take a maximum-size block, and blocks released to a class
+ *  are kept on its free list for the next allocation instead of going back to the heap.
+ *
+ *  Free lists are shared by all threads and protected by a mutex, since packet buffers are routinely allocated on one
+ *  thread and released on another.
+ */
+class DLL_EXPORT PacketBufferSlab
+{
+public:
+    static constexpr size_t kNumClasses = 4;
+
+    struct ClassStatistics
+    {
+        size_t mBlockSize;       /**< Size of the blocks of the class, including the PacketBuffer header. */
+        uint32_t mInUse;         /**< Number of blocks currently allocated. */
+        uint32_t mHighWatermark; /**< Largest number of blocks allocated at the same time. */
+        uint32_t mFree;          /**< Number of released blocks kept for reuse. */
+        size_t mRequestedBytes;  /**< Sum of the sizes requested for the blocks in use. */
+
+        /** Bytes allocated but not requested by the blocks in use, i.e. the internal fragmentation of the class. */
+        size_t UnusedBytes() const { return mInUse * mBlockSize - mRequestedBytes; }
+    };
+
+    /**
+     * Allocates a block of at least @a aSize bytes.
+     *
+     * @return the block, or \c nullptr if @a aSize exceeds the largest class or the heap is exhausted.
+     */
+    static void * Allocate(size_t aSize);
+
+    /**
+     * Releases a block returned by Allocate().
+     *
+     * @param[in] aBlock  The block.
+     * @param[in] aSize   The size passed to Allocate() for the block.
+     */
+    static void Release(void * aBlock, size_t aSize);
+
+    /**
+     * Returns the size of the block Allocate() would return for @a aSize bytes, or 0 if it exceeds the largest class.
+     */
+    static size_t BlockSize(size_t aSize);
+
+    /**
+     * Reports the usage of size class @a aClass, ordered by increasing block size.
+     *
+     * @return false if @a aClass is not less than kNumClasses.
+     */
+    static bool GetStatistics(size_t aClass, ClassStatistics & aStatistics);
+
+    /**
+     * Returns the blocks kept on the free lists to the heap, e.g. before chip::Platform::MemoryShutdown().
+     */
+    static void Purge();
+
+private:
+    static const size_t kBlockSizes[kNumClasses];
+
+    static size_t ClassFor(size_t aSize);
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
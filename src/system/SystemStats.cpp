@@ -33,6 +33,8 @@
 
 #include <support/SafeInt.h>
 
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 
 namespace chip {
@@ -46,6 +48,12 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "SystemLayer_NumPacketBufs",
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    "SystemLayer_NumPacketBufs128",
+    "SystemLayer_NumPacketBufs512",
+    "SystemLayer_NumPacketBufs1280",
+    "SystemLayer_NumPacketBufsMax",
 #endif
     "SystemLayer_NumTimersInUse",
 #if INET_CONFIG_NUM_RAW_ENDPOINTS
@@ -62,16 +70,45 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #endif
     "ExchangeMgr_NumContextsInUse",   "ExchangeMgr_NumUMHandlersInUse",
     "ExchangeMgr_NumBindings",        "MessageLayer_NumConnectionsInUse",
+    "ReliableMessageMgr_NumRetransEntriesInUse",
+    "SecureSessionMgr_NumPeerConnectionsInUse",
+    "InteractionModel_NumCommandHandlersInUse",
+    "InteractionModel_NumReadHandlersInUse",
+    "InteractionModel_NumWriteHandlersInUse",
+};
+
+static const Label sCounterStrings[chip::System::Stats::kNumCounters] = {
+    "ReliableMessageMgr_NumRetransmissions",
+    "ReliableMessageMgr_NumRetransmissionFailures",
+    "ReliableMessageMgr_NumRetransTableFull",
+    "ExchangeMgr_NumContextAllocFailures",
+    "SecureSessionMgr_NumPeerConnectionAllocFailures",
+    "SecureSessionMgr_NumDuplicateMessages",
+    "SecureSessionMgr_NumOutOfWindowMessages",
+    "InteractionModel_NumBusyResponses",
+    "InteractionModel_NumReportsSent",
+    "InteractionModel_NumReportBytes",
+    "EventManagement_NumEventsLogged",
+    "EventManagement_NumEventsEvicted",
+    "Crypto_NumEncryptions",
+    "Crypto_NumDecryptions",
+    "Crypto_NumDecryptionFailures",
 };
 
 count_t sResourcesInUse[kNumEntries];
 count_t sHighWatermarks[kNumEntries];
+counter_t sCounters[kNumCounters];
 
 const Label * GetStrings()
 {
     return sStatsStrings;
 }
 
+const Label * GetCounterStrings()
+{
+    return sCounterStrings;
+}
+
 count_t * GetResourcesInUse()
 {
     return sResourcesInUse;
@@ -82,10 +119,16 @@ count_t * GetHighWatermarks()
     return sHighWatermarks;
 }
 
+counter_t * GetCounters()
+{
+    return sCounters;
+}
+
 void UpdateSnapshot(Snapshot & aSnapshot)
 {
     memcpy(&aSnapshot.mResourcesInUse, &sResourcesInUse, sizeof(aSnapshot.mResourcesInUse));
     memcpy(&aSnapshot.mHighWatermarks, &sHighWatermarks, sizeof(aSnapshot.mHighWatermarks));
+    memcpy(&aSnapshot.mCounters, &sCounters, sizeof(aSnapshot.mCounters));
 
     chip::System::Timer::GetStatistics(aSnapshot.mResourcesInUse[kSystemLayer_NumTimers],
                                        aSnapshot.mHighWatermarks[kSystemLayer_NumTimers]);
@@ -110,9 +153,46 @@ bool Difference(Snapshot & result, Snapshot & after, Snapshot & before)
         }
     }
 
+    for (i = 0; i < kNumCounters; i++)
+    {
+        result.mCounters[i] = after.mCounters[i] - before.mCounters[i];
+    }
+
     return leak;
 }
 
+void WritePrometheusText(TextWriter writer, void * context)
+{
+    Snapshot snapshot;
+    char line[128];
+
+    UpdateSnapshot(snapshot);
+
+    writer(context, "# TYPE chip_resources_in_use gauge\n");
+    for (int i = 0; i < kNumEntries; i++)
+    {
+        snprintf(line, sizeof(line), "chip_resources_in_use{resource=\"%s\"} %" PRI_CHIP_SYS_STATS_COUNT "\n", sStatsStrings[i],
+                 snapshot.mResourcesInUse[i]);
+        writer(context, line);
+    }
+
+    writer(context, "# TYPE chip_resources_high_watermark gauge\n");
+    for (int i = 0; i < kNumEntries; i++)
+    {
+        snprintf(line, sizeof(line), "chip_resources_high_watermark{resource=\"%s\"} %" PRI_CHIP_SYS_STATS_COUNT "\n",
+                 sStatsStrings[i], snapshot.mHighWatermarks[i]);
+        writer(context, line);
+    }
+
+    writer(context, "# TYPE chip_events_total counter\n");
+    for (int i = 0; i < kNumCounters; i++)
+    {
+        snprintf(line, sizeof(line), "chip_events_total{event=\"%s\"} %" PRI_CHIP_SYS_STATS_COUNTER "\n", sCounterStrings[i],
+                 snapshot.mCounters[i]);
+        writer(context, line);
+    }
+}
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 void UpdateLwipPbufCounts(void)
 {
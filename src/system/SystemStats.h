@@ -56,6 +56,12 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    kSystemLayer_NumPacketBufs128,
+    kSystemLayer_NumPacketBufs512,
+    kSystemLayer_NumPacketBufs1280,
+    kSystemLayer_NumPacketBufsMax,
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_RAW_ENDPOINTS
@@ -74,13 +80,44 @@ enum
     kExchangeMgr_NumUMHandlers,
     kExchangeMgr_NumBindings,
     kMessageLayer_NumConnections,
+    kReliableMessageMgr_NumRetransEntries,
+    kSecureSessionMgr_NumPeerConnections,
+    kInteractionModel_NumCommandHandlers,
+    kInteractionModel_NumReadHandlers,
+    kInteractionModel_NumWriteHandlers,
     kNumEntries
 };
 
+/**
+ * The counters of events, which only ever go up, unlike the resources in use. They are counted with SYSTEM_STATS_COUNT().
+ */
+enum
+{
+    kReliableMessageMgr_NumRetransmissions,
+    kReliableMessageMgr_NumRetransmissionFailures,
+    kReliableMessageMgr_NumRetransTableFull,
+    kExchangeMgr_NumContextAllocFailures,
+    kSecureSessionMgr_NumPeerConnectionAllocFailures,
+    kSecureSessionMgr_NumDuplicateMessages,
+    kSecureSessionMgr_NumOutOfWindowMessages,
+    kInteractionModel_NumBusyResponses,
+    kInteractionModel_NumReportsSent,
+    kInteractionModel_NumReportBytes,
+    kEventManagement_NumEventsLogged,
+    kEventManagement_NumEventsEvicted,
+    kCrypto_NumEncryptions,
+    kCrypto_NumDecryptions,
+    kCrypto_NumDecryptionFailures,
+    kNumCounters
+};
+
 typedef int8_t count_t;
 #define PRI_CHIP_SYS_STATS_COUNT PRId8
 #define CHIP_SYS_STATS_COUNT_MAX INT8_MAX
 
+typedef uint32_t counter_t;
+#define PRI_CHIP_SYS_STATS_COUNTER PRIu32
+
 extern count_t ResourcesInUse[kNumEntries];
 extern count_t HighWatermarks[kNumEntries];
 
@@ -89,12 +126,14 @@ class Snapshot
 public:
     count_t mResourcesInUse[kNumEntries];
     count_t mHighWatermarks[kNumEntries];
+    counter_t mCounters[kNumCounters];
 };
 
 bool Difference(Snapshot & result, Snapshot & after, Snapshot & before);
 void UpdateSnapshot(Snapshot & aSnapshot);
 count_t * GetResourcesInUse();
 count_t * GetHighWatermarks();
+counter_t * GetCounters();
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 void UpdateLwipPbufCounts(void);
@@ -102,6 +141,14 @@ void UpdateLwipPbufCounts(void);
 
 typedef const char * Label;
 const Label * GetStrings();
+const Label * GetCounterStrings();
+
+/**
+ * Export a snapshot of the statistics in the Prometheus text exposition format, by pieces handed to writer in turn: the
+ * resources in use and their high watermarks as gauges, labelled with the resource, and the counters as counters.
+ */
+using TextWriter = void (*)(void * context, const char * text);
+void WritePrometheusText(TextWriter writer, void * context);
 
 } // namespace Stats
 } // namespace System
@@ -147,6 +194,18 @@ const Label * GetStrings();
         chip::System::Stats::GetResourcesInUse()[entry] = 0;                                                                       \
     } while (0);
 
+#define SYSTEM_STATS_COUNT(counter)                                                                                                \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::GetCounters()[counter]++;                                                                             \
+    } while (0);
+
+#define SYSTEM_STATS_COUNT_BY_N(counter, count)                                                                                    \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::GetCounters()[counter] += static_cast<chip::System::Stats::counter_t>(count);                         \
+    } while (0);
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()                                                                                     \
     do                                                                                                                             \
@@ -165,8 +224,14 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_DECREMENT_BY_N(entry, count)
 
+#define SYSTEM_STATS_SET(entry, count)
+
 #define SYSTEM_STATS_RESET(entry)
 
+#define SYSTEM_STATS_COUNT(counter)
+
+#define SYSTEM_STATS_COUNT_BY_N(counter, count)
+
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
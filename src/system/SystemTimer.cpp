@@ -135,7 +135,18 @@ Error Timer::Start(uint32_t aDelayMilliseconds, OnCompleteFunct aOnComplete, voi
         chipDie();
     }
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    lLayer.mTimerQueue.Track(*this);
+    lLayer.mTimerQueue.Schedule(*this);
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
+    // this may be the new earliest timer, in which case the platform timer needs (re-)starting; see below.
+    if (lLayer.mTimerQueue.Earliest() == this && !lLayer.mTimerComplete)
+    {
+        lLayer.StartPlatformTimer(aDelayMilliseconds);
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+#elif CHIP_SYSTEM_CONFIG_USE_LWIP
     // add to the sorted list of timers. Earliest timer appears first.
     if (lLayer.mTimerList == NULL || this->IsEarlierEpoch(this->mAwakenEpoch, lLayer.mTimerList->mAwakenEpoch))
     {
@@ -168,7 +179,7 @@ Error Timer::Start(uint32_t aDelayMilliseconds, OnCompleteFunct aOnComplete, voi
         this->mNextTimer   = lTimer->mNextTimer;
         lTimer->mNextTimer = this;
     }
-#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP / CHIP_SYSTEM_CONFIG_USE_LWIP
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
     lLayer.WakeSelect();
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
@@ -183,6 +194,16 @@ Error Timer::ScheduleWork(OnCompleteFunct aOnComplete, void * aAppState)
 
     this->AppState     = aAppState;
     this->mAwakenEpoch = Timer::GetCurrentEpoch();
+
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    // This may run on any thread, so unlike Start() it leaves the timer queue alone. The event loop finds scheduled work by
+    // scanning the timer pool while mScheduledWork is non-zero; count the work before arming it, so the count never drops
+    // below zero when the loop runs the work before this returns.
+    this->mQueueIndex  = kNotQueued;
+    this->mQueueBucket = kNotQueued;
+    lLayer.mScheduledWork++;
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
     if (!__sync_bool_compare_and_swap(&this->OnComplete, nullptr, aOnComplete))
     {
         chipDie();
@@ -205,9 +226,9 @@ Error Timer::ScheduleWork(OnCompleteFunct aOnComplete, void * aAppState)
  */
 Error Timer::Cancel()
 {
-#if CHIP_SYSTEM_CONFIG_USE_LWIP
+#if CHIP_SYSTEM_CONFIG_USE_LWIP && !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     Layer & lLayer = this->SystemLayer();
-#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+#endif // CHIP_SYSTEM_CONFIG_USE_LWIP && !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     OnCompleteFunct lOnComplete = this->OnComplete;
 
     // Check if the timer is armed
@@ -218,7 +239,9 @@ Error Timer::Cancel()
     // Since this thread changed the state of OnComplete, release the timer.
     this->AppState = nullptr;
 
-#if CHIP_SYSTEM_CONFIG_USE_LWIP
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    this->Untrack();
+#elif CHIP_SYSTEM_CONFIG_USE_LWIP
     if (lLayer.mTimerList)
     {
         if (this == lLayer.mTimerList)
@@ -243,7 +266,7 @@ Error Timer::Cancel()
 
         this->mNextTimer = NULL;
     }
-#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP / CHIP_SYSTEM_CONFIG_USE_LWIP
 
     this->Release();
 exit:
@@ -266,6 +289,9 @@ void Timer::HandleComplete()
     VerifyOrExit(__sync_bool_compare_and_swap(&this->OnComplete, lOnComplete, nullptr), );
 
     // Since this thread changed the state of OnComplete, release the timer.
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    this->Untrack();
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
     AppState = nullptr;
     this->Release();
 
@@ -277,6 +303,25 @@ exit:
     return;
 }
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+/**
+ *  This method takes a timer being disarmed out of the bookkeeping of its layer.
+ */
+void Timer::Untrack()
+{
+    Layer & lLayer = this->SystemLayer();
+
+    if (this->mQueueBucket == kNotQueued)
+    {
+        lLayer.mScheduledWork--;
+    }
+    else
+    {
+        lLayer.mTimerQueue.Untrack(*this);
+    }
+}
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 /**
  * Completes any timers that have expired.
@@ -301,17 +346,29 @@ Error Timer::HandleExpiredTimers(Layer & aLayer)
     // regardless how long the processing of the currently expired timers took
     Epoch currentEpoch = Timer::GetCurrentEpoch();
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    Timer * lEarliestTimer;
+
+    while ((lEarliestTimer = aLayer.mTimerQueue.Earliest()) != NULL)
+#else  // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     while (aLayer.mTimerList)
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     {
+#if !CHIP_SYSTEM_CONFIG_TIMER_HEAP
+        Timer * lEarliestTimer = aLayer.mTimerList;
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
         // limit the number of timers handled before the control is returned to the event queue.  The bound is similar to
         // (though not exactly same) as that on the sockets-based systems.
 
         // The platform timer API has MSEC resolution so expire any timer with less than 1 msec remaining.
-        if ((timersHandled < Timer::sPool.Size()) && Timer::IsEarlierEpoch(aLayer.mTimerList->mAwakenEpoch, currentEpoch + 1))
+        if ((timersHandled < Timer::sPool.Size()) && Timer::IsEarlierEpoch(lEarliestTimer->mAwakenEpoch, currentEpoch + 1))
         {
-            Timer & lTimer    = *aLayer.mTimerList;
+            Timer & lTimer = *lEarliestTimer;
+#if !CHIP_SYSTEM_CONFIG_TIMER_HEAP
             aLayer.mTimerList = lTimer.mNextTimer;
             lTimer.mNextTimer = NULL;
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
 
             aLayer.mTimerComplete = true;
             lTimer.HandleComplete();
@@ -327,9 +384,9 @@ Error Timer::HandleExpiredTimers(Layer & aLayer)
             currentEpoch = Timer::GetCurrentEpoch();
 
             // the next timer expires in the future, so set the delayMilliseconds to a non-zero value
-            if (currentEpoch < aLayer.mTimerList->mAwakenEpoch)
+            if (currentEpoch < lEarliestTimer->mAwakenEpoch)
             {
-                delayMilliseconds = aLayer.mTimerList->mAwakenEpoch - currentEpoch;
+                delayMilliseconds = lEarliestTimer->mAwakenEpoch - currentEpoch;
             }
             /*
              * StartPlatformTimer() accepts a 32bit value in milliseconds.  Epochs are 64bit numbers.  The only way in which this
@@ -53,6 +53,9 @@ class Layer;
 class DLL_EXPORT Timer : public Object
 {
     friend class Layer;
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    friend class TimerQueue;
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
 
 public:
     /**
@@ -82,8 +85,22 @@ private:
 
     Error ScheduleWork(OnCompleteFunct aOnComplete, void * aAppState);
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+    static constexpr size_t kNotQueued = SIZE_MAX;
+
+    size_t mQueueIndex;
+    size_t mQueueBucket; // kNotQueued for scheduled work, which is never tracked by the timer queue
+    uint32_t mQueueSequence;
+    Timer * mNextInBucket;
+
+    bool IsScheduledWork() const { return OnComplete != nullptr && mQueueBucket == kNotQueued; }
+    void Untrack();
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
+#if !CHIP_SYSTEM_CONFIG_TIMER_HEAP
     Timer * mNextTimer;
+#endif // !CHIP_SYSTEM_CONFIG_TIMER_HEAP
 
     static Error HandleExpiredTimers(Layer & aLayer);
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
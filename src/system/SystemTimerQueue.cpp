@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the chip::System::TimerQueue class.
+ */
+
+// Include module header
+#include <system/SystemTimerQueue.h>
+
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
+#include <system/SystemTimer.h>
+
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace System {
+
+void TimerQueue::Init()
+{
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        mBuckets[i] = nullptr;
+    }
+    mCount        = 0;
+    mNextSequence = 0;
+}
+
+size_t TimerQueue::BucketOf(CompleteFunct aOnComplete, void * aAppState)
+{
+    uint64_t lKey = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(aOnComplete)) * 0x9E3779B97F4A7C15ULL;
+
+    lKey ^= static_cast<uint64_t>(reinterpret_cast<uintptr_t>(aAppState));
+    lKey *= 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<size_t>(lKey >> 32) & (kBucketCount - 1);
+}
+
+bool TimerQueue::IsEarlier(const Timer & aFirst, const Timer & aSecond)
+{
+    if (aFirst.mAwakenEpoch != aSecond.mAwakenEpoch)
+    {
+        return Timer::IsEarlierEpoch(aFirst.mAwakenEpoch, aSecond.mAwakenEpoch);
+    }
+
+    // Same expiration: keep arming order, accounting for sequence wrap.
+    return static_cast<int32_t>(aFirst.mQueueSequence - aSecond.mQueueSequence) < 0;
+}
+
+void TimerQueue::Track(Timer & aTimer)
+{
+    const size_t lBucket = BucketOf(aTimer.OnComplete, aTimer.AppState);
+
+    aTimer.mQueueBucket  = lBucket;
+    aTimer.mNextInBucket = mBuckets[lBucket];
+    mBuckets[lBucket]    = &aTimer;
+    aTimer.mQueueIndex   = Timer::kNotQueued;
+}
+
+void TimerQueue::Schedule(Timer & aTimer)
+{
+    VerifyOrDie(mCount < kCapacity && aTimer.mQueueIndex == Timer::kNotQueued);
+
+    aTimer.mQueueSequence = mNextSequence++;
+    Place(aTimer, mCount++);
+    SiftUp(aTimer.mQueueIndex);
+}
+
+void TimerQueue::Untrack(Timer & aTimer)
+{
+    for (Timer ** lLink = &mBuckets[aTimer.mQueueBucket]; *lLink != nullptr; lLink = &(*lLink)->mNextInBucket)
+    {
+        if (*lLink == &aTimer)
+        {
+            *lLink               = aTimer.mNextInBucket;
+            aTimer.mNextInBucket = nullptr;
+            break;
+        }
+    }
+
+    if (aTimer.mQueueIndex == Timer::kNotQueued)
+    {
+        return;
+    }
+
+    const size_t lIndex = aTimer.mQueueIndex;
+    aTimer.mQueueIndex  = Timer::kNotQueued;
+
+    if (--mCount == lIndex)
+    {
+        return;
+    }
+
+    // Move the last leaf into the hole and restore the heap property in whichever direction is needed.
+    Timer & lMoved = *mHeap[mCount];
+    Place(lMoved, lIndex);
+    SiftUp(lIndex);
+    SiftDown(lMoved.mQueueIndex);
+}
+
+Timer * TimerQueue::EarliestExpired(uint64_t aEpoch, uint32_t aMark) const
+{
+    Timer * lTimer = Earliest();
+
+    if (lTimer == nullptr || Timer::IsEarlierEpoch(aEpoch, lTimer->mAwakenEpoch) ||
+        static_cast<int32_t>(lTimer->mQueueSequence - aMark) >= 0)
+    {
+        return nullptr;
+    }
+
+    return lTimer;
+}
+
+Timer * TimerQueue::Find(CompleteFunct aOnComplete, void * aAppState) const
+{
+    for (Timer * lTimer = mBuckets[BucketOf(aOnComplete, aAppState)]; lTimer != nullptr; lTimer = lTimer->mNextInBucket)
+    {
+        if (lTimer->OnComplete == aOnComplete && lTimer->AppState == aAppState)
+        {
+            return lTimer;
+        }
+    }
+
+    return nullptr;
+}
+
+void TimerQueue::Place(Timer & aTimer, size_t aIndex)
+{
+    mHeap[aIndex]      = &aTimer;
+    aTimer.mQueueIndex = aIndex;
+}
+
+void TimerQueue::SiftUp(size_t aIndex)
+{
+    Timer & lTimer = *mHeap[aIndex];
+
+    while (aIndex > 0)
+    {
+        const size_t lParent = (aIndex - 1) / 2;
+
+        if (!IsEarlier(lTimer, *mHeap[lParent]))
+        {
+            break;
+        }
+
+        Place(*mHeap[lParent], aIndex);
+        aIndex = lParent;
+    }
+
+    Place(lTimer, aIndex);
+}
+
+void TimerQueue::SiftDown(size_t aIndex)
+{
+    Timer & lTimer = *mHeap[aIndex];
+
+    while (true)
+    {
+        const size_t lLeft = 2 * aIndex + 1;
+        size_t lChild      = lLeft;
+
+        if (lLeft >= mCount)
+        {
+            break;
+        }
+
+        if (lLeft + 1 < mCount && IsEarlier(*mHeap[lLeft + 1], *mHeap[lLeft]))
+        {
+            lChild = lLeft + 1;
+        }
+
+        if (!IsEarlier(*mHeap[lChild], lTimer))
+        {
+            break;
+        }
+
+        Place(*mHeap[lChild], aIndex);
+        aIndex = lChild;
+    }
+
+    Place(lTimer, aIndex);
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the chip::System::TimerQueue class, the
+ *      binary-heap backend used to order armed timers when
+ *      CHIP_SYSTEM_CONFIG_TIMER_HEAP is enabled.
+ */
+
+#pragma once
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
+#include <system/SystemError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+class Layer;
+class Timer;
+
+namespace detail {
+
+constexpr size_t TimerQueueBucketCount(size_t aMinimum, size_t aCount = 1)
+{
+    return (aCount >= aMinimum) ? aCount : TimerQueueBucketCount(aMinimum, aCount * 2);
+}
+
+} // namespace detail
+
+/**
+ * @class TimerQueue
+ *
+ * @brief
+ *  Tracks the armed timers of a system layer. Timers are kept in a binary min-heap ordered by expiration (ties broken by
+ *  arming order), and in a hash table keyed on their completion function and application state so that
+ *  Layer::CancelTimer() does not have to scan the timer pool.
+ *
+ *  Both structures are fixed-size, intrusive and sized from CHIP_SYSTEM_CONFIG_NUM_TIMERS. Insertion and removal are
+ *  O(log n); finding the earliest timer is O(1).
+ */
+class TimerQueue
+{
+public:
+    /// Same signature as Timer::OnCompleteFunct.
+    typedef void (*CompleteFunct)(Layer * aLayer, void * aAppState, Error aError);
+
+    void Init();
+
+    /// Makes the timer findable through Find(). Must be called once the timer is armed.
+    void Track(Timer & aTimer);
+
+    /// Adds a tracked timer to the expiration heap.
+    void Schedule(Timer & aTimer);
+
+    /// Removes the timer from both the heap and the lookup table. Must be called when the timer is disarmed.
+    void Untrack(Timer & aTimer);
+
+    /// Returns the armed timer with the earliest expiration, or nullptr if the heap is empty.
+    Timer * Earliest() const { return (mCount > 0) ? mHeap[0] : nullptr; }
+
+    /**
+     * Returns the earliest timer if it expires no later than @a aEpoch and was scheduled before @a aMark was taken,
+     * nullptr otherwise. Marks let a caller expire a batch of timers without also firing the ones re-armed meanwhile.
+     */
+    Timer * EarliestExpired(uint64_t aEpoch, uint32_t aMark) const;
+
+    /// Returns a mark for EarliestExpired(); timers scheduled after this call compare as newer.
+    uint32_t Mark() const { return mNextSequence; }
+
+    /// Returns the armed timer started with the given completion function and application state, if any.
+    Timer * Find(CompleteFunct aOnComplete, void * aAppState) const;
+
+    size_t Count() const { return mCount; }
+
+private:
+    static constexpr size_t kCapacity = CHIP_SYSTEM_CONFIG_NUM_TIMERS;
+
+    static constexpr size_t kBucketCount = detail::TimerQueueBucketCount(kCapacity);
+
+    static size_t BucketOf(CompleteFunct aOnComplete, void * aAppState);
+    static bool IsEarlier(const Timer & aFirst, const Timer & aSecond);
+
+    void Place(Timer & aTimer, size_t aIndex);
+    void SiftUp(size_t aIndex);
+    void SiftDown(size_t aIndex);
+
+    Timer * mHeap[kCapacity];
+    Timer * mBuckets[kBucketCount];
+    size_t mCount;
+    uint32_t mNextSequence;
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file implements the CHIP API to trace the stages of the handling of a message.
+ */
+
+// Include module header
+#include <system/SystemTrace.h>
+
+#include <support/CodeUtils.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace System {
+namespace Trace {
+
+namespace {
+
+const char * const sStageNames[kStage_Max] = {
+    "SecureSessionReceive",
+    "ExchangeReceive",
+    "InteractionModelReceive",
+    "ClusterCommand",
+    "Boot",
+    "BootStorage",
+    "BootTransport",
+    "BootAdvertise",
+    "BootDataModel",
+};
+
+Histogram sHistograms[kStage_Max];
+Span sSpans[CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT];
+// The number of spans recorded, the next of which goes in sSpans[sSpanCount % CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT].
+size_t sSpanCount;
+
+size_t GetBucket(uint32_t durationUs)
+{
+    size_t bucket = 0;
+
+    while (durationUs != 0 && bucket < kNumHistogramBuckets - 1)
+    {
+        durationUs >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+} // namespace
+
+const char * GetStageName(Stage stage)
+{
+    return (stage < kStage_Max) ? sStageNames[stage] : "Unknown";
+}
+
+void RecordSpan(Stage stage, uint64_t startUs, uint64_t endUs)
+{
+    VerifyOrReturn(stage < kStage_Max && endUs >= startUs);
+
+    uint32_t durationUs   = static_cast<uint32_t>(chip::min<uint64_t>(endUs - startUs, UINT32_MAX));
+    Histogram & histogram = sHistograms[stage];
+
+    histogram.mCount++;
+    histogram.mTotalUs += durationUs;
+    histogram.mMaxUs = chip::max(histogram.mMaxUs, durationUs);
+    histogram.mBuckets[GetBucket(durationUs)]++;
+
+    Span & span      = sSpans[sSpanCount % CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT];
+    span.mStartUs    = startUs;
+    span.mDurationUs = durationUs;
+    span.mStage      = stage;
+    sSpanCount++;
+}
+
+const Histogram & GetHistogram(Stage stage)
+{
+    return sHistograms[(stage < kStage_Max) ? stage : kStage_SecureSessionReceive];
+}
+
+uint32_t GetPercentileUs(Stage stage, uint8_t percentile)
+{
+    const Histogram & histogram = GetHistogram(stage);
+    // The rank of the span of the percentile, rounded up
+    uint64_t rank  = (static_cast<uint64_t>(histogram.mCount) * chip::min<uint8_t>(percentile, 100) + 99) / 100;
+    uint64_t total = 0;
+
+    VerifyOrReturnError(histogram.mCount > 0, 0);
+
+    for (size_t bucket = 0; bucket < kNumHistogramBuckets - 1; bucket++)
+    {
+        total += histogram.mBuckets[bucket];
+        if (total >= rank)
+        {
+            uint32_t upperBoundUs = (bucket == 0) ? 0 : static_cast<uint32_t>((1u << bucket) - 1);
+            return chip::min(upperBoundUs, histogram.mMaxUs);
+        }
+    }
+    return histogram.mMaxUs;
+}
+
+size_t GetSpanCount()
+{
+    return sSpanCount;
+}
+
+bool GetSpan(size_t number, Span & span)
+{
+    VerifyOrReturnError(number < sSpanCount && sSpanCount - number <= CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT, false);
+
+    span = sSpans[number % CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT];
+    return true;
+}
+
+void Reset()
+{
+    memset(sHistograms, 0, sizeof(sHistograms));
+    sSpanCount = 0;
+}
+
+void ExportChromeTrace(TraceWriter writer, void * context)
+{
+    char event[128];
+    size_t count = chip::min<size_t>(sSpanCount, CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT);
+
+    writer(context, "{\"traceEvents\":[");
+    for (size_t i = 0; i < count; i++)
+    {
+        const Span & span = sSpans[(sSpanCount - count + i) % CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT];
+        snprintf(event, sizeof(event),
+                 "%s{\"name\":\"%s\",\"cat\":\"chip\",\"ph\":\"X\",\"ts\":%" PRIu64 ",\"dur\":%" PRIu32 ",\"pid\":1,\"tid\":1}",
+                 (i == 0) ? "" : ",", GetStageName(span.mStage), span.mStartUs, span.mDurationUs);
+        writer(context, event);
+    }
+    writer(context, "],\"displayTimeUnit\":\"ms\"}");
+}
+
+} // namespace Trace
+} // namespace System
+} // namespace chip
@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file declares the CHIP API to trace the stages of the handling of a message: scoped spans, timed with the
+ *  high-resolution monotonic clock, into a latency histogram per stage and a buffer of the most recent spans, which can be
+ *  exported as a Chrome / Perfetto trace.
+ */
+
+#pragma once
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+// Include dependent headers
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+namespace Trace {
+
+/**
+ * The stages traced, from the transport up to the cluster callbacks, and those of the server starting. A stage includes the
+ * stages it calls into.
+ */
+enum Stage : uint8_t
+{
+    kStage_SecureSessionReceive,    ///< SecureSessionMgr decoding and decrypting a received message.
+    kStage_ExchangeReceive,         ///< ExchangeManager dispatching a received message to its exchange.
+    kStage_InteractionModelReceive, ///< InteractionModelEngine handling a received message.
+    kStage_ClusterCommand,          ///< A cluster command callback.
+
+    // The timeline of a cold start of the server, from InitServer() to the event loop.
+    kStage_Boot,          ///< The server initializing, of which the stages below are parts.
+    kStage_BootStorage,   ///< Persistent storage, and the admin pairings and session key IDs kept in it.
+    kStage_BootTransport, ///< The transports listening, and the session and exchange managers over them.
+    kStage_BootAdvertise, ///< The commissioning window or test pairing, and the DNS-SD advertisement.
+    kStage_BootDataModel, ///< The data model and the Interaction Model engine.
+
+    kStage_Max
+};
+
+/**
+ * The number of buckets of a histogram. Bucket 0 counts the durations under 1 us, bucket i > 0 the durations in
+ * [2^(i-1), 2^i) us, and the last bucket every duration past it too.
+ */
+constexpr size_t kNumHistogramBuckets = 24;
+
+struct Histogram
+{
+    uint32_t mCount;
+    uint32_t mMaxUs;
+    uint64_t mTotalUs;
+    uint32_t mBuckets[kNumHistogramBuckets];
+};
+
+struct Span
+{
+    uint64_t mStartUs;
+    uint32_t mDurationUs;
+    Stage mStage;
+};
+
+const char * GetStageName(Stage stage);
+
+/**
+ * Record a span of a stage, which ended at endUs. The spans are to be recorded from the thread running the CHIP stack.
+ */
+void RecordSpan(Stage stage, uint64_t startUs, uint64_t endUs);
+
+const Histogram & GetHistogram(Stage stage);
+
+/**
+ * The duration under which the given percentage of the spans of a stage were, rounded up to the upper bound of its bucket.
+ */
+uint32_t GetPercentileUs(Stage stage, uint8_t percentile);
+
+/**
+ * The number of spans recorded since the last reset, which is the number of the next span recorded.
+ */
+size_t GetSpanCount();
+
+/**
+ * Get the span of the given number, counted from 0 since the last reset, if it is still among the most recent spans kept. Those
+ * polling the spans while they are recorded remember the count they got to, and get the spans past it.
+ */
+bool GetSpan(size_t number, Span & span);
+
+/**
+ * Forget the spans recorded until now.
+ */
+void Reset();
+
+/**
+ * Export the most recent spans as a trace in the JSON format of the Chrome trace viewer, which Perfetto reads too, by pieces
+ * handed to writer in turn.
+ */
+using TraceWriter = void (*)(void * context, const char * text);
+void ExportChromeTrace(TraceWriter writer, void * context);
+
+/**
+ * Records a span of a stage lasting for the lifetime of the object.
+ */
+class ScopedSpan
+{
+public:
+    explicit ScopedSpan(Stage stage) : mStartUs(Platform::Layer::GetClock_MonotonicHiRes()), mStage(stage) {}
+    ~ScopedSpan() { RecordSpan(mStage, mStartUs, Platform::Layer::GetClock_MonotonicHiRes()); }
+
+    ScopedSpan(const ScopedSpan &) = delete;
+    ScopedSpan & operator=(const ScopedSpan &) = delete;
+
+private:
+    uint64_t mStartUs;
+    Stage mStage;
+};
+
+} // namespace Trace
+} // namespace System
+} // namespace chip
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+
+/**
+ * Traces the rest of the enclosing scope as a span of stage, one of the Stage enumerators without its kStage_ prefix.
+ */
+#define SYSTEM_TRACE_SCOPE(stage) chip::System::Trace::ScopedSpan systemTraceScope(chip::System::Trace::kStage_##stage)
+
+#else // CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
+
+#define SYSTEM_TRACE_SCOPE(stage)
+
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_TRACING
@@ -0,0 +1,286 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the WorkerPool.
+ */
+
+#include <system/SystemWorkerPool.h>
+
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace System {
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+CHIP_ERROR WorkerPool::Init(Layer * systemLayer, size_t threadCount)
+{
+    int pthreadErr;
+
+    VerifyOrReturnError(mNumThreads == 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(threadCount > 0 && threadCount <= CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mSystemLayer         = systemLayer;
+    mQueueHead           = nullptr;
+    mQueueTail           = nullptr;
+    mDoneHead            = nullptr;
+    mDoneTail            = nullptr;
+    mShuttingDown        = false;
+    mCompletionScheduled = false;
+
+    pthreadErr = pthread_mutex_init(&mMutex, nullptr);
+    VerifyOrDie(pthreadErr == 0);
+    pthreadErr = pthread_cond_init(&mWorkAvailable, nullptr);
+    VerifyOrDie(pthreadErr == 0);
+    pthreadErr = pthread_cond_init(&mWorkDone, nullptr);
+    VerifyOrDie(pthreadErr == 0);
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        pthreadErr = pthread_create(&mThreads[i], nullptr, &WorkerThreadRun, this);
+        VerifyOrDie(pthreadErr == 0);
+        mNumThreads++;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void WorkerPool::Shutdown()
+{
+    int pthreadErr;
+
+    VerifyOrReturn(mNumThreads > 0);
+
+    pthread_mutex_lock(&mMutex);
+    mShuttingDown = true;
+    pthreadErr    = pthread_cond_broadcast(&mWorkAvailable);
+    VerifyOrDie(pthreadErr == 0);
+    pthread_mutex_unlock(&mMutex);
+
+    for (size_t i = 0; i < mNumThreads; i++)
+    {
+        pthreadErr = pthread_join(mThreads[i], nullptr);
+        VerifyOrDie(pthreadErr == 0);
+    }
+    mNumThreads = 0;
+
+    mSystemLayer->CancelTimer(HandleCompletedJobs, this);
+
+    DropJobs(mQueueHead, mQueueTail);
+    DropJobs(mDoneHead, mDoneTail);
+
+    pthread_cond_destroy(&mWorkDone);
+    pthread_cond_destroy(&mWorkAvailable);
+    pthread_mutex_destroy(&mMutex);
+}
+
+CHIP_ERROR WorkerPool::Post(WorkerJob & job, WorkerJob::WorkFunct work, WorkerJob::CompleteFunct complete, void * appState)
+{
+    VerifyOrReturnError(mNumThreads > 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(work != nullptr && complete != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!job.IsPending(), CHIP_ERROR_INCORRECT_STATE);
+
+    job.mWork     = work;
+    job.mComplete = complete;
+    job.mAppState = appState;
+    job.mNext     = nullptr;
+
+    pthread_mutex_lock(&mMutex);
+    job.mState = WorkerJob::State::kQueued;
+    if (mQueueTail != nullptr)
+    {
+        mQueueTail->mNext = &job;
+    }
+    else
+    {
+        mQueueHead = &job;
+    }
+    mQueueTail = &job;
+    pthread_cond_signal(&mWorkAvailable);
+    pthread_mutex_unlock(&mMutex);
+
+    return CHIP_NO_ERROR;
+}
+
+void WorkerPool::Cancel(WorkerJob & job)
+{
+    VerifyOrReturn(mNumThreads > 0 && job.IsPending());
+
+    pthread_mutex_lock(&mMutex);
+    while (job.mState == WorkerJob::State::kRunning)
+    {
+        pthread_cond_wait(&mWorkDone, &mMutex);
+    }
+
+    if (job.mState == WorkerJob::State::kQueued)
+    {
+        Remove(mQueueHead, mQueueTail, job);
+    }
+    else if (job.mState == WorkerJob::State::kDone)
+    {
+        Remove(mDoneHead, mDoneTail, job);
+    }
+    job.mState = WorkerJob::State::kIdle;
+    pthread_mutex_unlock(&mMutex);
+}
+
+void WorkerPool::Remove(WorkerJob *& head, WorkerJob *& tail, WorkerJob & job)
+{
+    WorkerJob * prev = nullptr;
+
+    for (WorkerJob * cur = head; cur != nullptr; prev = cur, cur = cur->mNext)
+    {
+        if (cur == &job)
+        {
+            if (prev != nullptr)
+            {
+                prev->mNext = job.mNext;
+            }
+            else
+            {
+                head = job.mNext;
+            }
+            if (tail == &job)
+            {
+                tail = prev;
+            }
+            job.mNext = nullptr;
+            return;
+        }
+    }
+}
+
+void WorkerPool::DropJobs(WorkerJob *& head, WorkerJob *& tail)
+{
+    while (head != nullptr)
+    {
+        WorkerJob * job = head;
+        head            = job->mNext;
+        job->mNext      = nullptr;
+        job->mState     = WorkerJob::State::kIdle;
+    }
+    tail = nullptr;
+}
+
+void * WorkerPool::WorkerThreadRun(void * arg)
+{
+    WorkerPool * pool = static_cast<WorkerPool *>(arg);
+
+    pthread_mutex_lock(&pool->mMutex);
+    while (true)
+    {
+        // Block until there is work to do or the pool shuts down.
+        while (pool->mQueueHead == nullptr && !pool->mShuttingDown)
+        {
+            pthread_cond_wait(&pool->mWorkAvailable, &pool->mMutex);
+        }
+
+        if (pool->mShuttingDown)
+        {
+            break;
+        }
+
+        WorkerJob * job = pool->mQueueHead;
+        Remove(pool->mQueueHead, pool->mQueueTail, *job);
+        job->mState = WorkerJob::State::kRunning;
+        pthread_mutex_unlock(&pool->mMutex);
+
+        job->mWork(job->mAppState);
+
+        pthread_mutex_lock(&pool->mMutex);
+        job->mState = WorkerJob::State::kDone;
+        if (pool->mDoneTail != nullptr)
+        {
+            pool->mDoneTail->mNext = job;
+        }
+        else
+        {
+            pool->mDoneHead = job;
+        }
+        pool->mDoneTail = job;
+        pthread_cond_broadcast(&pool->mWorkDone);
+
+        // Post the completion to the CHIP thread, unless an event is already pending: each one drains every completed job.
+        // If this fails, the job completes with the next one.
+        if (!pool->mCompletionScheduled)
+        {
+            if (pool->mSystemLayer->ScheduleWork(HandleCompletedJobs, pool) == CHIP_SYSTEM_NO_ERROR)
+            {
+                pool->mCompletionScheduled = true;
+            }
+            else
+            {
+                ChipLogError(chipSystemLayer, "Failed to post worker job completion");
+            }
+        }
+    }
+    pthread_mutex_unlock(&pool->mMutex);
+
+    return nullptr;
+}
+
+void WorkerPool::HandleCompletedJobs(Layer * aLayer, void * aAppState, Error aError)
+{
+    WorkerPool * pool = static_cast<WorkerPool *>(aAppState);
+
+    // Completion functions may cancel or post jobs, so take the completed jobs one at a time.
+    while (true)
+    {
+        pthread_mutex_lock(&pool->mMutex);
+        WorkerJob * job = pool->mDoneHead;
+        if (job != nullptr)
+        {
+            Remove(pool->mDoneHead, pool->mDoneTail, *job);
+            job->mState = WorkerJob::State::kIdle;
+        }
+        else
+        {
+            pool->mCompletionScheduled = false;
+        }
+        pthread_mutex_unlock(&pool->mMutex);
+
+        VerifyOrReturn(job != nullptr);
+
+        job->mComplete(job->mAppState);
+    }
+}
+
+#else // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+CHIP_ERROR WorkerPool::Init(Layer * systemLayer, size_t threadCount)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+void WorkerPool::Shutdown() {}
+
+CHIP_ERROR WorkerPool::Post(WorkerJob & job, WorkerJob::WorkFunct work, WorkerJob::CompleteFunct complete, void * appState)
+{
+    return CHIP_ERROR_INCORRECT_STATE;
+}
+
+void WorkerPool::Cancel(WorkerJob & job) {}
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the WorkerPool, a pool of threads running
+ *      blocking or expensive operations off the CHIP thread, and
+ *      completing them back on it.
+ */
+
+#pragma once
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+#include <core/CHIPError.h>
+#include <support/DLLUtil.h>
+#include <system/SystemLayer.h>
+
+#include <atomic>
+#include <stddef.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+namespace chip {
+namespace System {
+
+class WorkerPool;
+
+/**
+ * @class WorkerJob
+ *
+ * @brief
+ *   A unit of work posted to a WorkerPool, usually embedded in the object it works for. A job is posted at most once at a
+ *   time, and must be cancelled before the object it works for goes away.
+ */
+class WorkerJob
+{
+public:
+    /**
+     * Run on a worker thread. It must only touch state that the CHIP thread leaves alone until the job completes.
+     */
+    typedef void (*WorkFunct)(void * appState);
+
+    /**
+     * Run on the CHIP thread once the work is done, unless the job was cancelled.
+     */
+    typedef void (*CompleteFunct)(void * appState);
+
+    /**
+     * Whether the job is posted and has neither completed nor been cancelled. Only meaningful on the CHIP thread, which is the
+     * only one to make a job idle again; worker threads change the state of a pending job concurrently.
+     */
+    bool IsPending() const { return mState.load() != State::kIdle; }
+
+private:
+    friend class WorkerPool;
+
+    enum class State : uint8_t
+    {
+        kIdle,
+        kQueued,
+        kRunning,
+        kDone,
+    };
+
+    WorkFunct mWork         = nullptr;
+    CompleteFunct mComplete = nullptr;
+    void * mAppState        = nullptr;
+    WorkerJob * mNext       = nullptr;
+    /* Written by worker threads under the pool mutex, but read unlocked by IsPending(). Only goes back to kIdle on the CHIP
+     * thread. */
+    std::atomic<State> mState{ State::kIdle };
+};
+
+/**
+ * @class WorkerPool
+ *
+ * @brief
+ *   Runs WorkerJob work functions on up to CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS threads, in the order they were posted,
+ *   and calls their completion functions back on the CHIP thread through Layer::ScheduleWork().
+ *
+ *   Without CHIP_SYSTEM_CONFIG_POSIX_LOCKING, Init() fails and the users of the pool keep doing their operations inline.
+ */
+class DLL_EXPORT WorkerPool
+{
+public:
+    WorkerPool() {}
+    ~WorkerPool() { Shutdown(); }
+
+    /**
+     * Start the worker threads.
+     *
+     * @param[in] systemLayer   The system layer of the CHIP thread, on which jobs complete.
+     * @param[in] threadCount   The number of threads, at most CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS.
+     */
+    CHIP_ERROR Init(Layer * systemLayer, size_t threadCount);
+
+    /**
+     * Stop and join the worker threads. Jobs still queued are dropped without completing.
+     */
+    void Shutdown();
+
+    bool IsRunning() const { return mNumThreads > 0; }
+
+    /**
+     * Queue a job. Its work function runs on a worker thread, then its completion function on the CHIP thread.
+     */
+    CHIP_ERROR Post(WorkerJob & job, WorkerJob::WorkFunct work, WorkerJob::CompleteFunct complete, void * appState);
+
+    /**
+     * Make sure that neither function of a job runs any more. If its work function is running, wait for it to return.
+     * Does nothing if the job is not pending.
+     */
+    void Cancel(WorkerJob & job);
+
+    /**
+     * Queue a job calling the member function Work of an object on a worker thread, then its member function Complete on the
+     * CHIP thread.
+     */
+    template <class T, void (T::*Work)(), void (T::*Complete)()>
+    CHIP_ERROR Post(WorkerJob & job, T * object)
+    {
+        return Post(job, &RunMember<T, Work>, &RunMember<T, Complete>, object);
+    }
+
+private:
+    template <class T, void (T::*Member)()>
+    static void RunMember(void * appState)
+    {
+        (static_cast<T *>(appState)->*Member)();
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    static void * WorkerThreadRun(void * arg);
+    static void HandleCompletedJobs(Layer * aLayer, void * aAppState, Error aError);
+
+    static void Remove(WorkerJob *& head, WorkerJob *& tail, WorkerJob & job);
+    static void DropJobs(WorkerJob *& head, WorkerJob *& tail);
+
+    pthread_t mThreads[CHIP_SYSTEM_CONFIG_WORKER_POOL_MAX_THREADS];
+    pthread_mutex_t mMutex;
+    pthread_cond_t mWorkAvailable; /* Signalled when a job is queued, or on shutdown. */
+    pthread_cond_t mWorkDone;      /* Signalled when a work function returns. */
+
+    WorkerJob * mQueueHead    = nullptr;
+    WorkerJob * mQueueTail    = nullptr;
+    WorkerJob * mDoneHead     = nullptr;
+    WorkerJob * mDoneTail     = nullptr;
+    bool mShuttingDown        = false;
+    bool mCompletionScheduled = false; /* Whether HandleCompletedJobs is posted to the CHIP thread. */
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    Layer * mSystemLayer = nullptr;
+    size_t mNumThreads   = 0;
+};
+
+} // namespace System
+} // namespace chip
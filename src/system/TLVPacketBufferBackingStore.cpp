@@ -62,6 +62,15 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNextBuffer(chip::TLV::TLVReader & rea
 
 CHIP_ERROR TLVPacketBufferBackingStore::OnInit(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen)
 {
+    if (mHeadBuffer.IsNull())
+    {
+        // The first buffer is allocated by GetNewBuffer() once there is data to write
+        VerifyOrReturnError(mUseChainedBuffers, CHIP_ERROR_INVALID_ARGUMENT);
+        bufStart = nullptr;
+        bufLen   = 0;
+        return CHIP_NO_ERROR;
+    }
+
     bufStart = mHeadBuffer->Start() + mHeadBuffer->DataLength();
     bufLen   = mHeadBuffer->AvailableDataLength();
     return CHIP_NO_ERROR;
@@ -69,6 +78,12 @@ CHIP_ERROR TLVPacketBufferBackingStore::OnInit(chip::TLV::TLVWriter & writer, ui
 
 CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t dataLen)
 {
+    if (mCurrentBuffer.IsNull())
+    {
+        // Nothing was written yet, with no buffer provided
+        return (dataLen == 0) ? CHIP_NO_ERROR : CHIP_ERROR_INCORRECT_STATE;
+    }
+
     uint8_t * endPtr = bufStart + dataLen;
 
     intptr_t length = endPtr - mCurrentBuffer->Start();
@@ -76,7 +91,7 @@ CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & wr
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length));
+    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length), mHeadBuffer);
 
     return CHIP_NO_ERROR;
 }
@@ -88,15 +103,30 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
         return CHIP_ERROR_NO_MEMORY;
     }
 
-    mCurrentBuffer.Advance();
-    if (mCurrentBuffer.IsNull())
+    if (mHeadBuffer.IsNull())
     {
-        mCurrentBuffer = PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
-        if (mCurrentBuffer.IsNull())
+        // The head keeps the default reserve, for the headers of the message it is sent in
+        mHeadBuffer = PacketBufferHandle::New(kMinGrowingBufferSize);
+        if (mHeadBuffer.IsNull())
         {
             return CHIP_ERROR_NO_MEMORY;
         }
-        mHeadBuffer->AddToEnd(mCurrentBuffer.Retain());
+        mCurrentBuffer = mHeadBuffer.Retain();
+    }
+    else
+    {
+        PacketBufferHandle lastBuffer = mCurrentBuffer.Retain();
+
+        mCurrentBuffer.Advance();
+        if (mCurrentBuffer.IsNull())
+        {
+            mCurrentBuffer = PacketBufferHandle::New(NextBufferSize(lastBuffer), 0);
+            if (mCurrentBuffer.IsNull())
+            {
+                return CHIP_ERROR_NO_MEMORY;
+            }
+            mHeadBuffer->AddToEnd(mCurrentBuffer.Retain());
+        }
     }
 
     if (mCurrentBuffer.IsNull())
@@ -113,5 +143,18 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
     return CHIP_NO_ERROR;
 }
 
+uint16_t TLVPacketBufferBackingStore::NextBufferSize(const PacketBufferHandle & lastBuffer)
+{
+    // Buffers from pools are all of the largest size anyway, heap allocated ones double in size
+    const uint32_t size = 2 * static_cast<uint32_t>(lastBuffer->AllocSize());
+
+    if (size < kMinGrowingBufferSize)
+    {
+        return kMinGrowingBufferSize;
+    }
+    return (size < System::PacketBuffer::kMaxSizeWithoutReserve) ? static_cast<uint16_t>(size)
+                                                                  : System::PacketBuffer::kMaxSizeWithoutReserve;
+}
+
 } // namespace System
 } // namespace chip
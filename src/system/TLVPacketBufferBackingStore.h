@@ -48,17 +48,22 @@ public:
      * Take ownership of a backing packet buffer.
      *
      * @param[in]    buffer  A handle to a packet buffer, to be used as backing store for a TLV class.
+     *                       For writing with chained buffers, this may be null, in which case the first
+     *                       buffer is allocated when the first data is written.
      * @param[in]    useChainedBuffers
      *                       If true, advance to the next buffer in the chain once all data or space
      *                       in the current buffer has been consumed; a write will allocate new
-     *                       packet buffers if necessary.
+     *                       packet buffers if necessary. Each new buffer is up to twice the size of
+     *                       the last one, starting from kMinGrowingBufferSize and up to
+     *                       PacketBuffer::kMaxSizeWithoutReserve, so that small encodings use
+     *                       small buffers and large ones need few of them.
      *
      * @note This must take place before initializing a TLV class with this backing store.
      */
     void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
     {
         mHeadBuffer        = std::move(buffer);
-        mCurrentBuffer     = mHeadBuffer.Retain();
+        mCurrentBuffer     = mHeadBuffer.IsNull() ? chip::System::PacketBufferHandle() : mHeadBuffer.Retain();
         mUseChainedBuffers = useChainedBuffers;
     }
     void Adopt(chip::System::PacketBufferHandle && buffer) { Init(std::move(buffer), mUseChainedBuffers); }
@@ -81,7 +86,14 @@ public:
     CHIP_ERROR GetNewBuffer(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
     CHIP_ERROR FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override;
 
+    /**
+     * The size of the first buffer allocated by a write, when none was provided.
+     */
+    static constexpr uint16_t kMinGrowingBufferSize = 128;
+
 protected:
+    static uint16_t NextBufferSize(const chip::System::PacketBufferHandle & lastBuffer);
+
     chip::System::PacketBufferHandle mHeadBuffer;
     chip::System::PacketBufferHandle mCurrentBuffer;
     bool mUseChainedBuffers;
@@ -115,6 +127,8 @@ public:
      * Initializes a TLVWriter object to write to a PacketBuffer.
      *
      * @param[in]    buffer  A handle to PacketBuffer, to be used as backing store for a TLV class.
+     *                       May be null if useChainedBuffers is true, to allocate all buffers as
+     *                       the encoding grows.
      * @param[in]    useChainedBuffers
      *                       If true, advance to the next buffer in the chain once all space
      *                       in the current buffer has been consumed. Once all existing buffers
@@ -24,6 +24,7 @@
 
 #include <stdlib.h>
 #include <system/SystemClock.h>
+#include <system/SystemLayer.h>
 
 namespace chip {
 namespace Time {
@@ -57,13 +58,13 @@ public:
 };
 
 /**
- * A system time source, based on the system platform layer.
+ * A system time source, based on the time at which the system layer event loop last woke.
  */
 template <>
 class TimeSource<Source::kSystem>
 {
 public:
-    uint64_t GetCurrentMonotonicTimeMs() { return System::Platform::Layer::GetClock_MonotonicMS(); }
+    uint64_t GetCurrentMonotonicTimeMs() { return System::Layer::GetClock_MonotonicLoopMS(); }
 };
 
 /**
@@ -0,0 +1,271 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for <tt>chip::System::EventPoller</tt>
+ *
+ */
+
+#include <system/SystemConfig.h>
+
+#include <nlunit-test.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemError.h>
+#include <system/SystemEventPoller.h>
+#include <system/SystemLayer.h>
+
+#include <fcntl.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+using namespace chip::System;
+
+#if CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+namespace {
+
+struct TestContext
+{
+    EventPoller mPoller;
+    int mPipe[2];
+
+    int Poll()
+    {
+        timeval timeout = {};
+        int numReady    = -1;
+
+        return (mPoller.Wait(timeout, numReady) == CHIP_SYSTEM_NO_ERROR) ? numReady : -1;
+    }
+
+    void Drain()
+    {
+        char buffer[16];
+        while (read(mPipe[0], buffer, sizeof(buffer)) > 0)
+        {
+        }
+    }
+};
+
+void TestIdle(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 0);
+
+    lContext.mPoller.Request(lContext.mPipe[0], EventPoller::kRead);
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 0);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lContext.mPipe[0]) == 0);
+}
+
+void TestReadable(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+
+    NL_TEST_ASSERT(inSuite, write(lContext.mPipe[1], "x", 1) == 1);
+
+    lContext.mPoller.Request(lContext.mPipe[0], EventPoller::kRead);
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 1);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lContext.mPipe[0]) == EventPoller::kRead);
+
+    // Interest lasts a single iteration, like an fd_set.
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 0);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lContext.mPipe[0]) == 0);
+
+    lContext.Drain();
+}
+
+void TestRequestedOnly(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+
+    // The write end of an empty pipe is writable, but only the events asked for are reported.
+    lContext.mPoller.Request(lContext.mPipe[1], EventPoller::kWrite);
+    lContext.mPoller.Request(lContext.mPipe[0], EventPoller::kRead);
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 1);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lContext.mPipe[1]) == EventPoller::kWrite);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lContext.mPipe[0]) == 0);
+
+    // Changing the interest of a registered descriptor.
+    NL_TEST_ASSERT(inSuite, write(lContext.mPipe[1], "x", 1) == 1);
+    lContext.mPoller.Request(lContext.mPipe[1], EventPoller::kRead);
+    lContext.mPoller.Request(lContext.mPipe[0], EventPoller::kRead | EventPoller::kWrite);
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 1);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lContext.mPipe[0]) == EventPoller::kRead);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lContext.mPipe[1]) == 0);
+
+    lContext.Drain();
+}
+
+void TestForget(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    int lPipe[2];
+
+    NL_TEST_ASSERT(inSuite, pipe(lPipe) == 0);
+    lContext.mPoller.Request(lPipe[0], EventPoller::kRead);
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 0);
+
+    // Close the registered descriptor and reuse its number for a new, readable one.
+    const int lOldFd = lPipe[0];
+    lContext.mPoller.Request(lOldFd, EventPoller::kRead);
+    lContext.mPoller.Forget(lOldFd);
+    close(lPipe[0]);
+    close(lPipe[1]);
+
+    NL_TEST_ASSERT(inSuite, pipe(lPipe) == 0);
+    NL_TEST_ASSERT(inSuite, lPipe[0] == lOldFd);
+    NL_TEST_ASSERT(inSuite, write(lPipe[1], "x", 1) == 1);
+
+    lContext.mPoller.Request(lPipe[0], EventPoller::kRead);
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 1);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lPipe[0]) == EventPoller::kRead);
+
+    lContext.mPoller.Forget(lPipe[0]);
+    close(lPipe[0]);
+    close(lPipe[1]);
+}
+
+void TestBeyondFdSetSize(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+
+    // Only possible when the process descriptor limit allows it.
+    const int lHighFd = fcntl(lContext.mPipe[0], F_DUPFD, FD_SETSIZE + 8);
+    if (lHighFd < 0)
+    {
+        return;
+    }
+
+    NL_TEST_ASSERT(inSuite, write(lContext.mPipe[1], "x", 1) == 1);
+    lContext.mPoller.Request(lHighFd, EventPoller::kRead);
+    NL_TEST_ASSERT(inSuite, lContext.Poll() == 1);
+    NL_TEST_ASSERT(inSuite, lContext.mPoller.Pending(lHighFd) == EventPoller::kRead);
+
+    lContext.mPoller.Forget(lHighFd);
+    close(lHighFd);
+    lContext.Drain();
+}
+
+void HandleTimer(Layer * aLayer, void * aAppState, Error aError)
+{
+    (*static_cast<int *>(aAppState))++;
+}
+
+void TestLayerEvents(nlTestSuite * inSuite, void * aContext)
+{
+    Layer lLayer;
+    int lFired = 0;
+    int lNumReady;
+
+    NL_TEST_ASSERT(inSuite, lLayer.Init(nullptr) == CHIP_SYSTEM_NO_ERROR);
+    EventPoller & lPoller = lLayer.GetEventPoller();
+
+    // A due timer bounds the wait to zero and fires from HandleEvents().
+    NL_TEST_ASSERT(inSuite, lLayer.StartTimer(0, HandleTimer, &lFired) == CHIP_SYSTEM_NO_ERROR);
+    timeval lSleepTime = { 10, 0 };
+    lLayer.PrepareEvents(lSleepTime);
+    NL_TEST_ASSERT(inSuite, lSleepTime.tv_sec == 0 && lSleepTime.tv_usec == 0);
+    NL_TEST_ASSERT(inSuite, lPoller.Wait(lSleepTime, lNumReady) == CHIP_SYSTEM_NO_ERROR);
+    lLayer.HandleEvents();
+    NL_TEST_ASSERT(inSuite, lFired == 1);
+
+    // WakeSelect() wakes the poller, and HandleEvents() confirms the wake event.
+    lLayer.WakeSelect();
+    lSleepTime = { 10, 0 };
+    lLayer.PrepareEvents(lSleepTime);
+    NL_TEST_ASSERT(inSuite, lPoller.Wait(lSleepTime, lNumReady) == CHIP_SYSTEM_NO_ERROR && lNumReady == 1);
+    lLayer.HandleEvents();
+
+    lSleepTime = { 0, 0 };
+    lLayer.PrepareEvents(lSleepTime);
+    NL_TEST_ASSERT(inSuite, lPoller.Wait(lSleepTime, lNumReady) == CHIP_SYSTEM_NO_ERROR && lNumReady == 0);
+
+    NL_TEST_ASSERT(inSuite, lLayer.Shutdown() == CHIP_SYSTEM_NO_ERROR);
+}
+
+int TestSetup(void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+
+    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    VerifyOrReturnError(lContext.mPoller.Init() == CHIP_SYSTEM_NO_ERROR, FAILURE);
+    VerifyOrReturnError(pipe(lContext.mPipe) == 0, FAILURE);
+    VerifyOrReturnError(fcntl(lContext.mPipe[0], F_SETFL, O_NONBLOCK) == 0, FAILURE);
+
+    return SUCCESS;
+}
+
+int TestTeardown(void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+
+    lContext.mPoller.Shutdown();
+    close(lContext.mPipe[0]);
+    close(lContext.mPipe[1]);
+    chip::Platform::MemoryShutdown();
+
+    return SUCCESS;
+}
+
+} // namespace
+
+// Test Suite
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("EventPoller::TestIdle",              TestIdle),
+    NL_TEST_DEF("EventPoller::TestReadable",          TestReadable),
+    NL_TEST_DEF("EventPoller::TestRequestedOnly",     TestRequestedOnly),
+    NL_TEST_DEF("EventPoller::TestForget",            TestForget),
+    NL_TEST_DEF("EventPoller::TestBeyondFdSetSize",   TestBeyondFdSetSize),
+    NL_TEST_DEF("EventPoller::TestLayerEvents",       TestLayerEvents),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+static nlTestSuite kTheSuite =
+{
+    "chip-system-event-poller",
+    sTests,
+    TestSetup,
+    TestTeardown
+};
+// clang-format on
+
+int TestSystemEventPoller(void)
+{
+    TestContext context;
+
+    nlTestRunner(&kTheSuite, &context);
+
+    return nlTestRunnerStats(&kTheSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemEventPoller)
+#else  // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
+int TestSystemEventPoller(void)
+{
+    return SUCCESS;
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_EVENT_POLLER
@@ -38,6 +38,7 @@
 #include <support/CodeUtils.h>
 #include <support/UnitTestRegistration.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemPacketBufferSlab.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -132,6 +133,9 @@ public:
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    static void CheckSlab(nlTestSuite * inSuite, void * inContext);
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
 
     static void PrintHandle(const char * tag, const PacketBuffer * buffer)
     {
@@ -1904,6 +1908,70 @@ void PacketBufferTest::CheckPacketBufferWriter(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, memcmp(yayBuffer->Start(), kPayload, sizeof kPayload) == 0);
 }
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+void PacketBufferTest::CheckSlab(nlTestSuite * inSuite, void * inContext)
+{
+    using ::chip::System::PacketBufferSlab;
+
+    constexpr size_t kSmallClass = 0;
+    constexpr size_t kMaxClass   = PacketBufferSlab::kNumClasses - 1;
+    PacketBufferSlab::ClassStatistics small;
+    PacketBufferSlab::ClassStatistics max;
+    PacketBufferSlab::ClassStatistics stats;
+
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kSmallClass, small));
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kMaxClass, max));
+    NL_TEST_ASSERT(inSuite, !PacketBufferSlab::GetStatistics(PacketBufferSlab::kNumClasses, stats));
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::BlockSize(max.mBlockSize + 1) == 0);
+
+    // A short message takes a block of the smallest class, and keeps its requested size.
+    PacketBufferHandle handle = PacketBufferHandle::New(16, 0);
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    NL_TEST_ASSERT(inSuite, handle->AllocSize() == 16);
+    PacketBuffer * const buffer = handle.mBuffer;
+
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kSmallClass, stats));
+    NL_TEST_ASSERT(inSuite, stats.mInUse == small.mInUse + 1);
+    NL_TEST_ASSERT(inSuite, stats.mHighWatermark >= stats.mInUse);
+    NL_TEST_ASSERT(inSuite, stats.mRequestedBytes == small.mRequestedBytes + 16 + PacketBuffer::kStructureSize);
+    NL_TEST_ASSERT(inSuite, stats.UnusedBytes() == small.UnusedBytes() + stats.mBlockSize - 16 - PacketBuffer::kStructureSize);
+
+    // A released block is kept for reuse.
+    handle = nullptr;
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kSmallClass, stats));
+    NL_TEST_ASSERT(inSuite, stats.mInUse == small.mInUse);
+    NL_TEST_ASSERT(inSuite, stats.mFree >= 1);
+
+    handle = PacketBufferHandle::New(8, 0);
+    NL_TEST_ASSERT(inSuite, handle.mBuffer == buffer);
+
+    // A maximum-size buffer takes a block of the largest class, and right-sizing moves it to the smallest.
+    handle = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    handle->SetDataLength(4);
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kMaxClass, stats));
+    NL_TEST_ASSERT(inSuite, stats.mInUse == max.mInUse + 1);
+
+    handle.RightSize();
+    NL_TEST_ASSERT(inSuite, handle->AllocSize() == 4);
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kMaxClass, stats));
+    NL_TEST_ASSERT(inSuite, stats.mInUse == max.mInUse);
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kSmallClass, stats));
+    NL_TEST_ASSERT(inSuite, stats.mInUse == small.mInUse + 1);
+
+    // Purging returns the cached blocks to the heap, but leaves the blocks in use alone.
+    handle = nullptr;
+    PacketBufferSlab::Purge();
+    for (size_t i = 0; i < PacketBufferSlab::kNumClasses; i++)
+    {
+        NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(i, stats));
+        NL_TEST_ASSERT(inSuite, stats.mFree == 0);
+    }
+    NL_TEST_ASSERT(inSuite, PacketBufferSlab::GetStatistics(kSmallClass, stats));
+    NL_TEST_ASSERT(inSuite, stats.mInUse == small.mInUse);
+}
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -1944,6 +2012,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    NL_TEST_DEF("PacketBuffer::Slab",                   PacketBufferTest::CheckSlab),
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
 
     NL_TEST_SENTINEL()
 };
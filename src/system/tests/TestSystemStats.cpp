@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for <tt>chip::System::Stats</tt>
+ *
+ */
+
+#include <system/SystemStats.h>
+
+#include <nlunit-test.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <string>
+
+using namespace chip::System;
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+namespace {
+
+void AppendText(void * context, const char * text)
+{
+    static_cast<std::string *>(context)->append(text);
+}
+
+void TestCounters(nlTestSuite * inSuite, void * aContext)
+{
+    Stats::Snapshot before;
+    Stats::Snapshot after;
+    Stats::Snapshot difference;
+
+    Stats::UpdateSnapshot(before);
+    SYSTEM_STATS_COUNT(Stats::kReliableMessageMgr_NumRetransmissions);
+    SYSTEM_STATS_COUNT(Stats::kReliableMessageMgr_NumRetransmissions);
+    SYSTEM_STATS_COUNT_BY_N(Stats::kInteractionModel_NumReportBytes, 100);
+    Stats::UpdateSnapshot(after);
+
+    // Counters only go up, and are no leak
+    NL_TEST_ASSERT(inSuite, !Stats::Difference(difference, after, before));
+    NL_TEST_ASSERT(inSuite, difference.mCounters[Stats::kReliableMessageMgr_NumRetransmissions] == 2);
+    NL_TEST_ASSERT(inSuite, difference.mCounters[Stats::kInteractionModel_NumReportBytes] == 100);
+    NL_TEST_ASSERT(inSuite, difference.mCounters[Stats::kCrypto_NumEncryptions] == 0);
+}
+
+void TestPrometheusText(nlTestSuite * inSuite, void * aContext)
+{
+    std::string text;
+
+    SYSTEM_STATS_SET(Stats::kInteractionModel_NumReadHandlers, 2);
+    SYSTEM_STATS_SET(Stats::kInteractionModel_NumReadHandlers, 1);
+    Stats::WritePrometheusText(AppendText, &text);
+
+    NL_TEST_ASSERT(inSuite, text.find("# TYPE chip_resources_in_use gauge\n") == 0);
+    NL_TEST_ASSERT(inSuite,
+                   text.find("\nchip_resources_in_use{resource=\"InteractionModel_NumReadHandlersInUse\"} 1\n") !=
+                       std::string::npos);
+    NL_TEST_ASSERT(inSuite,
+                   text.find("\nchip_resources_high_watermark{resource=\"InteractionModel_NumReadHandlersInUse\"} 2\n") !=
+                       std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("\n# TYPE chip_events_total counter\n") != std::string::npos);
+    NL_TEST_ASSERT(inSuite, text.find("\nchip_events_total{event=\"Crypto_NumDecryptionFailures\"} ") != std::string::npos);
+}
+
+} // namespace
+
+// Test Suite
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("Stats::TestCounters",          TestCounters),
+    NL_TEST_DEF("Stats::TestPrometheusText",    TestPrometheusText),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+static nlTestSuite kTheSuite =
+{
+    "chip-system-stats",
+    sTests
+};
+// clang-format on
+
+int TestSystemStats(void)
+{
+    // Run test suit againt one context.
+    nlTestRunner(&kTheSuite, nullptr);
+
+    return nlTestRunnerStats(&kTheSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemStats)
+#else  // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+int TestSystemStats(void)
+{
+    return SUCCESS;
+}
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
@@ -50,6 +50,7 @@
 #include <errno.h>
 #include <stdint.h>
 #include <string.h>
+#include <unistd.h>
 
 using chip::ErrorStr;
 using namespace chip::System;
@@ -206,6 +207,167 @@ static void CheckStarvation(nlTestSuite * inSuite, void * aContext)
     ServiceEvents(lSys, sleepTime);
 }
 
+struct OrderedTimer
+{
+    TestContext * mContext;
+    uint32_t mDelay;
+};
+
+static uint32_t sOrderedFired[8];
+static size_t sNumOrderedFired;
+
+void HandleOrderedTimer(Layer * aLayer, void * aState, Error aError)
+{
+    (void) aLayer, (void) aError;
+    OrderedTimer & lTimer = *static_cast<OrderedTimer *>(aState);
+
+    NL_TEST_ASSERT(lTimer.mContext->mTestSuite, sNumOrderedFired < sizeof(sOrderedFired) / sizeof(sOrderedFired[0]));
+    if (sNumOrderedFired < sizeof(sOrderedFired) / sizeof(sOrderedFired[0]))
+    {
+        sOrderedFired[sNumOrderedFired++] = lTimer.mDelay;
+    }
+}
+
+static void CheckOrder(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    Layer & lSys           = *lContext.mLayer;
+
+    // Armed out of order, with one restarted and one cancelled, to exercise every path of the timer bookkeeping.
+    OrderedTimer lTimers[] = { { &lContext, 30 }, { &lContext, 10 }, { &lContext, 25 }, { &lContext, 5 },
+                               { &lContext, 40 }, { &lContext, 15 }, { &lContext, 20 } };
+    const size_t kNumTimers   = sizeof(lTimers) / sizeof(lTimers[0]);
+    const size_t kExpectFired = kNumTimers - 1;
+
+    sNumOrderedFired = 0;
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        NL_TEST_ASSERT(inSuite, lSys.StartTimer(lTimers[i].mDelay, HandleOrderedTimer, &lTimers[i]) == CHIP_SYSTEM_NO_ERROR);
+    }
+
+    lTimers[0].mDelay = 35;
+    NL_TEST_ASSERT(inSuite, lSys.StartTimer(lTimers[0].mDelay, HandleOrderedTimer, &lTimers[0]) == CHIP_SYSTEM_NO_ERROR);
+    lSys.CancelTimer(HandleOrderedTimer, &lTimers[2]);
+
+    const uint64_t kDeadline = Layer::GetClock_MonotonicMS() + 1000;
+    while (sNumOrderedFired < kExpectFired && Layer::GetClock_MonotonicMS() < kDeadline)
+    {
+        struct timeval sleepTime;
+        sleepTime.tv_sec  = 0;
+        sleepTime.tv_usec = 1000; // 1 ms tick
+        ServiceEvents(lSys, sleepTime);
+    }
+
+    NL_TEST_ASSERT(inSuite, sNumOrderedFired == kExpectFired);
+    for (size_t i = 1; i < sNumOrderedFired; i++)
+    {
+        NL_TEST_ASSERT(inSuite, sOrderedFired[i - 1] < sOrderedFired[i]);
+    }
+    for (size_t i = 0; i < sNumOrderedFired; i++)
+    {
+        NL_TEST_ASSERT(inSuite, sOrderedFired[i] != 25 && sOrderedFired[i] != 30);
+    }
+}
+
+void HandleTimeStampTimer(Layer * aLayer, void * aState, Error aError)
+{
+    (void) aLayer, (void) aError;
+    *static_cast<uint64_t *>(aState) = Layer::GetClock_MonotonicMS();
+}
+
+static void CheckSlack(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    Layer & lSys           = *lContext.mLayer;
+    uint64_t lExactFired   = 0;
+    uint64_t lMergedFired  = 0;
+    uint64_t lAloneFired   = 0;
+
+    const uint64_t kStart = Layer::GetClock_MonotonicMS();
+
+    // The first slack window covers the exact timer, which it merges into; the second covers no other timer.
+    NL_TEST_ASSERT(inSuite, lSys.StartTimer(30, HandleTimeStampTimer, &lExactFired) == CHIP_SYSTEM_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, lSys.StartTimerWithSlack(10, 40, HandleTimeStampTimer, &lMergedFired) == CHIP_SYSTEM_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, lSys.StartTimerWithSlack(10, 5, HandleTimeStampTimer, &lAloneFired) == CHIP_SYSTEM_NO_ERROR);
+
+    const uint64_t kDeadline = kStart + 1000;
+    while ((lExactFired == 0 || lMergedFired == 0 || lAloneFired == 0) && Layer::GetClock_MonotonicMS() < kDeadline)
+    {
+        struct timeval sleepTime;
+        sleepTime.tv_sec  = 0;
+        sleepTime.tv_usec = 1000; // 1 ms tick
+        ServiceEvents(lSys, sleepTime);
+    }
+
+    NL_TEST_ASSERT(inSuite, lExactFired != 0 && lMergedFired != 0 && lAloneFired != 0);
+    NL_TEST_ASSERT(inSuite, lMergedFired >= kStart + 30);
+    NL_TEST_ASSERT(inSuite, lAloneFired >= kStart + 10 && lAloneFired <= lExactFired);
+}
+
+struct LoopTimes
+{
+    uint64_t mBefore  = 0;
+    uint64_t mAfter   = 0;
+    uint64_t mPrecise = 0;
+};
+
+void HandleLoopTimeTimer(Layer * aLayer, void * aState, Error aError)
+{
+    (void) aLayer, (void) aError;
+    LoopTimes & lTimes = *static_cast<LoopTimes *>(aState);
+
+    lTimes.mBefore = Layer::GetClock_MonotonicLoopMS();
+    usleep(5000);
+    lTimes.mAfter   = Layer::GetClock_MonotonicLoopMS();
+    lTimes.mPrecise = Layer::GetClock_MonotonicMS();
+}
+
+static void CheckLoopTime(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    Layer & lSys           = *lContext.mLayer;
+    LoopTimes lTimes;
+
+    const uint64_t kStart = Layer::GetClock_MonotonicMS();
+
+    NL_TEST_ASSERT(inSuite, lSys.StartTimer(10, HandleLoopTimeTimer, &lTimes) == CHIP_SYSTEM_NO_ERROR);
+
+    const uint64_t kDeadline = kStart + 1000;
+    while (lTimes.mPrecise == 0 && Layer::GetClock_MonotonicMS() < kDeadline)
+    {
+        struct timeval sleepTime;
+        sleepTime.tv_sec  = 0;
+        sleepTime.tv_usec = 1000; // 1 ms tick
+        ServiceEvents(lSys, sleepTime);
+    }
+
+    // The loop time is the time the loop woke at for the whole of the handler, which the precise clock moves past.
+    NL_TEST_ASSERT(inSuite, lTimes.mPrecise != 0);
+    NL_TEST_ASSERT(inSuite, lTimes.mBefore >= kStart + 10);
+    NL_TEST_ASSERT(inSuite, lTimes.mAfter == lTimes.mBefore);
+    NL_TEST_ASSERT(inSuite, lTimes.mPrecise >= lTimes.mBefore + 5);
+}
+
+static void CheckWakeAlignment(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    Layer & lSys           = *lContext.mLayer;
+
+    // Without a period, wake times are left alone.
+    NL_TEST_ASSERT(inSuite, lSys.GetWakeAlignmentPeriod() == 0);
+    NL_TEST_ASSERT(inSuite, lSys.AlignWakeTime(1234, 1000) == 1234);
+
+    lSys.SetWakeAlignmentPeriod(500);
+    NL_TEST_ASSERT(inSuite, lSys.AlignWakeTime(1234, 1000) == 1500);
+    NL_TEST_ASSERT(inSuite, lSys.AlignWakeTime(1234, 266) == 1500);
+    NL_TEST_ASSERT(inSuite, lSys.AlignWakeTime(1234, 265) == 1234);
+    NL_TEST_ASSERT(inSuite, lSys.AlignWakeTime(1234, 0) == 1234);
+    NL_TEST_ASSERT(inSuite, lSys.AlignWakeTime(1500, 1000) == 1500);
+
+    lSys.SetWakeAlignmentPeriod(0);
+}
+
 // Test Suite
 
 /**
@@ -215,7 +377,11 @@ static void CheckStarvation(nlTestSuite * inSuite, void * aContext)
 static const nlTest sTests[] =
 {
     NL_TEST_DEF("Timer::TestOverflow",             CheckOverflow),
+    NL_TEST_DEF("Timer::TestTimerOrder",           CheckOrder),
+    NL_TEST_DEF("Timer::TestTimerSlack",           CheckSlack),
+    NL_TEST_DEF("Timer::TestLoopTime",             CheckLoopTime),
     NL_TEST_DEF("Timer::TestTimerStarvation",      CheckStarvation),
+    NL_TEST_DEF("Timer::TestWakeAlignment",        CheckWakeAlignment),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,334 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a microbenchmark for the timer bookkeeping of
+ *      <tt>chip::System::Layer</tt>. It fills the timer pool, then
+ *      measures starting, cancelling and expiring timers, so the
+ *      list/pool-scan and CHIP_SYSTEM_CONFIG_TIMER_HEAP backends can be
+ *      compared on a given target. Results are printed; the assertions
+ *      only check that every timer was accounted for.
+ *
+ */
+
+#include <system/SystemConfig.h>
+
+#include <nlunit-test.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemError.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+#include <lwip/init.h>
+#include <lwip/sys.h>
+#include <lwip/tcpip.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
+#include <sys/select.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+using namespace chip::System;
+
+namespace {
+
+// Leave a little headroom in the pool for timers started by the layer itself.
+constexpr size_t kNumTimers  = (CHIP_SYSTEM_CONFIG_NUM_TIMERS > 4) ? (CHIP_SYSTEM_CONFIG_NUM_TIMERS - 2) : 1;
+constexpr size_t kIterations = 200;
+
+// Long enough that nothing expires while start/cancel is being measured.
+constexpr uint32_t kBaseDelayMs = 60000;
+
+struct BenchmarkContext
+{
+    Layer * mLayer;
+    nlTestSuite * mTestSuite;
+    size_t mFired;
+    uint8_t mTimerStates[kNumTimers];
+};
+
+void HandleTimerFired(Layer * aLayer, void * aAppState, Error aError)
+{
+    (void) aLayer, (void) aError;
+    BenchmarkContext & lContext = *static_cast<BenchmarkContext *>(aAppState);
+    lContext.mFired++;
+}
+
+void HandleBenchmarkTimerFired(Layer * aLayer, void * aAppState, Error aError)
+{
+    (void) aLayer, (void) aError;
+    // Each benchmark timer's app state points into BenchmarkContext::mTimerStates; count through the slot.
+    (*static_cast<uint8_t *>(aAppState))++;
+}
+
+void ServiceEvents(Layer & aLayer)
+{
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
+    fd_set readFDs, writeFDs, exceptFDs;
+    int numFDs = 0;
+    struct timeval sleepTime;
+
+    sleepTime.tv_sec  = 0;
+    sleepTime.tv_usec = 0;
+
+    FD_ZERO(&readFDs);
+    FD_ZERO(&writeFDs);
+    FD_ZERO(&exceptFDs);
+
+    aLayer.PrepareSelect(numFDs, &readFDs, &writeFDs, &exceptFDs, sleepTime);
+    int selectRes = select(numFDs, &readFDs, &writeFDs, &exceptFDs, &sleepTime);
+    aLayer.HandleSelectResult(selectRes, &readFDs, &writeFDs, &exceptFDs);
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
+
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+    aLayer.HandlePlatformTimer();
+#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+}
+
+void PrintResult(const char * aName, uint64_t aElapsedUs, size_t aOperations)
+{
+    printf("    %-28s %8" PRIu64 " us total, %6" PRIu64 " ns/op (%u timers, %u ops)\n", aName, aElapsedUs,
+           (aOperations > 0) ? (aElapsedUs * 1000 / aOperations) : 0, static_cast<unsigned>(kNumTimers),
+           static_cast<unsigned>(aOperations));
+}
+
+void BenchmarkStartCancel(nlTestSuite * inSuite, void * aContext)
+{
+    BenchmarkContext & lContext = *static_cast<BenchmarkContext *>(aContext);
+    Layer & lSys                = *lContext.mLayer;
+    uint64_t lStartElapsed      = 0;
+    uint64_t lCancelElapsed     = 0;
+    bool lAllStarted            = true;
+
+    for (size_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        // Arm in order of decreasing expiration, the worst case for a sorted insert.
+        uint64_t lBegin = Layer::GetClock_MonotonicHiRes();
+        for (size_t i = 0; i < kNumTimers; i++)
+        {
+            const uint32_t lDelay = kBaseDelayMs + static_cast<uint32_t>(kNumTimers - i);
+            lAllStarted &= (lSys.StartTimer(lDelay, HandleBenchmarkTimerFired, &lContext.mTimerStates[i]) == CHIP_SYSTEM_NO_ERROR);
+        }
+        lStartElapsed += Layer::GetClock_MonotonicHiRes() - lBegin;
+
+        // Cancel in arming order, so the lookup cannot rely on the most recent timer being found first.
+        lBegin = Layer::GetClock_MonotonicHiRes();
+        for (size_t i = 0; i < kNumTimers; i++)
+        {
+            lSys.CancelTimer(HandleBenchmarkTimerFired, &lContext.mTimerStates[i]);
+        }
+        lCancelElapsed += Layer::GetClock_MonotonicHiRes() - lBegin;
+    }
+
+    NL_TEST_ASSERT(inSuite, lAllStarted);
+
+    chip::System::Stats::count_t lInUse, lHighWatermark;
+    Timer::GetStatistics(lInUse, lHighWatermark);
+    NL_TEST_ASSERT(inSuite, lInUse == 0);
+
+    PrintResult("StartTimer", lStartElapsed, kNumTimers * kIterations);
+    PrintResult("CancelTimer", lCancelElapsed, kNumTimers * kIterations);
+}
+
+void BenchmarkRestart(nlTestSuite * inSuite, void * aContext)
+{
+    BenchmarkContext & lContext = *static_cast<BenchmarkContext *>(aContext);
+    Layer & lSys                = *lContext.mLayer;
+    bool lAllStarted            = true;
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        lAllStarted &= (lSys.StartTimer(kBaseDelayMs, HandleBenchmarkTimerFired, &lContext.mTimerStates[i]) == CHIP_SYSTEM_NO_ERROR);
+    }
+
+    // Restarting an armed timer (e.g. a retransmission or report interval) cancels and re-arms it.
+    const uint64_t lBegin = Layer::GetClock_MonotonicHiRes();
+    for (size_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        for (size_t i = 0; i < kNumTimers; i++)
+        {
+            const uint32_t lDelay = kBaseDelayMs + static_cast<uint32_t>((i * 7 + iteration) % kNumTimers);
+            lAllStarted &= (lSys.StartTimer(lDelay, HandleBenchmarkTimerFired, &lContext.mTimerStates[i]) == CHIP_SYSTEM_NO_ERROR);
+        }
+    }
+    const uint64_t lElapsed = Layer::GetClock_MonotonicHiRes() - lBegin;
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        lSys.CancelTimer(HandleBenchmarkTimerFired, &lContext.mTimerStates[i]);
+    }
+
+    NL_TEST_ASSERT(inSuite, lAllStarted);
+    PrintResult("StartTimer (restart armed)", lElapsed, kNumTimers * kIterations);
+}
+
+void BenchmarkExpire(nlTestSuite * inSuite, void * aContext)
+{
+    BenchmarkContext & lContext = *static_cast<BenchmarkContext *>(aContext);
+    Layer & lSys                = *lContext.mLayer;
+    uint64_t lElapsed           = 0;
+
+    lContext.mFired = 0;
+
+    for (size_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        // A single timer armed from a distinct app state per slot, all already due.
+        for (size_t i = 0; i < kNumTimers; i++)
+        {
+            lContext.mTimerStates[i] = 0;
+            lSys.StartTimer(0, HandleBenchmarkTimerFired, &lContext.mTimerStates[i]);
+        }
+
+        const uint64_t lBegin = Layer::GetClock_MonotonicHiRes();
+        for (size_t remaining = kNumTimers; remaining > 0;)
+        {
+            ServiceEvents(lSys);
+
+            remaining = 0;
+            for (size_t i = 0; i < kNumTimers; i++)
+            {
+                remaining += (lContext.mTimerStates[i] == 0) ? 1 : 0;
+            }
+        }
+        lElapsed += Layer::GetClock_MonotonicHiRes() - lBegin;
+
+        for (size_t i = 0; i < kNumTimers; i++)
+        {
+            lContext.mFired += lContext.mTimerStates[i];
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, lContext.mFired == kNumTimers * kIterations);
+    PrintResult("Expire", lElapsed, kNumTimers * kIterations);
+
+    // An idle loop iteration with the pool half full of far-future timers measures the per-iteration scan cost.
+    for (size_t i = 0; i < kNumTimers / 2; i++)
+    {
+        lSys.StartTimer(kBaseDelayMs, HandleTimerFired, &lContext.mTimerStates[i]);
+    }
+
+    const uint64_t lBegin = Layer::GetClock_MonotonicHiRes();
+    for (size_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        ServiceEvents(lSys);
+    }
+    PrintResult("Idle loop iteration", Layer::GetClock_MonotonicHiRes() - lBegin, kIterations);
+
+    for (size_t i = 0; i < kNumTimers / 2; i++)
+    {
+        lSys.CancelTimer(HandleTimerFired, &lContext.mTimerStates[i]);
+    }
+}
+
+// Test Suite
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Timer::BenchmarkStartCancel", BenchmarkStartCancel),
+    NL_TEST_DEF("Timer::BenchmarkRestart",     BenchmarkRestart),
+    NL_TEST_DEF("Timer::BenchmarkExpire",      BenchmarkExpire),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSetup(void * aContext);
+int TestTeardown(void * aContext);
+
+// clang-format off
+nlTestSuite kTheSuite =
+{
+    "chip-system-timer-benchmark",
+    &sTests[0],
+    TestSetup,
+    TestTeardown
+};
+// clang-format on
+
+Layer sLayer;
+
+/**
+ *  Set up the test suite.
+ */
+int TestSetup(void * aContext)
+{
+    BenchmarkContext & lContext = *reinterpret_cast<BenchmarkContext *>(aContext);
+    void * lLayerContext        = nullptr;
+
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+#if LWIP_VERSION_MAJOR <= 2 && LWIP_VERSION_MINOR < 1
+    static sys_mbox_t * sLwIPEventQueue = NULL;
+
+    sys_mbox_new(sLwIPEventQueue, 100);
+    lLayerContext = &sLwIPEventQueue;
+    tcpip_init(NULL, NULL);
+#endif
+#endif // CHIP_SYSTEM_CONFIG_USE_LWIP
+
+    if (sLayer.Init(lLayerContext) != CHIP_SYSTEM_NO_ERROR)
+    {
+        return FAILURE;
+    }
+
+    lContext.mLayer     = &sLayer;
+    lContext.mTestSuite = &kTheSuite;
+
+    printf("Timer backend: %s\n", CHIP_SYSTEM_CONFIG_TIMER_HEAP ? "heap" : "default");
+
+    return (SUCCESS);
+}
+
+/**
+ *  Tear down the test suite.
+ */
+int TestTeardown(void * aContext)
+{
+    BenchmarkContext & lContext = *reinterpret_cast<BenchmarkContext *>(aContext);
+
+    lContext.mLayer->Shutdown();
+
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+#if !(LWIP_VERSION_MAJOR >= 2 && LWIP_VERSION_MINOR >= 1)
+    tcpip_finish(NULL, NULL);
+#endif
+#endif
+
+    return (SUCCESS);
+}
+
+} // namespace
+
+int TestSystemTimerBenchmark(void)
+{
+    BenchmarkContext context;
+
+    nlTestRunner(&kTheSuite, &context);
+
+    return nlTestRunnerStats(&kTheSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemTimerBenchmark)
@@ -0,0 +1,296 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for the CHIP_SYSTEM_CONFIG_TIMER_HEAP
+ *      backend of <tt>chip::System::Timer</tt>. It is built against a
+ *      system layer compiled with the timer heap enabled, and checks
+ *      the timer order, cancellation, and work scheduled from other
+ *      threads while the event loop arms and cancels timers.
+ *
+ */
+
+#include <system/SystemConfig.h>
+
+#include <nlunit-test.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemError.h>
+#include <system/SystemLayer.h>
+#include <system/SystemStats.h>
+#include <system/SystemTimer.h>
+
+#include <sys/select.h>
+
+#include <atomic>
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#if !CHIP_SYSTEM_CONFIG_TIMER_HEAP || !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#error "This test needs a sockets system layer built with CHIP_SYSTEM_CONFIG_TIMER_HEAP"
+#endif
+
+using chip::ErrorStr;
+using namespace chip::System;
+
+namespace {
+
+void ServiceEvents(Layer & aLayer)
+{
+    fd_set readFDs, writeFDs, exceptFDs;
+    int numFDs = 0;
+    struct timeval sleepTime;
+
+    sleepTime.tv_sec  = 0;
+    sleepTime.tv_usec = 1000; // 1 ms tick
+
+    FD_ZERO(&readFDs);
+    FD_ZERO(&writeFDs);
+    FD_ZERO(&exceptFDs);
+
+    aLayer.PrepareSelect(numFDs, &readFDs, &writeFDs, &exceptFDs, sleepTime);
+
+    int selectRes = select(numFDs, &readFDs, &writeFDs, &exceptFDs, &sleepTime);
+    if (selectRes < 0)
+    {
+        printf("select failed: %s\n", ErrorStr(MapErrorPOSIX(errno)));
+        return;
+    }
+
+    aLayer.HandleSelectResult(selectRes, &readFDs, &writeFDs, &exceptFDs);
+}
+
+chip::System::Stats::count_t TimersInUse()
+{
+    chip::System::Stats::count_t lInUse, lHighWatermark;
+
+    Timer::GetStatistics(lInUse, lHighWatermark);
+    return lInUse;
+}
+
+Layer sLayer;
+
+struct OrderedTimer
+{
+    uint32_t mDelay;
+    bool mFired;
+};
+
+uint32_t sLastFiredDelay;
+bool sFiredInOrder;
+
+void HandleOrderedTimer(Layer * aLayer, void * aState, Error aError)
+{
+    OrderedTimer & lTimer = *static_cast<OrderedTimer *>(aState);
+
+    sFiredInOrder   = sFiredInOrder && sLastFiredDelay <= lTimer.mDelay;
+    sLastFiredDelay = lTimer.mDelay;
+    lTimer.mFired   = true;
+}
+
+void CheckOrderAndCancel(nlTestSuite * inSuite, void * aContext)
+{
+    // Enough timers for the heap to be several levels deep, armed in an order unrelated to their delays.
+    OrderedTimer lTimers[16];
+    const size_t kNumTimers = sizeof(lTimers) / sizeof(lTimers[0]);
+
+    sLastFiredDelay = 0;
+    sFiredInOrder   = true;
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        lTimers[i].mDelay = static_cast<uint32_t>(((i * 7) % kNumTimers) * 3 + 1);
+        lTimers[i].mFired = false;
+        NL_TEST_ASSERT(inSuite, sLayer.StartTimer(lTimers[i].mDelay, HandleOrderedTimer, &lTimers[i]) == CHIP_SYSTEM_NO_ERROR);
+    }
+
+    // Cancelling every third timer removes entries from all over the heap.
+    for (size_t i = 0; i < kNumTimers; i += 3)
+    {
+        sLayer.CancelTimer(HandleOrderedTimer, &lTimers[i]);
+    }
+
+    const uint64_t kDeadline = Layer::GetClock_MonotonicMS() + 1000;
+    while (TimersInUse() > 0 && Layer::GetClock_MonotonicMS() < kDeadline)
+    {
+        ServiceEvents(sLayer);
+    }
+
+    NL_TEST_ASSERT(inSuite, sFiredInOrder);
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        NL_TEST_ASSERT(inSuite, lTimers[i].mFired == (i % 3 != 0));
+    }
+}
+
+void HandleCountedWork(Layer * aLayer, void * aState, Error aError)
+{
+    ++*static_cast<std::atomic<uint32_t> *>(aState);
+}
+
+void CheckCancelScheduledWork(nlTestSuite * inSuite, void * aContext)
+{
+    std::atomic<uint32_t> lCancelled(0);
+    std::atomic<uint32_t> lKept(0);
+
+    // Scheduled work is not in the timer queue; CancelTimer() must still find it.
+    NL_TEST_ASSERT(inSuite, sLayer.ScheduleWork(HandleCountedWork, &lCancelled) == CHIP_SYSTEM_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sLayer.ScheduleWork(HandleCountedWork, &lKept) == CHIP_SYSTEM_NO_ERROR);
+    sLayer.CancelTimer(HandleCountedWork, &lCancelled);
+
+    const uint64_t kDeadline = Layer::GetClock_MonotonicMS() + 1000;
+    while (TimersInUse() > 0 && Layer::GetClock_MonotonicMS() < kDeadline)
+    {
+        ServiceEvents(sLayer);
+    }
+
+    NL_TEST_ASSERT(inSuite, lCancelled == 0);
+    NL_TEST_ASSERT(inSuite, lKept == 1);
+}
+
+constexpr size_t kNumWorkThreads       = 4;
+constexpr uint32_t kWorkItemsPerThread = 500;
+constexpr uint32_t kTotalWorkItems     = kNumWorkThreads * kWorkItemsPerThread;
+std::atomic<uint32_t> sWorkDone;
+std::atomic<uint32_t> sWorkScheduleErrors;
+
+void * ScheduleWorkThreadMain(void * aContext)
+{
+    for (uint32_t i = 0; i < kWorkItemsPerThread; i++)
+    {
+        Error lError;
+
+        // The timer pool is shared with the event loop; wait for it to drain when it is full.
+        while ((lError = sLayer.ScheduleWork(HandleCountedWork, &sWorkDone)) == CHIP_SYSTEM_ERROR_NO_MEMORY)
+        {
+            usleep(100);
+        }
+
+        if (lError != CHIP_SYSTEM_NO_ERROR)
+        {
+            sWorkScheduleErrors++;
+        }
+    }
+
+    return nullptr;
+}
+
+void HandleChurnTimer(Layer * aLayer, void * aState, Error aError)
+{
+    // Keep the timer queue changing while the other threads schedule work.
+    aLayer->StartTimer(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(aState) % 3), HandleChurnTimer, aState);
+}
+
+void CheckScheduleWorkFromThreads(nlTestSuite * inSuite, void * aContext)
+{
+    pthread_t lThreads[kNumWorkThreads];
+    const size_t kNumChurnTimers = 4;
+
+    sWorkDone           = 0;
+    sWorkScheduleErrors = 0;
+
+    for (size_t i = 0; i < kNumChurnTimers; i++)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       sLayer.StartTimer(static_cast<uint32_t>(i), HandleChurnTimer, reinterpret_cast<void *>(i + 1)) ==
+                           CHIP_SYSTEM_NO_ERROR);
+    }
+
+    for (pthread_t & thread : lThreads)
+    {
+        NL_TEST_ASSERT(inSuite, pthread_create(&thread, nullptr, ScheduleWorkThreadMain, nullptr) == 0);
+    }
+
+    const uint64_t kDeadline = Layer::GetClock_MonotonicMS() + 10000;
+    while (sWorkDone + sWorkScheduleErrors < kTotalWorkItems && Layer::GetClock_MonotonicMS() < kDeadline)
+    {
+        ServiceEvents(sLayer);
+    }
+
+    for (pthread_t thread : lThreads)
+    {
+        NL_TEST_ASSERT(inSuite, pthread_join(thread, nullptr) == 0);
+    }
+
+    for (size_t i = 0; i < kNumChurnTimers; i++)
+    {
+        sLayer.CancelTimer(HandleChurnTimer, reinterpret_cast<void *>(i + 1));
+    }
+
+    NL_TEST_ASSERT(inSuite, sWorkScheduleErrors == 0);
+    NL_TEST_ASSERT(inSuite, sWorkDone == kTotalWorkItems);
+    NL_TEST_ASSERT(inSuite, TimersInUse() == 0);
+}
+
+} // namespace
+
+// Test Suite
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("TimerHeap::TestOrderAndCancel",            CheckOrderAndCancel),
+    NL_TEST_DEF("TimerHeap::TestCancelScheduledWork",       CheckCancelScheduledWork),
+    NL_TEST_DEF("TimerHeap::TestScheduleWorkFromThreads",   CheckScheduleWorkFromThreads),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+/**
+ *  Set up the test suite.
+ */
+static int TestSetup(void * aContext)
+{
+    return (sLayer.Init(nullptr) == CHIP_SYSTEM_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+/**
+ *  Tear down the test suite.
+ */
+static int TestTeardown(void * aContext)
+{
+    sLayer.Shutdown();
+
+    return (SUCCESS);
+}
+
+int TestSystemTimerHeap(void)
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-system-timer-heap",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemTimerHeap)
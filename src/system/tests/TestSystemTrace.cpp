@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for <tt>chip::System::Trace</tt>
+ *
+ */
+
+#include <system/SystemTrace.h>
+
+#include <nlunit-test.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <string>
+
+using namespace chip::System;
+
+namespace {
+
+void TestHistogram(nlTestSuite * inSuite, void * aContext)
+{
+    Trace::Reset();
+
+    // 90 spans of 10 us, 9 of 100 us and one of 5000 us
+    for (int i = 0; i < 90; i++)
+    {
+        Trace::RecordSpan(Trace::kStage_ExchangeReceive, 1000, 1010);
+    }
+    for (int i = 0; i < 9; i++)
+    {
+        Trace::RecordSpan(Trace::kStage_ExchangeReceive, 1000, 1100);
+    }
+    Trace::RecordSpan(Trace::kStage_ExchangeReceive, 1000, 6000);
+
+    const Trace::Histogram & histogram = Trace::GetHistogram(Trace::kStage_ExchangeReceive);
+    NL_TEST_ASSERT(inSuite, histogram.mCount == 100);
+    NL_TEST_ASSERT(inSuite, histogram.mTotalUs == 90 * 10 + 9 * 100 + 5000);
+    NL_TEST_ASSERT(inSuite, histogram.mMaxUs == 5000);
+
+    // The percentiles are the upper bounds of their buckets
+    NL_TEST_ASSERT(inSuite, Trace::GetPercentileUs(Trace::kStage_ExchangeReceive, 50) == 15);
+    NL_TEST_ASSERT(inSuite, Trace::GetPercentileUs(Trace::kStage_ExchangeReceive, 90) == 15);
+    NL_TEST_ASSERT(inSuite, Trace::GetPercentileUs(Trace::kStage_ExchangeReceive, 99) == 127);
+    NL_TEST_ASSERT(inSuite, Trace::GetPercentileUs(Trace::kStage_ExchangeReceive, 100) == 5000);
+
+    NL_TEST_ASSERT(inSuite, Trace::GetHistogram(Trace::kStage_ClusterCommand).mCount == 0);
+    NL_TEST_ASSERT(inSuite, Trace::GetPercentileUs(Trace::kStage_ClusterCommand, 99) == 0);
+}
+
+void TestScopedSpan(nlTestSuite * inSuite, void * aContext)
+{
+    Trace::Reset();
+
+    {
+        Trace::ScopedSpan outer(Trace::kStage_InteractionModelReceive);
+        Trace::ScopedSpan inner(Trace::kStage_ClusterCommand);
+    }
+
+    NL_TEST_ASSERT(inSuite, Trace::GetHistogram(Trace::kStage_InteractionModelReceive).mCount == 1);
+    NL_TEST_ASSERT(inSuite, Trace::GetHistogram(Trace::kStage_ClusterCommand).mCount == 1);
+    NL_TEST_ASSERT(inSuite,
+                   Trace::GetHistogram(Trace::kStage_ClusterCommand).mMaxUs <=
+                       Trace::GetHistogram(Trace::kStage_InteractionModelReceive).mMaxUs);
+}
+
+void TestGetSpan(nlTestSuite * inSuite, void * aContext)
+{
+    Trace::Span span;
+
+    Trace::Reset();
+    NL_TEST_ASSERT(inSuite, Trace::GetSpanCount() == 0);
+    NL_TEST_ASSERT(inSuite, !Trace::GetSpan(0, span));
+
+    for (uint64_t i = 0; i < CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT + 2; i++)
+    {
+        Trace::RecordSpan(Trace::kStage_ExchangeReceive, i * 100, i * 100 + i);
+    }
+    NL_TEST_ASSERT(inSuite, Trace::GetSpanCount() == CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT + 2);
+
+    // The oldest spans were overwritten, and the next one is not recorded yet
+    NL_TEST_ASSERT(inSuite, !Trace::GetSpan(1, span));
+    NL_TEST_ASSERT(inSuite, Trace::GetSpan(2, span));
+    NL_TEST_ASSERT(inSuite, span.mStartUs == 200 && span.mDurationUs == 2 && span.mStage == Trace::kStage_ExchangeReceive);
+    NL_TEST_ASSERT(inSuite, Trace::GetSpan(CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT + 1, span));
+    NL_TEST_ASSERT(inSuite, span.mDurationUs == CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT + 1);
+    NL_TEST_ASSERT(inSuite, !Trace::GetSpan(CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT + 2, span));
+}
+
+void AppendTrace(void * context, const char * text)
+{
+    static_cast<std::string *>(context)->append(text);
+}
+
+void TestExportChromeTrace(nlTestSuite * inSuite, void * aContext)
+{
+    std::string trace;
+
+    Trace::Reset();
+    Trace::ExportChromeTrace(AppendTrace, &trace);
+    NL_TEST_ASSERT(inSuite, trace == "{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}");
+
+    // Only the most recent spans are kept
+    for (uint64_t i = 0; i < CHIP_SYSTEM_CONFIG_TRACE_SPAN_COUNT + 1; i++)
+    {
+        Trace::RecordSpan(Trace::kStage_SecureSessionReceive, i * 100, i * 100 + 42);
+    }
+    trace.clear();
+    Trace::ExportChromeTrace(AppendTrace, &trace);
+    NL_TEST_ASSERT(inSuite, trace.find("\"ts\":0,") == std::string::npos);
+    NL_TEST_ASSERT(inSuite,
+                   trace.find("{\"traceEvents\":[{\"name\":\"SecureSessionReceive\",\"cat\":\"chip\",\"ph\":\"X\",\"ts\":100,"
+                              "\"dur\":42,\"pid\":1,\"tid\":1},") == 0);
+    NL_TEST_ASSERT(inSuite, trace.rfind("}],\"displayTimeUnit\":\"ms\"}") == trace.size() - 26);
+}
+
+} // namespace
+
+// Test Suite
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("Trace::TestHistogram",            TestHistogram),
+    NL_TEST_DEF("Trace::TestScopedSpan",           TestScopedSpan),
+    NL_TEST_DEF("Trace::TestGetSpan",              TestGetSpan),
+    NL_TEST_DEF("Trace::TestExportChromeTrace",    TestExportChromeTrace),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+static nlTestSuite kTheSuite =
+{
+    "chip-system-trace",
+    sTests
+};
+// clang-format on
+
+int TestSystemTrace(void)
+{
+    // Run test suit againt one context.
+    nlTestRunner(&kTheSuite, nullptr);
+
+    return nlTestRunnerStats(&kTheSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemTrace)
@@ -105,6 +105,7 @@ AdminPairingInfo * AdminPairingTable::AssignAdminId(AdminId adminId)
         if (!mStates[i].IsInitialized())
         {
             mStates[i].SetAdminId(adminId);
+            AddToIndex(i);
 
             return &mStates[i];
         }
@@ -130,54 +131,68 @@ void AdminPairingTable::ReleaseAdminId(AdminId adminId)
     AdminPairingInfo * admin = FindAdminWithId(adminId);
     if (admin != nullptr)
     {
+        RemoveFromIndex(SlotOf(admin));
         admin->Reset();
     }
 }
 
 AdminPairingInfo * AdminPairingTable::FindAdminWithId(AdminId adminId)
 {
-    for (auto & state : mStates)
-    {
-        if (state.IsInitialized() && state.GetAdminId() == adminId)
-        {
-            return &state;
-        }
-    }
+    size_t slot = mAdminIdIndex.FindFirst(adminId, 0, [this, adminId](size_t i) {
+        return mStates[i].IsInitialized() && mStates[i].GetAdminId() == adminId;
+    });
 
-    return nullptr;
+    return (slot < CHIP_CONFIG_MAX_DEVICE_ADMINS) ? &mStates[slot] : nullptr;
 }
 
 AdminPairingInfo * AdminPairingTable::FindAdminForNode(FabricId fabricId, NodeId nodeId, uint16_t vendorId)
 {
-    uint32_t index = 0;
-    for (auto & state : mStates)
-    {
-        if (state.IsInitialized())
-        {
-            ChipLogProgress(Discovery,
-                            "Looking at index %d with fabricID %llu nodeID %llu vendorId %d to see if it matches fabricId %llu "
-                            "nodeId %llu vendorId %d.",
-                            index, state.GetFabricId(), state.GetNodeId(), state.GetVendorId(), fabricId, nodeId, vendorId);
-        }
-        if (state.IsInitialized() && state.GetFabricId() == fabricId &&
+    size_t slot = mFabricIdIndex.FindFirst(fabricId, 0, [this, fabricId, nodeId, vendorId](size_t i) {
+        const AdminPairingInfo & state = mStates[i];
+        return state.IsInitialized() && state.GetFabricId() == fabricId &&
             (nodeId == kUndefinedNodeId || state.GetNodeId() == nodeId) &&
-            (vendorId == kUndefinedVendorId || state.GetVendorId() == vendorId))
-        {
-            ChipLogProgress(Discovery, "Found a match!");
-            return &state;
-        }
-        index++;
+            (vendorId == kUndefinedVendorId || state.GetVendorId() == vendorId);
+    });
+
+    if (slot < CHIP_CONFIG_MAX_DEVICE_ADMINS)
+    {
+        ChipLogProgress(Discovery, "Found admin at index %d matching fabricId %llu nodeId %llu vendorId %d.",
+                        static_cast<int>(slot), fabricId, nodeId, vendorId);
+        return &mStates[slot];
     }
 
     return nullptr;
 }
 
+void AdminPairingTable::SetFabricId(AdminPairingInfo * admin, FabricId fabricId)
+{
+    const size_t slot = SlotOf(admin);
+
+    mFabricIdIndex.Remove(slot, admin->GetFabricId());
+    admin->SetFabricId(fabricId);
+    mFabricIdIndex.Insert(slot, fabricId);
+}
+
 void AdminPairingTable::Reset()
 {
     for (size_t i = 0; i < CHIP_CONFIG_MAX_DEVICE_ADMINS; i++)
     {
         mStates[i].Reset();
     }
+    mAdminIdIndex.Clear();
+    mFabricIdIndex.Clear();
+}
+
+void AdminPairingTable::AddToIndex(size_t slot)
+{
+    mAdminIdIndex.Insert(slot, mStates[slot].GetAdminId());
+    mFabricIdIndex.Insert(slot, mStates[slot].GetFabricId());
+}
+
+void AdminPairingTable::RemoveFromIndex(size_t slot)
+{
+    mAdminIdIndex.Remove(slot, mStates[slot].GetAdminId());
+    mFabricIdIndex.Remove(slot, mStates[slot].GetFabricId());
 }
 
 CHIP_ERROR AdminPairingTable::Store(AdminId id)
@@ -214,7 +229,11 @@ CHIP_ERROR AdminPairingTable::LoadFromStorage(AdminId id)
         didCreateAdmin = true;
     }
     VerifyOrExit(admin != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The stored admin may come with another fabric ID.
+    RemoveFromIndex(SlotOf(admin));
     err = admin->FetchFromKVS(mStorage);
+    AddToIndex(SlotOf(admin));
 
 exit:
     if (err != CHIP_NO_ERROR && didCreateAdmin)
@@ -24,6 +24,7 @@
 #include <app/util/basic-types.h>
 #include <core/CHIPPersistentStorageDelegate.h>
 #include <support/DLLUtil.h>
+#include <transport/PeerConnectionIndex.h>
 #include <transport/raw/MessageHeader.h>
 
 namespace chip {
@@ -36,6 +37,7 @@ static constexpr AdminId kUndefinedAdminId = UINT16_MAX;
 // platform. Keeping them short.
 constexpr char kAdminTableKeyPrefix[] = "CHIPAdmin";
 constexpr char kAdminTableCountKey[]  = "CHIPAdminNextId";
+constexpr char kAdminTableIndexKey[]  = "CHIPAdminIdx";
 
 struct OperationalCredentials
 {
@@ -217,6 +219,13 @@ private:
     }
 };
 
+/**
+ * The admins that have provisioned the device, in a fixed table.
+ *
+ * When CHIP_CONFIG_ADMIN_PAIRING_TABLE_INDEX is set, lookups by admin ID and by fabric ID go through hash indexes kept in
+ * step with the table instead of scanning every entry. The fabric ID of an admin in the table must then only be changed
+ * via SetFabricId().
+ */
 class DLL_EXPORT AdminPairingTable
 {
 public:
@@ -235,6 +244,13 @@ public:
     AdminPairingInfo * FindAdminForNode(FabricId fabricId, NodeId nodeId = kUndefinedNodeId,
                                         uint16_t vendorId = kUndefinedVendorId);
 
+    /**
+     * Sets the fabric ID of an admin of the table.
+     *
+     * Use this rather than AdminPairingInfo::SetFabricId so that fabric ID lookups stay consistent with the admin.
+     */
+    void SetFabricId(AdminPairingInfo * admin, FabricId fabricId);
+
     void Reset();
 
     CHIP_ERROR Init(PersistentStorageDelegate * storage);
@@ -249,9 +265,18 @@ public:
     ConstAdminIterator end() const { return cend(); }
 
 private:
+    static constexpr bool kIndexed = (CHIP_CONFIG_ADMIN_PAIRING_TABLE_INDEX != 0);
+
+    void AddToIndex(size_t slot);
+    void RemoveFromIndex(size_t slot);
+    size_t SlotOf(const AdminPairingInfo * admin) const { return static_cast<size_t>(admin - &mStates[0]); }
+
     AdminPairingInfo mStates[CHIP_CONFIG_MAX_DEVICE_ADMINS];
     PersistentStorageDelegate * mStorage = nullptr;
 
+    PeerConnectionIndex<CHIP_CONFIG_MAX_DEVICE_ADMINS, AdminId, kIndexed> mAdminIdIndex;
+    PeerConnectionIndex<CHIP_CONFIG_MAX_DEVICE_ADMINS, FabricId, kIndexed> mFabricIdIndex;
+
     // TODO: Admin Pairing table should be backed by a single backing store (attribute store), remove delegate callbacks #6419
     AdminPairingTableDelegate * mDelegate = nullptr;
 };
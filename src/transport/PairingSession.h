@@ -26,6 +26,7 @@
 #pragma once
 
 #include <core/CHIPError.h>
+#include <support/CodeUtils.h>
 #include <transport/SecureSession.h>
 
 namespace chip {
@@ -49,6 +50,29 @@ public:
      */
     virtual CHIP_ERROR DeriveSecureSession(const uint8_t * info, size_t info_len, SecureSession & session) = 0;
 
+    /**
+     * @brief
+     *   Derive two secure sessions from the paired session, such as its two directions.
+     *   The API will return error if called before pairing is established.
+     *
+     *   The default implementation calls DeriveSecureSession() for each session. Pairings
+     *   can override it to share the work of the two key derivations.
+     *
+     * @param info1       Information string used for the key derivation of session1
+     * @param info1_len   Length of info1 string
+     * @param session1    Reference to the first secure session to initialize
+     * @param info2       Information string used for the key derivation of session2
+     * @param info2_len   Length of info2 string
+     * @param session2    Reference to the second secure session to initialize
+     * @return CHIP_ERROR The result of session derivation
+     */
+    virtual CHIP_ERROR DeriveSecureSessions(const uint8_t * info1, size_t info1_len, SecureSession & session1,
+                                            const uint8_t * info2, size_t info2_len, SecureSession & session2)
+    {
+        ReturnErrorOnFailure(DeriveSecureSession(info1, info1_len, session1));
+        return DeriveSecureSession(info2, info2_len, session2);
+    }
+
     /**
      * @brief
      *  Return the associated peer key id
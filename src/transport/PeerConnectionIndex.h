@@ -0,0 +1,201 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   Defines a fixed-size lookup index over the slots of a PeerConnections pool.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+namespace detail {
+
+constexpr size_t PeerConnectionIndexCapacity(size_t minimum, size_t capacity = 1)
+{
+    return (capacity >= minimum) ? capacity : PeerConnectionIndexCapacity(minimum, capacity * 2);
+}
+
+inline uint32_t PeerConnectionIndexHash(uint64_t key)
+{
+    // 64-bit finalizer from MurmurHash3; spreads sequentially allocated key and node ids.
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<uint32_t>(key);
+}
+
+} // namespace detail
+
+/**
+ * Maps a key (e.g. local key ID or peer node ID) to the pool slots that currently hold it.
+ *
+ * The index is an open-addressing hash table with linear probing and backward-shift
+ * deletion, sized at twice the pool size so probe sequences stay short. It lives entirely
+ * inside the owning object and never allocates.
+ *
+ * Several slots may share a key. FindFirst() returns the lowest-numbered matching slot
+ * at or after a starting slot, so callers keep exactly the iteration order of a linear
+ * scan over the pool.
+ *
+ * When kEnabled is false the index holds no storage and FindFirst() falls back to a
+ * linear scan, letting resource-constrained builds keep the original footprint.
+ */
+template <size_t kSlotCount, typename KeyType, bool kEnabled = true>
+class PeerConnectionIndex
+{
+public:
+    static constexpr size_t kNotFound = kSlotCount;
+
+    PeerConnectionIndex() { Clear(); }
+
+    void Clear()
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mEntries[i].slot = kEmptySlot;
+        }
+    }
+
+    /// Records that the given pool slot now holds the given key.
+    void Insert(size_t slot, KeyType key)
+    {
+        size_t pos = HomeOf(key);
+
+        while (mEntries[pos].slot != kEmptySlot)
+        {
+            pos = Next(pos);
+        }
+
+        mEntries[pos].key  = key;
+        mEntries[pos].slot = static_cast<SlotType>(slot);
+    }
+
+    /// Drops the association between a pool slot and a key. No-op if it was not recorded.
+    void Remove(size_t slot, KeyType key)
+    {
+        size_t pos = HomeOf(key);
+
+        while (mEntries[pos].slot != kEmptySlot)
+        {
+            if (mEntries[pos].slot == slot && mEntries[pos].key == key)
+            {
+                RemoveAt(pos);
+                return;
+            }
+            pos = Next(pos);
+        }
+    }
+
+    /**
+     * Finds the lowest slot >= startSlot holding key for which match(slot) returns true.
+     *
+     * @return the slot found, kNotFound otherwise
+     */
+    template <typename Matcher>
+    size_t FindFirst(KeyType key, size_t startSlot, Matcher match) const
+    {
+        size_t found = kNotFound;
+        size_t pos   = HomeOf(key);
+
+        while (mEntries[pos].slot != kEmptySlot)
+        {
+            const size_t slot = mEntries[pos].slot;
+            if (slot >= startSlot && slot < found && mEntries[pos].key == key && match(slot))
+            {
+                found = slot;
+            }
+            pos = Next(pos);
+        }
+
+        return found;
+    }
+
+private:
+    using SlotType = uint16_t;
+    static_assert(kSlotCount < UINT16_MAX, "PeerConnectionIndex slot type too small for the pool size");
+
+    static constexpr SlotType kEmptySlot = UINT16_MAX;
+    static constexpr size_t kCapacity    = detail::PeerConnectionIndexCapacity(kSlotCount * 2);
+
+    struct Entry
+    {
+        KeyType key;
+        SlotType slot;
+    };
+
+    static size_t HomeOf(KeyType key) { return detail::PeerConnectionIndexHash(static_cast<uint64_t>(key)) & (kCapacity - 1); }
+    static size_t Next(size_t pos) { return (pos + 1) & (kCapacity - 1); }
+
+    void RemoveAt(size_t hole)
+    {
+        // Backward-shift deletion: pull later members of the probe run into the hole so that
+        // lookups never need tombstones.
+        size_t pos = Next(hole);
+
+        while (mEntries[pos].slot != kEmptySlot)
+        {
+            const size_t home = HomeOf(mEntries[pos].key);
+            // Entry at pos may move to hole only if its home does not lie cyclically in (hole, pos].
+            const bool inRange = (hole <= pos) ? (hole < home && home <= pos) : (hole < home || home <= pos);
+            if (!inRange)
+            {
+                mEntries[hole] = mEntries[pos];
+                hole           = pos;
+            }
+            pos = Next(pos);
+        }
+
+        mEntries[hole].slot = kEmptySlot;
+    }
+
+    Entry mEntries[kCapacity];
+};
+
+template <size_t kSlotCount, typename KeyType>
+class PeerConnectionIndex<kSlotCount, KeyType, false>
+{
+public:
+    static constexpr size_t kNotFound = kSlotCount;
+
+    void Clear() {}
+    void Insert(size_t slot, KeyType key) {}
+    void Remove(size_t slot, KeyType key) {}
+
+    template <typename Matcher>
+    size_t FindFirst(KeyType key, size_t startSlot, Matcher match) const
+    {
+        for (size_t slot = startSlot; slot < kSlotCount; slot++)
+        {
+            if (match(slot))
+            {
+                return slot;
+            }
+        }
+        return kNotFound;
+    }
+};
+
+} // namespace Transport
+} // namespace chip
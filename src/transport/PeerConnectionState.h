@@ -21,7 +21,12 @@
 
 #pragma once
 
+#include <core/CHIPConfig.h>
+#include <support/CodeUtils.h>
+#include <system/SystemPacketBuffer.h>
 #include <transport/AdminPairingTable.h>
+#include <transport/PeerMessageCounter.h>
+#include <transport/RoundTripTimeEstimator.h>
 #include <transport/SecureSession.h>
 #include <transport/raw/Base.h>
 #include <transport/raw/MessageHeader.h>
@@ -30,8 +35,6 @@
 namespace chip {
 namespace Transport {
 
-static constexpr uint32_t kUndefinedMessageIndex = UINT32_MAX;
-
 /**
  * Defines state of a peer connection at a transport layer.
  *
@@ -39,18 +42,27 @@ static constexpr uint32_t kUndefinedMessageIndex = UINT32_MAX;
  *   - PeerAddress represents how to talk to the peer
  *   - PeerNodeId is the unique ID of the peer
  *   - SendMessageIndex is an ever increasing index for sending messages
+ *   - PeerMessageCounter is the replay window of the message indexes received
  *   - LastActivityTimeMs is a monotonic timestamp of when this connection was
  *     last used. Inactive connections can expire.
  *   - SecureSession contains the encryption context of a connection
+ *   - RoundTripTimeEstimator tracks the measured round-trip time to the peer
+ *   - PathMtu is the largest IPv6 packet known to reach the peer unfragmented,
+ *     which bounds the size of the messages sent to it
  *
  * TODO: to add any message ACK information
  */
+static_assert(CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE >= 1280, "The path MTU of IPv6 is at least 1280 bytes");
+
 class PeerConnectionState
 {
 public:
+    /// The guaranteed minimum IPv6 MTU, which kMaxAppMessageLen is sized for.
+    static constexpr uint16_t kMinPathMtu = 1280;
+
     PeerConnectionState() : mMsgCounterSynStatus(MsgCounterSyncStatus::NotSync), mPeerAddress(PeerAddress::Uninitialized()) {}
-    PeerConnectionState(const PeerAddress & addr) : mPeerAddress(addr) {}
-    PeerConnectionState(PeerAddress && addr) : mPeerAddress(addr) {}
+    PeerConnectionState(const PeerAddress & addr) : mPeerAddress(addr), mPathMtu(GetInitialPathMtu(addr)) {}
+    PeerConnectionState(PeerAddress && addr) : mPeerAddress(addr), mPathMtu(GetInitialPathMtu(mPeerAddress)) {}
 
     PeerConnectionState(PeerConnectionState &&)      = default;
     PeerConnectionState(const PeerConnectionState &) = default;
@@ -59,13 +71,21 @@ public:
 
     const PeerAddress & GetPeerAddress() const { return mPeerAddress; }
     PeerAddress & GetPeerAddress() { return mPeerAddress; }
-    void SetPeerAddress(const PeerAddress & address) { mPeerAddress = address; }
+    void SetPeerAddress(const PeerAddress & address)
+    {
+        // A new address may be reached through another path, whose MTU is relearned.
+        mPeerAddress = address;
+        mPathMtu     = GetInitialPathMtu(address);
+    }
 
     void SetTransport(Transport::Base * transport) { mTransport = transport; }
     Transport::Base * GetTransport() { return mTransport; }
 
-    bool IsPeerMsgCounterSynced() { return (mPeerMessageIndex != kUndefinedMessageIndex); }
-    void SetPeerMessageIndex(uint32_t id) { mPeerMessageIndex = id; }
+    bool IsPeerMsgCounterSynced() { return mPeerMessageCounter.IsSynchronized(); }
+    void SetPeerMessageIndex(uint32_t id) { mPeerMessageCounter.SetCounter(id); }
+
+    PeerMessageCounter & GetPeerMessageCounter() { return mPeerMessageCounter; }
+    const PeerMessageCounter & GetPeerMessageCounter() const { return mPeerMessageCounter; }
 
     NodeId GetPeerNodeId() const { return mPeerNodeId; }
     void SetPeerNodeId(NodeId peerNodeId) { mPeerNodeId = peerNodeId; }
@@ -82,12 +102,46 @@ public:
     uint64_t GetLastActivityTimeMs() const { return mLastActivityTimeMs; }
     void SetLastActivityTimeMs(uint64_t value) { mLastActivityTimeMs = value; }
 
+    RoundTripTimeEstimator & GetRoundTripTimeEstimator() { return mRoundTripTimeEstimator; }
+    const RoundTripTimeEstimator & GetRoundTripTimeEstimator() const { return mRoundTripTimeEstimator; }
+
+    /// The path MTU to the peer, or 0 if its transport is a stream that is not bound by one.
+    uint16_t GetPathMtu() const { return mPathMtu; }
+
+    /**
+     * Lower the path MTU to the peer, e.g. to the MTU of an ICMPv6 Packet Too Big message. The path MTU is never lowered
+     * below kMinPathMtu, which every IPv6 link carries.
+     */
+    void ReducePathMtu(uint16_t mtu)
+    {
+        if (mPathMtu != 0)
+        {
+            mPathMtu = chip::min(mPathMtu, (mtu < kMinPathMtu) ? static_cast<uint16_t>(kMinPathMtu) : mtu);
+        }
+    }
+
+    /**
+     * The largest application payload of a message to the peer: kMaxAppMessageLen, plus every byte the path MTU carries
+     * above kMinPathMtu, up to what fits in a single packet buffer with the message tag.
+     */
+    uint16_t GetMaxAppMessageLength() const
+    {
+        const size_t bufferLength = chip::max(kMaxAppMessageLen, static_cast<size_t>(System::PacketBuffer::kMaxSize - kMaxTagLen));
+        const size_t pathLength   = (mPathMtu == 0) ? bufferLength : kMaxAppMessageLen + mPathMtu - kMinPathMtu;
+        return static_cast<uint16_t>(chip::min(pathLength, bufferLength));
+    }
+
     SecureSession & GetSenderSecureSession() { return mSenderSecureSession; }
     SecureSession & GetReceiverSecureSession() { return mReceiverSecureSession; }
 
     Transport::AdminId GetAdminId() const { return mAdmin; }
     void SetAdminId(Transport::AdminId admin) { mAdmin = admin; }
 
+    /// A group session is keyed by a group key, shared by every member of the group, and its peer address is the
+    /// multicast address of the group.
+    bool IsGroupSession() const { return mIsGroupSession; }
+    void SetGroupSession(bool value) { mIsGroupSession = value; }
+
     void SetMsgCounterSyncInProgress(bool value)
     {
         mMsgCounterSynStatus = value ? MsgCounterSyncStatus::SyncInProcess : MsgCounterSyncStatus::Synced;
@@ -112,22 +166,29 @@ public:
         mLastActivityTimeMs = 0;
         mSenderSecureSession.Reset();
         mReceiverSecureSession.Reset();
+        mRoundTripTimeEstimator.Reset();
+        mPeerMessageCounter.Reset();
         mMsgCounterSynStatus = MsgCounterSyncStatus::NotSync;
+        mPathMtu             = CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE;
     }
 
-    CHIP_ERROR EncryptBeforeSend(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
-                                 MessageAuthenticationCode & mac) const
+    CHIP_ERROR EncryptBeforeSend(uint8_t * data, size_t data_length, size_t tag_space, PacketHeader & header,
+                                 uint16_t & tag_length) const
     {
-        return mSenderSecureSession.Encrypt(input, input_length, output, header, mac);
+        return mSenderSecureSession.EncryptInPlace(data, data_length, tag_space, header, tag_length);
     }
 
-    CHIP_ERROR DecryptOnReceive(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
-                                const MessageAuthenticationCode & mac) const
+    CHIP_ERROR DecryptOnReceive(uint8_t * data, size_t data_length, const PacketHeader & header) const
     {
-        return mReceiverSecureSession.Decrypt(input, input_length, output, header, mac);
+        return mReceiverSecureSession.DecryptInPlace(data, data_length, header);
     }
 
 private:
+    static uint16_t GetInitialPathMtu(const PeerAddress & address)
+    {
+        return (address.GetTransportType() == Type::kTcp) ? 0 : CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE;
+    }
+
     enum class MsgCounterSyncStatus
     {
         NotSync,
@@ -138,14 +199,17 @@ private:
     PeerAddress mPeerAddress;
     NodeId mPeerNodeId           = kUndefinedNodeId;
     uint32_t mSendMessageIndex   = 0;
-    uint32_t mPeerMessageIndex   = kUndefinedMessageIndex;
     uint16_t mPeerKeyID          = UINT16_MAX;
     uint16_t mLocalKeyID         = UINT16_MAX;
     uint64_t mLastActivityTimeMs = 0;
+    uint16_t mPathMtu            = CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE;
     Transport::Base * mTransport = nullptr;
+    RoundTripTimeEstimator mRoundTripTimeEstimator;
+    PeerMessageCounter mPeerMessageCounter;
     SecureSession mSenderSecureSession;
     SecureSession mReceiverSecureSession;
     Transport::AdminId mAdmin = kUndefinedAdminId;
+    bool mIsGroupSession      = false;
 };
 
 } // namespace Transport
@@ -18,8 +18,10 @@
 
 #include <core/CHIPError.h>
 #include <support/CodeUtils.h>
+#include <system/SystemStats.h>
 #include <system/TimeSource.h>
 #include <transport/AdminPairingTable.h>
+#include <transport/PeerConnectionIndex.h>
 #include <transport/PeerConnectionState.h>
 
 namespace chip {
@@ -36,11 +38,25 @@ constexpr const uint16_t kAnyKeyId = 0xffff;
  * Intended for:
  *   - handle connection active time and expiration
  *   - allocate and free space for connection states.
+ *
+ * When kIndexed is set, lookups by local key ID and by peer node ID go through hash
+ * indexes kept in step with state creation and expiry instead of scanning every slot.
+ * Peer node IDs of pooled states must then only be changed via SetPeerNodeId().
  */
-template <size_t kMaxConnectionCount, Time::Source kTimeSource = Time::Source::kSystem>
+template <size_t kMaxConnectionCount, Time::Source kTimeSource = Time::Source::kSystem,
+          bool kIndexed = (CHIP_CONFIG_PEER_CONNECTION_INDEX != 0)>
 class PeerConnections
 {
 public:
+    PeerConnections()
+    {
+        for (size_t i = 0; i < kMaxConnectionCount; i++)
+        {
+            mPrevActive[i] = kNoSlot;
+            mNextActive[i] = kNoSlot;
+        }
+    }
+
     /**
      * Allocates a new peer connection state state object out of the internal resource pool.
      *
@@ -66,8 +82,12 @@ public:
         {
             if (!mStates[i].IsInitialized())
             {
+                RemoveFromIndex(i);
                 mStates[i] = PeerConnectionState(address);
                 mStates[i].SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+                AddToIndex(i);
+                MoveToMostRecentlyActive(i);
+                SYSTEM_STATS_INCREMENT(chip::System::Stats::kSecureSessionMgr_NumPeerConnections);
 
                 if (state)
                 {
@@ -79,6 +99,10 @@ public:
             }
         }
 
+        if (err != CHIP_NO_ERROR)
+        {
+            SYSTEM_STATS_COUNT(chip::System::Stats::kSecureSessionMgr_NumPeerConnectionAllocFailures);
+        }
         return err;
     }
 
@@ -110,6 +134,7 @@ public:
         {
             if (!mStates[i].IsInitialized())
             {
+                RemoveFromIndex(i);
                 mStates[i] = PeerConnectionState();
                 mStates[i].SetPeerKeyID(peerKeyId);
                 mStates[i].SetLocalKeyID(localKeyId);
@@ -119,6 +144,9 @@ public:
                 {
                     mStates[i].SetPeerNodeId(peerNode.Value());
                 }
+                AddToIndex(i);
+                MoveToMostRecentlyActive(i);
+                SYSTEM_STATS_INCREMENT(chip::System::Stats::kSecureSessionMgr_NumPeerConnections);
 
                 if (state)
                 {
@@ -130,6 +158,10 @@ public:
             }
         }
 
+        if (err != CHIP_NO_ERROR)
+        {
+            SYSTEM_STATS_COUNT(chip::System::Stats::kSecureSessionMgr_NumPeerConnectionAllocFailures);
+        }
         return err;
     }
 
@@ -175,27 +207,10 @@ public:
     CHECK_RETURN_VALUE
     PeerConnectionState * FindPeerConnectionState(NodeId nodeId, PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetPeerNodeId() == nodeId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        size_t slot = mNodeIdIndex.FindFirst(nodeId, StartSlot(begin), [this, nodeId](size_t i) {
+            return mStates[i].IsInitialized() && mStates[i].GetPeerNodeId() == nodeId;
+        });
+        return StateAt(slot);
     }
 
     /**
@@ -211,31 +226,32 @@ public:
     CHECK_RETURN_VALUE
     PeerConnectionState * FindPeerConnectionState(Optional<NodeId> nodeId, uint16_t peerKeyId, PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
+        const NodeId peerNodeId = nodeId.ValueOr(kUndefinedNodeId);
+        const size_t start      = StartSlot(begin);
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
+        auto match = [this, peerNodeId, peerKeyId](size_t i) {
+            PeerConnectionState & state = mStates[i];
+            if (!state.IsInitialized())
             {
-                continue;
+                return false;
             }
-            if (peerKeyId == kAnyKeyId || iter->GetPeerKeyID() == peerKeyId)
+            if (peerKeyId != kAnyKeyId && state.GetPeerKeyID() != peerKeyId)
             {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
+                return false;
             }
+            return peerNodeId == kUndefinedNodeId || state.GetPeerNodeId() == kUndefinedNodeId ||
+                state.GetPeerNodeId() == peerNodeId;
+        };
+
+        if (!kIndexed || peerNodeId == kUndefinedNodeId)
+        {
+            return StateAt(FindFirstSlot(start, match));
         }
-        return state;
+
+        // A state matches either on the exact node id or because its node id is not known yet.
+        size_t slot              = mNodeIdIndex.FindFirst(peerNodeId, start, match);
+        size_t undefinedNodeSlot = mNodeIdIndex.FindFirst(kUndefinedNodeId, start, match);
+        return StateAt(undefinedNodeSlot < slot ? undefinedNodeSlot : slot);
     }
 
     /**
@@ -249,30 +265,12 @@ public:
     CHECK_RETURN_VALUE
     PeerConnectionState * FindPeerConnectionState(uint16_t keyId, PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
-
-        assert(begin == nullptr || (begin >= iter && begin < &mStates[kMaxConnectionCount]));
+        assert(begin == nullptr || (begin >= &mStates[0] && begin < &mStates[kMaxConnectionCount]));
 
-        if (begin != nullptr)
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-
-            if (iter->GetLocalKeyID() == keyId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        size_t slot = mLocalKeyIdIndex.FindFirst(keyId, StartSlot(begin), [this, keyId](size_t i) {
+            return mStates[i].IsInitialized() && mStates[i].GetLocalKeyID() == keyId;
+        });
+        return StateAt(slot);
     }
 
     /**
@@ -289,50 +287,58 @@ public:
     PeerConnectionState * FindPeerConnectionStateByLocalKey(Optional<NodeId> nodeId, uint16_t localKeyId,
                                                             PeerConnectionState * begin)
     {
-        PeerConnectionState * state = nullptr;
-        PeerConnectionState * iter  = &mStates[0];
+        const NodeId peerNodeId = nodeId.ValueOr(kUndefinedNodeId);
+
+        size_t slot = mLocalKeyIdIndex.FindFirst(localKeyId, StartSlot(begin), [this, peerNodeId, localKeyId](size_t i) {
+            PeerConnectionState & state = mStates[i];
+            return state.IsInitialized() && state.GetLocalKeyID() == localKeyId &&
+                (peerNodeId == kUndefinedNodeId || state.GetPeerNodeId() == kUndefinedNodeId ||
+                 state.GetPeerNodeId() == peerNodeId);
+        });
+        return StateAt(slot);
+    }
 
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
+    /**
+     * Sets the peer node ID of a pooled connection state.
+     *
+     * Use this rather than PeerConnectionState::SetPeerNodeId so that node ID lookups
+     * stay consistent with the state.
+     */
+    void SetPeerNodeId(PeerConnectionState * state, NodeId peerNodeId)
+    {
+        const size_t slot = static_cast<size_t>(state - &mStates[0]);
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetLocalKeyID() == localKeyId)
-            {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
-            }
-        }
-        return state;
+        mNodeIdIndex.Remove(slot, state->GetPeerNodeId());
+        state->SetPeerNodeId(peerNodeId);
+        mNodeIdIndex.Insert(slot, peerNodeId);
     }
 
     /// Convenience method to mark a peer connection state as active
     void MarkConnectionActive(PeerConnectionState * state)
     {
         state->SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+        MoveToMostRecentlyActive(static_cast<size_t>(state - &mStates[0]));
     }
 
     /// Convenience method to expired a peer connection state and fired the related callback
     template <typename Callback>
     void MarkConnectionExpired(PeerConnectionState * state, Callback callback)
     {
+        if (state->IsInitialized())
+        {
+            SYSTEM_STATS_DECREMENT(chip::System::Stats::kSecureSessionMgr_NumPeerConnections);
+        }
         callback(*state);
+        RemoveFromIndex(static_cast<size_t>(state - &mStates[0]));
+        RemoveFromActivityList(static_cast<size_t>(state - &mStates[0]));
         *state = PeerConnectionState(PeerAddress::Uninitialized());
     }
 
     /**
-     * Iterates through all active connections and expires any connection with an idle time
-     * larger than the given amount.
+     * Expires any connection with an idle time larger than the given amount.
+     *
+     * The connections are kept in the order of their last activity, so only those idle for
+     * longer are looked at, not the whole pool.
      *
      * Expiring a connection involves callback execution and then clearing the internal state.
      */
@@ -340,30 +346,147 @@ public:
     void ExpireInactiveConnections(uint64_t maxIdleTimeMs, Callback callback)
     {
         const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+        size_t slot                = mLeastRecentlyActive;
 
-        for (size_t i = 0; i < kMaxConnectionCount; i++)
+        while (slot != kNoSlot && mStates[slot].GetLastActivityTimeMs() + maxIdleTimeMs < currentTime)
         {
-            if (!mStates[i].GetPeerAddress().IsInitialized())
+            if (!CanExpire(mStates[slot]))
             {
-                continue; // not an active connection
+                slot = mNextActive[slot];
+                continue;
             }
 
-            uint64_t connectionActiveTime = mStates[i].GetLastActivityTimeMs();
-            if (connectionActiveTime + maxIdleTimeMs >= currentTime)
+            // The callback may expire other connections: start over from the least recently active one
+            MarkConnectionExpired(&mStates[slot], callback);
+            slot = mLeastRecentlyActive;
+        }
+    }
+
+    /**
+     * Gets the time at which ExpireInactiveConnections() expires the next connection, unless it is active again by then.
+     *
+     * @param maxIdleTimeMs The idle time after which connections expire.
+     * @param expiryTimeMs [out] The time of the next expiry, as given by the time source.
+     *
+     * @returns false if there is no connection to expire.
+     */
+    bool GetNextExpiryTimeMs(uint64_t maxIdleTimeMs, uint64_t & expiryTimeMs) const
+    {
+        for (size_t slot = mLeastRecentlyActive; slot != kNoSlot; slot = mNextActive[slot])
+        {
+            if (CanExpire(mStates[slot]))
             {
-                continue; // not expired
+                expiryTimeMs = mStates[slot].GetLastActivityTimeMs() + maxIdleTimeMs + 1;
+                return true;
             }
-
-            MarkConnectionExpired(&mStates[i], callback);
         }
+        return false;
     }
 
     /// Allows access to the underlying time source used for keeping track of connection active time
     Time::TimeSource<kTimeSource> & GetTimeSource() { return mTimeSource; }
 
 private:
+    size_t StartSlot(const PeerConnectionState * begin) const
+    {
+        if (begin >= &mStates[0] && begin < &mStates[kMaxConnectionCount])
+        {
+            return static_cast<size_t>(begin - &mStates[0]) + 1;
+        }
+        return 0;
+    }
+
+    PeerConnectionState * StateAt(size_t slot) { return (slot < kMaxConnectionCount) ? &mStates[slot] : nullptr; }
+
+    template <typename Matcher>
+    size_t FindFirstSlot(size_t start, Matcher match) const
+    {
+        for (size_t i = start; i < kMaxConnectionCount; i++)
+        {
+            if (match(i))
+            {
+                return i;
+            }
+        }
+        return kMaxConnectionCount;
+    }
+
+    static constexpr size_t kNoSlot = kMaxConnectionCount;
+    static_assert(kMaxConnectionCount < UINT16_MAX, "Activity list slots are 16 bits");
+
+    // Connections without an address are not active yet, and group sessions last as long as the membership in the group.
+    static bool CanExpire(const PeerConnectionState & state)
+    {
+        return state.GetPeerAddress().IsInitialized() && !state.IsGroupSession();
+    }
+
+    bool IsInActivityList(size_t slot) const { return mPrevActive[slot] != kNoSlot || mLeastRecentlyActive == slot; }
+
+    void RemoveFromActivityList(size_t slot)
+    {
+        VerifyOrReturn(IsInActivityList(slot));
+
+        const size_t prev = mPrevActive[slot];
+        const size_t next = mNextActive[slot];
+
+        if (prev != kNoSlot)
+        {
+            mNextActive[prev] = static_cast<uint16_t>(next);
+        }
+        else
+        {
+            mLeastRecentlyActive = next;
+        }
+        if (next != kNoSlot)
+        {
+            mPrevActive[next] = static_cast<uint16_t>(prev);
+        }
+        else
+        {
+            mMostRecentlyActive = prev;
+        }
+        mPrevActive[slot] = kNoSlot;
+        mNextActive[slot] = kNoSlot;
+    }
+
+    // The time source is monotonic: a connection active now is the most recently active one.
+    void MoveToMostRecentlyActive(size_t slot)
+    {
+        RemoveFromActivityList(slot);
+
+        mPrevActive[slot] = static_cast<uint16_t>(mMostRecentlyActive);
+        if (mMostRecentlyActive != kNoSlot)
+        {
+            mNextActive[mMostRecentlyActive] = static_cast<uint16_t>(slot);
+        }
+        else
+        {
+            mLeastRecentlyActive = slot;
+        }
+        mMostRecentlyActive = slot;
+    }
+
+    void AddToIndex(size_t slot)
+    {
+        mLocalKeyIdIndex.Insert(slot, mStates[slot].GetLocalKeyID());
+        mNodeIdIndex.Insert(slot, mStates[slot].GetPeerNodeId());
+    }
+
+    void RemoveFromIndex(size_t slot)
+    {
+        mLocalKeyIdIndex.Remove(slot, mStates[slot].GetLocalKeyID());
+        mNodeIdIndex.Remove(slot, mStates[slot].GetPeerNodeId());
+    }
+
     Time::TimeSource<kTimeSource> mTimeSource;
     PeerConnectionState mStates[kMaxConnectionCount];
+    // The connections in use, from the least to the most recently active, linked by slot.
+    uint16_t mPrevActive[kMaxConnectionCount];
+    uint16_t mNextActive[kMaxConnectionCount];
+    size_t mLeastRecentlyActive = kNoSlot;
+    size_t mMostRecentlyActive  = kNoSlot;
+    PeerConnectionIndex<kMaxConnectionCount, uint16_t, kIndexed> mLocalKeyIdIndex;
+    PeerConnectionIndex<kMaxConnectionCount, NodeId, kIndexed> mNodeIdIndex;
 };
 
 } // namespace Transport
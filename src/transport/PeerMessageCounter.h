@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   Defines the replay window of the message counters received from a peer.
+ */
+
+#pragma once
+
+#include <core/CHIPConfig.h>
+#include <core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Tracks the message counters received from a peer, so that replayed messages are told apart from those delivered out of
+ * order.
+ *
+ * Besides the highest counter received, the window remembers which of the kWindowSize counters up to it were received,
+ * in a bitmap where bit i stands for the highest counter minus i. A counter above the highest one slides the window up,
+ * a word at a time, and one below the window is too old to tell from a replay.
+ */
+class PeerMessageCounter
+{
+public:
+    static constexpr uint32_t kWindowSize = CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE;
+
+    /// Whether a counter was trusted, to which the others are compared.
+    bool IsSynchronized() const { return mSynchronized; }
+
+    uint32_t GetMaxCounter() const { return mMaxCounter; }
+
+    /**
+     * Trust counter as the highest received, forgetting those received before, as when the counters of the peer are
+     * synchronized.
+     */
+    void SetCounter(uint32_t counter)
+    {
+        for (uint64_t & word : mBitmap)
+        {
+            word = 0;
+        }
+        mBitmap[0]    = 1;
+        mMaxCounter   = counter;
+        mSynchronized = true;
+    }
+
+    /**
+     * Check whether a message counter may be received.
+     *
+     * @retval #CHIP_NO_ERROR                             if the counter was not received yet, or the window is not synchronized.
+     * @retval #CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED     if the counter was received already.
+     * @retval #CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW  if the counter is too old to tell whether it was received.
+     */
+    CHIP_ERROR Verify(uint32_t counter) const
+    {
+        if (!mSynchronized || counter > mMaxCounter)
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        const uint32_t offset = mMaxCounter - counter;
+        if (offset >= kWindowSize)
+        {
+            return CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW;
+        }
+        return (mBitmap[offset / kBitsPerWord] & (UINT64_C(1) << (offset % kBitsPerWord))) != 0
+            ? CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED
+            : CHIP_NO_ERROR;
+    }
+
+    /**
+     * Record a message counter as received, once Verify() accepted it and the message was authenticated.
+     */
+    void Commit(uint32_t counter)
+    {
+        if (!mSynchronized)
+        {
+            SetCounter(counter);
+            return;
+        }
+
+        if (counter > mMaxCounter)
+        {
+            SlideUp(counter - mMaxCounter);
+            mMaxCounter = counter;
+        }
+
+        const uint32_t offset = mMaxCounter - counter;
+        mBitmap[offset / kBitsPerWord] |= UINT64_C(1) << (offset % kBitsPerWord);
+    }
+
+    void Reset()
+    {
+        for (uint64_t & word : mBitmap)
+        {
+            word = 0;
+        }
+        mMaxCounter   = 0;
+        mSynchronized = false;
+    }
+
+private:
+    static constexpr uint32_t kBitsPerWord = 64;
+    static constexpr size_t kWordCount     = kWindowSize / kBitsPerWord;
+
+    static_assert(kWindowSize > 0 && kWindowSize % kBitsPerWord == 0,
+                  "CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE must be a positive multiple of 64");
+
+    // Shifts the bitmap towards the older counters by distance bits, whole words first.
+    void SlideUp(uint32_t distance)
+    {
+        const size_t wordShift  = distance / kBitsPerWord;
+        const uint32_t bitShift = distance % kBitsPerWord;
+
+        for (size_t i = kWordCount; i-- > 0;)
+        {
+            uint64_t word = 0;
+            if (i >= wordShift)
+            {
+                word = mBitmap[i - wordShift] << bitShift;
+                if (bitShift != 0 && i > wordShift)
+                {
+                    word |= mBitmap[i - wordShift - 1] >> (kBitsPerWord - bitShift);
+                }
+            }
+            mBitmap[i] = word;
+        }
+    }
+
+    uint64_t mBitmap[kWordCount] = {};
+    uint32_t mMaxCounter         = 0;
+    bool mSynchronized           = false;
+};
+
+} // namespace Transport
+} // namespace chip
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   Defines a smoothed round-trip time estimator for a peer connection.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Tracks the smoothed round-trip time (SRTT) and round-trip time variance
+ * (RTTVAR) of a peer, and derives a retransmission timeout from them, as
+ * specified for TCP by RFC 6298:
+ *
+ *     RTTVAR = 3/4 * RTTVAR + 1/4 * |SRTT - R|
+ *     SRTT   = 7/8 * SRTT   + 1/8 * R
+ *     RTO    = SRTT + max(G, 4 * RTTVAR)
+ *
+ * SRTT is kept scaled by 8 and RTTVAR by 4 so that the updates stay exact in
+ * integer arithmetic.
+ */
+class RoundTripTimeEstimator
+{
+public:
+    bool HasSample() const { return mSampleCount != 0; }
+    uint32_t GetSampleCount() const { return mSampleCount; }
+
+    uint32_t GetSmoothedRttMs() const { return mScaledSmoothedRtt >> 3; }
+    uint32_t GetRttVarianceMs() const { return mScaledRttVariance >> 2; }
+
+    /// Feeds one round-trip measurement. Samples must not come from retransmitted messages (Karn's algorithm).
+    void AddSample(uint32_t rttMs)
+    {
+        // Keep the scaled values within range.
+        if (rttMs > kMaxSampleMs)
+        {
+            rttMs = kMaxSampleMs;
+        }
+
+        if (mSampleCount == 0)
+        {
+            mScaledSmoothedRtt = rttMs << 3;
+            mScaledRttVariance = rttMs << 1;
+        }
+        else
+        {
+            const uint32_t srtt  = GetSmoothedRttMs();
+            const uint32_t error = (rttMs > srtt) ? rttMs - srtt : srtt - rttMs;
+
+            mScaledRttVariance = mScaledRttVariance - (mScaledRttVariance >> 2) + error;
+            mScaledSmoothedRtt = mScaledSmoothedRtt - srtt + rttMs;
+        }
+
+        if (mSampleCount != UINT32_MAX)
+        {
+            mSampleCount++;
+        }
+    }
+
+    /**
+     * Returns the retransmission timeout, only meaningful once HasSample() is true.
+     *
+     * @param[in] granularityMs  The clock granularity G, i.e. the retransmission timer tick period.
+     */
+    uint32_t GetRetransmitTimeoutMs(uint32_t granularityMs) const
+    {
+        // mScaledRttVariance is 4 * RTTVAR.
+        return GetSmoothedRttMs() + ((mScaledRttVariance > granularityMs) ? mScaledRttVariance : granularityMs);
+    }
+
+    void Reset()
+    {
+        mScaledSmoothedRtt = 0;
+        mScaledRttVariance = 0;
+        mSampleCount       = 0;
+    }
+
+private:
+    static constexpr uint32_t kMaxSampleMs = UINT32_MAX >> 4;
+
+    uint32_t mScaledSmoothedRtt = 0;
+    uint32_t mScaledRttVariance = 0;
+    uint32_t mSampleCount       = 0;
+};
+
+} // namespace Transport
+} // namespace chip
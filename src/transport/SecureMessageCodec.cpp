@@ -27,6 +27,7 @@
 
 #include <support/CodeUtils.h>
 #include <support/SafeInt.h>
+#include <system/SystemStats.h>
 #include <transport/SecureMessageCodec.h>
 
 namespace chip {
@@ -41,7 +42,7 @@ CHIP_ERROR Encode(NodeId localNodeId, Transport::PeerConnectionState * state, Pa
 {
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
-    VerifyOrReturnError(msgBuf->TotalLength() <= kMaxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
+    VerifyOrReturnError(msgBuf->TotalLength() <= state->GetMaxAppMessageLength(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
     uint32_t msgId = state->GetSendMessageIndex();
 
@@ -64,12 +65,12 @@ CHIP_ERROR Encode(NodeId localNodeId, Transport::PeerConnectionState * state, Pa
 
     uint8_t * data    = msgBuf->Start();
     uint16_t totalLen = msgBuf->TotalLength();
+    uint16_t taglen   = 0;
 
-    MessageAuthenticationCode mac;
-    ReturnErrorOnFailure(state->EncryptBeforeSend(data, totalLen, data, packetHeader, mac));
-
-    uint16_t taglen = 0;
-    ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
+    // The ciphertext overwrites the plaintext and the tag goes into the tailroom reserved by
+    // MessagePacketBuffer::New(), so the payload is never copied.
+    ReturnErrorOnFailure(state->EncryptBeforeSend(data, totalLen, msgBuf->AvailableDataLength(), packetHeader, taglen));
+    SYSTEM_STATS_COUNT(chip::System::Stats::kCrypto_NumEncryptions);
 
     VerifyOrReturnError(CanCastTo<uint16_t>(totalLen + taglen), CHIP_ERROR_INTERNAL);
     msgBuf->SetDataLength(static_cast<uint16_t>(totalLen + taglen));
@@ -88,30 +89,37 @@ CHIP_ERROR Decode(Transport::PeerConnectionState * state, PayloadHeader & payloa
     uint8_t * data = msg->Start();
     uint16_t len   = msg->DataLength();
 
-    PacketBufferHandle origMsg;
+    uint16_t footerLen = MessageAuthenticationCode::TagLenForEncryptionType(packetHeader.GetEncryptionType());
+    VerifyOrReturnError(footerLen != 0, CHIP_ERROR_WRONG_ENCRYPTION_TYPE_FROM_PEER);
+    VerifyOrReturnError(footerLen <= len, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    len = static_cast<uint16_t>(len - footerLen);
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
     /* This is a workaround for the case where PacketBuffer payload is not
         allocated as an inline buffer to PacketBuffer structure */
-    origMsg = std::move(msg);
-    msg     = PacketBufferHandle::New(len);
+    PacketBufferHandle origMsg = std::move(msg);
+    msg                        = PacketBufferHandle::New(len);
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_NO_MEMORY);
     msg->SetDataLength(len);
-#endif
-
-    uint16_t footerLen = MessageAuthenticationCode::TagLenForEncryptionType(packetHeader.GetEncryptionType());
-    VerifyOrReturnError(footerLen <= len, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
     uint16_t taglen = 0;
     MessageAuthenticationCode mac;
-    ReturnErrorOnFailure(mac.Decode(packetHeader, &data[len - footerLen], footerLen, &taglen));
-    VerifyOrReturnError(taglen == footerLen, CHIP_ERROR_INTERNAL);
+    ReturnErrorOnFailure(mac.Decode(packetHeader, &data[len], footerLen, &taglen));
+    CHIP_ERROR err = state->GetReceiverSecureSession().Decrypt(data, len, msg->Start(), packetHeader, mac);
+#else
+    // The plaintext overwrites the ciphertext and the tag is read where it lies, so the payload is never copied.
+    CHIP_ERROR err = state->DecryptOnReceive(data, len, packetHeader);
+#endif
 
-    len = static_cast<uint16_t>(len - taglen);
+    SYSTEM_STATS_COUNT(chip::System::Stats::kCrypto_NumDecryptions);
+    if (err != CHIP_NO_ERROR)
+    {
+        SYSTEM_STATS_COUNT(chip::System::Stats::kCrypto_NumDecryptionFailures);
+        return err;
+    }
     msg->SetDataLength(len);
 
-    uint8_t * plainText = msg->Start();
-    ReturnErrorOnFailure(state->DecryptOnReceive(data, len, plainText, packetHeader, mac));
-
     ReturnErrorOnFailure(payloadHeader.DecodeAndConsume(msg));
     return CHIP_NO_ERROR;
 }
@@ -46,7 +46,9 @@ namespace SecureMessageCodec {
  *                      portion of the message header
  * @param msgBuf        The message buffer that contains the unencrypted message. If
  *                      the operation is successuful, this buffer will contain the
- *                      encrypted message.
+ *                      encrypted message. The message is encrypted in place, and the
+ *                      message authentication code is appended into the tailroom,
+ *                      which must hold MessagePacketBuffer::kMaxFooterSize bytes.
  * @ return CHIP_ERROR  The result of the encode operation
  */
 CHIP_ERROR Encode(NodeId localNodeId, Transport::PeerConnectionState * state, PayloadHeader & payloadHeader,
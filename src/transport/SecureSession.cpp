@@ -41,31 +41,69 @@ constexpr size_t kMaxAADLen   = 128;
 
 using namespace Crypto;
 
-SecureSession::SecureSession() : mKeyAvailable(false) {}
+SecureSession::SecureSession() {}
 
 CHIP_ERROR SecureSession::InitFromSecret(const uint8_t * secret, const size_t secret_length, const uint8_t * salt,
                                          const size_t salt_length, const uint8_t * info, const size_t info_length)
 {
 
-    VerifyOrReturnError(mKeyAvailable == false, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mCipher.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(secret != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(secret_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError((salt_length == 0) || (salt != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(info_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(info != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    ReturnErrorOnFailure(HKDF_SHA256(secret, secret_length, salt, salt_length, info, info_length, mKey, sizeof(mKey)));
+    uint8_t key[kAES_CCM128_Key_Length];
+    CHIP_ERROR err = HKDF_SHA256(secret, secret_length, salt, salt_length, info, info_length, key, sizeof(key));
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mCipher.Init(key, sizeof(key));
+    }
+    ClearSecretData(key, sizeof(key));
 
-    mKeyAvailable = true;
+    return err;
+}
 
-    return CHIP_NO_ERROR;
+CHIP_ERROR SecureSession::InitPairFromSecret(const uint8_t * secret, const size_t secret_length, const uint8_t * salt,
+                                             const size_t salt_length, const uint8_t * info1, const size_t info1_length,
+                                             SecureSession & session1, const uint8_t * info2, const size_t info2_length,
+                                             SecureSession & session2)
+{
+    VerifyOrReturnError(!session1.mCipher.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!session2.mCipher.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(secret != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(secret_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((salt_length == 0) || (salt != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(info1_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(info1 != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(info2_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(info2 != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t key1[kAES_CCM128_Key_Length];
+    uint8_t key2[kAES_CCM128_Key_Length];
+    const HKDFOutput outputs[] = { { info1, info1_length, key1, sizeof(key1) }, { info2, info2_length, key2, sizeof(key2) } };
+
+    CHIP_ERROR err = HKDF_SHA256_Batch(secret, secret_length, salt, salt_length, outputs, ArraySize(outputs));
+    if (err == CHIP_NO_ERROR)
+    {
+        err = session1.mCipher.Init(key1, sizeof(key1));
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = session2.mCipher.Init(key2, sizeof(key2));
+    }
+    ClearSecretData(key1, sizeof(key1));
+    ClearSecretData(key2, sizeof(key2));
+
+    return err;
 }
 
 CHIP_ERROR SecureSession::Init(const Crypto::P256Keypair & local_keypair, const Crypto::P256PublicKey & remote_public_key,
                                const uint8_t * salt, const size_t salt_length, const uint8_t * info, const size_t info_length)
 {
 
-    VerifyOrReturnError(mKeyAvailable == false, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mCipher.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError((salt_length == 0) || (salt != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(info_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(info != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -78,8 +116,7 @@ CHIP_ERROR SecureSession::Init(const Crypto::P256Keypair & local_keypair, const
 
 void SecureSession::Reset()
 {
-    mKeyAvailable = false;
-    memset(mKey, 0, sizeof(mKey));
+    mCipher.Clear();
 }
 
 CHIP_ERROR SecureSession::GetIV(const PacketHeader & header, uint8_t * iv, size_t len)
@@ -111,45 +148,45 @@ CHIP_ERROR SecureSession::GetAdditionalAuthData(const PacketHeader & header, uin
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR SecureSession::Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
-                                  MessageAuthenticationCode & mac) const
+CHIP_ERROR SecureSession::EncryptWithTag(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
+                                         uint8_t * tag, size_t tag_space, uint16_t & tag_length) const
 {
 
     constexpr Header::EncryptionType encType = Header::EncryptionType::kAESCCMTagLen16;
 
-    const size_t taglen = MessageAuthenticationCode::TagLenForEncryptionType(encType);
+    const uint16_t taglen = MessageAuthenticationCode::TagLenForEncryptionType(encType);
     assert(taglen <= kMaxTagLen);
 
-    VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
+    VerifyOrReturnError(mCipher.IsInitialized(), CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
     VerifyOrReturnError(input != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(output != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_space >= taglen, CHIP_ERROR_BUFFER_TOO_SMALL);
 
     uint8_t AAD[kMaxAADLen];
     uint8_t IV[kAESCCMIVLen];
     uint16_t aadLen = sizeof(AAD);
-    uint8_t tag[kMaxTagLen];
 
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
-    ReturnErrorOnFailure(
-        AES_CCM_encrypt(input, input_length, AAD, aadLen, mKey, sizeof(mKey), IV, sizeof(IV), output, tag, taglen));
+    ReturnErrorOnFailure(mCipher.Encrypt(input, input_length, AAD, aadLen, IV, sizeof(IV), output, tag, taglen));
 
-    mac.SetTag(&header, encType, tag, taglen);
+    header.SetEncryptionType(encType);
+    tag_length = taglen;
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR SecureSession::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
-                                  const MessageAuthenticationCode & mac) const
+CHIP_ERROR SecureSession::DecryptWithTag(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                                         const uint8_t * tag) const
 {
     const size_t taglen = MessageAuthenticationCode::TagLenForEncryptionType(header.GetEncryptionType());
-    const uint8_t * tag = mac.GetTag();
     uint8_t IV[kAESCCMIVLen];
     uint8_t AAD[kMaxAADLen];
     uint16_t aadLen = sizeof(AAD);
 
-    VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
+    VerifyOrReturnError(mCipher.IsInitialized(), CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
     VerifyOrReturnError(input != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(output != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -157,7 +194,42 @@ CHIP_ERROR SecureSession::Decrypt(const uint8_t * input, size_t input_length, ui
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
-    return AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mKey, sizeof(mKey), IV, sizeof(IV), output);
+    return mCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, IV, sizeof(IV), output);
+}
+
+CHIP_ERROR SecureSession::Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
+                                  MessageAuthenticationCode & mac) const
+{
+    uint8_t tag[kMaxTagLen];
+    uint16_t taglen = 0;
+
+    ReturnErrorOnFailure(EncryptWithTag(input, input_length, output, header, tag, sizeof(tag), taglen));
+
+    mac.SetTag(&header, header.GetEncryptionType(), tag, taglen);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SecureSession::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                                  const MessageAuthenticationCode & mac) const
+{
+    return DecryptWithTag(input, input_length, output, header, mac.GetTag());
+}
+
+CHIP_ERROR SecureSession::EncryptInPlace(uint8_t * data, size_t data_length, size_t tag_space, PacketHeader & header,
+                                         uint16_t & tag_length) const
+{
+    VerifyOrReturnError(data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The tag is written straight into the space following the data, so no copy of it is kept.
+    return EncryptWithTag(data, data_length, data, header, data + data_length, tag_space, tag_length);
+}
+
+CHIP_ERROR SecureSession::DecryptInPlace(uint8_t * data, size_t data_length, const PacketHeader & header) const
+{
+    VerifyOrReturnError(data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return DecryptWithTag(data, data_length, data, header, data + data_length);
 }
 
 } // namespace chip
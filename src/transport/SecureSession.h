@@ -72,6 +72,28 @@ public:
     CHIP_ERROR InitFromSecret(const uint8_t * secret, size_t secret_length, const uint8_t * salt, size_t salt_length,
                               const uint8_t * info, size_t info_length);
 
+    /**
+     * @brief
+     *   Derive the keys of two sessions from the same shared secret, such as the two directions of a
+     *   pairing. The keys are the ones InitFromSecret() would derive, but share the extract step of
+     *   the key derivation.
+     *
+     * @param secret             A pointer to the shared secret
+     * @param secret_length      Length of the shared secret
+     * @param salt               A pointer to the initial salt used for deriving the keys
+     * @param salt_length        Length of the initial salt
+     * @param info1              A pointer to the initial info of session1
+     * @param info1_length       Length of the initial info of session1
+     * @param session1           The first session to initialize
+     * @param info2              A pointer to the initial info of session2
+     * @param info2_length       Length of the initial info of session2
+     * @param session2           The second session to initialize
+     * @return CHIP_ERROR        The result of key derivation
+     */
+    static CHIP_ERROR InitPairFromSecret(const uint8_t * secret, size_t secret_length, const uint8_t * salt, size_t salt_length,
+                                         const uint8_t * info1, size_t info1_length, SecureSession & session1,
+                                         const uint8_t * info2, size_t info2_length, SecureSession & session2);
+
     /**
      * @brief
      *   Encrypt the input data using keys established in the secure channel
@@ -101,6 +123,36 @@ public:
     CHIP_ERROR Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
                        const MessageAuthenticationCode & mac) const;
 
+    /**
+     * @brief
+     *   Encrypt data in place using keys established in the secure channel, and write
+     *   the message authentication tag directly after it.
+     *
+     * @param data Unencrypted input data, overwritten with the encrypted data
+     * @param data_length Length of the data
+     * @param tag_space Number of bytes available after the data for the tag
+     * @param header message header structure. Encryption type will be set on the header.
+     * @param tag_length - output the number of tag bytes written after the data
+     *
+     * @return CHIP_ERROR The result of encryption. The data is left untouched if there
+     *                    is not enough space for the tag.
+     */
+    CHIP_ERROR EncryptInPlace(uint8_t * data, size_t data_length, size_t tag_space, PacketHeader & header,
+                              uint16_t & tag_length) const;
+
+    /**
+     * @brief
+     *   Decrypt data in place using keys established in the secure channel.
+     *
+     * @param data Encrypted input data, followed by the message authentication tag whose
+     *             length is given by the encryption type of the header. Overwritten with the
+     *             decrypted data.
+     * @param data_length Length of the data, not including the tag
+     * @param header message header structure
+     * @return CHIP_ERROR The result of decryption
+     */
+    CHIP_ERROR DecryptInPlace(uint8_t * data, size_t data_length, const PacketHeader & header) const;
+
     /**
      * @brief
      *   Memory overhead of encrypting data. The overhead is indepedent of size of
@@ -118,8 +170,14 @@ public:
 private:
     static constexpr size_t kAES_CCM128_Key_Length = 16;
 
-    bool mKeyAvailable;
-    uint8_t mKey[kAES_CCM128_Key_Length];
+    // Keyed once by InitFromSecret() and reused for every message. The cipher context is scratch
+    // state that does not change the session, so Encrypt() and Decrypt() remain const.
+    mutable Crypto::AES_CCM_cipher mCipher;
+
+    CHIP_ERROR EncryptWithTag(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header, uint8_t * tag,
+                              size_t tag_space, uint16_t & tag_length) const;
+    CHIP_ERROR DecryptWithTag(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                              const uint8_t * tag) const;
 
     static CHIP_ERROR GetIV(const PacketHeader & header, uint8_t * iv, size_t len);
 
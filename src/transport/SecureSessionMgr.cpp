@@ -36,6 +36,8 @@
 #include <support/CodeUtils.h>
 #include <support/SafeInt.h>
 #include <support/logging/CHIPLogging.h>
+#include <system/SystemStats.h>
+#include <system/SystemTrace.h>
 #include <transport/AdminPairingTable.h>
 #include <transport/SecureMessageCodec.h>
 #include <transport/TransportMgr.h>
@@ -47,6 +49,7 @@ namespace chip {
 using System::PacketBufferHandle;
 using Transport::PeerAddress;
 using Transport::PeerConnectionState;
+using Transport::TrafficClass;
 
 uint32_t EncryptedPacketBufferHandle::GetMsgId() const
 {
@@ -69,6 +72,9 @@ SecureSessionMgr::SecureSessionMgr() : mState(State::kNotReady) {}
 SecureSessionMgr::~SecureSessionMgr()
 {
     CancelExpiryTimer();
+#if CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+    ClearSendQueue();
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
 }
 
 CHIP_ERROR SecureSessionMgr::Init(NodeId localNodeId, System::Layer * systemLayer, TransportMgrBase * transportMgr,
@@ -96,6 +102,9 @@ CHIP_ERROR SecureSessionMgr::Init(NodeId localNodeId, System::Layer * systemLaye
 void SecureSessionMgr::Shutdown()
 {
     CancelExpiryTimer();
+#if CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+    ClearSendQueue();
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
 
     mState        = State::kNotReady;
     mLocalNodeId  = kUndefinedNodeId;
@@ -118,15 +127,16 @@ Transport::Type SecureSessionMgr::GetTransportType(NodeId peerNodeId)
 }
 
 CHIP_ERROR SecureSessionMgr::SendMessage(SecureSessionHandle session, PayloadHeader & payloadHeader,
-                                         System::PacketBufferHandle && msgBuf, EncryptedPacketBufferHandle * bufferRetainSlot)
+                                         System::PacketBufferHandle && msgBuf, EncryptedPacketBufferHandle * bufferRetainSlot,
+                                         TrafficClass trafficClass)
 {
     PacketHeader unusedPacketHeader;
     return SendMessage(session, payloadHeader, unusedPacketHeader, std::move(msgBuf), bufferRetainSlot,
-                       EncryptionState::kPayloadIsUnencrypted);
+                       EncryptionState::kPayloadIsUnencrypted, trafficClass);
 }
 
 CHIP_ERROR SecureSessionMgr::SendEncryptedMessage(SecureSessionHandle session, EncryptedPacketBufferHandle msgBuf,
-                                                  EncryptedPacketBufferHandle * bufferRetainSlot)
+                                                  EncryptedPacketBufferHandle * bufferRetainSlot, TrafficClass trafficClass)
 {
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
@@ -137,12 +147,12 @@ CHIP_ERROR SecureSessionMgr::SendEncryptedMessage(SecureSessionHandle session, E
 
     PayloadHeader payloadHeader;
     return SendMessage(session, payloadHeader, packetHeader, std::move(msgBuf), bufferRetainSlot,
-                       EncryptionState::kPayloadIsEncrypted);
+                       EncryptionState::kPayloadIsEncrypted, trafficClass);
 }
 
 CHIP_ERROR SecureSessionMgr::SendMessage(SecureSessionHandle session, PayloadHeader & payloadHeader, PacketHeader & packetHeader,
                                          System::PacketBufferHandle msgBuf, EncryptedPacketBufferHandle * bufferRetainSlot,
-                                         EncryptionState encryptionState)
+                                         EncryptionState encryptionState, TrafficClass trafficClass)
 {
     CHIP_ERROR err              = CHIP_NO_ERROR;
     PeerConnectionState * state = nullptr;
@@ -152,12 +162,20 @@ CHIP_ERROR SecureSessionMgr::SendMessage(SecureSessionHandle session, PayloadHea
 
     VerifyOrExit(mState == State::kInitialized, err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(!msgBuf->HasChainedBuffer(), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
     // Find an active connection to the specified peer node
     state = GetPeerConnectionState(session);
     VerifyOrExit(state != nullptr, err = CHIP_ERROR_NOT_CONNECTED);
 
+    if (encryptionState == EncryptionState::kPayloadIsUnencrypted && msgBuf->HasChainedBuffer())
+    {
+        // Payloads written into chained buffers are encrypted in place like any other, which needs them in one buffer
+        VerifyOrExit(msgBuf->TotalLength() <= state->GetMaxAppMessageLength(), err = CHIP_ERROR_MESSAGE_TOO_LONG);
+        msgBuf = MessagePacketBuffer::Gather(std::move(msgBuf));
+        VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    }
+    VerifyOrExit(!msgBuf->HasChainedBuffer(), err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
     // This marks any connection where we send data to as 'active'
     mPeerConnections.MarkConnectionActive(state);
     admin = mAdmins->FindAdminWithId(state->GetAdminId());
@@ -189,7 +207,31 @@ CHIP_ERROR SecureSessionMgr::SendMessage(SecureSessionHandle session, PayloadHea
                     "Sending msg from 0x%08" PRIx32 "%08" PRIx32 " to 0x%08" PRIx32 "%08" PRIx32 " at utc time: %" PRId64 " msec",
                     static_cast<uint32_t>(localNodeId >> 32), static_cast<uint32_t>(localNodeId),
                     static_cast<uint32_t>(state->GetPeerNodeId() >> 32), static_cast<uint32_t>(state->GetPeerNodeId()),
-                    System::Layer::GetClock_MonotonicMS());
+                    System::Layer::GetClock_MonotonicLoopMS());
+
+#if CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+    err = QueueMessage(session, payloadHeader, std::move(msgBuf), trafficClass);
+#else
+    err = SendToPeer(state, std::move(msgBuf));
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+    SuccessOrExit(err);
+
+exit:
+    if (!msgBuf.IsNull())
+    {
+        const char * errStr = ErrorStr(err);
+        if (state == nullptr)
+        {
+            ChipLogError(Inet, "Secure transport could not find a valid PeerConnection: %s", errStr);
+        }
+    }
+
+    return err;
+}
+
+CHIP_ERROR SecureSessionMgr::SendToPeer(PeerConnectionState * state, System::PacketBufferHandle msgBuf)
+{
+    CHIP_ERROR err;
 
     if (state->GetTransport() != nullptr)
     {
@@ -202,21 +244,191 @@ CHIP_ERROR SecureSessionMgr::SendMessage(SecureSessionHandle session, PayloadHea
         err = mTransportMgr->SendMessage(state->GetPeerAddress(), std::move(msgBuf));
     }
     ChipLogProgress(Inet, "Secure msg send status %s", ErrorStr(err));
-    SuccessOrExit(err);
 
-exit:
-    if (!msgBuf.IsNull())
+    return err;
+}
+
+#if CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+namespace {
+
+// Indexed by TrafficClass
+constexpr uint8_t kSendWeights[Transport::kNumTrafficClasses] = {
+    CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE,
+    CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_REPORTING,
+    CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_BULK,
+};
+
+static_assert(CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_INTERACTIVE > 0 && CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_REPORTING > 0 &&
+                  CHIP_CONFIG_SECURE_SESSION_SEND_WEIGHT_BULK > 0,
+              "A traffic class without weight would never be sent");
+static_assert(CHIP_CONFIG_SECURE_SESSION_SEND_BURST > 0, "The send queue must send at least one message per flush");
+
+} // namespace
+
+CHIP_ERROR SecureSessionMgr::QueueMessage(SecureSessionHandle session, const PayloadHeader & payloadHeader,
+                                          System::PacketBufferHandle msgBuf, TrafficClass trafficClass)
+{
+    // A queued standalone ack is redundant with the same ack piggybacked on a later message of its exchange.
+    if (payloadHeader.IsAckMsg() && payloadHeader.GetAckId().HasValue())
     {
-        const char * errStr = ErrorStr(err);
-        if (state == nullptr)
+        for (uint16_t i = 0; i < mSendQueueLength; i++)
         {
-            ChipLogError(Inet, "Secure transport could not find a valid PeerConnection: %s", errStr);
+            const QueuedMessage & queued = mSendQueue[i];
+            if (queued.standaloneAck && queued.session == session && queued.exchangeId == payloadHeader.GetExchangeID() &&
+                queued.initiator == payloadHeader.IsInitiator() && queued.ackId == payloadHeader.GetAckId().Value())
+            {
+                ChipLogDetail(Inet, "Dropping standalone ack %" PRIu32 " piggybacked on a queued msg", queued.ackId);
+                RemoveQueuedMessage(i);
+                break;
+            }
         }
     }
 
-    return err;
+    if (mSendQueueLength == CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE)
+    {
+        // Make room by sending what would have gone next anyway.
+        SendQueuedMessage(NextQueuedMessage());
+    }
+
+    if (ScheduleSendQueueFlush() != CHIP_NO_ERROR)
+    {
+        // Without a flush to come, the queued messages and this one are sent right away.
+        FlushSendQueue();
+        PeerConnectionState * state = GetPeerConnectionState(session);
+        VerifyOrReturnError(state != nullptr, CHIP_ERROR_NOT_CONNECTED);
+        return SendToPeer(state, std::move(msgBuf));
+    }
+
+    // Holding back the ack of a bulk message would have its sender retransmit it, which costs the link more.
+    const bool standaloneAck = payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck);
+
+    QueuedMessage & queued = mSendQueue[mSendQueueLength++];
+    queued.session         = session;
+    queued.msgBuf          = std::move(msgBuf);
+    queued.ackId           = payloadHeader.GetAckId().ValueOr(0);
+    queued.exchangeId      = payloadHeader.GetExchangeID();
+    queued.initiator       = payloadHeader.IsInitiator();
+    queued.standaloneAck   = standaloneAck;
+    queued.trafficClass    = standaloneAck ? TrafficClass::kInteractive : trafficClass;
+
+    return CHIP_NO_ERROR;
+}
+
+uint16_t SecureSessionMgr::NextQueuedMessage()
+{
+    // Each round of the scheduler, a class sends as many messages as its weight, the classes of higher priority first.
+    // A round ends once no class with messages queued has credit left.
+    for (int round = 0; round < 2; round++)
+    {
+        for (size_t trafficClass = 0; trafficClass < Transport::kNumTrafficClasses; trafficClass++)
+        {
+            if (mSendCredits[trafficClass] == 0)
+            {
+                continue;
+            }
+
+            for (uint16_t i = 0; i < mSendQueueLength; i++)
+            {
+                if (static_cast<size_t>(mSendQueue[i].trafficClass) == trafficClass)
+                {
+                    mSendCredits[trafficClass]--;
+                    return i;
+                }
+            }
+        }
+
+        for (size_t trafficClass = 0; trafficClass < Transport::kNumTrafficClasses; trafficClass++)
+        {
+            mSendCredits[trafficClass] = kSendWeights[trafficClass];
+        }
+    }
+
+    // Not reached while any message is queued, since a new round gives every class credit
+    return 0;
+}
+
+void SecureSessionMgr::SendQueuedMessage(uint16_t index)
+{
+    SecureSessionHandle session       = mSendQueue[index].session;
+    System::PacketBufferHandle msgBuf = std::move(mSendQueue[index].msgBuf);
+    RemoveQueuedMessage(index);
+
+    PeerConnectionState * state = GetPeerConnectionState(session);
+    if (state == nullptr)
+    {
+        ChipLogError(Inet, "Dropping queued secure msg of an expired PeerConnection");
+        return;
+    }
+
+    CHIP_ERROR err = SendToPeer(state, std::move(msgBuf));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to send queued secure msg: %s", ErrorStr(err));
+    }
+}
+
+CHIP_ERROR SecureSessionMgr::ScheduleSendQueueFlush()
+{
+    VerifyOrReturnError(!mSendQueueFlushScheduled, CHIP_NO_ERROR);
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mSystemLayer->ScheduleWork(FlushSendQueueCallback, this));
+    mSendQueueFlushScheduled = true;
+    return CHIP_NO_ERROR;
+}
+
+void SecureSessionMgr::FlushSendQueue()
+{
+    // Messages are taken off one at a time, since a transport delivering synchronously may queue more.
+    while (mSendQueueLength > 0)
+    {
+        SendQueuedMessage(NextQueuedMessage());
+    }
 }
 
+void SecureSessionMgr::RemoveQueuedMessage(uint16_t index)
+{
+    mSendQueueLength--;
+    for (uint16_t i = index; i < mSendQueueLength; i++)
+    {
+        mSendQueue[i] = std::move(mSendQueue[i + 1]);
+    }
+    mSendQueue[mSendQueueLength].msgBuf = nullptr;
+}
+
+void SecureSessionMgr::ClearSendQueue()
+{
+    if (mSendQueueFlushScheduled && mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(FlushSendQueueCallback, this);
+    }
+    mSendQueueFlushScheduled = false;
+
+    for (uint16_t i = 0; i < mSendQueueLength; i++)
+    {
+        mSendQueue[i].msgBuf = nullptr;
+    }
+    mSendQueueLength = 0;
+}
+
+void SecureSessionMgr::FlushSendQueueCallback(System::Layer * layer, void * param, System::Error error)
+{
+    SecureSessionMgr * mgr = reinterpret_cast<SecureSessionMgr *>(param);
+
+    mgr->mSendQueueFlushScheduled = false;
+
+    // A burst at a time, so the messages of lower priority wait out a busy link rather than hold up the event loop.
+    for (int sent = 0; sent < CHIP_CONFIG_SECURE_SESSION_SEND_BURST && mgr->mSendQueueLength > 0; sent++)
+    {
+        mgr->SendQueuedMessage(mgr->NextQueuedMessage());
+    }
+
+    if (mgr->mSendQueueLength > 0 && mgr->ScheduleSendQueueFlush() != CHIP_NO_ERROR)
+    {
+        mgr->FlushSendQueue();
+    }
+}
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+
 CHIP_ERROR SecureSessionMgr::NewPairing(const Optional<Transport::PeerAddress> & peerAddr, NodeId peerNodeId,
                                         PairingSession * pairing, PairingDirection direction, Transport::AdminId admin,
                                         Transport::Base * transport)
@@ -262,22 +474,20 @@ CHIP_ERROR SecureSessionMgr::NewPairing(const Optional<Transport::PeerAddress> &
         {
         case PairingDirection::kInitiator: {
             const char * i2rInfo = pairing->GetI2RSessionInfo();
-            ReturnErrorOnFailure(pairing->DeriveSecureSession(reinterpret_cast<const uint8_t *>(i2rInfo), strlen(i2rInfo),
-                                                              state->GetSenderSecureSession()));
-
             const char * r2iInfo = pairing->GetR2ISessionInfo();
-            ReturnErrorOnFailure(pairing->DeriveSecureSession(reinterpret_cast<const uint8_t *>(r2iInfo), strlen(r2iInfo),
-                                                              state->GetReceiverSecureSession()));
+            ReturnErrorOnFailure(pairing->DeriveSecureSessions(reinterpret_cast<const uint8_t *>(i2rInfo), strlen(i2rInfo),
+                                                               state->GetSenderSecureSession(),
+                                                               reinterpret_cast<const uint8_t *>(r2iInfo), strlen(r2iInfo),
+                                                               state->GetReceiverSecureSession()));
         }
         break;
         case PairingDirection::kResponder: {
             const char * i2rInfo = pairing->GetR2ISessionInfo();
-            ReturnErrorOnFailure(pairing->DeriveSecureSession(reinterpret_cast<const uint8_t *>(i2rInfo), strlen(i2rInfo),
-                                                              state->GetSenderSecureSession()));
-
             const char * r2iInfo = pairing->GetI2RSessionInfo();
-            ReturnErrorOnFailure(pairing->DeriveSecureSession(reinterpret_cast<const uint8_t *>(r2iInfo), strlen(r2iInfo),
-                                                              state->GetReceiverSecureSession()));
+            ReturnErrorOnFailure(pairing->DeriveSecureSessions(reinterpret_cast<const uint8_t *>(i2rInfo), strlen(i2rInfo),
+                                                               state->GetSenderSecureSession(),
+                                                               reinterpret_cast<const uint8_t *>(r2iInfo), strlen(r2iInfo),
+                                                               state->GetReceiverSecureSession()));
         }
         break;
         default:
@@ -290,23 +500,105 @@ CHIP_ERROR SecureSessionMgr::NewPairing(const Optional<Transport::PeerAddress> &
         }
     }
 
+    ScheduleExpiryTimer();
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR SecureSessionMgr::NewGroupSession(const Transport::PeerAddress & groupAddress, uint16_t keyId, const uint8_t * groupKey,
+                                             size_t groupKeyLength, Transport::AdminId admin, SecureSessionHandle & session)
+{
+    static const char kGroupSessionInfo[] = "GroupSessionKeys";
+
+    CHIP_ERROR err              = CHIP_NO_ERROR;
+    PeerConnectionState * state = nullptr;
+
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(groupAddress.GetIPAddress().IsMulticast(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(groupKey != nullptr && groupKeyLength != 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mPeerConnections.FindPeerConnectionState(Optional<NodeId>::Missing(), keyId, nullptr) == nullptr,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The members of the group are not known: the session has no peer node id, and the messages sent on it carry no
+    // destination node id.
+    ReturnErrorOnFailure(mPeerConnections.CreateNewPeerConnectionState(Optional<NodeId>::Missing(), keyId, keyId, &state));
+
+    state->SetAdminId(admin);
+    state->SetPeerAddress(groupAddress);
+    state->SetGroupSession(true);
+
+    // Every member sends and receives with the same keys.
+    err = state->GetSenderSecureSession().InitFromSecret(groupKey, groupKeyLength, nullptr, 0,
+                                                         reinterpret_cast<const uint8_t *>(kGroupSessionInfo),
+                                                         strlen(kGroupSessionInfo));
+    SuccessOrExit(err);
+    err = state->GetReceiverSecureSession().InitFromSecret(groupKey, groupKeyLength, nullptr, 0,
+                                                           reinterpret_cast<const uint8_t *>(kGroupSessionInfo),
+                                                           strlen(kGroupSessionInfo));
+    SuccessOrExit(err);
+
+    err = mTransportMgr->MulticastGroupJoinLeave(groupAddress, true);
+    SuccessOrExit(err);
+
+    session = SecureSessionHandle(state->GetPeerNodeId(), state->GetPeerKeyID(), admin);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to establish the session of group key %d: %s", keyId, ErrorStr(err));
+        mPeerConnections.MarkConnectionExpired(state, [](const Transport::PeerConnectionState &) {});
+    }
+    return err;
+}
+
+void SecureSessionMgr::ExpirePairing(SecureSessionHandle session)
+{
+    PeerConnectionState * state = GetPeerConnectionState(session);
+
+    VerifyOrReturn(state != nullptr && !state->IsGroupSession());
+
+    mPeerConnections.MarkConnectionExpired(
+        state, [this](const Transport::PeerConnectionState & state1) { HandleConnectionExpired(state1); });
+}
+
+void SecureSessionMgr::RemoveGroupSession(SecureSessionHandle session)
+{
+    PeerConnectionState * state = GetPeerConnectionState(session);
+
+    VerifyOrReturn(state != nullptr && state->IsGroupSession());
+
+    mTransportMgr->MulticastGroupJoinLeave(state->GetPeerAddress(), false);
+    mPeerConnections.MarkConnectionExpired(
+        state, [this](const Transport::PeerConnectionState & state1) { HandleConnectionExpired(state1); });
+}
+
 void SecureSessionMgr::ScheduleExpiryTimer()
 {
-    CHIP_ERROR err =
-        mSystemLayer->StartTimer(CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS, SecureSessionMgr::ExpiryTimerCallback, this);
+#if CHIP_CONFIG_SESSION_REKEYING
+    uint64_t expiryTimeMs;
+
+    // A timer armed already expires no later than any session that became active since
+    VerifyOrReturn(!mExpiryTimerArmed && mSystemLayer != nullptr);
+    // Without sessions to expire, the timer is armed again once there are
+    VerifyOrReturn(mPeerConnections.GetNextExpiryTimeMs(CHIP_PEER_CONNECTION_TIMEOUT_MS, expiryTimeMs));
+
+    const uint64_t nowMs   = mPeerConnections.GetTimeSource().GetCurrentMonotonicTimeMs();
+    const uint64_t delayMs = (expiryTimeMs > nowMs) ? expiryTimeMs - nowMs : 0;
+    CHIP_ERROR err = mSystemLayer->StartTimerWithSlack(static_cast<uint32_t>((delayMs < UINT32_MAX) ? delayMs : UINT32_MAX),
+                                                       CHIP_PEER_CONNECTION_TIMEOUT_CHECK_SLACK_MS,
+                                                       SecureSessionMgr::ExpiryTimerCallback, this);
 
     VerifyOrDie(err == CHIP_NO_ERROR);
+    mExpiryTimerArmed = true;
+#endif
 }
 
 void SecureSessionMgr::CancelExpiryTimer()
 {
-    if (mSystemLayer != nullptr)
+    if (mSystemLayer != nullptr && mExpiryTimerArmed)
     {
         mSystemLayer->CancelTimer(SecureSessionMgr::ExpiryTimerCallback, this);
     }
+    mExpiryTimerArmed = false;
 }
 
 void SecureSessionMgr::HandleGroupMessageReceived(uint16_t keyId, System::PacketBufferHandle msgBuf)
@@ -319,6 +611,8 @@ void SecureSessionMgr::HandleGroupMessageReceived(uint16_t keyId, System::Packet
 
 void SecureSessionMgr::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle msg)
 {
+    SYSTEM_TRACE_SCOPE(SecureSessionReceive);
+
     PacketHeader packetHeader;
 
     ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
@@ -355,12 +649,19 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
 
     Transport::AdminPairingInfo * admin = nullptr;
 
-    bool modifiedAdmin = false;
+    bool modifiedAdmin       = false;
+    CHIP_ERROR counterStatus = CHIP_NO_ERROR;
     NodeId localNodeId;
     FabricId fabricId;
 
     VerifyOrExit(!msg.IsNull(), ChipLogError(Inet, "Secure transport received NULL packet, discarding"));
 
+    if (state == nullptr && mRestoreDelegate != nullptr &&
+        mRestoreDelegate->RestoreSession(packetHeader.GetEncryptionKeyID(), *this) == CHIP_NO_ERROR)
+    {
+        state = mPeerConnections.FindPeerConnectionState(packetHeader.GetEncryptionKeyID(), nullptr);
+    }
+
     if (state == nullptr)
     {
         ChipLogError(Inet, "Data received on an unknown connection (%d). Dropping it!!", packetHeader.GetEncryptionKeyID());
@@ -380,9 +681,17 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
                 "Secure transport received message, but destination node ID (%llu) doesn't match our node ID (%llu), discarding",
                 packetHeader.GetDestinationNodeId().Value(), admin->GetNodeId()));
     }
-    ChipLogError(Inet, "Secure transport received message destined to node ID (%llu)", packetHeader.GetDestinationNodeId().Value());
+    ChipLogError(Inet, "Secure transport received message destined to node ID (%llu)",
+                 packetHeader.GetDestinationNodeId().ValueOr(kUndefinedNodeId));
     mPeerConnections.MarkConnectionActive(state);
 
+    // With the multicast loopback, the messages sent to a group also come back to their sender.
+    if (state->IsGroupSession() && packetHeader.GetSourceNodeId().HasValue() &&
+        packetHeader.GetSourceNodeId().Value() == admin->GetNodeId())
+    {
+        return;
+    }
+
     if (!packetHeader.IsSecureSessionControlMsg() && !state->IsPeerMsgCounterSynced() &&
         ChipKeyId::IsAppGroupKey(packetHeader.GetEncryptionKeyID()))
     {
@@ -403,19 +712,47 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
         return;
     }
 
+    // Messages too old to be told from replays are dropped before being decrypted. The members of a group share its session
+    // while their message counters are unrelated, so group sessions have no replay window.
+    if (!state->IsGroupSession())
+    {
+        counterStatus = state->GetPeerMessageCounter().Verify(packetHeader.GetMessageId());
+        if (counterStatus == CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW)
+        {
+            SYSTEM_STATS_COUNT(chip::System::Stats::kSecureSessionMgr_NumOutOfWindowMessages);
+            ExitNow(ChipLogError(Inet, "Secure transport received message counter %" PRIu32 " out of window, discarding",
+                                 packetHeader.GetMessageId()));
+        }
+    }
+
     // Decode the message
     VerifyOrExit(CHIP_NO_ERROR == SecureMessageCodec::Decode(state, payloadHeader, packetHeader, msg),
                  ChipLogError(Inet, "Secure transport received message, but failed to decode it, discarding"));
 
+    // A duplicate is only passed up to be acknowledged again, as the peer retransmits the messages whose acknowledgement it
+    // missed.
+    if (counterStatus == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
+    {
+        SYSTEM_STATS_COUNT(chip::System::Stats::kSecureSessionMgr_NumDuplicateMessages);
+        ChipLogDetail(Inet, "Secure transport received duplicate message counter %" PRIu32, packetHeader.GetMessageId());
+        if (mCB != nullptr)
+        {
+            SecureSessionHandle session(state->GetPeerNodeId(), state->GetPeerKeyID(), state->GetAdminId());
+            mCB->OnDuplicateMessageReceived(packetHeader, payloadHeader, session, peerAddress, this);
+        }
+        ExitNow();
+    }
+
     // See operational-credentials-server.cpp for explanation as to why fabricId is being set to commissioner node id
     // This is temporary code until AddOptCert is implemented through which an admin will be correctly added with the correct
     // fields.
     // TODO: Remove temporary code once AddOptCert is implemented
-    if (packetHeader.GetSourceNodeId().HasValue())
+    // The session of a group is shared by all its members: it is not bound to the first of them to send a message.
+    if (packetHeader.GetSourceNodeId().HasValue() && !state->IsGroupSession())
     {
         if (state->GetPeerNodeId() == kUndefinedNodeId)
         {
-            state->SetPeerNodeId(packetHeader.GetSourceNodeId().Value());
+            mPeerConnections.SetPeerNodeId(state, packetHeader.GetSourceNodeId().Value());
         }
     }
 
@@ -437,7 +774,7 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
         fabricId = packetHeader.GetSourceNodeId().Value();
         if (fabricId != kUndefinedFabricId && admin->GetFabricId() != fabricId)
         {
-            admin->SetFabricId(packetHeader.GetSourceNodeId().Value());
+            mAdmins->SetFabricId(admin, packetHeader.GetSourceNodeId().Value());
             ChipLogProgress(Inet, "Setting fabricID %" PRIX64 " on admin.", admin->GetFabricId());
             modifiedAdmin = true;
         }
@@ -453,20 +790,28 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
     // TODO: once mDNS address resolution is available reconsider if this is required
     // This updates the peer address once a packet is received from a new address
     // and serves as a way to auto-detect peer changing IPs.
-    if (state->GetPeerAddress() != peerAddress)
+    if (state->GetPeerAddress() != peerAddress && !state->IsGroupSession())
     {
         state->SetPeerAddress(peerAddress);
+        // A session paired without an address can expire once it has one
+        ScheduleExpiryTimer();
     }
 
     if (!state->IsPeerMsgCounterSynced())
     {
         // For all control messages, the first authenticated message counter from an unsynchronized peer is trusted
-        // and used to seed subsequent message counter based replay protection.
-        if (packetHeader.IsSecureSessionControlMsg())
+        // and used to seed subsequent message counter based replay protection. So is that of the first message of a
+        // unicast session without a group key, whose counters start along with the session.
+        if (packetHeader.IsSecureSessionControlMsg() ||
+            (!state->IsGroupSession() && !ChipKeyId::IsAppGroupKey(packetHeader.GetEncryptionKeyID())))
         {
             state->SetPeerMessageIndex(packetHeader.GetMessageId());
         }
     }
+    else if (!state->IsGroupSession())
+    {
+        state->GetPeerMessageCounter().Commit(packetHeader.GetMessageId());
+    }
 
     if (mCB != nullptr)
     {
@@ -499,14 +844,25 @@ void SecureSessionMgr::HandleConnectionExpired(const Transport::PeerConnectionSt
 void SecureSessionMgr::ExpiryTimerCallback(System::Layer * layer, void * param, System::Error error)
 {
     SecureSessionMgr * mgr = reinterpret_cast<SecureSessionMgr *>(param);
+
+    mgr->mExpiryTimerArmed = false;
 #if CHIP_CONFIG_SESSION_REKEYING
     // TODO(#2279): session expiration is currently disabled until rekeying is supported
     // the #ifdef should be removed after that.
     mgr->mPeerConnections.ExpireInactiveConnections(
         CHIP_PEER_CONNECTION_TIMEOUT_MS,
-        [this](const Transport::PeerConnectionState & state1) { HandleConnectionExpired(state1); });
+        [mgr](const Transport::PeerConnectionState & state1) { mgr->HandleConnectionExpired(state1); });
 #endif
-    mgr->ScheduleExpiryTimer(); // re-schedule the oneshot timer
+    mgr->ScheduleExpiryTimer(); // for the next session to expire
+}
+
+CHIP_ERROR SecureSessionMgr::RestoreSession(uint16_t localKeyId)
+{
+    VerifyOrReturnError(mPeerConnections.FindPeerConnectionState(localKeyId, nullptr) == nullptr, CHIP_NO_ERROR);
+    VerifyOrReturnError(mRestoreDelegate != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    ReturnErrorOnFailure(mRestoreDelegate->RestoreSession(localKeyId, *this));
+    VerifyOrReturnError(mPeerConnections.FindPeerConnectionState(localKeyId, nullptr) != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    return CHIP_NO_ERROR;
 }
 
 PeerConnectionState * SecureSessionMgr::GetPeerConnectionState(SecureSessionHandle session)
@@ -514,4 +870,23 @@ PeerConnectionState * SecureSessionMgr::GetPeerConnectionState(SecureSessionHand
     return mPeerConnections.FindPeerConnectionState(Optional<NodeId>::Value(session.mPeerNodeId), session.mPeerKeyId, nullptr);
 }
 
+uint16_t SecureSessionMgr::GetMaxAppMessageLength(SecureSessionHandle session)
+{
+    PeerConnectionState * state = GetPeerConnectionState(session);
+    return (state != nullptr) ? state->GetMaxAppMessageLength() : static_cast<uint16_t>(kMaxAppMessageLen);
+}
+
+void SecureSessionMgr::HandlePacketTooBig(const Transport::PeerAddress & peerAddress, uint16_t mtu)
+{
+    PeerConnectionState * state = nullptr;
+
+    while ((state = mPeerConnections.FindPeerConnectionState(peerAddress, state)) != nullptr)
+    {
+        state->ReducePathMtu(mtu);
+        ChipLogProgress(Inet, "Path MTU of peer 0x%08" PRIx32 "%08" PRIx32 " is %" PRIu16,
+                        static_cast<uint32_t>(state->GetPeerNodeId() >> 32), static_cast<uint32_t>(state->GetPeerNodeId()),
+                        state->GetPathMtu());
+    }
+}
+
 } // namespace chip
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <string.h>
 #include <utility>
 
 #include <core/CHIPCore.h>
@@ -36,6 +37,7 @@
 #include <transport/PairingSession.h>
 #include <transport/PeerConnections.h>
 #include <transport/SecureSession.h>
+#include <transport/TrafficClass.h>
 #include <transport/TransportMgr.h>
 #include <transport/raw/Base.h>
 #include <transport/raw/PeerAddress.h>
@@ -158,6 +160,23 @@ public:
                                    System::PacketBufferHandle msgBuf, SecureSessionMgr * mgr)
     {}
 
+    /**
+     * @brief
+     *   Called when a message is received again, with the counter of a message received before. The duplicate is not
+     *   to be processed, only acknowledged if the peer asked for it, since it retransmits the messages it got no
+     *   acknowledgement for.
+     *
+     * @param packetHeader  The message header
+     * @param payloadHeader The payload header
+     * @param session       The handle to the secure session
+     * @param source        The sender's address
+     * @param mgr           A pointer to the SecureSessionMgr
+     */
+    virtual void OnDuplicateMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                            SecureSessionHandle session, const Transport::PeerAddress & source,
+                                            SecureSessionMgr * mgr)
+    {}
+
     /**
      * @brief
      *   Called when received message processing resulted in error
@@ -205,6 +224,29 @@ public:
     virtual ~SecureSessionMgrDelegate() {}
 };
 
+/**
+ * @brief
+ *   Restores a secure session kept in persistent storage the first time a message comes for its key, so that the
+ *   sessions of a node need not all be loaded when it starts, nor kept while they are idle.
+ */
+class DLL_EXPORT SecureSessionRestoreDelegate
+{
+public:
+    /**
+     * @brief
+     *   Called when a message is received with a key that no secure session has.
+     *
+     * @param localKeyId  The local key id the message is encrypted with
+     * @param mgr         The SecureSessionMgr to add the session to, with NewPairing()
+     *
+     * @retval #CHIP_ERROR_KEY_NOT_FOUND If no session is stored for the key.
+     * @retval #CHIP_NO_ERROR If the session of the key was added.
+     */
+    virtual CHIP_ERROR RestoreSession(uint16_t localKeyId, SecureSessionMgr & mgr) = 0;
+
+    virtual ~SecureSessionRestoreDelegate() {}
+};
+
 class DLL_EXPORT SecureSessionMgr : public TransportMgrDelegate
 {
 public:
@@ -228,14 +270,44 @@ public:
      *   msgBuf contains the data to be transmitted.  If bufferRetainSlot is not null and this function
      *   returns success, the encrypted data that was sent, as well as various other information needed
      *   to retransmit it, will be stored in *bufferRetainSlot.
+     *
+     *   trafficClass is what the message is scheduled by, while it waits in the send queue.
      */
     CHIP_ERROR SendMessage(SecureSessionHandle session, PayloadHeader & payloadHeader, System::PacketBufferHandle && msgBuf,
-                           EncryptedPacketBufferHandle * bufferRetainSlot = nullptr);
+                           EncryptedPacketBufferHandle * bufferRetainSlot = nullptr,
+                           Transport::TrafficClass trafficClass     = Transport::TrafficClass::kInteractive);
     CHIP_ERROR SendEncryptedMessage(SecureSessionHandle session, EncryptedPacketBufferHandle msgBuf,
-                                    EncryptedPacketBufferHandle * bufferRetainSlot);
+                                    EncryptedPacketBufferHandle * bufferRetainSlot,
+                                    Transport::TrafficClass trafficClass = Transport::TrafficClass::kInteractive);
+
+#if CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+    /**
+     * @brief
+     *   Send the queued messages now, rather than at the end of the current event loop iteration.
+     */
+    void FlushSendQueue();
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
 
     Transport::PeerConnectionState * GetPeerConnectionState(SecureSessionHandle session);
 
+    /**
+     * @brief
+     *   The largest payload SendMessage() takes for the peer of a session, which depends on the path MTU to the peer.
+     *
+     * @return The largest payload, or kMaxAppMessageLen if the session is unknown.
+     */
+    uint16_t GetMaxAppMessageLength(SecureSessionHandle session);
+
+    /**
+     * @brief
+     *   Lower the path MTU of the sessions to a peer address, on a report from the network that a packet sent to it was
+     *   too big for its path (e.g. an ICMPv6 Packet Too Big message, which quotes the address the packet was sent to).
+     *
+     * @param peerAddress The address the packet was sent to
+     * @param mtu         The MTU of the path to the address
+     */
+    void HandlePacketTooBig(const Transport::PeerAddress & peerAddress, uint16_t mtu);
+
     /**
      * @brief
      *   Set the callback object.
@@ -245,6 +317,21 @@ public:
      */
     void SetDelegate(SecureSessionMgrDelegate * cb) { mCB = cb; }
 
+    /**
+     * @brief
+     *   Set the object restoring the stored sessions, or nullptr for messages with an unknown key to be dropped.
+     */
+    void SetRestoreDelegate(SecureSessionRestoreDelegate * delegate) { mRestoreDelegate = delegate; }
+
+    /**
+     * @brief
+     *   Restore the stored session of a local key before any message comes for it, for a message to be sent on it first.
+     *
+     * @retval #CHIP_ERROR_KEY_NOT_FOUND If no session is stored for the key, or there is no restore delegate.
+     * @retval #CHIP_NO_ERROR If the session of the key was restored, or was already there.
+     */
+    CHIP_ERROR RestoreSession(uint16_t localKeyId);
+
     /**
      * @brief
      *   Establish a new pairing with a peer node
@@ -257,6 +344,40 @@ public:
     CHIP_ERROR NewPairing(const Optional<Transport::PeerAddress> & peerAddr, NodeId peerNodeId, PairingSession * pairing,
                           PairingDirection direction, Transport::AdminId admin, Transport::Base * transport = nullptr);
 
+    /**
+     * @brief
+     *   Remove the session with a peer node, once it is no longer needed, for its state to be reused by a new pairing.
+     *
+     * @details
+     *   The delegate is told of the expiry of the session, as for an idle one, which closes its exchanges.
+     */
+    void ExpirePairing(SecureSessionHandle session);
+
+    /**
+     * @brief
+     *   Establish a session with the members of a group
+     *
+     * @details
+     *   The session is keyed by the group key, which every member of the group shares. A message sent on the
+     *   session is a single packet to the multicast address of the group, which every member receives. The
+     *   multicast group is joined, for the messages of the other members to be received as well.
+     *
+     * @param groupAddress    The multicast address of the group
+     * @param keyId           The id of the group key, which no other session may use
+     * @param groupKey        The group key
+     * @param groupKeyLength  The length of the group key
+     * @param admin           The admin the group belongs to
+     * @param session         Set to the handle of the session
+     */
+    CHIP_ERROR NewGroupSession(const Transport::PeerAddress & groupAddress, uint16_t keyId, const uint8_t * groupKey,
+                               size_t groupKeyLength, Transport::AdminId admin, SecureSessionHandle & session);
+
+    /**
+     * @brief
+     *   Close a session established by NewGroupSession, and leave its multicast group.
+     */
+    void RemoveGroupSession(SecureSessionHandle session);
+
     /**
      * @brief
      *   Return the System Layer pointer used by current SecureSessionMgr.
@@ -343,15 +464,53 @@ private:
     Transport::PeerConnections<CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE> mPeerConnections; // < Active connections to other peers
     State mState;                                                                       // < Initialization state of the object
 
-    SecureSessionMgrDelegate * mCB         = nullptr;
-    TransportMgrBase * mTransportMgr       = nullptr;
-    Transport::AdminPairingTable * mAdmins = nullptr;
+    SecureSessionMgrDelegate * mCB                  = nullptr;
+    SecureSessionRestoreDelegate * mRestoreDelegate = nullptr;
+    TransportMgrBase * mTransportMgr                = nullptr;
+    Transport::AdminPairingTable * mAdmins          = nullptr;
+    bool mExpiryTimerArmed                          = false;
 
     CHIP_ERROR SendMessage(SecureSessionHandle session, PayloadHeader & payloadHeader, PacketHeader & packetHeader,
                            System::PacketBufferHandle msgBuf, EncryptedPacketBufferHandle * bufferRetainSlot,
-                           EncryptionState encryptionState);
+                           EncryptionState encryptionState, Transport::TrafficClass trafficClass);
+
+    /** Hands an encrypted message to the transport of the peer connection. */
+    CHIP_ERROR SendToPeer(Transport::PeerConnectionState * state, System::PacketBufferHandle msgBuf);
+
+#if CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+    /**
+     * An encrypted message waiting for the end of the event loop iteration. The session is looked up again when the
+     * message is sent, in case it expired in the meantime.
+     */
+    struct QueuedMessage
+    {
+        SecureSessionHandle session;
+        System::PacketBufferHandle msgBuf;
+        uint32_t ackId;
+        uint16_t exchangeId;
+        bool initiator;
+        bool standaloneAck;
+        Transport::TrafficClass trafficClass;
+    };
 
-    /** Schedules a new oneshot timer for checking connection expiry. */
+    QueuedMessage mSendQueue[CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE];
+    uint16_t mSendQueueLength       = 0;
+    bool mSendQueueFlushScheduled = false;
+    // What each traffic class has left to send of its weight, in the current round of the scheduler.
+    uint8_t mSendCredits[Transport::kNumTrafficClasses] = {};
+
+    CHIP_ERROR QueueMessage(SecureSessionHandle session, const PayloadHeader & payloadHeader, System::PacketBufferHandle msgBuf,
+                            Transport::TrafficClass trafficClass);
+    /** The index of the queued message to send next, by the weighted priority of the traffic classes. */
+    uint16_t NextQueuedMessage();
+    void SendQueuedMessage(uint16_t index);
+    CHIP_ERROR ScheduleSendQueueFlush();
+    void RemoveQueuedMessage(uint16_t index);
+    void ClearSendQueue();
+    static void FlushSendQueueCallback(System::Layer * layer, void * param, System::Error error);
+#endif // CHIP_CONFIG_SECURE_SESSION_SEND_QUEUE_SIZE > 0
+
+    /** Arms the oneshot connection expiry timer for the next session to expire, unless it is armed already. */
     void ScheduleExpiryTimer();
 
     /** Cancels any active timers for connection expiry checks. */
@@ -411,6 +570,31 @@ inline System::PacketBufferHandle NewWithData(const void * aData, size_t aDataSi
     return System::PacketBufferHandle::NewWithData(aData, aDataSize, kMaxFooterSize);
 }
 
+/**
+ * Gathers the data of a chain of packet buffers, such as one written by a PacketBufferTLVWriter
+ * with chained buffers, into a single buffer of the size of the data with space for message
+ * headers and footers, as messages are encrypted in place.
+ *
+ *  @param[in]  aBuffer         The chain, which is released.
+ *
+ *  @return     On success, a PacketBufferHandle to the single buffer. On fail, \c nullptr.
+ */
+inline System::PacketBufferHandle Gather(System::PacketBufferHandle && aBuffer)
+{
+    System::PacketBufferHandle gathered = New(aBuffer->TotalLength());
+    if (gathered.IsNull())
+    {
+        return gathered;
+    }
+
+    for (System::PacketBufferHandle buffer = std::move(aBuffer); !buffer.IsNull(); buffer.Advance())
+    {
+        memcpy(gathered->Start() + gathered->DataLength(), buffer->Start(), buffer->DataLength());
+        gathered->SetDataLength(static_cast<uint16_t>(gathered->DataLength() + buffer->DataLength()));
+    }
+    return gathered;
+}
+
 /**
  * Check whether a packet buffer has enough space for a message footer.
  *
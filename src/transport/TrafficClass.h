@@ -0,0 +1,45 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   Defines the traffic classes the secure session manager schedules its queued messages by.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * The kind of traffic a message is part of. The queued messages are sent by weighted priority of their classes, for the
+ * interactive traffic not to wait behind a transfer or a burst of reports to the same peer.
+ */
+enum class TrafficClass : uint8_t
+{
+    kInteractive = 0, ///< Commands and writes, and their responses, which a user waits for.
+    kReporting   = 1, ///< Reports of reads and subscriptions.
+    kBulk        = 2, ///< Transfers of large data, such as the blocks of a BDX transfer.
+};
+
+constexpr size_t kNumTrafficClasses = 3;
+
+} // namespace Transport
+} // namespace chip
@@ -32,6 +32,11 @@ void TransportMgrBase::Disconnect(const Transport::PeerAddress & address)
     mTransport->Disconnect(address);
 }
 
+CHIP_ERROR TransportMgrBase::MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join)
+{
+    return mTransport->MulticastGroupJoinLeave(address, join);
+}
+
 CHIP_ERROR TransportMgrBase::Init(Transport::Base * transport)
 {
     if (mTransport != nullptr)
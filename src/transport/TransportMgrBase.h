@@ -41,6 +41,8 @@ public:
 
     void Disconnect(const Transport::PeerAddress & address);
 
+    CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join);
+
     void SetSecureSessionMgr(TransportMgrDelegate * secureSessionMgr) { mSecureSessionMgr = secureSessionMgr; }
 
     void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle msg) override;
@@ -77,6 +77,11 @@ public:
      */
     virtual void Disconnect(const PeerAddress & address) {}
 
+    /**
+     * Join, or leave, the multicast group of the specified address, for the messages sent to the group to be received.
+     */
+    virtual CHIP_ERROR MulticastGroupJoinLeave(const PeerAddress & address, bool join) { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
     /**
      * Close the open endpoint without destroying the object
      */
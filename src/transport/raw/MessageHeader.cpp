@@ -82,6 +82,14 @@ constexpr uint16_t kVersionMask = 0xF000;
 /// Shift to convert to/from a masked version 16bit value to a 4bit version.
 constexpr int kVersionShift = 12;
 
+/// Mask to extract the flags telling which node ids a 16bit header prefix is followed by.
+constexpr uint16_t kNodeIdFlagsMask = static_cast<uint16_t>(Header::FlagValues::kSourceNodeIdPresent) |
+    static_cast<uint16_t>(Header::FlagValues::kDestinationNodeIdPresent);
+
+/// Mask to extract the flags telling which optional fields an exchange header has.
+constexpr uint8_t kPayloadOptionalFieldsMask = static_cast<uint8_t>(Header::ExFlagValues::kExchangeFlag_VendorIdPresent) |
+    static_cast<uint8_t>(Header::ExFlagValues::kExchangeFlag_AckMsg);
+
 /// Mask to extract just the encryption type part from a 16bit header prefix.
 constexpr uint16_t kEncryptionTypeMask = 0xF0;
 /// Shift to convert to/from a masked encryption type 16bit value to a 4bit encryption type.
@@ -147,29 +155,36 @@ uint16_t MessageAuthenticationCode::TagLenForEncryptionType(Header::EncryptionTy
 
 CHIP_ERROR PacketHeader::Decode(const uint8_t * const data, uint16_t size, uint16_t * decode_len)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    LittleEndian::Reader reader(data, size);
-    int version;
-    uint16_t octets_read;
+    const uint8_t * p = data;
+
+    VerifyOrReturnError(size >= kFixedUnencryptedHeaderSizeBytes, CHIP_ERROR_BUFFER_TOO_SMALL);
 
-    uint16_t header;
-    err = reader.Read16(&header).StatusCode();
-    SuccessOrExit(err);
-    version = ((header & kVersionMask) >> kVersionShift);
-    VerifyOrExit(version == kHeaderVersion, err = CHIP_ERROR_VERSION_MISMATCH);
+    const uint16_t header = LittleEndian::Read16(p);
+    VerifyOrReturnError(((header & kVersionMask) >> kVersionShift) == kHeaderVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    // The node id flags select one of four layouts, so the whole header is bounds checked once and then read at fixed offsets.
+    uint16_t headerSize;
+    switch (header & kNodeIdFlagsMask)
+    {
+    case 0:
+        headerSize = kFixedUnencryptedHeaderSizeBytes;
+        break;
+    case kNodeIdFlagsMask:
+        headerSize = kFixedUnencryptedHeaderSizeBytes + 2 * kNodeIdSizeBytes;
+        break;
+    default:
+        headerSize = kFixedUnencryptedHeaderSizeBytes + kNodeIdSizeBytes;
+        break;
+    }
+    VerifyOrReturnError(size >= headerSize, CHIP_ERROR_BUFFER_TOO_SMALL);
 
     mEncryptionType = static_cast<Header::EncryptionType>((header & kEncryptionTypeMask) >> kEncryptionTypeShift);
     mFlags.SetRaw(header & Header::kFlagsMask);
-
-    err = reader.Read32(&mMessageId).StatusCode();
-    SuccessOrExit(err);
+    mMessageId = LittleEndian::Read32(p);
 
     if (mFlags.Has(Header::FlagValues::kSourceNodeIdPresent))
     {
-        uint64_t sourceNodeId;
-        err = reader.Read64(&sourceNodeId).StatusCode();
-        SuccessOrExit(err);
-        mSourceNodeId.SetValue(sourceNodeId);
+        mSourceNodeId.SetValue(LittleEndian::Read64(p));
     }
     else
     {
@@ -178,26 +193,17 @@ CHIP_ERROR PacketHeader::Decode(const uint8_t * const data, uint16_t size, uint1
 
     if (mFlags.Has(Header::FlagValues::kDestinationNodeIdPresent))
     {
-        uint64_t destinationNodeId;
-        err = reader.Read64(&destinationNodeId).StatusCode();
-        SuccessOrExit(err);
-        mDestinationNodeId.SetValue(destinationNodeId);
+        mDestinationNodeId.SetValue(LittleEndian::Read64(p));
     }
     else
     {
         mDestinationNodeId.ClearValue();
     }
 
-    err = reader.Read16(&mEncryptionKeyID).StatusCode();
-    SuccessOrExit(err);
-
-    octets_read = reader.OctetsRead();
-    VerifyOrExit(octets_read == EncodeSizeBytes(), err = CHIP_ERROR_INTERNAL);
-    *decode_len = octets_read;
+    mEncryptionKeyID = LittleEndian::Read16(p);
 
-exit:
-
-    return err;
+    *decode_len = headerSize;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR PacketHeader::DecodeAndConsume(const System::PacketBufferHandle & buf)
@@ -210,54 +216,52 @@ CHIP_ERROR PacketHeader::DecodeAndConsume(const System::PacketBufferHandle & buf
 
 CHIP_ERROR PayloadHeader::Decode(const uint8_t * const data, uint16_t size, uint16_t * decode_len)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    LittleEndian::Reader reader(data, size);
-    uint8_t header;
-    uint16_t octets_read;
+    const uint8_t * p = data;
 
-    err = reader.Read8(&header).Read8(&mMessageType).Read16(&mExchangeID).StatusCode();
-    SuccessOrExit(err);
+    VerifyOrReturnError(size >= kEncryptedHeaderSizeBytes, CHIP_ERROR_BUFFER_TOO_SMALL);
 
-    mExchangeFlags.SetRaw(header);
+    const uint8_t header = Read8(p);
 
-    VendorId vendor_id;
-    if (HaveVendorId())
-    {
-        uint16_t vendor_id_raw;
-        err = reader.Read16(&vendor_id_raw).StatusCode();
-        SuccessOrExit(err);
-        vendor_id = static_cast<VendorId>(vendor_id_raw);
-    }
-    else
+    // As for the packet header, the vendor id and ack flags give the size of the whole header before any of it is read.
+    uint16_t headerSize = kEncryptedHeaderSizeBytes;
+    switch (header & kPayloadOptionalFieldsMask)
     {
-        vendor_id = VendorId::Common;
+    case 0:
+        break;
+    case static_cast<uint8_t>(Header::ExFlagValues::kExchangeFlag_VendorIdPresent):
+        headerSize += kVendorIdSizeBytes;
+        break;
+    case static_cast<uint8_t>(Header::ExFlagValues::kExchangeFlag_AckMsg):
+        headerSize += kAckIdSizeBytes;
+        break;
+    default:
+        headerSize += kVendorIdSizeBytes + kAckIdSizeBytes;
+        break;
     }
+    VerifyOrReturnError(size >= headerSize, CHIP_ERROR_BUFFER_TOO_SMALL);
 
-    uint16_t protocol_id;
-    err = reader.Read16(&protocol_id).StatusCode();
-    SuccessOrExit(err);
+    mExchangeFlags.SetRaw(header);
+    mMessageType = Read8(p);
+    mExchangeID  = LittleEndian::Read16(p);
 
-    mProtocolID = Protocols::Id(vendor_id, protocol_id);
+    VendorId vendor_id = VendorId::Common;
+    if (HaveVendorId())
+    {
+        vendor_id = static_cast<VendorId>(LittleEndian::Read16(p));
+    }
+    mProtocolID = Protocols::Id(vendor_id, LittleEndian::Read16(p));
 
     if (mExchangeFlags.Has(Header::ExFlagValues::kExchangeFlag_AckMsg))
     {
-        uint32_t ack_id;
-        err = reader.Read32(&ack_id).StatusCode();
-        SuccessOrExit(err);
-        mAckId.SetValue(ack_id);
+        mAckId.SetValue(LittleEndian::Read32(p));
     }
     else
     {
         mAckId.ClearValue();
     }
 
-    octets_read = reader.OctetsRead();
-    VerifyOrExit(octets_read == EncodeSizeBytes(), err = CHIP_ERROR_INTERNAL);
-    *decode_len = octets_read;
-
-exit:
-
-    return err;
+    *decode_len = headerSize;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR PayloadHeader::DecodeAndConsume(const System::PacketBufferHandle & buf)
@@ -23,11 +23,15 @@
 
 #pragma once
 
-#include <stdio.h>
+#include <functional>
+#include <stdint.h>
+#include <string.h>
 
 #include <core/CHIPConfig.h>
 #include <inet/IPAddress.h>
 #include <inet/InetInterface.h>
+#include <support/BufferWriter.h>
+#include <support/CodeUtils.h>
 
 namespace chip {
 namespace Transport {
@@ -109,6 +113,39 @@ public:
 
     bool operator!=(const PeerAddress & other) const { return !(*this == other); }
 
+    /// An ordering over the fields compared by operator==, for keeping peer addresses sorted.
+    bool operator<(const PeerAddress & other) const
+    {
+        if (mTransportType != other.mTransportType)
+        {
+            return mTransportType < other.mTransportType;
+        }
+
+        const int addrOrder = memcmp(mIPAddress.Addr, other.mIPAddress.Addr, sizeof(mIPAddress.Addr));
+        if (addrOrder != 0)
+        {
+            return addrOrder < 0;
+        }
+
+        if (mPort != other.mPort)
+        {
+            return mPort < other.mPort;
+        }
+
+        return std::less<Inet::InterfaceId>()(mInterface, other.mInterface);
+    }
+
+    /// A hash of the fields compared by operator==, for keying the lookup of the sessions and connections of a peer.
+    uint32_t Hash() const
+    {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        hash          = HashBytes(hash, &mTransportType, sizeof(mTransportType));
+        hash          = HashBytes(hash, mIPAddress.Addr, sizeof(mIPAddress.Addr));
+        hash          = HashBytes(hash, &mPort, sizeof(mPort));
+        return HashBytes(hash, &mInterface, sizeof(mInterface));
+    }
+
     /// Maximum size of an Inet address ToString format, that can hold both IPV6 and IPV4 addresses.
 #ifdef INET6_ADDRSTRLEN
     static constexpr size_t kInetMaxAddrLen = INET6_ADDRSTRLEN;
@@ -132,29 +169,34 @@ public:
 
     void ToString(char * buf, size_t bufSize) const
     {
-        char ip_addr[kInetMaxAddrLen];
+        VerifyOrReturn(buf != nullptr && bufSize > 0);
+
+        // One byte is kept back for the NUL termination.
+        Encoding::BufferWriter writer(reinterpret_cast<uint8_t *>(buf), bufSize - 1);
+        size_t written;
 
         switch (mTransportType)
         {
         case Type::kUndefined:
-            snprintf(buf, bufSize, "UNDEFINED");
+            writer.Put("UNDEFINED");
             break;
         case Type::kUdp:
-            mIPAddress.ToString(ip_addr);
-            snprintf(buf, bufSize, "UDP:%s:%d", ip_addr, mPort);
+            PutInetAddress(writer, "UDP:");
             break;
         case Type::kTcp:
-            mIPAddress.ToString(ip_addr);
-            snprintf(buf, bufSize, "TCP:%s:%d", ip_addr, mPort);
+            PutInetAddress(writer, "TCP:");
             break;
         case Type::kBle:
             // Note that BLE does not currently use any specific address.
-            snprintf(buf, bufSize, "BLE");
+            writer.Put("BLE");
             break;
         default:
-            snprintf(buf, bufSize, "ERROR");
+            writer.Put("ERROR");
             break;
         }
+
+        writer.Fit(written);
+        buf[written] = '\0';
     }
 
     /****** Factory methods for convenience ******/
@@ -172,6 +214,43 @@ public:
     static PeerAddress TCP(const Inet::IPAddress & addr, uint16_t port) { return TCP(addr).SetPort(port); }
 
 private:
+    static uint32_t HashBytes(uint32_t hash, const void * data, size_t size)
+    {
+        const uint8_t * bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    // Writes "<prefix><ip>:<port>" straight into the buffer of the writer, which is followed by one byte kept back.
+    void PutInetAddress(Encoding::BufferWriter & writer, const char * prefix) const
+    {
+        char digits[5];
+        size_t count  = 0;
+        uint16_t port = mPort;
+
+        writer.Put(prefix);
+        VerifyOrReturn(writer.Available() > 0);
+
+        char * ipAddr = reinterpret_cast<char *>(writer.Buffer()) + writer.Needed();
+        VerifyOrReturn(mIPAddress.ToString(ipAddr, static_cast<uint32_t>(writer.Available() + 1)) != nullptr);
+        writer.Skip(strlen(ipAddr));
+
+        do
+        {
+            digits[count++] = static_cast<char>('0' + port % 10);
+            port            = static_cast<uint16_t>(port / 10);
+        } while (port != 0);
+
+        writer.Put(':');
+        while (count > 0)
+        {
+            writer.Put(static_cast<uint8_t>(digits[--count]));
+        }
+    }
+
     Inet::IPAddress mIPAddress;
     Type mTransportType;
     uint16_t mPort               = CHIP_PORT; ///< Relevant for UDP data sending.
@@ -103,6 +103,8 @@ CHIP_ERROR TCPBase::Init(TcpListenParameters & params)
     mListenSocket->OnConnectionReceived = OnConnectionReceived;
     mListenSocket->OnAcceptError        = OnAcceptError;
     mEndpointType                       = params.GetAddressType();
+    mKeepAliveInterval                  = params.GetKeepAliveInterval();
+    mKeepAliveTimeoutCount              = params.GetKeepAliveTimeoutCount();
 
     mState = State::kInitialized;
 
@@ -139,15 +141,10 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const PeerAddress
 
     for (size_t i = 0; i < mActiveConnectionsSize; i++)
     {
-        if (!mActiveConnections[i].InUse())
-        {
-            continue;
-        }
-        Inet::IPAddress addr;
-        uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
+        const PeerAddress & peerAddress = mActiveConnections[i].mPeerAddress;
 
-        if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
+        if (mActiveConnections[i].InUse() && (peerAddress.GetPort() == address.GetPort()) &&
+            (peerAddress.GetIPAddress() == address.GetIPAddress()))
         {
             return &mActiveConnections[i];
         }
@@ -168,6 +165,55 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEn
     return nullptr;
 }
 
+TCPBase::ActiveConnectionState * TCPBase::StoreConnection(Inet::TCPEndPoint * endPoint, const PeerAddress & addr)
+{
+    ActiveConnectionState * state = nullptr;
+
+    for (size_t i = 0; i < mActiveConnectionsSize && state == nullptr; i++)
+    {
+        if (!mActiveConnections[i].InUse())
+        {
+            state = &mActiveConnections[i];
+        }
+    }
+    VerifyOrReturnError(state != nullptr, nullptr);
+
+    state->Init(endPoint, addr);
+
+    if (mKeepAliveInterval > 0)
+    {
+        INET_ERROR err = endPoint->EnableKeepAlive(mKeepAliveInterval, mKeepAliveTimeoutCount);
+        if (err != INET_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to enable TCP keep-alive: %s", ErrorStr(err));
+        }
+    }
+
+    return state;
+}
+
+bool TCPBase::CloseLeastRecentlyUsedConnection()
+{
+    ActiveConnectionState * oldest = nullptr;
+
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        ActiveConnectionState & state = mActiveConnections[i];
+
+        if (state.InUse() && state.IsIdle() && (oldest == nullptr || state.mLastUsedMs < oldest->mLastUsedMs))
+        {
+            oldest = &state;
+        }
+    }
+
+    VerifyOrReturnError(oldest != nullptr, false);
+
+    ChipLogProgress(Inet, "Closing least recently used connection to make room");
+    oldest->Free();
+    mUsedEndPointCount--;
+    return true;
+}
+
 CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle msgBuf)
 {
     // Sent buffer data format is:
@@ -193,6 +239,7 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
+        connection->mLastUsedMs = System::Layer::GetClock_MonotonicLoopMS();
         return connection->mEndPoint->Send(std::move(msgBuf));
     }
     else
@@ -209,9 +256,8 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     bool alreadyConnecting       = false;
     Inet::TCPEndPoint * endPoint = nullptr;
 
-    // Iterate through the ENTIRE array. If a pending packet for
-    // the address already exists, this means a connection is pending and
-    // does NOT need to be re-established.
+    // If packets for the address are already pending, a connection is pending and
+    // does NOT need to be re-established: the packet is queued after them.
     for (size_t i = 0; i < mPendingPacketsSize; i++)
     {
         if (mPendingPackets[i].packetBuffer.IsNull())
@@ -224,26 +270,22 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
         }
         else if (mPendingPackets[i].peerAddress == addr)
         {
-            // same destination exists.
+            packet            = mPendingPackets + i;
             alreadyConnecting = true;
-
-            // ensure packets are ORDERED
-            if (packet != nullptr)
-            {
-                packet->peerAddress  = addr;
-                packet->packetBuffer = std::move(mPendingPackets[i].packetBuffer);
-                packet               = mPendingPackets + i;
-            }
+            break;
         }
     }
 
     VerifyOrExit(packet != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
-    // If already connecting, buffer was just enqueued for more sending
-    VerifyOrExit(!alreadyConnecting, err = CHIP_NO_ERROR);
+    if (alreadyConnecting)
+    {
+        packet->packetBuffer->AddToEnd(std::move(msg));
+        ExitNow();
+    }
 
-    // Ensures sufficient active connections size exist
-    VerifyOrExit(mUsedEndPointCount < mActiveConnectionsSize, err = CHIP_ERROR_NO_MEMORY);
+    // Ensures sufficient active connections size exist, closing an idle connection if needed
+    VerifyOrExit(mUsedEndPointCount < mActiveConnectionsSize || CloseLeastRecentlyUsedConnection(), err = CHIP_ERROR_NO_MEMORY);
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     err = mListenSocket->Layer().NewTCPEndPoint(&endPoint);
@@ -284,52 +326,85 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
 {
     ActiveConnectionState * state = FindActiveConnection(endPoint);
     VerifyOrReturnError(state != nullptr, CHIP_ERROR_INTERNAL);
-    state->mReceived.AddToEnd(std::move(buffer));
+    state->mLastUsedMs = System::Layer::GetClock_MonotonicLoopMS();
+
+    System::PacketBufferHandle received = std::move(buffer);
 
-    while (!state->mReceived.IsNull())
+    while (!received.IsNull())
     {
         uint8_t messageSizeBuf[kPacketSizeBytes];
-        CHIP_ERROR err = state->mReceived->Read(messageSizeBuf);
+        CHIP_ERROR err = received->Read(messageSizeBuf);
         if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
         {
             // We don't have enough data to read the message size. Wait until there's more.
-            return CHIP_NO_ERROR;
+            return PutBackPartialMessage(endPoint, std::move(received), kPacketSizeBytes);
         }
         else if (err != CHIP_NO_ERROR)
         {
             return err;
         }
         uint16_t messageSize = LittleEndian::Get16(messageSizeBuf);
-        if (messageSize >= kMaxMessageSize)
+        if (messageSize > kMaxMessageSize)
         {
-            // This message is too long for upper layers.
+            // This message is too long for upper layers. One of exactly kMaxMessageSize still fits in a single packet buffer,
+            // which is how peers send the largest messages, such as BDX Blocks using the whole buffer.
             return CHIP_ERROR_MESSAGE_TOO_LONG;
         }
         // The subtraction will not underflow because we successfully read kPacketSizeBytes.
-        if (messageSize > (state->mReceived->TotalLength() - kPacketSizeBytes))
+        if (messageSize > (received->TotalLength() - kPacketSizeBytes))
         {
             // We have not yet received the complete message.
-            return CHIP_NO_ERROR;
+            return PutBackPartialMessage(endPoint, std::move(received), kPacketSizeBytes + messageSize);
         }
-        state->mReceived.Consume(kPacketSizeBytes);
-        ReturnErrorOnFailure(ProcessSingleMessage(peerAddress, state, messageSize));
+        received.Consume(kPacketSizeBytes);
+        ReturnErrorOnFailure(ProcessSingleMessage(peerAddress, received, messageSize));
+    }
+
+    // Everything was consumed, receive whatever comes next.
+    endPoint->SetReceiveCredit(Inet::TCPEndPoint::kUnlimitedReceiveCredit);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TCPBase::PutBackPartialMessage(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle received, size_t frameLength)
+{
+    // Unless the message may fit where it starts, move it to a buffer that holds the largest message, and where the
+    // endpoint receives the rest of it. This costs a copy of the start of the message, instead of one of the whole
+    // message once received in a chain.
+    if (received->HasChainedBuffer() || received->AllocSize() < frameLength)
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        const uint16_t length = received->TotalLength();
+        ReturnErrorOnFailure(received->Read(buffer->Start(), length));
+        buffer->SetDataLength(length);
+        received = std::move(buffer);
+    }
+    else
+    {
+        received->CompactHead();
     }
 
+    const uint32_t credit = static_cast<uint32_t>(frameLength - received->DataLength());
+    ReturnErrorOnFailure(endPoint->PutBackReceivedData(std::move(received)));
+    endPoint->SetReceiveCredit(credit);
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, ActiveConnectionState * state, uint16_t messageSize)
+CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, System::PacketBufferHandle & received,
+                                         uint16_t messageSize)
 {
-    // We enter with `state->mReceived` containing at least one full message, perhaps in a chain.
-    // `state->mReceived->Start()` currently points to the message data.
-    // On exit, `state->mReceived` will have had `messageSize` bytes consumed, no matter what.
+    // We enter with `received` containing at least one full message, perhaps in a chain.
+    // `received->Start()` currently points to the message data.
+    // On exit, `received` will have had `messageSize` bytes consumed, no matter what.
     System::PacketBufferHandle message;
-    if (state->mReceived->DataLength() == messageSize)
+    if (received->DataLength() == messageSize)
     {
         // In this case, the head packet buffer contains exactly the message.
-        // This is common because typical messages fit in a network packet, and are delivered as such.
-        // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
-        message = state->mReceived.PopHead();
+        // This is common because typical messages fit in a network packet, and are delivered as such,
+        // and because the rest of a message partially received is received into the buffer holding its start.
+        // Peel off the head to pass upstream, which effectively consumes it from `received`.
+        message = received.PopHead();
     }
     else
     {
@@ -342,8 +417,8 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
         {
             return CHIP_ERROR_NO_MEMORY;
         }
-        CHIP_ERROR err = state->mReceived->Read(message->Start(), messageSize);
-        state->mReceived.Consume(messageSize);
+        CHIP_ERROR err = received->Read(message->Start(), messageSize);
+        received.Consume(messageSize);
         ReturnErrorOnFailure(err);
         message->SetDataLength(messageSize);
     }
@@ -383,7 +458,7 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, INET_ERROR inet
     endPoint->GetPeerInfo(&ipAddress, &port);
     PeerAddress addr = PeerAddress::TCP(ipAddress, port);
 
-    // Send any pending packets
+    // Send the pending packets, all queued in a single entry
     for (size_t i = 0; i < tcp->mPendingPacketsSize; i++)
     {
         if ((tcp->mPendingPackets[i].peerAddress != addr) || (tcp->mPendingPackets[i].packetBuffer.IsNull()))
@@ -395,10 +470,11 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, INET_ERROR inet
         System::PacketBufferHandle buffer   = std::move(tcp->mPendingPackets[i].packetBuffer);
         tcp->mPendingPackets[i].peerAddress = PeerAddress::Uninitialized();
 
-        if ((inetErr == CHIP_NO_ERROR) && (err == CHIP_NO_ERROR))
+        if (inetErr == CHIP_NO_ERROR)
         {
             err = endPoint->Send(std::move(buffer));
         }
+        break;
     }
 
     if (err == CHIP_NO_ERROR)
@@ -421,26 +497,13 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, INET_ERROR inet
         endPoint->Free();
         tcp->mUsedEndPointCount--;
     }
-    else
+    else if (tcp->StoreConnection(endPoint, addr) == nullptr)
     {
-        bool connectionStored = false;
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                connectionStored = true;
-                break;
-            }
-        }
-
         // since we track end points counts, we always expect to store the
         // connection.
-        if (!connectionStored)
-        {
-            endPoint->Free();
-            ChipLogError(Inet, "Internal logic error: insufficient space to store active connection");
-        }
+        endPoint->Free();
+        tcp->mUsedEndPointCount--;
+        ChipLogError(Inet, "Internal logic error: insufficient space to store active connection");
     }
 }
 
@@ -466,17 +529,11 @@ void TCPBase::OnConnectionReceived(Inet::TCPEndPoint * listenEndPoint, Inet::TCP
 {
     TCPBase * tcp = reinterpret_cast<TCPBase *>(listenEndPoint->AppState);
 
-    if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize)
+    // have space to use one more (even if considering pending connections), possibly after closing an idle one
+    if ((tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize || tcp->CloseLeastRecentlyUsedConnection()) &&
+        (tcp->StoreConnection(endPoint, PeerAddress::TCP(peerAddress, peerPort)) != nullptr))
     {
-        // have space to use one more (even if considering pending connections)
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                break;
-            }
-        }
+        tcp->mUsedEndPointCount++;
 
         endPoint->AppState             = listenEndPoint->AppState;
         endPoint->OnDataReceived       = OnTcpReceive;
@@ -503,20 +560,13 @@ void TCPBase::Disconnect(const PeerAddress & address)
     // Closes an existing connection
     for (size_t i = 0; i < mActiveConnectionsSize; i++)
     {
-        if (mActiveConnections[i].InUse())
+        if (mActiveConnections[i].InUse() && (address == mActiveConnections[i].mPeerAddress))
         {
-            Inet::IPAddress ipAddress;
-            uint16_t port;
-
-            mActiveConnections[i].mEndPoint->GetPeerInfo(&ipAddress, &port);
-            if (address == PeerAddress::TCP(ipAddress, port))
-            {
-                // NOTE: this leaves the socket in TIME_WAIT.
-                // Calling Abort() would clean it since SO_LINGER would be set to 0,
-                // however this seems not to be useful.
-                mActiveConnections[i].Free();
-                mUsedEndPointCount--;
-            }
+            // NOTE: this leaves the socket in TIME_WAIT.
+            // Calling Abort() would clean it since SO_LINGER would be set to 0,
+            // however this seems not to be useful.
+            mActiveConnections[i].Free();
+            mUsedEndPointCount--;
         }
     }
 }
@@ -34,6 +34,7 @@
 #include <inet/InetInterface.h>
 #include <inet/TCPEndPoint.h>
 #include <support/CodeUtils.h>
+#include <system/SystemLayer.h>
 #include <transport/raw/Base.h>
 
 namespace chip {
@@ -73,19 +74,37 @@ public:
         return *this;
     }
 
+    uint16_t GetKeepAliveInterval() const { return mKeepAliveInterval; }
+    uint16_t GetKeepAliveTimeoutCount() const { return mKeepAliveTimeoutCount; }
+
+    /**
+     * Send TCP keep-alive probes every interval seconds on idle connections, giving up on a connection after timeoutCount
+     * unanswered probes. An interval of 0 (the default) leaves keep-alive disabled.
+     */
+    TcpListenParameters & SetKeepAlive(uint16_t interval, uint16_t timeoutCount)
+    {
+        mKeepAliveInterval     = interval;
+        mKeepAliveTimeoutCount = timeoutCount;
+
+        return *this;
+    }
+
 private:
     Inet::InetLayer * mLayer         = nullptr;                   ///< Associated inet layer
     Inet::IPAddressType mAddressType = Inet::kIPAddressType_IPv6; ///< type of listening socket
     uint16_t mListenPort             = CHIP_PORT;                 ///< TCP listen port
     Inet::InterfaceId mInterfaceId   = INET_NULL_INTERFACEID;     ///< Interface to listen on
+    uint16_t mKeepAliveInterval      = 0;                         ///< Seconds between keep-alive probes, 0 for none
+    uint16_t mKeepAliveTimeoutCount  = 0;                         ///< Unanswered probes closing a connection
 };
 
 /**
- * Packets scheduled for sending once a connection has been established.
+ * Packets scheduled for sending once a connection has been established. All the packets for a peer are queued in the same
+ * entry, chained in the order they are to be sent.
  */
 struct PendingPacket
 {
-    PeerAddress peerAddress;                 // where the packet is being sent to
+    PeerAddress peerAddress;                 // where the packets are being sent to
     System::PacketBufferHandle packetBuffer; // what data needs to be sent
 };
 
@@ -107,25 +126,32 @@ protected:
      */
     struct ActiveConnectionState
     {
-        void Init(Inet::TCPEndPoint * endPoint)
+        void Init(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress = PeerAddress::Uninitialized())
         {
-            mEndPoint = endPoint;
-            mReceived = nullptr;
+            mEndPoint    = endPoint;
+            mPeerAddress = peerAddress;
+            mLastUsedMs  = System::Layer::GetClock_MonotonicLoopMS();
         }
 
         void Free()
         {
             mEndPoint->Free();
             mEndPoint = nullptr;
-            mReceived = nullptr;
         }
         bool InUse() const { return mEndPoint != nullptr; }
 
+        // A connection can be closed to make room for another when no message is partially received or still being sent.
+        // The start of a message partially received is put back into the endpoint.
+        bool IsIdle() const { return (mEndPoint->PendingReceiveLength() == 0) && (mEndPoint->PendingSendLength() == 0); }
+
         // Associated endpoint.
         Inet::TCPEndPoint * mEndPoint;
 
-        // Buffers received but not yet consumed.
-        System::PacketBufferHandle mReceived;
+        // Address of the peer, kept to find connections without querying their endpoint.
+        PeerAddress mPeerAddress;
+
+        // Time a message was last sent or received on the connection.
+        uint64_t mLastUsedMs;
     };
 
 public:
@@ -195,6 +221,20 @@ private:
     ActiveConnectionState * FindActiveConnection(const PeerAddress & addr);
     ActiveConnectionState * FindActiveConnection(const Inet::TCPEndPoint * endPoint);
 
+    /**
+     * Store a new connection in a free slot, enabling keep-alive on it if configured.
+     *
+     * @return the stored connection, or nullptr if there is no free slot.
+     */
+    ActiveConnectionState * StoreConnection(Inet::TCPEndPoint * endPoint, const PeerAddress & addr);
+
+    /**
+     * Close the least recently used idle connection to make room for another.
+     *
+     * @return whether a connection was closed.
+     */
+    bool CloseLeastRecentlyUsedConnection();
+
     /**
      * Sends the specified message once a connection has been established.
      *
@@ -214,7 +254,9 @@ private:
      * @param buffer the actual data
      *
      * Ownership of buffer is taken over and will be freed (or re-enqueued to the endPoint receive queue)
-     * as needed during processing.
+     * as needed during processing. The start of an incomplete message is put back into the endpoint, in a buffer
+     * large enough for the whole message, and the endpoint is given the credit to receive exactly the rest of it,
+     * so that the message is received in place and passed up without being copied.
      */
     CHIP_ERROR ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress,
                                      System::PacketBufferHandle buffer);
@@ -223,12 +265,21 @@ private:
      * Process a single message of the specified size from a buffer.
      *
      * @param[in]     peerAddress   The peer the data is coming from.
-     * @param[in,out] state         The connection state, which contains the message. On entry, the payload points to the message
+     * @param[in,out] received      The data received, which contains the message. On entry, the payload points to the message
      *                              body (after the length). On exit, it points after the message (or the queue is null, if there
      *                              is no other data).
      * @param[in]     messageSize   Size of the single message.
      */
-    CHIP_ERROR ProcessSingleMessage(const PeerAddress & peerAddress, ActiveConnectionState * state, uint16_t messageSize);
+    CHIP_ERROR ProcessSingleMessage(const PeerAddress & peerAddress, System::PacketBufferHandle & received, uint16_t messageSize);
+
+    /**
+     * Put the start of an incomplete message back into its endpoint, to receive the rest of it after.
+     *
+     * @param[in]     endPoint      The endpoint the data comes from.
+     * @param[in]     received      The start of the message and of its length prefix.
+     * @param[in]     frameLength   Length of the message and its prefix, or of the prefix alone if that is incomplete.
+     */
+    static CHIP_ERROR PutBackPartialMessage(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle received, size_t frameLength);
 
     // Callback handler for TCPEndPoint. TCP message receive handler.
     // @see TCPEndpoint::OnDataReceivedFunct
@@ -258,6 +309,8 @@ private:
     Inet::TCPEndPoint * mListenSocket = nullptr;                                     ///< TCP socket used by the transport
     Inet::IPAddressType mEndpointType = Inet::IPAddressType::kIPAddressType_Unknown; ///< Socket listening type
     State mState                      = State::kNotReady;                            ///< State of the TCP transport
+    uint16_t mKeepAliveInterval       = 0;                                           ///< Seconds between keep-alive probes
+    uint16_t mKeepAliveTimeoutCount   = 0;                                           ///< Unanswered probes closing a connection
 
     // Number of active and 'pending connection' endpoints
     size_t mUsedEndPointCount = 0;
@@ -266,7 +319,7 @@ private:
     ActiveConnectionState * mActiveConnections;
     const size_t mActiveConnectionsSize;
 
-    // Data to be sent when connections succeed
+    // Data to be sent when connections succeed, one entry per peer being connected to
     PendingPacket * mPendingPackets;
     const size_t mPendingPacketsSize;
 };
@@ -90,6 +90,11 @@ public:
 
     void Disconnect(const PeerAddress & address) override { return DisconnectImpl<0>(address); }
 
+    CHIP_ERROR MulticastGroupJoinLeave(const PeerAddress & address, bool join) override
+    {
+        return MulticastGroupJoinLeaveImpl<0>(address, join);
+    }
+
     void Close() override { return CloseImpl<0>(); }
 
     /**
@@ -173,6 +178,33 @@ private:
     void CloseImpl()
     {}
 
+    /**
+     * Recursive multicast group join/leave implementation iterating through transport members.
+     *
+     * The group is joined, or left, through the first transport from index N or above, which returns 'CanSendToPeer'
+     *
+     * @tparam N the index of the underlying transport to join, or leave, the group through.
+     */
+    template <size_t N, typename std::enable_if<(N < sizeof...(TransportTypes))>::type * = nullptr>
+    CHIP_ERROR MulticastGroupJoinLeaveImpl(const PeerAddress & address, bool join)
+    {
+        Base * base = &std::get<N>(mTransports);
+        if (base->CanSendToPeer(address))
+        {
+            return base->MulticastGroupJoinLeave(address, join);
+        }
+        return MulticastGroupJoinLeaveImpl<N + 1>(address, join);
+    }
+
+    /**
+     * MulticastGroupJoinLeaveImpl when N is out of range. Always returns an error code.
+     */
+    template <size_t N, typename std::enable_if<(N >= sizeof...(TransportTypes))>::type * = nullptr>
+    CHIP_ERROR MulticastGroupJoinLeaveImpl(const PeerAddress & address, bool join)
+    {
+        return CHIP_ERROR_NO_MESSAGE_HANDLER;
+    }
+
     /**
      * Recursive sendmessage implementation iterating through transport members.
      *
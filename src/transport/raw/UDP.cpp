@@ -101,6 +101,54 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
 }
 
+CHIP_ERROR UDP::SendMessages(const Transport::PeerAddress * addresses, const System::PacketBufferHandle * msgBufs, size_t count,
+                             size_t & sentCount)
+{
+    sentCount = 0;
+
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mUDPEndPoint != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    while (sentCount < count)
+    {
+        Inet::IPPacketInfo addrInfo[INET_CONFIG_UDP_BATCH_SIZE];
+        size_t batchCount = 0;
+        size_t batchSent  = 0;
+
+        for (; batchCount < INET_CONFIG_UDP_BATCH_SIZE && sentCount + batchCount < count; batchCount++)
+        {
+            const Transport::PeerAddress & address = addresses[sentCount + batchCount];
+
+            VerifyOrReturnError(address.GetTransportType() == Type::kUdp, CHIP_ERROR_INVALID_ARGUMENT);
+
+            addrInfo[batchCount].Clear();
+            addrInfo[batchCount].DestAddress = address.GetIPAddress();
+            addrInfo[batchCount].DestPort    = address.GetPort();
+            addrInfo[batchCount].Interface   = address.GetInterface();
+        }
+
+        CHIP_ERROR err = mUDPEndPoint->SendMsgs(addrInfo, &msgBufs[sentCount], batchCount, batchSent);
+        sentCount += batchSent;
+        ReturnErrorOnFailure(err);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDP::MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join)
+{
+    VerifyOrReturnError(address.GetTransportType() == Type::kUdp, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(address.GetIPAddress().IsMulticast(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mUDPEndPoint != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (join)
+    {
+        return mUDPEndPoint->JoinMulticastGroup(address.GetInterface(), address.GetIPAddress());
+    }
+    return mUDPEndPoint->LeaveMulticastGroup(address.GetInterface(), address.GetIPAddress());
+}
+
 void UDP::OnUdpReceive(Inet::IPEndPointBasis * endPoint, System::PacketBufferHandle buffer, const Inet::IPPacketInfo * pktInfo)
 {
     CHIP_ERROR err          = CHIP_NO_ERROR;
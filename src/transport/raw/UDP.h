@@ -112,6 +112,19 @@ public:
 
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle msgBuf) override;
 
+    /**
+     * Send several messages, e.g. the fan-out of a group command, with as few system calls as the endpoint allows.
+     *
+     * @param[in]  addresses  Destination of each message.
+     * @param[in]  msgBufs    The messages. They remain owned by the caller.
+     * @param[in]  count      Number of messages.
+     * @param[out] sentCount  Number of messages, from the start, that were sent.
+     */
+    CHIP_ERROR SendMessages(const Transport::PeerAddress * addresses, const System::PacketBufferHandle * msgBufs, size_t count,
+                            size_t & sentCount);
+
+    CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join) override;
+
     bool CanSendToPeer(const Transport::PeerAddress & address) override
     {
         return (mState == State::kInitialized) && (address.GetTransportType() == Type::kUdp) &&
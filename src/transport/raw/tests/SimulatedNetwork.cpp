@@ -0,0 +1,226 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "SimulatedNetwork.h"
+
+#include <support/CodeUtils.h>
+
+#include <utility>
+
+namespace chip {
+namespace Test {
+
+CHIP_ERROR SimulatedNetwork::Init(System::Layer * systemLayer, const SimulatedLinkParams & params, uint32_t seed)
+{
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.mLossPermille <= 1000, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mSystemLayer = systemLayer;
+    mParams      = params;
+    mStats       = SimulatedNetworkStats();
+    // The generator never leaves 0
+    mRandomState = (seed != 0) ? seed : 1;
+    return CHIP_NO_ERROR;
+}
+
+void SimulatedNetwork::Shutdown()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleDeliveryTimer, this);
+    }
+    mInFlight.clear();
+
+    for (SimulatedTransport * transport : mNodes)
+    {
+        if (transport != nullptr)
+        {
+            transport->mNetwork = nullptr;
+        }
+    }
+    mNodes.clear();
+    mSystemLayer = nullptr;
+}
+
+Transport::PeerAddress SimulatedNetwork::GetAddress(size_t node)
+{
+    return Transport::PeerAddress::UDP(Inet::IPAddress::MakeULA(kGlobalId, 0, static_cast<uint64_t>(node) + 1), CHIP_PORT);
+}
+
+CHIP_ERROR SimulatedNetwork::Attach(SimulatedTransport * transport, size_t & node)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    node = mNodes.size();
+    mNodes.push_back(transport);
+    return CHIP_NO_ERROR;
+}
+
+void SimulatedNetwork::Detach(size_t node)
+{
+    // The nodes keep their index, for the addresses of the others not to change
+    if (node < mNodes.size())
+    {
+        mNodes[node] = nullptr;
+    }
+}
+
+SimulatedTransport * SimulatedNetwork::FindNode(const Transport::PeerAddress & address) const
+{
+    const Inet::IPAddress & ipAddress = address.GetIPAddress();
+
+    VerifyOrReturnError(address.GetTransportType() == Transport::Type::kUdp && address.GetPort() == CHIP_PORT, nullptr);
+    VerifyOrReturnError(ipAddress.IsIPv6ULA() && ipAddress.GlobalId() == kGlobalId, nullptr);
+
+    uint64_t interfaceId = ipAddress.InterfaceId();
+    VerifyOrReturnError(interfaceId >= 1 && interfaceId <= mNodes.size(), nullptr);
+    return mNodes[static_cast<size_t>(interfaceId - 1)];
+}
+
+CHIP_ERROR SimulatedNetwork::Send(SimulatedTransport * sender, const Transport::PeerAddress & destination,
+                                  System::PacketBufferHandle && msgBuf)
+{
+    SimulatedTransport * receiver = FindNode(destination);
+
+    if (receiver == nullptr)
+    {
+        mStats.mUnreachable++;
+        return CHIP_ERROR_NOT_CONNECTED;
+    }
+
+    const uint64_t nowUs  = System::Layer::GetClock_MonotonicHiRes();
+    const uint64_t length = msgBuf->DataLength();
+
+    mStats.mSent++;
+    mStats.mBytesSent += length;
+
+    // The message is on the link until the node is done sending it, after those it sent before, lost or not
+    uint64_t sentUs = (sender->mBusyUntilUs > nowUs) ? sender->mBusyUntilUs : nowUs;
+    if (mParams.mBandwidthBytesPerSecond != 0)
+    {
+        sentUs += length * 1000000 / mParams.mBandwidthBytesPerSecond;
+    }
+    sender->mBusyUntilUs = sentUs;
+
+    if (mParams.mLossPermille != 0 && (GetRandom() % 1000) < mParams.mLossPermille)
+    {
+        mStats.mLost++;
+        return CHIP_NO_ERROR;
+    }
+
+    uint64_t deliveryUs = sentUs + static_cast<uint64_t>(mParams.mLatencyMs) * 1000;
+    if (mParams.mJitterMs != 0)
+    {
+        deliveryUs += GetRandom() % (static_cast<uint64_t>(mParams.mJitterMs) * 1000 + 1);
+    }
+
+    // The sender may keep the buffer for retransmission, while the receiver decrypts it in place: pass a copy, as a network would
+    System::PacketBufferHandle copy = msgBuf.CloneData();
+    VerifyOrReturnError(!copy.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    auto message = mInFlight.emplace(deliveryUs, Message{ receiver->mNode, sender->mAddress, std::move(copy) });
+    if (message == mInFlight.begin())
+    {
+        ScheduleDelivery();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void SimulatedNetwork::ScheduleDelivery()
+{
+    VerifyOrReturn(!mInFlight.empty());
+
+    const uint64_t nowUs      = System::Layer::GetClock_MonotonicHiRes();
+    const uint64_t deliveryUs = mInFlight.begin()->first;
+    // Timers have a resolution of a millisecond: wake up at, or just after, the delivery of the next message
+    uint64_t delayMs = (deliveryUs > nowUs) ? (deliveryUs - nowUs + 999) / 1000 : 0;
+
+    if (delayMs > UINT32_MAX)
+    {
+        delayMs = UINT32_MAX;
+    }
+    mSystemLayer->StartTimer(static_cast<uint32_t>(delayMs), HandleDeliveryTimer, this);
+}
+
+void SimulatedNetwork::HandleDeliveryTimer(System::Layer * systemLayer, void * appState, System::Error error)
+{
+    SimulatedNetwork * network = static_cast<SimulatedNetwork *>(appState);
+    const uint64_t nowUs       = System::Layer::GetClock_MonotonicHiRes();
+
+    // Deliver the messages that are due, then wait for the next one
+    while (!network->mInFlight.empty() && network->mInFlight.begin()->first <= nowUs)
+    {
+        auto next       = network->mInFlight.begin();
+        Message message = std::move(next->second);
+        network->mInFlight.erase(next);
+
+        SimulatedTransport * receiver = network->mNodes[message.mReceiver];
+        if (receiver == nullptr)
+        {
+            network->mStats.mUnreachable++;
+            continue;
+        }
+
+        network->mStats.mDelivered++;
+        receiver->HandleMessageReceived(message.mSource, std::move(message.mBuffer));
+
+        // A receiver may have shut the network down
+        VerifyOrReturn(network->mSystemLayer != nullptr);
+    }
+
+    network->ScheduleDelivery();
+}
+
+uint32_t SimulatedNetwork::GetRandom()
+{
+    // xorshift32, which is plenty for drawing losses and jitter
+    mRandomState ^= mRandomState << 13;
+    mRandomState ^= mRandomState >> 17;
+    mRandomState ^= mRandomState << 5;
+    return mRandomState;
+}
+
+CHIP_ERROR SimulatedTransport::Init(SimulatedNetwork * network)
+{
+    VerifyOrReturnError(network != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Close();
+    ReturnErrorOnFailure(network->Attach(this, mNode));
+    mNetwork     = network;
+    mAddress     = SimulatedNetwork::GetAddress(mNode);
+    mBusyUntilUs = 0;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SimulatedTransport::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle msgBuf)
+{
+    VerifyOrReturnError(mNetwork != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    return mNetwork->Send(this, address, std::move(msgBuf));
+}
+
+void SimulatedTransport::Close()
+{
+    if (mNetwork != nullptr)
+    {
+        mNetwork->Detach(mNode);
+        mNetwork = nullptr;
+    }
+}
+
+} // namespace Test
+} // namespace chip
@@ -0,0 +1,168 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an in-memory network, connecting any number of
+ *      simulated transports in one process, which delivers the messages
+ *      they send from the system layer timers after the latency, loss and
+ *      bandwidth of a link model.
+ */
+
+#pragma once
+
+#include <core/CHIPError.h>
+#include <system/SystemLayer.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/raw/Base.h>
+#include <transport/raw/PeerAddress.h>
+
+#include <map>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace chip {
+namespace Test {
+
+/**
+ * The model of the link between any two nodes of a simulated network.
+ */
+struct SimulatedLinkParams
+{
+    /// The time a message takes to reach its receiver, once it is sent.
+    uint32_t mLatencyMs = 0;
+    /// A random delay of up to this many milliseconds added to the latency of each message, which reorders them.
+    uint32_t mJitterMs = 0;
+    /// The share of the messages lost, in thousandths.
+    uint16_t mLossPermille = 0;
+    /// The rate at which each node sends, the messages it sends faster waiting for the previous ones, or 0 for no limit.
+    uint32_t mBandwidthBytesPerSecond = 0;
+};
+
+struct SimulatedNetworkStats
+{
+    uint64_t mSent        = 0;
+    uint64_t mBytesSent   = 0;
+    uint64_t mDelivered   = 0;
+    uint64_t mLost        = 0;
+    uint64_t mUnreachable = 0;
+};
+
+class SimulatedTransport;
+
+/**
+ * Connects the simulated transports attached to it. Each transport gets an address of its own, of which the messages it sends
+ * are received, and the messages sent are delivered from a timer of the system layer, never from within the sending call, as
+ * they would be from a socket. The losses and jitter are drawn from a generator of the given seed, for runs to repeat.
+ */
+class SimulatedNetwork
+{
+public:
+    CHIP_ERROR Init(System::Layer * systemLayer, const SimulatedLinkParams & params = SimulatedLinkParams(), uint32_t seed = 1);
+
+    /**
+     * Drop the messages in flight. The transports attached are detached, and their messages are no longer delivered.
+     */
+    void Shutdown();
+
+    void SetLinkParams(const SimulatedLinkParams & params) { mParams = params; }
+    const SimulatedLinkParams & GetLinkParams() const { return mParams; }
+    const SimulatedNetworkStats & GetStats() const { return mStats; }
+    size_t GetInFlightCount() const { return mInFlight.size(); }
+    size_t GetNodeCount() const { return mNodes.size(); }
+
+    /**
+     * The address of the node-th transport attached, a unique local IPv6 address of its own.
+     */
+    static Transport::PeerAddress GetAddress(size_t node);
+
+    /**
+     * Whether a transport attached, and not detached since, has the address.
+     */
+    bool IsReachable(const Transport::PeerAddress & address) const { return FindNode(address) != nullptr; }
+
+private:
+    friend class SimulatedTransport;
+
+    // The 40-bit global id of the unique local addresses of the nodes, whose interface ids are their indices plus one
+    static constexpr uint64_t kGlobalId = 0xC419F1EE7;
+
+    struct Message
+    {
+        size_t mReceiver;
+        Transport::PeerAddress mSource;
+        System::PacketBufferHandle mBuffer;
+    };
+
+    CHIP_ERROR Attach(SimulatedTransport * transport, size_t & node);
+    void Detach(size_t node);
+    CHIP_ERROR Send(SimulatedTransport * sender, const Transport::PeerAddress & destination, System::PacketBufferHandle && msgBuf);
+
+    SimulatedTransport * FindNode(const Transport::PeerAddress & address) const;
+    void ScheduleDelivery();
+    uint32_t GetRandom();
+
+    static void HandleDeliveryTimer(System::Layer * systemLayer, void * appState, System::Error error);
+
+    System::Layer * mSystemLayer = nullptr;
+    SimulatedLinkParams mParams;
+    SimulatedNetworkStats mStats;
+    uint32_t mRandomState = 1;
+    std::vector<SimulatedTransport *> mNodes;
+    // The messages in flight, by the monotonic time in microseconds at which they are delivered: those delivered at the same
+    // time are kept in the order they were sent.
+    std::multimap<uint64_t, Message> mInFlight;
+};
+
+/**
+ * A transport of a simulated network, which can send to the address of any other transport attached to the network.
+ */
+class SimulatedTransport : public Transport::Base
+{
+public:
+    ~SimulatedTransport() override { Close(); }
+
+    /// Transports are required to have a constructor that takes exactly one argument
+    CHIP_ERROR Init(SimulatedNetwork * network);
+
+    CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle msgBuf) override;
+
+    bool CanSendToPeer(const Transport::PeerAddress & address) override
+    {
+        return mNetwork != nullptr && mNetwork->IsReachable(address);
+    }
+
+    /**
+     * Detach the transport from its network, which no longer delivers the messages sent to it.
+     */
+    void Close() override;
+
+    const Transport::PeerAddress & GetAddress() const { return mAddress; }
+
+private:
+    friend class SimulatedNetwork;
+
+    SimulatedNetwork * mNetwork = nullptr;
+    size_t mNode                = 0;
+    Transport::PeerAddress mAddress;
+    // When the transport is done sending the messages it sent, at the bandwidth of the link.
+    uint64_t mBusyUntilUs = 0;
+};
+
+} // namespace Test
+} // namespace chip
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements unit tests for the formatting, hashing and
+ *      ordering of PeerAddress.
+ *
+ */
+#include <inet/IPAddress.h>
+#include <support/UnitTestRegistration.h>
+#include <transport/raw/PeerAddress.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+
+Inet::IPAddress MakeAddress(const char * text)
+{
+    Inet::IPAddress addr;
+    Inet::IPAddress::FromString(text, addr);
+    return addr;
+}
+
+void TestToString(nlTestSuite * inSuite, void * inContext)
+{
+    char buf[PeerAddress::kMaxToStringSize];
+
+    PeerAddress::UDP(MakeAddress("fe80::1"), 5540).ToString(buf);
+    NL_TEST_ASSERT(inSuite, strcmp(buf, "UDP:fe80::1:5540") == 0);
+
+    PeerAddress::TCP(MakeAddress("192.168.1.10"), 0).ToString(buf);
+    NL_TEST_ASSERT(inSuite, strcmp(buf, "TCP:192.168.1.10:0") == 0);
+
+    PeerAddress::UDP(MakeAddress("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"), 65535).ToString(buf);
+    NL_TEST_ASSERT(inSuite, strcmp(buf, "UDP:ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff:65535") == 0);
+
+    PeerAddress::BLE().ToString(buf);
+    NL_TEST_ASSERT(inSuite, strcmp(buf, "BLE") == 0);
+
+    PeerAddress::Uninitialized().ToString(buf);
+    NL_TEST_ASSERT(inSuite, strcmp(buf, "UNDEFINED") == 0);
+}
+
+void TestToStringTruncates(nlTestSuite * inSuite, void * inContext)
+{
+    const PeerAddress address = PeerAddress::UDP(MakeAddress("fe80::1"), 5540);
+    const char * expected     = "UDP:fe80::1:5540";
+
+    for (size_t size = 1; size <= strlen(expected); size++)
+    {
+        char buf[32];
+
+        memset(buf, 'x', sizeof(buf));
+        address.ToString(buf, size);
+
+        // Always terminated within the buffer, and never anything but text its full form starts with.
+        NL_TEST_ASSERT(inSuite, memchr(buf, '\0', size) != nullptr);
+        NL_TEST_ASSERT(inSuite, strncmp(buf, expected, strlen(buf)) == 0);
+        NL_TEST_ASSERT(inSuite, buf[size] == 'x');
+    }
+}
+
+void TestHashAndOrdering(nlTestSuite * inSuite, void * inContext)
+{
+    const Inet::IPAddress addr = MakeAddress("fd00::1");
+    const PeerAddress a        = PeerAddress::UDP(addr, 5540);
+    const PeerAddress b        = PeerAddress::UDP(addr, 5541);
+    const PeerAddress c        = PeerAddress::TCP(addr, 5540);
+
+    NL_TEST_ASSERT(inSuite, a.Hash() == PeerAddress::UDP(addr, 5540).Hash());
+    NL_TEST_ASSERT(inSuite, a.Hash() != b.Hash());
+    NL_TEST_ASSERT(inSuite, a.Hash() != c.Hash());
+
+    NL_TEST_ASSERT(inSuite, !(a < a));
+    NL_TEST_ASSERT(inSuite, (a < b) != (b < a));
+    NL_TEST_ASSERT(inSuite, (a < c) != (c < a));
+    NL_TEST_ASSERT(inSuite, !(a < PeerAddress::UDP(addr, 5540)) && !(PeerAddress::UDP(addr, 5540) < a));
+}
+
+} // namespace
+
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("ToString", TestToString),
+    NL_TEST_DEF("ToStringTruncates", TestToStringTruncates),
+    NL_TEST_DEF("HashAndOrdering", TestHashAndOrdering),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestPeerAddress(void)
+{
+    nlTestSuite theSuite = { "Transport-PeerAddress", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPeerAddress)
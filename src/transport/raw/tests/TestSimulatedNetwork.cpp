@@ -0,0 +1,245 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the SimulatedNetwork and its
+ *      SimulatedTransport.
+ */
+
+#include "NetworkTestHelpers.h"
+#include "SimulatedNetwork.h"
+
+#include <core/CHIPCore.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <nlbyteorder.h>
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Test;
+
+static int Initialize(void * aContext);
+static int Finalize(void * aContext);
+
+namespace {
+
+using TestContext = chip::Test::IOContext;
+TestContext sContext;
+
+const char PAYLOAD[] = "Hello!";
+
+class CountingReceiver : public Transport::RawTransportDelegate
+{
+public:
+    void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle msg) override
+    {
+        mLastSource = peerAddress;
+        mLastLength = msg->DataLength();
+        mLastUs     = System::Layer::GetClock_MonotonicHiRes();
+        mCount++;
+    }
+
+    Transport::PeerAddress mLastSource;
+    size_t mLastLength = 0;
+    uint64_t mLastUs   = 0;
+    int mCount         = 0;
+};
+
+System::PacketBufferHandle NewPayload()
+{
+    return System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+}
+
+void CheckDelivery(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    SimulatedNetwork network;
+    SimulatedTransport sender;
+    SimulatedTransport receiver;
+    CountingReceiver delegate;
+
+    NL_TEST_ASSERT(inSuite, network.Init(&ctx.GetSystemLayer()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sender.Init(&network) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver.Init(&network) == CHIP_NO_ERROR);
+    receiver.SetDelegate(&delegate);
+
+    NL_TEST_ASSERT(inSuite, network.GetNodeCount() == 2);
+    NL_TEST_ASSERT(inSuite, sender.GetAddress() == SimulatedNetwork::GetAddress(0));
+    NL_TEST_ASSERT(inSuite, receiver.GetAddress() == SimulatedNetwork::GetAddress(1));
+    NL_TEST_ASSERT(inSuite, sender.CanSendToPeer(receiver.GetAddress()));
+    NL_TEST_ASSERT(inSuite, !sender.CanSendToPeer(SimulatedNetwork::GetAddress(2)));
+
+    // Messages are never delivered from within the sending call
+    NL_TEST_ASSERT(inSuite, sender.SendMessage(receiver.GetAddress(), NewPayload()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, delegate.mCount == 0);
+    NL_TEST_ASSERT(inSuite, network.GetInFlightCount() == 1);
+
+    ctx.DriveIOUntil(1000, [&delegate] { return delegate.mCount > 0; });
+    NL_TEST_ASSERT(inSuite, delegate.mCount == 1);
+    NL_TEST_ASSERT(inSuite, delegate.mLastSource == sender.GetAddress());
+    NL_TEST_ASSERT(inSuite, delegate.mLastLength == sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, network.GetStats().mSent == 1);
+    NL_TEST_ASSERT(inSuite, network.GetStats().mDelivered == 1);
+    NL_TEST_ASSERT(inSuite, network.GetStats().mBytesSent == sizeof(PAYLOAD));
+
+    NL_TEST_ASSERT(inSuite, sender.SendMessage(SimulatedNetwork::GetAddress(2), NewPayload()) == CHIP_ERROR_NOT_CONNECTED);
+    NL_TEST_ASSERT(inSuite, network.GetStats().mUnreachable == 1);
+
+    // A message sent to a transport that is closed on the way is dropped
+    NL_TEST_ASSERT(inSuite, sender.SendMessage(receiver.GetAddress(), NewPayload()) == CHIP_NO_ERROR);
+    receiver.Close();
+    NL_TEST_ASSERT(inSuite, !sender.CanSendToPeer(receiver.GetAddress()));
+    ctx.DriveIOUntil(1000, [&network] { return network.GetInFlightCount() == 0; });
+    NL_TEST_ASSERT(inSuite, delegate.mCount == 1);
+    NL_TEST_ASSERT(inSuite, network.GetStats().mUnreachable == 2);
+
+    network.Shutdown();
+    NL_TEST_ASSERT(inSuite, sender.SendMessage(receiver.GetAddress(), NewPayload()) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void CheckLatencyAndBandwidth(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    SimulatedNetwork network;
+    SimulatedTransport sender;
+    SimulatedTransport receiver;
+    CountingReceiver delegate;
+    SimulatedLinkParams params;
+
+    // Each message takes 20 ms to send at this rate, on top of the latency
+    params.mLatencyMs               = 30;
+    params.mBandwidthBytesPerSecond = sizeof(PAYLOAD) * 50;
+
+    NL_TEST_ASSERT(inSuite, network.Init(&ctx.GetSystemLayer(), params) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sender.Init(&network) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver.Init(&network) == CHIP_NO_ERROR);
+    receiver.SetDelegate(&delegate);
+
+    const uint64_t startUs = System::Layer::GetClock_MonotonicHiRes();
+    NL_TEST_ASSERT(inSuite, sender.SendMessage(receiver.GetAddress(), NewPayload()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sender.SendMessage(receiver.GetAddress(), NewPayload()) == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(1000, [&delegate] { return delegate.mCount > 0; });
+    NL_TEST_ASSERT(inSuite, delegate.mCount == 1);
+    NL_TEST_ASSERT(inSuite, delegate.mLastUs - startUs >= 50 * 1000);
+
+    // The second message waited for the first to be sent
+    ctx.DriveIOUntil(1000, [&delegate] { return delegate.mCount > 1; });
+    NL_TEST_ASSERT(inSuite, delegate.mCount == 2);
+    NL_TEST_ASSERT(inSuite, delegate.mLastUs - startUs >= 70 * 1000);
+
+    network.Shutdown();
+}
+
+void CheckLoss(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    SimulatedNetwork network;
+    SimulatedTransport sender;
+    SimulatedTransport receiver;
+    CountingReceiver delegate;
+    SimulatedLinkParams params;
+
+    params.mLossPermille = 1000;
+    NL_TEST_ASSERT(inSuite, network.Init(&ctx.GetSystemLayer(), params) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sender.Init(&network) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver.Init(&network) == CHIP_NO_ERROR);
+    receiver.SetDelegate(&delegate);
+
+    // A lost message was still sent, as far as its sender knows
+    NL_TEST_ASSERT(inSuite, sender.SendMessage(receiver.GetAddress(), NewPayload()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, network.GetInFlightCount() == 0);
+    NL_TEST_ASSERT(inSuite, network.GetStats().mLost == 1);
+
+    // Half of the messages are lost, the same ones for the same seed
+    params.mLossPermille = 500;
+    network.SetLinkParams(params);
+    for (int i = 0; i < 200; i++)
+    {
+        NL_TEST_ASSERT(inSuite, sender.SendMessage(receiver.GetAddress(), NewPayload()) == CHIP_NO_ERROR);
+    }
+    ctx.DriveIOUntil(1000, [&network] { return network.GetInFlightCount() == 0; });
+    NL_TEST_ASSERT(inSuite, network.GetStats().mDelivered == static_cast<uint64_t>(delegate.mCount));
+    NL_TEST_ASSERT(inSuite, network.GetStats().mLost + network.GetStats().mDelivered == 201);
+    NL_TEST_ASSERT(inSuite, delegate.mCount > 50 && delegate.mCount < 150);
+
+    params.mLossPermille = 1001;
+    NL_TEST_ASSERT(inSuite, network.Init(&ctx.GetSystemLayer(), params) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    network.Shutdown();
+}
+
+// Test Suite
+
+/**
+ *  Test Suite that lists all the test functions.
+ */
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Delivery",              CheckDelivery),
+    NL_TEST_DEF("Latency and bandwidth", CheckLatencyAndBandwidth),
+    NL_TEST_DEF("Loss",                  CheckLoss),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "Test-CHIP-SimulatedNetwork",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+} // namespace
+
+/**
+ *  Initialize the test suite.
+ */
+static int Initialize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Init(&sSuite);
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+/**
+ *  Finalize the test suite.
+ */
+static int Finalize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Shutdown();
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestSimulatedNetwork()
+{
+    // Run test suit against one context
+    nlTestRunner(&sSuite, &sContext);
+
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSimulatedNetwork);
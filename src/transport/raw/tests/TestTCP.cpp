@@ -53,6 +53,7 @@ class TCPTest
 {
 public:
     static void CheckProcessReceivedBuffer(nlTestSuite * inSuite, void * inContext);
+    static void CheckLeastRecentlyUsedConnection(nlTestSuite * inSuite, void * inContext);
 };
 } // namespace Transport
 } // namespace chip
@@ -148,6 +149,33 @@ public:
         SetCallback(nullptr);
     }
 
+    void QueuedMessagesTest(TCPImpl & tcp, const IPAddress & addr, int count)
+    {
+        // Sent before the connection is established, the messages wait in a single pending entry.
+        for (int i = 0; i < count; i++)
+        {
+            chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            NL_TEST_ASSERT(mSuite, !buffer.IsNull());
+
+            PacketHeader header;
+            header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageId(kMessageId + i);
+
+            CHIP_ERROR err = header.EncodeBeforeData(buffer);
+            NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
+
+            err = tcp.SendMessage(Transport::PeerAddress::TCP(addr), std::move(buffer));
+            if (err == System::MapErrorPOSIX(EADDRNOTAVAIL))
+            {
+                printf("%s:%u: System does NOT support IPV6.\n", __FILE__, __LINE__);
+                return;
+            }
+            NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
+        }
+
+        mContext.DriveIOUntil(5000 /* ms */, [this, count]() { return mReceiveHandlerCallCount >= count; });
+        NL_TEST_ASSERT(mSuite, mReceiveHandlerCallCount == count);
+    }
+
     void FinalizeMessageTest(TCPImpl & tcp, const IPAddress & addr)
     {
         // Disconnect and wait for seeing peer close
@@ -217,6 +245,21 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+void CheckQueuedMessagesTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    // More messages than pending packet entries, all to the same peer
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+    gMockTransportMgrDelegate.QueuedMessagesTest(tcp, addr, static_cast<int>(kMaxTcpPendingPackets + 2));
+    gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
+}
+
 // Generates a packet buffer or a chain of packet buffers for a single message.
 struct TestData
 {
@@ -425,6 +468,27 @@ void chip::Transport::TCPTest::CheckProcessReceivedBuffer(nlTestSuite * inSuite,
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
     NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 2);
 
+    // Test the largest message that fits in a single packet buffer, split accross two.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    NL_TEST_ASSERT(inSuite,
+                   testData[0].Init((const uint16_t[]){ 151, static_cast<uint16_t>(System::PacketBuffer::kMaxSizeWithoutReserve - 151),
+                                                        0 }));
+    err = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(testData[0].mHandle));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 1);
+
+    // Test the start of a message, which is put back into the endpoint for the rest to be received after it.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    NL_TEST_ASSERT(inSuite, testData[0].Init((const uint16_t[]){ 161, 162, 0 }));
+    System::PacketBufferHandle start = testData[0].mHandle.PopHead();
+    err                              = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(start));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 0);
+    NL_TEST_ASSERT(inSuite, lEndPoint->PendingReceiveLength() == 161);
+    NL_TEST_ASSERT(inSuite, !state->IsIdle());
+    lEndPoint->SetReceivedDataForTesting(System::PacketBufferHandle());
+    lEndPoint->SetReceiveCredit(Inet::TCPEndPoint::kUnlimitedReceiveCredit);
+
     // Test a message that is too large to coalesce into a single packet buffer.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
     gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, &testData[1]);
@@ -438,6 +502,41 @@ void chip::Transport::TCPTest::CheckProcessReceivedBuffer(nlTestSuite * inSuite,
     gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
 }
 
+void chip::Transport::TCPTest::CheckLeastRecentlyUsedConnection(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // Sending to itself uses two connections, the outgoing one being reused by the second message.
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr);
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr);
+    NL_TEST_ASSERT(inSuite, tcp.mUsedEndPointCount == 2);
+
+    Transport::PeerAddress lPeerAddress    = Transport::PeerAddress::TCP(addr);
+    TCPBase::ActiveConnectionState * state = tcp.FindActiveConnection(lPeerAddress);
+    NL_TEST_ASSERT(inSuite, state != nullptr);
+    if (state == nullptr)
+    {
+        return;
+    }
+
+    // The outgoing connection is made the least recently used, and is the one closed to make room.
+    state->mLastUsedMs = 0;
+    NL_TEST_ASSERT(inSuite, tcp.CloseLeastRecentlyUsedConnection());
+    NL_TEST_ASSERT(inSuite, tcp.FindActiveConnection(lPeerAddress) == nullptr);
+    NL_TEST_ASSERT(inSuite, tcp.mUsedEndPointCount == 1);
+
+    gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
+    NL_TEST_ASSERT(inSuite, tcp.mUsedEndPointCount == 0);
+}
+
 // Test Suite
 /**
  *  Test Suite that lists all the test functions.
@@ -453,6 +552,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Init Test IPV6",        CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",       CheckMessageTest6),
     NL_TEST_DEF("ProcessReceivedBuffer Test",   chip::Transport::TCPTest::CheckProcessReceivedBuffer),
+    NL_TEST_DEF("Queued Messages Test",         CheckQueuedMessagesTest),
+    NL_TEST_DEF("Least Recently Used Test",     chip::Transport::TCPTest::CheckLeastRecentlyUsedConnection),
 
     NL_TEST_SENTINEL()
 };
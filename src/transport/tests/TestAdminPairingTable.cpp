@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the lookups of the
+ *      AdminPairingTable class within the transport layer
+ *
+ */
+#include <support/UnitTestRegistration.h>
+#include <transport/AdminPairingTable.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+
+constexpr FabricId kFabric1 = 0x1111;
+constexpr FabricId kFabric2 = 0x2222;
+constexpr NodeId kNode1     = 0x0101;
+constexpr NodeId kNode2     = 0x0202;
+
+void TestFindAdminWithId(nlTestSuite * inSuite, void * inContext)
+{
+    AdminPairingTable table;
+
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(0) == nullptr);
+
+    AdminPairingInfo * admin0 = table.AssignAdminId(0, kNode1);
+    AdminPairingInfo * admin7 = table.AssignAdminId(7, kNode2);
+    NL_TEST_ASSERT(inSuite, admin0 != nullptr && admin7 != nullptr);
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(0) == admin0);
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(7) == admin7);
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(1) == nullptr);
+
+    // A released entry is reused for the next admin, and only found under its new ID.
+    table.ReleaseAdminId(0);
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(0) == nullptr);
+    AdminPairingInfo * admin3 = table.AssignAdminId(3);
+    NL_TEST_ASSERT(inSuite, admin3 == admin0);
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(3) == admin3);
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(0) == nullptr);
+
+    table.Reset();
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(3) == nullptr);
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(7) == nullptr);
+}
+
+void TestFindAdminForNode(nlTestSuite * inSuite, void * inContext)
+{
+    AdminPairingTable table;
+
+    AdminPairingInfo * admin0 = table.AssignAdminId(0, kNode1);
+    AdminPairingInfo * admin1 = table.AssignAdminId(1, kNode2);
+    NL_TEST_ASSERT(inSuite, admin0 != nullptr && admin1 != nullptr);
+
+    table.SetFabricId(admin0, kFabric1);
+    table.SetFabricId(admin1, kFabric1);
+    admin1->SetVendorId(0xFFF1);
+
+    // The first admin of the fabric matching the node and vendor IDs given is found.
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric1) == admin0);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric1, kNode2) == admin1);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric1, kUndefinedNodeId, 0xFFF1) == admin1);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric1, kNode1, 0xFFF1) == nullptr);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric2) == nullptr);
+
+    // Moving an admin to another fabric takes it out of the lookups of the former one.
+    table.SetFabricId(admin0, kFabric2);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric1) == admin1);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric2) == admin0);
+
+    table.ReleaseAdminId(1);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric1) == nullptr);
+    NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric2, kNode1) == admin0);
+}
+
+void TestFullTable(nlTestSuite * inSuite, void * inContext)
+{
+    AdminPairingTable table;
+
+    for (AdminId id = 0; id < CHIP_CONFIG_MAX_DEVICE_ADMINS; id++)
+    {
+        AdminPairingInfo * admin = table.AssignAdminId(static_cast<AdminId>(id * 3), static_cast<NodeId>(id));
+        NL_TEST_ASSERT(inSuite, admin != nullptr);
+        table.SetFabricId(admin, kFabric1 + id % 2);
+    }
+    NL_TEST_ASSERT(inSuite, table.AssignAdminId(1000) == nullptr);
+
+    for (AdminId id = 0; id < CHIP_CONFIG_MAX_DEVICE_ADMINS; id++)
+    {
+        AdminPairingInfo * admin = table.FindAdminWithId(static_cast<AdminId>(id * 3));
+        NL_TEST_ASSERT(inSuite, admin != nullptr && admin->GetNodeId() == id);
+        NL_TEST_ASSERT(inSuite, table.FindAdminForNode(kFabric1 + id % 2, static_cast<NodeId>(id)) == admin);
+    }
+    NL_TEST_ASSERT(inSuite, table.FindAdminWithId(1) == nullptr);
+}
+
+} // namespace
+
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("FindAdminWithId", TestFindAdminWithId),
+    NL_TEST_DEF("FindAdminForNode", TestFindAdminForNode),
+    NL_TEST_DEF("FullTable", TestFullTable),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestAdminPairingTable(void)
+{
+    nlTestSuite theSuite = { "Transport-AdminPairingTable", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAdminPairingTable)
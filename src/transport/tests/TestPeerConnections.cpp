@@ -116,15 +116,15 @@ void TestFindByNodeId(nlTestSuite * inSuite, void * inContext)
 
     err = connections.CreateNewPeerConnectionState(kPeer1Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer1NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer1NodeId);
 
     err = connections.CreateNewPeerConnectionState(kPeer2Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer2NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer2NodeId);
 
     err = connections.CreateNewPeerConnectionState(kPeer2Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer1NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer1NodeId);
 
     NL_TEST_ASSERT(inSuite, statePtr = connections.FindPeerConnectionState(kPeer1NodeId, nullptr));
     char buf[100];
@@ -214,7 +214,7 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(200);
     err = connections.CreateNewPeerConnectionState(kPeer2Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer2NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer2NodeId);
 
     // cannot add before expiry
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(300);
@@ -236,7 +236,7 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(300);
     err = connections.CreateNewPeerConnectionState(kPeer3Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer3NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer3NodeId);
 
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(400);
     NL_TEST_ASSERT(inSuite, statePtr = connections.FindPeerConnectionState(kPeer2NodeId, nullptr));
@@ -284,6 +284,234 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !connections.FindPeerConnectionState(kPeer3Addr, nullptr));
 }
 
+void TestExpireByActivity(nlTestSuite * inSuite, void * inContext)
+{
+    ExpiredCallInfo callInfo;
+    PeerConnectionState * peer1;
+    PeerConnectionState * peer2;
+    PeerConnectionState * pending;
+    PeerConnections<4, Time::Source::kTest> connections;
+    uint64_t expiryTimeMs = 0;
+
+    auto onExpired = [&callInfo](const PeerConnectionState & state) {
+        callInfo.callCount++;
+        callInfo.lastCallNodeId      = state.GetPeerNodeId();
+        callInfo.lastCallPeerAddress = state.GetPeerAddress();
+    };
+
+    NL_TEST_ASSERT(inSuite, !connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+
+    // A connection without an address, the least recently active one, never expires
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(100);
+    NL_TEST_ASSERT(inSuite,
+                   connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer3NodeId), 1, 2, &pending) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(200);
+    NL_TEST_ASSERT(inSuite, connections.CreateNewPeerConnectionState(kPeer1Addr, &peer1) == CHIP_NO_ERROR);
+    connections.SetPeerNodeId(peer1, kPeer1NodeId);
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(300);
+    NL_TEST_ASSERT(inSuite, connections.CreateNewPeerConnectionState(kPeer2Addr, &peer2) == CHIP_NO_ERROR);
+    connections.SetPeerNodeId(peer2, kPeer2NodeId);
+
+    // Peer 1, idle the longest, expires first
+    NL_TEST_ASSERT(inSuite, connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+    NL_TEST_ASSERT(inSuite, expiryTimeMs == 301);
+
+    // Until it is active again, which leaves peer 2 idle the longest
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(350);
+    connections.MarkConnectionActive(peer1);
+    NL_TEST_ASSERT(inSuite, connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+    NL_TEST_ASSERT(inSuite, expiryTimeMs == 401);
+
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(400);
+    connections.ExpireInactiveConnections(100, onExpired);
+    NL_TEST_ASSERT(inSuite, callInfo.callCount == 0);
+
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(401);
+    connections.ExpireInactiveConnections(100, onExpired);
+    NL_TEST_ASSERT(inSuite, callInfo.callCount == 1);
+    NL_TEST_ASSERT(inSuite, callInfo.lastCallNodeId == kPeer2NodeId);
+    NL_TEST_ASSERT(inSuite, connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+    NL_TEST_ASSERT(inSuite, expiryTimeMs == 451);
+
+    // The slot of peer 2 is reused by the most recently active connection
+    NL_TEST_ASSERT(inSuite, connections.CreateNewPeerConnectionState(kPeer3Addr, &peer2) == CHIP_NO_ERROR);
+
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(1000);
+    connections.ExpireInactiveConnections(100, onExpired);
+    NL_TEST_ASSERT(inSuite, callInfo.callCount == 3);
+    NL_TEST_ASSERT(inSuite, callInfo.lastCallPeerAddress == kPeer3Addr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer3NodeId, nullptr) == pending);
+    NL_TEST_ASSERT(inSuite, !connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+
+    // Once it has an address, it expires as well
+    pending->SetPeerAddress(kPeer1Addr);
+    NL_TEST_ASSERT(inSuite, connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+    NL_TEST_ASSERT(inSuite, expiryTimeMs == 201);
+    connections.ExpireInactiveConnections(100, onExpired);
+    NL_TEST_ASSERT(inSuite, callInfo.callCount == 4);
+    NL_TEST_ASSERT(inSuite, !connections.FindPeerConnectionState(kPeer3NodeId, nullptr));
+}
+
+template <bool kIndexed>
+using TestPool = PeerConnections<8, Time::Source::kTest, kIndexed>;
+
+void ExpectSameState(nlTestSuite * inSuite, TestPool<false> & linear, PeerConnectionState * linearState, TestPool<true> & indexed,
+                     PeerConnectionState * indexedState)
+{
+    NL_TEST_ASSERT(inSuite, (linearState == nullptr) == (indexedState == nullptr));
+    if (linearState != nullptr && indexedState != nullptr)
+    {
+        // Both pools allocate in the same order, so matching slots must be at the same offset.
+        NL_TEST_ASSERT(inSuite, (linearState - linear.FindPeerConnectionState(kAnyKeyId, nullptr)) ==
+                           (indexedState - indexed.FindPeerConnectionState(kAnyKeyId, nullptr)));
+        NL_TEST_ASSERT(inSuite, linearState->GetLocalKeyID() == indexedState->GetLocalKeyID());
+        NL_TEST_ASSERT(inSuite, linearState->GetPeerKeyID() == indexedState->GetPeerKeyID());
+        NL_TEST_ASSERT(inSuite, linearState->GetPeerNodeId() == indexedState->GetPeerNodeId());
+    }
+}
+
+void TestIndexedLookups(nlTestSuite * inSuite, void * inContext)
+{
+    TestPool<false> linear;
+    TestPool<true> indexed;
+    PeerConnectionState * linearState;
+    PeerConnectionState * indexedState;
+
+    // Slot 0 keeps the reference used for offset computation: it uses key id kAnyKeyId so
+    // FindPeerConnectionState(kAnyKeyId, nullptr) always returns the first slot.
+    NL_TEST_ASSERT(inSuite,
+                   linear.CreateNewPeerConnectionState(Optional<NodeId>::Missing(), 0, kAnyKeyId, &linearState) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   indexed.CreateNewPeerConnectionState(Optional<NodeId>::Missing(), 0, kAnyKeyId, &indexedState) == CHIP_NO_ERROR);
+
+    // Duplicated node ids and local keys exercise ordering within a probe run.
+    const struct
+    {
+        NodeId node;
+        uint16_t peerKey;
+        uint16_t localKey;
+    } kStates[] = {
+        { kPeer1NodeId, 10, 100 }, { kPeer2NodeId, 11, 101 },     { kPeer1NodeId, 12, 100 },
+        { kPeer3NodeId, 10, 102 }, { kUndefinedNodeId, 10, 103 }, { kPeer2NodeId, 13, 101 },
+    };
+
+    for (const auto & entry : kStates)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       linear.CreateNewPeerConnectionState(Optional<NodeId>::Value(entry.node), entry.peerKey, entry.localKey,
+                                                           nullptr) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       indexed.CreateNewPeerConnectionState(Optional<NodeId>::Value(entry.node), entry.peerKey, entry.localKey,
+                                                            nullptr) == CHIP_NO_ERROR);
+    }
+
+    auto compareAll = [&]() {
+        const NodeId nodes[]        = { kPeer1NodeId, kPeer2NodeId, kPeer3NodeId, kUndefinedNodeId, 999 };
+        const uint16_t localKeys[]  = { 100, 101, 102, 103, 104 };
+        const uint16_t peerKeys[]   = { 10, 11, 12, 13, 14, kAnyKeyId };
+        PeerConnectionState * lIter = nullptr;
+        PeerConnectionState * iIter = nullptr;
+
+        for (NodeId node : nodes)
+        {
+            lIter = nullptr;
+            iIter = nullptr;
+            do
+            {
+                lIter = linear.FindPeerConnectionState(node, lIter);
+                iIter = indexed.FindPeerConnectionState(node, iIter);
+                ExpectSameState(inSuite, linear, lIter, indexed, iIter);
+            } while (lIter != nullptr && iIter != nullptr);
+
+            for (uint16_t peerKey : peerKeys)
+            {
+                lIter = nullptr;
+                iIter = nullptr;
+                do
+                {
+                    lIter = linear.FindPeerConnectionState(Optional<NodeId>::Value(node), peerKey, lIter);
+                    iIter = indexed.FindPeerConnectionState(Optional<NodeId>::Value(node), peerKey, iIter);
+                    ExpectSameState(inSuite, linear, lIter, indexed, iIter);
+                } while (lIter != nullptr && iIter != nullptr);
+            }
+
+            for (uint16_t localKey : localKeys)
+            {
+                lIter = nullptr;
+                iIter = nullptr;
+                do
+                {
+                    lIter = linear.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Value(node), localKey, lIter);
+                    iIter = indexed.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Value(node), localKey, iIter);
+                    ExpectSameState(inSuite, linear, lIter, indexed, iIter);
+                } while (lIter != nullptr && iIter != nullptr);
+            }
+        }
+
+        for (uint16_t localKey : localKeys)
+        {
+            lIter = nullptr;
+            iIter = nullptr;
+            do
+            {
+                lIter = linear.FindPeerConnectionState(localKey, lIter);
+                iIter = indexed.FindPeerConnectionState(localKey, iIter);
+                ExpectSameState(inSuite, linear, lIter, indexed, iIter);
+            } while (lIter != nullptr && iIter != nullptr);
+        }
+    };
+
+    compareAll();
+
+    // Expire a state in the middle of a shared-key run and learn a node id for another one.
+    auto noop = [](const PeerConnectionState &) {};
+    linear.MarkConnectionExpired(linear.FindPeerConnectionState(static_cast<uint16_t>(100), nullptr), noop);
+    indexed.MarkConnectionExpired(indexed.FindPeerConnectionState(static_cast<uint16_t>(100), nullptr), noop);
+    linear.SetPeerNodeId(linear.FindPeerConnectionState(static_cast<uint16_t>(103), nullptr), kPeer3NodeId);
+    indexed.SetPeerNodeId(indexed.FindPeerConnectionState(static_cast<uint16_t>(103), nullptr), kPeer3NodeId);
+    compareAll();
+
+    // Reuse of the freed slot must be found again through the index.
+    NL_TEST_ASSERT(inSuite,
+                   linear.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer2NodeId), 14, 104, nullptr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   indexed.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer2NodeId), 14, 104, nullptr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, indexed.FindPeerConnectionState(static_cast<uint16_t>(104), nullptr) != nullptr);
+    compareAll();
+}
+
+void TestPathMtu(nlTestSuite * inSuite, void * inContext)
+{
+    PeerConnectionState state(kPeer1Addr);
+    const uint16_t kInitialLength = static_cast<uint16_t>(kMaxAppMessageLen + CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE - 1280);
+
+    // A UDP path starts at the default MTU, which lets messages carry the bytes it has above the IPv6 minimum.
+    NL_TEST_ASSERT(inSuite, state.GetPathMtu() == CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE);
+    NL_TEST_ASSERT(inSuite, state.GetMaxAppMessageLength() >= kMaxAppMessageLen);
+    NL_TEST_ASSERT(inSuite, state.GetMaxAppMessageLength() <= kInitialLength);
+
+    // A Packet Too Big message lowers the path MTU, but never below the IPv6 minimum.
+    state.ReducePathMtu(1000);
+    NL_TEST_ASSERT(inSuite, state.GetPathMtu() == PeerConnectionState::kMinPathMtu);
+    NL_TEST_ASSERT(inSuite, state.GetMaxAppMessageLength() == kMaxAppMessageLen);
+    state.ReducePathMtu(1400);
+    NL_TEST_ASSERT(inSuite, state.GetPathMtu() == PeerConnectionState::kMinPathMtu);
+
+    // TCP is a stream: its messages are only bound by the packet buffers.
+    state.SetPeerAddress(PeerAddress::TCP(kPeer1Addr.GetIPAddress()));
+    NL_TEST_ASSERT(inSuite, state.GetPathMtu() == 0);
+    NL_TEST_ASSERT(inSuite, state.GetMaxAppMessageLength() >= System::PacketBuffer::kMaxSize - kMaxTagLen);
+    state.ReducePathMtu(1000);
+    NL_TEST_ASSERT(inSuite, state.GetPathMtu() == 0);
+
+    // A new address is a new path, whose MTU is relearned.
+    state.SetPeerAddress(kPeer2Addr);
+    NL_TEST_ASSERT(inSuite, state.GetPathMtu() == CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE);
+}
+
 } // namespace
 
 // clang-format off
@@ -294,6 +522,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("FindByNodeId", TestFindByNodeId),
     NL_TEST_DEF("FindByKeyId", TestFindByKeyId),
     NL_TEST_DEF("ExpireConnections", TestExpireConnections),
+    NL_TEST_DEF("ExpireByActivity", TestExpireByActivity),
+    NL_TEST_DEF("IndexedLookups", TestIndexedLookups),
+    NL_TEST_DEF("PathMtu", TestPathMtu),
     NL_TEST_SENTINEL()
 };
 // clang-format on
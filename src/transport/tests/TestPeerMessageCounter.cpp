@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the PeerMessageCounter
+ *      class within the transport layer
+ *
+ */
+#include <support/UnitTestRegistration.h>
+#include <transport/PeerMessageCounter.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+
+constexpr uint32_t kWindowSize = PeerMessageCounter::kWindowSize;
+
+// Verifies the counter and commits it when it is accepted, as the secure session manager does for the messages it receives.
+CHIP_ERROR Receive(PeerMessageCounter & counter, uint32_t value)
+{
+    CHIP_ERROR err = counter.Verify(value);
+    if (err == CHIP_NO_ERROR)
+    {
+        counter.Commit(value);
+    }
+    return err;
+}
+
+void TestUnsynchronized(nlTestSuite * inSuite, void * inContext)
+{
+    PeerMessageCounter counter;
+
+    NL_TEST_ASSERT(inSuite, !counter.IsSynchronized());
+    NL_TEST_ASSERT(inSuite, counter.Verify(1000) == CHIP_NO_ERROR);
+
+    // The first counter committed is trusted.
+    counter.Commit(1000);
+    NL_TEST_ASSERT(inSuite, counter.IsSynchronized());
+    NL_TEST_ASSERT(inSuite, counter.GetMaxCounter() == 1000);
+    NL_TEST_ASSERT(inSuite, counter.Verify(1000) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(999) == CHIP_NO_ERROR);
+
+    counter.Reset();
+    NL_TEST_ASSERT(inSuite, !counter.IsSynchronized());
+    NL_TEST_ASSERT(inSuite, counter.Verify(1000) == CHIP_NO_ERROR);
+}
+
+void TestInOrder(nlTestSuite * inSuite, void * inContext)
+{
+    PeerMessageCounter counter;
+
+    counter.SetCounter(0);
+    for (uint32_t value = 1; value < 4 * kWindowSize; value++)
+    {
+        NL_TEST_ASSERT(inSuite, Receive(counter, value) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, Receive(counter, value) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+        NL_TEST_ASSERT(inSuite, Receive(counter, value - 1) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    }
+    NL_TEST_ASSERT(inSuite, counter.GetMaxCounter() == 4 * kWindowSize - 1);
+}
+
+void TestOutOfOrder(nlTestSuite * inSuite, void * inContext)
+{
+    PeerMessageCounter counter;
+
+    counter.SetCounter(100);
+
+    // Counters skipped over are let through when they arrive late, once each.
+    NL_TEST_ASSERT(inSuite, Receive(counter, 105) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Receive(counter, 103) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Receive(counter, 101) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Receive(counter, 103) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, Receive(counter, 102) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Receive(counter, 104) == CHIP_NO_ERROR);
+    for (uint32_t value = 100; value <= 105; value++)
+    {
+        NL_TEST_ASSERT(inSuite, counter.Verify(value) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    }
+    NL_TEST_ASSERT(inSuite, counter.GetMaxCounter() == 105);
+}
+
+void TestWindowEdges(nlTestSuite * inSuite, void * inContext)
+{
+    PeerMessageCounter counter;
+    const uint32_t base = 10 * kWindowSize;
+
+    counter.SetCounter(base);
+
+    // The oldest counter of the window is still told apart, the one below it is not.
+    NL_TEST_ASSERT(inSuite, Receive(counter, base - (kWindowSize - 1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Receive(counter, base - (kWindowSize - 1)) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, Receive(counter, base - kWindowSize) == CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW);
+
+    // Counters received on either side of a word boundary move along with the window.
+    NL_TEST_ASSERT(inSuite, Receive(counter, base - 63) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Receive(counter, base - 64) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Receive(counter, base + 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base - 63) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base - 64) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base - 62) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base - 65) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base - (kWindowSize - 1)) == CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW);
+
+    // Sliding by several words keeps the counters still within the window.
+    NL_TEST_ASSERT(inSuite, Receive(counter, base + 65) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base + 1) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base + 2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(base + 64) == CHIP_NO_ERROR);
+}
+
+void TestLargeJump(nlTestSuite * inSuite, void * inContext)
+{
+    PeerMessageCounter counter;
+
+    counter.SetCounter(5);
+    NL_TEST_ASSERT(inSuite, Receive(counter, 6) == CHIP_NO_ERROR);
+
+    // A jump past the whole window forgets every counter before it.
+    NL_TEST_ASSERT(inSuite, Receive(counter, 6 + 3 * kWindowSize) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(6) == CHIP_ERROR_MESSAGE_COUNTER_OUT_OF_WINDOW);
+    NL_TEST_ASSERT(inSuite, counter.Verify(7 + 2 * kWindowSize) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(6 + 3 * kWindowSize) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+
+    NL_TEST_ASSERT(inSuite, Receive(counter, UINT32_MAX) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter.Verify(UINT32_MAX) == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    NL_TEST_ASSERT(inSuite, counter.Verify(UINT32_MAX - 1) == CHIP_NO_ERROR);
+}
+
+} // namespace
+
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("Unsynchronized", TestUnsynchronized),
+    NL_TEST_DEF("InOrder", TestInOrder),
+    NL_TEST_DEF("OutOfOrder", TestOutOfOrder),
+    NL_TEST_DEF("WindowEdges", TestWindowEdges),
+    NL_TEST_DEF("LargeJump", TestLargeJump),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestPeerMessageCounter(void)
+{
+    nlTestSuite theSuite = { "Transport-PeerMessageCounter", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPeerMessageCounter)
@@ -0,0 +1,106 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the RoundTripTimeEstimator
+ *      class within the transport layer
+ *
+ */
+#include <support/UnitTestRegistration.h>
+#include <transport/RoundTripTimeEstimator.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip::Transport;
+
+constexpr uint32_t kGranularityMs = 64;
+
+void TestFirstSample(nlTestSuite * inSuite, void * inContext)
+{
+    RoundTripTimeEstimator estimator;
+
+    NL_TEST_ASSERT(inSuite, !estimator.HasSample());
+
+    // SRTT = R, RTTVAR = R / 2, RTO = SRTT + 4 * RTTVAR.
+    estimator.AddSample(200);
+    NL_TEST_ASSERT(inSuite, estimator.HasSample());
+    NL_TEST_ASSERT(inSuite, estimator.GetSampleCount() == 1);
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRttMs() == 200);
+    NL_TEST_ASSERT(inSuite, estimator.GetRttVarianceMs() == 100);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransmitTimeoutMs(kGranularityMs) == 600);
+}
+
+void TestSmoothing(nlTestSuite * inSuite, void * inContext)
+{
+    RoundTripTimeEstimator estimator;
+
+    estimator.AddSample(200);
+
+    // RTTVAR = 3/4 * 100 + 1/4 * |200 - 328| = 107, SRTT = 7/8 * 200 + 1/8 * 328 = 216.
+    estimator.AddSample(328);
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRttMs() == 216);
+    NL_TEST_ASSERT(inSuite, estimator.GetRttVarianceMs() == 107);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransmitTimeoutMs(kGranularityMs) == 216 + 428);
+
+    // A steady round-trip time converges, and the variance term then bottoms out at the granularity.
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(50);
+    }
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRttMs() <= 57);
+    NL_TEST_ASSERT(inSuite, estimator.GetRttVarianceMs() <= 2);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransmitTimeoutMs(kGranularityMs) == estimator.GetSmoothedRttMs() + kGranularityMs);
+}
+
+void TestLargeSamplesAndReset(nlTestSuite * inSuite, void * inContext)
+{
+    RoundTripTimeEstimator estimator;
+
+    // Out of range samples are clamped rather than overflowing the scaled state.
+    estimator.AddSample(UINT32_MAX);
+    estimator.AddSample(0);
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRttMs() < (UINT32_MAX >> 4));
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransmitTimeoutMs(kGranularityMs) > estimator.GetSmoothedRttMs());
+
+    estimator.Reset();
+    NL_TEST_ASSERT(inSuite, !estimator.HasSample());
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRttMs() == 0);
+}
+
+} // namespace
+
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("FirstSample", TestFirstSample),
+    NL_TEST_DEF("Smoothing", TestSmoothing),
+    NL_TEST_DEF("LargeSamplesAndReset", TestLargeSamplesAndReset),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestRoundTripTimeEstimator(void)
+{
+    nlTestSuite theSuite = { "Transport-RoundTripTimeEstimator", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestRoundTripTimeEstimator)
@@ -145,6 +145,110 @@ void SecureChannelDecryptTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
 }
 
+void SecureChannelInPlaceTest(nlTestSuite * inSuite, void * inContext)
+{
+    SecureSession channel;
+    SecureSession channel2;
+    const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90, 0xe1, 0x17, 0xa3, 0x2d, 0x4b, 0xd4, 0xe1, 0xe6 };
+    uint8_t expected[sizeof(plain_text)];
+    uint8_t buffer[sizeof(plain_text) + kMaxTagLen];
+    PacketHeader packetHeader;
+    MessageAuthenticationCode mac;
+    uint16_t taglen = 0;
+
+    const char * info = "Test Info";
+    const char * salt = "Test Salt";
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   channel.Init(keypair, keypair2.Pubkey(), (const uint8_t *) salt, sizeof(salt), (const uint8_t *) info,
+                                sizeof(info)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   channel2.Init(keypair2, keypair.Pubkey(), (const uint8_t *) salt, sizeof(salt), (const uint8_t *) info,
+                                 sizeof(info)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, channel.Encrypt(plain_text, sizeof(plain_text), expected, packetHeader, mac) == CHIP_NO_ERROR);
+
+    // Without room for the tag the data is left as it was
+    memcpy(buffer, plain_text, sizeof(plain_text));
+    NL_TEST_ASSERT(inSuite,
+                   channel.EncryptInPlace(buffer, sizeof(plain_text), kMaxTagLen - 1, packetHeader, taglen) ==
+                       CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, memcmp(buffer, plain_text, sizeof(plain_text)) == 0);
+
+    // The ciphertext replaces the data and the tag follows it
+    NL_TEST_ASSERT(inSuite,
+                   channel.EncryptInPlace(buffer, sizeof(plain_text), kMaxTagLen, packetHeader, taglen) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, taglen == MessageAuthenticationCode::TagLenForEncryptionType(packetHeader.GetEncryptionType()));
+    NL_TEST_ASSERT(inSuite, memcmp(buffer, expected, sizeof(expected)) == 0);
+    NL_TEST_ASSERT(inSuite, memcmp(buffer + sizeof(plain_text), mac.GetTag(), taglen) == 0);
+
+    NL_TEST_ASSERT(inSuite, channel2.DecryptInPlace(nullptr, sizeof(plain_text), packetHeader) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, channel2.DecryptInPlace(buffer, sizeof(plain_text), packetHeader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(buffer, plain_text, sizeof(plain_text)) == 0);
+
+    // A corrupted tag fails the integrity check
+    memcpy(buffer, expected, sizeof(expected));
+    buffer[sizeof(plain_text)] ^= 0x01;
+    NL_TEST_ASSERT(inSuite, channel2.DecryptInPlace(buffer, sizeof(plain_text), packetHeader) != CHIP_NO_ERROR);
+}
+
+void SecureChannelInitPairTest(nlTestSuite * inSuite, void * inContext)
+{
+    SecureSession sender;
+    SecureSession receiver;
+    SecureSession peerReceiver;
+    SecureSession peerSender;
+    const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90, 0xe1, 0x17, 0xa3, 0x2d, 0x4b, 0xd4, 0xe1, 0xe6 };
+    uint8_t encrypted[128];
+    uint8_t output[128];
+    PacketHeader packetHeader;
+    MessageAuthenticationCode mac;
+
+    const uint8_t secret[] = { 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b };
+    const char * salt      = "Test Salt";
+    const char * i2rInfo   = "Test I2R Info";
+    const char * r2iInfo   = "Test R2I Info";
+
+    NL_TEST_ASSERT(inSuite,
+                   SecureSession::InitPairFromSecret(secret, sizeof(secret), (const uint8_t *) salt, strlen(salt), nullptr, 0,
+                                                     sender, (const uint8_t *) r2iInfo, strlen(r2iInfo),
+                                                     receiver) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   SecureSession::InitPairFromSecret(secret, sizeof(secret), (const uint8_t *) salt, strlen(salt),
+                                                     (const uint8_t *) i2rInfo, strlen(i2rInfo), sender,
+                                                     (const uint8_t *) r2iInfo, strlen(r2iInfo), receiver) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   SecureSession::InitPairFromSecret(secret, sizeof(secret), (const uint8_t *) salt, strlen(salt),
+                                                     (const uint8_t *) i2rInfo, strlen(i2rInfo), sender,
+                                                     (const uint8_t *) r2iInfo, strlen(r2iInfo),
+                                                     receiver) == CHIP_ERROR_INCORRECT_STATE);
+
+    // The peer derives the same keys one session at a time
+    NL_TEST_ASSERT(inSuite,
+                   peerReceiver.InitFromSecret(secret, sizeof(secret), (const uint8_t *) salt, strlen(salt),
+                                               (const uint8_t *) i2rInfo, strlen(i2rInfo)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   peerSender.InitFromSecret(secret, sizeof(secret), (const uint8_t *) salt, strlen(salt),
+                                             (const uint8_t *) r2iInfo, strlen(r2iInfo)) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, sender.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, peerReceiver.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
+
+    NL_TEST_ASSERT(inSuite, peerSender.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
+
+    // The two directions use different keys
+    NL_TEST_ASSERT(inSuite, sender.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver.Decrypt(encrypted, sizeof(plain_text), output, packetHeader, mac) != CHIP_NO_ERROR);
+}
+
 // Test Suite
 
 /**
@@ -156,6 +260,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Init",    SecureChannelInitTest),
     NL_TEST_DEF("Encrypt", SecureChannelEncryptTest),
     NL_TEST_DEF("Decrypt", SecureChannelDecryptTest),
+    NL_TEST_DEF("InPlace", SecureChannelInPlaceTest),
+    NL_TEST_DEF("InitPair", SecureChannelInitPairTest),
 
     NL_TEST_SENTINEL()
 };
@@ -116,6 +116,13 @@ public:
         ReceiveHandlerCallCount++;
     }
 
+    void OnDuplicateMessageReceived(const PacketHeader & header, const PayloadHeader & payloadHeader, SecureSessionHandle session,
+                                    const Transport::PeerAddress & source, SecureSessionMgr * mgr) override
+    {
+        NL_TEST_ASSERT(mSuite, session == mRemoteToLocalSession);
+        DuplicateHandlerCallCount++;
+    }
+
     void OnNewConnection(SecureSessionHandle session, SecureSessionMgr * mgr) override
     {
         if (NewConnectionHandlerCallCount == 0)
@@ -124,13 +131,15 @@ public:
             mLocalToRemoteSession = session;
         NewConnectionHandlerCallCount++;
     }
-    void OnConnectionExpired(SecureSessionHandle session, SecureSessionMgr * mgr) override {}
+    void OnConnectionExpired(SecureSessionHandle session, SecureSessionMgr * mgr) override { ExpiredHandlerCallCount++; }
 
     nlTestSuite * mSuite = nullptr;
     SecureSessionHandle mRemoteToLocalSession;
     SecureSessionHandle mLocalToRemoteSession;
     int ReceiveHandlerCallCount       = 0;
+    int DuplicateHandlerCallCount     = 0;
     int NewConnectionHandlerCallCount = 0;
+    int ExpiredHandlerCallCount       = 0;
 
     bool LargeMessageSent = false;
 };
@@ -205,7 +214,8 @@ void CheckMessageTest(nlTestSuite * inSuite, void * inContext)
     SecureSessionHandle localToRemoteSession = callback.mLocalToRemoteSession;
 
     // Should be able to send a message to itself by just calling send.
-    callback.ReceiveHandlerCallCount = 0;
+    callback.ReceiveHandlerCallCount   = 0;
+    callback.DuplicateHandlerCallCount = 0;
 
     PayloadHeader payloadHeader;
 
@@ -297,7 +307,8 @@ void SendEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
     SecureSessionHandle localToRemoteSession = callback.mLocalToRemoteSession;
 
     // Should be able to send a message to itself by just calling send.
-    callback.ReceiveHandlerCallCount = 0;
+    callback.ReceiveHandlerCallCount   = 0;
+    callback.DuplicateHandlerCallCount = 0;
 
     PayloadHeader payloadHeader;
     EncryptedPacketBufferHandle msgBuf;
@@ -316,11 +327,13 @@ void SendEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
     ctx.DriveIOUntil(1000 /* ms */, []() { return callback.ReceiveHandlerCallCount != 0; });
     NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 1);
 
+    // Sending the same encrypted message again replays its message counter, which is reported as a duplicate.
     err = secureSessionMgr.SendEncryptedMessage(localToRemoteSession, std::move(msgBuf), nullptr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 
-    ctx.DriveIOUntil(1000 /* ms */, []() { return callback.ReceiveHandlerCallCount != 1; });
-    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 2);
+    ctx.DriveIOUntil(1000 /* ms */, []() { return callback.DuplicateHandlerCallCount != 0; });
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 1);
+    NL_TEST_ASSERT(inSuite, callback.DuplicateHandlerCallCount == 1);
 }
 
 void SendBadEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
@@ -373,7 +386,8 @@ void SendBadEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
     SecureSessionHandle localToRemoteSession = callback.mLocalToRemoteSession;
 
     // Should be able to send a message to itself by just calling send.
-    callback.ReceiveHandlerCallCount = 0;
+    callback.ReceiveHandlerCallCount   = 0;
+    callback.DuplicateHandlerCallCount = 0;
 
     PayloadHeader payloadHeader;
     EncryptedPacketBufferHandle msgBuf;
@@ -453,12 +467,167 @@ void SendBadEncryptedPacketTest(nlTestSuite * inSuite, void * inContext)
 
     NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 1);
 
-    // Send the correct encrypted msg
+    NL_TEST_ASSERT(inSuite, callback.DuplicateHandlerCallCount == 0);
+
+    // Send the correct encrypted msg, whose message counter was received already
     err = secureSessionMgr.SendEncryptedMessage(localToRemoteSession, std::move(msgBuf), nullptr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 
-    ctx.DriveIOUntil(1000 /* ms */, []() { return callback.ReceiveHandlerCallCount != 1; });
-    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 2);
+    ctx.DriveIOUntil(1000 /* ms */, []() { return callback.DuplicateHandlerCallCount != 0; });
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 1);
+    NL_TEST_ASSERT(inSuite, callback.DuplicateHandlerCallCount == 1);
+}
+
+class TestSessionRestorer : public SecureSessionRestoreDelegate
+{
+public:
+    CHIP_ERROR RestoreSession(uint16_t localKeyId, SecureSessionMgr & mgr) override
+    {
+        RestoreCallCount++;
+        VerifyOrReturnError(localKeyId == 2, CHIP_ERROR_KEY_NOT_FOUND);
+
+        SecurePairingUsingTestSecret pairing(1, 2);
+        return mgr.NewPairing(mPeer, kSourceNodeId, &pairing, SecureSessionMgr::PairingDirection::kInitiator, 1);
+    }
+
+    Optional<Transport::PeerAddress> mPeer;
+    int RestoreCallCount = 0;
+};
+
+void RestoreSessionTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    callback.LargeMessageSent = false;
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SecureSessionMgr secureSessionMgr;
+    TestSessionRestorer restorer;
+
+    err = transportMgr.Init("LOOPBACK");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    Transport::AdminPairingTable admins;
+    err = secureSessionMgr.Init(kSourceNodeId, ctx.GetInetLayer().SystemLayer(), &transportMgr, &admins);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    callback.mSuite = inSuite;
+
+    secureSessionMgr.SetDelegate(&callback);
+    secureSessionMgr.SetRestoreDelegate(&restorer);
+
+    Optional<Transport::PeerAddress> peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+    restorer.mPeer = peer;
+
+    Transport::AdminPairingInfo * admin = admins.AssignAdminId(0, kSourceNodeId);
+    NL_TEST_ASSERT(inSuite, admin != nullptr);
+
+    admin = admins.AssignAdminId(1, kDestinationNodeId);
+    NL_TEST_ASSERT(inSuite, admin != nullptr);
+
+    // Only the sending side of the loopback is paired, the receiving one is restored by the first message for its key.
+    callback.NewConnectionHandlerCallCount = 1;
+    SecurePairingUsingTestSecret pairing2(2, 1);
+    err = secureSessionMgr.NewPairing(peer, kDestinationNodeId, &pairing2, SecureSessionMgr::PairingDirection::kResponder, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SecureSessionHandle localToRemoteSession = callback.mLocalToRemoteSession;
+    callback.mRemoteToLocalSession           = SecureSessionHandle(kSourceNodeId, 1, 1);
+    callback.ReceiveHandlerCallCount         = 0;
+    callback.DuplicateHandlerCallCount       = 0;
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+
+    for (int i = 1; i <= 2; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        err = secureSessionMgr.SendMessage(localToRemoteSession, payloadHeader, std::move(buffer));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        ctx.DriveIOUntil(1000 /* ms */, [i]() { return callback.ReceiveHandlerCallCount == i; });
+        NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == i);
+
+        // The restored session receives the next messages.
+        NL_TEST_ASSERT(inSuite, restorer.RestoreCallCount == 1);
+    }
+}
+
+void ExpirePairingTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    callback.LargeMessageSent = false;
+
+    ctx.GetInetLayer().SystemLayer()->Init(nullptr);
+
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SecureSessionMgr secureSessionMgr;
+
+    err = transportMgr.Init("LOOPBACK");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    Transport::AdminPairingTable admins;
+    err = secureSessionMgr.Init(kSourceNodeId, ctx.GetInetLayer().SystemLayer(), &transportMgr, &admins);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    callback.mSuite = inSuite;
+
+    secureSessionMgr.SetDelegate(&callback);
+
+    Optional<Transport::PeerAddress> peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    Transport::AdminPairingInfo * admin = admins.AssignAdminId(0, kSourceNodeId);
+    NL_TEST_ASSERT(inSuite, admin != nullptr);
+
+    admin = admins.AssignAdminId(1, kDestinationNodeId);
+    NL_TEST_ASSERT(inSuite, admin != nullptr);
+
+    callback.NewConnectionHandlerCallCount = 0;
+    callback.ExpiredHandlerCallCount       = 0;
+
+    SecurePairingUsingTestSecret pairing1(1, 2);
+    err = secureSessionMgr.NewPairing(peer, kSourceNodeId, &pairing1, SecureSessionMgr::PairingDirection::kInitiator, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SecurePairingUsingTestSecret pairing2(2, 1);
+    err = secureSessionMgr.NewPairing(peer, kDestinationNodeId, &pairing2, SecureSessionMgr::PairingDirection::kResponder, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SecureSessionHandle localToRemoteSession = callback.mLocalToRemoteSession;
+    NL_TEST_ASSERT(inSuite, secureSessionMgr.GetPeerConnectionState(localToRemoteSession) != nullptr);
+
+    secureSessionMgr.ExpirePairing(localToRemoteSession);
+    NL_TEST_ASSERT(inSuite, callback.ExpiredHandlerCallCount == 1);
+    NL_TEST_ASSERT(inSuite, secureSessionMgr.GetPeerConnectionState(localToRemoteSession) == nullptr);
+    NL_TEST_ASSERT(inSuite, secureSessionMgr.GetPeerConnectionState(callback.mRemoteToLocalSession) != nullptr);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    err = secureSessionMgr.SendMessage(localToRemoteSession, payloadHeader, std::move(buffer));
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NOT_CONNECTED);
+
+    // An unknown session is left alone
+    secureSessionMgr.ExpirePairing(localToRemoteSession);
+    NL_TEST_ASSERT(inSuite, callback.ExpiredHandlerCallCount == 1);
 }
 
 // Test Suite
@@ -473,6 +642,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("Message Self Test",              CheckMessageTest),
     NL_TEST_DEF("Send Encrypted Packet Test",     SendEncryptedPacketTest),
     NL_TEST_DEF("Send Bad Encrypted Packet Test", SendBadEncryptedPacketTest),
+    NL_TEST_DEF("Restore Session Test",           RestoreSessionTest),
+    NL_TEST_DEF("Expire Pairing Test",            ExpirePairingTest),
 
     NL_TEST_SENTINEL()
 };